@@ -0,0 +1,6393 @@
+
+obj/user/testfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 09 00 00       	call   80094a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <xopen>:
+
+#define FVA ((struct Fd*)0xCCCCC000)
+
+static int
+xopen(const char *path, int mode)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	89 d3                	mov    %edx,%ebx
+	extern union Fsipc fsipcbuf;
+	envid_t fsenv;
+	
+	strcpy(fsipcbuf.open.req_path, path);
+  80003c:	50                   	push   %eax
+  80003d:	68 00 60 80 00       	push   $0x806000
+  800042:	e8 28 10 00 00       	call   80106f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  800047:	89 1d 00 64 80 00    	mov    %ebx,0x806400
+
+	fsenv = ipc_find_env(ENV_TYPE_FS);
+  80004d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800054:	e8 e7 1c 00 00       	call   801d40 <ipc_find_env>
+	ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800059:	6a 07                	push   $0x7
+  80005b:	68 00 60 80 00       	push   $0x806000
+  800060:	6a 01                	push   $0x1
+  800062:	50                   	push   %eax
+  800063:	e8 e3 1b 00 00       	call   801c4b <ipc_send>
+	return ipc_recv(NULL, FVA, NULL);
+  800068:	83 c4 1c             	add    $0x1c,%esp
+  80006b:	6a 00                	push   $0x0
+  80006d:	68 00 c0 cc cc       	push   $0xccccc000
+  800072:	6a 00                	push   $0x0
+  800074:	e8 0e 1b 00 00       	call   801b87 <ipc_recv>
+}
+  800079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007c:	c9                   	leave
+  80007d:	c3                   	ret
+
+0080007e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	57                   	push   %edi
+  800082:	56                   	push   %esi
+  800083:	53                   	push   %ebx
+  800084:	81 ec bc 02 00 00    	sub    $0x2bc,%esp
+	struct Fd fdcopy;
+	struct Stat st;
+	char buf[512];
+
+	// We open files manually first, to avoid the FD layer
+	if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80008a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008f:	b8 a0 2f 80 00       	mov    $0x802fa0,%eax
+  800094:	e8 9a ff ff ff       	call   800033 <xopen>
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	0f 89 91 04 00 00    	jns    800532 <umain+0x4b4>
+  8000a1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8000a4:	0f 85 76 04 00 00    	jne    800520 <umain+0x4a2>
+		panic("serve_open /not-found: %e", r);
+	else if (r >= 0)
+		panic("serve_open /not-found succeeded!");
+
+	if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000af:	b8 d5 2f 80 00       	mov    $0x802fd5,%eax
+  8000b4:	e8 7a ff ff ff       	call   800033 <xopen>
+  8000b9:	85 c0                	test   %eax,%eax
+  8000bb:	0f 88 85 04 00 00    	js     800546 <umain+0x4c8>
+		panic("serve_open /newmotd: %e", r);
+	if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8000c1:	83 3d 00 c0 cc cc 66 	cmpl   $0x66,0xccccc000
+  8000c8:	0f 85 8a 04 00 00    	jne    800558 <umain+0x4da>
+  8000ce:	83 3d 04 c0 cc cc 00 	cmpl   $0x0,0xccccc004
+  8000d5:	0f 85 7d 04 00 00    	jne    800558 <umain+0x4da>
+  8000db:	83 3d 08 c0 cc cc 00 	cmpl   $0x0,0xccccc008
+  8000e2:	0f 85 70 04 00 00    	jne    800558 <umain+0x4da>
+		panic("serve_open did not fill struct Fd correctly\n");
+	cprintf("serve_open is good\n");
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	68 f6 2f 80 00       	push   $0x802ff6
+  8000f0:	e8 93 09 00 00       	call   800a88 <cprintf>
+
+	if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  8000f5:	83 c4 08             	add    $0x8,%esp
+  8000f8:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  8000fe:	50                   	push   %eax
+  8000ff:	68 00 c0 cc cc       	push   $0xccccc000
+  800104:	ff 15 1c 40 80 00    	call   *0x80401c
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	85 c0                	test   %eax,%eax
+  80010f:	0f 88 57 04 00 00    	js     80056c <umain+0x4ee>
+		panic("file_stat: %e", r);
+	if (strlen(msg) != st.st_size)
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	ff 35 00 40 80 00    	push   0x804000
+  80011e:	e8 11 0f 00 00       	call   801034 <strlen>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	3b 45 cc             	cmp    -0x34(%ebp),%eax
+  800129:	0f 85 4f 04 00 00    	jne    80057e <umain+0x500>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+	cprintf("file_stat is good\n");
+  80012f:	83 ec 0c             	sub    $0xc,%esp
+  800132:	68 18 30 80 00       	push   $0x803018
+  800137:	e8 4c 09 00 00       	call   800a88 <cprintf>
+
+	memset(buf, 0, sizeof buf);
+  80013c:	83 c4 0c             	add    $0xc,%esp
+  80013f:	68 00 02 00 00       	push   $0x200
+  800144:	6a 00                	push   $0x0
+  800146:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  80014c:	53                   	push   %ebx
+  80014d:	e8 6e 10 00 00       	call   8011c0 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800152:	83 c4 0c             	add    $0xc,%esp
+  800155:	68 00 02 00 00       	push   $0x200
+  80015a:	53                   	push   %ebx
+  80015b:	68 00 c0 cc cc       	push   $0xccccc000
+  800160:	ff 15 10 40 80 00    	call   *0x804010
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	0f 88 32 04 00 00    	js     8005a3 <umain+0x525>
+		panic("file_read: %e", r);
+	if (strcmp(buf, msg) != 0)
+  800171:	83 ec 08             	sub    $0x8,%esp
+  800174:	ff 35 00 40 80 00    	push   0x804000
+  80017a:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	e8 9a 0f 00 00       	call   801120 <strcmp>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 85 24 04 00 00    	jne    8005b5 <umain+0x537>
+		panic("file_read returned wrong data");
+	cprintf("file_read is good\n");
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	68 57 30 80 00       	push   $0x803057
+  800199:	e8 ea 08 00 00       	call   800a88 <cprintf>
+
+	if ((r = devfile.dev_close(FVA)) < 0)
+  80019e:	c7 04 24 00 c0 cc cc 	movl   $0xccccc000,(%esp)
+  8001a5:	ff 15 18 40 80 00    	call   *0x804018
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	0f 88 13 04 00 00    	js     8005c9 <umain+0x54b>
+		panic("file_close: %e", r);
+	cprintf("file_close is good\n");
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  8001b9:	68 79 30 80 00       	push   $0x803079
+  8001be:	e8 c5 08 00 00       	call   800a88 <cprintf>
+
+	// We're about to unmap the FD, but still need a way to get
+	// the stale filenum to serve_read, so we make a local copy.
+	// The file server won't think it's stale until we unmap the
+	// FD page.
+	fdcopy = *FVA;
+  8001c3:	a1 00 c0 cc cc       	mov    0xccccc000,%eax
+  8001c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001cb:	a1 04 c0 cc cc       	mov    0xccccc004,%eax
+  8001d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001d3:	a1 08 c0 cc cc       	mov    0xccccc008,%eax
+  8001d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001db:	a1 0c c0 cc cc       	mov    0xccccc00c,%eax
+  8001e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	sys_page_unmap(0, FVA);
+  8001e3:	83 c4 08             	add    $0x8,%esp
+  8001e6:	68 00 c0 cc cc       	push   $0xccccc000
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	e8 f5 13 00 00       	call   8015e7 <sys_page_unmap>
+
+	if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	68 00 02 00 00       	push   $0x200
+  8001fa:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800200:	50                   	push   %eax
+  800201:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800204:	50                   	push   %eax
+  800205:	ff 15 10 40 80 00    	call   *0x804010
+  80020b:	83 c4 10             	add    $0x10,%esp
+  80020e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800211:	0f 85 c4 03 00 00    	jne    8005db <umain+0x55d>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+	cprintf("stale fileid is good\n");
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	68 8d 30 80 00       	push   $0x80308d
+  80021f:	e8 64 08 00 00       	call   800a88 <cprintf>
+
+	// Try writing
+	if ((r = xopen("/new-file", O_RDWR|O_CREAT)) < 0)
+  800224:	ba 02 01 00 00       	mov    $0x102,%edx
+  800229:	b8 a3 30 80 00       	mov    $0x8030a3,%eax
+  80022e:	e8 00 fe ff ff       	call   800033 <xopen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 88 af 03 00 00    	js     8005ed <umain+0x56f>
+		panic("serve_open /new-file: %e", r);
+
+	if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  80023e:	8b 1d 14 40 80 00    	mov    0x804014,%ebx
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	ff 35 00 40 80 00    	push   0x804000
+  80024d:	e8 e2 0d 00 00       	call   801034 <strlen>
+  800252:	83 c4 0c             	add    $0xc,%esp
+  800255:	50                   	push   %eax
+  800256:	ff 35 00 40 80 00    	push   0x804000
+  80025c:	68 00 c0 cc cc       	push   $0xccccc000
+  800261:	ff d3                	call   *%ebx
+  800263:	89 c3                	mov    %eax,%ebx
+  800265:	83 c4 04             	add    $0x4,%esp
+  800268:	ff 35 00 40 80 00    	push   0x804000
+  80026e:	e8 c1 0d 00 00       	call   801034 <strlen>
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	39 d8                	cmp    %ebx,%eax
+  800278:	0f 85 81 03 00 00    	jne    8005ff <umain+0x581>
+		panic("file_write: %e", r);
+	cprintf("file_write is good\n");
+  80027e:	83 ec 0c             	sub    $0xc,%esp
+  800281:	68 d5 30 80 00       	push   $0x8030d5
+  800286:	e8 fd 07 00 00       	call   800a88 <cprintf>
+
+	FVA->fd_offset = 0;
+  80028b:	c7 05 04 c0 cc cc 00 	movl   $0x0,0xccccc004
+  800292:	00 00 00 
+	memset(buf, 0, sizeof buf);
+  800295:	83 c4 0c             	add    $0xc,%esp
+  800298:	68 00 02 00 00       	push   $0x200
+  80029d:	6a 00                	push   $0x0
+  80029f:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  8002a5:	53                   	push   %ebx
+  8002a6:	e8 15 0f 00 00       	call   8011c0 <memset>
+	if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8002ab:	83 c4 0c             	add    $0xc,%esp
+  8002ae:	68 00 02 00 00       	push   $0x200
+  8002b3:	53                   	push   %ebx
+  8002b4:	68 00 c0 cc cc       	push   $0xccccc000
+  8002b9:	ff 15 10 40 80 00    	call   *0x804010
+  8002bf:	89 c3                	mov    %eax,%ebx
+  8002c1:	83 c4 10             	add    $0x10,%esp
+  8002c4:	85 c0                	test   %eax,%eax
+  8002c6:	0f 88 45 03 00 00    	js     800611 <umain+0x593>
+		panic("file_read after file_write: %e", r);
+	if (r != strlen(msg))
+  8002cc:	83 ec 0c             	sub    $0xc,%esp
+  8002cf:	ff 35 00 40 80 00    	push   0x804000
+  8002d5:	e8 5a 0d 00 00       	call   801034 <strlen>
+  8002da:	83 c4 10             	add    $0x10,%esp
+  8002dd:	39 d8                	cmp    %ebx,%eax
+  8002df:	0f 85 3e 03 00 00    	jne    800623 <umain+0x5a5>
+		panic("file_read after file_write returned wrong length: %d", r);
+	if (strcmp(buf, msg) != 0)
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	ff 35 00 40 80 00    	push   0x804000
+  8002ee:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	e8 26 0e 00 00       	call   801120 <strcmp>
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	85 c0                	test   %eax,%eax
+  8002ff:	0f 85 30 03 00 00    	jne    800635 <umain+0x5b7>
+		panic("file_read after file_write returned wrong data");
+	cprintf("file_read after file_write is good\n");
+  800305:	83 ec 0c             	sub    $0xc,%esp
+  800308:	68 34 33 80 00       	push   $0x803334
+  80030d:	e8 76 07 00 00       	call   800a88 <cprintf>
+
+	// Now we'll try out open
+	if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800312:	83 c4 08             	add    $0x8,%esp
+  800315:	6a 00                	push   $0x0
+  800317:	68 a0 2f 80 00       	push   $0x802fa0
+  80031c:	e8 73 22 00 00       	call   802594 <open>
+  800321:	83 c4 10             	add    $0x10,%esp
+  800324:	85 c0                	test   %eax,%eax
+  800326:	0f 89 2f 03 00 00    	jns    80065b <umain+0x5dd>
+  80032c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80032f:	0f 85 14 03 00 00    	jne    800649 <umain+0x5cb>
+		panic("open /not-found: %e", r);
+	else if (r >= 0)
+		panic("open /not-found succeeded!");
+
+	if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800335:	83 ec 08             	sub    $0x8,%esp
+  800338:	6a 00                	push   $0x0
+  80033a:	68 d5 2f 80 00       	push   $0x802fd5
+  80033f:	e8 50 22 00 00       	call   802594 <open>
+  800344:	83 c4 10             	add    $0x10,%esp
+  800347:	85 c0                	test   %eax,%eax
+  800349:	0f 88 20 03 00 00    	js     80066f <umain+0x5f1>
+		panic("open /newmotd: %e", r);
+	fd = (struct Fd*) (0xD0000000 + r*PGSIZE);
+  80034f:	c1 e0 0c             	shl    $0xc,%eax
+  800352:	8d 90 00 00 00 d0    	lea    -0x30000000(%eax),%edx
+	if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800358:	83 b8 00 00 00 d0 66 	cmpl   $0x66,-0x30000000(%eax)
+  80035f:	0f 85 1c 03 00 00    	jne    800681 <umain+0x603>
+  800365:	83 7a 04 00          	cmpl   $0x0,0x4(%edx)
+  800369:	0f 85 12 03 00 00    	jne    800681 <umain+0x603>
+  80036f:	8b 42 08             	mov    0x8(%edx),%eax
+  800372:	89 85 44 fd ff ff    	mov    %eax,-0x2bc(%ebp)
+  800378:	85 c0                	test   %eax,%eax
+  80037a:	0f 85 01 03 00 00    	jne    800681 <umain+0x603>
+		panic("open did not fill struct Fd correctly\n");
+	cprintf("open is good\n");
+  800380:	83 ec 0c             	sub    $0xc,%esp
+  800383:	68 fc 2f 80 00       	push   $0x802ffc
+  800388:	e8 fb 06 00 00       	call   800a88 <cprintf>
+
+	// Try files with indirect blocks
+	if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
+  80038d:	83 c4 08             	add    $0x8,%esp
+  800390:	68 01 01 00 00       	push   $0x101
+  800395:	68 04 31 80 00       	push   $0x803104
+  80039a:	e8 f5 21 00 00       	call   802594 <open>
+  80039f:	89 c6                	mov    %eax,%esi
+  8003a1:	83 c4 10             	add    $0x10,%esp
+  8003a4:	85 c0                	test   %eax,%eax
+  8003a6:	0f 88 e9 02 00 00    	js     800695 <umain+0x617>
+		panic("creat /big: %e", f);
+	memset(buf, 0, sizeof(buf));
+  8003ac:	83 ec 04             	sub    $0x4,%esp
+  8003af:	68 00 02 00 00       	push   $0x200
+  8003b4:	6a 00                	push   $0x0
+  8003b6:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003bc:	50                   	push   %eax
+  8003bd:	e8 fe 0d 00 00       	call   8011c0 <memset>
+  8003c2:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < (NEXTENT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003c5:	8b 9d 44 fd ff ff    	mov    -0x2bc(%ebp),%ebx
+		*(int*)buf = i;
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  8003cb:	8d bd 4c fd ff ff    	lea    -0x2b4(%ebp),%edi
+		*(int*)buf = i;
+  8003d1:	89 9d 4c fd ff ff    	mov    %ebx,-0x2b4(%ebp)
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  8003d7:	83 ec 04             	sub    $0x4,%esp
+  8003da:	68 00 02 00 00       	push   $0x200
+  8003df:	57                   	push   %edi
+  8003e0:	56                   	push   %esi
+  8003e1:	e8 41 1d 00 00       	call   802127 <write>
+  8003e6:	83 c4 10             	add    $0x10,%esp
+  8003e9:	85 c0                	test   %eax,%eax
+  8003eb:	0f 88 b6 02 00 00    	js     8006a7 <umain+0x629>
+	for (i = 0; i < (NEXTENT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003f1:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  8003f7:	89 c3                	mov    %eax,%ebx
+  8003f9:	3d 00 a0 02 00       	cmp    $0x2a000,%eax
+  8003fe:	75 d1                	jne    8003d1 <umain+0x353>
+			panic("write /big@%d: %e", i, r);
+	}
+	close(f);
+  800400:	83 ec 0c             	sub    $0xc,%esp
+  800403:	56                   	push   %esi
+  800404:	e8 14 1b 00 00       	call   801f1d <close>
+
+	if ((f = open("/big", O_RDONLY)) < 0)
+  800409:	83 c4 08             	add    $0x8,%esp
+  80040c:	6a 00                	push   $0x0
+  80040e:	68 04 31 80 00       	push   $0x803104
+  800413:	e8 7c 21 00 00       	call   802594 <open>
+  800418:	89 c7                	mov    %eax,%edi
+  80041a:	83 c4 10             	add    $0x10,%esp
+  80041d:	85 c0                	test   %eax,%eax
+  80041f:	0f 88 98 02 00 00    	js     8006bd <umain+0x63f>
+		panic("open /big: %e", f);
+	for (i = 0; i < (NEXTENT*3)*BLKSIZE; i += sizeof(buf)) {
+  800425:	8b 9d 44 fd ff ff    	mov    -0x2bc(%ebp),%ebx
+		*(int*)buf = i;
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  80042b:	8d b5 4c fd ff ff    	lea    -0x2b4(%ebp),%esi
+		*(int*)buf = i;
+  800431:	89 9d 4c fd ff ff    	mov    %ebx,-0x2b4(%ebp)
+		if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800437:	83 ec 04             	sub    $0x4,%esp
+  80043a:	68 00 02 00 00       	push   $0x200
+  80043f:	56                   	push   %esi
+  800440:	57                   	push   %edi
+  800441:	e8 9a 1c 00 00       	call   8020e0 <readn>
+  800446:	83 c4 10             	add    $0x10,%esp
+  800449:	85 c0                	test   %eax,%eax
+  80044b:	0f 88 7e 02 00 00    	js     8006cf <umain+0x651>
+			panic("read /big@%d: %e", i, r);
+		if (r != sizeof(buf))
+  800451:	3d 00 02 00 00       	cmp    $0x200,%eax
+  800456:	0f 85 89 02 00 00    	jne    8006e5 <umain+0x667>
+			panic("read /big from %d returned %d < %d bytes",
+			      i, r, sizeof(buf));
+		if (*(int*)buf != i)
+  80045c:	8b 85 4c fd ff ff    	mov    -0x2b4(%ebp),%eax
+  800462:	39 d8                	cmp    %ebx,%eax
+  800464:	0f 85 96 02 00 00    	jne    800700 <umain+0x682>
+	for (i = 0; i < (NEXTENT*3)*BLKSIZE; i += sizeof(buf)) {
+  80046a:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  800470:	89 c3                	mov    %eax,%ebx
+  800472:	3d 00 a0 02 00       	cmp    $0x2a000,%eax
+  800477:	75 b8                	jne    800431 <umain+0x3b3>
+			panic("read /big from %d returned bad data %d",
+			      i, *(int*)buf);
+	}
+	close(f);
+  800479:	83 ec 0c             	sub    $0xc,%esp
+  80047c:	57                   	push   %edi
+  80047d:	e8 9b 1a 00 00       	call   801f1d <close>
+	cprintf("large file is good\n");
+  800482:	c7 04 24 49 31 80 00 	movl   $0x803149,(%esp)
+  800489:	e8 fa 05 00 00       	call   800a88 <cprintf>
+
+	// Try a file with more extents than fit in its struct File: every
+	// other block is left a hole, so each block written is an extent
+	// of its own, and so is each hole.
+	if ((f = open("/holes", O_RDWR|O_CREAT)) < 0)
+  80048e:	83 c4 08             	add    $0x8,%esp
+  800491:	68 02 01 00 00       	push   $0x102
+  800496:	68 5d 31 80 00       	push   $0x80315d
+  80049b:	e8 f4 20 00 00       	call   802594 <open>
+  8004a0:	89 c7                	mov    %eax,%edi
+  8004a2:	83 c4 10             	add    $0x10,%esp
+  8004a5:	85 c0                	test   %eax,%eax
+  8004a7:	0f 88 69 02 00 00    	js     800716 <umain+0x698>
+		panic("creat /holes: %e", f);
+	for (i = 0; i < NEXTENT*3; i++) {
+  8004ad:	8b 9d 44 fd ff ff    	mov    -0x2bc(%ebp),%ebx
+		seek(f, 2*i*BLKSIZE);
+  8004b3:	89 de                	mov    %ebx,%esi
+  8004b5:	c1 e6 0d             	shl    $0xd,%esi
+  8004b8:	83 ec 08             	sub    $0x8,%esp
+  8004bb:	56                   	push   %esi
+  8004bc:	57                   	push   %edi
+  8004bd:	e8 e7 1c 00 00       	call   8021a9 <seek>
+		*(int*)buf = i;
+  8004c2:	89 9d 4c fd ff ff    	mov    %ebx,-0x2b4(%ebp)
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+  8004c8:	83 c4 0c             	add    $0xc,%esp
+  8004cb:	68 00 02 00 00       	push   $0x200
+  8004d0:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8004d6:	50                   	push   %eax
+  8004d7:	57                   	push   %edi
+  8004d8:	e8 4a 1c 00 00       	call   802127 <write>
+  8004dd:	83 c4 10             	add    $0x10,%esp
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	0f 88 43 02 00 00    	js     80072b <umain+0x6ad>
+	for (i = 0; i < NEXTENT*3; i++) {
+  8004e8:	83 c3 01             	add    $0x1,%ebx
+  8004eb:	83 fb 2a             	cmp    $0x2a,%ebx
+  8004ee:	75 c3                	jne    8004b3 <umain+0x435>
+			panic("write /holes@%d: %e", 2*i*BLKSIZE, r);
+	}
+	close(f);
+  8004f0:	83 ec 0c             	sub    $0xc,%esp
+  8004f3:	57                   	push   %edi
+  8004f4:	e8 24 1a 00 00       	call   801f1d <close>
+
+	if ((f = open("/holes", O_RDWR)) < 0)
+  8004f9:	83 c4 08             	add    $0x8,%esp
+  8004fc:	6a 02                	push   $0x2
+  8004fe:	68 5d 31 80 00       	push   $0x80315d
+  800503:	e8 8c 20 00 00       	call   802594 <open>
+  800508:	89 c6                	mov    %eax,%esi
+  80050a:	83 c4 10             	add    $0x10,%esp
+  80050d:	85 c0                	test   %eax,%eax
+  80050f:	0f 88 2f 02 00 00    	js     800744 <umain+0x6c6>
+		panic("open /holes: %e", f);
+	for (i = 0; i < NEXTENT*3*2 - 1; i++) {
+  800515:	8b 9d 44 fd ff ff    	mov    -0x2bc(%ebp),%ebx
+  80051b:	e9 5f 02 00 00       	jmp    80077f <umain+0x701>
+		panic("serve_open /not-found: %e", r);
+  800520:	50                   	push   %eax
+  800521:	68 ab 2f 80 00       	push   $0x802fab
+  800526:	6a 20                	push   $0x20
+  800528:	68 c5 2f 80 00       	push   $0x802fc5
+  80052d:	e8 7b 04 00 00       	call   8009ad <_panic>
+		panic("serve_open /not-found succeeded!");
+  800532:	83 ec 04             	sub    $0x4,%esp
+  800535:	68 f8 31 80 00       	push   $0x8031f8
+  80053a:	6a 22                	push   $0x22
+  80053c:	68 c5 2f 80 00       	push   $0x802fc5
+  800541:	e8 67 04 00 00       	call   8009ad <_panic>
+		panic("serve_open /newmotd: %e", r);
+  800546:	50                   	push   %eax
+  800547:	68 de 2f 80 00       	push   $0x802fde
+  80054c:	6a 25                	push   $0x25
+  80054e:	68 c5 2f 80 00       	push   $0x802fc5
+  800553:	e8 55 04 00 00       	call   8009ad <_panic>
+		panic("serve_open did not fill struct Fd correctly\n");
+  800558:	83 ec 04             	sub    $0x4,%esp
+  80055b:	68 1c 32 80 00       	push   $0x80321c
+  800560:	6a 27                	push   $0x27
+  800562:	68 c5 2f 80 00       	push   $0x802fc5
+  800567:	e8 41 04 00 00       	call   8009ad <_panic>
+		panic("file_stat: %e", r);
+  80056c:	50                   	push   %eax
+  80056d:	68 0a 30 80 00       	push   $0x80300a
+  800572:	6a 2b                	push   $0x2b
+  800574:	68 c5 2f 80 00       	push   $0x802fc5
+  800579:	e8 2f 04 00 00       	call   8009ad <_panic>
+		panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  80057e:	83 ec 0c             	sub    $0xc,%esp
+  800581:	ff 35 00 40 80 00    	push   0x804000
+  800587:	e8 a8 0a 00 00       	call   801034 <strlen>
+  80058c:	89 04 24             	mov    %eax,(%esp)
+  80058f:	ff 75 cc             	push   -0x34(%ebp)
+  800592:	68 4c 32 80 00       	push   $0x80324c
+  800597:	6a 2d                	push   $0x2d
+  800599:	68 c5 2f 80 00       	push   $0x802fc5
+  80059e:	e8 0a 04 00 00       	call   8009ad <_panic>
+		panic("file_read: %e", r);
+  8005a3:	50                   	push   %eax
+  8005a4:	68 2b 30 80 00       	push   $0x80302b
+  8005a9:	6a 32                	push   $0x32
+  8005ab:	68 c5 2f 80 00       	push   $0x802fc5
+  8005b0:	e8 f8 03 00 00       	call   8009ad <_panic>
+		panic("file_read returned wrong data");
+  8005b5:	83 ec 04             	sub    $0x4,%esp
+  8005b8:	68 39 30 80 00       	push   $0x803039
+  8005bd:	6a 34                	push   $0x34
+  8005bf:	68 c5 2f 80 00       	push   $0x802fc5
+  8005c4:	e8 e4 03 00 00       	call   8009ad <_panic>
+		panic("file_close: %e", r);
+  8005c9:	50                   	push   %eax
+  8005ca:	68 6a 30 80 00       	push   $0x80306a
+  8005cf:	6a 38                	push   $0x38
+  8005d1:	68 c5 2f 80 00       	push   $0x802fc5
+  8005d6:	e8 d2 03 00 00       	call   8009ad <_panic>
+		panic("serve_read does not handle stale fileids correctly: %e", r);
+  8005db:	50                   	push   %eax
+  8005dc:	68 74 32 80 00       	push   $0x803274
+  8005e1:	6a 43                	push   $0x43
+  8005e3:	68 c5 2f 80 00       	push   $0x802fc5
+  8005e8:	e8 c0 03 00 00       	call   8009ad <_panic>
+		panic("serve_open /new-file: %e", r);
+  8005ed:	50                   	push   %eax
+  8005ee:	68 ad 30 80 00       	push   $0x8030ad
+  8005f3:	6a 48                	push   $0x48
+  8005f5:	68 c5 2f 80 00       	push   $0x802fc5
+  8005fa:	e8 ae 03 00 00       	call   8009ad <_panic>
+		panic("file_write: %e", r);
+  8005ff:	53                   	push   %ebx
+  800600:	68 c6 30 80 00       	push   $0x8030c6
+  800605:	6a 4b                	push   $0x4b
+  800607:	68 c5 2f 80 00       	push   $0x802fc5
+  80060c:	e8 9c 03 00 00       	call   8009ad <_panic>
+		panic("file_read after file_write: %e", r);
+  800611:	50                   	push   %eax
+  800612:	68 ac 32 80 00       	push   $0x8032ac
+  800617:	6a 51                	push   $0x51
+  800619:	68 c5 2f 80 00       	push   $0x802fc5
+  80061e:	e8 8a 03 00 00       	call   8009ad <_panic>
+		panic("file_read after file_write returned wrong length: %d", r);
+  800623:	53                   	push   %ebx
+  800624:	68 cc 32 80 00       	push   $0x8032cc
+  800629:	6a 53                	push   $0x53
+  80062b:	68 c5 2f 80 00       	push   $0x802fc5
+  800630:	e8 78 03 00 00       	call   8009ad <_panic>
+		panic("file_read after file_write returned wrong data");
+  800635:	83 ec 04             	sub    $0x4,%esp
+  800638:	68 04 33 80 00       	push   $0x803304
+  80063d:	6a 55                	push   $0x55
+  80063f:	68 c5 2f 80 00       	push   $0x802fc5
+  800644:	e8 64 03 00 00       	call   8009ad <_panic>
+		panic("open /not-found: %e", r);
+  800649:	50                   	push   %eax
+  80064a:	68 b1 2f 80 00       	push   $0x802fb1
+  80064f:	6a 5a                	push   $0x5a
+  800651:	68 c5 2f 80 00       	push   $0x802fc5
+  800656:	e8 52 03 00 00       	call   8009ad <_panic>
+		panic("open /not-found succeeded!");
+  80065b:	83 ec 04             	sub    $0x4,%esp
+  80065e:	68 e9 30 80 00       	push   $0x8030e9
+  800663:	6a 5c                	push   $0x5c
+  800665:	68 c5 2f 80 00       	push   $0x802fc5
+  80066a:	e8 3e 03 00 00       	call   8009ad <_panic>
+		panic("open /newmotd: %e", r);
+  80066f:	50                   	push   %eax
+  800670:	68 e4 2f 80 00       	push   $0x802fe4
+  800675:	6a 5f                	push   $0x5f
+  800677:	68 c5 2f 80 00       	push   $0x802fc5
+  80067c:	e8 2c 03 00 00       	call   8009ad <_panic>
+		panic("open did not fill struct Fd correctly\n");
+  800681:	83 ec 04             	sub    $0x4,%esp
+  800684:	68 58 33 80 00       	push   $0x803358
+  800689:	6a 62                	push   $0x62
+  80068b:	68 c5 2f 80 00       	push   $0x802fc5
+  800690:	e8 18 03 00 00       	call   8009ad <_panic>
+		panic("creat /big: %e", f);
+  800695:	50                   	push   %eax
+  800696:	68 09 31 80 00       	push   $0x803109
+  80069b:	6a 67                	push   $0x67
+  80069d:	68 c5 2f 80 00       	push   $0x802fc5
+  8006a2:	e8 06 03 00 00       	call   8009ad <_panic>
+			panic("write /big@%d: %e", i, r);
+  8006a7:	83 ec 0c             	sub    $0xc,%esp
+  8006aa:	50                   	push   %eax
+  8006ab:	53                   	push   %ebx
+  8006ac:	68 18 31 80 00       	push   $0x803118
+  8006b1:	6a 6c                	push   $0x6c
+  8006b3:	68 c5 2f 80 00       	push   $0x802fc5
+  8006b8:	e8 f0 02 00 00       	call   8009ad <_panic>
+		panic("open /big: %e", f);
+  8006bd:	50                   	push   %eax
+  8006be:	68 2a 31 80 00       	push   $0x80312a
+  8006c3:	6a 71                	push   $0x71
+  8006c5:	68 c5 2f 80 00       	push   $0x802fc5
+  8006ca:	e8 de 02 00 00       	call   8009ad <_panic>
+			panic("read /big@%d: %e", i, r);
+  8006cf:	83 ec 0c             	sub    $0xc,%esp
+  8006d2:	50                   	push   %eax
+  8006d3:	53                   	push   %ebx
+  8006d4:	68 38 31 80 00       	push   $0x803138
+  8006d9:	6a 75                	push   $0x75
+  8006db:	68 c5 2f 80 00       	push   $0x802fc5
+  8006e0:	e8 c8 02 00 00       	call   8009ad <_panic>
+			panic("read /big from %d returned %d < %d bytes",
+  8006e5:	83 ec 08             	sub    $0x8,%esp
+  8006e8:	68 00 02 00 00       	push   $0x200
+  8006ed:	50                   	push   %eax
+  8006ee:	53                   	push   %ebx
+  8006ef:	68 80 33 80 00       	push   $0x803380
+  8006f4:	6a 77                	push   $0x77
+  8006f6:	68 c5 2f 80 00       	push   $0x802fc5
+  8006fb:	e8 ad 02 00 00       	call   8009ad <_panic>
+			panic("read /big from %d returned bad data %d",
+  800700:	83 ec 0c             	sub    $0xc,%esp
+  800703:	50                   	push   %eax
+  800704:	53                   	push   %ebx
+  800705:	68 ac 33 80 00       	push   $0x8033ac
+  80070a:	6a 7a                	push   $0x7a
+  80070c:	68 c5 2f 80 00       	push   $0x802fc5
+  800711:	e8 97 02 00 00       	call   8009ad <_panic>
+		panic("creat /holes: %e", f);
+  800716:	50                   	push   %eax
+  800717:	68 64 31 80 00       	push   $0x803164
+  80071c:	68 84 00 00 00       	push   $0x84
+  800721:	68 c5 2f 80 00       	push   $0x802fc5
+  800726:	e8 82 02 00 00       	call   8009ad <_panic>
+			panic("write /holes@%d: %e", 2*i*BLKSIZE, r);
+  80072b:	83 ec 0c             	sub    $0xc,%esp
+  80072e:	50                   	push   %eax
+  80072f:	56                   	push   %esi
+  800730:	68 75 31 80 00       	push   $0x803175
+  800735:	68 89 00 00 00       	push   $0x89
+  80073a:	68 c5 2f 80 00       	push   $0x802fc5
+  80073f:	e8 69 02 00 00       	call   8009ad <_panic>
+		panic("open /holes: %e", f);
+  800744:	50                   	push   %eax
+  800745:	68 89 31 80 00       	push   $0x803189
+  80074a:	68 8e 00 00 00       	push   $0x8e
+  80074f:	68 c5 2f 80 00       	push   $0x802fc5
+  800754:	e8 54 02 00 00       	call   8009ad <_panic>
+		seek(f, i*BLKSIZE);
+		if ((r = readn(f, buf, sizeof(buf))) != sizeof(buf))
+			panic("read /holes@%d returned %d: %e", i*BLKSIZE, r, r);
+  800759:	83 ec 08             	sub    $0x8,%esp
+  80075c:	50                   	push   %eax
+  80075d:	50                   	push   %eax
+  80075e:	57                   	push   %edi
+  80075f:	68 d4 33 80 00       	push   $0x8033d4
+  800764:	68 92 00 00 00       	push   $0x92
+  800769:	68 c5 2f 80 00       	push   $0x802fc5
+  80076e:	e8 3a 02 00 00       	call   8009ad <_panic>
+		if (*(int*)buf != (i % 2 ? 0 : i / 2))
+  800773:	39 c2                	cmp    %eax,%edx
+  800775:	75 52                	jne    8007c9 <umain+0x74b>
+	for (i = 0; i < NEXTENT*3*2 - 1; i++) {
+  800777:	83 c3 01             	add    $0x1,%ebx
+  80077a:	83 fb 53             	cmp    $0x53,%ebx
+  80077d:	74 63                	je     8007e2 <umain+0x764>
+		seek(f, i*BLKSIZE);
+  80077f:	89 df                	mov    %ebx,%edi
+  800781:	c1 e7 0c             	shl    $0xc,%edi
+  800784:	83 ec 08             	sub    $0x8,%esp
+  800787:	57                   	push   %edi
+  800788:	56                   	push   %esi
+  800789:	e8 1b 1a 00 00       	call   8021a9 <seek>
+		if ((r = readn(f, buf, sizeof(buf))) != sizeof(buf))
+  80078e:	83 c4 0c             	add    $0xc,%esp
+  800791:	68 00 02 00 00       	push   $0x200
+  800796:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  80079c:	50                   	push   %eax
+  80079d:	56                   	push   %esi
+  80079e:	e8 3d 19 00 00       	call   8020e0 <readn>
+  8007a3:	83 c4 10             	add    $0x10,%esp
+  8007a6:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8007ab:	75 ac                	jne    800759 <umain+0x6db>
+		if (*(int*)buf != (i % 2 ? 0 : i / 2))
+  8007ad:	8b 95 4c fd ff ff    	mov    -0x2b4(%ebp),%edx
+  8007b3:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  8007b9:	f6 c3 01             	test   $0x1,%bl
+  8007bc:	75 b5                	jne    800773 <umain+0x6f5>
+  8007be:	89 d8                	mov    %ebx,%eax
+  8007c0:	c1 e8 1f             	shr    $0x1f,%eax
+  8007c3:	01 d8                	add    %ebx,%eax
+  8007c5:	d1 f8                	sar    %eax
+  8007c7:	eb aa                	jmp    800773 <umain+0x6f5>
+			panic("read /holes@%d returned bad data %d",
+  8007c9:	83 ec 0c             	sub    $0xc,%esp
+  8007cc:	52                   	push   %edx
+  8007cd:	57                   	push   %edi
+  8007ce:	68 f4 33 80 00       	push   $0x8033f4
+  8007d3:	68 94 00 00 00       	push   $0x94
+  8007d8:	68 c5 2f 80 00       	push   $0x802fc5
+  8007dd:	e8 cb 01 00 00       	call   8009ad <_panic>
+			      i*BLKSIZE, *(int*)buf);
+	}
+
+	// Cut it back to fit in the struct File again
+	if ((r = ftruncate(f, 3*BLKSIZE)) < 0)
+  8007e2:	83 ec 08             	sub    $0x8,%esp
+  8007e5:	68 00 30 00 00       	push   $0x3000
+  8007ea:	56                   	push   %esi
+  8007eb:	e8 e2 19 00 00       	call   8021d2 <ftruncate>
+  8007f0:	83 c4 10             	add    $0x10,%esp
+  8007f3:	85 c0                	test   %eax,%eax
+  8007f5:	78 53                	js     80084a <umain+0x7cc>
+		panic("ftruncate /holes: %e", r);
+	close(f);
+  8007f7:	83 ec 0c             	sub    $0xc,%esp
+  8007fa:	56                   	push   %esi
+  8007fb:	e8 1d 17 00 00       	call   801f1d <close>
+	if ((f = open("/holes", O_RDONLY)) < 0)
+  800800:	83 c4 08             	add    $0x8,%esp
+  800803:	6a 00                	push   $0x0
+  800805:	68 5d 31 80 00       	push   $0x80315d
+  80080a:	e8 85 1d 00 00       	call   802594 <open>
+  80080f:	89 c6                	mov    %eax,%esi
+  800811:	83 c4 10             	add    $0x10,%esp
+  800814:	85 c0                	test   %eax,%eax
+  800816:	78 47                	js     80085f <umain+0x7e1>
+		panic("open /holes: %e", f);
+	if ((r = fstat(f, &st)) < 0)
+  800818:	83 ec 08             	sub    $0x8,%esp
+  80081b:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  800821:	50                   	push   %eax
+  800822:	56                   	push   %esi
+  800823:	e8 29 1a 00 00       	call   802251 <fstat>
+  800828:	83 c4 10             	add    $0x10,%esp
+  80082b:	85 c0                	test   %eax,%eax
+  80082d:	78 45                	js     800874 <umain+0x7f6>
+		panic("fstat /holes: %e", r);
+	if (st.st_size != 3*BLKSIZE)
+  80082f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800832:	3d 00 30 00 00       	cmp    $0x3000,%eax
+  800837:	75 50                	jne    800889 <umain+0x80b>
+		panic("ftruncate /holes left size %d", st.st_size);
+	for (i = 0; i < 3; i++) {
+  800839:	8b 9d 44 fd ff ff    	mov    -0x2bc(%ebp),%ebx
+		if ((r = readn(f, buf, sizeof(buf))) != sizeof(buf))
+  80083f:	8d bd 4c fd ff ff    	lea    -0x2b4(%ebp),%edi
+  800845:	e9 8f 00 00 00       	jmp    8008d9 <umain+0x85b>
+		panic("ftruncate /holes: %e", r);
+  80084a:	50                   	push   %eax
+  80084b:	68 99 31 80 00       	push   $0x803199
+  800850:	68 9a 00 00 00       	push   $0x9a
+  800855:	68 c5 2f 80 00       	push   $0x802fc5
+  80085a:	e8 4e 01 00 00       	call   8009ad <_panic>
+		panic("open /holes: %e", f);
+  80085f:	50                   	push   %eax
+  800860:	68 89 31 80 00       	push   $0x803189
+  800865:	68 9d 00 00 00       	push   $0x9d
+  80086a:	68 c5 2f 80 00       	push   $0x802fc5
+  80086f:	e8 39 01 00 00       	call   8009ad <_panic>
+		panic("fstat /holes: %e", r);
+  800874:	50                   	push   %eax
+  800875:	68 ae 31 80 00       	push   $0x8031ae
+  80087a:	68 9f 00 00 00       	push   $0x9f
+  80087f:	68 c5 2f 80 00       	push   $0x802fc5
+  800884:	e8 24 01 00 00       	call   8009ad <_panic>
+		panic("ftruncate /holes left size %d", st.st_size);
+  800889:	50                   	push   %eax
+  80088a:	68 bf 31 80 00       	push   $0x8031bf
+  80088f:	68 a1 00 00 00       	push   $0xa1
+  800894:	68 c5 2f 80 00       	push   $0x802fc5
+  800899:	e8 0f 01 00 00       	call   8009ad <_panic>
+			panic("read /holes@%d returned %d: %e", i*BLKSIZE, r, r);
+  80089e:	83 ec 08             	sub    $0x8,%esp
+  8008a1:	50                   	push   %eax
+  8008a2:	50                   	push   %eax
+  8008a3:	c1 e3 0c             	shl    $0xc,%ebx
+  8008a6:	53                   	push   %ebx
+  8008a7:	68 d4 33 80 00       	push   $0x8033d4
+  8008ac:	68 a4 00 00 00       	push   $0xa4
+  8008b1:	68 c5 2f 80 00       	push   $0x802fc5
+  8008b6:	e8 f2 00 00 00       	call   8009ad <_panic>
+		if (*(int*)buf != (i % 2 ? 0 : i / 2))
+  8008bb:	39 c2                	cmp    %eax,%edx
+  8008bd:	75 4f                	jne    80090e <umain+0x890>
+			panic("read /holes@%d returned bad data %d",
+			      i*BLKSIZE, *(int*)buf);
+		seek(f, (i + 1)*BLKSIZE);
+  8008bf:	83 c3 01             	add    $0x1,%ebx
+  8008c2:	83 ec 08             	sub    $0x8,%esp
+  8008c5:	89 d8                	mov    %ebx,%eax
+  8008c7:	c1 e0 0c             	shl    $0xc,%eax
+  8008ca:	50                   	push   %eax
+  8008cb:	56                   	push   %esi
+  8008cc:	e8 d8 18 00 00       	call   8021a9 <seek>
+	for (i = 0; i < 3; i++) {
+  8008d1:	83 c4 10             	add    $0x10,%esp
+  8008d4:	83 fb 03             	cmp    $0x3,%ebx
+  8008d7:	74 51                	je     80092a <umain+0x8ac>
+		if ((r = readn(f, buf, sizeof(buf))) != sizeof(buf))
+  8008d9:	83 ec 04             	sub    $0x4,%esp
+  8008dc:	68 00 02 00 00       	push   $0x200
+  8008e1:	57                   	push   %edi
+  8008e2:	56                   	push   %esi
+  8008e3:	e8 f8 17 00 00       	call   8020e0 <readn>
+  8008e8:	83 c4 10             	add    $0x10,%esp
+  8008eb:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8008f0:	75 ac                	jne    80089e <umain+0x820>
+		if (*(int*)buf != (i % 2 ? 0 : i / 2))
+  8008f2:	8b 95 4c fd ff ff    	mov    -0x2b4(%ebp),%edx
+  8008f8:	8b 85 44 fd ff ff    	mov    -0x2bc(%ebp),%eax
+  8008fe:	f6 c3 01             	test   $0x1,%bl
+  800901:	75 b8                	jne    8008bb <umain+0x83d>
+  800903:	89 d8                	mov    %ebx,%eax
+  800905:	c1 e8 1f             	shr    $0x1f,%eax
+  800908:	01 d8                	add    %ebx,%eax
+  80090a:	d1 f8                	sar    %eax
+  80090c:	eb ad                	jmp    8008bb <umain+0x83d>
+			panic("read /holes@%d returned bad data %d",
+  80090e:	83 ec 0c             	sub    $0xc,%esp
+  800911:	52                   	push   %edx
+  800912:	c1 e3 0c             	shl    $0xc,%ebx
+  800915:	53                   	push   %ebx
+  800916:	68 f4 33 80 00       	push   $0x8033f4
+  80091b:	68 a6 00 00 00       	push   $0xa6
+  800920:	68 c5 2f 80 00       	push   $0x802fc5
+  800925:	e8 83 00 00 00       	call   8009ad <_panic>
+	}
+	close(f);
+  80092a:	83 ec 0c             	sub    $0xc,%esp
+  80092d:	56                   	push   %esi
+  80092e:	e8 ea 15 00 00       	call   801f1d <close>
+	cprintf("fragmented file is good\n");
+  800933:	c7 04 24 dd 31 80 00 	movl   $0x8031dd,(%esp)
+  80093a:	e8 49 01 00 00       	call   800a88 <cprintf>
+}
+  80093f:	83 c4 10             	add    $0x10,%esp
+  800942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800945:	5b                   	pop    %ebx
+  800946:	5e                   	pop    %esi
+  800947:	5f                   	pop    %edi
+  800948:	5d                   	pop    %ebp
+  800949:	c3                   	ret
+
+0080094a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80094a:	55                   	push   %ebp
+  80094b:	89 e5                	mov    %esp,%ebp
+  80094d:	56                   	push   %esi
+  80094e:	53                   	push   %ebx
+  80094f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800952:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800955:	e8 ca 0b 00 00       	call   801524 <sys_getenvid>
+  80095a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80095f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800962:	c1 e0 06             	shl    $0x6,%eax
+  800965:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80096a:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80096f:	85 db                	test   %ebx,%ebx
+  800971:	7e 07                	jle    80097a <libmain+0x30>
+		binaryname = argv[0];
+  800973:	8b 06                	mov    (%esi),%eax
+  800975:	a3 04 40 80 00       	mov    %eax,0x804004
+
+	// call user main routine
+	umain(argc, argv);
+  80097a:	83 ec 08             	sub    $0x8,%esp
+  80097d:	56                   	push   %esi
+  80097e:	53                   	push   %ebx
+  80097f:	e8 fa f6 ff ff       	call   80007e <umain>
+
+	// exit gracefully
+	exit();
+  800984:	e8 0a 00 00 00       	call   800993 <exit>
+}
+  800989:	83 c4 10             	add    $0x10,%esp
+  80098c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80098f:	5b                   	pop    %ebx
+  800990:	5e                   	pop    %esi
+  800991:	5d                   	pop    %ebp
+  800992:	c3                   	ret
+
+00800993 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800993:	55                   	push   %ebp
+  800994:	89 e5                	mov    %esp,%ebp
+  800996:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800999:	e8 ac 15 00 00       	call   801f4a <close_all>
+	sys_env_destroy(0);
+  80099e:	83 ec 0c             	sub    $0xc,%esp
+  8009a1:	6a 00                	push   $0x0
+  8009a3:	e8 3b 0b 00 00       	call   8014e3 <sys_env_destroy>
+}
+  8009a8:	83 c4 10             	add    $0x10,%esp
+  8009ab:	c9                   	leave
+  8009ac:	c3                   	ret
+
+008009ad <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8009ad:	55                   	push   %ebp
+  8009ae:	89 e5                	mov    %esp,%ebp
+  8009b0:	56                   	push   %esi
+  8009b1:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8009b2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8009b5:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  8009bb:	e8 64 0b 00 00       	call   801524 <sys_getenvid>
+  8009c0:	83 ec 0c             	sub    $0xc,%esp
+  8009c3:	ff 75 0c             	push   0xc(%ebp)
+  8009c6:	ff 75 08             	push   0x8(%ebp)
+  8009c9:	56                   	push   %esi
+  8009ca:	50                   	push   %eax
+  8009cb:	68 48 34 80 00       	push   $0x803448
+  8009d0:	e8 b3 00 00 00       	call   800a88 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8009d5:	83 c4 18             	add    $0x18,%esp
+  8009d8:	53                   	push   %ebx
+  8009d9:	ff 75 10             	push   0x10(%ebp)
+  8009dc:	e8 56 00 00 00       	call   800a37 <vcprintf>
+	cprintf("\n");
+  8009e1:	c7 04 24 07 39 80 00 	movl   $0x803907,(%esp)
+  8009e8:	e8 9b 00 00 00       	call   800a88 <cprintf>
+  8009ed:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8009f0:	cc                   	int3
+	while (1)
+  8009f1:	eb fd                	jmp    8009f0 <_panic+0x43>
+
+008009f3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8009f3:	55                   	push   %ebp
+  8009f4:	89 e5                	mov    %esp,%ebp
+  8009f6:	53                   	push   %ebx
+  8009f7:	83 ec 04             	sub    $0x4,%esp
+  8009fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8009fd:	8b 13                	mov    (%ebx),%edx
+  8009ff:	8d 42 01             	lea    0x1(%edx),%eax
+  800a02:	89 03                	mov    %eax,(%ebx)
+  800a04:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a07:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800a0b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800a10:	74 09                	je     800a1b <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800a12:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800a16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a19:	c9                   	leave
+  800a1a:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800a1b:	83 ec 08             	sub    $0x8,%esp
+  800a1e:	68 ff 00 00 00       	push   $0xff
+  800a23:	8d 43 08             	lea    0x8(%ebx),%eax
+  800a26:	50                   	push   %eax
+  800a27:	e8 69 0a 00 00       	call   801495 <sys_cputs>
+		b->idx = 0;
+  800a2c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800a32:	83 c4 10             	add    $0x10,%esp
+  800a35:	eb db                	jmp    800a12 <putch+0x1f>
+
+00800a37 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800a40:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800a47:	00 00 00 
+	b.cnt = 0;
+  800a4a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800a51:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800a54:	ff 75 0c             	push   0xc(%ebp)
+  800a57:	ff 75 08             	push   0x8(%ebp)
+  800a5a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800a60:	50                   	push   %eax
+  800a61:	68 f3 09 80 00       	push   $0x8009f3
+  800a66:	e8 14 01 00 00       	call   800b7f <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800a6b:	83 c4 08             	add    $0x8,%esp
+  800a6e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800a74:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800a7a:	50                   	push   %eax
+  800a7b:	e8 15 0a 00 00       	call   801495 <sys_cputs>
+
+	return b.cnt;
+}
+  800a80:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800a86:	c9                   	leave
+  800a87:	c3                   	ret
+
+00800a88 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800a8e:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800a91:	50                   	push   %eax
+  800a92:	ff 75 08             	push   0x8(%ebp)
+  800a95:	e8 9d ff ff ff       	call   800a37 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800a9a:	c9                   	leave
+  800a9b:	c3                   	ret
+
+00800a9c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800a9c:	55                   	push   %ebp
+  800a9d:	89 e5                	mov    %esp,%ebp
+  800a9f:	57                   	push   %edi
+  800aa0:	56                   	push   %esi
+  800aa1:	53                   	push   %ebx
+  800aa2:	83 ec 1c             	sub    $0x1c,%esp
+  800aa5:	89 c7                	mov    %eax,%edi
+  800aa7:	89 d6                	mov    %edx,%esi
+  800aa9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aaf:	89 d1                	mov    %edx,%ecx
+  800ab1:	89 c2                	mov    %eax,%edx
+  800ab3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ab6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ab9:	8b 45 10             	mov    0x10(%ebp),%eax
+  800abc:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800abf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ac2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800ac9:	39 c2                	cmp    %eax,%edx
+  800acb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800ace:	72 3e                	jb     800b0e <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800ad0:	83 ec 0c             	sub    $0xc,%esp
+  800ad3:	ff 75 18             	push   0x18(%ebp)
+  800ad6:	83 eb 01             	sub    $0x1,%ebx
+  800ad9:	53                   	push   %ebx
+  800ada:	50                   	push   %eax
+  800adb:	83 ec 08             	sub    $0x8,%esp
+  800ade:	ff 75 e4             	push   -0x1c(%ebp)
+  800ae1:	ff 75 e0             	push   -0x20(%ebp)
+  800ae4:	ff 75 dc             	push   -0x24(%ebp)
+  800ae7:	ff 75 d8             	push   -0x28(%ebp)
+  800aea:	e8 7d 23 00 00       	call   802e6c <__udivdi3>
+  800aef:	83 c4 18             	add    $0x18,%esp
+  800af2:	52                   	push   %edx
+  800af3:	50                   	push   %eax
+  800af4:	89 f2                	mov    %esi,%edx
+  800af6:	89 f8                	mov    %edi,%eax
+  800af8:	e8 9f ff ff ff       	call   800a9c <printnum>
+  800afd:	83 c4 20             	add    $0x20,%esp
+  800b00:	eb 13                	jmp    800b15 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800b02:	83 ec 08             	sub    $0x8,%esp
+  800b05:	56                   	push   %esi
+  800b06:	ff 75 18             	push   0x18(%ebp)
+  800b09:	ff d7                	call   *%edi
+  800b0b:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800b0e:	83 eb 01             	sub    $0x1,%ebx
+  800b11:	85 db                	test   %ebx,%ebx
+  800b13:	7f ed                	jg     800b02 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800b15:	83 ec 08             	sub    $0x8,%esp
+  800b18:	56                   	push   %esi
+  800b19:	83 ec 04             	sub    $0x4,%esp
+  800b1c:	ff 75 e4             	push   -0x1c(%ebp)
+  800b1f:	ff 75 e0             	push   -0x20(%ebp)
+  800b22:	ff 75 dc             	push   -0x24(%ebp)
+  800b25:	ff 75 d8             	push   -0x28(%ebp)
+  800b28:	e8 5d 23 00 00       	call   802e8a <__umoddi3>
+  800b2d:	83 c4 14             	add    $0x14,%esp
+  800b30:	0f be 80 6b 34 80 00 	movsbl 0x80346b(%eax),%eax
+  800b37:	50                   	push   %eax
+  800b38:	ff d7                	call   *%edi
+}
+  800b3a:	83 c4 10             	add    $0x10,%esp
+  800b3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b40:	5b                   	pop    %ebx
+  800b41:	5e                   	pop    %esi
+  800b42:	5f                   	pop    %edi
+  800b43:	5d                   	pop    %ebp
+  800b44:	c3                   	ret
+
+00800b45 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800b45:	55                   	push   %ebp
+  800b46:	89 e5                	mov    %esp,%ebp
+  800b48:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800b4b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800b4f:	8b 10                	mov    (%eax),%edx
+  800b51:	3b 50 04             	cmp    0x4(%eax),%edx
+  800b54:	73 0a                	jae    800b60 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800b56:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800b59:	89 08                	mov    %ecx,(%eax)
+  800b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5e:	88 02                	mov    %al,(%edx)
+}
+  800b60:	5d                   	pop    %ebp
+  800b61:	c3                   	ret
+
+00800b62 <printfmt>:
+{
+  800b62:	55                   	push   %ebp
+  800b63:	89 e5                	mov    %esp,%ebp
+  800b65:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800b68:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800b6b:	50                   	push   %eax
+  800b6c:	ff 75 10             	push   0x10(%ebp)
+  800b6f:	ff 75 0c             	push   0xc(%ebp)
+  800b72:	ff 75 08             	push   0x8(%ebp)
+  800b75:	e8 05 00 00 00       	call   800b7f <vprintfmt>
+}
+  800b7a:	83 c4 10             	add    $0x10,%esp
+  800b7d:	c9                   	leave
+  800b7e:	c3                   	ret
+
+00800b7f <vprintfmt>:
+{
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	57                   	push   %edi
+  800b83:	56                   	push   %esi
+  800b84:	53                   	push   %ebx
+  800b85:	83 ec 2c             	sub    $0x2c,%esp
+  800b88:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b8b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800b8e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800b91:	eb 0a                	jmp    800b9d <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800b93:	83 ec 08             	sub    $0x8,%esp
+  800b96:	53                   	push   %ebx
+  800b97:	50                   	push   %eax
+  800b98:	ff d6                	call   *%esi
+  800b9a:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800b9d:	83 c7 01             	add    $0x1,%edi
+  800ba0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800ba4:	83 f8 25             	cmp    $0x25,%eax
+  800ba7:	74 0c                	je     800bb5 <vprintfmt+0x36>
+			if (ch == '\0')
+  800ba9:	85 c0                	test   %eax,%eax
+  800bab:	75 e6                	jne    800b93 <vprintfmt+0x14>
+}
+  800bad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb0:	5b                   	pop    %ebx
+  800bb1:	5e                   	pop    %esi
+  800bb2:	5f                   	pop    %edi
+  800bb3:	5d                   	pop    %ebp
+  800bb4:	c3                   	ret
+		padc = ' ';
+  800bb5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800bb9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800bc0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800bc7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800bce:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800bd3:	8d 47 01             	lea    0x1(%edi),%eax
+  800bd6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800bd9:	0f b6 17             	movzbl (%edi),%edx
+  800bdc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800bdf:	3c 55                	cmp    $0x55,%al
+  800be1:	0f 87 c5 03 00 00    	ja     800fac <vprintfmt+0x42d>
+  800be7:	0f b6 c0             	movzbl %al,%eax
+  800bea:	ff 24 85 00 36 80 00 	jmp    *0x803600(,%eax,4)
+  800bf1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800bf4:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800bf8:	eb d9                	jmp    800bd3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800bfa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800bfd:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800c01:	eb d0                	jmp    800bd3 <vprintfmt+0x54>
+  800c03:	0f b6 d2             	movzbl %dl,%edx
+  800c06:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800c09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800c11:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800c14:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800c18:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800c1b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800c1e:	83 f9 09             	cmp    $0x9,%ecx
+  800c21:	77 55                	ja     800c78 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800c23:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800c26:	eb e9                	jmp    800c11 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800c28:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c2b:	8b 00                	mov    (%eax),%eax
+  800c2d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800c30:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c33:	8d 40 04             	lea    0x4(%eax),%eax
+  800c36:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800c39:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800c3c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800c40:	79 91                	jns    800bd3 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800c42:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800c45:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800c48:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800c4f:	eb 82                	jmp    800bd3 <vprintfmt+0x54>
+			if (width < 0)
+  800c51:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800c54:	85 d2                	test   %edx,%edx
+  800c56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c5b:	0f 49 c2             	cmovns %edx,%eax
+  800c5e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800c61:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800c64:	e9 6a ff ff ff       	jmp    800bd3 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800c69:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800c6c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800c73:	e9 5b ff ff ff       	jmp    800bd3 <vprintfmt+0x54>
+  800c78:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800c7b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800c7e:	eb bc                	jmp    800c3c <vprintfmt+0xbd>
+			lflag++;
+  800c80:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800c83:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800c86:	e9 48 ff ff ff       	jmp    800bd3 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800c8b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c8e:	8d 78 04             	lea    0x4(%eax),%edi
+  800c91:	83 ec 08             	sub    $0x8,%esp
+  800c94:	53                   	push   %ebx
+  800c95:	ff 30                	push   (%eax)
+  800c97:	ff d6                	call   *%esi
+			break;
+  800c99:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800c9c:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800c9f:	e9 63 02 00 00       	jmp    800f07 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800ca4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ca7:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800caa:	8b 10                	mov    (%eax),%edx
+  800cac:	89 d0                	mov    %edx,%eax
+  800cae:	f7 d8                	neg    %eax
+  800cb0:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800cb3:	83 f8 12             	cmp    $0x12,%eax
+  800cb6:	7f 23                	jg     800cdb <vprintfmt+0x15c>
+  800cb8:	8b 14 85 60 37 80 00 	mov    0x803760(,%eax,4),%edx
+  800cbf:	85 d2                	test   %edx,%edx
+  800cc1:	74 18                	je     800cdb <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800cc3:	52                   	push   %edx
+  800cc4:	68 d5 38 80 00       	push   $0x8038d5
+  800cc9:	53                   	push   %ebx
+  800cca:	56                   	push   %esi
+  800ccb:	e8 92 fe ff ff       	call   800b62 <printfmt>
+  800cd0:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800cd3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800cd6:	e9 2c 02 00 00       	jmp    800f07 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800cdb:	50                   	push   %eax
+  800cdc:	68 83 34 80 00       	push   $0x803483
+  800ce1:	53                   	push   %ebx
+  800ce2:	56                   	push   %esi
+  800ce3:	e8 7a fe ff ff       	call   800b62 <printfmt>
+  800ce8:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800ceb:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800cee:	e9 14 02 00 00       	jmp    800f07 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800cf3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cf6:	83 c0 04             	add    $0x4,%eax
+  800cf9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800cfc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cff:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800d01:	85 c9                	test   %ecx,%ecx
+  800d03:	b8 7c 34 80 00       	mov    $0x80347c,%eax
+  800d08:	0f 45 c1             	cmovne %ecx,%eax
+  800d0b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800d0e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800d12:	7e 06                	jle    800d1a <vprintfmt+0x19b>
+  800d14:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800d18:	75 0b                	jne    800d25 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d1a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800d1d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800d20:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d23:	eb 5c                	jmp    800d81 <vprintfmt+0x202>
+  800d25:	83 ec 08             	sub    $0x8,%esp
+  800d28:	ff 75 d0             	push   -0x30(%ebp)
+  800d2b:	ff 75 cc             	push   -0x34(%ebp)
+  800d2e:	e8 19 03 00 00       	call   80104c <strnlen>
+  800d33:	89 c2                	mov    %eax,%edx
+  800d35:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800d38:	29 d0                	sub    %edx,%eax
+  800d3a:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800d3d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800d41:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800d44:	89 75 08             	mov    %esi,0x8(%ebp)
+  800d47:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d49:	eb 0e                	jmp    800d59 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800d4b:	83 ec 08             	sub    $0x8,%esp
+  800d4e:	53                   	push   %ebx
+  800d4f:	57                   	push   %edi
+  800d50:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d53:	83 ee 01             	sub    $0x1,%esi
+  800d56:	83 c4 10             	add    $0x10,%esp
+  800d59:	85 f6                	test   %esi,%esi
+  800d5b:	7f ee                	jg     800d4b <vprintfmt+0x1cc>
+  800d5d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800d60:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d63:	85 c0                	test   %eax,%eax
+  800d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d6a:	0f 49 d0             	cmovns %eax,%edx
+  800d6d:	29 d0                	sub    %edx,%eax
+  800d6f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800d72:	eb a6                	jmp    800d1a <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800d74:	83 ec 08             	sub    $0x8,%esp
+  800d77:	53                   	push   %ebx
+  800d78:	52                   	push   %edx
+  800d79:	ff 55 08             	call   *0x8(%ebp)
+  800d7c:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d7f:	89 f1                	mov    %esi,%ecx
+  800d81:	8d 71 01             	lea    0x1(%ecx),%esi
+  800d84:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800d88:	0f be d0             	movsbl %al,%edx
+  800d8b:	85 d2                	test   %edx,%edx
+  800d8d:	74 28                	je     800db7 <vprintfmt+0x238>
+  800d8f:	85 ff                	test   %edi,%edi
+  800d91:	78 05                	js     800d98 <vprintfmt+0x219>
+  800d93:	83 ef 01             	sub    $0x1,%edi
+  800d96:	78 30                	js     800dc8 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800d98:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800d9c:	74 d6                	je     800d74 <vprintfmt+0x1f5>
+  800d9e:	0f be c0             	movsbl %al,%eax
+  800da1:	83 e8 20             	sub    $0x20,%eax
+  800da4:	83 f8 5e             	cmp    $0x5e,%eax
+  800da7:	76 cb                	jbe    800d74 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800da9:	83 ec 08             	sub    $0x8,%esp
+  800dac:	53                   	push   %ebx
+  800dad:	6a 3f                	push   $0x3f
+  800daf:	ff 55 08             	call   *0x8(%ebp)
+  800db2:	83 c4 10             	add    $0x10,%esp
+  800db5:	eb c8                	jmp    800d7f <vprintfmt+0x200>
+  800db7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dba:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800dbd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800dc0:	01 d0                	add    %edx,%eax
+  800dc2:	29 c8                	sub    %ecx,%eax
+  800dc4:	89 c7                	mov    %eax,%edi
+  800dc6:	eb 13                	jmp    800ddb <vprintfmt+0x25c>
+  800dc8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dcb:	eb ed                	jmp    800dba <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800dcd:	83 ec 08             	sub    $0x8,%esp
+  800dd0:	53                   	push   %ebx
+  800dd1:	6a 20                	push   $0x20
+  800dd3:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800dd5:	83 ef 01             	sub    $0x1,%edi
+  800dd8:	83 c4 10             	add    $0x10,%esp
+  800ddb:	85 ff                	test   %edi,%edi
+  800ddd:	7f ee                	jg     800dcd <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800ddf:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800de2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800de5:	e9 1d 01 00 00       	jmp    800f07 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800dea:	83 f9 01             	cmp    $0x1,%ecx
+  800ded:	7f 1b                	jg     800e0a <vprintfmt+0x28b>
+	else if (lflag)
+  800def:	85 c9                	test   %ecx,%ecx
+  800df1:	74 63                	je     800e56 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800df3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800df6:	8b 00                	mov    (%eax),%eax
+  800df8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800dfb:	99                   	cltd
+  800dfc:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800dff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e02:	8d 40 04             	lea    0x4(%eax),%eax
+  800e05:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e08:	eb 17                	jmp    800e21 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800e0a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e0d:	8b 50 04             	mov    0x4(%eax),%edx
+  800e10:	8b 00                	mov    (%eax),%eax
+  800e12:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800e15:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800e18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e1b:	8d 40 08             	lea    0x8(%eax),%eax
+  800e1e:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800e21:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800e24:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800e27:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800e2c:	85 c9                	test   %ecx,%ecx
+  800e2e:	0f 89 b9 00 00 00    	jns    800eed <vprintfmt+0x36e>
+				putch('-', putdat);
+  800e34:	83 ec 08             	sub    $0x8,%esp
+  800e37:	53                   	push   %ebx
+  800e38:	6a 2d                	push   $0x2d
+  800e3a:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800e3c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800e3f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800e42:	f7 da                	neg    %edx
+  800e44:	83 d1 00             	adc    $0x0,%ecx
+  800e47:	f7 d9                	neg    %ecx
+  800e49:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800e4c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800e51:	e9 97 00 00 00       	jmp    800eed <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800e56:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e59:	8b 00                	mov    (%eax),%eax
+  800e5b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800e5e:	99                   	cltd
+  800e5f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800e62:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e65:	8d 40 04             	lea    0x4(%eax),%eax
+  800e68:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e6b:	eb b4                	jmp    800e21 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800e6d:	83 f9 01             	cmp    $0x1,%ecx
+  800e70:	7f 1b                	jg     800e8d <vprintfmt+0x30e>
+	else if (lflag)
+  800e72:	85 c9                	test   %ecx,%ecx
+  800e74:	74 2c                	je     800ea2 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800e76:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e79:	8b 10                	mov    (%eax),%edx
+  800e7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e80:	8d 40 04             	lea    0x4(%eax),%eax
+  800e83:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800e86:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800e8b:	eb 60                	jmp    800eed <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800e8d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e90:	8b 10                	mov    (%eax),%edx
+  800e92:	8b 48 04             	mov    0x4(%eax),%ecx
+  800e95:	8d 40 08             	lea    0x8(%eax),%eax
+  800e98:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800e9b:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800ea0:	eb 4b                	jmp    800eed <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800ea2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea5:	8b 10                	mov    (%eax),%edx
+  800ea7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eac:	8d 40 04             	lea    0x4(%eax),%eax
+  800eaf:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800eb2:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800eb7:	eb 34                	jmp    800eed <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800eb9:	83 f9 01             	cmp    $0x1,%ecx
+  800ebc:	7f 15                	jg     800ed3 <vprintfmt+0x354>
+	else if (lflag)
+  800ebe:	85 c9                	test   %ecx,%ecx
+  800ec0:	74 4d                	je     800f0f <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800ec2:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ec5:	8b 00                	mov    (%eax),%eax
+  800ec7:	99                   	cltd
+  800ec8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800ecb:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800ece:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800ed1:	eb 11                	jmp    800ee4 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800ed3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ed6:	8b 50 04             	mov    0x4(%eax),%edx
+  800ed9:	8b 00                	mov    (%eax),%eax
+  800edb:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800ede:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800ee1:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800ee4:	89 d1                	mov    %edx,%ecx
+  800ee6:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800ee8:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800eed:	83 ec 0c             	sub    $0xc,%esp
+  800ef0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800ef4:	50                   	push   %eax
+  800ef5:	ff 75 e0             	push   -0x20(%ebp)
+  800ef8:	57                   	push   %edi
+  800ef9:	51                   	push   %ecx
+  800efa:	52                   	push   %edx
+  800efb:	89 da                	mov    %ebx,%edx
+  800efd:	89 f0                	mov    %esi,%eax
+  800eff:	e8 98 fb ff ff       	call   800a9c <printnum>
+			break;
+  800f04:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800f07:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800f0a:	e9 8e fc ff ff       	jmp    800b9d <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800f0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f12:	8b 00                	mov    (%eax),%eax
+  800f14:	99                   	cltd
+  800f15:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800f18:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800f1b:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800f1e:	eb c4                	jmp    800ee4 <vprintfmt+0x365>
+			putch('0', putdat);
+  800f20:	83 ec 08             	sub    $0x8,%esp
+  800f23:	53                   	push   %ebx
+  800f24:	6a 30                	push   $0x30
+  800f26:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800f28:	83 c4 08             	add    $0x8,%esp
+  800f2b:	53                   	push   %ebx
+  800f2c:	6a 78                	push   $0x78
+  800f2e:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800f30:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f33:	8b 10                	mov    (%eax),%edx
+  800f35:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800f3a:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800f3d:	8d 40 04             	lea    0x4(%eax),%eax
+  800f40:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800f43:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800f48:	eb a3                	jmp    800eed <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800f4a:	83 f9 01             	cmp    $0x1,%ecx
+  800f4d:	7f 1b                	jg     800f6a <vprintfmt+0x3eb>
+	else if (lflag)
+  800f4f:	85 c9                	test   %ecx,%ecx
+  800f51:	74 2f                	je     800f82 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800f53:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f56:	8b 10                	mov    (%eax),%edx
+  800f58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f5d:	8d 40 04             	lea    0x4(%eax),%eax
+  800f60:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800f63:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800f68:	eb 83                	jmp    800eed <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800f6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f6d:	8b 10                	mov    (%eax),%edx
+  800f6f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f72:	8d 40 08             	lea    0x8(%eax),%eax
+  800f75:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800f78:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800f7d:	e9 6b ff ff ff       	jmp    800eed <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800f82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f85:	8b 10                	mov    (%eax),%edx
+  800f87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8c:	8d 40 04             	lea    0x4(%eax),%eax
+  800f8f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800f92:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800f97:	e9 51 ff ff ff       	jmp    800eed <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800f9c:	83 ec 08             	sub    $0x8,%esp
+  800f9f:	53                   	push   %ebx
+  800fa0:	6a 25                	push   $0x25
+  800fa2:	ff d6                	call   *%esi
+			break;
+  800fa4:	83 c4 10             	add    $0x10,%esp
+  800fa7:	e9 5b ff ff ff       	jmp    800f07 <vprintfmt+0x388>
+			putch('%', putdat);
+  800fac:	83 ec 08             	sub    $0x8,%esp
+  800faf:	53                   	push   %ebx
+  800fb0:	6a 25                	push   $0x25
+  800fb2:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800fb4:	83 c4 10             	add    $0x10,%esp
+  800fb7:	89 f8                	mov    %edi,%eax
+  800fb9:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800fbd:	74 05                	je     800fc4 <vprintfmt+0x445>
+  800fbf:	83 e8 01             	sub    $0x1,%eax
+  800fc2:	eb f5                	jmp    800fb9 <vprintfmt+0x43a>
+  800fc4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800fc7:	e9 3b ff ff ff       	jmp    800f07 <vprintfmt+0x388>
+
+00800fcc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800fcc:	55                   	push   %ebp
+  800fcd:	89 e5                	mov    %esp,%ebp
+  800fcf:	83 ec 18             	sub    $0x18,%esp
+  800fd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800fd8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800fdb:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800fdf:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800fe2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800fe9:	85 c0                	test   %eax,%eax
+  800feb:	74 26                	je     801013 <vsnprintf+0x47>
+  800fed:	85 d2                	test   %edx,%edx
+  800fef:	7e 22                	jle    801013 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ff1:	ff 75 14             	push   0x14(%ebp)
+  800ff4:	ff 75 10             	push   0x10(%ebp)
+  800ff7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800ffa:	50                   	push   %eax
+  800ffb:	68 45 0b 80 00       	push   $0x800b45
+  801000:	e8 7a fb ff ff       	call   800b7f <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  801005:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801008:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80100b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80100e:	83 c4 10             	add    $0x10,%esp
+}
+  801011:	c9                   	leave
+  801012:	c3                   	ret
+		return -E_INVAL;
+  801013:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801018:	eb f7                	jmp    801011 <vsnprintf+0x45>
+
+0080101a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80101a:	55                   	push   %ebp
+  80101b:	89 e5                	mov    %esp,%ebp
+  80101d:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  801020:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  801023:	50                   	push   %eax
+  801024:	ff 75 10             	push   0x10(%ebp)
+  801027:	ff 75 0c             	push   0xc(%ebp)
+  80102a:	ff 75 08             	push   0x8(%ebp)
+  80102d:	e8 9a ff ff ff       	call   800fcc <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  801032:	c9                   	leave
+  801033:	c3                   	ret
+
+00801034 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  801034:	55                   	push   %ebp
+  801035:	89 e5                	mov    %esp,%ebp
+  801037:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80103a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103f:	eb 03                	jmp    801044 <strlen+0x10>
+		n++;
+  801041:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  801044:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  801048:	75 f7                	jne    801041 <strlen+0xd>
+	return n;
+}
+  80104a:	5d                   	pop    %ebp
+  80104b:	c3                   	ret
+
+0080104c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80104c:	55                   	push   %ebp
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801052:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80105a:	eb 03                	jmp    80105f <strnlen+0x13>
+		n++;
+  80105c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80105f:	39 d0                	cmp    %edx,%eax
+  801061:	74 08                	je     80106b <strnlen+0x1f>
+  801063:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  801067:	75 f3                	jne    80105c <strnlen+0x10>
+  801069:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80106b:	89 d0                	mov    %edx,%eax
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+
+0080106f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	53                   	push   %ebx
+  801073:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801076:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  801079:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801082:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801085:	83 c0 01             	add    $0x1,%eax
+  801088:	84 d2                	test   %dl,%dl
+  80108a:	75 f2                	jne    80107e <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80108c:	89 c8                	mov    %ecx,%eax
+  80108e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801091:	c9                   	leave
+  801092:	c3                   	ret
+
+00801093 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801093:	55                   	push   %ebp
+  801094:	89 e5                	mov    %esp,%ebp
+  801096:	53                   	push   %ebx
+  801097:	83 ec 10             	sub    $0x10,%esp
+  80109a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  80109d:	53                   	push   %ebx
+  80109e:	e8 91 ff ff ff       	call   801034 <strlen>
+  8010a3:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8010a6:	ff 75 0c             	push   0xc(%ebp)
+  8010a9:	01 d8                	add    %ebx,%eax
+  8010ab:	50                   	push   %eax
+  8010ac:	e8 be ff ff ff       	call   80106f <strcpy>
+	return dst;
+}
+  8010b1:	89 d8                	mov    %ebx,%eax
+  8010b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010b6:	c9                   	leave
+  8010b7:	c3                   	ret
+
+008010b8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  8010bb:	56                   	push   %esi
+  8010bc:	53                   	push   %ebx
+  8010bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8010c3:	89 f3                	mov    %esi,%ebx
+  8010c5:	03 5d 10             	add    0x10(%ebp),%ebx
+  8010c8:	89 f0                	mov    %esi,%eax
+  8010ca:	eb 0f                	jmp    8010db <strncpy+0x23>
+		*dst++ = *src;
+  8010cc:	83 c0 01             	add    $0x1,%eax
+  8010cf:	0f b6 0a             	movzbl (%edx),%ecx
+  8010d2:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8010d5:	80 f9 01             	cmp    $0x1,%cl
+  8010d8:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8010db:	39 d8                	cmp    %ebx,%eax
+  8010dd:	75 ed                	jne    8010cc <strncpy+0x14>
+	}
+	return ret;
+}
+  8010df:	89 f0                	mov    %esi,%eax
+  8010e1:	5b                   	pop    %ebx
+  8010e2:	5e                   	pop    %esi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+
+008010e5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	56                   	push   %esi
+  8010e9:	53                   	push   %ebx
+  8010ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f0:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8010f3:	89 f0                	mov    %esi,%eax
+  8010f5:	85 d2                	test   %edx,%edx
+  8010f7:	74 21                	je     80111a <strlcpy+0x35>
+  8010f9:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8010fd:	89 f2                	mov    %esi,%edx
+  8010ff:	eb 09                	jmp    80110a <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801101:	83 c1 01             	add    $0x1,%ecx
+  801104:	83 c2 01             	add    $0x1,%edx
+  801107:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80110a:	39 c2                	cmp    %eax,%edx
+  80110c:	74 09                	je     801117 <strlcpy+0x32>
+  80110e:	0f b6 19             	movzbl (%ecx),%ebx
+  801111:	84 db                	test   %bl,%bl
+  801113:	75 ec                	jne    801101 <strlcpy+0x1c>
+  801115:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  801117:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80111a:	29 f0                	sub    %esi,%eax
+}
+  80111c:	5b                   	pop    %ebx
+  80111d:	5e                   	pop    %esi
+  80111e:	5d                   	pop    %ebp
+  80111f:	c3                   	ret
+
+00801120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  801120:	55                   	push   %ebp
+  801121:	89 e5                	mov    %esp,%ebp
+  801123:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801126:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  801129:	eb 06                	jmp    801131 <strcmp+0x11>
+		p++, q++;
+  80112b:	83 c1 01             	add    $0x1,%ecx
+  80112e:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  801131:	0f b6 01             	movzbl (%ecx),%eax
+  801134:	84 c0                	test   %al,%al
+  801136:	74 04                	je     80113c <strcmp+0x1c>
+  801138:	3a 02                	cmp    (%edx),%al
+  80113a:	74 ef                	je     80112b <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80113c:	0f b6 c0             	movzbl %al,%eax
+  80113f:	0f b6 12             	movzbl (%edx),%edx
+  801142:	29 d0                	sub    %edx,%eax
+}
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	53                   	push   %ebx
+  80114a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801150:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  801153:	eb 09                	jmp    80115e <strncmp+0x18>
+		n--, p++, q++;
+  801155:	83 ea 01             	sub    $0x1,%edx
+  801158:	83 c0 01             	add    $0x1,%eax
+  80115b:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80115e:	85 d2                	test   %edx,%edx
+  801160:	74 18                	je     80117a <strncmp+0x34>
+  801162:	0f b6 18             	movzbl (%eax),%ebx
+  801165:	84 db                	test   %bl,%bl
+  801167:	74 04                	je     80116d <strncmp+0x27>
+  801169:	3a 19                	cmp    (%ecx),%bl
+  80116b:	74 e8                	je     801155 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80116d:	0f b6 00             	movzbl (%eax),%eax
+  801170:	0f b6 11             	movzbl (%ecx),%edx
+  801173:	29 d0                	sub    %edx,%eax
+}
+  801175:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801178:	c9                   	leave
+  801179:	c3                   	ret
+		return 0;
+  80117a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117f:	eb f4                	jmp    801175 <strncmp+0x2f>
+
+00801181 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801181:	55                   	push   %ebp
+  801182:	89 e5                	mov    %esp,%ebp
+  801184:	8b 45 08             	mov    0x8(%ebp),%eax
+  801187:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80118b:	eb 03                	jmp    801190 <strchr+0xf>
+  80118d:	83 c0 01             	add    $0x1,%eax
+  801190:	0f b6 10             	movzbl (%eax),%edx
+  801193:	84 d2                	test   %dl,%dl
+  801195:	74 06                	je     80119d <strchr+0x1c>
+		if (*s == c)
+  801197:	38 ca                	cmp    %cl,%dl
+  801199:	75 f2                	jne    80118d <strchr+0xc>
+  80119b:	eb 05                	jmp    8011a2 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  80119d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a2:	5d                   	pop    %ebp
+  8011a3:	c3                   	ret
+
+008011a4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8011a4:	55                   	push   %ebp
+  8011a5:	89 e5                	mov    %esp,%ebp
+  8011a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011aa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8011ae:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8011b1:	38 ca                	cmp    %cl,%dl
+  8011b3:	74 09                	je     8011be <strfind+0x1a>
+  8011b5:	84 d2                	test   %dl,%dl
+  8011b7:	74 05                	je     8011be <strfind+0x1a>
+	for (; *s; s++)
+  8011b9:	83 c0 01             	add    $0x1,%eax
+  8011bc:	eb f0                	jmp    8011ae <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8011be:	5d                   	pop    %ebp
+  8011bf:	c3                   	ret
+
+008011c0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	57                   	push   %edi
+  8011c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8011c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8011ca:	85 c9                	test   %ecx,%ecx
+  8011cc:	74 20                	je     8011ee <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8011ce:	89 f8                	mov    %edi,%eax
+  8011d0:	09 c8                	or     %ecx,%eax
+  8011d2:	a8 03                	test   $0x3,%al
+  8011d4:	75 12                	jne    8011e8 <memset+0x28>
+		c &= 0xFF;
+  8011d6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8011da:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8011e0:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8011e3:	fc                   	cld
+  8011e4:	f3 ab                	rep stos %eax,%es:(%edi)
+  8011e6:	eb 06                	jmp    8011ee <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8011e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011eb:	fc                   	cld
+  8011ec:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8011ee:	89 f8                	mov    %edi,%eax
+  8011f0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8011f3:	c9                   	leave
+  8011f4:	c3                   	ret
+
+008011f5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8011f5:	55                   	push   %ebp
+  8011f6:	89 e5                	mov    %esp,%ebp
+  8011f8:	57                   	push   %edi
+  8011f9:	56                   	push   %esi
+  8011fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801200:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801203:	39 c6                	cmp    %eax,%esi
+  801205:	73 32                	jae    801239 <memmove+0x44>
+  801207:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80120a:	39 d0                	cmp    %edx,%eax
+  80120c:	73 2b                	jae    801239 <memmove+0x44>
+		s += n;
+		d += n;
+  80120e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801211:	89 d6                	mov    %edx,%esi
+  801213:	09 fe                	or     %edi,%esi
+  801215:	09 ce                	or     %ecx,%esi
+  801217:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80121d:	75 0e                	jne    80122d <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80121f:	83 ef 04             	sub    $0x4,%edi
+  801222:	8d 72 fc             	lea    -0x4(%edx),%esi
+  801225:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  801228:	fd                   	std
+  801229:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80122b:	eb 09                	jmp    801236 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80122d:	83 ef 01             	sub    $0x1,%edi
+  801230:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  801233:	fd                   	std
+  801234:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  801236:	fc                   	cld
+  801237:	eb 1a                	jmp    801253 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801239:	89 f2                	mov    %esi,%edx
+  80123b:	09 c2                	or     %eax,%edx
+  80123d:	09 ca                	or     %ecx,%edx
+  80123f:	f6 c2 03             	test   $0x3,%dl
+  801242:	75 0a                	jne    80124e <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  801244:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  801247:	89 c7                	mov    %eax,%edi
+  801249:	fc                   	cld
+  80124a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80124c:	eb 05                	jmp    801253 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80124e:	89 c7                	mov    %eax,%edi
+  801250:	fc                   	cld
+  801251:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  801253:	5e                   	pop    %esi
+  801254:	5f                   	pop    %edi
+  801255:	5d                   	pop    %ebp
+  801256:	c3                   	ret
+
+00801257 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80125d:	ff 75 10             	push   0x10(%ebp)
+  801260:	ff 75 0c             	push   0xc(%ebp)
+  801263:	ff 75 08             	push   0x8(%ebp)
+  801266:	e8 8a ff ff ff       	call   8011f5 <memmove>
+}
+  80126b:	c9                   	leave
+  80126c:	c3                   	ret
+
+0080126d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	56                   	push   %esi
+  801271:	53                   	push   %ebx
+  801272:	8b 45 08             	mov    0x8(%ebp),%eax
+  801275:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  801278:	89 c6                	mov    %eax,%esi
+  80127a:	03 75 10             	add    0x10(%ebp),%esi
+  80127d:	eb 06                	jmp    801285 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  80127f:	83 c0 01             	add    $0x1,%eax
+  801282:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  801285:	39 f0                	cmp    %esi,%eax
+  801287:	74 14                	je     80129d <memcmp+0x30>
+		if (*s1 != *s2)
+  801289:	0f b6 08             	movzbl (%eax),%ecx
+  80128c:	0f b6 1a             	movzbl (%edx),%ebx
+  80128f:	38 d9                	cmp    %bl,%cl
+  801291:	74 ec                	je     80127f <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801293:	0f b6 c1             	movzbl %cl,%eax
+  801296:	0f b6 db             	movzbl %bl,%ebx
+  801299:	29 d8                	sub    %ebx,%eax
+  80129b:	eb 05                	jmp    8012a2 <memcmp+0x35>
+	}
+
+	return 0;
+  80129d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012a2:	5b                   	pop    %ebx
+  8012a3:	5e                   	pop    %esi
+  8012a4:	5d                   	pop    %ebp
+  8012a5:	c3                   	ret
+
+008012a6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8012a6:	55                   	push   %ebp
+  8012a7:	89 e5                	mov    %esp,%ebp
+  8012a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8012af:	89 c2                	mov    %eax,%edx
+  8012b1:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8012b4:	eb 03                	jmp    8012b9 <memfind+0x13>
+  8012b6:	83 c0 01             	add    $0x1,%eax
+  8012b9:	39 d0                	cmp    %edx,%eax
+  8012bb:	73 04                	jae    8012c1 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8012bd:	38 08                	cmp    %cl,(%eax)
+  8012bf:	75 f5                	jne    8012b6 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8012c1:	5d                   	pop    %ebp
+  8012c2:	c3                   	ret
+
+008012c3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	57                   	push   %edi
+  8012c7:	56                   	push   %esi
+  8012c8:	53                   	push   %ebx
+  8012c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8012cf:	eb 03                	jmp    8012d4 <strtol+0x11>
+		s++;
+  8012d1:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8012d4:	0f b6 02             	movzbl (%edx),%eax
+  8012d7:	3c 20                	cmp    $0x20,%al
+  8012d9:	74 f6                	je     8012d1 <strtol+0xe>
+  8012db:	3c 09                	cmp    $0x9,%al
+  8012dd:	74 f2                	je     8012d1 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8012df:	3c 2b                	cmp    $0x2b,%al
+  8012e1:	74 2a                	je     80130d <strtol+0x4a>
+	int neg = 0;
+  8012e3:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8012e8:	3c 2d                	cmp    $0x2d,%al
+  8012ea:	74 2b                	je     801317 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8012ec:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8012f2:	75 0f                	jne    801303 <strtol+0x40>
+  8012f4:	80 3a 30             	cmpb   $0x30,(%edx)
+  8012f7:	74 28                	je     801321 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8012f9:	85 db                	test   %ebx,%ebx
+  8012fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801300:	0f 44 d8             	cmove  %eax,%ebx
+  801303:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801308:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80130b:	eb 46                	jmp    801353 <strtol+0x90>
+		s++;
+  80130d:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801310:	bf 00 00 00 00       	mov    $0x0,%edi
+  801315:	eb d5                	jmp    8012ec <strtol+0x29>
+		s++, neg = 1;
+  801317:	83 c2 01             	add    $0x1,%edx
+  80131a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80131f:	eb cb                	jmp    8012ec <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801321:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801325:	74 0e                	je     801335 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801327:	85 db                	test   %ebx,%ebx
+  801329:	75 d8                	jne    801303 <strtol+0x40>
+		s++, base = 8;
+  80132b:	83 c2 01             	add    $0x1,%edx
+  80132e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801333:	eb ce                	jmp    801303 <strtol+0x40>
+		s += 2, base = 16;
+  801335:	83 c2 02             	add    $0x2,%edx
+  801338:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80133d:	eb c4                	jmp    801303 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80133f:	0f be c0             	movsbl %al,%eax
+  801342:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801345:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801348:	7d 3a                	jge    801384 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  80134a:	83 c2 01             	add    $0x1,%edx
+  80134d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801351:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801353:	0f b6 02             	movzbl (%edx),%eax
+  801356:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801359:	89 f3                	mov    %esi,%ebx
+  80135b:	80 fb 09             	cmp    $0x9,%bl
+  80135e:	76 df                	jbe    80133f <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  801360:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801363:	89 f3                	mov    %esi,%ebx
+  801365:	80 fb 19             	cmp    $0x19,%bl
+  801368:	77 08                	ja     801372 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  80136a:	0f be c0             	movsbl %al,%eax
+  80136d:	83 e8 57             	sub    $0x57,%eax
+  801370:	eb d3                	jmp    801345 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  801372:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801375:	89 f3                	mov    %esi,%ebx
+  801377:	80 fb 19             	cmp    $0x19,%bl
+  80137a:	77 08                	ja     801384 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  80137c:	0f be c0             	movsbl %al,%eax
+  80137f:	83 e8 37             	sub    $0x37,%eax
+  801382:	eb c1                	jmp    801345 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801384:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801388:	74 05                	je     80138f <strtol+0xcc>
+		*endptr = (char *) s;
+  80138a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80138d:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80138f:	89 c8                	mov    %ecx,%eax
+  801391:	f7 d8                	neg    %eax
+  801393:	85 ff                	test   %edi,%edi
+  801395:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801398:	89 c8                	mov    %ecx,%eax
+  80139a:	5b                   	pop    %ebx
+  80139b:	5e                   	pop    %esi
+  80139c:	5f                   	pop    %edi
+  80139d:	5d                   	pop    %ebp
+  80139e:	c3                   	ret
+
+0080139f <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  80139f:	55                   	push   %ebp
+  8013a0:	89 e5                	mov    %esp,%ebp
+  8013a2:	57                   	push   %edi
+  8013a3:	56                   	push   %esi
+  8013a4:	53                   	push   %ebx
+  8013a5:	83 ec 0c             	sub    $0xc,%esp
+  8013a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8013ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8013ae:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  8013b1:	85 ff                	test   %edi,%edi
+  8013b3:	74 16                	je     8013cb <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  8013b5:	83 ec 04             	sub    $0x4,%esp
+  8013b8:	56                   	push   %esi
+  8013b9:	6a 00                	push   $0x0
+  8013bb:	53                   	push   %ebx
+  8013bc:	e8 02 ff ff ff       	call   8012c3 <strtol>
+  8013c1:	89 07                	mov    %eax,(%edi)
+  8013c3:	83 c4 10             	add    $0x10,%esp
+  8013c6:	eb 03                	jmp    8013cb <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  8013c8:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  8013cb:	0f b6 03             	movzbl (%ebx),%eax
+  8013ce:	3c 20                	cmp    $0x20,%al
+  8013d0:	74 f6                	je     8013c8 <strisl+0x29>
+  8013d2:	3c 09                	cmp    $0x9,%al
+  8013d4:	74 f2                	je     8013c8 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  8013d6:	3c 2b                	cmp    $0x2b,%al
+  8013d8:	74 23                	je     8013fd <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  8013da:	3c 2d                	cmp    $0x2d,%al
+  8013dc:	0f 94 c0             	sete   %al
+  8013df:	0f b6 c0             	movzbl %al,%eax
+  8013e2:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8013e4:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  8013ea:	75 41                	jne    80142d <strisl+0x8e>
+  8013ec:	80 3b 30             	cmpb   $0x30,(%ebx)
+  8013ef:	74 11                	je     801402 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8013f1:	85 f6                	test   %esi,%esi
+  8013f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013f8:	0f 44 f0             	cmove  %eax,%esi
+  8013fb:	eb 30                	jmp    80142d <strisl+0x8e>
+		s++;
+  8013fd:	83 c3 01             	add    $0x1,%ebx
+  801400:	eb e2                	jmp    8013e4 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801402:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  801406:	74 0e                	je     801416 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  801408:	85 f6                	test   %esi,%esi
+  80140a:	75 21                	jne    80142d <strisl+0x8e>
+		s++, base = 8;
+  80140c:	83 c3 01             	add    $0x1,%ebx
+  80140f:	be 08 00 00 00       	mov    $0x8,%esi
+  801414:	eb 17                	jmp    80142d <strisl+0x8e>
+		s += 2, base = 16;
+  801416:	83 c3 02             	add    $0x2,%ebx
+  801419:	be 10 00 00 00       	mov    $0x10,%esi
+  80141e:	eb 0d                	jmp    80142d <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  801420:	0f be c0             	movsbl %al,%eax
+  801423:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  801426:	39 f0                	cmp    %esi,%eax
+  801428:	7d 38                	jge    801462 <strisl+0xc3>
+			return 0;
+		s++;
+  80142a:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  80142d:	0f b6 03             	movzbl (%ebx),%eax
+  801430:	8d 50 d0             	lea    -0x30(%eax),%edx
+  801433:	80 fa 09             	cmp    $0x9,%dl
+  801436:	76 e8                	jbe    801420 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  801438:	8d 50 9f             	lea    -0x61(%eax),%edx
+  80143b:	80 fa 19             	cmp    $0x19,%dl
+  80143e:	77 08                	ja     801448 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  801440:	0f be c0             	movsbl %al,%eax
+  801443:	83 e8 57             	sub    $0x57,%eax
+  801446:	eb de                	jmp    801426 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  801448:	8d 50 bf             	lea    -0x41(%eax),%edx
+  80144b:	80 fa 19             	cmp    $0x19,%dl
+  80144e:	77 08                	ja     801458 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  801450:	0f be c0             	movsbl %al,%eax
+  801453:	83 e8 37             	sub    $0x37,%eax
+  801456:	eb ce                	jmp    801426 <strisl+0x87>
+		else if (!*s)
+  801458:	84 c0                	test   %al,%al
+  80145a:	0f 94 c0             	sete   %al
+  80145d:	0f b6 c0             	movzbl %al,%eax
+  801460:	eb 05                	jmp    801467 <strisl+0xc8>
+			return 0;
+  801462:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  801467:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146a:	5b                   	pop    %ebx
+  80146b:	5e                   	pop    %esi
+  80146c:	5f                   	pop    %edi
+  80146d:	5d                   	pop    %ebp
+  80146e:	c3                   	ret
+
+0080146f <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  80146f:	55                   	push   %ebp
+  801470:	89 e5                	mov    %esp,%ebp
+  801472:	83 ec 10             	sub    $0x10,%esp
+  801475:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  801478:	89 c8                	mov    %ecx,%eax
+  80147a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80147f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801482:	eb 0b                	jmp    80148f <touch_mem+0x20>
+		c = *(char *)page;
+  801484:	0f b6 10             	movzbl (%eax),%edx
+  801487:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  80148a:	05 00 10 00 00       	add    $0x1000,%eax
+  80148f:	39 c8                	cmp    %ecx,%eax
+  801491:	72 f1                	jb     801484 <touch_mem+0x15>
+}
+  801493:	c9                   	leave
+  801494:	c3                   	ret
+
+00801495 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801495:	55                   	push   %ebp
+  801496:	89 e5                	mov    %esp,%ebp
+  801498:	57                   	push   %edi
+  801499:	56                   	push   %esi
+  80149a:	53                   	push   %ebx
+	touch_mem(s, len);
+  80149b:	ff 75 0c             	push   0xc(%ebp)
+  80149e:	ff 75 08             	push   0x8(%ebp)
+  8014a1:	e8 c9 ff ff ff       	call   80146f <touch_mem>
+	asm volatile("int %1\n"
+  8014a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b1:	89 c3                	mov    %eax,%ebx
+  8014b3:	89 c7                	mov    %eax,%edi
+  8014b5:	89 c6                	mov    %eax,%esi
+  8014b7:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8014b9:	83 c4 08             	add    $0x8,%esp
+  8014bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014bf:	5b                   	pop    %ebx
+  8014c0:	5e                   	pop    %esi
+  8014c1:	5f                   	pop    %edi
+  8014c2:	5d                   	pop    %ebp
+  8014c3:	c3                   	ret
+
+008014c4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8014c4:	55                   	push   %ebp
+  8014c5:	89 e5                	mov    %esp,%ebp
+  8014c7:	57                   	push   %edi
+  8014c8:	56                   	push   %esi
+  8014c9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014d4:	89 d1                	mov    %edx,%ecx
+  8014d6:	89 d3                	mov    %edx,%ebx
+  8014d8:	89 d7                	mov    %edx,%edi
+  8014da:	89 d6                	mov    %edx,%esi
+  8014dc:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8014de:	5b                   	pop    %ebx
+  8014df:	5e                   	pop    %esi
+  8014e0:	5f                   	pop    %edi
+  8014e1:	5d                   	pop    %ebp
+  8014e2:	c3                   	ret
+
+008014e3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	57                   	push   %edi
+  8014e7:	56                   	push   %esi
+  8014e8:	53                   	push   %ebx
+  8014e9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8014ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014f4:	b8 03 00 00 00       	mov    $0x3,%eax
+  8014f9:	89 cb                	mov    %ecx,%ebx
+  8014fb:	89 cf                	mov    %ecx,%edi
+  8014fd:	89 ce                	mov    %ecx,%esi
+  8014ff:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801501:	85 c0                	test   %eax,%eax
+  801503:	7f 08                	jg     80150d <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801505:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801508:	5b                   	pop    %ebx
+  801509:	5e                   	pop    %esi
+  80150a:	5f                   	pop    %edi
+  80150b:	5d                   	pop    %ebp
+  80150c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80150d:	83 ec 0c             	sub    $0xc,%esp
+  801510:	50                   	push   %eax
+  801511:	6a 03                	push   $0x3
+  801513:	68 cb 37 80 00       	push   $0x8037cb
+  801518:	6a 23                	push   $0x23
+  80151a:	68 e8 37 80 00       	push   $0x8037e8
+  80151f:	e8 89 f4 ff ff       	call   8009ad <_panic>
+
+00801524 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801524:	55                   	push   %ebp
+  801525:	89 e5                	mov    %esp,%ebp
+  801527:	57                   	push   %edi
+  801528:	56                   	push   %esi
+  801529:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80152a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801534:	89 d1                	mov    %edx,%ecx
+  801536:	89 d3                	mov    %edx,%ebx
+  801538:	89 d7                	mov    %edx,%edi
+  80153a:	89 d6                	mov    %edx,%esi
+  80153c:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80153e:	5b                   	pop    %ebx
+  80153f:	5e                   	pop    %esi
+  801540:	5f                   	pop    %edi
+  801541:	5d                   	pop    %ebp
+  801542:	c3                   	ret
+
+00801543 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	57                   	push   %edi
+  801547:	56                   	push   %esi
+  801548:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801549:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801553:	89 d1                	mov    %edx,%ecx
+  801555:	89 d3                	mov    %edx,%ebx
+  801557:	89 d7                	mov    %edx,%edi
+  801559:	89 d6                	mov    %edx,%esi
+  80155b:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80155d:	5b                   	pop    %ebx
+  80155e:	5e                   	pop    %esi
+  80155f:	5f                   	pop    %edi
+  801560:	5d                   	pop    %ebp
+  801561:	c3                   	ret
+
+00801562 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	57                   	push   %edi
+  801566:	56                   	push   %esi
+  801567:	53                   	push   %ebx
+  801568:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80156b:	be 00 00 00 00       	mov    $0x0,%esi
+  801570:	8b 55 08             	mov    0x8(%ebp),%edx
+  801573:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801576:	b8 04 00 00 00       	mov    $0x4,%eax
+  80157b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80157e:	89 f7                	mov    %esi,%edi
+  801580:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801582:	85 c0                	test   %eax,%eax
+  801584:	7f 08                	jg     80158e <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801589:	5b                   	pop    %ebx
+  80158a:	5e                   	pop    %esi
+  80158b:	5f                   	pop    %edi
+  80158c:	5d                   	pop    %ebp
+  80158d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80158e:	83 ec 0c             	sub    $0xc,%esp
+  801591:	50                   	push   %eax
+  801592:	6a 04                	push   $0x4
+  801594:	68 cb 37 80 00       	push   $0x8037cb
+  801599:	6a 23                	push   $0x23
+  80159b:	68 e8 37 80 00       	push   $0x8037e8
+  8015a0:	e8 08 f4 ff ff       	call   8009ad <_panic>
+
+008015a5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	57                   	push   %edi
+  8015a9:	56                   	push   %esi
+  8015aa:	53                   	push   %ebx
+  8015ab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8015ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8015b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8015bf:	8b 75 18             	mov    0x18(%ebp),%esi
+  8015c2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015c4:	85 c0                	test   %eax,%eax
+  8015c6:	7f 08                	jg     8015d0 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8015c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015cb:	5b                   	pop    %ebx
+  8015cc:	5e                   	pop    %esi
+  8015cd:	5f                   	pop    %edi
+  8015ce:	5d                   	pop    %ebp
+  8015cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015d0:	83 ec 0c             	sub    $0xc,%esp
+  8015d3:	50                   	push   %eax
+  8015d4:	6a 05                	push   $0x5
+  8015d6:	68 cb 37 80 00       	push   $0x8037cb
+  8015db:	6a 23                	push   $0x23
+  8015dd:	68 e8 37 80 00       	push   $0x8037e8
+  8015e2:	e8 c6 f3 ff ff       	call   8009ad <_panic>
+
+008015e7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	57                   	push   %edi
+  8015eb:	56                   	push   %esi
+  8015ec:	53                   	push   %ebx
+  8015ed:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8015f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fb:	b8 06 00 00 00       	mov    $0x6,%eax
+  801600:	89 df                	mov    %ebx,%edi
+  801602:	89 de                	mov    %ebx,%esi
+  801604:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801606:	85 c0                	test   %eax,%eax
+  801608:	7f 08                	jg     801612 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80160a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160d:	5b                   	pop    %ebx
+  80160e:	5e                   	pop    %esi
+  80160f:	5f                   	pop    %edi
+  801610:	5d                   	pop    %ebp
+  801611:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801612:	83 ec 0c             	sub    $0xc,%esp
+  801615:	50                   	push   %eax
+  801616:	6a 06                	push   $0x6
+  801618:	68 cb 37 80 00       	push   $0x8037cb
+  80161d:	6a 23                	push   $0x23
+  80161f:	68 e8 37 80 00       	push   $0x8037e8
+  801624:	e8 84 f3 ff ff       	call   8009ad <_panic>
+
+00801629 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	57                   	push   %edi
+  80162d:	56                   	push   %esi
+  80162e:	53                   	push   %ebx
+  80162f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801632:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801637:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163d:	b8 18 00 00 00       	mov    $0x18,%eax
+  801642:	89 df                	mov    %ebx,%edi
+  801644:	89 de                	mov    %ebx,%esi
+  801646:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801648:	85 c0                	test   %eax,%eax
+  80164a:	7f 08                	jg     801654 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80164c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164f:	5b                   	pop    %ebx
+  801650:	5e                   	pop    %esi
+  801651:	5f                   	pop    %edi
+  801652:	5d                   	pop    %ebp
+  801653:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801654:	83 ec 0c             	sub    $0xc,%esp
+  801657:	50                   	push   %eax
+  801658:	6a 18                	push   $0x18
+  80165a:	68 cb 37 80 00       	push   $0x8037cb
+  80165f:	6a 23                	push   $0x23
+  801661:	68 e8 37 80 00       	push   $0x8037e8
+  801666:	e8 42 f3 ff ff       	call   8009ad <_panic>
+
+0080166b <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  80166b:	55                   	push   %ebp
+  80166c:	89 e5                	mov    %esp,%ebp
+  80166e:	57                   	push   %edi
+  80166f:	56                   	push   %esi
+  801670:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801671:	be 00 00 00 00       	mov    $0x0,%esi
+  801676:	8b 55 08             	mov    0x8(%ebp),%edx
+  801679:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167c:	b8 19 00 00 00       	mov    $0x19,%eax
+  801681:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801684:	89 f7                	mov    %esi,%edi
+  801686:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  801688:	5b                   	pop    %ebx
+  801689:	5e                   	pop    %esi
+  80168a:	5f                   	pop    %edi
+  80168b:	5d                   	pop    %ebp
+  80168c:	c3                   	ret
+
+0080168d <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80168d:	55                   	push   %ebp
+  80168e:	89 e5                	mov    %esp,%ebp
+  801690:	57                   	push   %edi
+  801691:	56                   	push   %esi
+  801692:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801693:	8b 55 08             	mov    0x8(%ebp),%edx
+  801696:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801699:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80169e:	be 00 00 00 00       	mov    $0x0,%esi
+  8016a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016a9:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8016ab:	5b                   	pop    %ebx
+  8016ac:	5e                   	pop    %esi
+  8016ad:	5f                   	pop    %edi
+  8016ae:	5d                   	pop    %ebp
+  8016af:	c3                   	ret
+
+008016b0 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8016b0:	55                   	push   %ebp
+  8016b1:	89 e5                	mov    %esp,%ebp
+  8016b3:	57                   	push   %edi
+  8016b4:	56                   	push   %esi
+  8016b5:	53                   	push   %ebx
+  8016b6:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8016b9:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8016bc:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8016c2:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  8016c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016cb:	b8 10 00 00 00       	mov    $0x10,%eax
+  8016d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016d3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8016d6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8016d8:	85 c0                	test   %eax,%eax
+  8016da:	7f 08                	jg     8016e4 <sys_page_map_range+0x34>
+}
+  8016dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016df:	5b                   	pop    %ebx
+  8016e0:	5e                   	pop    %esi
+  8016e1:	5f                   	pop    %edi
+  8016e2:	5d                   	pop    %ebp
+  8016e3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8016e4:	83 ec 0c             	sub    $0xc,%esp
+  8016e7:	50                   	push   %eax
+  8016e8:	6a 10                	push   $0x10
+  8016ea:	68 cb 37 80 00       	push   $0x8037cb
+  8016ef:	6a 23                	push   $0x23
+  8016f1:	68 e8 37 80 00       	push   $0x8037e8
+  8016f6:	e8 b2 f2 ff ff       	call   8009ad <_panic>
+
+008016fb <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8016fb:	55                   	push   %ebp
+  8016fc:	89 e5                	mov    %esp,%ebp
+  8016fe:	57                   	push   %edi
+  8016ff:	56                   	push   %esi
+  801700:	53                   	push   %ebx
+  801701:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801704:	be 00 00 00 00       	mov    $0x0,%esi
+  801709:	8b 55 08             	mov    0x8(%ebp),%edx
+  80170c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80170f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801714:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801717:	89 f7                	mov    %esi,%edi
+  801719:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80171b:	85 c0                	test   %eax,%eax
+  80171d:	7f 08                	jg     801727 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80171f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801722:	5b                   	pop    %ebx
+  801723:	5e                   	pop    %esi
+  801724:	5f                   	pop    %edi
+  801725:	5d                   	pop    %ebp
+  801726:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801727:	83 ec 0c             	sub    $0xc,%esp
+  80172a:	50                   	push   %eax
+  80172b:	6a 11                	push   $0x11
+  80172d:	68 cb 37 80 00       	push   $0x8037cb
+  801732:	6a 23                	push   $0x23
+  801734:	68 e8 37 80 00       	push   $0x8037e8
+  801739:	e8 6f f2 ff ff       	call   8009ad <_panic>
+
+0080173e <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  80173e:	55                   	push   %ebp
+  80173f:	89 e5                	mov    %esp,%ebp
+  801741:	57                   	push   %edi
+  801742:	56                   	push   %esi
+  801743:	53                   	push   %ebx
+  801744:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801747:	be 00 00 00 00       	mov    $0x0,%esi
+  80174c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801752:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801757:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80175a:	89 f7                	mov    %esi,%edi
+  80175c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80175e:	85 c0                	test   %eax,%eax
+  801760:	7f 08                	jg     80176a <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801765:	5b                   	pop    %ebx
+  801766:	5e                   	pop    %esi
+  801767:	5f                   	pop    %edi
+  801768:	5d                   	pop    %ebp
+  801769:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80176a:	83 ec 0c             	sub    $0xc,%esp
+  80176d:	50                   	push   %eax
+  80176e:	6a 1b                	push   $0x1b
+  801770:	68 cb 37 80 00       	push   $0x8037cb
+  801775:	6a 23                	push   $0x23
+  801777:	68 e8 37 80 00       	push   $0x8037e8
+  80177c:	e8 2c f2 ff ff       	call   8009ad <_panic>
+
+00801781 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801781:	55                   	push   %ebp
+  801782:	89 e5                	mov    %esp,%ebp
+  801784:	57                   	push   %edi
+  801785:	56                   	push   %esi
+  801786:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801787:	ba 00 00 00 00       	mov    $0x0,%edx
+  80178c:	b8 12 00 00 00       	mov    $0x12,%eax
+  801791:	89 d1                	mov    %edx,%ecx
+  801793:	89 d3                	mov    %edx,%ebx
+  801795:	89 d7                	mov    %edx,%edi
+  801797:	89 d6                	mov    %edx,%esi
+  801799:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80179b:	5b                   	pop    %ebx
+  80179c:	5e                   	pop    %esi
+  80179d:	5f                   	pop    %edi
+  80179e:	5d                   	pop    %ebp
+  80179f:	c3                   	ret
+
+008017a0 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8017a0:	55                   	push   %ebp
+  8017a1:	89 e5                	mov    %esp,%ebp
+  8017a3:	57                   	push   %edi
+  8017a4:	56                   	push   %esi
+  8017a5:	53                   	push   %ebx
+  8017a6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8017a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017b9:	89 df                	mov    %ebx,%edi
+  8017bb:	89 de                	mov    %ebx,%esi
+  8017bd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017bf:	85 c0                	test   %eax,%eax
+  8017c1:	7f 08                	jg     8017cb <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8017c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c6:	5b                   	pop    %ebx
+  8017c7:	5e                   	pop    %esi
+  8017c8:	5f                   	pop    %edi
+  8017c9:	5d                   	pop    %ebp
+  8017ca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017cb:	83 ec 0c             	sub    $0xc,%esp
+  8017ce:	50                   	push   %eax
+  8017cf:	6a 08                	push   $0x8
+  8017d1:	68 cb 37 80 00       	push   $0x8037cb
+  8017d6:	6a 23                	push   $0x23
+  8017d8:	68 e8 37 80 00       	push   $0x8037e8
+  8017dd:	e8 cb f1 ff ff       	call   8009ad <_panic>
+
+008017e2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8017e2:	55                   	push   %ebp
+  8017e3:	89 e5                	mov    %esp,%ebp
+  8017e5:	57                   	push   %edi
+  8017e6:	56                   	push   %esi
+  8017e7:	53                   	push   %ebx
+  8017e8:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  8017eb:	6a 44                	push   $0x44
+  8017ed:	ff 75 0c             	push   0xc(%ebp)
+  8017f0:	e8 7a fc ff ff       	call   80146f <touch_mem>
+	asm volatile("int %1\n"
+  8017f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fd:	b8 09 00 00 00       	mov    $0x9,%eax
+  801802:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801805:	89 df                	mov    %ebx,%edi
+  801807:	89 de                	mov    %ebx,%esi
+  801809:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80180b:	83 c4 08             	add    $0x8,%esp
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	7f 08                	jg     80181a <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801812:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801815:	5b                   	pop    %ebx
+  801816:	5e                   	pop    %esi
+  801817:	5f                   	pop    %edi
+  801818:	5d                   	pop    %ebp
+  801819:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80181a:	83 ec 0c             	sub    $0xc,%esp
+  80181d:	50                   	push   %eax
+  80181e:	6a 09                	push   $0x9
+  801820:	68 cb 37 80 00       	push   $0x8037cb
+  801825:	6a 23                	push   $0x23
+  801827:	68 e8 37 80 00       	push   $0x8037e8
+  80182c:	e8 7c f1 ff ff       	call   8009ad <_panic>
+
+00801831 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	57                   	push   %edi
+  801835:	56                   	push   %esi
+  801836:	53                   	push   %ebx
+  801837:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80183a:	be 00 00 00 00       	mov    $0x0,%esi
+  80183f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801842:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801845:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80184a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80184d:	89 f7                	mov    %esi,%edi
+  80184f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801851:	85 c0                	test   %eax,%eax
+  801853:	7f 08                	jg     80185d <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801855:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801858:	5b                   	pop    %ebx
+  801859:	5e                   	pop    %esi
+  80185a:	5f                   	pop    %edi
+  80185b:	5d                   	pop    %ebp
+  80185c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80185d:	83 ec 0c             	sub    $0xc,%esp
+  801860:	50                   	push   %eax
+  801861:	6a 1a                	push   $0x1a
+  801863:	68 cb 37 80 00       	push   $0x8037cb
+  801868:	6a 23                	push   $0x23
+  80186a:	68 e8 37 80 00       	push   $0x8037e8
+  80186f:	e8 39 f1 ff ff       	call   8009ad <_panic>
+
+00801874 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801874:	55                   	push   %ebp
+  801875:	89 e5                	mov    %esp,%ebp
+  801877:	57                   	push   %edi
+  801878:	56                   	push   %esi
+  801879:	53                   	push   %ebx
+  80187a:	83 ec 0c             	sub    $0xc,%esp
+  80187d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801880:	89 d8                	mov    %ebx,%eax
+  801882:	c1 e0 05             	shl    $0x5,%eax
+  801885:	50                   	push   %eax
+  801886:	ff 75 0c             	push   0xc(%ebp)
+  801889:	e8 e1 fb ff ff       	call   80146f <touch_mem>
+	asm volatile("int %1\n"
+  80188e:	be 00 00 00 00       	mov    $0x0,%esi
+  801893:	8b 55 08             	mov    0x8(%ebp),%edx
+  801896:	b8 13 00 00 00       	mov    $0x13,%eax
+  80189b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80189e:	89 f7                	mov    %esi,%edi
+  8018a0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018a2:	83 c4 08             	add    $0x8,%esp
+  8018a5:	85 c0                	test   %eax,%eax
+  8018a7:	7f 08                	jg     8018b1 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8018a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ac:	5b                   	pop    %ebx
+  8018ad:	5e                   	pop    %esi
+  8018ae:	5f                   	pop    %edi
+  8018af:	5d                   	pop    %ebp
+  8018b0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018b1:	83 ec 0c             	sub    $0xc,%esp
+  8018b4:	50                   	push   %eax
+  8018b5:	6a 13                	push   $0x13
+  8018b7:	68 cb 37 80 00       	push   $0x8037cb
+  8018bc:	6a 23                	push   $0x23
+  8018be:	68 e8 37 80 00       	push   $0x8037e8
+  8018c3:	e8 e5 f0 ff ff       	call   8009ad <_panic>
+
+008018c8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8018c8:	55                   	push   %ebp
+  8018c9:	89 e5                	mov    %esp,%ebp
+  8018cb:	57                   	push   %edi
+  8018cc:	56                   	push   %esi
+  8018cd:	53                   	push   %ebx
+  8018ce:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8018d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8018e1:	89 df                	mov    %ebx,%edi
+  8018e3:	89 de                	mov    %ebx,%esi
+  8018e5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	7f 08                	jg     8018f3 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8018eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ee:	5b                   	pop    %ebx
+  8018ef:	5e                   	pop    %esi
+  8018f0:	5f                   	pop    %edi
+  8018f1:	5d                   	pop    %ebp
+  8018f2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8018f3:	83 ec 0c             	sub    $0xc,%esp
+  8018f6:	50                   	push   %eax
+  8018f7:	6a 0a                	push   $0xa
+  8018f9:	68 cb 37 80 00       	push   $0x8037cb
+  8018fe:	6a 23                	push   $0x23
+  801900:	68 e8 37 80 00       	push   $0x8037e8
+  801905:	e8 a3 f0 ff ff       	call   8009ad <_panic>
+
+0080190a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80190a:	55                   	push   %ebp
+  80190b:	89 e5                	mov    %esp,%ebp
+  80190d:	57                   	push   %edi
+  80190e:	56                   	push   %esi
+  80190f:	53                   	push   %ebx
+  801910:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801913:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801919:	76 1d                	jbe    801938 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80191b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801921:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801926:	be 01 00 00 00       	mov    $0x1,%esi
+  80192b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80192e:	cd 30                	int    $0x30
+}
+  801930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801933:	5b                   	pop    %ebx
+  801934:	5e                   	pop    %esi
+  801935:	5f                   	pop    %edi
+  801936:	5d                   	pop    %ebp
+  801937:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801938:	68 00 10 00 00       	push   $0x1000
+  80193d:	53                   	push   %ebx
+  80193e:	e8 2c fb ff ff       	call   80146f <touch_mem>
+  801943:	83 c4 08             	add    $0x8,%esp
+  801946:	eb d3                	jmp    80191b <sys_ipc_send+0x11>
+
+00801948 <sys_ipc_send_pages>:
+{
+  801948:	55                   	push   %ebp
+  801949:	89 e5                	mov    %esp,%ebp
+  80194b:	57                   	push   %edi
+  80194c:	56                   	push   %esi
+  80194d:	53                   	push   %ebx
+  80194e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801951:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801954:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80195a:	76 18                	jbe    801974 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80195c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80195f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801962:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801967:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80196a:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80196c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80196f:	5b                   	pop    %ebx
+  801970:	5e                   	pop    %esi
+  801971:	5f                   	pop    %edi
+  801972:	5d                   	pop    %ebp
+  801973:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801974:	89 f0                	mov    %esi,%eax
+  801976:	c1 e0 0c             	shl    $0xc,%eax
+  801979:	50                   	push   %eax
+  80197a:	53                   	push   %ebx
+  80197b:	e8 ef fa ff ff       	call   80146f <touch_mem>
+  801980:	83 c4 08             	add    $0x8,%esp
+  801983:	eb d7                	jmp    80195c <sys_ipc_send_pages+0x14>
+
+00801985 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801985:	55                   	push   %ebp
+  801986:	89 e5                	mov    %esp,%ebp
+  801988:	57                   	push   %edi
+  801989:	56                   	push   %esi
+  80198a:	53                   	push   %ebx
+  80198b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80198e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801993:	8b 55 08             	mov    0x8(%ebp),%edx
+  801996:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801999:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80199e:	89 df                	mov    %ebx,%edi
+  8019a0:	89 de                	mov    %ebx,%esi
+  8019a2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8019a4:	85 c0                	test   %eax,%eax
+  8019a6:	7f 08                	jg     8019b0 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8019a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ab:	5b                   	pop    %ebx
+  8019ac:	5e                   	pop    %esi
+  8019ad:	5f                   	pop    %edi
+  8019ae:	5d                   	pop    %ebp
+  8019af:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8019b0:	83 ec 0c             	sub    $0xc,%esp
+  8019b3:	50                   	push   %eax
+  8019b4:	6a 0d                	push   $0xd
+  8019b6:	68 cb 37 80 00       	push   $0x8037cb
+  8019bb:	6a 23                	push   $0x23
+  8019bd:	68 e8 37 80 00       	push   $0x8037e8
+  8019c2:	e8 e6 ef ff ff       	call   8009ad <_panic>
+
+008019c7 <sys_ipc_recv>:
+{
+  8019c7:	55                   	push   %ebp
+  8019c8:	89 e5                	mov    %esp,%ebp
+  8019ca:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8019cd:	6a 01                	push   $0x1
+  8019cf:	ff 75 08             	push   0x8(%ebp)
+  8019d2:	e8 ae ff ff ff       	call   801985 <sys_ipc_recv_pages>
+}
+  8019d7:	c9                   	leave
+  8019d8:	c3                   	ret
+
+008019d9 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8019d9:	55                   	push   %ebp
+  8019da:	89 e5                	mov    %esp,%ebp
+  8019dc:	57                   	push   %edi
+  8019dd:	56                   	push   %esi
+  8019de:	53                   	push   %ebx
+  8019df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019e2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8019e5:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8019e8:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8019ee:	77 04                	ja     8019f4 <sys_ipc_call+0x1b>
+  8019f0:	85 f6                	test   %esi,%esi
+  8019f2:	75 15                	jne    801a09 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8019f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8019fa:	b8 14 00 00 00       	mov    $0x14,%eax
+  8019ff:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801a01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a04:	5b                   	pop    %ebx
+  801a05:	5e                   	pop    %esi
+  801a06:	5f                   	pop    %edi
+  801a07:	5d                   	pop    %ebp
+  801a08:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801a09:	89 f8                	mov    %edi,%eax
+  801a0b:	c1 e0 0c             	shl    $0xc,%eax
+  801a0e:	50                   	push   %eax
+  801a0f:	53                   	push   %ebx
+  801a10:	e8 5a fa ff ff       	call   80146f <touch_mem>
+  801a15:	83 c4 08             	add    $0x8,%esp
+  801a18:	eb da                	jmp    8019f4 <sys_ipc_call+0x1b>
+
+00801a1a <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801a1a:	55                   	push   %ebp
+  801a1b:	89 e5                	mov    %esp,%ebp
+  801a1d:	57                   	push   %edi
+  801a1e:	56                   	push   %esi
+  801a1f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801a20:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a26:	b8 15 00 00 00       	mov    $0x15,%eax
+  801a2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a2e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801a31:	8b 75 18             	mov    0x18(%ebp),%esi
+  801a34:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801a36:	5b                   	pop    %ebx
+  801a37:	5e                   	pop    %esi
+  801a38:	5f                   	pop    %edi
+  801a39:	5d                   	pop    %ebp
+  801a3a:	c3                   	ret
+
+00801a3b <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801a3b:	55                   	push   %ebp
+  801a3c:	89 e5                	mov    %esp,%ebp
+  801a3e:	57                   	push   %edi
+  801a3f:	56                   	push   %esi
+  801a40:	53                   	push   %ebx
+  801a41:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801a44:	6a 04                	push   $0x4
+  801a46:	ff 75 08             	push   0x8(%ebp)
+  801a49:	e8 21 fa ff ff       	call   80146f <touch_mem>
+	asm volatile("int %1\n"
+  801a4e:	be 00 00 00 00       	mov    $0x0,%esi
+  801a53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a56:	b8 16 00 00 00       	mov    $0x16,%eax
+  801a5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801a61:	89 f7                	mov    %esi,%edi
+  801a63:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801a65:	83 c4 08             	add    $0x8,%esp
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	7f 08                	jg     801a74 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801a6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a6f:	5b                   	pop    %ebx
+  801a70:	5e                   	pop    %esi
+  801a71:	5f                   	pop    %edi
+  801a72:	5d                   	pop    %ebp
+  801a73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801a74:	83 ec 0c             	sub    $0xc,%esp
+  801a77:	50                   	push   %eax
+  801a78:	6a 16                	push   $0x16
+  801a7a:	68 cb 37 80 00       	push   $0x8037cb
+  801a7f:	6a 23                	push   $0x23
+  801a81:	68 e8 37 80 00       	push   $0x8037e8
+  801a86:	e8 22 ef ff ff       	call   8009ad <_panic>
+
+00801a8b <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801a8b:	55                   	push   %ebp
+  801a8c:	89 e5                	mov    %esp,%ebp
+  801a8e:	57                   	push   %edi
+  801a8f:	56                   	push   %esi
+  801a90:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801a91:	6a 04                	push   $0x4
+  801a93:	ff 75 08             	push   0x8(%ebp)
+  801a96:	e8 d4 f9 ff ff       	call   80146f <touch_mem>
+	asm volatile("int %1\n"
+  801a9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa3:	b8 17 00 00 00       	mov    $0x17,%eax
+  801aa8:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aab:	89 df                	mov    %ebx,%edi
+  801aad:	89 de                	mov    %ebx,%esi
+  801aaf:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801ab1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab4:	5b                   	pop    %ebx
+  801ab5:	5e                   	pop    %esi
+  801ab6:	5f                   	pop    %edi
+  801ab7:	5d                   	pop    %ebp
+  801ab8:	c3                   	ret
+
+00801ab9 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+  801abc:	57                   	push   %edi
+  801abd:	56                   	push   %esi
+  801abe:	53                   	push   %ebx
+  801abf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801ac2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aca:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801acf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ad4:	89 df                	mov    %ebx,%edi
+  801ad6:	89 de                	mov    %ebx,%esi
+  801ad8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801ada:	85 c0                	test   %eax,%eax
+  801adc:	7f 08                	jg     801ae6 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801ade:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae1:	5b                   	pop    %ebx
+  801ae2:	5e                   	pop    %esi
+  801ae3:	5f                   	pop    %edi
+  801ae4:	5d                   	pop    %ebp
+  801ae5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801ae6:	83 ec 0c             	sub    $0xc,%esp
+  801ae9:	50                   	push   %eax
+  801aea:	6a 0e                	push   $0xe
+  801aec:	68 cb 37 80 00       	push   $0x8037cb
+  801af1:	6a 23                	push   $0x23
+  801af3:	68 e8 37 80 00       	push   $0x8037e8
+  801af8:	e8 b0 ee ff ff       	call   8009ad <_panic>
+
+00801afd <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  801afd:	55                   	push   %ebp
+  801afe:	89 e5                	mov    %esp,%ebp
+  801b00:	57                   	push   %edi
+  801b01:	56                   	push   %esi
+  801b02:	53                   	push   %ebx
+  801b03:	83 ec 14             	sub    $0x14,%esp
+  801b06:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b09:	8b 75 14             	mov    0x14(%ebp),%esi
+  801b0c:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  801b0f:	ff 75 10             	push   0x10(%ebp)
+  801b12:	ff 75 0c             	push   0xc(%ebp)
+  801b15:	e8 6b fe ff ff       	call   801985 <sys_ipc_recv_pages>
+  801b1a:	83 c4 10             	add    $0x10,%esp
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 46                	js     801b67 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801b21:	85 ff                	test   %edi,%edi
+  801b23:	74 0d                	je     801b32 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  801b25:	a1 08 50 80 00       	mov    0x805008,%eax
+  801b2a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801b30:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801b32:	85 f6                	test   %esi,%esi
+  801b34:	74 0d                	je     801b43 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  801b36:	a1 08 50 80 00       	mov    0x805008,%eax
+  801b3b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801b41:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  801b43:	85 db                	test   %ebx,%ebx
+  801b45:	74 0d                	je     801b54 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  801b47:	a1 08 50 80 00       	mov    0x805008,%eax
+  801b4c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801b52:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801b54:	a1 08 50 80 00       	mov    0x805008,%eax
+  801b59:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801b5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b62:	5b                   	pop    %ebx
+  801b63:	5e                   	pop    %esi
+  801b64:	5f                   	pop    %edi
+  801b65:	5d                   	pop    %ebp
+  801b66:	c3                   	ret
+		if (from_env_store) {
+  801b67:	85 ff                	test   %edi,%edi
+  801b69:	74 06                	je     801b71 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  801b6b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  801b71:	85 f6                	test   %esi,%esi
+  801b73:	74 06                	je     801b7b <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  801b75:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  801b7b:	85 db                	test   %ebx,%ebx
+  801b7d:	74 e0                	je     801b5f <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  801b7f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801b85:	eb d8                	jmp    801b5f <ipc_recv_pages+0x62>
+
+00801b87 <ipc_recv>:
+{
+  801b87:	55                   	push   %ebp
+  801b88:	89 e5                	mov    %esp,%ebp
+  801b8a:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  801b8d:	6a 00                	push   $0x0
+  801b8f:	ff 75 10             	push   0x10(%ebp)
+  801b92:	6a 01                	push   $0x1
+  801b94:	ff 75 0c             	push   0xc(%ebp)
+  801b97:	ff 75 08             	push   0x8(%ebp)
+  801b9a:	e8 5e ff ff ff       	call   801afd <ipc_recv_pages>
+}
+  801b9f:	c9                   	leave
+  801ba0:	c3                   	ret
+
+00801ba1 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  801ba1:	55                   	push   %ebp
+  801ba2:	89 e5                	mov    %esp,%ebp
+  801ba4:	56                   	push   %esi
+  801ba5:	53                   	push   %ebx
+  801ba6:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ba9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  801bac:	83 ec 0c             	sub    $0xc,%esp
+  801baf:	ff 75 0c             	push   0xc(%ebp)
+  801bb2:	e8 02 ff ff ff       	call   801ab9 <sys_ipc_try_recv>
+  801bb7:	83 c4 10             	add    $0x10,%esp
+  801bba:	85 c0                	test   %eax,%eax
+  801bbc:	78 34                	js     801bf2 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801bbe:	85 f6                	test   %esi,%esi
+  801bc0:	74 0d                	je     801bcf <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  801bc2:	a1 08 50 80 00       	mov    0x805008,%eax
+  801bc7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801bcd:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  801bcf:	85 db                	test   %ebx,%ebx
+  801bd1:	74 0d                	je     801be0 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  801bd3:	a1 08 50 80 00       	mov    0x805008,%eax
+  801bd8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801bde:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801be0:	a1 08 50 80 00       	mov    0x805008,%eax
+  801be5:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801beb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bee:	5b                   	pop    %ebx
+  801bef:	5e                   	pop    %esi
+  801bf0:	5d                   	pop    %ebp
+  801bf1:	c3                   	ret
+		if (from_env_store) {
+  801bf2:	85 f6                	test   %esi,%esi
+  801bf4:	74 06                	je     801bfc <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  801bf6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  801bfc:	85 db                	test   %ebx,%ebx
+  801bfe:	74 eb                	je     801beb <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  801c00:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801c06:	eb e3                	jmp    801beb <ipc_try_recv+0x4a>
+
+00801c08 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  801c08:	55                   	push   %ebp
+  801c09:	89 e5                	mov    %esp,%ebp
+  801c0b:	83 ec 14             	sub    $0x14,%esp
+  801c0e:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801c11:	85 c0                	test   %eax,%eax
+  801c13:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801c18:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801c1b:	ff 75 18             	push   0x18(%ebp)
+  801c1e:	ff 75 14             	push   0x14(%ebp)
+  801c21:	50                   	push   %eax
+  801c22:	ff 75 0c             	push   0xc(%ebp)
+  801c25:	ff 75 08             	push   0x8(%ebp)
+  801c28:	e8 1b fd ff ff       	call   801948 <sys_ipc_send_pages>
+  801c2d:	83 c4 20             	add    $0x20,%esp
+  801c30:	85 c0                	test   %eax,%eax
+  801c32:	78 02                	js     801c36 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  801c34:	c9                   	leave
+  801c35:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  801c36:	50                   	push   %eax
+  801c37:	68 f8 37 80 00       	push   $0x8037f8
+  801c3c:	68 80 00 00 00       	push   $0x80
+  801c41:	68 24 38 80 00       	push   $0x803824
+  801c46:	e8 62 ed ff ff       	call   8009ad <_panic>
+
+00801c4b <ipc_send>:
+{
+  801c4b:	55                   	push   %ebp
+  801c4c:	89 e5                	mov    %esp,%ebp
+  801c4e:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  801c51:	ff 75 14             	push   0x14(%ebp)
+  801c54:	6a 01                	push   $0x1
+  801c56:	ff 75 10             	push   0x10(%ebp)
+  801c59:	ff 75 0c             	push   0xc(%ebp)
+  801c5c:	ff 75 08             	push   0x8(%ebp)
+  801c5f:	e8 a4 ff ff ff       	call   801c08 <ipc_send_pages>
+}
+  801c64:	83 c4 20             	add    $0x20,%esp
+  801c67:	c9                   	leave
+  801c68:	c3                   	ret
+
+00801c69 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  801c69:	55                   	push   %ebp
+  801c6a:	89 e5                	mov    %esp,%ebp
+  801c6c:	83 ec 14             	sub    $0x14,%esp
+  801c6f:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801c72:	85 c0                	test   %eax,%eax
+  801c74:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801c79:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801c7c:	ff 75 18             	push   0x18(%ebp)
+  801c7f:	ff 75 14             	push   0x14(%ebp)
+  801c82:	50                   	push   %eax
+  801c83:	ff 75 0c             	push   0xc(%ebp)
+  801c86:	ff 75 08             	push   0x8(%ebp)
+  801c89:	e8 4b fd ff ff       	call   8019d9 <sys_ipc_call>
+  801c8e:	83 c4 20             	add    $0x20,%esp
+  801c91:	85 c0                	test   %eax,%eax
+  801c93:	78 0b                	js     801ca0 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  801c95:	a1 08 50 80 00       	mov    0x805008,%eax
+  801c9a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801ca0:	c9                   	leave
+  801ca1:	c3                   	ret
+
+00801ca2 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  801ca2:	55                   	push   %ebp
+  801ca3:	89 e5                	mov    %esp,%ebp
+  801ca5:	57                   	push   %edi
+  801ca6:	56                   	push   %esi
+  801ca7:	53                   	push   %ebx
+  801ca8:	83 ec 18             	sub    $0x18,%esp
+  801cab:	8b 45 10             	mov    0x10(%ebp),%eax
+  801cae:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801cb1:	8b 75 20             	mov    0x20(%ebp),%esi
+  801cb4:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801cbe:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801cc1:	ff 75 18             	push   0x18(%ebp)
+  801cc4:	ff 75 14             	push   0x14(%ebp)
+  801cc7:	50                   	push   %eax
+  801cc8:	ff 75 0c             	push   0xc(%ebp)
+  801ccb:	ff 75 08             	push   0x8(%ebp)
+  801cce:	e8 47 fd ff ff       	call   801a1a <sys_ipc_reply_recv>
+  801cd3:	83 c4 20             	add    $0x20,%esp
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 46                	js     801d20 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801cda:	85 ff                	test   %edi,%edi
+  801cdc:	74 0d                	je     801ceb <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  801cde:	a1 08 50 80 00       	mov    0x805008,%eax
+  801ce3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801ce9:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801ceb:	85 f6                	test   %esi,%esi
+  801ced:	74 0d                	je     801cfc <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  801cef:	a1 08 50 80 00       	mov    0x805008,%eax
+  801cf4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801cfa:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  801cfc:	85 db                	test   %ebx,%ebx
+  801cfe:	74 0d                	je     801d0d <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  801d00:	a1 08 50 80 00       	mov    0x805008,%eax
+  801d05:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801d0b:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801d0d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801d12:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801d18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d1b:	5b                   	pop    %ebx
+  801d1c:	5e                   	pop    %esi
+  801d1d:	5f                   	pop    %edi
+  801d1e:	5d                   	pop    %ebp
+  801d1f:	c3                   	ret
+		if (from_env_store) {
+  801d20:	85 ff                	test   %edi,%edi
+  801d22:	74 06                	je     801d2a <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  801d24:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  801d2a:	85 f6                	test   %esi,%esi
+  801d2c:	74 06                	je     801d34 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  801d2e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  801d34:	85 db                	test   %ebx,%ebx
+  801d36:	74 e0                	je     801d18 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  801d38:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801d3e:	eb d8                	jmp    801d18 <ipc_reply_recv+0x76>
+
+00801d40 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801d40:	55                   	push   %ebp
+  801d41:	89 e5                	mov    %esp,%ebp
+  801d43:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801d46:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801d4b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801d4e:	c1 e0 06             	shl    $0x6,%eax
+  801d51:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d56:	8b 40 50             	mov    0x50(%eax),%eax
+  801d59:	39 c8                	cmp    %ecx,%eax
+  801d5b:	74 12                	je     801d6f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801d5d:	83 c2 01             	add    $0x1,%edx
+  801d60:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801d66:	75 e3                	jne    801d4b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801d68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6d:	eb 0e                	jmp    801d7d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801d6f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801d72:	c1 e0 06             	shl    $0x6,%eax
+  801d75:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d7a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801d7d:	5d                   	pop    %ebp
+  801d7e:	c3                   	ret
+
+00801d7f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801d7f:	55                   	push   %ebp
+  801d80:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d85:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d8a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801d8d:	5d                   	pop    %ebp
+  801d8e:	c3                   	ret
+
+00801d8f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801d8f:	55                   	push   %ebp
+  801d90:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d92:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d95:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801d9a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d9f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801da4:	5d                   	pop    %ebp
+  801da5:	c3                   	ret
+
+00801da6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801da9:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801dae:	a8 01                	test   $0x1,%al
+  801db0:	74 3c                	je     801dee <fd_alloc+0x48>
+  801db2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801db7:	89 c2                	mov    %eax,%edx
+  801db9:	c1 ea 0c             	shr    $0xc,%edx
+  801dbc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dc3:	89 c1                	mov    %eax,%ecx
+  801dc5:	05 00 10 00 00       	add    $0x1000,%eax
+  801dca:	f6 c2 01             	test   $0x1,%dl
+  801dcd:	74 13                	je     801de2 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801dcf:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801dd4:	75 e1                	jne    801db7 <fd_alloc+0x11>
+  801dd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801ddb:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801de0:	eb 05                	jmp    801de7 <fd_alloc+0x41>
+			return 0;
+  801de2:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801de7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dea:	89 0a                	mov    %ecx,(%edx)
+}
+  801dec:	5d                   	pop    %ebp
+  801ded:	c3                   	ret
+  801dee:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801df3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df8:	eb ed                	jmp    801de7 <fd_alloc+0x41>
+
+00801dfa <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801dfa:	55                   	push   %ebp
+  801dfb:	89 e5                	mov    %esp,%ebp
+  801dfd:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801e00:	83 f8 1f             	cmp    $0x1f,%eax
+  801e03:	77 30                	ja     801e35 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801e05:	c1 e0 0c             	shl    $0xc,%eax
+  801e08:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801e0d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e13:	f6 c2 01             	test   $0x1,%dl
+  801e16:	74 24                	je     801e3c <fd_lookup+0x42>
+  801e18:	89 c2                	mov    %eax,%edx
+  801e1a:	c1 ea 0c             	shr    $0xc,%edx
+  801e1d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e24:	f6 c2 01             	test   $0x1,%dl
+  801e27:	74 1a                	je     801e43 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801e29:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e2c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e33:	5d                   	pop    %ebp
+  801e34:	c3                   	ret
+		return -E_INVAL;
+  801e35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e3a:	eb f7                	jmp    801e33 <fd_lookup+0x39>
+		return -E_INVAL;
+  801e3c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e41:	eb f0                	jmp    801e33 <fd_lookup+0x39>
+  801e43:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e48:	eb e9                	jmp    801e33 <fd_lookup+0x39>
+
+00801e4a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801e4a:	55                   	push   %ebp
+  801e4b:	89 e5                	mov    %esp,%ebp
+  801e4d:	53                   	push   %ebx
+  801e4e:	83 ec 04             	sub    $0x4,%esp
+  801e51:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801e54:	b8 ac 38 80 00       	mov    $0x8038ac,%eax
+  801e59:	8b 18                	mov    (%eax),%ebx
+  801e5b:	85 db                	test   %ebx,%ebx
+  801e5d:	74 0e                	je     801e6d <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801e5f:	83 c0 04             	add    $0x4,%eax
+  801e62:	39 13                	cmp    %edx,(%ebx)
+  801e64:	75 f3                	jne    801e59 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801e66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e6b:	eb 1f                	jmp    801e8c <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e6d:	a1 08 50 80 00       	mov    0x805008,%eax
+  801e72:	8b 40 48             	mov    0x48(%eax),%eax
+  801e75:	83 ec 04             	sub    $0x4,%esp
+  801e78:	52                   	push   %edx
+  801e79:	50                   	push   %eax
+  801e7a:	68 30 38 80 00       	push   $0x803830
+  801e7f:	e8 04 ec ff ff       	call   800a88 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801e84:	83 c4 10             	add    $0x10,%esp
+  801e87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801e8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e8f:	89 1a                	mov    %ebx,(%edx)
+}
+  801e91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e94:	c9                   	leave
+  801e95:	c3                   	ret
+
+00801e96 <fd_close>:
+{
+  801e96:	55                   	push   %ebp
+  801e97:	89 e5                	mov    %esp,%ebp
+  801e99:	57                   	push   %edi
+  801e9a:	56                   	push   %esi
+  801e9b:	53                   	push   %ebx
+  801e9c:	83 ec 24             	sub    $0x24,%esp
+  801e9f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ea2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ea5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ea8:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801ea9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801eaf:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801eb2:	50                   	push   %eax
+  801eb3:	e8 42 ff ff ff       	call   801dfa <fd_lookup>
+  801eb8:	89 c3                	mov    %eax,%ebx
+  801eba:	83 c4 10             	add    $0x10,%esp
+  801ebd:	85 c0                	test   %eax,%eax
+  801ebf:	78 05                	js     801ec6 <fd_close+0x30>
+	    || fd != fd2)
+  801ec1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ec4:	74 16                	je     801edc <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801ec6:	89 f8                	mov    %edi,%eax
+  801ec8:	84 c0                	test   %al,%al
+  801eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ecf:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801ed2:	89 d8                	mov    %ebx,%eax
+  801ed4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed7:	5b                   	pop    %ebx
+  801ed8:	5e                   	pop    %esi
+  801ed9:	5f                   	pop    %edi
+  801eda:	5d                   	pop    %ebp
+  801edb:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801edc:	83 ec 08             	sub    $0x8,%esp
+  801edf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801ee2:	50                   	push   %eax
+  801ee3:	ff 36                	push   (%esi)
+  801ee5:	e8 60 ff ff ff       	call   801e4a <dev_lookup>
+  801eea:	89 c3                	mov    %eax,%ebx
+  801eec:	83 c4 10             	add    $0x10,%esp
+  801eef:	85 c0                	test   %eax,%eax
+  801ef1:	78 1a                	js     801f0d <fd_close+0x77>
+		if (dev->dev_close)
+  801ef3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ef6:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801ef9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	74 0b                	je     801f0d <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801f02:	83 ec 0c             	sub    $0xc,%esp
+  801f05:	56                   	push   %esi
+  801f06:	ff d0                	call   *%eax
+  801f08:	89 c3                	mov    %eax,%ebx
+  801f0a:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801f0d:	83 ec 08             	sub    $0x8,%esp
+  801f10:	56                   	push   %esi
+  801f11:	6a 00                	push   $0x0
+  801f13:	e8 cf f6 ff ff       	call   8015e7 <sys_page_unmap>
+	return r;
+  801f18:	83 c4 10             	add    $0x10,%esp
+  801f1b:	eb b5                	jmp    801ed2 <fd_close+0x3c>
+
+00801f1d <close>:
+
+int
+close(int fdnum)
+{
+  801f1d:	55                   	push   %ebp
+  801f1e:	89 e5                	mov    %esp,%ebp
+  801f20:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f23:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f26:	50                   	push   %eax
+  801f27:	ff 75 08             	push   0x8(%ebp)
+  801f2a:	e8 cb fe ff ff       	call   801dfa <fd_lookup>
+  801f2f:	83 c4 10             	add    $0x10,%esp
+  801f32:	85 c0                	test   %eax,%eax
+  801f34:	79 02                	jns    801f38 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801f36:	c9                   	leave
+  801f37:	c3                   	ret
+		return fd_close(fd, 1);
+  801f38:	83 ec 08             	sub    $0x8,%esp
+  801f3b:	6a 01                	push   $0x1
+  801f3d:	ff 75 f4             	push   -0xc(%ebp)
+  801f40:	e8 51 ff ff ff       	call   801e96 <fd_close>
+  801f45:	83 c4 10             	add    $0x10,%esp
+  801f48:	eb ec                	jmp    801f36 <close+0x19>
+
+00801f4a <close_all>:
+
+void
+close_all(void)
+{
+  801f4a:	55                   	push   %ebp
+  801f4b:	89 e5                	mov    %esp,%ebp
+  801f4d:	53                   	push   %ebx
+  801f4e:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801f51:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801f56:	83 ec 0c             	sub    $0xc,%esp
+  801f59:	53                   	push   %ebx
+  801f5a:	e8 be ff ff ff       	call   801f1d <close>
+	for (i = 0; i < MAXFD; i++)
+  801f5f:	83 c3 01             	add    $0x1,%ebx
+  801f62:	83 c4 10             	add    $0x10,%esp
+  801f65:	83 fb 20             	cmp    $0x20,%ebx
+  801f68:	75 ec                	jne    801f56 <close_all+0xc>
+}
+  801f6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f6d:	c9                   	leave
+  801f6e:	c3                   	ret
+
+00801f6f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801f6f:	55                   	push   %ebp
+  801f70:	89 e5                	mov    %esp,%ebp
+  801f72:	57                   	push   %edi
+  801f73:	56                   	push   %esi
+  801f74:	53                   	push   %ebx
+  801f75:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801f78:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f7b:	50                   	push   %eax
+  801f7c:	ff 75 08             	push   0x8(%ebp)
+  801f7f:	e8 76 fe ff ff       	call   801dfa <fd_lookup>
+  801f84:	89 c3                	mov    %eax,%ebx
+  801f86:	83 c4 10             	add    $0x10,%esp
+  801f89:	85 c0                	test   %eax,%eax
+  801f8b:	78 7f                	js     80200c <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801f8d:	83 ec 0c             	sub    $0xc,%esp
+  801f90:	ff 75 0c             	push   0xc(%ebp)
+  801f93:	e8 85 ff ff ff       	call   801f1d <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801f98:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801f9b:	c1 e6 0c             	shl    $0xc,%esi
+  801f9e:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801fa4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801fa7:	89 3c 24             	mov    %edi,(%esp)
+  801faa:	e8 e0 fd ff ff       	call   801d8f <fd2data>
+  801faf:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801fb1:	89 34 24             	mov    %esi,(%esp)
+  801fb4:	e8 d6 fd ff ff       	call   801d8f <fd2data>
+  801fb9:	83 c4 10             	add    $0x10,%esp
+  801fbc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801fbf:	89 d8                	mov    %ebx,%eax
+  801fc1:	c1 e8 16             	shr    $0x16,%eax
+  801fc4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801fcb:	a8 01                	test   $0x1,%al
+  801fcd:	74 11                	je     801fe0 <dup+0x71>
+  801fcf:	89 d8                	mov    %ebx,%eax
+  801fd1:	c1 e8 0c             	shr    $0xc,%eax
+  801fd4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801fdb:	f6 c2 01             	test   $0x1,%dl
+  801fde:	75 36                	jne    802016 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801fe0:	89 f8                	mov    %edi,%eax
+  801fe2:	c1 e8 0c             	shr    $0xc,%eax
+  801fe5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801fec:	83 ec 0c             	sub    $0xc,%esp
+  801fef:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ff4:	50                   	push   %eax
+  801ff5:	56                   	push   %esi
+  801ff6:	6a 00                	push   $0x0
+  801ff8:	57                   	push   %edi
+  801ff9:	6a 00                	push   $0x0
+  801ffb:	e8 a5 f5 ff ff       	call   8015a5 <sys_page_map>
+  802000:	89 c3                	mov    %eax,%ebx
+  802002:	83 c4 20             	add    $0x20,%esp
+  802005:	85 c0                	test   %eax,%eax
+  802007:	78 33                	js     80203c <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802009:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80200c:	89 d8                	mov    %ebx,%eax
+  80200e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802011:	5b                   	pop    %ebx
+  802012:	5e                   	pop    %esi
+  802013:	5f                   	pop    %edi
+  802014:	5d                   	pop    %ebp
+  802015:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802016:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80201d:	83 ec 0c             	sub    $0xc,%esp
+  802020:	25 07 0e 00 00       	and    $0xe07,%eax
+  802025:	50                   	push   %eax
+  802026:	ff 75 d4             	push   -0x2c(%ebp)
+  802029:	6a 00                	push   $0x0
+  80202b:	53                   	push   %ebx
+  80202c:	6a 00                	push   $0x0
+  80202e:	e8 72 f5 ff ff       	call   8015a5 <sys_page_map>
+  802033:	89 c3                	mov    %eax,%ebx
+  802035:	83 c4 20             	add    $0x20,%esp
+  802038:	85 c0                	test   %eax,%eax
+  80203a:	79 a4                	jns    801fe0 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80203c:	83 ec 08             	sub    $0x8,%esp
+  80203f:	56                   	push   %esi
+  802040:	6a 00                	push   $0x0
+  802042:	e8 a0 f5 ff ff       	call   8015e7 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802047:	83 c4 08             	add    $0x8,%esp
+  80204a:	ff 75 d4             	push   -0x2c(%ebp)
+  80204d:	6a 00                	push   $0x0
+  80204f:	e8 93 f5 ff ff       	call   8015e7 <sys_page_unmap>
+	return r;
+  802054:	83 c4 10             	add    $0x10,%esp
+  802057:	eb b3                	jmp    80200c <dup+0x9d>
+
+00802059 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802059:	55                   	push   %ebp
+  80205a:	89 e5                	mov    %esp,%ebp
+  80205c:	56                   	push   %esi
+  80205d:	53                   	push   %ebx
+  80205e:	83 ec 18             	sub    $0x18,%esp
+  802061:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802064:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802067:	50                   	push   %eax
+  802068:	56                   	push   %esi
+  802069:	e8 8c fd ff ff       	call   801dfa <fd_lookup>
+  80206e:	83 c4 10             	add    $0x10,%esp
+  802071:	85 c0                	test   %eax,%eax
+  802073:	78 3c                	js     8020b1 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802075:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802078:	83 ec 08             	sub    $0x8,%esp
+  80207b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80207e:	50                   	push   %eax
+  80207f:	ff 33                	push   (%ebx)
+  802081:	e8 c4 fd ff ff       	call   801e4a <dev_lookup>
+  802086:	83 c4 10             	add    $0x10,%esp
+  802089:	85 c0                	test   %eax,%eax
+  80208b:	78 24                	js     8020b1 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80208d:	8b 43 08             	mov    0x8(%ebx),%eax
+  802090:	83 e0 03             	and    $0x3,%eax
+  802093:	83 f8 01             	cmp    $0x1,%eax
+  802096:	74 20                	je     8020b8 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  802098:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80209b:	8b 40 08             	mov    0x8(%eax),%eax
+  80209e:	85 c0                	test   %eax,%eax
+  8020a0:	74 37                	je     8020d9 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8020a2:	83 ec 04             	sub    $0x4,%esp
+  8020a5:	ff 75 10             	push   0x10(%ebp)
+  8020a8:	ff 75 0c             	push   0xc(%ebp)
+  8020ab:	53                   	push   %ebx
+  8020ac:	ff d0                	call   *%eax
+  8020ae:	83 c4 10             	add    $0x10,%esp
+}
+  8020b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b4:	5b                   	pop    %ebx
+  8020b5:	5e                   	pop    %esi
+  8020b6:	5d                   	pop    %ebp
+  8020b7:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020b8:	a1 08 50 80 00       	mov    0x805008,%eax
+  8020bd:	8b 40 48             	mov    0x48(%eax),%eax
+  8020c0:	83 ec 04             	sub    $0x4,%esp
+  8020c3:	56                   	push   %esi
+  8020c4:	50                   	push   %eax
+  8020c5:	68 71 38 80 00       	push   $0x803871
+  8020ca:	e8 b9 e9 ff ff       	call   800a88 <cprintf>
+		return -E_INVAL;
+  8020cf:	83 c4 10             	add    $0x10,%esp
+  8020d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020d7:	eb d8                	jmp    8020b1 <read+0x58>
+		return -E_NOT_SUPP;
+  8020d9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020de:	eb d1                	jmp    8020b1 <read+0x58>
+
+008020e0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8020e0:	55                   	push   %ebp
+  8020e1:	89 e5                	mov    %esp,%ebp
+  8020e3:	57                   	push   %edi
+  8020e4:	56                   	push   %esi
+  8020e5:	53                   	push   %ebx
+  8020e6:	83 ec 0c             	sub    $0xc,%esp
+  8020e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020ec:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8020ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f4:	eb 02                	jmp    8020f8 <readn+0x18>
+  8020f6:	01 c3                	add    %eax,%ebx
+  8020f8:	39 f3                	cmp    %esi,%ebx
+  8020fa:	73 21                	jae    80211d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8020fc:	83 ec 04             	sub    $0x4,%esp
+  8020ff:	89 f0                	mov    %esi,%eax
+  802101:	29 d8                	sub    %ebx,%eax
+  802103:	50                   	push   %eax
+  802104:	89 d8                	mov    %ebx,%eax
+  802106:	03 45 0c             	add    0xc(%ebp),%eax
+  802109:	50                   	push   %eax
+  80210a:	57                   	push   %edi
+  80210b:	e8 49 ff ff ff       	call   802059 <read>
+		if (m < 0)
+  802110:	83 c4 10             	add    $0x10,%esp
+  802113:	85 c0                	test   %eax,%eax
+  802115:	78 04                	js     80211b <readn+0x3b>
+			return m;
+		if (m == 0)
+  802117:	75 dd                	jne    8020f6 <readn+0x16>
+  802119:	eb 02                	jmp    80211d <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80211b:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80211d:	89 d8                	mov    %ebx,%eax
+  80211f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802122:	5b                   	pop    %ebx
+  802123:	5e                   	pop    %esi
+  802124:	5f                   	pop    %edi
+  802125:	5d                   	pop    %ebp
+  802126:	c3                   	ret
+
+00802127 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802127:	55                   	push   %ebp
+  802128:	89 e5                	mov    %esp,%ebp
+  80212a:	56                   	push   %esi
+  80212b:	53                   	push   %ebx
+  80212c:	83 ec 18             	sub    $0x18,%esp
+  80212f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802132:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802135:	50                   	push   %eax
+  802136:	53                   	push   %ebx
+  802137:	e8 be fc ff ff       	call   801dfa <fd_lookup>
+  80213c:	83 c4 10             	add    $0x10,%esp
+  80213f:	85 c0                	test   %eax,%eax
+  802141:	78 37                	js     80217a <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802143:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802146:	83 ec 08             	sub    $0x8,%esp
+  802149:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80214c:	50                   	push   %eax
+  80214d:	ff 36                	push   (%esi)
+  80214f:	e8 f6 fc ff ff       	call   801e4a <dev_lookup>
+  802154:	83 c4 10             	add    $0x10,%esp
+  802157:	85 c0                	test   %eax,%eax
+  802159:	78 1f                	js     80217a <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80215b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80215f:	74 20                	je     802181 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802161:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802164:	8b 40 0c             	mov    0xc(%eax),%eax
+  802167:	85 c0                	test   %eax,%eax
+  802169:	74 37                	je     8021a2 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80216b:	83 ec 04             	sub    $0x4,%esp
+  80216e:	ff 75 10             	push   0x10(%ebp)
+  802171:	ff 75 0c             	push   0xc(%ebp)
+  802174:	56                   	push   %esi
+  802175:	ff d0                	call   *%eax
+  802177:	83 c4 10             	add    $0x10,%esp
+}
+  80217a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80217d:	5b                   	pop    %ebx
+  80217e:	5e                   	pop    %esi
+  80217f:	5d                   	pop    %ebp
+  802180:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802181:	a1 08 50 80 00       	mov    0x805008,%eax
+  802186:	8b 40 48             	mov    0x48(%eax),%eax
+  802189:	83 ec 04             	sub    $0x4,%esp
+  80218c:	53                   	push   %ebx
+  80218d:	50                   	push   %eax
+  80218e:	68 8d 38 80 00       	push   $0x80388d
+  802193:	e8 f0 e8 ff ff       	call   800a88 <cprintf>
+		return -E_INVAL;
+  802198:	83 c4 10             	add    $0x10,%esp
+  80219b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021a0:	eb d8                	jmp    80217a <write+0x53>
+		return -E_NOT_SUPP;
+  8021a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021a7:	eb d1                	jmp    80217a <write+0x53>
+
+008021a9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8021a9:	55                   	push   %ebp
+  8021aa:	89 e5                	mov    %esp,%ebp
+  8021ac:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b2:	50                   	push   %eax
+  8021b3:	ff 75 08             	push   0x8(%ebp)
+  8021b6:	e8 3f fc ff ff       	call   801dfa <fd_lookup>
+  8021bb:	83 c4 10             	add    $0x10,%esp
+  8021be:	85 c0                	test   %eax,%eax
+  8021c0:	78 0e                	js     8021d0 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8021c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c8:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8021cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021d0:	c9                   	leave
+  8021d1:	c3                   	ret
+
+008021d2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8021d2:	55                   	push   %ebp
+  8021d3:	89 e5                	mov    %esp,%ebp
+  8021d5:	56                   	push   %esi
+  8021d6:	53                   	push   %ebx
+  8021d7:	83 ec 18             	sub    $0x18,%esp
+  8021da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021dd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021e0:	50                   	push   %eax
+  8021e1:	53                   	push   %ebx
+  8021e2:	e8 13 fc ff ff       	call   801dfa <fd_lookup>
+  8021e7:	83 c4 10             	add    $0x10,%esp
+  8021ea:	85 c0                	test   %eax,%eax
+  8021ec:	78 34                	js     802222 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021ee:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8021f1:	83 ec 08             	sub    $0x8,%esp
+  8021f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021f7:	50                   	push   %eax
+  8021f8:	ff 36                	push   (%esi)
+  8021fa:	e8 4b fc ff ff       	call   801e4a <dev_lookup>
+  8021ff:	83 c4 10             	add    $0x10,%esp
+  802202:	85 c0                	test   %eax,%eax
+  802204:	78 1c                	js     802222 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802206:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80220a:	74 1d                	je     802229 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80220c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80220f:	8b 40 18             	mov    0x18(%eax),%eax
+  802212:	85 c0                	test   %eax,%eax
+  802214:	74 34                	je     80224a <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802216:	83 ec 08             	sub    $0x8,%esp
+  802219:	ff 75 0c             	push   0xc(%ebp)
+  80221c:	56                   	push   %esi
+  80221d:	ff d0                	call   *%eax
+  80221f:	83 c4 10             	add    $0x10,%esp
+}
+  802222:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802225:	5b                   	pop    %ebx
+  802226:	5e                   	pop    %esi
+  802227:	5d                   	pop    %ebp
+  802228:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802229:	a1 08 50 80 00       	mov    0x805008,%eax
+  80222e:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802231:	83 ec 04             	sub    $0x4,%esp
+  802234:	53                   	push   %ebx
+  802235:	50                   	push   %eax
+  802236:	68 50 38 80 00       	push   $0x803850
+  80223b:	e8 48 e8 ff ff       	call   800a88 <cprintf>
+		return -E_INVAL;
+  802240:	83 c4 10             	add    $0x10,%esp
+  802243:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802248:	eb d8                	jmp    802222 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  80224a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80224f:	eb d1                	jmp    802222 <ftruncate+0x50>
+
+00802251 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802251:	55                   	push   %ebp
+  802252:	89 e5                	mov    %esp,%ebp
+  802254:	56                   	push   %esi
+  802255:	53                   	push   %ebx
+  802256:	83 ec 18             	sub    $0x18,%esp
+  802259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80225c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80225f:	50                   	push   %eax
+  802260:	ff 75 08             	push   0x8(%ebp)
+  802263:	e8 92 fb ff ff       	call   801dfa <fd_lookup>
+  802268:	83 c4 10             	add    $0x10,%esp
+  80226b:	85 c0                	test   %eax,%eax
+  80226d:	78 49                	js     8022b8 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80226f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802272:	83 ec 08             	sub    $0x8,%esp
+  802275:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802278:	50                   	push   %eax
+  802279:	ff 36                	push   (%esi)
+  80227b:	e8 ca fb ff ff       	call   801e4a <dev_lookup>
+  802280:	83 c4 10             	add    $0x10,%esp
+  802283:	85 c0                	test   %eax,%eax
+  802285:	78 31                	js     8022b8 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802287:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80228a:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80228e:	74 2f                	je     8022bf <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  802290:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802293:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80229a:	00 00 00 
+	stat->st_isdir = 0;
+  80229d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022a4:	00 00 00 
+	stat->st_dev = dev;
+  8022a7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8022ad:	83 ec 08             	sub    $0x8,%esp
+  8022b0:	53                   	push   %ebx
+  8022b1:	56                   	push   %esi
+  8022b2:	ff 50 14             	call   *0x14(%eax)
+  8022b5:	83 c4 10             	add    $0x10,%esp
+}
+  8022b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022bb:	5b                   	pop    %ebx
+  8022bc:	5e                   	pop    %esi
+  8022bd:	5d                   	pop    %ebp
+  8022be:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022bf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022c4:	eb f2                	jmp    8022b8 <fstat+0x67>
+
+008022c6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8022c6:	55                   	push   %ebp
+  8022c7:	89 e5                	mov    %esp,%ebp
+  8022c9:	56                   	push   %esi
+  8022ca:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8022cb:	83 ec 08             	sub    $0x8,%esp
+  8022ce:	6a 00                	push   $0x0
+  8022d0:	ff 75 08             	push   0x8(%ebp)
+  8022d3:	e8 bc 02 00 00       	call   802594 <open>
+  8022d8:	89 c3                	mov    %eax,%ebx
+  8022da:	83 c4 10             	add    $0x10,%esp
+  8022dd:	85 c0                	test   %eax,%eax
+  8022df:	78 1b                	js     8022fc <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8022e1:	83 ec 08             	sub    $0x8,%esp
+  8022e4:	ff 75 0c             	push   0xc(%ebp)
+  8022e7:	50                   	push   %eax
+  8022e8:	e8 64 ff ff ff       	call   802251 <fstat>
+  8022ed:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8022ef:	89 1c 24             	mov    %ebx,(%esp)
+  8022f2:	e8 26 fc ff ff       	call   801f1d <close>
+	return r;
+  8022f7:	83 c4 10             	add    $0x10,%esp
+  8022fa:	89 f3                	mov    %esi,%ebx
+}
+  8022fc:	89 d8                	mov    %ebx,%eax
+  8022fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802301:	5b                   	pop    %ebx
+  802302:	5e                   	pop    %esi
+  802303:	5d                   	pop    %ebp
+  802304:	c3                   	ret
+
+00802305 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  802305:	55                   	push   %ebp
+  802306:	89 e5                	mov    %esp,%ebp
+  802308:	57                   	push   %edi
+  802309:	56                   	push   %esi
+  80230a:	53                   	push   %ebx
+  80230b:	83 ec 0c             	sub    $0xc,%esp
+  80230e:	89 c7                	mov    %eax,%edi
+  802310:	89 d3                	mov    %edx,%ebx
+  802312:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802314:	83 3d 00 50 80 00 00 	cmpl   $0x0,0x805000
+  80231b:	74 2d                	je     80234a <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80231d:	6a 07                	push   $0x7
+  80231f:	68 00 60 80 00       	push   $0x806000
+  802324:	57                   	push   %edi
+  802325:	ff 35 00 50 80 00    	push   0x805000
+  80232b:	e8 1b f9 ff ff       	call   801c4b <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  802330:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802337:	6a 00                	push   $0x0
+  802339:	56                   	push   %esi
+  80233a:	53                   	push   %ebx
+  80233b:	6a 00                	push   $0x0
+  80233d:	e8 bb f7 ff ff       	call   801afd <ipc_recv_pages>
+}
+  802342:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802345:	5b                   	pop    %ebx
+  802346:	5e                   	pop    %esi
+  802347:	5f                   	pop    %edi
+  802348:	5d                   	pop    %ebp
+  802349:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80234a:	83 ec 0c             	sub    $0xc,%esp
+  80234d:	6a 01                	push   $0x1
+  80234f:	e8 ec f9 ff ff       	call   801d40 <ipc_find_env>
+  802354:	a3 00 50 80 00       	mov    %eax,0x805000
+  802359:	83 c4 10             	add    $0x10,%esp
+  80235c:	eb bf                	jmp    80231d <fsipc_pages+0x18>
+
+0080235e <fsipc>:
+{
+  80235e:	55                   	push   %ebp
+  80235f:	89 e5                	mov    %esp,%ebp
+  802361:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  802364:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802369:	e8 97 ff ff ff       	call   802305 <fsipc_pages>
+}
+  80236e:	c9                   	leave
+  80236f:	c3                   	ret
+
+00802370 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802370:	55                   	push   %ebp
+  802371:	89 e5                	mov    %esp,%ebp
+  802373:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802376:	8b 45 08             	mov    0x8(%ebp),%eax
+  802379:	8b 40 0c             	mov    0xc(%eax),%eax
+  80237c:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  802381:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802384:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802389:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238e:	b8 02 00 00 00       	mov    $0x2,%eax
+  802393:	e8 c6 ff ff ff       	call   80235e <fsipc>
+}
+  802398:	c9                   	leave
+  802399:	c3                   	ret
+
+0080239a <devfile_flush>:
+{
+  80239a:	55                   	push   %ebp
+  80239b:	89 e5                	mov    %esp,%ebp
+  80239d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8023a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023a6:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8023ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b0:	b8 06 00 00 00       	mov    $0x6,%eax
+  8023b5:	e8 a4 ff ff ff       	call   80235e <fsipc>
+}
+  8023ba:	c9                   	leave
+  8023bb:	c3                   	ret
+
+008023bc <devfile_stat>:
+{
+  8023bc:	55                   	push   %ebp
+  8023bd:	89 e5                	mov    %esp,%ebp
+  8023bf:	53                   	push   %ebx
+  8023c0:	83 ec 04             	sub    $0x4,%esp
+  8023c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8023c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023cc:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8023d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023db:	e8 7e ff ff ff       	call   80235e <fsipc>
+  8023e0:	85 c0                	test   %eax,%eax
+  8023e2:	78 2c                	js     802410 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8023e4:	83 ec 08             	sub    $0x8,%esp
+  8023e7:	68 00 60 80 00       	push   $0x806000
+  8023ec:	53                   	push   %ebx
+  8023ed:	e8 7d ec ff ff       	call   80106f <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8023f2:	a1 80 60 80 00       	mov    0x806080,%eax
+  8023f7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8023fd:	a1 84 60 80 00       	mov    0x806084,%eax
+  802402:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802408:	83 c4 10             	add    $0x10,%esp
+  80240b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802410:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802413:	c9                   	leave
+  802414:	c3                   	ret
+
+00802415 <devfile_write>:
+{
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	83 ec 0c             	sub    $0xc,%esp
+  80241b:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80241e:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802423:	39 d0                	cmp    %edx,%eax
+  802425:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802428:	8b 55 08             	mov    0x8(%ebp),%edx
+  80242b:	8b 52 0c             	mov    0xc(%edx),%edx
+  80242e:	89 15 00 60 80 00    	mov    %edx,0x806000
+	fsipcbuf.write.req_n = n;
+  802434:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802439:	50                   	push   %eax
+  80243a:	ff 75 0c             	push   0xc(%ebp)
+  80243d:	68 08 60 80 00       	push   $0x806008
+  802442:	e8 ae ed ff ff       	call   8011f5 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802451:	e8 08 ff ff ff       	call   80235e <fsipc>
+}
+  802456:	c9                   	leave
+  802457:	c3                   	ret
+
+00802458 <devfile_read>:
+{
+  802458:	55                   	push   %ebp
+  802459:	89 e5                	mov    %esp,%ebp
+  80245b:	57                   	push   %edi
+  80245c:	56                   	push   %esi
+  80245d:	53                   	push   %ebx
+  80245e:	83 ec 1c             	sub    $0x1c,%esp
+  802461:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802464:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802467:	89 fe                	mov    %edi,%esi
+  802469:	c1 ee 0c             	shr    $0xc,%esi
+  80246c:	b8 20 00 00 00       	mov    $0x20,%eax
+  802471:	39 c6                	cmp    %eax,%esi
+  802473:	0f 47 f0             	cmova  %eax,%esi
+  802476:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802479:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80247e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802481:	eb 14                	jmp    802497 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802483:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  80248a:	05 00 10 00 00       	add    $0x1000,%eax
+  80248f:	f6 c6 06             	test   $0x6,%dh
+  802492:	75 42                	jne    8024d6 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802494:	83 c1 01             	add    $0x1,%ecx
+  802497:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  80249a:	39 f1                	cmp    %esi,%ecx
+  80249c:	0f 84 95 00 00 00    	je     802537 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8024a2:	89 c2                	mov    %eax,%edx
+  8024a4:	c1 ea 16             	shr    $0x16,%edx
+  8024a7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8024ae:	f6 c2 01             	test   $0x1,%dl
+  8024b1:	74 23                	je     8024d6 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8024b3:	89 c2                	mov    %eax,%edx
+  8024b5:	c1 ea 0c             	shr    $0xc,%edx
+  8024b8:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8024bf:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8024c5:	74 0f                	je     8024d6 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8024c7:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8024ce:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8024d4:	75 ad                	jne    802483 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8024d6:	85 c9                	test   %ecx,%ecx
+  8024d8:	74 11                	je     8024eb <devfile_read+0x93>
+  8024da:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8024e1:	75 08                	jne    8024eb <devfile_read+0x93>
+  8024e3:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8024e9:	74 50                	je     80253b <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024eb:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8024ee:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  8024f3:	89 3d 04 60 80 00    	mov    %edi,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8024f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fe:	b8 03 00 00 00       	mov    $0x3,%eax
+  802503:	e8 56 fe ff ff       	call   80235e <fsipc>
+  802508:	89 c6                	mov    %eax,%esi
+  80250a:	85 c0                	test   %eax,%eax
+  80250c:	78 1f                	js     80252d <devfile_read+0xd5>
+	assert(r <= n);
+  80250e:	39 c7                	cmp    %eax,%edi
+  802510:	72 50                	jb     802562 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  802512:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802517:	7f 62                	jg     80257b <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802519:	83 ec 04             	sub    $0x4,%esp
+  80251c:	50                   	push   %eax
+  80251d:	68 00 60 80 00       	push   $0x806000
+  802522:	ff 75 0c             	push   0xc(%ebp)
+  802525:	e8 cb ec ff ff       	call   8011f5 <memmove>
+	return r;
+  80252a:	83 c4 10             	add    $0x10,%esp
+}
+  80252d:	89 f0                	mov    %esi,%eax
+  80252f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802532:	5b                   	pop    %ebx
+  802533:	5e                   	pop    %esi
+  802534:	5f                   	pop    %edi
+  802535:	5d                   	pop    %ebp
+  802536:	c3                   	ret
+  802537:	89 f1                	mov    %esi,%ecx
+  802539:	eb 9b                	jmp    8024d6 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  80253b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80253e:	a3 00 60 80 00       	mov    %eax,0x806000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802543:	89 c8                	mov    %ecx,%eax
+  802545:	c1 e0 0c             	shl    $0xc,%eax
+  802548:	a3 04 60 80 00       	mov    %eax,0x806004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  80254d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802550:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802555:	e8 ab fd ff ff       	call   802305 <fsipc_pages>
+  80255a:	89 c6                	mov    %eax,%esi
+  80255c:	85 c0                	test   %eax,%eax
+  80255e:	78 8b                	js     8024eb <devfile_read+0x93>
+  802560:	eb cb                	jmp    80252d <devfile_read+0xd5>
+	assert(r <= n);
+  802562:	68 bc 38 80 00       	push   $0x8038bc
+  802567:	68 c3 38 80 00       	push   $0x8038c3
+  80256c:	68 a0 00 00 00       	push   $0xa0
+  802571:	68 d8 38 80 00       	push   $0x8038d8
+  802576:	e8 32 e4 ff ff       	call   8009ad <_panic>
+	assert(r <= PGSIZE);
+  80257b:	68 e3 38 80 00       	push   $0x8038e3
+  802580:	68 c3 38 80 00       	push   $0x8038c3
+  802585:	68 a1 00 00 00       	push   $0xa1
+  80258a:	68 d8 38 80 00       	push   $0x8038d8
+  80258f:	e8 19 e4 ff ff       	call   8009ad <_panic>
+
+00802594 <open>:
+{
+  802594:	55                   	push   %ebp
+  802595:	89 e5                	mov    %esp,%ebp
+  802597:	56                   	push   %esi
+  802598:	53                   	push   %ebx
+  802599:	83 ec 1c             	sub    $0x1c,%esp
+  80259c:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80259f:	56                   	push   %esi
+  8025a0:	e8 8f ea ff ff       	call   801034 <strlen>
+  8025a5:	83 c4 10             	add    $0x10,%esp
+  8025a8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025ad:	7f 6c                	jg     80261b <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8025af:	83 ec 0c             	sub    $0xc,%esp
+  8025b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025b5:	50                   	push   %eax
+  8025b6:	e8 eb f7 ff ff       	call   801da6 <fd_alloc>
+  8025bb:	89 c3                	mov    %eax,%ebx
+  8025bd:	83 c4 10             	add    $0x10,%esp
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	78 3c                	js     802600 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8025c4:	83 ec 08             	sub    $0x8,%esp
+  8025c7:	56                   	push   %esi
+  8025c8:	68 00 60 80 00       	push   $0x806000
+  8025cd:	e8 9d ea ff ff       	call   80106f <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8025d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025d5:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8025da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025e2:	e8 77 fd ff ff       	call   80235e <fsipc>
+  8025e7:	89 c3                	mov    %eax,%ebx
+  8025e9:	83 c4 10             	add    $0x10,%esp
+  8025ec:	85 c0                	test   %eax,%eax
+  8025ee:	78 19                	js     802609 <open+0x75>
+	return fd2num(fd);
+  8025f0:	83 ec 0c             	sub    $0xc,%esp
+  8025f3:	ff 75 f4             	push   -0xc(%ebp)
+  8025f6:	e8 84 f7 ff ff       	call   801d7f <fd2num>
+  8025fb:	89 c3                	mov    %eax,%ebx
+  8025fd:	83 c4 10             	add    $0x10,%esp
+}
+  802600:	89 d8                	mov    %ebx,%eax
+  802602:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802605:	5b                   	pop    %ebx
+  802606:	5e                   	pop    %esi
+  802607:	5d                   	pop    %ebp
+  802608:	c3                   	ret
+		fd_close(fd, 0);
+  802609:	83 ec 08             	sub    $0x8,%esp
+  80260c:	6a 00                	push   $0x0
+  80260e:	ff 75 f4             	push   -0xc(%ebp)
+  802611:	e8 80 f8 ff ff       	call   801e96 <fd_close>
+		return r;
+  802616:	83 c4 10             	add    $0x10,%esp
+  802619:	eb e5                	jmp    802600 <open+0x6c>
+		return -E_BAD_PATH;
+  80261b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802620:	eb de                	jmp    802600 <open+0x6c>
+
+00802622 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802622:	55                   	push   %ebp
+  802623:	89 e5                	mov    %esp,%ebp
+  802625:	53                   	push   %ebx
+  802626:	83 ec 10             	sub    $0x10,%esp
+  802629:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80262c:	53                   	push   %ebx
+  80262d:	e8 02 ea ff ff       	call   801034 <strlen>
+  802632:	83 c4 10             	add    $0x10,%esp
+  802635:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80263a:	7f 25                	jg     802661 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80263c:	83 ec 08             	sub    $0x8,%esp
+  80263f:	53                   	push   %ebx
+  802640:	68 00 60 80 00       	push   $0x806000
+  802645:	e8 25 ea ff ff       	call   80106f <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  80264a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802654:	e8 05 fd ff ff       	call   80235e <fsipc>
+  802659:	83 c4 10             	add    $0x10,%esp
+}
+  80265c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80265f:	c9                   	leave
+  802660:	c3                   	ret
+		return -E_BAD_PATH;
+  802661:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802666:	eb f4                	jmp    80265c <remove+0x3a>
+
+00802668 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802668:	55                   	push   %ebp
+  802669:	89 e5                	mov    %esp,%ebp
+  80266b:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80266e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802673:	b8 08 00 00 00       	mov    $0x8,%eax
+  802678:	e8 e1 fc ff ff       	call   80235e <fsipc>
+}
+  80267d:	c9                   	leave
+  80267e:	c3                   	ret
+
+0080267f <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80267f:	55                   	push   %ebp
+  802680:	89 e5                	mov    %esp,%ebp
+  802682:	53                   	push   %ebx
+  802683:	83 ec 04             	sub    $0x4,%esp
+  802686:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  802689:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802693:	e8 c6 fc ff ff       	call   80235e <fsipc>
+  802698:	85 c0                	test   %eax,%eax
+  80269a:	78 3c                	js     8026d8 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  80269c:	a1 00 60 80 00       	mov    0x806000,%eax
+  8026a1:	89 03                	mov    %eax,(%ebx)
+  8026a3:	a1 04 60 80 00       	mov    0x806004,%eax
+  8026a8:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026ab:	a1 08 60 80 00       	mov    0x806008,%eax
+  8026b0:	89 43 08             	mov    %eax,0x8(%ebx)
+  8026b3:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  8026b8:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8026bb:	a1 10 60 80 00       	mov    0x806010,%eax
+  8026c0:	89 43 10             	mov    %eax,0x10(%ebx)
+  8026c3:	a1 14 60 80 00       	mov    0x806014,%eax
+  8026c8:	89 43 14             	mov    %eax,0x14(%ebx)
+  8026cb:	a1 18 60 80 00       	mov    0x806018,%eax
+  8026d0:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8026d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026db:	c9                   	leave
+  8026dc:	c3                   	ret
+
+008026dd <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8026dd:	55                   	push   %ebp
+  8026de:	89 e5                	mov    %esp,%ebp
+  8026e0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8026e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026e6:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_BCSET, NULL);
+  8026eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8026f5:	e8 64 fc ff ff       	call   80235e <fsipc>
+}
+  8026fa:	c9                   	leave
+  8026fb:	c3                   	ret
+
+008026fc <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026fc:	55                   	push   %ebp
+  8026fd:	89 e5                	mov    %esp,%ebp
+  8026ff:	56                   	push   %esi
+  802700:	53                   	push   %ebx
+  802701:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802704:	83 ec 0c             	sub    $0xc,%esp
+  802707:	ff 75 08             	push   0x8(%ebp)
+  80270a:	e8 80 f6 ff ff       	call   801d8f <fd2data>
+  80270f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802711:	83 c4 08             	add    $0x8,%esp
+  802714:	68 ef 38 80 00       	push   $0x8038ef
+  802719:	53                   	push   %ebx
+  80271a:	e8 50 e9 ff ff       	call   80106f <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80271f:	8b 46 04             	mov    0x4(%esi),%eax
+  802722:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802728:	2b 0e                	sub    (%esi),%ecx
+  80272a:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80272f:	89 c8                	mov    %ecx,%eax
+  802731:	f7 e2                	mul    %edx
+  802733:	c1 ea 0c             	shr    $0xc,%edx
+  802736:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80273c:	29 d1                	sub    %edx,%ecx
+  80273e:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802744:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80274b:	00 00 00 
+	stat->st_dev = &devpipe;
+  80274e:	c7 83 88 00 00 00 24 	movl   $0x804024,0x88(%ebx)
+  802755:	40 80 00 
+	return 0;
+}
+  802758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80275d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802760:	5b                   	pop    %ebx
+  802761:	5e                   	pop    %esi
+  802762:	5d                   	pop    %ebp
+  802763:	c3                   	ret
+
+00802764 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802764:	55                   	push   %ebp
+  802765:	89 e5                	mov    %esp,%ebp
+  802767:	53                   	push   %ebx
+  802768:	83 ec 0c             	sub    $0xc,%esp
+  80276b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80276e:	53                   	push   %ebx
+  80276f:	6a 00                	push   $0x0
+  802771:	e8 71 ee ff ff       	call   8015e7 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802776:	89 1c 24             	mov    %ebx,(%esp)
+  802779:	e8 11 f6 ff ff       	call   801d8f <fd2data>
+  80277e:	83 c4 08             	add    $0x8,%esp
+  802781:	50                   	push   %eax
+  802782:	6a 00                	push   $0x0
+  802784:	e8 5e ee ff ff       	call   8015e7 <sys_page_unmap>
+}
+  802789:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80278c:	c9                   	leave
+  80278d:	c3                   	ret
+
+0080278e <_pipeisclosed>:
+{
+  80278e:	55                   	push   %ebp
+  80278f:	89 e5                	mov    %esp,%ebp
+  802791:	57                   	push   %edi
+  802792:	56                   	push   %esi
+  802793:	53                   	push   %ebx
+  802794:	83 ec 1c             	sub    $0x1c,%esp
+  802797:	89 c7                	mov    %eax,%edi
+  802799:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80279b:	a1 08 50 80 00       	mov    0x805008,%eax
+  8027a0:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8027a3:	83 ec 0c             	sub    $0xc,%esp
+  8027a6:	57                   	push   %edi
+  8027a7:	e8 b3 05 00 00       	call   802d5f <pageref>
+  8027ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027af:	89 34 24             	mov    %esi,(%esp)
+  8027b2:	e8 a8 05 00 00       	call   802d5f <pageref>
+		nn = thisenv->env_runs;
+  8027b7:	8b 15 08 50 80 00    	mov    0x805008,%edx
+  8027bd:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8027c0:	83 c4 10             	add    $0x10,%esp
+  8027c3:	39 cb                	cmp    %ecx,%ebx
+  8027c5:	74 1b                	je     8027e2 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8027c7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027ca:	75 cf                	jne    80279b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8027cc:	8b 42 58             	mov    0x58(%edx),%eax
+  8027cf:	6a 01                	push   $0x1
+  8027d1:	50                   	push   %eax
+  8027d2:	53                   	push   %ebx
+  8027d3:	68 f6 38 80 00       	push   $0x8038f6
+  8027d8:	e8 ab e2 ff ff       	call   800a88 <cprintf>
+  8027dd:	83 c4 10             	add    $0x10,%esp
+  8027e0:	eb b9                	jmp    80279b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8027e2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027e5:	0f 94 c0             	sete   %al
+  8027e8:	0f b6 c0             	movzbl %al,%eax
+}
+  8027eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027ee:	5b                   	pop    %ebx
+  8027ef:	5e                   	pop    %esi
+  8027f0:	5f                   	pop    %edi
+  8027f1:	5d                   	pop    %ebp
+  8027f2:	c3                   	ret
+
+008027f3 <devpipe_read>:
+{
+  8027f3:	55                   	push   %ebp
+  8027f4:	89 e5                	mov    %esp,%ebp
+  8027f6:	57                   	push   %edi
+  8027f7:	56                   	push   %esi
+  8027f8:	53                   	push   %ebx
+  8027f9:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8027fc:	ff 75 08             	push   0x8(%ebp)
+  8027ff:	e8 8b f5 ff ff       	call   801d8f <fd2data>
+  802804:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802806:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802809:	8d 40 04             	lea    0x4(%eax),%eax
+  80280c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80280f:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802812:	8b 0b                	mov    (%ebx),%ecx
+  802814:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  80281a:	29 ce                	sub    %ecx,%esi
+  80281c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802821:	f7 e6                	mul    %esi
+  802823:	c1 ea 0c             	shr    $0xc,%edx
+  802826:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  80282c:	29 c6                	sub    %eax,%esi
+  80282e:	89 f2                	mov    %esi,%edx
+  802830:	75 43                	jne    802875 <devpipe_read+0x82>
+		ref = pageref(p);
+  802832:	83 ec 0c             	sub    $0xc,%esp
+  802835:	53                   	push   %ebx
+  802836:	e8 24 05 00 00       	call   802d5f <pageref>
+  80283b:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  80283d:	89 da                	mov    %ebx,%edx
+  80283f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802842:	e8 47 ff ff ff       	call   80278e <_pipeisclosed>
+  802847:	83 c4 10             	add    $0x10,%esp
+  80284a:	85 c0                	test   %eax,%eax
+  80284c:	0f 85 c1 00 00 00    	jne    802913 <devpipe_read+0x120>
+	*sleeping = 1;
+  802852:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802859:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80285e:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802861:	75 ac                	jne    80280f <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802863:	83 ec 04             	sub    $0x4,%esp
+  802866:	56                   	push   %esi
+  802867:	57                   	push   %edi
+  802868:	ff 75 e4             	push   -0x1c(%ebp)
+  80286b:	e8 cb f1 ff ff       	call   801a3b <sys_futex_wait>
+  802870:	83 c4 10             	add    $0x10,%esp
+  802873:	eb 9a                	jmp    80280f <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802875:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802878:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80287c:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  80287e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802883:	f7 e1                	mul    %ecx
+  802885:	c1 ea 0b             	shr    $0xb,%edx
+  802888:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80288e:	29 c1                	sub    %eax,%ecx
+  802890:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802892:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802897:	29 cf                	sub    %ecx,%edi
+  802899:	39 f7                	cmp    %esi,%edi
+  80289b:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  80289e:	8d 43 10             	lea    0x10(%ebx),%eax
+  8028a1:	83 ec 04             	sub    $0x4,%esp
+  8028a4:	57                   	push   %edi
+  8028a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028a8:	01 c2                	add    %eax,%edx
+  8028aa:	52                   	push   %edx
+  8028ab:	ff 75 0c             	push   0xc(%ebp)
+  8028ae:	e8 42 e9 ff ff       	call   8011f5 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  8028b3:	83 c4 0c             	add    $0xc,%esp
+  8028b6:	89 f1                	mov    %esi,%ecx
+  8028b8:	29 f9                	sub    %edi,%ecx
+  8028ba:	51                   	push   %ecx
+  8028bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8028be:	89 f8                	mov    %edi,%eax
+  8028c0:	03 45 0c             	add    0xc(%ebp),%eax
+  8028c3:	50                   	push   %eax
+  8028c4:	e8 2c e9 ff ff       	call   8011f5 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  8028c9:	89 f1                	mov    %esi,%ecx
+  8028cb:	03 0b                	add    (%ebx),%ecx
+  8028cd:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8028d2:	f7 e1                	mul    %ecx
+  8028d4:	c1 ea 0c             	shr    $0xc,%edx
+  8028d7:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8028dd:	29 d1                	sub    %edx,%ecx
+  8028df:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  8028e1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8028e6:	83 c4 10             	add    $0x10,%esp
+  8028e9:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8028ed:	75 0a                	jne    8028f9 <devpipe_read+0x106>
+	return n;
+  8028ef:	89 f0                	mov    %esi,%eax
+}
+  8028f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f4:	5b                   	pop    %ebx
+  8028f5:	5e                   	pop    %esi
+  8028f6:	5f                   	pop    %edi
+  8028f7:	5d                   	pop    %ebp
+  8028f8:	c3                   	ret
+		*sleeping = 0;
+  8028f9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802900:	83 ec 08             	sub    $0x8,%esp
+  802903:	68 00 04 00 00       	push   $0x400
+  802908:	53                   	push   %ebx
+  802909:	e8 7d f1 ff ff       	call   801a8b <sys_futex_wake>
+  80290e:	83 c4 10             	add    $0x10,%esp
+  802911:	eb dc                	jmp    8028ef <devpipe_read+0xfc>
+			return 0;
+  802913:	b8 00 00 00 00       	mov    $0x0,%eax
+  802918:	eb d7                	jmp    8028f1 <devpipe_read+0xfe>
+
+0080291a <devpipe_write>:
+{
+  80291a:	55                   	push   %ebp
+  80291b:	89 e5                	mov    %esp,%ebp
+  80291d:	57                   	push   %edi
+  80291e:	56                   	push   %esi
+  80291f:	53                   	push   %ebx
+  802920:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802923:	ff 75 08             	push   0x8(%ebp)
+  802926:	e8 64 f4 ff ff       	call   801d8f <fd2data>
+  80292b:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80292d:	83 c4 10             	add    $0x10,%esp
+  802930:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802937:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80293a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80293d:	0f 83 23 01 00 00    	jae    802a66 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802943:	8b 77 04             	mov    0x4(%edi),%esi
+  802946:	8b 1f                	mov    (%edi),%ebx
+  802948:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80294e:	29 d9                	sub    %ebx,%ecx
+  802950:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802955:	f7 e1                	mul    %ecx
+  802957:	c1 ea 0c             	shr    $0xc,%edx
+  80295a:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802960:	29 c1                	sub    %eax,%ecx
+  802962:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802964:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  80296a:	75 40                	jne    8029ac <devpipe_write+0x92>
+			ref = pageref(p);
+  80296c:	83 ec 0c             	sub    $0xc,%esp
+  80296f:	57                   	push   %edi
+  802970:	e8 ea 03 00 00       	call   802d5f <pageref>
+  802975:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802977:	89 fa                	mov    %edi,%edx
+  802979:	8b 45 08             	mov    0x8(%ebp),%eax
+  80297c:	e8 0d fe ff ff       	call   80278e <_pipeisclosed>
+  802981:	83 c4 10             	add    $0x10,%esp
+  802984:	85 c0                	test   %eax,%eax
+  802986:	0f 85 d5 00 00 00    	jne    802a61 <devpipe_write+0x147>
+	*sleeping = 1;
+  80298c:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802993:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802998:	39 1f                	cmp    %ebx,(%edi)
+  80299a:	75 a7                	jne    802943 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80299c:	83 ec 04             	sub    $0x4,%esp
+  80299f:	56                   	push   %esi
+  8029a0:	53                   	push   %ebx
+  8029a1:	57                   	push   %edi
+  8029a2:	e8 94 f0 ff ff       	call   801a3b <sys_futex_wait>
+  8029a7:	83 c4 10             	add    $0x10,%esp
+  8029aa:	eb 97                	jmp    802943 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8029ac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8029af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029b2:	29 c1                	sub    %eax,%ecx
+  8029b4:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  8029b9:	89 d8                	mov    %ebx,%eax
+  8029bb:	29 d0                	sub    %edx,%eax
+  8029bd:	39 c1                	cmp    %eax,%ecx
+  8029bf:	0f 46 c1             	cmovbe %ecx,%eax
+  8029c2:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  8029c4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8029c9:	f7 e6                	mul    %esi
+  8029cb:	c1 ea 0b             	shr    $0xb,%edx
+  8029ce:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8029d4:	29 c6                	sub    %eax,%esi
+  8029d6:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  8029d8:	29 f3                	sub    %esi,%ebx
+  8029da:	39 cb                	cmp    %ecx,%ebx
+  8029dc:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8029df:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  8029e2:	8d 77 10             	lea    0x10(%edi),%esi
+  8029e5:	83 ec 04             	sub    $0x4,%esp
+  8029e8:	53                   	push   %ebx
+  8029e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ec:	03 45 0c             	add    0xc(%ebp),%eax
+  8029ef:	50                   	push   %eax
+  8029f0:	01 f2                	add    %esi,%edx
+  8029f2:	52                   	push   %edx
+  8029f3:	e8 fd e7 ff ff       	call   8011f5 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8029f8:	83 c4 0c             	add    $0xc,%esp
+  8029fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8029fe:	29 d8                	sub    %ebx,%eax
+  802a00:	50                   	push   %eax
+  802a01:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a04:	01 d3                	add    %edx,%ebx
+  802a06:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802a09:	53                   	push   %ebx
+  802a0a:	56                   	push   %esi
+  802a0b:	e8 e5 e7 ff ff       	call   8011f5 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802a10:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802a13:	03 4f 04             	add    0x4(%edi),%ecx
+  802a16:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802a1b:	f7 e1                	mul    %ecx
+  802a1d:	c1 ea 0c             	shr    $0xc,%edx
+  802a20:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802a26:	29 d1                	sub    %edx,%ecx
+  802a28:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802a2b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802a30:	83 c4 10             	add    $0x10,%esp
+  802a33:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802a37:	75 0b                	jne    802a44 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802a39:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802a3c:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802a3f:	e9 f3 fe ff ff       	jmp    802937 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802a44:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802a4b:	83 ec 08             	sub    $0x8,%esp
+  802a4e:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802a53:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802a56:	50                   	push   %eax
+  802a57:	e8 2f f0 ff ff       	call   801a8b <sys_futex_wake>
+  802a5c:	83 c4 10             	add    $0x10,%esp
+  802a5f:	eb d8                	jmp    802a39 <devpipe_write+0x11f>
+				return 0;
+  802a61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a69:	5b                   	pop    %ebx
+  802a6a:	5e                   	pop    %esi
+  802a6b:	5f                   	pop    %edi
+  802a6c:	5d                   	pop    %ebp
+  802a6d:	c3                   	ret
+
+00802a6e <pipe>:
+{
+  802a6e:	55                   	push   %ebp
+  802a6f:	89 e5                	mov    %esp,%ebp
+  802a71:	56                   	push   %esi
+  802a72:	53                   	push   %ebx
+  802a73:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802a76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a79:	50                   	push   %eax
+  802a7a:	e8 27 f3 ff ff       	call   801da6 <fd_alloc>
+  802a7f:	89 c3                	mov    %eax,%ebx
+  802a81:	83 c4 10             	add    $0x10,%esp
+  802a84:	85 c0                	test   %eax,%eax
+  802a86:	0f 88 23 01 00 00    	js     802baf <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a8c:	83 ec 04             	sub    $0x4,%esp
+  802a8f:	68 07 04 00 00       	push   $0x407
+  802a94:	ff 75 f4             	push   -0xc(%ebp)
+  802a97:	6a 00                	push   $0x0
+  802a99:	e8 c4 ea ff ff       	call   801562 <sys_page_alloc>
+  802a9e:	89 c3                	mov    %eax,%ebx
+  802aa0:	83 c4 10             	add    $0x10,%esp
+  802aa3:	85 c0                	test   %eax,%eax
+  802aa5:	0f 88 04 01 00 00    	js     802baf <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802aab:	83 ec 0c             	sub    $0xc,%esp
+  802aae:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802ab1:	50                   	push   %eax
+  802ab2:	e8 ef f2 ff ff       	call   801da6 <fd_alloc>
+  802ab7:	89 c3                	mov    %eax,%ebx
+  802ab9:	83 c4 10             	add    $0x10,%esp
+  802abc:	85 c0                	test   %eax,%eax
+  802abe:	0f 88 db 00 00 00    	js     802b9f <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ac4:	83 ec 04             	sub    $0x4,%esp
+  802ac7:	68 07 04 00 00       	push   $0x407
+  802acc:	ff 75 f0             	push   -0x10(%ebp)
+  802acf:	6a 00                	push   $0x0
+  802ad1:	e8 8c ea ff ff       	call   801562 <sys_page_alloc>
+  802ad6:	89 c3                	mov    %eax,%ebx
+  802ad8:	83 c4 10             	add    $0x10,%esp
+  802adb:	85 c0                	test   %eax,%eax
+  802add:	0f 88 bc 00 00 00    	js     802b9f <pipe+0x131>
+	va = fd2data(fd0);
+  802ae3:	83 ec 0c             	sub    $0xc,%esp
+  802ae6:	ff 75 f4             	push   -0xc(%ebp)
+  802ae9:	e8 a1 f2 ff ff       	call   801d8f <fd2data>
+  802aee:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802af0:	83 c4 0c             	add    $0xc,%esp
+  802af3:	68 07 04 00 00       	push   $0x407
+  802af8:	50                   	push   %eax
+  802af9:	6a 00                	push   $0x0
+  802afb:	e8 62 ea ff ff       	call   801562 <sys_page_alloc>
+  802b00:	89 c3                	mov    %eax,%ebx
+  802b02:	83 c4 10             	add    $0x10,%esp
+  802b05:	85 c0                	test   %eax,%eax
+  802b07:	0f 88 82 00 00 00    	js     802b8f <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b0d:	83 ec 0c             	sub    $0xc,%esp
+  802b10:	ff 75 f0             	push   -0x10(%ebp)
+  802b13:	e8 77 f2 ff ff       	call   801d8f <fd2data>
+  802b18:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b1f:	50                   	push   %eax
+  802b20:	6a 00                	push   $0x0
+  802b22:	56                   	push   %esi
+  802b23:	6a 00                	push   $0x0
+  802b25:	e8 7b ea ff ff       	call   8015a5 <sys_page_map>
+  802b2a:	89 c3                	mov    %eax,%ebx
+  802b2c:	83 c4 20             	add    $0x20,%esp
+  802b2f:	85 c0                	test   %eax,%eax
+  802b31:	78 4e                	js     802b81 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802b33:	a1 24 40 80 00       	mov    0x804024,%eax
+  802b38:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b3b:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802b3d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b40:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802b47:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802b4a:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802b4c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802b4f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802b56:	83 ec 0c             	sub    $0xc,%esp
+  802b59:	ff 75 f4             	push   -0xc(%ebp)
+  802b5c:	e8 1e f2 ff ff       	call   801d7f <fd2num>
+  802b61:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b64:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802b66:	83 c4 04             	add    $0x4,%esp
+  802b69:	ff 75 f0             	push   -0x10(%ebp)
+  802b6c:	e8 0e f2 ff ff       	call   801d7f <fd2num>
+  802b71:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b74:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802b77:	83 c4 10             	add    $0x10,%esp
+  802b7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b7f:	eb 2e                	jmp    802baf <pipe+0x141>
+	sys_page_unmap(0, va);
+  802b81:	83 ec 08             	sub    $0x8,%esp
+  802b84:	56                   	push   %esi
+  802b85:	6a 00                	push   $0x0
+  802b87:	e8 5b ea ff ff       	call   8015e7 <sys_page_unmap>
+  802b8c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802b8f:	83 ec 08             	sub    $0x8,%esp
+  802b92:	ff 75 f0             	push   -0x10(%ebp)
+  802b95:	6a 00                	push   $0x0
+  802b97:	e8 4b ea ff ff       	call   8015e7 <sys_page_unmap>
+  802b9c:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802b9f:	83 ec 08             	sub    $0x8,%esp
+  802ba2:	ff 75 f4             	push   -0xc(%ebp)
+  802ba5:	6a 00                	push   $0x0
+  802ba7:	e8 3b ea ff ff       	call   8015e7 <sys_page_unmap>
+  802bac:	83 c4 10             	add    $0x10,%esp
+}
+  802baf:	89 d8                	mov    %ebx,%eax
+  802bb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bb4:	5b                   	pop    %ebx
+  802bb5:	5e                   	pop    %esi
+  802bb6:	5d                   	pop    %ebp
+  802bb7:	c3                   	ret
+
+00802bb8 <pipeisclosed>:
+{
+  802bb8:	55                   	push   %ebp
+  802bb9:	89 e5                	mov    %esp,%ebp
+  802bbb:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bbe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bc1:	50                   	push   %eax
+  802bc2:	ff 75 08             	push   0x8(%ebp)
+  802bc5:	e8 30 f2 ff ff       	call   801dfa <fd_lookup>
+  802bca:	83 c4 10             	add    $0x10,%esp
+  802bcd:	85 c0                	test   %eax,%eax
+  802bcf:	78 18                	js     802be9 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802bd1:	83 ec 0c             	sub    $0xc,%esp
+  802bd4:	ff 75 f4             	push   -0xc(%ebp)
+  802bd7:	e8 b3 f1 ff ff       	call   801d8f <fd2data>
+  802bdc:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802bde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802be1:	e8 a8 fb ff ff       	call   80278e <_pipeisclosed>
+  802be6:	83 c4 10             	add    $0x10,%esp
+}
+  802be9:	c9                   	leave
+  802bea:	c3                   	ret
+
+00802beb <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802beb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf0:	c3                   	ret
+
+00802bf1 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802bf1:	55                   	push   %ebp
+  802bf2:	89 e5                	mov    %esp,%ebp
+  802bf4:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802bf7:	68 0e 39 80 00       	push   $0x80390e
+  802bfc:	ff 75 0c             	push   0xc(%ebp)
+  802bff:	e8 6b e4 ff ff       	call   80106f <strcpy>
+	return 0;
+}
+  802c04:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c09:	c9                   	leave
+  802c0a:	c3                   	ret
+
+00802c0b <devcons_write>:
+{
+  802c0b:	55                   	push   %ebp
+  802c0c:	89 e5                	mov    %esp,%ebp
+  802c0e:	57                   	push   %edi
+  802c0f:	56                   	push   %esi
+  802c10:	53                   	push   %ebx
+  802c11:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802c17:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802c1c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802c22:	eb 2e                	jmp    802c52 <devcons_write+0x47>
+		m = n - tot;
+  802c24:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c27:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802c29:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c2e:	39 c3                	cmp    %eax,%ebx
+  802c30:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802c33:	83 ec 04             	sub    $0x4,%esp
+  802c36:	53                   	push   %ebx
+  802c37:	89 f0                	mov    %esi,%eax
+  802c39:	03 45 0c             	add    0xc(%ebp),%eax
+  802c3c:	50                   	push   %eax
+  802c3d:	57                   	push   %edi
+  802c3e:	e8 b2 e5 ff ff       	call   8011f5 <memmove>
+		sys_cputs(buf, m);
+  802c43:	83 c4 08             	add    $0x8,%esp
+  802c46:	53                   	push   %ebx
+  802c47:	57                   	push   %edi
+  802c48:	e8 48 e8 ff ff       	call   801495 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802c4d:	01 de                	add    %ebx,%esi
+  802c4f:	83 c4 10             	add    $0x10,%esp
+  802c52:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c55:	72 cd                	jb     802c24 <devcons_write+0x19>
+}
+  802c57:	89 f0                	mov    %esi,%eax
+  802c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c5c:	5b                   	pop    %ebx
+  802c5d:	5e                   	pop    %esi
+  802c5e:	5f                   	pop    %edi
+  802c5f:	5d                   	pop    %ebp
+  802c60:	c3                   	ret
+
+00802c61 <devcons_read>:
+{
+  802c61:	55                   	push   %ebp
+  802c62:	89 e5                	mov    %esp,%ebp
+  802c64:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802c67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c70:	75 07                	jne    802c79 <devcons_read+0x18>
+  802c72:	eb 1f                	jmp    802c93 <devcons_read+0x32>
+		sys_yield();
+  802c74:	e8 ca e8 ff ff       	call   801543 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802c79:	e8 46 e8 ff ff       	call   8014c4 <sys_cgetc>
+  802c7e:	85 c0                	test   %eax,%eax
+  802c80:	74 f2                	je     802c74 <devcons_read+0x13>
+	if (c < 0)
+  802c82:	78 0f                	js     802c93 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802c84:	83 f8 04             	cmp    $0x4,%eax
+  802c87:	74 0c                	je     802c95 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802c89:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c8c:	88 02                	mov    %al,(%edx)
+	return 1;
+  802c8e:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c93:	c9                   	leave
+  802c94:	c3                   	ret
+		return 0;
+  802c95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c9a:	eb f7                	jmp    802c93 <devcons_read+0x32>
+
+00802c9c <cputchar>:
+{
+  802c9c:	55                   	push   %ebp
+  802c9d:	89 e5                	mov    %esp,%ebp
+  802c9f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ca5:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802ca8:	6a 01                	push   $0x1
+  802caa:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cad:	50                   	push   %eax
+  802cae:	e8 e2 e7 ff ff       	call   801495 <sys_cputs>
+}
+  802cb3:	83 c4 10             	add    $0x10,%esp
+  802cb6:	c9                   	leave
+  802cb7:	c3                   	ret
+
+00802cb8 <getchar>:
+{
+  802cb8:	55                   	push   %ebp
+  802cb9:	89 e5                	mov    %esp,%ebp
+  802cbb:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802cbe:	6a 01                	push   $0x1
+  802cc0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cc3:	50                   	push   %eax
+  802cc4:	6a 00                	push   $0x0
+  802cc6:	e8 8e f3 ff ff       	call   802059 <read>
+	if (r < 0)
+  802ccb:	83 c4 10             	add    $0x10,%esp
+  802cce:	85 c0                	test   %eax,%eax
+  802cd0:	78 06                	js     802cd8 <getchar+0x20>
+	if (r < 1)
+  802cd2:	74 06                	je     802cda <getchar+0x22>
+	return c;
+  802cd4:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802cd8:	c9                   	leave
+  802cd9:	c3                   	ret
+		return -E_EOF;
+  802cda:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802cdf:	eb f7                	jmp    802cd8 <getchar+0x20>
+
+00802ce1 <iscons>:
+{
+  802ce1:	55                   	push   %ebp
+  802ce2:	89 e5                	mov    %esp,%ebp
+  802ce4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ce7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cea:	50                   	push   %eax
+  802ceb:	ff 75 08             	push   0x8(%ebp)
+  802cee:	e8 07 f1 ff ff       	call   801dfa <fd_lookup>
+  802cf3:	83 c4 10             	add    $0x10,%esp
+  802cf6:	85 c0                	test   %eax,%eax
+  802cf8:	78 11                	js     802d0b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802cfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cfd:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802d03:	39 10                	cmp    %edx,(%eax)
+  802d05:	0f 94 c0             	sete   %al
+  802d08:	0f b6 c0             	movzbl %al,%eax
+}
+  802d0b:	c9                   	leave
+  802d0c:	c3                   	ret
+
+00802d0d <opencons>:
+{
+  802d0d:	55                   	push   %ebp
+  802d0e:	89 e5                	mov    %esp,%ebp
+  802d10:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802d13:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d16:	50                   	push   %eax
+  802d17:	e8 8a f0 ff ff       	call   801da6 <fd_alloc>
+  802d1c:	83 c4 10             	add    $0x10,%esp
+  802d1f:	85 c0                	test   %eax,%eax
+  802d21:	78 3a                	js     802d5d <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802d23:	83 ec 04             	sub    $0x4,%esp
+  802d26:	68 07 04 00 00       	push   $0x407
+  802d2b:	ff 75 f4             	push   -0xc(%ebp)
+  802d2e:	6a 00                	push   $0x0
+  802d30:	e8 2d e8 ff ff       	call   801562 <sys_page_alloc>
+  802d35:	83 c4 10             	add    $0x10,%esp
+  802d38:	85 c0                	test   %eax,%eax
+  802d3a:	78 21                	js     802d5d <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802d3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d3f:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802d45:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802d47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d4a:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802d51:	83 ec 0c             	sub    $0xc,%esp
+  802d54:	50                   	push   %eax
+  802d55:	e8 25 f0 ff ff       	call   801d7f <fd2num>
+  802d5a:	83 c4 10             	add    $0x10,%esp
+}
+  802d5d:	c9                   	leave
+  802d5e:	c3                   	ret
+
+00802d5f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802d5f:	55                   	push   %ebp
+  802d60:	89 e5                	mov    %esp,%ebp
+  802d62:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d65:	89 c2                	mov    %eax,%edx
+  802d67:	c1 ea 16             	shr    $0x16,%edx
+  802d6a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802d71:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802d76:	f6 c1 01             	test   $0x1,%cl
+  802d79:	74 1e                	je     802d99 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802d7b:	c1 e8 0c             	shr    $0xc,%eax
+  802d7e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802d85:	a8 01                	test   $0x1,%al
+  802d87:	74 10                	je     802d99 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802d89:	c1 e8 0c             	shr    $0xc,%eax
+  802d8c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802d8f:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802d96:	0f b7 d2             	movzwl %dx,%edx
+}
+  802d99:	89 d0                	mov    %edx,%eax
+  802d9b:	5d                   	pop    %ebp
+  802d9c:	c3                   	ret
+
+00802d9d <udivmod>:
+  802d9d:	55                   	push   %ebp
+  802d9e:	57                   	push   %edi
+  802d9f:	56                   	push   %esi
+  802da0:	53                   	push   %ebx
+  802da1:	83 ec 24             	sub    $0x24,%esp
+  802da4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802da8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  802dac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802db0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802db4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802db8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  802dbc:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802dc0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dcf:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802dd6:	00 
+  802dd7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  802dde:	00 
+  802ddf:	89 fb                	mov    %edi,%ebx
+  802de1:	eb 08                	jmp    802deb <udivmod+0x4e>
+  802de3:	83 e9 01             	sub    $0x1,%ecx
+  802de6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802de9:	74 68                	je     802e53 <udivmod+0xb6>
+  802deb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802def:	01 c0                	add    %eax,%eax
+  802df1:	89 c6                	mov    %eax,%esi
+  802df3:	89 d7                	mov    %edx,%edi
+  802df5:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802df9:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802dfd:	0f ad d0             	shrd   %cl,%edx,%eax
+  802e00:	d3 ea                	shr    %cl,%edx
+  802e02:	f6 c1 20             	test   $0x20,%cl
+  802e05:	74 04                	je     802e0b <udivmod+0x6e>
+  802e07:	89 d0                	mov    %edx,%eax
+  802e09:	31 d2                	xor    %edx,%edx
+  802e0b:	83 e0 01             	and    $0x1,%eax
+  802e0e:	89 04 24             	mov    %eax,(%esp)
+  802e11:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802e18:	00 
+  802e19:	8b 04 24             	mov    (%esp),%eax
+  802e1c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802e20:	09 f0                	or     %esi,%eax
+  802e22:	09 fa                	or     %edi,%edx
+  802e24:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802e28:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  802e2c:	39 f0                	cmp    %esi,%eax
+  802e2e:	89 d5                	mov    %edx,%ebp
+  802e30:	19 fd                	sbb    %edi,%ebp
+  802e32:	72 af                	jb     802de3 <udivmod+0x46>
+  802e34:	29 f0                	sub    %esi,%eax
+  802e36:	19 fa                	sbb    %edi,%edx
+  802e38:	89 cf                	mov    %ecx,%edi
+  802e3a:	c1 ef 05             	shr    $0x5,%edi
+  802e3d:	83 e7 01             	and    $0x1,%edi
+  802e40:	89 fe                	mov    %edi,%esi
+  802e42:	83 f6 01             	xor    $0x1,%esi
+  802e45:	d3 e6                	shl    %cl,%esi
+  802e47:	d3 e7                	shl    %cl,%edi
+  802e49:	09 74 24 18          	or     %esi,0x18(%esp)
+  802e4d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  802e51:	eb 90                	jmp    802de3 <udivmod+0x46>
+  802e53:	85 db                	test   %ebx,%ebx
+  802e55:	74 05                	je     802e5c <udivmod+0xbf>
+  802e57:	89 03                	mov    %eax,(%ebx)
+  802e59:	89 53 04             	mov    %edx,0x4(%ebx)
+  802e5c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e60:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e64:	83 c4 24             	add    $0x24,%esp
+  802e67:	5b                   	pop    %ebx
+  802e68:	5e                   	pop    %esi
+  802e69:	5f                   	pop    %edi
+  802e6a:	5d                   	pop    %ebp
+  802e6b:	c3                   	ret
+
+00802e6c <__udivdi3>:
+  802e6c:	83 ec 08             	sub    $0x8,%esp
+  802e6f:	6a 00                	push   $0x0
+  802e71:	ff 74 24 1c          	push   0x1c(%esp)
+  802e75:	ff 74 24 1c          	push   0x1c(%esp)
+  802e79:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e7d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e81:	e8 17 ff ff ff       	call   802d9d <udivmod>
+  802e86:	83 c4 14             	add    $0x14,%esp
+  802e89:	c3                   	ret
+
+00802e8a <__umoddi3>:
+  802e8a:	83 ec 18             	sub    $0x18,%esp
+  802e8d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e91:	50                   	push   %eax
+  802e92:	ff 74 24 2c          	push   0x2c(%esp)
+  802e96:	ff 74 24 2c          	push   0x2c(%esp)
+  802e9a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e9e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ea2:	e8 f6 fe ff ff       	call   802d9d <udivmod>
+  802ea7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802eab:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802eaf:	83 c4 24             	add    $0x24,%esp
+  802eb2:	c3                   	ret
+
+00802eb3 <__divdi3>:
+  802eb3:	55                   	push   %ebp
+  802eb4:	57                   	push   %edi
+  802eb5:	56                   	push   %esi
+  802eb6:	53                   	push   %ebx
+  802eb7:	83 ec 10             	sub    $0x10,%esp
+  802eba:	8b 44 24 24          	mov    0x24(%esp),%eax
+  802ebe:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802ec2:	89 c6                	mov    %eax,%esi
+  802ec4:	89 d7                	mov    %edx,%edi
+  802ec6:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  802eca:	33 7c 24 30          	xor    0x30(%esp),%edi
+  802ece:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802ed2:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802ed6:	89 c5                	mov    %eax,%ebp
+  802ed8:	f7 dd                	neg    %ebp
+  802eda:	89 d6                	mov    %edx,%esi
+  802edc:	83 d6 00             	adc    $0x0,%esi
+  802edf:	f7 de                	neg    %esi
+  802ee1:	0f 48 e8             	cmovs  %eax,%ebp
+  802ee4:	0f 49 d6             	cmovns %esi,%edx
+  802ee7:	6a 00                	push   $0x0
+  802ee9:	8b 74 24 30          	mov    0x30(%esp),%esi
+  802eed:	f7 de                	neg    %esi
+  802eef:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802ef3:	83 d0 00             	adc    $0x0,%eax
+  802ef6:	f7 d8                	neg    %eax
+  802ef8:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  802efd:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802f02:	50                   	push   %eax
+  802f03:	56                   	push   %esi
+  802f04:	89 e8                	mov    %ebp,%eax
+  802f06:	e8 92 fe ff ff       	call   802d9d <udivmod>
+  802f0b:	83 c4 10             	add    $0x10,%esp
+  802f0e:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802f13:	78 08                	js     802f1d <__divdi3+0x6a>
+  802f15:	83 c4 0c             	add    $0xc,%esp
+  802f18:	5b                   	pop    %ebx
+  802f19:	5e                   	pop    %esi
+  802f1a:	5f                   	pop    %edi
+  802f1b:	5d                   	pop    %ebp
+  802f1c:	c3                   	ret
+  802f1d:	f7 d8                	neg    %eax
+  802f1f:	83 d2 00             	adc    $0x0,%edx
+  802f22:	f7 da                	neg    %edx
+  802f24:	eb ef                	jmp    802f15 <__divdi3+0x62>
+
+00802f26 <__moddi3>:
+  802f26:	55                   	push   %ebp
+  802f27:	57                   	push   %edi
+  802f28:	56                   	push   %esi
+  802f29:	53                   	push   %ebx
+  802f2a:	83 ec 18             	sub    $0x18,%esp
+  802f2d:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802f31:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802f35:	89 f1                	mov    %esi,%ecx
+  802f37:	f7 d9                	neg    %ecx
+  802f39:	89 da                	mov    %ebx,%edx
+  802f3b:	83 d2 00             	adc    $0x0,%edx
+  802f3e:	f7 da                	neg    %edx
+  802f40:	0f 48 ce             	cmovs  %esi,%ecx
+  802f43:	0f 48 d3             	cmovs  %ebx,%edx
+  802f46:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f4a:	50                   	push   %eax
+  802f4b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  802f4f:	f7 de                	neg    %esi
+  802f51:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  802f55:	83 d0 00             	adc    $0x0,%eax
+  802f58:	f7 d8                	neg    %eax
+  802f5a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802f5f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802f64:	50                   	push   %eax
+  802f65:	56                   	push   %esi
+  802f66:	89 c8                	mov    %ecx,%eax
+  802f68:	e8 30 fe ff ff       	call   802d9d <udivmod>
+  802f6d:	83 c4 10             	add    $0x10,%esp
+  802f70:	85 db                	test   %ebx,%ebx
+  802f72:	78 10                	js     802f84 <__moddi3+0x5e>
+  802f74:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f78:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f7c:	83 c4 14             	add    $0x14,%esp
+  802f7f:	5b                   	pop    %ebx
+  802f80:	5e                   	pop    %esi
+  802f81:	5f                   	pop    %edi
+  802f82:	5d                   	pop    %ebp
+  802f83:	c3                   	ret
+  802f84:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f88:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f8c:	f7 d8                	neg    %eax
+  802f8e:	83 d2 00             	adc    $0x0,%edx
+  802f91:	f7 da                	neg    %edx
+  802f93:	eb e7                	jmp    802f7c <__moddi3+0x56>
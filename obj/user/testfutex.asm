@@ -0,0 +1,11027 @@
+
+obj/user/testfutex.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 f6 05 00 00       	call   800627 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <wait_parent_asleep>:
+char buf[2*PGSIZE];
+
+// Wait until our parent is asleep
+static void
+wait_parent_asleep(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+	while (envs[ENVX(thisenv->env_parent_id)].env_status != ENV_NOT_RUNNABLE)
+  800039:	eb 05                	jmp    800040 <wait_parent_asleep+0xd>
+		sys_yield();
+  80003b:	e8 e0 11 00 00       	call   801220 <sys_yield>
+	while (envs[ENVX(thisenv->env_parent_id)].env_status != ENV_NOT_RUNNABLE)
+  800040:	a1 24 19 81 00       	mov    0x811924,%eax
+  800045:	8b 40 4c             	mov    0x4c(%eax),%eax
+  800048:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80004d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800050:	c1 e0 06             	shl    $0x6,%eax
+  800053:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800058:	8b 40 54             	mov    0x54(%eax),%eax
+  80005b:	83 f8 04             	cmp    $0x4,%eax
+  80005e:	75 db                	jne    80003b <wait_parent_asleep+0x8>
+}
+  800060:	c9                   	leave
+  800061:	c3                   	ret
+
+00800062 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800062:	55                   	push   %ebp
+  800063:	89 e5                	mov    %esp,%ebp
+  800065:	56                   	push   %esi
+  800066:	53                   	push   %ebx
+  800067:	83 ec 14             	sub    $0x14,%esp
+	int i, r, pid, p[2];
+
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80006a:	68 07 04 00 00       	push   $0x407
+  80006f:	68 00 00 00 a0       	push   $0xa0000000
+  800074:	6a 00                	push   $0x0
+  800076:	e8 c4 11 00 00       	call   80123f <sys_page_alloc>
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	85 c0                	test   %eax,%eax
+  800080:	0f 88 47 01 00 00    	js     8001cd <umain+0x16b>
+		panic("sys_page_alloc: %e", r);
+
+	// Bad addresses
+	assert(sys_futex_wait((uint32_t *) ((char *) VA + 1), 0, -1) == -E_INVAL);
+  800086:	83 ec 04             	sub    $0x4,%esp
+  800089:	6a ff                	push   $0xffffffff
+  80008b:	6a 00                	push   $0x0
+  80008d:	68 01 00 00 a0       	push   $0xa0000001
+  800092:	e8 81 16 00 00       	call   801718 <sys_futex_wait>
+  800097:	83 c4 10             	add    $0x10,%esp
+  80009a:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  80009d:	0f 85 3c 01 00 00    	jne    8001df <umain+0x17d>
+	assert(sys_futex_wait(VA + PGSIZE/sizeof(uint32_t), 0, -1) == -E_INVAL);
+  8000a3:	83 ec 04             	sub    $0x4,%esp
+  8000a6:	6a ff                	push   $0xffffffff
+  8000a8:	6a 00                	push   $0x0
+  8000aa:	68 00 10 00 a0       	push   $0xa0001000
+  8000af:	e8 64 16 00 00       	call   801718 <sys_futex_wait>
+  8000b4:	83 c4 10             	add    $0x10,%esp
+  8000b7:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8000ba:	0f 85 35 01 00 00    	jne    8001f5 <umain+0x193>
+	assert(sys_futex_wait((uint32_t *) &uvpt[PGNUM(VA)], uvpt[PGNUM(VA)], -1) == -E_INVAL);
+  8000c0:	a1 00 00 68 ef       	mov    0xef680000,%eax
+  8000c5:	83 ec 04             	sub    $0x4,%esp
+  8000c8:	6a ff                	push   $0xffffffff
+  8000ca:	50                   	push   %eax
+  8000cb:	68 00 00 68 ef       	push   $0xef680000
+  8000d0:	e8 43 16 00 00       	call   801718 <sys_futex_wait>
+  8000d5:	83 c4 10             	add    $0x10,%esp
+  8000d8:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8000db:	0f 85 2a 01 00 00    	jne    80020b <umain+0x1a9>
+	assert(sys_futex_wake((uint32_t *) &uvpt[PGNUM(VA)], 1) == -E_INVAL);
+  8000e1:	83 ec 08             	sub    $0x8,%esp
+  8000e4:	6a 01                	push   $0x1
+  8000e6:	68 00 00 68 ef       	push   $0xef680000
+  8000eb:	e8 78 16 00 00       	call   801768 <sys_futex_wake>
+  8000f0:	83 c4 10             	add    $0x10,%esp
+  8000f3:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  8000f6:	0f 85 25 01 00 00    	jne    800221 <umain+0x1bf>
+	assert(sys_futex_wake(VA, 1) == 0);
+  8000fc:	83 ec 08             	sub    $0x8,%esp
+  8000ff:	6a 01                	push   $0x1
+  800101:	68 00 00 00 a0       	push   $0xa0000000
+  800106:	e8 5d 16 00 00       	call   801768 <sys_futex_wake>
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	0f 85 21 01 00 00    	jne    800237 <umain+0x1d5>
+
+	// The word or the page's references have changed: don't sleep
+	*VA = 5;
+  800116:	c7 05 00 00 00 a0 05 	movl   $0x5,0xa0000000
+  80011d:	00 00 00 
+	assert(sys_futex_wait(VA, 4, -1) == 0);
+  800120:	83 ec 04             	sub    $0x4,%esp
+  800123:	6a ff                	push   $0xffffffff
+  800125:	6a 04                	push   $0x4
+  800127:	68 00 00 00 a0       	push   $0xa0000000
+  80012c:	e8 e7 15 00 00       	call   801718 <sys_futex_wait>
+  800131:	83 c4 10             	add    $0x10,%esp
+  800134:	85 c0                	test   %eax,%eax
+  800136:	0f 85 11 01 00 00    	jne    80024d <umain+0x1eb>
+	assert(sys_futex_wait(VA, 5, pageref(VA) + 1) == 0);
+  80013c:	83 ec 0c             	sub    $0xc,%esp
+  80013f:	68 00 00 00 a0       	push   $0xa0000000
+  800144:	e8 c2 25 00 00       	call   80270b <pageref>
+  800149:	83 c4 0c             	add    $0xc,%esp
+  80014c:	83 c0 01             	add    $0x1,%eax
+  80014f:	50                   	push   %eax
+  800150:	6a 05                	push   $0x5
+  800152:	68 00 00 00 a0       	push   $0xa0000000
+  800157:	e8 bc 15 00 00       	call   801718 <sys_futex_wait>
+  80015c:	83 c4 10             	add    $0x10,%esp
+  80015f:	85 c0                	test   %eax,%eax
+  800161:	0f 85 fc 00 00 00    	jne    800263 <umain+0x201>
+	cprintf("futex mismatch is good\n");
+  800167:	83 ec 0c             	sub    $0xc,%esp
+  80016a:	68 d4 58 80 00       	push   $0x8058d4
+  80016f:	e8 f1 05 00 00       	call   800765 <cprintf>
+
+	// Wait and wake across fork
+	*VA = 0;
+  800174:	c7 05 00 00 00 a0 00 	movl   $0x0,0xa0000000
+  80017b:	00 00 00 
+	if ((pid = fork()) < 0)
+  80017e:	e8 a3 17 00 00       	call   801926 <fork>
+  800183:	89 c3                	mov    %eax,%ebx
+  800185:	83 c4 10             	add    $0x10,%esp
+  800188:	85 c0                	test   %eax,%eax
+  80018a:	0f 88 e9 00 00 00    	js     800279 <umain+0x217>
+		panic("fork: %e", pid);
+	if (pid == 0) {
+  800190:	0f 84 f5 00 00 00    	je     80028b <umain+0x229>
+		*VA = 1;
+		if ((r = sys_futex_wake(VA, NENV)) != 1)
+			panic("sys_futex_wake woke %d", r);
+		exit();
+	}
+	while (*VA == 0)
+  800196:	83 3d 00 00 00 a0 00 	cmpl   $0x0,0xa0000000
+  80019d:	0f 85 2d 01 00 00    	jne    8002d0 <umain+0x26e>
+		if ((r = sys_futex_wait(VA, 0, -1)) < 0)
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	6a ff                	push   $0xffffffff
+  8001a8:	6a 00                	push   $0x0
+  8001aa:	68 00 00 00 a0       	push   $0xa0000000
+  8001af:	e8 64 15 00 00       	call   801718 <sys_futex_wait>
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	85 c0                	test   %eax,%eax
+  8001b9:	79 db                	jns    800196 <umain+0x134>
+			panic("sys_futex_wait: %e", r);
+  8001bb:	50                   	push   %eax
+  8001bc:	68 0c 59 80 00       	push   $0x80590c
+  8001c1:	6a 31                	push   $0x31
+  8001c3:	68 93 58 80 00       	push   $0x805893
+  8001c8:	e8 bd 04 00 00       	call   80068a <_panic>
+		panic("sys_page_alloc: %e", r);
+  8001cd:	50                   	push   %eax
+  8001ce:	68 80 58 80 00       	push   $0x805880
+  8001d3:	6a 15                	push   $0x15
+  8001d5:	68 93 58 80 00       	push   $0x805893
+  8001da:	e8 ab 04 00 00       	call   80068a <_panic>
+	assert(sys_futex_wait((uint32_t *) ((char *) VA + 1), 0, -1) == -E_INVAL);
+  8001df:	68 f4 59 80 00       	push   $0x8059f4
+  8001e4:	68 a4 58 80 00       	push   $0x8058a4
+  8001e9:	6a 18                	push   $0x18
+  8001eb:	68 93 58 80 00       	push   $0x805893
+  8001f0:	e8 95 04 00 00       	call   80068a <_panic>
+	assert(sys_futex_wait(VA + PGSIZE/sizeof(uint32_t), 0, -1) == -E_INVAL);
+  8001f5:	68 38 5a 80 00       	push   $0x805a38
+  8001fa:	68 a4 58 80 00       	push   $0x8058a4
+  8001ff:	6a 19                	push   $0x19
+  800201:	68 93 58 80 00       	push   $0x805893
+  800206:	e8 7f 04 00 00       	call   80068a <_panic>
+	assert(sys_futex_wait((uint32_t *) &uvpt[PGNUM(VA)], uvpt[PGNUM(VA)], -1) == -E_INVAL);
+  80020b:	68 78 5a 80 00       	push   $0x805a78
+  800210:	68 a4 58 80 00       	push   $0x8058a4
+  800215:	6a 1a                	push   $0x1a
+  800217:	68 93 58 80 00       	push   $0x805893
+  80021c:	e8 69 04 00 00       	call   80068a <_panic>
+	assert(sys_futex_wake((uint32_t *) &uvpt[PGNUM(VA)], 1) == -E_INVAL);
+  800221:	68 c8 5a 80 00       	push   $0x805ac8
+  800226:	68 a4 58 80 00       	push   $0x8058a4
+  80022b:	6a 1b                	push   $0x1b
+  80022d:	68 93 58 80 00       	push   $0x805893
+  800232:	e8 53 04 00 00       	call   80068a <_panic>
+	assert(sys_futex_wake(VA, 1) == 0);
+  800237:	68 b9 58 80 00       	push   $0x8058b9
+  80023c:	68 a4 58 80 00       	push   $0x8058a4
+  800241:	6a 1c                	push   $0x1c
+  800243:	68 93 58 80 00       	push   $0x805893
+  800248:	e8 3d 04 00 00       	call   80068a <_panic>
+	assert(sys_futex_wait(VA, 4, -1) == 0);
+  80024d:	68 08 5b 80 00       	push   $0x805b08
+  800252:	68 a4 58 80 00       	push   $0x8058a4
+  800257:	6a 20                	push   $0x20
+  800259:	68 93 58 80 00       	push   $0x805893
+  80025e:	e8 27 04 00 00       	call   80068a <_panic>
+	assert(sys_futex_wait(VA, 5, pageref(VA) + 1) == 0);
+  800263:	68 28 5b 80 00       	push   $0x805b28
+  800268:	68 a4 58 80 00       	push   $0x8058a4
+  80026d:	6a 21                	push   $0x21
+  80026f:	68 93 58 80 00       	push   $0x805893
+  800274:	e8 11 04 00 00       	call   80068a <_panic>
+		panic("fork: %e", pid);
+  800279:	50                   	push   %eax
+  80027a:	68 ec 58 80 00       	push   $0x8058ec
+  80027f:	6a 27                	push   $0x27
+  800281:	68 93 58 80 00       	push   $0x805893
+  800286:	e8 ff 03 00 00       	call   80068a <_panic>
+		wait_parent_asleep();
+  80028b:	e8 a3 fd ff ff       	call   800033 <wait_parent_asleep>
+		*VA = 1;
+  800290:	c7 05 00 00 00 a0 01 	movl   $0x1,0xa0000000
+  800297:	00 00 00 
+		if ((r = sys_futex_wake(VA, NENV)) != 1)
+  80029a:	83 ec 08             	sub    $0x8,%esp
+  80029d:	68 00 04 00 00       	push   $0x400
+  8002a2:	68 00 00 00 a0       	push   $0xa0000000
+  8002a7:	e8 bc 14 00 00       	call   801768 <sys_futex_wake>
+  8002ac:	83 c4 10             	add    $0x10,%esp
+  8002af:	83 f8 01             	cmp    $0x1,%eax
+  8002b2:	75 0a                	jne    8002be <umain+0x25c>
+		exit();
+  8002b4:	e8 b7 03 00 00       	call   800670 <exit>
+  8002b9:	e9 d8 fe ff ff       	jmp    800196 <umain+0x134>
+			panic("sys_futex_wake woke %d", r);
+  8002be:	50                   	push   %eax
+  8002bf:	68 f5 58 80 00       	push   $0x8058f5
+  8002c4:	6a 2c                	push   $0x2c
+  8002c6:	68 93 58 80 00       	push   $0x805893
+  8002cb:	e8 ba 03 00 00       	call   80068a <_panic>
+	wait(pid);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	53                   	push   %ebx
+  8002d4:	e8 5f 29 00 00       	call   802c38 <wait>
+	cprintf("futex wait and wake are good\n");
+  8002d9:	c7 04 24 1f 59 80 00 	movl   $0x80591f,(%esp)
+  8002e0:	e8 80 04 00 00       	call   800765 <cprintf>
+
+	// A reader asleep on an empty pipe sees the writer close it
+	if ((r = pipe(p)) < 0)
+  8002e5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8002e8:	89 04 24             	mov    %eax,(%esp)
+  8002eb:	e8 cb 27 00 00       	call   802abb <pipe>
+  8002f0:	83 c4 10             	add    $0x10,%esp
+  8002f3:	85 c0                	test   %eax,%eax
+  8002f5:	0f 88 04 02 00 00    	js     8004ff <umain+0x49d>
+		panic("pipe: %e", r);
+	if ((pid = fork()) < 0)
+  8002fb:	e8 26 16 00 00       	call   801926 <fork>
+  800300:	89 c6                	mov    %eax,%esi
+  800302:	85 c0                	test   %eax,%eax
+  800304:	0f 88 07 02 00 00    	js     800511 <umain+0x4af>
+		panic("fork: %e", pid);
+	if (pid == 0) {
+  80030a:	0f 84 13 02 00 00    	je     800523 <umain+0x4c1>
+		close(p[0]);
+		wait_parent_asleep();
+		close(p[1]);
+		exit();
+	}
+	close(p[1]);
+  800310:	83 ec 0c             	sub    $0xc,%esp
+  800313:	ff 75 f4             	push   -0xc(%ebp)
+  800316:	e8 11 1c 00 00       	call   801f2c <close>
+	if ((r = read(p[0], buf, 1)) != 0)
+  80031b:	83 c4 0c             	add    $0xc,%esp
+  80031e:	6a 01                	push   $0x1
+  800320:	68 20 f9 80 00       	push   $0x80f920
+  800325:	ff 75 f0             	push   -0x10(%ebp)
+  800328:	e8 3b 1d 00 00       	call   802068 <read>
+  80032d:	89 c3                	mov    %eax,%ebx
+  80032f:	83 c4 10             	add    $0x10,%esp
+  800332:	85 c0                	test   %eax,%eax
+  800334:	0f 85 11 02 00 00    	jne    80054b <umain+0x4e9>
+		panic("read from closed pipe returned %d", r);
+	close(p[0]);
+  80033a:	83 ec 0c             	sub    $0xc,%esp
+  80033d:	ff 75 f0             	push   -0x10(%ebp)
+  800340:	e8 e7 1b 00 00       	call   801f2c <close>
+	wait(pid);
+  800345:	89 34 24             	mov    %esi,(%esp)
+  800348:	e8 eb 28 00 00       	call   802c38 <wait>
+	cprintf("pipe reader wakes at eof\n");
+  80034d:	c7 04 24 46 59 80 00 	movl   $0x805946,(%esp)
+  800354:	e8 0c 04 00 00       	call   800765 <cprintf>
+
+	// A writer asleep on a full pipe sees the reader close it
+	if ((r = pipe(p)) < 0)
+  800359:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80035c:	89 04 24             	mov    %eax,(%esp)
+  80035f:	e8 57 27 00 00       	call   802abb <pipe>
+  800364:	83 c4 10             	add    $0x10,%esp
+  800367:	85 c0                	test   %eax,%eax
+  800369:	0f 88 ee 01 00 00    	js     80055d <umain+0x4fb>
+		panic("pipe: %e", r);
+	if ((pid = fork()) < 0)
+  80036f:	e8 b2 15 00 00       	call   801926 <fork>
+  800374:	89 c6                	mov    %eax,%esi
+  800376:	85 c0                	test   %eax,%eax
+  800378:	0f 88 f1 01 00 00    	js     80056f <umain+0x50d>
+		panic("fork: %e", pid);
+	if (pid == 0) {
+  80037e:	0f 84 fd 01 00 00    	je     800581 <umain+0x51f>
+		close(p[1]);
+		wait_parent_asleep();
+		close(p[0]);
+		exit();
+	}
+	close(p[0]);
+  800384:	83 ec 0c             	sub    $0xc,%esp
+  800387:	ff 75 f0             	push   -0x10(%ebp)
+  80038a:	e8 9d 1b 00 00       	call   801f2c <close>
+	memset(buf, 'x', sizeof buf);
+  80038f:	83 c4 0c             	add    $0xc,%esp
+  800392:	68 00 20 00 00       	push   $0x2000
+  800397:	6a 78                	push   $0x78
+  800399:	68 20 f9 80 00       	push   $0x80f920
+  80039e:	e8 fa 0a 00 00       	call   800e9d <memset>
+	if ((r = write(p[1], buf, sizeof buf)) >= (int) sizeof buf)
+  8003a3:	83 c4 0c             	add    $0xc,%esp
+  8003a6:	68 00 20 00 00       	push   $0x2000
+  8003ab:	68 20 f9 80 00       	push   $0x80f920
+  8003b0:	ff 75 f4             	push   -0xc(%ebp)
+  8003b3:	e8 7e 1d 00 00       	call   802136 <write>
+  8003b8:	83 c4 10             	add    $0x10,%esp
+  8003bb:	3d ff 1f 00 00       	cmp    $0x1fff,%eax
+  8003c0:	0f 8f e3 01 00 00    	jg     8005a9 <umain+0x547>
+		panic("write to closed pipe returned %d", r);
+	close(p[1]);
+  8003c6:	83 ec 0c             	sub    $0xc,%esp
+  8003c9:	ff 75 f4             	push   -0xc(%ebp)
+  8003cc:	e8 5b 1b 00 00       	call   801f2c <close>
+	wait(pid);
+  8003d1:	89 34 24             	mov    %esi,(%esp)
+  8003d4:	e8 5f 28 00 00       	call   802c38 <wait>
+	cprintf("pipe writer wakes at eof\n");
+  8003d9:	c7 04 24 60 59 80 00 	movl   $0x805960,(%esp)
+  8003e0:	e8 80 03 00 00       	call   800765 <cprintf>
+
+	// More than a pipe's worth in one write, taken in bulk
+	if ((r = pipe(p)) < 0)
+  8003e5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8003e8:	89 04 24             	mov    %eax,(%esp)
+  8003eb:	e8 cb 26 00 00       	call   802abb <pipe>
+  8003f0:	83 c4 10             	add    $0x10,%esp
+  8003f3:	85 c0                	test   %eax,%eax
+  8003f5:	0f 88 c0 01 00 00    	js     8005bb <umain+0x559>
+		panic("pipe: %e", r);
+	if ((pid = fork()) < 0)
+  8003fb:	e8 26 15 00 00       	call   801926 <fork>
+  800400:	89 c6                	mov    %eax,%esi
+  800402:	85 c0                	test   %eax,%eax
+  800404:	0f 88 c3 01 00 00    	js     8005cd <umain+0x56b>
+		panic("fork: %e", pid);
+	if (pid == 0) {
+  80040a:	75 48                	jne    800454 <umain+0x3f2>
+		close(p[0]);
+  80040c:	83 ec 0c             	sub    $0xc,%esp
+  80040f:	ff 75 f0             	push   -0x10(%ebp)
+  800412:	e8 15 1b 00 00       	call   801f2c <close>
+  800417:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < sizeof buf; i++)
+  80041a:	89 f0                	mov    %esi,%eax
+			buf[i] = i;
+  80041c:	88 80 20 f9 80 00    	mov    %al,0x80f920(%eax)
+		for (i = 0; i < sizeof buf; i++)
+  800422:	83 c0 01             	add    $0x1,%eax
+  800425:	3d 00 20 00 00       	cmp    $0x2000,%eax
+  80042a:	75 f0                	jne    80041c <umain+0x3ba>
+		if ((r = write(p[1], buf, sizeof buf)) != sizeof buf)
+  80042c:	83 ec 04             	sub    $0x4,%esp
+  80042f:	68 00 20 00 00       	push   $0x2000
+  800434:	68 20 f9 80 00       	push   $0x80f920
+  800439:	ff 75 f4             	push   -0xc(%ebp)
+  80043c:	e8 f5 1c 00 00       	call   802136 <write>
+  800441:	83 c4 10             	add    $0x10,%esp
+  800444:	3d 00 20 00 00       	cmp    $0x2000,%eax
+  800449:	0f 85 90 01 00 00    	jne    8005df <umain+0x57d>
+			panic("write: %e", r);
+		exit();
+  80044f:	e8 1c 02 00 00       	call   800670 <exit>
+	}
+	close(p[1]);
+  800454:	83 ec 0c             	sub    $0xc,%esp
+  800457:	ff 75 f4             	push   -0xc(%ebp)
+  80045a:	e8 cd 1a 00 00       	call   801f2c <close>
+	memset(buf, 0, sizeof buf);
+  80045f:	83 c4 0c             	add    $0xc,%esp
+  800462:	68 00 20 00 00       	push   $0x2000
+  800467:	6a 00                	push   $0x0
+  800469:	68 20 f9 80 00       	push   $0x80f920
+  80046e:	e8 2a 0a 00 00       	call   800e9d <memset>
+	if ((r = readn(p[0], buf, sizeof buf)) != sizeof buf)
+  800473:	83 c4 0c             	add    $0xc,%esp
+  800476:	68 00 20 00 00       	push   $0x2000
+  80047b:	68 20 f9 80 00       	push   $0x80f920
+  800480:	ff 75 f0             	push   -0x10(%ebp)
+  800483:	e8 67 1c 00 00       	call   8020ef <readn>
+  800488:	83 c4 10             	add    $0x10,%esp
+  80048b:	3d 00 20 00 00       	cmp    $0x2000,%eax
+  800490:	0f 85 5b 01 00 00    	jne    8005f1 <umain+0x58f>
+		panic("readn returned %d", r);
+	for (i = 0; i < sizeof buf; i++)
+		if (buf[i] != (char) i)
+  800496:	38 9b 20 f9 80 00    	cmp    %bl,0x80f920(%ebx)
+  80049c:	0f 85 61 01 00 00    	jne    800603 <umain+0x5a1>
+	for (i = 0; i < sizeof buf; i++)
+  8004a2:	83 c3 01             	add    $0x1,%ebx
+  8004a5:	81 fb 00 20 00 00    	cmp    $0x2000,%ebx
+  8004ab:	75 e9                	jne    800496 <umain+0x434>
+			panic("pipe data wrong at %d", i);
+	if ((r = read(p[0], buf, 1)) != 0)
+  8004ad:	83 ec 04             	sub    $0x4,%esp
+  8004b0:	6a 01                	push   $0x1
+  8004b2:	68 20 f9 80 00       	push   $0x80f920
+  8004b7:	ff 75 f0             	push   -0x10(%ebp)
+  8004ba:	e8 a9 1b 00 00       	call   802068 <read>
+  8004bf:	83 c4 10             	add    $0x10,%esp
+  8004c2:	85 c0                	test   %eax,%eax
+  8004c4:	0f 85 4b 01 00 00    	jne    800615 <umain+0x5b3>
+		panic("read past eof returned %d", r);
+	close(p[0]);
+  8004ca:	83 ec 0c             	sub    $0xc,%esp
+  8004cd:	ff 75 f0             	push   -0x10(%ebp)
+  8004d0:	e8 57 1a 00 00       	call   801f2c <close>
+	wait(pid);
+  8004d5:	89 34 24             	mov    %esi,(%esp)
+  8004d8:	e8 5b 27 00 00       	call   802c38 <wait>
+	cprintf("pipe bulk copy is good\n");
+  8004dd:	c7 04 24 c6 59 80 00 	movl   $0x8059c6,(%esp)
+  8004e4:	e8 7c 02 00 00       	call   800765 <cprintf>
+
+	cprintf("futex tests passed\n");
+  8004e9:	c7 04 24 de 59 80 00 	movl   $0x8059de,(%esp)
+  8004f0:	e8 70 02 00 00       	call   800765 <cprintf>
+}
+  8004f5:	83 c4 10             	add    $0x10,%esp
+  8004f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8004fb:	5b                   	pop    %ebx
+  8004fc:	5e                   	pop    %esi
+  8004fd:	5d                   	pop    %ebp
+  8004fe:	c3                   	ret
+		panic("pipe: %e", r);
+  8004ff:	50                   	push   %eax
+  800500:	68 3d 59 80 00       	push   $0x80593d
+  800505:	6a 37                	push   $0x37
+  800507:	68 93 58 80 00       	push   $0x805893
+  80050c:	e8 79 01 00 00       	call   80068a <_panic>
+		panic("fork: %e", pid);
+  800511:	50                   	push   %eax
+  800512:	68 ec 58 80 00       	push   $0x8058ec
+  800517:	6a 39                	push   $0x39
+  800519:	68 93 58 80 00       	push   $0x805893
+  80051e:	e8 67 01 00 00       	call   80068a <_panic>
+		close(p[0]);
+  800523:	83 ec 0c             	sub    $0xc,%esp
+  800526:	ff 75 f0             	push   -0x10(%ebp)
+  800529:	e8 fe 19 00 00       	call   801f2c <close>
+		wait_parent_asleep();
+  80052e:	e8 00 fb ff ff       	call   800033 <wait_parent_asleep>
+		close(p[1]);
+  800533:	83 c4 04             	add    $0x4,%esp
+  800536:	ff 75 f4             	push   -0xc(%ebp)
+  800539:	e8 ee 19 00 00       	call   801f2c <close>
+		exit();
+  80053e:	e8 2d 01 00 00       	call   800670 <exit>
+  800543:	83 c4 10             	add    $0x10,%esp
+  800546:	e9 c5 fd ff ff       	jmp    800310 <umain+0x2ae>
+		panic("read from closed pipe returned %d", r);
+  80054b:	50                   	push   %eax
+  80054c:	68 54 5b 80 00       	push   $0x805b54
+  800551:	6a 42                	push   $0x42
+  800553:	68 93 58 80 00       	push   $0x805893
+  800558:	e8 2d 01 00 00       	call   80068a <_panic>
+		panic("pipe: %e", r);
+  80055d:	50                   	push   %eax
+  80055e:	68 3d 59 80 00       	push   $0x80593d
+  800563:	6a 49                	push   $0x49
+  800565:	68 93 58 80 00       	push   $0x805893
+  80056a:	e8 1b 01 00 00       	call   80068a <_panic>
+		panic("fork: %e", pid);
+  80056f:	50                   	push   %eax
+  800570:	68 ec 58 80 00       	push   $0x8058ec
+  800575:	6a 4b                	push   $0x4b
+  800577:	68 93 58 80 00       	push   $0x805893
+  80057c:	e8 09 01 00 00       	call   80068a <_panic>
+		close(p[1]);
+  800581:	83 ec 0c             	sub    $0xc,%esp
+  800584:	ff 75 f4             	push   -0xc(%ebp)
+  800587:	e8 a0 19 00 00       	call   801f2c <close>
+		wait_parent_asleep();
+  80058c:	e8 a2 fa ff ff       	call   800033 <wait_parent_asleep>
+		close(p[0]);
+  800591:	83 c4 04             	add    $0x4,%esp
+  800594:	ff 75 f0             	push   -0x10(%ebp)
+  800597:	e8 90 19 00 00       	call   801f2c <close>
+		exit();
+  80059c:	e8 cf 00 00 00       	call   800670 <exit>
+  8005a1:	83 c4 10             	add    $0x10,%esp
+  8005a4:	e9 db fd ff ff       	jmp    800384 <umain+0x322>
+		panic("write to closed pipe returned %d", r);
+  8005a9:	50                   	push   %eax
+  8005aa:	68 78 5b 80 00       	push   $0x805b78
+  8005af:	6a 55                	push   $0x55
+  8005b1:	68 93 58 80 00       	push   $0x805893
+  8005b6:	e8 cf 00 00 00       	call   80068a <_panic>
+		panic("pipe: %e", r);
+  8005bb:	50                   	push   %eax
+  8005bc:	68 3d 59 80 00       	push   $0x80593d
+  8005c1:	6a 5c                	push   $0x5c
+  8005c3:	68 93 58 80 00       	push   $0x805893
+  8005c8:	e8 bd 00 00 00       	call   80068a <_panic>
+		panic("fork: %e", pid);
+  8005cd:	50                   	push   %eax
+  8005ce:	68 ec 58 80 00       	push   $0x8058ec
+  8005d3:	6a 5e                	push   $0x5e
+  8005d5:	68 93 58 80 00       	push   $0x805893
+  8005da:	e8 ab 00 00 00       	call   80068a <_panic>
+			panic("write: %e", r);
+  8005df:	50                   	push   %eax
+  8005e0:	68 7a 59 80 00       	push   $0x80597a
+  8005e5:	6a 64                	push   $0x64
+  8005e7:	68 93 58 80 00       	push   $0x805893
+  8005ec:	e8 99 00 00 00       	call   80068a <_panic>
+		panic("readn returned %d", r);
+  8005f1:	50                   	push   %eax
+  8005f2:	68 84 59 80 00       	push   $0x805984
+  8005f7:	6a 6a                	push   $0x6a
+  8005f9:	68 93 58 80 00       	push   $0x805893
+  8005fe:	e8 87 00 00 00       	call   80068a <_panic>
+			panic("pipe data wrong at %d", i);
+  800603:	53                   	push   %ebx
+  800604:	68 96 59 80 00       	push   $0x805996
+  800609:	6a 6d                	push   $0x6d
+  80060b:	68 93 58 80 00       	push   $0x805893
+  800610:	e8 75 00 00 00       	call   80068a <_panic>
+		panic("read past eof returned %d", r);
+  800615:	50                   	push   %eax
+  800616:	68 ac 59 80 00       	push   $0x8059ac
+  80061b:	6a 6f                	push   $0x6f
+  80061d:	68 93 58 80 00       	push   $0x805893
+  800622:	e8 63 00 00 00       	call   80068a <_panic>
+
+00800627 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800627:	55                   	push   %ebp
+  800628:	89 e5                	mov    %esp,%ebp
+  80062a:	56                   	push   %esi
+  80062b:	53                   	push   %ebx
+  80062c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80062f:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800632:	e8 ca 0b 00 00       	call   801201 <sys_getenvid>
+  800637:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80063c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80063f:	c1 e0 06             	shl    $0x6,%eax
+  800642:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800647:	a3 24 19 81 00       	mov    %eax,0x811924
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80064c:	85 db                	test   %ebx,%ebx
+  80064e:	7e 07                	jle    800657 <libmain+0x30>
+		binaryname = argv[0];
+  800650:	8b 06                	mov    (%esi),%eax
+  800652:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// call user main routine
+	umain(argc, argv);
+  800657:	83 ec 08             	sub    $0x8,%esp
+  80065a:	56                   	push   %esi
+  80065b:	53                   	push   %ebx
+  80065c:	e8 01 fa ff ff       	call   800062 <umain>
+
+	// exit gracefully
+	exit();
+  800661:	e8 0a 00 00 00       	call   800670 <exit>
+}
+  800666:	83 c4 10             	add    $0x10,%esp
+  800669:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80066c:	5b                   	pop    %ebx
+  80066d:	5e                   	pop    %esi
+  80066e:	5d                   	pop    %ebp
+  80066f:	c3                   	ret
+
+00800670 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800670:	55                   	push   %ebp
+  800671:	89 e5                	mov    %esp,%ebp
+  800673:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800676:	e8 de 18 00 00       	call   801f59 <close_all>
+	sys_env_destroy(0);
+  80067b:	83 ec 0c             	sub    $0xc,%esp
+  80067e:	6a 00                	push   $0x0
+  800680:	e8 3b 0b 00 00       	call   8011c0 <sys_env_destroy>
+}
+  800685:	83 c4 10             	add    $0x10,%esp
+  800688:	c9                   	leave
+  800689:	c3                   	ret
+
+0080068a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80068a:	55                   	push   %ebp
+  80068b:	89 e5                	mov    %esp,%ebp
+  80068d:	56                   	push   %esi
+  80068e:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80068f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800692:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  800698:	e8 64 0b 00 00       	call   801201 <sys_getenvid>
+  80069d:	83 ec 0c             	sub    $0xc,%esp
+  8006a0:	ff 75 0c             	push   0xc(%ebp)
+  8006a3:	ff 75 08             	push   0x8(%ebp)
+  8006a6:	56                   	push   %esi
+  8006a7:	50                   	push   %eax
+  8006a8:	68 a4 5b 80 00       	push   $0x805ba4
+  8006ad:	e8 b3 00 00 00       	call   800765 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8006b2:	83 c4 18             	add    $0x18,%esp
+  8006b5:	53                   	push   %ebx
+  8006b6:	ff 75 10             	push   0x10(%ebp)
+  8006b9:	e8 56 00 00 00       	call   800714 <vcprintf>
+	cprintf("\n");
+  8006be:	c7 04 24 42 61 80 00 	movl   $0x806142,(%esp)
+  8006c5:	e8 9b 00 00 00       	call   800765 <cprintf>
+  8006ca:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  8006cd:	cc                   	int3
+	while (1)
+  8006ce:	eb fd                	jmp    8006cd <_panic+0x43>
+
+008006d0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8006d0:	55                   	push   %ebp
+  8006d1:	89 e5                	mov    %esp,%ebp
+  8006d3:	53                   	push   %ebx
+  8006d4:	83 ec 04             	sub    $0x4,%esp
+  8006d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8006da:	8b 13                	mov    (%ebx),%edx
+  8006dc:	8d 42 01             	lea    0x1(%edx),%eax
+  8006df:	89 03                	mov    %eax,(%ebx)
+  8006e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006e4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8006e8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006ed:	74 09                	je     8006f8 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8006ef:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006f6:	c9                   	leave
+  8006f7:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8006f8:	83 ec 08             	sub    $0x8,%esp
+  8006fb:	68 ff 00 00 00       	push   $0xff
+  800700:	8d 43 08             	lea    0x8(%ebx),%eax
+  800703:	50                   	push   %eax
+  800704:	e8 69 0a 00 00       	call   801172 <sys_cputs>
+		b->idx = 0;
+  800709:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80070f:	83 c4 10             	add    $0x10,%esp
+  800712:	eb db                	jmp    8006ef <putch+0x1f>
+
+00800714 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800714:	55                   	push   %ebp
+  800715:	89 e5                	mov    %esp,%ebp
+  800717:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80071d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800724:	00 00 00 
+	b.cnt = 0;
+  800727:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80072e:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800731:	ff 75 0c             	push   0xc(%ebp)
+  800734:	ff 75 08             	push   0x8(%ebp)
+  800737:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80073d:	50                   	push   %eax
+  80073e:	68 d0 06 80 00       	push   $0x8006d0
+  800743:	e8 14 01 00 00       	call   80085c <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800748:	83 c4 08             	add    $0x8,%esp
+  80074b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800751:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800757:	50                   	push   %eax
+  800758:	e8 15 0a 00 00       	call   801172 <sys_cputs>
+
+	return b.cnt;
+}
+  80075d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800763:	c9                   	leave
+  800764:	c3                   	ret
+
+00800765 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800765:	55                   	push   %ebp
+  800766:	89 e5                	mov    %esp,%ebp
+  800768:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80076b:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80076e:	50                   	push   %eax
+  80076f:	ff 75 08             	push   0x8(%ebp)
+  800772:	e8 9d ff ff ff       	call   800714 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800777:	c9                   	leave
+  800778:	c3                   	ret
+
+00800779 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800779:	55                   	push   %ebp
+  80077a:	89 e5                	mov    %esp,%ebp
+  80077c:	57                   	push   %edi
+  80077d:	56                   	push   %esi
+  80077e:	53                   	push   %ebx
+  80077f:	83 ec 1c             	sub    $0x1c,%esp
+  800782:	89 c7                	mov    %eax,%edi
+  800784:	89 d6                	mov    %edx,%esi
+  800786:	8b 45 08             	mov    0x8(%ebp),%eax
+  800789:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80078c:	89 d1                	mov    %edx,%ecx
+  80078e:	89 c2                	mov    %eax,%edx
+  800790:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800793:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800796:	8b 45 10             	mov    0x10(%ebp),%eax
+  800799:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80079c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80079f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8007a6:	39 c2                	cmp    %eax,%edx
+  8007a8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8007ab:	72 3e                	jb     8007eb <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007ad:	83 ec 0c             	sub    $0xc,%esp
+  8007b0:	ff 75 18             	push   0x18(%ebp)
+  8007b3:	83 eb 01             	sub    $0x1,%ebx
+  8007b6:	53                   	push   %ebx
+  8007b7:	50                   	push   %eax
+  8007b8:	83 ec 08             	sub    $0x8,%esp
+  8007bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8007be:	ff 75 e0             	push   -0x20(%ebp)
+  8007c1:	ff 75 dc             	push   -0x24(%ebp)
+  8007c4:	ff 75 d8             	push   -0x28(%ebp)
+  8007c7:	e8 6e 4f 00 00       	call   80573a <__udivdi3>
+  8007cc:	83 c4 18             	add    $0x18,%esp
+  8007cf:	52                   	push   %edx
+  8007d0:	50                   	push   %eax
+  8007d1:	89 f2                	mov    %esi,%edx
+  8007d3:	89 f8                	mov    %edi,%eax
+  8007d5:	e8 9f ff ff ff       	call   800779 <printnum>
+  8007da:	83 c4 20             	add    $0x20,%esp
+  8007dd:	eb 13                	jmp    8007f2 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8007df:	83 ec 08             	sub    $0x8,%esp
+  8007e2:	56                   	push   %esi
+  8007e3:	ff 75 18             	push   0x18(%ebp)
+  8007e6:	ff d7                	call   *%edi
+  8007e8:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8007eb:	83 eb 01             	sub    $0x1,%ebx
+  8007ee:	85 db                	test   %ebx,%ebx
+  8007f0:	7f ed                	jg     8007df <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8007f2:	83 ec 08             	sub    $0x8,%esp
+  8007f5:	56                   	push   %esi
+  8007f6:	83 ec 04             	sub    $0x4,%esp
+  8007f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8007fc:	ff 75 e0             	push   -0x20(%ebp)
+  8007ff:	ff 75 dc             	push   -0x24(%ebp)
+  800802:	ff 75 d8             	push   -0x28(%ebp)
+  800805:	e8 4e 4f 00 00       	call   805758 <__umoddi3>
+  80080a:	83 c4 14             	add    $0x14,%esp
+  80080d:	0f be 80 c7 5b 80 00 	movsbl 0x805bc7(%eax),%eax
+  800814:	50                   	push   %eax
+  800815:	ff d7                	call   *%edi
+}
+  800817:	83 c4 10             	add    $0x10,%esp
+  80081a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80081d:	5b                   	pop    %ebx
+  80081e:	5e                   	pop    %esi
+  80081f:	5f                   	pop    %edi
+  800820:	5d                   	pop    %ebp
+  800821:	c3                   	ret
+
+00800822 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800822:	55                   	push   %ebp
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800828:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80082c:	8b 10                	mov    (%eax),%edx
+  80082e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800831:	73 0a                	jae    80083d <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800833:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800836:	89 08                	mov    %ecx,(%eax)
+  800838:	8b 45 08             	mov    0x8(%ebp),%eax
+  80083b:	88 02                	mov    %al,(%edx)
+}
+  80083d:	5d                   	pop    %ebp
+  80083e:	c3                   	ret
+
+0080083f <printfmt>:
+{
+  80083f:	55                   	push   %ebp
+  800840:	89 e5                	mov    %esp,%ebp
+  800842:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800845:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800848:	50                   	push   %eax
+  800849:	ff 75 10             	push   0x10(%ebp)
+  80084c:	ff 75 0c             	push   0xc(%ebp)
+  80084f:	ff 75 08             	push   0x8(%ebp)
+  800852:	e8 05 00 00 00       	call   80085c <vprintfmt>
+}
+  800857:	83 c4 10             	add    $0x10,%esp
+  80085a:	c9                   	leave
+  80085b:	c3                   	ret
+
+0080085c <vprintfmt>:
+{
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	57                   	push   %edi
+  800860:	56                   	push   %esi
+  800861:	53                   	push   %ebx
+  800862:	83 ec 2c             	sub    $0x2c,%esp
+  800865:	8b 75 08             	mov    0x8(%ebp),%esi
+  800868:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80086b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80086e:	eb 0a                	jmp    80087a <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800870:	83 ec 08             	sub    $0x8,%esp
+  800873:	53                   	push   %ebx
+  800874:	50                   	push   %eax
+  800875:	ff d6                	call   *%esi
+  800877:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80087a:	83 c7 01             	add    $0x1,%edi
+  80087d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800881:	83 f8 25             	cmp    $0x25,%eax
+  800884:	74 0c                	je     800892 <vprintfmt+0x36>
+			if (ch == '\0')
+  800886:	85 c0                	test   %eax,%eax
+  800888:	75 e6                	jne    800870 <vprintfmt+0x14>
+}
+  80088a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80088d:	5b                   	pop    %ebx
+  80088e:	5e                   	pop    %esi
+  80088f:	5f                   	pop    %edi
+  800890:	5d                   	pop    %ebp
+  800891:	c3                   	ret
+		padc = ' ';
+  800892:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800896:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80089d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8008a4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8008ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8008b0:	8d 47 01             	lea    0x1(%edi),%eax
+  8008b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008b6:	0f b6 17             	movzbl (%edi),%edx
+  8008b9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8008bc:	3c 55                	cmp    $0x55,%al
+  8008be:	0f 87 c5 03 00 00    	ja     800c89 <vprintfmt+0x42d>
+  8008c4:	0f b6 c0             	movzbl %al,%eax
+  8008c7:	ff 24 85 40 5d 80 00 	jmp    *0x805d40(,%eax,4)
+  8008ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8008d1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8008d5:	eb d9                	jmp    8008b0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8008d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8008da:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8008de:	eb d0                	jmp    8008b0 <vprintfmt+0x54>
+  8008e0:	0f b6 d2             	movzbl %dl,%edx
+  8008e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8008e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008eb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8008ee:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008f1:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8008f5:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8008f8:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8008fb:	83 f9 09             	cmp    $0x9,%ecx
+  8008fe:	77 55                	ja     800955 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800900:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800903:	eb e9                	jmp    8008ee <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800905:	8b 45 14             	mov    0x14(%ebp),%eax
+  800908:	8b 00                	mov    (%eax),%eax
+  80090a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80090d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800910:	8d 40 04             	lea    0x4(%eax),%eax
+  800913:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800916:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800919:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80091d:	79 91                	jns    8008b0 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80091f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800922:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800925:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80092c:	eb 82                	jmp    8008b0 <vprintfmt+0x54>
+			if (width < 0)
+  80092e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800931:	85 d2                	test   %edx,%edx
+  800933:	b8 00 00 00 00       	mov    $0x0,%eax
+  800938:	0f 49 c2             	cmovns %edx,%eax
+  80093b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80093e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800941:	e9 6a ff ff ff       	jmp    8008b0 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800946:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800949:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800950:	e9 5b ff ff ff       	jmp    8008b0 <vprintfmt+0x54>
+  800955:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800958:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80095b:	eb bc                	jmp    800919 <vprintfmt+0xbd>
+			lflag++;
+  80095d:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800960:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800963:	e9 48 ff ff ff       	jmp    8008b0 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800968:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096b:	8d 78 04             	lea    0x4(%eax),%edi
+  80096e:	83 ec 08             	sub    $0x8,%esp
+  800971:	53                   	push   %ebx
+  800972:	ff 30                	push   (%eax)
+  800974:	ff d6                	call   *%esi
+			break;
+  800976:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800979:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80097c:	e9 63 02 00 00       	jmp    800be4 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800981:	8b 45 14             	mov    0x14(%ebp),%eax
+  800984:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800987:	8b 10                	mov    (%eax),%edx
+  800989:	89 d0                	mov    %edx,%eax
+  80098b:	f7 d8                	neg    %eax
+  80098d:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800990:	83 f8 12             	cmp    $0x12,%eax
+  800993:	7f 23                	jg     8009b8 <vprintfmt+0x15c>
+  800995:	8b 14 85 a0 5e 80 00 	mov    0x805ea0(,%eax,4),%edx
+  80099c:	85 d2                	test   %edx,%edx
+  80099e:	74 18                	je     8009b8 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8009a0:	52                   	push   %edx
+  8009a1:	68 b6 58 80 00       	push   $0x8058b6
+  8009a6:	53                   	push   %ebx
+  8009a7:	56                   	push   %esi
+  8009a8:	e8 92 fe ff ff       	call   80083f <printfmt>
+  8009ad:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009b0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8009b3:	e9 2c 02 00 00       	jmp    800be4 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8009b8:	50                   	push   %eax
+  8009b9:	68 df 5b 80 00       	push   $0x805bdf
+  8009be:	53                   	push   %ebx
+  8009bf:	56                   	push   %esi
+  8009c0:	e8 7a fe ff ff       	call   80083f <printfmt>
+  8009c5:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8009c8:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8009cb:	e9 14 02 00 00       	jmp    800be4 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d3:	83 c0 04             	add    $0x4,%eax
+  8009d6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8009d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009dc:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8009de:	85 c9                	test   %ecx,%ecx
+  8009e0:	b8 d8 5b 80 00       	mov    $0x805bd8,%eax
+  8009e5:	0f 45 c1             	cmovne %ecx,%eax
+  8009e8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8009eb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009ef:	7e 06                	jle    8009f7 <vprintfmt+0x19b>
+  8009f1:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8009f5:	75 0b                	jne    800a02 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8009f7:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8009fa:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8009fd:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a00:	eb 5c                	jmp    800a5e <vprintfmt+0x202>
+  800a02:	83 ec 08             	sub    $0x8,%esp
+  800a05:	ff 75 d0             	push   -0x30(%ebp)
+  800a08:	ff 75 cc             	push   -0x34(%ebp)
+  800a0b:	e8 19 03 00 00       	call   800d29 <strnlen>
+  800a10:	89 c2                	mov    %eax,%edx
+  800a12:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a15:	29 d0                	sub    %edx,%eax
+  800a17:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800a1a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800a1e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a21:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a24:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a26:	eb 0e                	jmp    800a36 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800a28:	83 ec 08             	sub    $0x8,%esp
+  800a2b:	53                   	push   %ebx
+  800a2c:	57                   	push   %edi
+  800a2d:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800a30:	83 ee 01             	sub    $0x1,%esi
+  800a33:	83 c4 10             	add    $0x10,%esp
+  800a36:	85 f6                	test   %esi,%esi
+  800a38:	7f ee                	jg     800a28 <vprintfmt+0x1cc>
+  800a3a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a3d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a40:	85 c0                	test   %eax,%eax
+  800a42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a47:	0f 49 d0             	cmovns %eax,%edx
+  800a4a:	29 d0                	sub    %edx,%eax
+  800a4c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a4f:	eb a6                	jmp    8009f7 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800a51:	83 ec 08             	sub    $0x8,%esp
+  800a54:	53                   	push   %ebx
+  800a55:	52                   	push   %edx
+  800a56:	ff 55 08             	call   *0x8(%ebp)
+  800a59:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a5c:	89 f1                	mov    %esi,%ecx
+  800a5e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800a61:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a65:	0f be d0             	movsbl %al,%edx
+  800a68:	85 d2                	test   %edx,%edx
+  800a6a:	74 28                	je     800a94 <vprintfmt+0x238>
+  800a6c:	85 ff                	test   %edi,%edi
+  800a6e:	78 05                	js     800a75 <vprintfmt+0x219>
+  800a70:	83 ef 01             	sub    $0x1,%edi
+  800a73:	78 30                	js     800aa5 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800a75:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a79:	74 d6                	je     800a51 <vprintfmt+0x1f5>
+  800a7b:	0f be c0             	movsbl %al,%eax
+  800a7e:	83 e8 20             	sub    $0x20,%eax
+  800a81:	83 f8 5e             	cmp    $0x5e,%eax
+  800a84:	76 cb                	jbe    800a51 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800a86:	83 ec 08             	sub    $0x8,%esp
+  800a89:	53                   	push   %ebx
+  800a8a:	6a 3f                	push   $0x3f
+  800a8c:	ff 55 08             	call   *0x8(%ebp)
+  800a8f:	83 c4 10             	add    $0x10,%esp
+  800a92:	eb c8                	jmp    800a5c <vprintfmt+0x200>
+  800a94:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a97:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a9a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a9d:	01 d0                	add    %edx,%eax
+  800a9f:	29 c8                	sub    %ecx,%eax
+  800aa1:	89 c7                	mov    %eax,%edi
+  800aa3:	eb 13                	jmp    800ab8 <vprintfmt+0x25c>
+  800aa5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aa8:	eb ed                	jmp    800a97 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800aaa:	83 ec 08             	sub    $0x8,%esp
+  800aad:	53                   	push   %ebx
+  800aae:	6a 20                	push   $0x20
+  800ab0:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800ab2:	83 ef 01             	sub    $0x1,%edi
+  800ab5:	83 c4 10             	add    $0x10,%esp
+  800ab8:	85 ff                	test   %edi,%edi
+  800aba:	7f ee                	jg     800aaa <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800abc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800abf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ac2:	e9 1d 01 00 00       	jmp    800be4 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800ac7:	83 f9 01             	cmp    $0x1,%ecx
+  800aca:	7f 1b                	jg     800ae7 <vprintfmt+0x28b>
+	else if (lflag)
+  800acc:	85 c9                	test   %ecx,%ecx
+  800ace:	74 63                	je     800b33 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800ad0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad3:	8b 00                	mov    (%eax),%eax
+  800ad5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ad8:	99                   	cltd
+  800ad9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800adc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800adf:	8d 40 04             	lea    0x4(%eax),%eax
+  800ae2:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ae5:	eb 17                	jmp    800afe <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800ae7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aea:	8b 50 04             	mov    0x4(%eax),%edx
+  800aed:	8b 00                	mov    (%eax),%eax
+  800aef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800af2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800af5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af8:	8d 40 08             	lea    0x8(%eax),%eax
+  800afb:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800afe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b01:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800b04:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800b09:	85 c9                	test   %ecx,%ecx
+  800b0b:	0f 89 b9 00 00 00    	jns    800bca <vprintfmt+0x36e>
+				putch('-', putdat);
+  800b11:	83 ec 08             	sub    $0x8,%esp
+  800b14:	53                   	push   %ebx
+  800b15:	6a 2d                	push   $0x2d
+  800b17:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800b19:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b1c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b1f:	f7 da                	neg    %edx
+  800b21:	83 d1 00             	adc    $0x0,%ecx
+  800b24:	f7 d9                	neg    %ecx
+  800b26:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800b29:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800b2e:	e9 97 00 00 00       	jmp    800bca <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800b33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b36:	8b 00                	mov    (%eax),%eax
+  800b38:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b3b:	99                   	cltd
+  800b3c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b3f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b42:	8d 40 04             	lea    0x4(%eax),%eax
+  800b45:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b48:	eb b4                	jmp    800afe <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800b4a:	83 f9 01             	cmp    $0x1,%ecx
+  800b4d:	7f 1b                	jg     800b6a <vprintfmt+0x30e>
+	else if (lflag)
+  800b4f:	85 c9                	test   %ecx,%ecx
+  800b51:	74 2c                	je     800b7f <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800b53:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b56:	8b 10                	mov    (%eax),%edx
+  800b58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b5d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b60:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b63:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800b68:	eb 60                	jmp    800bca <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800b6a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b6d:	8b 10                	mov    (%eax),%edx
+  800b6f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b72:	8d 40 08             	lea    0x8(%eax),%eax
+  800b75:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b78:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800b7d:	eb 4b                	jmp    800bca <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800b7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b82:	8b 10                	mov    (%eax),%edx
+  800b84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b89:	8d 40 04             	lea    0x4(%eax),%eax
+  800b8c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800b8f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800b94:	eb 34                	jmp    800bca <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800b96:	83 f9 01             	cmp    $0x1,%ecx
+  800b99:	7f 15                	jg     800bb0 <vprintfmt+0x354>
+	else if (lflag)
+  800b9b:	85 c9                	test   %ecx,%ecx
+  800b9d:	74 4d                	je     800bec <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800b9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ba2:	8b 00                	mov    (%eax),%eax
+  800ba4:	99                   	cltd
+  800ba5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800ba8:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800bab:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800bae:	eb 11                	jmp    800bc1 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800bb0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb3:	8b 50 04             	mov    0x4(%eax),%edx
+  800bb6:	8b 00                	mov    (%eax),%eax
+  800bb8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800bbb:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800bbe:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800bc1:	89 d1                	mov    %edx,%ecx
+  800bc3:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800bc5:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800bca:	83 ec 0c             	sub    $0xc,%esp
+  800bcd:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800bd1:	50                   	push   %eax
+  800bd2:	ff 75 e0             	push   -0x20(%ebp)
+  800bd5:	57                   	push   %edi
+  800bd6:	51                   	push   %ecx
+  800bd7:	52                   	push   %edx
+  800bd8:	89 da                	mov    %ebx,%edx
+  800bda:	89 f0                	mov    %esi,%eax
+  800bdc:	e8 98 fb ff ff       	call   800779 <printnum>
+			break;
+  800be1:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800be4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800be7:	e9 8e fc ff ff       	jmp    80087a <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800bec:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bef:	8b 00                	mov    (%eax),%eax
+  800bf1:	99                   	cltd
+  800bf2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800bf5:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800bf8:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800bfb:	eb c4                	jmp    800bc1 <vprintfmt+0x365>
+			putch('0', putdat);
+  800bfd:	83 ec 08             	sub    $0x8,%esp
+  800c00:	53                   	push   %ebx
+  800c01:	6a 30                	push   $0x30
+  800c03:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800c05:	83 c4 08             	add    $0x8,%esp
+  800c08:	53                   	push   %ebx
+  800c09:	6a 78                	push   $0x78
+  800c0b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800c0d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c10:	8b 10                	mov    (%eax),%edx
+  800c12:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800c17:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800c1a:	8d 40 04             	lea    0x4(%eax),%eax
+  800c1d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c20:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800c25:	eb a3                	jmp    800bca <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800c27:	83 f9 01             	cmp    $0x1,%ecx
+  800c2a:	7f 1b                	jg     800c47 <vprintfmt+0x3eb>
+	else if (lflag)
+  800c2c:	85 c9                	test   %ecx,%ecx
+  800c2e:	74 2f                	je     800c5f <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800c30:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c33:	8b 10                	mov    (%eax),%edx
+  800c35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c3a:	8d 40 04             	lea    0x4(%eax),%eax
+  800c3d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c40:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800c45:	eb 83                	jmp    800bca <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800c47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c4a:	8b 10                	mov    (%eax),%edx
+  800c4c:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c4f:	8d 40 08             	lea    0x8(%eax),%eax
+  800c52:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c55:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800c5a:	e9 6b ff ff ff       	jmp    800bca <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800c5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c62:	8b 10                	mov    (%eax),%edx
+  800c64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c69:	8d 40 04             	lea    0x4(%eax),%eax
+  800c6c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800c6f:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800c74:	e9 51 ff ff ff       	jmp    800bca <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800c79:	83 ec 08             	sub    $0x8,%esp
+  800c7c:	53                   	push   %ebx
+  800c7d:	6a 25                	push   $0x25
+  800c7f:	ff d6                	call   *%esi
+			break;
+  800c81:	83 c4 10             	add    $0x10,%esp
+  800c84:	e9 5b ff ff ff       	jmp    800be4 <vprintfmt+0x388>
+			putch('%', putdat);
+  800c89:	83 ec 08             	sub    $0x8,%esp
+  800c8c:	53                   	push   %ebx
+  800c8d:	6a 25                	push   $0x25
+  800c8f:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800c91:	83 c4 10             	add    $0x10,%esp
+  800c94:	89 f8                	mov    %edi,%eax
+  800c96:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c9a:	74 05                	je     800ca1 <vprintfmt+0x445>
+  800c9c:	83 e8 01             	sub    $0x1,%eax
+  800c9f:	eb f5                	jmp    800c96 <vprintfmt+0x43a>
+  800ca1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ca4:	e9 3b ff ff ff       	jmp    800be4 <vprintfmt+0x388>
+
+00800ca9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ca9:	55                   	push   %ebp
+  800caa:	89 e5                	mov    %esp,%ebp
+  800cac:	83 ec 18             	sub    $0x18,%esp
+  800caf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb2:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800cb5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800cb8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800cbc:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800cbf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800cc6:	85 c0                	test   %eax,%eax
+  800cc8:	74 26                	je     800cf0 <vsnprintf+0x47>
+  800cca:	85 d2                	test   %edx,%edx
+  800ccc:	7e 22                	jle    800cf0 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800cce:	ff 75 14             	push   0x14(%ebp)
+  800cd1:	ff 75 10             	push   0x10(%ebp)
+  800cd4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800cd7:	50                   	push   %eax
+  800cd8:	68 22 08 80 00       	push   $0x800822
+  800cdd:	e8 7a fb ff ff       	call   80085c <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800ce2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ce5:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800ce8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ceb:	83 c4 10             	add    $0x10,%esp
+}
+  800cee:	c9                   	leave
+  800cef:	c3                   	ret
+		return -E_INVAL;
+  800cf0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cf5:	eb f7                	jmp    800cee <vsnprintf+0x45>
+
+00800cf7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800cf7:	55                   	push   %ebp
+  800cf8:	89 e5                	mov    %esp,%ebp
+  800cfa:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800cfd:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800d00:	50                   	push   %eax
+  800d01:	ff 75 10             	push   0x10(%ebp)
+  800d04:	ff 75 0c             	push   0xc(%ebp)
+  800d07:	ff 75 08             	push   0x8(%ebp)
+  800d0a:	e8 9a ff ff ff       	call   800ca9 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800d0f:	c9                   	leave
+  800d10:	c3                   	ret
+
+00800d11 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1c:	eb 03                	jmp    800d21 <strlen+0x10>
+		n++;
+  800d1e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800d21:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d25:	75 f7                	jne    800d1e <strlen+0xd>
+	return n;
+}
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+
+00800d29 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d2f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d37:	eb 03                	jmp    800d3c <strnlen+0x13>
+		n++;
+  800d39:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d3c:	39 d0                	cmp    %edx,%eax
+  800d3e:	74 08                	je     800d48 <strnlen+0x1f>
+  800d40:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d44:	75 f3                	jne    800d39 <strnlen+0x10>
+  800d46:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800d48:	89 d0                	mov    %edx,%eax
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	53                   	push   %ebx
+  800d50:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d5f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d62:	83 c0 01             	add    $0x1,%eax
+  800d65:	84 d2                	test   %dl,%dl
+  800d67:	75 f2                	jne    800d5b <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800d69:	89 c8                	mov    %ecx,%eax
+  800d6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d6e:	c9                   	leave
+  800d6f:	c3                   	ret
+
+00800d70 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	53                   	push   %ebx
+  800d74:	83 ec 10             	sub    $0x10,%esp
+  800d77:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800d7a:	53                   	push   %ebx
+  800d7b:	e8 91 ff ff ff       	call   800d11 <strlen>
+  800d80:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800d83:	ff 75 0c             	push   0xc(%ebp)
+  800d86:	01 d8                	add    %ebx,%eax
+  800d88:	50                   	push   %eax
+  800d89:	e8 be ff ff ff       	call   800d4c <strcpy>
+	return dst;
+}
+  800d8e:	89 d8                	mov    %ebx,%eax
+  800d90:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d93:	c9                   	leave
+  800d94:	c3                   	ret
+
+00800d95 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+  800d9a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800da0:	89 f3                	mov    %esi,%ebx
+  800da2:	03 5d 10             	add    0x10(%ebp),%ebx
+  800da5:	89 f0                	mov    %esi,%eax
+  800da7:	eb 0f                	jmp    800db8 <strncpy+0x23>
+		*dst++ = *src;
+  800da9:	83 c0 01             	add    $0x1,%eax
+  800dac:	0f b6 0a             	movzbl (%edx),%ecx
+  800daf:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800db2:	80 f9 01             	cmp    $0x1,%cl
+  800db5:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800db8:	39 d8                	cmp    %ebx,%eax
+  800dba:	75 ed                	jne    800da9 <strncpy+0x14>
+	}
+	return ret;
+}
+  800dbc:	89 f0                	mov    %esi,%eax
+  800dbe:	5b                   	pop    %ebx
+  800dbf:	5e                   	pop    %esi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+
+00800dc2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	56                   	push   %esi
+  800dc6:	53                   	push   %ebx
+  800dc7:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcd:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800dd0:	89 f0                	mov    %esi,%eax
+  800dd2:	85 d2                	test   %edx,%edx
+  800dd4:	74 21                	je     800df7 <strlcpy+0x35>
+  800dd6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800dda:	89 f2                	mov    %esi,%edx
+  800ddc:	eb 09                	jmp    800de7 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800dde:	83 c1 01             	add    $0x1,%ecx
+  800de1:	83 c2 01             	add    $0x1,%edx
+  800de4:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800de7:	39 c2                	cmp    %eax,%edx
+  800de9:	74 09                	je     800df4 <strlcpy+0x32>
+  800deb:	0f b6 19             	movzbl (%ecx),%ebx
+  800dee:	84 db                	test   %bl,%bl
+  800df0:	75 ec                	jne    800dde <strlcpy+0x1c>
+  800df2:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800df4:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800df7:	29 f0                	sub    %esi,%eax
+}
+  800df9:	5b                   	pop    %ebx
+  800dfa:	5e                   	pop    %esi
+  800dfb:	5d                   	pop    %ebp
+  800dfc:	c3                   	ret
+
+00800dfd <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800dfd:	55                   	push   %ebp
+  800dfe:	89 e5                	mov    %esp,%ebp
+  800e00:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e03:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800e06:	eb 06                	jmp    800e0e <strcmp+0x11>
+		p++, q++;
+  800e08:	83 c1 01             	add    $0x1,%ecx
+  800e0b:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800e0e:	0f b6 01             	movzbl (%ecx),%eax
+  800e11:	84 c0                	test   %al,%al
+  800e13:	74 04                	je     800e19 <strcmp+0x1c>
+  800e15:	3a 02                	cmp    (%edx),%al
+  800e17:	74 ef                	je     800e08 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e19:	0f b6 c0             	movzbl %al,%eax
+  800e1c:	0f b6 12             	movzbl (%edx),%edx
+  800e1f:	29 d0                	sub    %edx,%eax
+}
+  800e21:	5d                   	pop    %ebp
+  800e22:	c3                   	ret
+
+00800e23 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e23:	55                   	push   %ebp
+  800e24:	89 e5                	mov    %esp,%ebp
+  800e26:	53                   	push   %ebx
+  800e27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2d:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800e30:	eb 09                	jmp    800e3b <strncmp+0x18>
+		n--, p++, q++;
+  800e32:	83 ea 01             	sub    $0x1,%edx
+  800e35:	83 c0 01             	add    $0x1,%eax
+  800e38:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800e3b:	85 d2                	test   %edx,%edx
+  800e3d:	74 18                	je     800e57 <strncmp+0x34>
+  800e3f:	0f b6 18             	movzbl (%eax),%ebx
+  800e42:	84 db                	test   %bl,%bl
+  800e44:	74 04                	je     800e4a <strncmp+0x27>
+  800e46:	3a 19                	cmp    (%ecx),%bl
+  800e48:	74 e8                	je     800e32 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800e4a:	0f b6 00             	movzbl (%eax),%eax
+  800e4d:	0f b6 11             	movzbl (%ecx),%edx
+  800e50:	29 d0                	sub    %edx,%eax
+}
+  800e52:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e55:	c9                   	leave
+  800e56:	c3                   	ret
+		return 0;
+  800e57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5c:	eb f4                	jmp    800e52 <strncmp+0x2f>
+
+00800e5e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e5e:	55                   	push   %ebp
+  800e5f:	89 e5                	mov    %esp,%ebp
+  800e61:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e64:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e68:	eb 03                	jmp    800e6d <strchr+0xf>
+  800e6a:	83 c0 01             	add    $0x1,%eax
+  800e6d:	0f b6 10             	movzbl (%eax),%edx
+  800e70:	84 d2                	test   %dl,%dl
+  800e72:	74 06                	je     800e7a <strchr+0x1c>
+		if (*s == c)
+  800e74:	38 ca                	cmp    %cl,%dl
+  800e76:	75 f2                	jne    800e6a <strchr+0xc>
+  800e78:	eb 05                	jmp    800e7f <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800e7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e7f:	5d                   	pop    %ebp
+  800e80:	c3                   	ret
+
+00800e81 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e81:	55                   	push   %ebp
+  800e82:	89 e5                	mov    %esp,%ebp
+  800e84:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e87:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800e8b:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800e8e:	38 ca                	cmp    %cl,%dl
+  800e90:	74 09                	je     800e9b <strfind+0x1a>
+  800e92:	84 d2                	test   %dl,%dl
+  800e94:	74 05                	je     800e9b <strfind+0x1a>
+	for (; *s; s++)
+  800e96:	83 c0 01             	add    $0x1,%eax
+  800e99:	eb f0                	jmp    800e8b <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800e9b:	5d                   	pop    %ebp
+  800e9c:	c3                   	ret
+
+00800e9d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e9d:	55                   	push   %ebp
+  800e9e:	89 e5                	mov    %esp,%ebp
+  800ea0:	57                   	push   %edi
+  800ea1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ea4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800ea7:	85 c9                	test   %ecx,%ecx
+  800ea9:	74 20                	je     800ecb <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800eab:	89 f8                	mov    %edi,%eax
+  800ead:	09 c8                	or     %ecx,%eax
+  800eaf:	a8 03                	test   $0x3,%al
+  800eb1:	75 12                	jne    800ec5 <memset+0x28>
+		c &= 0xFF;
+  800eb3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800eb7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800ebd:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800ec0:	fc                   	cld
+  800ec1:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ec3:	eb 06                	jmp    800ecb <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800ec5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ec8:	fc                   	cld
+  800ec9:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800ecb:	89 f8                	mov    %edi,%eax
+  800ecd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ed0:	c9                   	leave
+  800ed1:	c3                   	ret
+
+00800ed2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ed2:	55                   	push   %ebp
+  800ed3:	89 e5                	mov    %esp,%ebp
+  800ed5:	57                   	push   %edi
+  800ed6:	56                   	push   %esi
+  800ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eda:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800edd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800ee0:	39 c6                	cmp    %eax,%esi
+  800ee2:	73 32                	jae    800f16 <memmove+0x44>
+  800ee4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ee7:	39 d0                	cmp    %edx,%eax
+  800ee9:	73 2b                	jae    800f16 <memmove+0x44>
+		s += n;
+		d += n;
+  800eeb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800eee:	89 d6                	mov    %edx,%esi
+  800ef0:	09 fe                	or     %edi,%esi
+  800ef2:	09 ce                	or     %ecx,%esi
+  800ef4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800efa:	75 0e                	jne    800f0a <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800efc:	83 ef 04             	sub    $0x4,%edi
+  800eff:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f02:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800f05:	fd                   	std
+  800f06:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f08:	eb 09                	jmp    800f13 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f0a:	83 ef 01             	sub    $0x1,%edi
+  800f0d:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800f10:	fd                   	std
+  800f11:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800f13:	fc                   	cld
+  800f14:	eb 1a                	jmp    800f30 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f16:	89 f2                	mov    %esi,%edx
+  800f18:	09 c2                	or     %eax,%edx
+  800f1a:	09 ca                	or     %ecx,%edx
+  800f1c:	f6 c2 03             	test   $0x3,%dl
+  800f1f:	75 0a                	jne    800f2b <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f21:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800f24:	89 c7                	mov    %eax,%edi
+  800f26:	fc                   	cld
+  800f27:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f29:	eb 05                	jmp    800f30 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800f2b:	89 c7                	mov    %eax,%edi
+  800f2d:	fc                   	cld
+  800f2e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+
+00800f34 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800f3a:	ff 75 10             	push   0x10(%ebp)
+  800f3d:	ff 75 0c             	push   0xc(%ebp)
+  800f40:	ff 75 08             	push   0x8(%ebp)
+  800f43:	e8 8a ff ff ff       	call   800ed2 <memmove>
+}
+  800f48:	c9                   	leave
+  800f49:	c3                   	ret
+
+00800f4a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	56                   	push   %esi
+  800f4e:	53                   	push   %ebx
+  800f4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f52:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800f55:	89 c6                	mov    %eax,%esi
+  800f57:	03 75 10             	add    0x10(%ebp),%esi
+  800f5a:	eb 06                	jmp    800f62 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800f5c:	83 c0 01             	add    $0x1,%eax
+  800f5f:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800f62:	39 f0                	cmp    %esi,%eax
+  800f64:	74 14                	je     800f7a <memcmp+0x30>
+		if (*s1 != *s2)
+  800f66:	0f b6 08             	movzbl (%eax),%ecx
+  800f69:	0f b6 1a             	movzbl (%edx),%ebx
+  800f6c:	38 d9                	cmp    %bl,%cl
+  800f6e:	74 ec                	je     800f5c <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800f70:	0f b6 c1             	movzbl %cl,%eax
+  800f73:	0f b6 db             	movzbl %bl,%ebx
+  800f76:	29 d8                	sub    %ebx,%eax
+  800f78:	eb 05                	jmp    800f7f <memcmp+0x35>
+	}
+
+	return 0;
+  800f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f7f:	5b                   	pop    %ebx
+  800f80:	5e                   	pop    %esi
+  800f81:	5d                   	pop    %ebp
+  800f82:	c3                   	ret
+
+00800f83 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800f8c:	89 c2                	mov    %eax,%edx
+  800f8e:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800f91:	eb 03                	jmp    800f96 <memfind+0x13>
+  800f93:	83 c0 01             	add    $0x1,%eax
+  800f96:	39 d0                	cmp    %edx,%eax
+  800f98:	73 04                	jae    800f9e <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800f9a:	38 08                	cmp    %cl,(%eax)
+  800f9c:	75 f5                	jne    800f93 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+
+00800fa0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+  800fa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800fac:	eb 03                	jmp    800fb1 <strtol+0x11>
+		s++;
+  800fae:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800fb1:	0f b6 02             	movzbl (%edx),%eax
+  800fb4:	3c 20                	cmp    $0x20,%al
+  800fb6:	74 f6                	je     800fae <strtol+0xe>
+  800fb8:	3c 09                	cmp    $0x9,%al
+  800fba:	74 f2                	je     800fae <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800fbc:	3c 2b                	cmp    $0x2b,%al
+  800fbe:	74 2a                	je     800fea <strtol+0x4a>
+	int neg = 0;
+  800fc0:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800fc5:	3c 2d                	cmp    $0x2d,%al
+  800fc7:	74 2b                	je     800ff4 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fc9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800fcf:	75 0f                	jne    800fe0 <strtol+0x40>
+  800fd1:	80 3a 30             	cmpb   $0x30,(%edx)
+  800fd4:	74 28                	je     800ffe <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800fd6:	85 db                	test   %ebx,%ebx
+  800fd8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fdd:	0f 44 d8             	cmove  %eax,%ebx
+  800fe0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800fe8:	eb 46                	jmp    801030 <strtol+0x90>
+		s++;
+  800fea:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800fed:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff2:	eb d5                	jmp    800fc9 <strtol+0x29>
+		s++, neg = 1;
+  800ff4:	83 c2 01             	add    $0x1,%edx
+  800ff7:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ffc:	eb cb                	jmp    800fc9 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ffe:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  801002:	74 0e                	je     801012 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  801004:	85 db                	test   %ebx,%ebx
+  801006:	75 d8                	jne    800fe0 <strtol+0x40>
+		s++, base = 8;
+  801008:	83 c2 01             	add    $0x1,%edx
+  80100b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801010:	eb ce                	jmp    800fe0 <strtol+0x40>
+		s += 2, base = 16;
+  801012:	83 c2 02             	add    $0x2,%edx
+  801015:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80101a:	eb c4                	jmp    800fe0 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  80101c:	0f be c0             	movsbl %al,%eax
+  80101f:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  801022:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801025:	7d 3a                	jge    801061 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  801027:	83 c2 01             	add    $0x1,%edx
+  80102a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80102e:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  801030:	0f b6 02             	movzbl (%edx),%eax
+  801033:	8d 70 d0             	lea    -0x30(%eax),%esi
+  801036:	89 f3                	mov    %esi,%ebx
+  801038:	80 fb 09             	cmp    $0x9,%bl
+  80103b:	76 df                	jbe    80101c <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  80103d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801040:	89 f3                	mov    %esi,%ebx
+  801042:	80 fb 19             	cmp    $0x19,%bl
+  801045:	77 08                	ja     80104f <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  801047:	0f be c0             	movsbl %al,%eax
+  80104a:	83 e8 57             	sub    $0x57,%eax
+  80104d:	eb d3                	jmp    801022 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  80104f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801052:	89 f3                	mov    %esi,%ebx
+  801054:	80 fb 19             	cmp    $0x19,%bl
+  801057:	77 08                	ja     801061 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801059:	0f be c0             	movsbl %al,%eax
+  80105c:	83 e8 37             	sub    $0x37,%eax
+  80105f:	eb c1                	jmp    801022 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801061:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  801065:	74 05                	je     80106c <strtol+0xcc>
+		*endptr = (char *) s;
+  801067:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80106a:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  80106c:	89 c8                	mov    %ecx,%eax
+  80106e:	f7 d8                	neg    %eax
+  801070:	85 ff                	test   %edi,%edi
+  801072:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801075:	89 c8                	mov    %ecx,%eax
+  801077:	5b                   	pop    %ebx
+  801078:	5e                   	pop    %esi
+  801079:	5f                   	pop    %edi
+  80107a:	5d                   	pop    %ebp
+  80107b:	c3                   	ret
+
+0080107c <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  80107c:	55                   	push   %ebp
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	57                   	push   %edi
+  801080:	56                   	push   %esi
+  801081:	53                   	push   %ebx
+  801082:	83 ec 0c             	sub    $0xc,%esp
+  801085:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801088:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80108b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  80108e:	85 ff                	test   %edi,%edi
+  801090:	74 16                	je     8010a8 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  801092:	83 ec 04             	sub    $0x4,%esp
+  801095:	56                   	push   %esi
+  801096:	6a 00                	push   $0x0
+  801098:	53                   	push   %ebx
+  801099:	e8 02 ff ff ff       	call   800fa0 <strtol>
+  80109e:	89 07                	mov    %eax,(%edi)
+  8010a0:	83 c4 10             	add    $0x10,%esp
+  8010a3:	eb 03                	jmp    8010a8 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  8010a5:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  8010a8:	0f b6 03             	movzbl (%ebx),%eax
+  8010ab:	3c 20                	cmp    $0x20,%al
+  8010ad:	74 f6                	je     8010a5 <strisl+0x29>
+  8010af:	3c 09                	cmp    $0x9,%al
+  8010b1:	74 f2                	je     8010a5 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  8010b3:	3c 2b                	cmp    $0x2b,%al
+  8010b5:	74 23                	je     8010da <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  8010b7:	3c 2d                	cmp    $0x2d,%al
+  8010b9:	0f 94 c0             	sete   %al
+  8010bc:	0f b6 c0             	movzbl %al,%eax
+  8010bf:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8010c1:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  8010c7:	75 41                	jne    80110a <strisl+0x8e>
+  8010c9:	80 3b 30             	cmpb   $0x30,(%ebx)
+  8010cc:	74 11                	je     8010df <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  8010ce:	85 f6                	test   %esi,%esi
+  8010d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010d5:	0f 44 f0             	cmove  %eax,%esi
+  8010d8:	eb 30                	jmp    80110a <strisl+0x8e>
+		s++;
+  8010da:	83 c3 01             	add    $0x1,%ebx
+  8010dd:	eb e2                	jmp    8010c1 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8010df:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  8010e3:	74 0e                	je     8010f3 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  8010e5:	85 f6                	test   %esi,%esi
+  8010e7:	75 21                	jne    80110a <strisl+0x8e>
+		s++, base = 8;
+  8010e9:	83 c3 01             	add    $0x1,%ebx
+  8010ec:	be 08 00 00 00       	mov    $0x8,%esi
+  8010f1:	eb 17                	jmp    80110a <strisl+0x8e>
+		s += 2, base = 16;
+  8010f3:	83 c3 02             	add    $0x2,%ebx
+  8010f6:	be 10 00 00 00       	mov    $0x10,%esi
+  8010fb:	eb 0d                	jmp    80110a <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8010fd:	0f be c0             	movsbl %al,%eax
+  801100:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  801103:	39 f0                	cmp    %esi,%eax
+  801105:	7d 38                	jge    80113f <strisl+0xc3>
+			return 0;
+		s++;
+  801107:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  80110a:	0f b6 03             	movzbl (%ebx),%eax
+  80110d:	8d 50 d0             	lea    -0x30(%eax),%edx
+  801110:	80 fa 09             	cmp    $0x9,%dl
+  801113:	76 e8                	jbe    8010fd <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  801115:	8d 50 9f             	lea    -0x61(%eax),%edx
+  801118:	80 fa 19             	cmp    $0x19,%dl
+  80111b:	77 08                	ja     801125 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  80111d:	0f be c0             	movsbl %al,%eax
+  801120:	83 e8 57             	sub    $0x57,%eax
+  801123:	eb de                	jmp    801103 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  801125:	8d 50 bf             	lea    -0x41(%eax),%edx
+  801128:	80 fa 19             	cmp    $0x19,%dl
+  80112b:	77 08                	ja     801135 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  80112d:	0f be c0             	movsbl %al,%eax
+  801130:	83 e8 37             	sub    $0x37,%eax
+  801133:	eb ce                	jmp    801103 <strisl+0x87>
+		else if (!*s)
+  801135:	84 c0                	test   %al,%al
+  801137:	0f 94 c0             	sete   %al
+  80113a:	0f b6 c0             	movzbl %al,%eax
+  80113d:	eb 05                	jmp    801144 <strisl+0xc8>
+			return 0;
+  80113f:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  801144:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+
+0080114c <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	83 ec 10             	sub    $0x10,%esp
+  801152:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  801155:	89 c8                	mov    %ecx,%eax
+  801157:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80115c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80115f:	eb 0b                	jmp    80116c <touch_mem+0x20>
+		c = *(char *)page;
+  801161:	0f b6 10             	movzbl (%eax),%edx
+  801164:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  801167:	05 00 10 00 00       	add    $0x1000,%eax
+  80116c:	39 c8                	cmp    %ecx,%eax
+  80116e:	72 f1                	jb     801161 <touch_mem+0x15>
+}
+  801170:	c9                   	leave
+  801171:	c3                   	ret
+
+00801172 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801172:	55                   	push   %ebp
+  801173:	89 e5                	mov    %esp,%ebp
+  801175:	57                   	push   %edi
+  801176:	56                   	push   %esi
+  801177:	53                   	push   %ebx
+	touch_mem(s, len);
+  801178:	ff 75 0c             	push   0xc(%ebp)
+  80117b:	ff 75 08             	push   0x8(%ebp)
+  80117e:	e8 c9 ff ff ff       	call   80114c <touch_mem>
+	asm volatile("int %1\n"
+  801183:	b8 00 00 00 00       	mov    $0x0,%eax
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118e:	89 c3                	mov    %eax,%ebx
+  801190:	89 c7                	mov    %eax,%edi
+  801192:	89 c6                	mov    %eax,%esi
+  801194:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801196:	83 c4 08             	add    $0x8,%esp
+  801199:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119c:	5b                   	pop    %ebx
+  80119d:	5e                   	pop    %esi
+  80119e:	5f                   	pop    %edi
+  80119f:	5d                   	pop    %ebp
+  8011a0:	c3                   	ret
+
+008011a1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8011a1:	55                   	push   %ebp
+  8011a2:	89 e5                	mov    %esp,%ebp
+  8011a4:	57                   	push   %edi
+  8011a5:	56                   	push   %esi
+  8011a6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011b1:	89 d1                	mov    %edx,%ecx
+  8011b3:	89 d3                	mov    %edx,%ebx
+  8011b5:	89 d7                	mov    %edx,%edi
+  8011b7:	89 d6                	mov    %edx,%esi
+  8011b9:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8011bb:	5b                   	pop    %ebx
+  8011bc:	5e                   	pop    %esi
+  8011bd:	5f                   	pop    %edi
+  8011be:	5d                   	pop    %ebp
+  8011bf:	c3                   	ret
+
+008011c0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8011c0:	55                   	push   %ebp
+  8011c1:	89 e5                	mov    %esp,%ebp
+  8011c3:	57                   	push   %edi
+  8011c4:	56                   	push   %esi
+  8011c5:	53                   	push   %ebx
+  8011c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8011d6:	89 cb                	mov    %ecx,%ebx
+  8011d8:	89 cf                	mov    %ecx,%edi
+  8011da:	89 ce                	mov    %ecx,%esi
+  8011dc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011de:	85 c0                	test   %eax,%eax
+  8011e0:	7f 08                	jg     8011ea <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8011e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e5:	5b                   	pop    %ebx
+  8011e6:	5e                   	pop    %esi
+  8011e7:	5f                   	pop    %edi
+  8011e8:	5d                   	pop    %ebp
+  8011e9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ea:	83 ec 0c             	sub    $0xc,%esp
+  8011ed:	50                   	push   %eax
+  8011ee:	6a 03                	push   $0x3
+  8011f0:	68 0b 5f 80 00       	push   $0x805f0b
+  8011f5:	6a 23                	push   $0x23
+  8011f7:	68 28 5f 80 00       	push   $0x805f28
+  8011fc:	e8 89 f4 ff ff       	call   80068a <_panic>
+
+00801201 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	57                   	push   %edi
+  801205:	56                   	push   %esi
+  801206:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801207:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801211:	89 d1                	mov    %edx,%ecx
+  801213:	89 d3                	mov    %edx,%ebx
+  801215:	89 d7                	mov    %edx,%edi
+  801217:	89 d6                	mov    %edx,%esi
+  801219:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80121b:	5b                   	pop    %ebx
+  80121c:	5e                   	pop    %esi
+  80121d:	5f                   	pop    %edi
+  80121e:	5d                   	pop    %ebp
+  80121f:	c3                   	ret
+
+00801220 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  801223:	57                   	push   %edi
+  801224:	56                   	push   %esi
+  801225:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801226:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801230:	89 d1                	mov    %edx,%ecx
+  801232:	89 d3                	mov    %edx,%ebx
+  801234:	89 d7                	mov    %edx,%edi
+  801236:	89 d6                	mov    %edx,%esi
+  801238:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80123a:	5b                   	pop    %ebx
+  80123b:	5e                   	pop    %esi
+  80123c:	5f                   	pop    %edi
+  80123d:	5d                   	pop    %ebp
+  80123e:	c3                   	ret
+
+0080123f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80123f:	55                   	push   %ebp
+  801240:	89 e5                	mov    %esp,%ebp
+  801242:	57                   	push   %edi
+  801243:	56                   	push   %esi
+  801244:	53                   	push   %ebx
+  801245:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801248:	be 00 00 00 00       	mov    $0x0,%esi
+  80124d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801250:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801253:	b8 04 00 00 00       	mov    $0x4,%eax
+  801258:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125b:	89 f7                	mov    %esi,%edi
+  80125d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80125f:	85 c0                	test   %eax,%eax
+  801261:	7f 08                	jg     80126b <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  801263:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801266:	5b                   	pop    %ebx
+  801267:	5e                   	pop    %esi
+  801268:	5f                   	pop    %edi
+  801269:	5d                   	pop    %ebp
+  80126a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80126b:	83 ec 0c             	sub    $0xc,%esp
+  80126e:	50                   	push   %eax
+  80126f:	6a 04                	push   $0x4
+  801271:	68 0b 5f 80 00       	push   $0x805f0b
+  801276:	6a 23                	push   $0x23
+  801278:	68 28 5f 80 00       	push   $0x805f28
+  80127d:	e8 08 f4 ff ff       	call   80068a <_panic>
+
+00801282 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	57                   	push   %edi
+  801286:	56                   	push   %esi
+  801287:	53                   	push   %ebx
+  801288:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80128b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801291:	b8 05 00 00 00       	mov    $0x5,%eax
+  801296:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801299:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80129c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80129f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012a1:	85 c0                	test   %eax,%eax
+  8012a3:	7f 08                	jg     8012ad <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  8012a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a8:	5b                   	pop    %ebx
+  8012a9:	5e                   	pop    %esi
+  8012aa:	5f                   	pop    %edi
+  8012ab:	5d                   	pop    %ebp
+  8012ac:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ad:	83 ec 0c             	sub    $0xc,%esp
+  8012b0:	50                   	push   %eax
+  8012b1:	6a 05                	push   $0x5
+  8012b3:	68 0b 5f 80 00       	push   $0x805f0b
+  8012b8:	6a 23                	push   $0x23
+  8012ba:	68 28 5f 80 00       	push   $0x805f28
+  8012bf:	e8 c6 f3 ff ff       	call   80068a <_panic>
+
+008012c4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8012c4:	55                   	push   %ebp
+  8012c5:	89 e5                	mov    %esp,%ebp
+  8012c7:	57                   	push   %edi
+  8012c8:	56                   	push   %esi
+  8012c9:	53                   	push   %ebx
+  8012ca:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d8:	b8 06 00 00 00       	mov    $0x6,%eax
+  8012dd:	89 df                	mov    %ebx,%edi
+  8012df:	89 de                	mov    %ebx,%esi
+  8012e1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e3:	85 c0                	test   %eax,%eax
+  8012e5:	7f 08                	jg     8012ef <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  8012e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012ef:	83 ec 0c             	sub    $0xc,%esp
+  8012f2:	50                   	push   %eax
+  8012f3:	6a 06                	push   $0x6
+  8012f5:	68 0b 5f 80 00       	push   $0x805f0b
+  8012fa:	6a 23                	push   $0x23
+  8012fc:	68 28 5f 80 00       	push   $0x805f28
+  801301:	e8 84 f3 ff ff       	call   80068a <_panic>
+
+00801306 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  801309:	57                   	push   %edi
+  80130a:	56                   	push   %esi
+  80130b:	53                   	push   %ebx
+  80130c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80130f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801314:	8b 55 08             	mov    0x8(%ebp),%edx
+  801317:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80131f:	89 df                	mov    %ebx,%edi
+  801321:	89 de                	mov    %ebx,%esi
+  801323:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801325:	85 c0                	test   %eax,%eax
+  801327:	7f 08                	jg     801331 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132c:	5b                   	pop    %ebx
+  80132d:	5e                   	pop    %esi
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801331:	83 ec 0c             	sub    $0xc,%esp
+  801334:	50                   	push   %eax
+  801335:	6a 18                	push   $0x18
+  801337:	68 0b 5f 80 00       	push   $0x805f0b
+  80133c:	6a 23                	push   $0x23
+  80133e:	68 28 5f 80 00       	push   $0x805f28
+  801343:	e8 42 f3 ff ff       	call   80068a <_panic>
+
+00801348 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	57                   	push   %edi
+  80134c:	56                   	push   %esi
+  80134d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80134e:	be 00 00 00 00       	mov    $0x0,%esi
+  801353:	8b 55 08             	mov    0x8(%ebp),%edx
+  801356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801359:	b8 19 00 00 00       	mov    $0x19,%eax
+  80135e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801361:	89 f7                	mov    %esi,%edi
+  801363:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  801365:	5b                   	pop    %ebx
+  801366:	5e                   	pop    %esi
+  801367:	5f                   	pop    %edi
+  801368:	5d                   	pop    %ebp
+  801369:	c3                   	ret
+
+0080136a <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80136a:	55                   	push   %ebp
+  80136b:	89 e5                	mov    %esp,%ebp
+  80136d:	57                   	push   %edi
+  80136e:	56                   	push   %esi
+  80136f:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801370:	8b 55 08             	mov    0x8(%ebp),%edx
+  801373:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801376:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80137b:	be 00 00 00 00       	mov    $0x0,%esi
+  801380:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801383:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801386:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801388:	5b                   	pop    %ebx
+  801389:	5e                   	pop    %esi
+  80138a:	5f                   	pop    %edi
+  80138b:	5d                   	pop    %ebp
+  80138c:	c3                   	ret
+
+0080138d <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  80138d:	55                   	push   %ebp
+  80138e:	89 e5                	mov    %esp,%ebp
+  801390:	57                   	push   %edi
+  801391:	56                   	push   %esi
+  801392:	53                   	push   %ebx
+  801393:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  801396:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801399:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80139f:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  8013a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a8:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013ad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b0:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013b3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013b5:	85 c0                	test   %eax,%eax
+  8013b7:	7f 08                	jg     8013c1 <sys_page_map_range+0x34>
+}
+  8013b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013bc:	5b                   	pop    %ebx
+  8013bd:	5e                   	pop    %esi
+  8013be:	5f                   	pop    %edi
+  8013bf:	5d                   	pop    %ebp
+  8013c0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013c1:	83 ec 0c             	sub    $0xc,%esp
+  8013c4:	50                   	push   %eax
+  8013c5:	6a 10                	push   $0x10
+  8013c7:	68 0b 5f 80 00       	push   $0x805f0b
+  8013cc:	6a 23                	push   $0x23
+  8013ce:	68 28 5f 80 00       	push   $0x805f28
+  8013d3:	e8 b2 f2 ff ff       	call   80068a <_panic>
+
+008013d8 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8013d8:	55                   	push   %ebp
+  8013d9:	89 e5                	mov    %esp,%ebp
+  8013db:	57                   	push   %edi
+  8013dc:	56                   	push   %esi
+  8013dd:	53                   	push   %ebx
+  8013de:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8013e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8013e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ec:	b8 11 00 00 00       	mov    $0x11,%eax
+  8013f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013f4:	89 f7                	mov    %esi,%edi
+  8013f6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013f8:	85 c0                	test   %eax,%eax
+  8013fa:	7f 08                	jg     801404 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8013fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ff:	5b                   	pop    %ebx
+  801400:	5e                   	pop    %esi
+  801401:	5f                   	pop    %edi
+  801402:	5d                   	pop    %ebp
+  801403:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801404:	83 ec 0c             	sub    $0xc,%esp
+  801407:	50                   	push   %eax
+  801408:	6a 11                	push   $0x11
+  80140a:	68 0b 5f 80 00       	push   $0x805f0b
+  80140f:	6a 23                	push   $0x23
+  801411:	68 28 5f 80 00       	push   $0x805f28
+  801416:	e8 6f f2 ff ff       	call   80068a <_panic>
+
+0080141b <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  80141b:	55                   	push   %ebp
+  80141c:	89 e5                	mov    %esp,%ebp
+  80141e:	57                   	push   %edi
+  80141f:	56                   	push   %esi
+  801420:	53                   	push   %ebx
+  801421:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801424:	be 00 00 00 00       	mov    $0x0,%esi
+  801429:	8b 55 08             	mov    0x8(%ebp),%edx
+  80142c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801434:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801437:	89 f7                	mov    %esi,%edi
+  801439:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80143b:	85 c0                	test   %eax,%eax
+  80143d:	7f 08                	jg     801447 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80143f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801442:	5b                   	pop    %ebx
+  801443:	5e                   	pop    %esi
+  801444:	5f                   	pop    %edi
+  801445:	5d                   	pop    %ebp
+  801446:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801447:	83 ec 0c             	sub    $0xc,%esp
+  80144a:	50                   	push   %eax
+  80144b:	6a 1b                	push   $0x1b
+  80144d:	68 0b 5f 80 00       	push   $0x805f0b
+  801452:	6a 23                	push   $0x23
+  801454:	68 28 5f 80 00       	push   $0x805f28
+  801459:	e8 2c f2 ff ff       	call   80068a <_panic>
+
+0080145e <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  80145e:	55                   	push   %ebp
+  80145f:	89 e5                	mov    %esp,%ebp
+  801461:	57                   	push   %edi
+  801462:	56                   	push   %esi
+  801463:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801464:	ba 00 00 00 00       	mov    $0x0,%edx
+  801469:	b8 12 00 00 00       	mov    $0x12,%eax
+  80146e:	89 d1                	mov    %edx,%ecx
+  801470:	89 d3                	mov    %edx,%ebx
+  801472:	89 d7                	mov    %edx,%edi
+  801474:	89 d6                	mov    %edx,%esi
+  801476:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801478:	5b                   	pop    %ebx
+  801479:	5e                   	pop    %esi
+  80147a:	5f                   	pop    %edi
+  80147b:	5d                   	pop    %ebp
+  80147c:	c3                   	ret
+
+0080147d <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80147d:	55                   	push   %ebp
+  80147e:	89 e5                	mov    %esp,%ebp
+  801480:	57                   	push   %edi
+  801481:	56                   	push   %esi
+  801482:	53                   	push   %ebx
+  801483:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801486:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80148b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80148e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801491:	b8 08 00 00 00       	mov    $0x8,%eax
+  801496:	89 df                	mov    %ebx,%edi
+  801498:	89 de                	mov    %ebx,%esi
+  80149a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80149c:	85 c0                	test   %eax,%eax
+  80149e:	7f 08                	jg     8014a8 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8014a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a3:	5b                   	pop    %ebx
+  8014a4:	5e                   	pop    %esi
+  8014a5:	5f                   	pop    %edi
+  8014a6:	5d                   	pop    %ebp
+  8014a7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014a8:	83 ec 0c             	sub    $0xc,%esp
+  8014ab:	50                   	push   %eax
+  8014ac:	6a 08                	push   $0x8
+  8014ae:	68 0b 5f 80 00       	push   $0x805f0b
+  8014b3:	6a 23                	push   $0x23
+  8014b5:	68 28 5f 80 00       	push   $0x805f28
+  8014ba:	e8 cb f1 ff ff       	call   80068a <_panic>
+
+008014bf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8014bf:	55                   	push   %ebp
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	57                   	push   %edi
+  8014c3:	56                   	push   %esi
+  8014c4:	53                   	push   %ebx
+  8014c5:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  8014c8:	6a 44                	push   $0x44
+  8014ca:	ff 75 0c             	push   0xc(%ebp)
+  8014cd:	e8 7a fc ff ff       	call   80114c <touch_mem>
+	asm volatile("int %1\n"
+  8014d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014da:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e2:	89 df                	mov    %ebx,%edi
+  8014e4:	89 de                	mov    %ebx,%esi
+  8014e6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014e8:	83 c4 08             	add    $0x8,%esp
+  8014eb:	85 c0                	test   %eax,%eax
+  8014ed:	7f 08                	jg     8014f7 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8014ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f2:	5b                   	pop    %ebx
+  8014f3:	5e                   	pop    %esi
+  8014f4:	5f                   	pop    %edi
+  8014f5:	5d                   	pop    %ebp
+  8014f6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+  8014fa:	50                   	push   %eax
+  8014fb:	6a 09                	push   $0x9
+  8014fd:	68 0b 5f 80 00       	push   $0x805f0b
+  801502:	6a 23                	push   $0x23
+  801504:	68 28 5f 80 00       	push   $0x805f28
+  801509:	e8 7c f1 ff ff       	call   80068a <_panic>
+
+0080150e <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80150e:	55                   	push   %ebp
+  80150f:	89 e5                	mov    %esp,%ebp
+  801511:	57                   	push   %edi
+  801512:	56                   	push   %esi
+  801513:	53                   	push   %ebx
+  801514:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801517:	be 00 00 00 00       	mov    $0x0,%esi
+  80151c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801522:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801527:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80152a:	89 f7                	mov    %esi,%edi
+  80152c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80152e:	85 c0                	test   %eax,%eax
+  801530:	7f 08                	jg     80153a <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801532:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801535:	5b                   	pop    %ebx
+  801536:	5e                   	pop    %esi
+  801537:	5f                   	pop    %edi
+  801538:	5d                   	pop    %ebp
+  801539:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80153a:	83 ec 0c             	sub    $0xc,%esp
+  80153d:	50                   	push   %eax
+  80153e:	6a 1a                	push   $0x1a
+  801540:	68 0b 5f 80 00       	push   $0x805f0b
+  801545:	6a 23                	push   $0x23
+  801547:	68 28 5f 80 00       	push   $0x805f28
+  80154c:	e8 39 f1 ff ff       	call   80068a <_panic>
+
+00801551 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801551:	55                   	push   %ebp
+  801552:	89 e5                	mov    %esp,%ebp
+  801554:	57                   	push   %edi
+  801555:	56                   	push   %esi
+  801556:	53                   	push   %ebx
+  801557:	83 ec 0c             	sub    $0xc,%esp
+  80155a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  80155d:	89 d8                	mov    %ebx,%eax
+  80155f:	c1 e0 05             	shl    $0x5,%eax
+  801562:	50                   	push   %eax
+  801563:	ff 75 0c             	push   0xc(%ebp)
+  801566:	e8 e1 fb ff ff       	call   80114c <touch_mem>
+	asm volatile("int %1\n"
+  80156b:	be 00 00 00 00       	mov    $0x0,%esi
+  801570:	8b 55 08             	mov    0x8(%ebp),%edx
+  801573:	b8 13 00 00 00       	mov    $0x13,%eax
+  801578:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80157b:	89 f7                	mov    %esi,%edi
+  80157d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80157f:	83 c4 08             	add    $0x8,%esp
+  801582:	85 c0                	test   %eax,%eax
+  801584:	7f 08                	jg     80158e <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801589:	5b                   	pop    %ebx
+  80158a:	5e                   	pop    %esi
+  80158b:	5f                   	pop    %edi
+  80158c:	5d                   	pop    %ebp
+  80158d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80158e:	83 ec 0c             	sub    $0xc,%esp
+  801591:	50                   	push   %eax
+  801592:	6a 13                	push   $0x13
+  801594:	68 0b 5f 80 00       	push   $0x805f0b
+  801599:	6a 23                	push   $0x23
+  80159b:	68 28 5f 80 00       	push   $0x805f28
+  8015a0:	e8 e5 f0 ff ff       	call   80068a <_panic>
+
+008015a5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8015a5:	55                   	push   %ebp
+  8015a6:	89 e5                	mov    %esp,%ebp
+  8015a8:	57                   	push   %edi
+  8015a9:	56                   	push   %esi
+  8015aa:	53                   	push   %ebx
+  8015ab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8015ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015be:	89 df                	mov    %ebx,%edi
+  8015c0:	89 de                	mov    %ebx,%esi
+  8015c2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015c4:	85 c0                	test   %eax,%eax
+  8015c6:	7f 08                	jg     8015d0 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8015c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015cb:	5b                   	pop    %ebx
+  8015cc:	5e                   	pop    %esi
+  8015cd:	5f                   	pop    %edi
+  8015ce:	5d                   	pop    %ebp
+  8015cf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015d0:	83 ec 0c             	sub    $0xc,%esp
+  8015d3:	50                   	push   %eax
+  8015d4:	6a 0a                	push   $0xa
+  8015d6:	68 0b 5f 80 00       	push   $0x805f0b
+  8015db:	6a 23                	push   $0x23
+  8015dd:	68 28 5f 80 00       	push   $0x805f28
+  8015e2:	e8 a3 f0 ff ff       	call   80068a <_panic>
+
+008015e7 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	57                   	push   %edi
+  8015eb:	56                   	push   %esi
+  8015ec:	53                   	push   %ebx
+  8015ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8015f0:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8015f6:	76 1d                	jbe    801615 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8015f8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015fe:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801603:	be 01 00 00 00       	mov    $0x1,%esi
+  801608:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80160b:	cd 30                	int    $0x30
+}
+  80160d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801610:	5b                   	pop    %ebx
+  801611:	5e                   	pop    %esi
+  801612:	5f                   	pop    %edi
+  801613:	5d                   	pop    %ebp
+  801614:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801615:	68 00 10 00 00       	push   $0x1000
+  80161a:	53                   	push   %ebx
+  80161b:	e8 2c fb ff ff       	call   80114c <touch_mem>
+  801620:	83 c4 08             	add    $0x8,%esp
+  801623:	eb d3                	jmp    8015f8 <sys_ipc_send+0x11>
+
+00801625 <sys_ipc_send_pages>:
+{
+  801625:	55                   	push   %ebp
+  801626:	89 e5                	mov    %esp,%ebp
+  801628:	57                   	push   %edi
+  801629:	56                   	push   %esi
+  80162a:	53                   	push   %ebx
+  80162b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80162e:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801631:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801637:	76 18                	jbe    801651 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801639:	8b 55 08             	mov    0x8(%ebp),%edx
+  80163c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80163f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801644:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801647:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164c:	5b                   	pop    %ebx
+  80164d:	5e                   	pop    %esi
+  80164e:	5f                   	pop    %edi
+  80164f:	5d                   	pop    %ebp
+  801650:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801651:	89 f0                	mov    %esi,%eax
+  801653:	c1 e0 0c             	shl    $0xc,%eax
+  801656:	50                   	push   %eax
+  801657:	53                   	push   %ebx
+  801658:	e8 ef fa ff ff       	call   80114c <touch_mem>
+  80165d:	83 c4 08             	add    $0x8,%esp
+  801660:	eb d7                	jmp    801639 <sys_ipc_send_pages+0x14>
+
+00801662 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801662:	55                   	push   %ebp
+  801663:	89 e5                	mov    %esp,%ebp
+  801665:	57                   	push   %edi
+  801666:	56                   	push   %esi
+  801667:	53                   	push   %ebx
+  801668:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80166b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801670:	8b 55 08             	mov    0x8(%ebp),%edx
+  801673:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801676:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80167b:	89 df                	mov    %ebx,%edi
+  80167d:	89 de                	mov    %ebx,%esi
+  80167f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801681:	85 c0                	test   %eax,%eax
+  801683:	7f 08                	jg     80168d <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801685:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801688:	5b                   	pop    %ebx
+  801689:	5e                   	pop    %esi
+  80168a:	5f                   	pop    %edi
+  80168b:	5d                   	pop    %ebp
+  80168c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80168d:	83 ec 0c             	sub    $0xc,%esp
+  801690:	50                   	push   %eax
+  801691:	6a 0d                	push   $0xd
+  801693:	68 0b 5f 80 00       	push   $0x805f0b
+  801698:	6a 23                	push   $0x23
+  80169a:	68 28 5f 80 00       	push   $0x805f28
+  80169f:	e8 e6 ef ff ff       	call   80068a <_panic>
+
+008016a4 <sys_ipc_recv>:
+{
+  8016a4:	55                   	push   %ebp
+  8016a5:	89 e5                	mov    %esp,%ebp
+  8016a7:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8016aa:	6a 01                	push   $0x1
+  8016ac:	ff 75 08             	push   0x8(%ebp)
+  8016af:	e8 ae ff ff ff       	call   801662 <sys_ipc_recv_pages>
+}
+  8016b4:	c9                   	leave
+  8016b5:	c3                   	ret
+
+008016b6 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8016b6:	55                   	push   %ebp
+  8016b7:	89 e5                	mov    %esp,%ebp
+  8016b9:	57                   	push   %edi
+  8016ba:	56                   	push   %esi
+  8016bb:	53                   	push   %ebx
+  8016bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016bf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016c2:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8016c5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8016cb:	77 04                	ja     8016d1 <sys_ipc_call+0x1b>
+  8016cd:	85 f6                	test   %esi,%esi
+  8016cf:	75 15                	jne    8016e6 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8016d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016d7:	b8 14 00 00 00       	mov    $0x14,%eax
+  8016dc:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8016de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e1:	5b                   	pop    %ebx
+  8016e2:	5e                   	pop    %esi
+  8016e3:	5f                   	pop    %edi
+  8016e4:	5d                   	pop    %ebp
+  8016e5:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8016e6:	89 f8                	mov    %edi,%eax
+  8016e8:	c1 e0 0c             	shl    $0xc,%eax
+  8016eb:	50                   	push   %eax
+  8016ec:	53                   	push   %ebx
+  8016ed:	e8 5a fa ff ff       	call   80114c <touch_mem>
+  8016f2:	83 c4 08             	add    $0x8,%esp
+  8016f5:	eb da                	jmp    8016d1 <sys_ipc_call+0x1b>
+
+008016f7 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8016f7:	55                   	push   %ebp
+  8016f8:	89 e5                	mov    %esp,%ebp
+  8016fa:	57                   	push   %edi
+  8016fb:	56                   	push   %esi
+  8016fc:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8016fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801700:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801703:	b8 15 00 00 00       	mov    $0x15,%eax
+  801708:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80170b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80170e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801711:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801713:	5b                   	pop    %ebx
+  801714:	5e                   	pop    %esi
+  801715:	5f                   	pop    %edi
+  801716:	5d                   	pop    %ebp
+  801717:	c3                   	ret
+
+00801718 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801718:	55                   	push   %ebp
+  801719:	89 e5                	mov    %esp,%ebp
+  80171b:	57                   	push   %edi
+  80171c:	56                   	push   %esi
+  80171d:	53                   	push   %ebx
+  80171e:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801721:	6a 04                	push   $0x4
+  801723:	ff 75 08             	push   0x8(%ebp)
+  801726:	e8 21 fa ff ff       	call   80114c <touch_mem>
+	asm volatile("int %1\n"
+  80172b:	be 00 00 00 00       	mov    $0x0,%esi
+  801730:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801733:	b8 16 00 00 00       	mov    $0x16,%eax
+  801738:	8b 55 08             	mov    0x8(%ebp),%edx
+  80173b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80173e:	89 f7                	mov    %esi,%edi
+  801740:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801742:	83 c4 08             	add    $0x8,%esp
+  801745:	85 c0                	test   %eax,%eax
+  801747:	7f 08                	jg     801751 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174c:	5b                   	pop    %ebx
+  80174d:	5e                   	pop    %esi
+  80174e:	5f                   	pop    %edi
+  80174f:	5d                   	pop    %ebp
+  801750:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801751:	83 ec 0c             	sub    $0xc,%esp
+  801754:	50                   	push   %eax
+  801755:	6a 16                	push   $0x16
+  801757:	68 0b 5f 80 00       	push   $0x805f0b
+  80175c:	6a 23                	push   $0x23
+  80175e:	68 28 5f 80 00       	push   $0x805f28
+  801763:	e8 22 ef ff ff       	call   80068a <_panic>
+
+00801768 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801768:	55                   	push   %ebp
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	57                   	push   %edi
+  80176c:	56                   	push   %esi
+  80176d:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80176e:	6a 04                	push   $0x4
+  801770:	ff 75 08             	push   0x8(%ebp)
+  801773:	e8 d4 f9 ff ff       	call   80114c <touch_mem>
+	asm volatile("int %1\n"
+  801778:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80177d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801780:	b8 17 00 00 00       	mov    $0x17,%eax
+  801785:	8b 55 08             	mov    0x8(%ebp),%edx
+  801788:	89 df                	mov    %ebx,%edi
+  80178a:	89 de                	mov    %ebx,%esi
+  80178c:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  80178e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801791:	5b                   	pop    %ebx
+  801792:	5e                   	pop    %esi
+  801793:	5f                   	pop    %edi
+  801794:	5d                   	pop    %ebp
+  801795:	c3                   	ret
+
+00801796 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801796:	55                   	push   %ebp
+  801797:	89 e5                	mov    %esp,%ebp
+  801799:	57                   	push   %edi
+  80179a:	56                   	push   %esi
+  80179b:	53                   	push   %ebx
+  80179c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80179f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017a7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8017ac:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017b1:	89 df                	mov    %ebx,%edi
+  8017b3:	89 de                	mov    %ebx,%esi
+  8017b5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8017b7:	85 c0                	test   %eax,%eax
+  8017b9:	7f 08                	jg     8017c3 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8017bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017be:	5b                   	pop    %ebx
+  8017bf:	5e                   	pop    %esi
+  8017c0:	5f                   	pop    %edi
+  8017c1:	5d                   	pop    %ebp
+  8017c2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8017c3:	83 ec 0c             	sub    $0xc,%esp
+  8017c6:	50                   	push   %eax
+  8017c7:	6a 0e                	push   $0xe
+  8017c9:	68 0b 5f 80 00       	push   $0x805f0b
+  8017ce:	6a 23                	push   $0x23
+  8017d0:	68 28 5f 80 00       	push   $0x805f28
+  8017d5:	e8 b0 ee ff ff       	call   80068a <_panic>
+
+008017da <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  8017da:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017e1:	f6 c6 06             	test   $0x6,%dh
+  8017e4:	75 37                	jne    80181d <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8017e6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017ed:	f6 c2 02             	test   $0x2,%dl
+  8017f0:	75 19                	jne    80180b <dupperm+0x31>
+  8017f2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017f9:	f6 c6 08             	test   $0x8,%dh
+  8017fc:	75 0d                	jne    80180b <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8017fe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801805:	25 07 0e 00 00       	and    $0xe07,%eax
+  80180a:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  80180b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801812:	25 00 06 00 00       	and    $0x600,%eax
+  801817:	0d 05 08 00 00       	or     $0x805,%eax
+  80181c:	c3                   	ret
+		return 0;
+  80181d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801822:	c3                   	ret
+
+00801823 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  801823:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  801825:	c1 e0 0c             	shl    $0xc,%eax
+  801828:	c1 e8 16             	shr    $0x16,%eax
+  80182b:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801832:	f6 c1 01             	test   $0x1,%cl
+  801835:	74 2c                	je     801863 <dupable+0x40>
+  801837:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80183e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801843:	f6 c1 04             	test   $0x4,%cl
+  801846:	74 20                	je     801868 <dupable+0x45>
+  801848:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80184f:	f6 c1 01             	test   $0x1,%cl
+  801852:	74 14                	je     801868 <dupable+0x45>
+  801854:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  80185b:	c1 e8 02             	shr    $0x2,%eax
+  80185e:	83 e0 01             	and    $0x1,%eax
+  801861:	eb 05                	jmp    801868 <dupable+0x45>
+  801863:	b8 00 00 00 00       	mov    $0x0,%eax
+  801868:	83 e0 01             	and    $0x1,%eax
+}
+  80186b:	c3                   	ret
+
+0080186c <pgfault>:
+{
+  80186c:	55                   	push   %ebp
+  80186d:	89 e5                	mov    %esp,%ebp
+  80186f:	56                   	push   %esi
+  801870:	53                   	push   %ebx
+  801871:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  801874:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801876:	89 ca                	mov    %ecx,%edx
+  801878:	c1 ea 0c             	shr    $0xc,%edx
+  80187b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801882:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801886:	0f 84 8e 00 00 00    	je     80191a <pgfault+0xae>
+		return 0;
+  80188c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801891:	f6 c6 08             	test   $0x8,%dh
+  801894:	0f 84 85 00 00 00    	je     80191f <pgfault+0xb3>
+	perm |= PTE_W;
+  80189a:	81 e2 07 06 00 00    	and    $0x607,%edx
+  8018a0:	89 d3                	mov    %edx,%ebx
+  8018a2:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8018a5:	89 ce                	mov    %ecx,%esi
+  8018a7:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  8018ad:	6a 01                	push   $0x1
+  8018af:	53                   	push   %ebx
+  8018b0:	68 00 f0 7f 00       	push   $0x7ff000
+  8018b5:	6a 00                	push   $0x0
+  8018b7:	e8 e3 27 00 00       	call   80409f <page_alloc>
+  8018bc:	83 c4 10             	add    $0x10,%esp
+  8018bf:	85 c0                	test   %eax,%eax
+  8018c1:	78 33                	js     8018f6 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  8018c3:	83 ec 04             	sub    $0x4,%esp
+  8018c6:	68 00 10 00 00       	push   $0x1000
+  8018cb:	56                   	push   %esi
+  8018cc:	68 00 f0 7f 00       	push   $0x7ff000
+  8018d1:	e8 fc f5 ff ff       	call   800ed2 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  8018d6:	89 1c 24             	mov    %ebx,(%esp)
+  8018d9:	56                   	push   %esi
+  8018da:	6a 00                	push   $0x0
+  8018dc:	68 00 f0 7f 00       	push   $0x7ff000
+  8018e1:	6a 00                	push   $0x0
+  8018e3:	e8 18 2e 00 00       	call   804700 <page_map>
+  8018e8:	83 c4 20             	add    $0x20,%esp
+  8018eb:	85 c0                	test   %eax,%eax
+  8018ed:	78 19                	js     801908 <pgfault+0x9c>
+	return 1;
+  8018ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018f4:	eb 29                	jmp    80191f <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8018f6:	50                   	push   %eax
+  8018f7:	68 38 5f 80 00       	push   $0x805f38
+  8018fc:	6a 2e                	push   $0x2e
+  8018fe:	68 8b 5f 80 00       	push   $0x805f8b
+  801903:	e8 82 ed ff ff       	call   80068a <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  801908:	50                   	push   %eax
+  801909:	68 64 5f 80 00       	push   $0x805f64
+  80190e:	6a 32                	push   $0x32
+  801910:	68 8b 5f 80 00       	push   $0x805f8b
+  801915:	e8 70 ed ff ff       	call   80068a <_panic>
+		return 0;
+  80191a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80191f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801922:	5b                   	pop    %ebx
+  801923:	5e                   	pop    %esi
+  801924:	5d                   	pop    %ebp
+  801925:	c3                   	ret
+
+00801926 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  801926:	55                   	push   %ebp
+  801927:	89 e5                	mov    %esp,%ebp
+  801929:	57                   	push   %edi
+  80192a:	56                   	push   %esi
+  80192b:	53                   	push   %ebx
+  80192c:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  80192f:	83 3d 20 19 81 00 00 	cmpl   $0x0,0x811920
+  801936:	74 5d                	je     801995 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  801938:	83 ec 0c             	sub    $0xc,%esp
+  80193b:	68 6c 18 80 00       	push   $0x80186c
+  801940:	e8 1c 3a 00 00       	call   805361 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  801945:	e8 14 fb ff ff       	call   80145e <sys_fork>
+  80194a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80194d:	83 c4 10             	add    $0x10,%esp
+  801950:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  801953:	74 47                	je     80199c <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801955:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801959:	0f 84 c5 03 00 00    	je     801d24 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  80195f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801963:	78 25                	js     80198a <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801965:	e8 ad 20 00 00       	call   803a17 <page_share_paged_out>
+  80196a:	85 c0                	test   %eax,%eax
+  80196c:	0f 88 d8 03 00 00    	js     801d4a <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801972:	83 ec 08             	sub    $0x8,%esp
+  801975:	6a 02                	push   $0x2
+  801977:	ff 75 e4             	push   -0x1c(%ebp)
+  80197a:	e8 fe fa ff ff       	call   80147d <sys_env_set_status>
+  80197f:	83 c4 10             	add    $0x10,%esp
+  801982:	85 c0                	test   %eax,%eax
+  801984:	0f 88 d5 03 00 00    	js     801d5f <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  80198a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80198d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801990:	5b                   	pop    %ebx
+  801991:	5e                   	pop    %esi
+  801992:	5f                   	pop    %edi
+  801993:	5d                   	pop    %ebp
+  801994:	c3                   	ret
+		init_map_dir();
+  801995:	e8 85 23 00 00       	call   803d1f <init_map_dir>
+  80199a:	eb 9c                	jmp    801938 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  80199c:	b8 07 00 00 00       	mov    $0x7,%eax
+  8019a1:	cd 30                	int    $0x30
+  8019a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  8019a6:	85 c0                	test   %eax,%eax
+  8019a8:	78 10                	js     8019ba <fork+0x94>
+	if (envid == 0)
+  8019aa:	0f 84 74 03 00 00    	je     801d24 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8019b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8019b8:	eb 30                	jmp    8019ea <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  8019ba:	50                   	push   %eax
+  8019bb:	68 96 5f 80 00       	push   $0x805f96
+  8019c0:	68 cd 00 00 00       	push   $0xcd
+  8019c5:	68 8b 5f 80 00       	push   $0x805f8b
+  8019ca:	e8 bb ec ff ff       	call   80068a <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  8019cf:	89 f2                	mov    %esi,%edx
+  8019d1:	c1 fa 1f             	sar    $0x1f,%edx
+  8019d4:	c1 ea 16             	shr    $0x16,%edx
+  8019d7:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8019da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019df:	29 d0                	sub    %edx,%eax
+  8019e1:	ba 00 04 00 00       	mov    $0x400,%edx
+  8019e6:	29 c2                	sub    %eax,%edx
+  8019e8:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8019ea:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8019ed:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  8019f3:	0f 87 ff 02 00 00    	ja     801cf8 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  8019f9:	89 f3                	mov    %esi,%ebx
+  8019fb:	c1 e3 0c             	shl    $0xc,%ebx
+  8019fe:	89 d8                	mov    %ebx,%eax
+  801a00:	c1 e8 16             	shr    $0x16,%eax
+  801a03:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801a0a:	f6 c2 01             	test   $0x1,%dl
+  801a0d:	74 c0                	je     8019cf <fork+0xa9>
+  801a0f:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801a16:	f6 c2 04             	test   $0x4,%dl
+  801a19:	74 b4                	je     8019cf <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  801a1b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a22:	a8 80                	test   $0x80,%al
+  801a24:	75 24                	jne    801a4a <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  801a26:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801a2d:	25 81 00 00 00       	and    $0x81,%eax
+  801a32:	3d 80 00 00 00       	cmp    $0x80,%eax
+  801a37:	74 21                	je     801a5a <fork+0x134>
+		if (!dupable(pn)) {
+  801a39:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a3c:	e8 e2 fd ff ff       	call   801823 <dupable>
+  801a41:	84 c0                	test   %al,%al
+  801a43:	75 1a                	jne    801a5f <fork+0x139>
+			++pn;
+  801a45:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801a48:	eb a0                	jmp    8019ea <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  801a4a:	83 ec 08             	sub    $0x8,%esp
+  801a4d:	53                   	push   %ebx
+  801a4e:	6a 00                	push   $0x0
+  801a50:	e8 b1 f8 ff ff       	call   801306 <sys_page_split>
+  801a55:	83 c4 10             	add    $0x10,%esp
+  801a58:	eb cc                	jmp    801a26 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  801a5a:	0f b6 03             	movzbl (%ebx),%eax
+  801a5d:	eb da                	jmp    801a39 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  801a5f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801a62:	89 f8                	mov    %edi,%eax
+  801a64:	e8 71 fd ff ff       	call   8017da <dupperm>
+  801a69:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801a6c:	85 c0                	test   %eax,%eax
+  801a6e:	74 16                	je     801a86 <fork+0x160>
+  801a70:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801a75:	29 f8                	sub    %edi,%eax
+  801a77:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801a7a:	bf 01 00 00 00       	mov    $0x1,%edi
+  801a7f:	89 c6                	mov    %eax,%esi
+  801a81:	e9 c4 01 00 00       	jmp    801c4a <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801a86:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a89:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a90:	f6 c4 04             	test   $0x4,%ah
+  801a93:	0f 85 89 00 00 00    	jne    801b22 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  801a99:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a9c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aa3:	f6 c4 02             	test   $0x2,%ah
+  801aa6:	0f 85 b1 00 00 00    	jne    801b5d <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801aac:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801aaf:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801ab6:	a8 02                	test   $0x2,%al
+  801ab8:	75 10                	jne    801aca <fork+0x1a4>
+  801aba:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801ac1:	f6 c4 08             	test   $0x8,%ah
+  801ac4:	0f 84 3e 01 00 00    	je     801c08 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801aca:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801acd:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801ad4:	25 00 06 00 00       	and    $0x600,%eax
+  801ad9:	0d 05 08 00 00       	or     $0x805,%eax
+  801ade:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  801ae0:	c1 e1 0c             	shl    $0xc,%ecx
+  801ae3:	89 cb                	mov    %ecx,%ebx
+  801ae5:	83 ec 0c             	sub    $0xc,%esp
+  801ae8:	50                   	push   %eax
+  801ae9:	51                   	push   %ecx
+  801aea:	ff 75 e4             	push   -0x1c(%ebp)
+  801aed:	51                   	push   %ecx
+  801aee:	6a 00                	push   $0x0
+  801af0:	e8 0b 2c 00 00       	call   804700 <page_map>
+  801af5:	83 c4 20             	add    $0x20,%esp
+  801af8:	85 c0                	test   %eax,%eax
+  801afa:	0f 88 e4 00 00 00    	js     801be4 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  801b00:	83 ec 0c             	sub    $0xc,%esp
+  801b03:	57                   	push   %edi
+  801b04:	53                   	push   %ebx
+  801b05:	6a 00                	push   $0x0
+  801b07:	53                   	push   %ebx
+  801b08:	6a 00                	push   $0x0
+  801b0a:	e8 f1 2b 00 00       	call   804700 <page_map>
+  801b0f:	83 c4 20             	add    $0x20,%esp
+  801b12:	85 c0                	test   %eax,%eax
+  801b14:	0f 88 dc 00 00 00    	js     801bf6 <fork+0x2d0>
+			++pn;
+  801b1a:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801b1d:	e9 c8 fe ff ff       	jmp    8019ea <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801b22:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801b25:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801b2c:	c1 e1 0c             	shl    $0xc,%ecx
+  801b2f:	83 ec 0c             	sub    $0xc,%esp
+  801b32:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b37:	50                   	push   %eax
+  801b38:	51                   	push   %ecx
+  801b39:	ff 75 e4             	push   -0x1c(%ebp)
+  801b3c:	51                   	push   %ecx
+  801b3d:	6a 00                	push   $0x0
+  801b3f:	e8 bc 2b 00 00       	call   804700 <page_map>
+  801b44:	83 c4 20             	add    $0x20,%esp
+  801b47:	85 c0                	test   %eax,%eax
+  801b49:	79 cf                	jns    801b1a <fork+0x1f4>
+			panic("page_map %d", r);
+  801b4b:	50                   	push   %eax
+  801b4c:	68 a6 5f 80 00       	push   $0x805fa6
+  801b51:	6a 4d                	push   $0x4d
+  801b53:	68 8b 5f 80 00       	push   $0x805f8b
+  801b58:	e8 2d eb ff ff       	call   80068a <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  801b5d:	83 ec 0c             	sub    $0xc,%esp
+  801b60:	68 00 10 00 00       	push   $0x1000
+  801b65:	e8 88 31 00 00       	call   804cf2 <malloc>
+  801b6a:	89 c7                	mov    %eax,%edi
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	74 4b                	je     801bbe <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  801b73:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801b76:	c1 e3 0c             	shl    $0xc,%ebx
+  801b79:	83 ec 04             	sub    $0x4,%esp
+  801b7c:	68 00 10 00 00       	push   $0x1000
+  801b81:	53                   	push   %ebx
+  801b82:	50                   	push   %eax
+  801b83:	e8 ac f3 ff ff       	call   800f34 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  801b88:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b8b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b92:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b97:	89 04 24             	mov    %eax,(%esp)
+  801b9a:	53                   	push   %ebx
+  801b9b:	ff 75 e4             	push   -0x1c(%ebp)
+  801b9e:	57                   	push   %edi
+  801b9f:	6a 00                	push   $0x0
+  801ba1:	e8 5a 2b 00 00       	call   804700 <page_map>
+  801ba6:	83 c4 20             	add    $0x20,%esp
+  801ba9:	85 c0                	test   %eax,%eax
+  801bab:	78 25                	js     801bd2 <fork+0x2ac>
+		free(temp);
+  801bad:	83 ec 0c             	sub    $0xc,%esp
+  801bb0:	57                   	push   %edi
+  801bb1:	e8 3a 2f 00 00       	call   804af0 <free>
+  801bb6:	83 c4 10             	add    $0x10,%esp
+  801bb9:	e9 5c ff ff ff       	jmp    801b1a <fork+0x1f4>
+			panic("malloc failed");
+  801bbe:	83 ec 04             	sub    $0x4,%esp
+  801bc1:	68 b2 5f 80 00       	push   $0x805fb2
+  801bc6:	6a 56                	push   $0x56
+  801bc8:	68 8b 5f 80 00       	push   $0x805f8b
+  801bcd:	e8 b8 ea ff ff       	call   80068a <_panic>
+			panic("page_map: %e", r);
+  801bd2:	50                   	push   %eax
+  801bd3:	68 c0 5f 80 00       	push   $0x805fc0
+  801bd8:	6a 59                	push   $0x59
+  801bda:	68 8b 5f 80 00       	push   $0x805f8b
+  801bdf:	e8 a6 ea ff ff       	call   80068a <_panic>
+			panic("page_map %d", r);
+  801be4:	50                   	push   %eax
+  801be5:	68 a6 5f 80 00       	push   $0x805fa6
+  801bea:	6a 65                	push   $0x65
+  801bec:	68 8b 5f 80 00       	push   $0x805f8b
+  801bf1:	e8 94 ea ff ff       	call   80068a <_panic>
+			panic("page_map %d", r);
+  801bf6:	50                   	push   %eax
+  801bf7:	68 a6 5f 80 00       	push   $0x805fa6
+  801bfc:	6a 78                	push   $0x78
+  801bfe:	68 8b 5f 80 00       	push   $0x805f8b
+  801c03:	e8 82 ea ff ff       	call   80068a <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801c08:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801c0b:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801c12:	c1 e1 0c             	shl    $0xc,%ecx
+  801c15:	83 ec 0c             	sub    $0xc,%esp
+  801c18:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c1d:	50                   	push   %eax
+  801c1e:	51                   	push   %ecx
+  801c1f:	ff 75 e4             	push   -0x1c(%ebp)
+  801c22:	51                   	push   %ecx
+  801c23:	6a 00                	push   $0x0
+  801c25:	e8 d6 2a 00 00       	call   804700 <page_map>
+  801c2a:	83 c4 20             	add    $0x20,%esp
+  801c2d:	85 c0                	test   %eax,%eax
+  801c2f:	0f 89 e5 fe ff ff    	jns    801b1a <fork+0x1f4>
+			panic("page_map %d", r);
+  801c35:	50                   	push   %eax
+  801c36:	68 a6 5f 80 00       	push   $0x805fa6
+  801c3b:	6a 7f                	push   $0x7f
+  801c3d:	68 8b 5f 80 00       	push   $0x805f8b
+  801c42:	e8 43 ea ff ff       	call   80068a <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801c47:	83 c7 01             	add    $0x1,%edi
+  801c4a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c4d:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801c50:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  801c53:	39 f7                	cmp    %esi,%edi
+  801c55:	74 1c                	je     801c73 <fork+0x34d>
+  801c57:	89 d8                	mov    %ebx,%eax
+  801c59:	e8 c5 fb ff ff       	call   801823 <dupable>
+  801c5e:	84 c0                	test   %al,%al
+  801c60:	74 7c                	je     801cde <fork+0x3b8>
+  801c62:	89 d8                	mov    %ebx,%eax
+  801c64:	e8 71 fb ff ff       	call   8017da <dupperm>
+  801c69:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801c6c:	74 d9                	je     801c47 <fork+0x321>
+  801c6e:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801c71:	eb 06                	jmp    801c79 <fork+0x353>
+  801c73:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801c76:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801c79:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c7c:	c1 e0 0c             	shl    $0xc,%eax
+  801c7f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801c82:	83 ec 08             	sub    $0x8,%esp
+  801c85:	ff 75 dc             	push   -0x24(%ebp)
+  801c88:	57                   	push   %edi
+  801c89:	50                   	push   %eax
+  801c8a:	ff 75 e4             	push   -0x1c(%ebp)
+  801c8d:	50                   	push   %eax
+  801c8e:	6a 00                	push   $0x0
+  801c90:	e8 62 2c 00 00       	call   8048f7 <page_map_range>
+  801c95:	83 c4 20             	add    $0x20,%esp
+  801c98:	85 c0                	test   %eax,%eax
+  801c9a:	78 47                	js     801ce3 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801c9c:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801ca3:	0f 84 41 fd ff ff    	je     8019ea <fork+0xc4>
+  801ca9:	83 ec 08             	sub    $0x8,%esp
+  801cac:	ff 75 dc             	push   -0x24(%ebp)
+  801caf:	57                   	push   %edi
+  801cb0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801cb3:	50                   	push   %eax
+  801cb4:	6a 00                	push   $0x0
+  801cb6:	50                   	push   %eax
+  801cb7:	6a 00                	push   $0x0
+  801cb9:	e8 39 2c 00 00       	call   8048f7 <page_map_range>
+  801cbe:	83 c4 20             	add    $0x20,%esp
+  801cc1:	85 c0                	test   %eax,%eax
+  801cc3:	0f 89 21 fd ff ff    	jns    8019ea <fork+0xc4>
+		panic("page_map_range %e", r);
+  801cc9:	50                   	push   %eax
+  801cca:	68 cd 5f 80 00       	push   $0x805fcd
+  801ccf:	68 a2 00 00 00       	push   $0xa2
+  801cd4:	68 8b 5f 80 00       	push   $0x805f8b
+  801cd9:	e8 ac e9 ff ff       	call   80068a <_panic>
+  801cde:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801ce1:	eb 96                	jmp    801c79 <fork+0x353>
+		panic("page_map_range %e", r);
+  801ce3:	50                   	push   %eax
+  801ce4:	68 cd 5f 80 00       	push   $0x805fcd
+  801ce9:	68 a0 00 00 00       	push   $0xa0
+  801cee:	68 8b 5f 80 00       	push   $0x805f8b
+  801cf3:	e8 92 e9 ff ff       	call   80068a <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  801cf8:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801cfb:	6a 01                	push   $0x1
+  801cfd:	6a 07                	push   $0x7
+  801cff:	68 00 f0 bf ee       	push   $0xeebff000
+  801d04:	53                   	push   %ebx
+  801d05:	e8 95 23 00 00       	call   80409f <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801d0a:	a1 24 19 81 00       	mov    0x811924,%eax
+  801d0f:	8b 40 74             	mov    0x74(%eax),%eax
+  801d12:	83 c4 08             	add    $0x8,%esp
+  801d15:	50                   	push   %eax
+  801d16:	53                   	push   %ebx
+  801d17:	e8 89 f8 ff ff       	call   8015a5 <sys_env_set_pgfault_upcall>
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	e9 41 fc ff ff       	jmp    801965 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801d24:	e8 d8 f4 ff ff       	call   801201 <sys_getenvid>
+  801d29:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d2e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801d31:	c1 e0 06             	shl    $0x6,%eax
+  801d34:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d39:	a3 24 19 81 00       	mov    %eax,0x811924
+		return 0;
+  801d3e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801d45:	e9 40 fc ff ff       	jmp    80198a <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  801d4a:	50                   	push   %eax
+  801d4b:	68 df 5f 80 00       	push   $0x805fdf
+  801d50:	68 27 01 00 00       	push   $0x127
+  801d55:	68 8b 5f 80 00       	push   $0x805f8b
+  801d5a:	e8 2b e9 ff ff       	call   80068a <_panic>
+		panic("sys_env_set_status: %d", r);
+  801d5f:	50                   	push   %eax
+  801d60:	68 f8 5f 80 00       	push   $0x805ff8
+  801d65:	68 2b 01 00 00       	push   $0x12b
+  801d6a:	68 8b 5f 80 00       	push   $0x805f8b
+  801d6f:	e8 16 e9 ff ff       	call   80068a <_panic>
+
+00801d74 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801d74:	55                   	push   %ebp
+  801d75:	89 e5                	mov    %esp,%ebp
+  801d77:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801d7a:	68 0f 60 80 00       	push   $0x80600f
+  801d7f:	68 35 01 00 00       	push   $0x135
+  801d84:	68 8b 5f 80 00       	push   $0x805f8b
+  801d89:	e8 fc e8 ff ff       	call   80068a <_panic>
+
+00801d8e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801d8e:	55                   	push   %ebp
+  801d8f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d91:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d94:	05 00 00 00 30       	add    $0x30000000,%eax
+  801d99:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801d9c:	5d                   	pop    %ebp
+  801d9d:	c3                   	ret
+
+00801d9e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801d9e:	55                   	push   %ebp
+  801d9f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801da1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da4:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801da9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801dae:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801db3:	5d                   	pop    %ebp
+  801db4:	c3                   	ret
+
+00801db5 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801db5:	55                   	push   %ebp
+  801db6:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801db8:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801dbd:	a8 01                	test   $0x1,%al
+  801dbf:	74 3c                	je     801dfd <fd_alloc+0x48>
+  801dc1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801dc6:	89 c2                	mov    %eax,%edx
+  801dc8:	c1 ea 0c             	shr    $0xc,%edx
+  801dcb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801dd2:	89 c1                	mov    %eax,%ecx
+  801dd4:	05 00 10 00 00       	add    $0x1000,%eax
+  801dd9:	f6 c2 01             	test   $0x1,%dl
+  801ddc:	74 13                	je     801df1 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801dde:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801de3:	75 e1                	jne    801dc6 <fd_alloc+0x11>
+  801de5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801dea:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801def:	eb 05                	jmp    801df6 <fd_alloc+0x41>
+			return 0;
+  801df1:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801df6:	8b 55 08             	mov    0x8(%ebp),%edx
+  801df9:	89 0a                	mov    %ecx,(%edx)
+}
+  801dfb:	5d                   	pop    %ebp
+  801dfc:	c3                   	ret
+  801dfd:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e07:	eb ed                	jmp    801df6 <fd_alloc+0x41>
+
+00801e09 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801e09:	55                   	push   %ebp
+  801e0a:	89 e5                	mov    %esp,%ebp
+  801e0c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801e0f:	83 f8 1f             	cmp    $0x1f,%eax
+  801e12:	77 30                	ja     801e44 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801e14:	c1 e0 0c             	shl    $0xc,%eax
+  801e17:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801e1c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801e22:	f6 c2 01             	test   $0x1,%dl
+  801e25:	74 24                	je     801e4b <fd_lookup+0x42>
+  801e27:	89 c2                	mov    %eax,%edx
+  801e29:	c1 ea 0c             	shr    $0xc,%edx
+  801e2c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e33:	f6 c2 01             	test   $0x1,%dl
+  801e36:	74 1a                	je     801e52 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801e38:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e3b:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801e3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e42:	5d                   	pop    %ebp
+  801e43:	c3                   	ret
+		return -E_INVAL;
+  801e44:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e49:	eb f7                	jmp    801e42 <fd_lookup+0x39>
+		return -E_INVAL;
+  801e4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e50:	eb f0                	jmp    801e42 <fd_lookup+0x39>
+  801e52:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e57:	eb e9                	jmp    801e42 <fd_lookup+0x39>
+
+00801e59 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801e59:	55                   	push   %ebp
+  801e5a:	89 e5                	mov    %esp,%ebp
+  801e5c:	53                   	push   %ebx
+  801e5d:	83 ec 04             	sub    $0x4,%esp
+  801e60:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801e63:	b8 a4 60 80 00       	mov    $0x8060a4,%eax
+  801e68:	8b 18                	mov    (%eax),%ebx
+  801e6a:	85 db                	test   %ebx,%ebx
+  801e6c:	74 0e                	je     801e7c <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801e6e:	83 c0 04             	add    $0x4,%eax
+  801e71:	39 13                	cmp    %edx,(%ebx)
+  801e73:	75 f3                	jne    801e68 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801e75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e7a:	eb 1f                	jmp    801e9b <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e7c:	a1 24 19 81 00       	mov    0x811924,%eax
+  801e81:	8b 40 48             	mov    0x48(%eax),%eax
+  801e84:	83 ec 04             	sub    $0x4,%esp
+  801e87:	52                   	push   %edx
+  801e88:	50                   	push   %eax
+  801e89:	68 28 60 80 00       	push   $0x806028
+  801e8e:	e8 d2 e8 ff ff       	call   800765 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801e93:	83 c4 10             	add    $0x10,%esp
+  801e96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801e9b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e9e:	89 1a                	mov    %ebx,(%edx)
+}
+  801ea0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea3:	c9                   	leave
+  801ea4:	c3                   	ret
+
+00801ea5 <fd_close>:
+{
+  801ea5:	55                   	push   %ebp
+  801ea6:	89 e5                	mov    %esp,%ebp
+  801ea8:	57                   	push   %edi
+  801ea9:	56                   	push   %esi
+  801eaa:	53                   	push   %ebx
+  801eab:	83 ec 24             	sub    $0x24,%esp
+  801eae:	8b 75 08             	mov    0x8(%ebp),%esi
+  801eb1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801eb4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801eb7:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801eb8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ebe:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ec1:	50                   	push   %eax
+  801ec2:	e8 42 ff ff ff       	call   801e09 <fd_lookup>
+  801ec7:	89 c3                	mov    %eax,%ebx
+  801ec9:	83 c4 10             	add    $0x10,%esp
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	78 05                	js     801ed5 <fd_close+0x30>
+	    || fd != fd2)
+  801ed0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801ed3:	74 16                	je     801eeb <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801ed5:	89 f8                	mov    %edi,%eax
+  801ed7:	84 c0                	test   %al,%al
+  801ed9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ede:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801ee1:	89 d8                	mov    %ebx,%eax
+  801ee3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ee6:	5b                   	pop    %ebx
+  801ee7:	5e                   	pop    %esi
+  801ee8:	5f                   	pop    %edi
+  801ee9:	5d                   	pop    %ebp
+  801eea:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801eeb:	83 ec 08             	sub    $0x8,%esp
+  801eee:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801ef1:	50                   	push   %eax
+  801ef2:	ff 36                	push   (%esi)
+  801ef4:	e8 60 ff ff ff       	call   801e59 <dev_lookup>
+  801ef9:	89 c3                	mov    %eax,%ebx
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	85 c0                	test   %eax,%eax
+  801f00:	78 1a                	js     801f1c <fd_close+0x77>
+		if (dev->dev_close)
+  801f02:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801f05:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801f08:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801f0d:	85 c0                	test   %eax,%eax
+  801f0f:	74 0b                	je     801f1c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801f11:	83 ec 0c             	sub    $0xc,%esp
+  801f14:	56                   	push   %esi
+  801f15:	ff d0                	call   *%eax
+  801f17:	89 c3                	mov    %eax,%ebx
+  801f19:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801f1c:	83 ec 08             	sub    $0x8,%esp
+  801f1f:	56                   	push   %esi
+  801f20:	6a 00                	push   $0x0
+  801f22:	e8 9d f3 ff ff       	call   8012c4 <sys_page_unmap>
+	return r;
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	eb b5                	jmp    801ee1 <fd_close+0x3c>
+
+00801f2c <close>:
+
+int
+close(int fdnum)
+{
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f35:	50                   	push   %eax
+  801f36:	ff 75 08             	push   0x8(%ebp)
+  801f39:	e8 cb fe ff ff       	call   801e09 <fd_lookup>
+  801f3e:	83 c4 10             	add    $0x10,%esp
+  801f41:	85 c0                	test   %eax,%eax
+  801f43:	79 02                	jns    801f47 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801f45:	c9                   	leave
+  801f46:	c3                   	ret
+		return fd_close(fd, 1);
+  801f47:	83 ec 08             	sub    $0x8,%esp
+  801f4a:	6a 01                	push   $0x1
+  801f4c:	ff 75 f4             	push   -0xc(%ebp)
+  801f4f:	e8 51 ff ff ff       	call   801ea5 <fd_close>
+  801f54:	83 c4 10             	add    $0x10,%esp
+  801f57:	eb ec                	jmp    801f45 <close+0x19>
+
+00801f59 <close_all>:
+
+void
+close_all(void)
+{
+  801f59:	55                   	push   %ebp
+  801f5a:	89 e5                	mov    %esp,%ebp
+  801f5c:	53                   	push   %ebx
+  801f5d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801f60:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801f65:	83 ec 0c             	sub    $0xc,%esp
+  801f68:	53                   	push   %ebx
+  801f69:	e8 be ff ff ff       	call   801f2c <close>
+	for (i = 0; i < MAXFD; i++)
+  801f6e:	83 c3 01             	add    $0x1,%ebx
+  801f71:	83 c4 10             	add    $0x10,%esp
+  801f74:	83 fb 20             	cmp    $0x20,%ebx
+  801f77:	75 ec                	jne    801f65 <close_all+0xc>
+}
+  801f79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f7c:	c9                   	leave
+  801f7d:	c3                   	ret
+
+00801f7e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801f7e:	55                   	push   %ebp
+  801f7f:	89 e5                	mov    %esp,%ebp
+  801f81:	57                   	push   %edi
+  801f82:	56                   	push   %esi
+  801f83:	53                   	push   %ebx
+  801f84:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801f87:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f8a:	50                   	push   %eax
+  801f8b:	ff 75 08             	push   0x8(%ebp)
+  801f8e:	e8 76 fe ff ff       	call   801e09 <fd_lookup>
+  801f93:	89 c3                	mov    %eax,%ebx
+  801f95:	83 c4 10             	add    $0x10,%esp
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	78 7f                	js     80201b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801f9c:	83 ec 0c             	sub    $0xc,%esp
+  801f9f:	ff 75 0c             	push   0xc(%ebp)
+  801fa2:	e8 85 ff ff ff       	call   801f2c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801fa7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801faa:	c1 e6 0c             	shl    $0xc,%esi
+  801fad:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801fb3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801fb6:	89 3c 24             	mov    %edi,(%esp)
+  801fb9:	e8 e0 fd ff ff       	call   801d9e <fd2data>
+  801fbe:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801fc0:	89 34 24             	mov    %esi,(%esp)
+  801fc3:	e8 d6 fd ff ff       	call   801d9e <fd2data>
+  801fc8:	83 c4 10             	add    $0x10,%esp
+  801fcb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801fce:	89 d8                	mov    %ebx,%eax
+  801fd0:	c1 e8 16             	shr    $0x16,%eax
+  801fd3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801fda:	a8 01                	test   $0x1,%al
+  801fdc:	74 11                	je     801fef <dup+0x71>
+  801fde:	89 d8                	mov    %ebx,%eax
+  801fe0:	c1 e8 0c             	shr    $0xc,%eax
+  801fe3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801fea:	f6 c2 01             	test   $0x1,%dl
+  801fed:	75 36                	jne    802025 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801fef:	89 f8                	mov    %edi,%eax
+  801ff1:	c1 e8 0c             	shr    $0xc,%eax
+  801ff4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ffb:	83 ec 0c             	sub    $0xc,%esp
+  801ffe:	25 07 0e 00 00       	and    $0xe07,%eax
+  802003:	50                   	push   %eax
+  802004:	56                   	push   %esi
+  802005:	6a 00                	push   $0x0
+  802007:	57                   	push   %edi
+  802008:	6a 00                	push   $0x0
+  80200a:	e8 73 f2 ff ff       	call   801282 <sys_page_map>
+  80200f:	89 c3                	mov    %eax,%ebx
+  802011:	83 c4 20             	add    $0x20,%esp
+  802014:	85 c0                	test   %eax,%eax
+  802016:	78 33                	js     80204b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  802018:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80201b:	89 d8                	mov    %ebx,%eax
+  80201d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802020:	5b                   	pop    %ebx
+  802021:	5e                   	pop    %esi
+  802022:	5f                   	pop    %edi
+  802023:	5d                   	pop    %ebp
+  802024:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  802025:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80202c:	83 ec 0c             	sub    $0xc,%esp
+  80202f:	25 07 0e 00 00       	and    $0xe07,%eax
+  802034:	50                   	push   %eax
+  802035:	ff 75 d4             	push   -0x2c(%ebp)
+  802038:	6a 00                	push   $0x0
+  80203a:	53                   	push   %ebx
+  80203b:	6a 00                	push   $0x0
+  80203d:	e8 40 f2 ff ff       	call   801282 <sys_page_map>
+  802042:	89 c3                	mov    %eax,%ebx
+  802044:	83 c4 20             	add    $0x20,%esp
+  802047:	85 c0                	test   %eax,%eax
+  802049:	79 a4                	jns    801fef <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80204b:	83 ec 08             	sub    $0x8,%esp
+  80204e:	56                   	push   %esi
+  80204f:	6a 00                	push   $0x0
+  802051:	e8 6e f2 ff ff       	call   8012c4 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  802056:	83 c4 08             	add    $0x8,%esp
+  802059:	ff 75 d4             	push   -0x2c(%ebp)
+  80205c:	6a 00                	push   $0x0
+  80205e:	e8 61 f2 ff ff       	call   8012c4 <sys_page_unmap>
+	return r;
+  802063:	83 c4 10             	add    $0x10,%esp
+  802066:	eb b3                	jmp    80201b <dup+0x9d>
+
+00802068 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802068:	55                   	push   %ebp
+  802069:	89 e5                	mov    %esp,%ebp
+  80206b:	56                   	push   %esi
+  80206c:	53                   	push   %ebx
+  80206d:	83 ec 18             	sub    $0x18,%esp
+  802070:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802073:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802076:	50                   	push   %eax
+  802077:	56                   	push   %esi
+  802078:	e8 8c fd ff ff       	call   801e09 <fd_lookup>
+  80207d:	83 c4 10             	add    $0x10,%esp
+  802080:	85 c0                	test   %eax,%eax
+  802082:	78 3c                	js     8020c0 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802084:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  802087:	83 ec 08             	sub    $0x8,%esp
+  80208a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80208d:	50                   	push   %eax
+  80208e:	ff 33                	push   (%ebx)
+  802090:	e8 c4 fd ff ff       	call   801e59 <dev_lookup>
+  802095:	83 c4 10             	add    $0x10,%esp
+  802098:	85 c0                	test   %eax,%eax
+  80209a:	78 24                	js     8020c0 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80209c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80209f:	83 e0 03             	and    $0x3,%eax
+  8020a2:	83 f8 01             	cmp    $0x1,%eax
+  8020a5:	74 20                	je     8020c7 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8020a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020aa:	8b 40 08             	mov    0x8(%eax),%eax
+  8020ad:	85 c0                	test   %eax,%eax
+  8020af:	74 37                	je     8020e8 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8020b1:	83 ec 04             	sub    $0x4,%esp
+  8020b4:	ff 75 10             	push   0x10(%ebp)
+  8020b7:	ff 75 0c             	push   0xc(%ebp)
+  8020ba:	53                   	push   %ebx
+  8020bb:	ff d0                	call   *%eax
+  8020bd:	83 c4 10             	add    $0x10,%esp
+}
+  8020c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020c3:	5b                   	pop    %ebx
+  8020c4:	5e                   	pop    %esi
+  8020c5:	5d                   	pop    %ebp
+  8020c6:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020c7:	a1 24 19 81 00       	mov    0x811924,%eax
+  8020cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8020cf:	83 ec 04             	sub    $0x4,%esp
+  8020d2:	56                   	push   %esi
+  8020d3:	50                   	push   %eax
+  8020d4:	68 69 60 80 00       	push   $0x806069
+  8020d9:	e8 87 e6 ff ff       	call   800765 <cprintf>
+		return -E_INVAL;
+  8020de:	83 c4 10             	add    $0x10,%esp
+  8020e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e6:	eb d8                	jmp    8020c0 <read+0x58>
+		return -E_NOT_SUPP;
+  8020e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020ed:	eb d1                	jmp    8020c0 <read+0x58>
+
+008020ef <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8020ef:	55                   	push   %ebp
+  8020f0:	89 e5                	mov    %esp,%ebp
+  8020f2:	57                   	push   %edi
+  8020f3:	56                   	push   %esi
+  8020f4:	53                   	push   %ebx
+  8020f5:	83 ec 0c             	sub    $0xc,%esp
+  8020f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020fb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8020fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802103:	eb 02                	jmp    802107 <readn+0x18>
+  802105:	01 c3                	add    %eax,%ebx
+  802107:	39 f3                	cmp    %esi,%ebx
+  802109:	73 21                	jae    80212c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80210b:	83 ec 04             	sub    $0x4,%esp
+  80210e:	89 f0                	mov    %esi,%eax
+  802110:	29 d8                	sub    %ebx,%eax
+  802112:	50                   	push   %eax
+  802113:	89 d8                	mov    %ebx,%eax
+  802115:	03 45 0c             	add    0xc(%ebp),%eax
+  802118:	50                   	push   %eax
+  802119:	57                   	push   %edi
+  80211a:	e8 49 ff ff ff       	call   802068 <read>
+		if (m < 0)
+  80211f:	83 c4 10             	add    $0x10,%esp
+  802122:	85 c0                	test   %eax,%eax
+  802124:	78 04                	js     80212a <readn+0x3b>
+			return m;
+		if (m == 0)
+  802126:	75 dd                	jne    802105 <readn+0x16>
+  802128:	eb 02                	jmp    80212c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80212a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80212c:	89 d8                	mov    %ebx,%eax
+  80212e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802131:	5b                   	pop    %ebx
+  802132:	5e                   	pop    %esi
+  802133:	5f                   	pop    %edi
+  802134:	5d                   	pop    %ebp
+  802135:	c3                   	ret
+
+00802136 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802136:	55                   	push   %ebp
+  802137:	89 e5                	mov    %esp,%ebp
+  802139:	56                   	push   %esi
+  80213a:	53                   	push   %ebx
+  80213b:	83 ec 18             	sub    $0x18,%esp
+  80213e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802141:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802144:	50                   	push   %eax
+  802145:	53                   	push   %ebx
+  802146:	e8 be fc ff ff       	call   801e09 <fd_lookup>
+  80214b:	83 c4 10             	add    $0x10,%esp
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	78 37                	js     802189 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802152:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802155:	83 ec 08             	sub    $0x8,%esp
+  802158:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80215b:	50                   	push   %eax
+  80215c:	ff 36                	push   (%esi)
+  80215e:	e8 f6 fc ff ff       	call   801e59 <dev_lookup>
+  802163:	83 c4 10             	add    $0x10,%esp
+  802166:	85 c0                	test   %eax,%eax
+  802168:	78 1f                	js     802189 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80216a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80216e:	74 20                	je     802190 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  802170:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802173:	8b 40 0c             	mov    0xc(%eax),%eax
+  802176:	85 c0                	test   %eax,%eax
+  802178:	74 37                	je     8021b1 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80217a:	83 ec 04             	sub    $0x4,%esp
+  80217d:	ff 75 10             	push   0x10(%ebp)
+  802180:	ff 75 0c             	push   0xc(%ebp)
+  802183:	56                   	push   %esi
+  802184:	ff d0                	call   *%eax
+  802186:	83 c4 10             	add    $0x10,%esp
+}
+  802189:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80218c:	5b                   	pop    %ebx
+  80218d:	5e                   	pop    %esi
+  80218e:	5d                   	pop    %ebp
+  80218f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802190:	a1 24 19 81 00       	mov    0x811924,%eax
+  802195:	8b 40 48             	mov    0x48(%eax),%eax
+  802198:	83 ec 04             	sub    $0x4,%esp
+  80219b:	53                   	push   %ebx
+  80219c:	50                   	push   %eax
+  80219d:	68 85 60 80 00       	push   $0x806085
+  8021a2:	e8 be e5 ff ff       	call   800765 <cprintf>
+		return -E_INVAL;
+  8021a7:	83 c4 10             	add    $0x10,%esp
+  8021aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021af:	eb d8                	jmp    802189 <write+0x53>
+		return -E_NOT_SUPP;
+  8021b1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8021b6:	eb d1                	jmp    802189 <write+0x53>
+
+008021b8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021c1:	50                   	push   %eax
+  8021c2:	ff 75 08             	push   0x8(%ebp)
+  8021c5:	e8 3f fc ff ff       	call   801e09 <fd_lookup>
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 0e                	js     8021df <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  8021d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021d7:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  8021da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021df:	c9                   	leave
+  8021e0:	c3                   	ret
+
+008021e1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	56                   	push   %esi
+  8021e5:	53                   	push   %ebx
+  8021e6:	83 ec 18             	sub    $0x18,%esp
+  8021e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8021ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8021ef:	50                   	push   %eax
+  8021f0:	53                   	push   %ebx
+  8021f1:	e8 13 fc ff ff       	call   801e09 <fd_lookup>
+  8021f6:	83 c4 10             	add    $0x10,%esp
+  8021f9:	85 c0                	test   %eax,%eax
+  8021fb:	78 34                	js     802231 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8021fd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802200:	83 ec 08             	sub    $0x8,%esp
+  802203:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802206:	50                   	push   %eax
+  802207:	ff 36                	push   (%esi)
+  802209:	e8 4b fc ff ff       	call   801e59 <dev_lookup>
+  80220e:	83 c4 10             	add    $0x10,%esp
+  802211:	85 c0                	test   %eax,%eax
+  802213:	78 1c                	js     802231 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802215:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802219:	74 1d                	je     802238 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80221b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80221e:	8b 40 18             	mov    0x18(%eax),%eax
+  802221:	85 c0                	test   %eax,%eax
+  802223:	74 34                	je     802259 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802225:	83 ec 08             	sub    $0x8,%esp
+  802228:	ff 75 0c             	push   0xc(%ebp)
+  80222b:	56                   	push   %esi
+  80222c:	ff d0                	call   *%eax
+  80222e:	83 c4 10             	add    $0x10,%esp
+}
+  802231:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802234:	5b                   	pop    %ebx
+  802235:	5e                   	pop    %esi
+  802236:	5d                   	pop    %ebp
+  802237:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802238:	a1 24 19 81 00       	mov    0x811924,%eax
+  80223d:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802240:	83 ec 04             	sub    $0x4,%esp
+  802243:	53                   	push   %ebx
+  802244:	50                   	push   %eax
+  802245:	68 48 60 80 00       	push   $0x806048
+  80224a:	e8 16 e5 ff ff       	call   800765 <cprintf>
+		return -E_INVAL;
+  80224f:	83 c4 10             	add    $0x10,%esp
+  802252:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802257:	eb d8                	jmp    802231 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  802259:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80225e:	eb d1                	jmp    802231 <ftruncate+0x50>
+
+00802260 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802260:	55                   	push   %ebp
+  802261:	89 e5                	mov    %esp,%ebp
+  802263:	56                   	push   %esi
+  802264:	53                   	push   %ebx
+  802265:	83 ec 18             	sub    $0x18,%esp
+  802268:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80226b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80226e:	50                   	push   %eax
+  80226f:	ff 75 08             	push   0x8(%ebp)
+  802272:	e8 92 fb ff ff       	call   801e09 <fd_lookup>
+  802277:	83 c4 10             	add    $0x10,%esp
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	78 49                	js     8022c7 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80227e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802281:	83 ec 08             	sub    $0x8,%esp
+  802284:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802287:	50                   	push   %eax
+  802288:	ff 36                	push   (%esi)
+  80228a:	e8 ca fb ff ff       	call   801e59 <dev_lookup>
+  80228f:	83 c4 10             	add    $0x10,%esp
+  802292:	85 c0                	test   %eax,%eax
+  802294:	78 31                	js     8022c7 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  802296:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802299:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80229d:	74 2f                	je     8022ce <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80229f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8022a2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8022a9:	00 00 00 
+	stat->st_isdir = 0;
+  8022ac:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022b3:	00 00 00 
+	stat->st_dev = dev;
+  8022b6:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8022bc:	83 ec 08             	sub    $0x8,%esp
+  8022bf:	53                   	push   %ebx
+  8022c0:	56                   	push   %esi
+  8022c1:	ff 50 14             	call   *0x14(%eax)
+  8022c4:	83 c4 10             	add    $0x10,%esp
+}
+  8022c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5d                   	pop    %ebp
+  8022cd:	c3                   	ret
+		return -E_NOT_SUPP;
+  8022ce:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8022d3:	eb f2                	jmp    8022c7 <fstat+0x67>
+
+008022d5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8022d5:	55                   	push   %ebp
+  8022d6:	89 e5                	mov    %esp,%ebp
+  8022d8:	56                   	push   %esi
+  8022d9:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  8022da:	83 ec 08             	sub    $0x8,%esp
+  8022dd:	6a 00                	push   $0x0
+  8022df:	ff 75 08             	push   0x8(%ebp)
+  8022e2:	e8 bc 02 00 00       	call   8025a3 <open>
+  8022e7:	89 c3                	mov    %eax,%ebx
+  8022e9:	83 c4 10             	add    $0x10,%esp
+  8022ec:	85 c0                	test   %eax,%eax
+  8022ee:	78 1b                	js     80230b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8022f0:	83 ec 08             	sub    $0x8,%esp
+  8022f3:	ff 75 0c             	push   0xc(%ebp)
+  8022f6:	50                   	push   %eax
+  8022f7:	e8 64 ff ff ff       	call   802260 <fstat>
+  8022fc:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8022fe:	89 1c 24             	mov    %ebx,(%esp)
+  802301:	e8 26 fc ff ff       	call   801f2c <close>
+	return r;
+  802306:	83 c4 10             	add    $0x10,%esp
+  802309:	89 f3                	mov    %esi,%ebx
+}
+  80230b:	89 d8                	mov    %ebx,%eax
+  80230d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802310:	5b                   	pop    %ebx
+  802311:	5e                   	pop    %esi
+  802312:	5d                   	pop    %ebp
+  802313:	c3                   	ret
+
+00802314 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  802314:	55                   	push   %ebp
+  802315:	89 e5                	mov    %esp,%ebp
+  802317:	57                   	push   %edi
+  802318:	56                   	push   %esi
+  802319:	53                   	push   %ebx
+  80231a:	83 ec 0c             	sub    $0xc,%esp
+  80231d:	89 c7                	mov    %eax,%edi
+  80231f:	89 d3                	mov    %edx,%ebx
+  802321:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802323:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80232a:	74 2d                	je     802359 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80232c:	6a 07                	push   $0x7
+  80232e:	68 00 20 81 00       	push   $0x812000
+  802333:	57                   	push   %edi
+  802334:	ff 35 00 80 80 00    	push   0x808000
+  80233a:	e8 f8 31 00 00       	call   805537 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  80233f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  802346:	6a 00                	push   $0x0
+  802348:	56                   	push   %esi
+  802349:	53                   	push   %ebx
+  80234a:	6a 00                	push   $0x0
+  80234c:	e8 98 30 00 00       	call   8053e9 <ipc_recv_pages>
+}
+  802351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802354:	5b                   	pop    %ebx
+  802355:	5e                   	pop    %esi
+  802356:	5f                   	pop    %edi
+  802357:	5d                   	pop    %ebp
+  802358:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802359:	83 ec 0c             	sub    $0xc,%esp
+  80235c:	6a 01                	push   $0x1
+  80235e:	e8 c9 32 00 00       	call   80562c <ipc_find_env>
+  802363:	a3 00 80 80 00       	mov    %eax,0x808000
+  802368:	83 c4 10             	add    $0x10,%esp
+  80236b:	eb bf                	jmp    80232c <fsipc_pages+0x18>
+
+0080236d <fsipc>:
+{
+  80236d:	55                   	push   %ebp
+  80236e:	89 e5                	mov    %esp,%ebp
+  802370:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  802373:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802378:	e8 97 ff ff ff       	call   802314 <fsipc_pages>
+}
+  80237d:	c9                   	leave
+  80237e:	c3                   	ret
+
+0080237f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80237f:	55                   	push   %ebp
+  802380:	89 e5                	mov    %esp,%ebp
+  802382:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802385:	8b 45 08             	mov    0x8(%ebp),%eax
+  802388:	8b 40 0c             	mov    0xc(%eax),%eax
+  80238b:	a3 00 20 81 00       	mov    %eax,0x812000
+	fsipcbuf.set_size.req_size = newsize;
+  802390:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802393:	a3 04 20 81 00       	mov    %eax,0x812004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802398:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239d:	b8 02 00 00 00       	mov    $0x2,%eax
+  8023a2:	e8 c6 ff ff ff       	call   80236d <fsipc>
+}
+  8023a7:	c9                   	leave
+  8023a8:	c3                   	ret
+
+008023a9 <devfile_flush>:
+{
+  8023a9:	55                   	push   %ebp
+  8023aa:	89 e5                	mov    %esp,%ebp
+  8023ac:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8023af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023b5:	a3 00 20 81 00       	mov    %eax,0x812000
+	return fsipc(FSREQ_FLUSH, NULL);
+  8023ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023bf:	b8 06 00 00 00       	mov    $0x6,%eax
+  8023c4:	e8 a4 ff ff ff       	call   80236d <fsipc>
+}
+  8023c9:	c9                   	leave
+  8023ca:	c3                   	ret
+
+008023cb <devfile_stat>:
+{
+  8023cb:	55                   	push   %ebp
+  8023cc:	89 e5                	mov    %esp,%ebp
+  8023ce:	53                   	push   %ebx
+  8023cf:	83 ec 04             	sub    $0x4,%esp
+  8023d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8023d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023db:	a3 00 20 81 00       	mov    %eax,0x812000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8023e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023ea:	e8 7e ff ff ff       	call   80236d <fsipc>
+  8023ef:	85 c0                	test   %eax,%eax
+  8023f1:	78 2c                	js     80241f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8023f3:	83 ec 08             	sub    $0x8,%esp
+  8023f6:	68 00 20 81 00       	push   $0x812000
+  8023fb:	53                   	push   %ebx
+  8023fc:	e8 4b e9 ff ff       	call   800d4c <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802401:	a1 80 20 81 00       	mov    0x812080,%eax
+  802406:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80240c:	a1 84 20 81 00       	mov    0x812084,%eax
+  802411:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802417:	83 c4 10             	add    $0x10,%esp
+  80241a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80241f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802422:	c9                   	leave
+  802423:	c3                   	ret
+
+00802424 <devfile_write>:
+{
+  802424:	55                   	push   %ebp
+  802425:	89 e5                	mov    %esp,%ebp
+  802427:	83 ec 0c             	sub    $0xc,%esp
+  80242a:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80242d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802432:	39 d0                	cmp    %edx,%eax
+  802434:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802437:	8b 55 08             	mov    0x8(%ebp),%edx
+  80243a:	8b 52 0c             	mov    0xc(%edx),%edx
+  80243d:	89 15 00 20 81 00    	mov    %edx,0x812000
+	fsipcbuf.write.req_n = n;
+  802443:	a3 04 20 81 00       	mov    %eax,0x812004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802448:	50                   	push   %eax
+  802449:	ff 75 0c             	push   0xc(%ebp)
+  80244c:	68 08 20 81 00       	push   $0x812008
+  802451:	e8 7c ea ff ff       	call   800ed2 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802456:	ba 00 00 00 00       	mov    $0x0,%edx
+  80245b:	b8 04 00 00 00       	mov    $0x4,%eax
+  802460:	e8 08 ff ff ff       	call   80236d <fsipc>
+}
+  802465:	c9                   	leave
+  802466:	c3                   	ret
+
+00802467 <devfile_read>:
+{
+  802467:	55                   	push   %ebp
+  802468:	89 e5                	mov    %esp,%ebp
+  80246a:	57                   	push   %edi
+  80246b:	56                   	push   %esi
+  80246c:	53                   	push   %ebx
+  80246d:	83 ec 1c             	sub    $0x1c,%esp
+  802470:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802473:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802476:	89 fe                	mov    %edi,%esi
+  802478:	c1 ee 0c             	shr    $0xc,%esi
+  80247b:	b8 20 00 00 00       	mov    $0x20,%eax
+  802480:	39 c6                	cmp    %eax,%esi
+  802482:	0f 47 f0             	cmova  %eax,%esi
+  802485:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802488:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80248d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  802490:	eb 14                	jmp    8024a6 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802492:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  802499:	05 00 10 00 00       	add    $0x1000,%eax
+  80249e:	f6 c6 06             	test   $0x6,%dh
+  8024a1:	75 42                	jne    8024e5 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8024a3:	83 c1 01             	add    $0x1,%ecx
+  8024a6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8024a9:	39 f1                	cmp    %esi,%ecx
+  8024ab:	0f 84 95 00 00 00    	je     802546 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8024b1:	89 c2                	mov    %eax,%edx
+  8024b3:	c1 ea 16             	shr    $0x16,%edx
+  8024b6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8024bd:	f6 c2 01             	test   $0x1,%dl
+  8024c0:	74 23                	je     8024e5 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8024c2:	89 c2                	mov    %eax,%edx
+  8024c4:	c1 ea 0c             	shr    $0xc,%edx
+  8024c7:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8024ce:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  8024d4:	74 0f                	je     8024e5 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  8024d6:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  8024dd:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  8024e3:	75 ad                	jne    802492 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  8024e5:	85 c9                	test   %ecx,%ecx
+  8024e7:	74 11                	je     8024fa <devfile_read+0x93>
+  8024e9:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  8024f0:	75 08                	jne    8024fa <devfile_read+0x93>
+  8024f2:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8024f8:	74 50                	je     80254a <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024fa:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8024fd:	a3 00 20 81 00       	mov    %eax,0x812000
+	fsipcbuf.read.req_n = n;
+  802502:	89 3d 04 20 81 00    	mov    %edi,0x812004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802508:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802512:	e8 56 fe ff ff       	call   80236d <fsipc>
+  802517:	89 c6                	mov    %eax,%esi
+  802519:	85 c0                	test   %eax,%eax
+  80251b:	78 1f                	js     80253c <devfile_read+0xd5>
+	assert(r <= n);
+  80251d:	39 c7                	cmp    %eax,%edi
+  80251f:	72 50                	jb     802571 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  802521:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802526:	7f 62                	jg     80258a <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802528:	83 ec 04             	sub    $0x4,%esp
+  80252b:	50                   	push   %eax
+  80252c:	68 00 20 81 00       	push   $0x812000
+  802531:	ff 75 0c             	push   0xc(%ebp)
+  802534:	e8 99 e9 ff ff       	call   800ed2 <memmove>
+	return r;
+  802539:	83 c4 10             	add    $0x10,%esp
+}
+  80253c:	89 f0                	mov    %esi,%eax
+  80253e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802541:	5b                   	pop    %ebx
+  802542:	5e                   	pop    %esi
+  802543:	5f                   	pop    %edi
+  802544:	5d                   	pop    %ebp
+  802545:	c3                   	ret
+  802546:	89 f1                	mov    %esi,%ecx
+  802548:	eb 9b                	jmp    8024e5 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  80254a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80254d:	a3 00 20 81 00       	mov    %eax,0x812000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  802552:	89 c8                	mov    %ecx,%eax
+  802554:	c1 e0 0c             	shl    $0xc,%eax
+  802557:	a3 04 20 81 00       	mov    %eax,0x812004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  80255c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80255f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802564:	e8 ab fd ff ff       	call   802314 <fsipc_pages>
+  802569:	89 c6                	mov    %eax,%esi
+  80256b:	85 c0                	test   %eax,%eax
+  80256d:	78 8b                	js     8024fa <devfile_read+0x93>
+  80256f:	eb cb                	jmp    80253c <devfile_read+0xd5>
+	assert(r <= n);
+  802571:	68 b4 60 80 00       	push   $0x8060b4
+  802576:	68 a4 58 80 00       	push   $0x8058a4
+  80257b:	68 a0 00 00 00       	push   $0xa0
+  802580:	68 bb 60 80 00       	push   $0x8060bb
+  802585:	e8 00 e1 ff ff       	call   80068a <_panic>
+	assert(r <= PGSIZE);
+  80258a:	68 c6 60 80 00       	push   $0x8060c6
+  80258f:	68 a4 58 80 00       	push   $0x8058a4
+  802594:	68 a1 00 00 00       	push   $0xa1
+  802599:	68 bb 60 80 00       	push   $0x8060bb
+  80259e:	e8 e7 e0 ff ff       	call   80068a <_panic>
+
+008025a3 <open>:
+{
+  8025a3:	55                   	push   %ebp
+  8025a4:	89 e5                	mov    %esp,%ebp
+  8025a6:	56                   	push   %esi
+  8025a7:	53                   	push   %ebx
+  8025a8:	83 ec 1c             	sub    $0x1c,%esp
+  8025ab:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8025ae:	56                   	push   %esi
+  8025af:	e8 5d e7 ff ff       	call   800d11 <strlen>
+  8025b4:	83 c4 10             	add    $0x10,%esp
+  8025b7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025bc:	7f 6c                	jg     80262a <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  8025be:	83 ec 0c             	sub    $0xc,%esp
+  8025c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025c4:	50                   	push   %eax
+  8025c5:	e8 eb f7 ff ff       	call   801db5 <fd_alloc>
+  8025ca:	89 c3                	mov    %eax,%ebx
+  8025cc:	83 c4 10             	add    $0x10,%esp
+  8025cf:	85 c0                	test   %eax,%eax
+  8025d1:	78 3c                	js     80260f <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  8025d3:	83 ec 08             	sub    $0x8,%esp
+  8025d6:	56                   	push   %esi
+  8025d7:	68 00 20 81 00       	push   $0x812000
+  8025dc:	e8 6b e7 ff ff       	call   800d4c <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8025e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025e4:	a3 00 24 81 00       	mov    %eax,0x812400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8025e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8025ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025f1:	e8 77 fd ff ff       	call   80236d <fsipc>
+  8025f6:	89 c3                	mov    %eax,%ebx
+  8025f8:	83 c4 10             	add    $0x10,%esp
+  8025fb:	85 c0                	test   %eax,%eax
+  8025fd:	78 19                	js     802618 <open+0x75>
+	return fd2num(fd);
+  8025ff:	83 ec 0c             	sub    $0xc,%esp
+  802602:	ff 75 f4             	push   -0xc(%ebp)
+  802605:	e8 84 f7 ff ff       	call   801d8e <fd2num>
+  80260a:	89 c3                	mov    %eax,%ebx
+  80260c:	83 c4 10             	add    $0x10,%esp
+}
+  80260f:	89 d8                	mov    %ebx,%eax
+  802611:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802614:	5b                   	pop    %ebx
+  802615:	5e                   	pop    %esi
+  802616:	5d                   	pop    %ebp
+  802617:	c3                   	ret
+		fd_close(fd, 0);
+  802618:	83 ec 08             	sub    $0x8,%esp
+  80261b:	6a 00                	push   $0x0
+  80261d:	ff 75 f4             	push   -0xc(%ebp)
+  802620:	e8 80 f8 ff ff       	call   801ea5 <fd_close>
+		return r;
+  802625:	83 c4 10             	add    $0x10,%esp
+  802628:	eb e5                	jmp    80260f <open+0x6c>
+		return -E_BAD_PATH;
+  80262a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80262f:	eb de                	jmp    80260f <open+0x6c>
+
+00802631 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802631:	55                   	push   %ebp
+  802632:	89 e5                	mov    %esp,%ebp
+  802634:	53                   	push   %ebx
+  802635:	83 ec 10             	sub    $0x10,%esp
+  802638:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  80263b:	53                   	push   %ebx
+  80263c:	e8 d0 e6 ff ff       	call   800d11 <strlen>
+  802641:	83 c4 10             	add    $0x10,%esp
+  802644:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802649:	7f 25                	jg     802670 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  80264b:	83 ec 08             	sub    $0x8,%esp
+  80264e:	53                   	push   %ebx
+  80264f:	68 00 20 81 00       	push   $0x812000
+  802654:	e8 f3 e6 ff ff       	call   800d4c <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802659:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265e:	b8 07 00 00 00       	mov    $0x7,%eax
+  802663:	e8 05 fd ff ff       	call   80236d <fsipc>
+  802668:	83 c4 10             	add    $0x10,%esp
+}
+  80266b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80266e:	c9                   	leave
+  80266f:	c3                   	ret
+		return -E_BAD_PATH;
+  802670:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802675:	eb f4                	jmp    80266b <remove+0x3a>
+
+00802677 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802677:	55                   	push   %ebp
+  802678:	89 e5                	mov    %esp,%ebp
+  80267a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80267d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802682:	b8 08 00 00 00       	mov    $0x8,%eax
+  802687:	e8 e1 fc ff ff       	call   80236d <fsipc>
+}
+  80268c:	c9                   	leave
+  80268d:	c3                   	ret
+
+0080268e <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  80268e:	55                   	push   %ebp
+  80268f:	89 e5                	mov    %esp,%ebp
+  802691:	53                   	push   %ebx
+  802692:	83 ec 04             	sub    $0x4,%esp
+  802695:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  802698:	ba 00 00 00 00       	mov    $0x0,%edx
+  80269d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026a2:	e8 c6 fc ff ff       	call   80236d <fsipc>
+  8026a7:	85 c0                	test   %eax,%eax
+  8026a9:	78 3c                	js     8026e7 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8026ab:	a1 00 20 81 00       	mov    0x812000,%eax
+  8026b0:	89 03                	mov    %eax,(%ebx)
+  8026b2:	a1 04 20 81 00       	mov    0x812004,%eax
+  8026b7:	89 43 04             	mov    %eax,0x4(%ebx)
+  8026ba:	a1 08 20 81 00       	mov    0x812008,%eax
+  8026bf:	89 43 08             	mov    %eax,0x8(%ebx)
+  8026c2:	a1 0c 20 81 00       	mov    0x81200c,%eax
+  8026c7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8026ca:	a1 10 20 81 00       	mov    0x812010,%eax
+  8026cf:	89 43 10             	mov    %eax,0x10(%ebx)
+  8026d2:	a1 14 20 81 00       	mov    0x812014,%eax
+  8026d7:	89 43 14             	mov    %eax,0x14(%ebx)
+  8026da:	a1 18 20 81 00       	mov    0x812018,%eax
+  8026df:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  8026e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026ea:	c9                   	leave
+  8026eb:	c3                   	ret
+
+008026ec <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  8026ec:	55                   	push   %ebp
+  8026ed:	89 e5                	mov    %esp,%ebp
+  8026ef:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  8026f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026f5:	a3 00 20 81 00       	mov    %eax,0x812000
+	return fsipc(FSREQ_BCSET, NULL);
+  8026fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ff:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802704:	e8 64 fc ff ff       	call   80236d <fsipc>
+}
+  802709:	c9                   	leave
+  80270a:	c3                   	ret
+
+0080270b <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80270b:	55                   	push   %ebp
+  80270c:	89 e5                	mov    %esp,%ebp
+  80270e:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802711:	89 c2                	mov    %eax,%edx
+  802713:	c1 ea 16             	shr    $0x16,%edx
+  802716:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80271d:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802722:	f6 c1 01             	test   $0x1,%cl
+  802725:	74 1e                	je     802745 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802727:	c1 e8 0c             	shr    $0xc,%eax
+  80272a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802731:	a8 01                	test   $0x1,%al
+  802733:	74 10                	je     802745 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  802735:	c1 e8 0c             	shr    $0xc,%eax
+  802738:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80273b:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802742:	0f b7 d2             	movzwl %dx,%edx
+}
+  802745:	89 d0                	mov    %edx,%eax
+  802747:	5d                   	pop    %ebp
+  802748:	c3                   	ret
+
+00802749 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802749:	55                   	push   %ebp
+  80274a:	89 e5                	mov    %esp,%ebp
+  80274c:	56                   	push   %esi
+  80274d:	53                   	push   %ebx
+  80274e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802751:	83 ec 0c             	sub    $0xc,%esp
+  802754:	ff 75 08             	push   0x8(%ebp)
+  802757:	e8 42 f6 ff ff       	call   801d9e <fd2data>
+  80275c:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80275e:	83 c4 08             	add    $0x8,%esp
+  802761:	68 d2 60 80 00       	push   $0x8060d2
+  802766:	53                   	push   %ebx
+  802767:	e8 e0 e5 ff ff       	call   800d4c <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80276c:	8b 46 04             	mov    0x4(%esi),%eax
+  80276f:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802775:	2b 0e                	sub    (%esi),%ecx
+  802777:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  80277c:	89 c8                	mov    %ecx,%eax
+  80277e:	f7 e2                	mul    %edx
+  802780:	c1 ea 0c             	shr    $0xc,%edx
+  802783:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802789:	29 d1                	sub    %edx,%ecx
+  80278b:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802791:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802798:	00 00 00 
+	stat->st_dev = &devpipe;
+  80279b:	c7 83 88 00 00 00 20 	movl   $0x807020,0x88(%ebx)
+  8027a2:	70 80 00 
+	return 0;
+}
+  8027a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027ad:	5b                   	pop    %ebx
+  8027ae:	5e                   	pop    %esi
+  8027af:	5d                   	pop    %ebp
+  8027b0:	c3                   	ret
+
+008027b1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8027b1:	55                   	push   %ebp
+  8027b2:	89 e5                	mov    %esp,%ebp
+  8027b4:	53                   	push   %ebx
+  8027b5:	83 ec 0c             	sub    $0xc,%esp
+  8027b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8027bb:	53                   	push   %ebx
+  8027bc:	6a 00                	push   $0x0
+  8027be:	e8 01 eb ff ff       	call   8012c4 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8027c3:	89 1c 24             	mov    %ebx,(%esp)
+  8027c6:	e8 d3 f5 ff ff       	call   801d9e <fd2data>
+  8027cb:	83 c4 08             	add    $0x8,%esp
+  8027ce:	50                   	push   %eax
+  8027cf:	6a 00                	push   $0x0
+  8027d1:	e8 ee ea ff ff       	call   8012c4 <sys_page_unmap>
+}
+  8027d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027d9:	c9                   	leave
+  8027da:	c3                   	ret
+
+008027db <_pipeisclosed>:
+{
+  8027db:	55                   	push   %ebp
+  8027dc:	89 e5                	mov    %esp,%ebp
+  8027de:	57                   	push   %edi
+  8027df:	56                   	push   %esi
+  8027e0:	53                   	push   %ebx
+  8027e1:	83 ec 1c             	sub    $0x1c,%esp
+  8027e4:	89 c7                	mov    %eax,%edi
+  8027e6:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8027e8:	a1 24 19 81 00       	mov    0x811924,%eax
+  8027ed:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8027f0:	83 ec 0c             	sub    $0xc,%esp
+  8027f3:	57                   	push   %edi
+  8027f4:	e8 12 ff ff ff       	call   80270b <pageref>
+  8027f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027fc:	89 34 24             	mov    %esi,(%esp)
+  8027ff:	e8 07 ff ff ff       	call   80270b <pageref>
+		nn = thisenv->env_runs;
+  802804:	8b 15 24 19 81 00    	mov    0x811924,%edx
+  80280a:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80280d:	83 c4 10             	add    $0x10,%esp
+  802810:	39 cb                	cmp    %ecx,%ebx
+  802812:	74 1b                	je     80282f <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802814:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802817:	75 cf                	jne    8027e8 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802819:	8b 42 58             	mov    0x58(%edx),%eax
+  80281c:	6a 01                	push   $0x1
+  80281e:	50                   	push   %eax
+  80281f:	53                   	push   %ebx
+  802820:	68 d9 60 80 00       	push   $0x8060d9
+  802825:	e8 3b df ff ff       	call   800765 <cprintf>
+  80282a:	83 c4 10             	add    $0x10,%esp
+  80282d:	eb b9                	jmp    8027e8 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80282f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802832:	0f 94 c0             	sete   %al
+  802835:	0f b6 c0             	movzbl %al,%eax
+}
+  802838:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80283b:	5b                   	pop    %ebx
+  80283c:	5e                   	pop    %esi
+  80283d:	5f                   	pop    %edi
+  80283e:	5d                   	pop    %ebp
+  80283f:	c3                   	ret
+
+00802840 <devpipe_read>:
+{
+  802840:	55                   	push   %ebp
+  802841:	89 e5                	mov    %esp,%ebp
+  802843:	57                   	push   %edi
+  802844:	56                   	push   %esi
+  802845:	53                   	push   %ebx
+  802846:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802849:	ff 75 08             	push   0x8(%ebp)
+  80284c:	e8 4d f5 ff ff       	call   801d9e <fd2data>
+  802851:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802853:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802856:	8d 40 04             	lea    0x4(%eax),%eax
+  802859:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  80285c:	8b 7b 04             	mov    0x4(%ebx),%edi
+  80285f:	8b 0b                	mov    (%ebx),%ecx
+  802861:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802867:	29 ce                	sub    %ecx,%esi
+  802869:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80286e:	f7 e6                	mul    %esi
+  802870:	c1 ea 0c             	shr    $0xc,%edx
+  802873:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802879:	29 c6                	sub    %eax,%esi
+  80287b:	89 f2                	mov    %esi,%edx
+  80287d:	75 43                	jne    8028c2 <devpipe_read+0x82>
+		ref = pageref(p);
+  80287f:	83 ec 0c             	sub    $0xc,%esp
+  802882:	53                   	push   %ebx
+  802883:	e8 83 fe ff ff       	call   80270b <pageref>
+  802888:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  80288a:	89 da                	mov    %ebx,%edx
+  80288c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288f:	e8 47 ff ff ff       	call   8027db <_pipeisclosed>
+  802894:	83 c4 10             	add    $0x10,%esp
+  802897:	85 c0                	test   %eax,%eax
+  802899:	0f 85 c1 00 00 00    	jne    802960 <devpipe_read+0x120>
+	*sleeping = 1;
+  80289f:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8028a6:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8028ab:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8028ae:	75 ac                	jne    80285c <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8028b0:	83 ec 04             	sub    $0x4,%esp
+  8028b3:	56                   	push   %esi
+  8028b4:	57                   	push   %edi
+  8028b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8028b8:	e8 5b ee ff ff       	call   801718 <sys_futex_wait>
+  8028bd:	83 c4 10             	add    $0x10,%esp
+  8028c0:	eb 9a                	jmp    80285c <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  8028c2:	39 75 10             	cmp    %esi,0x10(%ebp)
+  8028c5:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  8028c9:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  8028cb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8028d0:	f7 e1                	mul    %ecx
+  8028d2:	c1 ea 0b             	shr    $0xb,%edx
+  8028d5:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  8028db:	29 c1                	sub    %eax,%ecx
+  8028dd:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  8028df:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  8028e4:	29 cf                	sub    %ecx,%edi
+  8028e6:	39 f7                	cmp    %esi,%edi
+  8028e8:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  8028eb:	8d 43 10             	lea    0x10(%ebx),%eax
+  8028ee:	83 ec 04             	sub    $0x4,%esp
+  8028f1:	57                   	push   %edi
+  8028f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028f5:	01 c2                	add    %eax,%edx
+  8028f7:	52                   	push   %edx
+  8028f8:	ff 75 0c             	push   0xc(%ebp)
+  8028fb:	e8 d2 e5 ff ff       	call   800ed2 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802900:	83 c4 0c             	add    $0xc,%esp
+  802903:	89 f1                	mov    %esi,%ecx
+  802905:	29 f9                	sub    %edi,%ecx
+  802907:	51                   	push   %ecx
+  802908:	ff 75 e4             	push   -0x1c(%ebp)
+  80290b:	89 f8                	mov    %edi,%eax
+  80290d:	03 45 0c             	add    0xc(%ebp),%eax
+  802910:	50                   	push   %eax
+  802911:	e8 bc e5 ff ff       	call   800ed2 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802916:	89 f1                	mov    %esi,%ecx
+  802918:	03 0b                	add    (%ebx),%ecx
+  80291a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80291f:	f7 e1                	mul    %ecx
+  802921:	c1 ea 0c             	shr    $0xc,%edx
+  802924:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80292a:	29 d1                	sub    %edx,%ecx
+  80292c:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80292e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802933:	83 c4 10             	add    $0x10,%esp
+  802936:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  80293a:	75 0a                	jne    802946 <devpipe_read+0x106>
+	return n;
+  80293c:	89 f0                	mov    %esi,%eax
+}
+  80293e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802941:	5b                   	pop    %ebx
+  802942:	5e                   	pop    %esi
+  802943:	5f                   	pop    %edi
+  802944:	5d                   	pop    %ebp
+  802945:	c3                   	ret
+		*sleeping = 0;
+  802946:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  80294d:	83 ec 08             	sub    $0x8,%esp
+  802950:	68 00 04 00 00       	push   $0x400
+  802955:	53                   	push   %ebx
+  802956:	e8 0d ee ff ff       	call   801768 <sys_futex_wake>
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	eb dc                	jmp    80293c <devpipe_read+0xfc>
+			return 0;
+  802960:	b8 00 00 00 00       	mov    $0x0,%eax
+  802965:	eb d7                	jmp    80293e <devpipe_read+0xfe>
+
+00802967 <devpipe_write>:
+{
+  802967:	55                   	push   %ebp
+  802968:	89 e5                	mov    %esp,%ebp
+  80296a:	57                   	push   %edi
+  80296b:	56                   	push   %esi
+  80296c:	53                   	push   %ebx
+  80296d:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802970:	ff 75 08             	push   0x8(%ebp)
+  802973:	e8 26 f4 ff ff       	call   801d9e <fd2data>
+  802978:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  80297a:	83 c4 10             	add    $0x10,%esp
+  80297d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802984:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802987:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80298a:	0f 83 23 01 00 00    	jae    802ab3 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802990:	8b 77 04             	mov    0x4(%edi),%esi
+  802993:	8b 1f                	mov    (%edi),%ebx
+  802995:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  80299b:	29 d9                	sub    %ebx,%ecx
+  80299d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8029a2:	f7 e1                	mul    %ecx
+  8029a4:	c1 ea 0c             	shr    $0xc,%edx
+  8029a7:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8029ad:	29 c1                	sub    %eax,%ecx
+  8029af:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8029b1:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8029b7:	75 40                	jne    8029f9 <devpipe_write+0x92>
+			ref = pageref(p);
+  8029b9:	83 ec 0c             	sub    $0xc,%esp
+  8029bc:	57                   	push   %edi
+  8029bd:	e8 49 fd ff ff       	call   80270b <pageref>
+  8029c2:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  8029c4:	89 fa                	mov    %edi,%edx
+  8029c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029c9:	e8 0d fe ff ff       	call   8027db <_pipeisclosed>
+  8029ce:	83 c4 10             	add    $0x10,%esp
+  8029d1:	85 c0                	test   %eax,%eax
+  8029d3:	0f 85 d5 00 00 00    	jne    802aae <devpipe_write+0x147>
+	*sleeping = 1;
+  8029d9:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  8029e0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8029e5:	39 1f                	cmp    %ebx,(%edi)
+  8029e7:	75 a7                	jne    802990 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  8029e9:	83 ec 04             	sub    $0x4,%esp
+  8029ec:	56                   	push   %esi
+  8029ed:	53                   	push   %ebx
+  8029ee:	57                   	push   %edi
+  8029ef:	e8 24 ed ff ff       	call   801718 <sys_futex_wait>
+  8029f4:	83 c4 10             	add    $0x10,%esp
+  8029f7:	eb 97                	jmp    802990 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  8029f9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8029fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ff:	29 c1                	sub    %eax,%ecx
+  802a01:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802a06:	89 d8                	mov    %ebx,%eax
+  802a08:	29 d0                	sub    %edx,%eax
+  802a0a:	39 c1                	cmp    %eax,%ecx
+  802a0c:	0f 46 c1             	cmovbe %ecx,%eax
+  802a0f:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802a11:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802a16:	f7 e6                	mul    %esi
+  802a18:	c1 ea 0b             	shr    $0xb,%edx
+  802a1b:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802a21:	29 c6                	sub    %eax,%esi
+  802a23:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802a25:	29 f3                	sub    %esi,%ebx
+  802a27:	39 cb                	cmp    %ecx,%ebx
+  802a29:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802a2c:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802a2f:	8d 77 10             	lea    0x10(%edi),%esi
+  802a32:	83 ec 04             	sub    $0x4,%esp
+  802a35:	53                   	push   %ebx
+  802a36:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a39:	03 45 0c             	add    0xc(%ebp),%eax
+  802a3c:	50                   	push   %eax
+  802a3d:	01 f2                	add    %esi,%edx
+  802a3f:	52                   	push   %edx
+  802a40:	e8 8d e4 ff ff       	call   800ed2 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802a45:	83 c4 0c             	add    $0xc,%esp
+  802a48:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a4b:	29 d8                	sub    %ebx,%eax
+  802a4d:	50                   	push   %eax
+  802a4e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a51:	01 d3                	add    %edx,%ebx
+  802a53:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802a56:	53                   	push   %ebx
+  802a57:	56                   	push   %esi
+  802a58:	e8 75 e4 ff ff       	call   800ed2 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802a5d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802a60:	03 4f 04             	add    0x4(%edi),%ecx
+  802a63:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802a68:	f7 e1                	mul    %ecx
+  802a6a:	c1 ea 0c             	shr    $0xc,%edx
+  802a6d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802a73:	29 d1                	sub    %edx,%ecx
+  802a75:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802a78:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802a7d:	83 c4 10             	add    $0x10,%esp
+  802a80:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802a84:	75 0b                	jne    802a91 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802a86:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802a89:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802a8c:	e9 f3 fe ff ff       	jmp    802984 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802a91:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802a98:	83 ec 08             	sub    $0x8,%esp
+  802a9b:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802aa0:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802aa3:	50                   	push   %eax
+  802aa4:	e8 bf ec ff ff       	call   801768 <sys_futex_wake>
+  802aa9:	83 c4 10             	add    $0x10,%esp
+  802aac:	eb d8                	jmp    802a86 <devpipe_write+0x11f>
+				return 0;
+  802aae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ab3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ab6:	5b                   	pop    %ebx
+  802ab7:	5e                   	pop    %esi
+  802ab8:	5f                   	pop    %edi
+  802ab9:	5d                   	pop    %ebp
+  802aba:	c3                   	ret
+
+00802abb <pipe>:
+{
+  802abb:	55                   	push   %ebp
+  802abc:	89 e5                	mov    %esp,%ebp
+  802abe:	56                   	push   %esi
+  802abf:	53                   	push   %ebx
+  802ac0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802ac3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ac6:	50                   	push   %eax
+  802ac7:	e8 e9 f2 ff ff       	call   801db5 <fd_alloc>
+  802acc:	89 c3                	mov    %eax,%ebx
+  802ace:	83 c4 10             	add    $0x10,%esp
+  802ad1:	85 c0                	test   %eax,%eax
+  802ad3:	0f 88 23 01 00 00    	js     802bfc <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ad9:	83 ec 04             	sub    $0x4,%esp
+  802adc:	68 07 04 00 00       	push   $0x407
+  802ae1:	ff 75 f4             	push   -0xc(%ebp)
+  802ae4:	6a 00                	push   $0x0
+  802ae6:	e8 54 e7 ff ff       	call   80123f <sys_page_alloc>
+  802aeb:	89 c3                	mov    %eax,%ebx
+  802aed:	83 c4 10             	add    $0x10,%esp
+  802af0:	85 c0                	test   %eax,%eax
+  802af2:	0f 88 04 01 00 00    	js     802bfc <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802af8:	83 ec 0c             	sub    $0xc,%esp
+  802afb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802afe:	50                   	push   %eax
+  802aff:	e8 b1 f2 ff ff       	call   801db5 <fd_alloc>
+  802b04:	89 c3                	mov    %eax,%ebx
+  802b06:	83 c4 10             	add    $0x10,%esp
+  802b09:	85 c0                	test   %eax,%eax
+  802b0b:	0f 88 db 00 00 00    	js     802bec <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b11:	83 ec 04             	sub    $0x4,%esp
+  802b14:	68 07 04 00 00       	push   $0x407
+  802b19:	ff 75 f0             	push   -0x10(%ebp)
+  802b1c:	6a 00                	push   $0x0
+  802b1e:	e8 1c e7 ff ff       	call   80123f <sys_page_alloc>
+  802b23:	89 c3                	mov    %eax,%ebx
+  802b25:	83 c4 10             	add    $0x10,%esp
+  802b28:	85 c0                	test   %eax,%eax
+  802b2a:	0f 88 bc 00 00 00    	js     802bec <pipe+0x131>
+	va = fd2data(fd0);
+  802b30:	83 ec 0c             	sub    $0xc,%esp
+  802b33:	ff 75 f4             	push   -0xc(%ebp)
+  802b36:	e8 63 f2 ff ff       	call   801d9e <fd2data>
+  802b3b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b3d:	83 c4 0c             	add    $0xc,%esp
+  802b40:	68 07 04 00 00       	push   $0x407
+  802b45:	50                   	push   %eax
+  802b46:	6a 00                	push   $0x0
+  802b48:	e8 f2 e6 ff ff       	call   80123f <sys_page_alloc>
+  802b4d:	89 c3                	mov    %eax,%ebx
+  802b4f:	83 c4 10             	add    $0x10,%esp
+  802b52:	85 c0                	test   %eax,%eax
+  802b54:	0f 88 82 00 00 00    	js     802bdc <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b5a:	83 ec 0c             	sub    $0xc,%esp
+  802b5d:	ff 75 f0             	push   -0x10(%ebp)
+  802b60:	e8 39 f2 ff ff       	call   801d9e <fd2data>
+  802b65:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b6c:	50                   	push   %eax
+  802b6d:	6a 00                	push   $0x0
+  802b6f:	56                   	push   %esi
+  802b70:	6a 00                	push   $0x0
+  802b72:	e8 0b e7 ff ff       	call   801282 <sys_page_map>
+  802b77:	89 c3                	mov    %eax,%ebx
+  802b79:	83 c4 20             	add    $0x20,%esp
+  802b7c:	85 c0                	test   %eax,%eax
+  802b7e:	78 4e                	js     802bce <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802b80:	a1 20 70 80 00       	mov    0x807020,%eax
+  802b85:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b88:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802b8a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b8d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802b94:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802b97:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802b99:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802b9c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802ba3:	83 ec 0c             	sub    $0xc,%esp
+  802ba6:	ff 75 f4             	push   -0xc(%ebp)
+  802ba9:	e8 e0 f1 ff ff       	call   801d8e <fd2num>
+  802bae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bb1:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802bb3:	83 c4 04             	add    $0x4,%esp
+  802bb6:	ff 75 f0             	push   -0x10(%ebp)
+  802bb9:	e8 d0 f1 ff ff       	call   801d8e <fd2num>
+  802bbe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bc1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802bc4:	83 c4 10             	add    $0x10,%esp
+  802bc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bcc:	eb 2e                	jmp    802bfc <pipe+0x141>
+	sys_page_unmap(0, va);
+  802bce:	83 ec 08             	sub    $0x8,%esp
+  802bd1:	56                   	push   %esi
+  802bd2:	6a 00                	push   $0x0
+  802bd4:	e8 eb e6 ff ff       	call   8012c4 <sys_page_unmap>
+  802bd9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802bdc:	83 ec 08             	sub    $0x8,%esp
+  802bdf:	ff 75 f0             	push   -0x10(%ebp)
+  802be2:	6a 00                	push   $0x0
+  802be4:	e8 db e6 ff ff       	call   8012c4 <sys_page_unmap>
+  802be9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802bec:	83 ec 08             	sub    $0x8,%esp
+  802bef:	ff 75 f4             	push   -0xc(%ebp)
+  802bf2:	6a 00                	push   $0x0
+  802bf4:	e8 cb e6 ff ff       	call   8012c4 <sys_page_unmap>
+  802bf9:	83 c4 10             	add    $0x10,%esp
+}
+  802bfc:	89 d8                	mov    %ebx,%eax
+  802bfe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c01:	5b                   	pop    %ebx
+  802c02:	5e                   	pop    %esi
+  802c03:	5d                   	pop    %ebp
+  802c04:	c3                   	ret
+
+00802c05 <pipeisclosed>:
+{
+  802c05:	55                   	push   %ebp
+  802c06:	89 e5                	mov    %esp,%ebp
+  802c08:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c0e:	50                   	push   %eax
+  802c0f:	ff 75 08             	push   0x8(%ebp)
+  802c12:	e8 f2 f1 ff ff       	call   801e09 <fd_lookup>
+  802c17:	83 c4 10             	add    $0x10,%esp
+  802c1a:	85 c0                	test   %eax,%eax
+  802c1c:	78 18                	js     802c36 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802c1e:	83 ec 0c             	sub    $0xc,%esp
+  802c21:	ff 75 f4             	push   -0xc(%ebp)
+  802c24:	e8 75 f1 ff ff       	call   801d9e <fd2data>
+  802c29:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802c2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c2e:	e8 a8 fb ff ff       	call   8027db <_pipeisclosed>
+  802c33:	83 c4 10             	add    $0x10,%esp
+}
+  802c36:	c9                   	leave
+  802c37:	c3                   	ret
+
+00802c38 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802c38:	55                   	push   %ebp
+  802c39:	89 e5                	mov    %esp,%ebp
+  802c3b:	57                   	push   %edi
+  802c3c:	56                   	push   %esi
+  802c3d:	53                   	push   %ebx
+  802c3e:	83 ec 0c             	sub    $0xc,%esp
+  802c41:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  802c44:	85 ff                	test   %edi,%edi
+  802c46:	74 21                	je     802c69 <wait+0x31>
+	e = &envs[ENVX(envid)];
+  802c48:	89 f8                	mov    %edi,%eax
+  802c4a:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  802c4f:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  802c52:	c1 e6 06             	shl    $0x6,%esi
+  802c55:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802c5b:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  802c5e:	c1 e3 06             	shl    $0x6,%ebx
+  802c61:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802c67:	eb 25                	jmp    802c8e <wait+0x56>
+	assert(envid != 0);
+  802c69:	68 f1 60 80 00       	push   $0x8060f1
+  802c6e:	68 a4 58 80 00       	push   $0x8058a4
+  802c73:	6a 0a                	push   $0xa
+  802c75:	68 fc 60 80 00       	push   $0x8060fc
+  802c7a:	e8 0b da ff ff       	call   80068a <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  802c7f:	83 ec 04             	sub    $0x4,%esp
+  802c82:	6a ff                	push   $0xffffffff
+  802c84:	50                   	push   %eax
+  802c85:	56                   	push   %esi
+  802c86:	e8 8d ea ff ff       	call   801718 <sys_futex_wait>
+  802c8b:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802c8e:	8b 43 48             	mov    0x48(%ebx),%eax
+  802c91:	39 f8                	cmp    %edi,%eax
+  802c93:	75 07                	jne    802c9c <wait+0x64>
+  802c95:	8b 43 54             	mov    0x54(%ebx),%eax
+  802c98:	85 c0                	test   %eax,%eax
+  802c9a:	75 e3                	jne    802c7f <wait+0x47>
+}
+  802c9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c9f:	5b                   	pop    %ebx
+  802ca0:	5e                   	pop    %esi
+  802ca1:	5f                   	pop    %edi
+  802ca2:	5d                   	pop    %ebp
+  802ca3:	c3                   	ret
+
+00802ca4 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802ca4:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802ca6:	8b 15 24 19 81 00    	mov    0x811924,%edx
+  802cac:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802cb2:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802cb8:	39 d0                	cmp    %edx,%eax
+  802cba:	74 2e                	je     802cea <segment_lookup+0x46>
+{
+  802cbc:	55                   	push   %ebp
+  802cbd:	89 e5                	mov    %esp,%ebp
+  802cbf:	57                   	push   %edi
+  802cc0:	56                   	push   %esi
+  802cc1:	53                   	push   %ebx
+  802cc2:	eb 07                	jmp    802ccb <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802cc4:	83 c0 20             	add    $0x20,%eax
+  802cc7:	39 d0                	cmp    %edx,%eax
+  802cc9:	74 15                	je     802ce0 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802ccb:	8b 18                	mov    (%eax),%ebx
+  802ccd:	39 d9                	cmp    %ebx,%ecx
+  802ccf:	72 f3                	jb     802cc4 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802cd1:	8b 38                	mov    (%eax),%edi
+  802cd3:	8b 58 04             	mov    0x4(%eax),%ebx
+  802cd6:	89 ce                	mov    %ecx,%esi
+  802cd8:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802cda:	39 de                	cmp    %ebx,%esi
+  802cdc:	73 e6                	jae    802cc4 <segment_lookup+0x20>
+  802cde:	eb 05                	jmp    802ce5 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ce5:	5b                   	pop    %ebx
+  802ce6:	5e                   	pop    %esi
+  802ce7:	5f                   	pop    %edi
+  802ce8:	5d                   	pop    %ebp
+  802ce9:	c3                   	ret
+	return NULL;
+  802cea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cef:	c3                   	ret
+
+00802cf0 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802cf0:	55                   	push   %ebp
+  802cf1:	89 e5                	mov    %esp,%ebp
+  802cf3:	53                   	push   %ebx
+  802cf4:	83 ec 04             	sub    $0x4,%esp
+  802cf7:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802cf9:	c1 e8 16             	shr    $0x16,%eax
+  802cfc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802d03:	25 81 00 00 00       	and    $0x81,%eax
+  802d08:	83 f8 01             	cmp    $0x1,%eax
+  802d0b:	75 6b                	jne    802d78 <page_is_clean+0x88>
+  802d0d:	89 da                	mov    %ebx,%edx
+  802d0f:	c1 ea 0c             	shr    $0xc,%edx
+  802d12:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802d19:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802d1e:	f6 c1 01             	test   $0x1,%cl
+  802d21:	74 5a                	je     802d7d <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802d23:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802d2a:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802d30:	75 4b                	jne    802d7d <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802d32:	89 d8                	mov    %ebx,%eax
+  802d34:	e8 6b ff ff ff       	call   802ca4 <segment_lookup>
+  802d39:	89 c2                	mov    %eax,%edx
+		return 1;
+  802d3b:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802d40:	85 d2                	test   %edx,%edx
+  802d42:	75 39                	jne    802d7d <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802d44:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  802d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4f:	eb 03                	jmp    802d54 <page_is_clean+0x64>
+  802d51:	83 c0 01             	add    $0x1,%eax
+  802d54:	39 c2                	cmp    %eax,%edx
+  802d56:	7e 19                	jle    802d71 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802d58:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  802d5f:	72 f0                	jb     802d51 <page_is_clean+0x61>
+  802d61:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  802d68:	73 e7                	jae    802d51 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802d6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d6f:	eb 0c                	jmp    802d7d <page_is_clean+0x8d>
+	return 0;
+  802d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d76:	eb 05                	jmp    802d7d <page_is_clean+0x8d>
+		return 0;
+  802d78:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d80:	c9                   	leave
+  802d81:	c3                   	ret
+
+00802d82 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802d82:	55                   	push   %ebp
+  802d83:	89 e5                	mov    %esp,%ebp
+  802d85:	57                   	push   %edi
+  802d86:	56                   	push   %esi
+  802d87:	53                   	push   %ebx
+  802d88:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d8b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d90:	eb 19                	jmp    802dab <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802d92:	f7 d3                	not    %ebx
+  802d94:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802d9a:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d9c:	83 c6 01             	add    $0x1,%esi
+  802d9f:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802da5:	0f 87 97 00 00 00    	ja     802e42 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802dab:	89 f3                	mov    %esi,%ebx
+  802dad:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  802db3:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802db9:	89 d8                	mov    %ebx,%eax
+  802dbb:	c1 e8 0a             	shr    $0xa,%eax
+  802dbe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802dc5:	25 81 00 00 00       	and    $0x81,%eax
+  802dca:	83 f8 01             	cmp    $0x1,%eax
+  802dcd:	75 c3                	jne    802d92 <linear_walk+0x10>
+  802dcf:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802dd5:	77 bb                	ja     802d92 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802dd7:	89 df                	mov    %ebx,%edi
+  802dd9:	c1 e7 0c             	shl    $0xc,%edi
+  802ddc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802ddf:	89 f8                	mov    %edi,%eax
+  802de1:	e8 0a ff ff ff       	call   802cf0 <page_is_clean>
+  802de6:	84 c0                	test   %al,%al
+  802de8:	75 64                	jne    802e4e <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802dea:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802df0:	77 aa                	ja     802d9c <linear_walk+0x1a>
+  802df2:	81 ff 2c 30 81 00    	cmp    $0x81302c,%edi
+  802df8:	72 a2                	jb     802d9c <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802dfa:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802e01:	a8 01                	test   $0x1,%al
+  802e03:	74 97                	je     802d9c <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e05:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802e0c:	f6 c4 04             	test   $0x4,%ah
+  802e0f:	75 8b                	jne    802d9c <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802e11:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802e18:	f6 c4 02             	test   $0x2,%ah
+  802e1b:	0f 85 7b ff ff ff    	jne    802d9c <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802e21:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802e28:	c1 e8 0c             	shr    $0xc,%eax
+  802e2b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802e2e:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802e33:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802e37:	66 83 f8 01          	cmp    $0x1,%ax
+  802e3b:	76 11                	jbe    802e4e <linear_walk+0xcc>
+  802e3d:	e9 5a ff ff ff       	jmp    802d9c <linear_walk+0x1a>
+  802e42:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802e47:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802e4e:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  802e54:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e57:	83 c4 1c             	add    $0x1c,%esp
+  802e5a:	5b                   	pop    %ebx
+  802e5b:	5e                   	pop    %esi
+  802e5c:	5f                   	pop    %edi
+  802e5d:	5d                   	pop    %ebp
+  802e5e:	c3                   	ret
+
+00802e5f <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802e5f:	55                   	push   %ebp
+  802e60:	89 e5                	mov    %esp,%ebp
+  802e62:	56                   	push   %esi
+  802e63:	53                   	push   %ebx
+  802e64:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802e66:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802e6b:	83 e0 7f             	and    $0x7f,%eax
+  802e6e:	c1 e0 04             	shl    $0x4,%eax
+  802e71:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802e77:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802e7d:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802e83:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802e89:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802e8e:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802e91:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802e96:	83 c0 01             	add    $0x1,%eax
+  802e99:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802e9e:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802ea1:	5b                   	pop    %ebx
+  802ea2:	5e                   	pop    %esi
+  802ea3:	5d                   	pop    %ebp
+  802ea4:	c3                   	ret
+
+00802ea5 <page_ring_enter>:
+{
+  802ea5:	55                   	push   %ebp
+  802ea6:	89 e5                	mov    %esp,%ebp
+  802ea8:	57                   	push   %edi
+  802ea9:	56                   	push   %esi
+  802eaa:	53                   	push   %ebx
+  802eab:	83 ec 18             	sub    $0x18,%esp
+  802eae:	89 c6                	mov    %eax,%esi
+  802eb0:	89 d7                	mov    %edx,%edi
+  802eb2:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802eb4:	6a 00                	push   $0x0
+  802eb6:	6a 00                	push   $0x0
+  802eb8:	6a 00                	push   $0x0
+  802eba:	6a 07                	push   $0x7
+  802ebc:	ff 35 40 c0 80 00    	push   0x80c040
+  802ec2:	e8 8e 26 00 00       	call   805555 <ipc_call>
+  802ec7:	83 c4 20             	add    $0x20,%esp
+  802eca:	85 c0                	test   %eax,%eax
+  802ecc:	79 22                	jns    802ef0 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802ece:	50                   	push   %eax
+  802ecf:	68 07 61 80 00       	push   $0x806107
+  802ed4:	68 13 02 00 00       	push   $0x213
+  802ed9:	68 1b 61 80 00       	push   $0x80611b
+  802ede:	e8 a7 d7 ff ff       	call   80068a <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802ee3:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802ee8:	83 c0 01             	add    $0x1,%eax
+  802eeb:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802ef0:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802ef6:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802efb:	39 c2                	cmp    %eax,%edx
+  802efd:	74 24                	je     802f23 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802eff:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802f04:	83 e0 7f             	and    $0x7f,%eax
+  802f07:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802f0e:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802f15:	29 f0                	sub    %esi,%eax
+  802f17:	39 d8                	cmp    %ebx,%eax
+  802f19:	73 c8                	jae    802ee3 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802f1b:	8b 52 04             	mov    0x4(%edx),%edx
+  802f1e:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802f21:	eb c0                	jmp    802ee3 <page_ring_enter+0x3e>
+}
+  802f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f26:	5b                   	pop    %ebx
+  802f27:	5e                   	pop    %esi
+  802f28:	5f                   	pop    %edi
+  802f29:	5d                   	pop    %ebp
+  802f2a:	c3                   	ret
+
+00802f2b <page_ring_reserve>:
+{
+  802f2b:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802f2d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802f32:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802f38:	29 d0                	sub    %edx,%eax
+  802f3a:	ba 80 00 00 00       	mov    $0x80,%edx
+  802f3f:	29 ca                	sub    %ecx,%edx
+  802f41:	39 c2                	cmp    %eax,%edx
+  802f43:	72 01                	jb     802f46 <page_ring_reserve+0x1b>
+  802f45:	c3                   	ret
+{
+  802f46:	55                   	push   %ebp
+  802f47:	89 e5                	mov    %esp,%ebp
+  802f49:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802f4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f51:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f5b:	e8 45 ff ff ff       	call   802ea5 <page_ring_enter>
+}
+  802f60:	c9                   	leave
+  802f61:	c3                   	ret
+
+00802f62 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802f62:	55                   	push   %ebp
+  802f63:	89 e5                	mov    %esp,%ebp
+  802f65:	53                   	push   %ebx
+  802f66:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802f69:	6a 07                	push   $0x7
+  802f6b:	6a 01                	push   $0x1
+  802f6d:	89 c3                	mov    %eax,%ebx
+  802f6f:	c1 e3 0c             	shl    $0xc,%ebx
+  802f72:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802f78:	52                   	push   %edx
+  802f79:	6a 04                	push   $0x4
+  802f7b:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802f82:	e8 ce 25 00 00       	call   805555 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802f87:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802f8e:	00 00 00 
+	return r;
+}
+  802f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f94:	c9                   	leave
+  802f95:	c3                   	ret
+
+00802f96 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802f96:	55                   	push   %ebp
+  802f97:	89 e5                	mov    %esp,%ebp
+  802f99:	56                   	push   %esi
+  802f9a:	53                   	push   %ebx
+  802f9b:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802f9d:	c1 e8 10             	shr    $0x10,%eax
+  802fa0:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802fa3:	89 c2                	mov    %eax,%edx
+  802fa5:	c1 e2 0c             	shl    $0xc,%edx
+  802fa8:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802fae:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802fb1:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802fb7:	89 c2                	mov    %eax,%edx
+  802fb9:	c1 e2 0a             	shl    $0xa,%edx
+  802fbc:	01 f2                	add    %esi,%edx
+  802fbe:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802fc5:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802fcb:	74 09                	je     802fd6 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802fcd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fd2:	5b                   	pop    %ebx
+  802fd3:	5e                   	pop    %esi
+  802fd4:	5d                   	pop    %ebp
+  802fd5:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802fd6:	e8 87 ff ff ff       	call   802f62 <page_share_send>
+  802fdb:	eb f5                	jmp    802fd2 <page_share_slot+0x3c>
+
+00802fdd <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802fdd:	a1 24 19 81 00       	mov    0x811924,%eax
+  802fe2:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802fe5:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802fea:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802ff0:	74 09                	je     802ffb <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802ff2:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802ff7:	85 c0                	test   %eax,%eax
+  802ff9:	75 01                	jne    802ffc <page_ring_ready+0x1f>
+}
+  802ffb:	c3                   	ret
+{
+  802ffc:	55                   	push   %ebp
+  802ffd:	89 e5                	mov    %esp,%ebp
+  802fff:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  803002:	68 07 06 00 00       	push   $0x607
+  803007:	6a 08                	push   $0x8
+  803009:	68 00 30 ad de       	push   $0xdead3000
+  80300e:	6a 00                	push   $0x0
+  803010:	e8 55 e3 ff ff       	call   80136a <sys_page_alloc_range>
+  803015:	83 c4 10             	add    $0x10,%esp
+  803018:	83 f8 08             	cmp    $0x8,%eax
+  80301b:	74 1b                	je     803038 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  80301d:	83 ec 04             	sub    $0x4,%esp
+  803020:	6a 08                	push   $0x8
+  803022:	68 00 30 ad de       	push   $0xdead3000
+  803027:	6a 00                	push   $0x0
+  803029:	e8 aa e3 ff ff       	call   8013d8 <sys_page_unmap_range>
+		return 0;
+  80302e:	83 c4 10             	add    $0x10,%esp
+  803031:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803036:	c9                   	leave
+  803037:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  803038:	83 ec 0c             	sub    $0xc,%esp
+  80303b:	68 07 04 00 00       	push   $0x407
+  803040:	6a 08                	push   $0x8
+  803042:	68 00 30 ad de       	push   $0xdead3000
+  803047:	6a 06                	push   $0x6
+  803049:	ff 35 40 c0 80 00    	push   0x80c040
+  80304f:	e8 01 25 00 00       	call   805555 <ipc_call>
+  803054:	83 c4 20             	add    $0x20,%esp
+  803057:	85 c0                	test   %eax,%eax
+  803059:	78 14                	js     80306f <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  80305b:	a1 24 19 81 00       	mov    0x811924,%eax
+  803060:	8b 40 48             	mov    0x48(%eax),%eax
+  803063:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  803068:	b8 01 00 00 00       	mov    $0x1,%eax
+  80306d:	eb c7                	jmp    803036 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  80306f:	83 ec 04             	sub    $0x4,%esp
+  803072:	6a 08                	push   $0x8
+  803074:	68 00 30 ad de       	push   $0xdead3000
+  803079:	6a 00                	push   $0x0
+  80307b:	e8 58 e3 ff ff       	call   8013d8 <sys_page_unmap_range>
+		return 0;
+  803080:	83 c4 10             	add    $0x10,%esp
+  803083:	b8 00 00 00 00       	mov    $0x0,%eax
+  803088:	eb ac                	jmp    803036 <page_ring_ready+0x59>
+
+0080308a <page_remove_slot>:
+{
+  80308a:	55                   	push   %ebp
+  80308b:	89 e5                	mov    %esp,%ebp
+  80308d:	56                   	push   %esi
+  80308e:	53                   	push   %ebx
+  80308f:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803091:	89 c6                	mov    %eax,%esi
+  803093:	c1 ee 10             	shr    $0x10,%esi
+  803096:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  803099:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  8030a0:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  8030a6:	74 2a                	je     8030d2 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8030a8:	83 ec 0c             	sub    $0xc,%esp
+  8030ab:	6a 00                	push   $0x0
+  8030ad:	6a 00                	push   $0x0
+  8030af:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8030b1:	c1 e3 04             	shl    $0x4,%ebx
+  8030b4:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8030b7:	53                   	push   %ebx
+  8030b8:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  8030bf:	e8 91 24 00 00       	call   805555 <ipc_call>
+  8030c4:	83 c4 20             	add    $0x20,%esp
+  8030c7:	85 c0                	test   %eax,%eax
+  8030c9:	78 2d                	js     8030f8 <page_remove_slot+0x6e>
+}
+  8030cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030ce:	5b                   	pop    %ebx
+  8030cf:	5e                   	pop    %esi
+  8030d0:	5d                   	pop    %ebp
+  8030d1:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8030d2:	e8 06 ff ff ff       	call   802fdd <page_ring_ready>
+  8030d7:	85 c0                	test   %eax,%eax
+  8030d9:	74 cd                	je     8030a8 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  8030db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030e0:	e8 46 fe ff ff       	call   802f2b <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  8030e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030ea:	89 da                	mov    %ebx,%edx
+  8030ec:	b8 02 00 00 00       	mov    $0x2,%eax
+  8030f1:	e8 69 fd ff ff       	call   802e5f <page_ring_post>
+		return;
+  8030f6:	eb d3                	jmp    8030cb <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  8030f8:	50                   	push   %eax
+  8030f9:	68 74 61 80 00       	push   $0x806174
+  8030fe:	68 ac 03 00 00       	push   $0x3ac
+  803103:	68 1b 61 80 00       	push   $0x80611b
+  803108:	e8 7d d5 ff ff       	call   80068a <_panic>
+
+0080310d <find_paging_env>:
+	if(pagingenv)
+  80310d:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  803112:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  803114:	85 c0                	test   %eax,%eax
+  803116:	74 05                	je     80311d <find_paging_env+0x10>
+  803118:	eb 56                	jmp    803170 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  80311a:	83 c0 01             	add    $0x1,%eax
+  80311d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803122:	7f 47                	jg     80316b <find_paging_env+0x5e>
+  803124:	83 f9 01             	cmp    $0x1,%ecx
+  803127:	7f 42                	jg     80316b <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  803129:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  80312c:	c1 e2 06             	shl    $0x6,%edx
+  80312f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803135:	8b 52 50             	mov    0x50(%edx),%edx
+  803138:	83 fa 02             	cmp    $0x2,%edx
+  80313b:	75 dd                	jne    80311a <find_paging_env+0xd>
+  80313d:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803140:	c1 e2 06             	shl    $0x6,%edx
+  803143:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803149:	8b 52 54             	mov    0x54(%edx),%edx
+  80314c:	85 d2                	test   %edx,%edx
+  80314e:	74 ca                	je     80311a <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  803150:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803153:	c1 e2 06             	shl    $0x6,%edx
+  803156:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80315c:	8b 52 48             	mov    0x48(%edx),%edx
+  80315f:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  803166:	8d 49 01             	lea    0x1(%ecx),%ecx
+  803169:	eb af                	jmp    80311a <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  80316b:	83 f9 02             	cmp    $0x2,%ecx
+  80316e:	74 01                	je     803171 <find_paging_env+0x64>
+}
+  803170:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  803171:	a1 24 19 81 00       	mov    0x811924,%eax
+  803176:	8b 40 48             	mov    0x48(%eax),%eax
+  803179:	83 e0 01             	and    $0x1,%eax
+  80317c:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  803183:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  803188:	eb e6                	jmp    803170 <find_paging_env+0x63>
+
+0080318a <page_add_backed>:
+{
+  80318a:	55                   	push   %ebp
+  80318b:	89 e5                	mov    %esp,%ebp
+  80318d:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  803190:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  803195:	83 f8 04             	cmp    $0x4,%eax
+  803198:	74 35                	je     8031cf <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  80319a:	89 d1                	mov    %edx,%ecx
+  80319c:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8031a2:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8031a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8031ac:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8031b3:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8031b9:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  8031c0:	83 c0 01             	add    $0x1,%eax
+  8031c3:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  8031c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031cd:	5d                   	pop    %ebp
+  8031ce:	c3                   	ret
+		return -E_NO_MEM;
+  8031cf:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8031d4:	eb f7                	jmp    8031cd <page_add_backed+0x43>
+
+008031d6 <percentage_of_pgdir_to_walk>:
+{
+  8031d6:	55                   	push   %ebp
+  8031d7:	89 e5                	mov    %esp,%ebp
+  8031d9:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8031dc:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  8031e0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  8031e3:	db 45 fc             	fildl  -0x4(%ebp)
+  8031e6:	d8 35 00 66 80 00    	fdivs  0x806600
+	return ret*ret;
+  8031ec:	d8 c8                	fmul   %st(0),%st
+}
+  8031ee:	c9                   	leave
+  8031ef:	c3                   	ret
+
+008031f0 <nfu_with_aging_page_choice_func>:
+{
+  8031f0:	55                   	push   %ebp
+  8031f1:	89 e5                	mov    %esp,%ebp
+  8031f3:	57                   	push   %edi
+  8031f4:	56                   	push   %esi
+  8031f5:	53                   	push   %ebx
+  8031f6:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031f9:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  8031ff:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803201:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80320b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803212:	ba 00 00 00 00       	mov    $0x0,%edx
+  803217:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80321a:	eb 18                	jmp    803234 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80321c:	f7 d0                	not    %eax
+  80321e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803223:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803225:	83 c2 01             	add    $0x1,%edx
+  803228:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80322e:	0f 87 13 01 00 00    	ja     803347 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  803234:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803238:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80323b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803240:	89 c1                	mov    %eax,%ecx
+  803242:	c1 e9 0a             	shr    $0xa,%ecx
+  803245:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80324c:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803252:	83 f9 01             	cmp    $0x1,%ecx
+  803255:	75 c5                	jne    80321c <nfu_with_aging_page_choice_func+0x2c>
+  803257:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80325c:	77 be                	ja     80321c <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  80325e:	89 c1                	mov    %eax,%ecx
+  803260:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803263:	81 f9 2c 30 81 00    	cmp    $0x81302c,%ecx
+  803269:	0f 82 a5 00 00 00    	jb     803314 <nfu_with_aging_page_choice_func+0x124>
+  80326f:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803275:	0f 87 99 00 00 00    	ja     803314 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80327b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803282:	f6 c1 01             	test   $0x1,%cl
+  803285:	0f 84 89 00 00 00    	je     803314 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80328b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803292:	f6 c5 04             	test   $0x4,%ch
+  803295:	75 7d                	jne    803314 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803297:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80329e:	f6 c5 02             	test   $0x2,%ch
+  8032a1:	75 71                	jne    803314 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8032a3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032aa:	c1 e9 0c             	shr    $0xc,%ecx
+  8032ad:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032b0:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032b6:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8032ba:	66 83 f9 01          	cmp    $0x1,%cx
+  8032be:	77 54                	ja     803314 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  8032c0:	89 f9                	mov    %edi,%ecx
+  8032c2:	80 f9 ff             	cmp    $0xff,%cl
+  8032c5:	74 21                	je     8032e8 <nfu_with_aging_page_choice_func+0xf8>
+  8032c7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032ce:	c1 e9 0c             	shr    $0xc,%ecx
+  8032d1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032d4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032da:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  8032de:	89 fb                	mov    %edi,%ebx
+  8032e0:	38 d9                	cmp    %bl,%cl
+  8032e2:	73 30                	jae    803314 <nfu_with_aging_page_choice_func+0x124>
+  8032e4:	dd d8                	fstp   %st(0)
+  8032e6:	eb 02                	jmp    8032ea <nfu_with_aging_page_choice_func+0xfa>
+  8032e8:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  8032ea:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032f1:	c1 e9 0c             	shr    $0xc,%ecx
+  8032f4:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032f7:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8032fe:	89 fb                	mov    %edi,%ebx
+  803300:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803303:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803306:	db 45 e0             	fildl  -0x20(%ebp)
+  803309:	d8 35 00 66 80 00    	fdivs  0x806600
+	return ret*ret;
+  80330f:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803311:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803314:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803317:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80331a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803321:	df 6d e0             	fildll -0x20(%ebp)
+  803324:	d9 c1                	fld    %st(1)
+  803326:	d8 0d 04 66 80 00    	fmuls  0x806604
+  80332c:	d9 c9                	fxch   %st(1)
+  80332e:	df f1                	fcomip %st(1),%st
+  803330:	dd d8                	fstp   %st(0)
+  803332:	0f 82 ed fe ff ff    	jb     803225 <nfu_with_aging_page_choice_func+0x35>
+  803338:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80333a:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  80333f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803342:	c1 e0 0c             	shl    $0xc,%eax
+  803345:	eb 0e                	jmp    803355 <nfu_with_aging_page_choice_func+0x165>
+  803347:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803349:	89 f8                	mov    %edi,%eax
+  80334b:	3c ff                	cmp    $0xff,%al
+  80334d:	74 0e                	je     80335d <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  80334f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803352:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803355:	83 c4 14             	add    $0x14,%esp
+  803358:	5b                   	pop    %ebx
+  803359:	5e                   	pop    %esi
+  80335a:	5f                   	pop    %edi
+  80335b:	5d                   	pop    %ebp
+  80335c:	c3                   	ret
+	pgnum = 0;
+  80335d:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  803364:	00 00 00 
+	return (void*)UTOP;
+  803367:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80336c:	eb e7                	jmp    803355 <nfu_with_aging_page_choice_func+0x165>
+
+0080336e <myRand>:
+    state = state * 1664525 + 1013904223;
+  80336e:	69 05 40 70 80 00 0d 	imul   $0x19660d,0x807040,%eax
+  803375:	66 19 00 
+  803378:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  80337d:	a3 40 70 80 00       	mov    %eax,0x807040
+    return state >> 24;
+  803382:	c1 e8 18             	shr    $0x18,%eax
+}
+  803385:	c3                   	ret
+
+00803386 <random_page_choice_func>:
+{
+  803386:	55                   	push   %ebp
+  803387:	89 e5                	mov    %esp,%ebp
+  803389:	57                   	push   %edi
+  80338a:	56                   	push   %esi
+  80338b:	53                   	push   %ebx
+  80338c:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80338f:	be 00 00 00 00       	mov    $0x0,%esi
+  803394:	eb 19                	jmp    8033af <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803396:	f7 d3                	not    %ebx
+  803398:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80339e:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8033a0:	83 c6 01             	add    $0x1,%esi
+  8033a3:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8033a9:	0f 87 a0 00 00 00    	ja     80344f <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8033af:	89 f3                	mov    %esi,%ebx
+  8033b1:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  8033b7:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8033bd:	89 d8                	mov    %ebx,%eax
+  8033bf:	c1 e8 0a             	shr    $0xa,%eax
+  8033c2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8033c9:	25 81 00 00 00       	and    $0x81,%eax
+  8033ce:	83 f8 01             	cmp    $0x1,%eax
+  8033d1:	75 c3                	jne    803396 <random_page_choice_func+0x10>
+  8033d3:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8033d9:	77 bb                	ja     803396 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8033db:	89 df                	mov    %ebx,%edi
+  8033dd:	c1 e7 0c             	shl    $0xc,%edi
+  8033e0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8033e3:	89 f8                	mov    %edi,%eax
+  8033e5:	e8 06 f9 ff ff       	call   802cf0 <page_is_clean>
+  8033ea:	84 c0                	test   %al,%al
+  8033ec:	0f 85 82 00 00 00    	jne    803474 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8033f2:	81 ff 2c 30 81 00    	cmp    $0x81302c,%edi
+  8033f8:	72 a6                	jb     8033a0 <random_page_choice_func+0x1a>
+  8033fa:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  803400:	77 9e                	ja     8033a0 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803402:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803409:	a8 01                	test   $0x1,%al
+  80340b:	74 93                	je     8033a0 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80340d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803414:	f6 c4 04             	test   $0x4,%ah
+  803417:	75 87                	jne    8033a0 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803419:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803420:	f6 c4 02             	test   $0x2,%ah
+  803423:	0f 85 77 ff ff ff    	jne    8033a0 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803429:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803430:	c1 e8 0c             	shr    $0xc,%eax
+  803433:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803436:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80343b:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80343f:	66 83 f8 01          	cmp    $0x1,%ax
+  803443:	0f 87 57 ff ff ff    	ja     8033a0 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  803449:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80344f:	e8 1a ff ff ff       	call   80336e <myRand>
+  803454:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  80345a:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  80345f:	29 fe                	sub    %edi,%esi
+  803461:	0f be c0             	movsbl %al,%eax
+  803464:	ba 00 00 00 00       	mov    $0x0,%edx
+  803469:	f7 f6                	div    %esi
+  80346b:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  80346d:	bb 15 00 00 00       	mov    $0x15,%ebx
+  803472:	eb 1c                	jmp    803490 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  803474:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  80347a:	e9 8f 00 00 00       	jmp    80350e <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80347f:	e8 ea fe ff ff       	call   80336e <myRand>
+  803484:	0f be c0             	movsbl %al,%eax
+  803487:	ba 00 00 00 00       	mov    $0x0,%edx
+  80348c:	f7 f6                	div    %esi
+  80348e:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803490:	83 eb 01             	sub    $0x1,%ebx
+  803493:	0f 84 c2 00 00 00    	je     80355b <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  803499:	89 d0                	mov    %edx,%eax
+  80349b:	c1 e8 0a             	shr    $0xa,%eax
+  80349e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8034a5:	25 81 00 00 00       	and    $0x81,%eax
+  8034aa:	83 f8 01             	cmp    $0x1,%eax
+  8034ad:	75 d0                	jne    80347f <random_page_choice_func+0xf9>
+  8034af:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8034b5:	77 c8                	ja     80347f <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8034b7:	89 d0                	mov    %edx,%eax
+  8034b9:	c1 e0 0c             	shl    $0xc,%eax
+  8034bc:	3d 2c 30 81 00       	cmp    $0x81302c,%eax
+  8034c1:	72 56                	jb     803519 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8034c3:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8034c8:	77 65                	ja     80352f <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8034ca:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8034d1:	f6 c1 01             	test   $0x1,%cl
+  8034d4:	74 59                	je     80352f <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8034d6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8034dd:	f6 c5 04             	test   $0x4,%ch
+  8034e0:	75 4d                	jne    80352f <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  8034e2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8034e9:	f6 c5 02             	test   $0x2,%ch
+  8034ec:	75 41                	jne    80352f <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  8034ee:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8034f5:	c1 ea 0c             	shr    $0xc,%edx
+  8034f8:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8034fb:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  803501:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  803505:	66 83 fa 01          	cmp    $0x1,%dx
+  803509:	77 3a                	ja     803545 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  80350b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  80350e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803511:	83 c4 1c             	add    $0x1c,%esp
+  803514:	5b                   	pop    %ebx
+  803515:	5e                   	pop    %esi
+  803516:	5f                   	pop    %edi
+  803517:	5d                   	pop    %ebp
+  803518:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803519:	e8 50 fe ff ff       	call   80336e <myRand>
+  80351e:	0f be c0             	movsbl %al,%eax
+  803521:	ba 00 00 00 00       	mov    $0x0,%edx
+  803526:	f7 f6                	div    %esi
+  803528:	01 fa                	add    %edi,%edx
+			continue;
+  80352a:	e9 61 ff ff ff       	jmp    803490 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  80352f:	e8 3a fe ff ff       	call   80336e <myRand>
+  803534:	0f be c0             	movsbl %al,%eax
+  803537:	ba 00 00 00 00       	mov    $0x0,%edx
+  80353c:	f7 f6                	div    %esi
+  80353e:	01 fa                	add    %edi,%edx
+			continue;
+  803540:	e9 4b ff ff ff       	jmp    803490 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803545:	e8 24 fe ff ff       	call   80336e <myRand>
+  80354a:	0f be c0             	movsbl %al,%eax
+  80354d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803552:	f7 f6                	div    %esi
+  803554:	01 fa                	add    %edi,%edx
+			continue;
+  803556:	e9 35 ff ff ff       	jmp    803490 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  80355b:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  803562:	00 00 00 
+	return (void*)UTOP;
+  803565:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  80356c:	eb a0                	jmp    80350e <random_page_choice_func+0x188>
+
+0080356e <nfu>:
+{
+  80356e:	55                   	push   %ebp
+  80356f:	89 e5                	mov    %esp,%ebp
+  803571:	57                   	push   %edi
+  803572:	56                   	push   %esi
+  803573:	53                   	push   %ebx
+  803574:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803577:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  80357d:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  80357f:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803584:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803589:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803590:	ba 00 00 00 00       	mov    $0x0,%edx
+  803595:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803598:	eb 18                	jmp    8035b2 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80359a:	f7 d0                	not    %eax
+  80359c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8035a1:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8035a3:	83 c2 01             	add    $0x1,%edx
+  8035a6:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8035ac:	0f 87 13 01 00 00    	ja     8036c5 <nfu+0x157>
+		++num_searched_ptes;
+  8035b2:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8035b6:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8035b9:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8035be:	89 c1                	mov    %eax,%ecx
+  8035c0:	c1 e9 0a             	shr    $0xa,%ecx
+  8035c3:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8035ca:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8035d0:	83 f9 01             	cmp    $0x1,%ecx
+  8035d3:	75 c5                	jne    80359a <nfu+0x2c>
+  8035d5:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8035da:	77 be                	ja     80359a <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8035dc:	89 c1                	mov    %eax,%ecx
+  8035de:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8035e1:	81 f9 2c 30 81 00    	cmp    $0x81302c,%ecx
+  8035e7:	0f 82 a5 00 00 00    	jb     803692 <nfu+0x124>
+  8035ed:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8035f3:	0f 87 99 00 00 00    	ja     803692 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8035f9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803600:	f6 c1 01             	test   $0x1,%cl
+  803603:	0f 84 89 00 00 00    	je     803692 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803609:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803610:	f6 c5 04             	test   $0x4,%ch
+  803613:	75 7d                	jne    803692 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803615:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80361c:	f6 c5 02             	test   $0x2,%ch
+  80361f:	75 71                	jne    803692 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803621:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803628:	c1 e9 0c             	shr    $0xc,%ecx
+  80362b:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80362e:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803634:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803638:	66 83 f9 01          	cmp    $0x1,%cx
+  80363c:	77 54                	ja     803692 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  80363e:	89 f9                	mov    %edi,%ecx
+  803640:	80 f9 ff             	cmp    $0xff,%cl
+  803643:	74 21                	je     803666 <nfu+0xf8>
+  803645:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80364c:	c1 e9 0c             	shr    $0xc,%ecx
+  80364f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803652:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803658:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  80365c:	89 fb                	mov    %edi,%ebx
+  80365e:	38 d9                	cmp    %bl,%cl
+  803660:	73 30                	jae    803692 <nfu+0x124>
+  803662:	dd d8                	fstp   %st(0)
+  803664:	eb 02                	jmp    803668 <nfu+0xfa>
+  803666:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803668:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80366f:	c1 e9 0c             	shr    $0xc,%ecx
+  803672:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803675:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  80367c:	89 fb                	mov    %edi,%ebx
+  80367e:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803681:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803684:	db 45 e0             	fildl  -0x20(%ebp)
+  803687:	d8 35 00 66 80 00    	fdivs  0x806600
+	return ret*ret;
+  80368d:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80368f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803692:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803695:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803698:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80369f:	df 6d e0             	fildll -0x20(%ebp)
+  8036a2:	d9 c1                	fld    %st(1)
+  8036a4:	d8 0d 04 66 80 00    	fmuls  0x806604
+  8036aa:	d9 c9                	fxch   %st(1)
+  8036ac:	df f1                	fcomip %st(1),%st
+  8036ae:	dd d8                	fstp   %st(0)
+  8036b0:	0f 82 ed fe ff ff    	jb     8035a3 <nfu+0x35>
+  8036b6:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  8036b8:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  8036bd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8036c0:	c1 e0 0c             	shl    $0xc,%eax
+  8036c3:	eb 0e                	jmp    8036d3 <nfu+0x165>
+  8036c5:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8036c7:	89 f8                	mov    %edi,%eax
+  8036c9:	3c ff                	cmp    $0xff,%al
+  8036cb:	74 0e                	je     8036db <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8036cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8036d0:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8036d3:	83 c4 14             	add    $0x14,%esp
+  8036d6:	5b                   	pop    %ebx
+  8036d7:	5e                   	pop    %esi
+  8036d8:	5f                   	pop    %edi
+  8036d9:	5d                   	pop    %ebp
+  8036da:	c3                   	ret
+	pgnum = 0;
+  8036db:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  8036e2:	00 00 00 
+	return (void*)UTOP;
+  8036e5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8036ea:	eb e7                	jmp    8036d3 <nfu+0x165>
+
+008036ec <lru>:
+{
+  8036ec:	55                   	push   %ebp
+  8036ed:	89 e5                	mov    %esp,%ebp
+  8036ef:	57                   	push   %edi
+  8036f0:	56                   	push   %esi
+  8036f1:	53                   	push   %ebx
+  8036f2:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8036f5:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  8036fb:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  803702:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803709:	be 00 00 00 00       	mov    $0x0,%esi
+  80370e:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803715:	ba 00 00 00 00       	mov    $0x0,%edx
+  80371a:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  80371d:	eb 18                	jmp    803737 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80371f:	f7 d0                	not    %eax
+  803721:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803726:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803728:	83 c2 01             	add    $0x1,%edx
+  80372b:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803731:	0f 87 fa 00 00 00    	ja     803831 <lru+0x145>
+		++num_searched_ptes;
+  803737:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80373a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80373d:	01 d0                	add    %edx,%eax
+  80373f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803744:	89 c1                	mov    %eax,%ecx
+  803746:	c1 e9 0a             	shr    $0xa,%ecx
+  803749:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803750:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803756:	83 f9 01             	cmp    $0x1,%ecx
+  803759:	75 c4                	jne    80371f <lru+0x33>
+  80375b:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803760:	77 bd                	ja     80371f <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803762:	89 c1                	mov    %eax,%ecx
+  803764:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803767:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80376d:	0f 87 92 00 00 00    	ja     803805 <lru+0x119>
+  803773:	81 f9 2c 30 81 00    	cmp    $0x81302c,%ecx
+  803779:	0f 82 86 00 00 00    	jb     803805 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80377f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803786:	f6 c1 01             	test   $0x1,%cl
+  803789:	74 7a                	je     803805 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80378b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803792:	f6 c5 04             	test   $0x4,%ch
+  803795:	75 6e                	jne    803805 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803797:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80379e:	f6 c5 02             	test   $0x2,%ch
+  8037a1:	75 62                	jne    803805 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8037a3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8037aa:	c1 e9 0c             	shr    $0xc,%ecx
+  8037ad:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8037b0:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8037b6:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8037ba:	66 83 f9 01          	cmp    $0x1,%cx
+  8037be:	77 45                	ja     803805 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  8037c0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8037c7:	c1 e9 0c             	shr    $0xc,%ecx
+  8037ca:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8037cd:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8037d3:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8037d6:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8037d9:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8037dc:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8037df:	19 df                	sbb    %ebx,%edi
+  8037e1:	7c 22                	jl     803805 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8037e3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8037ea:	c1 e9 0c             	shr    $0xc,%ecx
+  8037ed:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8037f0:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8037f6:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8037f9:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8037fc:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8037ff:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803802:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803805:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  803808:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80380f:	df 6d e0             	fildll -0x20(%ebp)
+  803812:	d9 05 04 66 80 00    	flds   0x806604
+  803818:	d9 c9                	fxch   %st(1)
+  80381a:	df f1                	fcomip %st(1),%st
+  80381c:	dd d8                	fstp   %st(0)
+  80381e:	0f 82 04 ff ff ff    	jb     803728 <lru+0x3c>
+			pgnum = pgnum_actual;
+  803824:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  803829:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80382c:	c1 e0 0c             	shl    $0xc,%eax
+  80382f:	eb 06                	jmp    803837 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  803831:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803834:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803837:	83 c4 1c             	add    $0x1c,%esp
+  80383a:	5b                   	pop    %ebx
+  80383b:	5e                   	pop    %esi
+  80383c:	5f                   	pop    %edi
+  80383d:	5d                   	pop    %ebp
+  80383e:	c3                   	ret
+
+0080383f <set_page_choice_func>:
+{
+  80383f:	55                   	push   %ebp
+  803840:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  803842:	8b 45 08             	mov    0x8(%ebp),%eax
+  803845:	a3 3c 70 80 00       	mov    %eax,0x80703c
+}
+  80384a:	5d                   	pop    %ebp
+  80384b:	c3                   	ret
+
+0080384c <get_page_choice>:
+{
+  80384c:	55                   	push   %ebp
+  80384d:	89 e5                	mov    %esp,%ebp
+  80384f:	57                   	push   %edi
+  803850:	56                   	push   %esi
+  803851:	53                   	push   %ebx
+  803852:	83 ec 24             	sub    $0x24,%esp
+  803855:	8b 75 08             	mov    0x8(%ebp),%esi
+  803858:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  80385b:	57                   	push   %edi
+  80385c:	56                   	push   %esi
+  80385d:	ff 15 3c 70 80 00    	call   *0x80703c
+  803863:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803865:	83 c4 10             	add    $0x10,%esp
+  803868:	eb 25                	jmp    80388f <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  80386a:	83 ec 08             	sub    $0x8,%esp
+  80386d:	c1 e0 16             	shl    $0x16,%eax
+  803870:	50                   	push   %eax
+  803871:	6a 00                	push   $0x0
+  803873:	e8 8e da ff ff       	call   801306 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803878:	83 c4 10             	add    $0x10,%esp
+  80387b:	85 c0                	test   %eax,%eax
+  80387d:	75 43                	jne    8038c2 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  80387f:	83 ec 08             	sub    $0x8,%esp
+  803882:	57                   	push   %edi
+  803883:	56                   	push   %esi
+  803884:	ff 15 3c 70 80 00    	call   *0x80703c
+  80388a:	89 c3                	mov    %eax,%ebx
+  80388c:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80388f:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803892:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803898:	0f 86 ae 00 00 00    	jbe    80394c <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80389e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  8038a3:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8038aa:	81 e2 81 00 00 00    	and    $0x81,%edx
+  8038b0:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  8038b6:	74 b2                	je     80386a <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8038b8:	83 c0 01             	add    $0x1,%eax
+  8038bb:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  8038c0:	75 e1                	jne    8038a3 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8038c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038c5:	05 00 10 40 11       	add    $0x11401000,%eax
+  8038ca:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8038cf:	76 1f                	jbe    8038f0 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8038d1:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8038d6:	89 d8                	mov    %ebx,%eax
+  8038d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038db:	5b                   	pop    %ebx
+  8038dc:	5e                   	pop    %esi
+  8038dd:	5f                   	pop    %edi
+  8038de:	5d                   	pop    %ebp
+  8038df:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8038e0:	83 ec 08             	sub    $0x8,%esp
+  8038e3:	53                   	push   %ebx
+  8038e4:	6a 00                	push   $0x0
+  8038e6:	e8 1b da ff ff       	call   801306 <sys_page_split>
+  8038eb:	83 c4 10             	add    $0x10,%esp
+  8038ee:	eb 6c                	jmp    80395c <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  8038f0:	83 ec 04             	sub    $0x4,%esp
+  8038f3:	68 ac 61 80 00       	push   $0x8061ac
+  8038f8:	68 cc 01 00 00       	push   $0x1cc
+  8038fd:	68 1b 61 80 00       	push   $0x80611b
+  803902:	e8 83 cd ff ff       	call   80068a <_panic>
+		panic("We tried to page out code pages\n");
+  803907:	83 ec 04             	sub    $0x4,%esp
+  80390a:	68 dc 61 80 00       	push   $0x8061dc
+  80390f:	68 d6 01 00 00       	push   $0x1d6
+  803914:	68 1b 61 80 00       	push   $0x80611b
+  803919:	e8 6c cd ff ff       	call   80068a <_panic>
+		panic("Invalid mapping for the va\n");
+  80391e:	83 ec 04             	sub    $0x4,%esp
+  803921:	68 28 61 80 00       	push   $0x806128
+  803926:	68 da 01 00 00       	push   $0x1da
+  80392b:	68 1b 61 80 00       	push   $0x80611b
+  803930:	e8 55 cd ff ff       	call   80068a <_panic>
+		panic("We tried to page out a shared page\n");
+  803935:	83 ec 04             	sub    $0x4,%esp
+  803938:	68 00 62 80 00       	push   $0x806200
+  80393d:	68 e0 01 00 00       	push   $0x1e0
+  803942:	68 1b 61 80 00       	push   $0x80611b
+  803947:	e8 3e cd ff ff       	call   80068a <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  80394c:	89 de                	mov    %ebx,%esi
+  80394e:	c1 ee 16             	shr    $0x16,%esi
+  803951:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803958:	a8 80                	test   $0x80,%al
+  80395a:	75 84                	jne    8038e0 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  80395c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80395f:	05 00 10 40 11       	add    $0x11401000,%eax
+  803964:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803969:	76 85                	jbe    8038f0 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  80396b:	89 d8                	mov    %ebx,%eax
+  80396d:	e8 7e f3 ff ff       	call   802cf0 <page_is_clean>
+  803972:	84 c0                	test   %al,%al
+  803974:	0f 85 5c ff ff ff    	jne    8038d6 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  80397a:	81 7d e4 2c 30 81 00 	cmpl   $0x81302c,-0x1c(%ebp)
+  803981:	76 84                	jbe    803907 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803983:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80398a:	a8 01                	test   $0x1,%al
+  80398c:	74 90                	je     80391e <get_page_choice+0xd2>
+  80398e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803991:	c1 e8 0c             	shr    $0xc,%eax
+  803994:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80399b:	f6 c2 01             	test   $0x1,%dl
+  80399e:	0f 84 7a ff ff ff    	je     80391e <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8039a4:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  8039ab:	f6 c2 01             	test   $0x1,%dl
+  8039ae:	74 85                	je     803935 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8039b0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8039b7:	f6 c2 01             	test   $0x1,%dl
+  8039ba:	0f 84 75 ff ff ff    	je     803935 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8039c0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8039c7:	f6 c6 04             	test   $0x4,%dh
+  8039ca:	0f 85 65 ff ff ff    	jne    803935 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  8039d0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8039d7:	f6 c6 02             	test   $0x2,%dh
+  8039da:	0f 85 55 ff ff ff    	jne    803935 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8039e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8039e7:	c1 e8 0c             	shr    $0xc,%eax
+  8039ea:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8039ed:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8039f2:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8039f6:	66 83 f8 01          	cmp    $0x1,%ax
+  8039fa:	0f 86 d6 fe ff ff    	jbe    8038d6 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  803a00:	83 ec 04             	sub    $0x4,%esp
+  803a03:	68 24 62 80 00       	push   $0x806224
+  803a08:	68 e2 01 00 00       	push   $0x1e2
+  803a0d:	68 1b 61 80 00       	push   $0x80611b
+  803a12:	e8 73 cc ff ff       	call   80068a <_panic>
+
+00803a17 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  803a17:	55                   	push   %ebp
+  803a18:	89 e5                	mov    %esp,%ebp
+  803a1a:	57                   	push   %edi
+  803a1b:	56                   	push   %esi
+  803a1c:	53                   	push   %ebx
+  803a1d:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  803a20:	e8 e8 f6 ff ff       	call   80310d <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803a25:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803a2a:	85 c0                	test   %eax,%eax
+  803a2c:	74 41                	je     803a6f <page_share_paged_out+0x58>
+  803a2e:	83 3d 20 19 81 00 00 	cmpl   $0x0,0x811920
+  803a35:	0f 84 fd 00 00 00    	je     803b38 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  803a3b:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803a42:	00 00 00 
+  803a45:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  803a4c:	00 00 00 
+  803a4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a54:	eb 2c                	jmp    803a82 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803a56:	83 c3 04             	add    $0x4,%ebx
+  803a59:	39 f3                	cmp    %esi,%ebx
+  803a5b:	74 1a                	je     803a77 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803a5d:	8b 03                	mov    (%ebx),%eax
+  803a5f:	a8 01                	test   $0x1,%al
+  803a61:	74 f3                	je     803a56 <page_share_paged_out+0x3f>
+  803a63:	c1 e8 0c             	shr    $0xc,%eax
+  803a66:	e8 2b f5 ff ff       	call   802f96 <page_share_slot>
+  803a6b:	85 c0                	test   %eax,%eax
+  803a6d:	79 e7                	jns    803a56 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  803a6f:	83 c4 0c             	add    $0xc,%esp
+  803a72:	5b                   	pop    %ebx
+  803a73:	5e                   	pop    %esi
+  803a74:	5f                   	pop    %edi
+  803a75:	5d                   	pop    %ebp
+  803a76:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803a77:	83 c7 04             	add    $0x4,%edi
+  803a7a:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  803a80:	74 1b                	je     803a9d <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803a82:	a1 20 19 81 00       	mov    0x811920,%eax
+  803a87:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803a8a:	f6 c3 01             	test   $0x1,%bl
+  803a8d:	74 e8                	je     803a77 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  803a8f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803a95:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803a9b:	eb bc                	jmp    803a59 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803a9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803aa2:	eb 11                	jmp    803ab5 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803aa4:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803aaa:	83 c3 01             	add    $0x1,%ebx
+  803aad:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803ab3:	77 41                	ja     803af6 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803ab5:	89 d8                	mov    %ebx,%eax
+  803ab7:	c1 e8 0a             	shr    $0xa,%eax
+  803aba:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803ac1:	25 81 00 00 00       	and    $0x81,%eax
+  803ac6:	83 f8 01             	cmp    $0x1,%eax
+  803ac9:	75 d9                	jne    803aa4 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803acb:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803ad2:	25 81 00 00 00       	and    $0x81,%eax
+  803ad7:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803adc:	75 cc                	jne    803aaa <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803ade:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803ae5:	c1 e8 0c             	shr    $0xc,%eax
+  803ae8:	e8 a9 f4 ff ff       	call   802f96 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803aed:	85 c0                	test   %eax,%eax
+  803aef:	79 b9                	jns    803aaa <page_share_paged_out+0x93>
+  803af1:	e9 79 ff ff ff       	jmp    803a6f <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803af6:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803afd:	75 13                	jne    803b12 <page_share_paged_out+0xfb>
+  803aff:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  803b06:	75 1d                	jne    803b25 <page_share_paged_out+0x10e>
+	return 0;
+  803b08:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b0d:	e9 5d ff ff ff       	jmp    803a6f <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803b12:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b17:	e8 46 f4 ff ff       	call   802f62 <page_share_send>
+  803b1c:	85 c0                	test   %eax,%eax
+  803b1e:	79 df                	jns    803aff <page_share_paged_out+0xe8>
+  803b20:	e9 4a ff ff ff       	jmp    803a6f <page_share_paged_out+0x58>
+  803b25:	b8 01 00 00 00       	mov    $0x1,%eax
+  803b2a:	e8 33 f4 ff ff       	call   802f62 <page_share_send>
+  803b2f:	85 c0                	test   %eax,%eax
+  803b31:	79 d5                	jns    803b08 <page_share_paged_out+0xf1>
+  803b33:	e9 37 ff ff ff       	jmp    803a6f <page_share_paged_out+0x58>
+		return 0;
+  803b38:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b3d:	e9 2d ff ff ff       	jmp    803a6f <page_share_paged_out+0x58>
+
+00803b42 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803b42:	55                   	push   %ebp
+  803b43:	89 e5                	mov    %esp,%ebp
+  803b45:	56                   	push   %esi
+  803b46:	53                   	push   %ebx
+  803b47:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803b4a:	e8 be f5 ff ff       	call   80310d <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803b4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803b54:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803b5b:	0f 84 82 00 00 00    	je     803be3 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803b61:	83 ec 0c             	sub    $0xc,%esp
+  803b64:	68 00 10 00 00       	push   $0x1000
+  803b69:	e8 84 11 00 00       	call   804cf2 <malloc>
+  803b6e:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803b70:	83 c4 0c             	add    $0xc,%esp
+  803b73:	6a 14                	push   $0x14
+  803b75:	6a 00                	push   $0x0
+  803b77:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803b7a:	50                   	push   %eax
+  803b7b:	e8 1d d3 ff ff       	call   800e9d <memset>
+  803b80:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803b83:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803b88:	83 ec 0c             	sub    $0xc,%esp
+  803b8b:	6a 07                	push   $0x7
+  803b8d:	6a 01                	push   $0x1
+  803b8f:	53                   	push   %ebx
+  803b90:	6a 03                	push   $0x3
+  803b92:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  803b99:	e8 b7 19 00 00       	call   805555 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803b9e:	8b 03                	mov    (%ebx),%eax
+  803ba0:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803ba3:	8b 43 04             	mov    0x4(%ebx),%eax
+  803ba6:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803ba9:	8b 43 08             	mov    0x8(%ebx),%eax
+  803bac:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803baf:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803bb2:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803bb5:	8b 43 10             	mov    0x10(%ebx),%eax
+  803bb8:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803bbb:	83 c6 01             	add    $0x1,%esi
+  803bbe:	83 c4 20             	add    $0x20,%esp
+  803bc1:	83 fe 02             	cmp    $0x2,%esi
+  803bc4:	75 c2                	jne    803b88 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803bc6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803bc9:	89 03                	mov    %eax,(%ebx)
+  803bcb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803bce:	89 43 04             	mov    %eax,0x4(%ebx)
+  803bd1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803bd4:	89 43 08             	mov    %eax,0x8(%ebx)
+  803bd7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803bda:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803bdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803be0:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803be3:	89 d8                	mov    %ebx,%eax
+  803be5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803be8:	5b                   	pop    %ebx
+  803be9:	5e                   	pop    %esi
+  803bea:	5d                   	pop    %ebp
+  803beb:	c3                   	ret
+
+00803bec <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803bec:	55                   	push   %ebp
+  803bed:	89 e5                	mov    %esp,%ebp
+  803bef:	53                   	push   %ebx
+  803bf0:	83 ec 10             	sub    $0x10,%esp
+  803bf3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803bf6:	68 42 61 80 00       	push   $0x806142
+  803bfb:	e8 65 cb ff ff       	call   800765 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803c00:	83 c4 08             	add    $0x8,%esp
+  803c03:	ff 33                	push   (%ebx)
+  803c05:	68 58 62 80 00       	push   $0x806258
+  803c0a:	e8 56 cb ff ff       	call   800765 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803c0f:	83 c4 08             	add    $0x8,%esp
+  803c12:	ff 73 04             	push   0x4(%ebx)
+  803c15:	68 44 61 80 00       	push   $0x806144
+  803c1a:	e8 46 cb ff ff       	call   800765 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803c1f:	83 c4 08             	add    $0x8,%esp
+  803c22:	ff 73 08             	push   0x8(%ebx)
+  803c25:	68 78 62 80 00       	push   $0x806278
+  803c2a:	e8 36 cb ff ff       	call   800765 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803c2f:	83 c4 08             	add    $0x8,%esp
+  803c32:	ff 73 0c             	push   0xc(%ebx)
+  803c35:	68 9c 62 80 00       	push   $0x80629c
+  803c3a:	e8 26 cb ff ff       	call   800765 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803c3f:	83 c4 08             	add    $0x8,%esp
+  803c42:	ff 73 10             	push   0x10(%ebx)
+  803c45:	68 c0 62 80 00       	push   $0x8062c0
+  803c4a:	e8 16 cb ff ff       	call   800765 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803c4f:	83 c4 08             	add    $0x8,%esp
+  803c52:	ff 35 08 c0 80 00    	push   0x80c008
+  803c58:	68 fc 62 80 00       	push   $0x8062fc
+  803c5d:	e8 03 cb ff ff       	call   800765 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803c62:	83 c4 08             	add    $0x8,%esp
+  803c65:	ff 35 04 c0 80 00    	push   0x80c004
+  803c6b:	68 30 63 80 00       	push   $0x806330
+  803c70:	e8 f0 ca ff ff       	call   800765 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803c75:	a1 24 19 81 00       	mov    0x811924,%eax
+  803c7a:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803c7d:	8b 50 68             	mov    0x68(%eax),%edx
+  803c80:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803c83:	51                   	push   %ecx
+  803c84:	52                   	push   %edx
+  803c85:	50                   	push   %eax
+  803c86:	68 70 63 80 00       	push   $0x806370
+  803c8b:	e8 d5 ca ff ff       	call   800765 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803c90:	a1 24 19 81 00       	mov    0x811924,%eax
+  803c95:	8b 40 70             	mov    0x70(%eax),%eax
+  803c98:	83 c4 18             	add    $0x18,%esp
+  803c9b:	50                   	push   %eax
+  803c9c:	68 a4 63 80 00       	push   $0x8063a4
+  803ca1:	e8 bf ca ff ff       	call   800765 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803ca6:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803cac:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803cb2:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803cb7:	51                   	push   %ecx
+  803cb8:	52                   	push   %edx
+  803cb9:	50                   	push   %eax
+  803cba:	68 d4 63 80 00       	push   $0x8063d4
+  803cbf:	e8 a1 ca ff ff       	call   800765 <cprintf>
+	cprintf("\n");
+  803cc4:	83 c4 14             	add    $0x14,%esp
+  803cc7:	68 42 61 80 00       	push   $0x806142
+  803ccc:	e8 94 ca ff ff       	call   800765 <cprintf>
+}
+  803cd1:	83 c4 10             	add    $0x10,%esp
+  803cd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803cd7:	c9                   	leave
+  803cd8:	c3                   	ret
+
+00803cd9 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803cd9:	55                   	push   %ebp
+  803cda:	89 e5                	mov    %esp,%ebp
+  803cdc:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803cdf:	e8 5e fe ff ff       	call   803b42 <get_paging_stats>
+  803ce4:	83 ec 0c             	sub    $0xc,%esp
+  803ce7:	50                   	push   %eax
+  803ce8:	e8 ff fe ff ff       	call   803bec <print_paging_stats>
+}
+  803ced:	83 c4 10             	add    $0x10,%esp
+  803cf0:	c9                   	leave
+  803cf1:	c3                   	ret
+
+00803cf2 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803cf2:	55                   	push   %ebp
+  803cf3:	89 e5                	mov    %esp,%ebp
+  803cf5:	53                   	push   %ebx
+  803cf6:	83 ec 04             	sub    $0x4,%esp
+  803cf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803cfc:	eb 13                	jmp    803d11 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803cfe:	83 ec 04             	sub    $0x4,%esp
+  803d01:	6a ff                	push   $0xffffffff
+  803d03:	53                   	push   %ebx
+  803d04:	68 00 f0 ff ee       	push   $0xeefff000
+  803d09:	e8 0a da ff ff       	call   801718 <sys_futex_wait>
+  803d0e:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803d11:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803d16:	39 d8                	cmp    %ebx,%eax
+  803d18:	74 e4                	je     803cfe <mem_pressure_wait+0xc>
+	return now;
+}
+  803d1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d1d:	c9                   	leave
+  803d1e:	c3                   	ret
+
+00803d1f <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803d1f:	55                   	push   %ebp
+  803d20:	89 e5                	mov    %esp,%ebp
+  803d22:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803d25:	68 91 49 80 00       	push   $0x804991
+  803d2a:	e8 32 16 00 00       	call   805361 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803d2f:	c7 05 20 19 81 00 00 	movl   $0xdeadb000,0x811920
+  803d36:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803d39:	83 c4 0c             	add    $0xc,%esp
+  803d3c:	68 07 02 00 00       	push   $0x207
+  803d41:	68 00 b0 ad de       	push   $0xdeadb000
+  803d46:	6a 00                	push   $0x0
+  803d48:	e8 f2 d4 ff ff       	call   80123f <sys_page_alloc>
+  803d4d:	83 c4 10             	add    $0x10,%esp
+  803d50:	85 c0                	test   %eax,%eax
+  803d52:	78 0c                	js     803d60 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803d54:	e8 b4 f3 ff ff       	call   80310d <find_paging_env>
+	page_ring_ready();
+  803d59:	e8 7f f2 ff ff       	call   802fdd <page_ring_ready>
+}
+  803d5e:	c9                   	leave
+  803d5f:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803d60:	50                   	push   %eax
+  803d61:	68 62 61 80 00       	push   $0x806162
+  803d66:	68 13 05 00 00       	push   $0x513
+  803d6b:	68 1b 61 80 00       	push   $0x80611b
+  803d70:	e8 15 c9 ff ff       	call   80068a <_panic>
+
+00803d75 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803d75:	55                   	push   %ebp
+  803d76:	89 e5                	mov    %esp,%ebp
+  803d78:	57                   	push   %edi
+  803d79:	56                   	push   %esi
+  803d7a:	53                   	push   %ebx
+  803d7b:	83 ec 0c             	sub    $0xc,%esp
+  803d7e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803d81:	89 fa                	mov    %edi,%edx
+  803d83:	c1 ea 16             	shr    $0x16,%edx
+  803d86:	a1 20 19 81 00       	mov    0x811920,%eax
+  803d8b:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803d8e:	f6 06 01             	testb  $0x1,(%esi)
+  803d91:	75 3e                	jne    803dd1 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803d93:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803d98:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803d9c:	74 47                	je     803de5 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803d9e:	83 ec 0c             	sub    $0xc,%esp
+  803da1:	6a 01                	push   $0x1
+  803da3:	e8 f2 11 00 00       	call   804f9a <va_alloc>
+  803da8:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803daa:	83 c4 10             	add    $0x10,%esp
+  803dad:	85 c0                	test   %eax,%eax
+  803daf:	74 34                	je     803de5 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803db1:	6a 00                	push   $0x0
+  803db3:	68 07 02 00 00       	push   $0x207
+  803db8:	50                   	push   %eax
+  803db9:	6a 00                	push   $0x0
+  803dbb:	e8 df 02 00 00       	call   80409f <page_alloc>
+  803dc0:	83 c4 10             	add    $0x10,%esp
+  803dc3:	85 c0                	test   %eax,%eax
+  803dc5:	78 28                	js     803def <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803dc7:	f6 06 01             	testb  $0x1,(%esi)
+  803dca:	75 38                	jne    803e04 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803dcc:	83 cb 01             	or     $0x1,%ebx
+  803dcf:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803dd1:	89 f8                	mov    %edi,%eax
+  803dd3:	c1 e8 0a             	shr    $0xa,%eax
+  803dd6:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803ddb:	8b 1e                	mov    (%esi),%ebx
+  803ddd:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803de3:	01 c3                	add    %eax,%ebx
+}
+  803de5:	89 d8                	mov    %ebx,%eax
+  803de7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dea:	5b                   	pop    %ebx
+  803deb:	5e                   	pop    %esi
+  803dec:	5f                   	pop    %edi
+  803ded:	5d                   	pop    %ebp
+  803dee:	c3                   	ret
+			va_free(page, 1);
+  803def:	83 ec 08             	sub    $0x8,%esp
+  803df2:	6a 01                	push   $0x1
+  803df4:	53                   	push   %ebx
+  803df5:	e8 d8 12 00 00       	call   8050d2 <va_free>
+			return NULL;
+  803dfa:	83 c4 10             	add    $0x10,%esp
+  803dfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e02:	eb e1                	jmp    803de5 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803e04:	83 ec 08             	sub    $0x8,%esp
+  803e07:	53                   	push   %ebx
+  803e08:	6a 00                	push   $0x0
+  803e0a:	e8 b5 d4 ff ff       	call   8012c4 <sys_page_unmap>
+			va_free(page, 1);
+  803e0f:	83 c4 08             	add    $0x8,%esp
+  803e12:	6a 01                	push   $0x1
+  803e14:	53                   	push   %ebx
+  803e15:	e8 b8 12 00 00       	call   8050d2 <va_free>
+  803e1a:	83 c4 10             	add    $0x10,%esp
+  803e1d:	eb b2                	jmp    803dd1 <umapdir_walk+0x5c>
+
+00803e1f <page_out>:
+{
+  803e1f:	55                   	push   %ebp
+  803e20:	89 e5                	mov    %esp,%ebp
+  803e22:	57                   	push   %edi
+  803e23:	56                   	push   %esi
+  803e24:	53                   	push   %ebx
+  803e25:	83 ec 5c             	sub    $0x5c,%esp
+  803e28:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803e2b:	e8 dd f2 ff ff       	call   80310d <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803e30:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803e35:	85 c0                	test   %eax,%eax
+  803e37:	74 1e                	je     803e57 <page_out+0x38>
+  803e39:	83 ec 0c             	sub    $0xc,%esp
+  803e3c:	6a 00                	push   $0x0
+  803e3e:	6a 00                	push   $0x0
+  803e40:	6a 00                	push   $0x0
+  803e42:	6a 08                	push   $0x8
+  803e44:	50                   	push   %eax
+  803e45:	e8 0b 17 00 00       	call   805555 <ipc_call>
+  803e4a:	89 c3                	mov    %eax,%ebx
+  803e4c:	83 c4 20             	add    $0x20,%esp
+  803e4f:	85 c0                	test   %eax,%eax
+  803e51:	0f 84 ac 00 00 00    	je     803f03 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803e57:	83 ec 08             	sub    $0x8,%esp
+  803e5a:	ff 75 0c             	push   0xc(%ebp)
+  803e5d:	57                   	push   %edi
+  803e5e:	e8 e9 f9 ff ff       	call   80384c <get_page_choice>
+  803e63:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803e65:	83 c4 10             	add    $0x10,%esp
+  803e68:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803e6d:	0f 84 18 02 00 00    	je     80408b <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803e73:	e8 78 ee ff ff       	call   802cf0 <page_is_clean>
+  803e78:	84 c0                	test   %al,%al
+  803e7a:	0f 85 8c 00 00 00    	jne    803f0c <page_out+0xed>
+	if (pagingenv == 0)
+  803e80:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803e87:	0f 84 08 02 00 00    	je     804095 <page_out+0x276>
+	if (page_ring_ready())
+  803e8d:	e8 4b f1 ff ff       	call   802fdd <page_ring_ready>
+  803e92:	89 c3                	mov    %eax,%ebx
+  803e94:	85 c0                	test   %eax,%eax
+  803e96:	0f 85 89 00 00 00    	jne    803f25 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803e9c:	83 ec 0c             	sub    $0xc,%esp
+  803e9f:	6a 05                	push   $0x5
+  803ea1:	6a 01                	push   $0x1
+  803ea3:	56                   	push   %esi
+  803ea4:	6a 01                	push   $0x1
+  803ea6:	ff 35 40 c0 80 00    	push   0x80c040
+  803eac:	e8 a4 16 00 00       	call   805555 <ipc_call>
+  803eb1:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803eb3:	83 c4 20             	add    $0x20,%esp
+  803eb6:	85 c0                	test   %eax,%eax
+  803eb8:	0f 88 b8 01 00 00    	js     804076 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803ebe:	89 f0                	mov    %esi,%eax
+  803ec0:	c1 e8 0c             	shr    $0xc,%eax
+  803ec3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803eca:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803ecd:	83 ec 08             	sub    $0x8,%esp
+  803ed0:	56                   	push   %esi
+  803ed1:	6a 00                	push   $0x0
+  803ed3:	e8 ec d3 ff ff       	call   8012c4 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803ed8:	83 c4 08             	add    $0x8,%esp
+  803edb:	6a 01                	push   $0x1
+  803edd:	56                   	push   %esi
+  803ede:	e8 92 fe ff ff       	call   803d75 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803ee3:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803ee6:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803eec:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803eef:	09 fe                	or     %edi,%esi
+  803ef1:	83 ce 01             	or     $0x1,%esi
+  803ef4:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803ef6:	83 c4 10             	add    $0x10,%esp
+}
+  803ef9:	89 d8                	mov    %ebx,%eax
+  803efb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803efe:	5b                   	pop    %ebx
+  803eff:	5e                   	pop    %esi
+  803f00:	5f                   	pop    %edi
+  803f01:	5d                   	pop    %ebp
+  803f02:	c3                   	ret
+		num_page_reclaims++;
+  803f03:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  803f0a:	eb ed                	jmp    803ef9 <page_out+0xda>
+		num_page_drops++;
+  803f0c:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803f13:	83 ec 08             	sub    $0x8,%esp
+  803f16:	56                   	push   %esi
+  803f17:	6a 00                	push   $0x0
+  803f19:	e8 a6 d3 ff ff       	call   8012c4 <sys_page_unmap>
+  803f1e:	89 c3                	mov    %eax,%ebx
+  803f20:	83 c4 10             	add    $0x10,%esp
+  803f23:	eb d4                	jmp    803ef9 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803f25:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803f27:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803f2c:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803f31:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803f34:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803f36:	83 c0 08             	add    $0x8,%eax
+  803f39:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803f3c:	b8 07 00 00 00       	mov    $0x7,%eax
+  803f41:	e8 e5 ef ff ff       	call   802f2b <page_ring_reserve>
+	first = ring->sq_tail;
+  803f46:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803f4b:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803f4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803f53:	83 ec 04             	sub    $0x4,%esp
+  803f56:	68 00 10 00 00       	push   $0x1000
+  803f5b:	56                   	push   %esi
+  803f5c:	89 d8                	mov    %ebx,%eax
+  803f5e:	c1 e0 0c             	shl    $0xc,%eax
+  803f61:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803f66:	50                   	push   %eax
+  803f67:	e8 c8 cf ff ff       	call   800f34 <memcpy>
+		vas[n] = va;
+  803f6c:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803f70:	89 d9                	mov    %ebx,%ecx
+  803f72:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f77:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f7c:	e8 de ee ff ff       	call   802e5f <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803f81:	8d 43 01             	lea    0x1(%ebx),%eax
+  803f84:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803f87:	83 c4 10             	add    $0x10,%esp
+  803f8a:	83 fb 06             	cmp    $0x6,%ebx
+  803f8d:	74 62                	je     803ff1 <page_out+0x1d2>
+  803f8f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803f92:	eb 15                	jmp    803fa9 <page_out+0x18a>
+			num_page_drops++;
+  803f94:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803f9b:	83 ec 08             	sub    $0x8,%esp
+  803f9e:	56                   	push   %esi
+  803f9f:	6a 00                	push   $0x0
+  803fa1:	e8 1e d3 ff ff       	call   8012c4 <sys_page_unmap>
+  803fa6:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803fa9:	83 ec 08             	sub    $0x8,%esp
+  803fac:	53                   	push   %ebx
+  803fad:	57                   	push   %edi
+  803fae:	e8 99 f8 ff ff       	call   80384c <get_page_choice>
+  803fb3:	89 c6                	mov    %eax,%esi
+  803fb5:	83 c4 10             	add    $0x10,%esp
+  803fb8:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803fbd:	74 32                	je     803ff1 <page_out+0x1d2>
+  803fbf:	e8 2c ed ff ff       	call   802cf0 <page_is_clean>
+  803fc4:	84 c0                	test   %al,%al
+  803fc6:	75 cc                	jne    803f94 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803fc8:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803fcb:	39 c6                	cmp    %eax,%esi
+  803fcd:	72 07                	jb     803fd6 <page_out+0x1b7>
+  803fcf:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803fd2:	39 c6                	cmp    %eax,%esi
+  803fd4:	72 1b                	jb     803ff1 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803fd6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803fdb:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803fde:	eb 03                	jmp    803fe3 <page_out+0x1c4>
+  803fe0:	83 c3 01             	add    $0x1,%ebx
+  803fe3:	39 da                	cmp    %ebx,%edx
+  803fe5:	0f 84 68 ff ff ff    	je     803f53 <page_out+0x134>
+  803feb:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803fef:	75 ef                	jne    803fe0 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803ff1:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803ff4:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803ff7:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803ffa:	e8 a6 ee ff ff       	call   802ea5 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803fff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804004:	eb 42                	jmp    804048 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  804006:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  80400a:	89 f8                	mov    %edi,%eax
+  80400c:	c1 e8 0c             	shr    $0xc,%eax
+  80400f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804016:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  804019:	83 ec 08             	sub    $0x8,%esp
+  80401c:	57                   	push   %edi
+  80401d:	6a 00                	push   $0x0
+  80401f:	e8 a0 d2 ff ff       	call   8012c4 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  804024:	83 c4 08             	add    $0x8,%esp
+  804027:	6a 01                	push   $0x1
+  804029:	57                   	push   %edi
+  80402a:	e8 46 fd ff ff       	call   803d75 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80402f:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  804032:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  804038:	c1 e6 0c             	shl    $0xc,%esi
+  80403b:	09 d6                	or     %edx,%esi
+  80403d:	83 ce 01             	or     $0x1,%esi
+  804040:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  804042:	83 c3 01             	add    $0x1,%ebx
+  804045:	83 c4 10             	add    $0x10,%esp
+  804048:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  80404b:	39 c3                	cmp    %eax,%ebx
+  80404d:	74 1d                	je     80406c <page_out+0x24d>
+		if (res[i] < 0)
+  80404f:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  804053:	85 f6                	test   %esi,%esi
+  804055:	79 af                	jns    804006 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  804057:	56                   	push   %esi
+  804058:	68 04 64 80 00       	push   $0x806404
+  80405d:	68 d1 02 00 00       	push   $0x2d1
+  804062:	68 1b 61 80 00       	push   $0x80611b
+  804067:	e8 1e c6 ff ff       	call   80068a <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  80406c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804071:	e9 83 fe ff ff       	jmp    803ef9 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  804076:	50                   	push   %eax
+  804077:	68 04 64 80 00       	push   $0x806404
+  80407c:	68 0a 03 00 00       	push   $0x30a
+  804081:	68 1b 61 80 00       	push   $0x80611b
+  804086:	e8 ff c5 ff ff       	call   80068a <_panic>
+		return -E_NO_MEM;
+  80408b:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  804090:	e9 64 fe ff ff       	jmp    803ef9 <page_out+0xda>
+		return -E_PAGING;
+  804095:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80409a:	e9 5a fe ff ff       	jmp    803ef9 <page_out+0xda>
+
+0080409f <page_alloc>:
+{
+  80409f:	55                   	push   %ebp
+  8040a0:	89 e5                	mov    %esp,%ebp
+  8040a2:	57                   	push   %edi
+  8040a3:	56                   	push   %esi
+  8040a4:	53                   	push   %ebx
+  8040a5:	83 ec 0c             	sub    $0xc,%esp
+  8040a8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8040ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8040ae:	83 3d 20 19 81 00 00 	cmpl   $0x0,0x811920
+  8040b5:	74 34                	je     8040eb <page_alloc+0x4c>
+	if (check_mte)
+  8040b7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8040bb:	75 35                	jne    8040f2 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  8040bd:	83 ec 04             	sub    $0x4,%esp
+  8040c0:	ff 75 10             	push   0x10(%ebp)
+  8040c3:	56                   	push   %esi
+  8040c4:	57                   	push   %edi
+  8040c5:	e8 75 d1 ff ff       	call   80123f <sys_page_alloc>
+  8040ca:	89 c3                	mov    %eax,%ebx
+  8040cc:	83 c4 10             	add    $0x10,%esp
+  8040cf:	85 c0                	test   %eax,%eax
+  8040d1:	79 52                	jns    804125 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  8040d3:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8040d6:	75 52                	jne    80412a <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  8040d8:	83 ec 08             	sub    $0x8,%esp
+  8040db:	56                   	push   %esi
+  8040dc:	57                   	push   %edi
+  8040dd:	e8 3d fd ff ff       	call   803e1f <page_out>
+  8040e2:	83 c4 10             	add    $0x10,%esp
+  8040e5:	85 c0                	test   %eax,%eax
+  8040e7:	79 d4                	jns    8040bd <page_alloc+0x1e>
+  8040e9:	eb 3f                	jmp    80412a <page_alloc+0x8b>
+		init_map_dir();
+  8040eb:	e8 2f fc ff ff       	call   803d1f <init_map_dir>
+  8040f0:	eb c5                	jmp    8040b7 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  8040f2:	83 ec 08             	sub    $0x8,%esp
+  8040f5:	6a 00                	push   $0x0
+  8040f7:	56                   	push   %esi
+  8040f8:	e8 78 fc ff ff       	call   803d75 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  8040fd:	83 c4 10             	add    $0x10,%esp
+  804100:	85 c0                	test   %eax,%eax
+  804102:	74 b9                	je     8040bd <page_alloc+0x1e>
+  804104:	8b 10                	mov    (%eax),%edx
+  804106:	f6 c2 01             	test   $0x1,%dl
+  804109:	74 b2                	je     8040bd <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  80410b:	83 ec 08             	sub    $0x8,%esp
+  80410e:	56                   	push   %esi
+  80410f:	52                   	push   %edx
+  804110:	50                   	push   %eax
+  804111:	68 28 64 80 00       	push   $0x806428
+  804116:	68 34 03 00 00       	push   $0x334
+  80411b:	68 1b 61 80 00       	push   $0x80611b
+  804120:	e8 65 c5 ff ff       	call   80068a <_panic>
+	return 0;
+  804125:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80412a:	89 d8                	mov    %ebx,%eax
+  80412c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80412f:	5b                   	pop    %ebx
+  804130:	5e                   	pop    %esi
+  804131:	5f                   	pop    %edi
+  804132:	5d                   	pop    %ebp
+  804133:	c3                   	ret
+
+00804134 <page_adopt>:
+{
+  804134:	55                   	push   %ebp
+  804135:	89 e5                	mov    %esp,%ebp
+  804137:	56                   	push   %esi
+  804138:	53                   	push   %ebx
+  804139:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80413b:	c1 e8 16             	shr    $0x16,%eax
+  80413e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  804145:	25 81 00 00 00       	and    $0x81,%eax
+  80414a:	83 f8 01             	cmp    $0x1,%eax
+  80414d:	75 53                	jne    8041a2 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  80414f:	89 d8                	mov    %ebx,%eax
+  804151:	c1 e8 0c             	shr    $0xc,%eax
+  804154:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  80415b:	89 f2                	mov    %esi,%edx
+  80415d:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  804163:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  804168:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  80416e:	75 37                	jne    8041a7 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  804170:	83 ec 08             	sub    $0x8,%esp
+  804173:	6a 01                	push   $0x1
+  804175:	53                   	push   %ebx
+  804176:	e8 fa fb ff ff       	call   803d75 <umapdir_walk>
+  80417b:	83 c4 10             	add    $0x10,%esp
+  80417e:	85 c0                	test   %eax,%eax
+  804180:	74 2c                	je     8041ae <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  804182:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  804188:	83 ce 01             	or     $0x1,%esi
+  80418b:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  80418d:	83 ec 08             	sub    $0x8,%esp
+  804190:	53                   	push   %ebx
+  804191:	6a 00                	push   $0x0
+  804193:	e8 2c d1 ff ff       	call   8012c4 <sys_page_unmap>
+	return 1;
+  804198:	83 c4 10             	add    $0x10,%esp
+  80419b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8041a0:	eb 05                	jmp    8041a7 <page_adopt+0x73>
+		return 0;
+  8041a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8041aa:	5b                   	pop    %ebx
+  8041ab:	5e                   	pop    %esi
+  8041ac:	5d                   	pop    %ebp
+  8041ad:	c3                   	ret
+		return -E_NO_MEM;
+  8041ae:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8041b3:	eb f2                	jmp    8041a7 <page_adopt+0x73>
+
+008041b5 <page_forget>:
+{
+  8041b5:	55                   	push   %ebp
+  8041b6:	89 e5                	mov    %esp,%ebp
+  8041b8:	53                   	push   %ebx
+  8041b9:	83 ec 04             	sub    $0x4,%esp
+  8041bc:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  8041be:	e8 4a ef ff ff       	call   80310d <find_paging_env>
+	if (pagingenv == 0)
+  8041c3:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8041ca:	74 39                	je     804205 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  8041cc:	89 d8                	mov    %ebx,%eax
+  8041ce:	c1 e8 16             	shr    $0x16,%eax
+  8041d1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8041d8:	25 81 00 00 00       	and    $0x81,%eax
+  8041dd:	83 f8 01             	cmp    $0x1,%eax
+  8041e0:	74 28                	je     80420a <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  8041e2:	83 3d 20 19 81 00 00 	cmpl   $0x0,0x811920
+  8041e9:	74 1a                	je     804205 <page_forget+0x50>
+  8041eb:	83 ec 08             	sub    $0x8,%esp
+  8041ee:	6a 00                	push   $0x0
+  8041f0:	53                   	push   %ebx
+  8041f1:	e8 7f fb ff ff       	call   803d75 <umapdir_walk>
+  8041f6:	89 c3                	mov    %eax,%ebx
+  8041f8:	83 c4 10             	add    $0x10,%esp
+  8041fb:	85 c0                	test   %eax,%eax
+  8041fd:	74 06                	je     804205 <page_forget+0x50>
+  8041ff:	8b 00                	mov    (%eax),%eax
+  804201:	a8 01                	test   $0x1,%al
+  804203:	75 2b                	jne    804230 <page_forget+0x7b>
+}
+  804205:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804208:	c9                   	leave
+  804209:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  80420a:	89 d8                	mov    %ebx,%eax
+  80420c:	c1 e8 0c             	shr    $0xc,%eax
+  80420f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804216:	89 c2                	mov    %eax,%edx
+  804218:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  80421e:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  804224:	75 bc                	jne    8041e2 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  804226:	c1 e8 0c             	shr    $0xc,%eax
+  804229:	e8 5c ee ff ff       	call   80308a <page_remove_slot>
+		return;
+  80422e:	eb d5                	jmp    804205 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  804230:	c1 e8 0c             	shr    $0xc,%eax
+  804233:	e8 52 ee ff ff       	call   80308a <page_remove_slot>
+	*mte = 0;
+  804238:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80423e:	eb c5                	jmp    804205 <page_forget+0x50>
+
+00804240 <page_unmap>:
+{
+  804240:	55                   	push   %ebp
+  804241:	89 e5                	mov    %esp,%ebp
+  804243:	57                   	push   %edi
+  804244:	56                   	push   %esi
+  804245:	53                   	push   %ebx
+  804246:	83 ec 0c             	sub    $0xc,%esp
+  804249:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80424c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  80424f:	a1 24 19 81 00       	mov    0x811924,%eax
+  804254:	8b 40 48             	mov    0x48(%eax),%eax
+  804257:	85 db                	test   %ebx,%ebx
+  804259:	0f 8e b4 00 00 00    	jle    804313 <page_unmap+0xd3>
+  80425f:	39 d8                	cmp    %ebx,%eax
+  804261:	0f 84 ac 00 00 00    	je     804313 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  804267:	83 ec 08             	sub    $0x8,%esp
+  80426a:	57                   	push   %edi
+  80426b:	53                   	push   %ebx
+  80426c:	e8 53 d0 ff ff       	call   8012c4 <sys_page_unmap>
+  804271:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  804273:	e8 95 ee ff ff       	call   80310d <find_paging_env>
+	if (pagingenv == 0)
+  804278:	83 c4 10             	add    $0x10,%esp
+  80427b:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  804282:	0f 84 a1 00 00 00    	je     804329 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804288:	83 ec 0c             	sub    $0xc,%esp
+  80428b:	6a 05                	push   $0x5
+  80428d:	68 00 00 40 00       	push   $0x400000
+  804292:	6a 00                	push   $0x0
+  804294:	68 00 b0 ad de       	push   $0xdeadb000
+  804299:	53                   	push   %ebx
+  80429a:	e8 e3 cf ff ff       	call   801282 <sys_page_map>
+  80429f:	83 c4 20             	add    $0x20,%esp
+  8042a2:	85 c0                	test   %eax,%eax
+  8042a4:	0f 88 89 00 00 00    	js     804333 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8042aa:	89 f8                	mov    %edi,%eax
+  8042ac:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8042af:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  8042b6:	a8 01                	test   $0x1,%al
+  8042b8:	74 6f                	je     804329 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8042ba:	83 ec 0c             	sub    $0xc,%esp
+  8042bd:	6a 05                	push   $0x5
+  8042bf:	68 00 00 40 00       	push   $0x400000
+  8042c4:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8042c6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8042cb:	50                   	push   %eax
+  8042cc:	53                   	push   %ebx
+  8042cd:	e8 b0 cf ff ff       	call   801282 <sys_page_map>
+  8042d2:	83 c4 20             	add    $0x20,%esp
+  8042d5:	85 c0                	test   %eax,%eax
+  8042d7:	78 6f                	js     804348 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  8042d9:	c1 ef 0c             	shr    $0xc,%edi
+  8042dc:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8042e2:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  8042e9:	01 
+  8042ea:	74 3d                	je     804329 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8042ec:	83 ec 08             	sub    $0x8,%esp
+  8042ef:	68 00 00 40 00       	push   $0x400000
+  8042f4:	6a 00                	push   $0x0
+  8042f6:	e8 c9 cf ff ff       	call   8012c4 <sys_page_unmap>
+  8042fb:	83 c4 10             	add    $0x10,%esp
+  8042fe:	85 c0                	test   %eax,%eax
+  804300:	78 5b                	js     80435d <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  804302:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  804309:	c1 e8 0c             	shr    $0xc,%eax
+  80430c:	e8 79 ed ff ff       	call   80308a <page_remove_slot>
+	return r;
+  804311:	eb 16                	jmp    804329 <page_unmap+0xe9>
+		page_forget(va);
+  804313:	89 f8                	mov    %edi,%eax
+  804315:	e8 9b fe ff ff       	call   8041b5 <page_forget>
+		return sys_page_unmap(envid, va);
+  80431a:	83 ec 08             	sub    $0x8,%esp
+  80431d:	57                   	push   %edi
+  80431e:	53                   	push   %ebx
+  80431f:	e8 a0 cf ff ff       	call   8012c4 <sys_page_unmap>
+  804324:	89 c6                	mov    %eax,%esi
+  804326:	83 c4 10             	add    $0x10,%esp
+}
+  804329:	89 f0                	mov    %esi,%eax
+  80432b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80432e:	5b                   	pop    %ebx
+  80432f:	5e                   	pop    %esi
+  804330:	5f                   	pop    %edi
+  804331:	5d                   	pop    %ebp
+  804332:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  804333:	50                   	push   %eax
+  804334:	68 64 64 80 00       	push   $0x806464
+  804339:	68 e4 03 00 00       	push   $0x3e4
+  80433e:	68 1b 61 80 00       	push   $0x80611b
+  804343:	e8 42 c3 ff ff       	call   80068a <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  804348:	50                   	push   %eax
+  804349:	68 90 64 80 00       	push   $0x806490
+  80434e:	68 ea 03 00 00       	push   $0x3ea
+  804353:	68 1b 61 80 00       	push   $0x80611b
+  804358:	e8 2d c3 ff ff       	call   80068a <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  80435d:	50                   	push   %eax
+  80435e:	68 bc 64 80 00       	push   $0x8064bc
+  804363:	68 ef 03 00 00       	push   $0x3ef
+  804368:	68 1b 61 80 00       	push   $0x80611b
+  80436d:	e8 18 c3 ff ff       	call   80068a <_panic>
+
+00804372 <page_unmap_range>:
+{
+  804372:	55                   	push   %ebp
+  804373:	89 e5                	mov    %esp,%ebp
+  804375:	57                   	push   %edi
+  804376:	56                   	push   %esi
+  804377:	53                   	push   %ebx
+  804378:	83 ec 0c             	sub    $0xc,%esp
+  80437b:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  80437e:	e8 8a ed ff ff       	call   80310d <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  804383:	a1 24 19 81 00       	mov    0x811924,%eax
+  804388:	8b 40 48             	mov    0x48(%eax),%eax
+  80438b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80438f:	7e 38                	jle    8043c9 <page_unmap_range+0x57>
+  804391:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804394:	74 33                	je     8043c9 <page_unmap_range+0x57>
+  804396:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80439d:	74 2a                	je     8043c9 <page_unmap_range+0x57>
+  80439f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  8043a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8043a7:	39 fe                	cmp    %edi,%esi
+  8043a9:	74 56                	je     804401 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8043ab:	83 ec 08             	sub    $0x8,%esp
+  8043ae:	53                   	push   %ebx
+  8043af:	ff 75 08             	push   0x8(%ebp)
+  8043b2:	e8 89 fe ff ff       	call   804240 <page_unmap>
+  8043b7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8043bd:	83 c4 10             	add    $0x10,%esp
+  8043c0:	85 c0                	test   %eax,%eax
+  8043c2:	78 35                	js     8043f9 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8043c4:	83 c6 01             	add    $0x1,%esi
+  8043c7:	eb de                	jmp    8043a7 <page_unmap_range+0x35>
+  8043c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  8043cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8043d1:	eb 10                	jmp    8043e3 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  8043d3:	89 f0                	mov    %esi,%eax
+  8043d5:	e8 db fd ff ff       	call   8041b5 <page_forget>
+		for (i = 0; i < npages; i++)
+  8043da:	83 c3 01             	add    $0x1,%ebx
+  8043dd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8043e3:	39 fb                	cmp    %edi,%ebx
+  8043e5:	75 ec                	jne    8043d3 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  8043e7:	83 ec 04             	sub    $0x4,%esp
+  8043ea:	57                   	push   %edi
+  8043eb:	ff 75 0c             	push   0xc(%ebp)
+  8043ee:	ff 75 08             	push   0x8(%ebp)
+  8043f1:	e8 e2 cf ff ff       	call   8013d8 <sys_page_unmap_range>
+  8043f6:	83 c4 10             	add    $0x10,%esp
+}
+  8043f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043fc:	5b                   	pop    %ebx
+  8043fd:	5e                   	pop    %esi
+  8043fe:	5f                   	pop    %edi
+  8043ff:	5d                   	pop    %ebp
+  804400:	c3                   	ret
+	return 0;
+  804401:	b8 00 00 00 00       	mov    $0x0,%eax
+  804406:	eb f1                	jmp    8043f9 <page_unmap_range+0x87>
+
+00804408 <page_alloc_range>:
+{
+  804408:	55                   	push   %ebp
+  804409:	89 e5                	mov    %esp,%ebp
+  80440b:	57                   	push   %edi
+  80440c:	56                   	push   %esi
+  80440d:	53                   	push   %ebx
+  80440e:	83 ec 1c             	sub    $0x1c,%esp
+  804411:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804414:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  804417:	83 3d 20 19 81 00 00 	cmpl   $0x0,0x811920
+  80441e:	74 14                	je     804434 <page_alloc_range+0x2c>
+	if (check_mte)
+  804420:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  804424:	74 66                	je     80448c <page_alloc_range+0x84>
+  804426:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  804428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80442d:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  804430:	89 c7                	mov    %eax,%edi
+  804432:	eb 10                	jmp    804444 <page_alloc_range+0x3c>
+		init_map_dir();
+  804434:	e8 e6 f8 ff ff       	call   803d1f <init_map_dir>
+  804439:	eb e5                	jmp    804420 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  80443b:	83 c7 01             	add    $0x1,%edi
+  80443e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804444:	39 df                	cmp    %ebx,%edi
+  804446:	74 38                	je     804480 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  804448:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80444b:	83 ec 08             	sub    $0x8,%esp
+  80444e:	6a 00                	push   $0x0
+  804450:	56                   	push   %esi
+  804451:	e8 1f f9 ff ff       	call   803d75 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  804456:	83 c4 10             	add    $0x10,%esp
+  804459:	85 c0                	test   %eax,%eax
+  80445b:	74 de                	je     80443b <page_alloc_range+0x33>
+  80445d:	8b 10                	mov    (%eax),%edx
+  80445f:	f6 c2 01             	test   $0x1,%dl
+  804462:	74 d7                	je     80443b <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  804464:	83 ec 08             	sub    $0x8,%esp
+  804467:	ff 75 e4             	push   -0x1c(%ebp)
+  80446a:	52                   	push   %edx
+  80446b:	50                   	push   %eax
+  80446c:	68 28 64 80 00       	push   $0x806428
+  804471:	68 0b 04 00 00       	push   $0x40b
+  804476:	68 1b 61 80 00       	push   $0x80611b
+  80447b:	e8 0a c2 ff ff       	call   80068a <_panic>
+  804480:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804483:	eb 07                	jmp    80448c <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  804485:	c1 e0 0c             	shl    $0xc,%eax
+  804488:	01 c7                	add    %eax,%edi
+			npages -= r;
+  80448a:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  80448c:	85 db                	test   %ebx,%ebx
+  80448e:	74 30                	je     8044c0 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  804490:	ff 75 14             	push   0x14(%ebp)
+  804493:	53                   	push   %ebx
+  804494:	57                   	push   %edi
+  804495:	ff 75 08             	push   0x8(%ebp)
+  804498:	e8 cd ce ff ff       	call   80136a <sys_page_alloc_range>
+  80449d:	89 c6                	mov    %eax,%esi
+  80449f:	83 c4 10             	add    $0x10,%esp
+  8044a2:	85 c0                	test   %eax,%eax
+  8044a4:	7f df                	jg     804485 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8044a6:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8044a9:	75 1a                	jne    8044c5 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8044ab:	83 ec 08             	sub    $0x8,%esp
+  8044ae:	57                   	push   %edi
+  8044af:	ff 75 08             	push   0x8(%ebp)
+  8044b2:	e8 68 f9 ff ff       	call   803e1f <page_out>
+  8044b7:	83 c4 10             	add    $0x10,%esp
+  8044ba:	85 c0                	test   %eax,%eax
+  8044bc:	79 ce                	jns    80448c <page_alloc_range+0x84>
+  8044be:	eb 05                	jmp    8044c5 <page_alloc_range+0xbd>
+	return 0;
+  8044c0:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8044c5:	89 f0                	mov    %esi,%eax
+  8044c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8044ca:	5b                   	pop    %ebx
+  8044cb:	5e                   	pop    %esi
+  8044cc:	5f                   	pop    %edi
+  8044cd:	5d                   	pop    %ebp
+  8044ce:	c3                   	ret
+
+008044cf <page_in>:
+{
+  8044cf:	55                   	push   %ebp
+  8044d0:	89 e5                	mov    %esp,%ebp
+  8044d2:	57                   	push   %edi
+  8044d3:	56                   	push   %esi
+  8044d4:	53                   	push   %ebx
+  8044d5:	83 ec 3c             	sub    $0x3c,%esp
+  8044d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  8044db:	e8 2d ec ff ff       	call   80310d <find_paging_env>
+	if (pagingenv == 0)
+  8044e0:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8044e7:	0f 84 09 02 00 00    	je     8046f6 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  8044ed:	83 ec 08             	sub    $0x8,%esp
+  8044f0:	6a 00                	push   $0x0
+  8044f2:	56                   	push   %esi
+  8044f3:	e8 7d f8 ff ff       	call   803d75 <umapdir_walk>
+  8044f8:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8044fa:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  804500:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  804503:	83 c4 10             	add    $0x10,%esp
+  804506:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80450a:	74 0d                	je     804519 <page_in+0x4a>
+  80450c:	a1 24 19 81 00       	mov    0x811924,%eax
+  804511:	8b 40 48             	mov    0x48(%eax),%eax
+  804514:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804517:	75 06                	jne    80451f <page_in+0x50>
+  804519:	8b 03                	mov    (%ebx),%eax
+  80451b:	a8 02                	test   $0x2,%al
+  80451d:	75 63                	jne    804582 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  80451f:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804521:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804523:	89 f0                	mov    %esi,%eax
+  804525:	25 06 0e 00 00       	and    $0xe06,%eax
+  80452a:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  80452d:	50                   	push   %eax
+  80452e:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804531:	57                   	push   %edi
+  804532:	ff 75 08             	push   0x8(%ebp)
+  804535:	e8 65 fb ff ff       	call   80409f <page_alloc>
+  80453a:	83 c4 10             	add    $0x10,%esp
+  80453d:	85 c0                	test   %eax,%eax
+  80453f:	78 39                	js     80457a <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  804541:	89 f0                	mov    %esi,%eax
+  804543:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804546:	83 ec 0c             	sub    $0xc,%esp
+  804549:	6a 07                	push   $0x7
+  80454b:	6a 01                	push   $0x1
+  80454d:	57                   	push   %edi
+  80454e:	c1 e0 04             	shl    $0x4,%eax
+  804551:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804552:	c1 ee 1c             	shr    $0x1c,%esi
+  804555:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804558:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  80455f:	e8 f1 0f 00 00       	call   805555 <ipc_call>
+  804564:	83 c4 20             	add    $0x20,%esp
+  804567:	85 c0                	test   %eax,%eax
+  804569:	0f 88 72 01 00 00    	js     8046e1 <page_in+0x212>
+	*mte = 0;
+  80456f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804575:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80457a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80457d:	5b                   	pop    %ebx
+  80457e:	5e                   	pop    %esi
+  80457f:	5f                   	pop    %edi
+  804580:	5d                   	pop    %ebp
+  804581:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804582:	25 06 0e 00 00       	and    $0xe06,%eax
+  804587:	83 c8 01             	or     $0x1,%eax
+  80458a:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  80458d:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804590:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804593:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  804599:	be 01 00 00 00       	mov    $0x1,%esi
+  80459e:	eb 46                	jmp    8045e6 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  8045a0:	83 ec 08             	sub    $0x8,%esp
+  8045a3:	6a 00                	push   $0x0
+  8045a5:	51                   	push   %ecx
+  8045a6:	e8 ca f7 ff ff       	call   803d75 <umapdir_walk>
+  8045ab:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  8045af:	83 c4 10             	add    $0x10,%esp
+  8045b2:	85 c0                	test   %eax,%eax
+  8045b4:	74 66                	je     80461c <page_in+0x14d>
+  8045b6:	8b 00                	mov    (%eax),%eax
+  8045b8:	a8 01                	test   $0x1,%al
+  8045ba:	74 60                	je     80461c <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  8045bc:	89 c2                	mov    %eax,%edx
+  8045be:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  8045c4:	83 ca 01             	or     $0x1,%edx
+  8045c7:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  8045ca:	75 50                	jne    80461c <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  8045cc:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8045d2:	c1 e8 1c             	shr    $0x1c,%eax
+  8045d5:	8b 13                	mov    (%ebx),%edx
+  8045d7:	c1 ea 1c             	shr    $0x1c,%edx
+  8045da:	39 d0                	cmp    %edx,%eax
+  8045dc:	75 3e                	jne    80461c <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8045de:	83 c6 01             	add    $0x1,%esi
+  8045e1:	83 fe 08             	cmp    $0x8,%esi
+  8045e4:	74 3f                	je     804625 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  8045e6:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8045e8:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  8045ee:	77 2c                	ja     80461c <page_in+0x14d>
+  8045f0:	89 f8                	mov    %edi,%eax
+  8045f2:	c1 e8 16             	shr    $0x16,%eax
+  8045f5:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8045fc:	f6 c2 01             	test   $0x1,%dl
+  8045ff:	74 9f                	je     8045a0 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804601:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804608:	a8 80                	test   $0x80,%al
+  80460a:	75 10                	jne    80461c <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  80460c:	89 f8                	mov    %edi,%eax
+  80460e:	c1 e8 0c             	shr    $0xc,%eax
+  804611:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804618:	a8 01                	test   $0x1,%al
+  80461a:	74 84                	je     8045a0 <page_in+0xd1>
+	if (n == 1)
+  80461c:	83 fe 01             	cmp    $0x1,%esi
+  80461f:	0f 84 fa fe ff ff    	je     80451f <page_in+0x50>
+	req.nslots = n;
+  804625:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  80462b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804630:	eb 13                	jmp    804645 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  804632:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  804636:	8b 12                	mov    (%edx),%edx
+  804638:	c1 ea 0c             	shr    $0xc,%edx
+  80463b:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  804642:	83 c0 01             	add    $0x1,%eax
+  804645:	39 c6                	cmp    %eax,%esi
+  804647:	75 e9                	jne    804632 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  804649:	83 ec 0c             	sub    $0xc,%esp
+  80464c:	6a 00                	push   $0x0
+  80464e:	ff 75 c0             	push   -0x40(%ebp)
+  804651:	56                   	push   %esi
+  804652:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804655:	57                   	push   %edi
+  804656:	6a 00                	push   $0x0
+  804658:	e8 ab fd ff ff       	call   804408 <page_alloc_range>
+  80465d:	83 c4 20             	add    $0x20,%esp
+  804660:	85 c0                	test   %eax,%eax
+  804662:	78 6e                	js     8046d2 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804664:	83 ec 04             	sub    $0x4,%esp
+  804667:	6a 24                	push   $0x24
+  804669:	68 00 90 80 00       	push   $0x809000
+  80466e:	57                   	push   %edi
+  80466f:	e8 5e c8 ff ff       	call   800ed2 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804674:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80467b:	56                   	push   %esi
+  80467c:	57                   	push   %edi
+  80467d:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80467f:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  804686:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804689:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  804690:	e8 c0 0e 00 00       	call   805555 <ipc_call>
+  804695:	83 c4 20             	add    $0x20,%esp
+  804698:	85 c0                	test   %eax,%eax
+  80469a:	78 08                	js     8046a4 <page_in+0x1d5>
+  80469c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80469f:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  8046a2:	eb 20                	jmp    8046c4 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  8046a4:	50                   	push   %eax
+  8046a5:	68 e8 64 80 00       	push   $0x8064e8
+  8046aa:	68 59 02 00 00       	push   $0x259
+  8046af:	68 1b 61 80 00       	push   $0x80611b
+  8046b4:	e8 d1 bf ff ff       	call   80068a <_panic>
+		*mtes[i] = 0;
+  8046b9:	8b 10                	mov    (%eax),%edx
+  8046bb:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  8046c1:	83 c0 04             	add    $0x4,%eax
+  8046c4:	39 c8                	cmp    %ecx,%eax
+  8046c6:	75 f1                	jne    8046b9 <page_in+0x1ea>
+	return n;
+  8046c8:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  8046ca:	85 f6                	test   %esi,%esi
+  8046cc:	0f 84 4d fe ff ff    	je     80451f <page_in+0x50>
+		return r < 0 ? r : 0;
+  8046d2:	85 c0                	test   %eax,%eax
+  8046d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046d9:	0f 4f c2             	cmovg  %edx,%eax
+  8046dc:	e9 99 fe ff ff       	jmp    80457a <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8046e1:	50                   	push   %eax
+  8046e2:	68 20 65 80 00       	push   $0x806520
+  8046e7:	68 9a 02 00 00       	push   $0x29a
+  8046ec:	68 1b 61 80 00       	push   $0x80611b
+  8046f1:	e8 94 bf ff ff       	call   80068a <_panic>
+		return -E_PAGING;
+  8046f6:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8046fb:	e9 7a fe ff ff       	jmp    80457a <page_in+0xab>
+
+00804700 <page_map>:
+{
+  804700:	55                   	push   %ebp
+  804701:	89 e5                	mov    %esp,%ebp
+  804703:	57                   	push   %edi
+  804704:	56                   	push   %esi
+  804705:	53                   	push   %ebx
+  804706:	83 ec 1c             	sub    $0x1c,%esp
+  804709:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80470c:	83 ec 0c             	sub    $0xc,%esp
+  80470f:	ff 75 18             	push   0x18(%ebp)
+  804712:	ff 75 14             	push   0x14(%ebp)
+  804715:	ff 75 10             	push   0x10(%ebp)
+  804718:	ff 75 0c             	push   0xc(%ebp)
+  80471b:	56                   	push   %esi
+  80471c:	e8 61 cb ff ff       	call   801282 <sys_page_map>
+  804721:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804724:	83 c4 20             	add    $0x20,%esp
+  804727:	85 c0                	test   %eax,%eax
+  804729:	0f 89 a9 01 00 00    	jns    8048d8 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  80472f:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  804733:	74 5f                	je     804794 <page_map+0x94>
+		if (r != -E_INVAL)
+  804735:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  804739:	0f 85 a0 01 00 00    	jne    8048df <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80473f:	85 f6                	test   %esi,%esi
+  804741:	74 70                	je     8047b3 <page_map+0xb3>
+  804743:	a1 24 19 81 00       	mov    0x811924,%eax
+  804748:	8b 40 48             	mov    0x48(%eax),%eax
+  80474b:	39 f0                	cmp    %esi,%eax
+  80474d:	74 64                	je     8047b3 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80474f:	83 ec 0c             	sub    $0xc,%esp
+  804752:	6a 05                	push   $0x5
+  804754:	68 00 00 40 00       	push   $0x400000
+  804759:	6a 00                	push   $0x0
+  80475b:	68 00 b0 ad de       	push   $0xdeadb000
+  804760:	56                   	push   %esi
+  804761:	e8 1c cb ff ff       	call   801282 <sys_page_map>
+  804766:	89 c3                	mov    %eax,%ebx
+  804768:	83 c4 20             	add    $0x20,%esp
+  80476b:	85 c0                	test   %eax,%eax
+  80476d:	79 6a                	jns    8047d9 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  80476f:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804772:	75 50                	jne    8047c4 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804774:	83 ec 08             	sub    $0x8,%esp
+  804777:	68 00 00 40 00       	push   $0x400000
+  80477c:	6a fc                	push   $0xfffffffc
+  80477e:	e8 9c f6 ff ff       	call   803e1f <page_out>
+  804783:	83 c4 10             	add    $0x10,%esp
+  804786:	85 c0                	test   %eax,%eax
+  804788:	79 c5                	jns    80474f <page_map+0x4f>
+}
+  80478a:	89 d8                	mov    %ebx,%eax
+  80478c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80478f:	5b                   	pop    %ebx
+  804790:	5e                   	pop    %esi
+  804791:	5f                   	pop    %edi
+  804792:	5d                   	pop    %ebp
+  804793:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804794:	83 ec 08             	sub    $0x8,%esp
+  804797:	68 00 00 40 00       	push   $0x400000
+  80479c:	6a 00                	push   $0x0
+  80479e:	e8 7c f6 ff ff       	call   803e1f <page_out>
+  8047a3:	83 c4 10             	add    $0x10,%esp
+  8047a6:	85 c0                	test   %eax,%eax
+  8047a8:	0f 89 5e ff ff ff    	jns    80470c <page_map+0xc>
+				return r;
+  8047ae:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8047b1:	eb d7                	jmp    80478a <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8047b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8047b6:	e8 79 f9 ff ff       	call   804134 <page_adopt>
+  8047bb:	85 c0                	test   %eax,%eax
+  8047bd:	79 90                	jns    80474f <page_map+0x4f>
+			return r;
+  8047bf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8047c2:	eb c6                	jmp    80478a <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  8047c4:	53                   	push   %ebx
+  8047c5:	68 54 65 80 00       	push   $0x806554
+  8047ca:	68 77 03 00 00       	push   $0x377
+  8047cf:	68 1b 61 80 00       	push   $0x80611b
+  8047d4:	e8 b1 be ff ff       	call   80068a <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8047d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8047dc:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8047df:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8047e6:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8047ec:	0f 84 f5 00 00 00    	je     8048e7 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8047f2:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8047f8:	83 ec 0c             	sub    $0xc,%esp
+  8047fb:	6a 05                	push   $0x5
+  8047fd:	68 00 00 40 00       	push   $0x400000
+  804802:	6a 00                	push   $0x0
+  804804:	57                   	push   %edi
+  804805:	56                   	push   %esi
+  804806:	e8 77 ca ff ff       	call   801282 <sys_page_map>
+  80480b:	89 c3                	mov    %eax,%ebx
+  80480d:	83 c4 20             	add    $0x20,%esp
+  804810:	85 c0                	test   %eax,%eax
+  804812:	79 35                	jns    804849 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  804814:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804817:	75 1b                	jne    804834 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804819:	83 ec 08             	sub    $0x8,%esp
+  80481c:	68 00 00 40 00       	push   $0x400000
+  804821:	6a 00                	push   $0x0
+  804823:	e8 f7 f5 ff ff       	call   803e1f <page_out>
+  804828:	83 c4 10             	add    $0x10,%esp
+  80482b:	85 c0                	test   %eax,%eax
+  80482d:	79 c9                	jns    8047f8 <page_map+0xf8>
+  80482f:	e9 56 ff ff ff       	jmp    80478a <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  804834:	53                   	push   %ebx
+  804835:	68 7c 65 80 00       	push   $0x80657c
+  80483a:	68 83 03 00 00       	push   $0x383
+  80483f:	68 1b 61 80 00       	push   $0x80611b
+  804844:	e8 41 be ff ff       	call   80068a <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  804849:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80484c:	c1 e8 0c             	shr    $0xc,%eax
+  80484f:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  804854:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  80485b:	01 
+  80485c:	0f 84 8d 00 00 00    	je     8048ef <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804862:	83 ec 08             	sub    $0x8,%esp
+  804865:	68 00 00 40 00       	push   $0x400000
+  80486a:	6a 00                	push   $0x0
+  80486c:	e8 53 ca ff ff       	call   8012c4 <sys_page_unmap>
+  804871:	83 c4 10             	add    $0x10,%esp
+  804874:	85 c0                	test   %eax,%eax
+  804876:	78 36                	js     8048ae <page_map+0x1ae>
+  804878:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  80487b:	83 ec 08             	sub    $0x8,%esp
+  80487e:	57                   	push   %edi
+  80487f:	56                   	push   %esi
+  804880:	e8 4a fc ff ff       	call   8044cf <page_in>
+  804885:	89 c3                	mov    %eax,%ebx
+  804887:	83 c4 10             	add    $0x10,%esp
+  80488a:	85 c0                	test   %eax,%eax
+  80488c:	0f 89 7a fe ff ff    	jns    80470c <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804892:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804895:	75 2c                	jne    8048c3 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804897:	83 ec 08             	sub    $0x8,%esp
+  80489a:	57                   	push   %edi
+  80489b:	6a 00                	push   $0x0
+  80489d:	e8 7d f5 ff ff       	call   803e1f <page_out>
+  8048a2:	83 c4 10             	add    $0x10,%esp
+  8048a5:	85 c0                	test   %eax,%eax
+  8048a7:	79 d2                	jns    80487b <page_map+0x17b>
+  8048a9:	e9 dc fe ff ff       	jmp    80478a <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  8048ae:	50                   	push   %eax
+  8048af:	68 a8 65 80 00       	push   $0x8065a8
+  8048b4:	68 8b 03 00 00       	push   $0x38b
+  8048b9:	68 1b 61 80 00       	push   $0x80611b
+  8048be:	e8 c7 bd ff ff       	call   80068a <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  8048c3:	53                   	push   %ebx
+  8048c4:	68 d0 65 80 00       	push   $0x8065d0
+  8048c9:	68 91 03 00 00       	push   $0x391
+  8048ce:	68 1b 61 80 00       	push   $0x80611b
+  8048d3:	e8 b2 bd ff ff       	call   80068a <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8048d8:	89 c3                	mov    %eax,%ebx
+  8048da:	e9 ab fe ff ff       	jmp    80478a <page_map+0x8a>
+  8048df:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8048e2:	e9 a3 fe ff ff       	jmp    80478a <page_map+0x8a>
+			return r; // Pass through the error
+  8048e7:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8048ea:	e9 9b fe ff ff       	jmp    80478a <page_map+0x8a>
+			return r; // Pass through the error
+  8048ef:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8048f2:	e9 93 fe ff ff       	jmp    80478a <page_map+0x8a>
+
+008048f7 <page_map_range>:
+{
+  8048f7:	55                   	push   %ebp
+  8048f8:	89 e5                	mov    %esp,%ebp
+  8048fa:	57                   	push   %edi
+  8048fb:	56                   	push   %esi
+  8048fc:	53                   	push   %ebx
+  8048fd:	83 ec 0c             	sub    $0xc,%esp
+  804900:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804903:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  804906:	83 ec 08             	sub    $0x8,%esp
+  804909:	ff 75 1c             	push   0x1c(%ebp)
+  80490c:	ff 75 18             	push   0x18(%ebp)
+  80490f:	56                   	push   %esi
+  804910:	ff 75 10             	push   0x10(%ebp)
+  804913:	57                   	push   %edi
+  804914:	ff 75 08             	push   0x8(%ebp)
+  804917:	e8 71 ca ff ff       	call   80138d <sys_page_map_range>
+  80491c:	89 c3                	mov    %eax,%ebx
+  80491e:	83 c4 20             	add    $0x20,%esp
+  804921:	85 c0                	test   %eax,%eax
+  804923:	79 1b                	jns    804940 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804925:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804928:	75 20                	jne    80494a <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80492a:	83 ec 08             	sub    $0x8,%esp
+  80492d:	68 00 00 40 00       	push   $0x400000
+  804932:	6a 00                	push   $0x0
+  804934:	e8 e6 f4 ff ff       	call   803e1f <page_out>
+  804939:	83 c4 10             	add    $0x10,%esp
+  80493c:	85 c0                	test   %eax,%eax
+  80493e:	79 c6                	jns    804906 <page_map_range+0xf>
+}
+  804940:	89 d8                	mov    %ebx,%eax
+  804942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804945:	5b                   	pop    %ebx
+  804946:	5e                   	pop    %esi
+  804947:	5f                   	pop    %edi
+  804948:	5d                   	pop    %ebp
+  804949:	c3                   	ret
+		if (r != -E_INVAL)
+  80494a:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  80494d:	75 f1                	jne    804940 <page_map_range+0x49>
+  80494f:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  804951:	be 00 00 00 00       	mov    $0x0,%esi
+  804956:	eb 03                	jmp    80495b <page_map_range+0x64>
+  804958:	83 c6 01             	add    $0x1,%esi
+  80495b:	3b 75 18             	cmp    0x18(%ebp),%esi
+  80495e:	74 2a                	je     80498a <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  804960:	83 ec 0c             	sub    $0xc,%esp
+  804963:	ff 75 1c             	push   0x1c(%ebp)
+  804966:	53                   	push   %ebx
+  804967:	ff 75 10             	push   0x10(%ebp)
+  80496a:	57                   	push   %edi
+  80496b:	ff 75 08             	push   0x8(%ebp)
+  80496e:	e8 8d fd ff ff       	call   804700 <page_map>
+  804973:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804979:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80497f:	83 c4 20             	add    $0x20,%esp
+  804982:	85 c0                	test   %eax,%eax
+  804984:	79 d2                	jns    804958 <page_map_range+0x61>
+  804986:	89 c3                	mov    %eax,%ebx
+  804988:	eb b6                	jmp    804940 <page_map_range+0x49>
+		return 0;
+  80498a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80498f:	eb af                	jmp    804940 <page_map_range+0x49>
+
+00804991 <paging_pgfault_handler>:
+{
+  804991:	55                   	push   %ebp
+  804992:	89 e5                	mov    %esp,%ebp
+  804994:	56                   	push   %esi
+  804995:	53                   	push   %ebx
+  804996:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804999:	e8 6f e7 ff ff       	call   80310d <find_paging_env>
+	if (pagingenv == 0)
+  80499e:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  8049a3:	85 c0                	test   %eax,%eax
+  8049a5:	74 3c                	je     8049e3 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  8049a7:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8049a9:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8049ad:	75 12                	jne    8049c1 <paging_pgfault_handler+0x30>
+  8049af:	89 f0                	mov    %esi,%eax
+  8049b1:	e8 7e f7 ff ff       	call   804134 <page_adopt>
+  8049b6:	89 c2                	mov    %eax,%edx
+		return 0;
+  8049b8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8049bd:	85 d2                	test   %edx,%edx
+  8049bf:	78 22                	js     8049e3 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  8049c1:	83 ec 08             	sub    $0x8,%esp
+  8049c4:	6a 00                	push   $0x0
+  8049c6:	56                   	push   %esi
+  8049c7:	e8 a9 f3 ff ff       	call   803d75 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  8049cc:	83 c4 10             	add    $0x10,%esp
+  8049cf:	85 c0                	test   %eax,%eax
+  8049d1:	74 05                	je     8049d8 <paging_pgfault_handler+0x47>
+  8049d3:	f6 00 01             	testb  $0x1,(%eax)
+  8049d6:	75 12                	jne    8049ea <paging_pgfault_handler+0x59>
+	return 0;
+  8049d8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8049dd:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8049e1:	74 23                	je     804a06 <paging_pgfault_handler+0x75>
+}
+  8049e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8049e6:	5b                   	pop    %ebx
+  8049e7:	5e                   	pop    %esi
+  8049e8:	5d                   	pop    %ebp
+  8049e9:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  8049ea:	a1 24 19 81 00       	mov    0x811924,%eax
+  8049ef:	8b 40 48             	mov    0x48(%eax),%eax
+  8049f2:	83 ec 08             	sub    $0x8,%esp
+  8049f5:	56                   	push   %esi
+  8049f6:	50                   	push   %eax
+  8049f7:	e8 d3 fa ff ff       	call   8044cf <page_in>
+  8049fc:	f7 d0                	not    %eax
+  8049fe:	c1 e8 1f             	shr    $0x1f,%eax
+  804a01:	83 c4 10             	add    $0x10,%esp
+  804a04:	eb dd                	jmp    8049e3 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804a06:	89 f0                	mov    %esi,%eax
+  804a08:	e8 97 e2 ff ff       	call   802ca4 <segment_lookup>
+  804a0d:	89 c2                	mov    %eax,%edx
+	return 0;
+  804a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804a14:	85 d2                	test   %edx,%edx
+  804a16:	74 cb                	je     8049e3 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  804a18:	a1 24 19 81 00       	mov    0x811924,%eax
+  804a1d:	8b 40 48             	mov    0x48(%eax),%eax
+  804a20:	83 ec 08             	sub    $0x8,%esp
+  804a23:	56                   	push   %esi
+  804a24:	50                   	push   %eax
+  804a25:	e8 f5 f3 ff ff       	call   803e1f <page_out>
+  804a2a:	f7 d0                	not    %eax
+  804a2c:	c1 e8 1f             	shr    $0x1f,%eax
+  804a2f:	83 c4 10             	add    $0x10,%esp
+  804a32:	eb af                	jmp    8049e3 <paging_pgfault_handler+0x52>
+
+00804a34 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  804a34:	55                   	push   %ebp
+  804a35:	89 e5                	mov    %esp,%ebp
+  804a37:	57                   	push   %edi
+  804a38:	56                   	push   %esi
+  804a39:	53                   	push   %ebx
+  804a3a:	83 ec 2c             	sub    $0x2c,%esp
+  804a3d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804a40:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804a45:	89 c1                	mov    %eax,%ecx
+  804a47:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  804a4a:	c1 e8 11             	shr    $0x11,%eax
+  804a4d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804a50:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  804a57:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  804a5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a5f:	d3 e0                	shl    %cl,%eax
+  804a61:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804a64:	85 c7                	test   %eax,%edi
+  804a66:	74 12                	je     804a7a <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804a68:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804a6d:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  804a70:	bf 01 00 00 00       	mov    $0x1,%edi
+  804a75:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804a78:	eb 17                	jmp    804a91 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804a7a:	ff 75 e0             	push   -0x20(%ebp)
+  804a7d:	68 08 66 80 00       	push   $0x806608
+  804a82:	6a 48                	push   $0x48
+  804a84:	68 22 66 80 00       	push   $0x806622
+  804a89:	e8 fc bb ff ff       	call   80068a <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804a8e:	83 c3 01             	add    $0x1,%ebx
+  804a91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a94:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804a97:	89 c8                	mov    %ecx,%eax
+  804a99:	c1 e8 05             	shr    $0x5,%eax
+  804a9c:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804aa3:	89 fe                	mov    %edi,%esi
+  804aa5:	d3 e6                	shl    %cl,%esi
+  804aa7:	89 f1                	mov    %esi,%ecx
+  804aa9:	85 d6                	test   %edx,%esi
+  804aab:	74 e1                	je     804a8e <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804aad:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804ab0:	f7 d6                	not    %esi
+  804ab2:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804ab5:	21 fe                	and    %edi,%esi
+  804ab7:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804aba:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804ac1:	f7 d1                	not    %ecx
+  804ac3:	21 d1                	and    %edx,%ecx
+  804ac5:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804acc:	83 ec 04             	sub    $0x4,%esp
+  804acf:	53                   	push   %ebx
+  804ad0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804ad3:	57                   	push   %edi
+  804ad4:	6a 00                	push   $0x0
+  804ad6:	e8 97 f8 ff ff       	call   804372 <page_unmap_range>
+	va_free(va, n);
+  804adb:	83 c4 08             	add    $0x8,%esp
+  804ade:	53                   	push   %ebx
+  804adf:	57                   	push   %edi
+  804ae0:	e8 ed 05 00 00       	call   8050d2 <va_free>
+}
+  804ae5:	83 c4 10             	add    $0x10,%esp
+  804ae8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804aeb:	5b                   	pop    %ebx
+  804aec:	5e                   	pop    %esi
+  804aed:	5f                   	pop    %edi
+  804aee:	5d                   	pop    %ebp
+  804aef:	c3                   	ret
+
+00804af0 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804af0:	55                   	push   %ebp
+  804af1:	89 e5                	mov    %esp,%ebp
+  804af3:	57                   	push   %edi
+  804af4:	56                   	push   %esi
+  804af5:	53                   	push   %ebx
+  804af6:	83 ec 1c             	sub    $0x1c,%esp
+  804af9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804afc:	85 db                	test   %ebx,%ebx
+  804afe:	74 34                	je     804b34 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804b00:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804b06:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804b0b:	77 2f                	ja     804b3c <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804b0d:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804b13:	75 51                	jne    804b66 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804b15:	89 c1                	mov    %eax,%ecx
+  804b17:	c1 e9 0c             	shr    $0xc,%ecx
+  804b1a:	ba 01 00 00 00       	mov    $0x1,%edx
+  804b1f:	d3 e2                	shl    %cl,%edx
+  804b21:	c1 e8 11             	shr    $0x11,%eax
+  804b24:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  804b2b:	75 24                	jne    804b51 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804b2d:	89 d8                	mov    %ebx,%eax
+  804b2f:	e8 00 ff ff ff       	call   804a34 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804b34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b37:	5b                   	pop    %ebx
+  804b38:	5e                   	pop    %esi
+  804b39:	5f                   	pop    %edi
+  804b3a:	5d                   	pop    %ebp
+  804b3b:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804b3c:	53                   	push   %ebx
+  804b3d:	68 2f 66 80 00       	push   $0x80662f
+  804b42:	68 a2 00 00 00       	push   $0xa2
+  804b47:	68 22 66 80 00       	push   $0x806622
+  804b4c:	e8 39 bb ff ff       	call   80068a <_panic>
+			panic("free: %p is not allocated", va);
+  804b51:	53                   	push   %ebx
+  804b52:	68 08 66 80 00       	push   $0x806608
+  804b57:	68 a5 00 00 00       	push   $0xa5
+  804b5c:	68 22 66 80 00       	push   $0x806622
+  804b61:	e8 24 bb ff ff       	call   80068a <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804b66:	89 de                	mov    %ebx,%esi
+  804b68:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804b6e:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804b74:	89 c8                	mov    %ecx,%eax
+  804b76:	c1 e8 11             	shr    $0x11,%eax
+  804b79:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804b7c:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  804b83:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804b86:	c1 e9 0c             	shr    $0xc,%ecx
+  804b89:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b8e:	d3 e0                	shl    %cl,%eax
+  804b90:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804b93:	85 c7                	test   %eax,%edi
+  804b95:	74 1b                	je     804bb2 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804b97:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804b9b:	89 d8                	mov    %ebx,%eax
+  804b9d:	29 f0                	sub    %esi,%eax
+  804b9f:	83 e8 10             	sub    $0x10,%eax
+  804ba2:	99                   	cltd
+  804ba3:	f7 ff                	idiv   %edi
+  804ba5:	89 d1                	mov    %edx,%ecx
+  804ba7:	85 d2                	test   %edx,%edx
+  804ba9:	75 07                	jne    804bb2 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804bab:	ba 10 00 00 00       	mov    $0x10,%edx
+  804bb0:	eb 18                	jmp    804bca <free+0xda>
+		panic("free: %p is not allocated", va);
+  804bb2:	53                   	push   %ebx
+  804bb3:	68 08 66 80 00       	push   $0x806608
+  804bb8:	68 ad 00 00 00       	push   $0xad
+  804bbd:	68 22 66 80 00       	push   $0x806622
+  804bc2:	e8 c3 ba ff ff       	call   80068a <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804bc7:	83 c1 01             	add    $0x1,%ecx
+  804bca:	89 d0                	mov    %edx,%eax
+  804bcc:	d3 e0                	shl    %cl,%eax
+  804bce:	39 c7                	cmp    %eax,%edi
+  804bd0:	7f f5                	jg     804bc7 <free+0xd7>
+	*(void **) va = s->free;
+  804bd2:	8b 46 08             	mov    0x8(%esi),%eax
+  804bd5:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804bd7:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804bda:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804bde:	8d 58 01             	lea    0x1(%eax),%ebx
+  804be1:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804be5:	66 85 c0             	test   %ax,%ax
+  804be8:	74 52                	je     804c3c <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804bea:	0f b7 db             	movzwl %bx,%ebx
+  804bed:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804bf1:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bfb:	f7 ff                	idiv   %edi
+  804bfd:	39 c3                	cmp    %eax,%ebx
+  804bff:	0f 85 2f ff ff ff    	jne    804b34 <free+0x44>
+  804c05:	8b 46 04             	mov    0x4(%esi),%eax
+  804c08:	85 c0                	test   %eax,%eax
+  804c0a:	74 53                	je     804c5f <free+0x16f>
+		s->prev->next = s->next;
+  804c0c:	8b 16                	mov    (%esi),%edx
+  804c0e:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804c10:	8b 06                	mov    (%esi),%eax
+  804c12:	85 c0                	test   %eax,%eax
+  804c14:	74 06                	je     804c1c <free+0x12c>
+		s->next->prev = s->prev;
+  804c16:	8b 56 04             	mov    0x4(%esi),%edx
+  804c19:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804c1c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804c1f:	f7 d0                	not    %eax
+  804c21:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804c24:	21 d0                	and    %edx,%eax
+  804c26:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804c29:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  804c30:	89 f0                	mov    %esi,%eax
+  804c32:	e8 fd fd ff ff       	call   804a34 <heap_free_pages>
+  804c37:	e9 f8 fe ff ff       	jmp    804b34 <free+0x44>
+	s->prev = NULL;
+  804c3c:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804c43:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  804c4a:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804c4c:	85 c0                	test   %eax,%eax
+  804c4e:	74 03                	je     804c53 <free+0x163>
+		slabs[c]->prev = s;
+  804c50:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804c53:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  804c5a:	e9 d5 fe ff ff       	jmp    804b34 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804c5f:	8b 06                	mov    (%esi),%eax
+  804c61:	85 c0                	test   %eax,%eax
+  804c63:	0f 84 cb fe ff ff    	je     804b34 <free+0x44>
+		slabs[c] = s->next;
+  804c69:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  804c70:	8b 06                	mov    (%esi),%eax
+  804c72:	eb a2                	jmp    804c16 <free+0x126>
+
+00804c74 <heap_alloc_pages>:
+{
+  804c74:	55                   	push   %ebp
+  804c75:	89 e5                	mov    %esp,%ebp
+  804c77:	57                   	push   %edi
+  804c78:	56                   	push   %esi
+  804c79:	53                   	push   %ebx
+  804c7a:	83 ec 18             	sub    $0x18,%esp
+  804c7d:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804c7f:	50                   	push   %eax
+  804c80:	e8 15 03 00 00       	call   804f9a <va_alloc>
+  804c85:	89 c3                	mov    %eax,%ebx
+  804c87:	83 c4 10             	add    $0x10,%esp
+  804c8a:	85 c0                	test   %eax,%eax
+  804c8c:	74 47                	je     804cd5 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804c8e:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804c94:	89 c1                	mov    %eax,%ecx
+  804c96:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804c99:	c1 e8 11             	shr    $0x11,%eax
+  804c9c:	ba 01 00 00 00       	mov    $0x1,%edx
+  804ca1:	89 d7                	mov    %edx,%edi
+  804ca3:	d3 e7                	shl    %cl,%edi
+  804ca5:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804cac:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804cb0:	89 c8                	mov    %ecx,%eax
+  804cb2:	c1 e8 05             	shr    $0x5,%eax
+  804cb5:	d3 e2                	shl    %cl,%edx
+  804cb7:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804cbe:	83 ec 0c             	sub    $0xc,%esp
+  804cc1:	6a 00                	push   $0x0
+  804cc3:	6a 07                	push   $0x7
+  804cc5:	56                   	push   %esi
+  804cc6:	53                   	push   %ebx
+  804cc7:	6a 00                	push   $0x0
+  804cc9:	e8 3a f7 ff ff       	call   804408 <page_alloc_range>
+  804cce:	83 c4 20             	add    $0x20,%esp
+  804cd1:	85 c0                	test   %eax,%eax
+  804cd3:	78 0a                	js     804cdf <heap_alloc_pages+0x6b>
+}
+  804cd5:	89 d8                	mov    %ebx,%eax
+  804cd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cda:	5b                   	pop    %ebx
+  804cdb:	5e                   	pop    %esi
+  804cdc:	5f                   	pop    %edi
+  804cdd:	5d                   	pop    %ebp
+  804cde:	c3                   	ret
+		free(va);
+  804cdf:	83 ec 0c             	sub    $0xc,%esp
+  804ce2:	53                   	push   %ebx
+  804ce3:	e8 08 fe ff ff       	call   804af0 <free>
+		return NULL;
+  804ce8:	83 c4 10             	add    $0x10,%esp
+  804ceb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804cf0:	eb e3                	jmp    804cd5 <heap_alloc_pages+0x61>
+
+00804cf2 <malloc>:
+{
+  804cf2:	55                   	push   %ebp
+  804cf3:	89 e5                	mov    %esp,%ebp
+  804cf5:	57                   	push   %edi
+  804cf6:	56                   	push   %esi
+  804cf7:	53                   	push   %ebx
+  804cf8:	83 ec 1c             	sub    $0x1c,%esp
+  804cfb:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804cfe:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804d01:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804d07:	0f 87 21 01 00 00    	ja     804e2e <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804d0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804d12:	ba 10 00 00 00       	mov    $0x10,%edx
+  804d17:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804d19:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804d1e:	76 15                	jbe    804d35 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804d20:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804d25:	c1 e8 0c             	shr    $0xc,%eax
+  804d28:	e8 47 ff ff ff       	call   804c74 <heap_alloc_pages>
+  804d2d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804d30:	eb 37                	jmp    804d69 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804d32:	83 c1 01             	add    $0x1,%ecx
+  804d35:	89 d6                	mov    %edx,%esi
+  804d37:	d3 e6                	shl    %cl,%esi
+  804d39:	39 c6                	cmp    %eax,%esi
+  804d3b:	72 f5                	jb     804d32 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804d3d:	89 cb                	mov    %ecx,%ebx
+  804d3f:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  804d46:	85 ff                	test   %edi,%edi
+  804d48:	74 2a                	je     804d74 <malloc+0x82>
+	v = s->free;
+  804d4a:	8b 47 08             	mov    0x8(%edi),%eax
+  804d4d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804d50:	8b 00                	mov    (%eax),%eax
+  804d52:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804d55:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804d59:	83 e8 01             	sub    $0x1,%eax
+  804d5c:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804d60:	66 85 c0             	test   %ax,%ax
+  804d63:	0f 84 9a 00 00 00    	je     804e03 <malloc+0x111>
+}
+  804d69:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804d6c:	83 c4 1c             	add    $0x1c,%esp
+  804d6f:	5b                   	pop    %ebx
+  804d70:	5e                   	pop    %esi
+  804d71:	5f                   	pop    %edi
+  804d72:	5d                   	pop    %ebp
+  804d73:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804d74:	b8 01 00 00 00       	mov    $0x1,%eax
+  804d79:	e8 f6 fe ff ff       	call   804c74 <heap_alloc_pages>
+  804d7e:	89 c1                	mov    %eax,%ecx
+  804d80:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804d83:	85 c0                	test   %eax,%eax
+  804d85:	74 e2                	je     804d69 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804d87:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804d8d:	89 c8                	mov    %ecx,%eax
+  804d8f:	c1 e8 11             	shr    $0x11,%eax
+  804d92:	c1 e9 0c             	shr    $0xc,%ecx
+  804d95:	ba 01 00 00 00       	mov    $0x1,%edx
+  804d9a:	d3 e2                	shl    %cl,%edx
+  804d9c:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804da3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804da6:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804daa:	0f b7 f6             	movzwl %si,%esi
+  804dad:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804db2:	ba 00 00 00 00       	mov    $0x0,%edx
+  804db7:	f7 fe                	idiv   %esi
+  804db9:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804dbd:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804dc0:	85 c0                	test   %eax,%eax
+  804dc2:	74 14                	je     804dd8 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804dc4:	83 e8 01             	sub    $0x1,%eax
+  804dc7:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804dcb:	0f af d0             	imul   %eax,%edx
+  804dce:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804dd2:	89 3a                	mov    %edi,(%edx)
+  804dd4:	89 d7                	mov    %edx,%edi
+  804dd6:	eb e5                	jmp    804dbd <malloc+0xcb>
+	s->prev = NULL;
+  804dd8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804ddb:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804de2:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  804de9:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804deb:	85 c0                	test   %eax,%eax
+  804ded:	74 03                	je     804df2 <malloc+0x100>
+		slabs[c]->prev = s;
+  804def:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804df2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804df5:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  804dfc:	89 c7                	mov    %eax,%edi
+  804dfe:	e9 47 ff ff ff       	jmp    804d4a <malloc+0x58>
+	if (s->prev)
+  804e03:	8b 47 04             	mov    0x4(%edi),%eax
+  804e06:	85 c0                	test   %eax,%eax
+  804e08:	74 19                	je     804e23 <malloc+0x131>
+		s->prev->next = s->next;
+  804e0a:	8b 17                	mov    (%edi),%edx
+  804e0c:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804e0e:	8b 07                	mov    (%edi),%eax
+  804e10:	85 c0                	test   %eax,%eax
+  804e12:	0f 84 51 ff ff ff    	je     804d69 <malloc+0x77>
+		s->next->prev = s->prev;
+  804e18:	8b 57 04             	mov    0x4(%edi),%edx
+  804e1b:	89 50 04             	mov    %edx,0x4(%eax)
+  804e1e:	e9 46 ff ff ff       	jmp    804d69 <malloc+0x77>
+		slabs[c] = s->next;
+  804e23:	8b 07                	mov    (%edi),%eax
+  804e25:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  804e2c:	eb e0                	jmp    804e0e <malloc+0x11c>
+		return NULL;
+  804e2e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804e35:	e9 2f ff ff ff       	jmp    804d69 <malloc+0x77>
+
+00804e3a <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804e3a:	55                   	push   %ebp
+  804e3b:	89 e5                	mov    %esp,%ebp
+  804e3d:	57                   	push   %edi
+  804e3e:	56                   	push   %esi
+  804e3f:	53                   	push   %ebx
+  804e40:	83 ec 0c             	sub    $0xc,%esp
+  804e43:	89 c6                	mov    %eax,%esi
+  804e45:	89 d7                	mov    %edx,%edi
+  804e47:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804e4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804e4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e54:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804e59:	83 ef 01             	sub    $0x1,%edi
+  804e5c:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804e5f:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804e62:	eb 34                	jmp    804e98 <va_chunk_scan+0x5e>
+			i += 31;
+  804e64:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804e67:	89 ca                	mov    %ecx,%edx
+			continue;
+  804e69:	eb 23                	jmp    804e8e <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804e6b:	89 c7                	mov    %eax,%edi
+  804e6d:	c1 ef 05             	shr    $0x5,%edi
+  804e70:	be 01 00 00 00       	mov    $0x1,%esi
+  804e75:	d3 e6                	shl    %cl,%esi
+  804e77:	89 f1                	mov    %esi,%ecx
+  804e79:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804e7c:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804e7f:	75 41                	jne    804ec2 <va_chunk_scan+0x88>
+			len++;
+  804e81:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804e84:	39 d3                	cmp    %edx,%ebx
+  804e86:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804e89:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804e8c:	72 2d                	jb     804ebb <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804e8e:	83 c0 01             	add    $0x1,%eax
+  804e91:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804e96:	77 31                	ja     804ec9 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804e98:	89 c1                	mov    %eax,%ecx
+  804e9a:	83 e1 1f             	and    $0x1f,%ecx
+  804e9d:	75 cc                	jne    804e6b <va_chunk_scan+0x31>
+  804e9f:	89 c7                	mov    %eax,%edi
+  804ea1:	c1 ef 05             	shr    $0x5,%edi
+  804ea4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804ea7:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804eaa:	83 ff ff             	cmp    $0xffffffff,%edi
+  804ead:	74 b5                	je     804e64 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804eaf:	85 ff                	test   %edi,%edi
+  804eb1:	75 b8                	jne    804e6b <va_chunk_scan+0x31>
+			i += 31;
+  804eb3:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804eb6:	83 c2 20             	add    $0x20,%edx
+  804eb9:	eb c9                	jmp    804e84 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804ebb:	83 c0 01             	add    $0x1,%eax
+  804ebe:	29 d0                	sub    %edx,%eax
+  804ec0:	eb 15                	jmp    804ed7 <va_chunk_scan+0x9d>
+			len = 0;
+  804ec2:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ec7:	eb c5                	jmp    804e8e <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804ec9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804ece:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804ed1:	85 d2                	test   %edx,%edx
+  804ed3:	74 02                	je     804ed7 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804ed5:	89 1a                	mov    %ebx,(%edx)
+}
+  804ed7:	83 c4 0c             	add    $0xc,%esp
+  804eda:	5b                   	pop    %ebx
+  804edb:	5e                   	pop    %esi
+  804edc:	5f                   	pop    %edi
+  804edd:	5d                   	pop    %ebp
+  804ede:	c3                   	ret
+
+00804edf <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804edf:	55                   	push   %ebp
+  804ee0:	89 e5                	mov    %esp,%ebp
+  804ee2:	57                   	push   %edi
+  804ee3:	56                   	push   %esi
+  804ee4:	53                   	push   %ebx
+  804ee5:	83 ec 14             	sub    $0x14,%esp
+  804ee8:	89 c3                	mov    %eax,%ebx
+  804eea:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804eec:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804ef2:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  804ef8:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804efb:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804efe:	89 d6                	mov    %edx,%esi
+  804f00:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  804f06:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804f08:	eb 34                	jmp    804f3e <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804f0a:	89 c8                	mov    %ecx,%eax
+  804f0c:	c1 e8 05             	shr    $0x5,%eax
+  804f0f:	89 da                	mov    %ebx,%edx
+  804f11:	c1 e2 05             	shl    $0x5,%edx
+  804f14:	01 da                	add    %ebx,%edx
+  804f16:	01 c2                	add    %eax,%edx
+  804f18:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804f1d:	d3 c0                	rol    %cl,%eax
+  804f1f:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804f26:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804f2d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804f32:	01 d0                	add    %edx,%eax
+  804f34:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804f3b:	83 c1 01             	add    $0x1,%ecx
+  804f3e:	39 f9                	cmp    %edi,%ecx
+  804f40:	74 30                	je     804f72 <va_chunk_mark+0x93>
+		if (alloc)
+  804f42:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804f46:	74 c2                	je     804f0a <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804f48:	89 c8                	mov    %ecx,%eax
+  804f4a:	c1 e8 05             	shr    $0x5,%eax
+  804f4d:	89 da                	mov    %ebx,%edx
+  804f4f:	c1 e2 05             	shl    $0x5,%edx
+  804f52:	01 da                	add    %ebx,%edx
+  804f54:	01 c2                	add    %eax,%edx
+  804f56:	b8 01 00 00 00       	mov    $0x1,%eax
+  804f5b:	d3 e0                	shl    %cl,%eax
+  804f5d:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804f64:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804f6b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804f70:	eb c0                	jmp    804f32 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804f72:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804f75:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f7a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804f7d:	e8 b8 fe ff ff       	call   804e3a <va_chunk_scan>
+	ch->run = run;
+  804f82:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804f88:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804f8b:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804f92:	83 c4 14             	add    $0x14,%esp
+  804f95:	5b                   	pop    %ebx
+  804f96:	5e                   	pop    %esi
+  804f97:	5f                   	pop    %edi
+  804f98:	5d                   	pop    %ebp
+  804f99:	c3                   	ret
+
+00804f9a <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804f9a:	55                   	push   %ebp
+  804f9b:	89 e5                	mov    %esp,%ebp
+  804f9d:	57                   	push   %edi
+  804f9e:	56                   	push   %esi
+  804f9f:	53                   	push   %ebx
+  804fa0:	83 ec 04             	sub    $0x4,%esp
+  804fa3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804fa6:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804fab:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804fb0:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804fb7:	74 4f                	je     805008 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804fb9:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804fbc:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804fc1:	0f 87 01 01 00 00    	ja     8050c8 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804fc7:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804fcd:	0f 87 80 00 00 00    	ja     805053 <va_alloc+0xb9>
+  804fd3:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804fd8:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804fdd:	0f b7 10             	movzwl (%eax),%edx
+  804fe0:	05 84 00 00 00       	add    $0x84,%eax
+  804fe5:	39 da                	cmp    %ebx,%edx
+  804fe7:	73 2c                	jae    805015 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804fe9:	83 c6 01             	add    $0x1,%esi
+  804fec:	83 fe 1c             	cmp    $0x1c,%esi
+  804fef:	75 ec                	jne    804fdd <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ff6:	eb 53                	jmp    80504b <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804ff8:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804ffe:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  805003:	05 84 00 00 00       	add    $0x84,%eax
+  805008:	39 d0                	cmp    %edx,%eax
+  80500a:	75 ec                	jne    804ff8 <va_alloc+0x5e>
+	va_inited = 1;
+  80500c:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  805013:	eb a4                	jmp    804fb9 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  805015:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  80501b:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  805020:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805025:	89 da                	mov    %ebx,%edx
+  805027:	e8 0e fe ff ff       	call   804e3a <va_chunk_scan>
+  80502c:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  80502e:	6a 01                	push   $0x1
+  805030:	89 d9                	mov    %ebx,%ecx
+  805032:	89 c2                	mov    %eax,%edx
+  805034:	89 f0                	mov    %esi,%eax
+  805036:	e8 a4 fe ff ff       	call   804edf <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  80503b:	c1 e6 16             	shl    $0x16,%esi
+  80503e:	c1 e7 0c             	shl    $0xc,%edi
+  805041:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  805048:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  80504b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80504e:	5b                   	pop    %ebx
+  80504f:	5e                   	pop    %esi
+  805050:	5f                   	pop    %edi
+  805051:	5d                   	pop    %ebp
+  805052:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  805053:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  805059:	c1 ee 0a             	shr    $0xa,%esi
+  80505c:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  805061:	b8 00 00 00 00       	mov    $0x0,%eax
+  805066:	eb 0a                	jmp    805072 <va_alloc+0xd8>
+			first = c + 1;
+  805068:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  80506a:	83 c2 01             	add    $0x1,%edx
+  80506d:	83 fa 1d             	cmp    $0x1d,%edx
+  805070:	74 4f                	je     8050c1 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  805072:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  805078:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  80507f:	00 04 
+  805081:	75 e5                	jne    805068 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  805083:	89 d1                	mov    %edx,%ecx
+  805085:	29 c1                	sub    %eax,%ecx
+  805087:	39 f1                	cmp    %esi,%ecx
+  805089:	75 df                	jne    80506a <va_alloc+0xd0>
+  80508b:	89 c7                	mov    %eax,%edi
+  80508d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  805090:	be 00 04 00 00       	mov    $0x400,%esi
+  805095:	39 f3                	cmp    %esi,%ebx
+  805097:	0f 46 f3             	cmovbe %ebx,%esi
+  80509a:	6a 01                	push   $0x1
+  80509c:	89 f1                	mov    %esi,%ecx
+  80509e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050a3:	89 f8                	mov    %edi,%eax
+  8050a5:	e8 35 fe ff ff       	call   804edf <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8050aa:	83 c7 01             	add    $0x1,%edi
+  8050ad:	83 c4 04             	add    $0x4,%esp
+  8050b0:	29 f3                	sub    %esi,%ebx
+  8050b2:	75 dc                	jne    805090 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8050b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8050b7:	c1 e0 16             	shl    $0x16,%eax
+  8050ba:	05 00 00 00 08       	add    $0x8000000,%eax
+  8050bf:	eb 8a                	jmp    80504b <va_alloc+0xb1>
+	return NULL;
+  8050c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050c6:	eb 83                	jmp    80504b <va_alloc+0xb1>
+		return NULL;
+  8050c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050cd:	e9 79 ff ff ff       	jmp    80504b <va_alloc+0xb1>
+
+008050d2 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  8050d2:	55                   	push   %ebp
+  8050d3:	89 e5                	mov    %esp,%ebp
+  8050d5:	57                   	push   %edi
+  8050d6:	56                   	push   %esi
+  8050d7:	53                   	push   %ebx
+  8050d8:	83 ec 0c             	sub    $0xc,%esp
+  8050db:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8050de:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  8050e1:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  8050e7:	76 21                	jbe    80510a <va_free+0x38>
+  8050e9:	89 f0                	mov    %esi,%eax
+  8050eb:	c1 e0 0c             	shl    $0xc,%eax
+  8050ee:	01 f8                	add    %edi,%eax
+  8050f0:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  8050f5:	77 13                	ja     80510a <va_free+0x38>
+	    || PGOFF(va))
+  8050f7:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8050fd:	75 0b                	jne    80510a <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8050ff:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  805105:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  805108:	eb 45                	jmp    80514f <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  80510a:	83 ec 0c             	sub    $0xc,%esp
+  80510d:	56                   	push   %esi
+  80510e:	57                   	push   %edi
+  80510f:	68 4c 66 80 00       	push   $0x80664c
+  805114:	68 8e 00 00 00       	push   $0x8e
+  805119:	68 6c 66 80 00       	push   $0x80666c
+  80511e:	e8 67 b5 ff ff       	call   80068a <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  805123:	89 fa                	mov    %edi,%edx
+  805125:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80512b:	bb 00 04 00 00       	mov    $0x400,%ebx
+  805130:	29 d3                	sub    %edx,%ebx
+  805132:	39 f3                	cmp    %esi,%ebx
+  805134:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  805137:	89 f8                	mov    %edi,%eax
+  805139:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  80513c:	83 ec 0c             	sub    $0xc,%esp
+  80513f:	6a 00                	push   $0x0
+  805141:	89 d9                	mov    %ebx,%ecx
+  805143:	e8 97 fd ff ff       	call   804edf <va_chunk_mark>
+		i += n;
+  805148:	01 df                	add    %ebx,%edi
+		npages -= n;
+  80514a:	29 de                	sub    %ebx,%esi
+  80514c:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  80514f:	85 f6                	test   %esi,%esi
+  805151:	75 d0                	jne    805123 <va_free+0x51>
+	}
+}
+  805153:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805156:	5b                   	pop    %ebx
+  805157:	5e                   	pop    %esi
+  805158:	5f                   	pop    %edi
+  805159:	5d                   	pop    %ebp
+  80515a:	c3                   	ret
+
+0080515b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80515b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805160:	c3                   	ret
+
+00805161 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805161:	55                   	push   %ebp
+  805162:	89 e5                	mov    %esp,%ebp
+  805164:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  805167:	68 79 66 80 00       	push   $0x806679
+  80516c:	ff 75 0c             	push   0xc(%ebp)
+  80516f:	e8 d8 bb ff ff       	call   800d4c <strcpy>
+	return 0;
+}
+  805174:	b8 00 00 00 00       	mov    $0x0,%eax
+  805179:	c9                   	leave
+  80517a:	c3                   	ret
+
+0080517b <devcons_write>:
+{
+  80517b:	55                   	push   %ebp
+  80517c:	89 e5                	mov    %esp,%ebp
+  80517e:	57                   	push   %edi
+  80517f:	56                   	push   %esi
+  805180:	53                   	push   %ebx
+  805181:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  805187:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  80518c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  805192:	eb 2e                	jmp    8051c2 <devcons_write+0x47>
+		m = n - tot;
+  805194:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  805197:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  805199:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80519e:	39 c3                	cmp    %eax,%ebx
+  8051a0:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8051a3:	83 ec 04             	sub    $0x4,%esp
+  8051a6:	53                   	push   %ebx
+  8051a7:	89 f0                	mov    %esi,%eax
+  8051a9:	03 45 0c             	add    0xc(%ebp),%eax
+  8051ac:	50                   	push   %eax
+  8051ad:	57                   	push   %edi
+  8051ae:	e8 1f bd ff ff       	call   800ed2 <memmove>
+		sys_cputs(buf, m);
+  8051b3:	83 c4 08             	add    $0x8,%esp
+  8051b6:	53                   	push   %ebx
+  8051b7:	57                   	push   %edi
+  8051b8:	e8 b5 bf ff ff       	call   801172 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8051bd:	01 de                	add    %ebx,%esi
+  8051bf:	83 c4 10             	add    $0x10,%esp
+  8051c2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8051c5:	72 cd                	jb     805194 <devcons_write+0x19>
+}
+  8051c7:	89 f0                	mov    %esi,%eax
+  8051c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051cc:	5b                   	pop    %ebx
+  8051cd:	5e                   	pop    %esi
+  8051ce:	5f                   	pop    %edi
+  8051cf:	5d                   	pop    %ebp
+  8051d0:	c3                   	ret
+
+008051d1 <devcons_read>:
+{
+  8051d1:	55                   	push   %ebp
+  8051d2:	89 e5                	mov    %esp,%ebp
+  8051d4:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8051d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051dc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8051e0:	75 07                	jne    8051e9 <devcons_read+0x18>
+  8051e2:	eb 1f                	jmp    805203 <devcons_read+0x32>
+		sys_yield();
+  8051e4:	e8 37 c0 ff ff       	call   801220 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8051e9:	e8 b3 bf ff ff       	call   8011a1 <sys_cgetc>
+  8051ee:	85 c0                	test   %eax,%eax
+  8051f0:	74 f2                	je     8051e4 <devcons_read+0x13>
+	if (c < 0)
+  8051f2:	78 0f                	js     805203 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8051f4:	83 f8 04             	cmp    $0x4,%eax
+  8051f7:	74 0c                	je     805205 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8051f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8051fc:	88 02                	mov    %al,(%edx)
+	return 1;
+  8051fe:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805203:	c9                   	leave
+  805204:	c3                   	ret
+		return 0;
+  805205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80520a:	eb f7                	jmp    805203 <devcons_read+0x32>
+
+0080520c <cputchar>:
+{
+  80520c:	55                   	push   %ebp
+  80520d:	89 e5                	mov    %esp,%ebp
+  80520f:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  805212:	8b 45 08             	mov    0x8(%ebp),%eax
+  805215:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  805218:	6a 01                	push   $0x1
+  80521a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80521d:	50                   	push   %eax
+  80521e:	e8 4f bf ff ff       	call   801172 <sys_cputs>
+}
+  805223:	83 c4 10             	add    $0x10,%esp
+  805226:	c9                   	leave
+  805227:	c3                   	ret
+
+00805228 <getchar>:
+{
+  805228:	55                   	push   %ebp
+  805229:	89 e5                	mov    %esp,%ebp
+  80522b:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80522e:	6a 01                	push   $0x1
+  805230:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  805233:	50                   	push   %eax
+  805234:	6a 00                	push   $0x0
+  805236:	e8 2d ce ff ff       	call   802068 <read>
+	if (r < 0)
+  80523b:	83 c4 10             	add    $0x10,%esp
+  80523e:	85 c0                	test   %eax,%eax
+  805240:	78 06                	js     805248 <getchar+0x20>
+	if (r < 1)
+  805242:	74 06                	je     80524a <getchar+0x22>
+	return c;
+  805244:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  805248:	c9                   	leave
+  805249:	c3                   	ret
+		return -E_EOF;
+  80524a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80524f:	eb f7                	jmp    805248 <getchar+0x20>
+
+00805251 <iscons>:
+{
+  805251:	55                   	push   %ebp
+  805252:	89 e5                	mov    %esp,%ebp
+  805254:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805257:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80525a:	50                   	push   %eax
+  80525b:	ff 75 08             	push   0x8(%ebp)
+  80525e:	e8 a6 cb ff ff       	call   801e09 <fd_lookup>
+  805263:	83 c4 10             	add    $0x10,%esp
+  805266:	85 c0                	test   %eax,%eax
+  805268:	78 11                	js     80527b <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80526a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80526d:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  805273:	39 10                	cmp    %edx,(%eax)
+  805275:	0f 94 c0             	sete   %al
+  805278:	0f b6 c0             	movzbl %al,%eax
+}
+  80527b:	c9                   	leave
+  80527c:	c3                   	ret
+
+0080527d <opencons>:
+{
+  80527d:	55                   	push   %ebp
+  80527e:	89 e5                	mov    %esp,%ebp
+  805280:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  805283:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805286:	50                   	push   %eax
+  805287:	e8 29 cb ff ff       	call   801db5 <fd_alloc>
+  80528c:	83 c4 10             	add    $0x10,%esp
+  80528f:	85 c0                	test   %eax,%eax
+  805291:	78 3a                	js     8052cd <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805293:	83 ec 04             	sub    $0x4,%esp
+  805296:	68 07 04 00 00       	push   $0x407
+  80529b:	ff 75 f4             	push   -0xc(%ebp)
+  80529e:	6a 00                	push   $0x0
+  8052a0:	e8 9a bf ff ff       	call   80123f <sys_page_alloc>
+  8052a5:	83 c4 10             	add    $0x10,%esp
+  8052a8:	85 c0                	test   %eax,%eax
+  8052aa:	78 21                	js     8052cd <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8052ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8052af:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  8052b5:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8052b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8052ba:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8052c1:	83 ec 0c             	sub    $0xc,%esp
+  8052c4:	50                   	push   %eax
+  8052c5:	e8 c4 ca ff ff       	call   801d8e <fd2num>
+  8052ca:	83 c4 10             	add    $0x10,%esp
+}
+  8052cd:	c9                   	leave
+  8052ce:	c3                   	ret
+
+008052cf <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  8052cf:	55                   	push   %ebp
+  8052d0:	89 e5                	mov    %esp,%ebp
+  8052d2:	56                   	push   %esi
+  8052d3:	53                   	push   %ebx
+  8052d4:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8052d7:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  8052dc:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8052df:	85 db                	test   %ebx,%ebx
+  8052e1:	78 17                	js     8052fa <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  8052e3:	83 ec 0c             	sub    $0xc,%esp
+  8052e6:	56                   	push   %esi
+  8052e7:	ff 14 9d 00 30 81 00 	call   *0x813000(,%ebx,4)
+  8052ee:	83 c4 10             	add    $0x10,%esp
+  8052f1:	85 c0                	test   %eax,%eax
+  8052f3:	75 27                	jne    80531c <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8052f5:	83 eb 01             	sub    $0x1,%ebx
+  8052f8:	eb e5                	jmp    8052df <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  8052fa:	a1 24 19 81 00       	mov    0x811924,%eax
+  8052ff:	8b 40 48             	mov    0x48(%eax),%eax
+  805302:	83 ec 08             	sub    $0x8,%esp
+  805305:	ff 76 28             	push   0x28(%esi)
+  805308:	ff 36                	push   (%esi)
+  80530a:	50                   	push   %eax
+  80530b:	68 88 66 80 00       	push   $0x806688
+  805310:	6a 1d                	push   $0x1d
+  805312:	68 ab 66 80 00       	push   $0x8066ab
+  805317:	e8 6e b3 ff ff       	call   80068a <_panic>
+}
+  80531c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80531f:	5b                   	pop    %ebx
+  805320:	5e                   	pop    %esi
+  805321:	5d                   	pop    %ebp
+  805322:	c3                   	ret
+
+00805323 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  805323:	55                   	push   %ebp
+  805324:	89 e5                	mov    %esp,%ebp
+  805326:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  805329:	83 3d 28 30 81 00 00 	cmpl   $0x0,0x813028
+  805330:	74 0a                	je     80533c <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  805332:	8b 45 08             	mov    0x8(%ebp),%eax
+  805335:	a3 28 30 81 00       	mov    %eax,0x813028
+}
+  80533a:	c9                   	leave
+  80533b:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  80533c:	83 ec 04             	sub    $0x4,%esp
+  80533f:	6a 07                	push   $0x7
+  805341:	68 00 f0 bf ee       	push   $0xeebff000
+  805346:	6a 00                	push   $0x0
+  805348:	e8 f2 be ff ff       	call   80123f <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80534d:	83 c4 08             	add    $0x8,%esp
+  805350:	68 c3 53 80 00       	push   $0x8053c3
+  805355:	6a 00                	push   $0x0
+  805357:	e8 49 c2 ff ff       	call   8015a5 <sys_env_set_pgfault_upcall>
+  80535c:	83 c4 10             	add    $0x10,%esp
+  80535f:	eb d1                	jmp    805332 <set_pgfault_handler+0xf>
+
+00805361 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  805361:	55                   	push   %ebp
+  805362:	89 e5                	mov    %esp,%ebp
+  805364:	83 ec 08             	sub    $0x8,%esp
+  805367:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80536a:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  805370:	b8 00 00 00 00       	mov    $0x0,%eax
+  805375:	eb 03                	jmp    80537a <add_pgfault_handler+0x19>
+  805377:	83 c0 01             	add    $0x1,%eax
+  80537a:	39 d0                	cmp    %edx,%eax
+  80537c:	74 0b                	je     805389 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  80537e:	39 0c 85 00 30 81 00 	cmp    %ecx,0x813000(,%eax,4)
+  805385:	75 f0                	jne    805377 <add_pgfault_handler+0x16>
+  805387:	eb 24                	jmp    8053ad <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  805389:	83 fa 0a             	cmp    $0xa,%edx
+  80538c:	74 21                	je     8053af <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  80538e:	8d 42 01             	lea    0x1(%edx),%eax
+  805391:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  805396:	89 0c 95 00 30 81 00 	mov    %ecx,0x813000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  80539d:	83 ec 0c             	sub    $0xc,%esp
+  8053a0:	68 cf 52 80 00       	push   $0x8052cf
+  8053a5:	e8 79 ff ff ff       	call   805323 <set_pgfault_handler>
+  8053aa:	83 c4 10             	add    $0x10,%esp
+}
+  8053ad:	c9                   	leave
+  8053ae:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8053af:	83 ec 04             	sub    $0x4,%esp
+  8053b2:	68 b9 66 80 00       	push   $0x8066b9
+  8053b7:	6a 44                	push   $0x44
+  8053b9:	68 ab 66 80 00       	push   $0x8066ab
+  8053be:	e8 c7 b2 ff ff       	call   80068a <_panic>
+
+008053c3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8053c3:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8053c4:	a1 28 30 81 00       	mov    0x813028,%eax
+	call *%eax
+  8053c9:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8053cb:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  8053ce:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  8053d2:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  8053d6:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  8053d9:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  8053db:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  8053df:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  8053e2:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  8053e3:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  8053e6:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  8053e7:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8053e8:	c3                   	ret
+
+008053e9 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8053e9:	55                   	push   %ebp
+  8053ea:	89 e5                	mov    %esp,%ebp
+  8053ec:	57                   	push   %edi
+  8053ed:	56                   	push   %esi
+  8053ee:	53                   	push   %ebx
+  8053ef:	83 ec 14             	sub    $0x14,%esp
+  8053f2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8053f5:	8b 75 14             	mov    0x14(%ebp),%esi
+  8053f8:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8053fb:	ff 75 10             	push   0x10(%ebp)
+  8053fe:	ff 75 0c             	push   0xc(%ebp)
+  805401:	e8 5c c2 ff ff       	call   801662 <sys_ipc_recv_pages>
+  805406:	83 c4 10             	add    $0x10,%esp
+  805409:	85 c0                	test   %eax,%eax
+  80540b:	78 46                	js     805453 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80540d:	85 ff                	test   %edi,%edi
+  80540f:	74 0d                	je     80541e <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  805411:	a1 24 19 81 00       	mov    0x811924,%eax
+  805416:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80541c:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80541e:	85 f6                	test   %esi,%esi
+  805420:	74 0d                	je     80542f <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  805422:	a1 24 19 81 00       	mov    0x811924,%eax
+  805427:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80542d:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80542f:	85 db                	test   %ebx,%ebx
+  805431:	74 0d                	je     805440 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  805433:	a1 24 19 81 00       	mov    0x811924,%eax
+  805438:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80543e:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805440:	a1 24 19 81 00       	mov    0x811924,%eax
+  805445:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80544b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80544e:	5b                   	pop    %ebx
+  80544f:	5e                   	pop    %esi
+  805450:	5f                   	pop    %edi
+  805451:	5d                   	pop    %ebp
+  805452:	c3                   	ret
+		if (from_env_store) {
+  805453:	85 ff                	test   %edi,%edi
+  805455:	74 06                	je     80545d <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  805457:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80545d:	85 f6                	test   %esi,%esi
+  80545f:	74 06                	je     805467 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  805461:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805467:	85 db                	test   %ebx,%ebx
+  805469:	74 e0                	je     80544b <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80546b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805471:	eb d8                	jmp    80544b <ipc_recv_pages+0x62>
+
+00805473 <ipc_recv>:
+{
+  805473:	55                   	push   %ebp
+  805474:	89 e5                	mov    %esp,%ebp
+  805476:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  805479:	6a 00                	push   $0x0
+  80547b:	ff 75 10             	push   0x10(%ebp)
+  80547e:	6a 01                	push   $0x1
+  805480:	ff 75 0c             	push   0xc(%ebp)
+  805483:	ff 75 08             	push   0x8(%ebp)
+  805486:	e8 5e ff ff ff       	call   8053e9 <ipc_recv_pages>
+}
+  80548b:	c9                   	leave
+  80548c:	c3                   	ret
+
+0080548d <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80548d:	55                   	push   %ebp
+  80548e:	89 e5                	mov    %esp,%ebp
+  805490:	56                   	push   %esi
+  805491:	53                   	push   %ebx
+  805492:	8b 75 08             	mov    0x8(%ebp),%esi
+  805495:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  805498:	83 ec 0c             	sub    $0xc,%esp
+  80549b:	ff 75 0c             	push   0xc(%ebp)
+  80549e:	e8 f3 c2 ff ff       	call   801796 <sys_ipc_try_recv>
+  8054a3:	83 c4 10             	add    $0x10,%esp
+  8054a6:	85 c0                	test   %eax,%eax
+  8054a8:	78 34                	js     8054de <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8054aa:	85 f6                	test   %esi,%esi
+  8054ac:	74 0d                	je     8054bb <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8054ae:	a1 24 19 81 00       	mov    0x811924,%eax
+  8054b3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8054b9:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8054bb:	85 db                	test   %ebx,%ebx
+  8054bd:	74 0d                	je     8054cc <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8054bf:	a1 24 19 81 00       	mov    0x811924,%eax
+  8054c4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8054ca:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8054cc:	a1 24 19 81 00       	mov    0x811924,%eax
+  8054d1:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8054d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8054da:	5b                   	pop    %ebx
+  8054db:	5e                   	pop    %esi
+  8054dc:	5d                   	pop    %ebp
+  8054dd:	c3                   	ret
+		if (from_env_store) {
+  8054de:	85 f6                	test   %esi,%esi
+  8054e0:	74 06                	je     8054e8 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8054e2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8054e8:	85 db                	test   %ebx,%ebx
+  8054ea:	74 eb                	je     8054d7 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8054ec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8054f2:	eb e3                	jmp    8054d7 <ipc_try_recv+0x4a>
+
+008054f4 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8054f4:	55                   	push   %ebp
+  8054f5:	89 e5                	mov    %esp,%ebp
+  8054f7:	83 ec 14             	sub    $0x14,%esp
+  8054fa:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8054fd:	85 c0                	test   %eax,%eax
+  8054ff:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805504:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805507:	ff 75 18             	push   0x18(%ebp)
+  80550a:	ff 75 14             	push   0x14(%ebp)
+  80550d:	50                   	push   %eax
+  80550e:	ff 75 0c             	push   0xc(%ebp)
+  805511:	ff 75 08             	push   0x8(%ebp)
+  805514:	e8 0c c1 ff ff       	call   801625 <sys_ipc_send_pages>
+  805519:	83 c4 20             	add    $0x20,%esp
+  80551c:	85 c0                	test   %eax,%eax
+  80551e:	78 02                	js     805522 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  805520:	c9                   	leave
+  805521:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  805522:	50                   	push   %eax
+  805523:	68 d4 66 80 00       	push   $0x8066d4
+  805528:	68 80 00 00 00       	push   $0x80
+  80552d:	68 00 67 80 00       	push   $0x806700
+  805532:	e8 53 b1 ff ff       	call   80068a <_panic>
+
+00805537 <ipc_send>:
+{
+  805537:	55                   	push   %ebp
+  805538:	89 e5                	mov    %esp,%ebp
+  80553a:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80553d:	ff 75 14             	push   0x14(%ebp)
+  805540:	6a 01                	push   $0x1
+  805542:	ff 75 10             	push   0x10(%ebp)
+  805545:	ff 75 0c             	push   0xc(%ebp)
+  805548:	ff 75 08             	push   0x8(%ebp)
+  80554b:	e8 a4 ff ff ff       	call   8054f4 <ipc_send_pages>
+}
+  805550:	83 c4 20             	add    $0x20,%esp
+  805553:	c9                   	leave
+  805554:	c3                   	ret
+
+00805555 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805555:	55                   	push   %ebp
+  805556:	89 e5                	mov    %esp,%ebp
+  805558:	83 ec 14             	sub    $0x14,%esp
+  80555b:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80555e:	85 c0                	test   %eax,%eax
+  805560:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805565:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805568:	ff 75 18             	push   0x18(%ebp)
+  80556b:	ff 75 14             	push   0x14(%ebp)
+  80556e:	50                   	push   %eax
+  80556f:	ff 75 0c             	push   0xc(%ebp)
+  805572:	ff 75 08             	push   0x8(%ebp)
+  805575:	e8 3c c1 ff ff       	call   8016b6 <sys_ipc_call>
+  80557a:	83 c4 20             	add    $0x20,%esp
+  80557d:	85 c0                	test   %eax,%eax
+  80557f:	78 0b                	js     80558c <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  805581:	a1 24 19 81 00       	mov    0x811924,%eax
+  805586:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80558c:	c9                   	leave
+  80558d:	c3                   	ret
+
+0080558e <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  80558e:	55                   	push   %ebp
+  80558f:	89 e5                	mov    %esp,%ebp
+  805591:	57                   	push   %edi
+  805592:	56                   	push   %esi
+  805593:	53                   	push   %ebx
+  805594:	83 ec 18             	sub    $0x18,%esp
+  805597:	8b 45 10             	mov    0x10(%ebp),%eax
+  80559a:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80559d:	8b 75 20             	mov    0x20(%ebp),%esi
+  8055a0:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8055a3:	85 c0                	test   %eax,%eax
+  8055a5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8055aa:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8055ad:	ff 75 18             	push   0x18(%ebp)
+  8055b0:	ff 75 14             	push   0x14(%ebp)
+  8055b3:	50                   	push   %eax
+  8055b4:	ff 75 0c             	push   0xc(%ebp)
+  8055b7:	ff 75 08             	push   0x8(%ebp)
+  8055ba:	e8 38 c1 ff ff       	call   8016f7 <sys_ipc_reply_recv>
+  8055bf:	83 c4 20             	add    $0x20,%esp
+  8055c2:	85 c0                	test   %eax,%eax
+  8055c4:	78 46                	js     80560c <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8055c6:	85 ff                	test   %edi,%edi
+  8055c8:	74 0d                	je     8055d7 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8055ca:	a1 24 19 81 00       	mov    0x811924,%eax
+  8055cf:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8055d5:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8055d7:	85 f6                	test   %esi,%esi
+  8055d9:	74 0d                	je     8055e8 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8055db:	a1 24 19 81 00       	mov    0x811924,%eax
+  8055e0:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8055e6:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8055e8:	85 db                	test   %ebx,%ebx
+  8055ea:	74 0d                	je     8055f9 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8055ec:	a1 24 19 81 00       	mov    0x811924,%eax
+  8055f1:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8055f7:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8055f9:	a1 24 19 81 00       	mov    0x811924,%eax
+  8055fe:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805604:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805607:	5b                   	pop    %ebx
+  805608:	5e                   	pop    %esi
+  805609:	5f                   	pop    %edi
+  80560a:	5d                   	pop    %ebp
+  80560b:	c3                   	ret
+		if (from_env_store) {
+  80560c:	85 ff                	test   %edi,%edi
+  80560e:	74 06                	je     805616 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  805610:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  805616:	85 f6                	test   %esi,%esi
+  805618:	74 06                	je     805620 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80561a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805620:	85 db                	test   %ebx,%ebx
+  805622:	74 e0                	je     805604 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  805624:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80562a:	eb d8                	jmp    805604 <ipc_reply_recv+0x76>
+
+0080562c <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80562c:	55                   	push   %ebp
+  80562d:	89 e5                	mov    %esp,%ebp
+  80562f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805632:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  805637:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80563a:	c1 e0 06             	shl    $0x6,%eax
+  80563d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805642:	8b 40 50             	mov    0x50(%eax),%eax
+  805645:	39 c8                	cmp    %ecx,%eax
+  805647:	74 12                	je     80565b <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  805649:	83 c2 01             	add    $0x1,%edx
+  80564c:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  805652:	75 e3                	jne    805637 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  805654:	b8 00 00 00 00       	mov    $0x0,%eax
+  805659:	eb 0e                	jmp    805669 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80565b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80565e:	c1 e0 06             	shl    $0x6,%eax
+  805661:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805666:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  805669:	5d                   	pop    %ebp
+  80566a:	c3                   	ret
+
+0080566b <udivmod>:
+  80566b:	55                   	push   %ebp
+  80566c:	57                   	push   %edi
+  80566d:	56                   	push   %esi
+  80566e:	53                   	push   %ebx
+  80566f:	83 ec 24             	sub    $0x24,%esp
+  805672:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805676:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80567a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80567e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  805682:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805686:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80568a:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  80568e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805693:	b8 00 00 00 00       	mov    $0x0,%eax
+  805698:	ba 00 00 00 00       	mov    $0x0,%edx
+  80569d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8056a4:	00 
+  8056a5:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8056ac:	00 
+  8056ad:	89 fb                	mov    %edi,%ebx
+  8056af:	eb 08                	jmp    8056b9 <udivmod+0x4e>
+  8056b1:	83 e9 01             	sub    $0x1,%ecx
+  8056b4:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8056b7:	74 68                	je     805721 <udivmod+0xb6>
+  8056b9:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8056bd:	01 c0                	add    %eax,%eax
+  8056bf:	89 c6                	mov    %eax,%esi
+  8056c1:	89 d7                	mov    %edx,%edi
+  8056c3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8056c7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8056cb:	0f ad d0             	shrd   %cl,%edx,%eax
+  8056ce:	d3 ea                	shr    %cl,%edx
+  8056d0:	f6 c1 20             	test   $0x20,%cl
+  8056d3:	74 04                	je     8056d9 <udivmod+0x6e>
+  8056d5:	89 d0                	mov    %edx,%eax
+  8056d7:	31 d2                	xor    %edx,%edx
+  8056d9:	83 e0 01             	and    $0x1,%eax
+  8056dc:	89 04 24             	mov    %eax,(%esp)
+  8056df:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8056e6:	00 
+  8056e7:	8b 04 24             	mov    (%esp),%eax
+  8056ea:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8056ee:	09 f0                	or     %esi,%eax
+  8056f0:	09 fa                	or     %edi,%edx
+  8056f2:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8056f6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8056fa:	39 f0                	cmp    %esi,%eax
+  8056fc:	89 d5                	mov    %edx,%ebp
+  8056fe:	19 fd                	sbb    %edi,%ebp
+  805700:	72 af                	jb     8056b1 <udivmod+0x46>
+  805702:	29 f0                	sub    %esi,%eax
+  805704:	19 fa                	sbb    %edi,%edx
+  805706:	89 cf                	mov    %ecx,%edi
+  805708:	c1 ef 05             	shr    $0x5,%edi
+  80570b:	83 e7 01             	and    $0x1,%edi
+  80570e:	89 fe                	mov    %edi,%esi
+  805710:	83 f6 01             	xor    $0x1,%esi
+  805713:	d3 e6                	shl    %cl,%esi
+  805715:	d3 e7                	shl    %cl,%edi
+  805717:	09 74 24 18          	or     %esi,0x18(%esp)
+  80571b:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80571f:	eb 90                	jmp    8056b1 <udivmod+0x46>
+  805721:	85 db                	test   %ebx,%ebx
+  805723:	74 05                	je     80572a <udivmod+0xbf>
+  805725:	89 03                	mov    %eax,(%ebx)
+  805727:	89 53 04             	mov    %edx,0x4(%ebx)
+  80572a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80572e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805732:	83 c4 24             	add    $0x24,%esp
+  805735:	5b                   	pop    %ebx
+  805736:	5e                   	pop    %esi
+  805737:	5f                   	pop    %edi
+  805738:	5d                   	pop    %ebp
+  805739:	c3                   	ret
+
+0080573a <__udivdi3>:
+  80573a:	83 ec 08             	sub    $0x8,%esp
+  80573d:	6a 00                	push   $0x0
+  80573f:	ff 74 24 1c          	push   0x1c(%esp)
+  805743:	ff 74 24 1c          	push   0x1c(%esp)
+  805747:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80574b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80574f:	e8 17 ff ff ff       	call   80566b <udivmod>
+  805754:	83 c4 14             	add    $0x14,%esp
+  805757:	c3                   	ret
+
+00805758 <__umoddi3>:
+  805758:	83 ec 18             	sub    $0x18,%esp
+  80575b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80575f:	50                   	push   %eax
+  805760:	ff 74 24 2c          	push   0x2c(%esp)
+  805764:	ff 74 24 2c          	push   0x2c(%esp)
+  805768:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80576c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805770:	e8 f6 fe ff ff       	call   80566b <udivmod>
+  805775:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805779:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80577d:	83 c4 24             	add    $0x24,%esp
+  805780:	c3                   	ret
+
+00805781 <__divdi3>:
+  805781:	55                   	push   %ebp
+  805782:	57                   	push   %edi
+  805783:	56                   	push   %esi
+  805784:	53                   	push   %ebx
+  805785:	83 ec 10             	sub    $0x10,%esp
+  805788:	8b 44 24 24          	mov    0x24(%esp),%eax
+  80578c:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805790:	89 c6                	mov    %eax,%esi
+  805792:	89 d7                	mov    %edx,%edi
+  805794:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  805798:	33 7c 24 30          	xor    0x30(%esp),%edi
+  80579c:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8057a0:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8057a4:	89 c5                	mov    %eax,%ebp
+  8057a6:	f7 dd                	neg    %ebp
+  8057a8:	89 d6                	mov    %edx,%esi
+  8057aa:	83 d6 00             	adc    $0x0,%esi
+  8057ad:	f7 de                	neg    %esi
+  8057af:	0f 48 e8             	cmovs  %eax,%ebp
+  8057b2:	0f 49 d6             	cmovns %esi,%edx
+  8057b5:	6a 00                	push   $0x0
+  8057b7:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8057bb:	f7 de                	neg    %esi
+  8057bd:	8b 44 24 34          	mov    0x34(%esp),%eax
+  8057c1:	83 d0 00             	adc    $0x0,%eax
+  8057c4:	f7 d8                	neg    %eax
+  8057c6:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  8057cb:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8057d0:	50                   	push   %eax
+  8057d1:	56                   	push   %esi
+  8057d2:	89 e8                	mov    %ebp,%eax
+  8057d4:	e8 92 fe ff ff       	call   80566b <udivmod>
+  8057d9:	83 c4 10             	add    $0x10,%esp
+  8057dc:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8057e1:	78 08                	js     8057eb <__divdi3+0x6a>
+  8057e3:	83 c4 0c             	add    $0xc,%esp
+  8057e6:	5b                   	pop    %ebx
+  8057e7:	5e                   	pop    %esi
+  8057e8:	5f                   	pop    %edi
+  8057e9:	5d                   	pop    %ebp
+  8057ea:	c3                   	ret
+  8057eb:	f7 d8                	neg    %eax
+  8057ed:	83 d2 00             	adc    $0x0,%edx
+  8057f0:	f7 da                	neg    %edx
+  8057f2:	eb ef                	jmp    8057e3 <__divdi3+0x62>
+
+008057f4 <__moddi3>:
+  8057f4:	55                   	push   %ebp
+  8057f5:	57                   	push   %edi
+  8057f6:	56                   	push   %esi
+  8057f7:	53                   	push   %ebx
+  8057f8:	83 ec 18             	sub    $0x18,%esp
+  8057fb:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8057ff:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805803:	89 f1                	mov    %esi,%ecx
+  805805:	f7 d9                	neg    %ecx
+  805807:	89 da                	mov    %ebx,%edx
+  805809:	83 d2 00             	adc    $0x0,%edx
+  80580c:	f7 da                	neg    %edx
+  80580e:	0f 48 ce             	cmovs  %esi,%ecx
+  805811:	0f 48 d3             	cmovs  %ebx,%edx
+  805814:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805818:	50                   	push   %eax
+  805819:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80581d:	f7 de                	neg    %esi
+  80581f:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805823:	83 d0 00             	adc    $0x0,%eax
+  805826:	f7 d8                	neg    %eax
+  805828:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80582d:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805832:	50                   	push   %eax
+  805833:	56                   	push   %esi
+  805834:	89 c8                	mov    %ecx,%eax
+  805836:	e8 30 fe ff ff       	call   80566b <udivmod>
+  80583b:	83 c4 10             	add    $0x10,%esp
+  80583e:	85 db                	test   %ebx,%ebx
+  805840:	78 10                	js     805852 <__moddi3+0x5e>
+  805842:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805846:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80584a:	83 c4 14             	add    $0x14,%esp
+  80584d:	5b                   	pop    %ebx
+  80584e:	5e                   	pop    %esi
+  80584f:	5f                   	pop    %edi
+  805850:	5d                   	pop    %ebp
+  805851:	c3                   	ret
+  805852:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805856:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80585a:	f7 d8                	neg    %eax
+  80585c:	83 d2 00             	adc    $0x0,%edx
+  80585f:	f7 da                	neg    %edx
+  805861:	eb e7                	jmp    80584a <__moddi3+0x56>
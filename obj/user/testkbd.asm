@@ -0,0 +1,5946 @@
+
+obj/user/testkbd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2a 02 00 00       	call   80025b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	int i, r;
+
+	// Spin for a bit to let the console quiet
+	for (i = 0; i < 10; ++i)
+  80003a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80003f:	eb 05                	jmp    800046 <umain+0x13>
+		sys_yield();
+  800041:	e8 fe 0e 00 00       	call   800f44 <sys_yield>
+	for (i = 0; i < 10; ++i)
+  800046:	83 eb 01             	sub    $0x1,%ebx
+  800049:	75 f6                	jne    800041 <umain+0xe>
+
+	close(0);
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	e8 47 16 00 00       	call   80169c <close>
+	if ((r = opencons()) < 0)
+  800055:	e8 af 01 00 00       	call   800209 <opencons>
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 14                	js     800075 <umain+0x42>
+		panic("opencons: %e", r);
+	if (r != 0)
+  800061:	74 24                	je     800087 <umain+0x54>
+		panic("first opencons used fd %d", r);
+  800063:	50                   	push   %eax
+  800064:	68 5c 29 80 00       	push   $0x80295c
+  800069:	6a 11                	push   $0x11
+  80006b:	68 4d 29 80 00       	push   $0x80294d
+  800070:	e8 49 02 00 00       	call   8002be <_panic>
+		panic("opencons: %e", r);
+  800075:	50                   	push   %eax
+  800076:	68 40 29 80 00       	push   $0x802940
+  80007b:	6a 0f                	push   $0xf
+  80007d:	68 4d 29 80 00       	push   $0x80294d
+  800082:	e8 37 02 00 00       	call   8002be <_panic>
+	if ((r = dup(0, 1)) < 0)
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	6a 01                	push   $0x1
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 5b 16 00 00       	call   8016ee <dup>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 c0                	test   %eax,%eax
+  800098:	79 25                	jns    8000bf <umain+0x8c>
+		panic("dup: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 76 29 80 00       	push   $0x802976
+  8000a0:	6a 13                	push   $0x13
+  8000a2:	68 4d 29 80 00       	push   $0x80294d
+  8000a7:	e8 12 02 00 00       	call   8002be <_panic>
+	for(;;){
+		char *buf;
+
+		buf = readline("Type a line: ");
+		if (buf != NULL)
+			fprintf(1, "%s\n", buf);
+  8000ac:	83 ec 04             	sub    $0x4,%esp
+  8000af:	50                   	push   %eax
+  8000b0:	68 8c 29 80 00       	push   $0x80298c
+  8000b5:	6a 01                	push   $0x1
+  8000b7:	e8 a6 1e 00 00       	call   801f62 <fprintf>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+		buf = readline("Type a line: ");
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	68 7e 29 80 00       	push   $0x80297e
+  8000c7:	e8 79 08 00 00       	call   800945 <readline>
+		if (buf != NULL)
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	75 d9                	jne    8000ac <umain+0x79>
+		else
+			fprintf(1, "(end of file received)\n");
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	68 90 29 80 00       	push   $0x802990
+  8000db:	6a 01                	push   $0x1
+  8000dd:	e8 80 1e 00 00       	call   801f62 <fprintf>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	eb d8                	jmp    8000bf <umain+0x8c>
+
+008000e7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	c3                   	ret
+
+008000ed <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8000f3:	68 a8 29 80 00       	push   $0x8029a8
+  8000f8:	ff 75 0c             	push   0xc(%ebp)
+  8000fb:	e8 70 09 00 00       	call   800a70 <strcpy>
+	return 0;
+}
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	c9                   	leave
+  800106:	c3                   	ret
+
+00800107 <devcons_write>:
+{
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	57                   	push   %edi
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+  80010d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  800113:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800118:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80011e:	eb 2e                	jmp    80014e <devcons_write+0x47>
+		m = n - tot;
+  800120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800123:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  800125:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80012a:	39 c3                	cmp    %eax,%ebx
+  80012c:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  80012f:	83 ec 04             	sub    $0x4,%esp
+  800132:	53                   	push   %ebx
+  800133:	89 f0                	mov    %esi,%eax
+  800135:	03 45 0c             	add    0xc(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	57                   	push   %edi
+  80013a:	e8 b7 0a 00 00       	call   800bf6 <memmove>
+		sys_cputs(buf, m);
+  80013f:	83 c4 08             	add    $0x8,%esp
+  800142:	53                   	push   %ebx
+  800143:	57                   	push   %edi
+  800144:	e8 4d 0d 00 00       	call   800e96 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800149:	01 de                	add    %ebx,%esi
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800151:	72 cd                	jb     800120 <devcons_write+0x19>
+}
+  800153:	89 f0                	mov    %esi,%eax
+  800155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800158:	5b                   	pop    %ebx
+  800159:	5e                   	pop    %esi
+  80015a:	5f                   	pop    %edi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <devcons_read>:
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80016c:	75 07                	jne    800175 <devcons_read+0x18>
+  80016e:	eb 1f                	jmp    80018f <devcons_read+0x32>
+		sys_yield();
+  800170:	e8 cf 0d 00 00       	call   800f44 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  800175:	e8 4b 0d 00 00       	call   800ec5 <sys_cgetc>
+  80017a:	85 c0                	test   %eax,%eax
+  80017c:	74 f2                	je     800170 <devcons_read+0x13>
+	if (c < 0)
+  80017e:	78 0f                	js     80018f <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  800180:	83 f8 04             	cmp    $0x4,%eax
+  800183:	74 0c                	je     800191 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  800185:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800188:	88 02                	mov    %al,(%edx)
+	return 1;
+  80018a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+		return 0;
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	eb f7                	jmp    80018f <devcons_read+0x32>
+
+00800198 <cputchar>:
+{
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80019e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001a1:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8001a4:	6a 01                	push   $0x1
+  8001a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 e7 0c 00 00       	call   800e96 <sys_cputs>
+}
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+008001b4 <getchar>:
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8001ba:	6a 01                	push   $0x1
+  8001bc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001bf:	50                   	push   %eax
+  8001c0:	6a 00                	push   $0x0
+  8001c2:	e8 11 16 00 00       	call   8017d8 <read>
+	if (r < 0)
+  8001c7:	83 c4 10             	add    $0x10,%esp
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	78 06                	js     8001d4 <getchar+0x20>
+	if (r < 1)
+  8001ce:	74 06                	je     8001d6 <getchar+0x22>
+	return c;
+  8001d0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+		return -E_EOF;
+  8001d6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8001db:	eb f7                	jmp    8001d4 <getchar+0x20>
+
+008001dd <iscons>:
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8001e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	ff 75 08             	push   0x8(%ebp)
+  8001ea:	e8 8a 13 00 00       	call   801579 <fd_lookup>
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	78 11                	js     800207 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8001f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001f9:	8b 15 00 30 80 00    	mov    0x803000,%edx
+  8001ff:	39 10                	cmp    %edx,(%eax)
+  800201:	0f 94 c0             	sete   %al
+  800204:	0f b6 c0             	movzbl %al,%eax
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <opencons>:
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80020f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800212:	50                   	push   %eax
+  800213:	e8 0d 13 00 00       	call   801525 <fd_alloc>
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	85 c0                	test   %eax,%eax
+  80021d:	78 3a                	js     800259 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80021f:	83 ec 04             	sub    $0x4,%esp
+  800222:	68 07 04 00 00       	push   $0x407
+  800227:	ff 75 f4             	push   -0xc(%ebp)
+  80022a:	6a 00                	push   $0x0
+  80022c:	e8 32 0d 00 00       	call   800f63 <sys_page_alloc>
+  800231:	83 c4 10             	add    $0x10,%esp
+  800234:	85 c0                	test   %eax,%eax
+  800236:	78 21                	js     800259 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80023b:	8b 15 00 30 80 00    	mov    0x803000,%edx
+  800241:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  800243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800246:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	50                   	push   %eax
+  800251:	e8 a8 12 00 00       	call   8014fe <fd2num>
+  800256:	83 c4 10             	add    $0x10,%esp
+}
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	56                   	push   %esi
+  80025f:	53                   	push   %ebx
+  800260:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800263:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800266:	e8 ba 0c 00 00       	call   800f25 <sys_getenvid>
+  80026b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800270:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800273:	c1 e0 06             	shl    $0x6,%eax
+  800276:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80027b:	a3 08 44 80 00       	mov    %eax,0x804408
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800280:	85 db                	test   %ebx,%ebx
+  800282:	7e 07                	jle    80028b <libmain+0x30>
+		binaryname = argv[0];
+  800284:	8b 06                	mov    (%esi),%eax
+  800286:	a3 1c 30 80 00       	mov    %eax,0x80301c
+
+	// call user main routine
+	umain(argc, argv);
+  80028b:	83 ec 08             	sub    $0x8,%esp
+  80028e:	56                   	push   %esi
+  80028f:	53                   	push   %ebx
+  800290:	e8 9e fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800295:	e8 0a 00 00 00       	call   8002a4 <exit>
+}
+  80029a:	83 c4 10             	add    $0x10,%esp
+  80029d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002a0:	5b                   	pop    %ebx
+  8002a1:	5e                   	pop    %esi
+  8002a2:	5d                   	pop    %ebp
+  8002a3:	c3                   	ret
+
+008002a4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8002aa:	e8 1a 14 00 00       	call   8016c9 <close_all>
+	sys_env_destroy(0);
+  8002af:	83 ec 0c             	sub    $0xc,%esp
+  8002b2:	6a 00                	push   $0x0
+  8002b4:	e8 2b 0c 00 00       	call   800ee4 <sys_env_destroy>
+}
+  8002b9:	83 c4 10             	add    $0x10,%esp
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+008002be <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002be:	55                   	push   %ebp
+  8002bf:	89 e5                	mov    %esp,%ebp
+  8002c1:	56                   	push   %esi
+  8002c2:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8002c3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002c6:	8b 35 1c 30 80 00    	mov    0x80301c,%esi
+  8002cc:	e8 54 0c 00 00       	call   800f25 <sys_getenvid>
+  8002d1:	83 ec 0c             	sub    $0xc,%esp
+  8002d4:	ff 75 0c             	push   0xc(%ebp)
+  8002d7:	ff 75 08             	push   0x8(%ebp)
+  8002da:	56                   	push   %esi
+  8002db:	50                   	push   %eax
+  8002dc:	68 c0 29 80 00       	push   $0x8029c0
+  8002e1:	e8 b3 00 00 00       	call   800399 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8002e6:	83 c4 18             	add    $0x18,%esp
+  8002e9:	53                   	push   %ebx
+  8002ea:	ff 75 10             	push   0x10(%ebp)
+  8002ed:	e8 56 00 00 00       	call   800348 <vcprintf>
+	cprintf("\n");
+  8002f2:	c7 04 24 a6 29 80 00 	movl   $0x8029a6,(%esp)
+  8002f9:	e8 9b 00 00 00       	call   800399 <cprintf>
+  8002fe:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800301:	cc                   	int3
+	while (1)
+  800302:	eb fd                	jmp    800301 <_panic+0x43>
+
+00800304 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800304:	55                   	push   %ebp
+  800305:	89 e5                	mov    %esp,%ebp
+  800307:	53                   	push   %ebx
+  800308:	83 ec 04             	sub    $0x4,%esp
+  80030b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80030e:	8b 13                	mov    (%ebx),%edx
+  800310:	8d 42 01             	lea    0x1(%edx),%eax
+  800313:	89 03                	mov    %eax,(%ebx)
+  800315:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800318:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80031c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800321:	74 09                	je     80032c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800323:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800327:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80032c:	83 ec 08             	sub    $0x8,%esp
+  80032f:	68 ff 00 00 00       	push   $0xff
+  800334:	8d 43 08             	lea    0x8(%ebx),%eax
+  800337:	50                   	push   %eax
+  800338:	e8 59 0b 00 00       	call   800e96 <sys_cputs>
+		b->idx = 0;
+  80033d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800343:	83 c4 10             	add    $0x10,%esp
+  800346:	eb db                	jmp    800323 <putch+0x1f>
+
+00800348 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800348:	55                   	push   %ebp
+  800349:	89 e5                	mov    %esp,%ebp
+  80034b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800351:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800358:	00 00 00 
+	b.cnt = 0;
+  80035b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800362:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800365:	ff 75 0c             	push   0xc(%ebp)
+  800368:	ff 75 08             	push   0x8(%ebp)
+  80036b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800371:	50                   	push   %eax
+  800372:	68 04 03 80 00       	push   $0x800304
+  800377:	e8 14 01 00 00       	call   800490 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80037c:	83 c4 08             	add    $0x8,%esp
+  80037f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800385:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80038b:	50                   	push   %eax
+  80038c:	e8 05 0b 00 00       	call   800e96 <sys_cputs>
+
+	return b.cnt;
+}
+  800391:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800397:	c9                   	leave
+  800398:	c3                   	ret
+
+00800399 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800399:	55                   	push   %ebp
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80039f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8003a2:	50                   	push   %eax
+  8003a3:	ff 75 08             	push   0x8(%ebp)
+  8003a6:	e8 9d ff ff ff       	call   800348 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8003ab:	c9                   	leave
+  8003ac:	c3                   	ret
+
+008003ad <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8003ad:	55                   	push   %ebp
+  8003ae:	89 e5                	mov    %esp,%ebp
+  8003b0:	57                   	push   %edi
+  8003b1:	56                   	push   %esi
+  8003b2:	53                   	push   %ebx
+  8003b3:	83 ec 1c             	sub    $0x1c,%esp
+  8003b6:	89 c7                	mov    %eax,%edi
+  8003b8:	89 d6                	mov    %edx,%esi
+  8003ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003c0:	89 d1                	mov    %edx,%ecx
+  8003c2:	89 c2                	mov    %eax,%edx
+  8003c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003ca:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003cd:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8003d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003da:	39 c2                	cmp    %eax,%edx
+  8003dc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003df:	72 3e                	jb     80041f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003e1:	83 ec 0c             	sub    $0xc,%esp
+  8003e4:	ff 75 18             	push   0x18(%ebp)
+  8003e7:	83 eb 01             	sub    $0x1,%ebx
+  8003ea:	53                   	push   %ebx
+  8003eb:	50                   	push   %eax
+  8003ec:	83 ec 08             	sub    $0x8,%esp
+  8003ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8003f2:	ff 75 e0             	push   -0x20(%ebp)
+  8003f5:	ff 75 dc             	push   -0x24(%ebp)
+  8003f8:	ff 75 d8             	push   -0x28(%ebp)
+  8003fb:	e8 0d 24 00 00       	call   80280d <__udivdi3>
+  800400:	83 c4 18             	add    $0x18,%esp
+  800403:	52                   	push   %edx
+  800404:	50                   	push   %eax
+  800405:	89 f2                	mov    %esi,%edx
+  800407:	89 f8                	mov    %edi,%eax
+  800409:	e8 9f ff ff ff       	call   8003ad <printnum>
+  80040e:	83 c4 20             	add    $0x20,%esp
+  800411:	eb 13                	jmp    800426 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800413:	83 ec 08             	sub    $0x8,%esp
+  800416:	56                   	push   %esi
+  800417:	ff 75 18             	push   0x18(%ebp)
+  80041a:	ff d7                	call   *%edi
+  80041c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80041f:	83 eb 01             	sub    $0x1,%ebx
+  800422:	85 db                	test   %ebx,%ebx
+  800424:	7f ed                	jg     800413 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800426:	83 ec 08             	sub    $0x8,%esp
+  800429:	56                   	push   %esi
+  80042a:	83 ec 04             	sub    $0x4,%esp
+  80042d:	ff 75 e4             	push   -0x1c(%ebp)
+  800430:	ff 75 e0             	push   -0x20(%ebp)
+  800433:	ff 75 dc             	push   -0x24(%ebp)
+  800436:	ff 75 d8             	push   -0x28(%ebp)
+  800439:	e8 ed 23 00 00       	call   80282b <__umoddi3>
+  80043e:	83 c4 14             	add    $0x14,%esp
+  800441:	0f be 80 e3 29 80 00 	movsbl 0x8029e3(%eax),%eax
+  800448:	50                   	push   %eax
+  800449:	ff d7                	call   *%edi
+}
+  80044b:	83 c4 10             	add    $0x10,%esp
+  80044e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800451:	5b                   	pop    %ebx
+  800452:	5e                   	pop    %esi
+  800453:	5f                   	pop    %edi
+  800454:	5d                   	pop    %ebp
+  800455:	c3                   	ret
+
+00800456 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800456:	55                   	push   %ebp
+  800457:	89 e5                	mov    %esp,%ebp
+  800459:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80045c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800460:	8b 10                	mov    (%eax),%edx
+  800462:	3b 50 04             	cmp    0x4(%eax),%edx
+  800465:	73 0a                	jae    800471 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800467:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80046a:	89 08                	mov    %ecx,(%eax)
+  80046c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80046f:	88 02                	mov    %al,(%edx)
+}
+  800471:	5d                   	pop    %ebp
+  800472:	c3                   	ret
+
+00800473 <printfmt>:
+{
+  800473:	55                   	push   %ebp
+  800474:	89 e5                	mov    %esp,%ebp
+  800476:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800479:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80047c:	50                   	push   %eax
+  80047d:	ff 75 10             	push   0x10(%ebp)
+  800480:	ff 75 0c             	push   0xc(%ebp)
+  800483:	ff 75 08             	push   0x8(%ebp)
+  800486:	e8 05 00 00 00       	call   800490 <vprintfmt>
+}
+  80048b:	83 c4 10             	add    $0x10,%esp
+  80048e:	c9                   	leave
+  80048f:	c3                   	ret
+
+00800490 <vprintfmt>:
+{
+  800490:	55                   	push   %ebp
+  800491:	89 e5                	mov    %esp,%ebp
+  800493:	57                   	push   %edi
+  800494:	56                   	push   %esi
+  800495:	53                   	push   %ebx
+  800496:	83 ec 2c             	sub    $0x2c,%esp
+  800499:	8b 75 08             	mov    0x8(%ebp),%esi
+  80049c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80049f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004a2:	eb 0a                	jmp    8004ae <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8004a4:	83 ec 08             	sub    $0x8,%esp
+  8004a7:	53                   	push   %ebx
+  8004a8:	50                   	push   %eax
+  8004a9:	ff d6                	call   *%esi
+  8004ab:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8004ae:	83 c7 01             	add    $0x1,%edi
+  8004b1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004b5:	83 f8 25             	cmp    $0x25,%eax
+  8004b8:	74 0c                	je     8004c6 <vprintfmt+0x36>
+			if (ch == '\0')
+  8004ba:	85 c0                	test   %eax,%eax
+  8004bc:	75 e6                	jne    8004a4 <vprintfmt+0x14>
+}
+  8004be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c1:	5b                   	pop    %ebx
+  8004c2:	5e                   	pop    %esi
+  8004c3:	5f                   	pop    %edi
+  8004c4:	5d                   	pop    %ebp
+  8004c5:	c3                   	ret
+		padc = ' ';
+  8004c6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8004ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8004d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8004d8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8004df:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e4:	8d 47 01             	lea    0x1(%edi),%eax
+  8004e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004ea:	0f b6 17             	movzbl (%edi),%edx
+  8004ed:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004f0:	3c 55                	cmp    $0x55,%al
+  8004f2:	0f 87 c5 03 00 00    	ja     8008bd <vprintfmt+0x42d>
+  8004f8:	0f b6 c0             	movzbl %al,%eax
+  8004fb:	ff 24 85 60 2b 80 00 	jmp    *0x802b60(,%eax,4)
+  800502:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800505:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800509:	eb d9                	jmp    8004e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80050b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80050e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800512:	eb d0                	jmp    8004e4 <vprintfmt+0x54>
+  800514:	0f b6 d2             	movzbl %dl,%edx
+  800517:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800522:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800525:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800529:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80052c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80052f:	83 f9 09             	cmp    $0x9,%ecx
+  800532:	77 55                	ja     800589 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800534:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800537:	eb e9                	jmp    800522 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800539:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053c:	8b 00                	mov    (%eax),%eax
+  80053e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800541:	8b 45 14             	mov    0x14(%ebp),%eax
+  800544:	8d 40 04             	lea    0x4(%eax),%eax
+  800547:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80054a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80054d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800551:	79 91                	jns    8004e4 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800553:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800556:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800559:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800560:	eb 82                	jmp    8004e4 <vprintfmt+0x54>
+			if (width < 0)
+  800562:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800565:	85 d2                	test   %edx,%edx
+  800567:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056c:	0f 49 c2             	cmovns %edx,%eax
+  80056f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800572:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800575:	e9 6a ff ff ff       	jmp    8004e4 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80057a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80057d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800584:	e9 5b ff ff ff       	jmp    8004e4 <vprintfmt+0x54>
+  800589:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80058c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80058f:	eb bc                	jmp    80054d <vprintfmt+0xbd>
+			lflag++;
+  800591:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800594:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800597:	e9 48 ff ff ff       	jmp    8004e4 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80059c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059f:	8d 78 04             	lea    0x4(%eax),%edi
+  8005a2:	83 ec 08             	sub    $0x8,%esp
+  8005a5:	53                   	push   %ebx
+  8005a6:	ff 30                	push   (%eax)
+  8005a8:	ff d6                	call   *%esi
+			break;
+  8005aa:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8005ad:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8005b0:	e9 63 02 00 00       	jmp    800818 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8005bb:	8b 10                	mov    (%eax),%edx
+  8005bd:	89 d0                	mov    %edx,%eax
+  8005bf:	f7 d8                	neg    %eax
+  8005c1:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005c4:	83 f8 12             	cmp    $0x12,%eax
+  8005c7:	7f 23                	jg     8005ec <vprintfmt+0x15c>
+  8005c9:	8b 14 85 c0 2c 80 00 	mov    0x802cc0(,%eax,4),%edx
+  8005d0:	85 d2                	test   %edx,%edx
+  8005d2:	74 18                	je     8005ec <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8005d4:	52                   	push   %edx
+  8005d5:	68 0d 2e 80 00       	push   $0x802e0d
+  8005da:	53                   	push   %ebx
+  8005db:	56                   	push   %esi
+  8005dc:	e8 92 fe ff ff       	call   800473 <printfmt>
+  8005e1:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005e7:	e9 2c 02 00 00       	jmp    800818 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8005ec:	50                   	push   %eax
+  8005ed:	68 fb 29 80 00       	push   $0x8029fb
+  8005f2:	53                   	push   %ebx
+  8005f3:	56                   	push   %esi
+  8005f4:	e8 7a fe ff ff       	call   800473 <printfmt>
+  8005f9:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8005fc:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8005ff:	e9 14 02 00 00       	jmp    800818 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	83 c0 04             	add    $0x4,%eax
+  80060a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800612:	85 c9                	test   %ecx,%ecx
+  800614:	b8 f4 29 80 00       	mov    $0x8029f4,%eax
+  800619:	0f 45 c1             	cmovne %ecx,%eax
+  80061c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80061f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800623:	7e 06                	jle    80062b <vprintfmt+0x19b>
+  800625:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800629:	75 0b                	jne    800636 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80062b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80062e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800631:	89 75 08             	mov    %esi,0x8(%ebp)
+  800634:	eb 5c                	jmp    800692 <vprintfmt+0x202>
+  800636:	83 ec 08             	sub    $0x8,%esp
+  800639:	ff 75 d0             	push   -0x30(%ebp)
+  80063c:	ff 75 cc             	push   -0x34(%ebp)
+  80063f:	e8 09 04 00 00       	call   800a4d <strnlen>
+  800644:	89 c2                	mov    %eax,%edx
+  800646:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800649:	29 d0                	sub    %edx,%eax
+  80064b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80064e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800652:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800655:	89 75 08             	mov    %esi,0x8(%ebp)
+  800658:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80065a:	eb 0e                	jmp    80066a <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80065c:	83 ec 08             	sub    $0x8,%esp
+  80065f:	53                   	push   %ebx
+  800660:	57                   	push   %edi
+  800661:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800664:	83 ee 01             	sub    $0x1,%esi
+  800667:	83 c4 10             	add    $0x10,%esp
+  80066a:	85 f6                	test   %esi,%esi
+  80066c:	7f ee                	jg     80065c <vprintfmt+0x1cc>
+  80066e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800671:	8b 75 08             	mov    0x8(%ebp),%esi
+  800674:	85 c0                	test   %eax,%eax
+  800676:	ba 00 00 00 00       	mov    $0x0,%edx
+  80067b:	0f 49 d0             	cmovns %eax,%edx
+  80067e:	29 d0                	sub    %edx,%eax
+  800680:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800683:	eb a6                	jmp    80062b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800685:	83 ec 08             	sub    $0x8,%esp
+  800688:	53                   	push   %ebx
+  800689:	52                   	push   %edx
+  80068a:	ff 55 08             	call   *0x8(%ebp)
+  80068d:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800690:	89 f1                	mov    %esi,%ecx
+  800692:	8d 71 01             	lea    0x1(%ecx),%esi
+  800695:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800699:	0f be d0             	movsbl %al,%edx
+  80069c:	85 d2                	test   %edx,%edx
+  80069e:	74 28                	je     8006c8 <vprintfmt+0x238>
+  8006a0:	85 ff                	test   %edi,%edi
+  8006a2:	78 05                	js     8006a9 <vprintfmt+0x219>
+  8006a4:	83 ef 01             	sub    $0x1,%edi
+  8006a7:	78 30                	js     8006d9 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8006a9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006ad:	74 d6                	je     800685 <vprintfmt+0x1f5>
+  8006af:	0f be c0             	movsbl %al,%eax
+  8006b2:	83 e8 20             	sub    $0x20,%eax
+  8006b5:	83 f8 5e             	cmp    $0x5e,%eax
+  8006b8:	76 cb                	jbe    800685 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8006ba:	83 ec 08             	sub    $0x8,%esp
+  8006bd:	53                   	push   %ebx
+  8006be:	6a 3f                	push   $0x3f
+  8006c0:	ff 55 08             	call   *0x8(%ebp)
+  8006c3:	83 c4 10             	add    $0x10,%esp
+  8006c6:	eb c8                	jmp    800690 <vprintfmt+0x200>
+  8006c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006cb:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006d1:	01 d0                	add    %edx,%eax
+  8006d3:	29 c8                	sub    %ecx,%eax
+  8006d5:	89 c7                	mov    %eax,%edi
+  8006d7:	eb 13                	jmp    8006ec <vprintfmt+0x25c>
+  8006d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006dc:	eb ed                	jmp    8006cb <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8006de:	83 ec 08             	sub    $0x8,%esp
+  8006e1:	53                   	push   %ebx
+  8006e2:	6a 20                	push   $0x20
+  8006e4:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8006e6:	83 ef 01             	sub    $0x1,%edi
+  8006e9:	83 c4 10             	add    $0x10,%esp
+  8006ec:	85 ff                	test   %edi,%edi
+  8006ee:	7f ee                	jg     8006de <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8006f0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006f3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f6:	e9 1d 01 00 00       	jmp    800818 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8006fb:	83 f9 01             	cmp    $0x1,%ecx
+  8006fe:	7f 1b                	jg     80071b <vprintfmt+0x28b>
+	else if (lflag)
+  800700:	85 c9                	test   %ecx,%ecx
+  800702:	74 63                	je     800767 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 00                	mov    (%eax),%eax
+  800709:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80070c:	99                   	cltd
+  80070d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8d 40 04             	lea    0x4(%eax),%eax
+  800716:	89 45 14             	mov    %eax,0x14(%ebp)
+  800719:	eb 17                	jmp    800732 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80071b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071e:	8b 50 04             	mov    0x4(%eax),%edx
+  800721:	8b 00                	mov    (%eax),%eax
+  800723:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800726:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072c:	8d 40 08             	lea    0x8(%eax),%eax
+  80072f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800732:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800735:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800738:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80073d:	85 c9                	test   %ecx,%ecx
+  80073f:	0f 89 b9 00 00 00    	jns    8007fe <vprintfmt+0x36e>
+				putch('-', putdat);
+  800745:	83 ec 08             	sub    $0x8,%esp
+  800748:	53                   	push   %ebx
+  800749:	6a 2d                	push   $0x2d
+  80074b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80074d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800750:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800753:	f7 da                	neg    %edx
+  800755:	83 d1 00             	adc    $0x0,%ecx
+  800758:	f7 d9                	neg    %ecx
+  80075a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80075d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800762:	e9 97 00 00 00       	jmp    8007fe <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800767:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076a:	8b 00                	mov    (%eax),%eax
+  80076c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80076f:	99                   	cltd
+  800770:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800773:	8b 45 14             	mov    0x14(%ebp),%eax
+  800776:	8d 40 04             	lea    0x4(%eax),%eax
+  800779:	89 45 14             	mov    %eax,0x14(%ebp)
+  80077c:	eb b4                	jmp    800732 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  80077e:	83 f9 01             	cmp    $0x1,%ecx
+  800781:	7f 1b                	jg     80079e <vprintfmt+0x30e>
+	else if (lflag)
+  800783:	85 c9                	test   %ecx,%ecx
+  800785:	74 2c                	je     8007b3 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800787:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078a:	8b 10                	mov    (%eax),%edx
+  80078c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800791:	8d 40 04             	lea    0x4(%eax),%eax
+  800794:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800797:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80079c:	eb 60                	jmp    8007fe <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80079e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a1:	8b 10                	mov    (%eax),%edx
+  8007a3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8007b1:	eb 4b                	jmp    8007fe <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 10                	mov    (%eax),%edx
+  8007b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8007c3:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8007c8:	eb 34                	jmp    8007fe <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007ca:	83 f9 01             	cmp    $0x1,%ecx
+  8007cd:	7f 15                	jg     8007e4 <vprintfmt+0x354>
+	else if (lflag)
+  8007cf:	85 c9                	test   %ecx,%ecx
+  8007d1:	74 4d                	je     800820 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8007d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d6:	8b 00                	mov    (%eax),%eax
+  8007d8:	99                   	cltd
+  8007d9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007dc:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8007df:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8007e2:	eb 11                	jmp    8007f5 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8007e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e7:	8b 50 04             	mov    0x4(%eax),%edx
+  8007ea:	8b 00                	mov    (%eax),%eax
+  8007ec:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007ef:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8007f2:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8007f5:	89 d1                	mov    %edx,%ecx
+  8007f7:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8007f9:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8007fe:	83 ec 0c             	sub    $0xc,%esp
+  800801:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800805:	50                   	push   %eax
+  800806:	ff 75 e0             	push   -0x20(%ebp)
+  800809:	57                   	push   %edi
+  80080a:	51                   	push   %ecx
+  80080b:	52                   	push   %edx
+  80080c:	89 da                	mov    %ebx,%edx
+  80080e:	89 f0                	mov    %esi,%eax
+  800810:	e8 98 fb ff ff       	call   8003ad <printnum>
+			break;
+  800815:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800818:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80081b:	e9 8e fc ff ff       	jmp    8004ae <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800820:	8b 45 14             	mov    0x14(%ebp),%eax
+  800823:	8b 00                	mov    (%eax),%eax
+  800825:	99                   	cltd
+  800826:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800829:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80082c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80082f:	eb c4                	jmp    8007f5 <vprintfmt+0x365>
+			putch('0', putdat);
+  800831:	83 ec 08             	sub    $0x8,%esp
+  800834:	53                   	push   %ebx
+  800835:	6a 30                	push   $0x30
+  800837:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800839:	83 c4 08             	add    $0x8,%esp
+  80083c:	53                   	push   %ebx
+  80083d:	6a 78                	push   $0x78
+  80083f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800841:	8b 45 14             	mov    0x14(%ebp),%eax
+  800844:	8b 10                	mov    (%eax),%edx
+  800846:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80084b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80084e:	8d 40 04             	lea    0x4(%eax),%eax
+  800851:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800854:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800859:	eb a3                	jmp    8007fe <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80085b:	83 f9 01             	cmp    $0x1,%ecx
+  80085e:	7f 1b                	jg     80087b <vprintfmt+0x3eb>
+	else if (lflag)
+  800860:	85 c9                	test   %ecx,%ecx
+  800862:	74 2f                	je     800893 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800864:	8b 45 14             	mov    0x14(%ebp),%eax
+  800867:	8b 10                	mov    (%eax),%edx
+  800869:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086e:	8d 40 04             	lea    0x4(%eax),%eax
+  800871:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800874:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800879:	eb 83                	jmp    8007fe <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80087b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087e:	8b 10                	mov    (%eax),%edx
+  800880:	8b 48 04             	mov    0x4(%eax),%ecx
+  800883:	8d 40 08             	lea    0x8(%eax),%eax
+  800886:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800889:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80088e:	e9 6b ff ff ff       	jmp    8007fe <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800893:	8b 45 14             	mov    0x14(%ebp),%eax
+  800896:	8b 10                	mov    (%eax),%edx
+  800898:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80089d:	8d 40 04             	lea    0x4(%eax),%eax
+  8008a0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008a3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8008a8:	e9 51 ff ff ff       	jmp    8007fe <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8008ad:	83 ec 08             	sub    $0x8,%esp
+  8008b0:	53                   	push   %ebx
+  8008b1:	6a 25                	push   $0x25
+  8008b3:	ff d6                	call   *%esi
+			break;
+  8008b5:	83 c4 10             	add    $0x10,%esp
+  8008b8:	e9 5b ff ff ff       	jmp    800818 <vprintfmt+0x388>
+			putch('%', putdat);
+  8008bd:	83 ec 08             	sub    $0x8,%esp
+  8008c0:	53                   	push   %ebx
+  8008c1:	6a 25                	push   $0x25
+  8008c3:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8008c5:	83 c4 10             	add    $0x10,%esp
+  8008c8:	89 f8                	mov    %edi,%eax
+  8008ca:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008ce:	74 05                	je     8008d5 <vprintfmt+0x445>
+  8008d0:	83 e8 01             	sub    $0x1,%eax
+  8008d3:	eb f5                	jmp    8008ca <vprintfmt+0x43a>
+  8008d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008d8:	e9 3b ff ff ff       	jmp    800818 <vprintfmt+0x388>
+
+008008dd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	83 ec 18             	sub    $0x18,%esp
+  8008e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8008e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008ec:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008f0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008f3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8008fa:	85 c0                	test   %eax,%eax
+  8008fc:	74 26                	je     800924 <vsnprintf+0x47>
+  8008fe:	85 d2                	test   %edx,%edx
+  800900:	7e 22                	jle    800924 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800902:	ff 75 14             	push   0x14(%ebp)
+  800905:	ff 75 10             	push   0x10(%ebp)
+  800908:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80090b:	50                   	push   %eax
+  80090c:	68 56 04 80 00       	push   $0x800456
+  800911:	e8 7a fb ff ff       	call   800490 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800916:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800919:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80091c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80091f:	83 c4 10             	add    $0x10,%esp
+}
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+		return -E_INVAL;
+  800924:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800929:	eb f7                	jmp    800922 <vsnprintf+0x45>
+
+0080092b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800931:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800934:	50                   	push   %eax
+  800935:	ff 75 10             	push   0x10(%ebp)
+  800938:	ff 75 0c             	push   0xc(%ebp)
+  80093b:	ff 75 08             	push   0x8(%ebp)
+  80093e:	e8 9a ff ff ff       	call   8008dd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800943:	c9                   	leave
+  800944:	c3                   	ret
+
+00800945 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  800945:	55                   	push   %ebp
+  800946:	89 e5                	mov    %esp,%ebp
+  800948:	57                   	push   %edi
+  800949:	56                   	push   %esi
+  80094a:	53                   	push   %ebx
+  80094b:	83 ec 0c             	sub    $0xc,%esp
+  80094e:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+	if (prompt != NULL)
+		cprintf("%s", prompt);
+#else
+	if (prompt != NULL)
+  800951:	85 c0                	test   %eax,%eax
+  800953:	74 13                	je     800968 <readline+0x23>
+		fprintf(1, "%s", prompt);
+  800955:	83 ec 04             	sub    $0x4,%esp
+  800958:	50                   	push   %eax
+  800959:	68 0d 2e 80 00       	push   $0x802e0d
+  80095e:	6a 01                	push   $0x1
+  800960:	e8 fd 15 00 00       	call   801f62 <fprintf>
+  800965:	83 c4 10             	add    $0x10,%esp
+#endif
+
+	i = 0;
+	echoing = iscons(0);
+  800968:	83 ec 0c             	sub    $0xc,%esp
+  80096b:	6a 00                	push   $0x0
+  80096d:	e8 6b f8 ff ff       	call   8001dd <iscons>
+  800972:	89 c7                	mov    %eax,%edi
+  800974:	83 c4 10             	add    $0x10,%esp
+	i = 0;
+  800977:	be 00 00 00 00       	mov    $0x0,%esi
+  80097c:	eb 4b                	jmp    8009c9 <readline+0x84>
+	while (1) {
+		c = getchar();
+		if (c < 0) {
+			if (c != -E_EOF)
+				cprintf("read error: %e\n", c);
+			return NULL;
+  80097e:	b8 00 00 00 00       	mov    $0x0,%eax
+			if (c != -E_EOF)
+  800983:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  800986:	75 08                	jne    800990 <readline+0x4b>
+				cputchar('\n');
+			buf[i] = 0;
+			return buf;
+		}
+	}
+}
+  800988:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80098b:	5b                   	pop    %ebx
+  80098c:	5e                   	pop    %esi
+  80098d:	5f                   	pop    %edi
+  80098e:	5d                   	pop    %ebp
+  80098f:	c3                   	ret
+				cprintf("read error: %e\n", c);
+  800990:	83 ec 08             	sub    $0x8,%esp
+  800993:	53                   	push   %ebx
+  800994:	68 2b 2d 80 00       	push   $0x802d2b
+  800999:	e8 fb f9 ff ff       	call   800399 <cprintf>
+  80099e:	83 c4 10             	add    $0x10,%esp
+			return NULL;
+  8009a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a6:	eb e0                	jmp    800988 <readline+0x43>
+			if (echoing)
+  8009a8:	85 ff                	test   %edi,%edi
+  8009aa:	75 05                	jne    8009b1 <readline+0x6c>
+			i--;
+  8009ac:	83 ee 01             	sub    $0x1,%esi
+  8009af:	eb 18                	jmp    8009c9 <readline+0x84>
+				cputchar('\b');
+  8009b1:	83 ec 0c             	sub    $0xc,%esp
+  8009b4:	6a 08                	push   $0x8
+  8009b6:	e8 dd f7 ff ff       	call   800198 <cputchar>
+  8009bb:	83 c4 10             	add    $0x10,%esp
+  8009be:	eb ec                	jmp    8009ac <readline+0x67>
+			buf[i++] = c;
+  8009c0:	88 9e 00 40 80 00    	mov    %bl,0x804000(%esi)
+  8009c6:	8d 76 01             	lea    0x1(%esi),%esi
+		c = getchar();
+  8009c9:	e8 e6 f7 ff ff       	call   8001b4 <getchar>
+  8009ce:	89 c3                	mov    %eax,%ebx
+		if (c < 0) {
+  8009d0:	85 c0                	test   %eax,%eax
+  8009d2:	78 aa                	js     80097e <readline+0x39>
+		} else if ((c == '\b' || c == '\x7f') && i > 0) {
+  8009d4:	83 f8 08             	cmp    $0x8,%eax
+  8009d7:	0f 94 c0             	sete   %al
+  8009da:	83 fb 7f             	cmp    $0x7f,%ebx
+  8009dd:	0f 94 c2             	sete   %dl
+  8009e0:	08 d0                	or     %dl,%al
+  8009e2:	74 04                	je     8009e8 <readline+0xa3>
+  8009e4:	85 f6                	test   %esi,%esi
+  8009e6:	7f c0                	jg     8009a8 <readline+0x63>
+		} else if (c >= ' ' && i < BUFLEN-1) {
+  8009e8:	83 fb 1f             	cmp    $0x1f,%ebx
+  8009eb:	7e 1a                	jle    800a07 <readline+0xc2>
+  8009ed:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  8009f3:	7f 12                	jg     800a07 <readline+0xc2>
+			if (echoing)
+  8009f5:	85 ff                	test   %edi,%edi
+  8009f7:	74 c7                	je     8009c0 <readline+0x7b>
+				cputchar(c);
+  8009f9:	83 ec 0c             	sub    $0xc,%esp
+  8009fc:	53                   	push   %ebx
+  8009fd:	e8 96 f7 ff ff       	call   800198 <cputchar>
+  800a02:	83 c4 10             	add    $0x10,%esp
+  800a05:	eb b9                	jmp    8009c0 <readline+0x7b>
+		} else if (c == '\n' || c == '\r') {
+  800a07:	83 fb 0a             	cmp    $0xa,%ebx
+  800a0a:	74 05                	je     800a11 <readline+0xcc>
+  800a0c:	83 fb 0d             	cmp    $0xd,%ebx
+  800a0f:	75 b8                	jne    8009c9 <readline+0x84>
+			if (echoing)
+  800a11:	85 ff                	test   %edi,%edi
+  800a13:	75 11                	jne    800a26 <readline+0xe1>
+			buf[i] = 0;
+  800a15:	c6 86 00 40 80 00 00 	movb   $0x0,0x804000(%esi)
+			return buf;
+  800a1c:	b8 00 40 80 00       	mov    $0x804000,%eax
+  800a21:	e9 62 ff ff ff       	jmp    800988 <readline+0x43>
+				cputchar('\n');
+  800a26:	83 ec 0c             	sub    $0xc,%esp
+  800a29:	6a 0a                	push   $0xa
+  800a2b:	e8 68 f7 ff ff       	call   800198 <cputchar>
+  800a30:	83 c4 10             	add    $0x10,%esp
+  800a33:	eb e0                	jmp    800a15 <readline+0xd0>
+
+00800a35 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a40:	eb 03                	jmp    800a45 <strlen+0x10>
+		n++;
+  800a42:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800a45:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a49:	75 f7                	jne    800a42 <strlen+0xd>
+	return n;
+}
+  800a4b:	5d                   	pop    %ebp
+  800a4c:	c3                   	ret
+
+00800a4d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a4d:	55                   	push   %ebp
+  800a4e:	89 e5                	mov    %esp,%ebp
+  800a50:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a5b:	eb 03                	jmp    800a60 <strnlen+0x13>
+		n++;
+  800a5d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a60:	39 d0                	cmp    %edx,%eax
+  800a62:	74 08                	je     800a6c <strnlen+0x1f>
+  800a64:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a68:	75 f3                	jne    800a5d <strnlen+0x10>
+  800a6a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800a6c:	89 d0                	mov    %edx,%eax
+  800a6e:	5d                   	pop    %ebp
+  800a6f:	c3                   	ret
+
+00800a70 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a70:	55                   	push   %ebp
+  800a71:	89 e5                	mov    %esp,%ebp
+  800a73:	53                   	push   %ebx
+  800a74:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a77:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a83:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a86:	83 c0 01             	add    $0x1,%eax
+  800a89:	84 d2                	test   %dl,%dl
+  800a8b:	75 f2                	jne    800a7f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a8d:	89 c8                	mov    %ecx,%eax
+  800a8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a92:	c9                   	leave
+  800a93:	c3                   	ret
+
+00800a94 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a94:	55                   	push   %ebp
+  800a95:	89 e5                	mov    %esp,%ebp
+  800a97:	53                   	push   %ebx
+  800a98:	83 ec 10             	sub    $0x10,%esp
+  800a9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a9e:	53                   	push   %ebx
+  800a9f:	e8 91 ff ff ff       	call   800a35 <strlen>
+  800aa4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800aa7:	ff 75 0c             	push   0xc(%ebp)
+  800aaa:	01 d8                	add    %ebx,%eax
+  800aac:	50                   	push   %eax
+  800aad:	e8 be ff ff ff       	call   800a70 <strcpy>
+	return dst;
+}
+  800ab2:	89 d8                	mov    %ebx,%eax
+  800ab4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ab7:	c9                   	leave
+  800ab8:	c3                   	ret
+
+00800ab9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ab9:	55                   	push   %ebp
+  800aba:	89 e5                	mov    %esp,%ebp
+  800abc:	56                   	push   %esi
+  800abd:	53                   	push   %ebx
+  800abe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ac4:	89 f3                	mov    %esi,%ebx
+  800ac6:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ac9:	89 f0                	mov    %esi,%eax
+  800acb:	eb 0f                	jmp    800adc <strncpy+0x23>
+		*dst++ = *src;
+  800acd:	83 c0 01             	add    $0x1,%eax
+  800ad0:	0f b6 0a             	movzbl (%edx),%ecx
+  800ad3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800ad6:	80 f9 01             	cmp    $0x1,%cl
+  800ad9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800adc:	39 d8                	cmp    %ebx,%eax
+  800ade:	75 ed                	jne    800acd <strncpy+0x14>
+	}
+	return ret;
+}
+  800ae0:	89 f0                	mov    %esi,%eax
+  800ae2:	5b                   	pop    %ebx
+  800ae3:	5e                   	pop    %esi
+  800ae4:	5d                   	pop    %ebp
+  800ae5:	c3                   	ret
+
+00800ae6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ae6:	55                   	push   %ebp
+  800ae7:	89 e5                	mov    %esp,%ebp
+  800ae9:	56                   	push   %esi
+  800aea:	53                   	push   %ebx
+  800aeb:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af1:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800af4:	89 f0                	mov    %esi,%eax
+  800af6:	85 d2                	test   %edx,%edx
+  800af8:	74 21                	je     800b1b <strlcpy+0x35>
+  800afa:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800afe:	89 f2                	mov    %esi,%edx
+  800b00:	eb 09                	jmp    800b0b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800b02:	83 c1 01             	add    $0x1,%ecx
+  800b05:	83 c2 01             	add    $0x1,%edx
+  800b08:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800b0b:	39 c2                	cmp    %eax,%edx
+  800b0d:	74 09                	je     800b18 <strlcpy+0x32>
+  800b0f:	0f b6 19             	movzbl (%ecx),%ebx
+  800b12:	84 db                	test   %bl,%bl
+  800b14:	75 ec                	jne    800b02 <strlcpy+0x1c>
+  800b16:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800b18:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800b1b:	29 f0                	sub    %esi,%eax
+}
+  800b1d:	5b                   	pop    %ebx
+  800b1e:	5e                   	pop    %esi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b27:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800b2a:	eb 06                	jmp    800b32 <strcmp+0x11>
+		p++, q++;
+  800b2c:	83 c1 01             	add    $0x1,%ecx
+  800b2f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800b32:	0f b6 01             	movzbl (%ecx),%eax
+  800b35:	84 c0                	test   %al,%al
+  800b37:	74 04                	je     800b3d <strcmp+0x1c>
+  800b39:	3a 02                	cmp    (%edx),%al
+  800b3b:	74 ef                	je     800b2c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b3d:	0f b6 c0             	movzbl %al,%eax
+  800b40:	0f b6 12             	movzbl (%edx),%edx
+  800b43:	29 d0                	sub    %edx,%eax
+}
+  800b45:	5d                   	pop    %ebp
+  800b46:	c3                   	ret
+
+00800b47 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b47:	55                   	push   %ebp
+  800b48:	89 e5                	mov    %esp,%ebp
+  800b4a:	53                   	push   %ebx
+  800b4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b51:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800b54:	eb 09                	jmp    800b5f <strncmp+0x18>
+		n--, p++, q++;
+  800b56:	83 ea 01             	sub    $0x1,%edx
+  800b59:	83 c0 01             	add    $0x1,%eax
+  800b5c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800b5f:	85 d2                	test   %edx,%edx
+  800b61:	74 18                	je     800b7b <strncmp+0x34>
+  800b63:	0f b6 18             	movzbl (%eax),%ebx
+  800b66:	84 db                	test   %bl,%bl
+  800b68:	74 04                	je     800b6e <strncmp+0x27>
+  800b6a:	3a 19                	cmp    (%ecx),%bl
+  800b6c:	74 e8                	je     800b56 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800b6e:	0f b6 00             	movzbl (%eax),%eax
+  800b71:	0f b6 11             	movzbl (%ecx),%edx
+  800b74:	29 d0                	sub    %edx,%eax
+}
+  800b76:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b79:	c9                   	leave
+  800b7a:	c3                   	ret
+		return 0;
+  800b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b80:	eb f4                	jmp    800b76 <strncmp+0x2f>
+
+00800b82 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b88:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b8c:	eb 03                	jmp    800b91 <strchr+0xf>
+  800b8e:	83 c0 01             	add    $0x1,%eax
+  800b91:	0f b6 10             	movzbl (%eax),%edx
+  800b94:	84 d2                	test   %dl,%dl
+  800b96:	74 06                	je     800b9e <strchr+0x1c>
+		if (*s == c)
+  800b98:	38 ca                	cmp    %cl,%dl
+  800b9a:	75 f2                	jne    800b8e <strchr+0xc>
+  800b9c:	eb 05                	jmp    800ba3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ba3:	5d                   	pop    %ebp
+  800ba4:	c3                   	ret
+
+00800ba5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ba5:	55                   	push   %ebp
+  800ba6:	89 e5                	mov    %esp,%ebp
+  800ba8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bab:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800baf:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800bb2:	38 ca                	cmp    %cl,%dl
+  800bb4:	74 09                	je     800bbf <strfind+0x1a>
+  800bb6:	84 d2                	test   %dl,%dl
+  800bb8:	74 05                	je     800bbf <strfind+0x1a>
+	for (; *s; s++)
+  800bba:	83 c0 01             	add    $0x1,%eax
+  800bbd:	eb f0                	jmp    800baf <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	c3                   	ret
+
+00800bc1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bc1:	55                   	push   %ebp
+  800bc2:	89 e5                	mov    %esp,%ebp
+  800bc4:	57                   	push   %edi
+  800bc5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bc8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800bcb:	85 c9                	test   %ecx,%ecx
+  800bcd:	74 20                	je     800bef <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800bcf:	89 f8                	mov    %edi,%eax
+  800bd1:	09 c8                	or     %ecx,%eax
+  800bd3:	a8 03                	test   $0x3,%al
+  800bd5:	75 12                	jne    800be9 <memset+0x28>
+		c &= 0xFF;
+  800bd7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bdb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800be1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800be4:	fc                   	cld
+  800be5:	f3 ab                	rep stos %eax,%es:(%edi)
+  800be7:	eb 06                	jmp    800bef <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800be9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bec:	fc                   	cld
+  800bed:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800bef:	89 f8                	mov    %edi,%eax
+  800bf1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bf4:	c9                   	leave
+  800bf5:	c3                   	ret
+
+00800bf6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bf6:	55                   	push   %ebp
+  800bf7:	89 e5                	mov    %esp,%ebp
+  800bf9:	57                   	push   %edi
+  800bfa:	56                   	push   %esi
+  800bfb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bfe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c01:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800c04:	39 c6                	cmp    %eax,%esi
+  800c06:	73 32                	jae    800c3a <memmove+0x44>
+  800c08:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c0b:	39 d0                	cmp    %edx,%eax
+  800c0d:	73 2b                	jae    800c3a <memmove+0x44>
+		s += n;
+		d += n;
+  800c0f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c12:	89 d6                	mov    %edx,%esi
+  800c14:	09 fe                	or     %edi,%esi
+  800c16:	09 ce                	or     %ecx,%esi
+  800c18:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c1e:	75 0e                	jne    800c2e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c20:	83 ef 04             	sub    $0x4,%edi
+  800c23:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c26:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800c29:	fd                   	std
+  800c2a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c2c:	eb 09                	jmp    800c37 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c2e:	83 ef 01             	sub    $0x1,%edi
+  800c31:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800c34:	fd                   	std
+  800c35:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800c37:	fc                   	cld
+  800c38:	eb 1a                	jmp    800c54 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c3a:	89 f2                	mov    %esi,%edx
+  800c3c:	09 c2                	or     %eax,%edx
+  800c3e:	09 ca                	or     %ecx,%edx
+  800c40:	f6 c2 03             	test   $0x3,%dl
+  800c43:	75 0a                	jne    800c4f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c45:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800c48:	89 c7                	mov    %eax,%edi
+  800c4a:	fc                   	cld
+  800c4b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c4d:	eb 05                	jmp    800c54 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800c4f:	89 c7                	mov    %eax,%edi
+  800c51:	fc                   	cld
+  800c52:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800c54:	5e                   	pop    %esi
+  800c55:	5f                   	pop    %edi
+  800c56:	5d                   	pop    %ebp
+  800c57:	c3                   	ret
+
+00800c58 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c58:	55                   	push   %ebp
+  800c59:	89 e5                	mov    %esp,%ebp
+  800c5b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800c5e:	ff 75 10             	push   0x10(%ebp)
+  800c61:	ff 75 0c             	push   0xc(%ebp)
+  800c64:	ff 75 08             	push   0x8(%ebp)
+  800c67:	e8 8a ff ff ff       	call   800bf6 <memmove>
+}
+  800c6c:	c9                   	leave
+  800c6d:	c3                   	ret
+
+00800c6e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	56                   	push   %esi
+  800c72:	53                   	push   %ebx
+  800c73:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c76:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c79:	89 c6                	mov    %eax,%esi
+  800c7b:	03 75 10             	add    0x10(%ebp),%esi
+  800c7e:	eb 06                	jmp    800c86 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c80:	83 c0 01             	add    $0x1,%eax
+  800c83:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c86:	39 f0                	cmp    %esi,%eax
+  800c88:	74 14                	je     800c9e <memcmp+0x30>
+		if (*s1 != *s2)
+  800c8a:	0f b6 08             	movzbl (%eax),%ecx
+  800c8d:	0f b6 1a             	movzbl (%edx),%ebx
+  800c90:	38 d9                	cmp    %bl,%cl
+  800c92:	74 ec                	je     800c80 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c94:	0f b6 c1             	movzbl %cl,%eax
+  800c97:	0f b6 db             	movzbl %bl,%ebx
+  800c9a:	29 d8                	sub    %ebx,%eax
+  800c9c:	eb 05                	jmp    800ca3 <memcmp+0x35>
+	}
+
+	return 0;
+  800c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca3:	5b                   	pop    %ebx
+  800ca4:	5e                   	pop    %esi
+  800ca5:	5d                   	pop    %ebp
+  800ca6:	c3                   	ret
+
+00800ca7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ca7:	55                   	push   %ebp
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800cb0:	89 c2                	mov    %eax,%edx
+  800cb2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800cb5:	eb 03                	jmp    800cba <memfind+0x13>
+  800cb7:	83 c0 01             	add    $0x1,%eax
+  800cba:	39 d0                	cmp    %edx,%eax
+  800cbc:	73 04                	jae    800cc2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800cbe:	38 08                	cmp    %cl,(%eax)
+  800cc0:	75 f5                	jne    800cb7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800cc2:	5d                   	pop    %ebp
+  800cc3:	c3                   	ret
+
+00800cc4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	57                   	push   %edi
+  800cc8:	56                   	push   %esi
+  800cc9:	53                   	push   %ebx
+  800cca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800cd0:	eb 03                	jmp    800cd5 <strtol+0x11>
+		s++;
+  800cd2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800cd5:	0f b6 02             	movzbl (%edx),%eax
+  800cd8:	3c 20                	cmp    $0x20,%al
+  800cda:	74 f6                	je     800cd2 <strtol+0xe>
+  800cdc:	3c 09                	cmp    $0x9,%al
+  800cde:	74 f2                	je     800cd2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ce0:	3c 2b                	cmp    $0x2b,%al
+  800ce2:	74 2a                	je     800d0e <strtol+0x4a>
+	int neg = 0;
+  800ce4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800ce9:	3c 2d                	cmp    $0x2d,%al
+  800ceb:	74 2b                	je     800d18 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ced:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cf3:	75 0f                	jne    800d04 <strtol+0x40>
+  800cf5:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cf8:	74 28                	je     800d22 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800cfa:	85 db                	test   %ebx,%ebx
+  800cfc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d01:	0f 44 d8             	cmove  %eax,%ebx
+  800d04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d09:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d0c:	eb 46                	jmp    800d54 <strtol+0x90>
+		s++;
+  800d0e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800d11:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d16:	eb d5                	jmp    800ced <strtol+0x29>
+		s++, neg = 1;
+  800d18:	83 c2 01             	add    $0x1,%edx
+  800d1b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d20:	eb cb                	jmp    800ced <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d22:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d26:	74 0e                	je     800d36 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800d28:	85 db                	test   %ebx,%ebx
+  800d2a:	75 d8                	jne    800d04 <strtol+0x40>
+		s++, base = 8;
+  800d2c:	83 c2 01             	add    $0x1,%edx
+  800d2f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d34:	eb ce                	jmp    800d04 <strtol+0x40>
+		s += 2, base = 16;
+  800d36:	83 c2 02             	add    $0x2,%edx
+  800d39:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d3e:	eb c4                	jmp    800d04 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800d40:	0f be c0             	movsbl %al,%eax
+  800d43:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800d46:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d49:	7d 3a                	jge    800d85 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800d4b:	83 c2 01             	add    $0x1,%edx
+  800d4e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d52:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800d54:	0f b6 02             	movzbl (%edx),%eax
+  800d57:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d5a:	89 f3                	mov    %esi,%ebx
+  800d5c:	80 fb 09             	cmp    $0x9,%bl
+  800d5f:	76 df                	jbe    800d40 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800d61:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d64:	89 f3                	mov    %esi,%ebx
+  800d66:	80 fb 19             	cmp    $0x19,%bl
+  800d69:	77 08                	ja     800d73 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800d6b:	0f be c0             	movsbl %al,%eax
+  800d6e:	83 e8 57             	sub    $0x57,%eax
+  800d71:	eb d3                	jmp    800d46 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800d73:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d76:	89 f3                	mov    %esi,%ebx
+  800d78:	80 fb 19             	cmp    $0x19,%bl
+  800d7b:	77 08                	ja     800d85 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d7d:	0f be c0             	movsbl %al,%eax
+  800d80:	83 e8 37             	sub    $0x37,%eax
+  800d83:	eb c1                	jmp    800d46 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d85:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d89:	74 05                	je     800d90 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d8e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d90:	89 c8                	mov    %ecx,%eax
+  800d92:	f7 d8                	neg    %eax
+  800d94:	85 ff                	test   %edi,%edi
+  800d96:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d99:	89 c8                	mov    %ecx,%eax
+  800d9b:	5b                   	pop    %ebx
+  800d9c:	5e                   	pop    %esi
+  800d9d:	5f                   	pop    %edi
+  800d9e:	5d                   	pop    %ebp
+  800d9f:	c3                   	ret
+
+00800da0 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800da0:	55                   	push   %ebp
+  800da1:	89 e5                	mov    %esp,%ebp
+  800da3:	57                   	push   %edi
+  800da4:	56                   	push   %esi
+  800da5:	53                   	push   %ebx
+  800da6:	83 ec 0c             	sub    $0xc,%esp
+  800da9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800dac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800daf:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800db2:	85 ff                	test   %edi,%edi
+  800db4:	74 16                	je     800dcc <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800db6:	83 ec 04             	sub    $0x4,%esp
+  800db9:	56                   	push   %esi
+  800dba:	6a 00                	push   $0x0
+  800dbc:	53                   	push   %ebx
+  800dbd:	e8 02 ff ff ff       	call   800cc4 <strtol>
+  800dc2:	89 07                	mov    %eax,(%edi)
+  800dc4:	83 c4 10             	add    $0x10,%esp
+  800dc7:	eb 03                	jmp    800dcc <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800dc9:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800dcc:	0f b6 03             	movzbl (%ebx),%eax
+  800dcf:	3c 20                	cmp    $0x20,%al
+  800dd1:	74 f6                	je     800dc9 <strisl+0x29>
+  800dd3:	3c 09                	cmp    $0x9,%al
+  800dd5:	74 f2                	je     800dc9 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800dd7:	3c 2b                	cmp    $0x2b,%al
+  800dd9:	74 23                	je     800dfe <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800ddb:	3c 2d                	cmp    $0x2d,%al
+  800ddd:	0f 94 c0             	sete   %al
+  800de0:	0f b6 c0             	movzbl %al,%eax
+  800de3:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800de5:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800deb:	75 41                	jne    800e2e <strisl+0x8e>
+  800ded:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800df0:	74 11                	je     800e03 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800df2:	85 f6                	test   %esi,%esi
+  800df4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800df9:	0f 44 f0             	cmove  %eax,%esi
+  800dfc:	eb 30                	jmp    800e2e <strisl+0x8e>
+		s++;
+  800dfe:	83 c3 01             	add    $0x1,%ebx
+  800e01:	eb e2                	jmp    800de5 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e03:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800e07:	74 0e                	je     800e17 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800e09:	85 f6                	test   %esi,%esi
+  800e0b:	75 21                	jne    800e2e <strisl+0x8e>
+		s++, base = 8;
+  800e0d:	83 c3 01             	add    $0x1,%ebx
+  800e10:	be 08 00 00 00       	mov    $0x8,%esi
+  800e15:	eb 17                	jmp    800e2e <strisl+0x8e>
+		s += 2, base = 16;
+  800e17:	83 c3 02             	add    $0x2,%ebx
+  800e1a:	be 10 00 00 00       	mov    $0x10,%esi
+  800e1f:	eb 0d                	jmp    800e2e <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e21:	0f be c0             	movsbl %al,%eax
+  800e24:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800e27:	39 f0                	cmp    %esi,%eax
+  800e29:	7d 38                	jge    800e63 <strisl+0xc3>
+			return 0;
+		s++;
+  800e2b:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800e2e:	0f b6 03             	movzbl (%ebx),%eax
+  800e31:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800e34:	80 fa 09             	cmp    $0x9,%dl
+  800e37:	76 e8                	jbe    800e21 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800e39:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800e3c:	80 fa 19             	cmp    $0x19,%dl
+  800e3f:	77 08                	ja     800e49 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800e41:	0f be c0             	movsbl %al,%eax
+  800e44:	83 e8 57             	sub    $0x57,%eax
+  800e47:	eb de                	jmp    800e27 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800e49:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800e4c:	80 fa 19             	cmp    $0x19,%dl
+  800e4f:	77 08                	ja     800e59 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800e51:	0f be c0             	movsbl %al,%eax
+  800e54:	83 e8 37             	sub    $0x37,%eax
+  800e57:	eb ce                	jmp    800e27 <strisl+0x87>
+		else if (!*s)
+  800e59:	84 c0                	test   %al,%al
+  800e5b:	0f 94 c0             	sete   %al
+  800e5e:	0f b6 c0             	movzbl %al,%eax
+  800e61:	eb 05                	jmp    800e68 <strisl+0xc8>
+			return 0;
+  800e63:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800e68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6b:	5b                   	pop    %ebx
+  800e6c:	5e                   	pop    %esi
+  800e6d:	5f                   	pop    %edi
+  800e6e:	5d                   	pop    %ebp
+  800e6f:	c3                   	ret
+
+00800e70 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	83 ec 10             	sub    $0x10,%esp
+  800e76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800e79:	89 c8                	mov    %ecx,%eax
+  800e7b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e80:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800e83:	eb 0b                	jmp    800e90 <touch_mem+0x20>
+		c = *(char *)page;
+  800e85:	0f b6 10             	movzbl (%eax),%edx
+  800e88:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800e8b:	05 00 10 00 00       	add    $0x1000,%eax
+  800e90:	39 c8                	cmp    %ecx,%eax
+  800e92:	72 f1                	jb     800e85 <touch_mem+0x15>
+}
+  800e94:	c9                   	leave
+  800e95:	c3                   	ret
+
+00800e96 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e96:	55                   	push   %ebp
+  800e97:	89 e5                	mov    %esp,%ebp
+  800e99:	57                   	push   %edi
+  800e9a:	56                   	push   %esi
+  800e9b:	53                   	push   %ebx
+	touch_mem(s, len);
+  800e9c:	ff 75 0c             	push   0xc(%ebp)
+  800e9f:	ff 75 08             	push   0x8(%ebp)
+  800ea2:	e8 c9 ff ff ff       	call   800e70 <touch_mem>
+	asm volatile("int %1\n"
+  800ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb2:	89 c3                	mov    %eax,%ebx
+  800eb4:	89 c7                	mov    %eax,%edi
+  800eb6:	89 c6                	mov    %eax,%esi
+  800eb8:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800eba:	83 c4 08             	add    $0x8,%esp
+  800ebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec0:	5b                   	pop    %ebx
+  800ec1:	5e                   	pop    %esi
+  800ec2:	5f                   	pop    %edi
+  800ec3:	5d                   	pop    %ebp
+  800ec4:	c3                   	ret
+
+00800ec5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ecb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed5:	89 d1                	mov    %edx,%ecx
+  800ed7:	89 d3                	mov    %edx,%ebx
+  800ed9:	89 d7                	mov    %edx,%edi
+  800edb:	89 d6                	mov    %edx,%esi
+  800edd:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800edf:	5b                   	pop    %ebx
+  800ee0:	5e                   	pop    %esi
+  800ee1:	5f                   	pop    %edi
+  800ee2:	5d                   	pop    %ebp
+  800ee3:	c3                   	ret
+
+00800ee4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	57                   	push   %edi
+  800ee8:	56                   	push   %esi
+  800ee9:	53                   	push   %ebx
+  800eea:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800efa:	89 cb                	mov    %ecx,%ebx
+  800efc:	89 cf                	mov    %ecx,%edi
+  800efe:	89 ce                	mov    %ecx,%esi
+  800f00:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f02:	85 c0                	test   %eax,%eax
+  800f04:	7f 08                	jg     800f0e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f09:	5b                   	pop    %ebx
+  800f0a:	5e                   	pop    %esi
+  800f0b:	5f                   	pop    %edi
+  800f0c:	5d                   	pop    %ebp
+  800f0d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f0e:	83 ec 0c             	sub    $0xc,%esp
+  800f11:	50                   	push   %eax
+  800f12:	6a 03                	push   $0x3
+  800f14:	68 3b 2d 80 00       	push   $0x802d3b
+  800f19:	6a 23                	push   $0x23
+  800f1b:	68 58 2d 80 00       	push   $0x802d58
+  800f20:	e8 99 f3 ff ff       	call   8002be <_panic>
+
+00800f25 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f25:	55                   	push   %ebp
+  800f26:	89 e5                	mov    %esp,%ebp
+  800f28:	57                   	push   %edi
+  800f29:	56                   	push   %esi
+  800f2a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f30:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f35:	89 d1                	mov    %edx,%ecx
+  800f37:	89 d3                	mov    %edx,%ebx
+  800f39:	89 d7                	mov    %edx,%edi
+  800f3b:	89 d6                	mov    %edx,%esi
+  800f3d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+
+00800f44 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f54:	89 d1                	mov    %edx,%ecx
+  800f56:	89 d3                	mov    %edx,%ebx
+  800f58:	89 d7                	mov    %edx,%edi
+  800f5a:	89 d6                	mov    %edx,%esi
+  800f5c:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+
+00800f63 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f63:	55                   	push   %ebp
+  800f64:	89 e5                	mov    %esp,%ebp
+  800f66:	57                   	push   %edi
+  800f67:	56                   	push   %esi
+  800f68:	53                   	push   %ebx
+  800f69:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f6c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f77:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f7f:	89 f7                	mov    %esi,%edi
+  800f81:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f83:	85 c0                	test   %eax,%eax
+  800f85:	7f 08                	jg     800f8f <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8a:	5b                   	pop    %ebx
+  800f8b:	5e                   	pop    %esi
+  800f8c:	5f                   	pop    %edi
+  800f8d:	5d                   	pop    %ebp
+  800f8e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f8f:	83 ec 0c             	sub    $0xc,%esp
+  800f92:	50                   	push   %eax
+  800f93:	6a 04                	push   $0x4
+  800f95:	68 3b 2d 80 00       	push   $0x802d3b
+  800f9a:	6a 23                	push   $0x23
+  800f9c:	68 58 2d 80 00       	push   $0x802d58
+  800fa1:	e8 18 f3 ff ff       	call   8002be <_panic>
+
+00800fa6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fa6:	55                   	push   %ebp
+  800fa7:	89 e5                	mov    %esp,%ebp
+  800fa9:	57                   	push   %edi
+  800faa:	56                   	push   %esi
+  800fab:	53                   	push   %ebx
+  800fac:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800faf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fbd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fc3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fc5:	85 c0                	test   %eax,%eax
+  800fc7:	7f 08                	jg     800fd1 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fd1:	83 ec 0c             	sub    $0xc,%esp
+  800fd4:	50                   	push   %eax
+  800fd5:	6a 05                	push   $0x5
+  800fd7:	68 3b 2d 80 00       	push   $0x802d3b
+  800fdc:	6a 23                	push   $0x23
+  800fde:	68 58 2d 80 00       	push   $0x802d58
+  800fe3:	e8 d6 f2 ff ff       	call   8002be <_panic>
+
+00800fe8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800fe8:	55                   	push   %ebp
+  800fe9:	89 e5                	mov    %esp,%ebp
+  800feb:	57                   	push   %edi
+  800fec:	56                   	push   %esi
+  800fed:	53                   	push   %ebx
+  800fee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffc:	b8 06 00 00 00       	mov    $0x6,%eax
+  801001:	89 df                	mov    %ebx,%edi
+  801003:	89 de                	mov    %ebx,%esi
+  801005:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801007:	85 c0                	test   %eax,%eax
+  801009:	7f 08                	jg     801013 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80100b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100e:	5b                   	pop    %ebx
+  80100f:	5e                   	pop    %esi
+  801010:	5f                   	pop    %edi
+  801011:	5d                   	pop    %ebp
+  801012:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801013:	83 ec 0c             	sub    $0xc,%esp
+  801016:	50                   	push   %eax
+  801017:	6a 06                	push   $0x6
+  801019:	68 3b 2d 80 00       	push   $0x802d3b
+  80101e:	6a 23                	push   $0x23
+  801020:	68 58 2d 80 00       	push   $0x802d58
+  801025:	e8 94 f2 ff ff       	call   8002be <_panic>
+
+0080102a <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  80102a:	55                   	push   %ebp
+  80102b:	89 e5                	mov    %esp,%ebp
+  80102d:	57                   	push   %edi
+  80102e:	56                   	push   %esi
+  80102f:	53                   	push   %ebx
+  801030:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801033:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801038:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103e:	b8 18 00 00 00       	mov    $0x18,%eax
+  801043:	89 df                	mov    %ebx,%edi
+  801045:	89 de                	mov    %ebx,%esi
+  801047:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801049:	85 c0                	test   %eax,%eax
+  80104b:	7f 08                	jg     801055 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  80104d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801050:	5b                   	pop    %ebx
+  801051:	5e                   	pop    %esi
+  801052:	5f                   	pop    %edi
+  801053:	5d                   	pop    %ebp
+  801054:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801055:	83 ec 0c             	sub    $0xc,%esp
+  801058:	50                   	push   %eax
+  801059:	6a 18                	push   $0x18
+  80105b:	68 3b 2d 80 00       	push   $0x802d3b
+  801060:	6a 23                	push   $0x23
+  801062:	68 58 2d 80 00       	push   $0x802d58
+  801067:	e8 52 f2 ff ff       	call   8002be <_panic>
+
+0080106c <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  80106c:	55                   	push   %ebp
+  80106d:	89 e5                	mov    %esp,%ebp
+  80106f:	57                   	push   %edi
+  801070:	56                   	push   %esi
+  801071:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801072:	be 00 00 00 00       	mov    $0x0,%esi
+  801077:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107d:	b8 19 00 00 00       	mov    $0x19,%eax
+  801082:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801085:	89 f7                	mov    %esi,%edi
+  801087:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+
+0080108e <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	57                   	push   %edi
+  801092:	56                   	push   %esi
+  801093:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801094:	8b 55 08             	mov    0x8(%ebp),%edx
+  801097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80109f:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010aa:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8010ac:	5b                   	pop    %ebx
+  8010ad:	5e                   	pop    %esi
+  8010ae:	5f                   	pop    %edi
+  8010af:	5d                   	pop    %ebp
+  8010b0:	c3                   	ret
+
+008010b1 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+  8010b7:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8010ba:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8010bd:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8010c3:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  8010c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cc:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d4:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010d7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d9:	85 c0                	test   %eax,%eax
+  8010db:	7f 08                	jg     8010e5 <sys_page_map_range+0x34>
+}
+  8010dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e0:	5b                   	pop    %ebx
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5f                   	pop    %edi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	50                   	push   %eax
+  8010e9:	6a 10                	push   $0x10
+  8010eb:	68 3b 2d 80 00       	push   $0x802d3b
+  8010f0:	6a 23                	push   $0x23
+  8010f2:	68 58 2d 80 00       	push   $0x802d58
+  8010f7:	e8 c2 f1 ff ff       	call   8002be <_panic>
+
+008010fc <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	57                   	push   %edi
+  801100:	56                   	push   %esi
+  801101:	53                   	push   %ebx
+  801102:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801105:	be 00 00 00 00       	mov    $0x0,%esi
+  80110a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801110:	b8 11 00 00 00       	mov    $0x11,%eax
+  801115:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801118:	89 f7                	mov    %esi,%edi
+  80111a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80111c:	85 c0                	test   %eax,%eax
+  80111e:	7f 08                	jg     801128 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801123:	5b                   	pop    %ebx
+  801124:	5e                   	pop    %esi
+  801125:	5f                   	pop    %edi
+  801126:	5d                   	pop    %ebp
+  801127:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801128:	83 ec 0c             	sub    $0xc,%esp
+  80112b:	50                   	push   %eax
+  80112c:	6a 11                	push   $0x11
+  80112e:	68 3b 2d 80 00       	push   $0x802d3b
+  801133:	6a 23                	push   $0x23
+  801135:	68 58 2d 80 00       	push   $0x802d58
+  80113a:	e8 7f f1 ff ff       	call   8002be <_panic>
+
+0080113f <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  80113f:	55                   	push   %ebp
+  801140:	89 e5                	mov    %esp,%ebp
+  801142:	57                   	push   %edi
+  801143:	56                   	push   %esi
+  801144:	53                   	push   %ebx
+  801145:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801148:	be 00 00 00 00       	mov    $0x0,%esi
+  80114d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801150:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801153:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801158:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115b:	89 f7                	mov    %esi,%edi
+  80115d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80115f:	85 c0                	test   %eax,%eax
+  801161:	7f 08                	jg     80116b <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801166:	5b                   	pop    %ebx
+  801167:	5e                   	pop    %esi
+  801168:	5f                   	pop    %edi
+  801169:	5d                   	pop    %ebp
+  80116a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80116b:	83 ec 0c             	sub    $0xc,%esp
+  80116e:	50                   	push   %eax
+  80116f:	6a 1b                	push   $0x1b
+  801171:	68 3b 2d 80 00       	push   $0x802d3b
+  801176:	6a 23                	push   $0x23
+  801178:	68 58 2d 80 00       	push   $0x802d58
+  80117d:	e8 3c f1 ff ff       	call   8002be <_panic>
+
+00801182 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801182:	55                   	push   %ebp
+  801183:	89 e5                	mov    %esp,%ebp
+  801185:	57                   	push   %edi
+  801186:	56                   	push   %esi
+  801187:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118d:	b8 12 00 00 00       	mov    $0x12,%eax
+  801192:	89 d1                	mov    %edx,%ecx
+  801194:	89 d3                	mov    %edx,%ebx
+  801196:	89 d7                	mov    %edx,%edi
+  801198:	89 d6                	mov    %edx,%esi
+  80119a:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80119c:	5b                   	pop    %ebx
+  80119d:	5e                   	pop    %esi
+  80119e:	5f                   	pop    %edi
+  80119f:	5d                   	pop    %ebp
+  8011a0:	c3                   	ret
+
+008011a1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8011a1:	55                   	push   %ebp
+  8011a2:	89 e5                	mov    %esp,%ebp
+  8011a4:	57                   	push   %edi
+  8011a5:	56                   	push   %esi
+  8011a6:	53                   	push   %ebx
+  8011a7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011ba:	89 df                	mov    %ebx,%edi
+  8011bc:	89 de                	mov    %ebx,%esi
+  8011be:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011c0:	85 c0                	test   %eax,%eax
+  8011c2:	7f 08                	jg     8011cc <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c7:	5b                   	pop    %ebx
+  8011c8:	5e                   	pop    %esi
+  8011c9:	5f                   	pop    %edi
+  8011ca:	5d                   	pop    %ebp
+  8011cb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011cc:	83 ec 0c             	sub    $0xc,%esp
+  8011cf:	50                   	push   %eax
+  8011d0:	6a 08                	push   $0x8
+  8011d2:	68 3b 2d 80 00       	push   $0x802d3b
+  8011d7:	6a 23                	push   $0x23
+  8011d9:	68 58 2d 80 00       	push   $0x802d58
+  8011de:	e8 db f0 ff ff       	call   8002be <_panic>
+
+008011e3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011e3:	55                   	push   %ebp
+  8011e4:	89 e5                	mov    %esp,%ebp
+  8011e6:	57                   	push   %edi
+  8011e7:	56                   	push   %esi
+  8011e8:	53                   	push   %ebx
+  8011e9:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  8011ec:	6a 44                	push   $0x44
+  8011ee:	ff 75 0c             	push   0xc(%ebp)
+  8011f1:	e8 7a fc ff ff       	call   800e70 <touch_mem>
+	asm volatile("int %1\n"
+  8011f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fe:	b8 09 00 00 00       	mov    $0x9,%eax
+  801203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801206:	89 df                	mov    %ebx,%edi
+  801208:	89 de                	mov    %ebx,%esi
+  80120a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80120c:	83 c4 08             	add    $0x8,%esp
+  80120f:	85 c0                	test   %eax,%eax
+  801211:	7f 08                	jg     80121b <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801213:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801216:	5b                   	pop    %ebx
+  801217:	5e                   	pop    %esi
+  801218:	5f                   	pop    %edi
+  801219:	5d                   	pop    %ebp
+  80121a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80121b:	83 ec 0c             	sub    $0xc,%esp
+  80121e:	50                   	push   %eax
+  80121f:	6a 09                	push   $0x9
+  801221:	68 3b 2d 80 00       	push   $0x802d3b
+  801226:	6a 23                	push   $0x23
+  801228:	68 58 2d 80 00       	push   $0x802d58
+  80122d:	e8 8c f0 ff ff       	call   8002be <_panic>
+
+00801232 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	57                   	push   %edi
+  801236:	56                   	push   %esi
+  801237:	53                   	push   %ebx
+  801238:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80123b:	be 00 00 00 00       	mov    $0x0,%esi
+  801240:	8b 55 08             	mov    0x8(%ebp),%edx
+  801243:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801246:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80124b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80124e:	89 f7                	mov    %esi,%edi
+  801250:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801252:	85 c0                	test   %eax,%eax
+  801254:	7f 08                	jg     80125e <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801259:	5b                   	pop    %ebx
+  80125a:	5e                   	pop    %esi
+  80125b:	5f                   	pop    %edi
+  80125c:	5d                   	pop    %ebp
+  80125d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80125e:	83 ec 0c             	sub    $0xc,%esp
+  801261:	50                   	push   %eax
+  801262:	6a 1a                	push   $0x1a
+  801264:	68 3b 2d 80 00       	push   $0x802d3b
+  801269:	6a 23                	push   $0x23
+  80126b:	68 58 2d 80 00       	push   $0x802d58
+  801270:	e8 49 f0 ff ff       	call   8002be <_panic>
+
+00801275 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801275:	55                   	push   %ebp
+  801276:	89 e5                	mov    %esp,%ebp
+  801278:	57                   	push   %edi
+  801279:	56                   	push   %esi
+  80127a:	53                   	push   %ebx
+  80127b:	83 ec 0c             	sub    $0xc,%esp
+  80127e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801281:	89 d8                	mov    %ebx,%eax
+  801283:	c1 e0 05             	shl    $0x5,%eax
+  801286:	50                   	push   %eax
+  801287:	ff 75 0c             	push   0xc(%ebp)
+  80128a:	e8 e1 fb ff ff       	call   800e70 <touch_mem>
+	asm volatile("int %1\n"
+  80128f:	be 00 00 00 00       	mov    $0x0,%esi
+  801294:	8b 55 08             	mov    0x8(%ebp),%edx
+  801297:	b8 13 00 00 00       	mov    $0x13,%eax
+  80129c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129f:	89 f7                	mov    %esi,%edi
+  8012a1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012a3:	83 c4 08             	add    $0x8,%esp
+  8012a6:	85 c0                	test   %eax,%eax
+  8012a8:	7f 08                	jg     8012b2 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8012aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5e                   	pop    %esi
+  8012af:	5f                   	pop    %edi
+  8012b0:	5d                   	pop    %ebp
+  8012b1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012b2:	83 ec 0c             	sub    $0xc,%esp
+  8012b5:	50                   	push   %eax
+  8012b6:	6a 13                	push   $0x13
+  8012b8:	68 3b 2d 80 00       	push   $0x802d3b
+  8012bd:	6a 23                	push   $0x23
+  8012bf:	68 58 2d 80 00       	push   $0x802d58
+  8012c4:	e8 f5 ef ff ff       	call   8002be <_panic>
+
+008012c9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8012c9:	55                   	push   %ebp
+  8012ca:	89 e5                	mov    %esp,%ebp
+  8012cc:	57                   	push   %edi
+  8012cd:	56                   	push   %esi
+  8012ce:	53                   	push   %ebx
+  8012cf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012e2:	89 df                	mov    %ebx,%edi
+  8012e4:	89 de                	mov    %ebx,%esi
+  8012e6:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012e8:	85 c0                	test   %eax,%eax
+  8012ea:	7f 08                	jg     8012f4 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  8012ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ef:	5b                   	pop    %ebx
+  8012f0:	5e                   	pop    %esi
+  8012f1:	5f                   	pop    %edi
+  8012f2:	5d                   	pop    %ebp
+  8012f3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012f4:	83 ec 0c             	sub    $0xc,%esp
+  8012f7:	50                   	push   %eax
+  8012f8:	6a 0a                	push   $0xa
+  8012fa:	68 3b 2d 80 00       	push   $0x802d3b
+  8012ff:	6a 23                	push   $0x23
+  801301:	68 58 2d 80 00       	push   $0x802d58
+  801306:	e8 b3 ef ff ff       	call   8002be <_panic>
+
+0080130b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	57                   	push   %edi
+  80130f:	56                   	push   %esi
+  801310:	53                   	push   %ebx
+  801311:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801314:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80131a:	76 1d                	jbe    801339 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80131c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801322:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801327:	be 01 00 00 00       	mov    $0x1,%esi
+  80132c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80132f:	cd 30                	int    $0x30
+}
+  801331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801334:	5b                   	pop    %ebx
+  801335:	5e                   	pop    %esi
+  801336:	5f                   	pop    %edi
+  801337:	5d                   	pop    %ebp
+  801338:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801339:	68 00 10 00 00       	push   $0x1000
+  80133e:	53                   	push   %ebx
+  80133f:	e8 2c fb ff ff       	call   800e70 <touch_mem>
+  801344:	83 c4 08             	add    $0x8,%esp
+  801347:	eb d3                	jmp    80131c <sys_ipc_send+0x11>
+
+00801349 <sys_ipc_send_pages>:
+{
+  801349:	55                   	push   %ebp
+  80134a:	89 e5                	mov    %esp,%ebp
+  80134c:	57                   	push   %edi
+  80134d:	56                   	push   %esi
+  80134e:	53                   	push   %ebx
+  80134f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801352:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  801355:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80135b:	76 18                	jbe    801375 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  80135d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801360:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801363:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801368:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80136b:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  80136d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801370:	5b                   	pop    %ebx
+  801371:	5e                   	pop    %esi
+  801372:	5f                   	pop    %edi
+  801373:	5d                   	pop    %ebp
+  801374:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801375:	89 f0                	mov    %esi,%eax
+  801377:	c1 e0 0c             	shl    $0xc,%eax
+  80137a:	50                   	push   %eax
+  80137b:	53                   	push   %ebx
+  80137c:	e8 ef fa ff ff       	call   800e70 <touch_mem>
+  801381:	83 c4 08             	add    $0x8,%esp
+  801384:	eb d7                	jmp    80135d <sys_ipc_send_pages+0x14>
+
+00801386 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801386:	55                   	push   %ebp
+  801387:	89 e5                	mov    %esp,%ebp
+  801389:	57                   	push   %edi
+  80138a:	56                   	push   %esi
+  80138b:	53                   	push   %ebx
+  80138c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80138f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801394:	8b 55 08             	mov    0x8(%ebp),%edx
+  801397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80139f:	89 df                	mov    %ebx,%edi
+  8013a1:	89 de                	mov    %ebx,%esi
+  8013a3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013a5:	85 c0                	test   %eax,%eax
+  8013a7:	7f 08                	jg     8013b1 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8013a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ac:	5b                   	pop    %ebx
+  8013ad:	5e                   	pop    %esi
+  8013ae:	5f                   	pop    %edi
+  8013af:	5d                   	pop    %ebp
+  8013b0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013b1:	83 ec 0c             	sub    $0xc,%esp
+  8013b4:	50                   	push   %eax
+  8013b5:	6a 0d                	push   $0xd
+  8013b7:	68 3b 2d 80 00       	push   $0x802d3b
+  8013bc:	6a 23                	push   $0x23
+  8013be:	68 58 2d 80 00       	push   $0x802d58
+  8013c3:	e8 f6 ee ff ff       	call   8002be <_panic>
+
+008013c8 <sys_ipc_recv>:
+{
+  8013c8:	55                   	push   %ebp
+  8013c9:	89 e5                	mov    %esp,%ebp
+  8013cb:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8013ce:	6a 01                	push   $0x1
+  8013d0:	ff 75 08             	push   0x8(%ebp)
+  8013d3:	e8 ae ff ff ff       	call   801386 <sys_ipc_recv_pages>
+}
+  8013d8:	c9                   	leave
+  8013d9:	c3                   	ret
+
+008013da <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8013da:	55                   	push   %ebp
+  8013db:	89 e5                	mov    %esp,%ebp
+  8013dd:	57                   	push   %edi
+  8013de:	56                   	push   %esi
+  8013df:	53                   	push   %ebx
+  8013e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013e6:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8013e9:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8013ef:	77 04                	ja     8013f5 <sys_ipc_call+0x1b>
+  8013f1:	85 f6                	test   %esi,%esi
+  8013f3:	75 15                	jne    80140a <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8013f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013fb:	b8 14 00 00 00       	mov    $0x14,%eax
+  801400:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801402:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801405:	5b                   	pop    %ebx
+  801406:	5e                   	pop    %esi
+  801407:	5f                   	pop    %edi
+  801408:	5d                   	pop    %ebp
+  801409:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80140a:	89 f8                	mov    %edi,%eax
+  80140c:	c1 e0 0c             	shl    $0xc,%eax
+  80140f:	50                   	push   %eax
+  801410:	53                   	push   %ebx
+  801411:	e8 5a fa ff ff       	call   800e70 <touch_mem>
+  801416:	83 c4 08             	add    $0x8,%esp
+  801419:	eb da                	jmp    8013f5 <sys_ipc_call+0x1b>
+
+0080141b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80141b:	55                   	push   %ebp
+  80141c:	89 e5                	mov    %esp,%ebp
+  80141e:	57                   	push   %edi
+  80141f:	56                   	push   %esi
+  801420:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801421:	8b 55 08             	mov    0x8(%ebp),%edx
+  801424:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801427:	b8 15 00 00 00       	mov    $0x15,%eax
+  80142c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80142f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801432:	8b 75 18             	mov    0x18(%ebp),%esi
+  801435:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801437:	5b                   	pop    %ebx
+  801438:	5e                   	pop    %esi
+  801439:	5f                   	pop    %edi
+  80143a:	5d                   	pop    %ebp
+  80143b:	c3                   	ret
+
+0080143c <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80143c:	55                   	push   %ebp
+  80143d:	89 e5                	mov    %esp,%ebp
+  80143f:	57                   	push   %edi
+  801440:	56                   	push   %esi
+  801441:	53                   	push   %ebx
+  801442:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801445:	6a 04                	push   $0x4
+  801447:	ff 75 08             	push   0x8(%ebp)
+  80144a:	e8 21 fa ff ff       	call   800e70 <touch_mem>
+	asm volatile("int %1\n"
+  80144f:	be 00 00 00 00       	mov    $0x0,%esi
+  801454:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801457:	b8 16 00 00 00       	mov    $0x16,%eax
+  80145c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801462:	89 f7                	mov    %esi,%edi
+  801464:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801466:	83 c4 08             	add    $0x8,%esp
+  801469:	85 c0                	test   %eax,%eax
+  80146b:	7f 08                	jg     801475 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  80146d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5f                   	pop    %edi
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801475:	83 ec 0c             	sub    $0xc,%esp
+  801478:	50                   	push   %eax
+  801479:	6a 16                	push   $0x16
+  80147b:	68 3b 2d 80 00       	push   $0x802d3b
+  801480:	6a 23                	push   $0x23
+  801482:	68 58 2d 80 00       	push   $0x802d58
+  801487:	e8 32 ee ff ff       	call   8002be <_panic>
+
+0080148c <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80148c:	55                   	push   %ebp
+  80148d:	89 e5                	mov    %esp,%ebp
+  80148f:	57                   	push   %edi
+  801490:	56                   	push   %esi
+  801491:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801492:	6a 04                	push   $0x4
+  801494:	ff 75 08             	push   0x8(%ebp)
+  801497:	e8 d4 f9 ff ff       	call   800e70 <touch_mem>
+	asm volatile("int %1\n"
+  80149c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8014a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ac:	89 df                	mov    %ebx,%edi
+  8014ae:	89 de                	mov    %ebx,%esi
+  8014b0:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8014b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b5:	5b                   	pop    %ebx
+  8014b6:	5e                   	pop    %esi
+  8014b7:	5f                   	pop    %edi
+  8014b8:	5d                   	pop    %ebp
+  8014b9:	c3                   	ret
+
+008014ba <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	57                   	push   %edi
+  8014be:	56                   	push   %esi
+  8014bf:	53                   	push   %ebx
+  8014c0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8014c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8014d0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8014d5:	89 df                	mov    %ebx,%edi
+  8014d7:	89 de                	mov    %ebx,%esi
+  8014d9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	7f 08                	jg     8014e7 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8014df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e2:	5b                   	pop    %ebx
+  8014e3:	5e                   	pop    %esi
+  8014e4:	5f                   	pop    %edi
+  8014e5:	5d                   	pop    %ebp
+  8014e6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014e7:	83 ec 0c             	sub    $0xc,%esp
+  8014ea:	50                   	push   %eax
+  8014eb:	6a 0e                	push   $0xe
+  8014ed:	68 3b 2d 80 00       	push   $0x802d3b
+  8014f2:	6a 23                	push   $0x23
+  8014f4:	68 58 2d 80 00       	push   $0x802d58
+  8014f9:	e8 c0 ed ff ff       	call   8002be <_panic>
+
+008014fe <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801501:	8b 45 08             	mov    0x8(%ebp),%eax
+  801504:	05 00 00 00 30       	add    $0x30000000,%eax
+  801509:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80150c:	5d                   	pop    %ebp
+  80150d:	c3                   	ret
+
+0080150e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80150e:	55                   	push   %ebp
+  80150f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801511:	8b 45 08             	mov    0x8(%ebp),%eax
+  801514:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801519:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80151e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801523:	5d                   	pop    %ebp
+  801524:	c3                   	ret
+
+00801525 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801525:	55                   	push   %ebp
+  801526:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801528:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80152d:	a8 01                	test   $0x1,%al
+  80152f:	74 3c                	je     80156d <fd_alloc+0x48>
+  801531:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801536:	89 c2                	mov    %eax,%edx
+  801538:	c1 ea 0c             	shr    $0xc,%edx
+  80153b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801542:	89 c1                	mov    %eax,%ecx
+  801544:	05 00 10 00 00       	add    $0x1000,%eax
+  801549:	f6 c2 01             	test   $0x1,%dl
+  80154c:	74 13                	je     801561 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80154e:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801553:	75 e1                	jne    801536 <fd_alloc+0x11>
+  801555:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80155a:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80155f:	eb 05                	jmp    801566 <fd_alloc+0x41>
+			return 0;
+  801561:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801566:	8b 55 08             	mov    0x8(%ebp),%edx
+  801569:	89 0a                	mov    %ecx,(%edx)
+}
+  80156b:	5d                   	pop    %ebp
+  80156c:	c3                   	ret
+  80156d:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801572:	b8 00 00 00 00       	mov    $0x0,%eax
+  801577:	eb ed                	jmp    801566 <fd_alloc+0x41>
+
+00801579 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801579:	55                   	push   %ebp
+  80157a:	89 e5                	mov    %esp,%ebp
+  80157c:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80157f:	83 f8 1f             	cmp    $0x1f,%eax
+  801582:	77 30                	ja     8015b4 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801584:	c1 e0 0c             	shl    $0xc,%eax
+  801587:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80158c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801592:	f6 c2 01             	test   $0x1,%dl
+  801595:	74 24                	je     8015bb <fd_lookup+0x42>
+  801597:	89 c2                	mov    %eax,%edx
+  801599:	c1 ea 0c             	shr    $0xc,%edx
+  80159c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015a3:	f6 c2 01             	test   $0x1,%dl
+  8015a6:	74 1a                	je     8015c2 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8015a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ab:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8015ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015b2:	5d                   	pop    %ebp
+  8015b3:	c3                   	ret
+		return -E_INVAL;
+  8015b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b9:	eb f7                	jmp    8015b2 <fd_lookup+0x39>
+		return -E_INVAL;
+  8015bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c0:	eb f0                	jmp    8015b2 <fd_lookup+0x39>
+  8015c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c7:	eb e9                	jmp    8015b2 <fd_lookup+0x39>
+
+008015c9 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	53                   	push   %ebx
+  8015cd:	83 ec 04             	sub    $0x4,%esp
+  8015d0:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8015d3:	b8 e4 2d 80 00       	mov    $0x802de4,%eax
+  8015d8:	8b 18                	mov    (%eax),%ebx
+  8015da:	85 db                	test   %ebx,%ebx
+  8015dc:	74 0e                	je     8015ec <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8015de:	83 c0 04             	add    $0x4,%eax
+  8015e1:	39 13                	cmp    %edx,(%ebx)
+  8015e3:	75 f3                	jne    8015d8 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8015e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ea:	eb 1f                	jmp    80160b <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015ec:	a1 08 44 80 00       	mov    0x804408,%eax
+  8015f1:	8b 40 48             	mov    0x48(%eax),%eax
+  8015f4:	83 ec 04             	sub    $0x4,%esp
+  8015f7:	52                   	push   %edx
+  8015f8:	50                   	push   %eax
+  8015f9:	68 68 2d 80 00       	push   $0x802d68
+  8015fe:	e8 96 ed ff ff       	call   800399 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801603:	83 c4 10             	add    $0x10,%esp
+  801606:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80160b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80160e:	89 1a                	mov    %ebx,(%edx)
+}
+  801610:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801613:	c9                   	leave
+  801614:	c3                   	ret
+
+00801615 <fd_close>:
+{
+  801615:	55                   	push   %ebp
+  801616:	89 e5                	mov    %esp,%ebp
+  801618:	57                   	push   %edi
+  801619:	56                   	push   %esi
+  80161a:	53                   	push   %ebx
+  80161b:	83 ec 24             	sub    $0x24,%esp
+  80161e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801621:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801624:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801627:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801628:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80162e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801631:	50                   	push   %eax
+  801632:	e8 42 ff ff ff       	call   801579 <fd_lookup>
+  801637:	89 c3                	mov    %eax,%ebx
+  801639:	83 c4 10             	add    $0x10,%esp
+  80163c:	85 c0                	test   %eax,%eax
+  80163e:	78 05                	js     801645 <fd_close+0x30>
+	    || fd != fd2)
+  801640:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801643:	74 16                	je     80165b <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801645:	89 f8                	mov    %edi,%eax
+  801647:	84 c0                	test   %al,%al
+  801649:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801651:	89 d8                	mov    %ebx,%eax
+  801653:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801656:	5b                   	pop    %ebx
+  801657:	5e                   	pop    %esi
+  801658:	5f                   	pop    %edi
+  801659:	5d                   	pop    %ebp
+  80165a:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80165b:	83 ec 08             	sub    $0x8,%esp
+  80165e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801661:	50                   	push   %eax
+  801662:	ff 36                	push   (%esi)
+  801664:	e8 60 ff ff ff       	call   8015c9 <dev_lookup>
+  801669:	89 c3                	mov    %eax,%ebx
+  80166b:	83 c4 10             	add    $0x10,%esp
+  80166e:	85 c0                	test   %eax,%eax
+  801670:	78 1a                	js     80168c <fd_close+0x77>
+		if (dev->dev_close)
+  801672:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801675:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801678:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80167d:	85 c0                	test   %eax,%eax
+  80167f:	74 0b                	je     80168c <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801681:	83 ec 0c             	sub    $0xc,%esp
+  801684:	56                   	push   %esi
+  801685:	ff d0                	call   *%eax
+  801687:	89 c3                	mov    %eax,%ebx
+  801689:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80168c:	83 ec 08             	sub    $0x8,%esp
+  80168f:	56                   	push   %esi
+  801690:	6a 00                	push   $0x0
+  801692:	e8 51 f9 ff ff       	call   800fe8 <sys_page_unmap>
+	return r;
+  801697:	83 c4 10             	add    $0x10,%esp
+  80169a:	eb b5                	jmp    801651 <fd_close+0x3c>
+
+0080169c <close>:
+
+int
+close(int fdnum)
+{
+  80169c:	55                   	push   %ebp
+  80169d:	89 e5                	mov    %esp,%ebp
+  80169f:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a5:	50                   	push   %eax
+  8016a6:	ff 75 08             	push   0x8(%ebp)
+  8016a9:	e8 cb fe ff ff       	call   801579 <fd_lookup>
+  8016ae:	83 c4 10             	add    $0x10,%esp
+  8016b1:	85 c0                	test   %eax,%eax
+  8016b3:	79 02                	jns    8016b7 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8016b5:	c9                   	leave
+  8016b6:	c3                   	ret
+		return fd_close(fd, 1);
+  8016b7:	83 ec 08             	sub    $0x8,%esp
+  8016ba:	6a 01                	push   $0x1
+  8016bc:	ff 75 f4             	push   -0xc(%ebp)
+  8016bf:	e8 51 ff ff ff       	call   801615 <fd_close>
+  8016c4:	83 c4 10             	add    $0x10,%esp
+  8016c7:	eb ec                	jmp    8016b5 <close+0x19>
+
+008016c9 <close_all>:
+
+void
+close_all(void)
+{
+  8016c9:	55                   	push   %ebp
+  8016ca:	89 e5                	mov    %esp,%ebp
+  8016cc:	53                   	push   %ebx
+  8016cd:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8016d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8016d5:	83 ec 0c             	sub    $0xc,%esp
+  8016d8:	53                   	push   %ebx
+  8016d9:	e8 be ff ff ff       	call   80169c <close>
+	for (i = 0; i < MAXFD; i++)
+  8016de:	83 c3 01             	add    $0x1,%ebx
+  8016e1:	83 c4 10             	add    $0x10,%esp
+  8016e4:	83 fb 20             	cmp    $0x20,%ebx
+  8016e7:	75 ec                	jne    8016d5 <close_all+0xc>
+}
+  8016e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016ec:	c9                   	leave
+  8016ed:	c3                   	ret
+
+008016ee <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016ee:	55                   	push   %ebp
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	57                   	push   %edi
+  8016f2:	56                   	push   %esi
+  8016f3:	53                   	push   %ebx
+  8016f4:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016f7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016fa:	50                   	push   %eax
+  8016fb:	ff 75 08             	push   0x8(%ebp)
+  8016fe:	e8 76 fe ff ff       	call   801579 <fd_lookup>
+  801703:	89 c3                	mov    %eax,%ebx
+  801705:	83 c4 10             	add    $0x10,%esp
+  801708:	85 c0                	test   %eax,%eax
+  80170a:	78 7f                	js     80178b <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80170c:	83 ec 0c             	sub    $0xc,%esp
+  80170f:	ff 75 0c             	push   0xc(%ebp)
+  801712:	e8 85 ff ff ff       	call   80169c <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801717:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80171a:	c1 e6 0c             	shl    $0xc,%esi
+  80171d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801723:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801726:	89 3c 24             	mov    %edi,(%esp)
+  801729:	e8 e0 fd ff ff       	call   80150e <fd2data>
+  80172e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801730:	89 34 24             	mov    %esi,(%esp)
+  801733:	e8 d6 fd ff ff       	call   80150e <fd2data>
+  801738:	83 c4 10             	add    $0x10,%esp
+  80173b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80173e:	89 d8                	mov    %ebx,%eax
+  801740:	c1 e8 16             	shr    $0x16,%eax
+  801743:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80174a:	a8 01                	test   $0x1,%al
+  80174c:	74 11                	je     80175f <dup+0x71>
+  80174e:	89 d8                	mov    %ebx,%eax
+  801750:	c1 e8 0c             	shr    $0xc,%eax
+  801753:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80175a:	f6 c2 01             	test   $0x1,%dl
+  80175d:	75 36                	jne    801795 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80175f:	89 f8                	mov    %edi,%eax
+  801761:	c1 e8 0c             	shr    $0xc,%eax
+  801764:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80176b:	83 ec 0c             	sub    $0xc,%esp
+  80176e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801773:	50                   	push   %eax
+  801774:	56                   	push   %esi
+  801775:	6a 00                	push   $0x0
+  801777:	57                   	push   %edi
+  801778:	6a 00                	push   $0x0
+  80177a:	e8 27 f8 ff ff       	call   800fa6 <sys_page_map>
+  80177f:	89 c3                	mov    %eax,%ebx
+  801781:	83 c4 20             	add    $0x20,%esp
+  801784:	85 c0                	test   %eax,%eax
+  801786:	78 33                	js     8017bb <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801788:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  80178b:	89 d8                	mov    %ebx,%eax
+  80178d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801790:	5b                   	pop    %ebx
+  801791:	5e                   	pop    %esi
+  801792:	5f                   	pop    %edi
+  801793:	5d                   	pop    %ebp
+  801794:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801795:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80179c:	83 ec 0c             	sub    $0xc,%esp
+  80179f:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017a4:	50                   	push   %eax
+  8017a5:	ff 75 d4             	push   -0x2c(%ebp)
+  8017a8:	6a 00                	push   $0x0
+  8017aa:	53                   	push   %ebx
+  8017ab:	6a 00                	push   $0x0
+  8017ad:	e8 f4 f7 ff ff       	call   800fa6 <sys_page_map>
+  8017b2:	89 c3                	mov    %eax,%ebx
+  8017b4:	83 c4 20             	add    $0x20,%esp
+  8017b7:	85 c0                	test   %eax,%eax
+  8017b9:	79 a4                	jns    80175f <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8017bb:	83 ec 08             	sub    $0x8,%esp
+  8017be:	56                   	push   %esi
+  8017bf:	6a 00                	push   $0x0
+  8017c1:	e8 22 f8 ff ff       	call   800fe8 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8017c6:	83 c4 08             	add    $0x8,%esp
+  8017c9:	ff 75 d4             	push   -0x2c(%ebp)
+  8017cc:	6a 00                	push   $0x0
+  8017ce:	e8 15 f8 ff ff       	call   800fe8 <sys_page_unmap>
+	return r;
+  8017d3:	83 c4 10             	add    $0x10,%esp
+  8017d6:	eb b3                	jmp    80178b <dup+0x9d>
+
+008017d8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017d8:	55                   	push   %ebp
+  8017d9:	89 e5                	mov    %esp,%ebp
+  8017db:	56                   	push   %esi
+  8017dc:	53                   	push   %ebx
+  8017dd:	83 ec 18             	sub    $0x18,%esp
+  8017e0:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e6:	50                   	push   %eax
+  8017e7:	56                   	push   %esi
+  8017e8:	e8 8c fd ff ff       	call   801579 <fd_lookup>
+  8017ed:	83 c4 10             	add    $0x10,%esp
+  8017f0:	85 c0                	test   %eax,%eax
+  8017f2:	78 3c                	js     801830 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017f7:	83 ec 08             	sub    $0x8,%esp
+  8017fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017fd:	50                   	push   %eax
+  8017fe:	ff 33                	push   (%ebx)
+  801800:	e8 c4 fd ff ff       	call   8015c9 <dev_lookup>
+  801805:	83 c4 10             	add    $0x10,%esp
+  801808:	85 c0                	test   %eax,%eax
+  80180a:	78 24                	js     801830 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80180c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80180f:	83 e0 03             	and    $0x3,%eax
+  801812:	83 f8 01             	cmp    $0x1,%eax
+  801815:	74 20                	je     801837 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801817:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80181a:	8b 40 08             	mov    0x8(%eax),%eax
+  80181d:	85 c0                	test   %eax,%eax
+  80181f:	74 37                	je     801858 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801821:	83 ec 04             	sub    $0x4,%esp
+  801824:	ff 75 10             	push   0x10(%ebp)
+  801827:	ff 75 0c             	push   0xc(%ebp)
+  80182a:	53                   	push   %ebx
+  80182b:	ff d0                	call   *%eax
+  80182d:	83 c4 10             	add    $0x10,%esp
+}
+  801830:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801833:	5b                   	pop    %ebx
+  801834:	5e                   	pop    %esi
+  801835:	5d                   	pop    %ebp
+  801836:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801837:	a1 08 44 80 00       	mov    0x804408,%eax
+  80183c:	8b 40 48             	mov    0x48(%eax),%eax
+  80183f:	83 ec 04             	sub    $0x4,%esp
+  801842:	56                   	push   %esi
+  801843:	50                   	push   %eax
+  801844:	68 a9 2d 80 00       	push   $0x802da9
+  801849:	e8 4b eb ff ff       	call   800399 <cprintf>
+		return -E_INVAL;
+  80184e:	83 c4 10             	add    $0x10,%esp
+  801851:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801856:	eb d8                	jmp    801830 <read+0x58>
+		return -E_NOT_SUPP;
+  801858:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80185d:	eb d1                	jmp    801830 <read+0x58>
+
+0080185f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80185f:	55                   	push   %ebp
+  801860:	89 e5                	mov    %esp,%ebp
+  801862:	57                   	push   %edi
+  801863:	56                   	push   %esi
+  801864:	53                   	push   %ebx
+  801865:	83 ec 0c             	sub    $0xc,%esp
+  801868:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80186b:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80186e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801873:	eb 02                	jmp    801877 <readn+0x18>
+  801875:	01 c3                	add    %eax,%ebx
+  801877:	39 f3                	cmp    %esi,%ebx
+  801879:	73 21                	jae    80189c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80187b:	83 ec 04             	sub    $0x4,%esp
+  80187e:	89 f0                	mov    %esi,%eax
+  801880:	29 d8                	sub    %ebx,%eax
+  801882:	50                   	push   %eax
+  801883:	89 d8                	mov    %ebx,%eax
+  801885:	03 45 0c             	add    0xc(%ebp),%eax
+  801888:	50                   	push   %eax
+  801889:	57                   	push   %edi
+  80188a:	e8 49 ff ff ff       	call   8017d8 <read>
+		if (m < 0)
+  80188f:	83 c4 10             	add    $0x10,%esp
+  801892:	85 c0                	test   %eax,%eax
+  801894:	78 04                	js     80189a <readn+0x3b>
+			return m;
+		if (m == 0)
+  801896:	75 dd                	jne    801875 <readn+0x16>
+  801898:	eb 02                	jmp    80189c <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  80189a:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  80189c:	89 d8                	mov    %ebx,%eax
+  80189e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a1:	5b                   	pop    %ebx
+  8018a2:	5e                   	pop    %esi
+  8018a3:	5f                   	pop    %edi
+  8018a4:	5d                   	pop    %ebp
+  8018a5:	c3                   	ret
+
+008018a6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	56                   	push   %esi
+  8018aa:	53                   	push   %ebx
+  8018ab:	83 ec 18             	sub    $0x18,%esp
+  8018ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018b1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018b4:	50                   	push   %eax
+  8018b5:	53                   	push   %ebx
+  8018b6:	e8 be fc ff ff       	call   801579 <fd_lookup>
+  8018bb:	83 c4 10             	add    $0x10,%esp
+  8018be:	85 c0                	test   %eax,%eax
+  8018c0:	78 37                	js     8018f9 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018c2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018c5:	83 ec 08             	sub    $0x8,%esp
+  8018c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018cb:	50                   	push   %eax
+  8018cc:	ff 36                	push   (%esi)
+  8018ce:	e8 f6 fc ff ff       	call   8015c9 <dev_lookup>
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	78 1f                	js     8018f9 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018da:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018de:	74 20                	je     801900 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8018e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018e3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	74 37                	je     801921 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8018ea:	83 ec 04             	sub    $0x4,%esp
+  8018ed:	ff 75 10             	push   0x10(%ebp)
+  8018f0:	ff 75 0c             	push   0xc(%ebp)
+  8018f3:	56                   	push   %esi
+  8018f4:	ff d0                	call   *%eax
+  8018f6:	83 c4 10             	add    $0x10,%esp
+}
+  8018f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018fc:	5b                   	pop    %ebx
+  8018fd:	5e                   	pop    %esi
+  8018fe:	5d                   	pop    %ebp
+  8018ff:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801900:	a1 08 44 80 00       	mov    0x804408,%eax
+  801905:	8b 40 48             	mov    0x48(%eax),%eax
+  801908:	83 ec 04             	sub    $0x4,%esp
+  80190b:	53                   	push   %ebx
+  80190c:	50                   	push   %eax
+  80190d:	68 c5 2d 80 00       	push   $0x802dc5
+  801912:	e8 82 ea ff ff       	call   800399 <cprintf>
+		return -E_INVAL;
+  801917:	83 c4 10             	add    $0x10,%esp
+  80191a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80191f:	eb d8                	jmp    8018f9 <write+0x53>
+		return -E_NOT_SUPP;
+  801921:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801926:	eb d1                	jmp    8018f9 <write+0x53>
+
+00801928 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+  80192b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80192e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801931:	50                   	push   %eax
+  801932:	ff 75 08             	push   0x8(%ebp)
+  801935:	e8 3f fc ff ff       	call   801579 <fd_lookup>
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	78 0e                	js     80194f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801941:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801944:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801947:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80194a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80194f:	c9                   	leave
+  801950:	c3                   	ret
+
+00801951 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801951:	55                   	push   %ebp
+  801952:	89 e5                	mov    %esp,%ebp
+  801954:	56                   	push   %esi
+  801955:	53                   	push   %ebx
+  801956:	83 ec 18             	sub    $0x18,%esp
+  801959:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80195c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80195f:	50                   	push   %eax
+  801960:	53                   	push   %ebx
+  801961:	e8 13 fc ff ff       	call   801579 <fd_lookup>
+  801966:	83 c4 10             	add    $0x10,%esp
+  801969:	85 c0                	test   %eax,%eax
+  80196b:	78 34                	js     8019a1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80196d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801970:	83 ec 08             	sub    $0x8,%esp
+  801973:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801976:	50                   	push   %eax
+  801977:	ff 36                	push   (%esi)
+  801979:	e8 4b fc ff ff       	call   8015c9 <dev_lookup>
+  80197e:	83 c4 10             	add    $0x10,%esp
+  801981:	85 c0                	test   %eax,%eax
+  801983:	78 1c                	js     8019a1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801985:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801989:	74 1d                	je     8019a8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  80198b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198e:	8b 40 18             	mov    0x18(%eax),%eax
+  801991:	85 c0                	test   %eax,%eax
+  801993:	74 34                	je     8019c9 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801995:	83 ec 08             	sub    $0x8,%esp
+  801998:	ff 75 0c             	push   0xc(%ebp)
+  80199b:	56                   	push   %esi
+  80199c:	ff d0                	call   *%eax
+  80199e:	83 c4 10             	add    $0x10,%esp
+}
+  8019a1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a4:	5b                   	pop    %ebx
+  8019a5:	5e                   	pop    %esi
+  8019a6:	5d                   	pop    %ebp
+  8019a7:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8019a8:	a1 08 44 80 00       	mov    0x804408,%eax
+  8019ad:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019b0:	83 ec 04             	sub    $0x4,%esp
+  8019b3:	53                   	push   %ebx
+  8019b4:	50                   	push   %eax
+  8019b5:	68 88 2d 80 00       	push   $0x802d88
+  8019ba:	e8 da e9 ff ff       	call   800399 <cprintf>
+		return -E_INVAL;
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019c7:	eb d8                	jmp    8019a1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8019c9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019ce:	eb d1                	jmp    8019a1 <ftruncate+0x50>
+
+008019d0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8019d0:	55                   	push   %ebp
+  8019d1:	89 e5                	mov    %esp,%ebp
+  8019d3:	56                   	push   %esi
+  8019d4:	53                   	push   %ebx
+  8019d5:	83 ec 18             	sub    $0x18,%esp
+  8019d8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019de:	50                   	push   %eax
+  8019df:	ff 75 08             	push   0x8(%ebp)
+  8019e2:	e8 92 fb ff ff       	call   801579 <fd_lookup>
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	78 49                	js     801a37 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019ee:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019f1:	83 ec 08             	sub    $0x8,%esp
+  8019f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f7:	50                   	push   %eax
+  8019f8:	ff 36                	push   (%esi)
+  8019fa:	e8 ca fb ff ff       	call   8015c9 <dev_lookup>
+  8019ff:	83 c4 10             	add    $0x10,%esp
+  801a02:	85 c0                	test   %eax,%eax
+  801a04:	78 31                	js     801a37 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a09:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a0d:	74 2f                	je     801a3e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a0f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a12:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a19:	00 00 00 
+	stat->st_isdir = 0;
+  801a1c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a23:	00 00 00 
+	stat->st_dev = dev;
+  801a26:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a2c:	83 ec 08             	sub    $0x8,%esp
+  801a2f:	53                   	push   %ebx
+  801a30:	56                   	push   %esi
+  801a31:	ff 50 14             	call   *0x14(%eax)
+  801a34:	83 c4 10             	add    $0x10,%esp
+}
+  801a37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a3a:	5b                   	pop    %ebx
+  801a3b:	5e                   	pop    %esi
+  801a3c:	5d                   	pop    %ebp
+  801a3d:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a3e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a43:	eb f2                	jmp    801a37 <fstat+0x67>
+
+00801a45 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a45:	55                   	push   %ebp
+  801a46:	89 e5                	mov    %esp,%ebp
+  801a48:	56                   	push   %esi
+  801a49:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801a4a:	83 ec 08             	sub    $0x8,%esp
+  801a4d:	6a 00                	push   $0x0
+  801a4f:	ff 75 08             	push   0x8(%ebp)
+  801a52:	e8 bc 02 00 00       	call   801d13 <open>
+  801a57:	89 c3                	mov    %eax,%ebx
+  801a59:	83 c4 10             	add    $0x10,%esp
+  801a5c:	85 c0                	test   %eax,%eax
+  801a5e:	78 1b                	js     801a7b <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801a60:	83 ec 08             	sub    $0x8,%esp
+  801a63:	ff 75 0c             	push   0xc(%ebp)
+  801a66:	50                   	push   %eax
+  801a67:	e8 64 ff ff ff       	call   8019d0 <fstat>
+  801a6c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a6e:	89 1c 24             	mov    %ebx,(%esp)
+  801a71:	e8 26 fc ff ff       	call   80169c <close>
+	return r;
+  801a76:	83 c4 10             	add    $0x10,%esp
+  801a79:	89 f3                	mov    %esi,%ebx
+}
+  801a7b:	89 d8                	mov    %ebx,%eax
+  801a7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a80:	5b                   	pop    %ebx
+  801a81:	5e                   	pop    %esi
+  801a82:	5d                   	pop    %ebp
+  801a83:	c3                   	ret
+
+00801a84 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801a84:	55                   	push   %ebp
+  801a85:	89 e5                	mov    %esp,%ebp
+  801a87:	57                   	push   %edi
+  801a88:	56                   	push   %esi
+  801a89:	53                   	push   %ebx
+  801a8a:	83 ec 0c             	sub    $0xc,%esp
+  801a8d:	89 c7                	mov    %eax,%edi
+  801a8f:	89 d3                	mov    %edx,%ebx
+  801a91:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801a93:	83 3d 00 44 80 00 00 	cmpl   $0x0,0x804400
+  801a9a:	74 2d                	je     801ac9 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801a9c:	6a 07                	push   $0x7
+  801a9e:	68 00 50 80 00       	push   $0x805000
+  801aa3:	57                   	push   %edi
+  801aa4:	ff 35 00 44 80 00    	push   0x804400
+  801aaa:	e8 1d 0b 00 00       	call   8025cc <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801aaf:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ab6:	6a 00                	push   $0x0
+  801ab8:	56                   	push   %esi
+  801ab9:	53                   	push   %ebx
+  801aba:	6a 00                	push   $0x0
+  801abc:	e8 bd 09 00 00       	call   80247e <ipc_recv_pages>
+}
+  801ac1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ac4:	5b                   	pop    %ebx
+  801ac5:	5e                   	pop    %esi
+  801ac6:	5f                   	pop    %edi
+  801ac7:	5d                   	pop    %ebp
+  801ac8:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ac9:	83 ec 0c             	sub    $0xc,%esp
+  801acc:	6a 01                	push   $0x1
+  801ace:	e8 ee 0b 00 00       	call   8026c1 <ipc_find_env>
+  801ad3:	a3 00 44 80 00       	mov    %eax,0x804400
+  801ad8:	83 c4 10             	add    $0x10,%esp
+  801adb:	eb bf                	jmp    801a9c <fsipc_pages+0x18>
+
+00801add <fsipc>:
+{
+  801add:	55                   	push   %ebp
+  801ade:	89 e5                	mov    %esp,%ebp
+  801ae0:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801ae3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ae8:	e8 97 ff ff ff       	call   801a84 <fsipc_pages>
+}
+  801aed:	c9                   	leave
+  801aee:	c3                   	ret
+
+00801aef <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801aef:	55                   	push   %ebp
+  801af0:	89 e5                	mov    %esp,%ebp
+  801af2:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801af5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801afb:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  801b00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b03:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801b08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b12:	e8 c6 ff ff ff       	call   801add <fsipc>
+}
+  801b17:	c9                   	leave
+  801b18:	c3                   	ret
+
+00801b19 <devfile_flush>:
+{
+  801b19:	55                   	push   %ebp
+  801b1a:	89 e5                	mov    %esp,%ebp
+  801b1c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b22:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b25:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801b2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b2f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b34:	e8 a4 ff ff ff       	call   801add <fsipc>
+}
+  801b39:	c9                   	leave
+  801b3a:	c3                   	ret
+
+00801b3b <devfile_stat>:
+{
+  801b3b:	55                   	push   %ebp
+  801b3c:	89 e5                	mov    %esp,%ebp
+  801b3e:	53                   	push   %ebx
+  801b3f:	83 ec 04             	sub    $0x4,%esp
+  801b42:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b48:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b4b:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b55:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b5a:	e8 7e ff ff ff       	call   801add <fsipc>
+  801b5f:	85 c0                	test   %eax,%eax
+  801b61:	78 2c                	js     801b8f <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b63:	83 ec 08             	sub    $0x8,%esp
+  801b66:	68 00 50 80 00       	push   $0x805000
+  801b6b:	53                   	push   %ebx
+  801b6c:	e8 ff ee ff ff       	call   800a70 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801b71:	a1 80 50 80 00       	mov    0x805080,%eax
+  801b76:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b7c:	a1 84 50 80 00       	mov    0x805084,%eax
+  801b81:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801b87:	83 c4 10             	add    $0x10,%esp
+  801b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b92:	c9                   	leave
+  801b93:	c3                   	ret
+
+00801b94 <devfile_write>:
+{
+  801b94:	55                   	push   %ebp
+  801b95:	89 e5                	mov    %esp,%ebp
+  801b97:	83 ec 0c             	sub    $0xc,%esp
+  801b9a:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801b9d:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801ba2:	39 d0                	cmp    %edx,%eax
+  801ba4:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ba7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801baa:	8b 52 0c             	mov    0xc(%edx),%edx
+  801bad:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  801bb3:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801bb8:	50                   	push   %eax
+  801bb9:	ff 75 0c             	push   0xc(%ebp)
+  801bbc:	68 08 50 80 00       	push   $0x805008
+  801bc1:	e8 30 f0 ff ff       	call   800bf6 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801bc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bd0:	e8 08 ff ff ff       	call   801add <fsipc>
+}
+  801bd5:	c9                   	leave
+  801bd6:	c3                   	ret
+
+00801bd7 <devfile_read>:
+{
+  801bd7:	55                   	push   %ebp
+  801bd8:	89 e5                	mov    %esp,%ebp
+  801bda:	57                   	push   %edi
+  801bdb:	56                   	push   %esi
+  801bdc:	53                   	push   %ebx
+  801bdd:	83 ec 1c             	sub    $0x1c,%esp
+  801be0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801be3:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801be6:	89 fe                	mov    %edi,%esi
+  801be8:	c1 ee 0c             	shr    $0xc,%esi
+  801beb:	b8 20 00 00 00       	mov    $0x20,%eax
+  801bf0:	39 c6                	cmp    %eax,%esi
+  801bf2:	0f 47 f0             	cmova  %eax,%esi
+  801bf5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bf8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bfd:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801c00:	eb 14                	jmp    801c16 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801c02:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801c09:	05 00 10 00 00       	add    $0x1000,%eax
+  801c0e:	f6 c6 06             	test   $0x6,%dh
+  801c11:	75 42                	jne    801c55 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801c13:	83 c1 01             	add    $0x1,%ecx
+  801c16:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801c19:	39 f1                	cmp    %esi,%ecx
+  801c1b:	0f 84 95 00 00 00    	je     801cb6 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801c21:	89 c2                	mov    %eax,%edx
+  801c23:	c1 ea 16             	shr    $0x16,%edx
+  801c26:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801c2d:	f6 c2 01             	test   $0x1,%dl
+  801c30:	74 23                	je     801c55 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801c32:	89 c2                	mov    %eax,%edx
+  801c34:	c1 ea 0c             	shr    $0xc,%edx
+  801c37:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801c3e:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801c44:	74 0f                	je     801c55 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801c46:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801c4d:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801c53:	75 ad                	jne    801c02 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801c55:	85 c9                	test   %ecx,%ecx
+  801c57:	74 11                	je     801c6a <devfile_read+0x93>
+  801c59:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801c60:	75 08                	jne    801c6a <devfile_read+0x93>
+  801c62:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801c68:	74 50                	je     801cba <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c6a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c6d:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  801c72:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c7d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c82:	e8 56 fe ff ff       	call   801add <fsipc>
+  801c87:	89 c6                	mov    %eax,%esi
+  801c89:	85 c0                	test   %eax,%eax
+  801c8b:	78 1f                	js     801cac <devfile_read+0xd5>
+	assert(r <= n);
+  801c8d:	39 c7                	cmp    %eax,%edi
+  801c8f:	72 50                	jb     801ce1 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801c91:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c96:	7f 62                	jg     801cfa <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801c98:	83 ec 04             	sub    $0x4,%esp
+  801c9b:	50                   	push   %eax
+  801c9c:	68 00 50 80 00       	push   $0x805000
+  801ca1:	ff 75 0c             	push   0xc(%ebp)
+  801ca4:	e8 4d ef ff ff       	call   800bf6 <memmove>
+	return r;
+  801ca9:	83 c4 10             	add    $0x10,%esp
+}
+  801cac:	89 f0                	mov    %esi,%eax
+  801cae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cb1:	5b                   	pop    %ebx
+  801cb2:	5e                   	pop    %esi
+  801cb3:	5f                   	pop    %edi
+  801cb4:	5d                   	pop    %ebp
+  801cb5:	c3                   	ret
+  801cb6:	89 f1                	mov    %esi,%ecx
+  801cb8:	eb 9b                	jmp    801c55 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801cba:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801cbd:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801cc2:	89 c8                	mov    %ecx,%eax
+  801cc4:	c1 e0 0c             	shl    $0xc,%eax
+  801cc7:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801ccc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ccf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801cd4:	e8 ab fd ff ff       	call   801a84 <fsipc_pages>
+  801cd9:	89 c6                	mov    %eax,%esi
+  801cdb:	85 c0                	test   %eax,%eax
+  801cdd:	78 8b                	js     801c6a <devfile_read+0x93>
+  801cdf:	eb cb                	jmp    801cac <devfile_read+0xd5>
+	assert(r <= n);
+  801ce1:	68 f4 2d 80 00       	push   $0x802df4
+  801ce6:	68 fb 2d 80 00       	push   $0x802dfb
+  801ceb:	68 a0 00 00 00       	push   $0xa0
+  801cf0:	68 10 2e 80 00       	push   $0x802e10
+  801cf5:	e8 c4 e5 ff ff       	call   8002be <_panic>
+	assert(r <= PGSIZE);
+  801cfa:	68 1b 2e 80 00       	push   $0x802e1b
+  801cff:	68 fb 2d 80 00       	push   $0x802dfb
+  801d04:	68 a1 00 00 00       	push   $0xa1
+  801d09:	68 10 2e 80 00       	push   $0x802e10
+  801d0e:	e8 ab e5 ff ff       	call   8002be <_panic>
+
+00801d13 <open>:
+{
+  801d13:	55                   	push   %ebp
+  801d14:	89 e5                	mov    %esp,%ebp
+  801d16:	56                   	push   %esi
+  801d17:	53                   	push   %ebx
+  801d18:	83 ec 1c             	sub    $0x1c,%esp
+  801d1b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d1e:	56                   	push   %esi
+  801d1f:	e8 11 ed ff ff       	call   800a35 <strlen>
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d2c:	7f 6c                	jg     801d9a <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d2e:	83 ec 0c             	sub    $0xc,%esp
+  801d31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d34:	50                   	push   %eax
+  801d35:	e8 eb f7 ff ff       	call   801525 <fd_alloc>
+  801d3a:	89 c3                	mov    %eax,%ebx
+  801d3c:	83 c4 10             	add    $0x10,%esp
+  801d3f:	85 c0                	test   %eax,%eax
+  801d41:	78 3c                	js     801d7f <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d43:	83 ec 08             	sub    $0x8,%esp
+  801d46:	56                   	push   %esi
+  801d47:	68 00 50 80 00       	push   $0x805000
+  801d4c:	e8 1f ed ff ff       	call   800a70 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d51:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d54:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d59:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d61:	e8 77 fd ff ff       	call   801add <fsipc>
+  801d66:	89 c3                	mov    %eax,%ebx
+  801d68:	83 c4 10             	add    $0x10,%esp
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	78 19                	js     801d88 <open+0x75>
+	return fd2num(fd);
+  801d6f:	83 ec 0c             	sub    $0xc,%esp
+  801d72:	ff 75 f4             	push   -0xc(%ebp)
+  801d75:	e8 84 f7 ff ff       	call   8014fe <fd2num>
+  801d7a:	89 c3                	mov    %eax,%ebx
+  801d7c:	83 c4 10             	add    $0x10,%esp
+}
+  801d7f:	89 d8                	mov    %ebx,%eax
+  801d81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d84:	5b                   	pop    %ebx
+  801d85:	5e                   	pop    %esi
+  801d86:	5d                   	pop    %ebp
+  801d87:	c3                   	ret
+		fd_close(fd, 0);
+  801d88:	83 ec 08             	sub    $0x8,%esp
+  801d8b:	6a 00                	push   $0x0
+  801d8d:	ff 75 f4             	push   -0xc(%ebp)
+  801d90:	e8 80 f8 ff ff       	call   801615 <fd_close>
+		return r;
+  801d95:	83 c4 10             	add    $0x10,%esp
+  801d98:	eb e5                	jmp    801d7f <open+0x6c>
+		return -E_BAD_PATH;
+  801d9a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d9f:	eb de                	jmp    801d7f <open+0x6c>
+
+00801da1 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801da1:	55                   	push   %ebp
+  801da2:	89 e5                	mov    %esp,%ebp
+  801da4:	53                   	push   %ebx
+  801da5:	83 ec 10             	sub    $0x10,%esp
+  801da8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801dab:	53                   	push   %ebx
+  801dac:	e8 84 ec ff ff       	call   800a35 <strlen>
+  801db1:	83 c4 10             	add    $0x10,%esp
+  801db4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801db9:	7f 25                	jg     801de0 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801dbb:	83 ec 08             	sub    $0x8,%esp
+  801dbe:	53                   	push   %ebx
+  801dbf:	68 00 50 80 00       	push   $0x805000
+  801dc4:	e8 a7 ec ff ff       	call   800a70 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801dc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dce:	b8 07 00 00 00       	mov    $0x7,%eax
+  801dd3:	e8 05 fd ff ff       	call   801add <fsipc>
+  801dd8:	83 c4 10             	add    $0x10,%esp
+}
+  801ddb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dde:	c9                   	leave
+  801ddf:	c3                   	ret
+		return -E_BAD_PATH;
+  801de0:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801de5:	eb f4                	jmp    801ddb <remove+0x3a>
+
+00801de7 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801de7:	55                   	push   %ebp
+  801de8:	89 e5                	mov    %esp,%ebp
+  801dea:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801ded:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df2:	b8 08 00 00 00       	mov    $0x8,%eax
+  801df7:	e8 e1 fc ff ff       	call   801add <fsipc>
+}
+  801dfc:	c9                   	leave
+  801dfd:	c3                   	ret
+
+00801dfe <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801dfe:	55                   	push   %ebp
+  801dff:	89 e5                	mov    %esp,%ebp
+  801e01:	53                   	push   %ebx
+  801e02:	83 ec 04             	sub    $0x4,%esp
+  801e05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801e08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e0d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801e12:	e8 c6 fc ff ff       	call   801add <fsipc>
+  801e17:	85 c0                	test   %eax,%eax
+  801e19:	78 3c                	js     801e57 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801e1b:	a1 00 50 80 00       	mov    0x805000,%eax
+  801e20:	89 03                	mov    %eax,(%ebx)
+  801e22:	a1 04 50 80 00       	mov    0x805004,%eax
+  801e27:	89 43 04             	mov    %eax,0x4(%ebx)
+  801e2a:	a1 08 50 80 00       	mov    0x805008,%eax
+  801e2f:	89 43 08             	mov    %eax,0x8(%ebx)
+  801e32:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801e37:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801e3a:	a1 10 50 80 00       	mov    0x805010,%eax
+  801e3f:	89 43 10             	mov    %eax,0x10(%ebx)
+  801e42:	a1 14 50 80 00       	mov    0x805014,%eax
+  801e47:	89 43 14             	mov    %eax,0x14(%ebx)
+  801e4a:	a1 18 50 80 00       	mov    0x805018,%eax
+  801e4f:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801e52:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e5a:	c9                   	leave
+  801e5b:	c3                   	ret
+
+00801e5c <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801e5c:	55                   	push   %ebp
+  801e5d:	89 e5                	mov    %esp,%ebp
+  801e5f:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801e62:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e65:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801e6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801e74:	e8 64 fc ff ff       	call   801add <fsipc>
+}
+  801e79:	c9                   	leave
+  801e7a:	c3                   	ret
+
+00801e7b <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+	if (b->error > 0) {
+  801e7b:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  801e7f:	7f 01                	jg     801e82 <writebuf+0x7>
+  801e81:	c3                   	ret
+{
+  801e82:	55                   	push   %ebp
+  801e83:	89 e5                	mov    %esp,%ebp
+  801e85:	53                   	push   %ebx
+  801e86:	83 ec 08             	sub    $0x8,%esp
+  801e89:	89 c3                	mov    %eax,%ebx
+		ssize_t result = write(b->fd, b->buf, b->idx);
+  801e8b:	ff 70 04             	push   0x4(%eax)
+  801e8e:	8d 40 10             	lea    0x10(%eax),%eax
+  801e91:	50                   	push   %eax
+  801e92:	ff 33                	push   (%ebx)
+  801e94:	e8 0d fa ff ff       	call   8018a6 <write>
+		if (result > 0)
+  801e99:	83 c4 10             	add    $0x10,%esp
+  801e9c:	85 c0                	test   %eax,%eax
+  801e9e:	7e 03                	jle    801ea3 <writebuf+0x28>
+			b->result += result;
+  801ea0:	01 43 08             	add    %eax,0x8(%ebx)
+		if (result != b->idx) // error, or wrote less than supplied
+  801ea3:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801ea6:	74 0d                	je     801eb5 <writebuf+0x3a>
+			b->error = (result < 0 ? result : 0);
+  801ea8:	85 c0                	test   %eax,%eax
+  801eaa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eaf:	0f 4f c2             	cmovg  %edx,%eax
+  801eb2:	89 43 0c             	mov    %eax,0xc(%ebx)
+	}
+}
+  801eb5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eb8:	c9                   	leave
+  801eb9:	c3                   	ret
+
+00801eba <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  801eba:	55                   	push   %ebp
+  801ebb:	89 e5                	mov    %esp,%ebp
+  801ebd:	53                   	push   %ebx
+  801ebe:	83 ec 04             	sub    $0x4,%esp
+  801ec1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct printbuf *b = (struct printbuf *) thunk;
+	b->buf[b->idx++] = ch;
+  801ec4:	8b 53 04             	mov    0x4(%ebx),%edx
+  801ec7:	8d 42 01             	lea    0x1(%edx),%eax
+  801eca:	89 43 04             	mov    %eax,0x4(%ebx)
+  801ecd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ed0:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+	if (b->idx == 256) {
+  801ed4:	3d 00 01 00 00       	cmp    $0x100,%eax
+  801ed9:	74 05                	je     801ee0 <putch+0x26>
+		writebuf(b);
+		b->idx = 0;
+	}
+}
+  801edb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ede:	c9                   	leave
+  801edf:	c3                   	ret
+		writebuf(b);
+  801ee0:	89 d8                	mov    %ebx,%eax
+  801ee2:	e8 94 ff ff ff       	call   801e7b <writebuf>
+		b->idx = 0;
+  801ee7:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  801eee:	eb eb                	jmp    801edb <putch+0x21>
+
+00801ef0 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  801ef0:	55                   	push   %ebp
+  801ef1:	89 e5                	mov    %esp,%ebp
+  801ef3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.fd = fd;
+  801ef9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efc:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+	b.idx = 0;
+  801f02:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  801f09:	00 00 00 
+	b.result = 0;
+  801f0c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  801f13:	00 00 00 
+	b.error = 1;
+  801f16:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  801f1d:	00 00 00 
+	vprintfmt(putch, &b, fmt, ap);
+  801f20:	ff 75 10             	push   0x10(%ebp)
+  801f23:	ff 75 0c             	push   0xc(%ebp)
+  801f26:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801f2c:	50                   	push   %eax
+  801f2d:	68 ba 1e 80 00       	push   $0x801eba
+  801f32:	e8 59 e5 ff ff       	call   800490 <vprintfmt>
+	if (b.idx > 0)
+  801f37:	83 c4 10             	add    $0x10,%esp
+  801f3a:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  801f41:	7f 12                	jg     801f55 <vfprintf+0x65>
+		writebuf(&b);
+
+	return (b.result ? b.result : b.error);
+  801f43:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  801f49:	85 c0                	test   %eax,%eax
+  801f4b:	75 06                	jne    801f53 <vfprintf+0x63>
+  801f4d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  801f53:	c9                   	leave
+  801f54:	c3                   	ret
+		writebuf(&b);
+  801f55:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  801f5b:	e8 1b ff ff ff       	call   801e7b <writebuf>
+  801f60:	eb e1                	jmp    801f43 <vfprintf+0x53>
+
+00801f62 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  801f62:	55                   	push   %ebp
+  801f63:	89 e5                	mov    %esp,%ebp
+  801f65:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801f68:	8d 45 10             	lea    0x10(%ebp),%eax
+	cnt = vfprintf(fd, fmt, ap);
+  801f6b:	50                   	push   %eax
+  801f6c:	ff 75 0c             	push   0xc(%ebp)
+  801f6f:	ff 75 08             	push   0x8(%ebp)
+  801f72:	e8 79 ff ff ff       	call   801ef0 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801f77:	c9                   	leave
+  801f78:	c3                   	ret
+
+00801f79 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  801f79:	55                   	push   %ebp
+  801f7a:	89 e5                	mov    %esp,%ebp
+  801f7c:	83 ec 0c             	sub    $0xc,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  801f7f:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vfprintf(1, fmt, ap);
+  801f82:	50                   	push   %eax
+  801f83:	ff 75 08             	push   0x8(%ebp)
+  801f86:	6a 01                	push   $0x1
+  801f88:	e8 63 ff ff ff       	call   801ef0 <vfprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  801f8d:	c9                   	leave
+  801f8e:	c3                   	ret
+
+00801f8f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f8f:	55                   	push   %ebp
+  801f90:	89 e5                	mov    %esp,%ebp
+  801f92:	56                   	push   %esi
+  801f93:	53                   	push   %ebx
+  801f94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801f97:	83 ec 0c             	sub    $0xc,%esp
+  801f9a:	ff 75 08             	push   0x8(%ebp)
+  801f9d:	e8 6c f5 ff ff       	call   80150e <fd2data>
+  801fa2:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801fa4:	83 c4 08             	add    $0x8,%esp
+  801fa7:	68 27 2e 80 00       	push   $0x802e27
+  801fac:	53                   	push   %ebx
+  801fad:	e8 be ea ff ff       	call   800a70 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801fb2:	8b 46 04             	mov    0x4(%esi),%eax
+  801fb5:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801fbb:	2b 0e                	sub    (%esi),%ecx
+  801fbd:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801fc2:	89 c8                	mov    %ecx,%eax
+  801fc4:	f7 e2                	mul    %edx
+  801fc6:	c1 ea 0c             	shr    $0xc,%edx
+  801fc9:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801fcf:	29 d1                	sub    %edx,%ecx
+  801fd1:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801fd7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801fde:	00 00 00 
+	stat->st_dev = &devpipe;
+  801fe1:	c7 83 88 00 00 00 3c 	movl   $0x80303c,0x88(%ebx)
+  801fe8:	30 80 00 
+	return 0;
+}
+  801feb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff3:	5b                   	pop    %ebx
+  801ff4:	5e                   	pop    %esi
+  801ff5:	5d                   	pop    %ebp
+  801ff6:	c3                   	ret
+
+00801ff7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801ff7:	55                   	push   %ebp
+  801ff8:	89 e5                	mov    %esp,%ebp
+  801ffa:	53                   	push   %ebx
+  801ffb:	83 ec 0c             	sub    $0xc,%esp
+  801ffe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802001:	53                   	push   %ebx
+  802002:	6a 00                	push   $0x0
+  802004:	e8 df ef ff ff       	call   800fe8 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802009:	89 1c 24             	mov    %ebx,(%esp)
+  80200c:	e8 fd f4 ff ff       	call   80150e <fd2data>
+  802011:	83 c4 08             	add    $0x8,%esp
+  802014:	50                   	push   %eax
+  802015:	6a 00                	push   $0x0
+  802017:	e8 cc ef ff ff       	call   800fe8 <sys_page_unmap>
+}
+  80201c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80201f:	c9                   	leave
+  802020:	c3                   	ret
+
+00802021 <_pipeisclosed>:
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	57                   	push   %edi
+  802025:	56                   	push   %esi
+  802026:	53                   	push   %ebx
+  802027:	83 ec 1c             	sub    $0x1c,%esp
+  80202a:	89 c7                	mov    %eax,%edi
+  80202c:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80202e:	a1 08 44 80 00       	mov    0x804408,%eax
+  802033:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802036:	83 ec 0c             	sub    $0xc,%esp
+  802039:	57                   	push   %edi
+  80203a:	e8 c1 06 00 00       	call   802700 <pageref>
+  80203f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802042:	89 34 24             	mov    %esi,(%esp)
+  802045:	e8 b6 06 00 00       	call   802700 <pageref>
+		nn = thisenv->env_runs;
+  80204a:	8b 15 08 44 80 00    	mov    0x804408,%edx
+  802050:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802053:	83 c4 10             	add    $0x10,%esp
+  802056:	39 cb                	cmp    %ecx,%ebx
+  802058:	74 1b                	je     802075 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80205a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80205d:	75 cf                	jne    80202e <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80205f:	8b 42 58             	mov    0x58(%edx),%eax
+  802062:	6a 01                	push   $0x1
+  802064:	50                   	push   %eax
+  802065:	53                   	push   %ebx
+  802066:	68 2e 2e 80 00       	push   $0x802e2e
+  80206b:	e8 29 e3 ff ff       	call   800399 <cprintf>
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	eb b9                	jmp    80202e <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802075:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802078:	0f 94 c0             	sete   %al
+  80207b:	0f b6 c0             	movzbl %al,%eax
+}
+  80207e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802081:	5b                   	pop    %ebx
+  802082:	5e                   	pop    %esi
+  802083:	5f                   	pop    %edi
+  802084:	5d                   	pop    %ebp
+  802085:	c3                   	ret
+
+00802086 <devpipe_read>:
+{
+  802086:	55                   	push   %ebp
+  802087:	89 e5                	mov    %esp,%ebp
+  802089:	57                   	push   %edi
+  80208a:	56                   	push   %esi
+  80208b:	53                   	push   %ebx
+  80208c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  80208f:	ff 75 08             	push   0x8(%ebp)
+  802092:	e8 77 f4 ff ff       	call   80150e <fd2data>
+  802097:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802099:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  80209c:	8d 40 04             	lea    0x4(%eax),%eax
+  80209f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8020a2:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8020a5:	8b 0b                	mov    (%ebx),%ecx
+  8020a7:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8020ad:	29 ce                	sub    %ecx,%esi
+  8020af:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8020b4:	f7 e6                	mul    %esi
+  8020b6:	c1 ea 0c             	shr    $0xc,%edx
+  8020b9:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8020bf:	29 c6                	sub    %eax,%esi
+  8020c1:	89 f2                	mov    %esi,%edx
+  8020c3:	75 43                	jne    802108 <devpipe_read+0x82>
+		ref = pageref(p);
+  8020c5:	83 ec 0c             	sub    $0xc,%esp
+  8020c8:	53                   	push   %ebx
+  8020c9:	e8 32 06 00 00       	call   802700 <pageref>
+  8020ce:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8020d0:	89 da                	mov    %ebx,%edx
+  8020d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d5:	e8 47 ff ff ff       	call   802021 <_pipeisclosed>
+  8020da:	83 c4 10             	add    $0x10,%esp
+  8020dd:	85 c0                	test   %eax,%eax
+  8020df:	0f 85 c1 00 00 00    	jne    8021a6 <devpipe_read+0x120>
+	*sleeping = 1;
+  8020e5:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8020ec:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8020f1:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8020f4:	75 ac                	jne    8020a2 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8020f6:	83 ec 04             	sub    $0x4,%esp
+  8020f9:	56                   	push   %esi
+  8020fa:	57                   	push   %edi
+  8020fb:	ff 75 e4             	push   -0x1c(%ebp)
+  8020fe:	e8 39 f3 ff ff       	call   80143c <sys_futex_wait>
+  802103:	83 c4 10             	add    $0x10,%esp
+  802106:	eb 9a                	jmp    8020a2 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802108:	39 75 10             	cmp    %esi,0x10(%ebp)
+  80210b:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  80210f:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802111:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802116:	f7 e1                	mul    %ecx
+  802118:	c1 ea 0b             	shr    $0xb,%edx
+  80211b:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802121:	29 c1                	sub    %eax,%ecx
+  802123:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802125:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80212a:	29 cf                	sub    %ecx,%edi
+  80212c:	39 f7                	cmp    %esi,%edi
+  80212e:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802131:	8d 43 10             	lea    0x10(%ebx),%eax
+  802134:	83 ec 04             	sub    $0x4,%esp
+  802137:	57                   	push   %edi
+  802138:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80213b:	01 c2                	add    %eax,%edx
+  80213d:	52                   	push   %edx
+  80213e:	ff 75 0c             	push   0xc(%ebp)
+  802141:	e8 b0 ea ff ff       	call   800bf6 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802146:	83 c4 0c             	add    $0xc,%esp
+  802149:	89 f1                	mov    %esi,%ecx
+  80214b:	29 f9                	sub    %edi,%ecx
+  80214d:	51                   	push   %ecx
+  80214e:	ff 75 e4             	push   -0x1c(%ebp)
+  802151:	89 f8                	mov    %edi,%eax
+  802153:	03 45 0c             	add    0xc(%ebp),%eax
+  802156:	50                   	push   %eax
+  802157:	e8 9a ea ff ff       	call   800bf6 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  80215c:	89 f1                	mov    %esi,%ecx
+  80215e:	03 0b                	add    (%ebx),%ecx
+  802160:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802165:	f7 e1                	mul    %ecx
+  802167:	c1 ea 0c             	shr    $0xc,%edx
+  80216a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802170:	29 d1                	sub    %edx,%ecx
+  802172:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802174:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802179:	83 c4 10             	add    $0x10,%esp
+  80217c:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802180:	75 0a                	jne    80218c <devpipe_read+0x106>
+	return n;
+  802182:	89 f0                	mov    %esi,%eax
+}
+  802184:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802187:	5b                   	pop    %ebx
+  802188:	5e                   	pop    %esi
+  802189:	5f                   	pop    %edi
+  80218a:	5d                   	pop    %ebp
+  80218b:	c3                   	ret
+		*sleeping = 0;
+  80218c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802193:	83 ec 08             	sub    $0x8,%esp
+  802196:	68 00 04 00 00       	push   $0x400
+  80219b:	53                   	push   %ebx
+  80219c:	e8 eb f2 ff ff       	call   80148c <sys_futex_wake>
+  8021a1:	83 c4 10             	add    $0x10,%esp
+  8021a4:	eb dc                	jmp    802182 <devpipe_read+0xfc>
+			return 0;
+  8021a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ab:	eb d7                	jmp    802184 <devpipe_read+0xfe>
+
+008021ad <devpipe_write>:
+{
+  8021ad:	55                   	push   %ebp
+  8021ae:	89 e5                	mov    %esp,%ebp
+  8021b0:	57                   	push   %edi
+  8021b1:	56                   	push   %esi
+  8021b2:	53                   	push   %ebx
+  8021b3:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8021b6:	ff 75 08             	push   0x8(%ebp)
+  8021b9:	e8 50 f3 ff ff       	call   80150e <fd2data>
+  8021be:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8021c0:	83 c4 10             	add    $0x10,%esp
+  8021c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8021ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021cd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8021d0:	0f 83 23 01 00 00    	jae    8022f9 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8021d6:	8b 77 04             	mov    0x4(%edi),%esi
+  8021d9:	8b 1f                	mov    (%edi),%ebx
+  8021db:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8021e1:	29 d9                	sub    %ebx,%ecx
+  8021e3:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8021e8:	f7 e1                	mul    %ecx
+  8021ea:	c1 ea 0c             	shr    $0xc,%edx
+  8021ed:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8021f3:	29 c1                	sub    %eax,%ecx
+  8021f5:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8021f7:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  8021fd:	75 40                	jne    80223f <devpipe_write+0x92>
+			ref = pageref(p);
+  8021ff:	83 ec 0c             	sub    $0xc,%esp
+  802202:	57                   	push   %edi
+  802203:	e8 f8 04 00 00       	call   802700 <pageref>
+  802208:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80220a:	89 fa                	mov    %edi,%edx
+  80220c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220f:	e8 0d fe ff ff       	call   802021 <_pipeisclosed>
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	85 c0                	test   %eax,%eax
+  802219:	0f 85 d5 00 00 00    	jne    8022f4 <devpipe_write+0x147>
+	*sleeping = 1;
+  80221f:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802226:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80222b:	39 1f                	cmp    %ebx,(%edi)
+  80222d:	75 a7                	jne    8021d6 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  80222f:	83 ec 04             	sub    $0x4,%esp
+  802232:	56                   	push   %esi
+  802233:	53                   	push   %ebx
+  802234:	57                   	push   %edi
+  802235:	e8 02 f2 ff ff       	call   80143c <sys_futex_wait>
+  80223a:	83 c4 10             	add    $0x10,%esp
+  80223d:	eb 97                	jmp    8021d6 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  80223f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802242:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802245:	29 c1                	sub    %eax,%ecx
+  802247:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80224c:	89 d8                	mov    %ebx,%eax
+  80224e:	29 d0                	sub    %edx,%eax
+  802250:	39 c1                	cmp    %eax,%ecx
+  802252:	0f 46 c1             	cmovbe %ecx,%eax
+  802255:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802257:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80225c:	f7 e6                	mul    %esi
+  80225e:	c1 ea 0b             	shr    $0xb,%edx
+  802261:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802267:	29 c6                	sub    %eax,%esi
+  802269:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80226b:	29 f3                	sub    %esi,%ebx
+  80226d:	39 cb                	cmp    %ecx,%ebx
+  80226f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802272:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802275:	8d 77 10             	lea    0x10(%edi),%esi
+  802278:	83 ec 04             	sub    $0x4,%esp
+  80227b:	53                   	push   %ebx
+  80227c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80227f:	03 45 0c             	add    0xc(%ebp),%eax
+  802282:	50                   	push   %eax
+  802283:	01 f2                	add    %esi,%edx
+  802285:	52                   	push   %edx
+  802286:	e8 6b e9 ff ff       	call   800bf6 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80228b:	83 c4 0c             	add    $0xc,%esp
+  80228e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802291:	29 d8                	sub    %ebx,%eax
+  802293:	50                   	push   %eax
+  802294:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802297:	01 d3                	add    %edx,%ebx
+  802299:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80229c:	53                   	push   %ebx
+  80229d:	56                   	push   %esi
+  80229e:	e8 53 e9 ff ff       	call   800bf6 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8022a3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8022a6:	03 4f 04             	add    0x4(%edi),%ecx
+  8022a9:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8022ae:	f7 e1                	mul    %ecx
+  8022b0:	c1 ea 0c             	shr    $0xc,%edx
+  8022b3:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022b9:	29 d1                	sub    %edx,%ecx
+  8022bb:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8022be:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8022c3:	83 c4 10             	add    $0x10,%esp
+  8022c6:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8022ca:	75 0b                	jne    8022d7 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8022cc:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8022cf:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8022d2:	e9 f3 fe ff ff       	jmp    8021ca <devpipe_write+0x1d>
+		*sleeping = 0;
+  8022d7:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8022de:	83 ec 08             	sub    $0x8,%esp
+  8022e1:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8022e6:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8022e9:	50                   	push   %eax
+  8022ea:	e8 9d f1 ff ff       	call   80148c <sys_futex_wake>
+  8022ef:	83 c4 10             	add    $0x10,%esp
+  8022f2:	eb d8                	jmp    8022cc <devpipe_write+0x11f>
+				return 0;
+  8022f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022fc:	5b                   	pop    %ebx
+  8022fd:	5e                   	pop    %esi
+  8022fe:	5f                   	pop    %edi
+  8022ff:	5d                   	pop    %ebp
+  802300:	c3                   	ret
+
+00802301 <pipe>:
+{
+  802301:	55                   	push   %ebp
+  802302:	89 e5                	mov    %esp,%ebp
+  802304:	56                   	push   %esi
+  802305:	53                   	push   %ebx
+  802306:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802309:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80230c:	50                   	push   %eax
+  80230d:	e8 13 f2 ff ff       	call   801525 <fd_alloc>
+  802312:	89 c3                	mov    %eax,%ebx
+  802314:	83 c4 10             	add    $0x10,%esp
+  802317:	85 c0                	test   %eax,%eax
+  802319:	0f 88 23 01 00 00    	js     802442 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80231f:	83 ec 04             	sub    $0x4,%esp
+  802322:	68 07 04 00 00       	push   $0x407
+  802327:	ff 75 f4             	push   -0xc(%ebp)
+  80232a:	6a 00                	push   $0x0
+  80232c:	e8 32 ec ff ff       	call   800f63 <sys_page_alloc>
+  802331:	89 c3                	mov    %eax,%ebx
+  802333:	83 c4 10             	add    $0x10,%esp
+  802336:	85 c0                	test   %eax,%eax
+  802338:	0f 88 04 01 00 00    	js     802442 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80233e:	83 ec 0c             	sub    $0xc,%esp
+  802341:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802344:	50                   	push   %eax
+  802345:	e8 db f1 ff ff       	call   801525 <fd_alloc>
+  80234a:	89 c3                	mov    %eax,%ebx
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	85 c0                	test   %eax,%eax
+  802351:	0f 88 db 00 00 00    	js     802432 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802357:	83 ec 04             	sub    $0x4,%esp
+  80235a:	68 07 04 00 00       	push   $0x407
+  80235f:	ff 75 f0             	push   -0x10(%ebp)
+  802362:	6a 00                	push   $0x0
+  802364:	e8 fa eb ff ff       	call   800f63 <sys_page_alloc>
+  802369:	89 c3                	mov    %eax,%ebx
+  80236b:	83 c4 10             	add    $0x10,%esp
+  80236e:	85 c0                	test   %eax,%eax
+  802370:	0f 88 bc 00 00 00    	js     802432 <pipe+0x131>
+	va = fd2data(fd0);
+  802376:	83 ec 0c             	sub    $0xc,%esp
+  802379:	ff 75 f4             	push   -0xc(%ebp)
+  80237c:	e8 8d f1 ff ff       	call   80150e <fd2data>
+  802381:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802383:	83 c4 0c             	add    $0xc,%esp
+  802386:	68 07 04 00 00       	push   $0x407
+  80238b:	50                   	push   %eax
+  80238c:	6a 00                	push   $0x0
+  80238e:	e8 d0 eb ff ff       	call   800f63 <sys_page_alloc>
+  802393:	89 c3                	mov    %eax,%ebx
+  802395:	83 c4 10             	add    $0x10,%esp
+  802398:	85 c0                	test   %eax,%eax
+  80239a:	0f 88 82 00 00 00    	js     802422 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8023a0:	83 ec 0c             	sub    $0xc,%esp
+  8023a3:	ff 75 f0             	push   -0x10(%ebp)
+  8023a6:	e8 63 f1 ff ff       	call   80150e <fd2data>
+  8023ab:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8023b2:	50                   	push   %eax
+  8023b3:	6a 00                	push   $0x0
+  8023b5:	56                   	push   %esi
+  8023b6:	6a 00                	push   $0x0
+  8023b8:	e8 e9 eb ff ff       	call   800fa6 <sys_page_map>
+  8023bd:	89 c3                	mov    %eax,%ebx
+  8023bf:	83 c4 20             	add    $0x20,%esp
+  8023c2:	85 c0                	test   %eax,%eax
+  8023c4:	78 4e                	js     802414 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8023c6:	a1 3c 30 80 00       	mov    0x80303c,%eax
+  8023cb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023ce:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8023d0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8023d3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8023da:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8023dd:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8023df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8023e2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8023e9:	83 ec 0c             	sub    $0xc,%esp
+  8023ec:	ff 75 f4             	push   -0xc(%ebp)
+  8023ef:	e8 0a f1 ff ff       	call   8014fe <fd2num>
+  8023f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023f7:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8023f9:	83 c4 04             	add    $0x4,%esp
+  8023fc:	ff 75 f0             	push   -0x10(%ebp)
+  8023ff:	e8 fa f0 ff ff       	call   8014fe <fd2num>
+  802404:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802407:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  80240a:	83 c4 10             	add    $0x10,%esp
+  80240d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802412:	eb 2e                	jmp    802442 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802414:	83 ec 08             	sub    $0x8,%esp
+  802417:	56                   	push   %esi
+  802418:	6a 00                	push   $0x0
+  80241a:	e8 c9 eb ff ff       	call   800fe8 <sys_page_unmap>
+  80241f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802422:	83 ec 08             	sub    $0x8,%esp
+  802425:	ff 75 f0             	push   -0x10(%ebp)
+  802428:	6a 00                	push   $0x0
+  80242a:	e8 b9 eb ff ff       	call   800fe8 <sys_page_unmap>
+  80242f:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802432:	83 ec 08             	sub    $0x8,%esp
+  802435:	ff 75 f4             	push   -0xc(%ebp)
+  802438:	6a 00                	push   $0x0
+  80243a:	e8 a9 eb ff ff       	call   800fe8 <sys_page_unmap>
+  80243f:	83 c4 10             	add    $0x10,%esp
+}
+  802442:	89 d8                	mov    %ebx,%eax
+  802444:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802447:	5b                   	pop    %ebx
+  802448:	5e                   	pop    %esi
+  802449:	5d                   	pop    %ebp
+  80244a:	c3                   	ret
+
+0080244b <pipeisclosed>:
+{
+  80244b:	55                   	push   %ebp
+  80244c:	89 e5                	mov    %esp,%ebp
+  80244e:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802451:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802454:	50                   	push   %eax
+  802455:	ff 75 08             	push   0x8(%ebp)
+  802458:	e8 1c f1 ff ff       	call   801579 <fd_lookup>
+  80245d:	83 c4 10             	add    $0x10,%esp
+  802460:	85 c0                	test   %eax,%eax
+  802462:	78 18                	js     80247c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802464:	83 ec 0c             	sub    $0xc,%esp
+  802467:	ff 75 f4             	push   -0xc(%ebp)
+  80246a:	e8 9f f0 ff ff       	call   80150e <fd2data>
+  80246f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802471:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802474:	e8 a8 fb ff ff       	call   802021 <_pipeisclosed>
+  802479:	83 c4 10             	add    $0x10,%esp
+}
+  80247c:	c9                   	leave
+  80247d:	c3                   	ret
+
+0080247e <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80247e:	55                   	push   %ebp
+  80247f:	89 e5                	mov    %esp,%ebp
+  802481:	57                   	push   %edi
+  802482:	56                   	push   %esi
+  802483:	53                   	push   %ebx
+  802484:	83 ec 14             	sub    $0x14,%esp
+  802487:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80248a:	8b 75 14             	mov    0x14(%ebp),%esi
+  80248d:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  802490:	ff 75 10             	push   0x10(%ebp)
+  802493:	ff 75 0c             	push   0xc(%ebp)
+  802496:	e8 eb ee ff ff       	call   801386 <sys_ipc_recv_pages>
+  80249b:	83 c4 10             	add    $0x10,%esp
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	78 46                	js     8024e8 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8024a2:	85 ff                	test   %edi,%edi
+  8024a4:	74 0d                	je     8024b3 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  8024a6:	a1 08 44 80 00       	mov    0x804408,%eax
+  8024ab:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8024b1:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8024b3:	85 f6                	test   %esi,%esi
+  8024b5:	74 0d                	je     8024c4 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  8024b7:	a1 08 44 80 00       	mov    0x804408,%eax
+  8024bc:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8024c2:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8024c4:	85 db                	test   %ebx,%ebx
+  8024c6:	74 0d                	je     8024d5 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8024c8:	a1 08 44 80 00       	mov    0x804408,%eax
+  8024cd:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8024d3:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8024d5:	a1 08 44 80 00       	mov    0x804408,%eax
+  8024da:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8024e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e3:	5b                   	pop    %ebx
+  8024e4:	5e                   	pop    %esi
+  8024e5:	5f                   	pop    %edi
+  8024e6:	5d                   	pop    %ebp
+  8024e7:	c3                   	ret
+		if (from_env_store) {
+  8024e8:	85 ff                	test   %edi,%edi
+  8024ea:	74 06                	je     8024f2 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8024ec:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8024f2:	85 f6                	test   %esi,%esi
+  8024f4:	74 06                	je     8024fc <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8024f6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8024fc:	85 db                	test   %ebx,%ebx
+  8024fe:	74 e0                	je     8024e0 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  802500:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802506:	eb d8                	jmp    8024e0 <ipc_recv_pages+0x62>
+
+00802508 <ipc_recv>:
+{
+  802508:	55                   	push   %ebp
+  802509:	89 e5                	mov    %esp,%ebp
+  80250b:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80250e:	6a 00                	push   $0x0
+  802510:	ff 75 10             	push   0x10(%ebp)
+  802513:	6a 01                	push   $0x1
+  802515:	ff 75 0c             	push   0xc(%ebp)
+  802518:	ff 75 08             	push   0x8(%ebp)
+  80251b:	e8 5e ff ff ff       	call   80247e <ipc_recv_pages>
+}
+  802520:	c9                   	leave
+  802521:	c3                   	ret
+
+00802522 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  802522:	55                   	push   %ebp
+  802523:	89 e5                	mov    %esp,%ebp
+  802525:	56                   	push   %esi
+  802526:	53                   	push   %ebx
+  802527:	8b 75 08             	mov    0x8(%ebp),%esi
+  80252a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80252d:	83 ec 0c             	sub    $0xc,%esp
+  802530:	ff 75 0c             	push   0xc(%ebp)
+  802533:	e8 82 ef ff ff       	call   8014ba <sys_ipc_try_recv>
+  802538:	83 c4 10             	add    $0x10,%esp
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	78 34                	js     802573 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80253f:	85 f6                	test   %esi,%esi
+  802541:	74 0d                	je     802550 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  802543:	a1 08 44 80 00       	mov    0x804408,%eax
+  802548:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80254e:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  802550:	85 db                	test   %ebx,%ebx
+  802552:	74 0d                	je     802561 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  802554:	a1 08 44 80 00       	mov    0x804408,%eax
+  802559:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80255f:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802561:	a1 08 44 80 00       	mov    0x804408,%eax
+  802566:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80256c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80256f:	5b                   	pop    %ebx
+  802570:	5e                   	pop    %esi
+  802571:	5d                   	pop    %ebp
+  802572:	c3                   	ret
+		if (from_env_store) {
+  802573:	85 f6                	test   %esi,%esi
+  802575:	74 06                	je     80257d <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  802577:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80257d:	85 db                	test   %ebx,%ebx
+  80257f:	74 eb                	je     80256c <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  802581:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802587:	eb e3                	jmp    80256c <ipc_try_recv+0x4a>
+
+00802589 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802589:	55                   	push   %ebp
+  80258a:	89 e5                	mov    %esp,%ebp
+  80258c:	83 ec 14             	sub    $0x14,%esp
+  80258f:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802592:	85 c0                	test   %eax,%eax
+  802594:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802599:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80259c:	ff 75 18             	push   0x18(%ebp)
+  80259f:	ff 75 14             	push   0x14(%ebp)
+  8025a2:	50                   	push   %eax
+  8025a3:	ff 75 0c             	push   0xc(%ebp)
+  8025a6:	ff 75 08             	push   0x8(%ebp)
+  8025a9:	e8 9b ed ff ff       	call   801349 <sys_ipc_send_pages>
+  8025ae:	83 c4 20             	add    $0x20,%esp
+  8025b1:	85 c0                	test   %eax,%eax
+  8025b3:	78 02                	js     8025b7 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8025b5:	c9                   	leave
+  8025b6:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8025b7:	50                   	push   %eax
+  8025b8:	68 48 2e 80 00       	push   $0x802e48
+  8025bd:	68 80 00 00 00       	push   $0x80
+  8025c2:	68 74 2e 80 00       	push   $0x802e74
+  8025c7:	e8 f2 dc ff ff       	call   8002be <_panic>
+
+008025cc <ipc_send>:
+{
+  8025cc:	55                   	push   %ebp
+  8025cd:	89 e5                	mov    %esp,%ebp
+  8025cf:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8025d2:	ff 75 14             	push   0x14(%ebp)
+  8025d5:	6a 01                	push   $0x1
+  8025d7:	ff 75 10             	push   0x10(%ebp)
+  8025da:	ff 75 0c             	push   0xc(%ebp)
+  8025dd:	ff 75 08             	push   0x8(%ebp)
+  8025e0:	e8 a4 ff ff ff       	call   802589 <ipc_send_pages>
+}
+  8025e5:	83 c4 20             	add    $0x20,%esp
+  8025e8:	c9                   	leave
+  8025e9:	c3                   	ret
+
+008025ea <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8025ea:	55                   	push   %ebp
+  8025eb:	89 e5                	mov    %esp,%ebp
+  8025ed:	83 ec 14             	sub    $0x14,%esp
+  8025f0:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8025f3:	85 c0                	test   %eax,%eax
+  8025f5:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8025fa:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8025fd:	ff 75 18             	push   0x18(%ebp)
+  802600:	ff 75 14             	push   0x14(%ebp)
+  802603:	50                   	push   %eax
+  802604:	ff 75 0c             	push   0xc(%ebp)
+  802607:	ff 75 08             	push   0x8(%ebp)
+  80260a:	e8 cb ed ff ff       	call   8013da <sys_ipc_call>
+  80260f:	83 c4 20             	add    $0x20,%esp
+  802612:	85 c0                	test   %eax,%eax
+  802614:	78 0b                	js     802621 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  802616:	a1 08 44 80 00       	mov    0x804408,%eax
+  80261b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802621:	c9                   	leave
+  802622:	c3                   	ret
+
+00802623 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  802623:	55                   	push   %ebp
+  802624:	89 e5                	mov    %esp,%ebp
+  802626:	57                   	push   %edi
+  802627:	56                   	push   %esi
+  802628:	53                   	push   %ebx
+  802629:	83 ec 18             	sub    $0x18,%esp
+  80262c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80262f:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  802632:	8b 75 20             	mov    0x20(%ebp),%esi
+  802635:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802638:	85 c0                	test   %eax,%eax
+  80263a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80263f:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  802642:	ff 75 18             	push   0x18(%ebp)
+  802645:	ff 75 14             	push   0x14(%ebp)
+  802648:	50                   	push   %eax
+  802649:	ff 75 0c             	push   0xc(%ebp)
+  80264c:	ff 75 08             	push   0x8(%ebp)
+  80264f:	e8 c7 ed ff ff       	call   80141b <sys_ipc_reply_recv>
+  802654:	83 c4 20             	add    $0x20,%esp
+  802657:	85 c0                	test   %eax,%eax
+  802659:	78 46                	js     8026a1 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80265b:	85 ff                	test   %edi,%edi
+  80265d:	74 0d                	je     80266c <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  80265f:	a1 08 44 80 00       	mov    0x804408,%eax
+  802664:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80266a:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80266c:	85 f6                	test   %esi,%esi
+  80266e:	74 0d                	je     80267d <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  802670:	a1 08 44 80 00       	mov    0x804408,%eax
+  802675:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80267b:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80267d:	85 db                	test   %ebx,%ebx
+  80267f:	74 0d                	je     80268e <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  802681:	a1 08 44 80 00       	mov    0x804408,%eax
+  802686:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80268c:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80268e:	a1 08 44 80 00       	mov    0x804408,%eax
+  802693:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802699:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80269c:	5b                   	pop    %ebx
+  80269d:	5e                   	pop    %esi
+  80269e:	5f                   	pop    %edi
+  80269f:	5d                   	pop    %ebp
+  8026a0:	c3                   	ret
+		if (from_env_store) {
+  8026a1:	85 ff                	test   %edi,%edi
+  8026a3:	74 06                	je     8026ab <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  8026a5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8026ab:	85 f6                	test   %esi,%esi
+  8026ad:	74 06                	je     8026b5 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  8026af:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8026b5:	85 db                	test   %ebx,%ebx
+  8026b7:	74 e0                	je     802699 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8026b9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8026bf:	eb d8                	jmp    802699 <ipc_reply_recv+0x76>
+
+008026c1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8026c1:	55                   	push   %ebp
+  8026c2:	89 e5                	mov    %esp,%ebp
+  8026c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8026c7:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8026cc:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8026cf:	c1 e0 06             	shl    $0x6,%eax
+  8026d2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8026d7:	8b 40 50             	mov    0x50(%eax),%eax
+  8026da:	39 c8                	cmp    %ecx,%eax
+  8026dc:	74 12                	je     8026f0 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8026de:	83 c2 01             	add    $0x1,%edx
+  8026e1:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8026e7:	75 e3                	jne    8026cc <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8026e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ee:	eb 0e                	jmp    8026fe <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8026f0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8026f3:	c1 e0 06             	shl    $0x6,%eax
+  8026f6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8026fb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8026fe:	5d                   	pop    %ebp
+  8026ff:	c3                   	ret
+
+00802700 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802700:	55                   	push   %ebp
+  802701:	89 e5                	mov    %esp,%ebp
+  802703:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802706:	89 c2                	mov    %eax,%edx
+  802708:	c1 ea 16             	shr    $0x16,%edx
+  80270b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802712:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  802717:	f6 c1 01             	test   $0x1,%cl
+  80271a:	74 1e                	je     80273a <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80271c:	c1 e8 0c             	shr    $0xc,%eax
+  80271f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  802726:	a8 01                	test   $0x1,%al
+  802728:	74 10                	je     80273a <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80272a:	c1 e8 0c             	shr    $0xc,%eax
+  80272d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802730:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  802737:	0f b7 d2             	movzwl %dx,%edx
+}
+  80273a:	89 d0                	mov    %edx,%eax
+  80273c:	5d                   	pop    %ebp
+  80273d:	c3                   	ret
+
+0080273e <udivmod>:
+  80273e:	55                   	push   %ebp
+  80273f:	57                   	push   %edi
+  802740:	56                   	push   %esi
+  802741:	53                   	push   %ebx
+  802742:	83 ec 24             	sub    $0x24,%esp
+  802745:	89 44 24 08          	mov    %eax,0x8(%esp)
+  802749:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  80274d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802751:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802755:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802759:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80275d:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802761:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802770:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802777:	00 
+  802778:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80277f:	00 
+  802780:	89 fb                	mov    %edi,%ebx
+  802782:	eb 08                	jmp    80278c <udivmod+0x4e>
+  802784:	83 e9 01             	sub    $0x1,%ecx
+  802787:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  80278a:	74 68                	je     8027f4 <udivmod+0xb6>
+  80278c:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  802790:	01 c0                	add    %eax,%eax
+  802792:	89 c6                	mov    %eax,%esi
+  802794:	89 d7                	mov    %edx,%edi
+  802796:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80279a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80279e:	0f ad d0             	shrd   %cl,%edx,%eax
+  8027a1:	d3 ea                	shr    %cl,%edx
+  8027a3:	f6 c1 20             	test   $0x20,%cl
+  8027a6:	74 04                	je     8027ac <udivmod+0x6e>
+  8027a8:	89 d0                	mov    %edx,%eax
+  8027aa:	31 d2                	xor    %edx,%edx
+  8027ac:	83 e0 01             	and    $0x1,%eax
+  8027af:	89 04 24             	mov    %eax,(%esp)
+  8027b2:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8027b9:	00 
+  8027ba:	8b 04 24             	mov    (%esp),%eax
+  8027bd:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8027c1:	09 f0                	or     %esi,%eax
+  8027c3:	09 fa                	or     %edi,%edx
+  8027c5:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8027c9:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8027cd:	39 f0                	cmp    %esi,%eax
+  8027cf:	89 d5                	mov    %edx,%ebp
+  8027d1:	19 fd                	sbb    %edi,%ebp
+  8027d3:	72 af                	jb     802784 <udivmod+0x46>
+  8027d5:	29 f0                	sub    %esi,%eax
+  8027d7:	19 fa                	sbb    %edi,%edx
+  8027d9:	89 cf                	mov    %ecx,%edi
+  8027db:	c1 ef 05             	shr    $0x5,%edi
+  8027de:	83 e7 01             	and    $0x1,%edi
+  8027e1:	89 fe                	mov    %edi,%esi
+  8027e3:	83 f6 01             	xor    $0x1,%esi
+  8027e6:	d3 e6                	shl    %cl,%esi
+  8027e8:	d3 e7                	shl    %cl,%edi
+  8027ea:	09 74 24 18          	or     %esi,0x18(%esp)
+  8027ee:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8027f2:	eb 90                	jmp    802784 <udivmod+0x46>
+  8027f4:	85 db                	test   %ebx,%ebx
+  8027f6:	74 05                	je     8027fd <udivmod+0xbf>
+  8027f8:	89 03                	mov    %eax,(%ebx)
+  8027fa:	89 53 04             	mov    %edx,0x4(%ebx)
+  8027fd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802801:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802805:	83 c4 24             	add    $0x24,%esp
+  802808:	5b                   	pop    %ebx
+  802809:	5e                   	pop    %esi
+  80280a:	5f                   	pop    %edi
+  80280b:	5d                   	pop    %ebp
+  80280c:	c3                   	ret
+
+0080280d <__udivdi3>:
+  80280d:	83 ec 08             	sub    $0x8,%esp
+  802810:	6a 00                	push   $0x0
+  802812:	ff 74 24 1c          	push   0x1c(%esp)
+  802816:	ff 74 24 1c          	push   0x1c(%esp)
+  80281a:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80281e:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802822:	e8 17 ff ff ff       	call   80273e <udivmod>
+  802827:	83 c4 14             	add    $0x14,%esp
+  80282a:	c3                   	ret
+
+0080282b <__umoddi3>:
+  80282b:	83 ec 18             	sub    $0x18,%esp
+  80282e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802832:	50                   	push   %eax
+  802833:	ff 74 24 2c          	push   0x2c(%esp)
+  802837:	ff 74 24 2c          	push   0x2c(%esp)
+  80283b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80283f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802843:	e8 f6 fe ff ff       	call   80273e <udivmod>
+  802848:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80284c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802850:	83 c4 24             	add    $0x24,%esp
+  802853:	c3                   	ret
+
+00802854 <__divdi3>:
+  802854:	55                   	push   %ebp
+  802855:	57                   	push   %edi
+  802856:	56                   	push   %esi
+  802857:	53                   	push   %ebx
+  802858:	83 ec 10             	sub    $0x10,%esp
+  80285b:	8b 44 24 24          	mov    0x24(%esp),%eax
+  80285f:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802863:	89 c6                	mov    %eax,%esi
+  802865:	89 d7                	mov    %edx,%edi
+  802867:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80286b:	33 7c 24 30          	xor    0x30(%esp),%edi
+  80286f:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802873:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802877:	89 c5                	mov    %eax,%ebp
+  802879:	f7 dd                	neg    %ebp
+  80287b:	89 d6                	mov    %edx,%esi
+  80287d:	83 d6 00             	adc    $0x0,%esi
+  802880:	f7 de                	neg    %esi
+  802882:	0f 48 e8             	cmovs  %eax,%ebp
+  802885:	0f 49 d6             	cmovns %esi,%edx
+  802888:	6a 00                	push   $0x0
+  80288a:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80288e:	f7 de                	neg    %esi
+  802890:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802894:	83 d0 00             	adc    $0x0,%eax
+  802897:	f7 d8                	neg    %eax
+  802899:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80289e:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  8028a3:	50                   	push   %eax
+  8028a4:	56                   	push   %esi
+  8028a5:	89 e8                	mov    %ebp,%eax
+  8028a7:	e8 92 fe ff ff       	call   80273e <udivmod>
+  8028ac:	83 c4 10             	add    $0x10,%esp
+  8028af:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  8028b4:	78 08                	js     8028be <__divdi3+0x6a>
+  8028b6:	83 c4 0c             	add    $0xc,%esp
+  8028b9:	5b                   	pop    %ebx
+  8028ba:	5e                   	pop    %esi
+  8028bb:	5f                   	pop    %edi
+  8028bc:	5d                   	pop    %ebp
+  8028bd:	c3                   	ret
+  8028be:	f7 d8                	neg    %eax
+  8028c0:	83 d2 00             	adc    $0x0,%edx
+  8028c3:	f7 da                	neg    %edx
+  8028c5:	eb ef                	jmp    8028b6 <__divdi3+0x62>
+
+008028c7 <__moddi3>:
+  8028c7:	55                   	push   %ebp
+  8028c8:	57                   	push   %edi
+  8028c9:	56                   	push   %esi
+  8028ca:	53                   	push   %ebx
+  8028cb:	83 ec 18             	sub    $0x18,%esp
+  8028ce:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8028d2:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8028d6:	89 f1                	mov    %esi,%ecx
+  8028d8:	f7 d9                	neg    %ecx
+  8028da:	89 da                	mov    %ebx,%edx
+  8028dc:	83 d2 00             	adc    $0x0,%edx
+  8028df:	f7 da                	neg    %edx
+  8028e1:	0f 48 ce             	cmovs  %esi,%ecx
+  8028e4:	0f 48 d3             	cmovs  %ebx,%edx
+  8028e7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8028eb:	50                   	push   %eax
+  8028ec:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8028f0:	f7 de                	neg    %esi
+  8028f2:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8028f6:	83 d0 00             	adc    $0x0,%eax
+  8028f9:	f7 d8                	neg    %eax
+  8028fb:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  802900:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  802905:	50                   	push   %eax
+  802906:	56                   	push   %esi
+  802907:	89 c8                	mov    %ecx,%eax
+  802909:	e8 30 fe ff ff       	call   80273e <udivmod>
+  80290e:	83 c4 10             	add    $0x10,%esp
+  802911:	85 db                	test   %ebx,%ebx
+  802913:	78 10                	js     802925 <__moddi3+0x5e>
+  802915:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802919:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80291d:	83 c4 14             	add    $0x14,%esp
+  802920:	5b                   	pop    %ebx
+  802921:	5e                   	pop    %esi
+  802922:	5f                   	pop    %edi
+  802923:	5d                   	pop    %ebp
+  802924:	c3                   	ret
+  802925:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802929:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80292d:	f7 d8                	neg    %eax
+  80292f:	83 d2 00             	adc    $0x0,%edx
+  802932:	f7 da                	neg    %edx
+  802934:	eb e7                	jmp    80291d <__moddi3+0x56>
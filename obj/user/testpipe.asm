@@ -0,0 +1,10739 @@
+
+obj/user/testpipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 02 00 00       	call   8002d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 7c             	sub    $0x7c,%esp
+	char buf[100];
+	int i, pid, p[2];
+
+	binaryname = "pipereadeof";
+  80003b:	c7 05 04 70 80 00 20 	movl   $0x805520,0x807004
+  800042:	55 80 00 
+
+	if ((i = pipe(p)) < 0)
+  800045:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 da 26 00 00       	call   802728 <pipe>
+  80004e:	89 c6                	mov    %eax,%esi
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 1b 01 00 00    	js     800176 <umain+0x143>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80005b:	e8 71 15 00 00       	call   8015d1 <fork>
+  800060:	89 c3                	mov    %eax,%ebx
+  800062:	85 c0                	test   %eax,%eax
+  800064:	0f 88 1e 01 00 00    	js     800188 <umain+0x155>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80006a:	0f 85 56 01 00 00    	jne    8001c6 <umain+0x193>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800070:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  800075:	8b 40 48             	mov    0x48(%eax),%eax
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	ff 75 90             	push   -0x70(%ebp)
+  80007e:	50                   	push   %eax
+  80007f:	68 4e 55 80 00       	push   $0x80554e
+  800084:	e8 87 03 00 00       	call   800410 <cprintf>
+		close(p[1]);
+  800089:	83 c4 04             	add    $0x4,%esp
+  80008c:	ff 75 90             	push   -0x70(%ebp)
+  80008f:	e8 43 1b 00 00       	call   801bd7 <close>
+		cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  800094:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  800099:	8b 40 48             	mov    0x48(%eax),%eax
+  80009c:	83 c4 0c             	add    $0xc,%esp
+  80009f:	ff 75 8c             	push   -0x74(%ebp)
+  8000a2:	50                   	push   %eax
+  8000a3:	68 6b 55 80 00       	push   $0x80556b
+  8000a8:	e8 63 03 00 00       	call   800410 <cprintf>
+		i = readn(p[0], buf, sizeof buf-1);
+  8000ad:	83 c4 0c             	add    $0xc,%esp
+  8000b0:	6a 63                	push   $0x63
+  8000b2:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000b5:	50                   	push   %eax
+  8000b6:	ff 75 8c             	push   -0x74(%ebp)
+  8000b9:	e8 dc 1c 00 00       	call   801d9a <readn>
+  8000be:	89 c6                	mov    %eax,%esi
+		if (i < 0)
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	85 c0                	test   %eax,%eax
+  8000c5:	0f 88 cf 00 00 00    	js     80019a <umain+0x167>
+			panic("read: %e", i);
+		buf[i] = 0;
+  8000cb:	c6 44 05 94 00       	movb   $0x0,-0x6c(%ebp,%eax,1)
+		if (strcmp(buf, msg) == 0)
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+  8000d3:	ff 35 00 70 80 00    	push   0x807000
+  8000d9:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000dc:	50                   	push   %eax
+  8000dd:	e8 c6 09 00 00       	call   800aa8 <strcmp>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	85 c0                	test   %eax,%eax
+  8000e7:	0f 85 bf 00 00 00    	jne    8001ac <umain+0x179>
+			cprintf("\npipe read closed properly\n");
+  8000ed:	83 ec 0c             	sub    $0xc,%esp
+  8000f0:	68 91 55 80 00       	push   $0x805591
+  8000f5:	e8 16 03 00 00       	call   800410 <cprintf>
+  8000fa:	83 c4 10             	add    $0x10,%esp
+		else
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+		exit();
+  8000fd:	e8 19 02 00 00       	call   80031b <exit>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+			panic("write: %e", i);
+		close(p[1]);
+	}
+	wait(pid);
+  800102:	83 ec 0c             	sub    $0xc,%esp
+  800105:	53                   	push   %ebx
+  800106:	e8 9a 27 00 00       	call   8028a5 <wait>
+
+	binaryname = "pipewriteeof";
+  80010b:	c7 05 04 70 80 00 e7 	movl   $0x8055e7,0x807004
+  800112:	55 80 00 
+	if ((i = pipe(p)) < 0)
+  800115:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800118:	89 04 24             	mov    %eax,(%esp)
+  80011b:	e8 08 26 00 00       	call   802728 <pipe>
+  800120:	89 c6                	mov    %eax,%esi
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 32 01 00 00    	js     80025f <umain+0x22c>
+		panic("pipe: %e", i);
+
+	if ((pid = fork()) < 0)
+  80012d:	e8 9f 14 00 00       	call   8015d1 <fork>
+  800132:	89 c3                	mov    %eax,%ebx
+  800134:	85 c0                	test   %eax,%eax
+  800136:	0f 88 35 01 00 00    	js     800271 <umain+0x23e>
+		panic("fork: %e", i);
+
+	if (pid == 0) {
+  80013c:	0f 84 41 01 00 00    	je     800283 <umain+0x250>
+				break;
+		}
+		cprintf("\npipe write closed properly\n");
+		exit();
+	}
+	close(p[0]);
+  800142:	83 ec 0c             	sub    $0xc,%esp
+  800145:	ff 75 8c             	push   -0x74(%ebp)
+  800148:	e8 8a 1a 00 00       	call   801bd7 <close>
+	close(p[1]);
+  80014d:	83 c4 04             	add    $0x4,%esp
+  800150:	ff 75 90             	push   -0x70(%ebp)
+  800153:	e8 7f 1a 00 00       	call   801bd7 <close>
+	wait(pid);
+  800158:	89 1c 24             	mov    %ebx,(%esp)
+  80015b:	e8 45 27 00 00       	call   8028a5 <wait>
+
+	cprintf("pipe tests passed\n");
+  800160:	c7 04 24 15 56 80 00 	movl   $0x805615,(%esp)
+  800167:	e8 a4 02 00 00       	call   800410 <cprintf>
+}
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+		panic("pipe: %e", i);
+  800176:	50                   	push   %eax
+  800177:	68 2c 55 80 00       	push   $0x80552c
+  80017c:	6a 0e                	push   $0xe
+  80017e:	68 35 55 80 00       	push   $0x805535
+  800183:	e8 ad 01 00 00       	call   800335 <_panic>
+		panic("fork: %e", i);
+  800188:	56                   	push   %esi
+  800189:	68 45 55 80 00       	push   $0x805545
+  80018e:	6a 11                	push   $0x11
+  800190:	68 35 55 80 00       	push   $0x805535
+  800195:	e8 9b 01 00 00       	call   800335 <_panic>
+			panic("read: %e", i);
+  80019a:	50                   	push   %eax
+  80019b:	68 88 55 80 00       	push   $0x805588
+  8001a0:	6a 19                	push   $0x19
+  8001a2:	68 35 55 80 00       	push   $0x805535
+  8001a7:	e8 89 01 00 00       	call   800335 <_panic>
+			cprintf("\ngot %d bytes: %s\n", i, buf);
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8001b2:	50                   	push   %eax
+  8001b3:	56                   	push   %esi
+  8001b4:	68 ad 55 80 00       	push   $0x8055ad
+  8001b9:	e8 52 02 00 00       	call   800410 <cprintf>
+  8001be:	83 c4 10             	add    $0x10,%esp
+  8001c1:	e9 37 ff ff ff       	jmp    8000fd <umain+0xca>
+		cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8001c6:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8001cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8001ce:	83 ec 04             	sub    $0x4,%esp
+  8001d1:	ff 75 8c             	push   -0x74(%ebp)
+  8001d4:	50                   	push   %eax
+  8001d5:	68 4e 55 80 00       	push   $0x80554e
+  8001da:	e8 31 02 00 00       	call   800410 <cprintf>
+		close(p[0]);
+  8001df:	83 c4 04             	add    $0x4,%esp
+  8001e2:	ff 75 8c             	push   -0x74(%ebp)
+  8001e5:	e8 ed 19 00 00       	call   801bd7 <close>
+		cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  8001ea:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8001ef:	8b 40 48             	mov    0x48(%eax),%eax
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	ff 75 90             	push   -0x70(%ebp)
+  8001f8:	50                   	push   %eax
+  8001f9:	68 c0 55 80 00       	push   $0x8055c0
+  8001fe:	e8 0d 02 00 00       	call   800410 <cprintf>
+		if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800203:	83 c4 04             	add    $0x4,%esp
+  800206:	ff 35 00 70 80 00    	push   0x807000
+  80020c:	e8 ab 07 00 00       	call   8009bc <strlen>
+  800211:	83 c4 0c             	add    $0xc,%esp
+  800214:	50                   	push   %eax
+  800215:	ff 35 00 70 80 00    	push   0x807000
+  80021b:	ff 75 90             	push   -0x70(%ebp)
+  80021e:	e8 be 1b 00 00       	call   801de1 <write>
+  800223:	89 c6                	mov    %eax,%esi
+  800225:	83 c4 04             	add    $0x4,%esp
+  800228:	ff 35 00 70 80 00    	push   0x807000
+  80022e:	e8 89 07 00 00       	call   8009bc <strlen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	39 f0                	cmp    %esi,%eax
+  800238:	75 13                	jne    80024d <umain+0x21a>
+		close(p[1]);
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+  80023d:	ff 75 90             	push   -0x70(%ebp)
+  800240:	e8 92 19 00 00       	call   801bd7 <close>
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	e9 b5 fe ff ff       	jmp    800102 <umain+0xcf>
+			panic("write: %e", i);
+  80024d:	56                   	push   %esi
+  80024e:	68 dd 55 80 00       	push   $0x8055dd
+  800253:	6a 25                	push   $0x25
+  800255:	68 35 55 80 00       	push   $0x805535
+  80025a:	e8 d6 00 00 00       	call   800335 <_panic>
+		panic("pipe: %e", i);
+  80025f:	50                   	push   %eax
+  800260:	68 2c 55 80 00       	push   $0x80552c
+  800265:	6a 2c                	push   $0x2c
+  800267:	68 35 55 80 00       	push   $0x805535
+  80026c:	e8 c4 00 00 00       	call   800335 <_panic>
+		panic("fork: %e", i);
+  800271:	56                   	push   %esi
+  800272:	68 45 55 80 00       	push   $0x805545
+  800277:	6a 2f                	push   $0x2f
+  800279:	68 35 55 80 00       	push   $0x805535
+  80027e:	e8 b2 00 00 00       	call   800335 <_panic>
+		close(p[0]);
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	ff 75 8c             	push   -0x74(%ebp)
+  800289:	e8 49 19 00 00       	call   801bd7 <close>
+  80028e:	83 c4 10             	add    $0x10,%esp
+			cprintf(".");
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	68 f4 55 80 00       	push   $0x8055f4
+  800299:	e8 72 01 00 00       	call   800410 <cprintf>
+			if (write(p[1], "x", 1) != 1)
+  80029e:	83 c4 0c             	add    $0xc,%esp
+  8002a1:	6a 01                	push   $0x1
+  8002a3:	68 f6 55 80 00       	push   $0x8055f6
+  8002a8:	ff 75 90             	push   -0x70(%ebp)
+  8002ab:	e8 31 1b 00 00       	call   801de1 <write>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	83 f8 01             	cmp    $0x1,%eax
+  8002b6:	74 d9                	je     800291 <umain+0x25e>
+		cprintf("\npipe write closed properly\n");
+  8002b8:	83 ec 0c             	sub    $0xc,%esp
+  8002bb:	68 f8 55 80 00       	push   $0x8055f8
+  8002c0:	e8 4b 01 00 00       	call   800410 <cprintf>
+		exit();
+  8002c5:	e8 51 00 00 00       	call   80031b <exit>
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	e9 70 fe ff ff       	jmp    800142 <umain+0x10f>
+
+008002d2 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	56                   	push   %esi
+  8002d6:	53                   	push   %ebx
+  8002d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002da:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8002dd:	e8 ca 0b 00 00       	call   800eac <sys_getenvid>
+  8002e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002e7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002ea:	c1 e0 06             	shl    $0x6,%eax
+  8002ed:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f2:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8002f7:	85 db                	test   %ebx,%ebx
+  8002f9:	7e 07                	jle    800302 <libmain+0x30>
+		binaryname = argv[0];
+  8002fb:	8b 06                	mov    (%esi),%eax
+  8002fd:	a3 04 70 80 00       	mov    %eax,0x807004
+
+	// call user main routine
+	umain(argc, argv);
+  800302:	83 ec 08             	sub    $0x8,%esp
+  800305:	56                   	push   %esi
+  800306:	53                   	push   %ebx
+  800307:	e8 27 fd ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80030c:	e8 0a 00 00 00       	call   80031b <exit>
+}
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800317:	5b                   	pop    %ebx
+  800318:	5e                   	pop    %esi
+  800319:	5d                   	pop    %ebp
+  80031a:	c3                   	ret
+
+0080031b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800321:	e8 de 18 00 00       	call   801c04 <close_all>
+	sys_env_destroy(0);
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	6a 00                	push   $0x0
+  80032b:	e8 3b 0b 00 00       	call   800e6b <sys_env_destroy>
+}
+  800330:	83 c4 10             	add    $0x10,%esp
+  800333:	c9                   	leave
+  800334:	c3                   	ret
+
+00800335 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800335:	55                   	push   %ebp
+  800336:	89 e5                	mov    %esp,%ebp
+  800338:	56                   	push   %esi
+  800339:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80033a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80033d:	8b 35 04 70 80 00    	mov    0x807004,%esi
+  800343:	e8 64 0b 00 00       	call   800eac <sys_getenvid>
+  800348:	83 ec 0c             	sub    $0xc,%esp
+  80034b:	ff 75 0c             	push   0xc(%ebp)
+  80034e:	ff 75 08             	push   0x8(%ebp)
+  800351:	56                   	push   %esi
+  800352:	50                   	push   %eax
+  800353:	68 78 56 80 00       	push   $0x805678
+  800358:	e8 b3 00 00 00       	call   800410 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80035d:	83 c4 18             	add    $0x18,%esp
+  800360:	53                   	push   %ebx
+  800361:	ff 75 10             	push   0x10(%ebp)
+  800364:	e8 56 00 00 00       	call   8003bf <vcprintf>
+	cprintf("\n");
+  800369:	c7 04 24 37 5c 80 00 	movl   $0x805c37,(%esp)
+  800370:	e8 9b 00 00 00       	call   800410 <cprintf>
+  800375:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800378:	cc                   	int3
+	while (1)
+  800379:	eb fd                	jmp    800378 <_panic+0x43>
+
+0080037b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80037b:	55                   	push   %ebp
+  80037c:	89 e5                	mov    %esp,%ebp
+  80037e:	53                   	push   %ebx
+  80037f:	83 ec 04             	sub    $0x4,%esp
+  800382:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800385:	8b 13                	mov    (%ebx),%edx
+  800387:	8d 42 01             	lea    0x1(%edx),%eax
+  80038a:	89 03                	mov    %eax,(%ebx)
+  80038c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80038f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800393:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800398:	74 09                	je     8003a3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80039a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80039e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003a1:	c9                   	leave
+  8003a2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8003a3:	83 ec 08             	sub    $0x8,%esp
+  8003a6:	68 ff 00 00 00       	push   $0xff
+  8003ab:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003ae:	50                   	push   %eax
+  8003af:	e8 69 0a 00 00       	call   800e1d <sys_cputs>
+		b->idx = 0;
+  8003b4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	eb db                	jmp    80039a <putch+0x1f>
+
+008003bf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003bf:	55                   	push   %ebp
+  8003c0:	89 e5                	mov    %esp,%ebp
+  8003c2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8003c8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003cf:	00 00 00 
+	b.cnt = 0;
+  8003d2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8003dc:	ff 75 0c             	push   0xc(%ebp)
+  8003df:	ff 75 08             	push   0x8(%ebp)
+  8003e2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e8:	50                   	push   %eax
+  8003e9:	68 7b 03 80 00       	push   $0x80037b
+  8003ee:	e8 14 01 00 00       	call   800507 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8003f3:	83 c4 08             	add    $0x8,%esp
+  8003f6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003fc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800402:	50                   	push   %eax
+  800403:	e8 15 0a 00 00       	call   800e1d <sys_cputs>
+
+	return b.cnt;
+}
+  800408:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80040e:	c9                   	leave
+  80040f:	c3                   	ret
+
+00800410 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+  800413:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800416:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800419:	50                   	push   %eax
+  80041a:	ff 75 08             	push   0x8(%ebp)
+  80041d:	e8 9d ff ff ff       	call   8003bf <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800422:	c9                   	leave
+  800423:	c3                   	ret
+
+00800424 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800424:	55                   	push   %ebp
+  800425:	89 e5                	mov    %esp,%ebp
+  800427:	57                   	push   %edi
+  800428:	56                   	push   %esi
+  800429:	53                   	push   %ebx
+  80042a:	83 ec 1c             	sub    $0x1c,%esp
+  80042d:	89 c7                	mov    %eax,%edi
+  80042f:	89 d6                	mov    %edx,%esi
+  800431:	8b 45 08             	mov    0x8(%ebp),%eax
+  800434:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800437:	89 d1                	mov    %edx,%ecx
+  800439:	89 c2                	mov    %eax,%edx
+  80043b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80043e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800441:	8b 45 10             	mov    0x10(%ebp),%eax
+  800444:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800447:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800451:	39 c2                	cmp    %eax,%edx
+  800453:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800456:	72 3e                	jb     800496 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800458:	83 ec 0c             	sub    $0xc,%esp
+  80045b:	ff 75 18             	push   0x18(%ebp)
+  80045e:	83 eb 01             	sub    $0x1,%ebx
+  800461:	53                   	push   %ebx
+  800462:	50                   	push   %eax
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	ff 75 e4             	push   -0x1c(%ebp)
+  800469:	ff 75 e0             	push   -0x20(%ebp)
+  80046c:	ff 75 dc             	push   -0x24(%ebp)
+  80046f:	ff 75 d8             	push   -0x28(%ebp)
+  800472:	e8 6e 4f 00 00       	call   8053e5 <__udivdi3>
+  800477:	83 c4 18             	add    $0x18,%esp
+  80047a:	52                   	push   %edx
+  80047b:	50                   	push   %eax
+  80047c:	89 f2                	mov    %esi,%edx
+  80047e:	89 f8                	mov    %edi,%eax
+  800480:	e8 9f ff ff ff       	call   800424 <printnum>
+  800485:	83 c4 20             	add    $0x20,%esp
+  800488:	eb 13                	jmp    80049d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80048a:	83 ec 08             	sub    $0x8,%esp
+  80048d:	56                   	push   %esi
+  80048e:	ff 75 18             	push   0x18(%ebp)
+  800491:	ff d7                	call   *%edi
+  800493:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800496:	83 eb 01             	sub    $0x1,%ebx
+  800499:	85 db                	test   %ebx,%ebx
+  80049b:	7f ed                	jg     80048a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	56                   	push   %esi
+  8004a1:	83 ec 04             	sub    $0x4,%esp
+  8004a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a7:	ff 75 e0             	push   -0x20(%ebp)
+  8004aa:	ff 75 dc             	push   -0x24(%ebp)
+  8004ad:	ff 75 d8             	push   -0x28(%ebp)
+  8004b0:	e8 4e 4f 00 00       	call   805403 <__umoddi3>
+  8004b5:	83 c4 14             	add    $0x14,%esp
+  8004b8:	0f be 80 9b 56 80 00 	movsbl 0x80569b(%eax),%eax
+  8004bf:	50                   	push   %eax
+  8004c0:	ff d7                	call   *%edi
+}
+  8004c2:	83 c4 10             	add    $0x10,%esp
+  8004c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c8:	5b                   	pop    %ebx
+  8004c9:	5e                   	pop    %esi
+  8004ca:	5f                   	pop    %edi
+  8004cb:	5d                   	pop    %ebp
+  8004cc:	c3                   	ret
+
+008004cd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004cd:	55                   	push   %ebp
+  8004ce:	89 e5                	mov    %esp,%ebp
+  8004d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8004d3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8004d7:	8b 10                	mov    (%eax),%edx
+  8004d9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004dc:	73 0a                	jae    8004e8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8004de:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004e1:	89 08                	mov    %ecx,(%eax)
+  8004e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e6:	88 02                	mov    %al,(%edx)
+}
+  8004e8:	5d                   	pop    %ebp
+  8004e9:	c3                   	ret
+
+008004ea <printfmt>:
+{
+  8004ea:	55                   	push   %ebp
+  8004eb:	89 e5                	mov    %esp,%ebp
+  8004ed:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8004f0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8004f3:	50                   	push   %eax
+  8004f4:	ff 75 10             	push   0x10(%ebp)
+  8004f7:	ff 75 0c             	push   0xc(%ebp)
+  8004fa:	ff 75 08             	push   0x8(%ebp)
+  8004fd:	e8 05 00 00 00       	call   800507 <vprintfmt>
+}
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	c9                   	leave
+  800506:	c3                   	ret
+
+00800507 <vprintfmt>:
+{
+  800507:	55                   	push   %ebp
+  800508:	89 e5                	mov    %esp,%ebp
+  80050a:	57                   	push   %edi
+  80050b:	56                   	push   %esi
+  80050c:	53                   	push   %ebx
+  80050d:	83 ec 2c             	sub    $0x2c,%esp
+  800510:	8b 75 08             	mov    0x8(%ebp),%esi
+  800513:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800516:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800519:	eb 0a                	jmp    800525 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80051b:	83 ec 08             	sub    $0x8,%esp
+  80051e:	53                   	push   %ebx
+  80051f:	50                   	push   %eax
+  800520:	ff d6                	call   *%esi
+  800522:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800525:	83 c7 01             	add    $0x1,%edi
+  800528:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80052c:	83 f8 25             	cmp    $0x25,%eax
+  80052f:	74 0c                	je     80053d <vprintfmt+0x36>
+			if (ch == '\0')
+  800531:	85 c0                	test   %eax,%eax
+  800533:	75 e6                	jne    80051b <vprintfmt+0x14>
+}
+  800535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800538:	5b                   	pop    %ebx
+  800539:	5e                   	pop    %esi
+  80053a:	5f                   	pop    %edi
+  80053b:	5d                   	pop    %ebp
+  80053c:	c3                   	ret
+		padc = ' ';
+  80053d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800541:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800548:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80054f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800556:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80055b:	8d 47 01             	lea    0x1(%edi),%eax
+  80055e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800561:	0f b6 17             	movzbl (%edi),%edx
+  800564:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800567:	3c 55                	cmp    $0x55,%al
+  800569:	0f 87 c5 03 00 00    	ja     800934 <vprintfmt+0x42d>
+  80056f:	0f b6 c0             	movzbl %al,%eax
+  800572:	ff 24 85 20 58 80 00 	jmp    *0x805820(,%eax,4)
+  800579:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80057c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800580:	eb d9                	jmp    80055b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800582:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800585:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800589:	eb d0                	jmp    80055b <vprintfmt+0x54>
+  80058b:	0f b6 d2             	movzbl %dl,%edx
+  80058e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800591:	b8 00 00 00 00       	mov    $0x0,%eax
+  800596:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800599:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80059c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8005a0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8005a3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005a6:	83 f9 09             	cmp    $0x9,%ecx
+  8005a9:	77 55                	ja     800600 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8005ab:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8005ae:	eb e9                	jmp    800599 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8b 00                	mov    (%eax),%eax
+  8005b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005be:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8005c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c8:	79 91                	jns    80055b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8005ca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005d7:	eb 82                	jmp    80055b <vprintfmt+0x54>
+			if (width < 0)
+  8005d9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005dc:	85 d2                	test   %edx,%edx
+  8005de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e3:	0f 49 c2             	cmovns %edx,%eax
+  8005e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8005e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8005ec:	e9 6a ff ff ff       	jmp    80055b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8005f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8005f4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8005fb:	e9 5b ff ff ff       	jmp    80055b <vprintfmt+0x54>
+  800600:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800603:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800606:	eb bc                	jmp    8005c4 <vprintfmt+0xbd>
+			lflag++;
+  800608:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80060b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80060e:	e9 48 ff ff ff       	jmp    80055b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8d 78 04             	lea    0x4(%eax),%edi
+  800619:	83 ec 08             	sub    $0x8,%esp
+  80061c:	53                   	push   %ebx
+  80061d:	ff 30                	push   (%eax)
+  80061f:	ff d6                	call   *%esi
+			break;
+  800621:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800624:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800627:	e9 63 02 00 00       	jmp    80088f <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800632:	8b 10                	mov    (%eax),%edx
+  800634:	89 d0                	mov    %edx,%eax
+  800636:	f7 d8                	neg    %eax
+  800638:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80063b:	83 f8 12             	cmp    $0x12,%eax
+  80063e:	7f 23                	jg     800663 <vprintfmt+0x15c>
+  800640:	8b 14 85 80 59 80 00 	mov    0x805980(,%eax,4),%edx
+  800647:	85 d2                	test   %edx,%edx
+  800649:	74 18                	je     800663 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80064b:	52                   	push   %edx
+  80064c:	68 ad 5b 80 00       	push   $0x805bad
+  800651:	53                   	push   %ebx
+  800652:	56                   	push   %esi
+  800653:	e8 92 fe ff ff       	call   8004ea <printfmt>
+  800658:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80065b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80065e:	e9 2c 02 00 00       	jmp    80088f <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800663:	50                   	push   %eax
+  800664:	68 b3 56 80 00       	push   $0x8056b3
+  800669:	53                   	push   %ebx
+  80066a:	56                   	push   %esi
+  80066b:	e8 7a fe ff ff       	call   8004ea <printfmt>
+  800670:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800673:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800676:	e9 14 02 00 00       	jmp    80088f <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	83 c0 04             	add    $0x4,%eax
+  800681:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800689:	85 c9                	test   %ecx,%ecx
+  80068b:	b8 ac 56 80 00       	mov    $0x8056ac,%eax
+  800690:	0f 45 c1             	cmovne %ecx,%eax
+  800693:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800696:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80069a:	7e 06                	jle    8006a2 <vprintfmt+0x19b>
+  80069c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006a0:	75 0b                	jne    8006ad <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006a2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006a5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006a8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006ab:	eb 5c                	jmp    800709 <vprintfmt+0x202>
+  8006ad:	83 ec 08             	sub    $0x8,%esp
+  8006b0:	ff 75 d0             	push   -0x30(%ebp)
+  8006b3:	ff 75 cc             	push   -0x34(%ebp)
+  8006b6:	e8 19 03 00 00       	call   8009d4 <strnlen>
+  8006bb:	89 c2                	mov    %eax,%edx
+  8006bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c0:	29 d0                	sub    %edx,%eax
+  8006c2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8006c5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006cc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006cf:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006d1:	eb 0e                	jmp    8006e1 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8006d3:	83 ec 08             	sub    $0x8,%esp
+  8006d6:	53                   	push   %ebx
+  8006d7:	57                   	push   %edi
+  8006d8:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8006db:	83 ee 01             	sub    $0x1,%esi
+  8006de:	83 c4 10             	add    $0x10,%esp
+  8006e1:	85 f6                	test   %esi,%esi
+  8006e3:	7f ee                	jg     8006d3 <vprintfmt+0x1cc>
+  8006e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006eb:	85 c0                	test   %eax,%eax
+  8006ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f2:	0f 49 d0             	cmovns %eax,%edx
+  8006f5:	29 d0                	sub    %edx,%eax
+  8006f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006fa:	eb a6                	jmp    8006a2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8006fc:	83 ec 08             	sub    $0x8,%esp
+  8006ff:	53                   	push   %ebx
+  800700:	52                   	push   %edx
+  800701:	ff 55 08             	call   *0x8(%ebp)
+  800704:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800707:	89 f1                	mov    %esi,%ecx
+  800709:	8d 71 01             	lea    0x1(%ecx),%esi
+  80070c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800710:	0f be d0             	movsbl %al,%edx
+  800713:	85 d2                	test   %edx,%edx
+  800715:	74 28                	je     80073f <vprintfmt+0x238>
+  800717:	85 ff                	test   %edi,%edi
+  800719:	78 05                	js     800720 <vprintfmt+0x219>
+  80071b:	83 ef 01             	sub    $0x1,%edi
+  80071e:	78 30                	js     800750 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800720:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800724:	74 d6                	je     8006fc <vprintfmt+0x1f5>
+  800726:	0f be c0             	movsbl %al,%eax
+  800729:	83 e8 20             	sub    $0x20,%eax
+  80072c:	83 f8 5e             	cmp    $0x5e,%eax
+  80072f:	76 cb                	jbe    8006fc <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800731:	83 ec 08             	sub    $0x8,%esp
+  800734:	53                   	push   %ebx
+  800735:	6a 3f                	push   $0x3f
+  800737:	ff 55 08             	call   *0x8(%ebp)
+  80073a:	83 c4 10             	add    $0x10,%esp
+  80073d:	eb c8                	jmp    800707 <vprintfmt+0x200>
+  80073f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800742:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800745:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800748:	01 d0                	add    %edx,%eax
+  80074a:	29 c8                	sub    %ecx,%eax
+  80074c:	89 c7                	mov    %eax,%edi
+  80074e:	eb 13                	jmp    800763 <vprintfmt+0x25c>
+  800750:	8b 75 08             	mov    0x8(%ebp),%esi
+  800753:	eb ed                	jmp    800742 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800755:	83 ec 08             	sub    $0x8,%esp
+  800758:	53                   	push   %ebx
+  800759:	6a 20                	push   $0x20
+  80075b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80075d:	83 ef 01             	sub    $0x1,%edi
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	85 ff                	test   %edi,%edi
+  800765:	7f ee                	jg     800755 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800767:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80076a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076d:	e9 1d 01 00 00       	jmp    80088f <vprintfmt+0x388>
+	if (lflag >= 2)
+  800772:	83 f9 01             	cmp    $0x1,%ecx
+  800775:	7f 1b                	jg     800792 <vprintfmt+0x28b>
+	else if (lflag)
+  800777:	85 c9                	test   %ecx,%ecx
+  800779:	74 63                	je     8007de <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  80077b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077e:	8b 00                	mov    (%eax),%eax
+  800780:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800783:	99                   	cltd
+  800784:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800787:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078a:	8d 40 04             	lea    0x4(%eax),%eax
+  80078d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800790:	eb 17                	jmp    8007a9 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800792:	8b 45 14             	mov    0x14(%ebp),%eax
+  800795:	8b 50 04             	mov    0x4(%eax),%edx
+  800798:	8b 00                	mov    (%eax),%eax
+  80079a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80079d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8007a9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ac:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8007af:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8007b4:	85 c9                	test   %ecx,%ecx
+  8007b6:	0f 89 b9 00 00 00    	jns    800875 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8007bc:	83 ec 08             	sub    $0x8,%esp
+  8007bf:	53                   	push   %ebx
+  8007c0:	6a 2d                	push   $0x2d
+  8007c2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8007c4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007c7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ca:	f7 da                	neg    %edx
+  8007cc:	83 d1 00             	adc    $0x0,%ecx
+  8007cf:	f7 d9                	neg    %ecx
+  8007d1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8007d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007d9:	e9 97 00 00 00       	jmp    800875 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8007de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e1:	8b 00                	mov    (%eax),%eax
+  8007e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007e6:	99                   	cltd
+  8007e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f3:	eb b4                	jmp    8007a9 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8007f5:	83 f9 01             	cmp    $0x1,%ecx
+  8007f8:	7f 1b                	jg     800815 <vprintfmt+0x30e>
+	else if (lflag)
+  8007fa:	85 c9                	test   %ecx,%ecx
+  8007fc:	74 2c                	je     80082a <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8007fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800801:	8b 10                	mov    (%eax),%edx
+  800803:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800808:	8d 40 04             	lea    0x4(%eax),%eax
+  80080b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80080e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800813:	eb 60                	jmp    800875 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800815:	8b 45 14             	mov    0x14(%ebp),%eax
+  800818:	8b 10                	mov    (%eax),%edx
+  80081a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081d:	8d 40 08             	lea    0x8(%eax),%eax
+  800820:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800823:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800828:	eb 4b                	jmp    800875 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80082a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082d:	8b 10                	mov    (%eax),%edx
+  80082f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800834:	8d 40 04             	lea    0x4(%eax),%eax
+  800837:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80083a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80083f:	eb 34                	jmp    800875 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800841:	83 f9 01             	cmp    $0x1,%ecx
+  800844:	7f 15                	jg     80085b <vprintfmt+0x354>
+	else if (lflag)
+  800846:	85 c9                	test   %ecx,%ecx
+  800848:	74 4d                	je     800897 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  80084a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084d:	8b 00                	mov    (%eax),%eax
+  80084f:	99                   	cltd
+  800850:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800853:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800856:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800859:	eb 11                	jmp    80086c <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  80085b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085e:	8b 50 04             	mov    0x4(%eax),%edx
+  800861:	8b 00                	mov    (%eax),%eax
+  800863:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800866:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800869:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  80086c:	89 d1                	mov    %edx,%ecx
+  80086e:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800870:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800875:	83 ec 0c             	sub    $0xc,%esp
+  800878:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80087c:	50                   	push   %eax
+  80087d:	ff 75 e0             	push   -0x20(%ebp)
+  800880:	57                   	push   %edi
+  800881:	51                   	push   %ecx
+  800882:	52                   	push   %edx
+  800883:	89 da                	mov    %ebx,%edx
+  800885:	89 f0                	mov    %esi,%eax
+  800887:	e8 98 fb ff ff       	call   800424 <printnum>
+			break;
+  80088c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80088f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800892:	e9 8e fc ff ff       	jmp    800525 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800897:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089a:	8b 00                	mov    (%eax),%eax
+  80089c:	99                   	cltd
+  80089d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8008a0:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8008a3:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8008a6:	eb c4                	jmp    80086c <vprintfmt+0x365>
+			putch('0', putdat);
+  8008a8:	83 ec 08             	sub    $0x8,%esp
+  8008ab:	53                   	push   %ebx
+  8008ac:	6a 30                	push   $0x30
+  8008ae:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8008b0:	83 c4 08             	add    $0x8,%esp
+  8008b3:	53                   	push   %ebx
+  8008b4:	6a 78                	push   $0x78
+  8008b6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8008b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bb:	8b 10                	mov    (%eax),%edx
+  8008bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8008c2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8008c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008cb:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8008d0:	eb a3                	jmp    800875 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8008d2:	83 f9 01             	cmp    $0x1,%ecx
+  8008d5:	7f 1b                	jg     8008f2 <vprintfmt+0x3eb>
+	else if (lflag)
+  8008d7:	85 c9                	test   %ecx,%ecx
+  8008d9:	74 2f                	je     80090a <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8008db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008de:	8b 10                	mov    (%eax),%edx
+  8008e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8008eb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8008f0:	eb 83                	jmp    800875 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8008f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f5:	8b 10                	mov    (%eax),%edx
+  8008f7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8008fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800900:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800905:	e9 6b ff ff ff       	jmp    800875 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80090a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090d:	8b 10                	mov    (%eax),%edx
+  80090f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800914:	8d 40 04             	lea    0x4(%eax),%eax
+  800917:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80091a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80091f:	e9 51 ff ff ff       	jmp    800875 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800924:	83 ec 08             	sub    $0x8,%esp
+  800927:	53                   	push   %ebx
+  800928:	6a 25                	push   $0x25
+  80092a:	ff d6                	call   *%esi
+			break;
+  80092c:	83 c4 10             	add    $0x10,%esp
+  80092f:	e9 5b ff ff ff       	jmp    80088f <vprintfmt+0x388>
+			putch('%', putdat);
+  800934:	83 ec 08             	sub    $0x8,%esp
+  800937:	53                   	push   %ebx
+  800938:	6a 25                	push   $0x25
+  80093a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80093c:	83 c4 10             	add    $0x10,%esp
+  80093f:	89 f8                	mov    %edi,%eax
+  800941:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800945:	74 05                	je     80094c <vprintfmt+0x445>
+  800947:	83 e8 01             	sub    $0x1,%eax
+  80094a:	eb f5                	jmp    800941 <vprintfmt+0x43a>
+  80094c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80094f:	e9 3b ff ff ff       	jmp    80088f <vprintfmt+0x388>
+
+00800954 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800954:	55                   	push   %ebp
+  800955:	89 e5                	mov    %esp,%ebp
+  800957:	83 ec 18             	sub    $0x18,%esp
+  80095a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800960:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800963:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800967:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80096a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800971:	85 c0                	test   %eax,%eax
+  800973:	74 26                	je     80099b <vsnprintf+0x47>
+  800975:	85 d2                	test   %edx,%edx
+  800977:	7e 22                	jle    80099b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800979:	ff 75 14             	push   0x14(%ebp)
+  80097c:	ff 75 10             	push   0x10(%ebp)
+  80097f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800982:	50                   	push   %eax
+  800983:	68 cd 04 80 00       	push   $0x8004cd
+  800988:	e8 7a fb ff ff       	call   800507 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80098d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800990:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800993:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800996:	83 c4 10             	add    $0x10,%esp
+}
+  800999:	c9                   	leave
+  80099a:	c3                   	ret
+		return -E_INVAL;
+  80099b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a0:	eb f7                	jmp    800999 <vsnprintf+0x45>
+
+008009a2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8009a8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8009ab:	50                   	push   %eax
+  8009ac:	ff 75 10             	push   0x10(%ebp)
+  8009af:	ff 75 0c             	push   0xc(%ebp)
+  8009b2:	ff 75 08             	push   0x8(%ebp)
+  8009b5:	e8 9a ff ff ff       	call   800954 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8009ba:	c9                   	leave
+  8009bb:	c3                   	ret
+
+008009bc <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009bc:	55                   	push   %ebp
+  8009bd:	89 e5                	mov    %esp,%ebp
+  8009bf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8009c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c7:	eb 03                	jmp    8009cc <strlen+0x10>
+		n++;
+  8009c9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8009cc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009d0:	75 f7                	jne    8009c9 <strlen+0xd>
+	return n;
+}
+  8009d2:	5d                   	pop    %ebp
+  8009d3:	c3                   	ret
+
+008009d4 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e2:	eb 03                	jmp    8009e7 <strnlen+0x13>
+		n++;
+  8009e4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009e7:	39 d0                	cmp    %edx,%eax
+  8009e9:	74 08                	je     8009f3 <strnlen+0x1f>
+  8009eb:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009ef:	75 f3                	jne    8009e4 <strnlen+0x10>
+  8009f1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8009f3:	89 d0                	mov    %edx,%eax
+  8009f5:	5d                   	pop    %ebp
+  8009f6:	c3                   	ret
+
+008009f7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009f7:	55                   	push   %ebp
+  8009f8:	89 e5                	mov    %esp,%ebp
+  8009fa:	53                   	push   %ebx
+  8009fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a06:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a0a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a0d:	83 c0 01             	add    $0x1,%eax
+  800a10:	84 d2                	test   %dl,%dl
+  800a12:	75 f2                	jne    800a06 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800a14:	89 c8                	mov    %ecx,%eax
+  800a16:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a19:	c9                   	leave
+  800a1a:	c3                   	ret
+
+00800a1b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a1b:	55                   	push   %ebp
+  800a1c:	89 e5                	mov    %esp,%ebp
+  800a1e:	53                   	push   %ebx
+  800a1f:	83 ec 10             	sub    $0x10,%esp
+  800a22:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800a25:	53                   	push   %ebx
+  800a26:	e8 91 ff ff ff       	call   8009bc <strlen>
+  800a2b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800a2e:	ff 75 0c             	push   0xc(%ebp)
+  800a31:	01 d8                	add    %ebx,%eax
+  800a33:	50                   	push   %eax
+  800a34:	e8 be ff ff ff       	call   8009f7 <strcpy>
+	return dst;
+}
+  800a39:	89 d8                	mov    %ebx,%eax
+  800a3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a3e:	c9                   	leave
+  800a3f:	c3                   	ret
+
+00800a40 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800a40:	55                   	push   %ebp
+  800a41:	89 e5                	mov    %esp,%ebp
+  800a43:	56                   	push   %esi
+  800a44:	53                   	push   %ebx
+  800a45:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a48:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800a4b:	89 f3                	mov    %esi,%ebx
+  800a4d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a50:	89 f0                	mov    %esi,%eax
+  800a52:	eb 0f                	jmp    800a63 <strncpy+0x23>
+		*dst++ = *src;
+  800a54:	83 c0 01             	add    $0x1,%eax
+  800a57:	0f b6 0a             	movzbl (%edx),%ecx
+  800a5a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800a5d:	80 f9 01             	cmp    $0x1,%cl
+  800a60:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800a63:	39 d8                	cmp    %ebx,%eax
+  800a65:	75 ed                	jne    800a54 <strncpy+0x14>
+	}
+	return ret;
+}
+  800a67:	89 f0                	mov    %esi,%eax
+  800a69:	5b                   	pop    %ebx
+  800a6a:	5e                   	pop    %esi
+  800a6b:	5d                   	pop    %ebp
+  800a6c:	c3                   	ret
+
+00800a6d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a6d:	55                   	push   %ebp
+  800a6e:	89 e5                	mov    %esp,%ebp
+  800a70:	56                   	push   %esi
+  800a71:	53                   	push   %ebx
+  800a72:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a78:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800a7b:	89 f0                	mov    %esi,%eax
+  800a7d:	85 d2                	test   %edx,%edx
+  800a7f:	74 21                	je     800aa2 <strlcpy+0x35>
+  800a81:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a85:	89 f2                	mov    %esi,%edx
+  800a87:	eb 09                	jmp    800a92 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800a89:	83 c1 01             	add    $0x1,%ecx
+  800a8c:	83 c2 01             	add    $0x1,%edx
+  800a8f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800a92:	39 c2                	cmp    %eax,%edx
+  800a94:	74 09                	je     800a9f <strlcpy+0x32>
+  800a96:	0f b6 19             	movzbl (%ecx),%ebx
+  800a99:	84 db                	test   %bl,%bl
+  800a9b:	75 ec                	jne    800a89 <strlcpy+0x1c>
+  800a9d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800a9f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800aa2:	29 f0                	sub    %esi,%eax
+}
+  800aa4:	5b                   	pop    %ebx
+  800aa5:	5e                   	pop    %esi
+  800aa6:	5d                   	pop    %ebp
+  800aa7:	c3                   	ret
+
+00800aa8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800ab1:	eb 06                	jmp    800ab9 <strcmp+0x11>
+		p++, q++;
+  800ab3:	83 c1 01             	add    $0x1,%ecx
+  800ab6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800ab9:	0f b6 01             	movzbl (%ecx),%eax
+  800abc:	84 c0                	test   %al,%al
+  800abe:	74 04                	je     800ac4 <strcmp+0x1c>
+  800ac0:	3a 02                	cmp    (%edx),%al
+  800ac2:	74 ef                	je     800ab3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ac4:	0f b6 c0             	movzbl %al,%eax
+  800ac7:	0f b6 12             	movzbl (%edx),%edx
+  800aca:	29 d0                	sub    %edx,%eax
+}
+  800acc:	5d                   	pop    %ebp
+  800acd:	c3                   	ret
+
+00800ace <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	53                   	push   %ebx
+  800ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad8:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800adb:	eb 09                	jmp    800ae6 <strncmp+0x18>
+		n--, p++, q++;
+  800add:	83 ea 01             	sub    $0x1,%edx
+  800ae0:	83 c0 01             	add    $0x1,%eax
+  800ae3:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ae6:	85 d2                	test   %edx,%edx
+  800ae8:	74 18                	je     800b02 <strncmp+0x34>
+  800aea:	0f b6 18             	movzbl (%eax),%ebx
+  800aed:	84 db                	test   %bl,%bl
+  800aef:	74 04                	je     800af5 <strncmp+0x27>
+  800af1:	3a 19                	cmp    (%ecx),%bl
+  800af3:	74 e8                	je     800add <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800af5:	0f b6 00             	movzbl (%eax),%eax
+  800af8:	0f b6 11             	movzbl (%ecx),%edx
+  800afb:	29 d0                	sub    %edx,%eax
+}
+  800afd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b00:	c9                   	leave
+  800b01:	c3                   	ret
+		return 0;
+  800b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b07:	eb f4                	jmp    800afd <strncmp+0x2f>
+
+00800b09 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b09:	55                   	push   %ebp
+  800b0a:	89 e5                	mov    %esp,%ebp
+  800b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b13:	eb 03                	jmp    800b18 <strchr+0xf>
+  800b15:	83 c0 01             	add    $0x1,%eax
+  800b18:	0f b6 10             	movzbl (%eax),%edx
+  800b1b:	84 d2                	test   %dl,%dl
+  800b1d:	74 06                	je     800b25 <strchr+0x1c>
+		if (*s == c)
+  800b1f:	38 ca                	cmp    %cl,%dl
+  800b21:	75 f2                	jne    800b15 <strchr+0xc>
+  800b23:	eb 05                	jmp    800b2a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b2a:	5d                   	pop    %ebp
+  800b2b:	c3                   	ret
+
+00800b2c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b2c:	55                   	push   %ebp
+  800b2d:	89 e5                	mov    %esp,%ebp
+  800b2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b32:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800b36:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800b39:	38 ca                	cmp    %cl,%dl
+  800b3b:	74 09                	je     800b46 <strfind+0x1a>
+  800b3d:	84 d2                	test   %dl,%dl
+  800b3f:	74 05                	je     800b46 <strfind+0x1a>
+	for (; *s; s++)
+  800b41:	83 c0 01             	add    $0x1,%eax
+  800b44:	eb f0                	jmp    800b36 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800b46:	5d                   	pop    %ebp
+  800b47:	c3                   	ret
+
+00800b48 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b48:	55                   	push   %ebp
+  800b49:	89 e5                	mov    %esp,%ebp
+  800b4b:	57                   	push   %edi
+  800b4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b4f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800b52:	85 c9                	test   %ecx,%ecx
+  800b54:	74 20                	je     800b76 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800b56:	89 f8                	mov    %edi,%eax
+  800b58:	09 c8                	or     %ecx,%eax
+  800b5a:	a8 03                	test   $0x3,%al
+  800b5c:	75 12                	jne    800b70 <memset+0x28>
+		c &= 0xFF;
+  800b5e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b62:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800b68:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800b6b:	fc                   	cld
+  800b6c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b6e:	eb 06                	jmp    800b76 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800b70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b73:	fc                   	cld
+  800b74:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800b76:	89 f8                	mov    %edi,%eax
+  800b78:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b7b:	c9                   	leave
+  800b7c:	c3                   	ret
+
+00800b7d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	57                   	push   %edi
+  800b81:	56                   	push   %esi
+  800b82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b85:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b88:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800b8b:	39 c6                	cmp    %eax,%esi
+  800b8d:	73 32                	jae    800bc1 <memmove+0x44>
+  800b8f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b92:	39 d0                	cmp    %edx,%eax
+  800b94:	73 2b                	jae    800bc1 <memmove+0x44>
+		s += n;
+		d += n;
+  800b96:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b99:	89 d6                	mov    %edx,%esi
+  800b9b:	09 fe                	or     %edi,%esi
+  800b9d:	09 ce                	or     %ecx,%esi
+  800b9f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ba5:	75 0e                	jne    800bb5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ba7:	83 ef 04             	sub    $0x4,%edi
+  800baa:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bad:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800bb0:	fd                   	std
+  800bb1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bb3:	eb 09                	jmp    800bbe <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bb5:	83 ef 01             	sub    $0x1,%edi
+  800bb8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800bbb:	fd                   	std
+  800bbc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800bbe:	fc                   	cld
+  800bbf:	eb 1a                	jmp    800bdb <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bc1:	89 f2                	mov    %esi,%edx
+  800bc3:	09 c2                	or     %eax,%edx
+  800bc5:	09 ca                	or     %ecx,%edx
+  800bc7:	f6 c2 03             	test   $0x3,%dl
+  800bca:	75 0a                	jne    800bd6 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bcc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800bcf:	89 c7                	mov    %eax,%edi
+  800bd1:	fc                   	cld
+  800bd2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bd4:	eb 05                	jmp    800bdb <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800bd6:	89 c7                	mov    %eax,%edi
+  800bd8:	fc                   	cld
+  800bd9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800bdb:	5e                   	pop    %esi
+  800bdc:	5f                   	pop    %edi
+  800bdd:	5d                   	pop    %ebp
+  800bde:	c3                   	ret
+
+00800bdf <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bdf:	55                   	push   %ebp
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800be5:	ff 75 10             	push   0x10(%ebp)
+  800be8:	ff 75 0c             	push   0xc(%ebp)
+  800beb:	ff 75 08             	push   0x8(%ebp)
+  800bee:	e8 8a ff ff ff       	call   800b7d <memmove>
+}
+  800bf3:	c9                   	leave
+  800bf4:	c3                   	ret
+
+00800bf5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bf5:	55                   	push   %ebp
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	56                   	push   %esi
+  800bf9:	53                   	push   %ebx
+  800bfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bfd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800c00:	89 c6                	mov    %eax,%esi
+  800c02:	03 75 10             	add    0x10(%ebp),%esi
+  800c05:	eb 06                	jmp    800c0d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800c07:	83 c0 01             	add    $0x1,%eax
+  800c0a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800c0d:	39 f0                	cmp    %esi,%eax
+  800c0f:	74 14                	je     800c25 <memcmp+0x30>
+		if (*s1 != *s2)
+  800c11:	0f b6 08             	movzbl (%eax),%ecx
+  800c14:	0f b6 1a             	movzbl (%edx),%ebx
+  800c17:	38 d9                	cmp    %bl,%cl
+  800c19:	74 ec                	je     800c07 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800c1b:	0f b6 c1             	movzbl %cl,%eax
+  800c1e:	0f b6 db             	movzbl %bl,%ebx
+  800c21:	29 d8                	sub    %ebx,%eax
+  800c23:	eb 05                	jmp    800c2a <memcmp+0x35>
+	}
+
+	return 0;
+  800c25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c2a:	5b                   	pop    %ebx
+  800c2b:	5e                   	pop    %esi
+  800c2c:	5d                   	pop    %ebp
+  800c2d:	c3                   	ret
+
+00800c2e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c2e:	55                   	push   %ebp
+  800c2f:	89 e5                	mov    %esp,%ebp
+  800c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800c37:	89 c2                	mov    %eax,%edx
+  800c39:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800c3c:	eb 03                	jmp    800c41 <memfind+0x13>
+  800c3e:	83 c0 01             	add    $0x1,%eax
+  800c41:	39 d0                	cmp    %edx,%eax
+  800c43:	73 04                	jae    800c49 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800c45:	38 08                	cmp    %cl,(%eax)
+  800c47:	75 f5                	jne    800c3e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800c49:	5d                   	pop    %ebp
+  800c4a:	c3                   	ret
+
+00800c4b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	57                   	push   %edi
+  800c4f:	56                   	push   %esi
+  800c50:	53                   	push   %ebx
+  800c51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800c57:	eb 03                	jmp    800c5c <strtol+0x11>
+		s++;
+  800c59:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800c5c:	0f b6 02             	movzbl (%edx),%eax
+  800c5f:	3c 20                	cmp    $0x20,%al
+  800c61:	74 f6                	je     800c59 <strtol+0xe>
+  800c63:	3c 09                	cmp    $0x9,%al
+  800c65:	74 f2                	je     800c59 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c67:	3c 2b                	cmp    $0x2b,%al
+  800c69:	74 2a                	je     800c95 <strtol+0x4a>
+	int neg = 0;
+  800c6b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800c70:	3c 2d                	cmp    $0x2d,%al
+  800c72:	74 2b                	je     800c9f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c74:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c7a:	75 0f                	jne    800c8b <strtol+0x40>
+  800c7c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c7f:	74 28                	je     800ca9 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c81:	85 db                	test   %ebx,%ebx
+  800c83:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c88:	0f 44 d8             	cmove  %eax,%ebx
+  800c8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c90:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c93:	eb 46                	jmp    800cdb <strtol+0x90>
+		s++;
+  800c95:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800c98:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c9d:	eb d5                	jmp    800c74 <strtol+0x29>
+		s++, neg = 1;
+  800c9f:	83 c2 01             	add    $0x1,%edx
+  800ca2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ca7:	eb cb                	jmp    800c74 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ca9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cad:	74 0e                	je     800cbd <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800caf:	85 db                	test   %ebx,%ebx
+  800cb1:	75 d8                	jne    800c8b <strtol+0x40>
+		s++, base = 8;
+  800cb3:	83 c2 01             	add    $0x1,%edx
+  800cb6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cbb:	eb ce                	jmp    800c8b <strtol+0x40>
+		s += 2, base = 16;
+  800cbd:	83 c2 02             	add    $0x2,%edx
+  800cc0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cc5:	eb c4                	jmp    800c8b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cc7:	0f be c0             	movsbl %al,%eax
+  800cca:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800ccd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cd0:	7d 3a                	jge    800d0c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800cd2:	83 c2 01             	add    $0x1,%edx
+  800cd5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cd9:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800cdb:	0f b6 02             	movzbl (%edx),%eax
+  800cde:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ce1:	89 f3                	mov    %esi,%ebx
+  800ce3:	80 fb 09             	cmp    $0x9,%bl
+  800ce6:	76 df                	jbe    800cc7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ce8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ceb:	89 f3                	mov    %esi,%ebx
+  800ced:	80 fb 19             	cmp    $0x19,%bl
+  800cf0:	77 08                	ja     800cfa <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800cf2:	0f be c0             	movsbl %al,%eax
+  800cf5:	83 e8 57             	sub    $0x57,%eax
+  800cf8:	eb d3                	jmp    800ccd <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cfa:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cfd:	89 f3                	mov    %esi,%ebx
+  800cff:	80 fb 19             	cmp    $0x19,%bl
+  800d02:	77 08                	ja     800d0c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800d04:	0f be c0             	movsbl %al,%eax
+  800d07:	83 e8 37             	sub    $0x37,%eax
+  800d0a:	eb c1                	jmp    800ccd <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800d0c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d10:	74 05                	je     800d17 <strtol+0xcc>
+		*endptr = (char *) s;
+  800d12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d15:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800d17:	89 c8                	mov    %ecx,%eax
+  800d19:	f7 d8                	neg    %eax
+  800d1b:	85 ff                	test   %edi,%edi
+  800d1d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d20:	89 c8                	mov    %ecx,%eax
+  800d22:	5b                   	pop    %ebx
+  800d23:	5e                   	pop    %esi
+  800d24:	5f                   	pop    %edi
+  800d25:	5d                   	pop    %ebp
+  800d26:	c3                   	ret
+
+00800d27 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	57                   	push   %edi
+  800d2b:	56                   	push   %esi
+  800d2c:	53                   	push   %ebx
+  800d2d:	83 ec 0c             	sub    $0xc,%esp
+  800d30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800d33:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d36:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800d39:	85 ff                	test   %edi,%edi
+  800d3b:	74 16                	je     800d53 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800d3d:	83 ec 04             	sub    $0x4,%esp
+  800d40:	56                   	push   %esi
+  800d41:	6a 00                	push   $0x0
+  800d43:	53                   	push   %ebx
+  800d44:	e8 02 ff ff ff       	call   800c4b <strtol>
+  800d49:	89 07                	mov    %eax,(%edi)
+  800d4b:	83 c4 10             	add    $0x10,%esp
+  800d4e:	eb 03                	jmp    800d53 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800d50:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800d53:	0f b6 03             	movzbl (%ebx),%eax
+  800d56:	3c 20                	cmp    $0x20,%al
+  800d58:	74 f6                	je     800d50 <strisl+0x29>
+  800d5a:	3c 09                	cmp    $0x9,%al
+  800d5c:	74 f2                	je     800d50 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800d5e:	3c 2b                	cmp    $0x2b,%al
+  800d60:	74 23                	je     800d85 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800d62:	3c 2d                	cmp    $0x2d,%al
+  800d64:	0f 94 c0             	sete   %al
+  800d67:	0f b6 c0             	movzbl %al,%eax
+  800d6a:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d6c:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800d72:	75 41                	jne    800db5 <strisl+0x8e>
+  800d74:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800d77:	74 11                	je     800d8a <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800d79:	85 f6                	test   %esi,%esi
+  800d7b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d80:	0f 44 f0             	cmove  %eax,%esi
+  800d83:	eb 30                	jmp    800db5 <strisl+0x8e>
+		s++;
+  800d85:	83 c3 01             	add    $0x1,%ebx
+  800d88:	eb e2                	jmp    800d6c <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d8a:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800d8e:	74 0e                	je     800d9e <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800d90:	85 f6                	test   %esi,%esi
+  800d92:	75 21                	jne    800db5 <strisl+0x8e>
+		s++, base = 8;
+  800d94:	83 c3 01             	add    $0x1,%ebx
+  800d97:	be 08 00 00 00       	mov    $0x8,%esi
+  800d9c:	eb 17                	jmp    800db5 <strisl+0x8e>
+		s += 2, base = 16;
+  800d9e:	83 c3 02             	add    $0x2,%ebx
+  800da1:	be 10 00 00 00       	mov    $0x10,%esi
+  800da6:	eb 0d                	jmp    800db5 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800da8:	0f be c0             	movsbl %al,%eax
+  800dab:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800dae:	39 f0                	cmp    %esi,%eax
+  800db0:	7d 38                	jge    800dea <strisl+0xc3>
+			return 0;
+		s++;
+  800db2:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800db5:	0f b6 03             	movzbl (%ebx),%eax
+  800db8:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800dbb:	80 fa 09             	cmp    $0x9,%dl
+  800dbe:	76 e8                	jbe    800da8 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800dc0:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800dc3:	80 fa 19             	cmp    $0x19,%dl
+  800dc6:	77 08                	ja     800dd0 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800dc8:	0f be c0             	movsbl %al,%eax
+  800dcb:	83 e8 57             	sub    $0x57,%eax
+  800dce:	eb de                	jmp    800dae <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800dd0:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800dd3:	80 fa 19             	cmp    $0x19,%dl
+  800dd6:	77 08                	ja     800de0 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800dd8:	0f be c0             	movsbl %al,%eax
+  800ddb:	83 e8 37             	sub    $0x37,%eax
+  800dde:	eb ce                	jmp    800dae <strisl+0x87>
+		else if (!*s)
+  800de0:	84 c0                	test   %al,%al
+  800de2:	0f 94 c0             	sete   %al
+  800de5:	0f b6 c0             	movzbl %al,%eax
+  800de8:	eb 05                	jmp    800def <strisl+0xc8>
+			return 0;
+  800dea:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df2:	5b                   	pop    %ebx
+  800df3:	5e                   	pop    %esi
+  800df4:	5f                   	pop    %edi
+  800df5:	5d                   	pop    %ebp
+  800df6:	c3                   	ret
+
+00800df7 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	83 ec 10             	sub    $0x10,%esp
+  800dfd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800e00:	89 c8                	mov    %ecx,%eax
+  800e02:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800e07:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800e0a:	eb 0b                	jmp    800e17 <touch_mem+0x20>
+		c = *(char *)page;
+  800e0c:	0f b6 10             	movzbl (%eax),%edx
+  800e0f:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800e12:	05 00 10 00 00       	add    $0x1000,%eax
+  800e17:	39 c8                	cmp    %ecx,%eax
+  800e19:	72 f1                	jb     800e0c <touch_mem+0x15>
+}
+  800e1b:	c9                   	leave
+  800e1c:	c3                   	ret
+
+00800e1d <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e1d:	55                   	push   %ebp
+  800e1e:	89 e5                	mov    %esp,%ebp
+  800e20:	57                   	push   %edi
+  800e21:	56                   	push   %esi
+  800e22:	53                   	push   %ebx
+	touch_mem(s, len);
+  800e23:	ff 75 0c             	push   0xc(%ebp)
+  800e26:	ff 75 08             	push   0x8(%ebp)
+  800e29:	e8 c9 ff ff ff       	call   800df7 <touch_mem>
+	asm volatile("int %1\n"
+  800e2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e39:	89 c3                	mov    %eax,%ebx
+  800e3b:	89 c7                	mov    %eax,%edi
+  800e3d:	89 c6                	mov    %eax,%esi
+  800e3f:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e41:	83 c4 08             	add    $0x8,%esp
+  800e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+
+00800e4c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e4c:	55                   	push   %ebp
+  800e4d:	89 e5                	mov    %esp,%ebp
+  800e4f:	57                   	push   %edi
+  800e50:	56                   	push   %esi
+  800e51:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e5c:	89 d1                	mov    %edx,%ecx
+  800e5e:	89 d3                	mov    %edx,%ebx
+  800e60:	89 d7                	mov    %edx,%edi
+  800e62:	89 d6                	mov    %edx,%esi
+  800e64:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e66:	5b                   	pop    %ebx
+  800e67:	5e                   	pop    %esi
+  800e68:	5f                   	pop    %edi
+  800e69:	5d                   	pop    %ebp
+  800e6a:	c3                   	ret
+
+00800e6b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e6b:	55                   	push   %ebp
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	57                   	push   %edi
+  800e6f:	56                   	push   %esi
+  800e70:	53                   	push   %ebx
+  800e71:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e81:	89 cb                	mov    %ecx,%ebx
+  800e83:	89 cf                	mov    %ecx,%edi
+  800e85:	89 ce                	mov    %ecx,%esi
+  800e87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e89:	85 c0                	test   %eax,%eax
+  800e8b:	7f 08                	jg     800e95 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e90:	5b                   	pop    %ebx
+  800e91:	5e                   	pop    %esi
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+  800e98:	50                   	push   %eax
+  800e99:	6a 03                	push   $0x3
+  800e9b:	68 eb 59 80 00       	push   $0x8059eb
+  800ea0:	6a 23                	push   $0x23
+  800ea2:	68 08 5a 80 00       	push   $0x805a08
+  800ea7:	e8 89 f4 ff ff       	call   800335 <_panic>
+
+00800eac <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ebc:	89 d1                	mov    %edx,%ecx
+  800ebe:	89 d3                	mov    %edx,%ebx
+  800ec0:	89 d7                	mov    %edx,%edi
+  800ec2:	89 d6                	mov    %edx,%esi
+  800ec4:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ec6:	5b                   	pop    %ebx
+  800ec7:	5e                   	pop    %esi
+  800ec8:	5f                   	pop    %edi
+  800ec9:	5d                   	pop    %ebp
+  800eca:	c3                   	ret
+
+00800ecb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	57                   	push   %edi
+  800ecf:	56                   	push   %esi
+  800ed0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ed1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800edb:	89 d1                	mov    %edx,%ecx
+  800edd:	89 d3                	mov    %edx,%ebx
+  800edf:	89 d7                	mov    %edx,%edi
+  800ee1:	89 d6                	mov    %edx,%esi
+  800ee3:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ee5:	5b                   	pop    %ebx
+  800ee6:	5e                   	pop    %esi
+  800ee7:	5f                   	pop    %edi
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	c3                   	ret
+
+00800eea <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+  800eed:	57                   	push   %edi
+  800eee:	56                   	push   %esi
+  800eef:	53                   	push   %ebx
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ef3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efe:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f06:	89 f7                	mov    %esi,%edi
+  800f08:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f0a:	85 c0                	test   %eax,%eax
+  800f0c:	7f 08                	jg     800f16 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800f0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f11:	5b                   	pop    %ebx
+  800f12:	5e                   	pop    %esi
+  800f13:	5f                   	pop    %edi
+  800f14:	5d                   	pop    %ebp
+  800f15:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f16:	83 ec 0c             	sub    $0xc,%esp
+  800f19:	50                   	push   %eax
+  800f1a:	6a 04                	push   $0x4
+  800f1c:	68 eb 59 80 00       	push   $0x8059eb
+  800f21:	6a 23                	push   $0x23
+  800f23:	68 08 5a 80 00       	push   $0x805a08
+  800f28:	e8 08 f4 ff ff       	call   800335 <_panic>
+
+00800f2d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	57                   	push   %edi
+  800f31:	56                   	push   %esi
+  800f32:	53                   	push   %ebx
+  800f33:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f44:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f47:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f4a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f4c:	85 c0                	test   %eax,%eax
+  800f4e:	7f 08                	jg     800f58 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f53:	5b                   	pop    %ebx
+  800f54:	5e                   	pop    %esi
+  800f55:	5f                   	pop    %edi
+  800f56:	5d                   	pop    %ebp
+  800f57:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f58:	83 ec 0c             	sub    $0xc,%esp
+  800f5b:	50                   	push   %eax
+  800f5c:	6a 05                	push   $0x5
+  800f5e:	68 eb 59 80 00       	push   $0x8059eb
+  800f63:	6a 23                	push   $0x23
+  800f65:	68 08 5a 80 00       	push   $0x805a08
+  800f6a:	e8 c6 f3 ff ff       	call   800335 <_panic>
+
+00800f6f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f6f:	55                   	push   %ebp
+  800f70:	89 e5                	mov    %esp,%ebp
+  800f72:	57                   	push   %edi
+  800f73:	56                   	push   %esi
+  800f74:	53                   	push   %ebx
+  800f75:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f83:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f88:	89 df                	mov    %ebx,%edi
+  800f8a:	89 de                	mov    %ebx,%esi
+  800f8c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f8e:	85 c0                	test   %eax,%eax
+  800f90:	7f 08                	jg     800f9a <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800f92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f95:	5b                   	pop    %ebx
+  800f96:	5e                   	pop    %esi
+  800f97:	5f                   	pop    %edi
+  800f98:	5d                   	pop    %ebp
+  800f99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f9a:	83 ec 0c             	sub    $0xc,%esp
+  800f9d:	50                   	push   %eax
+  800f9e:	6a 06                	push   $0x6
+  800fa0:	68 eb 59 80 00       	push   $0x8059eb
+  800fa5:	6a 23                	push   $0x23
+  800fa7:	68 08 5a 80 00       	push   $0x805a08
+  800fac:	e8 84 f3 ff ff       	call   800335 <_panic>
+
+00800fb1 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800fb1:	55                   	push   %ebp
+  800fb2:	89 e5                	mov    %esp,%ebp
+  800fb4:	57                   	push   %edi
+  800fb5:	56                   	push   %esi
+  800fb6:	53                   	push   %ebx
+  800fb7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc5:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fca:	89 df                	mov    %ebx,%edi
+  800fcc:	89 de                	mov    %ebx,%esi
+  800fce:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fd0:	85 c0                	test   %eax,%eax
+  800fd2:	7f 08                	jg     800fdc <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800fd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd7:	5b                   	pop    %ebx
+  800fd8:	5e                   	pop    %esi
+  800fd9:	5f                   	pop    %edi
+  800fda:	5d                   	pop    %ebp
+  800fdb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fdc:	83 ec 0c             	sub    $0xc,%esp
+  800fdf:	50                   	push   %eax
+  800fe0:	6a 18                	push   $0x18
+  800fe2:	68 eb 59 80 00       	push   $0x8059eb
+  800fe7:	6a 23                	push   $0x23
+  800fe9:	68 08 5a 80 00       	push   $0x805a08
+  800fee:	e8 42 f3 ff ff       	call   800335 <_panic>
+
+00800ff3 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800ff3:	55                   	push   %ebp
+  800ff4:	89 e5                	mov    %esp,%ebp
+  800ff6:	57                   	push   %edi
+  800ff7:	56                   	push   %esi
+  800ff8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ff9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801001:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801004:	b8 19 00 00 00       	mov    $0x19,%eax
+  801009:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100c:	89 f7                	mov    %esi,%edi
+  80100e:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  801010:	5b                   	pop    %ebx
+  801011:	5e                   	pop    %esi
+  801012:	5f                   	pop    %edi
+  801013:	5d                   	pop    %ebp
+  801014:	c3                   	ret
+
+00801015 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	57                   	push   %edi
+  801019:	56                   	push   %esi
+  80101a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80101b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801021:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801026:	be 00 00 00 00       	mov    $0x0,%esi
+  80102b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801031:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  801033:	5b                   	pop    %ebx
+  801034:	5e                   	pop    %esi
+  801035:	5f                   	pop    %edi
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+
+00801038 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	57                   	push   %edi
+  80103c:	56                   	push   %esi
+  80103d:	53                   	push   %ebx
+  80103e:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  801041:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801044:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80104a:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  80104d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801050:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801053:	b8 10 00 00 00       	mov    $0x10,%eax
+  801058:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80105b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80105e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801060:	85 c0                	test   %eax,%eax
+  801062:	7f 08                	jg     80106c <sys_page_map_range+0x34>
+}
+  801064:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801067:	5b                   	pop    %ebx
+  801068:	5e                   	pop    %esi
+  801069:	5f                   	pop    %edi
+  80106a:	5d                   	pop    %ebp
+  80106b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106c:	83 ec 0c             	sub    $0xc,%esp
+  80106f:	50                   	push   %eax
+  801070:	6a 10                	push   $0x10
+  801072:	68 eb 59 80 00       	push   $0x8059eb
+  801077:	6a 23                	push   $0x23
+  801079:	68 08 5a 80 00       	push   $0x805a08
+  80107e:	e8 b2 f2 ff ff       	call   800335 <_panic>
+
+00801083 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	57                   	push   %edi
+  801087:	56                   	push   %esi
+  801088:	53                   	push   %ebx
+  801089:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80108c:	be 00 00 00 00       	mov    $0x0,%esi
+  801091:	8b 55 08             	mov    0x8(%ebp),%edx
+  801094:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801097:	b8 11 00 00 00       	mov    $0x11,%eax
+  80109c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109f:	89 f7                	mov    %esi,%edi
+  8010a1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a3:	85 c0                	test   %eax,%eax
+  8010a5:	7f 08                	jg     8010af <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8010a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010af:	83 ec 0c             	sub    $0xc,%esp
+  8010b2:	50                   	push   %eax
+  8010b3:	6a 11                	push   $0x11
+  8010b5:	68 eb 59 80 00       	push   $0x8059eb
+  8010ba:	6a 23                	push   $0x23
+  8010bc:	68 08 5a 80 00       	push   $0x805a08
+  8010c1:	e8 6f f2 ff ff       	call   800335 <_panic>
+
+008010c6 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	56                   	push   %esi
+  8010cb:	53                   	push   %ebx
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8010d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010da:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  8010df:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010e2:	89 f7                	mov    %esi,%edi
+  8010e4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010e6:	85 c0                	test   %eax,%eax
+  8010e8:	7f 08                	jg     8010f2 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  8010ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ed:	5b                   	pop    %ebx
+  8010ee:	5e                   	pop    %esi
+  8010ef:	5f                   	pop    %edi
+  8010f0:	5d                   	pop    %ebp
+  8010f1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010f2:	83 ec 0c             	sub    $0xc,%esp
+  8010f5:	50                   	push   %eax
+  8010f6:	6a 1b                	push   $0x1b
+  8010f8:	68 eb 59 80 00       	push   $0x8059eb
+  8010fd:	6a 23                	push   $0x23
+  8010ff:	68 08 5a 80 00       	push   $0x805a08
+  801104:	e8 2c f2 ff ff       	call   800335 <_panic>
+
+00801109 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80110f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801114:	b8 12 00 00 00       	mov    $0x12,%eax
+  801119:	89 d1                	mov    %edx,%ecx
+  80111b:	89 d3                	mov    %edx,%ebx
+  80111d:	89 d7                	mov    %edx,%edi
+  80111f:	89 d6                	mov    %edx,%esi
+  801121:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801123:	5b                   	pop    %ebx
+  801124:	5e                   	pop    %esi
+  801125:	5f                   	pop    %edi
+  801126:	5d                   	pop    %ebp
+  801127:	c3                   	ret
+
+00801128 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  80112b:	57                   	push   %edi
+  80112c:	56                   	push   %esi
+  80112d:	53                   	push   %ebx
+  80112e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801131:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801136:	8b 55 08             	mov    0x8(%ebp),%edx
+  801139:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801141:	89 df                	mov    %ebx,%edi
+  801143:	89 de                	mov    %ebx,%esi
+  801145:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801147:	85 c0                	test   %eax,%eax
+  801149:	7f 08                	jg     801153 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80114b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114e:	5b                   	pop    %ebx
+  80114f:	5e                   	pop    %esi
+  801150:	5f                   	pop    %edi
+  801151:	5d                   	pop    %ebp
+  801152:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801153:	83 ec 0c             	sub    $0xc,%esp
+  801156:	50                   	push   %eax
+  801157:	6a 08                	push   $0x8
+  801159:	68 eb 59 80 00       	push   $0x8059eb
+  80115e:	6a 23                	push   $0x23
+  801160:	68 08 5a 80 00       	push   $0x805a08
+  801165:	e8 cb f1 ff ff       	call   800335 <_panic>
+
+0080116a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	57                   	push   %edi
+  80116e:	56                   	push   %esi
+  80116f:	53                   	push   %ebx
+  801170:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  801173:	6a 44                	push   $0x44
+  801175:	ff 75 0c             	push   0xc(%ebp)
+  801178:	e8 7a fc ff ff       	call   800df7 <touch_mem>
+	asm volatile("int %1\n"
+  80117d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801182:	8b 55 08             	mov    0x8(%ebp),%edx
+  801185:	b8 09 00 00 00       	mov    $0x9,%eax
+  80118a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118d:	89 df                	mov    %ebx,%edi
+  80118f:	89 de                	mov    %ebx,%esi
+  801191:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801193:	83 c4 08             	add    $0x8,%esp
+  801196:	85 c0                	test   %eax,%eax
+  801198:	7f 08                	jg     8011a2 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80119a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80119d:	5b                   	pop    %ebx
+  80119e:	5e                   	pop    %esi
+  80119f:	5f                   	pop    %edi
+  8011a0:	5d                   	pop    %ebp
+  8011a1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011a2:	83 ec 0c             	sub    $0xc,%esp
+  8011a5:	50                   	push   %eax
+  8011a6:	6a 09                	push   $0x9
+  8011a8:	68 eb 59 80 00       	push   $0x8059eb
+  8011ad:	6a 23                	push   $0x23
+  8011af:	68 08 5a 80 00       	push   $0x805a08
+  8011b4:	e8 7c f1 ff ff       	call   800335 <_panic>
+
+008011b9 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	57                   	push   %edi
+  8011bd:	56                   	push   %esi
+  8011be:	53                   	push   %ebx
+  8011bf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011cd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8011d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d5:	89 f7                	mov    %esi,%edi
+  8011d7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011d9:	85 c0                	test   %eax,%eax
+  8011db:	7f 08                	jg     8011e5 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8011dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e0:	5b                   	pop    %ebx
+  8011e1:	5e                   	pop    %esi
+  8011e2:	5f                   	pop    %edi
+  8011e3:	5d                   	pop    %ebp
+  8011e4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011e5:	83 ec 0c             	sub    $0xc,%esp
+  8011e8:	50                   	push   %eax
+  8011e9:	6a 1a                	push   $0x1a
+  8011eb:	68 eb 59 80 00       	push   $0x8059eb
+  8011f0:	6a 23                	push   $0x23
+  8011f2:	68 08 5a 80 00       	push   $0x805a08
+  8011f7:	e8 39 f1 ff ff       	call   800335 <_panic>
+
+008011fc <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	57                   	push   %edi
+  801200:	56                   	push   %esi
+  801201:	53                   	push   %ebx
+  801202:	83 ec 0c             	sub    $0xc,%esp
+  801205:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801208:	89 d8                	mov    %ebx,%eax
+  80120a:	c1 e0 05             	shl    $0x5,%eax
+  80120d:	50                   	push   %eax
+  80120e:	ff 75 0c             	push   0xc(%ebp)
+  801211:	e8 e1 fb ff ff       	call   800df7 <touch_mem>
+	asm volatile("int %1\n"
+  801216:	be 00 00 00 00       	mov    $0x0,%esi
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801223:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801226:	89 f7                	mov    %esi,%edi
+  801228:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80122a:	83 c4 08             	add    $0x8,%esp
+  80122d:	85 c0                	test   %eax,%eax
+  80122f:	7f 08                	jg     801239 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801231:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801234:	5b                   	pop    %ebx
+  801235:	5e                   	pop    %esi
+  801236:	5f                   	pop    %edi
+  801237:	5d                   	pop    %ebp
+  801238:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801239:	83 ec 0c             	sub    $0xc,%esp
+  80123c:	50                   	push   %eax
+  80123d:	6a 13                	push   $0x13
+  80123f:	68 eb 59 80 00       	push   $0x8059eb
+  801244:	6a 23                	push   $0x23
+  801246:	68 08 5a 80 00       	push   $0x805a08
+  80124b:	e8 e5 f0 ff ff       	call   800335 <_panic>
+
+00801250 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801250:	55                   	push   %ebp
+  801251:	89 e5                	mov    %esp,%ebp
+  801253:	57                   	push   %edi
+  801254:	56                   	push   %esi
+  801255:	53                   	push   %ebx
+  801256:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801259:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801261:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801264:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801269:	89 df                	mov    %ebx,%edi
+  80126b:	89 de                	mov    %ebx,%esi
+  80126d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80126f:	85 c0                	test   %eax,%eax
+  801271:	7f 08                	jg     80127b <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801276:	5b                   	pop    %ebx
+  801277:	5e                   	pop    %esi
+  801278:	5f                   	pop    %edi
+  801279:	5d                   	pop    %ebp
+  80127a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80127b:	83 ec 0c             	sub    $0xc,%esp
+  80127e:	50                   	push   %eax
+  80127f:	6a 0a                	push   $0xa
+  801281:	68 eb 59 80 00       	push   $0x8059eb
+  801286:	6a 23                	push   $0x23
+  801288:	68 08 5a 80 00       	push   $0x805a08
+  80128d:	e8 a3 f0 ff ff       	call   800335 <_panic>
+
+00801292 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801292:	55                   	push   %ebp
+  801293:	89 e5                	mov    %esp,%ebp
+  801295:	57                   	push   %edi
+  801296:	56                   	push   %esi
+  801297:	53                   	push   %ebx
+  801298:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80129b:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8012a1:	76 1d                	jbe    8012c0 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8012a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8012b3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b6:	cd 30                	int    $0x30
+}
+  8012b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bb:	5b                   	pop    %ebx
+  8012bc:	5e                   	pop    %esi
+  8012bd:	5f                   	pop    %edi
+  8012be:	5d                   	pop    %ebp
+  8012bf:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8012c0:	68 00 10 00 00       	push   $0x1000
+  8012c5:	53                   	push   %ebx
+  8012c6:	e8 2c fb ff ff       	call   800df7 <touch_mem>
+  8012cb:	83 c4 08             	add    $0x8,%esp
+  8012ce:	eb d3                	jmp    8012a3 <sys_ipc_send+0x11>
+
+008012d0 <sys_ipc_send_pages>:
+{
+  8012d0:	55                   	push   %ebp
+  8012d1:	89 e5                	mov    %esp,%ebp
+  8012d3:	57                   	push   %edi
+  8012d4:	56                   	push   %esi
+  8012d5:	53                   	push   %ebx
+  8012d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d9:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8012dc:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8012e2:	76 18                	jbe    8012fc <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8012e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ea:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012ef:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8012f2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8012f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f7:	5b                   	pop    %ebx
+  8012f8:	5e                   	pop    %esi
+  8012f9:	5f                   	pop    %edi
+  8012fa:	5d                   	pop    %ebp
+  8012fb:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8012fc:	89 f0                	mov    %esi,%eax
+  8012fe:	c1 e0 0c             	shl    $0xc,%eax
+  801301:	50                   	push   %eax
+  801302:	53                   	push   %ebx
+  801303:	e8 ef fa ff ff       	call   800df7 <touch_mem>
+  801308:	83 c4 08             	add    $0x8,%esp
+  80130b:	eb d7                	jmp    8012e4 <sys_ipc_send_pages+0x14>
+
+0080130d <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80130d:	55                   	push   %ebp
+  80130e:	89 e5                	mov    %esp,%ebp
+  801310:	57                   	push   %edi
+  801311:	56                   	push   %esi
+  801312:	53                   	push   %ebx
+  801313:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801316:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80131b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801321:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801326:	89 df                	mov    %ebx,%edi
+  801328:	89 de                	mov    %ebx,%esi
+  80132a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80132c:	85 c0                	test   %eax,%eax
+  80132e:	7f 08                	jg     801338 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801330:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801333:	5b                   	pop    %ebx
+  801334:	5e                   	pop    %esi
+  801335:	5f                   	pop    %edi
+  801336:	5d                   	pop    %ebp
+  801337:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801338:	83 ec 0c             	sub    $0xc,%esp
+  80133b:	50                   	push   %eax
+  80133c:	6a 0d                	push   $0xd
+  80133e:	68 eb 59 80 00       	push   $0x8059eb
+  801343:	6a 23                	push   $0x23
+  801345:	68 08 5a 80 00       	push   $0x805a08
+  80134a:	e8 e6 ef ff ff       	call   800335 <_panic>
+
+0080134f <sys_ipc_recv>:
+{
+  80134f:	55                   	push   %ebp
+  801350:	89 e5                	mov    %esp,%ebp
+  801352:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801355:	6a 01                	push   $0x1
+  801357:	ff 75 08             	push   0x8(%ebp)
+  80135a:	e8 ae ff ff ff       	call   80130d <sys_ipc_recv_pages>
+}
+  80135f:	c9                   	leave
+  801360:	c3                   	ret
+
+00801361 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801361:	55                   	push   %ebp
+  801362:	89 e5                	mov    %esp,%ebp
+  801364:	57                   	push   %edi
+  801365:	56                   	push   %esi
+  801366:	53                   	push   %ebx
+  801367:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80136d:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801370:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801376:	77 04                	ja     80137c <sys_ipc_call+0x1b>
+  801378:	85 f6                	test   %esi,%esi
+  80137a:	75 15                	jne    801391 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80137c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801382:	b8 14 00 00 00       	mov    $0x14,%eax
+  801387:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801389:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80138c:	5b                   	pop    %ebx
+  80138d:	5e                   	pop    %esi
+  80138e:	5f                   	pop    %edi
+  80138f:	5d                   	pop    %ebp
+  801390:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801391:	89 f8                	mov    %edi,%eax
+  801393:	c1 e0 0c             	shl    $0xc,%eax
+  801396:	50                   	push   %eax
+  801397:	53                   	push   %ebx
+  801398:	e8 5a fa ff ff       	call   800df7 <touch_mem>
+  80139d:	83 c4 08             	add    $0x8,%esp
+  8013a0:	eb da                	jmp    80137c <sys_ipc_call+0x1b>
+
+008013a2 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8013a2:	55                   	push   %ebp
+  8013a3:	89 e5                	mov    %esp,%ebp
+  8013a5:	57                   	push   %edi
+  8013a6:	56                   	push   %esi
+  8013a7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8013a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013ae:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013b9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013bc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8013be:	5b                   	pop    %ebx
+  8013bf:	5e                   	pop    %esi
+  8013c0:	5f                   	pop    %edi
+  8013c1:	5d                   	pop    %ebp
+  8013c2:	c3                   	ret
+
+008013c3 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8013c3:	55                   	push   %ebp
+  8013c4:	89 e5                	mov    %esp,%ebp
+  8013c6:	57                   	push   %edi
+  8013c7:	56                   	push   %esi
+  8013c8:	53                   	push   %ebx
+  8013c9:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8013cc:	6a 04                	push   $0x4
+  8013ce:	ff 75 08             	push   0x8(%ebp)
+  8013d1:	e8 21 fa ff ff       	call   800df7 <touch_mem>
+	asm volatile("int %1\n"
+  8013d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8013db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013de:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013e9:	89 f7                	mov    %esi,%edi
+  8013eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013ed:	83 c4 08             	add    $0x8,%esp
+  8013f0:	85 c0                	test   %eax,%eax
+  8013f2:	7f 08                	jg     8013fc <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8013f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013f7:	5b                   	pop    %ebx
+  8013f8:	5e                   	pop    %esi
+  8013f9:	5f                   	pop    %edi
+  8013fa:	5d                   	pop    %ebp
+  8013fb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013fc:	83 ec 0c             	sub    $0xc,%esp
+  8013ff:	50                   	push   %eax
+  801400:	6a 16                	push   $0x16
+  801402:	68 eb 59 80 00       	push   $0x8059eb
+  801407:	6a 23                	push   $0x23
+  801409:	68 08 5a 80 00       	push   $0x805a08
+  80140e:	e8 22 ef ff ff       	call   800335 <_panic>
+
+00801413 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801413:	55                   	push   %ebp
+  801414:	89 e5                	mov    %esp,%ebp
+  801416:	57                   	push   %edi
+  801417:	56                   	push   %esi
+  801418:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801419:	6a 04                	push   $0x4
+  80141b:	ff 75 08             	push   0x8(%ebp)
+  80141e:	e8 d4 f9 ff ff       	call   800df7 <touch_mem>
+	asm volatile("int %1\n"
+  801423:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801428:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801430:	8b 55 08             	mov    0x8(%ebp),%edx
+  801433:	89 df                	mov    %ebx,%edi
+  801435:	89 de                	mov    %ebx,%esi
+  801437:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143c:	5b                   	pop    %ebx
+  80143d:	5e                   	pop    %esi
+  80143e:	5f                   	pop    %edi
+  80143f:	5d                   	pop    %ebp
+  801440:	c3                   	ret
+
+00801441 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801441:	55                   	push   %ebp
+  801442:	89 e5                	mov    %esp,%ebp
+  801444:	57                   	push   %edi
+  801445:	56                   	push   %esi
+  801446:	53                   	push   %ebx
+  801447:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80144a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801452:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801457:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80145c:	89 df                	mov    %ebx,%edi
+  80145e:	89 de                	mov    %ebx,%esi
+  801460:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801462:	85 c0                	test   %eax,%eax
+  801464:	7f 08                	jg     80146e <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801466:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801469:	5b                   	pop    %ebx
+  80146a:	5e                   	pop    %esi
+  80146b:	5f                   	pop    %edi
+  80146c:	5d                   	pop    %ebp
+  80146d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80146e:	83 ec 0c             	sub    $0xc,%esp
+  801471:	50                   	push   %eax
+  801472:	6a 0e                	push   $0xe
+  801474:	68 eb 59 80 00       	push   $0x8059eb
+  801479:	6a 23                	push   $0x23
+  80147b:	68 08 5a 80 00       	push   $0x805a08
+  801480:	e8 b0 ee ff ff       	call   800335 <_panic>
+
+00801485 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  801485:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80148c:	f6 c6 06             	test   $0x6,%dh
+  80148f:	75 37                	jne    8014c8 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  801491:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801498:	f6 c2 02             	test   $0x2,%dl
+  80149b:	75 19                	jne    8014b6 <dupperm+0x31>
+  80149d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014a4:	f6 c6 08             	test   $0x8,%dh
+  8014a7:	75 0d                	jne    8014b6 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8014a9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014b0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014b5:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8014b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014bd:	25 00 06 00 00       	and    $0x600,%eax
+  8014c2:	0d 05 08 00 00       	or     $0x805,%eax
+  8014c7:	c3                   	ret
+		return 0;
+  8014c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014cd:	c3                   	ret
+
+008014ce <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8014ce:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8014d0:	c1 e0 0c             	shl    $0xc,%eax
+  8014d3:	c1 e8 16             	shr    $0x16,%eax
+  8014d6:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8014dd:	f6 c1 01             	test   $0x1,%cl
+  8014e0:	74 2c                	je     80150e <dupable+0x40>
+  8014e2:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8014e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ee:	f6 c1 04             	test   $0x4,%cl
+  8014f1:	74 20                	je     801513 <dupable+0x45>
+  8014f3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8014fa:	f6 c1 01             	test   $0x1,%cl
+  8014fd:	74 14                	je     801513 <dupable+0x45>
+  8014ff:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801506:	c1 e8 02             	shr    $0x2,%eax
+  801509:	83 e0 01             	and    $0x1,%eax
+  80150c:	eb 05                	jmp    801513 <dupable+0x45>
+  80150e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801513:	83 e0 01             	and    $0x1,%eax
+}
+  801516:	c3                   	ret
+
+00801517 <pgfault>:
+{
+  801517:	55                   	push   %ebp
+  801518:	89 e5                	mov    %esp,%ebp
+  80151a:	56                   	push   %esi
+  80151b:	53                   	push   %ebx
+  80151c:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80151f:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801521:	89 ca                	mov    %ecx,%edx
+  801523:	c1 ea 0c             	shr    $0xc,%edx
+  801526:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80152d:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801531:	0f 84 8e 00 00 00    	je     8015c5 <pgfault+0xae>
+		return 0;
+  801537:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80153c:	f6 c6 08             	test   $0x8,%dh
+  80153f:	0f 84 85 00 00 00    	je     8015ca <pgfault+0xb3>
+	perm |= PTE_W;
+  801545:	81 e2 07 06 00 00    	and    $0x607,%edx
+  80154b:	89 d3                	mov    %edx,%ebx
+  80154d:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801550:	89 ce                	mov    %ecx,%esi
+  801552:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801558:	6a 01                	push   $0x1
+  80155a:	53                   	push   %ebx
+  80155b:	68 00 f0 7f 00       	push   $0x7ff000
+  801560:	6a 00                	push   $0x0
+  801562:	e8 a5 27 00 00       	call   803d0c <page_alloc>
+  801567:	83 c4 10             	add    $0x10,%esp
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	78 33                	js     8015a1 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  80156e:	83 ec 04             	sub    $0x4,%esp
+  801571:	68 00 10 00 00       	push   $0x1000
+  801576:	56                   	push   %esi
+  801577:	68 00 f0 7f 00       	push   $0x7ff000
+  80157c:	e8 fc f5 ff ff       	call   800b7d <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  801581:	89 1c 24             	mov    %ebx,(%esp)
+  801584:	56                   	push   %esi
+  801585:	6a 00                	push   $0x0
+  801587:	68 00 f0 7f 00       	push   $0x7ff000
+  80158c:	6a 00                	push   $0x0
+  80158e:	e8 da 2d 00 00       	call   80436d <page_map>
+  801593:	83 c4 20             	add    $0x20,%esp
+  801596:	85 c0                	test   %eax,%eax
+  801598:	78 19                	js     8015b3 <pgfault+0x9c>
+	return 1;
+  80159a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80159f:	eb 29                	jmp    8015ca <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8015a1:	50                   	push   %eax
+  8015a2:	68 18 5a 80 00       	push   $0x805a18
+  8015a7:	6a 2e                	push   $0x2e
+  8015a9:	68 6b 5a 80 00       	push   $0x805a6b
+  8015ae:	e8 82 ed ff ff       	call   800335 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8015b3:	50                   	push   %eax
+  8015b4:	68 44 5a 80 00       	push   $0x805a44
+  8015b9:	6a 32                	push   $0x32
+  8015bb:	68 6b 5a 80 00       	push   $0x805a6b
+  8015c0:	e8 70 ed ff ff       	call   800335 <_panic>
+		return 0;
+  8015c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015cd:	5b                   	pop    %ebx
+  8015ce:	5e                   	pop    %esi
+  8015cf:	5d                   	pop    %ebp
+  8015d0:	c3                   	ret
+
+008015d1 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8015d1:	55                   	push   %ebp
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	57                   	push   %edi
+  8015d5:	56                   	push   %esi
+  8015d6:	53                   	push   %ebx
+  8015d7:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  8015da:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8015e1:	74 5d                	je     801640 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  8015e3:	83 ec 0c             	sub    $0xc,%esp
+  8015e6:	68 17 15 80 00       	push   $0x801517
+  8015eb:	e8 de 39 00 00       	call   804fce <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  8015f0:	e8 14 fb ff ff       	call   801109 <sys_fork>
+  8015f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8015fe:	74 47                	je     801647 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801600:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801604:	0f 84 c5 03 00 00    	je     8019cf <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  80160a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80160e:	78 25                	js     801635 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801610:	e8 6f 20 00 00       	call   803684 <page_share_paged_out>
+  801615:	85 c0                	test   %eax,%eax
+  801617:	0f 88 d8 03 00 00    	js     8019f5 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80161d:	83 ec 08             	sub    $0x8,%esp
+  801620:	6a 02                	push   $0x2
+  801622:	ff 75 e4             	push   -0x1c(%ebp)
+  801625:	e8 fe fa ff ff       	call   801128 <sys_env_set_status>
+  80162a:	83 c4 10             	add    $0x10,%esp
+  80162d:	85 c0                	test   %eax,%eax
+  80162f:	0f 88 d5 03 00 00    	js     801a0a <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801635:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801638:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163b:	5b                   	pop    %ebx
+  80163c:	5e                   	pop    %esi
+  80163d:	5f                   	pop    %edi
+  80163e:	5d                   	pop    %ebp
+  80163f:	c3                   	ret
+		init_map_dir();
+  801640:	e8 47 23 00 00       	call   80398c <init_map_dir>
+  801645:	eb 9c                	jmp    8015e3 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801647:	b8 07 00 00 00       	mov    $0x7,%eax
+  80164c:	cd 30                	int    $0x30
+  80164e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  801651:	85 c0                	test   %eax,%eax
+  801653:	78 10                	js     801665 <fork+0x94>
+	if (envid == 0)
+  801655:	0f 84 74 03 00 00    	je     8019cf <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  80165b:	be 00 00 00 00       	mov    $0x0,%esi
+  801660:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801663:	eb 30                	jmp    801695 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801665:	50                   	push   %eax
+  801666:	68 76 5a 80 00       	push   $0x805a76
+  80166b:	68 cd 00 00 00       	push   $0xcd
+  801670:	68 6b 5a 80 00       	push   $0x805a6b
+  801675:	e8 bb ec ff ff       	call   800335 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  80167a:	89 f2                	mov    %esi,%edx
+  80167c:	c1 fa 1f             	sar    $0x1f,%edx
+  80167f:	c1 ea 16             	shr    $0x16,%edx
+  801682:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801685:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80168a:	29 d0                	sub    %edx,%eax
+  80168c:	ba 00 04 00 00       	mov    $0x400,%edx
+  801691:	29 c2                	sub    %eax,%edx
+  801693:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801695:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  801698:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  80169e:	0f 87 ff 02 00 00    	ja     8019a3 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  8016a4:	89 f3                	mov    %esi,%ebx
+  8016a6:	c1 e3 0c             	shl    $0xc,%ebx
+  8016a9:	89 d8                	mov    %ebx,%eax
+  8016ab:	c1 e8 16             	shr    $0x16,%eax
+  8016ae:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8016b5:	f6 c2 01             	test   $0x1,%dl
+  8016b8:	74 c0                	je     80167a <fork+0xa9>
+  8016ba:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8016c1:	f6 c2 04             	test   $0x4,%dl
+  8016c4:	74 b4                	je     80167a <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8016c6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016cd:	a8 80                	test   $0x80,%al
+  8016cf:	75 24                	jne    8016f5 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8016d1:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8016d8:	25 81 00 00 00       	and    $0x81,%eax
+  8016dd:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8016e2:	74 21                	je     801705 <fork+0x134>
+		if (!dupable(pn)) {
+  8016e4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016e7:	e8 e2 fd ff ff       	call   8014ce <dupable>
+  8016ec:	84 c0                	test   %al,%al
+  8016ee:	75 1a                	jne    80170a <fork+0x139>
+			++pn;
+  8016f0:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8016f3:	eb a0                	jmp    801695 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  8016f5:	83 ec 08             	sub    $0x8,%esp
+  8016f8:	53                   	push   %ebx
+  8016f9:	6a 00                	push   $0x0
+  8016fb:	e8 b1 f8 ff ff       	call   800fb1 <sys_page_split>
+  801700:	83 c4 10             	add    $0x10,%esp
+  801703:	eb cc                	jmp    8016d1 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  801705:	0f b6 03             	movzbl (%ebx),%eax
+  801708:	eb da                	jmp    8016e4 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  80170a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80170d:	89 f8                	mov    %edi,%eax
+  80170f:	e8 71 fd ff ff       	call   801485 <dupperm>
+  801714:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801717:	85 c0                	test   %eax,%eax
+  801719:	74 16                	je     801731 <fork+0x160>
+  80171b:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801720:	29 f8                	sub    %edi,%eax
+  801722:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801725:	bf 01 00 00 00       	mov    $0x1,%edi
+  80172a:	89 c6                	mov    %eax,%esi
+  80172c:	e9 c4 01 00 00       	jmp    8018f5 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801731:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801734:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80173b:	f6 c4 04             	test   $0x4,%ah
+  80173e:	0f 85 89 00 00 00    	jne    8017cd <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  801744:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801747:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80174e:	f6 c4 02             	test   $0x2,%ah
+  801751:	0f 85 b1 00 00 00    	jne    801808 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801757:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80175a:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801761:	a8 02                	test   $0x2,%al
+  801763:	75 10                	jne    801775 <fork+0x1a4>
+  801765:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80176c:	f6 c4 08             	test   $0x8,%ah
+  80176f:	0f 84 3e 01 00 00    	je     8018b3 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801775:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801778:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80177f:	25 00 06 00 00       	and    $0x600,%eax
+  801784:	0d 05 08 00 00       	or     $0x805,%eax
+  801789:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  80178b:	c1 e1 0c             	shl    $0xc,%ecx
+  80178e:	89 cb                	mov    %ecx,%ebx
+  801790:	83 ec 0c             	sub    $0xc,%esp
+  801793:	50                   	push   %eax
+  801794:	51                   	push   %ecx
+  801795:	ff 75 e4             	push   -0x1c(%ebp)
+  801798:	51                   	push   %ecx
+  801799:	6a 00                	push   $0x0
+  80179b:	e8 cd 2b 00 00       	call   80436d <page_map>
+  8017a0:	83 c4 20             	add    $0x20,%esp
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	0f 88 e4 00 00 00    	js     80188f <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  8017ab:	83 ec 0c             	sub    $0xc,%esp
+  8017ae:	57                   	push   %edi
+  8017af:	53                   	push   %ebx
+  8017b0:	6a 00                	push   $0x0
+  8017b2:	53                   	push   %ebx
+  8017b3:	6a 00                	push   $0x0
+  8017b5:	e8 b3 2b 00 00       	call   80436d <page_map>
+  8017ba:	83 c4 20             	add    $0x20,%esp
+  8017bd:	85 c0                	test   %eax,%eax
+  8017bf:	0f 88 dc 00 00 00    	js     8018a1 <fork+0x2d0>
+			++pn;
+  8017c5:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8017c8:	e9 c8 fe ff ff       	jmp    801695 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8017cd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017d0:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8017d7:	c1 e1 0c             	shl    $0xc,%ecx
+  8017da:	83 ec 0c             	sub    $0xc,%esp
+  8017dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017e2:	50                   	push   %eax
+  8017e3:	51                   	push   %ecx
+  8017e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8017e7:	51                   	push   %ecx
+  8017e8:	6a 00                	push   $0x0
+  8017ea:	e8 7e 2b 00 00       	call   80436d <page_map>
+  8017ef:	83 c4 20             	add    $0x20,%esp
+  8017f2:	85 c0                	test   %eax,%eax
+  8017f4:	79 cf                	jns    8017c5 <fork+0x1f4>
+			panic("page_map %d", r);
+  8017f6:	50                   	push   %eax
+  8017f7:	68 86 5a 80 00       	push   $0x805a86
+  8017fc:	6a 4d                	push   $0x4d
+  8017fe:	68 6b 5a 80 00       	push   $0x805a6b
+  801803:	e8 2d eb ff ff       	call   800335 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  801808:	83 ec 0c             	sub    $0xc,%esp
+  80180b:	68 00 10 00 00       	push   $0x1000
+  801810:	e8 4a 31 00 00       	call   80495f <malloc>
+  801815:	89 c7                	mov    %eax,%edi
+  801817:	83 c4 10             	add    $0x10,%esp
+  80181a:	85 c0                	test   %eax,%eax
+  80181c:	74 4b                	je     801869 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  80181e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801821:	c1 e3 0c             	shl    $0xc,%ebx
+  801824:	83 ec 04             	sub    $0x4,%esp
+  801827:	68 00 10 00 00       	push   $0x1000
+  80182c:	53                   	push   %ebx
+  80182d:	50                   	push   %eax
+  80182e:	e8 ac f3 ff ff       	call   800bdf <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  801833:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801836:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80183d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801842:	89 04 24             	mov    %eax,(%esp)
+  801845:	53                   	push   %ebx
+  801846:	ff 75 e4             	push   -0x1c(%ebp)
+  801849:	57                   	push   %edi
+  80184a:	6a 00                	push   $0x0
+  80184c:	e8 1c 2b 00 00       	call   80436d <page_map>
+  801851:	83 c4 20             	add    $0x20,%esp
+  801854:	85 c0                	test   %eax,%eax
+  801856:	78 25                	js     80187d <fork+0x2ac>
+		free(temp);
+  801858:	83 ec 0c             	sub    $0xc,%esp
+  80185b:	57                   	push   %edi
+  80185c:	e8 fc 2e 00 00       	call   80475d <free>
+  801861:	83 c4 10             	add    $0x10,%esp
+  801864:	e9 5c ff ff ff       	jmp    8017c5 <fork+0x1f4>
+			panic("malloc failed");
+  801869:	83 ec 04             	sub    $0x4,%esp
+  80186c:	68 92 5a 80 00       	push   $0x805a92
+  801871:	6a 56                	push   $0x56
+  801873:	68 6b 5a 80 00       	push   $0x805a6b
+  801878:	e8 b8 ea ff ff       	call   800335 <_panic>
+			panic("page_map: %e", r);
+  80187d:	50                   	push   %eax
+  80187e:	68 a0 5a 80 00       	push   $0x805aa0
+  801883:	6a 59                	push   $0x59
+  801885:	68 6b 5a 80 00       	push   $0x805a6b
+  80188a:	e8 a6 ea ff ff       	call   800335 <_panic>
+			panic("page_map %d", r);
+  80188f:	50                   	push   %eax
+  801890:	68 86 5a 80 00       	push   $0x805a86
+  801895:	6a 65                	push   $0x65
+  801897:	68 6b 5a 80 00       	push   $0x805a6b
+  80189c:	e8 94 ea ff ff       	call   800335 <_panic>
+			panic("page_map %d", r);
+  8018a1:	50                   	push   %eax
+  8018a2:	68 86 5a 80 00       	push   $0x805a86
+  8018a7:	6a 78                	push   $0x78
+  8018a9:	68 6b 5a 80 00       	push   $0x805a6b
+  8018ae:	e8 82 ea ff ff       	call   800335 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8018b3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8018b6:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8018bd:	c1 e1 0c             	shl    $0xc,%ecx
+  8018c0:	83 ec 0c             	sub    $0xc,%esp
+  8018c3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018c8:	50                   	push   %eax
+  8018c9:	51                   	push   %ecx
+  8018ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8018cd:	51                   	push   %ecx
+  8018ce:	6a 00                	push   $0x0
+  8018d0:	e8 98 2a 00 00       	call   80436d <page_map>
+  8018d5:	83 c4 20             	add    $0x20,%esp
+  8018d8:	85 c0                	test   %eax,%eax
+  8018da:	0f 89 e5 fe ff ff    	jns    8017c5 <fork+0x1f4>
+			panic("page_map %d", r);
+  8018e0:	50                   	push   %eax
+  8018e1:	68 86 5a 80 00       	push   $0x805a86
+  8018e6:	6a 7f                	push   $0x7f
+  8018e8:	68 6b 5a 80 00       	push   $0x805a6b
+  8018ed:	e8 43 ea ff ff       	call   800335 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8018f2:	83 c7 01             	add    $0x1,%edi
+  8018f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018f8:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  8018fb:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  8018fe:	39 f7                	cmp    %esi,%edi
+  801900:	74 1c                	je     80191e <fork+0x34d>
+  801902:	89 d8                	mov    %ebx,%eax
+  801904:	e8 c5 fb ff ff       	call   8014ce <dupable>
+  801909:	84 c0                	test   %al,%al
+  80190b:	74 7c                	je     801989 <fork+0x3b8>
+  80190d:	89 d8                	mov    %ebx,%eax
+  80190f:	e8 71 fb ff ff       	call   801485 <dupperm>
+  801914:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801917:	74 d9                	je     8018f2 <fork+0x321>
+  801919:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80191c:	eb 06                	jmp    801924 <fork+0x353>
+  80191e:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801921:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801924:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801927:	c1 e0 0c             	shl    $0xc,%eax
+  80192a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80192d:	83 ec 08             	sub    $0x8,%esp
+  801930:	ff 75 dc             	push   -0x24(%ebp)
+  801933:	57                   	push   %edi
+  801934:	50                   	push   %eax
+  801935:	ff 75 e4             	push   -0x1c(%ebp)
+  801938:	50                   	push   %eax
+  801939:	6a 00                	push   $0x0
+  80193b:	e8 24 2c 00 00       	call   804564 <page_map_range>
+  801940:	83 c4 20             	add    $0x20,%esp
+  801943:	85 c0                	test   %eax,%eax
+  801945:	78 47                	js     80198e <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801947:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  80194e:	0f 84 41 fd ff ff    	je     801695 <fork+0xc4>
+  801954:	83 ec 08             	sub    $0x8,%esp
+  801957:	ff 75 dc             	push   -0x24(%ebp)
+  80195a:	57                   	push   %edi
+  80195b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80195e:	50                   	push   %eax
+  80195f:	6a 00                	push   $0x0
+  801961:	50                   	push   %eax
+  801962:	6a 00                	push   $0x0
+  801964:	e8 fb 2b 00 00       	call   804564 <page_map_range>
+  801969:	83 c4 20             	add    $0x20,%esp
+  80196c:	85 c0                	test   %eax,%eax
+  80196e:	0f 89 21 fd ff ff    	jns    801695 <fork+0xc4>
+		panic("page_map_range %e", r);
+  801974:	50                   	push   %eax
+  801975:	68 ad 5a 80 00       	push   $0x805aad
+  80197a:	68 a2 00 00 00       	push   $0xa2
+  80197f:	68 6b 5a 80 00       	push   $0x805a6b
+  801984:	e8 ac e9 ff ff       	call   800335 <_panic>
+  801989:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80198c:	eb 96                	jmp    801924 <fork+0x353>
+		panic("page_map_range %e", r);
+  80198e:	50                   	push   %eax
+  80198f:	68 ad 5a 80 00       	push   $0x805aad
+  801994:	68 a0 00 00 00       	push   $0xa0
+  801999:	68 6b 5a 80 00       	push   $0x805a6b
+  80199e:	e8 92 e9 ff ff       	call   800335 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  8019a3:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8019a6:	6a 01                	push   $0x1
+  8019a8:	6a 07                	push   $0x7
+  8019aa:	68 00 f0 bf ee       	push   $0xeebff000
+  8019af:	53                   	push   %ebx
+  8019b0:	e8 57 23 00 00       	call   803d0c <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8019b5:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8019ba:	8b 40 74             	mov    0x74(%eax),%eax
+  8019bd:	83 c4 08             	add    $0x8,%esp
+  8019c0:	50                   	push   %eax
+  8019c1:	53                   	push   %ebx
+  8019c2:	e8 89 f8 ff ff       	call   801250 <sys_env_set_pgfault_upcall>
+  8019c7:	83 c4 10             	add    $0x10,%esp
+  8019ca:	e9 41 fc ff ff       	jmp    801610 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8019cf:	e8 d8 f4 ff ff       	call   800eac <sys_getenvid>
+  8019d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8019d9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8019dc:	c1 e0 06             	shl    $0x6,%eax
+  8019df:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8019e4:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  8019e9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8019f0:	e9 40 fc ff ff       	jmp    801635 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  8019f5:	50                   	push   %eax
+  8019f6:	68 bf 5a 80 00       	push   $0x805abf
+  8019fb:	68 27 01 00 00       	push   $0x127
+  801a00:	68 6b 5a 80 00       	push   $0x805a6b
+  801a05:	e8 2b e9 ff ff       	call   800335 <_panic>
+		panic("sys_env_set_status: %d", r);
+  801a0a:	50                   	push   %eax
+  801a0b:	68 d8 5a 80 00       	push   $0x805ad8
+  801a10:	68 2b 01 00 00       	push   $0x12b
+  801a15:	68 6b 5a 80 00       	push   $0x805a6b
+  801a1a:	e8 16 e9 ff ff       	call   800335 <_panic>
+
+00801a1f <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801a1f:	55                   	push   %ebp
+  801a20:	89 e5                	mov    %esp,%ebp
+  801a22:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801a25:	68 ef 5a 80 00       	push   $0x805aef
+  801a2a:	68 35 01 00 00       	push   $0x135
+  801a2f:	68 6b 5a 80 00       	push   $0x805a6b
+  801a34:	e8 fc e8 ff ff       	call   800335 <_panic>
+
+00801a39 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801a39:	55                   	push   %ebp
+  801a3a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a3f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a44:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801a47:	5d                   	pop    %ebp
+  801a48:	c3                   	ret
+
+00801a49 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801a49:	55                   	push   %ebp
+  801a4a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a4f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801a54:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801a59:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801a5e:	5d                   	pop    %ebp
+  801a5f:	c3                   	ret
+
+00801a60 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a60:	55                   	push   %ebp
+  801a61:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801a63:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801a68:	a8 01                	test   $0x1,%al
+  801a6a:	74 3c                	je     801aa8 <fd_alloc+0x48>
+  801a6c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801a71:	89 c2                	mov    %eax,%edx
+  801a73:	c1 ea 0c             	shr    $0xc,%edx
+  801a76:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a7d:	89 c1                	mov    %eax,%ecx
+  801a7f:	05 00 10 00 00       	add    $0x1000,%eax
+  801a84:	f6 c2 01             	test   $0x1,%dl
+  801a87:	74 13                	je     801a9c <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801a89:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801a8e:	75 e1                	jne    801a71 <fd_alloc+0x11>
+  801a90:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801a95:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801a9a:	eb 05                	jmp    801aa1 <fd_alloc+0x41>
+			return 0;
+  801a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801aa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aa4:	89 0a                	mov    %ecx,(%edx)
+}
+  801aa6:	5d                   	pop    %ebp
+  801aa7:	c3                   	ret
+  801aa8:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab2:	eb ed                	jmp    801aa1 <fd_alloc+0x41>
+
+00801ab4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801ab4:	55                   	push   %ebp
+  801ab5:	89 e5                	mov    %esp,%ebp
+  801ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801aba:	83 f8 1f             	cmp    $0x1f,%eax
+  801abd:	77 30                	ja     801aef <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801abf:	c1 e0 0c             	shl    $0xc,%eax
+  801ac2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801ac7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801acd:	f6 c2 01             	test   $0x1,%dl
+  801ad0:	74 24                	je     801af6 <fd_lookup+0x42>
+  801ad2:	89 c2                	mov    %eax,%edx
+  801ad4:	c1 ea 0c             	shr    $0xc,%edx
+  801ad7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ade:	f6 c2 01             	test   $0x1,%dl
+  801ae1:	74 1a                	je     801afd <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801ae3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ae6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aed:	5d                   	pop    %ebp
+  801aee:	c3                   	ret
+		return -E_INVAL;
+  801aef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af4:	eb f7                	jmp    801aed <fd_lookup+0x39>
+		return -E_INVAL;
+  801af6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801afb:	eb f0                	jmp    801aed <fd_lookup+0x39>
+  801afd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b02:	eb e9                	jmp    801aed <fd_lookup+0x39>
+
+00801b04 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b04:	55                   	push   %ebp
+  801b05:	89 e5                	mov    %esp,%ebp
+  801b07:	53                   	push   %ebx
+  801b08:	83 ec 04             	sub    $0x4,%esp
+  801b0b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801b0e:	b8 84 5b 80 00       	mov    $0x805b84,%eax
+  801b13:	8b 18                	mov    (%eax),%ebx
+  801b15:	85 db                	test   %ebx,%ebx
+  801b17:	74 0e                	je     801b27 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801b19:	83 c0 04             	add    $0x4,%eax
+  801b1c:	39 13                	cmp    %edx,(%ebx)
+  801b1e:	75 f3                	jne    801b13 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801b20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b25:	eb 1f                	jmp    801b46 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b27:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801b2c:	8b 40 48             	mov    0x48(%eax),%eax
+  801b2f:	83 ec 04             	sub    $0x4,%esp
+  801b32:	52                   	push   %edx
+  801b33:	50                   	push   %eax
+  801b34:	68 08 5b 80 00       	push   $0x805b08
+  801b39:	e8 d2 e8 ff ff       	call   800410 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801b3e:	83 c4 10             	add    $0x10,%esp
+  801b41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801b46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b49:	89 1a                	mov    %ebx,(%edx)
+}
+  801b4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b4e:	c9                   	leave
+  801b4f:	c3                   	ret
+
+00801b50 <fd_close>:
+{
+  801b50:	55                   	push   %ebp
+  801b51:	89 e5                	mov    %esp,%ebp
+  801b53:	57                   	push   %edi
+  801b54:	56                   	push   %esi
+  801b55:	53                   	push   %ebx
+  801b56:	83 ec 24             	sub    $0x24,%esp
+  801b59:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b5c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b5f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b62:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801b63:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801b69:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b6c:	50                   	push   %eax
+  801b6d:	e8 42 ff ff ff       	call   801ab4 <fd_lookup>
+  801b72:	89 c3                	mov    %eax,%ebx
+  801b74:	83 c4 10             	add    $0x10,%esp
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	78 05                	js     801b80 <fd_close+0x30>
+	    || fd != fd2)
+  801b7b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801b7e:	74 16                	je     801b96 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801b80:	89 f8                	mov    %edi,%eax
+  801b82:	84 c0                	test   %al,%al
+  801b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b89:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b8c:	89 d8                	mov    %ebx,%eax
+  801b8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b91:	5b                   	pop    %ebx
+  801b92:	5e                   	pop    %esi
+  801b93:	5f                   	pop    %edi
+  801b94:	5d                   	pop    %ebp
+  801b95:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b96:	83 ec 08             	sub    $0x8,%esp
+  801b99:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b9c:	50                   	push   %eax
+  801b9d:	ff 36                	push   (%esi)
+  801b9f:	e8 60 ff ff ff       	call   801b04 <dev_lookup>
+  801ba4:	89 c3                	mov    %eax,%ebx
+  801ba6:	83 c4 10             	add    $0x10,%esp
+  801ba9:	85 c0                	test   %eax,%eax
+  801bab:	78 1a                	js     801bc7 <fd_close+0x77>
+		if (dev->dev_close)
+  801bad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bb0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801bb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801bb8:	85 c0                	test   %eax,%eax
+  801bba:	74 0b                	je     801bc7 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801bbc:	83 ec 0c             	sub    $0xc,%esp
+  801bbf:	56                   	push   %esi
+  801bc0:	ff d0                	call   *%eax
+  801bc2:	89 c3                	mov    %eax,%ebx
+  801bc4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801bc7:	83 ec 08             	sub    $0x8,%esp
+  801bca:	56                   	push   %esi
+  801bcb:	6a 00                	push   $0x0
+  801bcd:	e8 9d f3 ff ff       	call   800f6f <sys_page_unmap>
+	return r;
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	eb b5                	jmp    801b8c <fd_close+0x3c>
+
+00801bd7 <close>:
+
+int
+close(int fdnum)
+{
+  801bd7:	55                   	push   %ebp
+  801bd8:	89 e5                	mov    %esp,%ebp
+  801bda:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801bdd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801be0:	50                   	push   %eax
+  801be1:	ff 75 08             	push   0x8(%ebp)
+  801be4:	e8 cb fe ff ff       	call   801ab4 <fd_lookup>
+  801be9:	83 c4 10             	add    $0x10,%esp
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	79 02                	jns    801bf2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801bf0:	c9                   	leave
+  801bf1:	c3                   	ret
+		return fd_close(fd, 1);
+  801bf2:	83 ec 08             	sub    $0x8,%esp
+  801bf5:	6a 01                	push   $0x1
+  801bf7:	ff 75 f4             	push   -0xc(%ebp)
+  801bfa:	e8 51 ff ff ff       	call   801b50 <fd_close>
+  801bff:	83 c4 10             	add    $0x10,%esp
+  801c02:	eb ec                	jmp    801bf0 <close+0x19>
+
+00801c04 <close_all>:
+
+void
+close_all(void)
+{
+  801c04:	55                   	push   %ebp
+  801c05:	89 e5                	mov    %esp,%ebp
+  801c07:	53                   	push   %ebx
+  801c08:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801c0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801c10:	83 ec 0c             	sub    $0xc,%esp
+  801c13:	53                   	push   %ebx
+  801c14:	e8 be ff ff ff       	call   801bd7 <close>
+	for (i = 0; i < MAXFD; i++)
+  801c19:	83 c3 01             	add    $0x1,%ebx
+  801c1c:	83 c4 10             	add    $0x10,%esp
+  801c1f:	83 fb 20             	cmp    $0x20,%ebx
+  801c22:	75 ec                	jne    801c10 <close_all+0xc>
+}
+  801c24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c27:	c9                   	leave
+  801c28:	c3                   	ret
+
+00801c29 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c29:	55                   	push   %ebp
+  801c2a:	89 e5                	mov    %esp,%ebp
+  801c2c:	57                   	push   %edi
+  801c2d:	56                   	push   %esi
+  801c2e:	53                   	push   %ebx
+  801c2f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c32:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c35:	50                   	push   %eax
+  801c36:	ff 75 08             	push   0x8(%ebp)
+  801c39:	e8 76 fe ff ff       	call   801ab4 <fd_lookup>
+  801c3e:	89 c3                	mov    %eax,%ebx
+  801c40:	83 c4 10             	add    $0x10,%esp
+  801c43:	85 c0                	test   %eax,%eax
+  801c45:	78 7f                	js     801cc6 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801c47:	83 ec 0c             	sub    $0xc,%esp
+  801c4a:	ff 75 0c             	push   0xc(%ebp)
+  801c4d:	e8 85 ff ff ff       	call   801bd7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801c52:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801c55:	c1 e6 0c             	shl    $0xc,%esi
+  801c58:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801c5e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801c61:	89 3c 24             	mov    %edi,(%esp)
+  801c64:	e8 e0 fd ff ff       	call   801a49 <fd2data>
+  801c69:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801c6b:	89 34 24             	mov    %esi,(%esp)
+  801c6e:	e8 d6 fd ff ff       	call   801a49 <fd2data>
+  801c73:	83 c4 10             	add    $0x10,%esp
+  801c76:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801c79:	89 d8                	mov    %ebx,%eax
+  801c7b:	c1 e8 16             	shr    $0x16,%eax
+  801c7e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c85:	a8 01                	test   $0x1,%al
+  801c87:	74 11                	je     801c9a <dup+0x71>
+  801c89:	89 d8                	mov    %ebx,%eax
+  801c8b:	c1 e8 0c             	shr    $0xc,%eax
+  801c8e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c95:	f6 c2 01             	test   $0x1,%dl
+  801c98:	75 36                	jne    801cd0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c9a:	89 f8                	mov    %edi,%eax
+  801c9c:	c1 e8 0c             	shr    $0xc,%eax
+  801c9f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ca6:	83 ec 0c             	sub    $0xc,%esp
+  801ca9:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cae:	50                   	push   %eax
+  801caf:	56                   	push   %esi
+  801cb0:	6a 00                	push   $0x0
+  801cb2:	57                   	push   %edi
+  801cb3:	6a 00                	push   $0x0
+  801cb5:	e8 73 f2 ff ff       	call   800f2d <sys_page_map>
+  801cba:	89 c3                	mov    %eax,%ebx
+  801cbc:	83 c4 20             	add    $0x20,%esp
+  801cbf:	85 c0                	test   %eax,%eax
+  801cc1:	78 33                	js     801cf6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801cc3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801cc6:	89 d8                	mov    %ebx,%eax
+  801cc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ccb:	5b                   	pop    %ebx
+  801ccc:	5e                   	pop    %esi
+  801ccd:	5f                   	pop    %edi
+  801cce:	5d                   	pop    %ebp
+  801ccf:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801cd0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801cd7:	83 ec 0c             	sub    $0xc,%esp
+  801cda:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cdf:	50                   	push   %eax
+  801ce0:	ff 75 d4             	push   -0x2c(%ebp)
+  801ce3:	6a 00                	push   $0x0
+  801ce5:	53                   	push   %ebx
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	e8 40 f2 ff ff       	call   800f2d <sys_page_map>
+  801ced:	89 c3                	mov    %eax,%ebx
+  801cef:	83 c4 20             	add    $0x20,%esp
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	79 a4                	jns    801c9a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801cf6:	83 ec 08             	sub    $0x8,%esp
+  801cf9:	56                   	push   %esi
+  801cfa:	6a 00                	push   $0x0
+  801cfc:	e8 6e f2 ff ff       	call   800f6f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801d01:	83 c4 08             	add    $0x8,%esp
+  801d04:	ff 75 d4             	push   -0x2c(%ebp)
+  801d07:	6a 00                	push   $0x0
+  801d09:	e8 61 f2 ff ff       	call   800f6f <sys_page_unmap>
+	return r;
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	eb b3                	jmp    801cc6 <dup+0x9d>
+
+00801d13 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d13:	55                   	push   %ebp
+  801d14:	89 e5                	mov    %esp,%ebp
+  801d16:	56                   	push   %esi
+  801d17:	53                   	push   %ebx
+  801d18:	83 ec 18             	sub    $0x18,%esp
+  801d1b:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d1e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d21:	50                   	push   %eax
+  801d22:	56                   	push   %esi
+  801d23:	e8 8c fd ff ff       	call   801ab4 <fd_lookup>
+  801d28:	83 c4 10             	add    $0x10,%esp
+  801d2b:	85 c0                	test   %eax,%eax
+  801d2d:	78 3c                	js     801d6b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d2f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801d32:	83 ec 08             	sub    $0x8,%esp
+  801d35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d38:	50                   	push   %eax
+  801d39:	ff 33                	push   (%ebx)
+  801d3b:	e8 c4 fd ff ff       	call   801b04 <dev_lookup>
+  801d40:	83 c4 10             	add    $0x10,%esp
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	78 24                	js     801d6b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d47:	8b 43 08             	mov    0x8(%ebx),%eax
+  801d4a:	83 e0 03             	and    $0x3,%eax
+  801d4d:	83 f8 01             	cmp    $0x1,%eax
+  801d50:	74 20                	je     801d72 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801d52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d55:	8b 40 08             	mov    0x8(%eax),%eax
+  801d58:	85 c0                	test   %eax,%eax
+  801d5a:	74 37                	je     801d93 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801d5c:	83 ec 04             	sub    $0x4,%esp
+  801d5f:	ff 75 10             	push   0x10(%ebp)
+  801d62:	ff 75 0c             	push   0xc(%ebp)
+  801d65:	53                   	push   %ebx
+  801d66:	ff d0                	call   *%eax
+  801d68:	83 c4 10             	add    $0x10,%esp
+}
+  801d6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d6e:	5b                   	pop    %ebx
+  801d6f:	5e                   	pop    %esi
+  801d70:	5d                   	pop    %ebp
+  801d71:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d72:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801d77:	8b 40 48             	mov    0x48(%eax),%eax
+  801d7a:	83 ec 04             	sub    $0x4,%esp
+  801d7d:	56                   	push   %esi
+  801d7e:	50                   	push   %eax
+  801d7f:	68 49 5b 80 00       	push   $0x805b49
+  801d84:	e8 87 e6 ff ff       	call   800410 <cprintf>
+		return -E_INVAL;
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d91:	eb d8                	jmp    801d6b <read+0x58>
+		return -E_NOT_SUPP;
+  801d93:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d98:	eb d1                	jmp    801d6b <read+0x58>
+
+00801d9a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d9a:	55                   	push   %ebp
+  801d9b:	89 e5                	mov    %esp,%ebp
+  801d9d:	57                   	push   %edi
+  801d9e:	56                   	push   %esi
+  801d9f:	53                   	push   %ebx
+  801da0:	83 ec 0c             	sub    $0xc,%esp
+  801da3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801da6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801da9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dae:	eb 02                	jmp    801db2 <readn+0x18>
+  801db0:	01 c3                	add    %eax,%ebx
+  801db2:	39 f3                	cmp    %esi,%ebx
+  801db4:	73 21                	jae    801dd7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801db6:	83 ec 04             	sub    $0x4,%esp
+  801db9:	89 f0                	mov    %esi,%eax
+  801dbb:	29 d8                	sub    %ebx,%eax
+  801dbd:	50                   	push   %eax
+  801dbe:	89 d8                	mov    %ebx,%eax
+  801dc0:	03 45 0c             	add    0xc(%ebp),%eax
+  801dc3:	50                   	push   %eax
+  801dc4:	57                   	push   %edi
+  801dc5:	e8 49 ff ff ff       	call   801d13 <read>
+		if (m < 0)
+  801dca:	83 c4 10             	add    $0x10,%esp
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 04                	js     801dd5 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801dd1:	75 dd                	jne    801db0 <readn+0x16>
+  801dd3:	eb 02                	jmp    801dd7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801dd5:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801dd7:	89 d8                	mov    %ebx,%eax
+  801dd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ddc:	5b                   	pop    %ebx
+  801ddd:	5e                   	pop    %esi
+  801dde:	5f                   	pop    %edi
+  801ddf:	5d                   	pop    %ebp
+  801de0:	c3                   	ret
+
+00801de1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801de1:	55                   	push   %ebp
+  801de2:	89 e5                	mov    %esp,%ebp
+  801de4:	56                   	push   %esi
+  801de5:	53                   	push   %ebx
+  801de6:	83 ec 18             	sub    $0x18,%esp
+  801de9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801def:	50                   	push   %eax
+  801df0:	53                   	push   %ebx
+  801df1:	e8 be fc ff ff       	call   801ab4 <fd_lookup>
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	78 37                	js     801e34 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dfd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e00:	83 ec 08             	sub    $0x8,%esp
+  801e03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e06:	50                   	push   %eax
+  801e07:	ff 36                	push   (%esi)
+  801e09:	e8 f6 fc ff ff       	call   801b04 <dev_lookup>
+  801e0e:	83 c4 10             	add    $0x10,%esp
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	78 1f                	js     801e34 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e15:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e19:	74 20                	je     801e3b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801e1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e21:	85 c0                	test   %eax,%eax
+  801e23:	74 37                	je     801e5c <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801e25:	83 ec 04             	sub    $0x4,%esp
+  801e28:	ff 75 10             	push   0x10(%ebp)
+  801e2b:	ff 75 0c             	push   0xc(%ebp)
+  801e2e:	56                   	push   %esi
+  801e2f:	ff d0                	call   *%eax
+  801e31:	83 c4 10             	add    $0x10,%esp
+}
+  801e34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e37:	5b                   	pop    %ebx
+  801e38:	5e                   	pop    %esi
+  801e39:	5d                   	pop    %ebp
+  801e3a:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e3b:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801e40:	8b 40 48             	mov    0x48(%eax),%eax
+  801e43:	83 ec 04             	sub    $0x4,%esp
+  801e46:	53                   	push   %ebx
+  801e47:	50                   	push   %eax
+  801e48:	68 65 5b 80 00       	push   $0x805b65
+  801e4d:	e8 be e5 ff ff       	call   800410 <cprintf>
+		return -E_INVAL;
+  801e52:	83 c4 10             	add    $0x10,%esp
+  801e55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e5a:	eb d8                	jmp    801e34 <write+0x53>
+		return -E_NOT_SUPP;
+  801e5c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e61:	eb d1                	jmp    801e34 <write+0x53>
+
+00801e63 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e63:	55                   	push   %ebp
+  801e64:	89 e5                	mov    %esp,%ebp
+  801e66:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e6c:	50                   	push   %eax
+  801e6d:	ff 75 08             	push   0x8(%ebp)
+  801e70:	e8 3f fc ff ff       	call   801ab4 <fd_lookup>
+  801e75:	83 c4 10             	add    $0x10,%esp
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	78 0e                	js     801e8a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801e7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e82:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801e85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e8a:	c9                   	leave
+  801e8b:	c3                   	ret
+
+00801e8c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e8c:	55                   	push   %ebp
+  801e8d:	89 e5                	mov    %esp,%ebp
+  801e8f:	56                   	push   %esi
+  801e90:	53                   	push   %ebx
+  801e91:	83 ec 18             	sub    $0x18,%esp
+  801e94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e9a:	50                   	push   %eax
+  801e9b:	53                   	push   %ebx
+  801e9c:	e8 13 fc ff ff       	call   801ab4 <fd_lookup>
+  801ea1:	83 c4 10             	add    $0x10,%esp
+  801ea4:	85 c0                	test   %eax,%eax
+  801ea6:	78 34                	js     801edc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ea8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801eab:	83 ec 08             	sub    $0x8,%esp
+  801eae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb1:	50                   	push   %eax
+  801eb2:	ff 36                	push   (%esi)
+  801eb4:	e8 4b fc ff ff       	call   801b04 <dev_lookup>
+  801eb9:	83 c4 10             	add    $0x10,%esp
+  801ebc:	85 c0                	test   %eax,%eax
+  801ebe:	78 1c                	js     801edc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ec0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ec4:	74 1d                	je     801ee3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801ec6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec9:	8b 40 18             	mov    0x18(%eax),%eax
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	74 34                	je     801f04 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801ed0:	83 ec 08             	sub    $0x8,%esp
+  801ed3:	ff 75 0c             	push   0xc(%ebp)
+  801ed6:	56                   	push   %esi
+  801ed7:	ff d0                	call   *%eax
+  801ed9:	83 c4 10             	add    $0x10,%esp
+}
+  801edc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801edf:	5b                   	pop    %ebx
+  801ee0:	5e                   	pop    %esi
+  801ee1:	5d                   	pop    %ebp
+  801ee2:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801ee3:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801ee8:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eeb:	83 ec 04             	sub    $0x4,%esp
+  801eee:	53                   	push   %ebx
+  801eef:	50                   	push   %eax
+  801ef0:	68 28 5b 80 00       	push   $0x805b28
+  801ef5:	e8 16 e5 ff ff       	call   800410 <cprintf>
+		return -E_INVAL;
+  801efa:	83 c4 10             	add    $0x10,%esp
+  801efd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f02:	eb d8                	jmp    801edc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801f04:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f09:	eb d1                	jmp    801edc <ftruncate+0x50>
+
+00801f0b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f0b:	55                   	push   %ebp
+  801f0c:	89 e5                	mov    %esp,%ebp
+  801f0e:	56                   	push   %esi
+  801f0f:	53                   	push   %ebx
+  801f10:	83 ec 18             	sub    $0x18,%esp
+  801f13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f16:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f19:	50                   	push   %eax
+  801f1a:	ff 75 08             	push   0x8(%ebp)
+  801f1d:	e8 92 fb ff ff       	call   801ab4 <fd_lookup>
+  801f22:	83 c4 10             	add    $0x10,%esp
+  801f25:	85 c0                	test   %eax,%eax
+  801f27:	78 49                	js     801f72 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f29:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f2c:	83 ec 08             	sub    $0x8,%esp
+  801f2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f32:	50                   	push   %eax
+  801f33:	ff 36                	push   (%esi)
+  801f35:	e8 ca fb ff ff       	call   801b04 <dev_lookup>
+  801f3a:	83 c4 10             	add    $0x10,%esp
+  801f3d:	85 c0                	test   %eax,%eax
+  801f3f:	78 31                	js     801f72 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801f41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f44:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f48:	74 2f                	je     801f79 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801f4a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801f4d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f54:	00 00 00 
+	stat->st_isdir = 0;
+  801f57:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f5e:	00 00 00 
+	stat->st_dev = dev;
+  801f61:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801f67:	83 ec 08             	sub    $0x8,%esp
+  801f6a:	53                   	push   %ebx
+  801f6b:	56                   	push   %esi
+  801f6c:	ff 50 14             	call   *0x14(%eax)
+  801f6f:	83 c4 10             	add    $0x10,%esp
+}
+  801f72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f75:	5b                   	pop    %ebx
+  801f76:	5e                   	pop    %esi
+  801f77:	5d                   	pop    %ebp
+  801f78:	c3                   	ret
+		return -E_NOT_SUPP;
+  801f79:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f7e:	eb f2                	jmp    801f72 <fstat+0x67>
+
+00801f80 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	56                   	push   %esi
+  801f84:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801f85:	83 ec 08             	sub    $0x8,%esp
+  801f88:	6a 00                	push   $0x0
+  801f8a:	ff 75 08             	push   0x8(%ebp)
+  801f8d:	e8 bc 02 00 00       	call   80224e <open>
+  801f92:	89 c3                	mov    %eax,%ebx
+  801f94:	83 c4 10             	add    $0x10,%esp
+  801f97:	85 c0                	test   %eax,%eax
+  801f99:	78 1b                	js     801fb6 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801f9b:	83 ec 08             	sub    $0x8,%esp
+  801f9e:	ff 75 0c             	push   0xc(%ebp)
+  801fa1:	50                   	push   %eax
+  801fa2:	e8 64 ff ff ff       	call   801f0b <fstat>
+  801fa7:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801fa9:	89 1c 24             	mov    %ebx,(%esp)
+  801fac:	e8 26 fc ff ff       	call   801bd7 <close>
+	return r;
+  801fb1:	83 c4 10             	add    $0x10,%esp
+  801fb4:	89 f3                	mov    %esi,%ebx
+}
+  801fb6:	89 d8                	mov    %ebx,%eax
+  801fb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fbb:	5b                   	pop    %ebx
+  801fbc:	5e                   	pop    %esi
+  801fbd:	5d                   	pop    %ebp
+  801fbe:	c3                   	ret
+
+00801fbf <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801fbf:	55                   	push   %ebp
+  801fc0:	89 e5                	mov    %esp,%ebp
+  801fc2:	57                   	push   %edi
+  801fc3:	56                   	push   %esi
+  801fc4:	53                   	push   %ebx
+  801fc5:	83 ec 0c             	sub    $0xc,%esp
+  801fc8:	89 c7                	mov    %eax,%edi
+  801fca:	89 d3                	mov    %edx,%ebx
+  801fcc:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801fce:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  801fd5:	74 2d                	je     802004 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801fd7:	6a 07                	push   $0x7
+  801fd9:	68 00 00 81 00       	push   $0x810000
+  801fde:	57                   	push   %edi
+  801fdf:	ff 35 00 80 80 00    	push   0x808000
+  801fe5:	e8 ba 31 00 00       	call   8051a4 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801fea:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ff1:	6a 00                	push   $0x0
+  801ff3:	56                   	push   %esi
+  801ff4:	53                   	push   %ebx
+  801ff5:	6a 00                	push   $0x0
+  801ff7:	e8 5a 30 00 00       	call   805056 <ipc_recv_pages>
+}
+  801ffc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fff:	5b                   	pop    %ebx
+  802000:	5e                   	pop    %esi
+  802001:	5f                   	pop    %edi
+  802002:	5d                   	pop    %ebp
+  802003:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802004:	83 ec 0c             	sub    $0xc,%esp
+  802007:	6a 01                	push   $0x1
+  802009:	e8 8b 32 00 00       	call   805299 <ipc_find_env>
+  80200e:	a3 00 80 80 00       	mov    %eax,0x808000
+  802013:	83 c4 10             	add    $0x10,%esp
+  802016:	eb bf                	jmp    801fd7 <fsipc_pages+0x18>
+
+00802018 <fsipc>:
+{
+  802018:	55                   	push   %ebp
+  802019:	89 e5                	mov    %esp,%ebp
+  80201b:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  80201e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802023:	e8 97 ff ff ff       	call   801fbf <fsipc_pages>
+}
+  802028:	c9                   	leave
+  802029:	c3                   	ret
+
+0080202a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802030:	8b 45 08             	mov    0x8(%ebp),%eax
+  802033:	8b 40 0c             	mov    0xc(%eax),%eax
+  802036:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  80203b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80203e:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  802043:	ba 00 00 00 00       	mov    $0x0,%edx
+  802048:	b8 02 00 00 00       	mov    $0x2,%eax
+  80204d:	e8 c6 ff ff ff       	call   802018 <fsipc>
+}
+  802052:	c9                   	leave
+  802053:	c3                   	ret
+
+00802054 <devfile_flush>:
+{
+  802054:	55                   	push   %ebp
+  802055:	89 e5                	mov    %esp,%ebp
+  802057:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80205a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802060:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802065:	ba 00 00 00 00       	mov    $0x0,%edx
+  80206a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80206f:	e8 a4 ff ff ff       	call   802018 <fsipc>
+}
+  802074:	c9                   	leave
+  802075:	c3                   	ret
+
+00802076 <devfile_stat>:
+{
+  802076:	55                   	push   %ebp
+  802077:	89 e5                	mov    %esp,%ebp
+  802079:	53                   	push   %ebx
+  80207a:	83 ec 04             	sub    $0x4,%esp
+  80207d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802080:	8b 45 08             	mov    0x8(%ebp),%eax
+  802083:	8b 40 0c             	mov    0xc(%eax),%eax
+  802086:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80208b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802090:	b8 05 00 00 00       	mov    $0x5,%eax
+  802095:	e8 7e ff ff ff       	call   802018 <fsipc>
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	78 2c                	js     8020ca <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80209e:	83 ec 08             	sub    $0x8,%esp
+  8020a1:	68 00 00 81 00       	push   $0x810000
+  8020a6:	53                   	push   %ebx
+  8020a7:	e8 4b e9 ff ff       	call   8009f7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8020ac:	a1 80 00 81 00       	mov    0x810080,%eax
+  8020b1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020b7:	a1 84 00 81 00       	mov    0x810084,%eax
+  8020bc:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8020c2:	83 c4 10             	add    $0x10,%esp
+  8020c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020cd:	c9                   	leave
+  8020ce:	c3                   	ret
+
+008020cf <devfile_write>:
+{
+  8020cf:	55                   	push   %ebp
+  8020d0:	89 e5                	mov    %esp,%ebp
+  8020d2:	83 ec 0c             	sub    $0xc,%esp
+  8020d5:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8020d8:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8020dd:	39 d0                	cmp    %edx,%eax
+  8020df:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020e5:	8b 52 0c             	mov    0xc(%edx),%edx
+  8020e8:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  8020ee:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8020f3:	50                   	push   %eax
+  8020f4:	ff 75 0c             	push   0xc(%ebp)
+  8020f7:	68 08 00 81 00       	push   $0x810008
+  8020fc:	e8 7c ea ff ff       	call   800b7d <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802101:	ba 00 00 00 00       	mov    $0x0,%edx
+  802106:	b8 04 00 00 00       	mov    $0x4,%eax
+  80210b:	e8 08 ff ff ff       	call   802018 <fsipc>
+}
+  802110:	c9                   	leave
+  802111:	c3                   	ret
+
+00802112 <devfile_read>:
+{
+  802112:	55                   	push   %ebp
+  802113:	89 e5                	mov    %esp,%ebp
+  802115:	57                   	push   %edi
+  802116:	56                   	push   %esi
+  802117:	53                   	push   %ebx
+  802118:	83 ec 1c             	sub    $0x1c,%esp
+  80211b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80211e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802121:	89 fe                	mov    %edi,%esi
+  802123:	c1 ee 0c             	shr    $0xc,%esi
+  802126:	b8 20 00 00 00       	mov    $0x20,%eax
+  80212b:	39 c6                	cmp    %eax,%esi
+  80212d:	0f 47 f0             	cmova  %eax,%esi
+  802130:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802133:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802138:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80213b:	eb 14                	jmp    802151 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80213d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  802144:	05 00 10 00 00       	add    $0x1000,%eax
+  802149:	f6 c6 06             	test   $0x6,%dh
+  80214c:	75 42                	jne    802190 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  80214e:	83 c1 01             	add    $0x1,%ecx
+  802151:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802154:	39 f1                	cmp    %esi,%ecx
+  802156:	0f 84 95 00 00 00    	je     8021f1 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80215c:	89 c2                	mov    %eax,%edx
+  80215e:	c1 ea 16             	shr    $0x16,%edx
+  802161:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802168:	f6 c2 01             	test   $0x1,%dl
+  80216b:	74 23                	je     802190 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80216d:	89 c2                	mov    %eax,%edx
+  80216f:	c1 ea 0c             	shr    $0xc,%edx
+  802172:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802179:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  80217f:	74 0f                	je     802190 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  802181:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802188:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  80218e:	75 ad                	jne    80213d <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802190:	85 c9                	test   %ecx,%ecx
+  802192:	74 11                	je     8021a5 <devfile_read+0x93>
+  802194:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80219b:	75 08                	jne    8021a5 <devfile_read+0x93>
+  80219d:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8021a3:	74 50                	je     8021f5 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021a5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8021a8:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  8021ad:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8021b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021bd:	e8 56 fe ff ff       	call   802018 <fsipc>
+  8021c2:	89 c6                	mov    %eax,%esi
+  8021c4:	85 c0                	test   %eax,%eax
+  8021c6:	78 1f                	js     8021e7 <devfile_read+0xd5>
+	assert(r <= n);
+  8021c8:	39 c7                	cmp    %eax,%edi
+  8021ca:	72 50                	jb     80221c <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8021cc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8021d1:	7f 62                	jg     802235 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8021d3:	83 ec 04             	sub    $0x4,%esp
+  8021d6:	50                   	push   %eax
+  8021d7:	68 00 00 81 00       	push   $0x810000
+  8021dc:	ff 75 0c             	push   0xc(%ebp)
+  8021df:	e8 99 e9 ff ff       	call   800b7d <memmove>
+	return r;
+  8021e4:	83 c4 10             	add    $0x10,%esp
+}
+  8021e7:	89 f0                	mov    %esi,%eax
+  8021e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ec:	5b                   	pop    %ebx
+  8021ed:	5e                   	pop    %esi
+  8021ee:	5f                   	pop    %edi
+  8021ef:	5d                   	pop    %ebp
+  8021f0:	c3                   	ret
+  8021f1:	89 f1                	mov    %esi,%ecx
+  8021f3:	eb 9b                	jmp    802190 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8021f5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8021f8:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8021fd:	89 c8                	mov    %ecx,%eax
+  8021ff:	c1 e0 0c             	shl    $0xc,%eax
+  802202:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802207:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80220a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80220f:	e8 ab fd ff ff       	call   801fbf <fsipc_pages>
+  802214:	89 c6                	mov    %eax,%esi
+  802216:	85 c0                	test   %eax,%eax
+  802218:	78 8b                	js     8021a5 <devfile_read+0x93>
+  80221a:	eb cb                	jmp    8021e7 <devfile_read+0xd5>
+	assert(r <= n);
+  80221c:	68 94 5b 80 00       	push   $0x805b94
+  802221:	68 9b 5b 80 00       	push   $0x805b9b
+  802226:	68 a0 00 00 00       	push   $0xa0
+  80222b:	68 b0 5b 80 00       	push   $0x805bb0
+  802230:	e8 00 e1 ff ff       	call   800335 <_panic>
+	assert(r <= PGSIZE);
+  802235:	68 bb 5b 80 00       	push   $0x805bbb
+  80223a:	68 9b 5b 80 00       	push   $0x805b9b
+  80223f:	68 a1 00 00 00       	push   $0xa1
+  802244:	68 b0 5b 80 00       	push   $0x805bb0
+  802249:	e8 e7 e0 ff ff       	call   800335 <_panic>
+
+0080224e <open>:
+{
+  80224e:	55                   	push   %ebp
+  80224f:	89 e5                	mov    %esp,%ebp
+  802251:	56                   	push   %esi
+  802252:	53                   	push   %ebx
+  802253:	83 ec 1c             	sub    $0x1c,%esp
+  802256:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802259:	56                   	push   %esi
+  80225a:	e8 5d e7 ff ff       	call   8009bc <strlen>
+  80225f:	83 c4 10             	add    $0x10,%esp
+  802262:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802267:	7f 6c                	jg     8022d5 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802269:	83 ec 0c             	sub    $0xc,%esp
+  80226c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80226f:	50                   	push   %eax
+  802270:	e8 eb f7 ff ff       	call   801a60 <fd_alloc>
+  802275:	89 c3                	mov    %eax,%ebx
+  802277:	83 c4 10             	add    $0x10,%esp
+  80227a:	85 c0                	test   %eax,%eax
+  80227c:	78 3c                	js     8022ba <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80227e:	83 ec 08             	sub    $0x8,%esp
+  802281:	56                   	push   %esi
+  802282:	68 00 00 81 00       	push   $0x810000
+  802287:	e8 6b e7 ff ff       	call   8009f7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80228c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80228f:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802294:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802297:	b8 01 00 00 00       	mov    $0x1,%eax
+  80229c:	e8 77 fd ff ff       	call   802018 <fsipc>
+  8022a1:	89 c3                	mov    %eax,%ebx
+  8022a3:	83 c4 10             	add    $0x10,%esp
+  8022a6:	85 c0                	test   %eax,%eax
+  8022a8:	78 19                	js     8022c3 <open+0x75>
+	return fd2num(fd);
+  8022aa:	83 ec 0c             	sub    $0xc,%esp
+  8022ad:	ff 75 f4             	push   -0xc(%ebp)
+  8022b0:	e8 84 f7 ff ff       	call   801a39 <fd2num>
+  8022b5:	89 c3                	mov    %eax,%ebx
+  8022b7:	83 c4 10             	add    $0x10,%esp
+}
+  8022ba:	89 d8                	mov    %ebx,%eax
+  8022bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022bf:	5b                   	pop    %ebx
+  8022c0:	5e                   	pop    %esi
+  8022c1:	5d                   	pop    %ebp
+  8022c2:	c3                   	ret
+		fd_close(fd, 0);
+  8022c3:	83 ec 08             	sub    $0x8,%esp
+  8022c6:	6a 00                	push   $0x0
+  8022c8:	ff 75 f4             	push   -0xc(%ebp)
+  8022cb:	e8 80 f8 ff ff       	call   801b50 <fd_close>
+		return r;
+  8022d0:	83 c4 10             	add    $0x10,%esp
+  8022d3:	eb e5                	jmp    8022ba <open+0x6c>
+		return -E_BAD_PATH;
+  8022d5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022da:	eb de                	jmp    8022ba <open+0x6c>
+
+008022dc <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8022dc:	55                   	push   %ebp
+  8022dd:	89 e5                	mov    %esp,%ebp
+  8022df:	53                   	push   %ebx
+  8022e0:	83 ec 10             	sub    $0x10,%esp
+  8022e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8022e6:	53                   	push   %ebx
+  8022e7:	e8 d0 e6 ff ff       	call   8009bc <strlen>
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022f4:	7f 25                	jg     80231b <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8022f6:	83 ec 08             	sub    $0x8,%esp
+  8022f9:	53                   	push   %ebx
+  8022fa:	68 00 00 81 00       	push   $0x810000
+  8022ff:	e8 f3 e6 ff ff       	call   8009f7 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802304:	ba 00 00 00 00       	mov    $0x0,%edx
+  802309:	b8 07 00 00 00       	mov    $0x7,%eax
+  80230e:	e8 05 fd ff ff       	call   802018 <fsipc>
+  802313:	83 c4 10             	add    $0x10,%esp
+}
+  802316:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802319:	c9                   	leave
+  80231a:	c3                   	ret
+		return -E_BAD_PATH;
+  80231b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802320:	eb f4                	jmp    802316 <remove+0x3a>
+
+00802322 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802322:	55                   	push   %ebp
+  802323:	89 e5                	mov    %esp,%ebp
+  802325:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802328:	ba 00 00 00 00       	mov    $0x0,%edx
+  80232d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802332:	e8 e1 fc ff ff       	call   802018 <fsipc>
+}
+  802337:	c9                   	leave
+  802338:	c3                   	ret
+
+00802339 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	53                   	push   %ebx
+  80233d:	83 ec 04             	sub    $0x4,%esp
+  802340:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  802343:	ba 00 00 00 00       	mov    $0x0,%edx
+  802348:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80234d:	e8 c6 fc ff ff       	call   802018 <fsipc>
+  802352:	85 c0                	test   %eax,%eax
+  802354:	78 3c                	js     802392 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802356:	a1 00 00 81 00       	mov    0x810000,%eax
+  80235b:	89 03                	mov    %eax,(%ebx)
+  80235d:	a1 04 00 81 00       	mov    0x810004,%eax
+  802362:	89 43 04             	mov    %eax,0x4(%ebx)
+  802365:	a1 08 00 81 00       	mov    0x810008,%eax
+  80236a:	89 43 08             	mov    %eax,0x8(%ebx)
+  80236d:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  802372:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802375:	a1 10 00 81 00       	mov    0x810010,%eax
+  80237a:	89 43 10             	mov    %eax,0x10(%ebx)
+  80237d:	a1 14 00 81 00       	mov    0x810014,%eax
+  802382:	89 43 14             	mov    %eax,0x14(%ebx)
+  802385:	a1 18 00 81 00       	mov    0x810018,%eax
+  80238a:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80238d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802392:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802395:	c9                   	leave
+  802396:	c3                   	ret
+
+00802397 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  802397:	55                   	push   %ebp
+  802398:	89 e5                	mov    %esp,%ebp
+  80239a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80239d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023a0:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  8023a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023aa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8023af:	e8 64 fc ff ff       	call   802018 <fsipc>
+}
+  8023b4:	c9                   	leave
+  8023b5:	c3                   	ret
+
+008023b6 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023b6:	55                   	push   %ebp
+  8023b7:	89 e5                	mov    %esp,%ebp
+  8023b9:	56                   	push   %esi
+  8023ba:	53                   	push   %ebx
+  8023bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8023be:	83 ec 0c             	sub    $0xc,%esp
+  8023c1:	ff 75 08             	push   0x8(%ebp)
+  8023c4:	e8 80 f6 ff ff       	call   801a49 <fd2data>
+  8023c9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8023cb:	83 c4 08             	add    $0x8,%esp
+  8023ce:	68 c7 5b 80 00       	push   $0x805bc7
+  8023d3:	53                   	push   %ebx
+  8023d4:	e8 1e e6 ff ff       	call   8009f7 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8023d9:	8b 46 04             	mov    0x4(%esi),%eax
+  8023dc:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8023e2:	2b 0e                	sub    (%esi),%ecx
+  8023e4:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8023e9:	89 c8                	mov    %ecx,%eax
+  8023eb:	f7 e2                	mul    %edx
+  8023ed:	c1 ea 0c             	shr    $0xc,%edx
+  8023f0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8023f6:	29 d1                	sub    %edx,%ecx
+  8023f8:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8023fe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802405:	00 00 00 
+	stat->st_dev = &devpipe;
+  802408:	c7 83 88 00 00 00 24 	movl   $0x807024,0x88(%ebx)
+  80240f:	70 80 00 
+	return 0;
+}
+  802412:	b8 00 00 00 00       	mov    $0x0,%eax
+  802417:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80241a:	5b                   	pop    %ebx
+  80241b:	5e                   	pop    %esi
+  80241c:	5d                   	pop    %ebp
+  80241d:	c3                   	ret
+
+0080241e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80241e:	55                   	push   %ebp
+  80241f:	89 e5                	mov    %esp,%ebp
+  802421:	53                   	push   %ebx
+  802422:	83 ec 0c             	sub    $0xc,%esp
+  802425:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802428:	53                   	push   %ebx
+  802429:	6a 00                	push   $0x0
+  80242b:	e8 3f eb ff ff       	call   800f6f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802430:	89 1c 24             	mov    %ebx,(%esp)
+  802433:	e8 11 f6 ff ff       	call   801a49 <fd2data>
+  802438:	83 c4 08             	add    $0x8,%esp
+  80243b:	50                   	push   %eax
+  80243c:	6a 00                	push   $0x0
+  80243e:	e8 2c eb ff ff       	call   800f6f <sys_page_unmap>
+}
+  802443:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802446:	c9                   	leave
+  802447:	c3                   	ret
+
+00802448 <_pipeisclosed>:
+{
+  802448:	55                   	push   %ebp
+  802449:	89 e5                	mov    %esp,%ebp
+  80244b:	57                   	push   %edi
+  80244c:	56                   	push   %esi
+  80244d:	53                   	push   %ebx
+  80244e:	83 ec 1c             	sub    $0x1c,%esp
+  802451:	89 c7                	mov    %eax,%edi
+  802453:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802455:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80245a:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80245d:	83 ec 0c             	sub    $0xc,%esp
+  802460:	57                   	push   %edi
+  802461:	e8 72 2e 00 00       	call   8052d8 <pageref>
+  802466:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802469:	89 34 24             	mov    %esi,(%esp)
+  80246c:	e8 67 2e 00 00       	call   8052d8 <pageref>
+		nn = thisenv->env_runs;
+  802471:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802477:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80247a:	83 c4 10             	add    $0x10,%esp
+  80247d:	39 cb                	cmp    %ecx,%ebx
+  80247f:	74 1b                	je     80249c <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802481:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802484:	75 cf                	jne    802455 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802486:	8b 42 58             	mov    0x58(%edx),%eax
+  802489:	6a 01                	push   $0x1
+  80248b:	50                   	push   %eax
+  80248c:	53                   	push   %ebx
+  80248d:	68 ce 5b 80 00       	push   $0x805bce
+  802492:	e8 79 df ff ff       	call   800410 <cprintf>
+  802497:	83 c4 10             	add    $0x10,%esp
+  80249a:	eb b9                	jmp    802455 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80249c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80249f:	0f 94 c0             	sete   %al
+  8024a2:	0f b6 c0             	movzbl %al,%eax
+}
+  8024a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a8:	5b                   	pop    %ebx
+  8024a9:	5e                   	pop    %esi
+  8024aa:	5f                   	pop    %edi
+  8024ab:	5d                   	pop    %ebp
+  8024ac:	c3                   	ret
+
+008024ad <devpipe_read>:
+{
+  8024ad:	55                   	push   %ebp
+  8024ae:	89 e5                	mov    %esp,%ebp
+  8024b0:	57                   	push   %edi
+  8024b1:	56                   	push   %esi
+  8024b2:	53                   	push   %ebx
+  8024b3:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8024b6:	ff 75 08             	push   0x8(%ebp)
+  8024b9:	e8 8b f5 ff ff       	call   801a49 <fd2data>
+  8024be:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8024c0:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8024c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8024c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8024c9:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8024cc:	8b 0b                	mov    (%ebx),%ecx
+  8024ce:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8024d4:	29 ce                	sub    %ecx,%esi
+  8024d6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8024db:	f7 e6                	mul    %esi
+  8024dd:	c1 ea 0c             	shr    $0xc,%edx
+  8024e0:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8024e6:	29 c6                	sub    %eax,%esi
+  8024e8:	89 f2                	mov    %esi,%edx
+  8024ea:	75 43                	jne    80252f <devpipe_read+0x82>
+		ref = pageref(p);
+  8024ec:	83 ec 0c             	sub    $0xc,%esp
+  8024ef:	53                   	push   %ebx
+  8024f0:	e8 e3 2d 00 00       	call   8052d8 <pageref>
+  8024f5:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8024f7:	89 da                	mov    %ebx,%edx
+  8024f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024fc:	e8 47 ff ff ff       	call   802448 <_pipeisclosed>
+  802501:	83 c4 10             	add    $0x10,%esp
+  802504:	85 c0                	test   %eax,%eax
+  802506:	0f 85 c1 00 00 00    	jne    8025cd <devpipe_read+0x120>
+	*sleeping = 1;
+  80250c:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802513:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802518:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80251b:	75 ac                	jne    8024c9 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80251d:	83 ec 04             	sub    $0x4,%esp
+  802520:	56                   	push   %esi
+  802521:	57                   	push   %edi
+  802522:	ff 75 e4             	push   -0x1c(%ebp)
+  802525:	e8 99 ee ff ff       	call   8013c3 <sys_futex_wait>
+  80252a:	83 c4 10             	add    $0x10,%esp
+  80252d:	eb 9a                	jmp    8024c9 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80252f:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802532:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802536:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802538:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80253d:	f7 e1                	mul    %ecx
+  80253f:	c1 ea 0b             	shr    $0xb,%edx
+  802542:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802548:	29 c1                	sub    %eax,%ecx
+  80254a:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80254c:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802551:	29 cf                	sub    %ecx,%edi
+  802553:	39 f7                	cmp    %esi,%edi
+  802555:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802558:	8d 43 10             	lea    0x10(%ebx),%eax
+  80255b:	83 ec 04             	sub    $0x4,%esp
+  80255e:	57                   	push   %edi
+  80255f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802562:	01 c2                	add    %eax,%edx
+  802564:	52                   	push   %edx
+  802565:	ff 75 0c             	push   0xc(%ebp)
+  802568:	e8 10 e6 ff ff       	call   800b7d <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80256d:	83 c4 0c             	add    $0xc,%esp
+  802570:	89 f1                	mov    %esi,%ecx
+  802572:	29 f9                	sub    %edi,%ecx
+  802574:	51                   	push   %ecx
+  802575:	ff 75 e4             	push   -0x1c(%ebp)
+  802578:	89 f8                	mov    %edi,%eax
+  80257a:	03 45 0c             	add    0xc(%ebp),%eax
+  80257d:	50                   	push   %eax
+  80257e:	e8 fa e5 ff ff       	call   800b7d <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802583:	89 f1                	mov    %esi,%ecx
+  802585:	03 0b                	add    (%ebx),%ecx
+  802587:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80258c:	f7 e1                	mul    %ecx
+  80258e:	c1 ea 0c             	shr    $0xc,%edx
+  802591:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802597:	29 d1                	sub    %edx,%ecx
+  802599:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80259b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8025a7:	75 0a                	jne    8025b3 <devpipe_read+0x106>
+	return n;
+  8025a9:	89 f0                	mov    %esi,%eax
+}
+  8025ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ae:	5b                   	pop    %ebx
+  8025af:	5e                   	pop    %esi
+  8025b0:	5f                   	pop    %edi
+  8025b1:	5d                   	pop    %ebp
+  8025b2:	c3                   	ret
+		*sleeping = 0;
+  8025b3:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8025ba:	83 ec 08             	sub    $0x8,%esp
+  8025bd:	68 00 04 00 00       	push   $0x400
+  8025c2:	53                   	push   %ebx
+  8025c3:	e8 4b ee ff ff       	call   801413 <sys_futex_wake>
+  8025c8:	83 c4 10             	add    $0x10,%esp
+  8025cb:	eb dc                	jmp    8025a9 <devpipe_read+0xfc>
+			return 0;
+  8025cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d2:	eb d7                	jmp    8025ab <devpipe_read+0xfe>
+
+008025d4 <devpipe_write>:
+{
+  8025d4:	55                   	push   %ebp
+  8025d5:	89 e5                	mov    %esp,%ebp
+  8025d7:	57                   	push   %edi
+  8025d8:	56                   	push   %esi
+  8025d9:	53                   	push   %ebx
+  8025da:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8025dd:	ff 75 08             	push   0x8(%ebp)
+  8025e0:	e8 64 f4 ff ff       	call   801a49 <fd2data>
+  8025e5:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8025e7:	83 c4 10             	add    $0x10,%esp
+  8025ea:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8025f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025f4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8025f7:	0f 83 23 01 00 00    	jae    802720 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8025fd:	8b 77 04             	mov    0x4(%edi),%esi
+  802600:	8b 1f                	mov    (%edi),%ebx
+  802602:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802608:	29 d9                	sub    %ebx,%ecx
+  80260a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80260f:	f7 e1                	mul    %ecx
+  802611:	c1 ea 0c             	shr    $0xc,%edx
+  802614:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80261a:	29 c1                	sub    %eax,%ecx
+  80261c:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80261e:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802624:	75 40                	jne    802666 <devpipe_write+0x92>
+			ref = pageref(p);
+  802626:	83 ec 0c             	sub    $0xc,%esp
+  802629:	57                   	push   %edi
+  80262a:	e8 a9 2c 00 00       	call   8052d8 <pageref>
+  80262f:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802631:	89 fa                	mov    %edi,%edx
+  802633:	8b 45 08             	mov    0x8(%ebp),%eax
+  802636:	e8 0d fe ff ff       	call   802448 <_pipeisclosed>
+  80263b:	83 c4 10             	add    $0x10,%esp
+  80263e:	85 c0                	test   %eax,%eax
+  802640:	0f 85 d5 00 00 00    	jne    80271b <devpipe_write+0x147>
+	*sleeping = 1;
+  802646:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80264d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802652:	39 1f                	cmp    %ebx,(%edi)
+  802654:	75 a7                	jne    8025fd <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802656:	83 ec 04             	sub    $0x4,%esp
+  802659:	56                   	push   %esi
+  80265a:	53                   	push   %ebx
+  80265b:	57                   	push   %edi
+  80265c:	e8 62 ed ff ff       	call   8013c3 <sys_futex_wait>
+  802661:	83 c4 10             	add    $0x10,%esp
+  802664:	eb 97                	jmp    8025fd <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802666:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802669:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80266c:	29 c1                	sub    %eax,%ecx
+  80266e:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802673:	89 d8                	mov    %ebx,%eax
+  802675:	29 d0                	sub    %edx,%eax
+  802677:	39 c1                	cmp    %eax,%ecx
+  802679:	0f 46 c1             	cmovbe %ecx,%eax
+  80267c:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  80267e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802683:	f7 e6                	mul    %esi
+  802685:	c1 ea 0b             	shr    $0xb,%edx
+  802688:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80268e:	29 c6                	sub    %eax,%esi
+  802690:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802692:	29 f3                	sub    %esi,%ebx
+  802694:	39 cb                	cmp    %ecx,%ebx
+  802696:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802699:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  80269c:	8d 77 10             	lea    0x10(%edi),%esi
+  80269f:	83 ec 04             	sub    $0x4,%esp
+  8026a2:	53                   	push   %ebx
+  8026a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026a6:	03 45 0c             	add    0xc(%ebp),%eax
+  8026a9:	50                   	push   %eax
+  8026aa:	01 f2                	add    %esi,%edx
+  8026ac:	52                   	push   %edx
+  8026ad:	e8 cb e4 ff ff       	call   800b7d <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8026b2:	83 c4 0c             	add    $0xc,%esp
+  8026b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026b8:	29 d8                	sub    %ebx,%eax
+  8026ba:	50                   	push   %eax
+  8026bb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026be:	01 d3                	add    %edx,%ebx
+  8026c0:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8026c3:	53                   	push   %ebx
+  8026c4:	56                   	push   %esi
+  8026c5:	e8 b3 e4 ff ff       	call   800b7d <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8026ca:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026cd:	03 4f 04             	add    0x4(%edi),%ecx
+  8026d0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8026d5:	f7 e1                	mul    %ecx
+  8026d7:	c1 ea 0c             	shr    $0xc,%edx
+  8026da:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8026e0:	29 d1                	sub    %edx,%ecx
+  8026e2:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8026e5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8026ea:	83 c4 10             	add    $0x10,%esp
+  8026ed:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8026f1:	75 0b                	jne    8026fe <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8026f3:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8026f6:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8026f9:	e9 f3 fe ff ff       	jmp    8025f1 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8026fe:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802705:	83 ec 08             	sub    $0x8,%esp
+  802708:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80270d:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802710:	50                   	push   %eax
+  802711:	e8 fd ec ff ff       	call   801413 <sys_futex_wake>
+  802716:	83 c4 10             	add    $0x10,%esp
+  802719:	eb d8                	jmp    8026f3 <devpipe_write+0x11f>
+				return 0;
+  80271b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802720:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802723:	5b                   	pop    %ebx
+  802724:	5e                   	pop    %esi
+  802725:	5f                   	pop    %edi
+  802726:	5d                   	pop    %ebp
+  802727:	c3                   	ret
+
+00802728 <pipe>:
+{
+  802728:	55                   	push   %ebp
+  802729:	89 e5                	mov    %esp,%ebp
+  80272b:	56                   	push   %esi
+  80272c:	53                   	push   %ebx
+  80272d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802730:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802733:	50                   	push   %eax
+  802734:	e8 27 f3 ff ff       	call   801a60 <fd_alloc>
+  802739:	89 c3                	mov    %eax,%ebx
+  80273b:	83 c4 10             	add    $0x10,%esp
+  80273e:	85 c0                	test   %eax,%eax
+  802740:	0f 88 23 01 00 00    	js     802869 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802746:	83 ec 04             	sub    $0x4,%esp
+  802749:	68 07 04 00 00       	push   $0x407
+  80274e:	ff 75 f4             	push   -0xc(%ebp)
+  802751:	6a 00                	push   $0x0
+  802753:	e8 92 e7 ff ff       	call   800eea <sys_page_alloc>
+  802758:	89 c3                	mov    %eax,%ebx
+  80275a:	83 c4 10             	add    $0x10,%esp
+  80275d:	85 c0                	test   %eax,%eax
+  80275f:	0f 88 04 01 00 00    	js     802869 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802765:	83 ec 0c             	sub    $0xc,%esp
+  802768:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80276b:	50                   	push   %eax
+  80276c:	e8 ef f2 ff ff       	call   801a60 <fd_alloc>
+  802771:	89 c3                	mov    %eax,%ebx
+  802773:	83 c4 10             	add    $0x10,%esp
+  802776:	85 c0                	test   %eax,%eax
+  802778:	0f 88 db 00 00 00    	js     802859 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80277e:	83 ec 04             	sub    $0x4,%esp
+  802781:	68 07 04 00 00       	push   $0x407
+  802786:	ff 75 f0             	push   -0x10(%ebp)
+  802789:	6a 00                	push   $0x0
+  80278b:	e8 5a e7 ff ff       	call   800eea <sys_page_alloc>
+  802790:	89 c3                	mov    %eax,%ebx
+  802792:	83 c4 10             	add    $0x10,%esp
+  802795:	85 c0                	test   %eax,%eax
+  802797:	0f 88 bc 00 00 00    	js     802859 <pipe+0x131>
+	va = fd2data(fd0);
+  80279d:	83 ec 0c             	sub    $0xc,%esp
+  8027a0:	ff 75 f4             	push   -0xc(%ebp)
+  8027a3:	e8 a1 f2 ff ff       	call   801a49 <fd2data>
+  8027a8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027aa:	83 c4 0c             	add    $0xc,%esp
+  8027ad:	68 07 04 00 00       	push   $0x407
+  8027b2:	50                   	push   %eax
+  8027b3:	6a 00                	push   $0x0
+  8027b5:	e8 30 e7 ff ff       	call   800eea <sys_page_alloc>
+  8027ba:	89 c3                	mov    %eax,%ebx
+  8027bc:	83 c4 10             	add    $0x10,%esp
+  8027bf:	85 c0                	test   %eax,%eax
+  8027c1:	0f 88 82 00 00 00    	js     802849 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027c7:	83 ec 0c             	sub    $0xc,%esp
+  8027ca:	ff 75 f0             	push   -0x10(%ebp)
+  8027cd:	e8 77 f2 ff ff       	call   801a49 <fd2data>
+  8027d2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8027d9:	50                   	push   %eax
+  8027da:	6a 00                	push   $0x0
+  8027dc:	56                   	push   %esi
+  8027dd:	6a 00                	push   $0x0
+  8027df:	e8 49 e7 ff ff       	call   800f2d <sys_page_map>
+  8027e4:	89 c3                	mov    %eax,%ebx
+  8027e6:	83 c4 20             	add    $0x20,%esp
+  8027e9:	85 c0                	test   %eax,%eax
+  8027eb:	78 4e                	js     80283b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8027ed:	a1 24 70 80 00       	mov    0x807024,%eax
+  8027f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027f5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8027f7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8027fa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802801:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802804:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802806:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802809:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802810:	83 ec 0c             	sub    $0xc,%esp
+  802813:	ff 75 f4             	push   -0xc(%ebp)
+  802816:	e8 1e f2 ff ff       	call   801a39 <fd2num>
+  80281b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80281e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802820:	83 c4 04             	add    $0x4,%esp
+  802823:	ff 75 f0             	push   -0x10(%ebp)
+  802826:	e8 0e f2 ff ff       	call   801a39 <fd2num>
+  80282b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80282e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802831:	83 c4 10             	add    $0x10,%esp
+  802834:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802839:	eb 2e                	jmp    802869 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80283b:	83 ec 08             	sub    $0x8,%esp
+  80283e:	56                   	push   %esi
+  80283f:	6a 00                	push   $0x0
+  802841:	e8 29 e7 ff ff       	call   800f6f <sys_page_unmap>
+  802846:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802849:	83 ec 08             	sub    $0x8,%esp
+  80284c:	ff 75 f0             	push   -0x10(%ebp)
+  80284f:	6a 00                	push   $0x0
+  802851:	e8 19 e7 ff ff       	call   800f6f <sys_page_unmap>
+  802856:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802859:	83 ec 08             	sub    $0x8,%esp
+  80285c:	ff 75 f4             	push   -0xc(%ebp)
+  80285f:	6a 00                	push   $0x0
+  802861:	e8 09 e7 ff ff       	call   800f6f <sys_page_unmap>
+  802866:	83 c4 10             	add    $0x10,%esp
+}
+  802869:	89 d8                	mov    %ebx,%eax
+  80286b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80286e:	5b                   	pop    %ebx
+  80286f:	5e                   	pop    %esi
+  802870:	5d                   	pop    %ebp
+  802871:	c3                   	ret
+
+00802872 <pipeisclosed>:
+{
+  802872:	55                   	push   %ebp
+  802873:	89 e5                	mov    %esp,%ebp
+  802875:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802878:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80287b:	50                   	push   %eax
+  80287c:	ff 75 08             	push   0x8(%ebp)
+  80287f:	e8 30 f2 ff ff       	call   801ab4 <fd_lookup>
+  802884:	83 c4 10             	add    $0x10,%esp
+  802887:	85 c0                	test   %eax,%eax
+  802889:	78 18                	js     8028a3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80288b:	83 ec 0c             	sub    $0xc,%esp
+  80288e:	ff 75 f4             	push   -0xc(%ebp)
+  802891:	e8 b3 f1 ff ff       	call   801a49 <fd2data>
+  802896:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802898:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80289b:	e8 a8 fb ff ff       	call   802448 <_pipeisclosed>
+  8028a0:	83 c4 10             	add    $0x10,%esp
+}
+  8028a3:	c9                   	leave
+  8028a4:	c3                   	ret
+
+008028a5 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8028a5:	55                   	push   %ebp
+  8028a6:	89 e5                	mov    %esp,%ebp
+  8028a8:	57                   	push   %edi
+  8028a9:	56                   	push   %esi
+  8028aa:	53                   	push   %ebx
+  8028ab:	83 ec 0c             	sub    $0xc,%esp
+  8028ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  8028b1:	85 ff                	test   %edi,%edi
+  8028b3:	74 21                	je     8028d6 <wait+0x31>
+	e = &envs[ENVX(envid)];
+  8028b5:	89 f8                	mov    %edi,%eax
+  8028b7:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  8028bc:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8028bf:	c1 e6 06             	shl    $0x6,%esi
+  8028c2:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  8028c8:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  8028cb:	c1 e3 06             	shl    $0x6,%ebx
+  8028ce:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8028d4:	eb 25                	jmp    8028fb <wait+0x56>
+	assert(envid != 0);
+  8028d6:	68 e6 5b 80 00       	push   $0x805be6
+  8028db:	68 9b 5b 80 00       	push   $0x805b9b
+  8028e0:	6a 0a                	push   $0xa
+  8028e2:	68 f1 5b 80 00       	push   $0x805bf1
+  8028e7:	e8 49 da ff ff       	call   800335 <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  8028ec:	83 ec 04             	sub    $0x4,%esp
+  8028ef:	6a ff                	push   $0xffffffff
+  8028f1:	50                   	push   %eax
+  8028f2:	56                   	push   %esi
+  8028f3:	e8 cb ea ff ff       	call   8013c3 <sys_futex_wait>
+  8028f8:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  8028fb:	8b 43 48             	mov    0x48(%ebx),%eax
+  8028fe:	39 f8                	cmp    %edi,%eax
+  802900:	75 07                	jne    802909 <wait+0x64>
+  802902:	8b 43 54             	mov    0x54(%ebx),%eax
+  802905:	85 c0                	test   %eax,%eax
+  802907:	75 e3                	jne    8028ec <wait+0x47>
+}
+  802909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80290c:	5b                   	pop    %ebx
+  80290d:	5e                   	pop    %esi
+  80290e:	5f                   	pop    %edi
+  80290f:	5d                   	pop    %ebp
+  802910:	c3                   	ret
+
+00802911 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802911:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802913:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802919:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  80291f:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802925:	39 d0                	cmp    %edx,%eax
+  802927:	74 2e                	je     802957 <segment_lookup+0x46>
+{
+  802929:	55                   	push   %ebp
+  80292a:	89 e5                	mov    %esp,%ebp
+  80292c:	57                   	push   %edi
+  80292d:	56                   	push   %esi
+  80292e:	53                   	push   %ebx
+  80292f:	eb 07                	jmp    802938 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802931:	83 c0 20             	add    $0x20,%eax
+  802934:	39 d0                	cmp    %edx,%eax
+  802936:	74 15                	je     80294d <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802938:	8b 18                	mov    (%eax),%ebx
+  80293a:	39 d9                	cmp    %ebx,%ecx
+  80293c:	72 f3                	jb     802931 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  80293e:	8b 38                	mov    (%eax),%edi
+  802940:	8b 58 04             	mov    0x4(%eax),%ebx
+  802943:	89 ce                	mov    %ecx,%esi
+  802945:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802947:	39 de                	cmp    %ebx,%esi
+  802949:	73 e6                	jae    802931 <segment_lookup+0x20>
+  80294b:	eb 05                	jmp    802952 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  80294d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802952:	5b                   	pop    %ebx
+  802953:	5e                   	pop    %esi
+  802954:	5f                   	pop    %edi
+  802955:	5d                   	pop    %ebp
+  802956:	c3                   	ret
+	return NULL;
+  802957:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80295c:	c3                   	ret
+
+0080295d <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  80295d:	55                   	push   %ebp
+  80295e:	89 e5                	mov    %esp,%ebp
+  802960:	53                   	push   %ebx
+  802961:	83 ec 04             	sub    $0x4,%esp
+  802964:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802966:	c1 e8 16             	shr    $0x16,%eax
+  802969:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802970:	25 81 00 00 00       	and    $0x81,%eax
+  802975:	83 f8 01             	cmp    $0x1,%eax
+  802978:	75 6b                	jne    8029e5 <page_is_clean+0x88>
+  80297a:	89 da                	mov    %ebx,%edx
+  80297c:	c1 ea 0c             	shr    $0xc,%edx
+  80297f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802986:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80298b:	f6 c1 01             	test   $0x1,%cl
+  80298e:	74 5a                	je     8029ea <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802990:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802997:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  80299d:	75 4b                	jne    8029ea <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  80299f:	89 d8                	mov    %ebx,%eax
+  8029a1:	e8 6b ff ff ff       	call   802911 <segment_lookup>
+  8029a6:	89 c2                	mov    %eax,%edx
+		return 1;
+  8029a8:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  8029ad:	85 d2                	test   %edx,%edx
+  8029af:	75 39                	jne    8029ea <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  8029b1:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  8029b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bc:	eb 03                	jmp    8029c1 <page_is_clean+0x64>
+  8029be:	83 c0 01             	add    $0x1,%eax
+  8029c1:	39 c2                	cmp    %eax,%edx
+  8029c3:	7e 19                	jle    8029de <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  8029c5:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  8029cc:	72 f0                	jb     8029be <page_is_clean+0x61>
+  8029ce:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  8029d5:	73 e7                	jae    8029be <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  8029d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029dc:	eb 0c                	jmp    8029ea <page_is_clean+0x8d>
+	return 0;
+  8029de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e3:	eb 05                	jmp    8029ea <page_is_clean+0x8d>
+		return 0;
+  8029e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ed:	c9                   	leave
+  8029ee:	c3                   	ret
+
+008029ef <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  8029ef:	55                   	push   %ebp
+  8029f0:	89 e5                	mov    %esp,%ebp
+  8029f2:	57                   	push   %edi
+  8029f3:	56                   	push   %esi
+  8029f4:	53                   	push   %ebx
+  8029f5:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8029f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8029fd:	eb 19                	jmp    802a18 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8029ff:	f7 d3                	not    %ebx
+  802a01:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802a07:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802a09:	83 c6 01             	add    $0x1,%esi
+  802a0c:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802a12:	0f 87 97 00 00 00    	ja     802aaf <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a18:	89 f3                	mov    %esi,%ebx
+  802a1a:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  802a20:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802a26:	89 d8                	mov    %ebx,%eax
+  802a28:	c1 e8 0a             	shr    $0xa,%eax
+  802a2b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a32:	25 81 00 00 00       	and    $0x81,%eax
+  802a37:	83 f8 01             	cmp    $0x1,%eax
+  802a3a:	75 c3                	jne    8029ff <linear_walk+0x10>
+  802a3c:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802a42:	77 bb                	ja     8029ff <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802a44:	89 df                	mov    %ebx,%edi
+  802a46:	c1 e7 0c             	shl    $0xc,%edi
+  802a49:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802a4c:	89 f8                	mov    %edi,%eax
+  802a4e:	e8 0a ff ff ff       	call   80295d <page_is_clean>
+  802a53:	84 c0                	test   %al,%al
+  802a55:	75 64                	jne    802abb <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a57:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802a5d:	77 aa                	ja     802a09 <linear_walk+0x1a>
+  802a5f:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802a65:	72 a2                	jb     802a09 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a67:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802a6e:	a8 01                	test   $0x1,%al
+  802a70:	74 97                	je     802a09 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802a72:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802a79:	f6 c4 04             	test   $0x4,%ah
+  802a7c:	75 8b                	jne    802a09 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802a7e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802a85:	f6 c4 02             	test   $0x2,%ah
+  802a88:	0f 85 7b ff ff ff    	jne    802a09 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802a8e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802a95:	c1 e8 0c             	shr    $0xc,%eax
+  802a98:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802a9b:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802aa0:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802aa4:	66 83 f8 01          	cmp    $0x1,%ax
+  802aa8:	76 11                	jbe    802abb <linear_walk+0xcc>
+  802aaa:	e9 5a ff ff ff       	jmp    802a09 <linear_walk+0x1a>
+  802aaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802ab4:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802abb:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  802ac1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ac4:	83 c4 1c             	add    $0x1c,%esp
+  802ac7:	5b                   	pop    %ebx
+  802ac8:	5e                   	pop    %esi
+  802ac9:	5f                   	pop    %edi
+  802aca:	5d                   	pop    %ebp
+  802acb:	c3                   	ret
+
+00802acc <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802acc:	55                   	push   %ebp
+  802acd:	89 e5                	mov    %esp,%ebp
+  802acf:	56                   	push   %esi
+  802ad0:	53                   	push   %ebx
+  802ad1:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802ad3:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802ad8:	83 e0 7f             	and    $0x7f,%eax
+  802adb:	c1 e0 04             	shl    $0x4,%eax
+  802ade:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802ae4:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802aea:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802af0:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802af6:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802afb:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802afe:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b03:	83 c0 01             	add    $0x1,%eax
+  802b06:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802b0b:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802b0e:	5b                   	pop    %ebx
+  802b0f:	5e                   	pop    %esi
+  802b10:	5d                   	pop    %ebp
+  802b11:	c3                   	ret
+
+00802b12 <page_ring_enter>:
+{
+  802b12:	55                   	push   %ebp
+  802b13:	89 e5                	mov    %esp,%ebp
+  802b15:	57                   	push   %edi
+  802b16:	56                   	push   %esi
+  802b17:	53                   	push   %ebx
+  802b18:	83 ec 18             	sub    $0x18,%esp
+  802b1b:	89 c6                	mov    %eax,%esi
+  802b1d:	89 d7                	mov    %edx,%edi
+  802b1f:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802b21:	6a 00                	push   $0x0
+  802b23:	6a 00                	push   $0x0
+  802b25:	6a 00                	push   $0x0
+  802b27:	6a 07                	push   $0x7
+  802b29:	ff 35 40 c0 80 00    	push   0x80c040
+  802b2f:	e8 8e 26 00 00       	call   8051c2 <ipc_call>
+  802b34:	83 c4 20             	add    $0x20,%esp
+  802b37:	85 c0                	test   %eax,%eax
+  802b39:	79 22                	jns    802b5d <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802b3b:	50                   	push   %eax
+  802b3c:	68 fc 5b 80 00       	push   $0x805bfc
+  802b41:	68 13 02 00 00       	push   $0x213
+  802b46:	68 10 5c 80 00       	push   $0x805c10
+  802b4b:	e8 e5 d7 ff ff       	call   800335 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802b50:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802b55:	83 c0 01             	add    $0x1,%eax
+  802b58:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802b5d:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802b63:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802b68:	39 c2                	cmp    %eax,%edx
+  802b6a:	74 24                	je     802b90 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802b6c:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802b71:	83 e0 7f             	and    $0x7f,%eax
+  802b74:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802b7b:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802b82:	29 f0                	sub    %esi,%eax
+  802b84:	39 d8                	cmp    %ebx,%eax
+  802b86:	73 c8                	jae    802b50 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802b88:	8b 52 04             	mov    0x4(%edx),%edx
+  802b8b:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802b8e:	eb c0                	jmp    802b50 <page_ring_enter+0x3e>
+}
+  802b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b93:	5b                   	pop    %ebx
+  802b94:	5e                   	pop    %esi
+  802b95:	5f                   	pop    %edi
+  802b96:	5d                   	pop    %ebp
+  802b97:	c3                   	ret
+
+00802b98 <page_ring_reserve>:
+{
+  802b98:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802b9a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802b9f:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802ba5:	29 d0                	sub    %edx,%eax
+  802ba7:	ba 80 00 00 00       	mov    $0x80,%edx
+  802bac:	29 ca                	sub    %ecx,%edx
+  802bae:	39 c2                	cmp    %eax,%edx
+  802bb0:	72 01                	jb     802bb3 <page_ring_reserve+0x1b>
+  802bb2:	c3                   	ret
+{
+  802bb3:	55                   	push   %ebp
+  802bb4:	89 e5                	mov    %esp,%ebp
+  802bb6:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802bb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc8:	e8 45 ff ff ff       	call   802b12 <page_ring_enter>
+}
+  802bcd:	c9                   	leave
+  802bce:	c3                   	ret
+
+00802bcf <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802bcf:	55                   	push   %ebp
+  802bd0:	89 e5                	mov    %esp,%ebp
+  802bd2:	53                   	push   %ebx
+  802bd3:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802bd6:	6a 07                	push   $0x7
+  802bd8:	6a 01                	push   $0x1
+  802bda:	89 c3                	mov    %eax,%ebx
+  802bdc:	c1 e3 0c             	shl    $0xc,%ebx
+  802bdf:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802be5:	52                   	push   %edx
+  802be6:	6a 04                	push   $0x4
+  802be8:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802bef:	e8 ce 25 00 00       	call   8051c2 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802bf4:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802bfb:	00 00 00 
+	return r;
+}
+  802bfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c01:	c9                   	leave
+  802c02:	c3                   	ret
+
+00802c03 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802c03:	55                   	push   %ebp
+  802c04:	89 e5                	mov    %esp,%ebp
+  802c06:	56                   	push   %esi
+  802c07:	53                   	push   %ebx
+  802c08:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802c0a:	c1 e8 10             	shr    $0x10,%eax
+  802c0d:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802c10:	89 c2                	mov    %eax,%edx
+  802c12:	c1 e2 0c             	shl    $0xc,%edx
+  802c15:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802c1b:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802c1e:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802c24:	89 c2                	mov    %eax,%edx
+  802c26:	c1 e2 0a             	shl    $0xa,%edx
+  802c29:	01 f2                	add    %esi,%edx
+  802c2b:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802c32:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802c38:	74 09                	je     802c43 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c3f:	5b                   	pop    %ebx
+  802c40:	5e                   	pop    %esi
+  802c41:	5d                   	pop    %ebp
+  802c42:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802c43:	e8 87 ff ff ff       	call   802bcf <page_share_send>
+  802c48:	eb f5                	jmp    802c3f <page_share_slot+0x3c>
+
+00802c4a <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802c4a:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802c4f:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802c52:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802c57:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802c5d:	74 09                	je     802c68 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802c5f:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802c64:	85 c0                	test   %eax,%eax
+  802c66:	75 01                	jne    802c69 <page_ring_ready+0x1f>
+}
+  802c68:	c3                   	ret
+{
+  802c69:	55                   	push   %ebp
+  802c6a:	89 e5                	mov    %esp,%ebp
+  802c6c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802c6f:	68 07 06 00 00       	push   $0x607
+  802c74:	6a 08                	push   $0x8
+  802c76:	68 00 30 ad de       	push   $0xdead3000
+  802c7b:	6a 00                	push   $0x0
+  802c7d:	e8 93 e3 ff ff       	call   801015 <sys_page_alloc_range>
+  802c82:	83 c4 10             	add    $0x10,%esp
+  802c85:	83 f8 08             	cmp    $0x8,%eax
+  802c88:	74 1b                	je     802ca5 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802c8a:	83 ec 04             	sub    $0x4,%esp
+  802c8d:	6a 08                	push   $0x8
+  802c8f:	68 00 30 ad de       	push   $0xdead3000
+  802c94:	6a 00                	push   $0x0
+  802c96:	e8 e8 e3 ff ff       	call   801083 <sys_page_unmap_range>
+		return 0;
+  802c9b:	83 c4 10             	add    $0x10,%esp
+  802c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ca3:	c9                   	leave
+  802ca4:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802ca5:	83 ec 0c             	sub    $0xc,%esp
+  802ca8:	68 07 04 00 00       	push   $0x407
+  802cad:	6a 08                	push   $0x8
+  802caf:	68 00 30 ad de       	push   $0xdead3000
+  802cb4:	6a 06                	push   $0x6
+  802cb6:	ff 35 40 c0 80 00    	push   0x80c040
+  802cbc:	e8 01 25 00 00       	call   8051c2 <ipc_call>
+  802cc1:	83 c4 20             	add    $0x20,%esp
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	78 14                	js     802cdc <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802cc8:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802ccd:	8b 40 48             	mov    0x48(%eax),%eax
+  802cd0:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  802cd5:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cda:	eb c7                	jmp    802ca3 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802cdc:	83 ec 04             	sub    $0x4,%esp
+  802cdf:	6a 08                	push   $0x8
+  802ce1:	68 00 30 ad de       	push   $0xdead3000
+  802ce6:	6a 00                	push   $0x0
+  802ce8:	e8 96 e3 ff ff       	call   801083 <sys_page_unmap_range>
+		return 0;
+  802ced:	83 c4 10             	add    $0x10,%esp
+  802cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf5:	eb ac                	jmp    802ca3 <page_ring_ready+0x59>
+
+00802cf7 <page_remove_slot>:
+{
+  802cf7:	55                   	push   %ebp
+  802cf8:	89 e5                	mov    %esp,%ebp
+  802cfa:	56                   	push   %esi
+  802cfb:	53                   	push   %ebx
+  802cfc:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802cfe:	89 c6                	mov    %eax,%esi
+  802d00:	c1 ee 10             	shr    $0x10,%esi
+  802d03:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802d06:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  802d0d:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  802d13:	74 2a                	je     802d3f <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802d15:	83 ec 0c             	sub    $0xc,%esp
+  802d18:	6a 00                	push   $0x0
+  802d1a:	6a 00                	push   $0x0
+  802d1c:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802d1e:	c1 e3 04             	shl    $0x4,%ebx
+  802d21:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802d24:	53                   	push   %ebx
+  802d25:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  802d2c:	e8 91 24 00 00       	call   8051c2 <ipc_call>
+  802d31:	83 c4 20             	add    $0x20,%esp
+  802d34:	85 c0                	test   %eax,%eax
+  802d36:	78 2d                	js     802d65 <page_remove_slot+0x6e>
+}
+  802d38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d3b:	5b                   	pop    %ebx
+  802d3c:	5e                   	pop    %esi
+  802d3d:	5d                   	pop    %ebp
+  802d3e:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802d3f:	e8 06 ff ff ff       	call   802c4a <page_ring_ready>
+  802d44:	85 c0                	test   %eax,%eax
+  802d46:	74 cd                	je     802d15 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802d48:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d4d:	e8 46 fe ff ff       	call   802b98 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802d52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d57:	89 da                	mov    %ebx,%edx
+  802d59:	b8 02 00 00 00       	mov    $0x2,%eax
+  802d5e:	e8 69 fd ff ff       	call   802acc <page_ring_post>
+		return;
+  802d63:	eb d3                	jmp    802d38 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802d65:	50                   	push   %eax
+  802d66:	68 68 5c 80 00       	push   $0x805c68
+  802d6b:	68 ac 03 00 00       	push   $0x3ac
+  802d70:	68 10 5c 80 00       	push   $0x805c10
+  802d75:	e8 bb d5 ff ff       	call   800335 <_panic>
+
+00802d7a <find_paging_env>:
+	if(pagingenv)
+  802d7a:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802d7f:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802d81:	85 c0                	test   %eax,%eax
+  802d83:	74 05                	je     802d8a <find_paging_env+0x10>
+  802d85:	eb 56                	jmp    802ddd <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802d87:	83 c0 01             	add    $0x1,%eax
+  802d8a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d8f:	7f 47                	jg     802dd8 <find_paging_env+0x5e>
+  802d91:	83 f9 01             	cmp    $0x1,%ecx
+  802d94:	7f 42                	jg     802dd8 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802d96:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802d99:	c1 e2 06             	shl    $0x6,%edx
+  802d9c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802da2:	8b 52 50             	mov    0x50(%edx),%edx
+  802da5:	83 fa 02             	cmp    $0x2,%edx
+  802da8:	75 dd                	jne    802d87 <find_paging_env+0xd>
+  802daa:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802dad:	c1 e2 06             	shl    $0x6,%edx
+  802db0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802db6:	8b 52 54             	mov    0x54(%edx),%edx
+  802db9:	85 d2                	test   %edx,%edx
+  802dbb:	74 ca                	je     802d87 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802dbd:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802dc0:	c1 e2 06             	shl    $0x6,%edx
+  802dc3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802dc9:	8b 52 48             	mov    0x48(%edx),%edx
+  802dcc:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  802dd3:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802dd6:	eb af                	jmp    802d87 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802dd8:	83 f9 02             	cmp    $0x2,%ecx
+  802ddb:	74 01                	je     802dde <find_paging_env+0x64>
+}
+  802ddd:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802dde:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802de3:	8b 40 48             	mov    0x48(%eax),%eax
+  802de6:	83 e0 01             	and    $0x1,%eax
+  802de9:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  802df0:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  802df5:	eb e6                	jmp    802ddd <find_paging_env+0x63>
+
+00802df7 <page_add_backed>:
+{
+  802df7:	55                   	push   %ebp
+  802df8:	89 e5                	mov    %esp,%ebp
+  802dfa:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802dfd:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  802e02:	83 f8 04             	cmp    $0x4,%eax
+  802e05:	74 35                	je     802e3c <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802e07:	89 d1                	mov    %edx,%ecx
+  802e09:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802e0f:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802e16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e19:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802e20:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802e26:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  802e2d:	83 c0 01             	add    $0x1,%eax
+  802e30:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  802e35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e3a:	5d                   	pop    %ebp
+  802e3b:	c3                   	ret
+		return -E_NO_MEM;
+  802e3c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802e41:	eb f7                	jmp    802e3a <page_add_backed+0x43>
+
+00802e43 <percentage_of_pgdir_to_walk>:
+{
+  802e43:	55                   	push   %ebp
+  802e44:	89 e5                	mov    %esp,%ebp
+  802e46:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802e49:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802e4d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802e50:	db 45 fc             	fildl  -0x4(%ebp)
+  802e53:	d8 35 f4 60 80 00    	fdivs  0x8060f4
+	return ret*ret;
+  802e59:	d8 c8                	fmul   %st(0),%st
+}
+  802e5b:	c9                   	leave
+  802e5c:	c3                   	ret
+
+00802e5d <nfu_with_aging_page_choice_func>:
+{
+  802e5d:	55                   	push   %ebp
+  802e5e:	89 e5                	mov    %esp,%ebp
+  802e60:	57                   	push   %edi
+  802e61:	56                   	push   %esi
+  802e62:	53                   	push   %ebx
+  802e63:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e66:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  802e6c:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802e6e:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802e73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e78:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e84:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802e87:	eb 18                	jmp    802ea1 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802e89:	f7 d0                	not    %eax
+  802e8b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802e90:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e92:	83 c2 01             	add    $0x1,%edx
+  802e95:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802e9b:	0f 87 13 01 00 00    	ja     802fb4 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802ea1:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ea5:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802ea8:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802ead:	89 c1                	mov    %eax,%ecx
+  802eaf:	c1 e9 0a             	shr    $0xa,%ecx
+  802eb2:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802eb9:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802ebf:	83 f9 01             	cmp    $0x1,%ecx
+  802ec2:	75 c5                	jne    802e89 <nfu_with_aging_page_choice_func+0x2c>
+  802ec4:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802ec9:	77 be                	ja     802e89 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802ecb:	89 c1                	mov    %eax,%ecx
+  802ecd:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ed0:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  802ed6:	0f 82 a5 00 00 00    	jb     802f81 <nfu_with_aging_page_choice_func+0x124>
+  802edc:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802ee2:	0f 87 99 00 00 00    	ja     802f81 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ee8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802eef:	f6 c1 01             	test   $0x1,%cl
+  802ef2:	0f 84 89 00 00 00    	je     802f81 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ef8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802eff:	f6 c5 04             	test   $0x4,%ch
+  802f02:	75 7d                	jne    802f81 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802f04:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f0b:	f6 c5 02             	test   $0x2,%ch
+  802f0e:	75 71                	jne    802f81 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802f10:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f17:	c1 e9 0c             	shr    $0xc,%ecx
+  802f1a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f1d:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802f23:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802f27:	66 83 f9 01          	cmp    $0x1,%cx
+  802f2b:	77 54                	ja     802f81 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802f2d:	89 f9                	mov    %edi,%ecx
+  802f2f:	80 f9 ff             	cmp    $0xff,%cl
+  802f32:	74 21                	je     802f55 <nfu_with_aging_page_choice_func+0xf8>
+  802f34:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f3b:	c1 e9 0c             	shr    $0xc,%ecx
+  802f3e:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f41:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802f47:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802f4b:	89 fb                	mov    %edi,%ebx
+  802f4d:	38 d9                	cmp    %bl,%cl
+  802f4f:	73 30                	jae    802f81 <nfu_with_aging_page_choice_func+0x124>
+  802f51:	dd d8                	fstp   %st(0)
+  802f53:	eb 02                	jmp    802f57 <nfu_with_aging_page_choice_func+0xfa>
+  802f55:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802f57:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802f5e:	c1 e9 0c             	shr    $0xc,%ecx
+  802f61:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802f64:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802f6b:	89 fb                	mov    %edi,%ebx
+  802f6d:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802f70:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802f73:	db 45 e0             	fildl  -0x20(%ebp)
+  802f76:	d8 35 f4 60 80 00    	fdivs  0x8060f4
+	return ret*ret;
+  802f7c:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802f7e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802f81:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802f84:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802f87:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802f8e:	df 6d e0             	fildll -0x20(%ebp)
+  802f91:	d9 c1                	fld    %st(1)
+  802f93:	d8 0d f8 60 80 00    	fmuls  0x8060f8
+  802f99:	d9 c9                	fxch   %st(1)
+  802f9b:	df f1                	fcomip %st(1),%st
+  802f9d:	dd d8                	fstp   %st(0)
+  802f9f:	0f 82 ed fe ff ff    	jb     802e92 <nfu_with_aging_page_choice_func+0x35>
+  802fa5:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802fa7:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  802fac:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802faf:	c1 e0 0c             	shl    $0xc,%eax
+  802fb2:	eb 0e                	jmp    802fc2 <nfu_with_aging_page_choice_func+0x165>
+  802fb4:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802fb6:	89 f8                	mov    %edi,%eax
+  802fb8:	3c ff                	cmp    $0xff,%al
+  802fba:	74 0e                	je     802fca <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802fbc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802fbf:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802fc2:	83 c4 14             	add    $0x14,%esp
+  802fc5:	5b                   	pop    %ebx
+  802fc6:	5e                   	pop    %esi
+  802fc7:	5f                   	pop    %edi
+  802fc8:	5d                   	pop    %ebp
+  802fc9:	c3                   	ret
+	pgnum = 0;
+  802fca:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  802fd1:	00 00 00 
+	return (void*)UTOP;
+  802fd4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802fd9:	eb e7                	jmp    802fc2 <nfu_with_aging_page_choice_func+0x165>
+
+00802fdb <myRand>:
+    state = state * 1664525 + 1013904223;
+  802fdb:	69 05 44 70 80 00 0d 	imul   $0x19660d,0x807044,%eax
+  802fe2:	66 19 00 
+  802fe5:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802fea:	a3 44 70 80 00       	mov    %eax,0x807044
+    return state >> 24;
+  802fef:	c1 e8 18             	shr    $0x18,%eax
+}
+  802ff2:	c3                   	ret
+
+00802ff3 <random_page_choice_func>:
+{
+  802ff3:	55                   	push   %ebp
+  802ff4:	89 e5                	mov    %esp,%ebp
+  802ff6:	57                   	push   %edi
+  802ff7:	56                   	push   %esi
+  802ff8:	53                   	push   %ebx
+  802ff9:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ffc:	be 00 00 00 00       	mov    $0x0,%esi
+  803001:	eb 19                	jmp    80301c <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803003:	f7 d3                	not    %ebx
+  803005:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80300b:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80300d:	83 c6 01             	add    $0x1,%esi
+  803010:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  803016:	0f 87 a0 00 00 00    	ja     8030bc <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80301c:	89 f3                	mov    %esi,%ebx
+  80301e:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  803024:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80302a:	89 d8                	mov    %ebx,%eax
+  80302c:	c1 e8 0a             	shr    $0xa,%eax
+  80302f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803036:	25 81 00 00 00       	and    $0x81,%eax
+  80303b:	83 f8 01             	cmp    $0x1,%eax
+  80303e:	75 c3                	jne    803003 <random_page_choice_func+0x10>
+  803040:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803046:	77 bb                	ja     803003 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  803048:	89 df                	mov    %ebx,%edi
+  80304a:	c1 e7 0c             	shl    $0xc,%edi
+  80304d:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  803050:	89 f8                	mov    %edi,%eax
+  803052:	e8 06 f9 ff ff       	call   80295d <page_is_clean>
+  803057:	84 c0                	test   %al,%al
+  803059:	0f 85 82 00 00 00    	jne    8030e1 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80305f:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  803065:	72 a6                	jb     80300d <random_page_choice_func+0x1a>
+  803067:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  80306d:	77 9e                	ja     80300d <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80306f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803076:	a8 01                	test   $0x1,%al
+  803078:	74 93                	je     80300d <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80307a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803081:	f6 c4 04             	test   $0x4,%ah
+  803084:	75 87                	jne    80300d <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803086:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80308d:	f6 c4 02             	test   $0x2,%ah
+  803090:	0f 85 77 ff ff ff    	jne    80300d <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803096:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80309d:	c1 e8 0c             	shr    $0xc,%eax
+  8030a0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8030a3:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8030a8:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8030ac:	66 83 f8 01          	cmp    $0x1,%ax
+  8030b0:	0f 87 57 ff ff ff    	ja     80300d <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  8030b6:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8030bc:	e8 1a ff ff ff       	call   802fdb <myRand>
+  8030c1:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  8030c7:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  8030cc:	29 fe                	sub    %edi,%esi
+  8030ce:	0f be c0             	movsbl %al,%eax
+  8030d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d6:	f7 f6                	div    %esi
+  8030d8:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8030da:	bb 15 00 00 00       	mov    $0x15,%ebx
+  8030df:	eb 1c                	jmp    8030fd <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  8030e1:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  8030e7:	e9 8f 00 00 00       	jmp    80317b <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8030ec:	e8 ea fe ff ff       	call   802fdb <myRand>
+  8030f1:	0f be c0             	movsbl %al,%eax
+  8030f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f9:	f7 f6                	div    %esi
+  8030fb:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8030fd:	83 eb 01             	sub    $0x1,%ebx
+  803100:	0f 84 c2 00 00 00    	je     8031c8 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  803106:	89 d0                	mov    %edx,%eax
+  803108:	c1 e8 0a             	shr    $0xa,%eax
+  80310b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803112:	25 81 00 00 00       	and    $0x81,%eax
+  803117:	83 f8 01             	cmp    $0x1,%eax
+  80311a:	75 d0                	jne    8030ec <random_page_choice_func+0xf9>
+  80311c:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  803122:	77 c8                	ja     8030ec <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  803124:	89 d0                	mov    %edx,%eax
+  803126:	c1 e0 0c             	shl    $0xc,%eax
+  803129:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  80312e:	72 56                	jb     803186 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  803130:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  803135:	77 65                	ja     80319c <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  803137:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  80313e:	f6 c1 01             	test   $0x1,%cl
+  803141:	74 59                	je     80319c <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  803143:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  80314a:	f6 c5 04             	test   $0x4,%ch
+  80314d:	75 4d                	jne    80319c <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  80314f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  803156:	f6 c5 02             	test   $0x2,%ch
+  803159:	75 41                	jne    80319c <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  80315b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  803162:	c1 ea 0c             	shr    $0xc,%edx
+  803165:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  803168:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  80316e:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  803172:	66 83 fa 01          	cmp    $0x1,%dx
+  803176:	77 3a                	ja     8031b2 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  803178:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  80317b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80317e:	83 c4 1c             	add    $0x1c,%esp
+  803181:	5b                   	pop    %ebx
+  803182:	5e                   	pop    %esi
+  803183:	5f                   	pop    %edi
+  803184:	5d                   	pop    %ebp
+  803185:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803186:	e8 50 fe ff ff       	call   802fdb <myRand>
+  80318b:	0f be c0             	movsbl %al,%eax
+  80318e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803193:	f7 f6                	div    %esi
+  803195:	01 fa                	add    %edi,%edx
+			continue;
+  803197:	e9 61 ff ff ff       	jmp    8030fd <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  80319c:	e8 3a fe ff ff       	call   802fdb <myRand>
+  8031a1:	0f be c0             	movsbl %al,%eax
+  8031a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031a9:	f7 f6                	div    %esi
+  8031ab:	01 fa                	add    %edi,%edx
+			continue;
+  8031ad:	e9 4b ff ff ff       	jmp    8030fd <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  8031b2:	e8 24 fe ff ff       	call   802fdb <myRand>
+  8031b7:	0f be c0             	movsbl %al,%eax
+  8031ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031bf:	f7 f6                	div    %esi
+  8031c1:	01 fa                	add    %edi,%edx
+			continue;
+  8031c3:	e9 35 ff ff ff       	jmp    8030fd <random_page_choice_func+0x10a>
+	pgnum = 0;
+  8031c8:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  8031cf:	00 00 00 
+	return (void*)UTOP;
+  8031d2:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  8031d9:	eb a0                	jmp    80317b <random_page_choice_func+0x188>
+
+008031db <nfu>:
+{
+  8031db:	55                   	push   %ebp
+  8031dc:	89 e5                	mov    %esp,%ebp
+  8031de:	57                   	push   %edi
+  8031df:	56                   	push   %esi
+  8031e0:	53                   	push   %ebx
+  8031e1:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031e4:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  8031ea:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  8031ec:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8031f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031f6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8031fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803202:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803205:	eb 18                	jmp    80321f <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803207:	f7 d0                	not    %eax
+  803209:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80320e:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803210:	83 c2 01             	add    $0x1,%edx
+  803213:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803219:	0f 87 13 01 00 00    	ja     803332 <nfu+0x157>
+		++num_searched_ptes;
+  80321f:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803223:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  803226:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80322b:	89 c1                	mov    %eax,%ecx
+  80322d:	c1 e9 0a             	shr    $0xa,%ecx
+  803230:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803237:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80323d:	83 f9 01             	cmp    $0x1,%ecx
+  803240:	75 c5                	jne    803207 <nfu+0x2c>
+  803242:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803247:	77 be                	ja     803207 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803249:	89 c1                	mov    %eax,%ecx
+  80324b:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80324e:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  803254:	0f 82 a5 00 00 00    	jb     8032ff <nfu+0x124>
+  80325a:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803260:	0f 87 99 00 00 00    	ja     8032ff <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803266:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80326d:	f6 c1 01             	test   $0x1,%cl
+  803270:	0f 84 89 00 00 00    	je     8032ff <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803276:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80327d:	f6 c5 04             	test   $0x4,%ch
+  803280:	75 7d                	jne    8032ff <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803282:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803289:	f6 c5 02             	test   $0x2,%ch
+  80328c:	75 71                	jne    8032ff <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80328e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803295:	c1 e9 0c             	shr    $0xc,%ecx
+  803298:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80329b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032a1:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8032a5:	66 83 f9 01          	cmp    $0x1,%cx
+  8032a9:	77 54                	ja     8032ff <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  8032ab:	89 f9                	mov    %edi,%ecx
+  8032ad:	80 f9 ff             	cmp    $0xff,%cl
+  8032b0:	74 21                	je     8032d3 <nfu+0xf8>
+  8032b2:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032b9:	c1 e9 0c             	shr    $0xc,%ecx
+  8032bc:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032bf:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032c5:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  8032c9:	89 fb                	mov    %edi,%ebx
+  8032cb:	38 d9                	cmp    %bl,%cl
+  8032cd:	73 30                	jae    8032ff <nfu+0x124>
+  8032cf:	dd d8                	fstp   %st(0)
+  8032d1:	eb 02                	jmp    8032d5 <nfu+0xfa>
+  8032d3:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  8032d5:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032dc:	c1 e9 0c             	shr    $0xc,%ecx
+  8032df:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032e2:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8032e9:	89 fb                	mov    %edi,%ebx
+  8032eb:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8032ee:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8032f1:	db 45 e0             	fildl  -0x20(%ebp)
+  8032f4:	d8 35 f4 60 80 00    	fdivs  0x8060f4
+	return ret*ret;
+  8032fa:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8032fc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8032ff:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803302:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803305:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80330c:	df 6d e0             	fildll -0x20(%ebp)
+  80330f:	d9 c1                	fld    %st(1)
+  803311:	d8 0d f8 60 80 00    	fmuls  0x8060f8
+  803317:	d9 c9                	fxch   %st(1)
+  803319:	df f1                	fcomip %st(1),%st
+  80331b:	dd d8                	fstp   %st(0)
+  80331d:	0f 82 ed fe ff ff    	jb     803210 <nfu+0x35>
+  803323:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803325:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  80332a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80332d:	c1 e0 0c             	shl    $0xc,%eax
+  803330:	eb 0e                	jmp    803340 <nfu+0x165>
+  803332:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803334:	89 f8                	mov    %edi,%eax
+  803336:	3c ff                	cmp    $0xff,%al
+  803338:	74 0e                	je     803348 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  80333a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80333d:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803340:	83 c4 14             	add    $0x14,%esp
+  803343:	5b                   	pop    %ebx
+  803344:	5e                   	pop    %esi
+  803345:	5f                   	pop    %edi
+  803346:	5d                   	pop    %ebp
+  803347:	c3                   	ret
+	pgnum = 0;
+  803348:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  80334f:	00 00 00 
+	return (void*)UTOP;
+  803352:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803357:	eb e7                	jmp    803340 <nfu+0x165>
+
+00803359 <lru>:
+{
+  803359:	55                   	push   %ebp
+  80335a:	89 e5                	mov    %esp,%ebp
+  80335c:	57                   	push   %edi
+  80335d:	56                   	push   %esi
+  80335e:	53                   	push   %ebx
+  80335f:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803362:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  803368:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  80336f:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803376:	be 00 00 00 00       	mov    $0x0,%esi
+  80337b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803382:	ba 00 00 00 00       	mov    $0x0,%edx
+  803387:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  80338a:	eb 18                	jmp    8033a4 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80338c:	f7 d0                	not    %eax
+  80338e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803393:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803395:	83 c2 01             	add    $0x1,%edx
+  803398:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80339e:	0f 87 fa 00 00 00    	ja     80349e <lru+0x145>
+		++num_searched_ptes;
+  8033a4:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8033a7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8033aa:	01 d0                	add    %edx,%eax
+  8033ac:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8033b1:	89 c1                	mov    %eax,%ecx
+  8033b3:	c1 e9 0a             	shr    $0xa,%ecx
+  8033b6:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8033bd:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8033c3:	83 f9 01             	cmp    $0x1,%ecx
+  8033c6:	75 c4                	jne    80338c <lru+0x33>
+  8033c8:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8033cd:	77 bd                	ja     80338c <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8033cf:	89 c1                	mov    %eax,%ecx
+  8033d1:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8033d4:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8033da:	0f 87 92 00 00 00    	ja     803472 <lru+0x119>
+  8033e0:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  8033e6:	0f 82 86 00 00 00    	jb     803472 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8033ec:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8033f3:	f6 c1 01             	test   $0x1,%cl
+  8033f6:	74 7a                	je     803472 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8033f8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8033ff:	f6 c5 04             	test   $0x4,%ch
+  803402:	75 6e                	jne    803472 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803404:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80340b:	f6 c5 02             	test   $0x2,%ch
+  80340e:	75 62                	jne    803472 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803410:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803417:	c1 e9 0c             	shr    $0xc,%ecx
+  80341a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80341d:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803423:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803427:	66 83 f9 01          	cmp    $0x1,%cx
+  80342b:	77 45                	ja     803472 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  80342d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803434:	c1 e9 0c             	shr    $0xc,%ecx
+  803437:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80343a:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803440:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803443:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803446:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803449:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80344c:	19 df                	sbb    %ebx,%edi
+  80344e:	7c 22                	jl     803472 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803450:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803457:	c1 e9 0c             	shr    $0xc,%ecx
+  80345a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80345d:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803463:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803466:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803469:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  80346c:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80346f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803472:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  803475:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80347c:	df 6d e0             	fildll -0x20(%ebp)
+  80347f:	d9 05 f8 60 80 00    	flds   0x8060f8
+  803485:	d9 c9                	fxch   %st(1)
+  803487:	df f1                	fcomip %st(1),%st
+  803489:	dd d8                	fstp   %st(0)
+  80348b:	0f 82 04 ff ff ff    	jb     803395 <lru+0x3c>
+			pgnum = pgnum_actual;
+  803491:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  803496:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803499:	c1 e0 0c             	shl    $0xc,%eax
+  80349c:	eb 06                	jmp    8034a4 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  80349e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8034a1:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8034a4:	83 c4 1c             	add    $0x1c,%esp
+  8034a7:	5b                   	pop    %ebx
+  8034a8:	5e                   	pop    %esi
+  8034a9:	5f                   	pop    %edi
+  8034aa:	5d                   	pop    %ebp
+  8034ab:	c3                   	ret
+
+008034ac <set_page_choice_func>:
+{
+  8034ac:	55                   	push   %ebp
+  8034ad:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  8034af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b2:	a3 40 70 80 00       	mov    %eax,0x807040
+}
+  8034b7:	5d                   	pop    %ebp
+  8034b8:	c3                   	ret
+
+008034b9 <get_page_choice>:
+{
+  8034b9:	55                   	push   %ebp
+  8034ba:	89 e5                	mov    %esp,%ebp
+  8034bc:	57                   	push   %edi
+  8034bd:	56                   	push   %esi
+  8034be:	53                   	push   %ebx
+  8034bf:	83 ec 24             	sub    $0x24,%esp
+  8034c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034c5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  8034c8:	57                   	push   %edi
+  8034c9:	56                   	push   %esi
+  8034ca:	ff 15 40 70 80 00    	call   *0x807040
+  8034d0:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8034d2:	83 c4 10             	add    $0x10,%esp
+  8034d5:	eb 25                	jmp    8034fc <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  8034d7:	83 ec 08             	sub    $0x8,%esp
+  8034da:	c1 e0 16             	shl    $0x16,%eax
+  8034dd:	50                   	push   %eax
+  8034de:	6a 00                	push   $0x0
+  8034e0:	e8 cc da ff ff       	call   800fb1 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8034e5:	83 c4 10             	add    $0x10,%esp
+  8034e8:	85 c0                	test   %eax,%eax
+  8034ea:	75 43                	jne    80352f <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  8034ec:	83 ec 08             	sub    $0x8,%esp
+  8034ef:	57                   	push   %edi
+  8034f0:	56                   	push   %esi
+  8034f1:	ff 15 40 70 80 00    	call   *0x807040
+  8034f7:	89 c3                	mov    %eax,%ebx
+  8034f9:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  8034fc:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  8034ff:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803505:	0f 86 ae 00 00 00    	jbe    8035b9 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80350b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803510:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803517:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80351d:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803523:	74 b2                	je     8034d7 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803525:	83 c0 01             	add    $0x1,%eax
+  803528:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  80352d:	75 e1                	jne    803510 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  80352f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803532:	05 00 10 40 11       	add    $0x11401000,%eax
+  803537:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80353c:	76 1f                	jbe    80355d <get_page_choice+0xa4>
+		return (void *) UTOP;
+  80353e:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  803543:	89 d8                	mov    %ebx,%eax
+  803545:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803548:	5b                   	pop    %ebx
+  803549:	5e                   	pop    %esi
+  80354a:	5f                   	pop    %edi
+  80354b:	5d                   	pop    %ebp
+  80354c:	c3                   	ret
+		sys_page_split(0, pg_out);
+  80354d:	83 ec 08             	sub    $0x8,%esp
+  803550:	53                   	push   %ebx
+  803551:	6a 00                	push   $0x0
+  803553:	e8 59 da ff ff       	call   800fb1 <sys_page_split>
+  803558:	83 c4 10             	add    $0x10,%esp
+  80355b:	eb 6c                	jmp    8035c9 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  80355d:	83 ec 04             	sub    $0x4,%esp
+  803560:	68 a0 5c 80 00       	push   $0x805ca0
+  803565:	68 cc 01 00 00       	push   $0x1cc
+  80356a:	68 10 5c 80 00       	push   $0x805c10
+  80356f:	e8 c1 cd ff ff       	call   800335 <_panic>
+		panic("We tried to page out code pages\n");
+  803574:	83 ec 04             	sub    $0x4,%esp
+  803577:	68 d0 5c 80 00       	push   $0x805cd0
+  80357c:	68 d6 01 00 00       	push   $0x1d6
+  803581:	68 10 5c 80 00       	push   $0x805c10
+  803586:	e8 aa cd ff ff       	call   800335 <_panic>
+		panic("Invalid mapping for the va\n");
+  80358b:	83 ec 04             	sub    $0x4,%esp
+  80358e:	68 1d 5c 80 00       	push   $0x805c1d
+  803593:	68 da 01 00 00       	push   $0x1da
+  803598:	68 10 5c 80 00       	push   $0x805c10
+  80359d:	e8 93 cd ff ff       	call   800335 <_panic>
+		panic("We tried to page out a shared page\n");
+  8035a2:	83 ec 04             	sub    $0x4,%esp
+  8035a5:	68 f4 5c 80 00       	push   $0x805cf4
+  8035aa:	68 e0 01 00 00       	push   $0x1e0
+  8035af:	68 10 5c 80 00       	push   $0x805c10
+  8035b4:	e8 7c cd ff ff       	call   800335 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  8035b9:	89 de                	mov    %ebx,%esi
+  8035bb:	c1 ee 16             	shr    $0x16,%esi
+  8035be:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8035c5:	a8 80                	test   $0x80,%al
+  8035c7:	75 84                	jne    80354d <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8035c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035cc:	05 00 10 40 11       	add    $0x11401000,%eax
+  8035d1:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8035d6:	76 85                	jbe    80355d <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  8035d8:	89 d8                	mov    %ebx,%eax
+  8035da:	e8 7e f3 ff ff       	call   80295d <page_is_clean>
+  8035df:	84 c0                	test   %al,%al
+  8035e1:	0f 85 5c ff ff ff    	jne    803543 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  8035e7:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  8035ee:	76 84                	jbe    803574 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  8035f0:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  8035f7:	a8 01                	test   $0x1,%al
+  8035f9:	74 90                	je     80358b <get_page_choice+0xd2>
+  8035fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035fe:	c1 e8 0c             	shr    $0xc,%eax
+  803601:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803608:	f6 c2 01             	test   $0x1,%dl
+  80360b:	0f 84 7a ff ff ff    	je     80358b <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803611:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803618:	f6 c2 01             	test   $0x1,%dl
+  80361b:	74 85                	je     8035a2 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80361d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803624:	f6 c2 01             	test   $0x1,%dl
+  803627:	0f 84 75 ff ff ff    	je     8035a2 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80362d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803634:	f6 c6 04             	test   $0x4,%dh
+  803637:	0f 85 65 ff ff ff    	jne    8035a2 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  80363d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803644:	f6 c6 02             	test   $0x2,%dh
+  803647:	0f 85 55 ff ff ff    	jne    8035a2 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  80364d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803654:	c1 e8 0c             	shr    $0xc,%eax
+  803657:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80365a:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80365f:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803663:	66 83 f8 01          	cmp    $0x1,%ax
+  803667:	0f 86 d6 fe ff ff    	jbe    803543 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  80366d:	83 ec 04             	sub    $0x4,%esp
+  803670:	68 18 5d 80 00       	push   $0x805d18
+  803675:	68 e2 01 00 00       	push   $0x1e2
+  80367a:	68 10 5c 80 00       	push   $0x805c10
+  80367f:	e8 b1 cc ff ff       	call   800335 <_panic>
+
+00803684 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  803684:	55                   	push   %ebp
+  803685:	89 e5                	mov    %esp,%ebp
+  803687:	57                   	push   %edi
+  803688:	56                   	push   %esi
+  803689:	53                   	push   %ebx
+  80368a:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  80368d:	e8 e8 f6 ff ff       	call   802d7a <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803692:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803697:	85 c0                	test   %eax,%eax
+  803699:	74 41                	je     8036dc <page_share_paged_out+0x58>
+  80369b:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8036a2:	0f 84 fd 00 00 00    	je     8037a5 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  8036a8:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8036af:	00 00 00 
+  8036b2:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  8036b9:	00 00 00 
+  8036bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c1:	eb 2c                	jmp    8036ef <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  8036c3:	83 c3 04             	add    $0x4,%ebx
+  8036c6:	39 f3                	cmp    %esi,%ebx
+  8036c8:	74 1a                	je     8036e4 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  8036ca:	8b 03                	mov    (%ebx),%eax
+  8036cc:	a8 01                	test   $0x1,%al
+  8036ce:	74 f3                	je     8036c3 <page_share_paged_out+0x3f>
+  8036d0:	c1 e8 0c             	shr    $0xc,%eax
+  8036d3:	e8 2b f5 ff ff       	call   802c03 <page_share_slot>
+  8036d8:	85 c0                	test   %eax,%eax
+  8036da:	79 e7                	jns    8036c3 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  8036dc:	83 c4 0c             	add    $0xc,%esp
+  8036df:	5b                   	pop    %ebx
+  8036e0:	5e                   	pop    %esi
+  8036e1:	5f                   	pop    %edi
+  8036e2:	5d                   	pop    %ebp
+  8036e3:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  8036e4:	83 c7 04             	add    $0x4,%edi
+  8036e7:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  8036ed:	74 1b                	je     80370a <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  8036ef:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  8036f4:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  8036f7:	f6 c3 01             	test   $0x1,%bl
+  8036fa:	74 e8                	je     8036e4 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  8036fc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803702:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803708:	eb bc                	jmp    8036c6 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80370a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80370f:	eb 11                	jmp    803722 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803711:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803717:	83 c3 01             	add    $0x1,%ebx
+  80371a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803720:	77 41                	ja     803763 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803722:	89 d8                	mov    %ebx,%eax
+  803724:	c1 e8 0a             	shr    $0xa,%eax
+  803727:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80372e:	25 81 00 00 00       	and    $0x81,%eax
+  803733:	83 f8 01             	cmp    $0x1,%eax
+  803736:	75 d9                	jne    803711 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803738:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80373f:	25 81 00 00 00       	and    $0x81,%eax
+  803744:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803749:	75 cc                	jne    803717 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  80374b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803752:	c1 e8 0c             	shr    $0xc,%eax
+  803755:	e8 a9 f4 ff ff       	call   802c03 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  80375a:	85 c0                	test   %eax,%eax
+  80375c:	79 b9                	jns    803717 <page_share_paged_out+0x93>
+  80375e:	e9 79 ff ff ff       	jmp    8036dc <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803763:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80376a:	75 13                	jne    80377f <page_share_paged_out+0xfb>
+  80376c:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  803773:	75 1d                	jne    803792 <page_share_paged_out+0x10e>
+	return 0;
+  803775:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377a:	e9 5d ff ff ff       	jmp    8036dc <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80377f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803784:	e8 46 f4 ff ff       	call   802bcf <page_share_send>
+  803789:	85 c0                	test   %eax,%eax
+  80378b:	79 df                	jns    80376c <page_share_paged_out+0xe8>
+  80378d:	e9 4a ff ff ff       	jmp    8036dc <page_share_paged_out+0x58>
+  803792:	b8 01 00 00 00       	mov    $0x1,%eax
+  803797:	e8 33 f4 ff ff       	call   802bcf <page_share_send>
+  80379c:	85 c0                	test   %eax,%eax
+  80379e:	79 d5                	jns    803775 <page_share_paged_out+0xf1>
+  8037a0:	e9 37 ff ff ff       	jmp    8036dc <page_share_paged_out+0x58>
+		return 0;
+  8037a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037aa:	e9 2d ff ff ff       	jmp    8036dc <page_share_paged_out+0x58>
+
+008037af <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  8037af:	55                   	push   %ebp
+  8037b0:	89 e5                	mov    %esp,%ebp
+  8037b2:	56                   	push   %esi
+  8037b3:	53                   	push   %ebx
+  8037b4:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  8037b7:	e8 be f5 ff ff       	call   802d7a <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  8037bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  8037c1:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8037c8:	0f 84 82 00 00 00    	je     803850 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  8037ce:	83 ec 0c             	sub    $0xc,%esp
+  8037d1:	68 00 10 00 00       	push   $0x1000
+  8037d6:	e8 84 11 00 00       	call   80495f <malloc>
+  8037db:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  8037dd:	83 c4 0c             	add    $0xc,%esp
+  8037e0:	6a 14                	push   $0x14
+  8037e2:	6a 00                	push   $0x0
+  8037e4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8037e7:	50                   	push   %eax
+  8037e8:	e8 5b d3 ff ff       	call   800b48 <memset>
+  8037ed:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  8037f0:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  8037f5:	83 ec 0c             	sub    $0xc,%esp
+  8037f8:	6a 07                	push   $0x7
+  8037fa:	6a 01                	push   $0x1
+  8037fc:	53                   	push   %ebx
+  8037fd:	6a 03                	push   $0x3
+  8037ff:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  803806:	e8 b7 19 00 00       	call   8051c2 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  80380b:	8b 03                	mov    (%ebx),%eax
+  80380d:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803810:	8b 43 04             	mov    0x4(%ebx),%eax
+  803813:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803816:	8b 43 08             	mov    0x8(%ebx),%eax
+  803819:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80381c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80381f:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803822:	8b 43 10             	mov    0x10(%ebx),%eax
+  803825:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803828:	83 c6 01             	add    $0x1,%esi
+  80382b:	83 c4 20             	add    $0x20,%esp
+  80382e:	83 fe 02             	cmp    $0x2,%esi
+  803831:	75 c2                	jne    8037f5 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803833:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803836:	89 03                	mov    %eax,(%ebx)
+  803838:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80383b:	89 43 04             	mov    %eax,0x4(%ebx)
+  80383e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803841:	89 43 08             	mov    %eax,0x8(%ebx)
+  803844:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803847:	89 43 0c             	mov    %eax,0xc(%ebx)
+  80384a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80384d:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803850:	89 d8                	mov    %ebx,%eax
+  803852:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803855:	5b                   	pop    %ebx
+  803856:	5e                   	pop    %esi
+  803857:	5d                   	pop    %ebp
+  803858:	c3                   	ret
+
+00803859 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803859:	55                   	push   %ebp
+  80385a:	89 e5                	mov    %esp,%ebp
+  80385c:	53                   	push   %ebx
+  80385d:	83 ec 10             	sub    $0x10,%esp
+  803860:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803863:	68 37 5c 80 00       	push   $0x805c37
+  803868:	e8 a3 cb ff ff       	call   800410 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  80386d:	83 c4 08             	add    $0x8,%esp
+  803870:	ff 33                	push   (%ebx)
+  803872:	68 4c 5d 80 00       	push   $0x805d4c
+  803877:	e8 94 cb ff ff       	call   800410 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  80387c:	83 c4 08             	add    $0x8,%esp
+  80387f:	ff 73 04             	push   0x4(%ebx)
+  803882:	68 39 5c 80 00       	push   $0x805c39
+  803887:	e8 84 cb ff ff       	call   800410 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  80388c:	83 c4 08             	add    $0x8,%esp
+  80388f:	ff 73 08             	push   0x8(%ebx)
+  803892:	68 6c 5d 80 00       	push   $0x805d6c
+  803897:	e8 74 cb ff ff       	call   800410 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  80389c:	83 c4 08             	add    $0x8,%esp
+  80389f:	ff 73 0c             	push   0xc(%ebx)
+  8038a2:	68 90 5d 80 00       	push   $0x805d90
+  8038a7:	e8 64 cb ff ff       	call   800410 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  8038ac:	83 c4 08             	add    $0x8,%esp
+  8038af:	ff 73 10             	push   0x10(%ebx)
+  8038b2:	68 b4 5d 80 00       	push   $0x805db4
+  8038b7:	e8 54 cb ff ff       	call   800410 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  8038bc:	83 c4 08             	add    $0x8,%esp
+  8038bf:	ff 35 08 c0 80 00    	push   0x80c008
+  8038c5:	68 f0 5d 80 00       	push   $0x805df0
+  8038ca:	e8 41 cb ff ff       	call   800410 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  8038cf:	83 c4 08             	add    $0x8,%esp
+  8038d2:	ff 35 04 c0 80 00    	push   0x80c004
+  8038d8:	68 24 5e 80 00       	push   $0x805e24
+  8038dd:	e8 2e cb ff ff       	call   800410 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  8038e2:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8038e7:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  8038ea:	8b 50 68             	mov    0x68(%eax),%edx
+  8038ed:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  8038f0:	51                   	push   %ecx
+  8038f1:	52                   	push   %edx
+  8038f2:	50                   	push   %eax
+  8038f3:	68 64 5e 80 00       	push   $0x805e64
+  8038f8:	e8 13 cb ff ff       	call   800410 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8038fd:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803902:	8b 40 70             	mov    0x70(%eax),%eax
+  803905:	83 c4 18             	add    $0x18,%esp
+  803908:	50                   	push   %eax
+  803909:	68 98 5e 80 00       	push   $0x805e98
+  80390e:	e8 fd ca ff ff       	call   800410 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803913:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803919:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  80391f:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803924:	51                   	push   %ecx
+  803925:	52                   	push   %edx
+  803926:	50                   	push   %eax
+  803927:	68 c8 5e 80 00       	push   $0x805ec8
+  80392c:	e8 df ca ff ff       	call   800410 <cprintf>
+	cprintf("\n");
+  803931:	83 c4 14             	add    $0x14,%esp
+  803934:	68 37 5c 80 00       	push   $0x805c37
+  803939:	e8 d2 ca ff ff       	call   800410 <cprintf>
+}
+  80393e:	83 c4 10             	add    $0x10,%esp
+  803941:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803944:	c9                   	leave
+  803945:	c3                   	ret
+
+00803946 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803946:	55                   	push   %ebp
+  803947:	89 e5                	mov    %esp,%ebp
+  803949:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  80394c:	e8 5e fe ff ff       	call   8037af <get_paging_stats>
+  803951:	83 ec 0c             	sub    $0xc,%esp
+  803954:	50                   	push   %eax
+  803955:	e8 ff fe ff ff       	call   803859 <print_paging_stats>
+}
+  80395a:	83 c4 10             	add    $0x10,%esp
+  80395d:	c9                   	leave
+  80395e:	c3                   	ret
+
+0080395f <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  80395f:	55                   	push   %ebp
+  803960:	89 e5                	mov    %esp,%ebp
+  803962:	53                   	push   %ebx
+  803963:	83 ec 04             	sub    $0x4,%esp
+  803966:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803969:	eb 13                	jmp    80397e <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  80396b:	83 ec 04             	sub    $0x4,%esp
+  80396e:	6a ff                	push   $0xffffffff
+  803970:	53                   	push   %ebx
+  803971:	68 00 f0 ff ee       	push   $0xeefff000
+  803976:	e8 48 da ff ff       	call   8013c3 <sys_futex_wait>
+  80397b:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  80397e:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803983:	39 d8                	cmp    %ebx,%eax
+  803985:	74 e4                	je     80396b <mem_pressure_wait+0xc>
+	return now;
+}
+  803987:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80398a:	c9                   	leave
+  80398b:	c3                   	ret
+
+0080398c <init_map_dir>:
+
+void
+init_map_dir()
+{
+  80398c:	55                   	push   %ebp
+  80398d:	89 e5                	mov    %esp,%ebp
+  80398f:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803992:	68 fe 45 80 00       	push   $0x8045fe
+  803997:	e8 32 16 00 00       	call   804fce <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  80399c:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  8039a3:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  8039a6:	83 c4 0c             	add    $0xc,%esp
+  8039a9:	68 07 02 00 00       	push   $0x207
+  8039ae:	68 00 b0 ad de       	push   $0xdeadb000
+  8039b3:	6a 00                	push   $0x0
+  8039b5:	e8 30 d5 ff ff       	call   800eea <sys_page_alloc>
+  8039ba:	83 c4 10             	add    $0x10,%esp
+  8039bd:	85 c0                	test   %eax,%eax
+  8039bf:	78 0c                	js     8039cd <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  8039c1:	e8 b4 f3 ff ff       	call   802d7a <find_paging_env>
+	page_ring_ready();
+  8039c6:	e8 7f f2 ff ff       	call   802c4a <page_ring_ready>
+}
+  8039cb:	c9                   	leave
+  8039cc:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  8039cd:	50                   	push   %eax
+  8039ce:	68 57 5c 80 00       	push   $0x805c57
+  8039d3:	68 13 05 00 00       	push   $0x513
+  8039d8:	68 10 5c 80 00       	push   $0x805c10
+  8039dd:	e8 53 c9 ff ff       	call   800335 <_panic>
+
+008039e2 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  8039e2:	55                   	push   %ebp
+  8039e3:	89 e5                	mov    %esp,%ebp
+  8039e5:	57                   	push   %edi
+  8039e6:	56                   	push   %esi
+  8039e7:	53                   	push   %ebx
+  8039e8:	83 ec 0c             	sub    $0xc,%esp
+  8039eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  8039ee:	89 fa                	mov    %edi,%edx
+  8039f0:	c1 ea 16             	shr    $0x16,%edx
+  8039f3:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  8039f8:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8039fb:	f6 06 01             	testb  $0x1,(%esi)
+  8039fe:	75 3e                	jne    803a3e <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803a00:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803a05:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803a09:	74 47                	je     803a52 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803a0b:	83 ec 0c             	sub    $0xc,%esp
+  803a0e:	6a 01                	push   $0x1
+  803a10:	e8 f2 11 00 00       	call   804c07 <va_alloc>
+  803a15:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803a17:	83 c4 10             	add    $0x10,%esp
+  803a1a:	85 c0                	test   %eax,%eax
+  803a1c:	74 34                	je     803a52 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803a1e:	6a 00                	push   $0x0
+  803a20:	68 07 02 00 00       	push   $0x207
+  803a25:	50                   	push   %eax
+  803a26:	6a 00                	push   $0x0
+  803a28:	e8 df 02 00 00       	call   803d0c <page_alloc>
+  803a2d:	83 c4 10             	add    $0x10,%esp
+  803a30:	85 c0                	test   %eax,%eax
+  803a32:	78 28                	js     803a5c <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803a34:	f6 06 01             	testb  $0x1,(%esi)
+  803a37:	75 38                	jne    803a71 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803a39:	83 cb 01             	or     $0x1,%ebx
+  803a3c:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803a3e:	89 f8                	mov    %edi,%eax
+  803a40:	c1 e8 0a             	shr    $0xa,%eax
+  803a43:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803a48:	8b 1e                	mov    (%esi),%ebx
+  803a4a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803a50:	01 c3                	add    %eax,%ebx
+}
+  803a52:	89 d8                	mov    %ebx,%eax
+  803a54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a57:	5b                   	pop    %ebx
+  803a58:	5e                   	pop    %esi
+  803a59:	5f                   	pop    %edi
+  803a5a:	5d                   	pop    %ebp
+  803a5b:	c3                   	ret
+			va_free(page, 1);
+  803a5c:	83 ec 08             	sub    $0x8,%esp
+  803a5f:	6a 01                	push   $0x1
+  803a61:	53                   	push   %ebx
+  803a62:	e8 d8 12 00 00       	call   804d3f <va_free>
+			return NULL;
+  803a67:	83 c4 10             	add    $0x10,%esp
+  803a6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a6f:	eb e1                	jmp    803a52 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803a71:	83 ec 08             	sub    $0x8,%esp
+  803a74:	53                   	push   %ebx
+  803a75:	6a 00                	push   $0x0
+  803a77:	e8 f3 d4 ff ff       	call   800f6f <sys_page_unmap>
+			va_free(page, 1);
+  803a7c:	83 c4 08             	add    $0x8,%esp
+  803a7f:	6a 01                	push   $0x1
+  803a81:	53                   	push   %ebx
+  803a82:	e8 b8 12 00 00       	call   804d3f <va_free>
+  803a87:	83 c4 10             	add    $0x10,%esp
+  803a8a:	eb b2                	jmp    803a3e <umapdir_walk+0x5c>
+
+00803a8c <page_out>:
+{
+  803a8c:	55                   	push   %ebp
+  803a8d:	89 e5                	mov    %esp,%ebp
+  803a8f:	57                   	push   %edi
+  803a90:	56                   	push   %esi
+  803a91:	53                   	push   %ebx
+  803a92:	83 ec 5c             	sub    $0x5c,%esp
+  803a95:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803a98:	e8 dd f2 ff ff       	call   802d7a <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803a9d:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803aa2:	85 c0                	test   %eax,%eax
+  803aa4:	74 1e                	je     803ac4 <page_out+0x38>
+  803aa6:	83 ec 0c             	sub    $0xc,%esp
+  803aa9:	6a 00                	push   $0x0
+  803aab:	6a 00                	push   $0x0
+  803aad:	6a 00                	push   $0x0
+  803aaf:	6a 08                	push   $0x8
+  803ab1:	50                   	push   %eax
+  803ab2:	e8 0b 17 00 00       	call   8051c2 <ipc_call>
+  803ab7:	89 c3                	mov    %eax,%ebx
+  803ab9:	83 c4 20             	add    $0x20,%esp
+  803abc:	85 c0                	test   %eax,%eax
+  803abe:	0f 84 ac 00 00 00    	je     803b70 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803ac4:	83 ec 08             	sub    $0x8,%esp
+  803ac7:	ff 75 0c             	push   0xc(%ebp)
+  803aca:	57                   	push   %edi
+  803acb:	e8 e9 f9 ff ff       	call   8034b9 <get_page_choice>
+  803ad0:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803ad2:	83 c4 10             	add    $0x10,%esp
+  803ad5:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803ada:	0f 84 18 02 00 00    	je     803cf8 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803ae0:	e8 78 ee ff ff       	call   80295d <page_is_clean>
+  803ae5:	84 c0                	test   %al,%al
+  803ae7:	0f 85 8c 00 00 00    	jne    803b79 <page_out+0xed>
+	if (pagingenv == 0)
+  803aed:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803af4:	0f 84 08 02 00 00    	je     803d02 <page_out+0x276>
+	if (page_ring_ready())
+  803afa:	e8 4b f1 ff ff       	call   802c4a <page_ring_ready>
+  803aff:	89 c3                	mov    %eax,%ebx
+  803b01:	85 c0                	test   %eax,%eax
+  803b03:	0f 85 89 00 00 00    	jne    803b92 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803b09:	83 ec 0c             	sub    $0xc,%esp
+  803b0c:	6a 05                	push   $0x5
+  803b0e:	6a 01                	push   $0x1
+  803b10:	56                   	push   %esi
+  803b11:	6a 01                	push   $0x1
+  803b13:	ff 35 40 c0 80 00    	push   0x80c040
+  803b19:	e8 a4 16 00 00       	call   8051c2 <ipc_call>
+  803b1e:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803b20:	83 c4 20             	add    $0x20,%esp
+  803b23:	85 c0                	test   %eax,%eax
+  803b25:	0f 88 b8 01 00 00    	js     803ce3 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803b2b:	89 f0                	mov    %esi,%eax
+  803b2d:	c1 e8 0c             	shr    $0xc,%eax
+  803b30:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b37:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803b3a:	83 ec 08             	sub    $0x8,%esp
+  803b3d:	56                   	push   %esi
+  803b3e:	6a 00                	push   $0x0
+  803b40:	e8 2a d4 ff ff       	call   800f6f <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803b45:	83 c4 08             	add    $0x8,%esp
+  803b48:	6a 01                	push   $0x1
+  803b4a:	56                   	push   %esi
+  803b4b:	e8 92 fe ff ff       	call   8039e2 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803b50:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803b53:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803b59:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803b5c:	09 fe                	or     %edi,%esi
+  803b5e:	83 ce 01             	or     $0x1,%esi
+  803b61:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803b63:	83 c4 10             	add    $0x10,%esp
+}
+  803b66:	89 d8                	mov    %ebx,%eax
+  803b68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b6b:	5b                   	pop    %ebx
+  803b6c:	5e                   	pop    %esi
+  803b6d:	5f                   	pop    %edi
+  803b6e:	5d                   	pop    %ebp
+  803b6f:	c3                   	ret
+		num_page_reclaims++;
+  803b70:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  803b77:	eb ed                	jmp    803b66 <page_out+0xda>
+		num_page_drops++;
+  803b79:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803b80:	83 ec 08             	sub    $0x8,%esp
+  803b83:	56                   	push   %esi
+  803b84:	6a 00                	push   $0x0
+  803b86:	e8 e4 d3 ff ff       	call   800f6f <sys_page_unmap>
+  803b8b:	89 c3                	mov    %eax,%ebx
+  803b8d:	83 c4 10             	add    $0x10,%esp
+  803b90:	eb d4                	jmp    803b66 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803b92:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803b94:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803b99:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803b9e:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803ba1:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803ba3:	83 c0 08             	add    $0x8,%eax
+  803ba6:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803ba9:	b8 07 00 00 00       	mov    $0x7,%eax
+  803bae:	e8 e5 ef ff ff       	call   802b98 <page_ring_reserve>
+	first = ring->sq_tail;
+  803bb3:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803bb8:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803bbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803bc0:	83 ec 04             	sub    $0x4,%esp
+  803bc3:	68 00 10 00 00       	push   $0x1000
+  803bc8:	56                   	push   %esi
+  803bc9:	89 d8                	mov    %ebx,%eax
+  803bcb:	c1 e0 0c             	shl    $0xc,%eax
+  803bce:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803bd3:	50                   	push   %eax
+  803bd4:	e8 06 d0 ff ff       	call   800bdf <memcpy>
+		vas[n] = va;
+  803bd9:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803bdd:	89 d9                	mov    %ebx,%ecx
+  803bdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803be4:	b8 01 00 00 00       	mov    $0x1,%eax
+  803be9:	e8 de ee ff ff       	call   802acc <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803bee:	8d 43 01             	lea    0x1(%ebx),%eax
+  803bf1:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803bf4:	83 c4 10             	add    $0x10,%esp
+  803bf7:	83 fb 06             	cmp    $0x6,%ebx
+  803bfa:	74 62                	je     803c5e <page_out+0x1d2>
+  803bfc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803bff:	eb 15                	jmp    803c16 <page_out+0x18a>
+			num_page_drops++;
+  803c01:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803c08:	83 ec 08             	sub    $0x8,%esp
+  803c0b:	56                   	push   %esi
+  803c0c:	6a 00                	push   $0x0
+  803c0e:	e8 5c d3 ff ff       	call   800f6f <sys_page_unmap>
+  803c13:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803c16:	83 ec 08             	sub    $0x8,%esp
+  803c19:	53                   	push   %ebx
+  803c1a:	57                   	push   %edi
+  803c1b:	e8 99 f8 ff ff       	call   8034b9 <get_page_choice>
+  803c20:	89 c6                	mov    %eax,%esi
+  803c22:	83 c4 10             	add    $0x10,%esp
+  803c25:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803c2a:	74 32                	je     803c5e <page_out+0x1d2>
+  803c2c:	e8 2c ed ff ff       	call   80295d <page_is_clean>
+  803c31:	84 c0                	test   %al,%al
+  803c33:	75 cc                	jne    803c01 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803c35:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803c38:	39 c6                	cmp    %eax,%esi
+  803c3a:	72 07                	jb     803c43 <page_out+0x1b7>
+  803c3c:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803c3f:	39 c6                	cmp    %eax,%esi
+  803c41:	72 1b                	jb     803c5e <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803c43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c48:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803c4b:	eb 03                	jmp    803c50 <page_out+0x1c4>
+  803c4d:	83 c3 01             	add    $0x1,%ebx
+  803c50:	39 da                	cmp    %ebx,%edx
+  803c52:	0f 84 68 ff ff ff    	je     803bc0 <page_out+0x134>
+  803c58:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803c5c:	75 ef                	jne    803c4d <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803c5e:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803c61:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803c64:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803c67:	e8 a6 ee ff ff       	call   802b12 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803c6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c71:	eb 42                	jmp    803cb5 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803c73:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803c77:	89 f8                	mov    %edi,%eax
+  803c79:	c1 e8 0c             	shr    $0xc,%eax
+  803c7c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803c83:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803c86:	83 ec 08             	sub    $0x8,%esp
+  803c89:	57                   	push   %edi
+  803c8a:	6a 00                	push   $0x0
+  803c8c:	e8 de d2 ff ff       	call   800f6f <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803c91:	83 c4 08             	add    $0x8,%esp
+  803c94:	6a 01                	push   $0x1
+  803c96:	57                   	push   %edi
+  803c97:	e8 46 fd ff ff       	call   8039e2 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803c9c:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803c9f:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803ca5:	c1 e6 0c             	shl    $0xc,%esi
+  803ca8:	09 d6                	or     %edx,%esi
+  803caa:	83 ce 01             	or     $0x1,%esi
+  803cad:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803caf:	83 c3 01             	add    $0x1,%ebx
+  803cb2:	83 c4 10             	add    $0x10,%esp
+  803cb5:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803cb8:	39 c3                	cmp    %eax,%ebx
+  803cba:	74 1d                	je     803cd9 <page_out+0x24d>
+		if (res[i] < 0)
+  803cbc:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803cc0:	85 f6                	test   %esi,%esi
+  803cc2:	79 af                	jns    803c73 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803cc4:	56                   	push   %esi
+  803cc5:	68 f8 5e 80 00       	push   $0x805ef8
+  803cca:	68 d1 02 00 00       	push   $0x2d1
+  803ccf:	68 10 5c 80 00       	push   $0x805c10
+  803cd4:	e8 5c c6 ff ff       	call   800335 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803cd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803cde:	e9 83 fe ff ff       	jmp    803b66 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803ce3:	50                   	push   %eax
+  803ce4:	68 f8 5e 80 00       	push   $0x805ef8
+  803ce9:	68 0a 03 00 00       	push   $0x30a
+  803cee:	68 10 5c 80 00       	push   $0x805c10
+  803cf3:	e8 3d c6 ff ff       	call   800335 <_panic>
+		return -E_NO_MEM;
+  803cf8:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803cfd:	e9 64 fe ff ff       	jmp    803b66 <page_out+0xda>
+		return -E_PAGING;
+  803d02:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803d07:	e9 5a fe ff ff       	jmp    803b66 <page_out+0xda>
+
+00803d0c <page_alloc>:
+{
+  803d0c:	55                   	push   %ebp
+  803d0d:	89 e5                	mov    %esp,%ebp
+  803d0f:	57                   	push   %edi
+  803d10:	56                   	push   %esi
+  803d11:	53                   	push   %ebx
+  803d12:	83 ec 0c             	sub    $0xc,%esp
+  803d15:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803d18:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803d1b:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803d22:	74 34                	je     803d58 <page_alloc+0x4c>
+	if (check_mte)
+  803d24:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803d28:	75 35                	jne    803d5f <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803d2a:	83 ec 04             	sub    $0x4,%esp
+  803d2d:	ff 75 10             	push   0x10(%ebp)
+  803d30:	56                   	push   %esi
+  803d31:	57                   	push   %edi
+  803d32:	e8 b3 d1 ff ff       	call   800eea <sys_page_alloc>
+  803d37:	89 c3                	mov    %eax,%ebx
+  803d39:	83 c4 10             	add    $0x10,%esp
+  803d3c:	85 c0                	test   %eax,%eax
+  803d3e:	79 52                	jns    803d92 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803d40:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d43:	75 52                	jne    803d97 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803d45:	83 ec 08             	sub    $0x8,%esp
+  803d48:	56                   	push   %esi
+  803d49:	57                   	push   %edi
+  803d4a:	e8 3d fd ff ff       	call   803a8c <page_out>
+  803d4f:	83 c4 10             	add    $0x10,%esp
+  803d52:	85 c0                	test   %eax,%eax
+  803d54:	79 d4                	jns    803d2a <page_alloc+0x1e>
+  803d56:	eb 3f                	jmp    803d97 <page_alloc+0x8b>
+		init_map_dir();
+  803d58:	e8 2f fc ff ff       	call   80398c <init_map_dir>
+  803d5d:	eb c5                	jmp    803d24 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803d5f:	83 ec 08             	sub    $0x8,%esp
+  803d62:	6a 00                	push   $0x0
+  803d64:	56                   	push   %esi
+  803d65:	e8 78 fc ff ff       	call   8039e2 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803d6a:	83 c4 10             	add    $0x10,%esp
+  803d6d:	85 c0                	test   %eax,%eax
+  803d6f:	74 b9                	je     803d2a <page_alloc+0x1e>
+  803d71:	8b 10                	mov    (%eax),%edx
+  803d73:	f6 c2 01             	test   $0x1,%dl
+  803d76:	74 b2                	je     803d2a <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803d78:	83 ec 08             	sub    $0x8,%esp
+  803d7b:	56                   	push   %esi
+  803d7c:	52                   	push   %edx
+  803d7d:	50                   	push   %eax
+  803d7e:	68 1c 5f 80 00       	push   $0x805f1c
+  803d83:	68 34 03 00 00       	push   $0x334
+  803d88:	68 10 5c 80 00       	push   $0x805c10
+  803d8d:	e8 a3 c5 ff ff       	call   800335 <_panic>
+	return 0;
+  803d92:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803d97:	89 d8                	mov    %ebx,%eax
+  803d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d9c:	5b                   	pop    %ebx
+  803d9d:	5e                   	pop    %esi
+  803d9e:	5f                   	pop    %edi
+  803d9f:	5d                   	pop    %ebp
+  803da0:	c3                   	ret
+
+00803da1 <page_adopt>:
+{
+  803da1:	55                   	push   %ebp
+  803da2:	89 e5                	mov    %esp,%ebp
+  803da4:	56                   	push   %esi
+  803da5:	53                   	push   %ebx
+  803da6:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803da8:	c1 e8 16             	shr    $0x16,%eax
+  803dab:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803db2:	25 81 00 00 00       	and    $0x81,%eax
+  803db7:	83 f8 01             	cmp    $0x1,%eax
+  803dba:	75 53                	jne    803e0f <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803dbc:	89 d8                	mov    %ebx,%eax
+  803dbe:	c1 e8 0c             	shr    $0xc,%eax
+  803dc1:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803dc8:	89 f2                	mov    %esi,%edx
+  803dca:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803dd0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803dd5:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803ddb:	75 37                	jne    803e14 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803ddd:	83 ec 08             	sub    $0x8,%esp
+  803de0:	6a 01                	push   $0x1
+  803de2:	53                   	push   %ebx
+  803de3:	e8 fa fb ff ff       	call   8039e2 <umapdir_walk>
+  803de8:	83 c4 10             	add    $0x10,%esp
+  803deb:	85 c0                	test   %eax,%eax
+  803ded:	74 2c                	je     803e1b <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803def:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803df5:	83 ce 01             	or     $0x1,%esi
+  803df8:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803dfa:	83 ec 08             	sub    $0x8,%esp
+  803dfd:	53                   	push   %ebx
+  803dfe:	6a 00                	push   $0x0
+  803e00:	e8 6a d1 ff ff       	call   800f6f <sys_page_unmap>
+	return 1;
+  803e05:	83 c4 10             	add    $0x10,%esp
+  803e08:	b8 01 00 00 00       	mov    $0x1,%eax
+  803e0d:	eb 05                	jmp    803e14 <page_adopt+0x73>
+		return 0;
+  803e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803e17:	5b                   	pop    %ebx
+  803e18:	5e                   	pop    %esi
+  803e19:	5d                   	pop    %ebp
+  803e1a:	c3                   	ret
+		return -E_NO_MEM;
+  803e1b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803e20:	eb f2                	jmp    803e14 <page_adopt+0x73>
+
+00803e22 <page_forget>:
+{
+  803e22:	55                   	push   %ebp
+  803e23:	89 e5                	mov    %esp,%ebp
+  803e25:	53                   	push   %ebx
+  803e26:	83 ec 04             	sub    $0x4,%esp
+  803e29:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803e2b:	e8 4a ef ff ff       	call   802d7a <find_paging_env>
+	if (pagingenv == 0)
+  803e30:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803e37:	74 39                	je     803e72 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803e39:	89 d8                	mov    %ebx,%eax
+  803e3b:	c1 e8 16             	shr    $0x16,%eax
+  803e3e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803e45:	25 81 00 00 00       	and    $0x81,%eax
+  803e4a:	83 f8 01             	cmp    $0x1,%eax
+  803e4d:	74 28                	je     803e77 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803e4f:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803e56:	74 1a                	je     803e72 <page_forget+0x50>
+  803e58:	83 ec 08             	sub    $0x8,%esp
+  803e5b:	6a 00                	push   $0x0
+  803e5d:	53                   	push   %ebx
+  803e5e:	e8 7f fb ff ff       	call   8039e2 <umapdir_walk>
+  803e63:	89 c3                	mov    %eax,%ebx
+  803e65:	83 c4 10             	add    $0x10,%esp
+  803e68:	85 c0                	test   %eax,%eax
+  803e6a:	74 06                	je     803e72 <page_forget+0x50>
+  803e6c:	8b 00                	mov    (%eax),%eax
+  803e6e:	a8 01                	test   $0x1,%al
+  803e70:	75 2b                	jne    803e9d <page_forget+0x7b>
+}
+  803e72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803e75:	c9                   	leave
+  803e76:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803e77:	89 d8                	mov    %ebx,%eax
+  803e79:	c1 e8 0c             	shr    $0xc,%eax
+  803e7c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803e83:	89 c2                	mov    %eax,%edx
+  803e85:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803e8b:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803e91:	75 bc                	jne    803e4f <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803e93:	c1 e8 0c             	shr    $0xc,%eax
+  803e96:	e8 5c ee ff ff       	call   802cf7 <page_remove_slot>
+		return;
+  803e9b:	eb d5                	jmp    803e72 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803e9d:	c1 e8 0c             	shr    $0xc,%eax
+  803ea0:	e8 52 ee ff ff       	call   802cf7 <page_remove_slot>
+	*mte = 0;
+  803ea5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803eab:	eb c5                	jmp    803e72 <page_forget+0x50>
+
+00803ead <page_unmap>:
+{
+  803ead:	55                   	push   %ebp
+  803eae:	89 e5                	mov    %esp,%ebp
+  803eb0:	57                   	push   %edi
+  803eb1:	56                   	push   %esi
+  803eb2:	53                   	push   %ebx
+  803eb3:	83 ec 0c             	sub    $0xc,%esp
+  803eb6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803eb9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803ebc:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803ec1:	8b 40 48             	mov    0x48(%eax),%eax
+  803ec4:	85 db                	test   %ebx,%ebx
+  803ec6:	0f 8e b4 00 00 00    	jle    803f80 <page_unmap+0xd3>
+  803ecc:	39 d8                	cmp    %ebx,%eax
+  803ece:	0f 84 ac 00 00 00    	je     803f80 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803ed4:	83 ec 08             	sub    $0x8,%esp
+  803ed7:	57                   	push   %edi
+  803ed8:	53                   	push   %ebx
+  803ed9:	e8 91 d0 ff ff       	call   800f6f <sys_page_unmap>
+  803ede:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803ee0:	e8 95 ee ff ff       	call   802d7a <find_paging_env>
+	if (pagingenv == 0)
+  803ee5:	83 c4 10             	add    $0x10,%esp
+  803ee8:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803eef:	0f 84 a1 00 00 00    	je     803f96 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803ef5:	83 ec 0c             	sub    $0xc,%esp
+  803ef8:	6a 05                	push   $0x5
+  803efa:	68 00 00 40 00       	push   $0x400000
+  803eff:	6a 00                	push   $0x0
+  803f01:	68 00 b0 ad de       	push   $0xdeadb000
+  803f06:	53                   	push   %ebx
+  803f07:	e8 21 d0 ff ff       	call   800f2d <sys_page_map>
+  803f0c:	83 c4 20             	add    $0x20,%esp
+  803f0f:	85 c0                	test   %eax,%eax
+  803f11:	0f 88 89 00 00 00    	js     803fa0 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803f17:	89 f8                	mov    %edi,%eax
+  803f19:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803f1c:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803f23:	a8 01                	test   $0x1,%al
+  803f25:	74 6f                	je     803f96 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f27:	83 ec 0c             	sub    $0xc,%esp
+  803f2a:	6a 05                	push   $0x5
+  803f2c:	68 00 00 40 00       	push   $0x400000
+  803f31:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803f33:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803f38:	50                   	push   %eax
+  803f39:	53                   	push   %ebx
+  803f3a:	e8 ee cf ff ff       	call   800f2d <sys_page_map>
+  803f3f:	83 c4 20             	add    $0x20,%esp
+  803f42:	85 c0                	test   %eax,%eax
+  803f44:	78 6f                	js     803fb5 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803f46:	c1 ef 0c             	shr    $0xc,%edi
+  803f49:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803f4f:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803f56:	01 
+  803f57:	74 3d                	je     803f96 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803f59:	83 ec 08             	sub    $0x8,%esp
+  803f5c:	68 00 00 40 00       	push   $0x400000
+  803f61:	6a 00                	push   $0x0
+  803f63:	e8 07 d0 ff ff       	call   800f6f <sys_page_unmap>
+  803f68:	83 c4 10             	add    $0x10,%esp
+  803f6b:	85 c0                	test   %eax,%eax
+  803f6d:	78 5b                	js     803fca <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803f6f:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803f76:	c1 e8 0c             	shr    $0xc,%eax
+  803f79:	e8 79 ed ff ff       	call   802cf7 <page_remove_slot>
+	return r;
+  803f7e:	eb 16                	jmp    803f96 <page_unmap+0xe9>
+		page_forget(va);
+  803f80:	89 f8                	mov    %edi,%eax
+  803f82:	e8 9b fe ff ff       	call   803e22 <page_forget>
+		return sys_page_unmap(envid, va);
+  803f87:	83 ec 08             	sub    $0x8,%esp
+  803f8a:	57                   	push   %edi
+  803f8b:	53                   	push   %ebx
+  803f8c:	e8 de cf ff ff       	call   800f6f <sys_page_unmap>
+  803f91:	89 c6                	mov    %eax,%esi
+  803f93:	83 c4 10             	add    $0x10,%esp
+}
+  803f96:	89 f0                	mov    %esi,%eax
+  803f98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f9b:	5b                   	pop    %ebx
+  803f9c:	5e                   	pop    %esi
+  803f9d:	5f                   	pop    %edi
+  803f9e:	5d                   	pop    %ebp
+  803f9f:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803fa0:	50                   	push   %eax
+  803fa1:	68 58 5f 80 00       	push   $0x805f58
+  803fa6:	68 e4 03 00 00       	push   $0x3e4
+  803fab:	68 10 5c 80 00       	push   $0x805c10
+  803fb0:	e8 80 c3 ff ff       	call   800335 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803fb5:	50                   	push   %eax
+  803fb6:	68 84 5f 80 00       	push   $0x805f84
+  803fbb:	68 ea 03 00 00       	push   $0x3ea
+  803fc0:	68 10 5c 80 00       	push   $0x805c10
+  803fc5:	e8 6b c3 ff ff       	call   800335 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803fca:	50                   	push   %eax
+  803fcb:	68 b0 5f 80 00       	push   $0x805fb0
+  803fd0:	68 ef 03 00 00       	push   $0x3ef
+  803fd5:	68 10 5c 80 00       	push   $0x805c10
+  803fda:	e8 56 c3 ff ff       	call   800335 <_panic>
+
+00803fdf <page_unmap_range>:
+{
+  803fdf:	55                   	push   %ebp
+  803fe0:	89 e5                	mov    %esp,%ebp
+  803fe2:	57                   	push   %edi
+  803fe3:	56                   	push   %esi
+  803fe4:	53                   	push   %ebx
+  803fe5:	83 ec 0c             	sub    $0xc,%esp
+  803fe8:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803feb:	e8 8a ed ff ff       	call   802d7a <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803ff0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803ff5:	8b 40 48             	mov    0x48(%eax),%eax
+  803ff8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803ffc:	7e 38                	jle    804036 <page_unmap_range+0x57>
+  803ffe:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804001:	74 33                	je     804036 <page_unmap_range+0x57>
+  804003:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80400a:	74 2a                	je     804036 <page_unmap_range+0x57>
+  80400c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  80400f:	be 00 00 00 00       	mov    $0x0,%esi
+  804014:	39 fe                	cmp    %edi,%esi
+  804016:	74 56                	je     80406e <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  804018:	83 ec 08             	sub    $0x8,%esp
+  80401b:	53                   	push   %ebx
+  80401c:	ff 75 08             	push   0x8(%ebp)
+  80401f:	e8 89 fe ff ff       	call   803ead <page_unmap>
+  804024:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80402a:	83 c4 10             	add    $0x10,%esp
+  80402d:	85 c0                	test   %eax,%eax
+  80402f:	78 35                	js     804066 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  804031:	83 c6 01             	add    $0x1,%esi
+  804034:	eb de                	jmp    804014 <page_unmap_range+0x35>
+  804036:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  804039:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80403e:	eb 10                	jmp    804050 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  804040:	89 f0                	mov    %esi,%eax
+  804042:	e8 db fd ff ff       	call   803e22 <page_forget>
+		for (i = 0; i < npages; i++)
+  804047:	83 c3 01             	add    $0x1,%ebx
+  80404a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804050:	39 fb                	cmp    %edi,%ebx
+  804052:	75 ec                	jne    804040 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  804054:	83 ec 04             	sub    $0x4,%esp
+  804057:	57                   	push   %edi
+  804058:	ff 75 0c             	push   0xc(%ebp)
+  80405b:	ff 75 08             	push   0x8(%ebp)
+  80405e:	e8 20 d0 ff ff       	call   801083 <sys_page_unmap_range>
+  804063:	83 c4 10             	add    $0x10,%esp
+}
+  804066:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804069:	5b                   	pop    %ebx
+  80406a:	5e                   	pop    %esi
+  80406b:	5f                   	pop    %edi
+  80406c:	5d                   	pop    %ebp
+  80406d:	c3                   	ret
+	return 0;
+  80406e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804073:	eb f1                	jmp    804066 <page_unmap_range+0x87>
+
+00804075 <page_alloc_range>:
+{
+  804075:	55                   	push   %ebp
+  804076:	89 e5                	mov    %esp,%ebp
+  804078:	57                   	push   %edi
+  804079:	56                   	push   %esi
+  80407a:	53                   	push   %ebx
+  80407b:	83 ec 1c             	sub    $0x1c,%esp
+  80407e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804081:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  804084:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  80408b:	74 14                	je     8040a1 <page_alloc_range+0x2c>
+	if (check_mte)
+  80408d:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  804091:	74 66                	je     8040f9 <page_alloc_range+0x84>
+  804093:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  804095:	b8 00 00 00 00       	mov    $0x0,%eax
+  80409a:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  80409d:	89 c7                	mov    %eax,%edi
+  80409f:	eb 10                	jmp    8040b1 <page_alloc_range+0x3c>
+		init_map_dir();
+  8040a1:	e8 e6 f8 ff ff       	call   80398c <init_map_dir>
+  8040a6:	eb e5                	jmp    80408d <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  8040a8:	83 c7 01             	add    $0x1,%edi
+  8040ab:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8040b1:	39 df                	cmp    %ebx,%edi
+  8040b3:	74 38                	je     8040ed <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  8040b5:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8040b8:	83 ec 08             	sub    $0x8,%esp
+  8040bb:	6a 00                	push   $0x0
+  8040bd:	56                   	push   %esi
+  8040be:	e8 1f f9 ff ff       	call   8039e2 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  8040c3:	83 c4 10             	add    $0x10,%esp
+  8040c6:	85 c0                	test   %eax,%eax
+  8040c8:	74 de                	je     8040a8 <page_alloc_range+0x33>
+  8040ca:	8b 10                	mov    (%eax),%edx
+  8040cc:	f6 c2 01             	test   $0x1,%dl
+  8040cf:	74 d7                	je     8040a8 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  8040d1:	83 ec 08             	sub    $0x8,%esp
+  8040d4:	ff 75 e4             	push   -0x1c(%ebp)
+  8040d7:	52                   	push   %edx
+  8040d8:	50                   	push   %eax
+  8040d9:	68 1c 5f 80 00       	push   $0x805f1c
+  8040de:	68 0b 04 00 00       	push   $0x40b
+  8040e3:	68 10 5c 80 00       	push   $0x805c10
+  8040e8:	e8 48 c2 ff ff       	call   800335 <_panic>
+  8040ed:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8040f0:	eb 07                	jmp    8040f9 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  8040f2:	c1 e0 0c             	shl    $0xc,%eax
+  8040f5:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8040f7:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8040f9:	85 db                	test   %ebx,%ebx
+  8040fb:	74 30                	je     80412d <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8040fd:	ff 75 14             	push   0x14(%ebp)
+  804100:	53                   	push   %ebx
+  804101:	57                   	push   %edi
+  804102:	ff 75 08             	push   0x8(%ebp)
+  804105:	e8 0b cf ff ff       	call   801015 <sys_page_alloc_range>
+  80410a:	89 c6                	mov    %eax,%esi
+  80410c:	83 c4 10             	add    $0x10,%esp
+  80410f:	85 c0                	test   %eax,%eax
+  804111:	7f df                	jg     8040f2 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  804113:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  804116:	75 1a                	jne    804132 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  804118:	83 ec 08             	sub    $0x8,%esp
+  80411b:	57                   	push   %edi
+  80411c:	ff 75 08             	push   0x8(%ebp)
+  80411f:	e8 68 f9 ff ff       	call   803a8c <page_out>
+  804124:	83 c4 10             	add    $0x10,%esp
+  804127:	85 c0                	test   %eax,%eax
+  804129:	79 ce                	jns    8040f9 <page_alloc_range+0x84>
+  80412b:	eb 05                	jmp    804132 <page_alloc_range+0xbd>
+	return 0;
+  80412d:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  804132:	89 f0                	mov    %esi,%eax
+  804134:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804137:	5b                   	pop    %ebx
+  804138:	5e                   	pop    %esi
+  804139:	5f                   	pop    %edi
+  80413a:	5d                   	pop    %ebp
+  80413b:	c3                   	ret
+
+0080413c <page_in>:
+{
+  80413c:	55                   	push   %ebp
+  80413d:	89 e5                	mov    %esp,%ebp
+  80413f:	57                   	push   %edi
+  804140:	56                   	push   %esi
+  804141:	53                   	push   %ebx
+  804142:	83 ec 3c             	sub    $0x3c,%esp
+  804145:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  804148:	e8 2d ec ff ff       	call   802d7a <find_paging_env>
+	if (pagingenv == 0)
+  80414d:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  804154:	0f 84 09 02 00 00    	je     804363 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  80415a:	83 ec 08             	sub    $0x8,%esp
+  80415d:	6a 00                	push   $0x0
+  80415f:	56                   	push   %esi
+  804160:	e8 7d f8 ff ff       	call   8039e2 <umapdir_walk>
+  804165:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  804167:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  80416d:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  804170:	83 c4 10             	add    $0x10,%esp
+  804173:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804177:	74 0d                	je     804186 <page_in+0x4a>
+  804179:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80417e:	8b 40 48             	mov    0x48(%eax),%eax
+  804181:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804184:	75 06                	jne    80418c <page_in+0x50>
+  804186:	8b 03                	mov    (%ebx),%eax
+  804188:	a8 02                	test   $0x2,%al
+  80418a:	75 63                	jne    8041ef <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  80418c:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  80418e:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804190:	89 f0                	mov    %esi,%eax
+  804192:	25 06 0e 00 00       	and    $0xe06,%eax
+  804197:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  80419a:	50                   	push   %eax
+  80419b:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  80419e:	57                   	push   %edi
+  80419f:	ff 75 08             	push   0x8(%ebp)
+  8041a2:	e8 65 fb ff ff       	call   803d0c <page_alloc>
+  8041a7:	83 c4 10             	add    $0x10,%esp
+  8041aa:	85 c0                	test   %eax,%eax
+  8041ac:	78 39                	js     8041e7 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  8041ae:	89 f0                	mov    %esi,%eax
+  8041b0:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8041b3:	83 ec 0c             	sub    $0xc,%esp
+  8041b6:	6a 07                	push   $0x7
+  8041b8:	6a 01                	push   $0x1
+  8041ba:	57                   	push   %edi
+  8041bb:	c1 e0 04             	shl    $0x4,%eax
+  8041be:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8041bf:	c1 ee 1c             	shr    $0x1c,%esi
+  8041c2:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  8041c5:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  8041cc:	e8 f1 0f 00 00       	call   8051c2 <ipc_call>
+  8041d1:	83 c4 20             	add    $0x20,%esp
+  8041d4:	85 c0                	test   %eax,%eax
+  8041d6:	0f 88 72 01 00 00    	js     80434e <page_in+0x212>
+	*mte = 0;
+  8041dc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  8041e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041ea:	5b                   	pop    %ebx
+  8041eb:	5e                   	pop    %esi
+  8041ec:	5f                   	pop    %edi
+  8041ed:	5d                   	pop    %ebp
+  8041ee:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  8041ef:	25 06 0e 00 00       	and    $0xe06,%eax
+  8041f4:	83 c8 01             	or     $0x1,%eax
+  8041f7:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  8041fa:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8041fd:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804200:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  804206:	be 01 00 00 00       	mov    $0x1,%esi
+  80420b:	eb 46                	jmp    804253 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  80420d:	83 ec 08             	sub    $0x8,%esp
+  804210:	6a 00                	push   $0x0
+  804212:	51                   	push   %ecx
+  804213:	e8 ca f7 ff ff       	call   8039e2 <umapdir_walk>
+  804218:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  80421c:	83 c4 10             	add    $0x10,%esp
+  80421f:	85 c0                	test   %eax,%eax
+  804221:	74 66                	je     804289 <page_in+0x14d>
+  804223:	8b 00                	mov    (%eax),%eax
+  804225:	a8 01                	test   $0x1,%al
+  804227:	74 60                	je     804289 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804229:	89 c2                	mov    %eax,%edx
+  80422b:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  804231:	83 ca 01             	or     $0x1,%edx
+  804234:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  804237:	75 50                	jne    804289 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804239:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80423f:	c1 e8 1c             	shr    $0x1c,%eax
+  804242:	8b 13                	mov    (%ebx),%edx
+  804244:	c1 ea 1c             	shr    $0x1c,%edx
+  804247:	39 d0                	cmp    %edx,%eax
+  804249:	75 3e                	jne    804289 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  80424b:	83 c6 01             	add    $0x1,%esi
+  80424e:	83 fe 08             	cmp    $0x8,%esi
+  804251:	74 3f                	je     804292 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  804253:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804255:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  80425b:	77 2c                	ja     804289 <page_in+0x14d>
+  80425d:	89 f8                	mov    %edi,%eax
+  80425f:	c1 e8 16             	shr    $0x16,%eax
+  804262:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804269:	f6 c2 01             	test   $0x1,%dl
+  80426c:	74 9f                	je     80420d <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  80426e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804275:	a8 80                	test   $0x80,%al
+  804277:	75 10                	jne    804289 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804279:	89 f8                	mov    %edi,%eax
+  80427b:	c1 e8 0c             	shr    $0xc,%eax
+  80427e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804285:	a8 01                	test   $0x1,%al
+  804287:	74 84                	je     80420d <page_in+0xd1>
+	if (n == 1)
+  804289:	83 fe 01             	cmp    $0x1,%esi
+  80428c:	0f 84 fa fe ff ff    	je     80418c <page_in+0x50>
+	req.nslots = n;
+  804292:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  804298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80429d:	eb 13                	jmp    8042b2 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  80429f:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  8042a3:	8b 12                	mov    (%edx),%edx
+  8042a5:	c1 ea 0c             	shr    $0xc,%edx
+  8042a8:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  8042af:	83 c0 01             	add    $0x1,%eax
+  8042b2:	39 c6                	cmp    %eax,%esi
+  8042b4:	75 e9                	jne    80429f <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  8042b6:	83 ec 0c             	sub    $0xc,%esp
+  8042b9:	6a 00                	push   $0x0
+  8042bb:	ff 75 c0             	push   -0x40(%ebp)
+  8042be:	56                   	push   %esi
+  8042bf:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8042c2:	57                   	push   %edi
+  8042c3:	6a 00                	push   $0x0
+  8042c5:	e8 ab fd ff ff       	call   804075 <page_alloc_range>
+  8042ca:	83 c4 20             	add    $0x20,%esp
+  8042cd:	85 c0                	test   %eax,%eax
+  8042cf:	78 6e                	js     80433f <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  8042d1:	83 ec 04             	sub    $0x4,%esp
+  8042d4:	6a 24                	push   $0x24
+  8042d6:	68 00 90 80 00       	push   $0x809000
+  8042db:	57                   	push   %edi
+  8042dc:	e8 9c c8 ff ff       	call   800b7d <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8042e1:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8042e8:	56                   	push   %esi
+  8042e9:	57                   	push   %edi
+  8042ea:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8042ec:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  8042f3:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  8042f6:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  8042fd:	e8 c0 0e 00 00       	call   8051c2 <ipc_call>
+  804302:	83 c4 20             	add    $0x20,%esp
+  804305:	85 c0                	test   %eax,%eax
+  804307:	78 08                	js     804311 <page_in+0x1d5>
+  804309:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80430c:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  80430f:	eb 20                	jmp    804331 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804311:	50                   	push   %eax
+  804312:	68 dc 5f 80 00       	push   $0x805fdc
+  804317:	68 59 02 00 00       	push   $0x259
+  80431c:	68 10 5c 80 00       	push   $0x805c10
+  804321:	e8 0f c0 ff ff       	call   800335 <_panic>
+		*mtes[i] = 0;
+  804326:	8b 10                	mov    (%eax),%edx
+  804328:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  80432e:	83 c0 04             	add    $0x4,%eax
+  804331:	39 c8                	cmp    %ecx,%eax
+  804333:	75 f1                	jne    804326 <page_in+0x1ea>
+	return n;
+  804335:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804337:	85 f6                	test   %esi,%esi
+  804339:	0f 84 4d fe ff ff    	je     80418c <page_in+0x50>
+		return r < 0 ? r : 0;
+  80433f:	85 c0                	test   %eax,%eax
+  804341:	ba 00 00 00 00       	mov    $0x0,%edx
+  804346:	0f 4f c2             	cmovg  %edx,%eax
+  804349:	e9 99 fe ff ff       	jmp    8041e7 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  80434e:	50                   	push   %eax
+  80434f:	68 14 60 80 00       	push   $0x806014
+  804354:	68 9a 02 00 00       	push   $0x29a
+  804359:	68 10 5c 80 00       	push   $0x805c10
+  80435e:	e8 d2 bf ff ff       	call   800335 <_panic>
+		return -E_PAGING;
+  804363:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804368:	e9 7a fe ff ff       	jmp    8041e7 <page_in+0xab>
+
+0080436d <page_map>:
+{
+  80436d:	55                   	push   %ebp
+  80436e:	89 e5                	mov    %esp,%ebp
+  804370:	57                   	push   %edi
+  804371:	56                   	push   %esi
+  804372:	53                   	push   %ebx
+  804373:	83 ec 1c             	sub    $0x1c,%esp
+  804376:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804379:	83 ec 0c             	sub    $0xc,%esp
+  80437c:	ff 75 18             	push   0x18(%ebp)
+  80437f:	ff 75 14             	push   0x14(%ebp)
+  804382:	ff 75 10             	push   0x10(%ebp)
+  804385:	ff 75 0c             	push   0xc(%ebp)
+  804388:	56                   	push   %esi
+  804389:	e8 9f cb ff ff       	call   800f2d <sys_page_map>
+  80438e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804391:	83 c4 20             	add    $0x20,%esp
+  804394:	85 c0                	test   %eax,%eax
+  804396:	0f 89 a9 01 00 00    	jns    804545 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  80439c:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  8043a0:	74 5f                	je     804401 <page_map+0x94>
+		if (r != -E_INVAL)
+  8043a2:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  8043a6:	0f 85 a0 01 00 00    	jne    80454c <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8043ac:	85 f6                	test   %esi,%esi
+  8043ae:	74 70                	je     804420 <page_map+0xb3>
+  8043b0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8043b5:	8b 40 48             	mov    0x48(%eax),%eax
+  8043b8:	39 f0                	cmp    %esi,%eax
+  8043ba:	74 64                	je     804420 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8043bc:	83 ec 0c             	sub    $0xc,%esp
+  8043bf:	6a 05                	push   $0x5
+  8043c1:	68 00 00 40 00       	push   $0x400000
+  8043c6:	6a 00                	push   $0x0
+  8043c8:	68 00 b0 ad de       	push   $0xdeadb000
+  8043cd:	56                   	push   %esi
+  8043ce:	e8 5a cb ff ff       	call   800f2d <sys_page_map>
+  8043d3:	89 c3                	mov    %eax,%ebx
+  8043d5:	83 c4 20             	add    $0x20,%esp
+  8043d8:	85 c0                	test   %eax,%eax
+  8043da:	79 6a                	jns    804446 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  8043dc:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8043df:	75 50                	jne    804431 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  8043e1:	83 ec 08             	sub    $0x8,%esp
+  8043e4:	68 00 00 40 00       	push   $0x400000
+  8043e9:	6a fc                	push   $0xfffffffc
+  8043eb:	e8 9c f6 ff ff       	call   803a8c <page_out>
+  8043f0:	83 c4 10             	add    $0x10,%esp
+  8043f3:	85 c0                	test   %eax,%eax
+  8043f5:	79 c5                	jns    8043bc <page_map+0x4f>
+}
+  8043f7:	89 d8                	mov    %ebx,%eax
+  8043f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043fc:	5b                   	pop    %ebx
+  8043fd:	5e                   	pop    %esi
+  8043fe:	5f                   	pop    %edi
+  8043ff:	5d                   	pop    %ebp
+  804400:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804401:	83 ec 08             	sub    $0x8,%esp
+  804404:	68 00 00 40 00       	push   $0x400000
+  804409:	6a 00                	push   $0x0
+  80440b:	e8 7c f6 ff ff       	call   803a8c <page_out>
+  804410:	83 c4 10             	add    $0x10,%esp
+  804413:	85 c0                	test   %eax,%eax
+  804415:	0f 89 5e ff ff ff    	jns    804379 <page_map+0xc>
+				return r;
+  80441b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80441e:	eb d7                	jmp    8043f7 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804420:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804423:	e8 79 f9 ff ff       	call   803da1 <page_adopt>
+  804428:	85 c0                	test   %eax,%eax
+  80442a:	79 90                	jns    8043bc <page_map+0x4f>
+			return r;
+  80442c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80442f:	eb c6                	jmp    8043f7 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804431:	53                   	push   %ebx
+  804432:	68 48 60 80 00       	push   $0x806048
+  804437:	68 77 03 00 00       	push   $0x377
+  80443c:	68 10 5c 80 00       	push   $0x805c10
+  804441:	e8 ef be ff ff       	call   800335 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  804446:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804449:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  80444c:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  804453:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804459:	0f 84 f5 00 00 00    	je     804554 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  80445f:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804465:	83 ec 0c             	sub    $0xc,%esp
+  804468:	6a 05                	push   $0x5
+  80446a:	68 00 00 40 00       	push   $0x400000
+  80446f:	6a 00                	push   $0x0
+  804471:	57                   	push   %edi
+  804472:	56                   	push   %esi
+  804473:	e8 b5 ca ff ff       	call   800f2d <sys_page_map>
+  804478:	89 c3                	mov    %eax,%ebx
+  80447a:	83 c4 20             	add    $0x20,%esp
+  80447d:	85 c0                	test   %eax,%eax
+  80447f:	79 35                	jns    8044b6 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  804481:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804484:	75 1b                	jne    8044a1 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804486:	83 ec 08             	sub    $0x8,%esp
+  804489:	68 00 00 40 00       	push   $0x400000
+  80448e:	6a 00                	push   $0x0
+  804490:	e8 f7 f5 ff ff       	call   803a8c <page_out>
+  804495:	83 c4 10             	add    $0x10,%esp
+  804498:	85 c0                	test   %eax,%eax
+  80449a:	79 c9                	jns    804465 <page_map+0xf8>
+  80449c:	e9 56 ff ff ff       	jmp    8043f7 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  8044a1:	53                   	push   %ebx
+  8044a2:	68 70 60 80 00       	push   $0x806070
+  8044a7:	68 83 03 00 00       	push   $0x383
+  8044ac:	68 10 5c 80 00       	push   $0x805c10
+  8044b1:	e8 7f be ff ff       	call   800335 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  8044b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8044b9:	c1 e8 0c             	shr    $0xc,%eax
+  8044bc:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8044c1:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  8044c8:	01 
+  8044c9:	0f 84 8d 00 00 00    	je     80455c <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8044cf:	83 ec 08             	sub    $0x8,%esp
+  8044d2:	68 00 00 40 00       	push   $0x400000
+  8044d7:	6a 00                	push   $0x0
+  8044d9:	e8 91 ca ff ff       	call   800f6f <sys_page_unmap>
+  8044de:	83 c4 10             	add    $0x10,%esp
+  8044e1:	85 c0                	test   %eax,%eax
+  8044e3:	78 36                	js     80451b <page_map+0x1ae>
+  8044e5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  8044e8:	83 ec 08             	sub    $0x8,%esp
+  8044eb:	57                   	push   %edi
+  8044ec:	56                   	push   %esi
+  8044ed:	e8 4a fc ff ff       	call   80413c <page_in>
+  8044f2:	89 c3                	mov    %eax,%ebx
+  8044f4:	83 c4 10             	add    $0x10,%esp
+  8044f7:	85 c0                	test   %eax,%eax
+  8044f9:	0f 89 7a fe ff ff    	jns    804379 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  8044ff:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804502:	75 2c                	jne    804530 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804504:	83 ec 08             	sub    $0x8,%esp
+  804507:	57                   	push   %edi
+  804508:	6a 00                	push   $0x0
+  80450a:	e8 7d f5 ff ff       	call   803a8c <page_out>
+  80450f:	83 c4 10             	add    $0x10,%esp
+  804512:	85 c0                	test   %eax,%eax
+  804514:	79 d2                	jns    8044e8 <page_map+0x17b>
+  804516:	e9 dc fe ff ff       	jmp    8043f7 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  80451b:	50                   	push   %eax
+  80451c:	68 9c 60 80 00       	push   $0x80609c
+  804521:	68 8b 03 00 00       	push   $0x38b
+  804526:	68 10 5c 80 00       	push   $0x805c10
+  80452b:	e8 05 be ff ff       	call   800335 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804530:	53                   	push   %ebx
+  804531:	68 c4 60 80 00       	push   $0x8060c4
+  804536:	68 91 03 00 00       	push   $0x391
+  80453b:	68 10 5c 80 00       	push   $0x805c10
+  804540:	e8 f0 bd ff ff       	call   800335 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804545:	89 c3                	mov    %eax,%ebx
+  804547:	e9 ab fe ff ff       	jmp    8043f7 <page_map+0x8a>
+  80454c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80454f:	e9 a3 fe ff ff       	jmp    8043f7 <page_map+0x8a>
+			return r; // Pass through the error
+  804554:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804557:	e9 9b fe ff ff       	jmp    8043f7 <page_map+0x8a>
+			return r; // Pass through the error
+  80455c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80455f:	e9 93 fe ff ff       	jmp    8043f7 <page_map+0x8a>
+
+00804564 <page_map_range>:
+{
+  804564:	55                   	push   %ebp
+  804565:	89 e5                	mov    %esp,%ebp
+  804567:	57                   	push   %edi
+  804568:	56                   	push   %esi
+  804569:	53                   	push   %ebx
+  80456a:	83 ec 0c             	sub    $0xc,%esp
+  80456d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804570:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  804573:	83 ec 08             	sub    $0x8,%esp
+  804576:	ff 75 1c             	push   0x1c(%ebp)
+  804579:	ff 75 18             	push   0x18(%ebp)
+  80457c:	56                   	push   %esi
+  80457d:	ff 75 10             	push   0x10(%ebp)
+  804580:	57                   	push   %edi
+  804581:	ff 75 08             	push   0x8(%ebp)
+  804584:	e8 af ca ff ff       	call   801038 <sys_page_map_range>
+  804589:	89 c3                	mov    %eax,%ebx
+  80458b:	83 c4 20             	add    $0x20,%esp
+  80458e:	85 c0                	test   %eax,%eax
+  804590:	79 1b                	jns    8045ad <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804592:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804595:	75 20                	jne    8045b7 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804597:	83 ec 08             	sub    $0x8,%esp
+  80459a:	68 00 00 40 00       	push   $0x400000
+  80459f:	6a 00                	push   $0x0
+  8045a1:	e8 e6 f4 ff ff       	call   803a8c <page_out>
+  8045a6:	83 c4 10             	add    $0x10,%esp
+  8045a9:	85 c0                	test   %eax,%eax
+  8045ab:	79 c6                	jns    804573 <page_map_range+0xf>
+}
+  8045ad:	89 d8                	mov    %ebx,%eax
+  8045af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045b2:	5b                   	pop    %ebx
+  8045b3:	5e                   	pop    %esi
+  8045b4:	5f                   	pop    %edi
+  8045b5:	5d                   	pop    %ebp
+  8045b6:	c3                   	ret
+		if (r != -E_INVAL)
+  8045b7:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  8045ba:	75 f1                	jne    8045ad <page_map_range+0x49>
+  8045bc:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  8045be:	be 00 00 00 00       	mov    $0x0,%esi
+  8045c3:	eb 03                	jmp    8045c8 <page_map_range+0x64>
+  8045c5:	83 c6 01             	add    $0x1,%esi
+  8045c8:	3b 75 18             	cmp    0x18(%ebp),%esi
+  8045cb:	74 2a                	je     8045f7 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  8045cd:	83 ec 0c             	sub    $0xc,%esp
+  8045d0:	ff 75 1c             	push   0x1c(%ebp)
+  8045d3:	53                   	push   %ebx
+  8045d4:	ff 75 10             	push   0x10(%ebp)
+  8045d7:	57                   	push   %edi
+  8045d8:	ff 75 08             	push   0x8(%ebp)
+  8045db:	e8 8d fd ff ff       	call   80436d <page_map>
+  8045e0:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8045e6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8045ec:	83 c4 20             	add    $0x20,%esp
+  8045ef:	85 c0                	test   %eax,%eax
+  8045f1:	79 d2                	jns    8045c5 <page_map_range+0x61>
+  8045f3:	89 c3                	mov    %eax,%ebx
+  8045f5:	eb b6                	jmp    8045ad <page_map_range+0x49>
+		return 0;
+  8045f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8045fc:	eb af                	jmp    8045ad <page_map_range+0x49>
+
+008045fe <paging_pgfault_handler>:
+{
+  8045fe:	55                   	push   %ebp
+  8045ff:	89 e5                	mov    %esp,%ebp
+  804601:	56                   	push   %esi
+  804602:	53                   	push   %ebx
+  804603:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804606:	e8 6f e7 ff ff       	call   802d7a <find_paging_env>
+	if (pagingenv == 0)
+  80460b:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804610:	85 c0                	test   %eax,%eax
+  804612:	74 3c                	je     804650 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804614:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804616:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80461a:	75 12                	jne    80462e <paging_pgfault_handler+0x30>
+  80461c:	89 f0                	mov    %esi,%eax
+  80461e:	e8 7e f7 ff ff       	call   803da1 <page_adopt>
+  804623:	89 c2                	mov    %eax,%edx
+		return 0;
+  804625:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80462a:	85 d2                	test   %edx,%edx
+  80462c:	78 22                	js     804650 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  80462e:	83 ec 08             	sub    $0x8,%esp
+  804631:	6a 00                	push   $0x0
+  804633:	56                   	push   %esi
+  804634:	e8 a9 f3 ff ff       	call   8039e2 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804639:	83 c4 10             	add    $0x10,%esp
+  80463c:	85 c0                	test   %eax,%eax
+  80463e:	74 05                	je     804645 <paging_pgfault_handler+0x47>
+  804640:	f6 00 01             	testb  $0x1,(%eax)
+  804643:	75 12                	jne    804657 <paging_pgfault_handler+0x59>
+	return 0;
+  804645:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  80464a:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80464e:	74 23                	je     804673 <paging_pgfault_handler+0x75>
+}
+  804650:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804653:	5b                   	pop    %ebx
+  804654:	5e                   	pop    %esi
+  804655:	5d                   	pop    %ebp
+  804656:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804657:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80465c:	8b 40 48             	mov    0x48(%eax),%eax
+  80465f:	83 ec 08             	sub    $0x8,%esp
+  804662:	56                   	push   %esi
+  804663:	50                   	push   %eax
+  804664:	e8 d3 fa ff ff       	call   80413c <page_in>
+  804669:	f7 d0                	not    %eax
+  80466b:	c1 e8 1f             	shr    $0x1f,%eax
+  80466e:	83 c4 10             	add    $0x10,%esp
+  804671:	eb dd                	jmp    804650 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804673:	89 f0                	mov    %esi,%eax
+  804675:	e8 97 e2 ff ff       	call   802911 <segment_lookup>
+  80467a:	89 c2                	mov    %eax,%edx
+	return 0;
+  80467c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804681:	85 d2                	test   %edx,%edx
+  804683:	74 cb                	je     804650 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  804685:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80468a:	8b 40 48             	mov    0x48(%eax),%eax
+  80468d:	83 ec 08             	sub    $0x8,%esp
+  804690:	56                   	push   %esi
+  804691:	50                   	push   %eax
+  804692:	e8 f5 f3 ff ff       	call   803a8c <page_out>
+  804697:	f7 d0                	not    %eax
+  804699:	c1 e8 1f             	shr    $0x1f,%eax
+  80469c:	83 c4 10             	add    $0x10,%esp
+  80469f:	eb af                	jmp    804650 <paging_pgfault_handler+0x52>
+
+008046a1 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  8046a1:	55                   	push   %ebp
+  8046a2:	89 e5                	mov    %esp,%ebp
+  8046a4:	57                   	push   %edi
+  8046a5:	56                   	push   %esi
+  8046a6:	53                   	push   %ebx
+  8046a7:	83 ec 2c             	sub    $0x2c,%esp
+  8046aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8046ad:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  8046b2:	89 c1                	mov    %eax,%ecx
+  8046b4:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  8046b7:	c1 e8 11             	shr    $0x11,%eax
+  8046ba:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8046bd:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  8046c4:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8046c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8046cc:	d3 e0                	shl    %cl,%eax
+  8046ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8046d1:	85 c7                	test   %eax,%edi
+  8046d3:	74 12                	je     8046e7 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8046d5:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8046da:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  8046dd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8046e2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8046e5:	eb 17                	jmp    8046fe <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  8046e7:	ff 75 e0             	push   -0x20(%ebp)
+  8046ea:	68 fc 60 80 00       	push   $0x8060fc
+  8046ef:	6a 48                	push   $0x48
+  8046f1:	68 16 61 80 00       	push   $0x806116
+  8046f6:	e8 3a bc ff ff       	call   800335 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  8046fb:	83 c3 01             	add    $0x1,%ebx
+  8046fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804701:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804704:	89 c8                	mov    %ecx,%eax
+  804706:	c1 e8 05             	shr    $0x5,%eax
+  804709:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804710:	89 fe                	mov    %edi,%esi
+  804712:	d3 e6                	shl    %cl,%esi
+  804714:	89 f1                	mov    %esi,%ecx
+  804716:	85 d6                	test   %edx,%esi
+  804718:	74 e1                	je     8046fb <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  80471a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  80471d:	f7 d6                	not    %esi
+  80471f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804722:	21 fe                	and    %edi,%esi
+  804724:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804727:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  80472e:	f7 d1                	not    %ecx
+  804730:	21 d1                	and    %edx,%ecx
+  804732:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804739:	83 ec 04             	sub    $0x4,%esp
+  80473c:	53                   	push   %ebx
+  80473d:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804740:	57                   	push   %edi
+  804741:	6a 00                	push   $0x0
+  804743:	e8 97 f8 ff ff       	call   803fdf <page_unmap_range>
+	va_free(va, n);
+  804748:	83 c4 08             	add    $0x8,%esp
+  80474b:	53                   	push   %ebx
+  80474c:	57                   	push   %edi
+  80474d:	e8 ed 05 00 00       	call   804d3f <va_free>
+}
+  804752:	83 c4 10             	add    $0x10,%esp
+  804755:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804758:	5b                   	pop    %ebx
+  804759:	5e                   	pop    %esi
+  80475a:	5f                   	pop    %edi
+  80475b:	5d                   	pop    %ebp
+  80475c:	c3                   	ret
+
+0080475d <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  80475d:	55                   	push   %ebp
+  80475e:	89 e5                	mov    %esp,%ebp
+  804760:	57                   	push   %edi
+  804761:	56                   	push   %esi
+  804762:	53                   	push   %ebx
+  804763:	83 ec 1c             	sub    $0x1c,%esp
+  804766:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804769:	85 db                	test   %ebx,%ebx
+  80476b:	74 34                	je     8047a1 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  80476d:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804773:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804778:	77 2f                	ja     8047a9 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  80477a:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804780:	75 51                	jne    8047d3 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804782:	89 c1                	mov    %eax,%ecx
+  804784:	c1 e9 0c             	shr    $0xc,%ecx
+  804787:	ba 01 00 00 00       	mov    $0x1,%edx
+  80478c:	d3 e2                	shl    %cl,%edx
+  80478e:	c1 e8 11             	shr    $0x11,%eax
+  804791:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  804798:	75 24                	jne    8047be <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  80479a:	89 d8                	mov    %ebx,%eax
+  80479c:	e8 00 ff ff ff       	call   8046a1 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  8047a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047a4:	5b                   	pop    %ebx
+  8047a5:	5e                   	pop    %esi
+  8047a6:	5f                   	pop    %edi
+  8047a7:	5d                   	pop    %ebp
+  8047a8:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  8047a9:	53                   	push   %ebx
+  8047aa:	68 23 61 80 00       	push   $0x806123
+  8047af:	68 a2 00 00 00       	push   $0xa2
+  8047b4:	68 16 61 80 00       	push   $0x806116
+  8047b9:	e8 77 bb ff ff       	call   800335 <_panic>
+			panic("free: %p is not allocated", va);
+  8047be:	53                   	push   %ebx
+  8047bf:	68 fc 60 80 00       	push   $0x8060fc
+  8047c4:	68 a5 00 00 00       	push   $0xa5
+  8047c9:	68 16 61 80 00       	push   $0x806116
+  8047ce:	e8 62 bb ff ff       	call   800335 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  8047d3:	89 de                	mov    %ebx,%esi
+  8047d5:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  8047db:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  8047e1:	89 c8                	mov    %ecx,%eax
+  8047e3:	c1 e8 11             	shr    $0x11,%eax
+  8047e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8047e9:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  8047f0:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8047f3:	c1 e9 0c             	shr    $0xc,%ecx
+  8047f6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8047fb:	d3 e0                	shl    %cl,%eax
+  8047fd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804800:	85 c7                	test   %eax,%edi
+  804802:	74 1b                	je     80481f <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804804:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804808:	89 d8                	mov    %ebx,%eax
+  80480a:	29 f0                	sub    %esi,%eax
+  80480c:	83 e8 10             	sub    $0x10,%eax
+  80480f:	99                   	cltd
+  804810:	f7 ff                	idiv   %edi
+  804812:	89 d1                	mov    %edx,%ecx
+  804814:	85 d2                	test   %edx,%edx
+  804816:	75 07                	jne    80481f <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804818:	ba 10 00 00 00       	mov    $0x10,%edx
+  80481d:	eb 18                	jmp    804837 <free+0xda>
+		panic("free: %p is not allocated", va);
+  80481f:	53                   	push   %ebx
+  804820:	68 fc 60 80 00       	push   $0x8060fc
+  804825:	68 ad 00 00 00       	push   $0xad
+  80482a:	68 16 61 80 00       	push   $0x806116
+  80482f:	e8 01 bb ff ff       	call   800335 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804834:	83 c1 01             	add    $0x1,%ecx
+  804837:	89 d0                	mov    %edx,%eax
+  804839:	d3 e0                	shl    %cl,%eax
+  80483b:	39 c7                	cmp    %eax,%edi
+  80483d:	7f f5                	jg     804834 <free+0xd7>
+	*(void **) va = s->free;
+  80483f:	8b 46 08             	mov    0x8(%esi),%eax
+  804842:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804844:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804847:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  80484b:	8d 58 01             	lea    0x1(%eax),%ebx
+  80484e:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804852:	66 85 c0             	test   %ax,%ax
+  804855:	74 52                	je     8048a9 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804857:	0f b7 db             	movzwl %bx,%ebx
+  80485a:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80485e:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804863:	ba 00 00 00 00       	mov    $0x0,%edx
+  804868:	f7 ff                	idiv   %edi
+  80486a:	39 c3                	cmp    %eax,%ebx
+  80486c:	0f 85 2f ff ff ff    	jne    8047a1 <free+0x44>
+  804872:	8b 46 04             	mov    0x4(%esi),%eax
+  804875:	85 c0                	test   %eax,%eax
+  804877:	74 53                	je     8048cc <free+0x16f>
+		s->prev->next = s->next;
+  804879:	8b 16                	mov    (%esi),%edx
+  80487b:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80487d:	8b 06                	mov    (%esi),%eax
+  80487f:	85 c0                	test   %eax,%eax
+  804881:	74 06                	je     804889 <free+0x12c>
+		s->next->prev = s->prev;
+  804883:	8b 56 04             	mov    0x4(%esi),%edx
+  804886:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804889:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80488c:	f7 d0                	not    %eax
+  80488e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804891:	21 d0                	and    %edx,%eax
+  804893:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804896:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  80489d:	89 f0                	mov    %esi,%eax
+  80489f:	e8 fd fd ff ff       	call   8046a1 <heap_free_pages>
+  8048a4:	e9 f8 fe ff ff       	jmp    8047a1 <free+0x44>
+	s->prev = NULL;
+  8048a9:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  8048b0:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  8048b7:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  8048b9:	85 c0                	test   %eax,%eax
+  8048bb:	74 03                	je     8048c0 <free+0x163>
+		slabs[c]->prev = s;
+  8048bd:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  8048c0:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  8048c7:	e9 d5 fe ff ff       	jmp    8047a1 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8048cc:	8b 06                	mov    (%esi),%eax
+  8048ce:	85 c0                	test   %eax,%eax
+  8048d0:	0f 84 cb fe ff ff    	je     8047a1 <free+0x44>
+		slabs[c] = s->next;
+  8048d6:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  8048dd:	8b 06                	mov    (%esi),%eax
+  8048df:	eb a2                	jmp    804883 <free+0x126>
+
+008048e1 <heap_alloc_pages>:
+{
+  8048e1:	55                   	push   %ebp
+  8048e2:	89 e5                	mov    %esp,%ebp
+  8048e4:	57                   	push   %edi
+  8048e5:	56                   	push   %esi
+  8048e6:	53                   	push   %ebx
+  8048e7:	83 ec 18             	sub    $0x18,%esp
+  8048ea:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  8048ec:	50                   	push   %eax
+  8048ed:	e8 15 03 00 00       	call   804c07 <va_alloc>
+  8048f2:	89 c3                	mov    %eax,%ebx
+  8048f4:	83 c4 10             	add    $0x10,%esp
+  8048f7:	85 c0                	test   %eax,%eax
+  8048f9:	74 47                	je     804942 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8048fb:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804901:	89 c1                	mov    %eax,%ecx
+  804903:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804906:	c1 e8 11             	shr    $0x11,%eax
+  804909:	ba 01 00 00 00       	mov    $0x1,%edx
+  80490e:	89 d7                	mov    %edx,%edi
+  804910:	d3 e7                	shl    %cl,%edi
+  804912:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804919:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  80491d:	89 c8                	mov    %ecx,%eax
+  80491f:	c1 e8 05             	shr    $0x5,%eax
+  804922:	d3 e2                	shl    %cl,%edx
+  804924:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  80492b:	83 ec 0c             	sub    $0xc,%esp
+  80492e:	6a 00                	push   $0x0
+  804930:	6a 07                	push   $0x7
+  804932:	56                   	push   %esi
+  804933:	53                   	push   %ebx
+  804934:	6a 00                	push   $0x0
+  804936:	e8 3a f7 ff ff       	call   804075 <page_alloc_range>
+  80493b:	83 c4 20             	add    $0x20,%esp
+  80493e:	85 c0                	test   %eax,%eax
+  804940:	78 0a                	js     80494c <heap_alloc_pages+0x6b>
+}
+  804942:	89 d8                	mov    %ebx,%eax
+  804944:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804947:	5b                   	pop    %ebx
+  804948:	5e                   	pop    %esi
+  804949:	5f                   	pop    %edi
+  80494a:	5d                   	pop    %ebp
+  80494b:	c3                   	ret
+		free(va);
+  80494c:	83 ec 0c             	sub    $0xc,%esp
+  80494f:	53                   	push   %ebx
+  804950:	e8 08 fe ff ff       	call   80475d <free>
+		return NULL;
+  804955:	83 c4 10             	add    $0x10,%esp
+  804958:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80495d:	eb e3                	jmp    804942 <heap_alloc_pages+0x61>
+
+0080495f <malloc>:
+{
+  80495f:	55                   	push   %ebp
+  804960:	89 e5                	mov    %esp,%ebp
+  804962:	57                   	push   %edi
+  804963:	56                   	push   %esi
+  804964:	53                   	push   %ebx
+  804965:	83 ec 1c             	sub    $0x1c,%esp
+  804968:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  80496b:	8d 50 ff             	lea    -0x1(%eax),%edx
+  80496e:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804974:	0f 87 21 01 00 00    	ja     804a9b <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80497a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80497f:	ba 10 00 00 00       	mov    $0x10,%edx
+  804984:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804986:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80498b:	76 15                	jbe    8049a2 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  80498d:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804992:	c1 e8 0c             	shr    $0xc,%eax
+  804995:	e8 47 ff ff ff       	call   8048e1 <heap_alloc_pages>
+  80499a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80499d:	eb 37                	jmp    8049d6 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80499f:	83 c1 01             	add    $0x1,%ecx
+  8049a2:	89 d6                	mov    %edx,%esi
+  8049a4:	d3 e6                	shl    %cl,%esi
+  8049a6:	39 c6                	cmp    %eax,%esi
+  8049a8:	72 f5                	jb     80499f <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  8049aa:	89 cb                	mov    %ecx,%ebx
+  8049ac:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  8049b3:	85 ff                	test   %edi,%edi
+  8049b5:	74 2a                	je     8049e1 <malloc+0x82>
+	v = s->free;
+  8049b7:	8b 47 08             	mov    0x8(%edi),%eax
+  8049ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  8049bd:	8b 00                	mov    (%eax),%eax
+  8049bf:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  8049c2:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  8049c6:	83 e8 01             	sub    $0x1,%eax
+  8049c9:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  8049cd:	66 85 c0             	test   %ax,%ax
+  8049d0:	0f 84 9a 00 00 00    	je     804a70 <malloc+0x111>
+}
+  8049d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8049d9:	83 c4 1c             	add    $0x1c,%esp
+  8049dc:	5b                   	pop    %ebx
+  8049dd:	5e                   	pop    %esi
+  8049de:	5f                   	pop    %edi
+  8049df:	5d                   	pop    %ebp
+  8049e0:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  8049e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8049e6:	e8 f6 fe ff ff       	call   8048e1 <heap_alloc_pages>
+  8049eb:	89 c1                	mov    %eax,%ecx
+  8049ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8049f0:	85 c0                	test   %eax,%eax
+  8049f2:	74 e2                	je     8049d6 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8049f4:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8049fa:	89 c8                	mov    %ecx,%eax
+  8049fc:	c1 e8 11             	shr    $0x11,%eax
+  8049ff:	c1 e9 0c             	shr    $0xc,%ecx
+  804a02:	ba 01 00 00 00       	mov    $0x1,%edx
+  804a07:	d3 e2                	shl    %cl,%edx
+  804a09:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804a10:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804a13:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804a17:	0f b7 f6             	movzwl %si,%esi
+  804a1a:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804a1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a24:	f7 fe                	idiv   %esi
+  804a26:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804a2a:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804a2d:	85 c0                	test   %eax,%eax
+  804a2f:	74 14                	je     804a45 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804a31:	83 e8 01             	sub    $0x1,%eax
+  804a34:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804a38:	0f af d0             	imul   %eax,%edx
+  804a3b:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804a3f:	89 3a                	mov    %edi,(%edx)
+  804a41:	89 d7                	mov    %edx,%edi
+  804a43:	eb e5                	jmp    804a2a <malloc+0xcb>
+	s->prev = NULL;
+  804a45:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804a48:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804a4f:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  804a56:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804a58:	85 c0                	test   %eax,%eax
+  804a5a:	74 03                	je     804a5f <malloc+0x100>
+		slabs[c]->prev = s;
+  804a5c:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804a5f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804a62:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  804a69:	89 c7                	mov    %eax,%edi
+  804a6b:	e9 47 ff ff ff       	jmp    8049b7 <malloc+0x58>
+	if (s->prev)
+  804a70:	8b 47 04             	mov    0x4(%edi),%eax
+  804a73:	85 c0                	test   %eax,%eax
+  804a75:	74 19                	je     804a90 <malloc+0x131>
+		s->prev->next = s->next;
+  804a77:	8b 17                	mov    (%edi),%edx
+  804a79:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804a7b:	8b 07                	mov    (%edi),%eax
+  804a7d:	85 c0                	test   %eax,%eax
+  804a7f:	0f 84 51 ff ff ff    	je     8049d6 <malloc+0x77>
+		s->next->prev = s->prev;
+  804a85:	8b 57 04             	mov    0x4(%edi),%edx
+  804a88:	89 50 04             	mov    %edx,0x4(%eax)
+  804a8b:	e9 46 ff ff ff       	jmp    8049d6 <malloc+0x77>
+		slabs[c] = s->next;
+  804a90:	8b 07                	mov    (%edi),%eax
+  804a92:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  804a99:	eb e0                	jmp    804a7b <malloc+0x11c>
+		return NULL;
+  804a9b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804aa2:	e9 2f ff ff ff       	jmp    8049d6 <malloc+0x77>
+
+00804aa7 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804aa7:	55                   	push   %ebp
+  804aa8:	89 e5                	mov    %esp,%ebp
+  804aaa:	57                   	push   %edi
+  804aab:	56                   	push   %esi
+  804aac:	53                   	push   %ebx
+  804aad:	83 ec 0c             	sub    $0xc,%esp
+  804ab0:	89 c6                	mov    %eax,%esi
+  804ab2:	89 d7                	mov    %edx,%edi
+  804ab4:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804ab7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804abc:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804ac6:	83 ef 01             	sub    $0x1,%edi
+  804ac9:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804acc:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804acf:	eb 34                	jmp    804b05 <va_chunk_scan+0x5e>
+			i += 31;
+  804ad1:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804ad4:	89 ca                	mov    %ecx,%edx
+			continue;
+  804ad6:	eb 23                	jmp    804afb <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804ad8:	89 c7                	mov    %eax,%edi
+  804ada:	c1 ef 05             	shr    $0x5,%edi
+  804add:	be 01 00 00 00       	mov    $0x1,%esi
+  804ae2:	d3 e6                	shl    %cl,%esi
+  804ae4:	89 f1                	mov    %esi,%ecx
+  804ae6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804ae9:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804aec:	75 41                	jne    804b2f <va_chunk_scan+0x88>
+			len++;
+  804aee:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804af1:	39 d3                	cmp    %edx,%ebx
+  804af3:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804af6:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804af9:	72 2d                	jb     804b28 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804afb:	83 c0 01             	add    $0x1,%eax
+  804afe:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804b03:	77 31                	ja     804b36 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804b05:	89 c1                	mov    %eax,%ecx
+  804b07:	83 e1 1f             	and    $0x1f,%ecx
+  804b0a:	75 cc                	jne    804ad8 <va_chunk_scan+0x31>
+  804b0c:	89 c7                	mov    %eax,%edi
+  804b0e:	c1 ef 05             	shr    $0x5,%edi
+  804b11:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804b14:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804b17:	83 ff ff             	cmp    $0xffffffff,%edi
+  804b1a:	74 b5                	je     804ad1 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804b1c:	85 ff                	test   %edi,%edi
+  804b1e:	75 b8                	jne    804ad8 <va_chunk_scan+0x31>
+			i += 31;
+  804b20:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804b23:	83 c2 20             	add    $0x20,%edx
+  804b26:	eb c9                	jmp    804af1 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804b28:	83 c0 01             	add    $0x1,%eax
+  804b2b:	29 d0                	sub    %edx,%eax
+  804b2d:	eb 15                	jmp    804b44 <va_chunk_scan+0x9d>
+			len = 0;
+  804b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b34:	eb c5                	jmp    804afb <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804b36:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804b3b:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804b3e:	85 d2                	test   %edx,%edx
+  804b40:	74 02                	je     804b44 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804b42:	89 1a                	mov    %ebx,(%edx)
+}
+  804b44:	83 c4 0c             	add    $0xc,%esp
+  804b47:	5b                   	pop    %ebx
+  804b48:	5e                   	pop    %esi
+  804b49:	5f                   	pop    %edi
+  804b4a:	5d                   	pop    %ebp
+  804b4b:	c3                   	ret
+
+00804b4c <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804b4c:	55                   	push   %ebp
+  804b4d:	89 e5                	mov    %esp,%ebp
+  804b4f:	57                   	push   %edi
+  804b50:	56                   	push   %esi
+  804b51:	53                   	push   %ebx
+  804b52:	83 ec 14             	sub    $0x14,%esp
+  804b55:	89 c3                	mov    %eax,%ebx
+  804b57:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804b59:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804b5f:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  804b65:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804b68:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804b6b:	89 d6                	mov    %edx,%esi
+  804b6d:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  804b73:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804b75:	eb 34                	jmp    804bab <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804b77:	89 c8                	mov    %ecx,%eax
+  804b79:	c1 e8 05             	shr    $0x5,%eax
+  804b7c:	89 da                	mov    %ebx,%edx
+  804b7e:	c1 e2 05             	shl    $0x5,%edx
+  804b81:	01 da                	add    %ebx,%edx
+  804b83:	01 c2                	add    %eax,%edx
+  804b85:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804b8a:	d3 c0                	rol    %cl,%eax
+  804b8c:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804b93:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804b9a:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b9f:	01 d0                	add    %edx,%eax
+  804ba1:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804ba8:	83 c1 01             	add    $0x1,%ecx
+  804bab:	39 f9                	cmp    %edi,%ecx
+  804bad:	74 30                	je     804bdf <va_chunk_mark+0x93>
+		if (alloc)
+  804baf:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804bb3:	74 c2                	je     804b77 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804bb5:	89 c8                	mov    %ecx,%eax
+  804bb7:	c1 e8 05             	shr    $0x5,%eax
+  804bba:	89 da                	mov    %ebx,%edx
+  804bbc:	c1 e2 05             	shl    $0x5,%edx
+  804bbf:	01 da                	add    %ebx,%edx
+  804bc1:	01 c2                	add    %eax,%edx
+  804bc3:	b8 01 00 00 00       	mov    $0x1,%eax
+  804bc8:	d3 e0                	shl    %cl,%eax
+  804bca:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804bd1:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804bd8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804bdd:	eb c0                	jmp    804b9f <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804bdf:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804be2:	ba 00 00 00 00       	mov    $0x0,%edx
+  804be7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804bea:	e8 b8 fe ff ff       	call   804aa7 <va_chunk_scan>
+	ch->run = run;
+  804bef:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804bf5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804bf8:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804bff:	83 c4 14             	add    $0x14,%esp
+  804c02:	5b                   	pop    %ebx
+  804c03:	5e                   	pop    %esi
+  804c04:	5f                   	pop    %edi
+  804c05:	5d                   	pop    %ebp
+  804c06:	c3                   	ret
+
+00804c07 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804c07:	55                   	push   %ebp
+  804c08:	89 e5                	mov    %esp,%ebp
+  804c0a:	57                   	push   %edi
+  804c0b:	56                   	push   %esi
+  804c0c:	53                   	push   %ebx
+  804c0d:	83 ec 04             	sub    $0x4,%esp
+  804c10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804c13:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804c18:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804c1d:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804c24:	74 4f                	je     804c75 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804c26:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804c29:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804c2e:	0f 87 01 01 00 00    	ja     804d35 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804c34:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804c3a:	0f 87 80 00 00 00    	ja     804cc0 <va_alloc+0xb9>
+  804c40:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c45:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804c4a:	0f b7 10             	movzwl (%eax),%edx
+  804c4d:	05 84 00 00 00       	add    $0x84,%eax
+  804c52:	39 da                	cmp    %ebx,%edx
+  804c54:	73 2c                	jae    804c82 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804c56:	83 c6 01             	add    $0x1,%esi
+  804c59:	83 fe 1c             	cmp    $0x1c,%esi
+  804c5c:	75 ec                	jne    804c4a <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c63:	eb 53                	jmp    804cb8 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804c65:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804c6b:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804c70:	05 84 00 00 00       	add    $0x84,%eax
+  804c75:	39 d0                	cmp    %edx,%eax
+  804c77:	75 ec                	jne    804c65 <va_alloc+0x5e>
+	va_inited = 1;
+  804c79:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  804c80:	eb a4                	jmp    804c26 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804c82:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804c88:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  804c8d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804c92:	89 da                	mov    %ebx,%edx
+  804c94:	e8 0e fe ff ff       	call   804aa7 <va_chunk_scan>
+  804c99:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804c9b:	6a 01                	push   $0x1
+  804c9d:	89 d9                	mov    %ebx,%ecx
+  804c9f:	89 c2                	mov    %eax,%edx
+  804ca1:	89 f0                	mov    %esi,%eax
+  804ca3:	e8 a4 fe ff ff       	call   804b4c <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804ca8:	c1 e6 16             	shl    $0x16,%esi
+  804cab:	c1 e7 0c             	shl    $0xc,%edi
+  804cae:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804cb5:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cbb:	5b                   	pop    %ebx
+  804cbc:	5e                   	pop    %esi
+  804cbd:	5f                   	pop    %edi
+  804cbe:	5d                   	pop    %ebp
+  804cbf:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804cc0:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804cc6:	c1 ee 0a             	shr    $0xa,%esi
+  804cc9:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd3:	eb 0a                	jmp    804cdf <va_alloc+0xd8>
+			first = c + 1;
+  804cd5:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804cd7:	83 c2 01             	add    $0x1,%edx
+  804cda:	83 fa 1d             	cmp    $0x1d,%edx
+  804cdd:	74 4f                	je     804d2e <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804cdf:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804ce5:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  804cec:	00 04 
+  804cee:	75 e5                	jne    804cd5 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804cf0:	89 d1                	mov    %edx,%ecx
+  804cf2:	29 c1                	sub    %eax,%ecx
+  804cf4:	39 f1                	cmp    %esi,%ecx
+  804cf6:	75 df                	jne    804cd7 <va_alloc+0xd0>
+  804cf8:	89 c7                	mov    %eax,%edi
+  804cfa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804cfd:	be 00 04 00 00       	mov    $0x400,%esi
+  804d02:	39 f3                	cmp    %esi,%ebx
+  804d04:	0f 46 f3             	cmovbe %ebx,%esi
+  804d07:	6a 01                	push   $0x1
+  804d09:	89 f1                	mov    %esi,%ecx
+  804d0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d10:	89 f8                	mov    %edi,%eax
+  804d12:	e8 35 fe ff ff       	call   804b4c <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804d17:	83 c7 01             	add    $0x1,%edi
+  804d1a:	83 c4 04             	add    $0x4,%esp
+  804d1d:	29 f3                	sub    %esi,%ebx
+  804d1f:	75 dc                	jne    804cfd <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804d21:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804d24:	c1 e0 16             	shl    $0x16,%eax
+  804d27:	05 00 00 00 08       	add    $0x8000000,%eax
+  804d2c:	eb 8a                	jmp    804cb8 <va_alloc+0xb1>
+	return NULL;
+  804d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d33:	eb 83                	jmp    804cb8 <va_alloc+0xb1>
+		return NULL;
+  804d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d3a:	e9 79 ff ff ff       	jmp    804cb8 <va_alloc+0xb1>
+
+00804d3f <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804d3f:	55                   	push   %ebp
+  804d40:	89 e5                	mov    %esp,%ebp
+  804d42:	57                   	push   %edi
+  804d43:	56                   	push   %esi
+  804d44:	53                   	push   %ebx
+  804d45:	83 ec 0c             	sub    $0xc,%esp
+  804d48:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804d4b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804d4e:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804d54:	76 21                	jbe    804d77 <va_free+0x38>
+  804d56:	89 f0                	mov    %esi,%eax
+  804d58:	c1 e0 0c             	shl    $0xc,%eax
+  804d5b:	01 f8                	add    %edi,%eax
+  804d5d:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804d62:	77 13                	ja     804d77 <va_free+0x38>
+	    || PGOFF(va))
+  804d64:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804d6a:	75 0b                	jne    804d77 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804d6c:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804d72:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804d75:	eb 45                	jmp    804dbc <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804d77:	83 ec 0c             	sub    $0xc,%esp
+  804d7a:	56                   	push   %esi
+  804d7b:	57                   	push   %edi
+  804d7c:	68 40 61 80 00       	push   $0x806140
+  804d81:	68 8e 00 00 00       	push   $0x8e
+  804d86:	68 60 61 80 00       	push   $0x806160
+  804d8b:	e8 a5 b5 ff ff       	call   800335 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804d90:	89 fa                	mov    %edi,%edx
+  804d92:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804d98:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804d9d:	29 d3                	sub    %edx,%ebx
+  804d9f:	39 f3                	cmp    %esi,%ebx
+  804da1:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804da4:	89 f8                	mov    %edi,%eax
+  804da6:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804da9:	83 ec 0c             	sub    $0xc,%esp
+  804dac:	6a 00                	push   $0x0
+  804dae:	89 d9                	mov    %ebx,%ecx
+  804db0:	e8 97 fd ff ff       	call   804b4c <va_chunk_mark>
+		i += n;
+  804db5:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804db7:	29 de                	sub    %ebx,%esi
+  804db9:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804dbc:	85 f6                	test   %esi,%esi
+  804dbe:	75 d0                	jne    804d90 <va_free+0x51>
+	}
+}
+  804dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804dc3:	5b                   	pop    %ebx
+  804dc4:	5e                   	pop    %esi
+  804dc5:	5f                   	pop    %edi
+  804dc6:	5d                   	pop    %ebp
+  804dc7:	c3                   	ret
+
+00804dc8 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dcd:	c3                   	ret
+
+00804dce <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804dce:	55                   	push   %ebp
+  804dcf:	89 e5                	mov    %esp,%ebp
+  804dd1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804dd4:	68 6d 61 80 00       	push   $0x80616d
+  804dd9:	ff 75 0c             	push   0xc(%ebp)
+  804ddc:	e8 16 bc ff ff       	call   8009f7 <strcpy>
+	return 0;
+}
+  804de1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804de6:	c9                   	leave
+  804de7:	c3                   	ret
+
+00804de8 <devcons_write>:
+{
+  804de8:	55                   	push   %ebp
+  804de9:	89 e5                	mov    %esp,%ebp
+  804deb:	57                   	push   %edi
+  804dec:	56                   	push   %esi
+  804ded:	53                   	push   %ebx
+  804dee:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804df4:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804df9:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804dff:	eb 2e                	jmp    804e2f <devcons_write+0x47>
+		m = n - tot;
+  804e01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804e04:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804e06:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804e0b:	39 c3                	cmp    %eax,%ebx
+  804e0d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804e10:	83 ec 04             	sub    $0x4,%esp
+  804e13:	53                   	push   %ebx
+  804e14:	89 f0                	mov    %esi,%eax
+  804e16:	03 45 0c             	add    0xc(%ebp),%eax
+  804e19:	50                   	push   %eax
+  804e1a:	57                   	push   %edi
+  804e1b:	e8 5d bd ff ff       	call   800b7d <memmove>
+		sys_cputs(buf, m);
+  804e20:	83 c4 08             	add    $0x8,%esp
+  804e23:	53                   	push   %ebx
+  804e24:	57                   	push   %edi
+  804e25:	e8 f3 bf ff ff       	call   800e1d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804e2a:	01 de                	add    %ebx,%esi
+  804e2c:	83 c4 10             	add    $0x10,%esp
+  804e2f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804e32:	72 cd                	jb     804e01 <devcons_write+0x19>
+}
+  804e34:	89 f0                	mov    %esi,%eax
+  804e36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e39:	5b                   	pop    %ebx
+  804e3a:	5e                   	pop    %esi
+  804e3b:	5f                   	pop    %edi
+  804e3c:	5d                   	pop    %ebp
+  804e3d:	c3                   	ret
+
+00804e3e <devcons_read>:
+{
+  804e3e:	55                   	push   %ebp
+  804e3f:	89 e5                	mov    %esp,%ebp
+  804e41:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e49:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804e4d:	75 07                	jne    804e56 <devcons_read+0x18>
+  804e4f:	eb 1f                	jmp    804e70 <devcons_read+0x32>
+		sys_yield();
+  804e51:	e8 75 c0 ff ff       	call   800ecb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804e56:	e8 f1 bf ff ff       	call   800e4c <sys_cgetc>
+  804e5b:	85 c0                	test   %eax,%eax
+  804e5d:	74 f2                	je     804e51 <devcons_read+0x13>
+	if (c < 0)
+  804e5f:	78 0f                	js     804e70 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804e61:	83 f8 04             	cmp    $0x4,%eax
+  804e64:	74 0c                	je     804e72 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804e66:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804e69:	88 02                	mov    %al,(%edx)
+	return 1;
+  804e6b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804e70:	c9                   	leave
+  804e71:	c3                   	ret
+		return 0;
+  804e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e77:	eb f7                	jmp    804e70 <devcons_read+0x32>
+
+00804e79 <cputchar>:
+{
+  804e79:	55                   	push   %ebp
+  804e7a:	89 e5                	mov    %esp,%ebp
+  804e7c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804e7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e82:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804e85:	6a 01                	push   $0x1
+  804e87:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804e8a:	50                   	push   %eax
+  804e8b:	e8 8d bf ff ff       	call   800e1d <sys_cputs>
+}
+  804e90:	83 c4 10             	add    $0x10,%esp
+  804e93:	c9                   	leave
+  804e94:	c3                   	ret
+
+00804e95 <getchar>:
+{
+  804e95:	55                   	push   %ebp
+  804e96:	89 e5                	mov    %esp,%ebp
+  804e98:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804e9b:	6a 01                	push   $0x1
+  804e9d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804ea0:	50                   	push   %eax
+  804ea1:	6a 00                	push   $0x0
+  804ea3:	e8 6b ce ff ff       	call   801d13 <read>
+	if (r < 0)
+  804ea8:	83 c4 10             	add    $0x10,%esp
+  804eab:	85 c0                	test   %eax,%eax
+  804ead:	78 06                	js     804eb5 <getchar+0x20>
+	if (r < 1)
+  804eaf:	74 06                	je     804eb7 <getchar+0x22>
+	return c;
+  804eb1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804eb5:	c9                   	leave
+  804eb6:	c3                   	ret
+		return -E_EOF;
+  804eb7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804ebc:	eb f7                	jmp    804eb5 <getchar+0x20>
+
+00804ebe <iscons>:
+{
+  804ebe:	55                   	push   %ebp
+  804ebf:	89 e5                	mov    %esp,%ebp
+  804ec1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804ec4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804ec7:	50                   	push   %eax
+  804ec8:	ff 75 08             	push   0x8(%ebp)
+  804ecb:	e8 e4 cb ff ff       	call   801ab4 <fd_lookup>
+  804ed0:	83 c4 10             	add    $0x10,%esp
+  804ed3:	85 c0                	test   %eax,%eax
+  804ed5:	78 11                	js     804ee8 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804ed7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804eda:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  804ee0:	39 10                	cmp    %edx,(%eax)
+  804ee2:	0f 94 c0             	sete   %al
+  804ee5:	0f b6 c0             	movzbl %al,%eax
+}
+  804ee8:	c9                   	leave
+  804ee9:	c3                   	ret
+
+00804eea <opencons>:
+{
+  804eea:	55                   	push   %ebp
+  804eeb:	89 e5                	mov    %esp,%ebp
+  804eed:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804ef0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804ef3:	50                   	push   %eax
+  804ef4:	e8 67 cb ff ff       	call   801a60 <fd_alloc>
+  804ef9:	83 c4 10             	add    $0x10,%esp
+  804efc:	85 c0                	test   %eax,%eax
+  804efe:	78 3a                	js     804f3a <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804f00:	83 ec 04             	sub    $0x4,%esp
+  804f03:	68 07 04 00 00       	push   $0x407
+  804f08:	ff 75 f4             	push   -0xc(%ebp)
+  804f0b:	6a 00                	push   $0x0
+  804f0d:	e8 d8 bf ff ff       	call   800eea <sys_page_alloc>
+  804f12:	83 c4 10             	add    $0x10,%esp
+  804f15:	85 c0                	test   %eax,%eax
+  804f17:	78 21                	js     804f3a <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804f19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f1c:	8b 15 48 70 80 00    	mov    0x807048,%edx
+  804f22:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804f24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804f27:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804f2e:	83 ec 0c             	sub    $0xc,%esp
+  804f31:	50                   	push   %eax
+  804f32:	e8 02 cb ff ff       	call   801a39 <fd2num>
+  804f37:	83 c4 10             	add    $0x10,%esp
+}
+  804f3a:	c9                   	leave
+  804f3b:	c3                   	ret
+
+00804f3c <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804f3c:	55                   	push   %ebp
+  804f3d:	89 e5                	mov    %esp,%ebp
+  804f3f:	56                   	push   %esi
+  804f40:	53                   	push   %ebx
+  804f41:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804f44:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  804f49:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804f4c:	85 db                	test   %ebx,%ebx
+  804f4e:	78 17                	js     804f67 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804f50:	83 ec 0c             	sub    $0xc,%esp
+  804f53:	56                   	push   %esi
+  804f54:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  804f5b:	83 c4 10             	add    $0x10,%esp
+  804f5e:	85 c0                	test   %eax,%eax
+  804f60:	75 27                	jne    804f89 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804f62:	83 eb 01             	sub    $0x1,%ebx
+  804f65:	eb e5                	jmp    804f4c <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804f67:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f6c:	8b 40 48             	mov    0x48(%eax),%eax
+  804f6f:	83 ec 08             	sub    $0x8,%esp
+  804f72:	ff 76 28             	push   0x28(%esi)
+  804f75:	ff 36                	push   (%esi)
+  804f77:	50                   	push   %eax
+  804f78:	68 7c 61 80 00       	push   $0x80617c
+  804f7d:	6a 1d                	push   $0x1d
+  804f7f:	68 9f 61 80 00       	push   $0x80619f
+  804f84:	e8 ac b3 ff ff       	call   800335 <_panic>
+}
+  804f89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804f8c:	5b                   	pop    %ebx
+  804f8d:	5e                   	pop    %esi
+  804f8e:	5d                   	pop    %ebp
+  804f8f:	c3                   	ret
+
+00804f90 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804f90:	55                   	push   %ebp
+  804f91:	89 e5                	mov    %esp,%ebp
+  804f93:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804f96:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  804f9d:	74 0a                	je     804fa9 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804f9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  804fa2:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  804fa7:	c9                   	leave
+  804fa8:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804fa9:	83 ec 04             	sub    $0x4,%esp
+  804fac:	6a 07                	push   $0x7
+  804fae:	68 00 f0 bf ee       	push   $0xeebff000
+  804fb3:	6a 00                	push   $0x0
+  804fb5:	e8 30 bf ff ff       	call   800eea <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804fba:	83 c4 08             	add    $0x8,%esp
+  804fbd:	68 30 50 80 00       	push   $0x805030
+  804fc2:	6a 00                	push   $0x0
+  804fc4:	e8 87 c2 ff ff       	call   801250 <sys_env_set_pgfault_upcall>
+  804fc9:	83 c4 10             	add    $0x10,%esp
+  804fcc:	eb d1                	jmp    804f9f <set_pgfault_handler+0xf>
+
+00804fce <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804fce:	55                   	push   %ebp
+  804fcf:	89 e5                	mov    %esp,%ebp
+  804fd1:	83 ec 08             	sub    $0x8,%esp
+  804fd4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804fd7:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  804fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fe2:	eb 03                	jmp    804fe7 <add_pgfault_handler+0x19>
+  804fe4:	83 c0 01             	add    $0x1,%eax
+  804fe7:	39 d0                	cmp    %edx,%eax
+  804fe9:	74 0b                	je     804ff6 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804feb:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  804ff2:	75 f0                	jne    804fe4 <add_pgfault_handler+0x16>
+  804ff4:	eb 24                	jmp    80501a <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804ff6:	83 fa 0a             	cmp    $0xa,%edx
+  804ff9:	74 21                	je     80501c <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804ffb:	8d 42 01             	lea    0x1(%edx),%eax
+  804ffe:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  805003:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  80500a:	83 ec 0c             	sub    $0xc,%esp
+  80500d:	68 3c 4f 80 00       	push   $0x804f3c
+  805012:	e8 79 ff ff ff       	call   804f90 <set_pgfault_handler>
+  805017:	83 c4 10             	add    $0x10,%esp
+}
+  80501a:	c9                   	leave
+  80501b:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  80501c:	83 ec 04             	sub    $0x4,%esp
+  80501f:	68 ad 61 80 00       	push   $0x8061ad
+  805024:	6a 44                	push   $0x44
+  805026:	68 9f 61 80 00       	push   $0x80619f
+  80502b:	e8 05 b3 ff ff       	call   800335 <_panic>
+
+00805030 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805030:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805031:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  805036:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  805038:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  80503b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  80503f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  805043:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  805046:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  805048:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  80504c:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  80504f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  805050:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  805053:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  805054:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  805055:	c3                   	ret
+
+00805056 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  805056:	55                   	push   %ebp
+  805057:	89 e5                	mov    %esp,%ebp
+  805059:	57                   	push   %edi
+  80505a:	56                   	push   %esi
+  80505b:	53                   	push   %ebx
+  80505c:	83 ec 14             	sub    $0x14,%esp
+  80505f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  805062:	8b 75 14             	mov    0x14(%ebp),%esi
+  805065:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  805068:	ff 75 10             	push   0x10(%ebp)
+  80506b:	ff 75 0c             	push   0xc(%ebp)
+  80506e:	e8 9a c2 ff ff       	call   80130d <sys_ipc_recv_pages>
+  805073:	83 c4 10             	add    $0x10,%esp
+  805076:	85 c0                	test   %eax,%eax
+  805078:	78 46                	js     8050c0 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80507a:	85 ff                	test   %edi,%edi
+  80507c:	74 0d                	je     80508b <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  80507e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805083:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  805089:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80508b:	85 f6                	test   %esi,%esi
+  80508d:	74 0d                	je     80509c <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80508f:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805094:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80509a:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80509c:	85 db                	test   %ebx,%ebx
+  80509e:	74 0d                	je     8050ad <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8050a0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050a5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8050ab:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8050ad:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050b2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8050b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8050bb:	5b                   	pop    %ebx
+  8050bc:	5e                   	pop    %esi
+  8050bd:	5f                   	pop    %edi
+  8050be:	5d                   	pop    %ebp
+  8050bf:	c3                   	ret
+		if (from_env_store) {
+  8050c0:	85 ff                	test   %edi,%edi
+  8050c2:	74 06                	je     8050ca <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8050c4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8050ca:	85 f6                	test   %esi,%esi
+  8050cc:	74 06                	je     8050d4 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8050ce:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8050d4:	85 db                	test   %ebx,%ebx
+  8050d6:	74 e0                	je     8050b8 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8050d8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8050de:	eb d8                	jmp    8050b8 <ipc_recv_pages+0x62>
+
+008050e0 <ipc_recv>:
+{
+  8050e0:	55                   	push   %ebp
+  8050e1:	89 e5                	mov    %esp,%ebp
+  8050e3:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8050e6:	6a 00                	push   $0x0
+  8050e8:	ff 75 10             	push   0x10(%ebp)
+  8050eb:	6a 01                	push   $0x1
+  8050ed:	ff 75 0c             	push   0xc(%ebp)
+  8050f0:	ff 75 08             	push   0x8(%ebp)
+  8050f3:	e8 5e ff ff ff       	call   805056 <ipc_recv_pages>
+}
+  8050f8:	c9                   	leave
+  8050f9:	c3                   	ret
+
+008050fa <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8050fa:	55                   	push   %ebp
+  8050fb:	89 e5                	mov    %esp,%ebp
+  8050fd:	56                   	push   %esi
+  8050fe:	53                   	push   %ebx
+  8050ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  805102:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  805105:	83 ec 0c             	sub    $0xc,%esp
+  805108:	ff 75 0c             	push   0xc(%ebp)
+  80510b:	e8 31 c3 ff ff       	call   801441 <sys_ipc_try_recv>
+  805110:	83 c4 10             	add    $0x10,%esp
+  805113:	85 c0                	test   %eax,%eax
+  805115:	78 34                	js     80514b <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805117:	85 f6                	test   %esi,%esi
+  805119:	74 0d                	je     805128 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  80511b:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805120:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  805126:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  805128:	85 db                	test   %ebx,%ebx
+  80512a:	74 0d                	je     805139 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  80512c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805131:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805137:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805139:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80513e:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805144:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805147:	5b                   	pop    %ebx
+  805148:	5e                   	pop    %esi
+  805149:	5d                   	pop    %ebp
+  80514a:	c3                   	ret
+		if (from_env_store) {
+  80514b:	85 f6                	test   %esi,%esi
+  80514d:	74 06                	je     805155 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  80514f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  805155:	85 db                	test   %ebx,%ebx
+  805157:	74 eb                	je     805144 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  805159:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80515f:	eb e3                	jmp    805144 <ipc_try_recv+0x4a>
+
+00805161 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805161:	55                   	push   %ebp
+  805162:	89 e5                	mov    %esp,%ebp
+  805164:	83 ec 14             	sub    $0x14,%esp
+  805167:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80516a:	85 c0                	test   %eax,%eax
+  80516c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805171:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805174:	ff 75 18             	push   0x18(%ebp)
+  805177:	ff 75 14             	push   0x14(%ebp)
+  80517a:	50                   	push   %eax
+  80517b:	ff 75 0c             	push   0xc(%ebp)
+  80517e:	ff 75 08             	push   0x8(%ebp)
+  805181:	e8 4a c1 ff ff       	call   8012d0 <sys_ipc_send_pages>
+  805186:	83 c4 20             	add    $0x20,%esp
+  805189:	85 c0                	test   %eax,%eax
+  80518b:	78 02                	js     80518f <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  80518d:	c9                   	leave
+  80518e:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  80518f:	50                   	push   %eax
+  805190:	68 c8 61 80 00       	push   $0x8061c8
+  805195:	68 80 00 00 00       	push   $0x80
+  80519a:	68 f4 61 80 00       	push   $0x8061f4
+  80519f:	e8 91 b1 ff ff       	call   800335 <_panic>
+
+008051a4 <ipc_send>:
+{
+  8051a4:	55                   	push   %ebp
+  8051a5:	89 e5                	mov    %esp,%ebp
+  8051a7:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8051aa:	ff 75 14             	push   0x14(%ebp)
+  8051ad:	6a 01                	push   $0x1
+  8051af:	ff 75 10             	push   0x10(%ebp)
+  8051b2:	ff 75 0c             	push   0xc(%ebp)
+  8051b5:	ff 75 08             	push   0x8(%ebp)
+  8051b8:	e8 a4 ff ff ff       	call   805161 <ipc_send_pages>
+}
+  8051bd:	83 c4 20             	add    $0x20,%esp
+  8051c0:	c9                   	leave
+  8051c1:	c3                   	ret
+
+008051c2 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8051c2:	55                   	push   %ebp
+  8051c3:	89 e5                	mov    %esp,%ebp
+  8051c5:	83 ec 14             	sub    $0x14,%esp
+  8051c8:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8051cb:	85 c0                	test   %eax,%eax
+  8051cd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8051d2:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8051d5:	ff 75 18             	push   0x18(%ebp)
+  8051d8:	ff 75 14             	push   0x14(%ebp)
+  8051db:	50                   	push   %eax
+  8051dc:	ff 75 0c             	push   0xc(%ebp)
+  8051df:	ff 75 08             	push   0x8(%ebp)
+  8051e2:	e8 7a c1 ff ff       	call   801361 <sys_ipc_call>
+  8051e7:	83 c4 20             	add    $0x20,%esp
+  8051ea:	85 c0                	test   %eax,%eax
+  8051ec:	78 0b                	js     8051f9 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8051ee:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8051f3:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8051f9:	c9                   	leave
+  8051fa:	c3                   	ret
+
+008051fb <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8051fb:	55                   	push   %ebp
+  8051fc:	89 e5                	mov    %esp,%ebp
+  8051fe:	57                   	push   %edi
+  8051ff:	56                   	push   %esi
+  805200:	53                   	push   %ebx
+  805201:	83 ec 18             	sub    $0x18,%esp
+  805204:	8b 45 10             	mov    0x10(%ebp),%eax
+  805207:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80520a:	8b 75 20             	mov    0x20(%ebp),%esi
+  80520d:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805210:	85 c0                	test   %eax,%eax
+  805212:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805217:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80521a:	ff 75 18             	push   0x18(%ebp)
+  80521d:	ff 75 14             	push   0x14(%ebp)
+  805220:	50                   	push   %eax
+  805221:	ff 75 0c             	push   0xc(%ebp)
+  805224:	ff 75 08             	push   0x8(%ebp)
+  805227:	e8 76 c1 ff ff       	call   8013a2 <sys_ipc_reply_recv>
+  80522c:	83 c4 20             	add    $0x20,%esp
+  80522f:	85 c0                	test   %eax,%eax
+  805231:	78 46                	js     805279 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805233:	85 ff                	test   %edi,%edi
+  805235:	74 0d                	je     805244 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  805237:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80523c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  805242:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  805244:	85 f6                	test   %esi,%esi
+  805246:	74 0d                	je     805255 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  805248:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80524d:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805253:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  805255:	85 db                	test   %ebx,%ebx
+  805257:	74 0d                	je     805266 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  805259:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80525e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  805264:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805266:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80526b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805271:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805274:	5b                   	pop    %ebx
+  805275:	5e                   	pop    %esi
+  805276:	5f                   	pop    %edi
+  805277:	5d                   	pop    %ebp
+  805278:	c3                   	ret
+		if (from_env_store) {
+  805279:	85 ff                	test   %edi,%edi
+  80527b:	74 06                	je     805283 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  80527d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  805283:	85 f6                	test   %esi,%esi
+  805285:	74 06                	je     80528d <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  805287:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80528d:	85 db                	test   %ebx,%ebx
+  80528f:	74 e0                	je     805271 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  805291:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805297:	eb d8                	jmp    805271 <ipc_reply_recv+0x76>
+
+00805299 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805299:	55                   	push   %ebp
+  80529a:	89 e5                	mov    %esp,%ebp
+  80529c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80529f:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8052a4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8052a7:	c1 e0 06             	shl    $0x6,%eax
+  8052aa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8052af:	8b 40 50             	mov    0x50(%eax),%eax
+  8052b2:	39 c8                	cmp    %ecx,%eax
+  8052b4:	74 12                	je     8052c8 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8052b6:	83 c2 01             	add    $0x1,%edx
+  8052b9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8052bf:	75 e3                	jne    8052a4 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8052c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052c6:	eb 0e                	jmp    8052d6 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8052c8:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8052cb:	c1 e0 06             	shl    $0x6,%eax
+  8052ce:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8052d3:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8052d6:	5d                   	pop    %ebp
+  8052d7:	c3                   	ret
+
+008052d8 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8052d8:	55                   	push   %ebp
+  8052d9:	89 e5                	mov    %esp,%ebp
+  8052db:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8052de:	89 c2                	mov    %eax,%edx
+  8052e0:	c1 ea 16             	shr    $0x16,%edx
+  8052e3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8052ea:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8052ef:	f6 c1 01             	test   $0x1,%cl
+  8052f2:	74 1e                	je     805312 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8052f4:	c1 e8 0c             	shr    $0xc,%eax
+  8052f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8052fe:	a8 01                	test   $0x1,%al
+  805300:	74 10                	je     805312 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805302:	c1 e8 0c             	shr    $0xc,%eax
+  805305:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  805308:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  80530f:	0f b7 d2             	movzwl %dx,%edx
+}
+  805312:	89 d0                	mov    %edx,%eax
+  805314:	5d                   	pop    %ebp
+  805315:	c3                   	ret
+
+00805316 <udivmod>:
+  805316:	55                   	push   %ebp
+  805317:	57                   	push   %edi
+  805318:	56                   	push   %esi
+  805319:	53                   	push   %ebx
+  80531a:	83 ec 24             	sub    $0x24,%esp
+  80531d:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805321:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805325:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805329:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80532d:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805331:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805335:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  805339:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80533e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805343:	ba 00 00 00 00       	mov    $0x0,%edx
+  805348:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80534f:	00 
+  805350:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805357:	00 
+  805358:	89 fb                	mov    %edi,%ebx
+  80535a:	eb 08                	jmp    805364 <udivmod+0x4e>
+  80535c:	83 e9 01             	sub    $0x1,%ecx
+  80535f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805362:	74 68                	je     8053cc <udivmod+0xb6>
+  805364:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805368:	01 c0                	add    %eax,%eax
+  80536a:	89 c6                	mov    %eax,%esi
+  80536c:	89 d7                	mov    %edx,%edi
+  80536e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805372:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805376:	0f ad d0             	shrd   %cl,%edx,%eax
+  805379:	d3 ea                	shr    %cl,%edx
+  80537b:	f6 c1 20             	test   $0x20,%cl
+  80537e:	74 04                	je     805384 <udivmod+0x6e>
+  805380:	89 d0                	mov    %edx,%eax
+  805382:	31 d2                	xor    %edx,%edx
+  805384:	83 e0 01             	and    $0x1,%eax
+  805387:	89 04 24             	mov    %eax,(%esp)
+  80538a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805391:	00 
+  805392:	8b 04 24             	mov    (%esp),%eax
+  805395:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805399:	09 f0                	or     %esi,%eax
+  80539b:	09 fa                	or     %edi,%edx
+  80539d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8053a1:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8053a5:	39 f0                	cmp    %esi,%eax
+  8053a7:	89 d5                	mov    %edx,%ebp
+  8053a9:	19 fd                	sbb    %edi,%ebp
+  8053ab:	72 af                	jb     80535c <udivmod+0x46>
+  8053ad:	29 f0                	sub    %esi,%eax
+  8053af:	19 fa                	sbb    %edi,%edx
+  8053b1:	89 cf                	mov    %ecx,%edi
+  8053b3:	c1 ef 05             	shr    $0x5,%edi
+  8053b6:	83 e7 01             	and    $0x1,%edi
+  8053b9:	89 fe                	mov    %edi,%esi
+  8053bb:	83 f6 01             	xor    $0x1,%esi
+  8053be:	d3 e6                	shl    %cl,%esi
+  8053c0:	d3 e7                	shl    %cl,%edi
+  8053c2:	09 74 24 18          	or     %esi,0x18(%esp)
+  8053c6:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8053ca:	eb 90                	jmp    80535c <udivmod+0x46>
+  8053cc:	85 db                	test   %ebx,%ebx
+  8053ce:	74 05                	je     8053d5 <udivmod+0xbf>
+  8053d0:	89 03                	mov    %eax,(%ebx)
+  8053d2:	89 53 04             	mov    %edx,0x4(%ebx)
+  8053d5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8053d9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8053dd:	83 c4 24             	add    $0x24,%esp
+  8053e0:	5b                   	pop    %ebx
+  8053e1:	5e                   	pop    %esi
+  8053e2:	5f                   	pop    %edi
+  8053e3:	5d                   	pop    %ebp
+  8053e4:	c3                   	ret
+
+008053e5 <__udivdi3>:
+  8053e5:	83 ec 08             	sub    $0x8,%esp
+  8053e8:	6a 00                	push   $0x0
+  8053ea:	ff 74 24 1c          	push   0x1c(%esp)
+  8053ee:	ff 74 24 1c          	push   0x1c(%esp)
+  8053f2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8053f6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8053fa:	e8 17 ff ff ff       	call   805316 <udivmod>
+  8053ff:	83 c4 14             	add    $0x14,%esp
+  805402:	c3                   	ret
+
+00805403 <__umoddi3>:
+  805403:	83 ec 18             	sub    $0x18,%esp
+  805406:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80540a:	50                   	push   %eax
+  80540b:	ff 74 24 2c          	push   0x2c(%esp)
+  80540f:	ff 74 24 2c          	push   0x2c(%esp)
+  805413:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805417:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80541b:	e8 f6 fe ff ff       	call   805316 <udivmod>
+  805420:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805424:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805428:	83 c4 24             	add    $0x24,%esp
+  80542b:	c3                   	ret
+
+0080542c <__divdi3>:
+  80542c:	55                   	push   %ebp
+  80542d:	57                   	push   %edi
+  80542e:	56                   	push   %esi
+  80542f:	53                   	push   %ebx
+  805430:	83 ec 10             	sub    $0x10,%esp
+  805433:	8b 44 24 24          	mov    0x24(%esp),%eax
+  805437:	8b 54 24 28          	mov    0x28(%esp),%edx
+  80543b:	89 c6                	mov    %eax,%esi
+  80543d:	89 d7                	mov    %edx,%edi
+  80543f:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  805443:	33 7c 24 30          	xor    0x30(%esp),%edi
+  805447:	89 74 24 04          	mov    %esi,0x4(%esp)
+  80544b:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  80544f:	89 c5                	mov    %eax,%ebp
+  805451:	f7 dd                	neg    %ebp
+  805453:	89 d6                	mov    %edx,%esi
+  805455:	83 d6 00             	adc    $0x0,%esi
+  805458:	f7 de                	neg    %esi
+  80545a:	0f 48 e8             	cmovs  %eax,%ebp
+  80545d:	0f 49 d6             	cmovns %esi,%edx
+  805460:	6a 00                	push   $0x0
+  805462:	8b 74 24 30          	mov    0x30(%esp),%esi
+  805466:	f7 de                	neg    %esi
+  805468:	8b 44 24 34          	mov    0x34(%esp),%eax
+  80546c:	83 d0 00             	adc    $0x0,%eax
+  80546f:	f7 d8                	neg    %eax
+  805471:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  805476:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  80547b:	50                   	push   %eax
+  80547c:	56                   	push   %esi
+  80547d:	89 e8                	mov    %ebp,%eax
+  80547f:	e8 92 fe ff ff       	call   805316 <udivmod>
+  805484:	83 c4 10             	add    $0x10,%esp
+  805487:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  80548c:	78 08                	js     805496 <__divdi3+0x6a>
+  80548e:	83 c4 0c             	add    $0xc,%esp
+  805491:	5b                   	pop    %ebx
+  805492:	5e                   	pop    %esi
+  805493:	5f                   	pop    %edi
+  805494:	5d                   	pop    %ebp
+  805495:	c3                   	ret
+  805496:	f7 d8                	neg    %eax
+  805498:	83 d2 00             	adc    $0x0,%edx
+  80549b:	f7 da                	neg    %edx
+  80549d:	eb ef                	jmp    80548e <__divdi3+0x62>
+
+0080549f <__moddi3>:
+  80549f:	55                   	push   %ebp
+  8054a0:	57                   	push   %edi
+  8054a1:	56                   	push   %esi
+  8054a2:	53                   	push   %ebx
+  8054a3:	83 ec 18             	sub    $0x18,%esp
+  8054a6:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  8054aa:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  8054ae:	89 f1                	mov    %esi,%ecx
+  8054b0:	f7 d9                	neg    %ecx
+  8054b2:	89 da                	mov    %ebx,%edx
+  8054b4:	83 d2 00             	adc    $0x0,%edx
+  8054b7:	f7 da                	neg    %edx
+  8054b9:	0f 48 ce             	cmovs  %esi,%ecx
+  8054bc:	0f 48 d3             	cmovs  %ebx,%edx
+  8054bf:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8054c3:	50                   	push   %eax
+  8054c4:	8b 74 24 38          	mov    0x38(%esp),%esi
+  8054c8:	f7 de                	neg    %esi
+  8054ca:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8054ce:	83 d0 00             	adc    $0x0,%eax
+  8054d1:	f7 d8                	neg    %eax
+  8054d3:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8054d8:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8054dd:	50                   	push   %eax
+  8054de:	56                   	push   %esi
+  8054df:	89 c8                	mov    %ecx,%eax
+  8054e1:	e8 30 fe ff ff       	call   805316 <udivmod>
+  8054e6:	83 c4 10             	add    $0x10,%esp
+  8054e9:	85 db                	test   %ebx,%ebx
+  8054eb:	78 10                	js     8054fd <__moddi3+0x5e>
+  8054ed:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8054f1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8054f5:	83 c4 14             	add    $0x14,%esp
+  8054f8:	5b                   	pop    %ebx
+  8054f9:	5e                   	pop    %esi
+  8054fa:	5f                   	pop    %edi
+  8054fb:	5d                   	pop    %ebp
+  8054fc:	c3                   	ret
+  8054fd:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805501:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805505:	f7 d8                	neg    %eax
+  805507:	83 d2 00             	adc    $0x0,%edx
+  80550a:	f7 da                	neg    %edx
+  80550c:	eb e7                	jmp    8054f5 <__moddi3+0x56>
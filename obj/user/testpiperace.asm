@@ -0,0 +1,10604 @@
+
+obj/user/testpiperace.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 bd 01 00 00       	call   8001ee <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 1c             	sub    $0x1c,%esp
+	int p[2], r, pid, i, max;
+	void *va;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for dup race...\n");
+  80003b:	68 c0 53 80 00       	push   $0x8053c0
+  800040:	e8 e7 02 00 00       	call   80032c <cprintf>
+	if ((r = pipe(p)) < 0)
+  800045:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800048:	89 04 24             	mov    %eax,(%esp)
+  80004b:	e8 b4 28 00 00       	call   802904 <pipe>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	78 59                	js     8000b0 <umain+0x7d>
+		panic("pipe: %e", r);
+	max = 200;
+	if ((r = fork()) < 0)
+  800057:	e8 91 14 00 00       	call   8014ed <fork>
+  80005c:	89 c6                	mov    %eax,%esi
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 60                	js     8000c2 <umain+0x8f>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800062:	74 70                	je     8000d4 <umain+0xa1>
+		}
+		// do something to be not runnable besides exiting
+		ipc_recv(0,0,0);
+	}
+	pid = r;
+	cprintf("pid is %d\n", pid);
+  800064:	83 ec 08             	sub    $0x8,%esp
+  800067:	56                   	push   %esi
+  800068:	68 1a 54 80 00       	push   $0x80541a
+  80006d:	e8 ba 02 00 00       	call   80032c <cprintf>
+	va = 0;
+	kid = &envs[ENVX(pid)];
+  800072:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	cprintf("kid is %d\n", kid-envs);
+  800078:	83 c4 08             	add    $0x8,%esp
+  80007b:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+  80007e:	69 c0 cd cc cc cc    	imul   $0xcccccccd,%eax,%eax
+  800084:	50                   	push   %eax
+  800085:	68 25 54 80 00       	push   $0x805425
+  80008a:	e8 9d 02 00 00       	call   80032c <cprintf>
+	dup(p[0], 10);
+  80008f:	83 c4 08             	add    $0x8,%esp
+  800092:	6a 0a                	push   $0xa
+  800094:	ff 75 f0             	push   -0x10(%ebp)
+  800097:	e8 2b 1d 00 00       	call   801dc7 <dup>
+	while (kid->env_status == ENV_RUNNABLE)
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	8d 1c b6             	lea    (%esi,%esi,4),%ebx
+  8000a2:	c1 e3 06             	shl    $0x6,%ebx
+  8000a5:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8000ab:	e9 92 00 00 00       	jmp    800142 <umain+0x10f>
+		panic("pipe: %e", r);
+  8000b0:	50                   	push   %eax
+  8000b1:	68 d9 53 80 00       	push   $0x8053d9
+  8000b6:	6a 0d                	push   $0xd
+  8000b8:	68 e2 53 80 00       	push   $0x8053e2
+  8000bd:	e8 8f 01 00 00       	call   800251 <_panic>
+		panic("fork: %e", r);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 f6 53 80 00       	push   $0x8053f6
+  8000c8:	6a 10                	push   $0x10
+  8000ca:	68 e2 53 80 00       	push   $0x8053e2
+  8000cf:	e8 7d 01 00 00       	call   800251 <_panic>
+		close(p[1]);
+  8000d4:	83 ec 0c             	sub    $0xc,%esp
+  8000d7:	ff 75 f4             	push   -0xc(%ebp)
+  8000da:	e8 96 1c 00 00       	call   801d75 <close>
+		for (i=0; i<max; i++) {
+  8000df:	83 c4 10             	add    $0x10,%esp
+  8000e2:	bb c9 00 00 00       	mov    $0xc9,%ebx
+  8000e7:	eb 05                	jmp    8000ee <umain+0xbb>
+			sys_yield();
+  8000e9:	e8 f9 0c 00 00       	call   800de7 <sys_yield>
+		for (i=0; i<max; i++) {
+  8000ee:	83 eb 01             	sub    $0x1,%ebx
+  8000f1:	74 29                	je     80011c <umain+0xe9>
+			if(pipeisclosed(p[0])){
+  8000f3:	83 ec 0c             	sub    $0xc,%esp
+  8000f6:	ff 75 f0             	push   -0x10(%ebp)
+  8000f9:	e8 50 29 00 00       	call   802a4e <pipeisclosed>
+  8000fe:	83 c4 10             	add    $0x10,%esp
+  800101:	85 c0                	test   %eax,%eax
+  800103:	74 e4                	je     8000e9 <umain+0xb6>
+				cprintf("RACE: pipe appears closed\n");
+  800105:	83 ec 0c             	sub    $0xc,%esp
+  800108:	68 ff 53 80 00       	push   $0x8053ff
+  80010d:	e8 1a 02 00 00       	call   80032c <cprintf>
+				exit();
+  800112:	e8 20 01 00 00       	call   800237 <exit>
+  800117:	83 c4 10             	add    $0x10,%esp
+  80011a:	eb cd                	jmp    8000e9 <umain+0xb6>
+		ipc_recv(0,0,0);
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	6a 00                	push   $0x0
+  800121:	6a 00                	push   $0x0
+  800123:	6a 00                	push   $0x0
+  800125:	e8 b5 18 00 00       	call   8019df <ipc_recv>
+  80012a:	83 c4 10             	add    $0x10,%esp
+  80012d:	e9 32 ff ff ff       	jmp    800064 <umain+0x31>
+		dup(p[0], 10);
+  800132:	83 ec 08             	sub    $0x8,%esp
+  800135:	6a 0a                	push   $0xa
+  800137:	ff 75 f0             	push   -0x10(%ebp)
+  80013a:	e8 88 1c 00 00       	call   801dc7 <dup>
+  80013f:	83 c4 10             	add    $0x10,%esp
+	while (kid->env_status == ENV_RUNNABLE)
+  800142:	8b 43 54             	mov    0x54(%ebx),%eax
+  800145:	83 f8 02             	cmp    $0x2,%eax
+  800148:	74 e8                	je     800132 <umain+0xff>
+
+	cprintf("child done with loop\n");
+  80014a:	83 ec 0c             	sub    $0xc,%esp
+  80014d:	68 30 54 80 00       	push   $0x805430
+  800152:	e8 d5 01 00 00       	call   80032c <cprintf>
+	if (pipeisclosed(p[0]))
+  800157:	83 c4 04             	add    $0x4,%esp
+  80015a:	ff 75 f0             	push   -0x10(%ebp)
+  80015d:	e8 ec 28 00 00       	call   802a4e <pipeisclosed>
+  800162:	83 c4 10             	add    $0x10,%esp
+  800165:	85 c0                	test   %eax,%eax
+  800167:	75 48                	jne    8001b1 <umain+0x17e>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800169:	83 ec 08             	sub    $0x8,%esp
+  80016c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80016f:	50                   	push   %eax
+  800170:	ff 75 f0             	push   -0x10(%ebp)
+  800173:	e8 da 1a 00 00       	call   801c52 <fd_lookup>
+  800178:	83 c4 10             	add    $0x10,%esp
+  80017b:	85 c0                	test   %eax,%eax
+  80017d:	78 46                	js     8001c5 <umain+0x192>
+		panic("cannot look up p[0]: %e", r);
+	va = fd2data(fd);
+  80017f:	83 ec 0c             	sub    $0xc,%esp
+  800182:	ff 75 ec             	push   -0x14(%ebp)
+  800185:	e8 5d 1a 00 00       	call   801be7 <fd2data>
+	if (pageref(va) != 3+1)
+  80018a:	89 04 24             	mov    %eax,(%esp)
+  80018d:	e8 c2 23 00 00       	call   802554 <pageref>
+  800192:	83 c4 10             	add    $0x10,%esp
+  800195:	83 f8 04             	cmp    $0x4,%eax
+  800198:	74 3d                	je     8001d7 <umain+0x1a4>
+		cprintf("\nchild detected race\n");
+  80019a:	83 ec 0c             	sub    $0xc,%esp
+  80019d:	68 5e 54 80 00       	push   $0x80545e
+  8001a2:	e8 85 01 00 00       	call   80032c <cprintf>
+  8001a7:	83 c4 10             	add    $0x10,%esp
+	else
+		cprintf("\nrace didn't happen\n", max);
+}
+  8001aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ad:	5b                   	pop    %ebx
+  8001ae:	5e                   	pop    %esi
+  8001af:	5d                   	pop    %ebp
+  8001b0:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001b1:	83 ec 04             	sub    $0x4,%esp
+  8001b4:	68 8c 54 80 00       	push   $0x80548c
+  8001b9:	6a 3a                	push   $0x3a
+  8001bb:	68 e2 53 80 00       	push   $0x8053e2
+  8001c0:	e8 8c 00 00 00       	call   800251 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001c5:	50                   	push   %eax
+  8001c6:	68 46 54 80 00       	push   $0x805446
+  8001cb:	6a 3c                	push   $0x3c
+  8001cd:	68 e2 53 80 00       	push   $0x8053e2
+  8001d2:	e8 7a 00 00 00       	call   800251 <_panic>
+		cprintf("\nrace didn't happen\n", max);
+  8001d7:	83 ec 08             	sub    $0x8,%esp
+  8001da:	68 c8 00 00 00       	push   $0xc8
+  8001df:	68 74 54 80 00       	push   $0x805474
+  8001e4:	e8 43 01 00 00       	call   80032c <cprintf>
+  8001e9:	83 c4 10             	add    $0x10,%esp
+}
+  8001ec:	eb bc                	jmp    8001aa <umain+0x177>
+
+008001ee <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ee:	55                   	push   %ebp
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	56                   	push   %esi
+  8001f2:	53                   	push   %ebx
+  8001f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001f6:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8001f9:	e8 ca 0b 00 00       	call   800dc8 <sys_getenvid>
+  8001fe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800203:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800206:	c1 e0 06             	shl    $0x6,%eax
+  800209:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80020e:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  800213:	85 db                	test   %ebx,%ebx
+  800215:	7e 07                	jle    80021e <libmain+0x30>
+		binaryname = argv[0];
+  800217:	8b 06                	mov    (%esi),%eax
+  800219:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// call user main routine
+	umain(argc, argv);
+  80021e:	83 ec 08             	sub    $0x8,%esp
+  800221:	56                   	push   %esi
+  800222:	53                   	push   %ebx
+  800223:	e8 0b fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  800228:	e8 0a 00 00 00       	call   800237 <exit>
+}
+  80022d:	83 c4 10             	add    $0x10,%esp
+  800230:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800233:	5b                   	pop    %ebx
+  800234:	5e                   	pop    %esi
+  800235:	5d                   	pop    %ebp
+  800236:	c3                   	ret
+
+00800237 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  80023d:	e8 60 1b 00 00       	call   801da2 <close_all>
+	sys_env_destroy(0);
+  800242:	83 ec 0c             	sub    $0xc,%esp
+  800245:	6a 00                	push   $0x0
+  800247:	e8 3b 0b 00 00       	call   800d87 <sys_env_destroy>
+}
+  80024c:	83 c4 10             	add    $0x10,%esp
+  80024f:	c9                   	leave
+  800250:	c3                   	ret
+
+00800251 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800251:	55                   	push   %ebp
+  800252:	89 e5                	mov    %esp,%ebp
+  800254:	56                   	push   %esi
+  800255:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800256:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800259:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  80025f:	e8 64 0b 00 00       	call   800dc8 <sys_getenvid>
+  800264:	83 ec 0c             	sub    $0xc,%esp
+  800267:	ff 75 0c             	push   0xc(%ebp)
+  80026a:	ff 75 08             	push   0x8(%ebp)
+  80026d:	56                   	push   %esi
+  80026e:	50                   	push   %eax
+  80026f:	68 c0 54 80 00       	push   $0x8054c0
+  800274:	e8 b3 00 00 00       	call   80032c <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800279:	83 c4 18             	add    $0x18,%esp
+  80027c:	53                   	push   %ebx
+  80027d:	ff 75 10             	push   0x10(%ebp)
+  800280:	e8 56 00 00 00       	call   8002db <vcprintf>
+	cprintf("\n");
+  800285:	c7 04 24 d7 53 80 00 	movl   $0x8053d7,(%esp)
+  80028c:	e8 9b 00 00 00       	call   80032c <cprintf>
+  800291:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800294:	cc                   	int3
+	while (1)
+  800295:	eb fd                	jmp    800294 <_panic+0x43>
+
+00800297 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800297:	55                   	push   %ebp
+  800298:	89 e5                	mov    %esp,%ebp
+  80029a:	53                   	push   %ebx
+  80029b:	83 ec 04             	sub    $0x4,%esp
+  80029e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8002a1:	8b 13                	mov    (%ebx),%edx
+  8002a3:	8d 42 01             	lea    0x1(%edx),%eax
+  8002a6:	89 03                	mov    %eax,(%ebx)
+  8002a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002ab:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8002af:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002b4:	74 09                	je     8002bf <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8002b6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002bd:	c9                   	leave
+  8002be:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002bf:	83 ec 08             	sub    $0x8,%esp
+  8002c2:	68 ff 00 00 00       	push   $0xff
+  8002c7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002ca:	50                   	push   %eax
+  8002cb:	e8 69 0a 00 00       	call   800d39 <sys_cputs>
+		b->idx = 0;
+  8002d0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002d6:	83 c4 10             	add    $0x10,%esp
+  8002d9:	eb db                	jmp    8002b6 <putch+0x1f>
+
+008002db <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002db:	55                   	push   %ebp
+  8002dc:	89 e5                	mov    %esp,%ebp
+  8002de:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002e4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002eb:	00 00 00 
+	b.cnt = 0;
+  8002ee:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002f5:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002f8:	ff 75 0c             	push   0xc(%ebp)
+  8002fb:	ff 75 08             	push   0x8(%ebp)
+  8002fe:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800304:	50                   	push   %eax
+  800305:	68 97 02 80 00       	push   $0x800297
+  80030a:	e8 14 01 00 00       	call   800423 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  80030f:	83 c4 08             	add    $0x8,%esp
+  800312:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800318:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80031e:	50                   	push   %eax
+  80031f:	e8 15 0a 00 00       	call   800d39 <sys_cputs>
+
+	return b.cnt;
+}
+  800324:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80032a:	c9                   	leave
+  80032b:	c3                   	ret
+
+0080032c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80032c:	55                   	push   %ebp
+  80032d:	89 e5                	mov    %esp,%ebp
+  80032f:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800332:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800335:	50                   	push   %eax
+  800336:	ff 75 08             	push   0x8(%ebp)
+  800339:	e8 9d ff ff ff       	call   8002db <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  80033e:	c9                   	leave
+  80033f:	c3                   	ret
+
+00800340 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800340:	55                   	push   %ebp
+  800341:	89 e5                	mov    %esp,%ebp
+  800343:	57                   	push   %edi
+  800344:	56                   	push   %esi
+  800345:	53                   	push   %ebx
+  800346:	83 ec 1c             	sub    $0x1c,%esp
+  800349:	89 c7                	mov    %eax,%edi
+  80034b:	89 d6                	mov    %edx,%esi
+  80034d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800350:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800353:	89 d1                	mov    %edx,%ecx
+  800355:	89 c2                	mov    %eax,%edx
+  800357:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80035a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80035d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800360:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800363:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800366:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80036d:	39 c2                	cmp    %eax,%edx
+  80036f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800372:	72 3e                	jb     8003b2 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800374:	83 ec 0c             	sub    $0xc,%esp
+  800377:	ff 75 18             	push   0x18(%ebp)
+  80037a:	83 eb 01             	sub    $0x1,%ebx
+  80037d:	53                   	push   %ebx
+  80037e:	50                   	push   %eax
+  80037f:	83 ec 08             	sub    $0x8,%esp
+  800382:	ff 75 e4             	push   -0x1c(%ebp)
+  800385:	ff 75 e0             	push   -0x20(%ebp)
+  800388:	ff 75 dc             	push   -0x24(%ebp)
+  80038b:	ff 75 d8             	push   -0x28(%ebp)
+  80038e:	e8 02 4f 00 00       	call   805295 <__udivdi3>
+  800393:	83 c4 18             	add    $0x18,%esp
+  800396:	52                   	push   %edx
+  800397:	50                   	push   %eax
+  800398:	89 f2                	mov    %esi,%edx
+  80039a:	89 f8                	mov    %edi,%eax
+  80039c:	e8 9f ff ff ff       	call   800340 <printnum>
+  8003a1:	83 c4 20             	add    $0x20,%esp
+  8003a4:	eb 13                	jmp    8003b9 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8003a6:	83 ec 08             	sub    $0x8,%esp
+  8003a9:	56                   	push   %esi
+  8003aa:	ff 75 18             	push   0x18(%ebp)
+  8003ad:	ff d7                	call   *%edi
+  8003af:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8003b2:	83 eb 01             	sub    $0x1,%ebx
+  8003b5:	85 db                	test   %ebx,%ebx
+  8003b7:	7f ed                	jg     8003a6 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8003b9:	83 ec 08             	sub    $0x8,%esp
+  8003bc:	56                   	push   %esi
+  8003bd:	83 ec 04             	sub    $0x4,%esp
+  8003c0:	ff 75 e4             	push   -0x1c(%ebp)
+  8003c3:	ff 75 e0             	push   -0x20(%ebp)
+  8003c6:	ff 75 dc             	push   -0x24(%ebp)
+  8003c9:	ff 75 d8             	push   -0x28(%ebp)
+  8003cc:	e8 e2 4e 00 00       	call   8052b3 <__umoddi3>
+  8003d1:	83 c4 14             	add    $0x14,%esp
+  8003d4:	0f be 80 e3 54 80 00 	movsbl 0x8054e3(%eax),%eax
+  8003db:	50                   	push   %eax
+  8003dc:	ff d7                	call   *%edi
+}
+  8003de:	83 c4 10             	add    $0x10,%esp
+  8003e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e4:	5b                   	pop    %ebx
+  8003e5:	5e                   	pop    %esi
+  8003e6:	5f                   	pop    %edi
+  8003e7:	5d                   	pop    %ebp
+  8003e8:	c3                   	ret
+
+008003e9 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003e9:	55                   	push   %ebp
+  8003ea:	89 e5                	mov    %esp,%ebp
+  8003ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003ef:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003f3:	8b 10                	mov    (%eax),%edx
+  8003f5:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003f8:	73 0a                	jae    800404 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003fa:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003fd:	89 08                	mov    %ecx,(%eax)
+  8003ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800402:	88 02                	mov    %al,(%edx)
+}
+  800404:	5d                   	pop    %ebp
+  800405:	c3                   	ret
+
+00800406 <printfmt>:
+{
+  800406:	55                   	push   %ebp
+  800407:	89 e5                	mov    %esp,%ebp
+  800409:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  80040c:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  80040f:	50                   	push   %eax
+  800410:	ff 75 10             	push   0x10(%ebp)
+  800413:	ff 75 0c             	push   0xc(%ebp)
+  800416:	ff 75 08             	push   0x8(%ebp)
+  800419:	e8 05 00 00 00       	call   800423 <vprintfmt>
+}
+  80041e:	83 c4 10             	add    $0x10,%esp
+  800421:	c9                   	leave
+  800422:	c3                   	ret
+
+00800423 <vprintfmt>:
+{
+  800423:	55                   	push   %ebp
+  800424:	89 e5                	mov    %esp,%ebp
+  800426:	57                   	push   %edi
+  800427:	56                   	push   %esi
+  800428:	53                   	push   %ebx
+  800429:	83 ec 2c             	sub    $0x2c,%esp
+  80042c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80042f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800432:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800435:	eb 0a                	jmp    800441 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800437:	83 ec 08             	sub    $0x8,%esp
+  80043a:	53                   	push   %ebx
+  80043b:	50                   	push   %eax
+  80043c:	ff d6                	call   *%esi
+  80043e:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800441:	83 c7 01             	add    $0x1,%edi
+  800444:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800448:	83 f8 25             	cmp    $0x25,%eax
+  80044b:	74 0c                	je     800459 <vprintfmt+0x36>
+			if (ch == '\0')
+  80044d:	85 c0                	test   %eax,%eax
+  80044f:	75 e6                	jne    800437 <vprintfmt+0x14>
+}
+  800451:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800454:	5b                   	pop    %ebx
+  800455:	5e                   	pop    %esi
+  800456:	5f                   	pop    %edi
+  800457:	5d                   	pop    %ebp
+  800458:	c3                   	ret
+		padc = ' ';
+  800459:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80045d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800464:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80046b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800472:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800477:	8d 47 01             	lea    0x1(%edi),%eax
+  80047a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80047d:	0f b6 17             	movzbl (%edi),%edx
+  800480:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800483:	3c 55                	cmp    $0x55,%al
+  800485:	0f 87 c5 03 00 00    	ja     800850 <vprintfmt+0x42d>
+  80048b:	0f b6 c0             	movzbl %al,%eax
+  80048e:	ff 24 85 60 56 80 00 	jmp    *0x805660(,%eax,4)
+  800495:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800498:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80049c:	eb d9                	jmp    800477 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80049e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004a1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004a5:	eb d0                	jmp    800477 <vprintfmt+0x54>
+  8004a7:	0f b6 d2             	movzbl %dl,%edx
+  8004aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8004ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8004b5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004b8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004bc:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004bf:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004c2:	83 f9 09             	cmp    $0x9,%ecx
+  8004c5:	77 55                	ja     80051c <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004c7:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004ca:	eb e9                	jmp    8004b5 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004cf:	8b 00                	mov    (%eax),%eax
+  8004d1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8004da:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004e0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004e4:	79 91                	jns    800477 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004e6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ec:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004f3:	eb 82                	jmp    800477 <vprintfmt+0x54>
+			if (width < 0)
+  8004f5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f8:	85 d2                	test   %edx,%edx
+  8004fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ff:	0f 49 c2             	cmovns %edx,%eax
+  800502:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800505:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800508:	e9 6a ff ff ff       	jmp    800477 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80050d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800510:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800517:	e9 5b ff ff ff       	jmp    800477 <vprintfmt+0x54>
+  80051c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80051f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800522:	eb bc                	jmp    8004e0 <vprintfmt+0xbd>
+			lflag++;
+  800524:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800527:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80052a:	e9 48 ff ff ff       	jmp    800477 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  80052f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800532:	8d 78 04             	lea    0x4(%eax),%edi
+  800535:	83 ec 08             	sub    $0x8,%esp
+  800538:	53                   	push   %ebx
+  800539:	ff 30                	push   (%eax)
+  80053b:	ff d6                	call   *%esi
+			break;
+  80053d:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800540:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800543:	e9 63 02 00 00       	jmp    8007ab <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  800548:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054b:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  80054e:	8b 10                	mov    (%eax),%edx
+  800550:	89 d0                	mov    %edx,%eax
+  800552:	f7 d8                	neg    %eax
+  800554:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800557:	83 f8 12             	cmp    $0x12,%eax
+  80055a:	7f 23                	jg     80057f <vprintfmt+0x15c>
+  80055c:	8b 14 85 c0 57 80 00 	mov    0x8057c0(,%eax,4),%edx
+  800563:	85 d2                	test   %edx,%edx
+  800565:	74 18                	je     80057f <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800567:	52                   	push   %edx
+  800568:	68 25 5a 80 00       	push   $0x805a25
+  80056d:	53                   	push   %ebx
+  80056e:	56                   	push   %esi
+  80056f:	e8 92 fe ff ff       	call   800406 <printfmt>
+  800574:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800577:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80057a:	e9 2c 02 00 00       	jmp    8007ab <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80057f:	50                   	push   %eax
+  800580:	68 fb 54 80 00       	push   $0x8054fb
+  800585:	53                   	push   %ebx
+  800586:	56                   	push   %esi
+  800587:	e8 7a fe ff ff       	call   800406 <printfmt>
+  80058c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80058f:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800592:	e9 14 02 00 00       	jmp    8007ab <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	83 c0 04             	add    $0x4,%eax
+  80059d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a3:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8005a5:	85 c9                	test   %ecx,%ecx
+  8005a7:	b8 f4 54 80 00       	mov    $0x8054f4,%eax
+  8005ac:	0f 45 c1             	cmovne %ecx,%eax
+  8005af:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8005b2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005b6:	7e 06                	jle    8005be <vprintfmt+0x19b>
+  8005b8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005bc:	75 0b                	jne    8005c9 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005be:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005c1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005c4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c7:	eb 5c                	jmp    800625 <vprintfmt+0x202>
+  8005c9:	83 ec 08             	sub    $0x8,%esp
+  8005cc:	ff 75 d0             	push   -0x30(%ebp)
+  8005cf:	ff 75 cc             	push   -0x34(%ebp)
+  8005d2:	e8 19 03 00 00       	call   8008f0 <strnlen>
+  8005d7:	89 c2                	mov    %eax,%edx
+  8005d9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005dc:	29 d0                	sub    %edx,%eax
+  8005de:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005e1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005e8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005eb:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005ed:	eb 0e                	jmp    8005fd <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005ef:	83 ec 08             	sub    $0x8,%esp
+  8005f2:	53                   	push   %ebx
+  8005f3:	57                   	push   %edi
+  8005f4:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005f7:	83 ee 01             	sub    $0x1,%esi
+  8005fa:	83 c4 10             	add    $0x10,%esp
+  8005fd:	85 f6                	test   %esi,%esi
+  8005ff:	7f ee                	jg     8005ef <vprintfmt+0x1cc>
+  800601:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800604:	8b 75 08             	mov    0x8(%ebp),%esi
+  800607:	85 c0                	test   %eax,%eax
+  800609:	ba 00 00 00 00       	mov    $0x0,%edx
+  80060e:	0f 49 d0             	cmovns %eax,%edx
+  800611:	29 d0                	sub    %edx,%eax
+  800613:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800616:	eb a6                	jmp    8005be <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800618:	83 ec 08             	sub    $0x8,%esp
+  80061b:	53                   	push   %ebx
+  80061c:	52                   	push   %edx
+  80061d:	ff 55 08             	call   *0x8(%ebp)
+  800620:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800623:	89 f1                	mov    %esi,%ecx
+  800625:	8d 71 01             	lea    0x1(%ecx),%esi
+  800628:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80062c:	0f be d0             	movsbl %al,%edx
+  80062f:	85 d2                	test   %edx,%edx
+  800631:	74 28                	je     80065b <vprintfmt+0x238>
+  800633:	85 ff                	test   %edi,%edi
+  800635:	78 05                	js     80063c <vprintfmt+0x219>
+  800637:	83 ef 01             	sub    $0x1,%edi
+  80063a:	78 30                	js     80066c <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  80063c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800640:	74 d6                	je     800618 <vprintfmt+0x1f5>
+  800642:	0f be c0             	movsbl %al,%eax
+  800645:	83 e8 20             	sub    $0x20,%eax
+  800648:	83 f8 5e             	cmp    $0x5e,%eax
+  80064b:	76 cb                	jbe    800618 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	6a 3f                	push   $0x3f
+  800653:	ff 55 08             	call   *0x8(%ebp)
+  800656:	83 c4 10             	add    $0x10,%esp
+  800659:	eb c8                	jmp    800623 <vprintfmt+0x200>
+  80065b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80065e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800661:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800664:	01 d0                	add    %edx,%eax
+  800666:	29 c8                	sub    %ecx,%eax
+  800668:	89 c7                	mov    %eax,%edi
+  80066a:	eb 13                	jmp    80067f <vprintfmt+0x25c>
+  80066c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80066f:	eb ed                	jmp    80065e <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	53                   	push   %ebx
+  800675:	6a 20                	push   $0x20
+  800677:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800679:	83 ef 01             	sub    $0x1,%edi
+  80067c:	83 c4 10             	add    $0x10,%esp
+  80067f:	85 ff                	test   %edi,%edi
+  800681:	7f ee                	jg     800671 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800683:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+  800689:	e9 1d 01 00 00       	jmp    8007ab <vprintfmt+0x388>
+	if (lflag >= 2)
+  80068e:	83 f9 01             	cmp    $0x1,%ecx
+  800691:	7f 1b                	jg     8006ae <vprintfmt+0x28b>
+	else if (lflag)
+  800693:	85 c9                	test   %ecx,%ecx
+  800695:	74 63                	je     8006fa <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800697:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069a:	8b 00                	mov    (%eax),%eax
+  80069c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069f:	99                   	cltd
+  8006a0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ac:	eb 17                	jmp    8006c5 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  8006ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b1:	8b 50 04             	mov    0x4(%eax),%edx
+  8006b4:	8b 00                	mov    (%eax),%eax
+  8006b6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bf:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c2:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006c5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006d0:	85 c9                	test   %ecx,%ecx
+  8006d2:	0f 89 b9 00 00 00    	jns    800791 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8006d8:	83 ec 08             	sub    $0x8,%esp
+  8006db:	53                   	push   %ebx
+  8006dc:	6a 2d                	push   $0x2d
+  8006de:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006e0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006e3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006e6:	f7 da                	neg    %edx
+  8006e8:	83 d1 00             	adc    $0x0,%ecx
+  8006eb:	f7 d9                	neg    %ecx
+  8006ed:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006f0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006f5:	e9 97 00 00 00       	jmp    800791 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8b 00                	mov    (%eax),%eax
+  8006ff:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800702:	99                   	cltd
+  800703:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800706:	8b 45 14             	mov    0x14(%ebp),%eax
+  800709:	8d 40 04             	lea    0x4(%eax),%eax
+  80070c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80070f:	eb b4                	jmp    8006c5 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800711:	83 f9 01             	cmp    $0x1,%ecx
+  800714:	7f 1b                	jg     800731 <vprintfmt+0x30e>
+	else if (lflag)
+  800716:	85 c9                	test   %ecx,%ecx
+  800718:	74 2c                	je     800746 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 10                	mov    (%eax),%edx
+  80071f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80072a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80072f:	eb 60                	jmp    800791 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8b 10                	mov    (%eax),%edx
+  800736:	8b 48 04             	mov    0x4(%eax),%ecx
+  800739:	8d 40 08             	lea    0x8(%eax),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073f:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800744:	eb 4b                	jmp    800791 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800746:	8b 45 14             	mov    0x14(%ebp),%eax
+  800749:	8b 10                	mov    (%eax),%edx
+  80074b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800750:	8d 40 04             	lea    0x4(%eax),%eax
+  800753:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800756:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80075b:	eb 34                	jmp    800791 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80075d:	83 f9 01             	cmp    $0x1,%ecx
+  800760:	7f 15                	jg     800777 <vprintfmt+0x354>
+	else if (lflag)
+  800762:	85 c9                	test   %ecx,%ecx
+  800764:	74 4d                	je     8007b3 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800766:	8b 45 14             	mov    0x14(%ebp),%eax
+  800769:	8b 00                	mov    (%eax),%eax
+  80076b:	99                   	cltd
+  80076c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80076f:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800772:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800775:	eb 11                	jmp    800788 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800777:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077a:	8b 50 04             	mov    0x4(%eax),%edx
+  80077d:	8b 00                	mov    (%eax),%eax
+  80077f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800782:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800785:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800788:	89 d1                	mov    %edx,%ecx
+  80078a:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  80078c:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800791:	83 ec 0c             	sub    $0xc,%esp
+  800794:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800798:	50                   	push   %eax
+  800799:	ff 75 e0             	push   -0x20(%ebp)
+  80079c:	57                   	push   %edi
+  80079d:	51                   	push   %ecx
+  80079e:	52                   	push   %edx
+  80079f:	89 da                	mov    %ebx,%edx
+  8007a1:	89 f0                	mov    %esi,%eax
+  8007a3:	e8 98 fb ff ff       	call   800340 <printnum>
+			break;
+  8007a8:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  8007ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007ae:	e9 8e fc ff ff       	jmp    800441 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 00                	mov    (%eax),%eax
+  8007b8:	99                   	cltd
+  8007b9:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007bc:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8007bf:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8007c2:	eb c4                	jmp    800788 <vprintfmt+0x365>
+			putch('0', putdat);
+  8007c4:	83 ec 08             	sub    $0x8,%esp
+  8007c7:	53                   	push   %ebx
+  8007c8:	6a 30                	push   $0x30
+  8007ca:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007cc:	83 c4 08             	add    $0x8,%esp
+  8007cf:	53                   	push   %ebx
+  8007d0:	6a 78                	push   $0x78
+  8007d2:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d7:	8b 10                	mov    (%eax),%edx
+  8007d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007de:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007e1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e7:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8007ec:	eb a3                	jmp    800791 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007ee:	83 f9 01             	cmp    $0x1,%ecx
+  8007f1:	7f 1b                	jg     80080e <vprintfmt+0x3eb>
+	else if (lflag)
+  8007f3:	85 c9                	test   %ecx,%ecx
+  8007f5:	74 2f                	je     800826 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8007f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fa:	8b 10                	mov    (%eax),%edx
+  8007fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800801:	8d 40 04             	lea    0x4(%eax),%eax
+  800804:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800807:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  80080c:	eb 83                	jmp    800791 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  80080e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800811:	8b 10                	mov    (%eax),%edx
+  800813:	8b 48 04             	mov    0x4(%eax),%ecx
+  800816:	8d 40 08             	lea    0x8(%eax),%eax
+  800819:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800821:	e9 6b ff ff ff       	jmp    800791 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800826:	8b 45 14             	mov    0x14(%ebp),%eax
+  800829:	8b 10                	mov    (%eax),%edx
+  80082b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800830:	8d 40 04             	lea    0x4(%eax),%eax
+  800833:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800836:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80083b:	e9 51 ff ff ff       	jmp    800791 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800840:	83 ec 08             	sub    $0x8,%esp
+  800843:	53                   	push   %ebx
+  800844:	6a 25                	push   $0x25
+  800846:	ff d6                	call   *%esi
+			break;
+  800848:	83 c4 10             	add    $0x10,%esp
+  80084b:	e9 5b ff ff ff       	jmp    8007ab <vprintfmt+0x388>
+			putch('%', putdat);
+  800850:	83 ec 08             	sub    $0x8,%esp
+  800853:	53                   	push   %ebx
+  800854:	6a 25                	push   $0x25
+  800856:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800858:	83 c4 10             	add    $0x10,%esp
+  80085b:	89 f8                	mov    %edi,%eax
+  80085d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800861:	74 05                	je     800868 <vprintfmt+0x445>
+  800863:	83 e8 01             	sub    $0x1,%eax
+  800866:	eb f5                	jmp    80085d <vprintfmt+0x43a>
+  800868:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80086b:	e9 3b ff ff ff       	jmp    8007ab <vprintfmt+0x388>
+
+00800870 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800870:	55                   	push   %ebp
+  800871:	89 e5                	mov    %esp,%ebp
+  800873:	83 ec 18             	sub    $0x18,%esp
+  800876:	8b 45 08             	mov    0x8(%ebp),%eax
+  800879:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80087c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80087f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800883:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800886:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80088d:	85 c0                	test   %eax,%eax
+  80088f:	74 26                	je     8008b7 <vsnprintf+0x47>
+  800891:	85 d2                	test   %edx,%edx
+  800893:	7e 22                	jle    8008b7 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800895:	ff 75 14             	push   0x14(%ebp)
+  800898:	ff 75 10             	push   0x10(%ebp)
+  80089b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80089e:	50                   	push   %eax
+  80089f:	68 e9 03 80 00       	push   $0x8003e9
+  8008a4:	e8 7a fb ff ff       	call   800423 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8008a9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008ac:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8008af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008b2:	83 c4 10             	add    $0x10,%esp
+}
+  8008b5:	c9                   	leave
+  8008b6:	c3                   	ret
+		return -E_INVAL;
+  8008b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008bc:	eb f7                	jmp    8008b5 <vsnprintf+0x45>
+
+008008be <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008be:	55                   	push   %ebp
+  8008bf:	89 e5                	mov    %esp,%ebp
+  8008c1:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008c4:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008c7:	50                   	push   %eax
+  8008c8:	ff 75 10             	push   0x10(%ebp)
+  8008cb:	ff 75 0c             	push   0xc(%ebp)
+  8008ce:	ff 75 08             	push   0x8(%ebp)
+  8008d1:	e8 9a ff ff ff       	call   800870 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008d6:	c9                   	leave
+  8008d7:	c3                   	ret
+
+008008d8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e3:	eb 03                	jmp    8008e8 <strlen+0x10>
+		n++;
+  8008e5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008e8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008ec:	75 f7                	jne    8008e5 <strlen+0xd>
+	return n;
+}
+  8008ee:	5d                   	pop    %ebp
+  8008ef:	c3                   	ret
+
+008008f0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008f0:	55                   	push   %ebp
+  8008f1:	89 e5                	mov    %esp,%ebp
+  8008f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fe:	eb 03                	jmp    800903 <strnlen+0x13>
+		n++;
+  800900:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800903:	39 d0                	cmp    %edx,%eax
+  800905:	74 08                	je     80090f <strnlen+0x1f>
+  800907:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80090b:	75 f3                	jne    800900 <strnlen+0x10>
+  80090d:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80090f:	89 d0                	mov    %edx,%eax
+  800911:	5d                   	pop    %ebp
+  800912:	c3                   	ret
+
+00800913 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	53                   	push   %ebx
+  800917:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80091d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800922:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800926:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800929:	83 c0 01             	add    $0x1,%eax
+  80092c:	84 d2                	test   %dl,%dl
+  80092e:	75 f2                	jne    800922 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800930:	89 c8                	mov    %ecx,%eax
+  800932:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800935:	c9                   	leave
+  800936:	c3                   	ret
+
+00800937 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	53                   	push   %ebx
+  80093b:	83 ec 10             	sub    $0x10,%esp
+  80093e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800941:	53                   	push   %ebx
+  800942:	e8 91 ff ff ff       	call   8008d8 <strlen>
+  800947:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80094a:	ff 75 0c             	push   0xc(%ebp)
+  80094d:	01 d8                	add    %ebx,%eax
+  80094f:	50                   	push   %eax
+  800950:	e8 be ff ff ff       	call   800913 <strcpy>
+	return dst;
+}
+  800955:	89 d8                	mov    %ebx,%eax
+  800957:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095a:	c9                   	leave
+  80095b:	c3                   	ret
+
+0080095c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	56                   	push   %esi
+  800960:	53                   	push   %ebx
+  800961:	8b 75 08             	mov    0x8(%ebp),%esi
+  800964:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800967:	89 f3                	mov    %esi,%ebx
+  800969:	03 5d 10             	add    0x10(%ebp),%ebx
+  80096c:	89 f0                	mov    %esi,%eax
+  80096e:	eb 0f                	jmp    80097f <strncpy+0x23>
+		*dst++ = *src;
+  800970:	83 c0 01             	add    $0x1,%eax
+  800973:	0f b6 0a             	movzbl (%edx),%ecx
+  800976:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800979:	80 f9 01             	cmp    $0x1,%cl
+  80097c:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80097f:	39 d8                	cmp    %ebx,%eax
+  800981:	75 ed                	jne    800970 <strncpy+0x14>
+	}
+	return ret;
+}
+  800983:	89 f0                	mov    %esi,%eax
+  800985:	5b                   	pop    %ebx
+  800986:	5e                   	pop    %esi
+  800987:	5d                   	pop    %ebp
+  800988:	c3                   	ret
+
+00800989 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800989:	55                   	push   %ebp
+  80098a:	89 e5                	mov    %esp,%ebp
+  80098c:	56                   	push   %esi
+  80098d:	53                   	push   %ebx
+  80098e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800991:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800994:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800997:	89 f0                	mov    %esi,%eax
+  800999:	85 d2                	test   %edx,%edx
+  80099b:	74 21                	je     8009be <strlcpy+0x35>
+  80099d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009a1:	89 f2                	mov    %esi,%edx
+  8009a3:	eb 09                	jmp    8009ae <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8009a5:	83 c1 01             	add    $0x1,%ecx
+  8009a8:	83 c2 01             	add    $0x1,%edx
+  8009ab:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8009ae:	39 c2                	cmp    %eax,%edx
+  8009b0:	74 09                	je     8009bb <strlcpy+0x32>
+  8009b2:	0f b6 19             	movzbl (%ecx),%ebx
+  8009b5:	84 db                	test   %bl,%bl
+  8009b7:	75 ec                	jne    8009a5 <strlcpy+0x1c>
+  8009b9:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8009bb:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009be:	29 f0                	sub    %esi,%eax
+}
+  8009c0:	5b                   	pop    %ebx
+  8009c1:	5e                   	pop    %esi
+  8009c2:	5d                   	pop    %ebp
+  8009c3:	c3                   	ret
+
+008009c4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009cd:	eb 06                	jmp    8009d5 <strcmp+0x11>
+		p++, q++;
+  8009cf:	83 c1 01             	add    $0x1,%ecx
+  8009d2:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009d5:	0f b6 01             	movzbl (%ecx),%eax
+  8009d8:	84 c0                	test   %al,%al
+  8009da:	74 04                	je     8009e0 <strcmp+0x1c>
+  8009dc:	3a 02                	cmp    (%edx),%al
+  8009de:	74 ef                	je     8009cf <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009e0:	0f b6 c0             	movzbl %al,%eax
+  8009e3:	0f b6 12             	movzbl (%edx),%edx
+  8009e6:	29 d0                	sub    %edx,%eax
+}
+  8009e8:	5d                   	pop    %ebp
+  8009e9:	c3                   	ret
+
+008009ea <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009ea:	55                   	push   %ebp
+  8009eb:	89 e5                	mov    %esp,%ebp
+  8009ed:	53                   	push   %ebx
+  8009ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f4:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009f7:	eb 09                	jmp    800a02 <strncmp+0x18>
+		n--, p++, q++;
+  8009f9:	83 ea 01             	sub    $0x1,%edx
+  8009fc:	83 c0 01             	add    $0x1,%eax
+  8009ff:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800a02:	85 d2                	test   %edx,%edx
+  800a04:	74 18                	je     800a1e <strncmp+0x34>
+  800a06:	0f b6 18             	movzbl (%eax),%ebx
+  800a09:	84 db                	test   %bl,%bl
+  800a0b:	74 04                	je     800a11 <strncmp+0x27>
+  800a0d:	3a 19                	cmp    (%ecx),%bl
+  800a0f:	74 e8                	je     8009f9 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800a11:	0f b6 00             	movzbl (%eax),%eax
+  800a14:	0f b6 11             	movzbl (%ecx),%edx
+  800a17:	29 d0                	sub    %edx,%eax
+}
+  800a19:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a1c:	c9                   	leave
+  800a1d:	c3                   	ret
+		return 0;
+  800a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a23:	eb f4                	jmp    800a19 <strncmp+0x2f>
+
+00800a25 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a25:	55                   	push   %ebp
+  800a26:	89 e5                	mov    %esp,%ebp
+  800a28:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a2f:	eb 03                	jmp    800a34 <strchr+0xf>
+  800a31:	83 c0 01             	add    $0x1,%eax
+  800a34:	0f b6 10             	movzbl (%eax),%edx
+  800a37:	84 d2                	test   %dl,%dl
+  800a39:	74 06                	je     800a41 <strchr+0x1c>
+		if (*s == c)
+  800a3b:	38 ca                	cmp    %cl,%dl
+  800a3d:	75 f2                	jne    800a31 <strchr+0xc>
+  800a3f:	eb 05                	jmp    800a46 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a46:	5d                   	pop    %ebp
+  800a47:	c3                   	ret
+
+00800a48 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a52:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a55:	38 ca                	cmp    %cl,%dl
+  800a57:	74 09                	je     800a62 <strfind+0x1a>
+  800a59:	84 d2                	test   %dl,%dl
+  800a5b:	74 05                	je     800a62 <strfind+0x1a>
+	for (; *s; s++)
+  800a5d:	83 c0 01             	add    $0x1,%eax
+  800a60:	eb f0                	jmp    800a52 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a62:	5d                   	pop    %ebp
+  800a63:	c3                   	ret
+
+00800a64 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a64:	55                   	push   %ebp
+  800a65:	89 e5                	mov    %esp,%ebp
+  800a67:	57                   	push   %edi
+  800a68:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a6b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a6e:	85 c9                	test   %ecx,%ecx
+  800a70:	74 20                	je     800a92 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a72:	89 f8                	mov    %edi,%eax
+  800a74:	09 c8                	or     %ecx,%eax
+  800a76:	a8 03                	test   $0x3,%al
+  800a78:	75 12                	jne    800a8c <memset+0x28>
+		c &= 0xFF;
+  800a7a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a7e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a84:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a87:	fc                   	cld
+  800a88:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a8a:	eb 06                	jmp    800a92 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a8f:	fc                   	cld
+  800a90:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a92:	89 f8                	mov    %edi,%eax
+  800a94:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a97:	c9                   	leave
+  800a98:	c3                   	ret
+
+00800a99 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	57                   	push   %edi
+  800a9d:	56                   	push   %esi
+  800a9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aa4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800aa7:	39 c6                	cmp    %eax,%esi
+  800aa9:	73 32                	jae    800add <memmove+0x44>
+  800aab:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aae:	39 d0                	cmp    %edx,%eax
+  800ab0:	73 2b                	jae    800add <memmove+0x44>
+		s += n;
+		d += n;
+  800ab2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab5:	89 d6                	mov    %edx,%esi
+  800ab7:	09 fe                	or     %edi,%esi
+  800ab9:	09 ce                	or     %ecx,%esi
+  800abb:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ac1:	75 0e                	jne    800ad1 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ac3:	83 ef 04             	sub    $0x4,%edi
+  800ac6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ac9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800acc:	fd                   	std
+  800acd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800acf:	eb 09                	jmp    800ada <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ad1:	83 ef 01             	sub    $0x1,%edi
+  800ad4:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800ad7:	fd                   	std
+  800ad8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800ada:	fc                   	cld
+  800adb:	eb 1a                	jmp    800af7 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800add:	89 f2                	mov    %esi,%edx
+  800adf:	09 c2                	or     %eax,%edx
+  800ae1:	09 ca                	or     %ecx,%edx
+  800ae3:	f6 c2 03             	test   $0x3,%dl
+  800ae6:	75 0a                	jne    800af2 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ae8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800aeb:	89 c7                	mov    %eax,%edi
+  800aed:	fc                   	cld
+  800aee:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af0:	eb 05                	jmp    800af7 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800af2:	89 c7                	mov    %eax,%edi
+  800af4:	fc                   	cld
+  800af5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800af7:	5e                   	pop    %esi
+  800af8:	5f                   	pop    %edi
+  800af9:	5d                   	pop    %ebp
+  800afa:	c3                   	ret
+
+00800afb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800afb:	55                   	push   %ebp
+  800afc:	89 e5                	mov    %esp,%ebp
+  800afe:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800b01:	ff 75 10             	push   0x10(%ebp)
+  800b04:	ff 75 0c             	push   0xc(%ebp)
+  800b07:	ff 75 08             	push   0x8(%ebp)
+  800b0a:	e8 8a ff ff ff       	call   800a99 <memmove>
+}
+  800b0f:	c9                   	leave
+  800b10:	c3                   	ret
+
+00800b11 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	56                   	push   %esi
+  800b15:	53                   	push   %ebx
+  800b16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b19:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b1c:	89 c6                	mov    %eax,%esi
+  800b1e:	03 75 10             	add    0x10(%ebp),%esi
+  800b21:	eb 06                	jmp    800b29 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b23:	83 c0 01             	add    $0x1,%eax
+  800b26:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b29:	39 f0                	cmp    %esi,%eax
+  800b2b:	74 14                	je     800b41 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b2d:	0f b6 08             	movzbl (%eax),%ecx
+  800b30:	0f b6 1a             	movzbl (%edx),%ebx
+  800b33:	38 d9                	cmp    %bl,%cl
+  800b35:	74 ec                	je     800b23 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b37:	0f b6 c1             	movzbl %cl,%eax
+  800b3a:	0f b6 db             	movzbl %bl,%ebx
+  800b3d:	29 d8                	sub    %ebx,%eax
+  800b3f:	eb 05                	jmp    800b46 <memcmp+0x35>
+	}
+
+	return 0;
+  800b41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b46:	5b                   	pop    %ebx
+  800b47:	5e                   	pop    %esi
+  800b48:	5d                   	pop    %ebp
+  800b49:	c3                   	ret
+
+00800b4a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b4a:	55                   	push   %ebp
+  800b4b:	89 e5                	mov    %esp,%ebp
+  800b4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b53:	89 c2                	mov    %eax,%edx
+  800b55:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b58:	eb 03                	jmp    800b5d <memfind+0x13>
+  800b5a:	83 c0 01             	add    $0x1,%eax
+  800b5d:	39 d0                	cmp    %edx,%eax
+  800b5f:	73 04                	jae    800b65 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b61:	38 08                	cmp    %cl,(%eax)
+  800b63:	75 f5                	jne    800b5a <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b65:	5d                   	pop    %ebp
+  800b66:	c3                   	ret
+
+00800b67 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b67:	55                   	push   %ebp
+  800b68:	89 e5                	mov    %esp,%ebp
+  800b6a:	57                   	push   %edi
+  800b6b:	56                   	push   %esi
+  800b6c:	53                   	push   %ebx
+  800b6d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b70:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b73:	eb 03                	jmp    800b78 <strtol+0x11>
+		s++;
+  800b75:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b78:	0f b6 02             	movzbl (%edx),%eax
+  800b7b:	3c 20                	cmp    $0x20,%al
+  800b7d:	74 f6                	je     800b75 <strtol+0xe>
+  800b7f:	3c 09                	cmp    $0x9,%al
+  800b81:	74 f2                	je     800b75 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b83:	3c 2b                	cmp    $0x2b,%al
+  800b85:	74 2a                	je     800bb1 <strtol+0x4a>
+	int neg = 0;
+  800b87:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b8c:	3c 2d                	cmp    $0x2d,%al
+  800b8e:	74 2b                	je     800bbb <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b90:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b96:	75 0f                	jne    800ba7 <strtol+0x40>
+  800b98:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b9b:	74 28                	je     800bc5 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b9d:	85 db                	test   %ebx,%ebx
+  800b9f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ba4:	0f 44 d8             	cmove  %eax,%ebx
+  800ba7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bac:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800baf:	eb 46                	jmp    800bf7 <strtol+0x90>
+		s++;
+  800bb1:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800bb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bb9:	eb d5                	jmp    800b90 <strtol+0x29>
+		s++, neg = 1;
+  800bbb:	83 c2 01             	add    $0x1,%edx
+  800bbe:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bc3:	eb cb                	jmp    800b90 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bc5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bc9:	74 0e                	je     800bd9 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800bcb:	85 db                	test   %ebx,%ebx
+  800bcd:	75 d8                	jne    800ba7 <strtol+0x40>
+		s++, base = 8;
+  800bcf:	83 c2 01             	add    $0x1,%edx
+  800bd2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bd7:	eb ce                	jmp    800ba7 <strtol+0x40>
+		s += 2, base = 16;
+  800bd9:	83 c2 02             	add    $0x2,%edx
+  800bdc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800be1:	eb c4                	jmp    800ba7 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800be3:	0f be c0             	movsbl %al,%eax
+  800be6:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800be9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bec:	7d 3a                	jge    800c28 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bee:	83 c2 01             	add    $0x1,%edx
+  800bf1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bf5:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bf7:	0f b6 02             	movzbl (%edx),%eax
+  800bfa:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bfd:	89 f3                	mov    %esi,%ebx
+  800bff:	80 fb 09             	cmp    $0x9,%bl
+  800c02:	76 df                	jbe    800be3 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800c04:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c07:	89 f3                	mov    %esi,%ebx
+  800c09:	80 fb 19             	cmp    $0x19,%bl
+  800c0c:	77 08                	ja     800c16 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800c0e:	0f be c0             	movsbl %al,%eax
+  800c11:	83 e8 57             	sub    $0x57,%eax
+  800c14:	eb d3                	jmp    800be9 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c16:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c19:	89 f3                	mov    %esi,%ebx
+  800c1b:	80 fb 19             	cmp    $0x19,%bl
+  800c1e:	77 08                	ja     800c28 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c20:	0f be c0             	movsbl %al,%eax
+  800c23:	83 e8 37             	sub    $0x37,%eax
+  800c26:	eb c1                	jmp    800be9 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c28:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c2c:	74 05                	je     800c33 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c31:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c33:	89 c8                	mov    %ecx,%eax
+  800c35:	f7 d8                	neg    %eax
+  800c37:	85 ff                	test   %edi,%edi
+  800c39:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c3c:	89 c8                	mov    %ecx,%eax
+  800c3e:	5b                   	pop    %ebx
+  800c3f:	5e                   	pop    %esi
+  800c40:	5f                   	pop    %edi
+  800c41:	5d                   	pop    %ebp
+  800c42:	c3                   	ret
+
+00800c43 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c43:	55                   	push   %ebp
+  800c44:	89 e5                	mov    %esp,%ebp
+  800c46:	57                   	push   %edi
+  800c47:	56                   	push   %esi
+  800c48:	53                   	push   %ebx
+  800c49:	83 ec 0c             	sub    $0xc,%esp
+  800c4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c4f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c52:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c55:	85 ff                	test   %edi,%edi
+  800c57:	74 16                	je     800c6f <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c59:	83 ec 04             	sub    $0x4,%esp
+  800c5c:	56                   	push   %esi
+  800c5d:	6a 00                	push   $0x0
+  800c5f:	53                   	push   %ebx
+  800c60:	e8 02 ff ff ff       	call   800b67 <strtol>
+  800c65:	89 07                	mov    %eax,(%edi)
+  800c67:	83 c4 10             	add    $0x10,%esp
+  800c6a:	eb 03                	jmp    800c6f <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c6c:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c6f:	0f b6 03             	movzbl (%ebx),%eax
+  800c72:	3c 20                	cmp    $0x20,%al
+  800c74:	74 f6                	je     800c6c <strisl+0x29>
+  800c76:	3c 09                	cmp    $0x9,%al
+  800c78:	74 f2                	je     800c6c <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c7a:	3c 2b                	cmp    $0x2b,%al
+  800c7c:	74 23                	je     800ca1 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c7e:	3c 2d                	cmp    $0x2d,%al
+  800c80:	0f 94 c0             	sete   %al
+  800c83:	0f b6 c0             	movzbl %al,%eax
+  800c86:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c88:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c8e:	75 41                	jne    800cd1 <strisl+0x8e>
+  800c90:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c93:	74 11                	je     800ca6 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c95:	85 f6                	test   %esi,%esi
+  800c97:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c9c:	0f 44 f0             	cmove  %eax,%esi
+  800c9f:	eb 30                	jmp    800cd1 <strisl+0x8e>
+		s++;
+  800ca1:	83 c3 01             	add    $0x1,%ebx
+  800ca4:	eb e2                	jmp    800c88 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ca6:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800caa:	74 0e                	je     800cba <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800cac:	85 f6                	test   %esi,%esi
+  800cae:	75 21                	jne    800cd1 <strisl+0x8e>
+		s++, base = 8;
+  800cb0:	83 c3 01             	add    $0x1,%ebx
+  800cb3:	be 08 00 00 00       	mov    $0x8,%esi
+  800cb8:	eb 17                	jmp    800cd1 <strisl+0x8e>
+		s += 2, base = 16;
+  800cba:	83 c3 02             	add    $0x2,%ebx
+  800cbd:	be 10 00 00 00       	mov    $0x10,%esi
+  800cc2:	eb 0d                	jmp    800cd1 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800cc4:	0f be c0             	movsbl %al,%eax
+  800cc7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800cca:	39 f0                	cmp    %esi,%eax
+  800ccc:	7d 38                	jge    800d06 <strisl+0xc3>
+			return 0;
+		s++;
+  800cce:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800cd1:	0f b6 03             	movzbl (%ebx),%eax
+  800cd4:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800cd7:	80 fa 09             	cmp    $0x9,%dl
+  800cda:	76 e8                	jbe    800cc4 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800cdc:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800cdf:	80 fa 19             	cmp    $0x19,%dl
+  800ce2:	77 08                	ja     800cec <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800ce4:	0f be c0             	movsbl %al,%eax
+  800ce7:	83 e8 57             	sub    $0x57,%eax
+  800cea:	eb de                	jmp    800cca <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cec:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800cef:	80 fa 19             	cmp    $0x19,%dl
+  800cf2:	77 08                	ja     800cfc <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800cf4:	0f be c0             	movsbl %al,%eax
+  800cf7:	83 e8 37             	sub    $0x37,%eax
+  800cfa:	eb ce                	jmp    800cca <strisl+0x87>
+		else if (!*s)
+  800cfc:	84 c0                	test   %al,%al
+  800cfe:	0f 94 c0             	sete   %al
+  800d01:	0f b6 c0             	movzbl %al,%eax
+  800d04:	eb 05                	jmp    800d0b <strisl+0xc8>
+			return 0;
+  800d06:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800d0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0e:	5b                   	pop    %ebx
+  800d0f:	5e                   	pop    %esi
+  800d10:	5f                   	pop    %edi
+  800d11:	5d                   	pop    %ebp
+  800d12:	c3                   	ret
+
+00800d13 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800d13:	55                   	push   %ebp
+  800d14:	89 e5                	mov    %esp,%ebp
+  800d16:	83 ec 10             	sub    $0x10,%esp
+  800d19:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d1c:	89 c8                	mov    %ecx,%eax
+  800d1e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800d23:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800d26:	eb 0b                	jmp    800d33 <touch_mem+0x20>
+		c = *(char *)page;
+  800d28:	0f b6 10             	movzbl (%eax),%edx
+  800d2b:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d2e:	05 00 10 00 00       	add    $0x1000,%eax
+  800d33:	39 c8                	cmp    %ecx,%eax
+  800d35:	72 f1                	jb     800d28 <touch_mem+0x15>
+}
+  800d37:	c9                   	leave
+  800d38:	c3                   	ret
+
+00800d39 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d39:	55                   	push   %ebp
+  800d3a:	89 e5                	mov    %esp,%ebp
+  800d3c:	57                   	push   %edi
+  800d3d:	56                   	push   %esi
+  800d3e:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d3f:	ff 75 0c             	push   0xc(%ebp)
+  800d42:	ff 75 08             	push   0x8(%ebp)
+  800d45:	e8 c9 ff ff ff       	call   800d13 <touch_mem>
+	asm volatile("int %1\n"
+  800d4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d55:	89 c3                	mov    %eax,%ebx
+  800d57:	89 c7                	mov    %eax,%edi
+  800d59:	89 c6                	mov    %eax,%esi
+  800d5b:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d5d:	83 c4 08             	add    $0x8,%esp
+  800d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d63:	5b                   	pop    %ebx
+  800d64:	5e                   	pop    %esi
+  800d65:	5f                   	pop    %edi
+  800d66:	5d                   	pop    %ebp
+  800d67:	c3                   	ret
+
+00800d68 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d68:	55                   	push   %ebp
+  800d69:	89 e5                	mov    %esp,%ebp
+  800d6b:	57                   	push   %edi
+  800d6c:	56                   	push   %esi
+  800d6d:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d73:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d78:	89 d1                	mov    %edx,%ecx
+  800d7a:	89 d3                	mov    %edx,%ebx
+  800d7c:	89 d7                	mov    %edx,%edi
+  800d7e:	89 d6                	mov    %edx,%esi
+  800d80:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d82:	5b                   	pop    %ebx
+  800d83:	5e                   	pop    %esi
+  800d84:	5f                   	pop    %edi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+
+00800d87 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	53                   	push   %ebx
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d98:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d9d:	89 cb                	mov    %ecx,%ebx
+  800d9f:	89 cf                	mov    %ecx,%edi
+  800da1:	89 ce                	mov    %ecx,%esi
+  800da3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800da5:	85 c0                	test   %eax,%eax
+  800da7:	7f 08                	jg     800db1 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800da9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800db1:	83 ec 0c             	sub    $0xc,%esp
+  800db4:	50                   	push   %eax
+  800db5:	6a 03                	push   $0x3
+  800db7:	68 2b 58 80 00       	push   $0x80582b
+  800dbc:	6a 23                	push   $0x23
+  800dbe:	68 48 58 80 00       	push   $0x805848
+  800dc3:	e8 89 f4 ff ff       	call   800251 <_panic>
+
+00800dc8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dc8:	55                   	push   %ebp
+  800dc9:	89 e5                	mov    %esp,%ebp
+  800dcb:	57                   	push   %edi
+  800dcc:	56                   	push   %esi
+  800dcd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dce:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dd8:	89 d1                	mov    %edx,%ecx
+  800dda:	89 d3                	mov    %edx,%ebx
+  800ddc:	89 d7                	mov    %edx,%edi
+  800dde:	89 d6                	mov    %edx,%esi
+  800de0:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800de2:	5b                   	pop    %ebx
+  800de3:	5e                   	pop    %esi
+  800de4:	5f                   	pop    %edi
+  800de5:	5d                   	pop    %ebp
+  800de6:	c3                   	ret
+
+00800de7 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800de7:	55                   	push   %ebp
+  800de8:	89 e5                	mov    %esp,%ebp
+  800dea:	57                   	push   %edi
+  800deb:	56                   	push   %esi
+  800dec:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ded:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df2:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800df7:	89 d1                	mov    %edx,%ecx
+  800df9:	89 d3                	mov    %edx,%ebx
+  800dfb:	89 d7                	mov    %edx,%edi
+  800dfd:	89 d6                	mov    %edx,%esi
+  800dff:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e01:	5b                   	pop    %ebx
+  800e02:	5e                   	pop    %esi
+  800e03:	5f                   	pop    %edi
+  800e04:	5d                   	pop    %ebp
+  800e05:	c3                   	ret
+
+00800e06 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	57                   	push   %edi
+  800e0a:	56                   	push   %esi
+  800e0b:	53                   	push   %ebx
+  800e0c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e22:	89 f7                	mov    %esi,%edi
+  800e24:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e26:	85 c0                	test   %eax,%eax
+  800e28:	7f 08                	jg     800e32 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5e                   	pop    %esi
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+  800e35:	50                   	push   %eax
+  800e36:	6a 04                	push   $0x4
+  800e38:	68 2b 58 80 00       	push   $0x80582b
+  800e3d:	6a 23                	push   $0x23
+  800e3f:	68 48 58 80 00       	push   $0x805848
+  800e44:	e8 08 f4 ff ff       	call   800251 <_panic>
+
+00800e49 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	56                   	push   %esi
+  800e4e:	53                   	push   %ebx
+  800e4f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e58:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e60:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e63:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e66:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e68:	85 c0                	test   %eax,%eax
+  800e6a:	7f 08                	jg     800e74 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6f:	5b                   	pop    %ebx
+  800e70:	5e                   	pop    %esi
+  800e71:	5f                   	pop    %edi
+  800e72:	5d                   	pop    %ebp
+  800e73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+  800e77:	50                   	push   %eax
+  800e78:	6a 05                	push   $0x5
+  800e7a:	68 2b 58 80 00       	push   $0x80582b
+  800e7f:	6a 23                	push   $0x23
+  800e81:	68 48 58 80 00       	push   $0x805848
+  800e86:	e8 c6 f3 ff ff       	call   800251 <_panic>
+
+00800e8b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e8b:	55                   	push   %ebp
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	57                   	push   %edi
+  800e8f:	56                   	push   %esi
+  800e90:	53                   	push   %ebx
+  800e91:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ea4:	89 df                	mov    %ebx,%edi
+  800ea6:	89 de                	mov    %ebx,%esi
+  800ea8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eaa:	85 c0                	test   %eax,%eax
+  800eac:	7f 08                	jg     800eb6 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb1:	5b                   	pop    %ebx
+  800eb2:	5e                   	pop    %esi
+  800eb3:	5f                   	pop    %edi
+  800eb4:	5d                   	pop    %ebp
+  800eb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb6:	83 ec 0c             	sub    $0xc,%esp
+  800eb9:	50                   	push   %eax
+  800eba:	6a 06                	push   $0x6
+  800ebc:	68 2b 58 80 00       	push   $0x80582b
+  800ec1:	6a 23                	push   $0x23
+  800ec3:	68 48 58 80 00       	push   $0x805848
+  800ec8:	e8 84 f3 ff ff       	call   800251 <_panic>
+
+00800ecd <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800ecd:	55                   	push   %ebp
+  800ece:	89 e5                	mov    %esp,%ebp
+  800ed0:	57                   	push   %edi
+  800ed1:	56                   	push   %esi
+  800ed2:	53                   	push   %ebx
+  800ed3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ed6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ede:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee1:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ee6:	89 df                	mov    %ebx,%edi
+  800ee8:	89 de                	mov    %ebx,%esi
+  800eea:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eec:	85 c0                	test   %eax,%eax
+  800eee:	7f 08                	jg     800ef8 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ef0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef3:	5b                   	pop    %ebx
+  800ef4:	5e                   	pop    %esi
+  800ef5:	5f                   	pop    %edi
+  800ef6:	5d                   	pop    %ebp
+  800ef7:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ef8:	83 ec 0c             	sub    $0xc,%esp
+  800efb:	50                   	push   %eax
+  800efc:	6a 18                	push   $0x18
+  800efe:	68 2b 58 80 00       	push   $0x80582b
+  800f03:	6a 23                	push   $0x23
+  800f05:	68 48 58 80 00       	push   $0x805848
+  800f0a:	e8 42 f3 ff ff       	call   800251 <_panic>
+
+00800f0f <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	57                   	push   %edi
+  800f13:	56                   	push   %esi
+  800f14:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f15:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f20:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f28:	89 f7                	mov    %esi,%edi
+  800f2a:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5f                   	pop    %edi
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+
+00800f31 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	57                   	push   %edi
+  800f35:	56                   	push   %esi
+  800f36:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f42:	be 00 00 00 00       	mov    $0x0,%esi
+  800f47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f4d:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5e                   	pop    %esi
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+
+00800f54 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	57                   	push   %edi
+  800f58:	56                   	push   %esi
+  800f59:	53                   	push   %ebx
+  800f5a:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f5d:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f60:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f66:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f77:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f7a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f7c:	85 c0                	test   %eax,%eax
+  800f7e:	7f 08                	jg     800f88 <sys_page_map_range+0x34>
+}
+  800f80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5f                   	pop    %edi
+  800f86:	5d                   	pop    %ebp
+  800f87:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f88:	83 ec 0c             	sub    $0xc,%esp
+  800f8b:	50                   	push   %eax
+  800f8c:	6a 10                	push   $0x10
+  800f8e:	68 2b 58 80 00       	push   $0x80582b
+  800f93:	6a 23                	push   $0x23
+  800f95:	68 48 58 80 00       	push   $0x805848
+  800f9a:	e8 b2 f2 ff ff       	call   800251 <_panic>
+
+00800f9f <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f9f:	55                   	push   %ebp
+  800fa0:	89 e5                	mov    %esp,%ebp
+  800fa2:	57                   	push   %edi
+  800fa3:	56                   	push   %esi
+  800fa4:	53                   	push   %ebx
+  800fa5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fa8:	be 00 00 00 00       	mov    $0x0,%esi
+  800fad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb3:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fbb:	89 f7                	mov    %esi,%edi
+  800fbd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fbf:	85 c0                	test   %eax,%eax
+  800fc1:	7f 08                	jg     800fcb <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc6:	5b                   	pop    %ebx
+  800fc7:	5e                   	pop    %esi
+  800fc8:	5f                   	pop    %edi
+  800fc9:	5d                   	pop    %ebp
+  800fca:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fcb:	83 ec 0c             	sub    $0xc,%esp
+  800fce:	50                   	push   %eax
+  800fcf:	6a 11                	push   $0x11
+  800fd1:	68 2b 58 80 00       	push   $0x80582b
+  800fd6:	6a 23                	push   $0x23
+  800fd8:	68 48 58 80 00       	push   $0x805848
+  800fdd:	e8 6f f2 ff ff       	call   800251 <_panic>
+
+00800fe2 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	57                   	push   %edi
+  800fe6:	56                   	push   %esi
+  800fe7:	53                   	push   %ebx
+  800fe8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800feb:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff6:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800ffb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ffe:	89 f7                	mov    %esi,%edi
+  801000:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801002:	85 c0                	test   %eax,%eax
+  801004:	7f 08                	jg     80100e <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  801006:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801009:	5b                   	pop    %ebx
+  80100a:	5e                   	pop    %esi
+  80100b:	5f                   	pop    %edi
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80100e:	83 ec 0c             	sub    $0xc,%esp
+  801011:	50                   	push   %eax
+  801012:	6a 1b                	push   $0x1b
+  801014:	68 2b 58 80 00       	push   $0x80582b
+  801019:	6a 23                	push   $0x23
+  80101b:	68 48 58 80 00       	push   $0x805848
+  801020:	e8 2c f2 ff ff       	call   800251 <_panic>
+
+00801025 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	57                   	push   %edi
+  801029:	56                   	push   %esi
+  80102a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80102b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801030:	b8 12 00 00 00       	mov    $0x12,%eax
+  801035:	89 d1                	mov    %edx,%ecx
+  801037:	89 d3                	mov    %edx,%ebx
+  801039:	89 d7                	mov    %edx,%edi
+  80103b:	89 d6                	mov    %edx,%esi
+  80103d:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80103f:	5b                   	pop    %ebx
+  801040:	5e                   	pop    %esi
+  801041:	5f                   	pop    %edi
+  801042:	5d                   	pop    %ebp
+  801043:	c3                   	ret
+
+00801044 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801044:	55                   	push   %ebp
+  801045:	89 e5                	mov    %esp,%ebp
+  801047:	57                   	push   %edi
+  801048:	56                   	push   %esi
+  801049:	53                   	push   %ebx
+  80104a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80104d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801052:	8b 55 08             	mov    0x8(%ebp),%edx
+  801055:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801058:	b8 08 00 00 00       	mov    $0x8,%eax
+  80105d:	89 df                	mov    %ebx,%edi
+  80105f:	89 de                	mov    %ebx,%esi
+  801061:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801063:	85 c0                	test   %eax,%eax
+  801065:	7f 08                	jg     80106f <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801067:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106a:	5b                   	pop    %ebx
+  80106b:	5e                   	pop    %esi
+  80106c:	5f                   	pop    %edi
+  80106d:	5d                   	pop    %ebp
+  80106e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106f:	83 ec 0c             	sub    $0xc,%esp
+  801072:	50                   	push   %eax
+  801073:	6a 08                	push   $0x8
+  801075:	68 2b 58 80 00       	push   $0x80582b
+  80107a:	6a 23                	push   $0x23
+  80107c:	68 48 58 80 00       	push   $0x805848
+  801081:	e8 cb f1 ff ff       	call   800251 <_panic>
+
+00801086 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801086:	55                   	push   %ebp
+  801087:	89 e5                	mov    %esp,%ebp
+  801089:	57                   	push   %edi
+  80108a:	56                   	push   %esi
+  80108b:	53                   	push   %ebx
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80108f:	6a 44                	push   $0x44
+  801091:	ff 75 0c             	push   0xc(%ebp)
+  801094:	e8 7a fc ff ff       	call   800d13 <touch_mem>
+	asm volatile("int %1\n"
+  801099:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a9:	89 df                	mov    %ebx,%edi
+  8010ab:	89 de                	mov    %ebx,%esi
+  8010ad:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010af:	83 c4 08             	add    $0x8,%esp
+  8010b2:	85 c0                	test   %eax,%eax
+  8010b4:	7f 08                	jg     8010be <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  8010b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b9:	5b                   	pop    %ebx
+  8010ba:	5e                   	pop    %esi
+  8010bb:	5f                   	pop    %edi
+  8010bc:	5d                   	pop    %ebp
+  8010bd:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010be:	83 ec 0c             	sub    $0xc,%esp
+  8010c1:	50                   	push   %eax
+  8010c2:	6a 09                	push   $0x9
+  8010c4:	68 2b 58 80 00       	push   $0x80582b
+  8010c9:	6a 23                	push   $0x23
+  8010cb:	68 48 58 80 00       	push   $0x805848
+  8010d0:	e8 7c f1 ff ff       	call   800251 <_panic>
+
+008010d5 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	57                   	push   %edi
+  8010d9:	56                   	push   %esi
+  8010da:	53                   	push   %ebx
+  8010db:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010de:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f1:	89 f7                	mov    %esi,%edi
+  8010f3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f5:	85 c0                	test   %eax,%eax
+  8010f7:	7f 08                	jg     801101 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8010f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fc:	5b                   	pop    %ebx
+  8010fd:	5e                   	pop    %esi
+  8010fe:	5f                   	pop    %edi
+  8010ff:	5d                   	pop    %ebp
+  801100:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801101:	83 ec 0c             	sub    $0xc,%esp
+  801104:	50                   	push   %eax
+  801105:	6a 1a                	push   $0x1a
+  801107:	68 2b 58 80 00       	push   $0x80582b
+  80110c:	6a 23                	push   $0x23
+  80110e:	68 48 58 80 00       	push   $0x805848
+  801113:	e8 39 f1 ff ff       	call   800251 <_panic>
+
+00801118 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+  80111e:	83 ec 0c             	sub    $0xc,%esp
+  801121:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801124:	89 d8                	mov    %ebx,%eax
+  801126:	c1 e0 05             	shl    $0x5,%eax
+  801129:	50                   	push   %eax
+  80112a:	ff 75 0c             	push   0xc(%ebp)
+  80112d:	e8 e1 fb ff ff       	call   800d13 <touch_mem>
+	asm volatile("int %1\n"
+  801132:	be 00 00 00 00       	mov    $0x0,%esi
+  801137:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80113f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801142:	89 f7                	mov    %esi,%edi
+  801144:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801146:	83 c4 08             	add    $0x8,%esp
+  801149:	85 c0                	test   %eax,%eax
+  80114b:	7f 08                	jg     801155 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  80114d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801150:	5b                   	pop    %ebx
+  801151:	5e                   	pop    %esi
+  801152:	5f                   	pop    %edi
+  801153:	5d                   	pop    %ebp
+  801154:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801155:	83 ec 0c             	sub    $0xc,%esp
+  801158:	50                   	push   %eax
+  801159:	6a 13                	push   $0x13
+  80115b:	68 2b 58 80 00       	push   $0x80582b
+  801160:	6a 23                	push   $0x23
+  801162:	68 48 58 80 00       	push   $0x805848
+  801167:	e8 e5 f0 ff ff       	call   800251 <_panic>
+
+0080116c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  80116f:	57                   	push   %edi
+  801170:	56                   	push   %esi
+  801171:	53                   	push   %ebx
+  801172:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801175:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801180:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801185:	89 df                	mov    %ebx,%edi
+  801187:	89 de                	mov    %ebx,%esi
+  801189:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80118b:	85 c0                	test   %eax,%eax
+  80118d:	7f 08                	jg     801197 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80118f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801192:	5b                   	pop    %ebx
+  801193:	5e                   	pop    %esi
+  801194:	5f                   	pop    %edi
+  801195:	5d                   	pop    %ebp
+  801196:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801197:	83 ec 0c             	sub    $0xc,%esp
+  80119a:	50                   	push   %eax
+  80119b:	6a 0a                	push   $0xa
+  80119d:	68 2b 58 80 00       	push   $0x80582b
+  8011a2:	6a 23                	push   $0x23
+  8011a4:	68 48 58 80 00       	push   $0x805848
+  8011a9:	e8 a3 f0 ff ff       	call   800251 <_panic>
+
+008011ae <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8011ae:	55                   	push   %ebp
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	57                   	push   %edi
+  8011b2:	56                   	push   %esi
+  8011b3:	53                   	push   %ebx
+  8011b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  8011b7:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011bd:	76 1d                	jbe    8011dc <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8011bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8011cf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011d2:	cd 30                	int    $0x30
+}
+  8011d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011d7:	5b                   	pop    %ebx
+  8011d8:	5e                   	pop    %esi
+  8011d9:	5f                   	pop    %edi
+  8011da:	5d                   	pop    %ebp
+  8011db:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011dc:	68 00 10 00 00       	push   $0x1000
+  8011e1:	53                   	push   %ebx
+  8011e2:	e8 2c fb ff ff       	call   800d13 <touch_mem>
+  8011e7:	83 c4 08             	add    $0x8,%esp
+  8011ea:	eb d3                	jmp    8011bf <sys_ipc_send+0x11>
+
+008011ec <sys_ipc_send_pages>:
+{
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	57                   	push   %edi
+  8011f0:	56                   	push   %esi
+  8011f1:	53                   	push   %ebx
+  8011f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f5:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8011f8:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011fe:	76 18                	jbe    801218 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801206:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80120b:	8b 7d 18             	mov    0x18(%ebp),%edi
+  80120e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801210:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801213:	5b                   	pop    %ebx
+  801214:	5e                   	pop    %esi
+  801215:	5f                   	pop    %edi
+  801216:	5d                   	pop    %ebp
+  801217:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801218:	89 f0                	mov    %esi,%eax
+  80121a:	c1 e0 0c             	shl    $0xc,%eax
+  80121d:	50                   	push   %eax
+  80121e:	53                   	push   %ebx
+  80121f:	e8 ef fa ff ff       	call   800d13 <touch_mem>
+  801224:	83 c4 08             	add    $0x8,%esp
+  801227:	eb d7                	jmp    801200 <sys_ipc_send_pages+0x14>
+
+00801229 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  801229:	55                   	push   %ebp
+  80122a:	89 e5                	mov    %esp,%ebp
+  80122c:	57                   	push   %edi
+  80122d:	56                   	push   %esi
+  80122e:	53                   	push   %ebx
+  80122f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801232:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80123a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801242:	89 df                	mov    %ebx,%edi
+  801244:	89 de                	mov    %ebx,%esi
+  801246:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	7f 08                	jg     801254 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  80124c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124f:	5b                   	pop    %ebx
+  801250:	5e                   	pop    %esi
+  801251:	5f                   	pop    %edi
+  801252:	5d                   	pop    %ebp
+  801253:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801254:	83 ec 0c             	sub    $0xc,%esp
+  801257:	50                   	push   %eax
+  801258:	6a 0d                	push   $0xd
+  80125a:	68 2b 58 80 00       	push   $0x80582b
+  80125f:	6a 23                	push   $0x23
+  801261:	68 48 58 80 00       	push   $0x805848
+  801266:	e8 e6 ef ff ff       	call   800251 <_panic>
+
+0080126b <sys_ipc_recv>:
+{
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801271:	6a 01                	push   $0x1
+  801273:	ff 75 08             	push   0x8(%ebp)
+  801276:	e8 ae ff ff ff       	call   801229 <sys_ipc_recv_pages>
+}
+  80127b:	c9                   	leave
+  80127c:	c3                   	ret
+
+0080127d <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80127d:	55                   	push   %ebp
+  80127e:	89 e5                	mov    %esp,%ebp
+  801280:	57                   	push   %edi
+  801281:	56                   	push   %esi
+  801282:	53                   	push   %ebx
+  801283:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801286:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801289:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  80128c:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801292:	77 04                	ja     801298 <sys_ipc_call+0x1b>
+  801294:	85 f6                	test   %esi,%esi
+  801296:	75 15                	jne    8012ad <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129e:	b8 14 00 00 00       	mov    $0x14,%eax
+  8012a3:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a8:	5b                   	pop    %ebx
+  8012a9:	5e                   	pop    %esi
+  8012aa:	5f                   	pop    %edi
+  8012ab:	5d                   	pop    %ebp
+  8012ac:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  8012ad:	89 f8                	mov    %edi,%eax
+  8012af:	c1 e0 0c             	shl    $0xc,%eax
+  8012b2:	50                   	push   %eax
+  8012b3:	53                   	push   %ebx
+  8012b4:	e8 5a fa ff ff       	call   800d13 <touch_mem>
+  8012b9:	83 c4 08             	add    $0x8,%esp
+  8012bc:	eb da                	jmp    801298 <sys_ipc_call+0x1b>
+
+008012be <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  8012c1:	57                   	push   %edi
+  8012c2:	56                   	push   %esi
+  8012c3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ca:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012d5:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012d8:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012da:	5b                   	pop    %ebx
+  8012db:	5e                   	pop    %esi
+  8012dc:	5f                   	pop    %edi
+  8012dd:	5d                   	pop    %ebp
+  8012de:	c3                   	ret
+
+008012df <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	57                   	push   %edi
+  8012e3:	56                   	push   %esi
+  8012e4:	53                   	push   %ebx
+  8012e5:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8012e8:	6a 04                	push   $0x4
+  8012ea:	ff 75 08             	push   0x8(%ebp)
+  8012ed:	e8 21 fa ff ff       	call   800d13 <touch_mem>
+	asm volatile("int %1\n"
+  8012f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012fa:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801302:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801305:	89 f7                	mov    %esi,%edi
+  801307:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801309:	83 c4 08             	add    $0x8,%esp
+  80130c:	85 c0                	test   %eax,%eax
+  80130e:	7f 08                	jg     801318 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801313:	5b                   	pop    %ebx
+  801314:	5e                   	pop    %esi
+  801315:	5f                   	pop    %edi
+  801316:	5d                   	pop    %ebp
+  801317:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801318:	83 ec 0c             	sub    $0xc,%esp
+  80131b:	50                   	push   %eax
+  80131c:	6a 16                	push   $0x16
+  80131e:	68 2b 58 80 00       	push   $0x80582b
+  801323:	6a 23                	push   $0x23
+  801325:	68 48 58 80 00       	push   $0x805848
+  80132a:	e8 22 ef ff ff       	call   800251 <_panic>
+
+0080132f <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  80132f:	55                   	push   %ebp
+  801330:	89 e5                	mov    %esp,%ebp
+  801332:	57                   	push   %edi
+  801333:	56                   	push   %esi
+  801334:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801335:	6a 04                	push   $0x4
+  801337:	ff 75 08             	push   0x8(%ebp)
+  80133a:	e8 d4 f9 ff ff       	call   800d13 <touch_mem>
+	asm volatile("int %1\n"
+  80133f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801344:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801347:	b8 17 00 00 00       	mov    $0x17,%eax
+  80134c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134f:	89 df                	mov    %ebx,%edi
+  801351:	89 de                	mov    %ebx,%esi
+  801353:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801355:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801358:	5b                   	pop    %ebx
+  801359:	5e                   	pop    %esi
+  80135a:	5f                   	pop    %edi
+  80135b:	5d                   	pop    %ebp
+  80135c:	c3                   	ret
+
+0080135d <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	57                   	push   %edi
+  801361:	56                   	push   %esi
+  801362:	53                   	push   %ebx
+  801363:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801366:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80136e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801373:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801378:	89 df                	mov    %ebx,%edi
+  80137a:	89 de                	mov    %ebx,%esi
+  80137c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80137e:	85 c0                	test   %eax,%eax
+  801380:	7f 08                	jg     80138a <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801382:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801385:	5b                   	pop    %ebx
+  801386:	5e                   	pop    %esi
+  801387:	5f                   	pop    %edi
+  801388:	5d                   	pop    %ebp
+  801389:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80138a:	83 ec 0c             	sub    $0xc,%esp
+  80138d:	50                   	push   %eax
+  80138e:	6a 0e                	push   $0xe
+  801390:	68 2b 58 80 00       	push   $0x80582b
+  801395:	6a 23                	push   $0x23
+  801397:	68 48 58 80 00       	push   $0x805848
+  80139c:	e8 b0 ee ff ff       	call   800251 <_panic>
+
+008013a1 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  8013a1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013a8:	f6 c6 06             	test   $0x6,%dh
+  8013ab:	75 37                	jne    8013e4 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  8013ad:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013b4:	f6 c2 02             	test   $0x2,%dl
+  8013b7:	75 19                	jne    8013d2 <dupperm+0x31>
+  8013b9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013c0:	f6 c6 08             	test   $0x8,%dh
+  8013c3:	75 0d                	jne    8013d2 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8013c5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013cc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013d1:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8013d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013d9:	25 00 06 00 00       	and    $0x600,%eax
+  8013de:	0d 05 08 00 00       	or     $0x805,%eax
+  8013e3:	c3                   	ret
+		return 0;
+  8013e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e9:	c3                   	ret
+
+008013ea <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8013ea:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8013ec:	c1 e0 0c             	shl    $0xc,%eax
+  8013ef:	c1 e8 16             	shr    $0x16,%eax
+  8013f2:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8013f9:	f6 c1 01             	test   $0x1,%cl
+  8013fc:	74 2c                	je     80142a <dupable+0x40>
+  8013fe:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140a:	f6 c1 04             	test   $0x4,%cl
+  80140d:	74 20                	je     80142f <dupable+0x45>
+  80140f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801416:	f6 c1 01             	test   $0x1,%cl
+  801419:	74 14                	je     80142f <dupable+0x45>
+  80141b:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801422:	c1 e8 02             	shr    $0x2,%eax
+  801425:	83 e0 01             	and    $0x1,%eax
+  801428:	eb 05                	jmp    80142f <dupable+0x45>
+  80142a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142f:	83 e0 01             	and    $0x1,%eax
+}
+  801432:	c3                   	ret
+
+00801433 <pgfault>:
+{
+  801433:	55                   	push   %ebp
+  801434:	89 e5                	mov    %esp,%ebp
+  801436:	56                   	push   %esi
+  801437:	53                   	push   %ebx
+  801438:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80143b:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  80143d:	89 ca                	mov    %ecx,%edx
+  80143f:	c1 ea 0c             	shr    $0xc,%edx
+  801442:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801449:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  80144d:	0f 84 8e 00 00 00    	je     8014e1 <pgfault+0xae>
+		return 0;
+  801453:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  801458:	f6 c6 08             	test   $0x8,%dh
+  80145b:	0f 84 85 00 00 00    	je     8014e6 <pgfault+0xb3>
+	perm |= PTE_W;
+  801461:	81 e2 07 06 00 00    	and    $0x607,%edx
+  801467:	89 d3                	mov    %edx,%ebx
+  801469:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  80146c:	89 ce                	mov    %ecx,%esi
+  80146e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801474:	6a 01                	push   $0x1
+  801476:	53                   	push   %ebx
+  801477:	68 00 f0 7f 00       	push   $0x7ff000
+  80147c:	6a 00                	push   $0x0
+  80147e:	e8 f9 29 00 00       	call   803e7c <page_alloc>
+  801483:	83 c4 10             	add    $0x10,%esp
+  801486:	85 c0                	test   %eax,%eax
+  801488:	78 33                	js     8014bd <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  80148a:	83 ec 04             	sub    $0x4,%esp
+  80148d:	68 00 10 00 00       	push   $0x1000
+  801492:	56                   	push   %esi
+  801493:	68 00 f0 7f 00       	push   $0x7ff000
+  801498:	e8 fc f5 ff ff       	call   800a99 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  80149d:	89 1c 24             	mov    %ebx,(%esp)
+  8014a0:	56                   	push   %esi
+  8014a1:	6a 00                	push   $0x0
+  8014a3:	68 00 f0 7f 00       	push   $0x7ff000
+  8014a8:	6a 00                	push   $0x0
+  8014aa:	e8 2e 30 00 00       	call   8044dd <page_map>
+  8014af:	83 c4 20             	add    $0x20,%esp
+  8014b2:	85 c0                	test   %eax,%eax
+  8014b4:	78 19                	js     8014cf <pgfault+0x9c>
+	return 1;
+  8014b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8014bb:	eb 29                	jmp    8014e6 <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8014bd:	50                   	push   %eax
+  8014be:	68 58 58 80 00       	push   $0x805858
+  8014c3:	6a 2e                	push   $0x2e
+  8014c5:	68 ab 58 80 00       	push   $0x8058ab
+  8014ca:	e8 82 ed ff ff       	call   800251 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8014cf:	50                   	push   %eax
+  8014d0:	68 84 58 80 00       	push   $0x805884
+  8014d5:	6a 32                	push   $0x32
+  8014d7:	68 ab 58 80 00       	push   $0x8058ab
+  8014dc:	e8 70 ed ff ff       	call   800251 <_panic>
+		return 0;
+  8014e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014e9:	5b                   	pop    %ebx
+  8014ea:	5e                   	pop    %esi
+  8014eb:	5d                   	pop    %ebp
+  8014ec:	c3                   	ret
+
+008014ed <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	57                   	push   %edi
+  8014f1:	56                   	push   %esi
+  8014f2:	53                   	push   %ebx
+  8014f3:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  8014f6:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8014fd:	74 5d                	je     80155c <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  8014ff:	83 ec 0c             	sub    $0xc,%esp
+  801502:	68 33 14 80 00       	push   $0x801433
+  801507:	e8 32 3c 00 00       	call   80513e <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  80150c:	e8 14 fb ff ff       	call   801025 <sys_fork>
+  801511:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801514:	83 c4 10             	add    $0x10,%esp
+  801517:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80151a:	74 47                	je     801563 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  80151c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801520:	0f 84 c5 03 00 00    	je     8018eb <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  801526:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80152a:	78 25                	js     801551 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  80152c:	e8 c3 22 00 00       	call   8037f4 <page_share_paged_out>
+  801531:	85 c0                	test   %eax,%eax
+  801533:	0f 88 d8 03 00 00    	js     801911 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801539:	83 ec 08             	sub    $0x8,%esp
+  80153c:	6a 02                	push   $0x2
+  80153e:	ff 75 e4             	push   -0x1c(%ebp)
+  801541:	e8 fe fa ff ff       	call   801044 <sys_env_set_status>
+  801546:	83 c4 10             	add    $0x10,%esp
+  801549:	85 c0                	test   %eax,%eax
+  80154b:	0f 88 d5 03 00 00    	js     801926 <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801551:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801554:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801557:	5b                   	pop    %ebx
+  801558:	5e                   	pop    %esi
+  801559:	5f                   	pop    %edi
+  80155a:	5d                   	pop    %ebp
+  80155b:	c3                   	ret
+		init_map_dir();
+  80155c:	e8 9b 25 00 00       	call   803afc <init_map_dir>
+  801561:	eb 9c                	jmp    8014ff <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801563:	b8 07 00 00 00       	mov    $0x7,%eax
+  801568:	cd 30                	int    $0x30
+  80156a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	78 10                	js     801581 <fork+0x94>
+	if (envid == 0)
+  801571:	0f 84 74 03 00 00    	je     8018eb <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801577:	be 00 00 00 00       	mov    $0x0,%esi
+  80157c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80157f:	eb 30                	jmp    8015b1 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801581:	50                   	push   %eax
+  801582:	68 b6 58 80 00       	push   $0x8058b6
+  801587:	68 cd 00 00 00       	push   $0xcd
+  80158c:	68 ab 58 80 00       	push   $0x8058ab
+  801591:	e8 bb ec ff ff       	call   800251 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  801596:	89 f2                	mov    %esi,%edx
+  801598:	c1 fa 1f             	sar    $0x1f,%edx
+  80159b:	c1 ea 16             	shr    $0x16,%edx
+  80159e:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8015a1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015a6:	29 d0                	sub    %edx,%eax
+  8015a8:	ba 00 04 00 00       	mov    $0x400,%edx
+  8015ad:	29 c2                	sub    %eax,%edx
+  8015af:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  8015b1:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8015b4:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  8015ba:	0f 87 ff 02 00 00    	ja     8018bf <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  8015c0:	89 f3                	mov    %esi,%ebx
+  8015c2:	c1 e3 0c             	shl    $0xc,%ebx
+  8015c5:	89 d8                	mov    %ebx,%eax
+  8015c7:	c1 e8 16             	shr    $0x16,%eax
+  8015ca:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015d1:	f6 c2 01             	test   $0x1,%dl
+  8015d4:	74 c0                	je     801596 <fork+0xa9>
+  8015d6:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015dd:	f6 c2 04             	test   $0x4,%dl
+  8015e0:	74 b4                	je     801596 <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8015e2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015e9:	a8 80                	test   $0x80,%al
+  8015eb:	75 24                	jne    801611 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8015ed:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8015f4:	25 81 00 00 00       	and    $0x81,%eax
+  8015f9:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8015fe:	74 21                	je     801621 <fork+0x134>
+		if (!dupable(pn)) {
+  801600:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801603:	e8 e2 fd ff ff       	call   8013ea <dupable>
+  801608:	84 c0                	test   %al,%al
+  80160a:	75 1a                	jne    801626 <fork+0x139>
+			++pn;
+  80160c:	83 c6 01             	add    $0x1,%esi
+			continue;
+  80160f:	eb a0                	jmp    8015b1 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  801611:	83 ec 08             	sub    $0x8,%esp
+  801614:	53                   	push   %ebx
+  801615:	6a 00                	push   $0x0
+  801617:	e8 b1 f8 ff ff       	call   800ecd <sys_page_split>
+  80161c:	83 c4 10             	add    $0x10,%esp
+  80161f:	eb cc                	jmp    8015ed <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  801621:	0f b6 03             	movzbl (%ebx),%eax
+  801624:	eb da                	jmp    801600 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  801626:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801629:	89 f8                	mov    %edi,%eax
+  80162b:	e8 71 fd ff ff       	call   8013a1 <dupperm>
+  801630:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801633:	85 c0                	test   %eax,%eax
+  801635:	74 16                	je     80164d <fork+0x160>
+  801637:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  80163c:	29 f8                	sub    %edi,%eax
+  80163e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801641:	bf 01 00 00 00       	mov    $0x1,%edi
+  801646:	89 c6                	mov    %eax,%esi
+  801648:	e9 c4 01 00 00       	jmp    801811 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  80164d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801650:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801657:	f6 c4 04             	test   $0x4,%ah
+  80165a:	0f 85 89 00 00 00    	jne    8016e9 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  801660:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801663:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80166a:	f6 c4 02             	test   $0x2,%ah
+  80166d:	0f 85 b1 00 00 00    	jne    801724 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801673:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801676:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80167d:	a8 02                	test   $0x2,%al
+  80167f:	75 10                	jne    801691 <fork+0x1a4>
+  801681:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801688:	f6 c4 08             	test   $0x8,%ah
+  80168b:	0f 84 3e 01 00 00    	je     8017cf <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801691:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801694:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80169b:	25 00 06 00 00       	and    $0x600,%eax
+  8016a0:	0d 05 08 00 00       	or     $0x805,%eax
+  8016a5:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  8016a7:	c1 e1 0c             	shl    $0xc,%ecx
+  8016aa:	89 cb                	mov    %ecx,%ebx
+  8016ac:	83 ec 0c             	sub    $0xc,%esp
+  8016af:	50                   	push   %eax
+  8016b0:	51                   	push   %ecx
+  8016b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8016b4:	51                   	push   %ecx
+  8016b5:	6a 00                	push   $0x0
+  8016b7:	e8 21 2e 00 00       	call   8044dd <page_map>
+  8016bc:	83 c4 20             	add    $0x20,%esp
+  8016bf:	85 c0                	test   %eax,%eax
+  8016c1:	0f 88 e4 00 00 00    	js     8017ab <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  8016c7:	83 ec 0c             	sub    $0xc,%esp
+  8016ca:	57                   	push   %edi
+  8016cb:	53                   	push   %ebx
+  8016cc:	6a 00                	push   $0x0
+  8016ce:	53                   	push   %ebx
+  8016cf:	6a 00                	push   $0x0
+  8016d1:	e8 07 2e 00 00       	call   8044dd <page_map>
+  8016d6:	83 c4 20             	add    $0x20,%esp
+  8016d9:	85 c0                	test   %eax,%eax
+  8016db:	0f 88 dc 00 00 00    	js     8017bd <fork+0x2d0>
+			++pn;
+  8016e1:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8016e4:	e9 c8 fe ff ff       	jmp    8015b1 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8016e9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016ec:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016f3:	c1 e1 0c             	shl    $0xc,%ecx
+  8016f6:	83 ec 0c             	sub    $0xc,%esp
+  8016f9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016fe:	50                   	push   %eax
+  8016ff:	51                   	push   %ecx
+  801700:	ff 75 e4             	push   -0x1c(%ebp)
+  801703:	51                   	push   %ecx
+  801704:	6a 00                	push   $0x0
+  801706:	e8 d2 2d 00 00       	call   8044dd <page_map>
+  80170b:	83 c4 20             	add    $0x20,%esp
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	79 cf                	jns    8016e1 <fork+0x1f4>
+			panic("page_map %d", r);
+  801712:	50                   	push   %eax
+  801713:	68 c6 58 80 00       	push   $0x8058c6
+  801718:	6a 4d                	push   $0x4d
+  80171a:	68 ab 58 80 00       	push   $0x8058ab
+  80171f:	e8 2d eb ff ff       	call   800251 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  801724:	83 ec 0c             	sub    $0xc,%esp
+  801727:	68 00 10 00 00       	push   $0x1000
+  80172c:	e8 9e 33 00 00       	call   804acf <malloc>
+  801731:	89 c7                	mov    %eax,%edi
+  801733:	83 c4 10             	add    $0x10,%esp
+  801736:	85 c0                	test   %eax,%eax
+  801738:	74 4b                	je     801785 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  80173a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80173d:	c1 e3 0c             	shl    $0xc,%ebx
+  801740:	83 ec 04             	sub    $0x4,%esp
+  801743:	68 00 10 00 00       	push   $0x1000
+  801748:	53                   	push   %ebx
+  801749:	50                   	push   %eax
+  80174a:	e8 ac f3 ff ff       	call   800afb <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  80174f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801752:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801759:	25 07 0e 00 00       	and    $0xe07,%eax
+  80175e:	89 04 24             	mov    %eax,(%esp)
+  801761:	53                   	push   %ebx
+  801762:	ff 75 e4             	push   -0x1c(%ebp)
+  801765:	57                   	push   %edi
+  801766:	6a 00                	push   $0x0
+  801768:	e8 70 2d 00 00       	call   8044dd <page_map>
+  80176d:	83 c4 20             	add    $0x20,%esp
+  801770:	85 c0                	test   %eax,%eax
+  801772:	78 25                	js     801799 <fork+0x2ac>
+		free(temp);
+  801774:	83 ec 0c             	sub    $0xc,%esp
+  801777:	57                   	push   %edi
+  801778:	e8 50 31 00 00       	call   8048cd <free>
+  80177d:	83 c4 10             	add    $0x10,%esp
+  801780:	e9 5c ff ff ff       	jmp    8016e1 <fork+0x1f4>
+			panic("malloc failed");
+  801785:	83 ec 04             	sub    $0x4,%esp
+  801788:	68 d2 58 80 00       	push   $0x8058d2
+  80178d:	6a 56                	push   $0x56
+  80178f:	68 ab 58 80 00       	push   $0x8058ab
+  801794:	e8 b8 ea ff ff       	call   800251 <_panic>
+			panic("page_map: %e", r);
+  801799:	50                   	push   %eax
+  80179a:	68 e0 58 80 00       	push   $0x8058e0
+  80179f:	6a 59                	push   $0x59
+  8017a1:	68 ab 58 80 00       	push   $0x8058ab
+  8017a6:	e8 a6 ea ff ff       	call   800251 <_panic>
+			panic("page_map %d", r);
+  8017ab:	50                   	push   %eax
+  8017ac:	68 c6 58 80 00       	push   $0x8058c6
+  8017b1:	6a 65                	push   $0x65
+  8017b3:	68 ab 58 80 00       	push   $0x8058ab
+  8017b8:	e8 94 ea ff ff       	call   800251 <_panic>
+			panic("page_map %d", r);
+  8017bd:	50                   	push   %eax
+  8017be:	68 c6 58 80 00       	push   $0x8058c6
+  8017c3:	6a 78                	push   $0x78
+  8017c5:	68 ab 58 80 00       	push   $0x8058ab
+  8017ca:	e8 82 ea ff ff       	call   800251 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8017cf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017d2:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8017d9:	c1 e1 0c             	shl    $0xc,%ecx
+  8017dc:	83 ec 0c             	sub    $0xc,%esp
+  8017df:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017e4:	50                   	push   %eax
+  8017e5:	51                   	push   %ecx
+  8017e6:	ff 75 e4             	push   -0x1c(%ebp)
+  8017e9:	51                   	push   %ecx
+  8017ea:	6a 00                	push   $0x0
+  8017ec:	e8 ec 2c 00 00       	call   8044dd <page_map>
+  8017f1:	83 c4 20             	add    $0x20,%esp
+  8017f4:	85 c0                	test   %eax,%eax
+  8017f6:	0f 89 e5 fe ff ff    	jns    8016e1 <fork+0x1f4>
+			panic("page_map %d", r);
+  8017fc:	50                   	push   %eax
+  8017fd:	68 c6 58 80 00       	push   $0x8058c6
+  801802:	6a 7f                	push   $0x7f
+  801804:	68 ab 58 80 00       	push   $0x8058ab
+  801809:	e8 43 ea ff ff       	call   800251 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  80180e:	83 c7 01             	add    $0x1,%edi
+  801811:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801814:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801817:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  80181a:	39 f7                	cmp    %esi,%edi
+  80181c:	74 1c                	je     80183a <fork+0x34d>
+  80181e:	89 d8                	mov    %ebx,%eax
+  801820:	e8 c5 fb ff ff       	call   8013ea <dupable>
+  801825:	84 c0                	test   %al,%al
+  801827:	74 7c                	je     8018a5 <fork+0x3b8>
+  801829:	89 d8                	mov    %ebx,%eax
+  80182b:	e8 71 fb ff ff       	call   8013a1 <dupperm>
+  801830:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801833:	74 d9                	je     80180e <fork+0x321>
+  801835:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801838:	eb 06                	jmp    801840 <fork+0x353>
+  80183a:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80183d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801840:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801843:	c1 e0 0c             	shl    $0xc,%eax
+  801846:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801849:	83 ec 08             	sub    $0x8,%esp
+  80184c:	ff 75 dc             	push   -0x24(%ebp)
+  80184f:	57                   	push   %edi
+  801850:	50                   	push   %eax
+  801851:	ff 75 e4             	push   -0x1c(%ebp)
+  801854:	50                   	push   %eax
+  801855:	6a 00                	push   $0x0
+  801857:	e8 78 2e 00 00       	call   8046d4 <page_map_range>
+  80185c:	83 c4 20             	add    $0x20,%esp
+  80185f:	85 c0                	test   %eax,%eax
+  801861:	78 47                	js     8018aa <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801863:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  80186a:	0f 84 41 fd ff ff    	je     8015b1 <fork+0xc4>
+  801870:	83 ec 08             	sub    $0x8,%esp
+  801873:	ff 75 dc             	push   -0x24(%ebp)
+  801876:	57                   	push   %edi
+  801877:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80187a:	50                   	push   %eax
+  80187b:	6a 00                	push   $0x0
+  80187d:	50                   	push   %eax
+  80187e:	6a 00                	push   $0x0
+  801880:	e8 4f 2e 00 00       	call   8046d4 <page_map_range>
+  801885:	83 c4 20             	add    $0x20,%esp
+  801888:	85 c0                	test   %eax,%eax
+  80188a:	0f 89 21 fd ff ff    	jns    8015b1 <fork+0xc4>
+		panic("page_map_range %e", r);
+  801890:	50                   	push   %eax
+  801891:	68 ed 58 80 00       	push   $0x8058ed
+  801896:	68 a2 00 00 00       	push   $0xa2
+  80189b:	68 ab 58 80 00       	push   $0x8058ab
+  8018a0:	e8 ac e9 ff ff       	call   800251 <_panic>
+  8018a5:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8018a8:	eb 96                	jmp    801840 <fork+0x353>
+		panic("page_map_range %e", r);
+  8018aa:	50                   	push   %eax
+  8018ab:	68 ed 58 80 00       	push   $0x8058ed
+  8018b0:	68 a0 00 00 00       	push   $0xa0
+  8018b5:	68 ab 58 80 00       	push   $0x8058ab
+  8018ba:	e8 92 e9 ff ff       	call   800251 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  8018bf:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8018c2:	6a 01                	push   $0x1
+  8018c4:	6a 07                	push   $0x7
+  8018c6:	68 00 f0 bf ee       	push   $0xeebff000
+  8018cb:	53                   	push   %ebx
+  8018cc:	e8 ab 25 00 00       	call   803e7c <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8018d1:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8018d6:	8b 40 74             	mov    0x74(%eax),%eax
+  8018d9:	83 c4 08             	add    $0x8,%esp
+  8018dc:	50                   	push   %eax
+  8018dd:	53                   	push   %ebx
+  8018de:	e8 89 f8 ff ff       	call   80116c <sys_env_set_pgfault_upcall>
+  8018e3:	83 c4 10             	add    $0x10,%esp
+  8018e6:	e9 41 fc ff ff       	jmp    80152c <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8018eb:	e8 d8 f4 ff ff       	call   800dc8 <sys_getenvid>
+  8018f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018f5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8018f8:	c1 e0 06             	shl    $0x6,%eax
+  8018fb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801900:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  801905:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80190c:	e9 40 fc ff ff       	jmp    801551 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  801911:	50                   	push   %eax
+  801912:	68 ff 58 80 00       	push   $0x8058ff
+  801917:	68 27 01 00 00       	push   $0x127
+  80191c:	68 ab 58 80 00       	push   $0x8058ab
+  801921:	e8 2b e9 ff ff       	call   800251 <_panic>
+		panic("sys_env_set_status: %d", r);
+  801926:	50                   	push   %eax
+  801927:	68 18 59 80 00       	push   $0x805918
+  80192c:	68 2b 01 00 00       	push   $0x12b
+  801931:	68 ab 58 80 00       	push   $0x8058ab
+  801936:	e8 16 e9 ff ff       	call   800251 <_panic>
+
+0080193b <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80193b:	55                   	push   %ebp
+  80193c:	89 e5                	mov    %esp,%ebp
+  80193e:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801941:	68 2f 59 80 00       	push   $0x80592f
+  801946:	68 35 01 00 00       	push   $0x135
+  80194b:	68 ab 58 80 00       	push   $0x8058ab
+  801950:	e8 fc e8 ff ff       	call   800251 <_panic>
+
+00801955 <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	57                   	push   %edi
+  801959:	56                   	push   %esi
+  80195a:	53                   	push   %ebx
+  80195b:	83 ec 14             	sub    $0x14,%esp
+  80195e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801961:	8b 75 14             	mov    0x14(%ebp),%esi
+  801964:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  801967:	ff 75 10             	push   0x10(%ebp)
+  80196a:	ff 75 0c             	push   0xc(%ebp)
+  80196d:	e8 b7 f8 ff ff       	call   801229 <sys_ipc_recv_pages>
+  801972:	83 c4 10             	add    $0x10,%esp
+  801975:	85 c0                	test   %eax,%eax
+  801977:	78 46                	js     8019bf <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801979:	85 ff                	test   %edi,%edi
+  80197b:	74 0d                	je     80198a <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  80197d:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801982:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801988:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80198a:	85 f6                	test   %esi,%esi
+  80198c:	74 0d                	je     80199b <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  80198e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801993:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801999:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80199b:	85 db                	test   %ebx,%ebx
+  80199d:	74 0d                	je     8019ac <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  80199f:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8019a4:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8019aa:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8019ac:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8019b1:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8019b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ba:	5b                   	pop    %ebx
+  8019bb:	5e                   	pop    %esi
+  8019bc:	5f                   	pop    %edi
+  8019bd:	5d                   	pop    %ebp
+  8019be:	c3                   	ret
+		if (from_env_store) {
+  8019bf:	85 ff                	test   %edi,%edi
+  8019c1:	74 06                	je     8019c9 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8019c3:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8019c9:	85 f6                	test   %esi,%esi
+  8019cb:	74 06                	je     8019d3 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8019cd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8019d3:	85 db                	test   %ebx,%ebx
+  8019d5:	74 e0                	je     8019b7 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8019d7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8019dd:	eb d8                	jmp    8019b7 <ipc_recv_pages+0x62>
+
+008019df <ipc_recv>:
+{
+  8019df:	55                   	push   %ebp
+  8019e0:	89 e5                	mov    %esp,%ebp
+  8019e2:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8019e5:	6a 00                	push   $0x0
+  8019e7:	ff 75 10             	push   0x10(%ebp)
+  8019ea:	6a 01                	push   $0x1
+  8019ec:	ff 75 0c             	push   0xc(%ebp)
+  8019ef:	ff 75 08             	push   0x8(%ebp)
+  8019f2:	e8 5e ff ff ff       	call   801955 <ipc_recv_pages>
+}
+  8019f7:	c9                   	leave
+  8019f8:	c3                   	ret
+
+008019f9 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8019f9:	55                   	push   %ebp
+  8019fa:	89 e5                	mov    %esp,%ebp
+  8019fc:	56                   	push   %esi
+  8019fd:	53                   	push   %ebx
+  8019fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a01:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  801a04:	83 ec 0c             	sub    $0xc,%esp
+  801a07:	ff 75 0c             	push   0xc(%ebp)
+  801a0a:	e8 4e f9 ff ff       	call   80135d <sys_ipc_try_recv>
+  801a0f:	83 c4 10             	add    $0x10,%esp
+  801a12:	85 c0                	test   %eax,%eax
+  801a14:	78 34                	js     801a4a <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801a16:	85 f6                	test   %esi,%esi
+  801a18:	74 0d                	je     801a27 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  801a1a:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801a1f:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801a25:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  801a27:	85 db                	test   %ebx,%ebx
+  801a29:	74 0d                	je     801a38 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  801a2b:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801a30:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801a36:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801a38:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801a3d:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801a43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a46:	5b                   	pop    %ebx
+  801a47:	5e                   	pop    %esi
+  801a48:	5d                   	pop    %ebp
+  801a49:	c3                   	ret
+		if (from_env_store) {
+  801a4a:	85 f6                	test   %esi,%esi
+  801a4c:	74 06                	je     801a54 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  801a4e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  801a54:	85 db                	test   %ebx,%ebx
+  801a56:	74 eb                	je     801a43 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  801a58:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801a5e:	eb e3                	jmp    801a43 <ipc_try_recv+0x4a>
+
+00801a60 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  801a60:	55                   	push   %ebp
+  801a61:	89 e5                	mov    %esp,%ebp
+  801a63:	83 ec 14             	sub    $0x14,%esp
+  801a66:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801a70:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801a73:	ff 75 18             	push   0x18(%ebp)
+  801a76:	ff 75 14             	push   0x14(%ebp)
+  801a79:	50                   	push   %eax
+  801a7a:	ff 75 0c             	push   0xc(%ebp)
+  801a7d:	ff 75 08             	push   0x8(%ebp)
+  801a80:	e8 67 f7 ff ff       	call   8011ec <sys_ipc_send_pages>
+  801a85:	83 c4 20             	add    $0x20,%esp
+  801a88:	85 c0                	test   %eax,%eax
+  801a8a:	78 02                	js     801a8e <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  801a8c:	c9                   	leave
+  801a8d:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  801a8e:	50                   	push   %eax
+  801a8f:	68 48 59 80 00       	push   $0x805948
+  801a94:	68 80 00 00 00       	push   $0x80
+  801a99:	68 74 59 80 00       	push   $0x805974
+  801a9e:	e8 ae e7 ff ff       	call   800251 <_panic>
+
+00801aa3 <ipc_send>:
+{
+  801aa3:	55                   	push   %ebp
+  801aa4:	89 e5                	mov    %esp,%ebp
+  801aa6:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  801aa9:	ff 75 14             	push   0x14(%ebp)
+  801aac:	6a 01                	push   $0x1
+  801aae:	ff 75 10             	push   0x10(%ebp)
+  801ab1:	ff 75 0c             	push   0xc(%ebp)
+  801ab4:	ff 75 08             	push   0x8(%ebp)
+  801ab7:	e8 a4 ff ff ff       	call   801a60 <ipc_send_pages>
+}
+  801abc:	83 c4 20             	add    $0x20,%esp
+  801abf:	c9                   	leave
+  801ac0:	c3                   	ret
+
+00801ac1 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  801ac1:	55                   	push   %ebp
+  801ac2:	89 e5                	mov    %esp,%ebp
+  801ac4:	83 ec 14             	sub    $0x14,%esp
+  801ac7:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801aca:	85 c0                	test   %eax,%eax
+  801acc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801ad1:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801ad4:	ff 75 18             	push   0x18(%ebp)
+  801ad7:	ff 75 14             	push   0x14(%ebp)
+  801ada:	50                   	push   %eax
+  801adb:	ff 75 0c             	push   0xc(%ebp)
+  801ade:	ff 75 08             	push   0x8(%ebp)
+  801ae1:	e8 97 f7 ff ff       	call   80127d <sys_ipc_call>
+  801ae6:	83 c4 20             	add    $0x20,%esp
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	78 0b                	js     801af8 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  801aed:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801af2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801af8:	c9                   	leave
+  801af9:	c3                   	ret
+
+00801afa <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  801afa:	55                   	push   %ebp
+  801afb:	89 e5                	mov    %esp,%ebp
+  801afd:	57                   	push   %edi
+  801afe:	56                   	push   %esi
+  801aff:	53                   	push   %ebx
+  801b00:	83 ec 18             	sub    $0x18,%esp
+  801b03:	8b 45 10             	mov    0x10(%ebp),%eax
+  801b06:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  801b09:	8b 75 20             	mov    0x20(%ebp),%esi
+  801b0c:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801b16:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  801b19:	ff 75 18             	push   0x18(%ebp)
+  801b1c:	ff 75 14             	push   0x14(%ebp)
+  801b1f:	50                   	push   %eax
+  801b20:	ff 75 0c             	push   0xc(%ebp)
+  801b23:	ff 75 08             	push   0x8(%ebp)
+  801b26:	e8 93 f7 ff ff       	call   8012be <sys_ipc_reply_recv>
+  801b2b:	83 c4 20             	add    $0x20,%esp
+  801b2e:	85 c0                	test   %eax,%eax
+  801b30:	78 46                	js     801b78 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  801b32:	85 ff                	test   %edi,%edi
+  801b34:	74 0d                	je     801b43 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  801b36:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801b3b:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  801b41:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  801b43:	85 f6                	test   %esi,%esi
+  801b45:	74 0d                	je     801b54 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  801b47:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801b4c:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  801b52:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  801b54:	85 db                	test   %ebx,%ebx
+  801b56:	74 0d                	je     801b65 <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  801b58:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801b5d:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  801b63:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  801b65:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801b6a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  801b70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b73:	5b                   	pop    %ebx
+  801b74:	5e                   	pop    %esi
+  801b75:	5f                   	pop    %edi
+  801b76:	5d                   	pop    %ebp
+  801b77:	c3                   	ret
+		if (from_env_store) {
+  801b78:	85 ff                	test   %edi,%edi
+  801b7a:	74 06                	je     801b82 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  801b7c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  801b82:	85 f6                	test   %esi,%esi
+  801b84:	74 06                	je     801b8c <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  801b86:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  801b8c:	85 db                	test   %ebx,%ebx
+  801b8e:	74 e0                	je     801b70 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  801b90:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  801b96:	eb d8                	jmp    801b70 <ipc_reply_recv+0x76>
+
+00801b98 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801b98:	55                   	push   %ebp
+  801b99:	89 e5                	mov    %esp,%ebp
+  801b9b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  801b9e:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  801ba3:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801ba6:	c1 e0 06             	shl    $0x6,%eax
+  801ba9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801bae:	8b 40 50             	mov    0x50(%eax),%eax
+  801bb1:	39 c8                	cmp    %ecx,%eax
+  801bb3:	74 12                	je     801bc7 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  801bb5:	83 c2 01             	add    $0x1,%edx
+  801bb8:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801bbe:	75 e3                	jne    801ba3 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  801bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc5:	eb 0e                	jmp    801bd5 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  801bc7:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  801bca:	c1 e0 06             	shl    $0x6,%eax
+  801bcd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801bd2:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801bd5:	5d                   	pop    %ebp
+  801bd6:	c3                   	ret
+
+00801bd7 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801bd7:	55                   	push   %ebp
+  801bd8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bda:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bdd:	05 00 00 00 30       	add    $0x30000000,%eax
+  801be2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801be5:	5d                   	pop    %ebp
+  801be6:	c3                   	ret
+
+00801be7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801be7:	55                   	push   %ebp
+  801be8:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bed:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801bf2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bf7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801bfc:	5d                   	pop    %ebp
+  801bfd:	c3                   	ret
+
+00801bfe <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801bfe:	55                   	push   %ebp
+  801bff:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801c01:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801c06:	a8 01                	test   $0x1,%al
+  801c08:	74 3c                	je     801c46 <fd_alloc+0x48>
+  801c0a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c0f:	89 c2                	mov    %eax,%edx
+  801c11:	c1 ea 0c             	shr    $0xc,%edx
+  801c14:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c1b:	89 c1                	mov    %eax,%ecx
+  801c1d:	05 00 10 00 00       	add    $0x1000,%eax
+  801c22:	f6 c2 01             	test   $0x1,%dl
+  801c25:	74 13                	je     801c3a <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801c27:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801c2c:	75 e1                	jne    801c0f <fd_alloc+0x11>
+  801c2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801c33:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801c38:	eb 05                	jmp    801c3f <fd_alloc+0x41>
+			return 0;
+  801c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801c3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c42:	89 0a                	mov    %ecx,(%edx)
+}
+  801c44:	5d                   	pop    %ebp
+  801c45:	c3                   	ret
+  801c46:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c50:	eb ed                	jmp    801c3f <fd_alloc+0x41>
+
+00801c52 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801c52:	55                   	push   %ebp
+  801c53:	89 e5                	mov    %esp,%ebp
+  801c55:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801c58:	83 f8 1f             	cmp    $0x1f,%eax
+  801c5b:	77 30                	ja     801c8d <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801c5d:	c1 e0 0c             	shl    $0xc,%eax
+  801c60:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801c65:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c6b:	f6 c2 01             	test   $0x1,%dl
+  801c6e:	74 24                	je     801c94 <fd_lookup+0x42>
+  801c70:	89 c2                	mov    %eax,%edx
+  801c72:	c1 ea 0c             	shr    $0xc,%edx
+  801c75:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c7c:	f6 c2 01             	test   $0x1,%dl
+  801c7f:	74 1a                	je     801c9b <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c81:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c84:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c8b:	5d                   	pop    %ebp
+  801c8c:	c3                   	ret
+		return -E_INVAL;
+  801c8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c92:	eb f7                	jmp    801c8b <fd_lookup+0x39>
+		return -E_INVAL;
+  801c94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c99:	eb f0                	jmp    801c8b <fd_lookup+0x39>
+  801c9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ca0:	eb e9                	jmp    801c8b <fd_lookup+0x39>
+
+00801ca2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801ca2:	55                   	push   %ebp
+  801ca3:	89 e5                	mov    %esp,%ebp
+  801ca5:	53                   	push   %ebx
+  801ca6:	83 ec 04             	sub    $0x4,%esp
+  801ca9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801cac:	b8 fc 59 80 00       	mov    $0x8059fc,%eax
+  801cb1:	8b 18                	mov    (%eax),%ebx
+  801cb3:	85 db                	test   %ebx,%ebx
+  801cb5:	74 0e                	je     801cc5 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801cb7:	83 c0 04             	add    $0x4,%eax
+  801cba:	39 13                	cmp    %edx,(%ebx)
+  801cbc:	75 f3                	jne    801cb1 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc3:	eb 1f                	jmp    801ce4 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801cc5:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801cca:	8b 40 48             	mov    0x48(%eax),%eax
+  801ccd:	83 ec 04             	sub    $0x4,%esp
+  801cd0:	52                   	push   %edx
+  801cd1:	50                   	push   %eax
+  801cd2:	68 80 59 80 00       	push   $0x805980
+  801cd7:	e8 50 e6 ff ff       	call   80032c <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801cdc:	83 c4 10             	add    $0x10,%esp
+  801cdf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801ce4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ce7:	89 1a                	mov    %ebx,(%edx)
+}
+  801ce9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cec:	c9                   	leave
+  801ced:	c3                   	ret
+
+00801cee <fd_close>:
+{
+  801cee:	55                   	push   %ebp
+  801cef:	89 e5                	mov    %esp,%ebp
+  801cf1:	57                   	push   %edi
+  801cf2:	56                   	push   %esi
+  801cf3:	53                   	push   %ebx
+  801cf4:	83 ec 24             	sub    $0x24,%esp
+  801cf7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cfa:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801cfd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d00:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d01:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d07:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d0a:	50                   	push   %eax
+  801d0b:	e8 42 ff ff ff       	call   801c52 <fd_lookup>
+  801d10:	89 c3                	mov    %eax,%ebx
+  801d12:	83 c4 10             	add    $0x10,%esp
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	78 05                	js     801d1e <fd_close+0x30>
+	    || fd != fd2)
+  801d19:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d1c:	74 16                	je     801d34 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801d1e:	89 f8                	mov    %edi,%eax
+  801d20:	84 c0                	test   %al,%al
+  801d22:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d27:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801d2a:	89 d8                	mov    %ebx,%eax
+  801d2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d2f:	5b                   	pop    %ebx
+  801d30:	5e                   	pop    %esi
+  801d31:	5f                   	pop    %edi
+  801d32:	5d                   	pop    %ebp
+  801d33:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d34:	83 ec 08             	sub    $0x8,%esp
+  801d37:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d3a:	50                   	push   %eax
+  801d3b:	ff 36                	push   (%esi)
+  801d3d:	e8 60 ff ff ff       	call   801ca2 <dev_lookup>
+  801d42:	89 c3                	mov    %eax,%ebx
+  801d44:	83 c4 10             	add    $0x10,%esp
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	78 1a                	js     801d65 <fd_close+0x77>
+		if (dev->dev_close)
+  801d4b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d4e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d51:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	74 0b                	je     801d65 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801d5a:	83 ec 0c             	sub    $0xc,%esp
+  801d5d:	56                   	push   %esi
+  801d5e:	ff d0                	call   *%eax
+  801d60:	89 c3                	mov    %eax,%ebx
+  801d62:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801d65:	83 ec 08             	sub    $0x8,%esp
+  801d68:	56                   	push   %esi
+  801d69:	6a 00                	push   $0x0
+  801d6b:	e8 1b f1 ff ff       	call   800e8b <sys_page_unmap>
+	return r;
+  801d70:	83 c4 10             	add    $0x10,%esp
+  801d73:	eb b5                	jmp    801d2a <fd_close+0x3c>
+
+00801d75 <close>:
+
+int
+close(int fdnum)
+{
+  801d75:	55                   	push   %ebp
+  801d76:	89 e5                	mov    %esp,%ebp
+  801d78:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d7e:	50                   	push   %eax
+  801d7f:	ff 75 08             	push   0x8(%ebp)
+  801d82:	e8 cb fe ff ff       	call   801c52 <fd_lookup>
+  801d87:	83 c4 10             	add    $0x10,%esp
+  801d8a:	85 c0                	test   %eax,%eax
+  801d8c:	79 02                	jns    801d90 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801d8e:	c9                   	leave
+  801d8f:	c3                   	ret
+		return fd_close(fd, 1);
+  801d90:	83 ec 08             	sub    $0x8,%esp
+  801d93:	6a 01                	push   $0x1
+  801d95:	ff 75 f4             	push   -0xc(%ebp)
+  801d98:	e8 51 ff ff ff       	call   801cee <fd_close>
+  801d9d:	83 c4 10             	add    $0x10,%esp
+  801da0:	eb ec                	jmp    801d8e <close+0x19>
+
+00801da2 <close_all>:
+
+void
+close_all(void)
+{
+  801da2:	55                   	push   %ebp
+  801da3:	89 e5                	mov    %esp,%ebp
+  801da5:	53                   	push   %ebx
+  801da6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801da9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801dae:	83 ec 0c             	sub    $0xc,%esp
+  801db1:	53                   	push   %ebx
+  801db2:	e8 be ff ff ff       	call   801d75 <close>
+	for (i = 0; i < MAXFD; i++)
+  801db7:	83 c3 01             	add    $0x1,%ebx
+  801dba:	83 c4 10             	add    $0x10,%esp
+  801dbd:	83 fb 20             	cmp    $0x20,%ebx
+  801dc0:	75 ec                	jne    801dae <close_all+0xc>
+}
+  801dc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dc5:	c9                   	leave
+  801dc6:	c3                   	ret
+
+00801dc7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801dc7:	55                   	push   %ebp
+  801dc8:	89 e5                	mov    %esp,%ebp
+  801dca:	57                   	push   %edi
+  801dcb:	56                   	push   %esi
+  801dcc:	53                   	push   %ebx
+  801dcd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801dd0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801dd3:	50                   	push   %eax
+  801dd4:	ff 75 08             	push   0x8(%ebp)
+  801dd7:	e8 76 fe ff ff       	call   801c52 <fd_lookup>
+  801ddc:	89 c3                	mov    %eax,%ebx
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	78 7f                	js     801e64 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801de5:	83 ec 0c             	sub    $0xc,%esp
+  801de8:	ff 75 0c             	push   0xc(%ebp)
+  801deb:	e8 85 ff ff ff       	call   801d75 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801df0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801df3:	c1 e6 0c             	shl    $0xc,%esi
+  801df6:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801dfc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801dff:	89 3c 24             	mov    %edi,(%esp)
+  801e02:	e8 e0 fd ff ff       	call   801be7 <fd2data>
+  801e07:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e09:	89 34 24             	mov    %esi,(%esp)
+  801e0c:	e8 d6 fd ff ff       	call   801be7 <fd2data>
+  801e11:	83 c4 10             	add    $0x10,%esp
+  801e14:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801e17:	89 d8                	mov    %ebx,%eax
+  801e19:	c1 e8 16             	shr    $0x16,%eax
+  801e1c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e23:	a8 01                	test   $0x1,%al
+  801e25:	74 11                	je     801e38 <dup+0x71>
+  801e27:	89 d8                	mov    %ebx,%eax
+  801e29:	c1 e8 0c             	shr    $0xc,%eax
+  801e2c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e33:	f6 c2 01             	test   $0x1,%dl
+  801e36:	75 36                	jne    801e6e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e38:	89 f8                	mov    %edi,%eax
+  801e3a:	c1 e8 0c             	shr    $0xc,%eax
+  801e3d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e44:	83 ec 0c             	sub    $0xc,%esp
+  801e47:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e4c:	50                   	push   %eax
+  801e4d:	56                   	push   %esi
+  801e4e:	6a 00                	push   $0x0
+  801e50:	57                   	push   %edi
+  801e51:	6a 00                	push   $0x0
+  801e53:	e8 f1 ef ff ff       	call   800e49 <sys_page_map>
+  801e58:	89 c3                	mov    %eax,%ebx
+  801e5a:	83 c4 20             	add    $0x20,%esp
+  801e5d:	85 c0                	test   %eax,%eax
+  801e5f:	78 33                	js     801e94 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801e61:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801e64:	89 d8                	mov    %ebx,%eax
+  801e66:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e69:	5b                   	pop    %ebx
+  801e6a:	5e                   	pop    %esi
+  801e6b:	5f                   	pop    %edi
+  801e6c:	5d                   	pop    %ebp
+  801e6d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e6e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e75:	83 ec 0c             	sub    $0xc,%esp
+  801e78:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e7d:	50                   	push   %eax
+  801e7e:	ff 75 d4             	push   -0x2c(%ebp)
+  801e81:	6a 00                	push   $0x0
+  801e83:	53                   	push   %ebx
+  801e84:	6a 00                	push   $0x0
+  801e86:	e8 be ef ff ff       	call   800e49 <sys_page_map>
+  801e8b:	89 c3                	mov    %eax,%ebx
+  801e8d:	83 c4 20             	add    $0x20,%esp
+  801e90:	85 c0                	test   %eax,%eax
+  801e92:	79 a4                	jns    801e38 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801e94:	83 ec 08             	sub    $0x8,%esp
+  801e97:	56                   	push   %esi
+  801e98:	6a 00                	push   $0x0
+  801e9a:	e8 ec ef ff ff       	call   800e8b <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801e9f:	83 c4 08             	add    $0x8,%esp
+  801ea2:	ff 75 d4             	push   -0x2c(%ebp)
+  801ea5:	6a 00                	push   $0x0
+  801ea7:	e8 df ef ff ff       	call   800e8b <sys_page_unmap>
+	return r;
+  801eac:	83 c4 10             	add    $0x10,%esp
+  801eaf:	eb b3                	jmp    801e64 <dup+0x9d>
+
+00801eb1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801eb1:	55                   	push   %ebp
+  801eb2:	89 e5                	mov    %esp,%ebp
+  801eb4:	56                   	push   %esi
+  801eb5:	53                   	push   %ebx
+  801eb6:	83 ec 18             	sub    $0x18,%esp
+  801eb9:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ebc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ebf:	50                   	push   %eax
+  801ec0:	56                   	push   %esi
+  801ec1:	e8 8c fd ff ff       	call   801c52 <fd_lookup>
+  801ec6:	83 c4 10             	add    $0x10,%esp
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	78 3c                	js     801f09 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ecd:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801ed0:	83 ec 08             	sub    $0x8,%esp
+  801ed3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed6:	50                   	push   %eax
+  801ed7:	ff 33                	push   (%ebx)
+  801ed9:	e8 c4 fd ff ff       	call   801ca2 <dev_lookup>
+  801ede:	83 c4 10             	add    $0x10,%esp
+  801ee1:	85 c0                	test   %eax,%eax
+  801ee3:	78 24                	js     801f09 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ee5:	8b 43 08             	mov    0x8(%ebx),%eax
+  801ee8:	83 e0 03             	and    $0x3,%eax
+  801eeb:	83 f8 01             	cmp    $0x1,%eax
+  801eee:	74 20                	je     801f10 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801ef0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef3:	8b 40 08             	mov    0x8(%eax),%eax
+  801ef6:	85 c0                	test   %eax,%eax
+  801ef8:	74 37                	je     801f31 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801efa:	83 ec 04             	sub    $0x4,%esp
+  801efd:	ff 75 10             	push   0x10(%ebp)
+  801f00:	ff 75 0c             	push   0xc(%ebp)
+  801f03:	53                   	push   %ebx
+  801f04:	ff d0                	call   *%eax
+  801f06:	83 c4 10             	add    $0x10,%esp
+}
+  801f09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f0c:	5b                   	pop    %ebx
+  801f0d:	5e                   	pop    %esi
+  801f0e:	5d                   	pop    %ebp
+  801f0f:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f10:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801f15:	8b 40 48             	mov    0x48(%eax),%eax
+  801f18:	83 ec 04             	sub    $0x4,%esp
+  801f1b:	56                   	push   %esi
+  801f1c:	50                   	push   %eax
+  801f1d:	68 c1 59 80 00       	push   $0x8059c1
+  801f22:	e8 05 e4 ff ff       	call   80032c <cprintf>
+		return -E_INVAL;
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f2f:	eb d8                	jmp    801f09 <read+0x58>
+		return -E_NOT_SUPP;
+  801f31:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f36:	eb d1                	jmp    801f09 <read+0x58>
+
+00801f38 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f38:	55                   	push   %ebp
+  801f39:	89 e5                	mov    %esp,%ebp
+  801f3b:	57                   	push   %edi
+  801f3c:	56                   	push   %esi
+  801f3d:	53                   	push   %ebx
+  801f3e:	83 ec 0c             	sub    $0xc,%esp
+  801f41:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f44:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f4c:	eb 02                	jmp    801f50 <readn+0x18>
+  801f4e:	01 c3                	add    %eax,%ebx
+  801f50:	39 f3                	cmp    %esi,%ebx
+  801f52:	73 21                	jae    801f75 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f54:	83 ec 04             	sub    $0x4,%esp
+  801f57:	89 f0                	mov    %esi,%eax
+  801f59:	29 d8                	sub    %ebx,%eax
+  801f5b:	50                   	push   %eax
+  801f5c:	89 d8                	mov    %ebx,%eax
+  801f5e:	03 45 0c             	add    0xc(%ebp),%eax
+  801f61:	50                   	push   %eax
+  801f62:	57                   	push   %edi
+  801f63:	e8 49 ff ff ff       	call   801eb1 <read>
+		if (m < 0)
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 04                	js     801f73 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801f6f:	75 dd                	jne    801f4e <readn+0x16>
+  801f71:	eb 02                	jmp    801f75 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f73:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801f75:	89 d8                	mov    %ebx,%eax
+  801f77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f7a:	5b                   	pop    %ebx
+  801f7b:	5e                   	pop    %esi
+  801f7c:	5f                   	pop    %edi
+  801f7d:	5d                   	pop    %ebp
+  801f7e:	c3                   	ret
+
+00801f7f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+  801f82:	56                   	push   %esi
+  801f83:	53                   	push   %ebx
+  801f84:	83 ec 18             	sub    $0x18,%esp
+  801f87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f8a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f8d:	50                   	push   %eax
+  801f8e:	53                   	push   %ebx
+  801f8f:	e8 be fc ff ff       	call   801c52 <fd_lookup>
+  801f94:	83 c4 10             	add    $0x10,%esp
+  801f97:	85 c0                	test   %eax,%eax
+  801f99:	78 37                	js     801fd2 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f9b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f9e:	83 ec 08             	sub    $0x8,%esp
+  801fa1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fa4:	50                   	push   %eax
+  801fa5:	ff 36                	push   (%esi)
+  801fa7:	e8 f6 fc ff ff       	call   801ca2 <dev_lookup>
+  801fac:	83 c4 10             	add    $0x10,%esp
+  801faf:	85 c0                	test   %eax,%eax
+  801fb1:	78 1f                	js     801fd2 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fb3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fb7:	74 20                	je     801fd9 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801fb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fbc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fbf:	85 c0                	test   %eax,%eax
+  801fc1:	74 37                	je     801ffa <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801fc3:	83 ec 04             	sub    $0x4,%esp
+  801fc6:	ff 75 10             	push   0x10(%ebp)
+  801fc9:	ff 75 0c             	push   0xc(%ebp)
+  801fcc:	56                   	push   %esi
+  801fcd:	ff d0                	call   *%eax
+  801fcf:	83 c4 10             	add    $0x10,%esp
+}
+  801fd2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fd5:	5b                   	pop    %ebx
+  801fd6:	5e                   	pop    %esi
+  801fd7:	5d                   	pop    %ebp
+  801fd8:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fd9:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801fde:	8b 40 48             	mov    0x48(%eax),%eax
+  801fe1:	83 ec 04             	sub    $0x4,%esp
+  801fe4:	53                   	push   %ebx
+  801fe5:	50                   	push   %eax
+  801fe6:	68 dd 59 80 00       	push   $0x8059dd
+  801feb:	e8 3c e3 ff ff       	call   80032c <cprintf>
+		return -E_INVAL;
+  801ff0:	83 c4 10             	add    $0x10,%esp
+  801ff3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ff8:	eb d8                	jmp    801fd2 <write+0x53>
+		return -E_NOT_SUPP;
+  801ffa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801fff:	eb d1                	jmp    801fd2 <write+0x53>
+
+00802001 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802001:	55                   	push   %ebp
+  802002:	89 e5                	mov    %esp,%ebp
+  802004:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802007:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80200a:	50                   	push   %eax
+  80200b:	ff 75 08             	push   0x8(%ebp)
+  80200e:	e8 3f fc ff ff       	call   801c52 <fd_lookup>
+  802013:	83 c4 10             	add    $0x10,%esp
+  802016:	85 c0                	test   %eax,%eax
+  802018:	78 0e                	js     802028 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80201a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80201d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802020:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802023:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802028:	c9                   	leave
+  802029:	c3                   	ret
+
+0080202a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	56                   	push   %esi
+  80202e:	53                   	push   %ebx
+  80202f:	83 ec 18             	sub    $0x18,%esp
+  802032:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  802035:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802038:	50                   	push   %eax
+  802039:	53                   	push   %ebx
+  80203a:	e8 13 fc ff ff       	call   801c52 <fd_lookup>
+  80203f:	83 c4 10             	add    $0x10,%esp
+  802042:	85 c0                	test   %eax,%eax
+  802044:	78 34                	js     80207a <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802046:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802049:	83 ec 08             	sub    $0x8,%esp
+  80204c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80204f:	50                   	push   %eax
+  802050:	ff 36                	push   (%esi)
+  802052:	e8 4b fc ff ff       	call   801ca2 <dev_lookup>
+  802057:	83 c4 10             	add    $0x10,%esp
+  80205a:	85 c0                	test   %eax,%eax
+  80205c:	78 1c                	js     80207a <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80205e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802062:	74 1d                	je     802081 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802064:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802067:	8b 40 18             	mov    0x18(%eax),%eax
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	74 34                	je     8020a2 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80206e:	83 ec 08             	sub    $0x8,%esp
+  802071:	ff 75 0c             	push   0xc(%ebp)
+  802074:	56                   	push   %esi
+  802075:	ff d0                	call   *%eax
+  802077:	83 c4 10             	add    $0x10,%esp
+}
+  80207a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80207d:	5b                   	pop    %ebx
+  80207e:	5e                   	pop    %esi
+  80207f:	5d                   	pop    %ebp
+  802080:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802081:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802086:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802089:	83 ec 04             	sub    $0x4,%esp
+  80208c:	53                   	push   %ebx
+  80208d:	50                   	push   %eax
+  80208e:	68 a0 59 80 00       	push   $0x8059a0
+  802093:	e8 94 e2 ff ff       	call   80032c <cprintf>
+		return -E_INVAL;
+  802098:	83 c4 10             	add    $0x10,%esp
+  80209b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020a0:	eb d8                	jmp    80207a <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8020a2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020a7:	eb d1                	jmp    80207a <ftruncate+0x50>
+
+008020a9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8020a9:	55                   	push   %ebp
+  8020aa:	89 e5                	mov    %esp,%ebp
+  8020ac:	56                   	push   %esi
+  8020ad:	53                   	push   %ebx
+  8020ae:	83 ec 18             	sub    $0x18,%esp
+  8020b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020b4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020b7:	50                   	push   %eax
+  8020b8:	ff 75 08             	push   0x8(%ebp)
+  8020bb:	e8 92 fb ff ff       	call   801c52 <fd_lookup>
+  8020c0:	83 c4 10             	add    $0x10,%esp
+  8020c3:	85 c0                	test   %eax,%eax
+  8020c5:	78 49                	js     802110 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020c7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020ca:	83 ec 08             	sub    $0x8,%esp
+  8020cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020d0:	50                   	push   %eax
+  8020d1:	ff 36                	push   (%esi)
+  8020d3:	e8 ca fb ff ff       	call   801ca2 <dev_lookup>
+  8020d8:	83 c4 10             	add    $0x10,%esp
+  8020db:	85 c0                	test   %eax,%eax
+  8020dd:	78 31                	js     802110 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8020df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8020e6:	74 2f                	je     802117 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8020e8:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8020eb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8020f2:	00 00 00 
+	stat->st_isdir = 0;
+  8020f5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020fc:	00 00 00 
+	stat->st_dev = dev;
+  8020ff:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  802105:	83 ec 08             	sub    $0x8,%esp
+  802108:	53                   	push   %ebx
+  802109:	56                   	push   %esi
+  80210a:	ff 50 14             	call   *0x14(%eax)
+  80210d:	83 c4 10             	add    $0x10,%esp
+}
+  802110:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802113:	5b                   	pop    %ebx
+  802114:	5e                   	pop    %esi
+  802115:	5d                   	pop    %ebp
+  802116:	c3                   	ret
+		return -E_NOT_SUPP;
+  802117:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80211c:	eb f2                	jmp    802110 <fstat+0x67>
+
+0080211e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80211e:	55                   	push   %ebp
+  80211f:	89 e5                	mov    %esp,%ebp
+  802121:	56                   	push   %esi
+  802122:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802123:	83 ec 08             	sub    $0x8,%esp
+  802126:	6a 00                	push   $0x0
+  802128:	ff 75 08             	push   0x8(%ebp)
+  80212b:	e8 bc 02 00 00       	call   8023ec <open>
+  802130:	89 c3                	mov    %eax,%ebx
+  802132:	83 c4 10             	add    $0x10,%esp
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 1b                	js     802154 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  802139:	83 ec 08             	sub    $0x8,%esp
+  80213c:	ff 75 0c             	push   0xc(%ebp)
+  80213f:	50                   	push   %eax
+  802140:	e8 64 ff ff ff       	call   8020a9 <fstat>
+  802145:	89 c6                	mov    %eax,%esi
+	close(fd);
+  802147:	89 1c 24             	mov    %ebx,(%esp)
+  80214a:	e8 26 fc ff ff       	call   801d75 <close>
+	return r;
+  80214f:	83 c4 10             	add    $0x10,%esp
+  802152:	89 f3                	mov    %esi,%ebx
+}
+  802154:	89 d8                	mov    %ebx,%eax
+  802156:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802159:	5b                   	pop    %ebx
+  80215a:	5e                   	pop    %esi
+  80215b:	5d                   	pop    %ebp
+  80215c:	c3                   	ret
+
+0080215d <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  80215d:	55                   	push   %ebp
+  80215e:	89 e5                	mov    %esp,%ebp
+  802160:	57                   	push   %edi
+  802161:	56                   	push   %esi
+  802162:	53                   	push   %ebx
+  802163:	83 ec 0c             	sub    $0xc,%esp
+  802166:	89 c7                	mov    %eax,%edi
+  802168:	89 d3                	mov    %edx,%ebx
+  80216a:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80216c:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802173:	74 2d                	je     8021a2 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  802175:	6a 07                	push   $0x7
+  802177:	68 00 00 81 00       	push   $0x810000
+  80217c:	57                   	push   %edi
+  80217d:	ff 35 00 80 80 00    	push   0x808000
+  802183:	e8 1b f9 ff ff       	call   801aa3 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  802188:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80218f:	6a 00                	push   $0x0
+  802191:	56                   	push   %esi
+  802192:	53                   	push   %ebx
+  802193:	6a 00                	push   $0x0
+  802195:	e8 bb f7 ff ff       	call   801955 <ipc_recv_pages>
+}
+  80219a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80219d:	5b                   	pop    %ebx
+  80219e:	5e                   	pop    %esi
+  80219f:	5f                   	pop    %edi
+  8021a0:	5d                   	pop    %ebp
+  8021a1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021a2:	83 ec 0c             	sub    $0xc,%esp
+  8021a5:	6a 01                	push   $0x1
+  8021a7:	e8 ec f9 ff ff       	call   801b98 <ipc_find_env>
+  8021ac:	a3 00 80 80 00       	mov    %eax,0x808000
+  8021b1:	83 c4 10             	add    $0x10,%esp
+  8021b4:	eb bf                	jmp    802175 <fsipc_pages+0x18>
+
+008021b6 <fsipc>:
+{
+  8021b6:	55                   	push   %ebp
+  8021b7:	89 e5                	mov    %esp,%ebp
+  8021b9:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8021bc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021c1:	e8 97 ff ff ff       	call   80215d <fsipc_pages>
+}
+  8021c6:	c9                   	leave
+  8021c7:	c3                   	ret
+
+008021c8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8021c8:	55                   	push   %ebp
+  8021c9:	89 e5                	mov    %esp,%ebp
+  8021cb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021d4:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  8021d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021dc:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8021e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e6:	b8 02 00 00 00       	mov    $0x2,%eax
+  8021eb:	e8 c6 ff ff ff       	call   8021b6 <fsipc>
+}
+  8021f0:	c9                   	leave
+  8021f1:	c3                   	ret
+
+008021f2 <devfile_flush>:
+{
+  8021f2:	55                   	push   %ebp
+  8021f3:	89 e5                	mov    %esp,%ebp
+  8021f5:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8021f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021fe:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802203:	ba 00 00 00 00       	mov    $0x0,%edx
+  802208:	b8 06 00 00 00       	mov    $0x6,%eax
+  80220d:	e8 a4 ff ff ff       	call   8021b6 <fsipc>
+}
+  802212:	c9                   	leave
+  802213:	c3                   	ret
+
+00802214 <devfile_stat>:
+{
+  802214:	55                   	push   %ebp
+  802215:	89 e5                	mov    %esp,%ebp
+  802217:	53                   	push   %ebx
+  802218:	83 ec 04             	sub    $0x4,%esp
+  80221b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80221e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802221:	8b 40 0c             	mov    0xc(%eax),%eax
+  802224:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222e:	b8 05 00 00 00       	mov    $0x5,%eax
+  802233:	e8 7e ff ff ff       	call   8021b6 <fsipc>
+  802238:	85 c0                	test   %eax,%eax
+  80223a:	78 2c                	js     802268 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80223c:	83 ec 08             	sub    $0x8,%esp
+  80223f:	68 00 00 81 00       	push   $0x810000
+  802244:	53                   	push   %ebx
+  802245:	e8 c9 e6 ff ff       	call   800913 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80224a:	a1 80 00 81 00       	mov    0x810080,%eax
+  80224f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802255:	a1 84 00 81 00       	mov    0x810084,%eax
+  80225a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802260:	83 c4 10             	add    $0x10,%esp
+  802263:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80226b:	c9                   	leave
+  80226c:	c3                   	ret
+
+0080226d <devfile_write>:
+{
+  80226d:	55                   	push   %ebp
+  80226e:	89 e5                	mov    %esp,%ebp
+  802270:	83 ec 0c             	sub    $0xc,%esp
+  802273:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  802276:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  80227b:	39 d0                	cmp    %edx,%eax
+  80227d:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802280:	8b 55 08             	mov    0x8(%ebp),%edx
+  802283:	8b 52 0c             	mov    0xc(%edx),%edx
+  802286:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  80228c:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  802291:	50                   	push   %eax
+  802292:	ff 75 0c             	push   0xc(%ebp)
+  802295:	68 08 00 81 00       	push   $0x810008
+  80229a:	e8 fa e7 ff ff       	call   800a99 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  80229f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022a9:	e8 08 ff ff ff       	call   8021b6 <fsipc>
+}
+  8022ae:	c9                   	leave
+  8022af:	c3                   	ret
+
+008022b0 <devfile_read>:
+{
+  8022b0:	55                   	push   %ebp
+  8022b1:	89 e5                	mov    %esp,%ebp
+  8022b3:	57                   	push   %edi
+  8022b4:	56                   	push   %esi
+  8022b5:	53                   	push   %ebx
+  8022b6:	83 ec 1c             	sub    $0x1c,%esp
+  8022b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022bc:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8022bf:	89 fe                	mov    %edi,%esi
+  8022c1:	c1 ee 0c             	shr    $0xc,%esi
+  8022c4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8022c9:	39 c6                	cmp    %eax,%esi
+  8022cb:	0f 47 f0             	cmova  %eax,%esi
+  8022ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022d6:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8022d9:	eb 14                	jmp    8022ef <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8022db:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8022e2:	05 00 10 00 00       	add    $0x1000,%eax
+  8022e7:	f6 c6 06             	test   $0x6,%dh
+  8022ea:	75 42                	jne    80232e <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8022ec:	83 c1 01             	add    $0x1,%ecx
+  8022ef:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8022f2:	39 f1                	cmp    %esi,%ecx
+  8022f4:	0f 84 95 00 00 00    	je     80238f <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  8022fa:	89 c2                	mov    %eax,%edx
+  8022fc:	c1 ea 16             	shr    $0x16,%edx
+  8022ff:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802306:	f6 c2 01             	test   $0x1,%dl
+  802309:	74 23                	je     80232e <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80230b:	89 c2                	mov    %eax,%edx
+  80230d:	c1 ea 0c             	shr    $0xc,%edx
+  802310:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802317:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  80231d:	74 0f                	je     80232e <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  80231f:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802326:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  80232c:	75 ad                	jne    8022db <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  80232e:	85 c9                	test   %ecx,%ecx
+  802330:	74 11                	je     802343 <devfile_read+0x93>
+  802332:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  802339:	75 08                	jne    802343 <devfile_read+0x93>
+  80233b:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802341:	74 50                	je     802393 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802343:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802346:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  80234b:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802351:	ba 00 00 00 00       	mov    $0x0,%edx
+  802356:	b8 03 00 00 00       	mov    $0x3,%eax
+  80235b:	e8 56 fe ff ff       	call   8021b6 <fsipc>
+  802360:	89 c6                	mov    %eax,%esi
+  802362:	85 c0                	test   %eax,%eax
+  802364:	78 1f                	js     802385 <devfile_read+0xd5>
+	assert(r <= n);
+  802366:	39 c7                	cmp    %eax,%edi
+  802368:	72 50                	jb     8023ba <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  80236a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80236f:	7f 62                	jg     8023d3 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802371:	83 ec 04             	sub    $0x4,%esp
+  802374:	50                   	push   %eax
+  802375:	68 00 00 81 00       	push   $0x810000
+  80237a:	ff 75 0c             	push   0xc(%ebp)
+  80237d:	e8 17 e7 ff ff       	call   800a99 <memmove>
+	return r;
+  802382:	83 c4 10             	add    $0x10,%esp
+}
+  802385:	89 f0                	mov    %esi,%eax
+  802387:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80238a:	5b                   	pop    %ebx
+  80238b:	5e                   	pop    %esi
+  80238c:	5f                   	pop    %edi
+  80238d:	5d                   	pop    %ebp
+  80238e:	c3                   	ret
+  80238f:	89 f1                	mov    %esi,%ecx
+  802391:	eb 9b                	jmp    80232e <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  802393:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802396:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  80239b:	89 c8                	mov    %ecx,%eax
+  80239d:	c1 e0 0c             	shl    $0xc,%eax
+  8023a0:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  8023a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023a8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8023ad:	e8 ab fd ff ff       	call   80215d <fsipc_pages>
+  8023b2:	89 c6                	mov    %eax,%esi
+  8023b4:	85 c0                	test   %eax,%eax
+  8023b6:	78 8b                	js     802343 <devfile_read+0x93>
+  8023b8:	eb cb                	jmp    802385 <devfile_read+0xd5>
+	assert(r <= n);
+  8023ba:	68 0c 5a 80 00       	push   $0x805a0c
+  8023bf:	68 13 5a 80 00       	push   $0x805a13
+  8023c4:	68 a0 00 00 00       	push   $0xa0
+  8023c9:	68 28 5a 80 00       	push   $0x805a28
+  8023ce:	e8 7e de ff ff       	call   800251 <_panic>
+	assert(r <= PGSIZE);
+  8023d3:	68 33 5a 80 00       	push   $0x805a33
+  8023d8:	68 13 5a 80 00       	push   $0x805a13
+  8023dd:	68 a1 00 00 00       	push   $0xa1
+  8023e2:	68 28 5a 80 00       	push   $0x805a28
+  8023e7:	e8 65 de ff ff       	call   800251 <_panic>
+
+008023ec <open>:
+{
+  8023ec:	55                   	push   %ebp
+  8023ed:	89 e5                	mov    %esp,%ebp
+  8023ef:	56                   	push   %esi
+  8023f0:	53                   	push   %ebx
+  8023f1:	83 ec 1c             	sub    $0x1c,%esp
+  8023f4:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8023f7:	56                   	push   %esi
+  8023f8:	e8 db e4 ff ff       	call   8008d8 <strlen>
+  8023fd:	83 c4 10             	add    $0x10,%esp
+  802400:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802405:	7f 6c                	jg     802473 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802407:	83 ec 0c             	sub    $0xc,%esp
+  80240a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80240d:	50                   	push   %eax
+  80240e:	e8 eb f7 ff ff       	call   801bfe <fd_alloc>
+  802413:	89 c3                	mov    %eax,%ebx
+  802415:	83 c4 10             	add    $0x10,%esp
+  802418:	85 c0                	test   %eax,%eax
+  80241a:	78 3c                	js     802458 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80241c:	83 ec 08             	sub    $0x8,%esp
+  80241f:	56                   	push   %esi
+  802420:	68 00 00 81 00       	push   $0x810000
+  802425:	e8 e9 e4 ff ff       	call   800913 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80242a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80242d:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802432:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802435:	b8 01 00 00 00       	mov    $0x1,%eax
+  80243a:	e8 77 fd ff ff       	call   8021b6 <fsipc>
+  80243f:	89 c3                	mov    %eax,%ebx
+  802441:	83 c4 10             	add    $0x10,%esp
+  802444:	85 c0                	test   %eax,%eax
+  802446:	78 19                	js     802461 <open+0x75>
+	return fd2num(fd);
+  802448:	83 ec 0c             	sub    $0xc,%esp
+  80244b:	ff 75 f4             	push   -0xc(%ebp)
+  80244e:	e8 84 f7 ff ff       	call   801bd7 <fd2num>
+  802453:	89 c3                	mov    %eax,%ebx
+  802455:	83 c4 10             	add    $0x10,%esp
+}
+  802458:	89 d8                	mov    %ebx,%eax
+  80245a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80245d:	5b                   	pop    %ebx
+  80245e:	5e                   	pop    %esi
+  80245f:	5d                   	pop    %ebp
+  802460:	c3                   	ret
+		fd_close(fd, 0);
+  802461:	83 ec 08             	sub    $0x8,%esp
+  802464:	6a 00                	push   $0x0
+  802466:	ff 75 f4             	push   -0xc(%ebp)
+  802469:	e8 80 f8 ff ff       	call   801cee <fd_close>
+		return r;
+  80246e:	83 c4 10             	add    $0x10,%esp
+  802471:	eb e5                	jmp    802458 <open+0x6c>
+		return -E_BAD_PATH;
+  802473:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802478:	eb de                	jmp    802458 <open+0x6c>
+
+0080247a <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80247a:	55                   	push   %ebp
+  80247b:	89 e5                	mov    %esp,%ebp
+  80247d:	53                   	push   %ebx
+  80247e:	83 ec 10             	sub    $0x10,%esp
+  802481:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802484:	53                   	push   %ebx
+  802485:	e8 4e e4 ff ff       	call   8008d8 <strlen>
+  80248a:	83 c4 10             	add    $0x10,%esp
+  80248d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802492:	7f 25                	jg     8024b9 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802494:	83 ec 08             	sub    $0x8,%esp
+  802497:	53                   	push   %ebx
+  802498:	68 00 00 81 00       	push   $0x810000
+  80249d:	e8 71 e4 ff ff       	call   800913 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8024a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024a7:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024ac:	e8 05 fd ff ff       	call   8021b6 <fsipc>
+  8024b1:	83 c4 10             	add    $0x10,%esp
+}
+  8024b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024b7:	c9                   	leave
+  8024b8:	c3                   	ret
+		return -E_BAD_PATH;
+  8024b9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8024be:	eb f4                	jmp    8024b4 <remove+0x3a>
+
+008024c0 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024c0:	55                   	push   %ebp
+  8024c1:	89 e5                	mov    %esp,%ebp
+  8024c3:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8024c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024cb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024d0:	e8 e1 fc ff ff       	call   8021b6 <fsipc>
+}
+  8024d5:	c9                   	leave
+  8024d6:	c3                   	ret
+
+008024d7 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  8024d7:	55                   	push   %ebp
+  8024d8:	89 e5                	mov    %esp,%ebp
+  8024da:	53                   	push   %ebx
+  8024db:	83 ec 04             	sub    $0x4,%esp
+  8024de:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8024e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024eb:	e8 c6 fc ff ff       	call   8021b6 <fsipc>
+  8024f0:	85 c0                	test   %eax,%eax
+  8024f2:	78 3c                	js     802530 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  8024f4:	a1 00 00 81 00       	mov    0x810000,%eax
+  8024f9:	89 03                	mov    %eax,(%ebx)
+  8024fb:	a1 04 00 81 00       	mov    0x810004,%eax
+  802500:	89 43 04             	mov    %eax,0x4(%ebx)
+  802503:	a1 08 00 81 00       	mov    0x810008,%eax
+  802508:	89 43 08             	mov    %eax,0x8(%ebx)
+  80250b:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  802510:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802513:	a1 10 00 81 00       	mov    0x810010,%eax
+  802518:	89 43 10             	mov    %eax,0x10(%ebx)
+  80251b:	a1 14 00 81 00       	mov    0x810014,%eax
+  802520:	89 43 14             	mov    %eax,0x14(%ebx)
+  802523:	a1 18 00 81 00       	mov    0x810018,%eax
+  802528:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80252b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802530:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802533:	c9                   	leave
+  802534:	c3                   	ret
+
+00802535 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  802535:	55                   	push   %ebp
+  802536:	89 e5                	mov    %esp,%ebp
+  802538:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80253b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80253e:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  802543:	ba 00 00 00 00       	mov    $0x0,%edx
+  802548:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80254d:	e8 64 fc ff ff       	call   8021b6 <fsipc>
+}
+  802552:	c9                   	leave
+  802553:	c3                   	ret
+
+00802554 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802554:	55                   	push   %ebp
+  802555:	89 e5                	mov    %esp,%ebp
+  802557:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80255a:	89 c2                	mov    %eax,%edx
+  80255c:	c1 ea 16             	shr    $0x16,%edx
+  80255f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  802566:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80256b:	f6 c1 01             	test   $0x1,%cl
+  80256e:	74 1e                	je     80258e <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  802570:	c1 e8 0c             	shr    $0xc,%eax
+  802573:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80257a:	a8 01                	test   $0x1,%al
+  80257c:	74 10                	je     80258e <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80257e:	c1 e8 0c             	shr    $0xc,%eax
+  802581:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802584:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  80258b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80258e:	89 d0                	mov    %edx,%eax
+  802590:	5d                   	pop    %ebp
+  802591:	c3                   	ret
+
+00802592 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802592:	55                   	push   %ebp
+  802593:	89 e5                	mov    %esp,%ebp
+  802595:	56                   	push   %esi
+  802596:	53                   	push   %ebx
+  802597:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  80259a:	83 ec 0c             	sub    $0xc,%esp
+  80259d:	ff 75 08             	push   0x8(%ebp)
+  8025a0:	e8 42 f6 ff ff       	call   801be7 <fd2data>
+  8025a5:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8025a7:	83 c4 08             	add    $0x8,%esp
+  8025aa:	68 3f 5a 80 00       	push   $0x805a3f
+  8025af:	53                   	push   %ebx
+  8025b0:	e8 5e e3 ff ff       	call   800913 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8025b5:	8b 46 04             	mov    0x4(%esi),%eax
+  8025b8:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8025be:	2b 0e                	sub    (%esi),%ecx
+  8025c0:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8025c5:	89 c8                	mov    %ecx,%eax
+  8025c7:	f7 e2                	mul    %edx
+  8025c9:	c1 ea 0c             	shr    $0xc,%edx
+  8025cc:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8025d2:	29 d1                	sub    %edx,%ecx
+  8025d4:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8025da:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025e1:	00 00 00 
+	stat->st_dev = &devpipe;
+  8025e4:	c7 83 88 00 00 00 20 	movl   $0x807020,0x88(%ebx)
+  8025eb:	70 80 00 
+	return 0;
+}
+  8025ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025f6:	5b                   	pop    %ebx
+  8025f7:	5e                   	pop    %esi
+  8025f8:	5d                   	pop    %ebp
+  8025f9:	c3                   	ret
+
+008025fa <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8025fa:	55                   	push   %ebp
+  8025fb:	89 e5                	mov    %esp,%ebp
+  8025fd:	53                   	push   %ebx
+  8025fe:	83 ec 0c             	sub    $0xc,%esp
+  802601:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802604:	53                   	push   %ebx
+  802605:	6a 00                	push   $0x0
+  802607:	e8 7f e8 ff ff       	call   800e8b <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80260c:	89 1c 24             	mov    %ebx,(%esp)
+  80260f:	e8 d3 f5 ff ff       	call   801be7 <fd2data>
+  802614:	83 c4 08             	add    $0x8,%esp
+  802617:	50                   	push   %eax
+  802618:	6a 00                	push   $0x0
+  80261a:	e8 6c e8 ff ff       	call   800e8b <sys_page_unmap>
+}
+  80261f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802622:	c9                   	leave
+  802623:	c3                   	ret
+
+00802624 <_pipeisclosed>:
+{
+  802624:	55                   	push   %ebp
+  802625:	89 e5                	mov    %esp,%ebp
+  802627:	57                   	push   %edi
+  802628:	56                   	push   %esi
+  802629:	53                   	push   %ebx
+  80262a:	83 ec 1c             	sub    $0x1c,%esp
+  80262d:	89 c7                	mov    %eax,%edi
+  80262f:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802631:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802636:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802639:	83 ec 0c             	sub    $0xc,%esp
+  80263c:	57                   	push   %edi
+  80263d:	e8 12 ff ff ff       	call   802554 <pageref>
+  802642:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802645:	89 34 24             	mov    %esi,(%esp)
+  802648:	e8 07 ff ff ff       	call   802554 <pageref>
+		nn = thisenv->env_runs;
+  80264d:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802653:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802656:	83 c4 10             	add    $0x10,%esp
+  802659:	39 cb                	cmp    %ecx,%ebx
+  80265b:	74 1b                	je     802678 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80265d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802660:	75 cf                	jne    802631 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802662:	8b 42 58             	mov    0x58(%edx),%eax
+  802665:	6a 01                	push   $0x1
+  802667:	50                   	push   %eax
+  802668:	53                   	push   %ebx
+  802669:	68 46 5a 80 00       	push   $0x805a46
+  80266e:	e8 b9 dc ff ff       	call   80032c <cprintf>
+  802673:	83 c4 10             	add    $0x10,%esp
+  802676:	eb b9                	jmp    802631 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802678:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80267b:	0f 94 c0             	sete   %al
+  80267e:	0f b6 c0             	movzbl %al,%eax
+}
+  802681:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802684:	5b                   	pop    %ebx
+  802685:	5e                   	pop    %esi
+  802686:	5f                   	pop    %edi
+  802687:	5d                   	pop    %ebp
+  802688:	c3                   	ret
+
+00802689 <devpipe_read>:
+{
+  802689:	55                   	push   %ebp
+  80268a:	89 e5                	mov    %esp,%ebp
+  80268c:	57                   	push   %edi
+  80268d:	56                   	push   %esi
+  80268e:	53                   	push   %ebx
+  80268f:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802692:	ff 75 08             	push   0x8(%ebp)
+  802695:	e8 4d f5 ff ff       	call   801be7 <fd2data>
+  80269a:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  80269c:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  80269f:	8d 40 04             	lea    0x4(%eax),%eax
+  8026a2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8026a5:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8026a8:	8b 0b                	mov    (%ebx),%ecx
+  8026aa:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8026b0:	29 ce                	sub    %ecx,%esi
+  8026b2:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8026b7:	f7 e6                	mul    %esi
+  8026b9:	c1 ea 0c             	shr    $0xc,%edx
+  8026bc:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8026c2:	29 c6                	sub    %eax,%esi
+  8026c4:	89 f2                	mov    %esi,%edx
+  8026c6:	75 43                	jne    80270b <devpipe_read+0x82>
+		ref = pageref(p);
+  8026c8:	83 ec 0c             	sub    $0xc,%esp
+  8026cb:	53                   	push   %ebx
+  8026cc:	e8 83 fe ff ff       	call   802554 <pageref>
+  8026d1:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8026d3:	89 da                	mov    %ebx,%edx
+  8026d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d8:	e8 47 ff ff ff       	call   802624 <_pipeisclosed>
+  8026dd:	83 c4 10             	add    $0x10,%esp
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	0f 85 c1 00 00 00    	jne    8027a9 <devpipe_read+0x120>
+	*sleeping = 1;
+  8026e8:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  8026ef:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  8026f4:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  8026f7:	75 ac                	jne    8026a5 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  8026f9:	83 ec 04             	sub    $0x4,%esp
+  8026fc:	56                   	push   %esi
+  8026fd:	57                   	push   %edi
+  8026fe:	ff 75 e4             	push   -0x1c(%ebp)
+  802701:	e8 d9 eb ff ff       	call   8012df <sys_futex_wait>
+  802706:	83 c4 10             	add    $0x10,%esp
+  802709:	eb 9a                	jmp    8026a5 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80270b:	39 75 10             	cmp    %esi,0x10(%ebp)
+  80270e:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802712:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802714:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802719:	f7 e1                	mul    %ecx
+  80271b:	c1 ea 0b             	shr    $0xb,%edx
+  80271e:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802724:	29 c1                	sub    %eax,%ecx
+  802726:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802728:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  80272d:	29 cf                	sub    %ecx,%edi
+  80272f:	39 f7                	cmp    %esi,%edi
+  802731:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802734:	8d 43 10             	lea    0x10(%ebx),%eax
+  802737:	83 ec 04             	sub    $0x4,%esp
+  80273a:	57                   	push   %edi
+  80273b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80273e:	01 c2                	add    %eax,%edx
+  802740:	52                   	push   %edx
+  802741:	ff 75 0c             	push   0xc(%ebp)
+  802744:	e8 50 e3 ff ff       	call   800a99 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802749:	83 c4 0c             	add    $0xc,%esp
+  80274c:	89 f1                	mov    %esi,%ecx
+  80274e:	29 f9                	sub    %edi,%ecx
+  802750:	51                   	push   %ecx
+  802751:	ff 75 e4             	push   -0x1c(%ebp)
+  802754:	89 f8                	mov    %edi,%eax
+  802756:	03 45 0c             	add    0xc(%ebp),%eax
+  802759:	50                   	push   %eax
+  80275a:	e8 3a e3 ff ff       	call   800a99 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  80275f:	89 f1                	mov    %esi,%ecx
+  802761:	03 0b                	add    (%ebx),%ecx
+  802763:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802768:	f7 e1                	mul    %ecx
+  80276a:	c1 ea 0c             	shr    $0xc,%edx
+  80276d:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802773:	29 d1                	sub    %edx,%ecx
+  802775:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802777:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  80277c:	83 c4 10             	add    $0x10,%esp
+  80277f:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802783:	75 0a                	jne    80278f <devpipe_read+0x106>
+	return n;
+  802785:	89 f0                	mov    %esi,%eax
+}
+  802787:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80278a:	5b                   	pop    %ebx
+  80278b:	5e                   	pop    %esi
+  80278c:	5f                   	pop    %edi
+  80278d:	5d                   	pop    %ebp
+  80278e:	c3                   	ret
+		*sleeping = 0;
+  80278f:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802796:	83 ec 08             	sub    $0x8,%esp
+  802799:	68 00 04 00 00       	push   $0x400
+  80279e:	53                   	push   %ebx
+  80279f:	e8 8b eb ff ff       	call   80132f <sys_futex_wake>
+  8027a4:	83 c4 10             	add    $0x10,%esp
+  8027a7:	eb dc                	jmp    802785 <devpipe_read+0xfc>
+			return 0;
+  8027a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ae:	eb d7                	jmp    802787 <devpipe_read+0xfe>
+
+008027b0 <devpipe_write>:
+{
+  8027b0:	55                   	push   %ebp
+  8027b1:	89 e5                	mov    %esp,%ebp
+  8027b3:	57                   	push   %edi
+  8027b4:	56                   	push   %esi
+  8027b5:	53                   	push   %ebx
+  8027b6:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8027b9:	ff 75 08             	push   0x8(%ebp)
+  8027bc:	e8 26 f4 ff ff       	call   801be7 <fd2data>
+  8027c1:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8027c3:	83 c4 10             	add    $0x10,%esp
+  8027c6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8027cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027d0:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8027d3:	0f 83 23 01 00 00    	jae    8028fc <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8027d9:	8b 77 04             	mov    0x4(%edi),%esi
+  8027dc:	8b 1f                	mov    (%edi),%ebx
+  8027de:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  8027e4:	29 d9                	sub    %ebx,%ecx
+  8027e6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8027eb:	f7 e1                	mul    %ecx
+  8027ed:	c1 ea 0c             	shr    $0xc,%edx
+  8027f0:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  8027f6:	29 c1                	sub    %eax,%ecx
+  8027f8:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  8027fa:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802800:	75 40                	jne    802842 <devpipe_write+0x92>
+			ref = pageref(p);
+  802802:	83 ec 0c             	sub    $0xc,%esp
+  802805:	57                   	push   %edi
+  802806:	e8 49 fd ff ff       	call   802554 <pageref>
+  80280b:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  80280d:	89 fa                	mov    %edi,%edx
+  80280f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802812:	e8 0d fe ff ff       	call   802624 <_pipeisclosed>
+  802817:	83 c4 10             	add    $0x10,%esp
+  80281a:	85 c0                	test   %eax,%eax
+  80281c:	0f 85 d5 00 00 00    	jne    8028f7 <devpipe_write+0x147>
+	*sleeping = 1;
+  802822:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802829:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  80282e:	39 1f                	cmp    %ebx,(%edi)
+  802830:	75 a7                	jne    8027d9 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802832:	83 ec 04             	sub    $0x4,%esp
+  802835:	56                   	push   %esi
+  802836:	53                   	push   %ebx
+  802837:	57                   	push   %edi
+  802838:	e8 a2 ea ff ff       	call   8012df <sys_futex_wait>
+  80283d:	83 c4 10             	add    $0x10,%esp
+  802840:	eb 97                	jmp    8027d9 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802842:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802845:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802848:	29 c1                	sub    %eax,%ecx
+  80284a:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  80284f:	89 d8                	mov    %ebx,%eax
+  802851:	29 d0                	sub    %edx,%eax
+  802853:	39 c1                	cmp    %eax,%ecx
+  802855:	0f 46 c1             	cmovbe %ecx,%eax
+  802858:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  80285a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80285f:	f7 e6                	mul    %esi
+  802861:	c1 ea 0b             	shr    $0xb,%edx
+  802864:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80286a:	29 c6                	sub    %eax,%esi
+  80286c:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  80286e:	29 f3                	sub    %esi,%ebx
+  802870:	39 cb                	cmp    %ecx,%ebx
+  802872:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802875:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802878:	8d 77 10             	lea    0x10(%edi),%esi
+  80287b:	83 ec 04             	sub    $0x4,%esp
+  80287e:	53                   	push   %ebx
+  80287f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802882:	03 45 0c             	add    0xc(%ebp),%eax
+  802885:	50                   	push   %eax
+  802886:	01 f2                	add    %esi,%edx
+  802888:	52                   	push   %edx
+  802889:	e8 0b e2 ff ff       	call   800a99 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  80288e:	83 c4 0c             	add    $0xc,%esp
+  802891:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802894:	29 d8                	sub    %ebx,%eax
+  802896:	50                   	push   %eax
+  802897:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80289a:	01 d3                	add    %edx,%ebx
+  80289c:	03 5d 0c             	add    0xc(%ebp),%ebx
+  80289f:	53                   	push   %ebx
+  8028a0:	56                   	push   %esi
+  8028a1:	e8 f3 e1 ff ff       	call   800a99 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8028a6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028a9:	03 4f 04             	add    0x4(%edi),%ecx
+  8028ac:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8028b1:	f7 e1                	mul    %ecx
+  8028b3:	c1 ea 0c             	shr    $0xc,%edx
+  8028b6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8028bc:	29 d1                	sub    %edx,%ecx
+  8028be:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8028c1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8028c6:	83 c4 10             	add    $0x10,%esp
+  8028c9:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8028cd:	75 0b                	jne    8028da <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8028cf:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8028d2:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8028d5:	e9 f3 fe ff ff       	jmp    8027cd <devpipe_write+0x1d>
+		*sleeping = 0;
+  8028da:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  8028e1:	83 ec 08             	sub    $0x8,%esp
+  8028e4:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  8028e9:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  8028ec:	50                   	push   %eax
+  8028ed:	e8 3d ea ff ff       	call   80132f <sys_futex_wake>
+  8028f2:	83 c4 10             	add    $0x10,%esp
+  8028f5:	eb d8                	jmp    8028cf <devpipe_write+0x11f>
+				return 0;
+  8028f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028ff:	5b                   	pop    %ebx
+  802900:	5e                   	pop    %esi
+  802901:	5f                   	pop    %edi
+  802902:	5d                   	pop    %ebp
+  802903:	c3                   	ret
+
+00802904 <pipe>:
+{
+  802904:	55                   	push   %ebp
+  802905:	89 e5                	mov    %esp,%ebp
+  802907:	56                   	push   %esi
+  802908:	53                   	push   %ebx
+  802909:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  80290c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80290f:	50                   	push   %eax
+  802910:	e8 e9 f2 ff ff       	call   801bfe <fd_alloc>
+  802915:	89 c3                	mov    %eax,%ebx
+  802917:	83 c4 10             	add    $0x10,%esp
+  80291a:	85 c0                	test   %eax,%eax
+  80291c:	0f 88 23 01 00 00    	js     802a45 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802922:	83 ec 04             	sub    $0x4,%esp
+  802925:	68 07 04 00 00       	push   $0x407
+  80292a:	ff 75 f4             	push   -0xc(%ebp)
+  80292d:	6a 00                	push   $0x0
+  80292f:	e8 d2 e4 ff ff       	call   800e06 <sys_page_alloc>
+  802934:	89 c3                	mov    %eax,%ebx
+  802936:	83 c4 10             	add    $0x10,%esp
+  802939:	85 c0                	test   %eax,%eax
+  80293b:	0f 88 04 01 00 00    	js     802a45 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802941:	83 ec 0c             	sub    $0xc,%esp
+  802944:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802947:	50                   	push   %eax
+  802948:	e8 b1 f2 ff ff       	call   801bfe <fd_alloc>
+  80294d:	89 c3                	mov    %eax,%ebx
+  80294f:	83 c4 10             	add    $0x10,%esp
+  802952:	85 c0                	test   %eax,%eax
+  802954:	0f 88 db 00 00 00    	js     802a35 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80295a:	83 ec 04             	sub    $0x4,%esp
+  80295d:	68 07 04 00 00       	push   $0x407
+  802962:	ff 75 f0             	push   -0x10(%ebp)
+  802965:	6a 00                	push   $0x0
+  802967:	e8 9a e4 ff ff       	call   800e06 <sys_page_alloc>
+  80296c:	89 c3                	mov    %eax,%ebx
+  80296e:	83 c4 10             	add    $0x10,%esp
+  802971:	85 c0                	test   %eax,%eax
+  802973:	0f 88 bc 00 00 00    	js     802a35 <pipe+0x131>
+	va = fd2data(fd0);
+  802979:	83 ec 0c             	sub    $0xc,%esp
+  80297c:	ff 75 f4             	push   -0xc(%ebp)
+  80297f:	e8 63 f2 ff ff       	call   801be7 <fd2data>
+  802984:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802986:	83 c4 0c             	add    $0xc,%esp
+  802989:	68 07 04 00 00       	push   $0x407
+  80298e:	50                   	push   %eax
+  80298f:	6a 00                	push   $0x0
+  802991:	e8 70 e4 ff ff       	call   800e06 <sys_page_alloc>
+  802996:	89 c3                	mov    %eax,%ebx
+  802998:	83 c4 10             	add    $0x10,%esp
+  80299b:	85 c0                	test   %eax,%eax
+  80299d:	0f 88 82 00 00 00    	js     802a25 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029a3:	83 ec 0c             	sub    $0xc,%esp
+  8029a6:	ff 75 f0             	push   -0x10(%ebp)
+  8029a9:	e8 39 f2 ff ff       	call   801be7 <fd2data>
+  8029ae:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8029b5:	50                   	push   %eax
+  8029b6:	6a 00                	push   $0x0
+  8029b8:	56                   	push   %esi
+  8029b9:	6a 00                	push   $0x0
+  8029bb:	e8 89 e4 ff ff       	call   800e49 <sys_page_map>
+  8029c0:	89 c3                	mov    %eax,%ebx
+  8029c2:	83 c4 20             	add    $0x20,%esp
+  8029c5:	85 c0                	test   %eax,%eax
+  8029c7:	78 4e                	js     802a17 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8029c9:	a1 20 70 80 00       	mov    0x807020,%eax
+  8029ce:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029d1:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8029d3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8029d6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8029dd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8029e0:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8029e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8029e5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8029ec:	83 ec 0c             	sub    $0xc,%esp
+  8029ef:	ff 75 f4             	push   -0xc(%ebp)
+  8029f2:	e8 e0 f1 ff ff       	call   801bd7 <fd2num>
+  8029f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029fa:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8029fc:	83 c4 04             	add    $0x4,%esp
+  8029ff:	ff 75 f0             	push   -0x10(%ebp)
+  802a02:	e8 d0 f1 ff ff       	call   801bd7 <fd2num>
+  802a07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a0a:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802a0d:	83 c4 10             	add    $0x10,%esp
+  802a10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a15:	eb 2e                	jmp    802a45 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802a17:	83 ec 08             	sub    $0x8,%esp
+  802a1a:	56                   	push   %esi
+  802a1b:	6a 00                	push   $0x0
+  802a1d:	e8 69 e4 ff ff       	call   800e8b <sys_page_unmap>
+  802a22:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802a25:	83 ec 08             	sub    $0x8,%esp
+  802a28:	ff 75 f0             	push   -0x10(%ebp)
+  802a2b:	6a 00                	push   $0x0
+  802a2d:	e8 59 e4 ff ff       	call   800e8b <sys_page_unmap>
+  802a32:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802a35:	83 ec 08             	sub    $0x8,%esp
+  802a38:	ff 75 f4             	push   -0xc(%ebp)
+  802a3b:	6a 00                	push   $0x0
+  802a3d:	e8 49 e4 ff ff       	call   800e8b <sys_page_unmap>
+  802a42:	83 c4 10             	add    $0x10,%esp
+}
+  802a45:	89 d8                	mov    %ebx,%eax
+  802a47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a4a:	5b                   	pop    %ebx
+  802a4b:	5e                   	pop    %esi
+  802a4c:	5d                   	pop    %ebp
+  802a4d:	c3                   	ret
+
+00802a4e <pipeisclosed>:
+{
+  802a4e:	55                   	push   %ebp
+  802a4f:	89 e5                	mov    %esp,%ebp
+  802a51:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a57:	50                   	push   %eax
+  802a58:	ff 75 08             	push   0x8(%ebp)
+  802a5b:	e8 f2 f1 ff ff       	call   801c52 <fd_lookup>
+  802a60:	83 c4 10             	add    $0x10,%esp
+  802a63:	85 c0                	test   %eax,%eax
+  802a65:	78 18                	js     802a7f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802a67:	83 ec 0c             	sub    $0xc,%esp
+  802a6a:	ff 75 f4             	push   -0xc(%ebp)
+  802a6d:	e8 75 f1 ff ff       	call   801be7 <fd2data>
+  802a72:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802a74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a77:	e8 a8 fb ff ff       	call   802624 <_pipeisclosed>
+  802a7c:	83 c4 10             	add    $0x10,%esp
+}
+  802a7f:	c9                   	leave
+  802a80:	c3                   	ret
+
+00802a81 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802a81:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802a83:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802a89:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802a8f:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802a95:	39 d0                	cmp    %edx,%eax
+  802a97:	74 2e                	je     802ac7 <segment_lookup+0x46>
+{
+  802a99:	55                   	push   %ebp
+  802a9a:	89 e5                	mov    %esp,%ebp
+  802a9c:	57                   	push   %edi
+  802a9d:	56                   	push   %esi
+  802a9e:	53                   	push   %ebx
+  802a9f:	eb 07                	jmp    802aa8 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802aa1:	83 c0 20             	add    $0x20,%eax
+  802aa4:	39 d0                	cmp    %edx,%eax
+  802aa6:	74 15                	je     802abd <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802aa8:	8b 18                	mov    (%eax),%ebx
+  802aaa:	39 d9                	cmp    %ebx,%ecx
+  802aac:	72 f3                	jb     802aa1 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802aae:	8b 38                	mov    (%eax),%edi
+  802ab0:	8b 58 04             	mov    0x4(%eax),%ebx
+  802ab3:	89 ce                	mov    %ecx,%esi
+  802ab5:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802ab7:	39 de                	cmp    %ebx,%esi
+  802ab9:	73 e6                	jae    802aa1 <segment_lookup+0x20>
+  802abb:	eb 05                	jmp    802ac2 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802abd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ac2:	5b                   	pop    %ebx
+  802ac3:	5e                   	pop    %esi
+  802ac4:	5f                   	pop    %edi
+  802ac5:	5d                   	pop    %ebp
+  802ac6:	c3                   	ret
+	return NULL;
+  802ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802acc:	c3                   	ret
+
+00802acd <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802acd:	55                   	push   %ebp
+  802ace:	89 e5                	mov    %esp,%ebp
+  802ad0:	53                   	push   %ebx
+  802ad1:	83 ec 04             	sub    $0x4,%esp
+  802ad4:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802ad6:	c1 e8 16             	shr    $0x16,%eax
+  802ad9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ae0:	25 81 00 00 00       	and    $0x81,%eax
+  802ae5:	83 f8 01             	cmp    $0x1,%eax
+  802ae8:	75 6b                	jne    802b55 <page_is_clean+0x88>
+  802aea:	89 da                	mov    %ebx,%edx
+  802aec:	c1 ea 0c             	shr    $0xc,%edx
+  802aef:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802af6:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802afb:	f6 c1 01             	test   $0x1,%cl
+  802afe:	74 5a                	je     802b5a <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802b00:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802b07:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802b0d:	75 4b                	jne    802b5a <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802b0f:	89 d8                	mov    %ebx,%eax
+  802b11:	e8 6b ff ff ff       	call   802a81 <segment_lookup>
+  802b16:	89 c2                	mov    %eax,%edx
+		return 1;
+  802b18:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802b1d:	85 d2                	test   %edx,%edx
+  802b1f:	75 39                	jne    802b5a <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802b21:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  802b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2c:	eb 03                	jmp    802b31 <page_is_clean+0x64>
+  802b2e:	83 c0 01             	add    $0x1,%eax
+  802b31:	39 c2                	cmp    %eax,%edx
+  802b33:	7e 19                	jle    802b4e <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802b35:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  802b3c:	72 f0                	jb     802b2e <page_is_clean+0x61>
+  802b3e:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  802b45:	73 e7                	jae    802b2e <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802b47:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b4c:	eb 0c                	jmp    802b5a <page_is_clean+0x8d>
+	return 0;
+  802b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b53:	eb 05                	jmp    802b5a <page_is_clean+0x8d>
+		return 0;
+  802b55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b5d:	c9                   	leave
+  802b5e:	c3                   	ret
+
+00802b5f <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802b5f:	55                   	push   %ebp
+  802b60:	89 e5                	mov    %esp,%ebp
+  802b62:	57                   	push   %edi
+  802b63:	56                   	push   %esi
+  802b64:	53                   	push   %ebx
+  802b65:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802b68:	be 00 00 00 00       	mov    $0x0,%esi
+  802b6d:	eb 19                	jmp    802b88 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802b6f:	f7 d3                	not    %ebx
+  802b71:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802b77:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802b79:	83 c6 01             	add    $0x1,%esi
+  802b7c:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802b82:	0f 87 97 00 00 00    	ja     802c1f <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802b88:	89 f3                	mov    %esi,%ebx
+  802b8a:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  802b90:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802b96:	89 d8                	mov    %ebx,%eax
+  802b98:	c1 e8 0a             	shr    $0xa,%eax
+  802b9b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ba2:	25 81 00 00 00       	and    $0x81,%eax
+  802ba7:	83 f8 01             	cmp    $0x1,%eax
+  802baa:	75 c3                	jne    802b6f <linear_walk+0x10>
+  802bac:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802bb2:	77 bb                	ja     802b6f <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802bb4:	89 df                	mov    %ebx,%edi
+  802bb6:	c1 e7 0c             	shl    $0xc,%edi
+  802bb9:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802bbc:	89 f8                	mov    %edi,%eax
+  802bbe:	e8 0a ff ff ff       	call   802acd <page_is_clean>
+  802bc3:	84 c0                	test   %al,%al
+  802bc5:	75 64                	jne    802c2b <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802bc7:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802bcd:	77 aa                	ja     802b79 <linear_walk+0x1a>
+  802bcf:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802bd5:	72 a2                	jb     802b79 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802bd7:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802bde:	a8 01                	test   $0x1,%al
+  802be0:	74 97                	je     802b79 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802be2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802be9:	f6 c4 04             	test   $0x4,%ah
+  802bec:	75 8b                	jne    802b79 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802bee:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802bf5:	f6 c4 02             	test   $0x2,%ah
+  802bf8:	0f 85 7b ff ff ff    	jne    802b79 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802bfe:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802c05:	c1 e8 0c             	shr    $0xc,%eax
+  802c08:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802c0b:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802c10:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802c14:	66 83 f8 01          	cmp    $0x1,%ax
+  802c18:	76 11                	jbe    802c2b <linear_walk+0xcc>
+  802c1a:	e9 5a ff ff ff       	jmp    802b79 <linear_walk+0x1a>
+  802c1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802c24:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802c2b:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  802c31:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c34:	83 c4 1c             	add    $0x1c,%esp
+  802c37:	5b                   	pop    %ebx
+  802c38:	5e                   	pop    %esi
+  802c39:	5f                   	pop    %edi
+  802c3a:	5d                   	pop    %ebp
+  802c3b:	c3                   	ret
+
+00802c3c <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802c3c:	55                   	push   %ebp
+  802c3d:	89 e5                	mov    %esp,%ebp
+  802c3f:	56                   	push   %esi
+  802c40:	53                   	push   %ebx
+  802c41:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802c43:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802c48:	83 e0 7f             	and    $0x7f,%eax
+  802c4b:	c1 e0 04             	shl    $0x4,%eax
+  802c4e:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802c54:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802c5a:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802c60:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  802c66:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802c6b:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802c6e:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802c73:	83 c0 01             	add    $0x1,%eax
+  802c76:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  802c7b:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  802c7e:	5b                   	pop    %ebx
+  802c7f:	5e                   	pop    %esi
+  802c80:	5d                   	pop    %ebp
+  802c81:	c3                   	ret
+
+00802c82 <page_ring_enter>:
+{
+  802c82:	55                   	push   %ebp
+  802c83:	89 e5                	mov    %esp,%ebp
+  802c85:	57                   	push   %edi
+  802c86:	56                   	push   %esi
+  802c87:	53                   	push   %ebx
+  802c88:	83 ec 18             	sub    $0x18,%esp
+  802c8b:	89 c6                	mov    %eax,%esi
+  802c8d:	89 d7                	mov    %edx,%edi
+  802c8f:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  802c91:	6a 00                	push   $0x0
+  802c93:	6a 00                	push   $0x0
+  802c95:	6a 00                	push   $0x0
+  802c97:	6a 07                	push   $0x7
+  802c99:	ff 35 40 c0 80 00    	push   0x80c040
+  802c9f:	e8 1d ee ff ff       	call   801ac1 <ipc_call>
+  802ca4:	83 c4 20             	add    $0x20,%esp
+  802ca7:	85 c0                	test   %eax,%eax
+  802ca9:	79 22                	jns    802ccd <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  802cab:	50                   	push   %eax
+  802cac:	68 5e 5a 80 00       	push   $0x805a5e
+  802cb1:	68 13 02 00 00       	push   $0x213
+  802cb6:	68 72 5a 80 00       	push   $0x805a72
+  802cbb:	e8 91 d5 ff ff       	call   800251 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  802cc0:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802cc5:	83 c0 01             	add    $0x1,%eax
+  802cc8:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802ccd:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802cd3:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802cd8:	39 c2                	cmp    %eax,%edx
+  802cda:	74 24                	je     802d00 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802cdc:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802ce1:	83 e0 7f             	and    $0x7f,%eax
+  802ce4:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802ceb:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802cf2:	29 f0                	sub    %esi,%eax
+  802cf4:	39 d8                	cmp    %ebx,%eax
+  802cf6:	73 c8                	jae    802cc0 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802cf8:	8b 52 04             	mov    0x4(%edx),%edx
+  802cfb:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802cfe:	eb c0                	jmp    802cc0 <page_ring_enter+0x3e>
+}
+  802d00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d03:	5b                   	pop    %ebx
+  802d04:	5e                   	pop    %esi
+  802d05:	5f                   	pop    %edi
+  802d06:	5d                   	pop    %ebp
+  802d07:	c3                   	ret
+
+00802d08 <page_ring_reserve>:
+{
+  802d08:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802d0a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802d0f:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802d15:	29 d0                	sub    %edx,%eax
+  802d17:	ba 80 00 00 00       	mov    $0x80,%edx
+  802d1c:	29 ca                	sub    %ecx,%edx
+  802d1e:	39 c2                	cmp    %eax,%edx
+  802d20:	72 01                	jb     802d23 <page_ring_reserve+0x1b>
+  802d22:	c3                   	ret
+{
+  802d23:	55                   	push   %ebp
+  802d24:	89 e5                	mov    %esp,%ebp
+  802d26:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802d29:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d38:	e8 45 ff ff ff       	call   802c82 <page_ring_enter>
+}
+  802d3d:	c9                   	leave
+  802d3e:	c3                   	ret
+
+00802d3f <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802d3f:	55                   	push   %ebp
+  802d40:	89 e5                	mov    %esp,%ebp
+  802d42:	53                   	push   %ebx
+  802d43:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802d46:	6a 07                	push   $0x7
+  802d48:	6a 01                	push   $0x1
+  802d4a:	89 c3                	mov    %eax,%ebx
+  802d4c:	c1 e3 0c             	shl    $0xc,%ebx
+  802d4f:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802d55:	52                   	push   %edx
+  802d56:	6a 04                	push   $0x4
+  802d58:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802d5f:	e8 5d ed ff ff       	call   801ac1 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802d64:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802d6b:	00 00 00 
+	return r;
+}
+  802d6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d71:	c9                   	leave
+  802d72:	c3                   	ret
+
+00802d73 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802d73:	55                   	push   %ebp
+  802d74:	89 e5                	mov    %esp,%ebp
+  802d76:	56                   	push   %esi
+  802d77:	53                   	push   %ebx
+  802d78:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802d7a:	c1 e8 10             	shr    $0x10,%eax
+  802d7d:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802d80:	89 c2                	mov    %eax,%edx
+  802d82:	c1 e2 0c             	shl    $0xc,%edx
+  802d85:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802d8b:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802d8e:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802d94:	89 c2                	mov    %eax,%edx
+  802d96:	c1 e2 0a             	shl    $0xa,%edx
+  802d99:	01 f2                	add    %esi,%edx
+  802d9b:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802da2:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802da8:	74 09                	je     802db3 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802daa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802daf:	5b                   	pop    %ebx
+  802db0:	5e                   	pop    %esi
+  802db1:	5d                   	pop    %ebp
+  802db2:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802db3:	e8 87 ff ff ff       	call   802d3f <page_share_send>
+  802db8:	eb f5                	jmp    802daf <page_share_slot+0x3c>
+
+00802dba <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802dba:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802dbf:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802dc2:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802dc7:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802dcd:	74 09                	je     802dd8 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802dcf:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802dd4:	85 c0                	test   %eax,%eax
+  802dd6:	75 01                	jne    802dd9 <page_ring_ready+0x1f>
+}
+  802dd8:	c3                   	ret
+{
+  802dd9:	55                   	push   %ebp
+  802dda:	89 e5                	mov    %esp,%ebp
+  802ddc:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802ddf:	68 07 06 00 00       	push   $0x607
+  802de4:	6a 08                	push   $0x8
+  802de6:	68 00 30 ad de       	push   $0xdead3000
+  802deb:	6a 00                	push   $0x0
+  802ded:	e8 3f e1 ff ff       	call   800f31 <sys_page_alloc_range>
+  802df2:	83 c4 10             	add    $0x10,%esp
+  802df5:	83 f8 08             	cmp    $0x8,%eax
+  802df8:	74 1b                	je     802e15 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802dfa:	83 ec 04             	sub    $0x4,%esp
+  802dfd:	6a 08                	push   $0x8
+  802dff:	68 00 30 ad de       	push   $0xdead3000
+  802e04:	6a 00                	push   $0x0
+  802e06:	e8 94 e1 ff ff       	call   800f9f <sys_page_unmap_range>
+		return 0;
+  802e0b:	83 c4 10             	add    $0x10,%esp
+  802e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e13:	c9                   	leave
+  802e14:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802e15:	83 ec 0c             	sub    $0xc,%esp
+  802e18:	68 07 04 00 00       	push   $0x407
+  802e1d:	6a 08                	push   $0x8
+  802e1f:	68 00 30 ad de       	push   $0xdead3000
+  802e24:	6a 06                	push   $0x6
+  802e26:	ff 35 40 c0 80 00    	push   0x80c040
+  802e2c:	e8 90 ec ff ff       	call   801ac1 <ipc_call>
+  802e31:	83 c4 20             	add    $0x20,%esp
+  802e34:	85 c0                	test   %eax,%eax
+  802e36:	78 14                	js     802e4c <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802e38:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802e3d:	8b 40 48             	mov    0x48(%eax),%eax
+  802e40:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  802e45:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e4a:	eb c7                	jmp    802e13 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802e4c:	83 ec 04             	sub    $0x4,%esp
+  802e4f:	6a 08                	push   $0x8
+  802e51:	68 00 30 ad de       	push   $0xdead3000
+  802e56:	6a 00                	push   $0x0
+  802e58:	e8 42 e1 ff ff       	call   800f9f <sys_page_unmap_range>
+		return 0;
+  802e5d:	83 c4 10             	add    $0x10,%esp
+  802e60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e65:	eb ac                	jmp    802e13 <page_ring_ready+0x59>
+
+00802e67 <page_remove_slot>:
+{
+  802e67:	55                   	push   %ebp
+  802e68:	89 e5                	mov    %esp,%ebp
+  802e6a:	56                   	push   %esi
+  802e6b:	53                   	push   %ebx
+  802e6c:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802e6e:	89 c6                	mov    %eax,%esi
+  802e70:	c1 ee 10             	shr    $0x10,%esi
+  802e73:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802e76:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  802e7d:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  802e83:	74 2a                	je     802eaf <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802e85:	83 ec 0c             	sub    $0xc,%esp
+  802e88:	6a 00                	push   $0x0
+  802e8a:	6a 00                	push   $0x0
+  802e8c:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802e8e:	c1 e3 04             	shl    $0x4,%ebx
+  802e91:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802e94:	53                   	push   %ebx
+  802e95:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  802e9c:	e8 20 ec ff ff       	call   801ac1 <ipc_call>
+  802ea1:	83 c4 20             	add    $0x20,%esp
+  802ea4:	85 c0                	test   %eax,%eax
+  802ea6:	78 2d                	js     802ed5 <page_remove_slot+0x6e>
+}
+  802ea8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802eab:	5b                   	pop    %ebx
+  802eac:	5e                   	pop    %esi
+  802ead:	5d                   	pop    %ebp
+  802eae:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802eaf:	e8 06 ff ff ff       	call   802dba <page_ring_ready>
+  802eb4:	85 c0                	test   %eax,%eax
+  802eb6:	74 cd                	je     802e85 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802eb8:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ebd:	e8 46 fe ff ff       	call   802d08 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802ec2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ec7:	89 da                	mov    %ebx,%edx
+  802ec9:	b8 02 00 00 00       	mov    $0x2,%eax
+  802ece:	e8 69 fd ff ff       	call   802c3c <page_ring_post>
+		return;
+  802ed3:	eb d3                	jmp    802ea8 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802ed5:	50                   	push   %eax
+  802ed6:	68 cc 5a 80 00       	push   $0x805acc
+  802edb:	68 ac 03 00 00       	push   $0x3ac
+  802ee0:	68 72 5a 80 00       	push   $0x805a72
+  802ee5:	e8 67 d3 ff ff       	call   800251 <_panic>
+
+00802eea <find_paging_env>:
+	if(pagingenv)
+  802eea:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802eef:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802ef1:	85 c0                	test   %eax,%eax
+  802ef3:	74 05                	je     802efa <find_paging_env+0x10>
+  802ef5:	eb 56                	jmp    802f4d <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802ef7:	83 c0 01             	add    $0x1,%eax
+  802efa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802eff:	7f 47                	jg     802f48 <find_paging_env+0x5e>
+  802f01:	83 f9 01             	cmp    $0x1,%ecx
+  802f04:	7f 42                	jg     802f48 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802f06:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802f09:	c1 e2 06             	shl    $0x6,%edx
+  802f0c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f12:	8b 52 50             	mov    0x50(%edx),%edx
+  802f15:	83 fa 02             	cmp    $0x2,%edx
+  802f18:	75 dd                	jne    802ef7 <find_paging_env+0xd>
+  802f1a:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802f1d:	c1 e2 06             	shl    $0x6,%edx
+  802f20:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f26:	8b 52 54             	mov    0x54(%edx),%edx
+  802f29:	85 d2                	test   %edx,%edx
+  802f2b:	74 ca                	je     802ef7 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802f2d:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802f30:	c1 e2 06             	shl    $0x6,%edx
+  802f33:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802f39:	8b 52 48             	mov    0x48(%edx),%edx
+  802f3c:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  802f43:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802f46:	eb af                	jmp    802ef7 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802f48:	83 f9 02             	cmp    $0x2,%ecx
+  802f4b:	74 01                	je     802f4e <find_paging_env+0x64>
+}
+  802f4d:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802f4e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802f53:	8b 40 48             	mov    0x48(%eax),%eax
+  802f56:	83 e0 01             	and    $0x1,%eax
+  802f59:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  802f60:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  802f65:	eb e6                	jmp    802f4d <find_paging_env+0x63>
+
+00802f67 <page_add_backed>:
+{
+  802f67:	55                   	push   %ebp
+  802f68:	89 e5                	mov    %esp,%ebp
+  802f6a:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802f6d:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  802f72:	83 f8 04             	cmp    $0x4,%eax
+  802f75:	74 35                	je     802fac <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802f77:	89 d1                	mov    %edx,%ecx
+  802f79:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802f7f:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802f86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f89:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802f90:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802f96:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  802f9d:	83 c0 01             	add    $0x1,%eax
+  802fa0:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  802fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802faa:	5d                   	pop    %ebp
+  802fab:	c3                   	ret
+		return -E_NO_MEM;
+  802fac:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802fb1:	eb f7                	jmp    802faa <page_add_backed+0x43>
+
+00802fb3 <percentage_of_pgdir_to_walk>:
+{
+  802fb3:	55                   	push   %ebp
+  802fb4:	89 e5                	mov    %esp,%ebp
+  802fb6:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802fb9:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802fbd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802fc0:	db 45 fc             	fildl  -0x4(%ebp)
+  802fc3:	d8 35 58 5f 80 00    	fdivs  0x805f58
+	return ret*ret;
+  802fc9:	d8 c8                	fmul   %st(0),%st
+}
+  802fcb:	c9                   	leave
+  802fcc:	c3                   	ret
+
+00802fcd <nfu_with_aging_page_choice_func>:
+{
+  802fcd:	55                   	push   %ebp
+  802fce:	89 e5                	mov    %esp,%ebp
+  802fd0:	57                   	push   %edi
+  802fd1:	56                   	push   %esi
+  802fd2:	53                   	push   %ebx
+  802fd3:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802fd6:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  802fdc:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802fde:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802fe3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fe8:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802fef:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff4:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802ff7:	eb 18                	jmp    803011 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802ff9:	f7 d0                	not    %eax
+  802ffb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803000:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803002:	83 c2 01             	add    $0x1,%edx
+  803005:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80300b:	0f 87 13 01 00 00    	ja     803124 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  803011:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803015:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  803018:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80301d:	89 c1                	mov    %eax,%ecx
+  80301f:	c1 e9 0a             	shr    $0xa,%ecx
+  803022:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803029:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80302f:	83 f9 01             	cmp    $0x1,%ecx
+  803032:	75 c5                	jne    802ff9 <nfu_with_aging_page_choice_func+0x2c>
+  803034:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803039:	77 be                	ja     802ff9 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  80303b:	89 c1                	mov    %eax,%ecx
+  80303d:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803040:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  803046:	0f 82 a5 00 00 00    	jb     8030f1 <nfu_with_aging_page_choice_func+0x124>
+  80304c:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803052:	0f 87 99 00 00 00    	ja     8030f1 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803058:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80305f:	f6 c1 01             	test   $0x1,%cl
+  803062:	0f 84 89 00 00 00    	je     8030f1 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803068:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80306f:	f6 c5 04             	test   $0x4,%ch
+  803072:	75 7d                	jne    8030f1 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803074:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80307b:	f6 c5 02             	test   $0x2,%ch
+  80307e:	75 71                	jne    8030f1 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803080:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803087:	c1 e9 0c             	shr    $0xc,%ecx
+  80308a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80308d:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803093:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803097:	66 83 f9 01          	cmp    $0x1,%cx
+  80309b:	77 54                	ja     8030f1 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  80309d:	89 f9                	mov    %edi,%ecx
+  80309f:	80 f9 ff             	cmp    $0xff,%cl
+  8030a2:	74 21                	je     8030c5 <nfu_with_aging_page_choice_func+0xf8>
+  8030a4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8030ab:	c1 e9 0c             	shr    $0xc,%ecx
+  8030ae:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8030b1:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8030b7:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  8030bb:	89 fb                	mov    %edi,%ebx
+  8030bd:	38 d9                	cmp    %bl,%cl
+  8030bf:	73 30                	jae    8030f1 <nfu_with_aging_page_choice_func+0x124>
+  8030c1:	dd d8                	fstp   %st(0)
+  8030c3:	eb 02                	jmp    8030c7 <nfu_with_aging_page_choice_func+0xfa>
+  8030c5:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  8030c7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8030ce:	c1 e9 0c             	shr    $0xc,%ecx
+  8030d1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8030d4:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8030db:	89 fb                	mov    %edi,%ebx
+  8030dd:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8030e0:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8030e3:	db 45 e0             	fildl  -0x20(%ebp)
+  8030e6:	d8 35 58 5f 80 00    	fdivs  0x805f58
+	return ret*ret;
+  8030ec:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8030ee:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8030f1:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  8030f4:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  8030f7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8030fe:	df 6d e0             	fildll -0x20(%ebp)
+  803101:	d9 c1                	fld    %st(1)
+  803103:	d8 0d 5c 5f 80 00    	fmuls  0x805f5c
+  803109:	d9 c9                	fxch   %st(1)
+  80310b:	df f1                	fcomip %st(1),%st
+  80310d:	dd d8                	fstp   %st(0)
+  80310f:	0f 82 ed fe ff ff    	jb     803002 <nfu_with_aging_page_choice_func+0x35>
+  803115:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803117:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  80311c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80311f:	c1 e0 0c             	shl    $0xc,%eax
+  803122:	eb 0e                	jmp    803132 <nfu_with_aging_page_choice_func+0x165>
+  803124:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803126:	89 f8                	mov    %edi,%eax
+  803128:	3c ff                	cmp    $0xff,%al
+  80312a:	74 0e                	je     80313a <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  80312c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80312f:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803132:	83 c4 14             	add    $0x14,%esp
+  803135:	5b                   	pop    %ebx
+  803136:	5e                   	pop    %esi
+  803137:	5f                   	pop    %edi
+  803138:	5d                   	pop    %ebp
+  803139:	c3                   	ret
+	pgnum = 0;
+  80313a:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  803141:	00 00 00 
+	return (void*)UTOP;
+  803144:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803149:	eb e7                	jmp    803132 <nfu_with_aging_page_choice_func+0x165>
+
+0080314b <myRand>:
+    state = state * 1664525 + 1013904223;
+  80314b:	69 05 40 70 80 00 0d 	imul   $0x19660d,0x807040,%eax
+  803152:	66 19 00 
+  803155:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  80315a:	a3 40 70 80 00       	mov    %eax,0x807040
+    return state >> 24;
+  80315f:	c1 e8 18             	shr    $0x18,%eax
+}
+  803162:	c3                   	ret
+
+00803163 <random_page_choice_func>:
+{
+  803163:	55                   	push   %ebp
+  803164:	89 e5                	mov    %esp,%ebp
+  803166:	57                   	push   %edi
+  803167:	56                   	push   %esi
+  803168:	53                   	push   %ebx
+  803169:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80316c:	be 00 00 00 00       	mov    $0x0,%esi
+  803171:	eb 19                	jmp    80318c <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803173:	f7 d3                	not    %ebx
+  803175:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80317b:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80317d:	83 c6 01             	add    $0x1,%esi
+  803180:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  803186:	0f 87 a0 00 00 00    	ja     80322c <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80318c:	89 f3                	mov    %esi,%ebx
+  80318e:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  803194:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80319a:	89 d8                	mov    %ebx,%eax
+  80319c:	c1 e8 0a             	shr    $0xa,%eax
+  80319f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8031a6:	25 81 00 00 00       	and    $0x81,%eax
+  8031ab:	83 f8 01             	cmp    $0x1,%eax
+  8031ae:	75 c3                	jne    803173 <random_page_choice_func+0x10>
+  8031b0:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8031b6:	77 bb                	ja     803173 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8031b8:	89 df                	mov    %ebx,%edi
+  8031ba:	c1 e7 0c             	shl    $0xc,%edi
+  8031bd:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8031c0:	89 f8                	mov    %edi,%eax
+  8031c2:	e8 06 f9 ff ff       	call   802acd <page_is_clean>
+  8031c7:	84 c0                	test   %al,%al
+  8031c9:	0f 85 82 00 00 00    	jne    803251 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8031cf:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  8031d5:	72 a6                	jb     80317d <random_page_choice_func+0x1a>
+  8031d7:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8031dd:	77 9e                	ja     80317d <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8031df:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8031e6:	a8 01                	test   $0x1,%al
+  8031e8:	74 93                	je     80317d <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031ea:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8031f1:	f6 c4 04             	test   $0x4,%ah
+  8031f4:	75 87                	jne    80317d <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8031f6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8031fd:	f6 c4 02             	test   $0x2,%ah
+  803200:	0f 85 77 ff ff ff    	jne    80317d <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803206:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80320d:	c1 e8 0c             	shr    $0xc,%eax
+  803210:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803213:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803218:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80321c:	66 83 f8 01          	cmp    $0x1,%ax
+  803220:	0f 87 57 ff ff ff    	ja     80317d <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  803226:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80322c:	e8 1a ff ff ff       	call   80314b <myRand>
+  803231:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  803237:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  80323c:	29 fe                	sub    %edi,%esi
+  80323e:	0f be c0             	movsbl %al,%eax
+  803241:	ba 00 00 00 00       	mov    $0x0,%edx
+  803246:	f7 f6                	div    %esi
+  803248:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  80324a:	bb 15 00 00 00       	mov    $0x15,%ebx
+  80324f:	eb 1c                	jmp    80326d <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  803251:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  803257:	e9 8f 00 00 00       	jmp    8032eb <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80325c:	e8 ea fe ff ff       	call   80314b <myRand>
+  803261:	0f be c0             	movsbl %al,%eax
+  803264:	ba 00 00 00 00       	mov    $0x0,%edx
+  803269:	f7 f6                	div    %esi
+  80326b:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  80326d:	83 eb 01             	sub    $0x1,%ebx
+  803270:	0f 84 c2 00 00 00    	je     803338 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  803276:	89 d0                	mov    %edx,%eax
+  803278:	c1 e8 0a             	shr    $0xa,%eax
+  80327b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803282:	25 81 00 00 00       	and    $0x81,%eax
+  803287:	83 f8 01             	cmp    $0x1,%eax
+  80328a:	75 d0                	jne    80325c <random_page_choice_func+0xf9>
+  80328c:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  803292:	77 c8                	ja     80325c <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  803294:	89 d0                	mov    %edx,%eax
+  803296:	c1 e0 0c             	shl    $0xc,%eax
+  803299:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  80329e:	72 56                	jb     8032f6 <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032a0:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8032a5:	77 65                	ja     80330c <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8032a7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032ae:	f6 c1 01             	test   $0x1,%cl
+  8032b1:	74 59                	je     80330c <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8032b3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8032ba:	f6 c5 04             	test   $0x4,%ch
+  8032bd:	75 4d                	jne    80330c <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  8032bf:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8032c6:	f6 c5 02             	test   $0x2,%ch
+  8032c9:	75 41                	jne    80330c <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  8032cb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8032d2:	c1 ea 0c             	shr    $0xc,%edx
+  8032d5:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8032d8:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  8032de:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  8032e2:	66 83 fa 01          	cmp    $0x1,%dx
+  8032e6:	77 3a                	ja     803322 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  8032e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  8032eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032ee:	83 c4 1c             	add    $0x1c,%esp
+  8032f1:	5b                   	pop    %ebx
+  8032f2:	5e                   	pop    %esi
+  8032f3:	5f                   	pop    %edi
+  8032f4:	5d                   	pop    %ebp
+  8032f5:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  8032f6:	e8 50 fe ff ff       	call   80314b <myRand>
+  8032fb:	0f be c0             	movsbl %al,%eax
+  8032fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803303:	f7 f6                	div    %esi
+  803305:	01 fa                	add    %edi,%edx
+			continue;
+  803307:	e9 61 ff ff ff       	jmp    80326d <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  80330c:	e8 3a fe ff ff       	call   80314b <myRand>
+  803311:	0f be c0             	movsbl %al,%eax
+  803314:	ba 00 00 00 00       	mov    $0x0,%edx
+  803319:	f7 f6                	div    %esi
+  80331b:	01 fa                	add    %edi,%edx
+			continue;
+  80331d:	e9 4b ff ff ff       	jmp    80326d <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803322:	e8 24 fe ff ff       	call   80314b <myRand>
+  803327:	0f be c0             	movsbl %al,%eax
+  80332a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80332f:	f7 f6                	div    %esi
+  803331:	01 fa                	add    %edi,%edx
+			continue;
+  803333:	e9 35 ff ff ff       	jmp    80326d <random_page_choice_func+0x10a>
+	pgnum = 0;
+  803338:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  80333f:	00 00 00 
+	return (void*)UTOP;
+  803342:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803349:	eb a0                	jmp    8032eb <random_page_choice_func+0x188>
+
+0080334b <nfu>:
+{
+  80334b:	55                   	push   %ebp
+  80334c:	89 e5                	mov    %esp,%ebp
+  80334e:	57                   	push   %edi
+  80334f:	56                   	push   %esi
+  803350:	53                   	push   %ebx
+  803351:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803354:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  80335a:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  80335c:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803361:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803366:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80336d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803372:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803375:	eb 18                	jmp    80338f <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803377:	f7 d0                	not    %eax
+  803379:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80337e:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803380:	83 c2 01             	add    $0x1,%edx
+  803383:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803389:	0f 87 13 01 00 00    	ja     8034a2 <nfu+0x157>
+		++num_searched_ptes;
+  80338f:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803393:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  803396:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  80339b:	89 c1                	mov    %eax,%ecx
+  80339d:	c1 e9 0a             	shr    $0xa,%ecx
+  8033a0:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8033a7:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8033ad:	83 f9 01             	cmp    $0x1,%ecx
+  8033b0:	75 c5                	jne    803377 <nfu+0x2c>
+  8033b2:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8033b7:	77 be                	ja     803377 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8033b9:	89 c1                	mov    %eax,%ecx
+  8033bb:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8033be:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  8033c4:	0f 82 a5 00 00 00    	jb     80346f <nfu+0x124>
+  8033ca:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8033d0:	0f 87 99 00 00 00    	ja     80346f <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8033d6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8033dd:	f6 c1 01             	test   $0x1,%cl
+  8033e0:	0f 84 89 00 00 00    	je     80346f <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8033e6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8033ed:	f6 c5 04             	test   $0x4,%ch
+  8033f0:	75 7d                	jne    80346f <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8033f2:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8033f9:	f6 c5 02             	test   $0x2,%ch
+  8033fc:	75 71                	jne    80346f <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8033fe:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803405:	c1 e9 0c             	shr    $0xc,%ecx
+  803408:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80340b:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803411:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803415:	66 83 f9 01          	cmp    $0x1,%cx
+  803419:	77 54                	ja     80346f <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  80341b:	89 f9                	mov    %edi,%ecx
+  80341d:	80 f9 ff             	cmp    $0xff,%cl
+  803420:	74 21                	je     803443 <nfu+0xf8>
+  803422:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803429:	c1 e9 0c             	shr    $0xc,%ecx
+  80342c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80342f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803435:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803439:	89 fb                	mov    %edi,%ebx
+  80343b:	38 d9                	cmp    %bl,%cl
+  80343d:	73 30                	jae    80346f <nfu+0x124>
+  80343f:	dd d8                	fstp   %st(0)
+  803441:	eb 02                	jmp    803445 <nfu+0xfa>
+  803443:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803445:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80344c:	c1 e9 0c             	shr    $0xc,%ecx
+  80344f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803452:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803459:	89 fb                	mov    %edi,%ebx
+  80345b:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  80345e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803461:	db 45 e0             	fildl  -0x20(%ebp)
+  803464:	d8 35 58 5f 80 00    	fdivs  0x805f58
+	return ret*ret;
+  80346a:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80346c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80346f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803472:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803475:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80347c:	df 6d e0             	fildll -0x20(%ebp)
+  80347f:	d9 c1                	fld    %st(1)
+  803481:	d8 0d 5c 5f 80 00    	fmuls  0x805f5c
+  803487:	d9 c9                	fxch   %st(1)
+  803489:	df f1                	fcomip %st(1),%st
+  80348b:	dd d8                	fstp   %st(0)
+  80348d:	0f 82 ed fe ff ff    	jb     803380 <nfu+0x35>
+  803493:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803495:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  80349a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80349d:	c1 e0 0c             	shl    $0xc,%eax
+  8034a0:	eb 0e                	jmp    8034b0 <nfu+0x165>
+  8034a2:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8034a4:	89 f8                	mov    %edi,%eax
+  8034a6:	3c ff                	cmp    $0xff,%al
+  8034a8:	74 0e                	je     8034b8 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8034aa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8034ad:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8034b0:	83 c4 14             	add    $0x14,%esp
+  8034b3:	5b                   	pop    %ebx
+  8034b4:	5e                   	pop    %esi
+  8034b5:	5f                   	pop    %edi
+  8034b6:	5d                   	pop    %ebp
+  8034b7:	c3                   	ret
+	pgnum = 0;
+  8034b8:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  8034bf:	00 00 00 
+	return (void*)UTOP;
+  8034c2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8034c7:	eb e7                	jmp    8034b0 <nfu+0x165>
+
+008034c9 <lru>:
+{
+  8034c9:	55                   	push   %ebp
+  8034ca:	89 e5                	mov    %esp,%ebp
+  8034cc:	57                   	push   %edi
+  8034cd:	56                   	push   %esi
+  8034ce:	53                   	push   %ebx
+  8034cf:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8034d2:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  8034d8:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  8034df:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8034e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8034eb:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8034f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034f7:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  8034fa:	eb 18                	jmp    803514 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8034fc:	f7 d0                	not    %eax
+  8034fe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803503:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803505:	83 c2 01             	add    $0x1,%edx
+  803508:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  80350e:	0f 87 fa 00 00 00    	ja     80360e <lru+0x145>
+		++num_searched_ptes;
+  803514:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803517:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80351a:	01 d0                	add    %edx,%eax
+  80351c:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803521:	89 c1                	mov    %eax,%ecx
+  803523:	c1 e9 0a             	shr    $0xa,%ecx
+  803526:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  80352d:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803533:	83 f9 01             	cmp    $0x1,%ecx
+  803536:	75 c4                	jne    8034fc <lru+0x33>
+  803538:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  80353d:	77 bd                	ja     8034fc <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  80353f:	89 c1                	mov    %eax,%ecx
+  803541:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803544:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80354a:	0f 87 92 00 00 00    	ja     8035e2 <lru+0x119>
+  803550:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  803556:	0f 82 86 00 00 00    	jb     8035e2 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80355c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803563:	f6 c1 01             	test   $0x1,%cl
+  803566:	74 7a                	je     8035e2 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803568:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80356f:	f6 c5 04             	test   $0x4,%ch
+  803572:	75 6e                	jne    8035e2 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803574:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80357b:	f6 c5 02             	test   $0x2,%ch
+  80357e:	75 62                	jne    8035e2 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803580:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803587:	c1 e9 0c             	shr    $0xc,%ecx
+  80358a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80358d:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803593:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803597:	66 83 f9 01          	cmp    $0x1,%cx
+  80359b:	77 45                	ja     8035e2 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  80359d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8035a4:	c1 e9 0c             	shr    $0xc,%ecx
+  8035a7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8035aa:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8035b0:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8035b3:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8035b6:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8035b9:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8035bc:	19 df                	sbb    %ebx,%edi
+  8035be:	7c 22                	jl     8035e2 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8035c0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8035c7:	c1 e9 0c             	shr    $0xc,%ecx
+  8035ca:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8035cd:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8035d3:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8035d6:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8035d9:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  8035dc:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8035df:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  8035e2:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  8035e5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8035ec:	df 6d e0             	fildll -0x20(%ebp)
+  8035ef:	d9 05 5c 5f 80 00    	flds   0x805f5c
+  8035f5:	d9 c9                	fxch   %st(1)
+  8035f7:	df f1                	fcomip %st(1),%st
+  8035f9:	dd d8                	fstp   %st(0)
+  8035fb:	0f 82 04 ff ff ff    	jb     803505 <lru+0x3c>
+			pgnum = pgnum_actual;
+  803601:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  803606:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803609:	c1 e0 0c             	shl    $0xc,%eax
+  80360c:	eb 06                	jmp    803614 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  80360e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803611:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803614:	83 c4 1c             	add    $0x1c,%esp
+  803617:	5b                   	pop    %ebx
+  803618:	5e                   	pop    %esi
+  803619:	5f                   	pop    %edi
+  80361a:	5d                   	pop    %ebp
+  80361b:	c3                   	ret
+
+0080361c <set_page_choice_func>:
+{
+  80361c:	55                   	push   %ebp
+  80361d:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  80361f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803622:	a3 3c 70 80 00       	mov    %eax,0x80703c
+}
+  803627:	5d                   	pop    %ebp
+  803628:	c3                   	ret
+
+00803629 <get_page_choice>:
+{
+  803629:	55                   	push   %ebp
+  80362a:	89 e5                	mov    %esp,%ebp
+  80362c:	57                   	push   %edi
+  80362d:	56                   	push   %esi
+  80362e:	53                   	push   %ebx
+  80362f:	83 ec 24             	sub    $0x24,%esp
+  803632:	8b 75 08             	mov    0x8(%ebp),%esi
+  803635:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  803638:	57                   	push   %edi
+  803639:	56                   	push   %esi
+  80363a:	ff 15 3c 70 80 00    	call   *0x80703c
+  803640:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803642:	83 c4 10             	add    $0x10,%esp
+  803645:	eb 25                	jmp    80366c <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803647:	83 ec 08             	sub    $0x8,%esp
+  80364a:	c1 e0 16             	shl    $0x16,%eax
+  80364d:	50                   	push   %eax
+  80364e:	6a 00                	push   $0x0
+  803650:	e8 78 d8 ff ff       	call   800ecd <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803655:	83 c4 10             	add    $0x10,%esp
+  803658:	85 c0                	test   %eax,%eax
+  80365a:	75 43                	jne    80369f <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  80365c:	83 ec 08             	sub    $0x8,%esp
+  80365f:	57                   	push   %edi
+  803660:	56                   	push   %esi
+  803661:	ff 15 3c 70 80 00    	call   *0x80703c
+  803667:	89 c3                	mov    %eax,%ebx
+  803669:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  80366c:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  80366f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803675:	0f 86 ae 00 00 00    	jbe    803729 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80367b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803680:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803687:	81 e2 81 00 00 00    	and    $0x81,%edx
+  80368d:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803693:	74 b2                	je     803647 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803695:	83 c0 01             	add    $0x1,%eax
+  803698:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  80369d:	75 e1                	jne    803680 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  80369f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036a2:	05 00 10 40 11       	add    $0x11401000,%eax
+  8036a7:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8036ac:	76 1f                	jbe    8036cd <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8036ae:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8036b3:	89 d8                	mov    %ebx,%eax
+  8036b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036b8:	5b                   	pop    %ebx
+  8036b9:	5e                   	pop    %esi
+  8036ba:	5f                   	pop    %edi
+  8036bb:	5d                   	pop    %ebp
+  8036bc:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8036bd:	83 ec 08             	sub    $0x8,%esp
+  8036c0:	53                   	push   %ebx
+  8036c1:	6a 00                	push   $0x0
+  8036c3:	e8 05 d8 ff ff       	call   800ecd <sys_page_split>
+  8036c8:	83 c4 10             	add    $0x10,%esp
+  8036cb:	eb 6c                	jmp    803739 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  8036cd:	83 ec 04             	sub    $0x4,%esp
+  8036d0:	68 04 5b 80 00       	push   $0x805b04
+  8036d5:	68 cc 01 00 00       	push   $0x1cc
+  8036da:	68 72 5a 80 00       	push   $0x805a72
+  8036df:	e8 6d cb ff ff       	call   800251 <_panic>
+		panic("We tried to page out code pages\n");
+  8036e4:	83 ec 04             	sub    $0x4,%esp
+  8036e7:	68 34 5b 80 00       	push   $0x805b34
+  8036ec:	68 d6 01 00 00       	push   $0x1d6
+  8036f1:	68 72 5a 80 00       	push   $0x805a72
+  8036f6:	e8 56 cb ff ff       	call   800251 <_panic>
+		panic("Invalid mapping for the va\n");
+  8036fb:	83 ec 04             	sub    $0x4,%esp
+  8036fe:	68 7f 5a 80 00       	push   $0x805a7f
+  803703:	68 da 01 00 00       	push   $0x1da
+  803708:	68 72 5a 80 00       	push   $0x805a72
+  80370d:	e8 3f cb ff ff       	call   800251 <_panic>
+		panic("We tried to page out a shared page\n");
+  803712:	83 ec 04             	sub    $0x4,%esp
+  803715:	68 58 5b 80 00       	push   $0x805b58
+  80371a:	68 e0 01 00 00       	push   $0x1e0
+  80371f:	68 72 5a 80 00       	push   $0x805a72
+  803724:	e8 28 cb ff ff       	call   800251 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  803729:	89 de                	mov    %ebx,%esi
+  80372b:	c1 ee 16             	shr    $0x16,%esi
+  80372e:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803735:	a8 80                	test   $0x80,%al
+  803737:	75 84                	jne    8036bd <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803739:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80373c:	05 00 10 40 11       	add    $0x11401000,%eax
+  803741:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803746:	76 85                	jbe    8036cd <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803748:	89 d8                	mov    %ebx,%eax
+  80374a:	e8 7e f3 ff ff       	call   802acd <page_is_clean>
+  80374f:	84 c0                	test   %al,%al
+  803751:	0f 85 5c ff ff ff    	jne    8036b3 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803757:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  80375e:	76 84                	jbe    8036e4 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803760:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803767:	a8 01                	test   $0x1,%al
+  803769:	74 90                	je     8036fb <get_page_choice+0xd2>
+  80376b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80376e:	c1 e8 0c             	shr    $0xc,%eax
+  803771:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803778:	f6 c2 01             	test   $0x1,%dl
+  80377b:	0f 84 7a ff ff ff    	je     8036fb <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803781:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803788:	f6 c2 01             	test   $0x1,%dl
+  80378b:	74 85                	je     803712 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  80378d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803794:	f6 c2 01             	test   $0x1,%dl
+  803797:	0f 84 75 ff ff ff    	je     803712 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  80379d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8037a4:	f6 c6 04             	test   $0x4,%dh
+  8037a7:	0f 85 65 ff ff ff    	jne    803712 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  8037ad:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8037b4:	f6 c6 02             	test   $0x2,%dh
+  8037b7:	0f 85 55 ff ff ff    	jne    803712 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8037bd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8037c4:	c1 e8 0c             	shr    $0xc,%eax
+  8037c7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8037ca:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8037cf:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8037d3:	66 83 f8 01          	cmp    $0x1,%ax
+  8037d7:	0f 86 d6 fe ff ff    	jbe    8036b3 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  8037dd:	83 ec 04             	sub    $0x4,%esp
+  8037e0:	68 7c 5b 80 00       	push   $0x805b7c
+  8037e5:	68 e2 01 00 00       	push   $0x1e2
+  8037ea:	68 72 5a 80 00       	push   $0x805a72
+  8037ef:	e8 5d ca ff ff       	call   800251 <_panic>
+
+008037f4 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  8037f4:	55                   	push   %ebp
+  8037f5:	89 e5                	mov    %esp,%ebp
+  8037f7:	57                   	push   %edi
+  8037f8:	56                   	push   %esi
+  8037f9:	53                   	push   %ebx
+  8037fa:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  8037fd:	e8 e8 f6 ff ff       	call   802eea <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803802:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803807:	85 c0                	test   %eax,%eax
+  803809:	74 41                	je     80384c <page_share_paged_out+0x58>
+  80380b:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803812:	0f 84 fd 00 00 00    	je     803915 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  803818:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  80381f:	00 00 00 
+  803822:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  803829:	00 00 00 
+  80382c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803831:	eb 2c                	jmp    80385f <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803833:	83 c3 04             	add    $0x4,%ebx
+  803836:	39 f3                	cmp    %esi,%ebx
+  803838:	74 1a                	je     803854 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  80383a:	8b 03                	mov    (%ebx),%eax
+  80383c:	a8 01                	test   $0x1,%al
+  80383e:	74 f3                	je     803833 <page_share_paged_out+0x3f>
+  803840:	c1 e8 0c             	shr    $0xc,%eax
+  803843:	e8 2b f5 ff ff       	call   802d73 <page_share_slot>
+  803848:	85 c0                	test   %eax,%eax
+  80384a:	79 e7                	jns    803833 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  80384c:	83 c4 0c             	add    $0xc,%esp
+  80384f:	5b                   	pop    %ebx
+  803850:	5e                   	pop    %esi
+  803851:	5f                   	pop    %edi
+  803852:	5d                   	pop    %ebp
+  803853:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803854:	83 c7 04             	add    $0x4,%edi
+  803857:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  80385d:	74 1b                	je     80387a <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  80385f:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  803864:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803867:	f6 c3 01             	test   $0x1,%bl
+  80386a:	74 e8                	je     803854 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  80386c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803872:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803878:	eb bc                	jmp    803836 <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80387a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80387f:	eb 11                	jmp    803892 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803881:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803887:	83 c3 01             	add    $0x1,%ebx
+  80388a:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803890:	77 41                	ja     8038d3 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803892:	89 d8                	mov    %ebx,%eax
+  803894:	c1 e8 0a             	shr    $0xa,%eax
+  803897:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80389e:	25 81 00 00 00       	and    $0x81,%eax
+  8038a3:	83 f8 01             	cmp    $0x1,%eax
+  8038a6:	75 d9                	jne    803881 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8038a8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8038af:	25 81 00 00 00       	and    $0x81,%eax
+  8038b4:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8038b9:	75 cc                	jne    803887 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8038bb:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8038c2:	c1 e8 0c             	shr    $0xc,%eax
+  8038c5:	e8 a9 f4 ff ff       	call   802d73 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8038ca:	85 c0                	test   %eax,%eax
+  8038cc:	79 b9                	jns    803887 <page_share_paged_out+0x93>
+  8038ce:	e9 79 ff ff ff       	jmp    80384c <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8038d3:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8038da:	75 13                	jne    8038ef <page_share_paged_out+0xfb>
+  8038dc:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  8038e3:	75 1d                	jne    803902 <page_share_paged_out+0x10e>
+	return 0;
+  8038e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ea:	e9 5d ff ff ff       	jmp    80384c <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8038ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f4:	e8 46 f4 ff ff       	call   802d3f <page_share_send>
+  8038f9:	85 c0                	test   %eax,%eax
+  8038fb:	79 df                	jns    8038dc <page_share_paged_out+0xe8>
+  8038fd:	e9 4a ff ff ff       	jmp    80384c <page_share_paged_out+0x58>
+  803902:	b8 01 00 00 00       	mov    $0x1,%eax
+  803907:	e8 33 f4 ff ff       	call   802d3f <page_share_send>
+  80390c:	85 c0                	test   %eax,%eax
+  80390e:	79 d5                	jns    8038e5 <page_share_paged_out+0xf1>
+  803910:	e9 37 ff ff ff       	jmp    80384c <page_share_paged_out+0x58>
+		return 0;
+  803915:	b8 00 00 00 00       	mov    $0x0,%eax
+  80391a:	e9 2d ff ff ff       	jmp    80384c <page_share_paged_out+0x58>
+
+0080391f <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  80391f:	55                   	push   %ebp
+  803920:	89 e5                	mov    %esp,%ebp
+  803922:	56                   	push   %esi
+  803923:	53                   	push   %ebx
+  803924:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803927:	e8 be f5 ff ff       	call   802eea <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  80392c:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803931:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803938:	0f 84 82 00 00 00    	je     8039c0 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  80393e:	83 ec 0c             	sub    $0xc,%esp
+  803941:	68 00 10 00 00       	push   $0x1000
+  803946:	e8 84 11 00 00       	call   804acf <malloc>
+  80394b:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  80394d:	83 c4 0c             	add    $0xc,%esp
+  803950:	6a 14                	push   $0x14
+  803952:	6a 00                	push   $0x0
+  803954:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803957:	50                   	push   %eax
+  803958:	e8 07 d1 ff ff       	call   800a64 <memset>
+  80395d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803960:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803965:	83 ec 0c             	sub    $0xc,%esp
+  803968:	6a 07                	push   $0x7
+  80396a:	6a 01                	push   $0x1
+  80396c:	53                   	push   %ebx
+  80396d:	6a 03                	push   $0x3
+  80396f:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  803976:	e8 46 e1 ff ff       	call   801ac1 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  80397b:	8b 03                	mov    (%ebx),%eax
+  80397d:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803980:	8b 43 04             	mov    0x4(%ebx),%eax
+  803983:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803986:	8b 43 08             	mov    0x8(%ebx),%eax
+  803989:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  80398c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80398f:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803992:	8b 43 10             	mov    0x10(%ebx),%eax
+  803995:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803998:	83 c6 01             	add    $0x1,%esi
+  80399b:	83 c4 20             	add    $0x20,%esp
+  80399e:	83 fe 02             	cmp    $0x2,%esi
+  8039a1:	75 c2                	jne    803965 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8039a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8039a6:	89 03                	mov    %eax,(%ebx)
+  8039a8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8039ab:	89 43 04             	mov    %eax,0x4(%ebx)
+  8039ae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8039b1:	89 43 08             	mov    %eax,0x8(%ebx)
+  8039b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8039b7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8039ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039bd:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8039c0:	89 d8                	mov    %ebx,%eax
+  8039c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039c5:	5b                   	pop    %ebx
+  8039c6:	5e                   	pop    %esi
+  8039c7:	5d                   	pop    %ebp
+  8039c8:	c3                   	ret
+
+008039c9 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8039c9:	55                   	push   %ebp
+  8039ca:	89 e5                	mov    %esp,%ebp
+  8039cc:	53                   	push   %ebx
+  8039cd:	83 ec 10             	sub    $0x10,%esp
+  8039d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8039d3:	68 d7 53 80 00       	push   $0x8053d7
+  8039d8:	e8 4f c9 ff ff       	call   80032c <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8039dd:	83 c4 08             	add    $0x8,%esp
+  8039e0:	ff 33                	push   (%ebx)
+  8039e2:	68 b0 5b 80 00       	push   $0x805bb0
+  8039e7:	e8 40 c9 ff ff       	call   80032c <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  8039ec:	83 c4 08             	add    $0x8,%esp
+  8039ef:	ff 73 04             	push   0x4(%ebx)
+  8039f2:	68 9b 5a 80 00       	push   $0x805a9b
+  8039f7:	e8 30 c9 ff ff       	call   80032c <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  8039fc:	83 c4 08             	add    $0x8,%esp
+  8039ff:	ff 73 08             	push   0x8(%ebx)
+  803a02:	68 d0 5b 80 00       	push   $0x805bd0
+  803a07:	e8 20 c9 ff ff       	call   80032c <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803a0c:	83 c4 08             	add    $0x8,%esp
+  803a0f:	ff 73 0c             	push   0xc(%ebx)
+  803a12:	68 f4 5b 80 00       	push   $0x805bf4
+  803a17:	e8 10 c9 ff ff       	call   80032c <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803a1c:	83 c4 08             	add    $0x8,%esp
+  803a1f:	ff 73 10             	push   0x10(%ebx)
+  803a22:	68 18 5c 80 00       	push   $0x805c18
+  803a27:	e8 00 c9 ff ff       	call   80032c <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803a2c:	83 c4 08             	add    $0x8,%esp
+  803a2f:	ff 35 08 c0 80 00    	push   0x80c008
+  803a35:	68 54 5c 80 00       	push   $0x805c54
+  803a3a:	e8 ed c8 ff ff       	call   80032c <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803a3f:	83 c4 08             	add    $0x8,%esp
+  803a42:	ff 35 04 c0 80 00    	push   0x80c004
+  803a48:	68 88 5c 80 00       	push   $0x805c88
+  803a4d:	e8 da c8 ff ff       	call   80032c <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803a52:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803a57:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803a5a:	8b 50 68             	mov    0x68(%eax),%edx
+  803a5d:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803a60:	51                   	push   %ecx
+  803a61:	52                   	push   %edx
+  803a62:	50                   	push   %eax
+  803a63:	68 c8 5c 80 00       	push   $0x805cc8
+  803a68:	e8 bf c8 ff ff       	call   80032c <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803a6d:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803a72:	8b 40 70             	mov    0x70(%eax),%eax
+  803a75:	83 c4 18             	add    $0x18,%esp
+  803a78:	50                   	push   %eax
+  803a79:	68 fc 5c 80 00       	push   $0x805cfc
+  803a7e:	e8 a9 c8 ff ff       	call   80032c <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803a83:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803a89:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803a8f:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803a94:	51                   	push   %ecx
+  803a95:	52                   	push   %edx
+  803a96:	50                   	push   %eax
+  803a97:	68 2c 5d 80 00       	push   $0x805d2c
+  803a9c:	e8 8b c8 ff ff       	call   80032c <cprintf>
+	cprintf("\n");
+  803aa1:	83 c4 14             	add    $0x14,%esp
+  803aa4:	68 d7 53 80 00       	push   $0x8053d7
+  803aa9:	e8 7e c8 ff ff       	call   80032c <cprintf>
+}
+  803aae:	83 c4 10             	add    $0x10,%esp
+  803ab1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803ab4:	c9                   	leave
+  803ab5:	c3                   	ret
+
+00803ab6 <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803ab6:	55                   	push   %ebp
+  803ab7:	89 e5                	mov    %esp,%ebp
+  803ab9:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803abc:	e8 5e fe ff ff       	call   80391f <get_paging_stats>
+  803ac1:	83 ec 0c             	sub    $0xc,%esp
+  803ac4:	50                   	push   %eax
+  803ac5:	e8 ff fe ff ff       	call   8039c9 <print_paging_stats>
+}
+  803aca:	83 c4 10             	add    $0x10,%esp
+  803acd:	c9                   	leave
+  803ace:	c3                   	ret
+
+00803acf <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803acf:	55                   	push   %ebp
+  803ad0:	89 e5                	mov    %esp,%ebp
+  803ad2:	53                   	push   %ebx
+  803ad3:	83 ec 04             	sub    $0x4,%esp
+  803ad6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803ad9:	eb 13                	jmp    803aee <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803adb:	83 ec 04             	sub    $0x4,%esp
+  803ade:	6a ff                	push   $0xffffffff
+  803ae0:	53                   	push   %ebx
+  803ae1:	68 00 f0 ff ee       	push   $0xeefff000
+  803ae6:	e8 f4 d7 ff ff       	call   8012df <sys_futex_wait>
+  803aeb:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803aee:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803af3:	39 d8                	cmp    %ebx,%eax
+  803af5:	74 e4                	je     803adb <mem_pressure_wait+0xc>
+	return now;
+}
+  803af7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803afa:	c9                   	leave
+  803afb:	c3                   	ret
+
+00803afc <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803afc:	55                   	push   %ebp
+  803afd:	89 e5                	mov    %esp,%ebp
+  803aff:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803b02:	68 6e 47 80 00       	push   $0x80476e
+  803b07:	e8 32 16 00 00       	call   80513e <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803b0c:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  803b13:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803b16:	83 c4 0c             	add    $0xc,%esp
+  803b19:	68 07 02 00 00       	push   $0x207
+  803b1e:	68 00 b0 ad de       	push   $0xdeadb000
+  803b23:	6a 00                	push   $0x0
+  803b25:	e8 dc d2 ff ff       	call   800e06 <sys_page_alloc>
+  803b2a:	83 c4 10             	add    $0x10,%esp
+  803b2d:	85 c0                	test   %eax,%eax
+  803b2f:	78 0c                	js     803b3d <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803b31:	e8 b4 f3 ff ff       	call   802eea <find_paging_env>
+	page_ring_ready();
+  803b36:	e8 7f f2 ff ff       	call   802dba <page_ring_ready>
+}
+  803b3b:	c9                   	leave
+  803b3c:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803b3d:	50                   	push   %eax
+  803b3e:	68 b9 5a 80 00       	push   $0x805ab9
+  803b43:	68 13 05 00 00       	push   $0x513
+  803b48:	68 72 5a 80 00       	push   $0x805a72
+  803b4d:	e8 ff c6 ff ff       	call   800251 <_panic>
+
+00803b52 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803b52:	55                   	push   %ebp
+  803b53:	89 e5                	mov    %esp,%ebp
+  803b55:	57                   	push   %edi
+  803b56:	56                   	push   %esi
+  803b57:	53                   	push   %ebx
+  803b58:	83 ec 0c             	sub    $0xc,%esp
+  803b5b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803b5e:	89 fa                	mov    %edi,%edx
+  803b60:	c1 ea 16             	shr    $0x16,%edx
+  803b63:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  803b68:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803b6b:	f6 06 01             	testb  $0x1,(%esi)
+  803b6e:	75 3e                	jne    803bae <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803b70:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803b75:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803b79:	74 47                	je     803bc2 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803b7b:	83 ec 0c             	sub    $0xc,%esp
+  803b7e:	6a 01                	push   $0x1
+  803b80:	e8 f2 11 00 00       	call   804d77 <va_alloc>
+  803b85:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803b87:	83 c4 10             	add    $0x10,%esp
+  803b8a:	85 c0                	test   %eax,%eax
+  803b8c:	74 34                	je     803bc2 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803b8e:	6a 00                	push   $0x0
+  803b90:	68 07 02 00 00       	push   $0x207
+  803b95:	50                   	push   %eax
+  803b96:	6a 00                	push   $0x0
+  803b98:	e8 df 02 00 00       	call   803e7c <page_alloc>
+  803b9d:	83 c4 10             	add    $0x10,%esp
+  803ba0:	85 c0                	test   %eax,%eax
+  803ba2:	78 28                	js     803bcc <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803ba4:	f6 06 01             	testb  $0x1,(%esi)
+  803ba7:	75 38                	jne    803be1 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803ba9:	83 cb 01             	or     $0x1,%ebx
+  803bac:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803bae:	89 f8                	mov    %edi,%eax
+  803bb0:	c1 e8 0a             	shr    $0xa,%eax
+  803bb3:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803bb8:	8b 1e                	mov    (%esi),%ebx
+  803bba:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803bc0:	01 c3                	add    %eax,%ebx
+}
+  803bc2:	89 d8                	mov    %ebx,%eax
+  803bc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bc7:	5b                   	pop    %ebx
+  803bc8:	5e                   	pop    %esi
+  803bc9:	5f                   	pop    %edi
+  803bca:	5d                   	pop    %ebp
+  803bcb:	c3                   	ret
+			va_free(page, 1);
+  803bcc:	83 ec 08             	sub    $0x8,%esp
+  803bcf:	6a 01                	push   $0x1
+  803bd1:	53                   	push   %ebx
+  803bd2:	e8 d8 12 00 00       	call   804eaf <va_free>
+			return NULL;
+  803bd7:	83 c4 10             	add    $0x10,%esp
+  803bda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bdf:	eb e1                	jmp    803bc2 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803be1:	83 ec 08             	sub    $0x8,%esp
+  803be4:	53                   	push   %ebx
+  803be5:	6a 00                	push   $0x0
+  803be7:	e8 9f d2 ff ff       	call   800e8b <sys_page_unmap>
+			va_free(page, 1);
+  803bec:	83 c4 08             	add    $0x8,%esp
+  803bef:	6a 01                	push   $0x1
+  803bf1:	53                   	push   %ebx
+  803bf2:	e8 b8 12 00 00       	call   804eaf <va_free>
+  803bf7:	83 c4 10             	add    $0x10,%esp
+  803bfa:	eb b2                	jmp    803bae <umapdir_walk+0x5c>
+
+00803bfc <page_out>:
+{
+  803bfc:	55                   	push   %ebp
+  803bfd:	89 e5                	mov    %esp,%ebp
+  803bff:	57                   	push   %edi
+  803c00:	56                   	push   %esi
+  803c01:	53                   	push   %ebx
+  803c02:	83 ec 5c             	sub    $0x5c,%esp
+  803c05:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803c08:	e8 dd f2 ff ff       	call   802eea <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803c0d:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803c12:	85 c0                	test   %eax,%eax
+  803c14:	74 1e                	je     803c34 <page_out+0x38>
+  803c16:	83 ec 0c             	sub    $0xc,%esp
+  803c19:	6a 00                	push   $0x0
+  803c1b:	6a 00                	push   $0x0
+  803c1d:	6a 00                	push   $0x0
+  803c1f:	6a 08                	push   $0x8
+  803c21:	50                   	push   %eax
+  803c22:	e8 9a de ff ff       	call   801ac1 <ipc_call>
+  803c27:	89 c3                	mov    %eax,%ebx
+  803c29:	83 c4 20             	add    $0x20,%esp
+  803c2c:	85 c0                	test   %eax,%eax
+  803c2e:	0f 84 ac 00 00 00    	je     803ce0 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803c34:	83 ec 08             	sub    $0x8,%esp
+  803c37:	ff 75 0c             	push   0xc(%ebp)
+  803c3a:	57                   	push   %edi
+  803c3b:	e8 e9 f9 ff ff       	call   803629 <get_page_choice>
+  803c40:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803c42:	83 c4 10             	add    $0x10,%esp
+  803c45:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803c4a:	0f 84 18 02 00 00    	je     803e68 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803c50:	e8 78 ee ff ff       	call   802acd <page_is_clean>
+  803c55:	84 c0                	test   %al,%al
+  803c57:	0f 85 8c 00 00 00    	jne    803ce9 <page_out+0xed>
+	if (pagingenv == 0)
+  803c5d:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803c64:	0f 84 08 02 00 00    	je     803e72 <page_out+0x276>
+	if (page_ring_ready())
+  803c6a:	e8 4b f1 ff ff       	call   802dba <page_ring_ready>
+  803c6f:	89 c3                	mov    %eax,%ebx
+  803c71:	85 c0                	test   %eax,%eax
+  803c73:	0f 85 89 00 00 00    	jne    803d02 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  803c79:	83 ec 0c             	sub    $0xc,%esp
+  803c7c:	6a 05                	push   $0x5
+  803c7e:	6a 01                	push   $0x1
+  803c80:	56                   	push   %esi
+  803c81:	6a 01                	push   $0x1
+  803c83:	ff 35 40 c0 80 00    	push   0x80c040
+  803c89:	e8 33 de ff ff       	call   801ac1 <ipc_call>
+  803c8e:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  803c90:	83 c4 20             	add    $0x20,%esp
+  803c93:	85 c0                	test   %eax,%eax
+  803c95:	0f 88 b8 01 00 00    	js     803e53 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  803c9b:	89 f0                	mov    %esi,%eax
+  803c9d:	c1 e8 0c             	shr    $0xc,%eax
+  803ca0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ca7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  803caa:	83 ec 08             	sub    $0x8,%esp
+  803cad:	56                   	push   %esi
+  803cae:	6a 00                	push   $0x0
+  803cb0:	e8 d6 d1 ff ff       	call   800e8b <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  803cb5:	83 c4 08             	add    $0x8,%esp
+  803cb8:	6a 01                	push   $0x1
+  803cba:	56                   	push   %esi
+  803cbb:	e8 92 fe ff ff       	call   803b52 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  803cc0:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  803cc3:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803cc9:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803ccc:	09 fe                	or     %edi,%esi
+  803cce:	83 ce 01             	or     $0x1,%esi
+  803cd1:	89 30                	mov    %esi,(%eax)
+	return 0;
+  803cd3:	83 c4 10             	add    $0x10,%esp
+}
+  803cd6:	89 d8                	mov    %ebx,%eax
+  803cd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cdb:	5b                   	pop    %ebx
+  803cdc:	5e                   	pop    %esi
+  803cdd:	5f                   	pop    %edi
+  803cde:	5d                   	pop    %ebp
+  803cdf:	c3                   	ret
+		num_page_reclaims++;
+  803ce0:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  803ce7:	eb ed                	jmp    803cd6 <page_out+0xda>
+		num_page_drops++;
+  803ce9:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803cf0:	83 ec 08             	sub    $0x8,%esp
+  803cf3:	56                   	push   %esi
+  803cf4:	6a 00                	push   $0x0
+  803cf6:	e8 90 d1 ff ff       	call   800e8b <sys_page_unmap>
+  803cfb:	89 c3                	mov    %eax,%ebx
+  803cfd:	83 c4 10             	add    $0x10,%esp
+  803d00:	eb d4                	jmp    803cd6 <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803d02:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803d04:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803d09:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803d0e:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803d11:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803d13:	83 c0 08             	add    $0x8,%eax
+  803d16:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803d19:	b8 07 00 00 00       	mov    $0x7,%eax
+  803d1e:	e8 e5 ef ff ff       	call   802d08 <page_ring_reserve>
+	first = ring->sq_tail;
+  803d23:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803d28:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803d2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803d30:	83 ec 04             	sub    $0x4,%esp
+  803d33:	68 00 10 00 00       	push   $0x1000
+  803d38:	56                   	push   %esi
+  803d39:	89 d8                	mov    %ebx,%eax
+  803d3b:	c1 e0 0c             	shl    $0xc,%eax
+  803d3e:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803d43:	50                   	push   %eax
+  803d44:	e8 b2 cd ff ff       	call   800afb <memcpy>
+		vas[n] = va;
+  803d49:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803d4d:	89 d9                	mov    %ebx,%ecx
+  803d4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d54:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d59:	e8 de ee ff ff       	call   802c3c <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803d5e:	8d 43 01             	lea    0x1(%ebx),%eax
+  803d61:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803d64:	83 c4 10             	add    $0x10,%esp
+  803d67:	83 fb 06             	cmp    $0x6,%ebx
+  803d6a:	74 62                	je     803dce <page_out+0x1d2>
+  803d6c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803d6f:	eb 15                	jmp    803d86 <page_out+0x18a>
+			num_page_drops++;
+  803d71:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803d78:	83 ec 08             	sub    $0x8,%esp
+  803d7b:	56                   	push   %esi
+  803d7c:	6a 00                	push   $0x0
+  803d7e:	e8 08 d1 ff ff       	call   800e8b <sys_page_unmap>
+  803d83:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803d86:	83 ec 08             	sub    $0x8,%esp
+  803d89:	53                   	push   %ebx
+  803d8a:	57                   	push   %edi
+  803d8b:	e8 99 f8 ff ff       	call   803629 <get_page_choice>
+  803d90:	89 c6                	mov    %eax,%esi
+  803d92:	83 c4 10             	add    $0x10,%esp
+  803d95:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803d9a:	74 32                	je     803dce <page_out+0x1d2>
+  803d9c:	e8 2c ed ff ff       	call   802acd <page_is_clean>
+  803da1:	84 c0                	test   %al,%al
+  803da3:	75 cc                	jne    803d71 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803da5:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803da8:	39 c6                	cmp    %eax,%esi
+  803daa:	72 07                	jb     803db3 <page_out+0x1b7>
+  803dac:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803daf:	39 c6                	cmp    %eax,%esi
+  803db1:	72 1b                	jb     803dce <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803db3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803db8:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803dbb:	eb 03                	jmp    803dc0 <page_out+0x1c4>
+  803dbd:	83 c3 01             	add    $0x1,%ebx
+  803dc0:	39 da                	cmp    %ebx,%edx
+  803dc2:	0f 84 68 ff ff ff    	je     803d30 <page_out+0x134>
+  803dc8:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803dcc:	75 ef                	jne    803dbd <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803dce:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803dd1:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803dd4:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803dd7:	e8 a6 ee ff ff       	call   802c82 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803ddc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803de1:	eb 42                	jmp    803e25 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803de3:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803de7:	89 f8                	mov    %edi,%eax
+  803de9:	c1 e8 0c             	shr    $0xc,%eax
+  803dec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803df3:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803df6:	83 ec 08             	sub    $0x8,%esp
+  803df9:	57                   	push   %edi
+  803dfa:	6a 00                	push   $0x0
+  803dfc:	e8 8a d0 ff ff       	call   800e8b <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803e01:	83 c4 08             	add    $0x8,%esp
+  803e04:	6a 01                	push   $0x1
+  803e06:	57                   	push   %edi
+  803e07:	e8 46 fd ff ff       	call   803b52 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803e0c:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803e0f:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803e15:	c1 e6 0c             	shl    $0xc,%esi
+  803e18:	09 d6                	or     %edx,%esi
+  803e1a:	83 ce 01             	or     $0x1,%esi
+  803e1d:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803e1f:	83 c3 01             	add    $0x1,%ebx
+  803e22:	83 c4 10             	add    $0x10,%esp
+  803e25:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803e28:	39 c3                	cmp    %eax,%ebx
+  803e2a:	74 1d                	je     803e49 <page_out+0x24d>
+		if (res[i] < 0)
+  803e2c:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803e30:	85 f6                	test   %esi,%esi
+  803e32:	79 af                	jns    803de3 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803e34:	56                   	push   %esi
+  803e35:	68 5c 5d 80 00       	push   $0x805d5c
+  803e3a:	68 d1 02 00 00       	push   $0x2d1
+  803e3f:	68 72 5a 80 00       	push   $0x805a72
+  803e44:	e8 08 c4 ff ff       	call   800251 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803e49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e4e:	e9 83 fe ff ff       	jmp    803cd6 <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803e53:	50                   	push   %eax
+  803e54:	68 5c 5d 80 00       	push   $0x805d5c
+  803e59:	68 0a 03 00 00       	push   $0x30a
+  803e5e:	68 72 5a 80 00       	push   $0x805a72
+  803e63:	e8 e9 c3 ff ff       	call   800251 <_panic>
+		return -E_NO_MEM;
+  803e68:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803e6d:	e9 64 fe ff ff       	jmp    803cd6 <page_out+0xda>
+		return -E_PAGING;
+  803e72:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803e77:	e9 5a fe ff ff       	jmp    803cd6 <page_out+0xda>
+
+00803e7c <page_alloc>:
+{
+  803e7c:	55                   	push   %ebp
+  803e7d:	89 e5                	mov    %esp,%ebp
+  803e7f:	57                   	push   %edi
+  803e80:	56                   	push   %esi
+  803e81:	53                   	push   %ebx
+  803e82:	83 ec 0c             	sub    $0xc,%esp
+  803e85:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803e88:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803e8b:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803e92:	74 34                	je     803ec8 <page_alloc+0x4c>
+	if (check_mte)
+  803e94:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803e98:	75 35                	jne    803ecf <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803e9a:	83 ec 04             	sub    $0x4,%esp
+  803e9d:	ff 75 10             	push   0x10(%ebp)
+  803ea0:	56                   	push   %esi
+  803ea1:	57                   	push   %edi
+  803ea2:	e8 5f cf ff ff       	call   800e06 <sys_page_alloc>
+  803ea7:	89 c3                	mov    %eax,%ebx
+  803ea9:	83 c4 10             	add    $0x10,%esp
+  803eac:	85 c0                	test   %eax,%eax
+  803eae:	79 52                	jns    803f02 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803eb0:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803eb3:	75 52                	jne    803f07 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803eb5:	83 ec 08             	sub    $0x8,%esp
+  803eb8:	56                   	push   %esi
+  803eb9:	57                   	push   %edi
+  803eba:	e8 3d fd ff ff       	call   803bfc <page_out>
+  803ebf:	83 c4 10             	add    $0x10,%esp
+  803ec2:	85 c0                	test   %eax,%eax
+  803ec4:	79 d4                	jns    803e9a <page_alloc+0x1e>
+  803ec6:	eb 3f                	jmp    803f07 <page_alloc+0x8b>
+		init_map_dir();
+  803ec8:	e8 2f fc ff ff       	call   803afc <init_map_dir>
+  803ecd:	eb c5                	jmp    803e94 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803ecf:	83 ec 08             	sub    $0x8,%esp
+  803ed2:	6a 00                	push   $0x0
+  803ed4:	56                   	push   %esi
+  803ed5:	e8 78 fc ff ff       	call   803b52 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803eda:	83 c4 10             	add    $0x10,%esp
+  803edd:	85 c0                	test   %eax,%eax
+  803edf:	74 b9                	je     803e9a <page_alloc+0x1e>
+  803ee1:	8b 10                	mov    (%eax),%edx
+  803ee3:	f6 c2 01             	test   $0x1,%dl
+  803ee6:	74 b2                	je     803e9a <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803ee8:	83 ec 08             	sub    $0x8,%esp
+  803eeb:	56                   	push   %esi
+  803eec:	52                   	push   %edx
+  803eed:	50                   	push   %eax
+  803eee:	68 80 5d 80 00       	push   $0x805d80
+  803ef3:	68 34 03 00 00       	push   $0x334
+  803ef8:	68 72 5a 80 00       	push   $0x805a72
+  803efd:	e8 4f c3 ff ff       	call   800251 <_panic>
+	return 0;
+  803f02:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803f07:	89 d8                	mov    %ebx,%eax
+  803f09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f0c:	5b                   	pop    %ebx
+  803f0d:	5e                   	pop    %esi
+  803f0e:	5f                   	pop    %edi
+  803f0f:	5d                   	pop    %ebp
+  803f10:	c3                   	ret
+
+00803f11 <page_adopt>:
+{
+  803f11:	55                   	push   %ebp
+  803f12:	89 e5                	mov    %esp,%ebp
+  803f14:	56                   	push   %esi
+  803f15:	53                   	push   %ebx
+  803f16:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803f18:	c1 e8 16             	shr    $0x16,%eax
+  803f1b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803f22:	25 81 00 00 00       	and    $0x81,%eax
+  803f27:	83 f8 01             	cmp    $0x1,%eax
+  803f2a:	75 53                	jne    803f7f <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803f2c:	89 d8                	mov    %ebx,%eax
+  803f2e:	c1 e8 0c             	shr    $0xc,%eax
+  803f31:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803f38:	89 f2                	mov    %esi,%edx
+  803f3a:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803f40:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803f45:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803f4b:	75 37                	jne    803f84 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803f4d:	83 ec 08             	sub    $0x8,%esp
+  803f50:	6a 01                	push   $0x1
+  803f52:	53                   	push   %ebx
+  803f53:	e8 fa fb ff ff       	call   803b52 <umapdir_walk>
+  803f58:	83 c4 10             	add    $0x10,%esp
+  803f5b:	85 c0                	test   %eax,%eax
+  803f5d:	74 2c                	je     803f8b <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803f5f:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803f65:	83 ce 01             	or     $0x1,%esi
+  803f68:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803f6a:	83 ec 08             	sub    $0x8,%esp
+  803f6d:	53                   	push   %ebx
+  803f6e:	6a 00                	push   $0x0
+  803f70:	e8 16 cf ff ff       	call   800e8b <sys_page_unmap>
+	return 1;
+  803f75:	83 c4 10             	add    $0x10,%esp
+  803f78:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f7d:	eb 05                	jmp    803f84 <page_adopt+0x73>
+		return 0;
+  803f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803f87:	5b                   	pop    %ebx
+  803f88:	5e                   	pop    %esi
+  803f89:	5d                   	pop    %ebp
+  803f8a:	c3                   	ret
+		return -E_NO_MEM;
+  803f8b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803f90:	eb f2                	jmp    803f84 <page_adopt+0x73>
+
+00803f92 <page_forget>:
+{
+  803f92:	55                   	push   %ebp
+  803f93:	89 e5                	mov    %esp,%ebp
+  803f95:	53                   	push   %ebx
+  803f96:	83 ec 04             	sub    $0x4,%esp
+  803f99:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803f9b:	e8 4a ef ff ff       	call   802eea <find_paging_env>
+	if (pagingenv == 0)
+  803fa0:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803fa7:	74 39                	je     803fe2 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803fa9:	89 d8                	mov    %ebx,%eax
+  803fab:	c1 e8 16             	shr    $0x16,%eax
+  803fae:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803fb5:	25 81 00 00 00       	and    $0x81,%eax
+  803fba:	83 f8 01             	cmp    $0x1,%eax
+  803fbd:	74 28                	je     803fe7 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803fbf:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803fc6:	74 1a                	je     803fe2 <page_forget+0x50>
+  803fc8:	83 ec 08             	sub    $0x8,%esp
+  803fcb:	6a 00                	push   $0x0
+  803fcd:	53                   	push   %ebx
+  803fce:	e8 7f fb ff ff       	call   803b52 <umapdir_walk>
+  803fd3:	89 c3                	mov    %eax,%ebx
+  803fd5:	83 c4 10             	add    $0x10,%esp
+  803fd8:	85 c0                	test   %eax,%eax
+  803fda:	74 06                	je     803fe2 <page_forget+0x50>
+  803fdc:	8b 00                	mov    (%eax),%eax
+  803fde:	a8 01                	test   $0x1,%al
+  803fe0:	75 2b                	jne    80400d <page_forget+0x7b>
+}
+  803fe2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803fe5:	c9                   	leave
+  803fe6:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803fe7:	89 d8                	mov    %ebx,%eax
+  803fe9:	c1 e8 0c             	shr    $0xc,%eax
+  803fec:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803ff3:	89 c2                	mov    %eax,%edx
+  803ff5:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803ffb:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  804001:	75 bc                	jne    803fbf <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  804003:	c1 e8 0c             	shr    $0xc,%eax
+  804006:	e8 5c ee ff ff       	call   802e67 <page_remove_slot>
+		return;
+  80400b:	eb d5                	jmp    803fe2 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  80400d:	c1 e8 0c             	shr    $0xc,%eax
+  804010:	e8 52 ee ff ff       	call   802e67 <page_remove_slot>
+	*mte = 0;
+  804015:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80401b:	eb c5                	jmp    803fe2 <page_forget+0x50>
+
+0080401d <page_unmap>:
+{
+  80401d:	55                   	push   %ebp
+  80401e:	89 e5                	mov    %esp,%ebp
+  804020:	57                   	push   %edi
+  804021:	56                   	push   %esi
+  804022:	53                   	push   %ebx
+  804023:	83 ec 0c             	sub    $0xc,%esp
+  804026:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804029:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  80402c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804031:	8b 40 48             	mov    0x48(%eax),%eax
+  804034:	85 db                	test   %ebx,%ebx
+  804036:	0f 8e b4 00 00 00    	jle    8040f0 <page_unmap+0xd3>
+  80403c:	39 d8                	cmp    %ebx,%eax
+  80403e:	0f 84 ac 00 00 00    	je     8040f0 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  804044:	83 ec 08             	sub    $0x8,%esp
+  804047:	57                   	push   %edi
+  804048:	53                   	push   %ebx
+  804049:	e8 3d ce ff ff       	call   800e8b <sys_page_unmap>
+  80404e:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  804050:	e8 95 ee ff ff       	call   802eea <find_paging_env>
+	if (pagingenv == 0)
+  804055:	83 c4 10             	add    $0x10,%esp
+  804058:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80405f:	0f 84 a1 00 00 00    	je     804106 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804065:	83 ec 0c             	sub    $0xc,%esp
+  804068:	6a 05                	push   $0x5
+  80406a:	68 00 00 40 00       	push   $0x400000
+  80406f:	6a 00                	push   $0x0
+  804071:	68 00 b0 ad de       	push   $0xdeadb000
+  804076:	53                   	push   %ebx
+  804077:	e8 cd cd ff ff       	call   800e49 <sys_page_map>
+  80407c:	83 c4 20             	add    $0x20,%esp
+  80407f:	85 c0                	test   %eax,%eax
+  804081:	0f 88 89 00 00 00    	js     804110 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  804087:	89 f8                	mov    %edi,%eax
+  804089:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  80408c:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  804093:	a8 01                	test   $0x1,%al
+  804095:	74 6f                	je     804106 <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804097:	83 ec 0c             	sub    $0xc,%esp
+  80409a:	6a 05                	push   $0x5
+  80409c:	68 00 00 40 00       	push   $0x400000
+  8040a1:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8040a3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8040a8:	50                   	push   %eax
+  8040a9:	53                   	push   %ebx
+  8040aa:	e8 9a cd ff ff       	call   800e49 <sys_page_map>
+  8040af:	83 c4 20             	add    $0x20,%esp
+  8040b2:	85 c0                	test   %eax,%eax
+  8040b4:	78 6f                	js     804125 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  8040b6:	c1 ef 0c             	shr    $0xc,%edi
+  8040b9:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8040bf:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  8040c6:	01 
+  8040c7:	74 3d                	je     804106 <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8040c9:	83 ec 08             	sub    $0x8,%esp
+  8040cc:	68 00 00 40 00       	push   $0x400000
+  8040d1:	6a 00                	push   $0x0
+  8040d3:	e8 b3 cd ff ff       	call   800e8b <sys_page_unmap>
+  8040d8:	83 c4 10             	add    $0x10,%esp
+  8040db:	85 c0                	test   %eax,%eax
+  8040dd:	78 5b                	js     80413a <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  8040df:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  8040e6:	c1 e8 0c             	shr    $0xc,%eax
+  8040e9:	e8 79 ed ff ff       	call   802e67 <page_remove_slot>
+	return r;
+  8040ee:	eb 16                	jmp    804106 <page_unmap+0xe9>
+		page_forget(va);
+  8040f0:	89 f8                	mov    %edi,%eax
+  8040f2:	e8 9b fe ff ff       	call   803f92 <page_forget>
+		return sys_page_unmap(envid, va);
+  8040f7:	83 ec 08             	sub    $0x8,%esp
+  8040fa:	57                   	push   %edi
+  8040fb:	53                   	push   %ebx
+  8040fc:	e8 8a cd ff ff       	call   800e8b <sys_page_unmap>
+  804101:	89 c6                	mov    %eax,%esi
+  804103:	83 c4 10             	add    $0x10,%esp
+}
+  804106:	89 f0                	mov    %esi,%eax
+  804108:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80410b:	5b                   	pop    %ebx
+  80410c:	5e                   	pop    %esi
+  80410d:	5f                   	pop    %edi
+  80410e:	5d                   	pop    %ebp
+  80410f:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  804110:	50                   	push   %eax
+  804111:	68 bc 5d 80 00       	push   $0x805dbc
+  804116:	68 e4 03 00 00       	push   $0x3e4
+  80411b:	68 72 5a 80 00       	push   $0x805a72
+  804120:	e8 2c c1 ff ff       	call   800251 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  804125:	50                   	push   %eax
+  804126:	68 e8 5d 80 00       	push   $0x805de8
+  80412b:	68 ea 03 00 00       	push   $0x3ea
+  804130:	68 72 5a 80 00       	push   $0x805a72
+  804135:	e8 17 c1 ff ff       	call   800251 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  80413a:	50                   	push   %eax
+  80413b:	68 14 5e 80 00       	push   $0x805e14
+  804140:	68 ef 03 00 00       	push   $0x3ef
+  804145:	68 72 5a 80 00       	push   $0x805a72
+  80414a:	e8 02 c1 ff ff       	call   800251 <_panic>
+
+0080414f <page_unmap_range>:
+{
+  80414f:	55                   	push   %ebp
+  804150:	89 e5                	mov    %esp,%ebp
+  804152:	57                   	push   %edi
+  804153:	56                   	push   %esi
+  804154:	53                   	push   %ebx
+  804155:	83 ec 0c             	sub    $0xc,%esp
+  804158:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  80415b:	e8 8a ed ff ff       	call   802eea <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  804160:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804165:	8b 40 48             	mov    0x48(%eax),%eax
+  804168:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80416c:	7e 38                	jle    8041a6 <page_unmap_range+0x57>
+  80416e:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804171:	74 33                	je     8041a6 <page_unmap_range+0x57>
+  804173:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80417a:	74 2a                	je     8041a6 <page_unmap_range+0x57>
+  80417c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  80417f:	be 00 00 00 00       	mov    $0x0,%esi
+  804184:	39 fe                	cmp    %edi,%esi
+  804186:	74 56                	je     8041de <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  804188:	83 ec 08             	sub    $0x8,%esp
+  80418b:	53                   	push   %ebx
+  80418c:	ff 75 08             	push   0x8(%ebp)
+  80418f:	e8 89 fe ff ff       	call   80401d <page_unmap>
+  804194:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80419a:	83 c4 10             	add    $0x10,%esp
+  80419d:	85 c0                	test   %eax,%eax
+  80419f:	78 35                	js     8041d6 <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8041a1:	83 c6 01             	add    $0x1,%esi
+  8041a4:	eb de                	jmp    804184 <page_unmap_range+0x35>
+  8041a6:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  8041a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041ae:	eb 10                	jmp    8041c0 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  8041b0:	89 f0                	mov    %esi,%eax
+  8041b2:	e8 db fd ff ff       	call   803f92 <page_forget>
+		for (i = 0; i < npages; i++)
+  8041b7:	83 c3 01             	add    $0x1,%ebx
+  8041ba:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8041c0:	39 fb                	cmp    %edi,%ebx
+  8041c2:	75 ec                	jne    8041b0 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  8041c4:	83 ec 04             	sub    $0x4,%esp
+  8041c7:	57                   	push   %edi
+  8041c8:	ff 75 0c             	push   0xc(%ebp)
+  8041cb:	ff 75 08             	push   0x8(%ebp)
+  8041ce:	e8 cc cd ff ff       	call   800f9f <sys_page_unmap_range>
+  8041d3:	83 c4 10             	add    $0x10,%esp
+}
+  8041d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041d9:	5b                   	pop    %ebx
+  8041da:	5e                   	pop    %esi
+  8041db:	5f                   	pop    %edi
+  8041dc:	5d                   	pop    %ebp
+  8041dd:	c3                   	ret
+	return 0;
+  8041de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e3:	eb f1                	jmp    8041d6 <page_unmap_range+0x87>
+
+008041e5 <page_alloc_range>:
+{
+  8041e5:	55                   	push   %ebp
+  8041e6:	89 e5                	mov    %esp,%ebp
+  8041e8:	57                   	push   %edi
+  8041e9:	56                   	push   %esi
+  8041ea:	53                   	push   %ebx
+  8041eb:	83 ec 1c             	sub    $0x1c,%esp
+  8041ee:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8041f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  8041f4:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8041fb:	74 14                	je     804211 <page_alloc_range+0x2c>
+	if (check_mte)
+  8041fd:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  804201:	74 66                	je     804269 <page_alloc_range+0x84>
+  804203:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  804205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80420a:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  80420d:	89 c7                	mov    %eax,%edi
+  80420f:	eb 10                	jmp    804221 <page_alloc_range+0x3c>
+		init_map_dir();
+  804211:	e8 e6 f8 ff ff       	call   803afc <init_map_dir>
+  804216:	eb e5                	jmp    8041fd <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  804218:	83 c7 01             	add    $0x1,%edi
+  80421b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804221:	39 df                	cmp    %ebx,%edi
+  804223:	74 38                	je     80425d <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  804225:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804228:	83 ec 08             	sub    $0x8,%esp
+  80422b:	6a 00                	push   $0x0
+  80422d:	56                   	push   %esi
+  80422e:	e8 1f f9 ff ff       	call   803b52 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  804233:	83 c4 10             	add    $0x10,%esp
+  804236:	85 c0                	test   %eax,%eax
+  804238:	74 de                	je     804218 <page_alloc_range+0x33>
+  80423a:	8b 10                	mov    (%eax),%edx
+  80423c:	f6 c2 01             	test   $0x1,%dl
+  80423f:	74 d7                	je     804218 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  804241:	83 ec 08             	sub    $0x8,%esp
+  804244:	ff 75 e4             	push   -0x1c(%ebp)
+  804247:	52                   	push   %edx
+  804248:	50                   	push   %eax
+  804249:	68 80 5d 80 00       	push   $0x805d80
+  80424e:	68 0b 04 00 00       	push   $0x40b
+  804253:	68 72 5a 80 00       	push   $0x805a72
+  804258:	e8 f4 bf ff ff       	call   800251 <_panic>
+  80425d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804260:	eb 07                	jmp    804269 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  804262:	c1 e0 0c             	shl    $0xc,%eax
+  804265:	01 c7                	add    %eax,%edi
+			npages -= r;
+  804267:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  804269:	85 db                	test   %ebx,%ebx
+  80426b:	74 30                	je     80429d <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  80426d:	ff 75 14             	push   0x14(%ebp)
+  804270:	53                   	push   %ebx
+  804271:	57                   	push   %edi
+  804272:	ff 75 08             	push   0x8(%ebp)
+  804275:	e8 b7 cc ff ff       	call   800f31 <sys_page_alloc_range>
+  80427a:	89 c6                	mov    %eax,%esi
+  80427c:	83 c4 10             	add    $0x10,%esp
+  80427f:	85 c0                	test   %eax,%eax
+  804281:	7f df                	jg     804262 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  804283:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  804286:	75 1a                	jne    8042a2 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  804288:	83 ec 08             	sub    $0x8,%esp
+  80428b:	57                   	push   %edi
+  80428c:	ff 75 08             	push   0x8(%ebp)
+  80428f:	e8 68 f9 ff ff       	call   803bfc <page_out>
+  804294:	83 c4 10             	add    $0x10,%esp
+  804297:	85 c0                	test   %eax,%eax
+  804299:	79 ce                	jns    804269 <page_alloc_range+0x84>
+  80429b:	eb 05                	jmp    8042a2 <page_alloc_range+0xbd>
+	return 0;
+  80429d:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8042a2:	89 f0                	mov    %esi,%eax
+  8042a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042a7:	5b                   	pop    %ebx
+  8042a8:	5e                   	pop    %esi
+  8042a9:	5f                   	pop    %edi
+  8042aa:	5d                   	pop    %ebp
+  8042ab:	c3                   	ret
+
+008042ac <page_in>:
+{
+  8042ac:	55                   	push   %ebp
+  8042ad:	89 e5                	mov    %esp,%ebp
+  8042af:	57                   	push   %edi
+  8042b0:	56                   	push   %esi
+  8042b1:	53                   	push   %ebx
+  8042b2:	83 ec 3c             	sub    $0x3c,%esp
+  8042b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  8042b8:	e8 2d ec ff ff       	call   802eea <find_paging_env>
+	if (pagingenv == 0)
+  8042bd:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8042c4:	0f 84 09 02 00 00    	je     8044d3 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  8042ca:	83 ec 08             	sub    $0x8,%esp
+  8042cd:	6a 00                	push   $0x0
+  8042cf:	56                   	push   %esi
+  8042d0:	e8 7d f8 ff ff       	call   803b52 <umapdir_walk>
+  8042d5:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8042d7:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8042dd:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  8042e0:	83 c4 10             	add    $0x10,%esp
+  8042e3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8042e7:	74 0d                	je     8042f6 <page_in+0x4a>
+  8042e9:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8042ee:	8b 40 48             	mov    0x48(%eax),%eax
+  8042f1:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8042f4:	75 06                	jne    8042fc <page_in+0x50>
+  8042f6:	8b 03                	mov    (%ebx),%eax
+  8042f8:	a8 02                	test   $0x2,%al
+  8042fa:	75 63                	jne    80435f <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  8042fc:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  8042fe:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804300:	89 f0                	mov    %esi,%eax
+  804302:	25 06 0e 00 00       	and    $0xe06,%eax
+  804307:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  80430a:	50                   	push   %eax
+  80430b:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  80430e:	57                   	push   %edi
+  80430f:	ff 75 08             	push   0x8(%ebp)
+  804312:	e8 65 fb ff ff       	call   803e7c <page_alloc>
+  804317:	83 c4 10             	add    $0x10,%esp
+  80431a:	85 c0                	test   %eax,%eax
+  80431c:	78 39                	js     804357 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  80431e:	89 f0                	mov    %esi,%eax
+  804320:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804323:	83 ec 0c             	sub    $0xc,%esp
+  804326:	6a 07                	push   $0x7
+  804328:	6a 01                	push   $0x1
+  80432a:	57                   	push   %edi
+  80432b:	c1 e0 04             	shl    $0x4,%eax
+  80432e:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80432f:	c1 ee 1c             	shr    $0x1c,%esi
+  804332:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804335:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  80433c:	e8 80 d7 ff ff       	call   801ac1 <ipc_call>
+  804341:	83 c4 20             	add    $0x20,%esp
+  804344:	85 c0                	test   %eax,%eax
+  804346:	0f 88 72 01 00 00    	js     8044be <page_in+0x212>
+	*mte = 0;
+  80434c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804352:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804357:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80435a:	5b                   	pop    %ebx
+  80435b:	5e                   	pop    %esi
+  80435c:	5f                   	pop    %edi
+  80435d:	5d                   	pop    %ebp
+  80435e:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  80435f:	25 06 0e 00 00       	and    $0xe06,%eax
+  804364:	83 c8 01             	or     $0x1,%eax
+  804367:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  80436a:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  80436d:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804370:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  804376:	be 01 00 00 00       	mov    $0x1,%esi
+  80437b:	eb 46                	jmp    8043c3 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  80437d:	83 ec 08             	sub    $0x8,%esp
+  804380:	6a 00                	push   $0x0
+  804382:	51                   	push   %ecx
+  804383:	e8 ca f7 ff ff       	call   803b52 <umapdir_walk>
+  804388:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  80438c:	83 c4 10             	add    $0x10,%esp
+  80438f:	85 c0                	test   %eax,%eax
+  804391:	74 66                	je     8043f9 <page_in+0x14d>
+  804393:	8b 00                	mov    (%eax),%eax
+  804395:	a8 01                	test   $0x1,%al
+  804397:	74 60                	je     8043f9 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804399:	89 c2                	mov    %eax,%edx
+  80439b:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  8043a1:	83 ca 01             	or     $0x1,%edx
+  8043a4:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  8043a7:	75 50                	jne    8043f9 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  8043a9:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8043af:	c1 e8 1c             	shr    $0x1c,%eax
+  8043b2:	8b 13                	mov    (%ebx),%edx
+  8043b4:	c1 ea 1c             	shr    $0x1c,%edx
+  8043b7:	39 d0                	cmp    %edx,%eax
+  8043b9:	75 3e                	jne    8043f9 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8043bb:	83 c6 01             	add    $0x1,%esi
+  8043be:	83 fe 08             	cmp    $0x8,%esi
+  8043c1:	74 3f                	je     804402 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  8043c3:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8043c5:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  8043cb:	77 2c                	ja     8043f9 <page_in+0x14d>
+  8043cd:	89 f8                	mov    %edi,%eax
+  8043cf:	c1 e8 16             	shr    $0x16,%eax
+  8043d2:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8043d9:	f6 c2 01             	test   $0x1,%dl
+  8043dc:	74 9f                	je     80437d <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8043de:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8043e5:	a8 80                	test   $0x80,%al
+  8043e7:	75 10                	jne    8043f9 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  8043e9:	89 f8                	mov    %edi,%eax
+  8043eb:	c1 e8 0c             	shr    $0xc,%eax
+  8043ee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8043f5:	a8 01                	test   $0x1,%al
+  8043f7:	74 84                	je     80437d <page_in+0xd1>
+	if (n == 1)
+  8043f9:	83 fe 01             	cmp    $0x1,%esi
+  8043fc:	0f 84 fa fe ff ff    	je     8042fc <page_in+0x50>
+	req.nslots = n;
+  804402:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  804408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80440d:	eb 13                	jmp    804422 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  80440f:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  804413:	8b 12                	mov    (%edx),%edx
+  804415:	c1 ea 0c             	shr    $0xc,%edx
+  804418:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  80441f:	83 c0 01             	add    $0x1,%eax
+  804422:	39 c6                	cmp    %eax,%esi
+  804424:	75 e9                	jne    80440f <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  804426:	83 ec 0c             	sub    $0xc,%esp
+  804429:	6a 00                	push   $0x0
+  80442b:	ff 75 c0             	push   -0x40(%ebp)
+  80442e:	56                   	push   %esi
+  80442f:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804432:	57                   	push   %edi
+  804433:	6a 00                	push   $0x0
+  804435:	e8 ab fd ff ff       	call   8041e5 <page_alloc_range>
+  80443a:	83 c4 20             	add    $0x20,%esp
+  80443d:	85 c0                	test   %eax,%eax
+  80443f:	78 6e                	js     8044af <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804441:	83 ec 04             	sub    $0x4,%esp
+  804444:	6a 24                	push   $0x24
+  804446:	68 00 90 80 00       	push   $0x809000
+  80444b:	57                   	push   %edi
+  80444c:	e8 48 c6 ff ff       	call   800a99 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804451:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804458:	56                   	push   %esi
+  804459:	57                   	push   %edi
+  80445a:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  80445c:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  804463:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804466:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  80446d:	e8 4f d6 ff ff       	call   801ac1 <ipc_call>
+  804472:	83 c4 20             	add    $0x20,%esp
+  804475:	85 c0                	test   %eax,%eax
+  804477:	78 08                	js     804481 <page_in+0x1d5>
+  804479:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  80447c:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  80447f:	eb 20                	jmp    8044a1 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804481:	50                   	push   %eax
+  804482:	68 40 5e 80 00       	push   $0x805e40
+  804487:	68 59 02 00 00       	push   $0x259
+  80448c:	68 72 5a 80 00       	push   $0x805a72
+  804491:	e8 bb bd ff ff       	call   800251 <_panic>
+		*mtes[i] = 0;
+  804496:	8b 10                	mov    (%eax),%edx
+  804498:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  80449e:	83 c0 04             	add    $0x4,%eax
+  8044a1:	39 c8                	cmp    %ecx,%eax
+  8044a3:	75 f1                	jne    804496 <page_in+0x1ea>
+	return n;
+  8044a5:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  8044a7:	85 f6                	test   %esi,%esi
+  8044a9:	0f 84 4d fe ff ff    	je     8042fc <page_in+0x50>
+		return r < 0 ? r : 0;
+  8044af:	85 c0                	test   %eax,%eax
+  8044b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044b6:	0f 4f c2             	cmovg  %edx,%eax
+  8044b9:	e9 99 fe ff ff       	jmp    804357 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8044be:	50                   	push   %eax
+  8044bf:	68 78 5e 80 00       	push   $0x805e78
+  8044c4:	68 9a 02 00 00       	push   $0x29a
+  8044c9:	68 72 5a 80 00       	push   $0x805a72
+  8044ce:	e8 7e bd ff ff       	call   800251 <_panic>
+		return -E_PAGING;
+  8044d3:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8044d8:	e9 7a fe ff ff       	jmp    804357 <page_in+0xab>
+
+008044dd <page_map>:
+{
+  8044dd:	55                   	push   %ebp
+  8044de:	89 e5                	mov    %esp,%ebp
+  8044e0:	57                   	push   %edi
+  8044e1:	56                   	push   %esi
+  8044e2:	53                   	push   %ebx
+  8044e3:	83 ec 1c             	sub    $0x1c,%esp
+  8044e6:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8044e9:	83 ec 0c             	sub    $0xc,%esp
+  8044ec:	ff 75 18             	push   0x18(%ebp)
+  8044ef:	ff 75 14             	push   0x14(%ebp)
+  8044f2:	ff 75 10             	push   0x10(%ebp)
+  8044f5:	ff 75 0c             	push   0xc(%ebp)
+  8044f8:	56                   	push   %esi
+  8044f9:	e8 4b c9 ff ff       	call   800e49 <sys_page_map>
+  8044fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804501:	83 c4 20             	add    $0x20,%esp
+  804504:	85 c0                	test   %eax,%eax
+  804506:	0f 89 a9 01 00 00    	jns    8046b5 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  80450c:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  804510:	74 5f                	je     804571 <page_map+0x94>
+		if (r != -E_INVAL)
+  804512:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  804516:	0f 85 a0 01 00 00    	jne    8046bc <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  80451c:	85 f6                	test   %esi,%esi
+  80451e:	74 70                	je     804590 <page_map+0xb3>
+  804520:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804525:	8b 40 48             	mov    0x48(%eax),%eax
+  804528:	39 f0                	cmp    %esi,%eax
+  80452a:	74 64                	je     804590 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80452c:	83 ec 0c             	sub    $0xc,%esp
+  80452f:	6a 05                	push   $0x5
+  804531:	68 00 00 40 00       	push   $0x400000
+  804536:	6a 00                	push   $0x0
+  804538:	68 00 b0 ad de       	push   $0xdeadb000
+  80453d:	56                   	push   %esi
+  80453e:	e8 06 c9 ff ff       	call   800e49 <sys_page_map>
+  804543:	89 c3                	mov    %eax,%ebx
+  804545:	83 c4 20             	add    $0x20,%esp
+  804548:	85 c0                	test   %eax,%eax
+  80454a:	79 6a                	jns    8045b6 <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  80454c:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  80454f:	75 50                	jne    8045a1 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804551:	83 ec 08             	sub    $0x8,%esp
+  804554:	68 00 00 40 00       	push   $0x400000
+  804559:	6a fc                	push   $0xfffffffc
+  80455b:	e8 9c f6 ff ff       	call   803bfc <page_out>
+  804560:	83 c4 10             	add    $0x10,%esp
+  804563:	85 c0                	test   %eax,%eax
+  804565:	79 c5                	jns    80452c <page_map+0x4f>
+}
+  804567:	89 d8                	mov    %ebx,%eax
+  804569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80456c:	5b                   	pop    %ebx
+  80456d:	5e                   	pop    %esi
+  80456e:	5f                   	pop    %edi
+  80456f:	5d                   	pop    %ebp
+  804570:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804571:	83 ec 08             	sub    $0x8,%esp
+  804574:	68 00 00 40 00       	push   $0x400000
+  804579:	6a 00                	push   $0x0
+  80457b:	e8 7c f6 ff ff       	call   803bfc <page_out>
+  804580:	83 c4 10             	add    $0x10,%esp
+  804583:	85 c0                	test   %eax,%eax
+  804585:	0f 89 5e ff ff ff    	jns    8044e9 <page_map+0xc>
+				return r;
+  80458b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80458e:	eb d7                	jmp    804567 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804590:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804593:	e8 79 f9 ff ff       	call   803f11 <page_adopt>
+  804598:	85 c0                	test   %eax,%eax
+  80459a:	79 90                	jns    80452c <page_map+0x4f>
+			return r;
+  80459c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80459f:	eb c6                	jmp    804567 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  8045a1:	53                   	push   %ebx
+  8045a2:	68 ac 5e 80 00       	push   $0x805eac
+  8045a7:	68 77 03 00 00       	push   $0x377
+  8045ac:	68 72 5a 80 00       	push   $0x805a72
+  8045b1:	e8 9b bc ff ff       	call   800251 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8045b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8045b9:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8045bc:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8045c3:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8045c9:	0f 84 f5 00 00 00    	je     8046c4 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8045cf:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8045d5:	83 ec 0c             	sub    $0xc,%esp
+  8045d8:	6a 05                	push   $0x5
+  8045da:	68 00 00 40 00       	push   $0x400000
+  8045df:	6a 00                	push   $0x0
+  8045e1:	57                   	push   %edi
+  8045e2:	56                   	push   %esi
+  8045e3:	e8 61 c8 ff ff       	call   800e49 <sys_page_map>
+  8045e8:	89 c3                	mov    %eax,%ebx
+  8045ea:	83 c4 20             	add    $0x20,%esp
+  8045ed:	85 c0                	test   %eax,%eax
+  8045ef:	79 35                	jns    804626 <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  8045f1:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8045f4:	75 1b                	jne    804611 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  8045f6:	83 ec 08             	sub    $0x8,%esp
+  8045f9:	68 00 00 40 00       	push   $0x400000
+  8045fe:	6a 00                	push   $0x0
+  804600:	e8 f7 f5 ff ff       	call   803bfc <page_out>
+  804605:	83 c4 10             	add    $0x10,%esp
+  804608:	85 c0                	test   %eax,%eax
+  80460a:	79 c9                	jns    8045d5 <page_map+0xf8>
+  80460c:	e9 56 ff ff ff       	jmp    804567 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  804611:	53                   	push   %ebx
+  804612:	68 d4 5e 80 00       	push   $0x805ed4
+  804617:	68 83 03 00 00       	push   $0x383
+  80461c:	68 72 5a 80 00       	push   $0x805a72
+  804621:	e8 2b bc ff ff       	call   800251 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  804626:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804629:	c1 e8 0c             	shr    $0xc,%eax
+  80462c:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  804631:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  804638:	01 
+  804639:	0f 84 8d 00 00 00    	je     8046cc <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  80463f:	83 ec 08             	sub    $0x8,%esp
+  804642:	68 00 00 40 00       	push   $0x400000
+  804647:	6a 00                	push   $0x0
+  804649:	e8 3d c8 ff ff       	call   800e8b <sys_page_unmap>
+  80464e:	83 c4 10             	add    $0x10,%esp
+  804651:	85 c0                	test   %eax,%eax
+  804653:	78 36                	js     80468b <page_map+0x1ae>
+  804655:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804658:	83 ec 08             	sub    $0x8,%esp
+  80465b:	57                   	push   %edi
+  80465c:	56                   	push   %esi
+  80465d:	e8 4a fc ff ff       	call   8042ac <page_in>
+  804662:	89 c3                	mov    %eax,%ebx
+  804664:	83 c4 10             	add    $0x10,%esp
+  804667:	85 c0                	test   %eax,%eax
+  804669:	0f 89 7a fe ff ff    	jns    8044e9 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  80466f:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804672:	75 2c                	jne    8046a0 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804674:	83 ec 08             	sub    $0x8,%esp
+  804677:	57                   	push   %edi
+  804678:	6a 00                	push   $0x0
+  80467a:	e8 7d f5 ff ff       	call   803bfc <page_out>
+  80467f:	83 c4 10             	add    $0x10,%esp
+  804682:	85 c0                	test   %eax,%eax
+  804684:	79 d2                	jns    804658 <page_map+0x17b>
+  804686:	e9 dc fe ff ff       	jmp    804567 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  80468b:	50                   	push   %eax
+  80468c:	68 00 5f 80 00       	push   $0x805f00
+  804691:	68 8b 03 00 00       	push   $0x38b
+  804696:	68 72 5a 80 00       	push   $0x805a72
+  80469b:	e8 b1 bb ff ff       	call   800251 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  8046a0:	53                   	push   %ebx
+  8046a1:	68 28 5f 80 00       	push   $0x805f28
+  8046a6:	68 91 03 00 00       	push   $0x391
+  8046ab:	68 72 5a 80 00       	push   $0x805a72
+  8046b0:	e8 9c bb ff ff       	call   800251 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8046b5:	89 c3                	mov    %eax,%ebx
+  8046b7:	e9 ab fe ff ff       	jmp    804567 <page_map+0x8a>
+  8046bc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8046bf:	e9 a3 fe ff ff       	jmp    804567 <page_map+0x8a>
+			return r; // Pass through the error
+  8046c4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8046c7:	e9 9b fe ff ff       	jmp    804567 <page_map+0x8a>
+			return r; // Pass through the error
+  8046cc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8046cf:	e9 93 fe ff ff       	jmp    804567 <page_map+0x8a>
+
+008046d4 <page_map_range>:
+{
+  8046d4:	55                   	push   %ebp
+  8046d5:	89 e5                	mov    %esp,%ebp
+  8046d7:	57                   	push   %edi
+  8046d8:	56                   	push   %esi
+  8046d9:	53                   	push   %ebx
+  8046da:	83 ec 0c             	sub    $0xc,%esp
+  8046dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8046e0:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  8046e3:	83 ec 08             	sub    $0x8,%esp
+  8046e6:	ff 75 1c             	push   0x1c(%ebp)
+  8046e9:	ff 75 18             	push   0x18(%ebp)
+  8046ec:	56                   	push   %esi
+  8046ed:	ff 75 10             	push   0x10(%ebp)
+  8046f0:	57                   	push   %edi
+  8046f1:	ff 75 08             	push   0x8(%ebp)
+  8046f4:	e8 5b c8 ff ff       	call   800f54 <sys_page_map_range>
+  8046f9:	89 c3                	mov    %eax,%ebx
+  8046fb:	83 c4 20             	add    $0x20,%esp
+  8046fe:	85 c0                	test   %eax,%eax
+  804700:	79 1b                	jns    80471d <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804702:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804705:	75 20                	jne    804727 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804707:	83 ec 08             	sub    $0x8,%esp
+  80470a:	68 00 00 40 00       	push   $0x400000
+  80470f:	6a 00                	push   $0x0
+  804711:	e8 e6 f4 ff ff       	call   803bfc <page_out>
+  804716:	83 c4 10             	add    $0x10,%esp
+  804719:	85 c0                	test   %eax,%eax
+  80471b:	79 c6                	jns    8046e3 <page_map_range+0xf>
+}
+  80471d:	89 d8                	mov    %ebx,%eax
+  80471f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804722:	5b                   	pop    %ebx
+  804723:	5e                   	pop    %esi
+  804724:	5f                   	pop    %edi
+  804725:	5d                   	pop    %ebp
+  804726:	c3                   	ret
+		if (r != -E_INVAL)
+  804727:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  80472a:	75 f1                	jne    80471d <page_map_range+0x49>
+  80472c:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  80472e:	be 00 00 00 00       	mov    $0x0,%esi
+  804733:	eb 03                	jmp    804738 <page_map_range+0x64>
+  804735:	83 c6 01             	add    $0x1,%esi
+  804738:	3b 75 18             	cmp    0x18(%ebp),%esi
+  80473b:	74 2a                	je     804767 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  80473d:	83 ec 0c             	sub    $0xc,%esp
+  804740:	ff 75 1c             	push   0x1c(%ebp)
+  804743:	53                   	push   %ebx
+  804744:	ff 75 10             	push   0x10(%ebp)
+  804747:	57                   	push   %edi
+  804748:	ff 75 08             	push   0x8(%ebp)
+  80474b:	e8 8d fd ff ff       	call   8044dd <page_map>
+  804750:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804756:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80475c:	83 c4 20             	add    $0x20,%esp
+  80475f:	85 c0                	test   %eax,%eax
+  804761:	79 d2                	jns    804735 <page_map_range+0x61>
+  804763:	89 c3                	mov    %eax,%ebx
+  804765:	eb b6                	jmp    80471d <page_map_range+0x49>
+		return 0;
+  804767:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80476c:	eb af                	jmp    80471d <page_map_range+0x49>
+
+0080476e <paging_pgfault_handler>:
+{
+  80476e:	55                   	push   %ebp
+  80476f:	89 e5                	mov    %esp,%ebp
+  804771:	56                   	push   %esi
+  804772:	53                   	push   %ebx
+  804773:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804776:	e8 6f e7 ff ff       	call   802eea <find_paging_env>
+	if (pagingenv == 0)
+  80477b:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804780:	85 c0                	test   %eax,%eax
+  804782:	74 3c                	je     8047c0 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804784:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804786:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  80478a:	75 12                	jne    80479e <paging_pgfault_handler+0x30>
+  80478c:	89 f0                	mov    %esi,%eax
+  80478e:	e8 7e f7 ff ff       	call   803f11 <page_adopt>
+  804793:	89 c2                	mov    %eax,%edx
+		return 0;
+  804795:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  80479a:	85 d2                	test   %edx,%edx
+  80479c:	78 22                	js     8047c0 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  80479e:	83 ec 08             	sub    $0x8,%esp
+  8047a1:	6a 00                	push   $0x0
+  8047a3:	56                   	push   %esi
+  8047a4:	e8 a9 f3 ff ff       	call   803b52 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  8047a9:	83 c4 10             	add    $0x10,%esp
+  8047ac:	85 c0                	test   %eax,%eax
+  8047ae:	74 05                	je     8047b5 <paging_pgfault_handler+0x47>
+  8047b0:	f6 00 01             	testb  $0x1,(%eax)
+  8047b3:	75 12                	jne    8047c7 <paging_pgfault_handler+0x59>
+	return 0;
+  8047b5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8047ba:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8047be:	74 23                	je     8047e3 <paging_pgfault_handler+0x75>
+}
+  8047c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8047c3:	5b                   	pop    %ebx
+  8047c4:	5e                   	pop    %esi
+  8047c5:	5d                   	pop    %ebp
+  8047c6:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  8047c7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8047cc:	8b 40 48             	mov    0x48(%eax),%eax
+  8047cf:	83 ec 08             	sub    $0x8,%esp
+  8047d2:	56                   	push   %esi
+  8047d3:	50                   	push   %eax
+  8047d4:	e8 d3 fa ff ff       	call   8042ac <page_in>
+  8047d9:	f7 d0                	not    %eax
+  8047db:	c1 e8 1f             	shr    $0x1f,%eax
+  8047de:	83 c4 10             	add    $0x10,%esp
+  8047e1:	eb dd                	jmp    8047c0 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8047e3:	89 f0                	mov    %esi,%eax
+  8047e5:	e8 97 e2 ff ff       	call   802a81 <segment_lookup>
+  8047ea:	89 c2                	mov    %eax,%edx
+	return 0;
+  8047ec:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8047f1:	85 d2                	test   %edx,%edx
+  8047f3:	74 cb                	je     8047c0 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  8047f5:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8047fa:	8b 40 48             	mov    0x48(%eax),%eax
+  8047fd:	83 ec 08             	sub    $0x8,%esp
+  804800:	56                   	push   %esi
+  804801:	50                   	push   %eax
+  804802:	e8 f5 f3 ff ff       	call   803bfc <page_out>
+  804807:	f7 d0                	not    %eax
+  804809:	c1 e8 1f             	shr    $0x1f,%eax
+  80480c:	83 c4 10             	add    $0x10,%esp
+  80480f:	eb af                	jmp    8047c0 <paging_pgfault_handler+0x52>
+
+00804811 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  804811:	55                   	push   %ebp
+  804812:	89 e5                	mov    %esp,%ebp
+  804814:	57                   	push   %edi
+  804815:	56                   	push   %esi
+  804816:	53                   	push   %ebx
+  804817:	83 ec 2c             	sub    $0x2c,%esp
+  80481a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80481d:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804822:	89 c1                	mov    %eax,%ecx
+  804824:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  804827:	c1 e8 11             	shr    $0x11,%eax
+  80482a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80482d:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  804834:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  804837:	b8 01 00 00 00       	mov    $0x1,%eax
+  80483c:	d3 e0                	shl    %cl,%eax
+  80483e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804841:	85 c7                	test   %eax,%edi
+  804843:	74 12                	je     804857 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804845:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80484a:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  80484d:	bf 01 00 00 00       	mov    $0x1,%edi
+  804852:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804855:	eb 17                	jmp    80486e <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804857:	ff 75 e0             	push   -0x20(%ebp)
+  80485a:	68 60 5f 80 00       	push   $0x805f60
+  80485f:	6a 48                	push   $0x48
+  804861:	68 7a 5f 80 00       	push   $0x805f7a
+  804866:	e8 e6 b9 ff ff       	call   800251 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80486b:	83 c3 01             	add    $0x1,%ebx
+  80486e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804871:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804874:	89 c8                	mov    %ecx,%eax
+  804876:	c1 e8 05             	shr    $0x5,%eax
+  804879:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804880:	89 fe                	mov    %edi,%esi
+  804882:	d3 e6                	shl    %cl,%esi
+  804884:	89 f1                	mov    %esi,%ecx
+  804886:	85 d6                	test   %edx,%esi
+  804888:	74 e1                	je     80486b <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  80488a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  80488d:	f7 d6                	not    %esi
+  80488f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804892:	21 fe                	and    %edi,%esi
+  804894:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804897:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  80489e:	f7 d1                	not    %ecx
+  8048a0:	21 d1                	and    %edx,%ecx
+  8048a2:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  8048a9:	83 ec 04             	sub    $0x4,%esp
+  8048ac:	53                   	push   %ebx
+  8048ad:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8048b0:	57                   	push   %edi
+  8048b1:	6a 00                	push   $0x0
+  8048b3:	e8 97 f8 ff ff       	call   80414f <page_unmap_range>
+	va_free(va, n);
+  8048b8:	83 c4 08             	add    $0x8,%esp
+  8048bb:	53                   	push   %ebx
+  8048bc:	57                   	push   %edi
+  8048bd:	e8 ed 05 00 00       	call   804eaf <va_free>
+}
+  8048c2:	83 c4 10             	add    $0x10,%esp
+  8048c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048c8:	5b                   	pop    %ebx
+  8048c9:	5e                   	pop    %esi
+  8048ca:	5f                   	pop    %edi
+  8048cb:	5d                   	pop    %ebp
+  8048cc:	c3                   	ret
+
+008048cd <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  8048cd:	55                   	push   %ebp
+  8048ce:	89 e5                	mov    %esp,%ebp
+  8048d0:	57                   	push   %edi
+  8048d1:	56                   	push   %esi
+  8048d2:	53                   	push   %ebx
+  8048d3:	83 ec 1c             	sub    $0x1c,%esp
+  8048d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8048d9:	85 db                	test   %ebx,%ebx
+  8048db:	74 34                	je     804911 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  8048dd:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  8048e3:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  8048e8:	77 2f                	ja     804919 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  8048ea:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8048f0:	75 51                	jne    804943 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  8048f2:	89 c1                	mov    %eax,%ecx
+  8048f4:	c1 e9 0c             	shr    $0xc,%ecx
+  8048f7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8048fc:	d3 e2                	shl    %cl,%edx
+  8048fe:	c1 e8 11             	shr    $0x11,%eax
+  804901:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  804908:	75 24                	jne    80492e <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  80490a:	89 d8                	mov    %ebx,%eax
+  80490c:	e8 00 ff ff ff       	call   804811 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804911:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804914:	5b                   	pop    %ebx
+  804915:	5e                   	pop    %esi
+  804916:	5f                   	pop    %edi
+  804917:	5d                   	pop    %ebp
+  804918:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804919:	53                   	push   %ebx
+  80491a:	68 87 5f 80 00       	push   $0x805f87
+  80491f:	68 a2 00 00 00       	push   $0xa2
+  804924:	68 7a 5f 80 00       	push   $0x805f7a
+  804929:	e8 23 b9 ff ff       	call   800251 <_panic>
+			panic("free: %p is not allocated", va);
+  80492e:	53                   	push   %ebx
+  80492f:	68 60 5f 80 00       	push   $0x805f60
+  804934:	68 a5 00 00 00       	push   $0xa5
+  804939:	68 7a 5f 80 00       	push   $0x805f7a
+  80493e:	e8 0e b9 ff ff       	call   800251 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804943:	89 de                	mov    %ebx,%esi
+  804945:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  80494b:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804951:	89 c8                	mov    %ecx,%eax
+  804953:	c1 e8 11             	shr    $0x11,%eax
+  804956:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804959:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  804960:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804963:	c1 e9 0c             	shr    $0xc,%ecx
+  804966:	b8 01 00 00 00       	mov    $0x1,%eax
+  80496b:	d3 e0                	shl    %cl,%eax
+  80496d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804970:	85 c7                	test   %eax,%edi
+  804972:	74 1b                	je     80498f <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804974:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804978:	89 d8                	mov    %ebx,%eax
+  80497a:	29 f0                	sub    %esi,%eax
+  80497c:	83 e8 10             	sub    $0x10,%eax
+  80497f:	99                   	cltd
+  804980:	f7 ff                	idiv   %edi
+  804982:	89 d1                	mov    %edx,%ecx
+  804984:	85 d2                	test   %edx,%edx
+  804986:	75 07                	jne    80498f <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804988:	ba 10 00 00 00       	mov    $0x10,%edx
+  80498d:	eb 18                	jmp    8049a7 <free+0xda>
+		panic("free: %p is not allocated", va);
+  80498f:	53                   	push   %ebx
+  804990:	68 60 5f 80 00       	push   $0x805f60
+  804995:	68 ad 00 00 00       	push   $0xad
+  80499a:	68 7a 5f 80 00       	push   $0x805f7a
+  80499f:	e8 ad b8 ff ff       	call   800251 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8049a4:	83 c1 01             	add    $0x1,%ecx
+  8049a7:	89 d0                	mov    %edx,%eax
+  8049a9:	d3 e0                	shl    %cl,%eax
+  8049ab:	39 c7                	cmp    %eax,%edi
+  8049ad:	7f f5                	jg     8049a4 <free+0xd7>
+	*(void **) va = s->free;
+  8049af:	8b 46 08             	mov    0x8(%esi),%eax
+  8049b2:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8049b4:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8049b7:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8049bb:	8d 58 01             	lea    0x1(%eax),%ebx
+  8049be:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8049c2:	66 85 c0             	test   %ax,%ax
+  8049c5:	74 52                	je     804a19 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8049c7:	0f b7 db             	movzwl %bx,%ebx
+  8049ca:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8049ce:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8049d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049d8:	f7 ff                	idiv   %edi
+  8049da:	39 c3                	cmp    %eax,%ebx
+  8049dc:	0f 85 2f ff ff ff    	jne    804911 <free+0x44>
+  8049e2:	8b 46 04             	mov    0x4(%esi),%eax
+  8049e5:	85 c0                	test   %eax,%eax
+  8049e7:	74 53                	je     804a3c <free+0x16f>
+		s->prev->next = s->next;
+  8049e9:	8b 16                	mov    (%esi),%edx
+  8049eb:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  8049ed:	8b 06                	mov    (%esi),%eax
+  8049ef:	85 c0                	test   %eax,%eax
+  8049f1:	74 06                	je     8049f9 <free+0x12c>
+		s->next->prev = s->prev;
+  8049f3:	8b 56 04             	mov    0x4(%esi),%edx
+  8049f6:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  8049f9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8049fc:	f7 d0                	not    %eax
+  8049fe:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804a01:	21 d0                	and    %edx,%eax
+  804a03:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804a06:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  804a0d:	89 f0                	mov    %esi,%eax
+  804a0f:	e8 fd fd ff ff       	call   804811 <heap_free_pages>
+  804a14:	e9 f8 fe ff ff       	jmp    804911 <free+0x44>
+	s->prev = NULL;
+  804a19:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804a20:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  804a27:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804a29:	85 c0                	test   %eax,%eax
+  804a2b:	74 03                	je     804a30 <free+0x163>
+		slabs[c]->prev = s;
+  804a2d:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804a30:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  804a37:	e9 d5 fe ff ff       	jmp    804911 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804a3c:	8b 06                	mov    (%esi),%eax
+  804a3e:	85 c0                	test   %eax,%eax
+  804a40:	0f 84 cb fe ff ff    	je     804911 <free+0x44>
+		slabs[c] = s->next;
+  804a46:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  804a4d:	8b 06                	mov    (%esi),%eax
+  804a4f:	eb a2                	jmp    8049f3 <free+0x126>
+
+00804a51 <heap_alloc_pages>:
+{
+  804a51:	55                   	push   %ebp
+  804a52:	89 e5                	mov    %esp,%ebp
+  804a54:	57                   	push   %edi
+  804a55:	56                   	push   %esi
+  804a56:	53                   	push   %ebx
+  804a57:	83 ec 18             	sub    $0x18,%esp
+  804a5a:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804a5c:	50                   	push   %eax
+  804a5d:	e8 15 03 00 00       	call   804d77 <va_alloc>
+  804a62:	89 c3                	mov    %eax,%ebx
+  804a64:	83 c4 10             	add    $0x10,%esp
+  804a67:	85 c0                	test   %eax,%eax
+  804a69:	74 47                	je     804ab2 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804a6b:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804a71:	89 c1                	mov    %eax,%ecx
+  804a73:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804a76:	c1 e8 11             	shr    $0x11,%eax
+  804a79:	ba 01 00 00 00       	mov    $0x1,%edx
+  804a7e:	89 d7                	mov    %edx,%edi
+  804a80:	d3 e7                	shl    %cl,%edi
+  804a82:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804a89:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804a8d:	89 c8                	mov    %ecx,%eax
+  804a8f:	c1 e8 05             	shr    $0x5,%eax
+  804a92:	d3 e2                	shl    %cl,%edx
+  804a94:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804a9b:	83 ec 0c             	sub    $0xc,%esp
+  804a9e:	6a 00                	push   $0x0
+  804aa0:	6a 07                	push   $0x7
+  804aa2:	56                   	push   %esi
+  804aa3:	53                   	push   %ebx
+  804aa4:	6a 00                	push   $0x0
+  804aa6:	e8 3a f7 ff ff       	call   8041e5 <page_alloc_range>
+  804aab:	83 c4 20             	add    $0x20,%esp
+  804aae:	85 c0                	test   %eax,%eax
+  804ab0:	78 0a                	js     804abc <heap_alloc_pages+0x6b>
+}
+  804ab2:	89 d8                	mov    %ebx,%eax
+  804ab4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ab7:	5b                   	pop    %ebx
+  804ab8:	5e                   	pop    %esi
+  804ab9:	5f                   	pop    %edi
+  804aba:	5d                   	pop    %ebp
+  804abb:	c3                   	ret
+		free(va);
+  804abc:	83 ec 0c             	sub    $0xc,%esp
+  804abf:	53                   	push   %ebx
+  804ac0:	e8 08 fe ff ff       	call   8048cd <free>
+		return NULL;
+  804ac5:	83 c4 10             	add    $0x10,%esp
+  804ac8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804acd:	eb e3                	jmp    804ab2 <heap_alloc_pages+0x61>
+
+00804acf <malloc>:
+{
+  804acf:	55                   	push   %ebp
+  804ad0:	89 e5                	mov    %esp,%ebp
+  804ad2:	57                   	push   %edi
+  804ad3:	56                   	push   %esi
+  804ad4:	53                   	push   %ebx
+  804ad5:	83 ec 1c             	sub    $0x1c,%esp
+  804ad8:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804adb:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804ade:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804ae4:	0f 87 21 01 00 00    	ja     804c0b <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804aea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804aef:	ba 10 00 00 00       	mov    $0x10,%edx
+  804af4:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804af6:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804afb:	76 15                	jbe    804b12 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804afd:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804b02:	c1 e8 0c             	shr    $0xc,%eax
+  804b05:	e8 47 ff ff ff       	call   804a51 <heap_alloc_pages>
+  804b0a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804b0d:	eb 37                	jmp    804b46 <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804b0f:	83 c1 01             	add    $0x1,%ecx
+  804b12:	89 d6                	mov    %edx,%esi
+  804b14:	d3 e6                	shl    %cl,%esi
+  804b16:	39 c6                	cmp    %eax,%esi
+  804b18:	72 f5                	jb     804b0f <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804b1a:	89 cb                	mov    %ecx,%ebx
+  804b1c:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  804b23:	85 ff                	test   %edi,%edi
+  804b25:	74 2a                	je     804b51 <malloc+0x82>
+	v = s->free;
+  804b27:	8b 47 08             	mov    0x8(%edi),%eax
+  804b2a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804b2d:	8b 00                	mov    (%eax),%eax
+  804b2f:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804b32:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804b36:	83 e8 01             	sub    $0x1,%eax
+  804b39:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804b3d:	66 85 c0             	test   %ax,%ax
+  804b40:	0f 84 9a 00 00 00    	je     804be0 <malloc+0x111>
+}
+  804b46:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804b49:	83 c4 1c             	add    $0x1c,%esp
+  804b4c:	5b                   	pop    %ebx
+  804b4d:	5e                   	pop    %esi
+  804b4e:	5f                   	pop    %edi
+  804b4f:	5d                   	pop    %ebp
+  804b50:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804b51:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b56:	e8 f6 fe ff ff       	call   804a51 <heap_alloc_pages>
+  804b5b:	89 c1                	mov    %eax,%ecx
+  804b5d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804b60:	85 c0                	test   %eax,%eax
+  804b62:	74 e2                	je     804b46 <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804b64:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804b6a:	89 c8                	mov    %ecx,%eax
+  804b6c:	c1 e8 11             	shr    $0x11,%eax
+  804b6f:	c1 e9 0c             	shr    $0xc,%ecx
+  804b72:	ba 01 00 00 00       	mov    $0x1,%edx
+  804b77:	d3 e2                	shl    %cl,%edx
+  804b79:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804b80:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804b83:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804b87:	0f b7 f6             	movzwl %si,%esi
+  804b8a:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b94:	f7 fe                	idiv   %esi
+  804b96:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804b9a:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804b9d:	85 c0                	test   %eax,%eax
+  804b9f:	74 14                	je     804bb5 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804ba1:	83 e8 01             	sub    $0x1,%eax
+  804ba4:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804ba8:	0f af d0             	imul   %eax,%edx
+  804bab:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804baf:	89 3a                	mov    %edi,(%edx)
+  804bb1:	89 d7                	mov    %edx,%edi
+  804bb3:	eb e5                	jmp    804b9a <malloc+0xcb>
+	s->prev = NULL;
+  804bb5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804bb8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804bbf:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  804bc6:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804bc8:	85 c0                	test   %eax,%eax
+  804bca:	74 03                	je     804bcf <malloc+0x100>
+		slabs[c]->prev = s;
+  804bcc:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804bcf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804bd2:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  804bd9:	89 c7                	mov    %eax,%edi
+  804bdb:	e9 47 ff ff ff       	jmp    804b27 <malloc+0x58>
+	if (s->prev)
+  804be0:	8b 47 04             	mov    0x4(%edi),%eax
+  804be3:	85 c0                	test   %eax,%eax
+  804be5:	74 19                	je     804c00 <malloc+0x131>
+		s->prev->next = s->next;
+  804be7:	8b 17                	mov    (%edi),%edx
+  804be9:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804beb:	8b 07                	mov    (%edi),%eax
+  804bed:	85 c0                	test   %eax,%eax
+  804bef:	0f 84 51 ff ff ff    	je     804b46 <malloc+0x77>
+		s->next->prev = s->prev;
+  804bf5:	8b 57 04             	mov    0x4(%edi),%edx
+  804bf8:	89 50 04             	mov    %edx,0x4(%eax)
+  804bfb:	e9 46 ff ff ff       	jmp    804b46 <malloc+0x77>
+		slabs[c] = s->next;
+  804c00:	8b 07                	mov    (%edi),%eax
+  804c02:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  804c09:	eb e0                	jmp    804beb <malloc+0x11c>
+		return NULL;
+  804c0b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804c12:	e9 2f ff ff ff       	jmp    804b46 <malloc+0x77>
+
+00804c17 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804c17:	55                   	push   %ebp
+  804c18:	89 e5                	mov    %esp,%ebp
+  804c1a:	57                   	push   %edi
+  804c1b:	56                   	push   %esi
+  804c1c:	53                   	push   %ebx
+  804c1d:	83 ec 0c             	sub    $0xc,%esp
+  804c20:	89 c6                	mov    %eax,%esi
+  804c22:	89 d7                	mov    %edx,%edi
+  804c24:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804c27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804c2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c31:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  804c36:	83 ef 01             	sub    $0x1,%edi
+  804c39:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804c3c:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804c3f:	eb 34                	jmp    804c75 <va_chunk_scan+0x5e>
+			i += 31;
+  804c41:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804c44:	89 ca                	mov    %ecx,%edx
+			continue;
+  804c46:	eb 23                	jmp    804c6b <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804c48:	89 c7                	mov    %eax,%edi
+  804c4a:	c1 ef 05             	shr    $0x5,%edi
+  804c4d:	be 01 00 00 00       	mov    $0x1,%esi
+  804c52:	d3 e6                	shl    %cl,%esi
+  804c54:	89 f1                	mov    %esi,%ecx
+  804c56:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804c59:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804c5c:	75 41                	jne    804c9f <va_chunk_scan+0x88>
+			len++;
+  804c5e:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804c61:	39 d3                	cmp    %edx,%ebx
+  804c63:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  804c66:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  804c69:	72 2d                	jb     804c98 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804c6b:	83 c0 01             	add    $0x1,%eax
+  804c6e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804c73:	77 31                	ja     804ca6 <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804c75:	89 c1                	mov    %eax,%ecx
+  804c77:	83 e1 1f             	and    $0x1f,%ecx
+  804c7a:	75 cc                	jne    804c48 <va_chunk_scan+0x31>
+  804c7c:	89 c7                	mov    %eax,%edi
+  804c7e:	c1 ef 05             	shr    $0x5,%edi
+  804c81:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804c84:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  804c87:	83 ff ff             	cmp    $0xffffffff,%edi
+  804c8a:	74 b5                	je     804c41 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  804c8c:	85 ff                	test   %edi,%edi
+  804c8e:	75 b8                	jne    804c48 <va_chunk_scan+0x31>
+			i += 31;
+  804c90:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  804c93:	83 c2 20             	add    $0x20,%edx
+  804c96:	eb c9                	jmp    804c61 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  804c98:	83 c0 01             	add    $0x1,%eax
+  804c9b:	29 d0                	sub    %edx,%eax
+  804c9d:	eb 15                	jmp    804cb4 <va_chunk_scan+0x9d>
+			len = 0;
+  804c9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ca4:	eb c5                	jmp    804c6b <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  804ca6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  804cab:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  804cae:	85 d2                	test   %edx,%edx
+  804cb0:	74 02                	je     804cb4 <va_chunk_scan+0x9d>
+		*run_store = best;
+  804cb2:	89 1a                	mov    %ebx,(%edx)
+}
+  804cb4:	83 c4 0c             	add    $0xc,%esp
+  804cb7:	5b                   	pop    %ebx
+  804cb8:	5e                   	pop    %esi
+  804cb9:	5f                   	pop    %edi
+  804cba:	5d                   	pop    %ebp
+  804cbb:	c3                   	ret
+
+00804cbc <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  804cbc:	55                   	push   %ebp
+  804cbd:	89 e5                	mov    %esp,%ebp
+  804cbf:	57                   	push   %edi
+  804cc0:	56                   	push   %esi
+  804cc1:	53                   	push   %ebx
+  804cc2:	83 ec 14             	sub    $0x14,%esp
+  804cc5:	89 c3                	mov    %eax,%ebx
+  804cc7:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804cc9:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804ccf:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  804cd5:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804cd8:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804cdb:	89 d6                	mov    %edx,%esi
+  804cdd:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  804ce3:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804ce5:	eb 34                	jmp    804d1b <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804ce7:	89 c8                	mov    %ecx,%eax
+  804ce9:	c1 e8 05             	shr    $0x5,%eax
+  804cec:	89 da                	mov    %ebx,%edx
+  804cee:	c1 e2 05             	shl    $0x5,%edx
+  804cf1:	01 da                	add    %ebx,%edx
+  804cf3:	01 c2                	add    %eax,%edx
+  804cf5:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804cfa:	d3 c0                	rol    %cl,%eax
+  804cfc:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804d03:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804d0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  804d0f:	01 d0                	add    %edx,%eax
+  804d11:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804d18:	83 c1 01             	add    $0x1,%ecx
+  804d1b:	39 f9                	cmp    %edi,%ecx
+  804d1d:	74 30                	je     804d4f <va_chunk_mark+0x93>
+		if (alloc)
+  804d1f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804d23:	74 c2                	je     804ce7 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804d25:	89 c8                	mov    %ecx,%eax
+  804d27:	c1 e8 05             	shr    $0x5,%eax
+  804d2a:	89 da                	mov    %ebx,%edx
+  804d2c:	c1 e2 05             	shl    $0x5,%edx
+  804d2f:	01 da                	add    %ebx,%edx
+  804d31:	01 c2                	add    %eax,%edx
+  804d33:	b8 01 00 00 00       	mov    $0x1,%eax
+  804d38:	d3 e0                	shl    %cl,%eax
+  804d3a:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804d41:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804d48:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804d4d:	eb c0                	jmp    804d0f <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804d4f:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d57:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804d5a:	e8 b8 fe ff ff       	call   804c17 <va_chunk_scan>
+	ch->run = run;
+  804d5f:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804d65:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804d68:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804d6f:	83 c4 14             	add    $0x14,%esp
+  804d72:	5b                   	pop    %ebx
+  804d73:	5e                   	pop    %esi
+  804d74:	5f                   	pop    %edi
+  804d75:	5d                   	pop    %ebp
+  804d76:	c3                   	ret
+
+00804d77 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804d77:	55                   	push   %ebp
+  804d78:	89 e5                	mov    %esp,%ebp
+  804d7a:	57                   	push   %edi
+  804d7b:	56                   	push   %esi
+  804d7c:	53                   	push   %ebx
+  804d7d:	83 ec 04             	sub    $0x4,%esp
+  804d80:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804d83:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804d88:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804d8d:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804d94:	74 4f                	je     804de5 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804d96:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804d99:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804d9e:	0f 87 01 01 00 00    	ja     804ea5 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804da4:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804daa:	0f 87 80 00 00 00    	ja     804e30 <va_alloc+0xb9>
+  804db0:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804db5:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804dba:	0f b7 10             	movzwl (%eax),%edx
+  804dbd:	05 84 00 00 00       	add    $0x84,%eax
+  804dc2:	39 da                	cmp    %ebx,%edx
+  804dc4:	73 2c                	jae    804df2 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804dc6:	83 c6 01             	add    $0x1,%esi
+  804dc9:	83 fe 1c             	cmp    $0x1c,%esi
+  804dcc:	75 ec                	jne    804dba <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804dce:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dd3:	eb 53                	jmp    804e28 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804dd5:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804ddb:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804de0:	05 84 00 00 00       	add    $0x84,%eax
+  804de5:	39 d0                	cmp    %edx,%eax
+  804de7:	75 ec                	jne    804dd5 <va_alloc+0x5e>
+	va_inited = 1;
+  804de9:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  804df0:	eb a4                	jmp    804d96 <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804df2:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804df8:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  804dfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804e02:	89 da                	mov    %ebx,%edx
+  804e04:	e8 0e fe ff ff       	call   804c17 <va_chunk_scan>
+  804e09:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804e0b:	6a 01                	push   $0x1
+  804e0d:	89 d9                	mov    %ebx,%ecx
+  804e0f:	89 c2                	mov    %eax,%edx
+  804e11:	89 f0                	mov    %esi,%eax
+  804e13:	e8 a4 fe ff ff       	call   804cbc <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804e18:	c1 e6 16             	shl    $0x16,%esi
+  804e1b:	c1 e7 0c             	shl    $0xc,%edi
+  804e1e:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804e25:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e2b:	5b                   	pop    %ebx
+  804e2c:	5e                   	pop    %esi
+  804e2d:	5f                   	pop    %edi
+  804e2e:	5d                   	pop    %ebp
+  804e2f:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804e30:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804e36:	c1 ee 0a             	shr    $0xa,%esi
+  804e39:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e43:	eb 0a                	jmp    804e4f <va_alloc+0xd8>
+			first = c + 1;
+  804e45:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804e47:	83 c2 01             	add    $0x1,%edx
+  804e4a:	83 fa 1d             	cmp    $0x1d,%edx
+  804e4d:	74 4f                	je     804e9e <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804e4f:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804e55:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  804e5c:	00 04 
+  804e5e:	75 e5                	jne    804e45 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804e60:	89 d1                	mov    %edx,%ecx
+  804e62:	29 c1                	sub    %eax,%ecx
+  804e64:	39 f1                	cmp    %esi,%ecx
+  804e66:	75 df                	jne    804e47 <va_alloc+0xd0>
+  804e68:	89 c7                	mov    %eax,%edi
+  804e6a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804e6d:	be 00 04 00 00       	mov    $0x400,%esi
+  804e72:	39 f3                	cmp    %esi,%ebx
+  804e74:	0f 46 f3             	cmovbe %ebx,%esi
+  804e77:	6a 01                	push   $0x1
+  804e79:	89 f1                	mov    %esi,%ecx
+  804e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e80:	89 f8                	mov    %edi,%eax
+  804e82:	e8 35 fe ff ff       	call   804cbc <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804e87:	83 c7 01             	add    $0x1,%edi
+  804e8a:	83 c4 04             	add    $0x4,%esp
+  804e8d:	29 f3                	sub    %esi,%ebx
+  804e8f:	75 dc                	jne    804e6d <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804e91:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804e94:	c1 e0 16             	shl    $0x16,%eax
+  804e97:	05 00 00 00 08       	add    $0x8000000,%eax
+  804e9c:	eb 8a                	jmp    804e28 <va_alloc+0xb1>
+	return NULL;
+  804e9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ea3:	eb 83                	jmp    804e28 <va_alloc+0xb1>
+		return NULL;
+  804ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eaa:	e9 79 ff ff ff       	jmp    804e28 <va_alloc+0xb1>
+
+00804eaf <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804eaf:	55                   	push   %ebp
+  804eb0:	89 e5                	mov    %esp,%ebp
+  804eb2:	57                   	push   %edi
+  804eb3:	56                   	push   %esi
+  804eb4:	53                   	push   %ebx
+  804eb5:	83 ec 0c             	sub    $0xc,%esp
+  804eb8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804ebb:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804ebe:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804ec4:	76 21                	jbe    804ee7 <va_free+0x38>
+  804ec6:	89 f0                	mov    %esi,%eax
+  804ec8:	c1 e0 0c             	shl    $0xc,%eax
+  804ecb:	01 f8                	add    %edi,%eax
+  804ecd:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804ed2:	77 13                	ja     804ee7 <va_free+0x38>
+	    || PGOFF(va))
+  804ed4:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804eda:	75 0b                	jne    804ee7 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804edc:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804ee2:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804ee5:	eb 45                	jmp    804f2c <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804ee7:	83 ec 0c             	sub    $0xc,%esp
+  804eea:	56                   	push   %esi
+  804eeb:	57                   	push   %edi
+  804eec:	68 a4 5f 80 00       	push   $0x805fa4
+  804ef1:	68 8e 00 00 00       	push   $0x8e
+  804ef6:	68 c4 5f 80 00       	push   $0x805fc4
+  804efb:	e8 51 b3 ff ff       	call   800251 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804f00:	89 fa                	mov    %edi,%edx
+  804f02:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804f08:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804f0d:	29 d3                	sub    %edx,%ebx
+  804f0f:	39 f3                	cmp    %esi,%ebx
+  804f11:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804f14:	89 f8                	mov    %edi,%eax
+  804f16:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804f19:	83 ec 0c             	sub    $0xc,%esp
+  804f1c:	6a 00                	push   $0x0
+  804f1e:	89 d9                	mov    %ebx,%ecx
+  804f20:	e8 97 fd ff ff       	call   804cbc <va_chunk_mark>
+		i += n;
+  804f25:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804f27:	29 de                	sub    %ebx,%esi
+  804f29:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804f2c:	85 f6                	test   %esi,%esi
+  804f2e:	75 d0                	jne    804f00 <va_free+0x51>
+	}
+}
+  804f30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f33:	5b                   	pop    %ebx
+  804f34:	5e                   	pop    %esi
+  804f35:	5f                   	pop    %edi
+  804f36:	5d                   	pop    %ebp
+  804f37:	c3                   	ret
+
+00804f38 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804f38:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f3d:	c3                   	ret
+
+00804f3e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804f3e:	55                   	push   %ebp
+  804f3f:	89 e5                	mov    %esp,%ebp
+  804f41:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804f44:	68 d1 5f 80 00       	push   $0x805fd1
+  804f49:	ff 75 0c             	push   0xc(%ebp)
+  804f4c:	e8 c2 b9 ff ff       	call   800913 <strcpy>
+	return 0;
+}
+  804f51:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f56:	c9                   	leave
+  804f57:	c3                   	ret
+
+00804f58 <devcons_write>:
+{
+  804f58:	55                   	push   %ebp
+  804f59:	89 e5                	mov    %esp,%ebp
+  804f5b:	57                   	push   %edi
+  804f5c:	56                   	push   %esi
+  804f5d:	53                   	push   %ebx
+  804f5e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804f64:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804f69:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804f6f:	eb 2e                	jmp    804f9f <devcons_write+0x47>
+		m = n - tot;
+  804f71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804f74:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804f76:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804f7b:	39 c3                	cmp    %eax,%ebx
+  804f7d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804f80:	83 ec 04             	sub    $0x4,%esp
+  804f83:	53                   	push   %ebx
+  804f84:	89 f0                	mov    %esi,%eax
+  804f86:	03 45 0c             	add    0xc(%ebp),%eax
+  804f89:	50                   	push   %eax
+  804f8a:	57                   	push   %edi
+  804f8b:	e8 09 bb ff ff       	call   800a99 <memmove>
+		sys_cputs(buf, m);
+  804f90:	83 c4 08             	add    $0x8,%esp
+  804f93:	53                   	push   %ebx
+  804f94:	57                   	push   %edi
+  804f95:	e8 9f bd ff ff       	call   800d39 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804f9a:	01 de                	add    %ebx,%esi
+  804f9c:	83 c4 10             	add    $0x10,%esp
+  804f9f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804fa2:	72 cd                	jb     804f71 <devcons_write+0x19>
+}
+  804fa4:	89 f0                	mov    %esi,%eax
+  804fa6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804fa9:	5b                   	pop    %ebx
+  804faa:	5e                   	pop    %esi
+  804fab:	5f                   	pop    %edi
+  804fac:	5d                   	pop    %ebp
+  804fad:	c3                   	ret
+
+00804fae <devcons_read>:
+{
+  804fae:	55                   	push   %ebp
+  804faf:	89 e5                	mov    %esp,%ebp
+  804fb1:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fb9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804fbd:	75 07                	jne    804fc6 <devcons_read+0x18>
+  804fbf:	eb 1f                	jmp    804fe0 <devcons_read+0x32>
+		sys_yield();
+  804fc1:	e8 21 be ff ff       	call   800de7 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804fc6:	e8 9d bd ff ff       	call   800d68 <sys_cgetc>
+  804fcb:	85 c0                	test   %eax,%eax
+  804fcd:	74 f2                	je     804fc1 <devcons_read+0x13>
+	if (c < 0)
+  804fcf:	78 0f                	js     804fe0 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804fd1:	83 f8 04             	cmp    $0x4,%eax
+  804fd4:	74 0c                	je     804fe2 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804fd6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804fd9:	88 02                	mov    %al,(%edx)
+	return 1;
+  804fdb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804fe0:	c9                   	leave
+  804fe1:	c3                   	ret
+		return 0;
+  804fe2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fe7:	eb f7                	jmp    804fe0 <devcons_read+0x32>
+
+00804fe9 <cputchar>:
+{
+  804fe9:	55                   	push   %ebp
+  804fea:	89 e5                	mov    %esp,%ebp
+  804fec:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804fef:	8b 45 08             	mov    0x8(%ebp),%eax
+  804ff2:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804ff5:	6a 01                	push   $0x1
+  804ff7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804ffa:	50                   	push   %eax
+  804ffb:	e8 39 bd ff ff       	call   800d39 <sys_cputs>
+}
+  805000:	83 c4 10             	add    $0x10,%esp
+  805003:	c9                   	leave
+  805004:	c3                   	ret
+
+00805005 <getchar>:
+{
+  805005:	55                   	push   %ebp
+  805006:	89 e5                	mov    %esp,%ebp
+  805008:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80500b:	6a 01                	push   $0x1
+  80500d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  805010:	50                   	push   %eax
+  805011:	6a 00                	push   $0x0
+  805013:	e8 99 ce ff ff       	call   801eb1 <read>
+	if (r < 0)
+  805018:	83 c4 10             	add    $0x10,%esp
+  80501b:	85 c0                	test   %eax,%eax
+  80501d:	78 06                	js     805025 <getchar+0x20>
+	if (r < 1)
+  80501f:	74 06                	je     805027 <getchar+0x22>
+	return c;
+  805021:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  805025:	c9                   	leave
+  805026:	c3                   	ret
+		return -E_EOF;
+  805027:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80502c:	eb f7                	jmp    805025 <getchar+0x20>
+
+0080502e <iscons>:
+{
+  80502e:	55                   	push   %ebp
+  80502f:	89 e5                	mov    %esp,%ebp
+  805031:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805034:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805037:	50                   	push   %eax
+  805038:	ff 75 08             	push   0x8(%ebp)
+  80503b:	e8 12 cc ff ff       	call   801c52 <fd_lookup>
+  805040:	83 c4 10             	add    $0x10,%esp
+  805043:	85 c0                	test   %eax,%eax
+  805045:	78 11                	js     805058 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  805047:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80504a:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  805050:	39 10                	cmp    %edx,(%eax)
+  805052:	0f 94 c0             	sete   %al
+  805055:	0f b6 c0             	movzbl %al,%eax
+}
+  805058:	c9                   	leave
+  805059:	c3                   	ret
+
+0080505a <opencons>:
+{
+  80505a:	55                   	push   %ebp
+  80505b:	89 e5                	mov    %esp,%ebp
+  80505d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  805060:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805063:	50                   	push   %eax
+  805064:	e8 95 cb ff ff       	call   801bfe <fd_alloc>
+  805069:	83 c4 10             	add    $0x10,%esp
+  80506c:	85 c0                	test   %eax,%eax
+  80506e:	78 3a                	js     8050aa <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805070:	83 ec 04             	sub    $0x4,%esp
+  805073:	68 07 04 00 00       	push   $0x407
+  805078:	ff 75 f4             	push   -0xc(%ebp)
+  80507b:	6a 00                	push   $0x0
+  80507d:	e8 84 bd ff ff       	call   800e06 <sys_page_alloc>
+  805082:	83 c4 10             	add    $0x10,%esp
+  805085:	85 c0                	test   %eax,%eax
+  805087:	78 21                	js     8050aa <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  805089:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80508c:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  805092:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  805094:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805097:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80509e:	83 ec 0c             	sub    $0xc,%esp
+  8050a1:	50                   	push   %eax
+  8050a2:	e8 30 cb ff ff       	call   801bd7 <fd2num>
+  8050a7:	83 c4 10             	add    $0x10,%esp
+}
+  8050aa:	c9                   	leave
+  8050ab:	c3                   	ret
+
+008050ac <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  8050ac:	55                   	push   %ebp
+  8050ad:	89 e5                	mov    %esp,%ebp
+  8050af:	56                   	push   %esi
+  8050b0:	53                   	push   %ebx
+  8050b1:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8050b4:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  8050b9:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8050bc:	85 db                	test   %ebx,%ebx
+  8050be:	78 17                	js     8050d7 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  8050c0:	83 ec 0c             	sub    $0xc,%esp
+  8050c3:	56                   	push   %esi
+  8050c4:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  8050cb:	83 c4 10             	add    $0x10,%esp
+  8050ce:	85 c0                	test   %eax,%eax
+  8050d0:	75 27                	jne    8050f9 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8050d2:	83 eb 01             	sub    $0x1,%ebx
+  8050d5:	eb e5                	jmp    8050bc <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  8050d7:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050dc:	8b 40 48             	mov    0x48(%eax),%eax
+  8050df:	83 ec 08             	sub    $0x8,%esp
+  8050e2:	ff 76 28             	push   0x28(%esi)
+  8050e5:	ff 36                	push   (%esi)
+  8050e7:	50                   	push   %eax
+  8050e8:	68 e0 5f 80 00       	push   $0x805fe0
+  8050ed:	6a 1d                	push   $0x1d
+  8050ef:	68 03 60 80 00       	push   $0x806003
+  8050f4:	e8 58 b1 ff ff       	call   800251 <_panic>
+}
+  8050f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8050fc:	5b                   	pop    %ebx
+  8050fd:	5e                   	pop    %esi
+  8050fe:	5d                   	pop    %ebp
+  8050ff:	c3                   	ret
+
+00805100 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  805100:	55                   	push   %ebp
+  805101:	89 e5                	mov    %esp,%ebp
+  805103:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  805106:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  80510d:	74 0a                	je     805119 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  80510f:	8b 45 08             	mov    0x8(%ebp),%eax
+  805112:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  805117:	c9                   	leave
+  805118:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  805119:	83 ec 04             	sub    $0x4,%esp
+  80511c:	6a 07                	push   $0x7
+  80511e:	68 00 f0 bf ee       	push   $0xeebff000
+  805123:	6a 00                	push   $0x0
+  805125:	e8 dc bc ff ff       	call   800e06 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  80512a:	83 c4 08             	add    $0x8,%esp
+  80512d:	68 a0 51 80 00       	push   $0x8051a0
+  805132:	6a 00                	push   $0x0
+  805134:	e8 33 c0 ff ff       	call   80116c <sys_env_set_pgfault_upcall>
+  805139:	83 c4 10             	add    $0x10,%esp
+  80513c:	eb d1                	jmp    80510f <set_pgfault_handler+0xf>
+
+0080513e <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  80513e:	55                   	push   %ebp
+  80513f:	89 e5                	mov    %esp,%ebp
+  805141:	83 ec 08             	sub    $0x8,%esp
+  805144:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  805147:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  80514d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805152:	eb 03                	jmp    805157 <add_pgfault_handler+0x19>
+  805154:	83 c0 01             	add    $0x1,%eax
+  805157:	39 d0                	cmp    %edx,%eax
+  805159:	74 0b                	je     805166 <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  80515b:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  805162:	75 f0                	jne    805154 <add_pgfault_handler+0x16>
+  805164:	eb 24                	jmp    80518a <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  805166:	83 fa 0a             	cmp    $0xa,%edx
+  805169:	74 21                	je     80518c <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  80516b:	8d 42 01             	lea    0x1(%edx),%eax
+  80516e:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  805173:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  80517a:	83 ec 0c             	sub    $0xc,%esp
+  80517d:	68 ac 50 80 00       	push   $0x8050ac
+  805182:	e8 79 ff ff ff       	call   805100 <set_pgfault_handler>
+  805187:	83 c4 10             	add    $0x10,%esp
+}
+  80518a:	c9                   	leave
+  80518b:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  80518c:	83 ec 04             	sub    $0x4,%esp
+  80518f:	68 11 60 80 00       	push   $0x806011
+  805194:	6a 44                	push   $0x44
+  805196:	68 03 60 80 00       	push   $0x806003
+  80519b:	e8 b1 b0 ff ff       	call   800251 <_panic>
+
+008051a0 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8051a0:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8051a1:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  8051a6:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8051a8:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  8051ab:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  8051af:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  8051b3:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  8051b6:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  8051b8:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  8051bc:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  8051bf:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  8051c0:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  8051c3:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  8051c4:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8051c5:	c3                   	ret
+
+008051c6 <udivmod>:
+  8051c6:	55                   	push   %ebp
+  8051c7:	57                   	push   %edi
+  8051c8:	56                   	push   %esi
+  8051c9:	53                   	push   %ebx
+  8051ca:	83 ec 24             	sub    $0x24,%esp
+  8051cd:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8051d1:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8051d5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8051d9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8051dd:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8051e1:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8051e5:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8051e9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8051ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051f8:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8051ff:	00 
+  805200:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805207:	00 
+  805208:	89 fb                	mov    %edi,%ebx
+  80520a:	eb 08                	jmp    805214 <udivmod+0x4e>
+  80520c:	83 e9 01             	sub    $0x1,%ecx
+  80520f:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805212:	74 68                	je     80527c <udivmod+0xb6>
+  805214:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805218:	01 c0                	add    %eax,%eax
+  80521a:	89 c6                	mov    %eax,%esi
+  80521c:	89 d7                	mov    %edx,%edi
+  80521e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805222:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805226:	0f ad d0             	shrd   %cl,%edx,%eax
+  805229:	d3 ea                	shr    %cl,%edx
+  80522b:	f6 c1 20             	test   $0x20,%cl
+  80522e:	74 04                	je     805234 <udivmod+0x6e>
+  805230:	89 d0                	mov    %edx,%eax
+  805232:	31 d2                	xor    %edx,%edx
+  805234:	83 e0 01             	and    $0x1,%eax
+  805237:	89 04 24             	mov    %eax,(%esp)
+  80523a:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805241:	00 
+  805242:	8b 04 24             	mov    (%esp),%eax
+  805245:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805249:	09 f0                	or     %esi,%eax
+  80524b:	09 fa                	or     %edi,%edx
+  80524d:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805251:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805255:	39 f0                	cmp    %esi,%eax
+  805257:	89 d5                	mov    %edx,%ebp
+  805259:	19 fd                	sbb    %edi,%ebp
+  80525b:	72 af                	jb     80520c <udivmod+0x46>
+  80525d:	29 f0                	sub    %esi,%eax
+  80525f:	19 fa                	sbb    %edi,%edx
+  805261:	89 cf                	mov    %ecx,%edi
+  805263:	c1 ef 05             	shr    $0x5,%edi
+  805266:	83 e7 01             	and    $0x1,%edi
+  805269:	89 fe                	mov    %edi,%esi
+  80526b:	83 f6 01             	xor    $0x1,%esi
+  80526e:	d3 e6                	shl    %cl,%esi
+  805270:	d3 e7                	shl    %cl,%edi
+  805272:	09 74 24 18          	or     %esi,0x18(%esp)
+  805276:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80527a:	eb 90                	jmp    80520c <udivmod+0x46>
+  80527c:	85 db                	test   %ebx,%ebx
+  80527e:	74 05                	je     805285 <udivmod+0xbf>
+  805280:	89 03                	mov    %eax,(%ebx)
+  805282:	89 53 04             	mov    %edx,0x4(%ebx)
+  805285:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805289:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80528d:	83 c4 24             	add    $0x24,%esp
+  805290:	5b                   	pop    %ebx
+  805291:	5e                   	pop    %esi
+  805292:	5f                   	pop    %edi
+  805293:	5d                   	pop    %ebp
+  805294:	c3                   	ret
+
+00805295 <__udivdi3>:
+  805295:	83 ec 08             	sub    $0x8,%esp
+  805298:	6a 00                	push   $0x0
+  80529a:	ff 74 24 1c          	push   0x1c(%esp)
+  80529e:	ff 74 24 1c          	push   0x1c(%esp)
+  8052a2:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8052a6:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8052aa:	e8 17 ff ff ff       	call   8051c6 <udivmod>
+  8052af:	83 c4 14             	add    $0x14,%esp
+  8052b2:	c3                   	ret
+
+008052b3 <__umoddi3>:
+  8052b3:	83 ec 18             	sub    $0x18,%esp
+  8052b6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8052ba:	50                   	push   %eax
+  8052bb:	ff 74 24 2c          	push   0x2c(%esp)
+  8052bf:	ff 74 24 2c          	push   0x2c(%esp)
+  8052c3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8052c7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8052cb:	e8 f6 fe ff ff       	call   8051c6 <udivmod>
+  8052d0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8052d4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8052d8:	83 c4 24             	add    $0x24,%esp
+  8052db:	c3                   	ret
+
+008052dc <__divdi3>:
+  8052dc:	55                   	push   %ebp
+  8052dd:	57                   	push   %edi
+  8052de:	56                   	push   %esi
+  8052df:	53                   	push   %ebx
+  8052e0:	83 ec 10             	sub    $0x10,%esp
+  8052e3:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8052e7:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8052eb:	89 c6                	mov    %eax,%esi
+  8052ed:	89 d7                	mov    %edx,%edi
+  8052ef:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8052f3:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8052f7:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8052fb:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8052ff:	89 c5                	mov    %eax,%ebp
+  805301:	f7 dd                	neg    %ebp
+  805303:	89 d6                	mov    %edx,%esi
+  805305:	83 d6 00             	adc    $0x0,%esi
+  805308:	f7 de                	neg    %esi
+  80530a:	0f 48 e8             	cmovs  %eax,%ebp
+  80530d:	0f 49 d6             	cmovns %esi,%edx
+  805310:	6a 00                	push   $0x0
+  805312:	8b 74 24 30          	mov    0x30(%esp),%esi
+  805316:	f7 de                	neg    %esi
+  805318:	8b 44 24 34          	mov    0x34(%esp),%eax
+  80531c:	83 d0 00             	adc    $0x0,%eax
+  80531f:	f7 d8                	neg    %eax
+  805321:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  805326:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  80532b:	50                   	push   %eax
+  80532c:	56                   	push   %esi
+  80532d:	89 e8                	mov    %ebp,%eax
+  80532f:	e8 92 fe ff ff       	call   8051c6 <udivmod>
+  805334:	83 c4 10             	add    $0x10,%esp
+  805337:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  80533c:	78 08                	js     805346 <__divdi3+0x6a>
+  80533e:	83 c4 0c             	add    $0xc,%esp
+  805341:	5b                   	pop    %ebx
+  805342:	5e                   	pop    %esi
+  805343:	5f                   	pop    %edi
+  805344:	5d                   	pop    %ebp
+  805345:	c3                   	ret
+  805346:	f7 d8                	neg    %eax
+  805348:	83 d2 00             	adc    $0x0,%edx
+  80534b:	f7 da                	neg    %edx
+  80534d:	eb ef                	jmp    80533e <__divdi3+0x62>
+
+0080534f <__moddi3>:
+  80534f:	55                   	push   %ebp
+  805350:	57                   	push   %edi
+  805351:	56                   	push   %esi
+  805352:	53                   	push   %ebx
+  805353:	83 ec 18             	sub    $0x18,%esp
+  805356:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80535a:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  80535e:	89 f1                	mov    %esi,%ecx
+  805360:	f7 d9                	neg    %ecx
+  805362:	89 da                	mov    %ebx,%edx
+  805364:	83 d2 00             	adc    $0x0,%edx
+  805367:	f7 da                	neg    %edx
+  805369:	0f 48 ce             	cmovs  %esi,%ecx
+  80536c:	0f 48 d3             	cmovs  %ebx,%edx
+  80536f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805373:	50                   	push   %eax
+  805374:	8b 74 24 38          	mov    0x38(%esp),%esi
+  805378:	f7 de                	neg    %esi
+  80537a:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  80537e:	83 d0 00             	adc    $0x0,%eax
+  805381:	f7 d8                	neg    %eax
+  805383:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  805388:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  80538d:	50                   	push   %eax
+  80538e:	56                   	push   %esi
+  80538f:	89 c8                	mov    %ecx,%eax
+  805391:	e8 30 fe ff ff       	call   8051c6 <udivmod>
+  805396:	83 c4 10             	add    $0x10,%esp
+  805399:	85 db                	test   %ebx,%ebx
+  80539b:	78 10                	js     8053ad <__moddi3+0x5e>
+  80539d:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8053a1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8053a5:	83 c4 14             	add    $0x14,%esp
+  8053a8:	5b                   	pop    %ebx
+  8053a9:	5e                   	pop    %esi
+  8053aa:	5f                   	pop    %edi
+  8053ab:	5d                   	pop    %ebp
+  8053ac:	c3                   	ret
+  8053ad:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8053b1:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8053b5:	f7 d8                	neg    %eax
+  8053b7:	83 d2 00             	adc    $0x0,%edx
+  8053ba:	f7 da                	neg    %edx
+  8053bc:	eb e7                	jmp    8053a5 <__moddi3+0x56>
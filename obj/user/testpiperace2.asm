@@ -0,0 +1,10592 @@
+
+obj/user/testpiperace2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 01 00 00       	call   8001d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 28             	sub    $0x28,%esp
+	int p[2], r, i;
+	struct Fd *fd;
+	const volatile struct Env *kid;
+
+	cprintf("testing for pipeisclosed race...\n");
+  80003c:	68 c0 53 80 00       	push   $0x8053c0
+  800041:	e8 ca 02 00 00       	call   800310 <cprintf>
+	if ((r = pipe(p)) < 0)
+  800046:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800049:	89 04 24             	mov    %eax,(%esp)
+  80004c:	e8 d7 25 00 00       	call   802628 <pipe>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 5d                	js     8000b5 <umain+0x82>
+		panic("pipe: %e", r);
+	if ((r = fork()) < 0)
+  800058:	e8 74 14 00 00       	call   8014d1 <fork>
+  80005d:	89 c7                	mov    %eax,%edi
+  80005f:	85 c0                	test   %eax,%eax
+  800061:	78 64                	js     8000c7 <umain+0x94>
+		panic("fork: %e", r);
+	if (r == 0) {
+  800063:	74 74                	je     8000d9 <umain+0xa6>
+	// pageref(p[0]) and gets 3, then it will return true when
+	// it shouldn't.
+	//
+	// So either way, pipeisclosed is going give a wrong answer.
+	//
+	kid = &envs[ENVX(r)];
+  800065:	89 f8                	mov    %edi,%eax
+  800067:	25 ff 03 00 00       	and    $0x3ff,%eax
+	while (kid->env_status == ENV_RUNNABLE)
+  80006c:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  80006f:	c1 e3 06             	shl    $0x6,%ebx
+  800072:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  800078:	8b 43 54             	mov    0x54(%ebx),%eax
+  80007b:	83 f8 02             	cmp    $0x2,%eax
+  80007e:	0f 85 d1 00 00 00    	jne    800155 <umain+0x122>
+		if (pipeisclosed(p[0]) != 0) {
+  800084:	83 ec 0c             	sub    $0xc,%esp
+  800087:	ff 75 e0             	push   -0x20(%ebp)
+  80008a:	e8 e3 26 00 00       	call   802772 <pipeisclosed>
+  80008f:	83 c4 10             	add    $0x10,%esp
+  800092:	85 c0                	test   %eax,%eax
+  800094:	74 e2                	je     800078 <umain+0x45>
+			cprintf("\nRACE: pipe appears closed\n");
+  800096:	83 ec 0c             	sub    $0xc,%esp
+  800099:	68 39 54 80 00       	push   $0x805439
+  80009e:	e8 6d 02 00 00       	call   800310 <cprintf>
+			sys_env_destroy(r);
+  8000a3:	89 3c 24             	mov    %edi,(%esp)
+  8000a6:	e8 c0 0c 00 00       	call   800d6b <sys_env_destroy>
+			exit();
+  8000ab:	e8 6b 01 00 00       	call   80021b <exit>
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	eb c3                	jmp    800078 <umain+0x45>
+		panic("pipe: %e", r);
+  8000b5:	50                   	push   %eax
+  8000b6:	68 0e 54 80 00       	push   $0x80540e
+  8000bb:	6a 0d                	push   $0xd
+  8000bd:	68 17 54 80 00       	push   $0x805417
+  8000c2:	e8 6e 01 00 00       	call   800235 <_panic>
+		panic("fork: %e", r);
+  8000c7:	50                   	push   %eax
+  8000c8:	68 2c 54 80 00       	push   $0x80542c
+  8000cd:	6a 0f                	push   $0xf
+  8000cf:	68 17 54 80 00       	push   $0x805417
+  8000d4:	e8 5c 01 00 00       	call   800235 <_panic>
+		close(p[1]);
+  8000d9:	83 ec 0c             	sub    $0xc,%esp
+  8000dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8000df:	e8 f3 19 00 00       	call   801ad7 <close>
+  8000e4:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < 200; i++) {
+  8000e7:	89 fb                	mov    %edi,%ebx
+			if (i % 10 == 0)
+  8000e9:	be 67 66 66 66       	mov    $0x66666667,%esi
+  8000ee:	eb 31                	jmp    800121 <umain+0xee>
+			dup(p[0], 10);
+  8000f0:	83 ec 08             	sub    $0x8,%esp
+  8000f3:	6a 0a                	push   $0xa
+  8000f5:	ff 75 e0             	push   -0x20(%ebp)
+  8000f8:	e8 2c 1a 00 00       	call   801b29 <dup>
+			sys_yield();
+  8000fd:	e8 c9 0c 00 00       	call   800dcb <sys_yield>
+			close(10);
+  800102:	c7 04 24 0a 00 00 00 	movl   $0xa,(%esp)
+  800109:	e8 c9 19 00 00       	call   801ad7 <close>
+			sys_yield();
+  80010e:	e8 b8 0c 00 00       	call   800dcb <sys_yield>
+		for (i = 0; i < 200; i++) {
+  800113:	83 c3 01             	add    $0x1,%ebx
+  800116:	83 c4 10             	add    $0x10,%esp
+  800119:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  80011f:	74 2a                	je     80014b <umain+0x118>
+			if (i % 10 == 0)
+  800121:	89 d8                	mov    %ebx,%eax
+  800123:	f7 ee                	imul   %esi
+  800125:	c1 fa 02             	sar    $0x2,%edx
+  800128:	89 d8                	mov    %ebx,%eax
+  80012a:	c1 f8 1f             	sar    $0x1f,%eax
+  80012d:	29 c2                	sub    %eax,%edx
+  80012f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  800132:	01 c0                	add    %eax,%eax
+  800134:	39 c3                	cmp    %eax,%ebx
+  800136:	75 b8                	jne    8000f0 <umain+0xbd>
+				cprintf("%d.", i);
+  800138:	83 ec 08             	sub    $0x8,%esp
+  80013b:	53                   	push   %ebx
+  80013c:	68 35 54 80 00       	push   $0x805435
+  800141:	e8 ca 01 00 00       	call   800310 <cprintf>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	eb a5                	jmp    8000f0 <umain+0xbd>
+		exit();
+  80014b:	e8 cb 00 00 00       	call   80021b <exit>
+  800150:	e9 10 ff ff ff       	jmp    800065 <umain+0x32>
+		}
+	cprintf("child done with loop\n");
+  800155:	83 ec 0c             	sub    $0xc,%esp
+  800158:	68 55 54 80 00       	push   $0x805455
+  80015d:	e8 ae 01 00 00       	call   800310 <cprintf>
+	if (pipeisclosed(p[0]))
+  800162:	83 c4 04             	add    $0x4,%esp
+  800165:	ff 75 e0             	push   -0x20(%ebp)
+  800168:	e8 05 26 00 00       	call   802772 <pipeisclosed>
+  80016d:	83 c4 10             	add    $0x10,%esp
+  800170:	85 c0                	test   %eax,%eax
+  800172:	75 38                	jne    8001ac <umain+0x179>
+		panic("somehow the other end of p[0] got closed!");
+	if ((r = fd_lookup(p[0], &fd)) < 0)
+  800174:	83 ec 08             	sub    $0x8,%esp
+  800177:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80017a:	50                   	push   %eax
+  80017b:	ff 75 e0             	push   -0x20(%ebp)
+  80017e:	e8 31 18 00 00       	call   8019b4 <fd_lookup>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 36                	js     8001c0 <umain+0x18d>
+		panic("cannot look up p[0]: %e", r);
+	(void) fd2data(fd);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	ff 75 dc             	push   -0x24(%ebp)
+  800190:	e8 b4 17 00 00       	call   801949 <fd2data>
+	cprintf("race didn't happen\n");
+  800195:	c7 04 24 83 54 80 00 	movl   $0x805483,(%esp)
+  80019c:	e8 6f 01 00 00       	call   800310 <cprintf>
+}
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a7:	5b                   	pop    %ebx
+  8001a8:	5e                   	pop    %esi
+  8001a9:	5f                   	pop    %edi
+  8001aa:	5d                   	pop    %ebp
+  8001ab:	c3                   	ret
+		panic("somehow the other end of p[0] got closed!");
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	68 e4 53 80 00       	push   $0x8053e4
+  8001b4:	6a 40                	push   $0x40
+  8001b6:	68 17 54 80 00       	push   $0x805417
+  8001bb:	e8 75 00 00 00       	call   800235 <_panic>
+		panic("cannot look up p[0]: %e", r);
+  8001c0:	50                   	push   %eax
+  8001c1:	68 6b 54 80 00       	push   $0x80546b
+  8001c6:	6a 42                	push   $0x42
+  8001c8:	68 17 54 80 00       	push   $0x805417
+  8001cd:	e8 63 00 00 00       	call   800235 <_panic>
+
+008001d2 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001d2:	55                   	push   %ebp
+  8001d3:	89 e5                	mov    %esp,%ebp
+  8001d5:	56                   	push   %esi
+  8001d6:	53                   	push   %ebx
+  8001d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001da:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8001dd:	e8 ca 0b 00 00       	call   800dac <sys_getenvid>
+  8001e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8001ea:	c1 e0 06             	shl    $0x6,%eax
+  8001ed:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001f2:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001f7:	85 db                	test   %ebx,%ebx
+  8001f9:	7e 07                	jle    800202 <libmain+0x30>
+		binaryname = argv[0];
+  8001fb:	8b 06                	mov    (%esi),%eax
+  8001fd:	a3 00 70 80 00       	mov    %eax,0x807000
+
+	// call user main routine
+	umain(argc, argv);
+  800202:	83 ec 08             	sub    $0x8,%esp
+  800205:	56                   	push   %esi
+  800206:	53                   	push   %ebx
+  800207:	e8 27 fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  80020c:	e8 0a 00 00 00       	call   80021b <exit>
+}
+  800211:	83 c4 10             	add    $0x10,%esp
+  800214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800217:	5b                   	pop    %ebx
+  800218:	5e                   	pop    %esi
+  800219:	5d                   	pop    %ebp
+  80021a:	c3                   	ret
+
+0080021b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80021b:	55                   	push   %ebp
+  80021c:	89 e5                	mov    %esp,%ebp
+  80021e:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800221:	e8 de 18 00 00       	call   801b04 <close_all>
+	sys_env_destroy(0);
+  800226:	83 ec 0c             	sub    $0xc,%esp
+  800229:	6a 00                	push   $0x0
+  80022b:	e8 3b 0b 00 00       	call   800d6b <sys_env_destroy>
+}
+  800230:	83 c4 10             	add    $0x10,%esp
+  800233:	c9                   	leave
+  800234:	c3                   	ret
+
+00800235 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800235:	55                   	push   %ebp
+  800236:	89 e5                	mov    %esp,%ebp
+  800238:	56                   	push   %esi
+  800239:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80023a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  80023d:	8b 35 00 70 80 00    	mov    0x807000,%esi
+  800243:	e8 64 0b 00 00       	call   800dac <sys_getenvid>
+  800248:	83 ec 0c             	sub    $0xc,%esp
+  80024b:	ff 75 0c             	push   0xc(%ebp)
+  80024e:	ff 75 08             	push   0x8(%ebp)
+  800251:	56                   	push   %esi
+  800252:	50                   	push   %eax
+  800253:	68 a4 54 80 00       	push   $0x8054a4
+  800258:	e8 b3 00 00 00       	call   800310 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80025d:	83 c4 18             	add    $0x18,%esp
+  800260:	53                   	push   %ebx
+  800261:	ff 75 10             	push   0x10(%ebp)
+  800264:	e8 56 00 00 00       	call   8002bf <vcprintf>
+	cprintf("\n");
+  800269:	c7 04 24 41 5a 80 00 	movl   $0x805a41,(%esp)
+  800270:	e8 9b 00 00 00       	call   800310 <cprintf>
+  800275:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800278:	cc                   	int3
+	while (1)
+  800279:	eb fd                	jmp    800278 <_panic+0x43>
+
+0080027b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80027b:	55                   	push   %ebp
+  80027c:	89 e5                	mov    %esp,%ebp
+  80027e:	53                   	push   %ebx
+  80027f:	83 ec 04             	sub    $0x4,%esp
+  800282:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800285:	8b 13                	mov    (%ebx),%edx
+  800287:	8d 42 01             	lea    0x1(%edx),%eax
+  80028a:	89 03                	mov    %eax,(%ebx)
+  80028c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80028f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800293:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800298:	74 09                	je     8002a3 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80029a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80029e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a1:	c9                   	leave
+  8002a2:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8002a3:	83 ec 08             	sub    $0x8,%esp
+  8002a6:	68 ff 00 00 00       	push   $0xff
+  8002ab:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002ae:	50                   	push   %eax
+  8002af:	e8 69 0a 00 00       	call   800d1d <sys_cputs>
+		b->idx = 0;
+  8002b4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002ba:	83 c4 10             	add    $0x10,%esp
+  8002bd:	eb db                	jmp    80029a <putch+0x1f>
+
+008002bf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002bf:	55                   	push   %ebp
+  8002c0:	89 e5                	mov    %esp,%ebp
+  8002c2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8002c8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002cf:	00 00 00 
+	b.cnt = 0;
+  8002d2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002d9:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002dc:	ff 75 0c             	push   0xc(%ebp)
+  8002df:	ff 75 08             	push   0x8(%ebp)
+  8002e2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002e8:	50                   	push   %eax
+  8002e9:	68 7b 02 80 00       	push   $0x80027b
+  8002ee:	e8 14 01 00 00       	call   800407 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002f3:	83 c4 08             	add    $0x8,%esp
+  8002f6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002fc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800302:	50                   	push   %eax
+  800303:	e8 15 0a 00 00       	call   800d1d <sys_cputs>
+
+	return b.cnt;
+}
+  800308:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80030e:	c9                   	leave
+  80030f:	c3                   	ret
+
+00800310 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800310:	55                   	push   %ebp
+  800311:	89 e5                	mov    %esp,%ebp
+  800313:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800316:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800319:	50                   	push   %eax
+  80031a:	ff 75 08             	push   0x8(%ebp)
+  80031d:	e8 9d ff ff ff       	call   8002bf <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800322:	c9                   	leave
+  800323:	c3                   	ret
+
+00800324 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800324:	55                   	push   %ebp
+  800325:	89 e5                	mov    %esp,%ebp
+  800327:	57                   	push   %edi
+  800328:	56                   	push   %esi
+  800329:	53                   	push   %ebx
+  80032a:	83 ec 1c             	sub    $0x1c,%esp
+  80032d:	89 c7                	mov    %eax,%edi
+  80032f:	89 d6                	mov    %edx,%esi
+  800331:	8b 45 08             	mov    0x8(%ebp),%eax
+  800334:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800337:	89 d1                	mov    %edx,%ecx
+  800339:	89 c2                	mov    %eax,%edx
+  80033b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80033e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800341:	8b 45 10             	mov    0x10(%ebp),%eax
+  800344:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800347:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800351:	39 c2                	cmp    %eax,%edx
+  800353:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800356:	72 3e                	jb     800396 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800358:	83 ec 0c             	sub    $0xc,%esp
+  80035b:	ff 75 18             	push   0x18(%ebp)
+  80035e:	83 eb 01             	sub    $0x1,%ebx
+  800361:	53                   	push   %ebx
+  800362:	50                   	push   %eax
+  800363:	83 ec 08             	sub    $0x8,%esp
+  800366:	ff 75 e4             	push   -0x1c(%ebp)
+  800369:	ff 75 e0             	push   -0x20(%ebp)
+  80036c:	ff 75 dc             	push   -0x24(%ebp)
+  80036f:	ff 75 d8             	push   -0x28(%ebp)
+  800372:	e8 02 4f 00 00       	call   805279 <__udivdi3>
+  800377:	83 c4 18             	add    $0x18,%esp
+  80037a:	52                   	push   %edx
+  80037b:	50                   	push   %eax
+  80037c:	89 f2                	mov    %esi,%edx
+  80037e:	89 f8                	mov    %edi,%eax
+  800380:	e8 9f ff ff ff       	call   800324 <printnum>
+  800385:	83 c4 20             	add    $0x20,%esp
+  800388:	eb 13                	jmp    80039d <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80038a:	83 ec 08             	sub    $0x8,%esp
+  80038d:	56                   	push   %esi
+  80038e:	ff 75 18             	push   0x18(%ebp)
+  800391:	ff d7                	call   *%edi
+  800393:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800396:	83 eb 01             	sub    $0x1,%ebx
+  800399:	85 db                	test   %ebx,%ebx
+  80039b:	7f ed                	jg     80038a <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80039d:	83 ec 08             	sub    $0x8,%esp
+  8003a0:	56                   	push   %esi
+  8003a1:	83 ec 04             	sub    $0x4,%esp
+  8003a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a7:	ff 75 e0             	push   -0x20(%ebp)
+  8003aa:	ff 75 dc             	push   -0x24(%ebp)
+  8003ad:	ff 75 d8             	push   -0x28(%ebp)
+  8003b0:	e8 e2 4e 00 00       	call   805297 <__umoddi3>
+  8003b5:	83 c4 14             	add    $0x14,%esp
+  8003b8:	0f be 80 c7 54 80 00 	movsbl 0x8054c7(%eax),%eax
+  8003bf:	50                   	push   %eax
+  8003c0:	ff d7                	call   *%edi
+}
+  8003c2:	83 c4 10             	add    $0x10,%esp
+  8003c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c8:	5b                   	pop    %ebx
+  8003c9:	5e                   	pop    %esi
+  8003ca:	5f                   	pop    %edi
+  8003cb:	5d                   	pop    %ebp
+  8003cc:	c3                   	ret
+
+008003cd <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003cd:	55                   	push   %ebp
+  8003ce:	89 e5                	mov    %esp,%ebp
+  8003d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8003d3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003d7:	8b 10                	mov    (%eax),%edx
+  8003d9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003dc:	73 0a                	jae    8003e8 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003de:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003e1:	89 08                	mov    %ecx,(%eax)
+  8003e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e6:	88 02                	mov    %al,(%edx)
+}
+  8003e8:	5d                   	pop    %ebp
+  8003e9:	c3                   	ret
+
+008003ea <printfmt>:
+{
+  8003ea:	55                   	push   %ebp
+  8003eb:	89 e5                	mov    %esp,%ebp
+  8003ed:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003f0:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003f3:	50                   	push   %eax
+  8003f4:	ff 75 10             	push   0x10(%ebp)
+  8003f7:	ff 75 0c             	push   0xc(%ebp)
+  8003fa:	ff 75 08             	push   0x8(%ebp)
+  8003fd:	e8 05 00 00 00       	call   800407 <vprintfmt>
+}
+  800402:	83 c4 10             	add    $0x10,%esp
+  800405:	c9                   	leave
+  800406:	c3                   	ret
+
+00800407 <vprintfmt>:
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	57                   	push   %edi
+  80040b:	56                   	push   %esi
+  80040c:	53                   	push   %ebx
+  80040d:	83 ec 2c             	sub    $0x2c,%esp
+  800410:	8b 75 08             	mov    0x8(%ebp),%esi
+  800413:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800416:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800419:	eb 0a                	jmp    800425 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80041b:	83 ec 08             	sub    $0x8,%esp
+  80041e:	53                   	push   %ebx
+  80041f:	50                   	push   %eax
+  800420:	ff d6                	call   *%esi
+  800422:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800425:	83 c7 01             	add    $0x1,%edi
+  800428:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80042c:	83 f8 25             	cmp    $0x25,%eax
+  80042f:	74 0c                	je     80043d <vprintfmt+0x36>
+			if (ch == '\0')
+  800431:	85 c0                	test   %eax,%eax
+  800433:	75 e6                	jne    80041b <vprintfmt+0x14>
+}
+  800435:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800438:	5b                   	pop    %ebx
+  800439:	5e                   	pop    %esi
+  80043a:	5f                   	pop    %edi
+  80043b:	5d                   	pop    %ebp
+  80043c:	c3                   	ret
+		padc = ' ';
+  80043d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800441:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800448:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  80044f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800456:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80045b:	8d 47 01             	lea    0x1(%edi),%eax
+  80045e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800461:	0f b6 17             	movzbl (%edi),%edx
+  800464:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800467:	3c 55                	cmp    $0x55,%al
+  800469:	0f 87 c5 03 00 00    	ja     800834 <vprintfmt+0x42d>
+  80046f:	0f b6 c0             	movzbl %al,%eax
+  800472:	ff 24 85 40 56 80 00 	jmp    *0x805640(,%eax,4)
+  800479:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80047c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800480:	eb d9                	jmp    80045b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800482:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800485:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800489:	eb d0                	jmp    80045b <vprintfmt+0x54>
+  80048b:	0f b6 d2             	movzbl %dl,%edx
+  80048e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800491:	b8 00 00 00 00       	mov    $0x0,%eax
+  800496:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800499:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80049c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8004a0:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8004a3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004a6:	83 f9 09             	cmp    $0x9,%ecx
+  8004a9:	77 55                	ja     800500 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8004ab:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8004ae:	eb e9                	jmp    800499 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8b 00                	mov    (%eax),%eax
+  8004b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8004be:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8004c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c8:	79 91                	jns    80045b <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8004ca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d7:	eb 82                	jmp    80045b <vprintfmt+0x54>
+			if (width < 0)
+  8004d9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004dc:	85 d2                	test   %edx,%edx
+  8004de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e3:	0f 49 c2             	cmovns %edx,%eax
+  8004e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004ec:	e9 6a ff ff ff       	jmp    80045b <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004f4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004fb:	e9 5b ff ff ff       	jmp    80045b <vprintfmt+0x54>
+  800500:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800503:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800506:	eb bc                	jmp    8004c4 <vprintfmt+0xbd>
+			lflag++;
+  800508:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80050b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80050e:	e9 48 ff ff ff       	jmp    80045b <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800513:	8b 45 14             	mov    0x14(%ebp),%eax
+  800516:	8d 78 04             	lea    0x4(%eax),%edi
+  800519:	83 ec 08             	sub    $0x8,%esp
+  80051c:	53                   	push   %ebx
+  80051d:	ff 30                	push   (%eax)
+  80051f:	ff d6                	call   *%esi
+			break;
+  800521:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800524:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800527:	e9 63 02 00 00       	jmp    80078f <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  80052c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052f:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800532:	8b 10                	mov    (%eax),%edx
+  800534:	89 d0                	mov    %edx,%eax
+  800536:	f7 d8                	neg    %eax
+  800538:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80053b:	83 f8 12             	cmp    $0x12,%eax
+  80053e:	7f 23                	jg     800563 <vprintfmt+0x15c>
+  800540:	8b 14 85 a0 57 80 00 	mov    0x8057a0(,%eax,4),%edx
+  800547:	85 d2                	test   %edx,%edx
+  800549:	74 18                	je     800563 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80054b:	52                   	push   %edx
+  80054c:	68 cd 59 80 00       	push   $0x8059cd
+  800551:	53                   	push   %ebx
+  800552:	56                   	push   %esi
+  800553:	e8 92 fe ff ff       	call   8003ea <printfmt>
+  800558:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80055b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80055e:	e9 2c 02 00 00       	jmp    80078f <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800563:	50                   	push   %eax
+  800564:	68 df 54 80 00       	push   $0x8054df
+  800569:	53                   	push   %ebx
+  80056a:	56                   	push   %esi
+  80056b:	e8 7a fe ff ff       	call   8003ea <printfmt>
+  800570:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800573:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800576:	e9 14 02 00 00       	jmp    80078f <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80057b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057e:	83 c0 04             	add    $0x4,%eax
+  800581:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800584:	8b 45 14             	mov    0x14(%ebp),%eax
+  800587:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800589:	85 c9                	test   %ecx,%ecx
+  80058b:	b8 d8 54 80 00       	mov    $0x8054d8,%eax
+  800590:	0f 45 c1             	cmovne %ecx,%eax
+  800593:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800596:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80059a:	7e 06                	jle    8005a2 <vprintfmt+0x19b>
+  80059c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005a0:	75 0b                	jne    8005ad <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005a2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005a5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005a8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005ab:	eb 5c                	jmp    800609 <vprintfmt+0x202>
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	ff 75 d0             	push   -0x30(%ebp)
+  8005b3:	ff 75 cc             	push   -0x34(%ebp)
+  8005b6:	e8 19 03 00 00       	call   8008d4 <strnlen>
+  8005bb:	89 c2                	mov    %eax,%edx
+  8005bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c0:	29 d0                	sub    %edx,%eax
+  8005c2:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8005c5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005cc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005cf:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005d1:	eb 0e                	jmp    8005e1 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8005d3:	83 ec 08             	sub    $0x8,%esp
+  8005d6:	53                   	push   %ebx
+  8005d7:	57                   	push   %edi
+  8005d8:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005db:	83 ee 01             	sub    $0x1,%esi
+  8005de:	83 c4 10             	add    $0x10,%esp
+  8005e1:	85 f6                	test   %esi,%esi
+  8005e3:	7f ee                	jg     8005d3 <vprintfmt+0x1cc>
+  8005e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005eb:	85 c0                	test   %eax,%eax
+  8005ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f2:	0f 49 d0             	cmovns %eax,%edx
+  8005f5:	29 d0                	sub    %edx,%eax
+  8005f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fa:	eb a6                	jmp    8005a2 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005fc:	83 ec 08             	sub    $0x8,%esp
+  8005ff:	53                   	push   %ebx
+  800600:	52                   	push   %edx
+  800601:	ff 55 08             	call   *0x8(%ebp)
+  800604:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800607:	89 f1                	mov    %esi,%ecx
+  800609:	8d 71 01             	lea    0x1(%ecx),%esi
+  80060c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800610:	0f be d0             	movsbl %al,%edx
+  800613:	85 d2                	test   %edx,%edx
+  800615:	74 28                	je     80063f <vprintfmt+0x238>
+  800617:	85 ff                	test   %edi,%edi
+  800619:	78 05                	js     800620 <vprintfmt+0x219>
+  80061b:	83 ef 01             	sub    $0x1,%edi
+  80061e:	78 30                	js     800650 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800620:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800624:	74 d6                	je     8005fc <vprintfmt+0x1f5>
+  800626:	0f be c0             	movsbl %al,%eax
+  800629:	83 e8 20             	sub    $0x20,%eax
+  80062c:	83 f8 5e             	cmp    $0x5e,%eax
+  80062f:	76 cb                	jbe    8005fc <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800631:	83 ec 08             	sub    $0x8,%esp
+  800634:	53                   	push   %ebx
+  800635:	6a 3f                	push   $0x3f
+  800637:	ff 55 08             	call   *0x8(%ebp)
+  80063a:	83 c4 10             	add    $0x10,%esp
+  80063d:	eb c8                	jmp    800607 <vprintfmt+0x200>
+  80063f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800642:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800645:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800648:	01 d0                	add    %edx,%eax
+  80064a:	29 c8                	sub    %ecx,%eax
+  80064c:	89 c7                	mov    %eax,%edi
+  80064e:	eb 13                	jmp    800663 <vprintfmt+0x25c>
+  800650:	8b 75 08             	mov    0x8(%ebp),%esi
+  800653:	eb ed                	jmp    800642 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800655:	83 ec 08             	sub    $0x8,%esp
+  800658:	53                   	push   %ebx
+  800659:	6a 20                	push   $0x20
+  80065b:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80065d:	83 ef 01             	sub    $0x1,%edi
+  800660:	83 c4 10             	add    $0x10,%esp
+  800663:	85 ff                	test   %edi,%edi
+  800665:	7f ee                	jg     800655 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800667:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80066a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066d:	e9 1d 01 00 00       	jmp    80078f <vprintfmt+0x388>
+	if (lflag >= 2)
+  800672:	83 f9 01             	cmp    $0x1,%ecx
+  800675:	7f 1b                	jg     800692 <vprintfmt+0x28b>
+	else if (lflag)
+  800677:	85 c9                	test   %ecx,%ecx
+  800679:	74 63                	je     8006de <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 00                	mov    (%eax),%eax
+  800680:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800683:	99                   	cltd
+  800684:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8d 40 04             	lea    0x4(%eax),%eax
+  80068d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800690:	eb 17                	jmp    8006a9 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 50 04             	mov    0x4(%eax),%edx
+  800698:	8b 00                	mov    (%eax),%eax
+  80069a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8006a9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006ac:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8006af:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8006b4:	85 c9                	test   %ecx,%ecx
+  8006b6:	0f 89 b9 00 00 00    	jns    800775 <vprintfmt+0x36e>
+				putch('-', putdat);
+  8006bc:	83 ec 08             	sub    $0x8,%esp
+  8006bf:	53                   	push   %ebx
+  8006c0:	6a 2d                	push   $0x2d
+  8006c2:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8006c4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006ca:	f7 da                	neg    %edx
+  8006cc:	83 d1 00             	adc    $0x0,%ecx
+  8006cf:	f7 d9                	neg    %ecx
+  8006d1:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8006d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006d9:	e9 97 00 00 00       	jmp    800775 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 00                	mov    (%eax),%eax
+  8006e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e6:	99                   	cltd
+  8006e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006f3:	eb b4                	jmp    8006a9 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8006f5:	83 f9 01             	cmp    $0x1,%ecx
+  8006f8:	7f 1b                	jg     800715 <vprintfmt+0x30e>
+	else if (lflag)
+  8006fa:	85 c9                	test   %ecx,%ecx
+  8006fc:	74 2c                	je     80072a <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800701:	8b 10                	mov    (%eax),%edx
+  800703:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800708:	8d 40 04             	lea    0x4(%eax),%eax
+  80070b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800713:	eb 60                	jmp    800775 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800715:	8b 45 14             	mov    0x14(%ebp),%eax
+  800718:	8b 10                	mov    (%eax),%edx
+  80071a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80071d:	8d 40 08             	lea    0x8(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800723:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800728:	eb 4b                	jmp    800775 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80072a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072d:	8b 10                	mov    (%eax),%edx
+  80072f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800734:	8d 40 04             	lea    0x4(%eax),%eax
+  800737:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80073a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80073f:	eb 34                	jmp    800775 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800741:	83 f9 01             	cmp    $0x1,%ecx
+  800744:	7f 15                	jg     80075b <vprintfmt+0x354>
+	else if (lflag)
+  800746:	85 c9                	test   %ecx,%ecx
+  800748:	74 4d                	je     800797 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  80074a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074d:	8b 00                	mov    (%eax),%eax
+  80074f:	99                   	cltd
+  800750:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800753:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800756:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800759:	eb 11                	jmp    80076c <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  80075b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075e:	8b 50 04             	mov    0x4(%eax),%edx
+  800761:	8b 00                	mov    (%eax),%eax
+  800763:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800766:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800769:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  80076c:	89 d1                	mov    %edx,%ecx
+  80076e:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800770:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800775:	83 ec 0c             	sub    $0xc,%esp
+  800778:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80077c:	50                   	push   %eax
+  80077d:	ff 75 e0             	push   -0x20(%ebp)
+  800780:	57                   	push   %edi
+  800781:	51                   	push   %ecx
+  800782:	52                   	push   %edx
+  800783:	89 da                	mov    %ebx,%edx
+  800785:	89 f0                	mov    %esi,%eax
+  800787:	e8 98 fb ff ff       	call   800324 <printnum>
+			break;
+  80078c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80078f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800792:	e9 8e fc ff ff       	jmp    800425 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800797:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079a:	8b 00                	mov    (%eax),%eax
+  80079c:	99                   	cltd
+  80079d:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8007a0:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8007a3:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8007a6:	eb c4                	jmp    80076c <vprintfmt+0x365>
+			putch('0', putdat);
+  8007a8:	83 ec 08             	sub    $0x8,%esp
+  8007ab:	53                   	push   %ebx
+  8007ac:	6a 30                	push   $0x30
+  8007ae:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8007b0:	83 c4 08             	add    $0x8,%esp
+  8007b3:	53                   	push   %ebx
+  8007b4:	6a 78                	push   $0x78
+  8007b6:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 10                	mov    (%eax),%edx
+  8007bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8007c2:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8007c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007cb:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  8007d0:	eb a3                	jmp    800775 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8007d2:	83 f9 01             	cmp    $0x1,%ecx
+  8007d5:	7f 1b                	jg     8007f2 <vprintfmt+0x3eb>
+	else if (lflag)
+  8007d7:	85 c9                	test   %ecx,%ecx
+  8007d9:	74 2f                	je     80080a <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8007db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007de:	8b 10                	mov    (%eax),%edx
+  8007e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007eb:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007f0:	eb 83                	jmp    800775 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8007f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f5:	8b 10                	mov    (%eax),%edx
+  8007f7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800800:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800805:	e9 6b ff ff ff       	jmp    800775 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80080a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080d:	8b 10                	mov    (%eax),%edx
+  80080f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800814:	8d 40 04             	lea    0x4(%eax),%eax
+  800817:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80081a:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  80081f:	e9 51 ff ff ff       	jmp    800775 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800824:	83 ec 08             	sub    $0x8,%esp
+  800827:	53                   	push   %ebx
+  800828:	6a 25                	push   $0x25
+  80082a:	ff d6                	call   *%esi
+			break;
+  80082c:	83 c4 10             	add    $0x10,%esp
+  80082f:	e9 5b ff ff ff       	jmp    80078f <vprintfmt+0x388>
+			putch('%', putdat);
+  800834:	83 ec 08             	sub    $0x8,%esp
+  800837:	53                   	push   %ebx
+  800838:	6a 25                	push   $0x25
+  80083a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80083c:	83 c4 10             	add    $0x10,%esp
+  80083f:	89 f8                	mov    %edi,%eax
+  800841:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800845:	74 05                	je     80084c <vprintfmt+0x445>
+  800847:	83 e8 01             	sub    $0x1,%eax
+  80084a:	eb f5                	jmp    800841 <vprintfmt+0x43a>
+  80084c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80084f:	e9 3b ff ff ff       	jmp    80078f <vprintfmt+0x388>
+
+00800854 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	83 ec 18             	sub    $0x18,%esp
+  80085a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085d:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800860:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800863:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800867:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80086a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800871:	85 c0                	test   %eax,%eax
+  800873:	74 26                	je     80089b <vsnprintf+0x47>
+  800875:	85 d2                	test   %edx,%edx
+  800877:	7e 22                	jle    80089b <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800879:	ff 75 14             	push   0x14(%ebp)
+  80087c:	ff 75 10             	push   0x10(%ebp)
+  80087f:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800882:	50                   	push   %eax
+  800883:	68 cd 03 80 00       	push   $0x8003cd
+  800888:	e8 7a fb ff ff       	call   800407 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80088d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800890:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800893:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800896:	83 c4 10             	add    $0x10,%esp
+}
+  800899:	c9                   	leave
+  80089a:	c3                   	ret
+		return -E_INVAL;
+  80089b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a0:	eb f7                	jmp    800899 <vsnprintf+0x45>
+
+008008a2 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8008a8:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8008ab:	50                   	push   %eax
+  8008ac:	ff 75 10             	push   0x10(%ebp)
+  8008af:	ff 75 0c             	push   0xc(%ebp)
+  8008b2:	ff 75 08             	push   0x8(%ebp)
+  8008b5:	e8 9a ff ff ff       	call   800854 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8008ba:	c9                   	leave
+  8008bb:	c3                   	ret
+
+008008bc <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008bc:	55                   	push   %ebp
+  8008bd:	89 e5                	mov    %esp,%ebp
+  8008bf:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8008c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c7:	eb 03                	jmp    8008cc <strlen+0x10>
+		n++;
+  8008c9:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8008cc:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d0:	75 f7                	jne    8008c9 <strlen+0xd>
+	return n;
+}
+  8008d2:	5d                   	pop    %ebp
+  8008d3:	c3                   	ret
+
+008008d4 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008d4:	55                   	push   %ebp
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008da:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e2:	eb 03                	jmp    8008e7 <strnlen+0x13>
+		n++;
+  8008e4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e7:	39 d0                	cmp    %edx,%eax
+  8008e9:	74 08                	je     8008f3 <strnlen+0x1f>
+  8008eb:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008ef:	75 f3                	jne    8008e4 <strnlen+0x10>
+  8008f1:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008f3:	89 d0                	mov    %edx,%eax
+  8008f5:	5d                   	pop    %ebp
+  8008f6:	c3                   	ret
+
+008008f7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008f7:	55                   	push   %ebp
+  8008f8:	89 e5                	mov    %esp,%ebp
+  8008fa:	53                   	push   %ebx
+  8008fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+  800906:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80090a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80090d:	83 c0 01             	add    $0x1,%eax
+  800910:	84 d2                	test   %dl,%dl
+  800912:	75 f2                	jne    800906 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800914:	89 c8                	mov    %ecx,%eax
+  800916:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800919:	c9                   	leave
+  80091a:	c3                   	ret
+
+0080091b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	53                   	push   %ebx
+  80091f:	83 ec 10             	sub    $0x10,%esp
+  800922:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800925:	53                   	push   %ebx
+  800926:	e8 91 ff ff ff       	call   8008bc <strlen>
+  80092b:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80092e:	ff 75 0c             	push   0xc(%ebp)
+  800931:	01 d8                	add    %ebx,%eax
+  800933:	50                   	push   %eax
+  800934:	e8 be ff ff ff       	call   8008f7 <strcpy>
+	return dst;
+}
+  800939:	89 d8                	mov    %ebx,%eax
+  80093b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80093e:	c9                   	leave
+  80093f:	c3                   	ret
+
+00800940 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800940:	55                   	push   %ebp
+  800941:	89 e5                	mov    %esp,%ebp
+  800943:	56                   	push   %esi
+  800944:	53                   	push   %ebx
+  800945:	8b 75 08             	mov    0x8(%ebp),%esi
+  800948:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80094b:	89 f3                	mov    %esi,%ebx
+  80094d:	03 5d 10             	add    0x10(%ebp),%ebx
+  800950:	89 f0                	mov    %esi,%eax
+  800952:	eb 0f                	jmp    800963 <strncpy+0x23>
+		*dst++ = *src;
+  800954:	83 c0 01             	add    $0x1,%eax
+  800957:	0f b6 0a             	movzbl (%edx),%ecx
+  80095a:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80095d:	80 f9 01             	cmp    $0x1,%cl
+  800960:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800963:	39 d8                	cmp    %ebx,%eax
+  800965:	75 ed                	jne    800954 <strncpy+0x14>
+	}
+	return ret;
+}
+  800967:	89 f0                	mov    %esi,%eax
+  800969:	5b                   	pop    %ebx
+  80096a:	5e                   	pop    %esi
+  80096b:	5d                   	pop    %ebp
+  80096c:	c3                   	ret
+
+0080096d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	56                   	push   %esi
+  800971:	53                   	push   %ebx
+  800972:	8b 75 08             	mov    0x8(%ebp),%esi
+  800975:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800978:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80097b:	89 f0                	mov    %esi,%eax
+  80097d:	85 d2                	test   %edx,%edx
+  80097f:	74 21                	je     8009a2 <strlcpy+0x35>
+  800981:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800985:	89 f2                	mov    %esi,%edx
+  800987:	eb 09                	jmp    800992 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800989:	83 c1 01             	add    $0x1,%ecx
+  80098c:	83 c2 01             	add    $0x1,%edx
+  80098f:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800992:	39 c2                	cmp    %eax,%edx
+  800994:	74 09                	je     80099f <strlcpy+0x32>
+  800996:	0f b6 19             	movzbl (%ecx),%ebx
+  800999:	84 db                	test   %bl,%bl
+  80099b:	75 ec                	jne    800989 <strlcpy+0x1c>
+  80099d:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80099f:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8009a2:	29 f0                	sub    %esi,%eax
+}
+  8009a4:	5b                   	pop    %ebx
+  8009a5:	5e                   	pop    %esi
+  8009a6:	5d                   	pop    %ebp
+  8009a7:	c3                   	ret
+
+008009a8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8009b1:	eb 06                	jmp    8009b9 <strcmp+0x11>
+		p++, q++;
+  8009b3:	83 c1 01             	add    $0x1,%ecx
+  8009b6:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8009b9:	0f b6 01             	movzbl (%ecx),%eax
+  8009bc:	84 c0                	test   %al,%al
+  8009be:	74 04                	je     8009c4 <strcmp+0x1c>
+  8009c0:	3a 02                	cmp    (%edx),%al
+  8009c2:	74 ef                	je     8009b3 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009c4:	0f b6 c0             	movzbl %al,%eax
+  8009c7:	0f b6 12             	movzbl (%edx),%edx
+  8009ca:	29 d0                	sub    %edx,%eax
+}
+  8009cc:	5d                   	pop    %ebp
+  8009cd:	c3                   	ret
+
+008009ce <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009ce:	55                   	push   %ebp
+  8009cf:	89 e5                	mov    %esp,%ebp
+  8009d1:	53                   	push   %ebx
+  8009d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009d8:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009db:	eb 09                	jmp    8009e6 <strncmp+0x18>
+		n--, p++, q++;
+  8009dd:	83 ea 01             	sub    $0x1,%edx
+  8009e0:	83 c0 01             	add    $0x1,%eax
+  8009e3:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009e6:	85 d2                	test   %edx,%edx
+  8009e8:	74 18                	je     800a02 <strncmp+0x34>
+  8009ea:	0f b6 18             	movzbl (%eax),%ebx
+  8009ed:	84 db                	test   %bl,%bl
+  8009ef:	74 04                	je     8009f5 <strncmp+0x27>
+  8009f1:	3a 19                	cmp    (%ecx),%bl
+  8009f3:	74 e8                	je     8009dd <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009f5:	0f b6 00             	movzbl (%eax),%eax
+  8009f8:	0f b6 11             	movzbl (%ecx),%edx
+  8009fb:	29 d0                	sub    %edx,%eax
+}
+  8009fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a00:	c9                   	leave
+  800a01:	c3                   	ret
+		return 0;
+  800a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a07:	eb f4                	jmp    8009fd <strncmp+0x2f>
+
+00800a09 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a13:	eb 03                	jmp    800a18 <strchr+0xf>
+  800a15:	83 c0 01             	add    $0x1,%eax
+  800a18:	0f b6 10             	movzbl (%eax),%edx
+  800a1b:	84 d2                	test   %dl,%dl
+  800a1d:	74 06                	je     800a25 <strchr+0x1c>
+		if (*s == c)
+  800a1f:	38 ca                	cmp    %cl,%dl
+  800a21:	75 f2                	jne    800a15 <strchr+0xc>
+  800a23:	eb 05                	jmp    800a2a <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800a25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a2a:	5d                   	pop    %ebp
+  800a2b:	c3                   	ret
+
+00800a2c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a32:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800a36:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a39:	38 ca                	cmp    %cl,%dl
+  800a3b:	74 09                	je     800a46 <strfind+0x1a>
+  800a3d:	84 d2                	test   %dl,%dl
+  800a3f:	74 05                	je     800a46 <strfind+0x1a>
+	for (; *s; s++)
+  800a41:	83 c0 01             	add    $0x1,%eax
+  800a44:	eb f0                	jmp    800a36 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a46:	5d                   	pop    %ebp
+  800a47:	c3                   	ret
+
+00800a48 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	57                   	push   %edi
+  800a4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a52:	85 c9                	test   %ecx,%ecx
+  800a54:	74 20                	je     800a76 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a56:	89 f8                	mov    %edi,%eax
+  800a58:	09 c8                	or     %ecx,%eax
+  800a5a:	a8 03                	test   $0x3,%al
+  800a5c:	75 12                	jne    800a70 <memset+0x28>
+		c &= 0xFF;
+  800a5e:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a62:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a68:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a6b:	fc                   	cld
+  800a6c:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a6e:	eb 06                	jmp    800a76 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a73:	fc                   	cld
+  800a74:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a76:	89 f8                	mov    %edi,%eax
+  800a78:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a7b:	c9                   	leave
+  800a7c:	c3                   	ret
+
+00800a7d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a7d:	55                   	push   %ebp
+  800a7e:	89 e5                	mov    %esp,%ebp
+  800a80:	57                   	push   %edi
+  800a81:	56                   	push   %esi
+  800a82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a85:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a88:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a8b:	39 c6                	cmp    %eax,%esi
+  800a8d:	73 32                	jae    800ac1 <memmove+0x44>
+  800a8f:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a92:	39 d0                	cmp    %edx,%eax
+  800a94:	73 2b                	jae    800ac1 <memmove+0x44>
+		s += n;
+		d += n;
+  800a96:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a99:	89 d6                	mov    %edx,%esi
+  800a9b:	09 fe                	or     %edi,%esi
+  800a9d:	09 ce                	or     %ecx,%esi
+  800a9f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aa5:	75 0e                	jne    800ab5 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800aa7:	83 ef 04             	sub    $0x4,%edi
+  800aaa:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aad:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800ab0:	fd                   	std
+  800ab1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ab3:	eb 09                	jmp    800abe <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ab5:	83 ef 01             	sub    $0x1,%edi
+  800ab8:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800abb:	fd                   	std
+  800abc:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800abe:	fc                   	cld
+  800abf:	eb 1a                	jmp    800adb <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ac1:	89 f2                	mov    %esi,%edx
+  800ac3:	09 c2                	or     %eax,%edx
+  800ac5:	09 ca                	or     %ecx,%edx
+  800ac7:	f6 c2 03             	test   $0x3,%dl
+  800aca:	75 0a                	jne    800ad6 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800acc:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800acf:	89 c7                	mov    %eax,%edi
+  800ad1:	fc                   	cld
+  800ad2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad4:	eb 05                	jmp    800adb <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800ad6:	89 c7                	mov    %eax,%edi
+  800ad8:	fc                   	cld
+  800ad9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800adb:	5e                   	pop    %esi
+  800adc:	5f                   	pop    %edi
+  800add:	5d                   	pop    %ebp
+  800ade:	c3                   	ret
+
+00800adf <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800ae5:	ff 75 10             	push   0x10(%ebp)
+  800ae8:	ff 75 0c             	push   0xc(%ebp)
+  800aeb:	ff 75 08             	push   0x8(%ebp)
+  800aee:	e8 8a ff ff ff       	call   800a7d <memmove>
+}
+  800af3:	c9                   	leave
+  800af4:	c3                   	ret
+
+00800af5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800af5:	55                   	push   %ebp
+  800af6:	89 e5                	mov    %esp,%ebp
+  800af8:	56                   	push   %esi
+  800af9:	53                   	push   %ebx
+  800afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afd:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800b00:	89 c6                	mov    %eax,%esi
+  800b02:	03 75 10             	add    0x10(%ebp),%esi
+  800b05:	eb 06                	jmp    800b0d <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800b07:	83 c0 01             	add    $0x1,%eax
+  800b0a:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800b0d:	39 f0                	cmp    %esi,%eax
+  800b0f:	74 14                	je     800b25 <memcmp+0x30>
+		if (*s1 != *s2)
+  800b11:	0f b6 08             	movzbl (%eax),%ecx
+  800b14:	0f b6 1a             	movzbl (%edx),%ebx
+  800b17:	38 d9                	cmp    %bl,%cl
+  800b19:	74 ec                	je     800b07 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800b1b:	0f b6 c1             	movzbl %cl,%eax
+  800b1e:	0f b6 db             	movzbl %bl,%ebx
+  800b21:	29 d8                	sub    %ebx,%eax
+  800b23:	eb 05                	jmp    800b2a <memcmp+0x35>
+	}
+
+	return 0;
+  800b25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b2a:	5b                   	pop    %ebx
+  800b2b:	5e                   	pop    %esi
+  800b2c:	5d                   	pop    %ebp
+  800b2d:	c3                   	ret
+
+00800b2e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b2e:	55                   	push   %ebp
+  800b2f:	89 e5                	mov    %esp,%ebp
+  800b31:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b37:	89 c2                	mov    %eax,%edx
+  800b39:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b3c:	eb 03                	jmp    800b41 <memfind+0x13>
+  800b3e:	83 c0 01             	add    $0x1,%eax
+  800b41:	39 d0                	cmp    %edx,%eax
+  800b43:	73 04                	jae    800b49 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b45:	38 08                	cmp    %cl,(%eax)
+  800b47:	75 f5                	jne    800b3e <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	57                   	push   %edi
+  800b4f:	56                   	push   %esi
+  800b50:	53                   	push   %ebx
+  800b51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b57:	eb 03                	jmp    800b5c <strtol+0x11>
+		s++;
+  800b59:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b5c:	0f b6 02             	movzbl (%edx),%eax
+  800b5f:	3c 20                	cmp    $0x20,%al
+  800b61:	74 f6                	je     800b59 <strtol+0xe>
+  800b63:	3c 09                	cmp    $0x9,%al
+  800b65:	74 f2                	je     800b59 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b67:	3c 2b                	cmp    $0x2b,%al
+  800b69:	74 2a                	je     800b95 <strtol+0x4a>
+	int neg = 0;
+  800b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b70:	3c 2d                	cmp    $0x2d,%al
+  800b72:	74 2b                	je     800b9f <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b74:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b7a:	75 0f                	jne    800b8b <strtol+0x40>
+  800b7c:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b7f:	74 28                	je     800ba9 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b81:	85 db                	test   %ebx,%ebx
+  800b83:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b88:	0f 44 d8             	cmove  %eax,%ebx
+  800b8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b90:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b93:	eb 46                	jmp    800bdb <strtol+0x90>
+		s++;
+  800b95:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b98:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b9d:	eb d5                	jmp    800b74 <strtol+0x29>
+		s++, neg = 1;
+  800b9f:	83 c2 01             	add    $0x1,%edx
+  800ba2:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ba7:	eb cb                	jmp    800b74 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ba9:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bad:	74 0e                	je     800bbd <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800baf:	85 db                	test   %ebx,%ebx
+  800bb1:	75 d8                	jne    800b8b <strtol+0x40>
+		s++, base = 8;
+  800bb3:	83 c2 01             	add    $0x1,%edx
+  800bb6:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bbb:	eb ce                	jmp    800b8b <strtol+0x40>
+		s += 2, base = 16;
+  800bbd:	83 c2 02             	add    $0x2,%edx
+  800bc0:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bc5:	eb c4                	jmp    800b8b <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800bc7:	0f be c0             	movsbl %al,%eax
+  800bca:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800bcd:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bd0:	7d 3a                	jge    800c0c <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800bd2:	83 c2 01             	add    $0x1,%edx
+  800bd5:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bd9:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800bdb:	0f b6 02             	movzbl (%edx),%eax
+  800bde:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800be1:	89 f3                	mov    %esi,%ebx
+  800be3:	80 fb 09             	cmp    $0x9,%bl
+  800be6:	76 df                	jbe    800bc7 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800be8:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800beb:	89 f3                	mov    %esi,%ebx
+  800bed:	80 fb 19             	cmp    $0x19,%bl
+  800bf0:	77 08                	ja     800bfa <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bf2:	0f be c0             	movsbl %al,%eax
+  800bf5:	83 e8 57             	sub    $0x57,%eax
+  800bf8:	eb d3                	jmp    800bcd <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bfa:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bfd:	89 f3                	mov    %esi,%ebx
+  800bff:	80 fb 19             	cmp    $0x19,%bl
+  800c02:	77 08                	ja     800c0c <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800c04:	0f be c0             	movsbl %al,%eax
+  800c07:	83 e8 37             	sub    $0x37,%eax
+  800c0a:	eb c1                	jmp    800bcd <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800c0c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c10:	74 05                	je     800c17 <strtol+0xcc>
+		*endptr = (char *) s;
+  800c12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c15:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800c17:	89 c8                	mov    %ecx,%eax
+  800c19:	f7 d8                	neg    %eax
+  800c1b:	85 ff                	test   %edi,%edi
+  800c1d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c20:	89 c8                	mov    %ecx,%eax
+  800c22:	5b                   	pop    %ebx
+  800c23:	5e                   	pop    %esi
+  800c24:	5f                   	pop    %edi
+  800c25:	5d                   	pop    %ebp
+  800c26:	c3                   	ret
+
+00800c27 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	57                   	push   %edi
+  800c2b:	56                   	push   %esi
+  800c2c:	53                   	push   %ebx
+  800c2d:	83 ec 0c             	sub    $0xc,%esp
+  800c30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800c33:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c36:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c39:	85 ff                	test   %edi,%edi
+  800c3b:	74 16                	je     800c53 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c3d:	83 ec 04             	sub    $0x4,%esp
+  800c40:	56                   	push   %esi
+  800c41:	6a 00                	push   $0x0
+  800c43:	53                   	push   %ebx
+  800c44:	e8 02 ff ff ff       	call   800b4b <strtol>
+  800c49:	89 07                	mov    %eax,(%edi)
+  800c4b:	83 c4 10             	add    $0x10,%esp
+  800c4e:	eb 03                	jmp    800c53 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c50:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c53:	0f b6 03             	movzbl (%ebx),%eax
+  800c56:	3c 20                	cmp    $0x20,%al
+  800c58:	74 f6                	je     800c50 <strisl+0x29>
+  800c5a:	3c 09                	cmp    $0x9,%al
+  800c5c:	74 f2                	je     800c50 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c5e:	3c 2b                	cmp    $0x2b,%al
+  800c60:	74 23                	je     800c85 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c62:	3c 2d                	cmp    $0x2d,%al
+  800c64:	0f 94 c0             	sete   %al
+  800c67:	0f b6 c0             	movzbl %al,%eax
+  800c6a:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c6c:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c72:	75 41                	jne    800cb5 <strisl+0x8e>
+  800c74:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c77:	74 11                	je     800c8a <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c79:	85 f6                	test   %esi,%esi
+  800c7b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c80:	0f 44 f0             	cmove  %eax,%esi
+  800c83:	eb 30                	jmp    800cb5 <strisl+0x8e>
+		s++;
+  800c85:	83 c3 01             	add    $0x1,%ebx
+  800c88:	eb e2                	jmp    800c6c <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c8a:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c8e:	74 0e                	je     800c9e <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c90:	85 f6                	test   %esi,%esi
+  800c92:	75 21                	jne    800cb5 <strisl+0x8e>
+		s++, base = 8;
+  800c94:	83 c3 01             	add    $0x1,%ebx
+  800c97:	be 08 00 00 00       	mov    $0x8,%esi
+  800c9c:	eb 17                	jmp    800cb5 <strisl+0x8e>
+		s += 2, base = 16;
+  800c9e:	83 c3 02             	add    $0x2,%ebx
+  800ca1:	be 10 00 00 00       	mov    $0x10,%esi
+  800ca6:	eb 0d                	jmp    800cb5 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800ca8:	0f be c0             	movsbl %al,%eax
+  800cab:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800cae:	39 f0                	cmp    %esi,%eax
+  800cb0:	7d 38                	jge    800cea <strisl+0xc3>
+			return 0;
+		s++;
+  800cb2:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800cb5:	0f b6 03             	movzbl (%ebx),%eax
+  800cb8:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800cbb:	80 fa 09             	cmp    $0x9,%dl
+  800cbe:	76 e8                	jbe    800ca8 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800cc0:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800cc3:	80 fa 19             	cmp    $0x19,%dl
+  800cc6:	77 08                	ja     800cd0 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800cc8:	0f be c0             	movsbl %al,%eax
+  800ccb:	83 e8 57             	sub    $0x57,%eax
+  800cce:	eb de                	jmp    800cae <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800cd0:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800cd3:	80 fa 19             	cmp    $0x19,%dl
+  800cd6:	77 08                	ja     800ce0 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800cd8:	0f be c0             	movsbl %al,%eax
+  800cdb:	83 e8 37             	sub    $0x37,%eax
+  800cde:	eb ce                	jmp    800cae <strisl+0x87>
+		else if (!*s)
+  800ce0:	84 c0                	test   %al,%al
+  800ce2:	0f 94 c0             	sete   %al
+  800ce5:	0f b6 c0             	movzbl %al,%eax
+  800ce8:	eb 05                	jmp    800cef <strisl+0xc8>
+			return 0;
+  800cea:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf2:	5b                   	pop    %ebx
+  800cf3:	5e                   	pop    %esi
+  800cf4:	5f                   	pop    %edi
+  800cf5:	5d                   	pop    %ebp
+  800cf6:	c3                   	ret
+
+00800cf7 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800cf7:	55                   	push   %ebp
+  800cf8:	89 e5                	mov    %esp,%ebp
+  800cfa:	83 ec 10             	sub    $0x10,%esp
+  800cfd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d00:	89 c8                	mov    %ecx,%eax
+  800d02:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800d07:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800d0a:	eb 0b                	jmp    800d17 <touch_mem+0x20>
+		c = *(char *)page;
+  800d0c:	0f b6 10             	movzbl (%eax),%edx
+  800d0f:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800d12:	05 00 10 00 00       	add    $0x1000,%eax
+  800d17:	39 c8                	cmp    %ecx,%eax
+  800d19:	72 f1                	jb     800d0c <touch_mem+0x15>
+}
+  800d1b:	c9                   	leave
+  800d1c:	c3                   	ret
+
+00800d1d <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+	touch_mem(s, len);
+  800d23:	ff 75 0c             	push   0xc(%ebp)
+  800d26:	ff 75 08             	push   0x8(%ebp)
+  800d29:	e8 c9 ff ff ff       	call   800cf7 <touch_mem>
+	asm volatile("int %1\n"
+  800d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d39:	89 c3                	mov    %eax,%ebx
+  800d3b:	89 c7                	mov    %eax,%edi
+  800d3d:	89 c6                	mov    %eax,%esi
+  800d3f:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d41:	83 c4 08             	add    $0x8,%esp
+  800d44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d47:	5b                   	pop    %ebx
+  800d48:	5e                   	pop    %esi
+  800d49:	5f                   	pop    %edi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	57                   	push   %edi
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d5c:	89 d1                	mov    %edx,%ecx
+  800d5e:	89 d3                	mov    %edx,%ebx
+  800d60:	89 d7                	mov    %edx,%edi
+  800d62:	89 d6                	mov    %edx,%esi
+  800d64:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d66:	5b                   	pop    %ebx
+  800d67:	5e                   	pop    %esi
+  800d68:	5f                   	pop    %edi
+  800d69:	5d                   	pop    %ebp
+  800d6a:	c3                   	ret
+
+00800d6b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	57                   	push   %edi
+  800d6f:	56                   	push   %esi
+  800d70:	53                   	push   %ebx
+  800d71:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d81:	89 cb                	mov    %ecx,%ebx
+  800d83:	89 cf                	mov    %ecx,%edi
+  800d85:	89 ce                	mov    %ecx,%esi
+  800d87:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	7f 08                	jg     800d95 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d90:	5b                   	pop    %ebx
+  800d91:	5e                   	pop    %esi
+  800d92:	5f                   	pop    %edi
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d95:	83 ec 0c             	sub    $0xc,%esp
+  800d98:	50                   	push   %eax
+  800d99:	6a 03                	push   $0x3
+  800d9b:	68 0b 58 80 00       	push   $0x80580b
+  800da0:	6a 23                	push   $0x23
+  800da2:	68 28 58 80 00       	push   $0x805828
+  800da7:	e8 89 f4 ff ff       	call   800235 <_panic>
+
+00800dac <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	57                   	push   %edi
+  800db0:	56                   	push   %esi
+  800db1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800db2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dbc:	89 d1                	mov    %edx,%ecx
+  800dbe:	89 d3                	mov    %edx,%ebx
+  800dc0:	89 d7                	mov    %edx,%edi
+  800dc2:	89 d6                	mov    %edx,%esi
+  800dc4:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5f                   	pop    %edi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+
+00800dcb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	57                   	push   %edi
+  800dcf:	56                   	push   %esi
+  800dd0:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800dd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ddb:	89 d1                	mov    %edx,%ecx
+  800ddd:	89 d3                	mov    %edx,%ebx
+  800ddf:	89 d7                	mov    %edx,%edi
+  800de1:	89 d6                	mov    %edx,%esi
+  800de3:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800de5:	5b                   	pop    %ebx
+  800de6:	5e                   	pop    %esi
+  800de7:	5f                   	pop    %edi
+  800de8:	5d                   	pop    %ebp
+  800de9:	c3                   	ret
+
+00800dea <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	57                   	push   %edi
+  800dee:	56                   	push   %esi
+  800def:	53                   	push   %ebx
+  800df0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df3:	be 00 00 00 00       	mov    $0x0,%esi
+  800df8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfe:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e06:	89 f7                	mov    %esi,%edi
+  800e08:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0a:	85 c0                	test   %eax,%eax
+  800e0c:	7f 08                	jg     800e16 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800e0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e11:	5b                   	pop    %ebx
+  800e12:	5e                   	pop    %esi
+  800e13:	5f                   	pop    %edi
+  800e14:	5d                   	pop    %ebp
+  800e15:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e16:	83 ec 0c             	sub    $0xc,%esp
+  800e19:	50                   	push   %eax
+  800e1a:	6a 04                	push   $0x4
+  800e1c:	68 0b 58 80 00       	push   $0x80580b
+  800e21:	6a 23                	push   $0x23
+  800e23:	68 28 58 80 00       	push   $0x805828
+  800e28:	e8 08 f4 ff ff       	call   800235 <_panic>
+
+00800e2d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e2d:	55                   	push   %ebp
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	57                   	push   %edi
+  800e31:	56                   	push   %esi
+  800e32:	53                   	push   %ebx
+  800e33:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e44:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e47:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e4a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4c:	85 c0                	test   %eax,%eax
+  800e4e:	7f 08                	jg     800e58 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e53:	5b                   	pop    %ebx
+  800e54:	5e                   	pop    %esi
+  800e55:	5f                   	pop    %edi
+  800e56:	5d                   	pop    %ebp
+  800e57:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+  800e5b:	50                   	push   %eax
+  800e5c:	6a 05                	push   $0x5
+  800e5e:	68 0b 58 80 00       	push   $0x80580b
+  800e63:	6a 23                	push   $0x23
+  800e65:	68 28 58 80 00       	push   $0x805828
+  800e6a:	e8 c6 f3 ff ff       	call   800235 <_panic>
+
+00800e6f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e6f:	55                   	push   %ebp
+  800e70:	89 e5                	mov    %esp,%ebp
+  800e72:	57                   	push   %edi
+  800e73:	56                   	push   %esi
+  800e74:	53                   	push   %ebx
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e83:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e88:	89 df                	mov    %ebx,%edi
+  800e8a:	89 de                	mov    %ebx,%esi
+  800e8c:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e8e:	85 c0                	test   %eax,%eax
+  800e90:	7f 08                	jg     800e9a <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e95:	5b                   	pop    %ebx
+  800e96:	5e                   	pop    %esi
+  800e97:	5f                   	pop    %edi
+  800e98:	5d                   	pop    %ebp
+  800e99:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+  800e9d:	50                   	push   %eax
+  800e9e:	6a 06                	push   $0x6
+  800ea0:	68 0b 58 80 00       	push   $0x80580b
+  800ea5:	6a 23                	push   $0x23
+  800ea7:	68 28 58 80 00       	push   $0x805828
+  800eac:	e8 84 f3 ff ff       	call   800235 <_panic>
+
+00800eb1 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800eb1:	55                   	push   %ebp
+  800eb2:	89 e5                	mov    %esp,%ebp
+  800eb4:	57                   	push   %edi
+  800eb5:	56                   	push   %esi
+  800eb6:	53                   	push   %ebx
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 18 00 00 00       	mov    $0x18,%eax
+  800eca:	89 df                	mov    %ebx,%edi
+  800ecc:	89 de                	mov    %ebx,%esi
+  800ece:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ed0:	85 c0                	test   %eax,%eax
+  800ed2:	7f 08                	jg     800edc <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800ed4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed7:	5b                   	pop    %ebx
+  800ed8:	5e                   	pop    %esi
+  800ed9:	5f                   	pop    %edi
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+  800edf:	50                   	push   %eax
+  800ee0:	6a 18                	push   $0x18
+  800ee2:	68 0b 58 80 00       	push   $0x80580b
+  800ee7:	6a 23                	push   $0x23
+  800ee9:	68 28 58 80 00       	push   $0x805828
+  800eee:	e8 42 f3 ff ff       	call   800235 <_panic>
+
+00800ef3 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ef9:	be 00 00 00 00       	mov    $0x0,%esi
+  800efe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f04:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0c:	89 f7                	mov    %esi,%edi
+  800f0e:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800f10:	5b                   	pop    %ebx
+  800f11:	5e                   	pop    %esi
+  800f12:	5f                   	pop    %edi
+  800f13:	5d                   	pop    %ebp
+  800f14:	c3                   	ret
+
+00800f15 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	56                   	push   %esi
+  800f1a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f21:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f26:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f31:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800f33:	5b                   	pop    %ebx
+  800f34:	5e                   	pop    %esi
+  800f35:	5f                   	pop    %edi
+  800f36:	5d                   	pop    %ebp
+  800f37:	c3                   	ret
+
+00800f38 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f41:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f44:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f4a:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f53:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f5e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f60:	85 c0                	test   %eax,%eax
+  800f62:	7f 08                	jg     800f6c <sys_page_map_range+0x34>
+}
+  800f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f67:	5b                   	pop    %ebx
+  800f68:	5e                   	pop    %esi
+  800f69:	5f                   	pop    %edi
+  800f6a:	5d                   	pop    %ebp
+  800f6b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f6c:	83 ec 0c             	sub    $0xc,%esp
+  800f6f:	50                   	push   %eax
+  800f70:	6a 10                	push   $0x10
+  800f72:	68 0b 58 80 00       	push   $0x80580b
+  800f77:	6a 23                	push   $0x23
+  800f79:	68 28 58 80 00       	push   $0x805828
+  800f7e:	e8 b2 f2 ff ff       	call   800235 <_panic>
+
+00800f83 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f83:	55                   	push   %ebp
+  800f84:	89 e5                	mov    %esp,%ebp
+  800f86:	57                   	push   %edi
+  800f87:	56                   	push   %esi
+  800f88:	53                   	push   %ebx
+  800f89:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f8c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f97:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f9f:	89 f7                	mov    %esi,%edi
+  800fa1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa3:	85 c0                	test   %eax,%eax
+  800fa5:	7f 08                	jg     800faf <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fa7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800faa:	5b                   	pop    %ebx
+  800fab:	5e                   	pop    %esi
+  800fac:	5f                   	pop    %edi
+  800fad:	5d                   	pop    %ebp
+  800fae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800faf:	83 ec 0c             	sub    $0xc,%esp
+  800fb2:	50                   	push   %eax
+  800fb3:	6a 11                	push   $0x11
+  800fb5:	68 0b 58 80 00       	push   $0x80580b
+  800fba:	6a 23                	push   $0x23
+  800fbc:	68 28 58 80 00       	push   $0x805828
+  800fc1:	e8 6f f2 ff ff       	call   800235 <_panic>
+
+00800fc6 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	57                   	push   %edi
+  800fca:	56                   	push   %esi
+  800fcb:	53                   	push   %ebx
+  800fcc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fcf:	be 00 00 00 00       	mov    $0x0,%esi
+  800fd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fda:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fdf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe2:	89 f7                	mov    %esi,%edi
+  800fe4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fe6:	85 c0                	test   %eax,%eax
+  800fe8:	7f 08                	jg     800ff2 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fed:	5b                   	pop    %ebx
+  800fee:	5e                   	pop    %esi
+  800fef:	5f                   	pop    %edi
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff2:	83 ec 0c             	sub    $0xc,%esp
+  800ff5:	50                   	push   %eax
+  800ff6:	6a 1b                	push   $0x1b
+  800ff8:	68 0b 58 80 00       	push   $0x80580b
+  800ffd:	6a 23                	push   $0x23
+  800fff:	68 28 58 80 00       	push   $0x805828
+  801004:	e8 2c f2 ff ff       	call   800235 <_panic>
+
+00801009 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	57                   	push   %edi
+  80100d:	56                   	push   %esi
+  80100e:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80100f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801014:	b8 12 00 00 00       	mov    $0x12,%eax
+  801019:	89 d1                	mov    %edx,%ecx
+  80101b:	89 d3                	mov    %edx,%ebx
+  80101d:	89 d7                	mov    %edx,%edi
+  80101f:	89 d6                	mov    %edx,%esi
+  801021:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801023:	5b                   	pop    %ebx
+  801024:	5e                   	pop    %esi
+  801025:	5f                   	pop    %edi
+  801026:	5d                   	pop    %ebp
+  801027:	c3                   	ret
+
+00801028 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	57                   	push   %edi
+  80102c:	56                   	push   %esi
+  80102d:	53                   	push   %ebx
+  80102e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801031:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801041:	89 df                	mov    %ebx,%edi
+  801043:	89 de                	mov    %ebx,%esi
+  801045:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801047:	85 c0                	test   %eax,%eax
+  801049:	7f 08                	jg     801053 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80104b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104e:	5b                   	pop    %ebx
+  80104f:	5e                   	pop    %esi
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801053:	83 ec 0c             	sub    $0xc,%esp
+  801056:	50                   	push   %eax
+  801057:	6a 08                	push   $0x8
+  801059:	68 0b 58 80 00       	push   $0x80580b
+  80105e:	6a 23                	push   $0x23
+  801060:	68 28 58 80 00       	push   $0x805828
+  801065:	e8 cb f1 ff ff       	call   800235 <_panic>
+
+0080106a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80106a:	55                   	push   %ebp
+  80106b:	89 e5                	mov    %esp,%ebp
+  80106d:	57                   	push   %edi
+  80106e:	56                   	push   %esi
+  80106f:	53                   	push   %ebx
+  801070:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  801073:	6a 44                	push   $0x44
+  801075:	ff 75 0c             	push   0xc(%ebp)
+  801078:	e8 7a fc ff ff       	call   800cf7 <touch_mem>
+	asm volatile("int %1\n"
+  80107d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	b8 09 00 00 00       	mov    $0x9,%eax
+  80108a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108d:	89 df                	mov    %ebx,%edi
+  80108f:	89 de                	mov    %ebx,%esi
+  801091:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801093:	83 c4 08             	add    $0x8,%esp
+  801096:	85 c0                	test   %eax,%eax
+  801098:	7f 08                	jg     8010a2 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80109a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109d:	5b                   	pop    %ebx
+  80109e:	5e                   	pop    %esi
+  80109f:	5f                   	pop    %edi
+  8010a0:	5d                   	pop    %ebp
+  8010a1:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a2:	83 ec 0c             	sub    $0xc,%esp
+  8010a5:	50                   	push   %eax
+  8010a6:	6a 09                	push   $0x9
+  8010a8:	68 0b 58 80 00       	push   $0x80580b
+  8010ad:	6a 23                	push   $0x23
+  8010af:	68 28 58 80 00       	push   $0x805828
+  8010b4:	e8 7c f1 ff ff       	call   800235 <_panic>
+
+008010b9 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	57                   	push   %edi
+  8010bd:	56                   	push   %esi
+  8010be:	53                   	push   %ebx
+  8010bf:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8010c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010cd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  8010d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010d5:	89 f7                	mov    %esi,%edi
+  8010d7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010d9:	85 c0                	test   %eax,%eax
+  8010db:	7f 08                	jg     8010e5 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8010dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010e0:	5b                   	pop    %ebx
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5f                   	pop    %edi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010e5:	83 ec 0c             	sub    $0xc,%esp
+  8010e8:	50                   	push   %eax
+  8010e9:	6a 1a                	push   $0x1a
+  8010eb:	68 0b 58 80 00       	push   $0x80580b
+  8010f0:	6a 23                	push   $0x23
+  8010f2:	68 28 58 80 00       	push   $0x805828
+  8010f7:	e8 39 f1 ff ff       	call   800235 <_panic>
+
+008010fc <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	57                   	push   %edi
+  801100:	56                   	push   %esi
+  801101:	53                   	push   %ebx
+  801102:	83 ec 0c             	sub    $0xc,%esp
+  801105:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  801108:	89 d8                	mov    %ebx,%eax
+  80110a:	c1 e0 05             	shl    $0x5,%eax
+  80110d:	50                   	push   %eax
+  80110e:	ff 75 0c             	push   0xc(%ebp)
+  801111:	e8 e1 fb ff ff       	call   800cf7 <touch_mem>
+	asm volatile("int %1\n"
+  801116:	be 00 00 00 00       	mov    $0x0,%esi
+  80111b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111e:	b8 13 00 00 00       	mov    $0x13,%eax
+  801123:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801126:	89 f7                	mov    %esi,%edi
+  801128:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80112a:	83 c4 08             	add    $0x8,%esp
+  80112d:	85 c0                	test   %eax,%eax
+  80112f:	7f 08                	jg     801139 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  801131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801134:	5b                   	pop    %ebx
+  801135:	5e                   	pop    %esi
+  801136:	5f                   	pop    %edi
+  801137:	5d                   	pop    %ebp
+  801138:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801139:	83 ec 0c             	sub    $0xc,%esp
+  80113c:	50                   	push   %eax
+  80113d:	6a 13                	push   $0x13
+  80113f:	68 0b 58 80 00       	push   $0x80580b
+  801144:	6a 23                	push   $0x23
+  801146:	68 28 58 80 00       	push   $0x805828
+  80114b:	e8 e5 f0 ff ff       	call   800235 <_panic>
+
+00801150 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801150:	55                   	push   %ebp
+  801151:	89 e5                	mov    %esp,%ebp
+  801153:	57                   	push   %edi
+  801154:	56                   	push   %esi
+  801155:	53                   	push   %ebx
+  801156:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801159:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801161:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801164:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801169:	89 df                	mov    %ebx,%edi
+  80116b:	89 de                	mov    %ebx,%esi
+  80116d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116f:	85 c0                	test   %eax,%eax
+  801171:	7f 08                	jg     80117b <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801173:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801176:	5b                   	pop    %ebx
+  801177:	5e                   	pop    %esi
+  801178:	5f                   	pop    %edi
+  801179:	5d                   	pop    %ebp
+  80117a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117b:	83 ec 0c             	sub    $0xc,%esp
+  80117e:	50                   	push   %eax
+  80117f:	6a 0a                	push   $0xa
+  801181:	68 0b 58 80 00       	push   $0x80580b
+  801186:	6a 23                	push   $0x23
+  801188:	68 28 58 80 00       	push   $0x805828
+  80118d:	e8 a3 f0 ff ff       	call   800235 <_panic>
+
+00801192 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801192:	55                   	push   %ebp
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	57                   	push   %edi
+  801196:	56                   	push   %esi
+  801197:	53                   	push   %ebx
+  801198:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80119b:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011a1:	76 1d                	jbe    8011c0 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  8011a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8011b3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b6:	cd 30                	int    $0x30
+}
+  8011b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011bb:	5b                   	pop    %ebx
+  8011bc:	5e                   	pop    %esi
+  8011bd:	5f                   	pop    %edi
+  8011be:	5d                   	pop    %ebp
+  8011bf:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011c0:	68 00 10 00 00       	push   $0x1000
+  8011c5:	53                   	push   %ebx
+  8011c6:	e8 2c fb ff ff       	call   800cf7 <touch_mem>
+  8011cb:	83 c4 08             	add    $0x8,%esp
+  8011ce:	eb d3                	jmp    8011a3 <sys_ipc_send+0x11>
+
+008011d0 <sys_ipc_send_pages>:
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	57                   	push   %edi
+  8011d4:	56                   	push   %esi
+  8011d5:	53                   	push   %ebx
+  8011d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d9:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8011dc:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011e2:	76 18                	jbe    8011fc <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8011e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ea:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011ef:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8011f2:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8011f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f7:	5b                   	pop    %ebx
+  8011f8:	5e                   	pop    %esi
+  8011f9:	5f                   	pop    %edi
+  8011fa:	5d                   	pop    %ebp
+  8011fb:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011fc:	89 f0                	mov    %esi,%eax
+  8011fe:	c1 e0 0c             	shl    $0xc,%eax
+  801201:	50                   	push   %eax
+  801202:	53                   	push   %ebx
+  801203:	e8 ef fa ff ff       	call   800cf7 <touch_mem>
+  801208:	83 c4 08             	add    $0x8,%esp
+  80120b:	eb d7                	jmp    8011e4 <sys_ipc_send_pages+0x14>
+
+0080120d <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80120d:	55                   	push   %ebp
+  80120e:	89 e5                	mov    %esp,%ebp
+  801210:	57                   	push   %edi
+  801211:	56                   	push   %esi
+  801212:	53                   	push   %ebx
+  801213:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801216:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80121b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801221:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801226:	89 df                	mov    %ebx,%edi
+  801228:	89 de                	mov    %ebx,%esi
+  80122a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80122c:	85 c0                	test   %eax,%eax
+  80122e:	7f 08                	jg     801238 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  801230:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801233:	5b                   	pop    %ebx
+  801234:	5e                   	pop    %esi
+  801235:	5f                   	pop    %edi
+  801236:	5d                   	pop    %ebp
+  801237:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801238:	83 ec 0c             	sub    $0xc,%esp
+  80123b:	50                   	push   %eax
+  80123c:	6a 0d                	push   $0xd
+  80123e:	68 0b 58 80 00       	push   $0x80580b
+  801243:	6a 23                	push   $0x23
+  801245:	68 28 58 80 00       	push   $0x805828
+  80124a:	e8 e6 ef ff ff       	call   800235 <_panic>
+
+0080124f <sys_ipc_recv>:
+{
+  80124f:	55                   	push   %ebp
+  801250:	89 e5                	mov    %esp,%ebp
+  801252:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801255:	6a 01                	push   $0x1
+  801257:	ff 75 08             	push   0x8(%ebp)
+  80125a:	e8 ae ff ff ff       	call   80120d <sys_ipc_recv_pages>
+}
+  80125f:	c9                   	leave
+  801260:	c3                   	ret
+
+00801261 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+  801264:	57                   	push   %edi
+  801265:	56                   	push   %esi
+  801266:	53                   	push   %ebx
+  801267:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80126a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80126d:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801270:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801276:	77 04                	ja     80127c <sys_ipc_call+0x1b>
+  801278:	85 f6                	test   %esi,%esi
+  80127a:	75 15                	jne    801291 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80127c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801282:	b8 14 00 00 00       	mov    $0x14,%eax
+  801287:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801289:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128c:	5b                   	pop    %ebx
+  80128d:	5e                   	pop    %esi
+  80128e:	5f                   	pop    %edi
+  80128f:	5d                   	pop    %ebp
+  801290:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801291:	89 f8                	mov    %edi,%eax
+  801293:	c1 e0 0c             	shl    $0xc,%eax
+  801296:	50                   	push   %eax
+  801297:	53                   	push   %ebx
+  801298:	e8 5a fa ff ff       	call   800cf7 <touch_mem>
+  80129d:	83 c4 08             	add    $0x8,%esp
+  8012a0:	eb da                	jmp    80127c <sys_ipc_call+0x1b>
+
+008012a2 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8012a2:	55                   	push   %ebp
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	57                   	push   %edi
+  8012a6:	56                   	push   %esi
+  8012a7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ae:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012b9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012bc:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  8012be:	5b                   	pop    %ebx
+  8012bf:	5e                   	pop    %esi
+  8012c0:	5f                   	pop    %edi
+  8012c1:	5d                   	pop    %ebp
+  8012c2:	c3                   	ret
+
+008012c3 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	57                   	push   %edi
+  8012c7:	56                   	push   %esi
+  8012c8:	53                   	push   %ebx
+  8012c9:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  8012cc:	6a 04                	push   $0x4
+  8012ce:	ff 75 08             	push   0x8(%ebp)
+  8012d1:	e8 21 fa ff ff       	call   800cf7 <touch_mem>
+	asm volatile("int %1\n"
+  8012d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012de:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e9:	89 f7                	mov    %esi,%edi
+  8012eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ed:	83 c4 08             	add    $0x8,%esp
+  8012f0:	85 c0                	test   %eax,%eax
+  8012f2:	7f 08                	jg     8012fc <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8012f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012f7:	5b                   	pop    %ebx
+  8012f8:	5e                   	pop    %esi
+  8012f9:	5f                   	pop    %edi
+  8012fa:	5d                   	pop    %ebp
+  8012fb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012fc:	83 ec 0c             	sub    $0xc,%esp
+  8012ff:	50                   	push   %eax
+  801300:	6a 16                	push   $0x16
+  801302:	68 0b 58 80 00       	push   $0x80580b
+  801307:	6a 23                	push   $0x23
+  801309:	68 28 58 80 00       	push   $0x805828
+  80130e:	e8 22 ef ff ff       	call   800235 <_panic>
+
+00801313 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801313:	55                   	push   %ebp
+  801314:	89 e5                	mov    %esp,%ebp
+  801316:	57                   	push   %edi
+  801317:	56                   	push   %esi
+  801318:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  801319:	6a 04                	push   $0x4
+  80131b:	ff 75 08             	push   0x8(%ebp)
+  80131e:	e8 d4 f9 ff ff       	call   800cf7 <touch_mem>
+	asm volatile("int %1\n"
+  801323:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801328:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80132b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801330:	8b 55 08             	mov    0x8(%ebp),%edx
+  801333:	89 df                	mov    %ebx,%edi
+  801335:	89 de                	mov    %ebx,%esi
+  801337:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801339:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80133c:	5b                   	pop    %ebx
+  80133d:	5e                   	pop    %esi
+  80133e:	5f                   	pop    %edi
+  80133f:	5d                   	pop    %ebp
+  801340:	c3                   	ret
+
+00801341 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801341:	55                   	push   %ebp
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	57                   	push   %edi
+  801345:	56                   	push   %esi
+  801346:	53                   	push   %ebx
+  801347:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80134a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801352:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801357:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80135c:	89 df                	mov    %ebx,%edi
+  80135e:	89 de                	mov    %ebx,%esi
+  801360:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801362:	85 c0                	test   %eax,%eax
+  801364:	7f 08                	jg     80136e <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801366:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801369:	5b                   	pop    %ebx
+  80136a:	5e                   	pop    %esi
+  80136b:	5f                   	pop    %edi
+  80136c:	5d                   	pop    %ebp
+  80136d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80136e:	83 ec 0c             	sub    $0xc,%esp
+  801371:	50                   	push   %eax
+  801372:	6a 0e                	push   $0xe
+  801374:	68 0b 58 80 00       	push   $0x80580b
+  801379:	6a 23                	push   $0x23
+  80137b:	68 28 58 80 00       	push   $0x805828
+  801380:	e8 b0 ee ff ff       	call   800235 <_panic>
+
+00801385 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  801385:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80138c:	f6 c6 06             	test   $0x6,%dh
+  80138f:	75 37                	jne    8013c8 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  801391:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801398:	f6 c2 02             	test   $0x2,%dl
+  80139b:	75 19                	jne    8013b6 <dupperm+0x31>
+  80139d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013a4:	f6 c6 08             	test   $0x8,%dh
+  8013a7:	75 0d                	jne    8013b6 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  8013a9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013b0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013b5:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  8013b6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013bd:	25 00 06 00 00       	and    $0x600,%eax
+  8013c2:	0d 05 08 00 00       	or     $0x805,%eax
+  8013c7:	c3                   	ret
+		return 0;
+  8013c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013cd:	c3                   	ret
+
+008013ce <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  8013ce:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  8013d0:	c1 e0 0c             	shl    $0xc,%eax
+  8013d3:	c1 e8 16             	shr    $0x16,%eax
+  8013d6:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8013dd:	f6 c1 01             	test   $0x1,%cl
+  8013e0:	74 2c                	je     80140e <dupable+0x40>
+  8013e2:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8013e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ee:	f6 c1 04             	test   $0x4,%cl
+  8013f1:	74 20                	je     801413 <dupable+0x45>
+  8013f3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013fa:	f6 c1 01             	test   $0x1,%cl
+  8013fd:	74 14                	je     801413 <dupable+0x45>
+  8013ff:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  801406:	c1 e8 02             	shr    $0x2,%eax
+  801409:	83 e0 01             	and    $0x1,%eax
+  80140c:	eb 05                	jmp    801413 <dupable+0x45>
+  80140e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801413:	83 e0 01             	and    $0x1,%eax
+}
+  801416:	c3                   	ret
+
+00801417 <pgfault>:
+{
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	56                   	push   %esi
+  80141b:	53                   	push   %ebx
+  80141c:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  80141f:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  801421:	89 ca                	mov    %ecx,%edx
+  801423:	c1 ea 0c             	shr    $0xc,%edx
+  801426:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80142d:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  801431:	0f 84 8e 00 00 00    	je     8014c5 <pgfault+0xae>
+		return 0;
+  801437:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  80143c:	f6 c6 08             	test   $0x8,%dh
+  80143f:	0f 84 85 00 00 00    	je     8014ca <pgfault+0xb3>
+	perm |= PTE_W;
+  801445:	81 e2 07 06 00 00    	and    $0x607,%edx
+  80144b:	89 d3                	mov    %edx,%ebx
+  80144d:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801450:	89 ce                	mov    %ecx,%esi
+  801452:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801458:	6a 01                	push   $0x1
+  80145a:	53                   	push   %ebx
+  80145b:	68 00 f0 7f 00       	push   $0x7ff000
+  801460:	6a 00                	push   $0x0
+  801462:	e8 39 27 00 00       	call   803ba0 <page_alloc>
+  801467:	83 c4 10             	add    $0x10,%esp
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	78 33                	js     8014a1 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  80146e:	83 ec 04             	sub    $0x4,%esp
+  801471:	68 00 10 00 00       	push   $0x1000
+  801476:	56                   	push   %esi
+  801477:	68 00 f0 7f 00       	push   $0x7ff000
+  80147c:	e8 fc f5 ff ff       	call   800a7d <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  801481:	89 1c 24             	mov    %ebx,(%esp)
+  801484:	56                   	push   %esi
+  801485:	6a 00                	push   $0x0
+  801487:	68 00 f0 7f 00       	push   $0x7ff000
+  80148c:	6a 00                	push   $0x0
+  80148e:	e8 6e 2d 00 00       	call   804201 <page_map>
+  801493:	83 c4 20             	add    $0x20,%esp
+  801496:	85 c0                	test   %eax,%eax
+  801498:	78 19                	js     8014b3 <pgfault+0x9c>
+	return 1;
+  80149a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80149f:	eb 29                	jmp    8014ca <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  8014a1:	50                   	push   %eax
+  8014a2:	68 38 58 80 00       	push   $0x805838
+  8014a7:	6a 2e                	push   $0x2e
+  8014a9:	68 8b 58 80 00       	push   $0x80588b
+  8014ae:	e8 82 ed ff ff       	call   800235 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  8014b3:	50                   	push   %eax
+  8014b4:	68 64 58 80 00       	push   $0x805864
+  8014b9:	6a 32                	push   $0x32
+  8014bb:	68 8b 58 80 00       	push   $0x80588b
+  8014c0:	e8 70 ed ff ff       	call   800235 <_panic>
+		return 0;
+  8014c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014cd:	5b                   	pop    %ebx
+  8014ce:	5e                   	pop    %esi
+  8014cf:	5d                   	pop    %ebp
+  8014d0:	c3                   	ret
+
+008014d1 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  8014d1:	55                   	push   %ebp
+  8014d2:	89 e5                	mov    %esp,%ebp
+  8014d4:	57                   	push   %edi
+  8014d5:	56                   	push   %esi
+  8014d6:	53                   	push   %ebx
+  8014d7:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  8014da:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8014e1:	74 5d                	je     801540 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  8014e3:	83 ec 0c             	sub    $0xc,%esp
+  8014e6:	68 17 14 80 00       	push   $0x801417
+  8014eb:	e8 72 39 00 00       	call   804e62 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  8014f0:	e8 14 fb ff ff       	call   801009 <sys_fork>
+  8014f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8014f8:	83 c4 10             	add    $0x10,%esp
+  8014fb:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8014fe:	74 47                	je     801547 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  801500:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  801504:	0f 84 c5 03 00 00    	je     8018cf <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  80150a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  80150e:	78 25                	js     801535 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  801510:	e8 03 20 00 00       	call   803518 <page_share_paged_out>
+  801515:	85 c0                	test   %eax,%eax
+  801517:	0f 88 d8 03 00 00    	js     8018f5 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80151d:	83 ec 08             	sub    $0x8,%esp
+  801520:	6a 02                	push   $0x2
+  801522:	ff 75 e4             	push   -0x1c(%ebp)
+  801525:	e8 fe fa ff ff       	call   801028 <sys_env_set_status>
+  80152a:	83 c4 10             	add    $0x10,%esp
+  80152d:	85 c0                	test   %eax,%eax
+  80152f:	0f 88 d5 03 00 00    	js     80190a <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  801535:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801538:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153b:	5b                   	pop    %ebx
+  80153c:	5e                   	pop    %esi
+  80153d:	5f                   	pop    %edi
+  80153e:	5d                   	pop    %ebp
+  80153f:	c3                   	ret
+		init_map_dir();
+  801540:	e8 db 22 00 00       	call   803820 <init_map_dir>
+  801545:	eb 9c                	jmp    8014e3 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801547:	b8 07 00 00 00       	mov    $0x7,%eax
+  80154c:	cd 30                	int    $0x30
+  80154e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  801551:	85 c0                	test   %eax,%eax
+  801553:	78 10                	js     801565 <fork+0x94>
+	if (envid == 0)
+  801555:	0f 84 74 03 00 00    	je     8018cf <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  80155b:	be 00 00 00 00       	mov    $0x0,%esi
+  801560:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801563:	eb 30                	jmp    801595 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801565:	50                   	push   %eax
+  801566:	68 96 58 80 00       	push   $0x805896
+  80156b:	68 cd 00 00 00       	push   $0xcd
+  801570:	68 8b 58 80 00       	push   $0x80588b
+  801575:	e8 bb ec ff ff       	call   800235 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  80157a:	89 f2                	mov    %esi,%edx
+  80157c:	c1 fa 1f             	sar    $0x1f,%edx
+  80157f:	c1 ea 16             	shr    $0x16,%edx
+  801582:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801585:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80158a:	29 d0                	sub    %edx,%eax
+  80158c:	ba 00 04 00 00       	mov    $0x400,%edx
+  801591:	29 c2                	sub    %eax,%edx
+  801593:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801595:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  801598:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  80159e:	0f 87 ff 02 00 00    	ja     8018a3 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  8015a4:	89 f3                	mov    %esi,%ebx
+  8015a6:	c1 e3 0c             	shl    $0xc,%ebx
+  8015a9:	89 d8                	mov    %ebx,%eax
+  8015ab:	c1 e8 16             	shr    $0x16,%eax
+  8015ae:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015b5:	f6 c2 01             	test   $0x1,%dl
+  8015b8:	74 c0                	je     80157a <fork+0xa9>
+  8015ba:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8015c1:	f6 c2 04             	test   $0x4,%dl
+  8015c4:	74 b4                	je     80157a <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  8015c6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015cd:	a8 80                	test   $0x80,%al
+  8015cf:	75 24                	jne    8015f5 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  8015d1:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  8015d8:	25 81 00 00 00       	and    $0x81,%eax
+  8015dd:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8015e2:	74 21                	je     801605 <fork+0x134>
+		if (!dupable(pn)) {
+  8015e4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015e7:	e8 e2 fd ff ff       	call   8013ce <dupable>
+  8015ec:	84 c0                	test   %al,%al
+  8015ee:	75 1a                	jne    80160a <fork+0x139>
+			++pn;
+  8015f0:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8015f3:	eb a0                	jmp    801595 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  8015f5:	83 ec 08             	sub    $0x8,%esp
+  8015f8:	53                   	push   %ebx
+  8015f9:	6a 00                	push   $0x0
+  8015fb:	e8 b1 f8 ff ff       	call   800eb1 <sys_page_split>
+  801600:	83 c4 10             	add    $0x10,%esp
+  801603:	eb cc                	jmp    8015d1 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  801605:	0f b6 03             	movzbl (%ebx),%eax
+  801608:	eb da                	jmp    8015e4 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  80160a:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80160d:	89 f8                	mov    %edi,%eax
+  80160f:	e8 71 fd ff ff       	call   801385 <dupperm>
+  801614:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  801617:	85 c0                	test   %eax,%eax
+  801619:	74 16                	je     801631 <fork+0x160>
+  80161b:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  801620:	29 f8                	sub    %edi,%eax
+  801622:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801625:	bf 01 00 00 00       	mov    $0x1,%edi
+  80162a:	89 c6                	mov    %eax,%esi
+  80162c:	e9 c4 01 00 00       	jmp    8017f5 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  801631:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801634:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80163b:	f6 c4 04             	test   $0x4,%ah
+  80163e:	0f 85 89 00 00 00    	jne    8016cd <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  801644:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801647:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80164e:	f6 c4 02             	test   $0x2,%ah
+  801651:	0f 85 b1 00 00 00    	jne    801708 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801657:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80165a:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801661:	a8 02                	test   $0x2,%al
+  801663:	75 10                	jne    801675 <fork+0x1a4>
+  801665:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80166c:	f6 c4 08             	test   $0x8,%ah
+  80166f:	0f 84 3e 01 00 00    	je     8017b3 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801675:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801678:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80167f:	25 00 06 00 00       	and    $0x600,%eax
+  801684:	0d 05 08 00 00       	or     $0x805,%eax
+  801689:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  80168b:	c1 e1 0c             	shl    $0xc,%ecx
+  80168e:	89 cb                	mov    %ecx,%ebx
+  801690:	83 ec 0c             	sub    $0xc,%esp
+  801693:	50                   	push   %eax
+  801694:	51                   	push   %ecx
+  801695:	ff 75 e4             	push   -0x1c(%ebp)
+  801698:	51                   	push   %ecx
+  801699:	6a 00                	push   $0x0
+  80169b:	e8 61 2b 00 00       	call   804201 <page_map>
+  8016a0:	83 c4 20             	add    $0x20,%esp
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	0f 88 e4 00 00 00    	js     80178f <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  8016ab:	83 ec 0c             	sub    $0xc,%esp
+  8016ae:	57                   	push   %edi
+  8016af:	53                   	push   %ebx
+  8016b0:	6a 00                	push   $0x0
+  8016b2:	53                   	push   %ebx
+  8016b3:	6a 00                	push   $0x0
+  8016b5:	e8 47 2b 00 00       	call   804201 <page_map>
+  8016ba:	83 c4 20             	add    $0x20,%esp
+  8016bd:	85 c0                	test   %eax,%eax
+  8016bf:	0f 88 dc 00 00 00    	js     8017a1 <fork+0x2d0>
+			++pn;
+  8016c5:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8016c8:	e9 c8 fe ff ff       	jmp    801595 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8016cd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8016d0:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8016d7:	c1 e1 0c             	shl    $0xc,%ecx
+  8016da:	83 ec 0c             	sub    $0xc,%esp
+  8016dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016e2:	50                   	push   %eax
+  8016e3:	51                   	push   %ecx
+  8016e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8016e7:	51                   	push   %ecx
+  8016e8:	6a 00                	push   $0x0
+  8016ea:	e8 12 2b 00 00       	call   804201 <page_map>
+  8016ef:	83 c4 20             	add    $0x20,%esp
+  8016f2:	85 c0                	test   %eax,%eax
+  8016f4:	79 cf                	jns    8016c5 <fork+0x1f4>
+			panic("page_map %d", r);
+  8016f6:	50                   	push   %eax
+  8016f7:	68 a6 58 80 00       	push   $0x8058a6
+  8016fc:	6a 4d                	push   $0x4d
+  8016fe:	68 8b 58 80 00       	push   $0x80588b
+  801703:	e8 2d eb ff ff       	call   800235 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  801708:	83 ec 0c             	sub    $0xc,%esp
+  80170b:	68 00 10 00 00       	push   $0x1000
+  801710:	e8 de 30 00 00       	call   8047f3 <malloc>
+  801715:	89 c7                	mov    %eax,%edi
+  801717:	83 c4 10             	add    $0x10,%esp
+  80171a:	85 c0                	test   %eax,%eax
+  80171c:	74 4b                	je     801769 <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  80171e:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  801721:	c1 e3 0c             	shl    $0xc,%ebx
+  801724:	83 ec 04             	sub    $0x4,%esp
+  801727:	68 00 10 00 00       	push   $0x1000
+  80172c:	53                   	push   %ebx
+  80172d:	50                   	push   %eax
+  80172e:	e8 ac f3 ff ff       	call   800adf <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  801733:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801736:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80173d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801742:	89 04 24             	mov    %eax,(%esp)
+  801745:	53                   	push   %ebx
+  801746:	ff 75 e4             	push   -0x1c(%ebp)
+  801749:	57                   	push   %edi
+  80174a:	6a 00                	push   $0x0
+  80174c:	e8 b0 2a 00 00       	call   804201 <page_map>
+  801751:	83 c4 20             	add    $0x20,%esp
+  801754:	85 c0                	test   %eax,%eax
+  801756:	78 25                	js     80177d <fork+0x2ac>
+		free(temp);
+  801758:	83 ec 0c             	sub    $0xc,%esp
+  80175b:	57                   	push   %edi
+  80175c:	e8 90 2e 00 00       	call   8045f1 <free>
+  801761:	83 c4 10             	add    $0x10,%esp
+  801764:	e9 5c ff ff ff       	jmp    8016c5 <fork+0x1f4>
+			panic("malloc failed");
+  801769:	83 ec 04             	sub    $0x4,%esp
+  80176c:	68 b2 58 80 00       	push   $0x8058b2
+  801771:	6a 56                	push   $0x56
+  801773:	68 8b 58 80 00       	push   $0x80588b
+  801778:	e8 b8 ea ff ff       	call   800235 <_panic>
+			panic("page_map: %e", r);
+  80177d:	50                   	push   %eax
+  80177e:	68 c0 58 80 00       	push   $0x8058c0
+  801783:	6a 59                	push   $0x59
+  801785:	68 8b 58 80 00       	push   $0x80588b
+  80178a:	e8 a6 ea ff ff       	call   800235 <_panic>
+			panic("page_map %d", r);
+  80178f:	50                   	push   %eax
+  801790:	68 a6 58 80 00       	push   $0x8058a6
+  801795:	6a 65                	push   $0x65
+  801797:	68 8b 58 80 00       	push   $0x80588b
+  80179c:	e8 94 ea ff ff       	call   800235 <_panic>
+			panic("page_map %d", r);
+  8017a1:	50                   	push   %eax
+  8017a2:	68 a6 58 80 00       	push   $0x8058a6
+  8017a7:	6a 78                	push   $0x78
+  8017a9:	68 8b 58 80 00       	push   $0x80588b
+  8017ae:	e8 82 ea ff ff       	call   800235 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  8017b3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8017b6:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  8017bd:	c1 e1 0c             	shl    $0xc,%ecx
+  8017c0:	83 ec 0c             	sub    $0xc,%esp
+  8017c3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017c8:	50                   	push   %eax
+  8017c9:	51                   	push   %ecx
+  8017ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8017cd:	51                   	push   %ecx
+  8017ce:	6a 00                	push   $0x0
+  8017d0:	e8 2c 2a 00 00       	call   804201 <page_map>
+  8017d5:	83 c4 20             	add    $0x20,%esp
+  8017d8:	85 c0                	test   %eax,%eax
+  8017da:	0f 89 e5 fe ff ff    	jns    8016c5 <fork+0x1f4>
+			panic("page_map %d", r);
+  8017e0:	50                   	push   %eax
+  8017e1:	68 a6 58 80 00       	push   $0x8058a6
+  8017e6:	6a 7f                	push   $0x7f
+  8017e8:	68 8b 58 80 00       	push   $0x80588b
+  8017ed:	e8 43 ea ff ff       	call   800235 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8017f2:	83 c7 01             	add    $0x1,%edi
+  8017f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017f8:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  8017fb:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  8017fe:	39 f7                	cmp    %esi,%edi
+  801800:	74 1c                	je     80181e <fork+0x34d>
+  801802:	89 d8                	mov    %ebx,%eax
+  801804:	e8 c5 fb ff ff       	call   8013ce <dupable>
+  801809:	84 c0                	test   %al,%al
+  80180b:	74 7c                	je     801889 <fork+0x3b8>
+  80180d:	89 d8                	mov    %ebx,%eax
+  80180f:	e8 71 fb ff ff       	call   801385 <dupperm>
+  801814:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801817:	74 d9                	je     8017f2 <fork+0x321>
+  801819:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80181c:	eb 06                	jmp    801824 <fork+0x353>
+  80181e:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801821:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801824:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801827:	c1 e0 0c             	shl    $0xc,%eax
+  80182a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80182d:	83 ec 08             	sub    $0x8,%esp
+  801830:	ff 75 dc             	push   -0x24(%ebp)
+  801833:	57                   	push   %edi
+  801834:	50                   	push   %eax
+  801835:	ff 75 e4             	push   -0x1c(%ebp)
+  801838:	50                   	push   %eax
+  801839:	6a 00                	push   $0x0
+  80183b:	e8 b8 2b 00 00       	call   8043f8 <page_map_range>
+  801840:	83 c4 20             	add    $0x20,%esp
+  801843:	85 c0                	test   %eax,%eax
+  801845:	78 47                	js     80188e <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801847:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  80184e:	0f 84 41 fd ff ff    	je     801595 <fork+0xc4>
+  801854:	83 ec 08             	sub    $0x8,%esp
+  801857:	ff 75 dc             	push   -0x24(%ebp)
+  80185a:	57                   	push   %edi
+  80185b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80185e:	50                   	push   %eax
+  80185f:	6a 00                	push   $0x0
+  801861:	50                   	push   %eax
+  801862:	6a 00                	push   $0x0
+  801864:	e8 8f 2b 00 00       	call   8043f8 <page_map_range>
+  801869:	83 c4 20             	add    $0x20,%esp
+  80186c:	85 c0                	test   %eax,%eax
+  80186e:	0f 89 21 fd ff ff    	jns    801595 <fork+0xc4>
+		panic("page_map_range %e", r);
+  801874:	50                   	push   %eax
+  801875:	68 cd 58 80 00       	push   $0x8058cd
+  80187a:	68 a2 00 00 00       	push   $0xa2
+  80187f:	68 8b 58 80 00       	push   $0x80588b
+  801884:	e8 ac e9 ff ff       	call   800235 <_panic>
+  801889:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80188c:	eb 96                	jmp    801824 <fork+0x353>
+		panic("page_map_range %e", r);
+  80188e:	50                   	push   %eax
+  80188f:	68 cd 58 80 00       	push   $0x8058cd
+  801894:	68 a0 00 00 00       	push   $0xa0
+  801899:	68 8b 58 80 00       	push   $0x80588b
+  80189e:	e8 92 e9 ff ff       	call   800235 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  8018a3:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8018a6:	6a 01                	push   $0x1
+  8018a8:	6a 07                	push   $0x7
+  8018aa:	68 00 f0 bf ee       	push   $0xeebff000
+  8018af:	53                   	push   %ebx
+  8018b0:	e8 eb 22 00 00       	call   803ba0 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  8018b5:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8018ba:	8b 40 74             	mov    0x74(%eax),%eax
+  8018bd:	83 c4 08             	add    $0x8,%esp
+  8018c0:	50                   	push   %eax
+  8018c1:	53                   	push   %ebx
+  8018c2:	e8 89 f8 ff ff       	call   801150 <sys_env_set_pgfault_upcall>
+  8018c7:	83 c4 10             	add    $0x10,%esp
+  8018ca:	e9 41 fc ff ff       	jmp    801510 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8018cf:	e8 d8 f4 ff ff       	call   800dac <sys_getenvid>
+  8018d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8018d9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8018dc:	c1 e0 06             	shl    $0x6,%eax
+  8018df:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018e4:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  8018e9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8018f0:	e9 40 fc ff ff       	jmp    801535 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  8018f5:	50                   	push   %eax
+  8018f6:	68 df 58 80 00       	push   $0x8058df
+  8018fb:	68 27 01 00 00       	push   $0x127
+  801900:	68 8b 58 80 00       	push   $0x80588b
+  801905:	e8 2b e9 ff ff       	call   800235 <_panic>
+		panic("sys_env_set_status: %d", r);
+  80190a:	50                   	push   %eax
+  80190b:	68 f8 58 80 00       	push   $0x8058f8
+  801910:	68 2b 01 00 00       	push   $0x12b
+  801915:	68 8b 58 80 00       	push   $0x80588b
+  80191a:	e8 16 e9 ff ff       	call   800235 <_panic>
+
+0080191f <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  80191f:	55                   	push   %ebp
+  801920:	89 e5                	mov    %esp,%ebp
+  801922:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801925:	68 0f 59 80 00       	push   $0x80590f
+  80192a:	68 35 01 00 00       	push   $0x135
+  80192f:	68 8b 58 80 00       	push   $0x80588b
+  801934:	e8 fc e8 ff ff       	call   800235 <_panic>
+
+00801939 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801939:	55                   	push   %ebp
+  80193a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80193c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80193f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801944:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801947:	5d                   	pop    %ebp
+  801948:	c3                   	ret
+
+00801949 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80194c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80194f:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801954:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801959:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80195e:	5d                   	pop    %ebp
+  80195f:	c3                   	ret
+
+00801960 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801960:	55                   	push   %ebp
+  801961:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801963:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801968:	a8 01                	test   $0x1,%al
+  80196a:	74 3c                	je     8019a8 <fd_alloc+0x48>
+  80196c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801971:	89 c2                	mov    %eax,%edx
+  801973:	c1 ea 0c             	shr    $0xc,%edx
+  801976:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80197d:	89 c1                	mov    %eax,%ecx
+  80197f:	05 00 10 00 00       	add    $0x1000,%eax
+  801984:	f6 c2 01             	test   $0x1,%dl
+  801987:	74 13                	je     80199c <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801989:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80198e:	75 e1                	jne    801971 <fd_alloc+0x11>
+  801990:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801995:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80199a:	eb 05                	jmp    8019a1 <fd_alloc+0x41>
+			return 0;
+  80199c:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8019a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019a4:	89 0a                	mov    %ecx,(%edx)
+}
+  8019a6:	5d                   	pop    %ebp
+  8019a7:	c3                   	ret
+  8019a8:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8019ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b2:	eb ed                	jmp    8019a1 <fd_alloc+0x41>
+
+008019b4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8019b4:	55                   	push   %ebp
+  8019b5:	89 e5                	mov    %esp,%ebp
+  8019b7:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8019ba:	83 f8 1f             	cmp    $0x1f,%eax
+  8019bd:	77 30                	ja     8019ef <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8019bf:	c1 e0 0c             	shl    $0xc,%eax
+  8019c2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8019c7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8019cd:	f6 c2 01             	test   $0x1,%dl
+  8019d0:	74 24                	je     8019f6 <fd_lookup+0x42>
+  8019d2:	89 c2                	mov    %eax,%edx
+  8019d4:	c1 ea 0c             	shr    $0xc,%edx
+  8019d7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019de:	f6 c2 01             	test   $0x1,%dl
+  8019e1:	74 1a                	je     8019fd <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019e6:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ed:	5d                   	pop    %ebp
+  8019ee:	c3                   	ret
+		return -E_INVAL;
+  8019ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f4:	eb f7                	jmp    8019ed <fd_lookup+0x39>
+		return -E_INVAL;
+  8019f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019fb:	eb f0                	jmp    8019ed <fd_lookup+0x39>
+  8019fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a02:	eb e9                	jmp    8019ed <fd_lookup+0x39>
+
+00801a04 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a04:	55                   	push   %ebp
+  801a05:	89 e5                	mov    %esp,%ebp
+  801a07:	53                   	push   %ebx
+  801a08:	83 ec 04             	sub    $0x4,%esp
+  801a0b:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801a0e:	b8 a4 59 80 00       	mov    $0x8059a4,%eax
+  801a13:	8b 18                	mov    (%eax),%ebx
+  801a15:	85 db                	test   %ebx,%ebx
+  801a17:	74 0e                	je     801a27 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801a19:	83 c0 04             	add    $0x4,%eax
+  801a1c:	39 13                	cmp    %edx,(%ebx)
+  801a1e:	75 f3                	jne    801a13 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801a20:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a25:	eb 1f                	jmp    801a46 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a27:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801a2c:	8b 40 48             	mov    0x48(%eax),%eax
+  801a2f:	83 ec 04             	sub    $0x4,%esp
+  801a32:	52                   	push   %edx
+  801a33:	50                   	push   %eax
+  801a34:	68 28 59 80 00       	push   $0x805928
+  801a39:	e8 d2 e8 ff ff       	call   800310 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a3e:	83 c4 10             	add    $0x10,%esp
+  801a41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a49:	89 1a                	mov    %ebx,(%edx)
+}
+  801a4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a4e:	c9                   	leave
+  801a4f:	c3                   	ret
+
+00801a50 <fd_close>:
+{
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	57                   	push   %edi
+  801a54:	56                   	push   %esi
+  801a55:	53                   	push   %ebx
+  801a56:	83 ec 24             	sub    $0x24,%esp
+  801a59:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a5c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a5f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a62:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a63:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a69:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a6c:	50                   	push   %eax
+  801a6d:	e8 42 ff ff ff       	call   8019b4 <fd_lookup>
+  801a72:	89 c3                	mov    %eax,%ebx
+  801a74:	83 c4 10             	add    $0x10,%esp
+  801a77:	85 c0                	test   %eax,%eax
+  801a79:	78 05                	js     801a80 <fd_close+0x30>
+	    || fd != fd2)
+  801a7b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a7e:	74 16                	je     801a96 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a80:	89 f8                	mov    %edi,%eax
+  801a82:	84 c0                	test   %al,%al
+  801a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a89:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a8c:	89 d8                	mov    %ebx,%eax
+  801a8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a91:	5b                   	pop    %ebx
+  801a92:	5e                   	pop    %esi
+  801a93:	5f                   	pop    %edi
+  801a94:	5d                   	pop    %ebp
+  801a95:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a96:	83 ec 08             	sub    $0x8,%esp
+  801a99:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a9c:	50                   	push   %eax
+  801a9d:	ff 36                	push   (%esi)
+  801a9f:	e8 60 ff ff ff       	call   801a04 <dev_lookup>
+  801aa4:	89 c3                	mov    %eax,%ebx
+  801aa6:	83 c4 10             	add    $0x10,%esp
+  801aa9:	85 c0                	test   %eax,%eax
+  801aab:	78 1a                	js     801ac7 <fd_close+0x77>
+		if (dev->dev_close)
+  801aad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ab0:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801ab3:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801ab8:	85 c0                	test   %eax,%eax
+  801aba:	74 0b                	je     801ac7 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801abc:	83 ec 0c             	sub    $0xc,%esp
+  801abf:	56                   	push   %esi
+  801ac0:	ff d0                	call   *%eax
+  801ac2:	89 c3                	mov    %eax,%ebx
+  801ac4:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801ac7:	83 ec 08             	sub    $0x8,%esp
+  801aca:	56                   	push   %esi
+  801acb:	6a 00                	push   $0x0
+  801acd:	e8 9d f3 ff ff       	call   800e6f <sys_page_unmap>
+	return r;
+  801ad2:	83 c4 10             	add    $0x10,%esp
+  801ad5:	eb b5                	jmp    801a8c <fd_close+0x3c>
+
+00801ad7 <close>:
+
+int
+close(int fdnum)
+{
+  801ad7:	55                   	push   %ebp
+  801ad8:	89 e5                	mov    %esp,%ebp
+  801ada:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801add:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ae0:	50                   	push   %eax
+  801ae1:	ff 75 08             	push   0x8(%ebp)
+  801ae4:	e8 cb fe ff ff       	call   8019b4 <fd_lookup>
+  801ae9:	83 c4 10             	add    $0x10,%esp
+  801aec:	85 c0                	test   %eax,%eax
+  801aee:	79 02                	jns    801af2 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801af0:	c9                   	leave
+  801af1:	c3                   	ret
+		return fd_close(fd, 1);
+  801af2:	83 ec 08             	sub    $0x8,%esp
+  801af5:	6a 01                	push   $0x1
+  801af7:	ff 75 f4             	push   -0xc(%ebp)
+  801afa:	e8 51 ff ff ff       	call   801a50 <fd_close>
+  801aff:	83 c4 10             	add    $0x10,%esp
+  801b02:	eb ec                	jmp    801af0 <close+0x19>
+
+00801b04 <close_all>:
+
+void
+close_all(void)
+{
+  801b04:	55                   	push   %ebp
+  801b05:	89 e5                	mov    %esp,%ebp
+  801b07:	53                   	push   %ebx
+  801b08:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801b0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801b10:	83 ec 0c             	sub    $0xc,%esp
+  801b13:	53                   	push   %ebx
+  801b14:	e8 be ff ff ff       	call   801ad7 <close>
+	for (i = 0; i < MAXFD; i++)
+  801b19:	83 c3 01             	add    $0x1,%ebx
+  801b1c:	83 c4 10             	add    $0x10,%esp
+  801b1f:	83 fb 20             	cmp    $0x20,%ebx
+  801b22:	75 ec                	jne    801b10 <close_all+0xc>
+}
+  801b24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b27:	c9                   	leave
+  801b28:	c3                   	ret
+
+00801b29 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801b29:	55                   	push   %ebp
+  801b2a:	89 e5                	mov    %esp,%ebp
+  801b2c:	57                   	push   %edi
+  801b2d:	56                   	push   %esi
+  801b2e:	53                   	push   %ebx
+  801b2f:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b32:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b35:	50                   	push   %eax
+  801b36:	ff 75 08             	push   0x8(%ebp)
+  801b39:	e8 76 fe ff ff       	call   8019b4 <fd_lookup>
+  801b3e:	89 c3                	mov    %eax,%ebx
+  801b40:	83 c4 10             	add    $0x10,%esp
+  801b43:	85 c0                	test   %eax,%eax
+  801b45:	78 7f                	js     801bc6 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b47:	83 ec 0c             	sub    $0xc,%esp
+  801b4a:	ff 75 0c             	push   0xc(%ebp)
+  801b4d:	e8 85 ff ff ff       	call   801ad7 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b52:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b55:	c1 e6 0c             	shl    $0xc,%esi
+  801b58:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b5e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b61:	89 3c 24             	mov    %edi,(%esp)
+  801b64:	e8 e0 fd ff ff       	call   801949 <fd2data>
+  801b69:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b6b:	89 34 24             	mov    %esi,(%esp)
+  801b6e:	e8 d6 fd ff ff       	call   801949 <fd2data>
+  801b73:	83 c4 10             	add    $0x10,%esp
+  801b76:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b79:	89 d8                	mov    %ebx,%eax
+  801b7b:	c1 e8 16             	shr    $0x16,%eax
+  801b7e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b85:	a8 01                	test   $0x1,%al
+  801b87:	74 11                	je     801b9a <dup+0x71>
+  801b89:	89 d8                	mov    %ebx,%eax
+  801b8b:	c1 e8 0c             	shr    $0xc,%eax
+  801b8e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b95:	f6 c2 01             	test   $0x1,%dl
+  801b98:	75 36                	jne    801bd0 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b9a:	89 f8                	mov    %edi,%eax
+  801b9c:	c1 e8 0c             	shr    $0xc,%eax
+  801b9f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ba6:	83 ec 0c             	sub    $0xc,%esp
+  801ba9:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bae:	50                   	push   %eax
+  801baf:	56                   	push   %esi
+  801bb0:	6a 00                	push   $0x0
+  801bb2:	57                   	push   %edi
+  801bb3:	6a 00                	push   $0x0
+  801bb5:	e8 73 f2 ff ff       	call   800e2d <sys_page_map>
+  801bba:	89 c3                	mov    %eax,%ebx
+  801bbc:	83 c4 20             	add    $0x20,%esp
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	78 33                	js     801bf6 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801bc3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801bc6:	89 d8                	mov    %ebx,%eax
+  801bc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bcb:	5b                   	pop    %ebx
+  801bcc:	5e                   	pop    %esi
+  801bcd:	5f                   	pop    %edi
+  801bce:	5d                   	pop    %ebp
+  801bcf:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801bd0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801bd7:	83 ec 0c             	sub    $0xc,%esp
+  801bda:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bdf:	50                   	push   %eax
+  801be0:	ff 75 d4             	push   -0x2c(%ebp)
+  801be3:	6a 00                	push   $0x0
+  801be5:	53                   	push   %ebx
+  801be6:	6a 00                	push   $0x0
+  801be8:	e8 40 f2 ff ff       	call   800e2d <sys_page_map>
+  801bed:	89 c3                	mov    %eax,%ebx
+  801bef:	83 c4 20             	add    $0x20,%esp
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	79 a4                	jns    801b9a <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801bf6:	83 ec 08             	sub    $0x8,%esp
+  801bf9:	56                   	push   %esi
+  801bfa:	6a 00                	push   $0x0
+  801bfc:	e8 6e f2 ff ff       	call   800e6f <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801c01:	83 c4 08             	add    $0x8,%esp
+  801c04:	ff 75 d4             	push   -0x2c(%ebp)
+  801c07:	6a 00                	push   $0x0
+  801c09:	e8 61 f2 ff ff       	call   800e6f <sys_page_unmap>
+	return r;
+  801c0e:	83 c4 10             	add    $0x10,%esp
+  801c11:	eb b3                	jmp    801bc6 <dup+0x9d>
+
+00801c13 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801c13:	55                   	push   %ebp
+  801c14:	89 e5                	mov    %esp,%ebp
+  801c16:	56                   	push   %esi
+  801c17:	53                   	push   %ebx
+  801c18:	83 ec 18             	sub    $0x18,%esp
+  801c1b:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c1e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c21:	50                   	push   %eax
+  801c22:	56                   	push   %esi
+  801c23:	e8 8c fd ff ff       	call   8019b4 <fd_lookup>
+  801c28:	83 c4 10             	add    $0x10,%esp
+  801c2b:	85 c0                	test   %eax,%eax
+  801c2d:	78 3c                	js     801c6b <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c2f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c32:	83 ec 08             	sub    $0x8,%esp
+  801c35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c38:	50                   	push   %eax
+  801c39:	ff 33                	push   (%ebx)
+  801c3b:	e8 c4 fd ff ff       	call   801a04 <dev_lookup>
+  801c40:	83 c4 10             	add    $0x10,%esp
+  801c43:	85 c0                	test   %eax,%eax
+  801c45:	78 24                	js     801c6b <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c47:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c4a:	83 e0 03             	and    $0x3,%eax
+  801c4d:	83 f8 01             	cmp    $0x1,%eax
+  801c50:	74 20                	je     801c72 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c55:	8b 40 08             	mov    0x8(%eax),%eax
+  801c58:	85 c0                	test   %eax,%eax
+  801c5a:	74 37                	je     801c93 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c5c:	83 ec 04             	sub    $0x4,%esp
+  801c5f:	ff 75 10             	push   0x10(%ebp)
+  801c62:	ff 75 0c             	push   0xc(%ebp)
+  801c65:	53                   	push   %ebx
+  801c66:	ff d0                	call   *%eax
+  801c68:	83 c4 10             	add    $0x10,%esp
+}
+  801c6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c6e:	5b                   	pop    %ebx
+  801c6f:	5e                   	pop    %esi
+  801c70:	5d                   	pop    %ebp
+  801c71:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c72:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801c77:	8b 40 48             	mov    0x48(%eax),%eax
+  801c7a:	83 ec 04             	sub    $0x4,%esp
+  801c7d:	56                   	push   %esi
+  801c7e:	50                   	push   %eax
+  801c7f:	68 69 59 80 00       	push   $0x805969
+  801c84:	e8 87 e6 ff ff       	call   800310 <cprintf>
+		return -E_INVAL;
+  801c89:	83 c4 10             	add    $0x10,%esp
+  801c8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c91:	eb d8                	jmp    801c6b <read+0x58>
+		return -E_NOT_SUPP;
+  801c93:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c98:	eb d1                	jmp    801c6b <read+0x58>
+
+00801c9a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c9a:	55                   	push   %ebp
+  801c9b:	89 e5                	mov    %esp,%ebp
+  801c9d:	57                   	push   %edi
+  801c9e:	56                   	push   %esi
+  801c9f:	53                   	push   %ebx
+  801ca0:	83 ec 0c             	sub    $0xc,%esp
+  801ca3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ca6:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801ca9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cae:	eb 02                	jmp    801cb2 <readn+0x18>
+  801cb0:	01 c3                	add    %eax,%ebx
+  801cb2:	39 f3                	cmp    %esi,%ebx
+  801cb4:	73 21                	jae    801cd7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cb6:	83 ec 04             	sub    $0x4,%esp
+  801cb9:	89 f0                	mov    %esi,%eax
+  801cbb:	29 d8                	sub    %ebx,%eax
+  801cbd:	50                   	push   %eax
+  801cbe:	89 d8                	mov    %ebx,%eax
+  801cc0:	03 45 0c             	add    0xc(%ebp),%eax
+  801cc3:	50                   	push   %eax
+  801cc4:	57                   	push   %edi
+  801cc5:	e8 49 ff ff ff       	call   801c13 <read>
+		if (m < 0)
+  801cca:	83 c4 10             	add    $0x10,%esp
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	78 04                	js     801cd5 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801cd1:	75 dd                	jne    801cb0 <readn+0x16>
+  801cd3:	eb 02                	jmp    801cd7 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801cd5:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801cd7:	89 d8                	mov    %ebx,%eax
+  801cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cdc:	5b                   	pop    %ebx
+  801cdd:	5e                   	pop    %esi
+  801cde:	5f                   	pop    %edi
+  801cdf:	5d                   	pop    %ebp
+  801ce0:	c3                   	ret
+
+00801ce1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801ce1:	55                   	push   %ebp
+  801ce2:	89 e5                	mov    %esp,%ebp
+  801ce4:	56                   	push   %esi
+  801ce5:	53                   	push   %ebx
+  801ce6:	83 ec 18             	sub    $0x18,%esp
+  801ce9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cef:	50                   	push   %eax
+  801cf0:	53                   	push   %ebx
+  801cf1:	e8 be fc ff ff       	call   8019b4 <fd_lookup>
+  801cf6:	83 c4 10             	add    $0x10,%esp
+  801cf9:	85 c0                	test   %eax,%eax
+  801cfb:	78 37                	js     801d34 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cfd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d00:	83 ec 08             	sub    $0x8,%esp
+  801d03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d06:	50                   	push   %eax
+  801d07:	ff 36                	push   (%esi)
+  801d09:	e8 f6 fc ff ff       	call   801a04 <dev_lookup>
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	85 c0                	test   %eax,%eax
+  801d13:	78 1f                	js     801d34 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d15:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d19:	74 20                	je     801d3b <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801d1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	74 37                	je     801d5c <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801d25:	83 ec 04             	sub    $0x4,%esp
+  801d28:	ff 75 10             	push   0x10(%ebp)
+  801d2b:	ff 75 0c             	push   0xc(%ebp)
+  801d2e:	56                   	push   %esi
+  801d2f:	ff d0                	call   *%eax
+  801d31:	83 c4 10             	add    $0x10,%esp
+}
+  801d34:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d37:	5b                   	pop    %ebx
+  801d38:	5e                   	pop    %esi
+  801d39:	5d                   	pop    %ebp
+  801d3a:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d3b:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801d40:	8b 40 48             	mov    0x48(%eax),%eax
+  801d43:	83 ec 04             	sub    $0x4,%esp
+  801d46:	53                   	push   %ebx
+  801d47:	50                   	push   %eax
+  801d48:	68 85 59 80 00       	push   $0x805985
+  801d4d:	e8 be e5 ff ff       	call   800310 <cprintf>
+		return -E_INVAL;
+  801d52:	83 c4 10             	add    $0x10,%esp
+  801d55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d5a:	eb d8                	jmp    801d34 <write+0x53>
+		return -E_NOT_SUPP;
+  801d5c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d61:	eb d1                	jmp    801d34 <write+0x53>
+
+00801d63 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d63:	55                   	push   %ebp
+  801d64:	89 e5                	mov    %esp,%ebp
+  801d66:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d6c:	50                   	push   %eax
+  801d6d:	ff 75 08             	push   0x8(%ebp)
+  801d70:	e8 3f fc ff ff       	call   8019b4 <fd_lookup>
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	78 0e                	js     801d8a <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d82:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d8a:	c9                   	leave
+  801d8b:	c3                   	ret
+
+00801d8c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d8c:	55                   	push   %ebp
+  801d8d:	89 e5                	mov    %esp,%ebp
+  801d8f:	56                   	push   %esi
+  801d90:	53                   	push   %ebx
+  801d91:	83 ec 18             	sub    $0x18,%esp
+  801d94:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d9a:	50                   	push   %eax
+  801d9b:	53                   	push   %ebx
+  801d9c:	e8 13 fc ff ff       	call   8019b4 <fd_lookup>
+  801da1:	83 c4 10             	add    $0x10,%esp
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 34                	js     801ddc <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801da8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dab:	83 ec 08             	sub    $0x8,%esp
+  801dae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db1:	50                   	push   %eax
+  801db2:	ff 36                	push   (%esi)
+  801db4:	e8 4b fc ff ff       	call   801a04 <dev_lookup>
+  801db9:	83 c4 10             	add    $0x10,%esp
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 1c                	js     801ddc <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dc0:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dc4:	74 1d                	je     801de3 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801dc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc9:	8b 40 18             	mov    0x18(%eax),%eax
+  801dcc:	85 c0                	test   %eax,%eax
+  801dce:	74 34                	je     801e04 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801dd0:	83 ec 08             	sub    $0x8,%esp
+  801dd3:	ff 75 0c             	push   0xc(%ebp)
+  801dd6:	56                   	push   %esi
+  801dd7:	ff d0                	call   *%eax
+  801dd9:	83 c4 10             	add    $0x10,%esp
+}
+  801ddc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ddf:	5b                   	pop    %ebx
+  801de0:	5e                   	pop    %esi
+  801de1:	5d                   	pop    %ebp
+  801de2:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801de3:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801de8:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801deb:	83 ec 04             	sub    $0x4,%esp
+  801dee:	53                   	push   %ebx
+  801def:	50                   	push   %eax
+  801df0:	68 48 59 80 00       	push   $0x805948
+  801df5:	e8 16 e5 ff ff       	call   800310 <cprintf>
+		return -E_INVAL;
+  801dfa:	83 c4 10             	add    $0x10,%esp
+  801dfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e02:	eb d8                	jmp    801ddc <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801e04:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e09:	eb d1                	jmp    801ddc <ftruncate+0x50>
+
+00801e0b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e0b:	55                   	push   %ebp
+  801e0c:	89 e5                	mov    %esp,%ebp
+  801e0e:	56                   	push   %esi
+  801e0f:	53                   	push   %ebx
+  801e10:	83 ec 18             	sub    $0x18,%esp
+  801e13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e16:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e19:	50                   	push   %eax
+  801e1a:	ff 75 08             	push   0x8(%ebp)
+  801e1d:	e8 92 fb ff ff       	call   8019b4 <fd_lookup>
+  801e22:	83 c4 10             	add    $0x10,%esp
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	78 49                	js     801e72 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e29:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e2c:	83 ec 08             	sub    $0x8,%esp
+  801e2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e32:	50                   	push   %eax
+  801e33:	ff 36                	push   (%esi)
+  801e35:	e8 ca fb ff ff       	call   801a04 <dev_lookup>
+  801e3a:	83 c4 10             	add    $0x10,%esp
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	78 31                	js     801e72 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e44:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e48:	74 2f                	je     801e79 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e4a:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e4d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e54:	00 00 00 
+	stat->st_isdir = 0;
+  801e57:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e5e:	00 00 00 
+	stat->st_dev = dev;
+  801e61:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e67:	83 ec 08             	sub    $0x8,%esp
+  801e6a:	53                   	push   %ebx
+  801e6b:	56                   	push   %esi
+  801e6c:	ff 50 14             	call   *0x14(%eax)
+  801e6f:	83 c4 10             	add    $0x10,%esp
+}
+  801e72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e75:	5b                   	pop    %ebx
+  801e76:	5e                   	pop    %esi
+  801e77:	5d                   	pop    %ebp
+  801e78:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e79:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e7e:	eb f2                	jmp    801e72 <fstat+0x67>
+
+00801e80 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e80:	55                   	push   %ebp
+  801e81:	89 e5                	mov    %esp,%ebp
+  801e83:	56                   	push   %esi
+  801e84:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e85:	83 ec 08             	sub    $0x8,%esp
+  801e88:	6a 00                	push   $0x0
+  801e8a:	ff 75 08             	push   0x8(%ebp)
+  801e8d:	e8 bc 02 00 00       	call   80214e <open>
+  801e92:	89 c3                	mov    %eax,%ebx
+  801e94:	83 c4 10             	add    $0x10,%esp
+  801e97:	85 c0                	test   %eax,%eax
+  801e99:	78 1b                	js     801eb6 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e9b:	83 ec 08             	sub    $0x8,%esp
+  801e9e:	ff 75 0c             	push   0xc(%ebp)
+  801ea1:	50                   	push   %eax
+  801ea2:	e8 64 ff ff ff       	call   801e0b <fstat>
+  801ea7:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801ea9:	89 1c 24             	mov    %ebx,(%esp)
+  801eac:	e8 26 fc ff ff       	call   801ad7 <close>
+	return r;
+  801eb1:	83 c4 10             	add    $0x10,%esp
+  801eb4:	89 f3                	mov    %esi,%ebx
+}
+  801eb6:	89 d8                	mov    %ebx,%eax
+  801eb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ebb:	5b                   	pop    %ebx
+  801ebc:	5e                   	pop    %esi
+  801ebd:	5d                   	pop    %ebp
+  801ebe:	c3                   	ret
+
+00801ebf <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801ebf:	55                   	push   %ebp
+  801ec0:	89 e5                	mov    %esp,%ebp
+  801ec2:	57                   	push   %edi
+  801ec3:	56                   	push   %esi
+  801ec4:	53                   	push   %ebx
+  801ec5:	83 ec 0c             	sub    $0xc,%esp
+  801ec8:	89 c7                	mov    %eax,%edi
+  801eca:	89 d3                	mov    %edx,%ebx
+  801ecc:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801ece:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  801ed5:	74 2d                	je     801f04 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801ed7:	6a 07                	push   $0x7
+  801ed9:	68 00 00 81 00       	push   $0x810000
+  801ede:	57                   	push   %edi
+  801edf:	ff 35 00 80 80 00    	push   0x808000
+  801ee5:	e8 4e 31 00 00       	call   805038 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801eea:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801ef1:	6a 00                	push   $0x0
+  801ef3:	56                   	push   %esi
+  801ef4:	53                   	push   %ebx
+  801ef5:	6a 00                	push   $0x0
+  801ef7:	e8 ee 2f 00 00       	call   804eea <ipc_recv_pages>
+}
+  801efc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eff:	5b                   	pop    %ebx
+  801f00:	5e                   	pop    %esi
+  801f01:	5f                   	pop    %edi
+  801f02:	5d                   	pop    %ebp
+  801f03:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f04:	83 ec 0c             	sub    $0xc,%esp
+  801f07:	6a 01                	push   $0x1
+  801f09:	e8 1f 32 00 00       	call   80512d <ipc_find_env>
+  801f0e:	a3 00 80 80 00       	mov    %eax,0x808000
+  801f13:	83 c4 10             	add    $0x10,%esp
+  801f16:	eb bf                	jmp    801ed7 <fsipc_pages+0x18>
+
+00801f18 <fsipc>:
+{
+  801f18:	55                   	push   %ebp
+  801f19:	89 e5                	mov    %esp,%ebp
+  801f1b:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801f1e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f23:	e8 97 ff ff ff       	call   801ebf <fsipc_pages>
+}
+  801f28:	c9                   	leave
+  801f29:	c3                   	ret
+
+00801f2a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f2a:	55                   	push   %ebp
+  801f2b:	89 e5                	mov    %esp,%ebp
+  801f2d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f33:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f36:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  801f3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f3e:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f43:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f48:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f4d:	e8 c6 ff ff ff       	call   801f18 <fsipc>
+}
+  801f52:	c9                   	leave
+  801f53:	c3                   	ret
+
+00801f54 <devfile_flush>:
+{
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+  801f57:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f60:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f6f:	e8 a4 ff ff ff       	call   801f18 <fsipc>
+}
+  801f74:	c9                   	leave
+  801f75:	c3                   	ret
+
+00801f76 <devfile_stat>:
+{
+  801f76:	55                   	push   %ebp
+  801f77:	89 e5                	mov    %esp,%ebp
+  801f79:	53                   	push   %ebx
+  801f7a:	83 ec 04             	sub    $0x4,%esp
+  801f7d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f80:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f83:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f86:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f90:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f95:	e8 7e ff ff ff       	call   801f18 <fsipc>
+  801f9a:	85 c0                	test   %eax,%eax
+  801f9c:	78 2c                	js     801fca <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f9e:	83 ec 08             	sub    $0x8,%esp
+  801fa1:	68 00 00 81 00       	push   $0x810000
+  801fa6:	53                   	push   %ebx
+  801fa7:	e8 4b e9 ff ff       	call   8008f7 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801fac:	a1 80 00 81 00       	mov    0x810080,%eax
+  801fb1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fb7:	a1 84 00 81 00       	mov    0x810084,%eax
+  801fbc:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801fc2:	83 c4 10             	add    $0x10,%esp
+  801fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <devfile_write>:
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	83 ec 0c             	sub    $0xc,%esp
+  801fd5:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801fd8:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801fdd:	39 d0                	cmp    %edx,%eax
+  801fdf:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fe5:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fe8:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  801fee:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801ff3:	50                   	push   %eax
+  801ff4:	ff 75 0c             	push   0xc(%ebp)
+  801ff7:	68 08 00 81 00       	push   $0x810008
+  801ffc:	e8 7c ea ff ff       	call   800a7d <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802001:	ba 00 00 00 00       	mov    $0x0,%edx
+  802006:	b8 04 00 00 00       	mov    $0x4,%eax
+  80200b:	e8 08 ff ff ff       	call   801f18 <fsipc>
+}
+  802010:	c9                   	leave
+  802011:	c3                   	ret
+
+00802012 <devfile_read>:
+{
+  802012:	55                   	push   %ebp
+  802013:	89 e5                	mov    %esp,%ebp
+  802015:	57                   	push   %edi
+  802016:	56                   	push   %esi
+  802017:	53                   	push   %ebx
+  802018:	83 ec 1c             	sub    $0x1c,%esp
+  80201b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80201e:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802021:	89 fe                	mov    %edi,%esi
+  802023:	c1 ee 0c             	shr    $0xc,%esi
+  802026:	b8 20 00 00 00       	mov    $0x20,%eax
+  80202b:	39 c6                	cmp    %eax,%esi
+  80202d:	0f 47 f0             	cmova  %eax,%esi
+  802030:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802033:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802038:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80203b:	eb 14                	jmp    802051 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80203d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  802044:	05 00 10 00 00       	add    $0x1000,%eax
+  802049:	f6 c6 06             	test   $0x6,%dh
+  80204c:	75 42                	jne    802090 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  80204e:	83 c1 01             	add    $0x1,%ecx
+  802051:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802054:	39 f1                	cmp    %esi,%ecx
+  802056:	0f 84 95 00 00 00    	je     8020f1 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80205c:	89 c2                	mov    %eax,%edx
+  80205e:	c1 ea 16             	shr    $0x16,%edx
+  802061:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802068:	f6 c2 01             	test   $0x1,%dl
+  80206b:	74 23                	je     802090 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80206d:	89 c2                	mov    %eax,%edx
+  80206f:	c1 ea 0c             	shr    $0xc,%edx
+  802072:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802079:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  80207f:	74 0f                	je     802090 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  802081:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802088:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  80208e:	75 ad                	jne    80203d <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802090:	85 c9                	test   %ecx,%ecx
+  802092:	74 11                	je     8020a5 <devfile_read+0x93>
+  802094:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80209b:	75 08                	jne    8020a5 <devfile_read+0x93>
+  80209d:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  8020a3:	74 50                	je     8020f5 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020a5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8020a8:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  8020ad:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020bd:	e8 56 fe ff ff       	call   801f18 <fsipc>
+  8020c2:	89 c6                	mov    %eax,%esi
+  8020c4:	85 c0                	test   %eax,%eax
+  8020c6:	78 1f                	js     8020e7 <devfile_read+0xd5>
+	assert(r <= n);
+  8020c8:	39 c7                	cmp    %eax,%edi
+  8020ca:	72 50                	jb     80211c <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  8020cc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020d1:	7f 62                	jg     802135 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8020d3:	83 ec 04             	sub    $0x4,%esp
+  8020d6:	50                   	push   %eax
+  8020d7:	68 00 00 81 00       	push   $0x810000
+  8020dc:	ff 75 0c             	push   0xc(%ebp)
+  8020df:	e8 99 e9 ff ff       	call   800a7d <memmove>
+	return r;
+  8020e4:	83 c4 10             	add    $0x10,%esp
+}
+  8020e7:	89 f0                	mov    %esi,%eax
+  8020e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ec:	5b                   	pop    %ebx
+  8020ed:	5e                   	pop    %esi
+  8020ee:	5f                   	pop    %edi
+  8020ef:	5d                   	pop    %ebp
+  8020f0:	c3                   	ret
+  8020f1:	89 f1                	mov    %esi,%ecx
+  8020f3:	eb 9b                	jmp    802090 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8020f5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8020f8:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8020fd:	89 c8                	mov    %ecx,%eax
+  8020ff:	c1 e0 0c             	shl    $0xc,%eax
+  802102:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  802107:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80210a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80210f:	e8 ab fd ff ff       	call   801ebf <fsipc_pages>
+  802114:	89 c6                	mov    %eax,%esi
+  802116:	85 c0                	test   %eax,%eax
+  802118:	78 8b                	js     8020a5 <devfile_read+0x93>
+  80211a:	eb cb                	jmp    8020e7 <devfile_read+0xd5>
+	assert(r <= n);
+  80211c:	68 b4 59 80 00       	push   $0x8059b4
+  802121:	68 bb 59 80 00       	push   $0x8059bb
+  802126:	68 a0 00 00 00       	push   $0xa0
+  80212b:	68 d0 59 80 00       	push   $0x8059d0
+  802130:	e8 00 e1 ff ff       	call   800235 <_panic>
+	assert(r <= PGSIZE);
+  802135:	68 db 59 80 00       	push   $0x8059db
+  80213a:	68 bb 59 80 00       	push   $0x8059bb
+  80213f:	68 a1 00 00 00       	push   $0xa1
+  802144:	68 d0 59 80 00       	push   $0x8059d0
+  802149:	e8 e7 e0 ff ff       	call   800235 <_panic>
+
+0080214e <open>:
+{
+  80214e:	55                   	push   %ebp
+  80214f:	89 e5                	mov    %esp,%ebp
+  802151:	56                   	push   %esi
+  802152:	53                   	push   %ebx
+  802153:	83 ec 1c             	sub    $0x1c,%esp
+  802156:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802159:	56                   	push   %esi
+  80215a:	e8 5d e7 ff ff       	call   8008bc <strlen>
+  80215f:	83 c4 10             	add    $0x10,%esp
+  802162:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802167:	7f 6c                	jg     8021d5 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  802169:	83 ec 0c             	sub    $0xc,%esp
+  80216c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80216f:	50                   	push   %eax
+  802170:	e8 eb f7 ff ff       	call   801960 <fd_alloc>
+  802175:	89 c3                	mov    %eax,%ebx
+  802177:	83 c4 10             	add    $0x10,%esp
+  80217a:	85 c0                	test   %eax,%eax
+  80217c:	78 3c                	js     8021ba <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80217e:	83 ec 08             	sub    $0x8,%esp
+  802181:	56                   	push   %esi
+  802182:	68 00 00 81 00       	push   $0x810000
+  802187:	e8 6b e7 ff ff       	call   8008f7 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80218c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80218f:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802194:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802197:	b8 01 00 00 00       	mov    $0x1,%eax
+  80219c:	e8 77 fd ff ff       	call   801f18 <fsipc>
+  8021a1:	89 c3                	mov    %eax,%ebx
+  8021a3:	83 c4 10             	add    $0x10,%esp
+  8021a6:	85 c0                	test   %eax,%eax
+  8021a8:	78 19                	js     8021c3 <open+0x75>
+	return fd2num(fd);
+  8021aa:	83 ec 0c             	sub    $0xc,%esp
+  8021ad:	ff 75 f4             	push   -0xc(%ebp)
+  8021b0:	e8 84 f7 ff ff       	call   801939 <fd2num>
+  8021b5:	89 c3                	mov    %eax,%ebx
+  8021b7:	83 c4 10             	add    $0x10,%esp
+}
+  8021ba:	89 d8                	mov    %ebx,%eax
+  8021bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021bf:	5b                   	pop    %ebx
+  8021c0:	5e                   	pop    %esi
+  8021c1:	5d                   	pop    %ebp
+  8021c2:	c3                   	ret
+		fd_close(fd, 0);
+  8021c3:	83 ec 08             	sub    $0x8,%esp
+  8021c6:	6a 00                	push   $0x0
+  8021c8:	ff 75 f4             	push   -0xc(%ebp)
+  8021cb:	e8 80 f8 ff ff       	call   801a50 <fd_close>
+		return r;
+  8021d0:	83 c4 10             	add    $0x10,%esp
+  8021d3:	eb e5                	jmp    8021ba <open+0x6c>
+		return -E_BAD_PATH;
+  8021d5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021da:	eb de                	jmp    8021ba <open+0x6c>
+
+008021dc <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8021dc:	55                   	push   %ebp
+  8021dd:	89 e5                	mov    %esp,%ebp
+  8021df:	53                   	push   %ebx
+  8021e0:	83 ec 10             	sub    $0x10,%esp
+  8021e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8021e6:	53                   	push   %ebx
+  8021e7:	e8 d0 e6 ff ff       	call   8008bc <strlen>
+  8021ec:	83 c4 10             	add    $0x10,%esp
+  8021ef:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021f4:	7f 25                	jg     80221b <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8021f6:	83 ec 08             	sub    $0x8,%esp
+  8021f9:	53                   	push   %ebx
+  8021fa:	68 00 00 81 00       	push   $0x810000
+  8021ff:	e8 f3 e6 ff ff       	call   8008f7 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802204:	ba 00 00 00 00       	mov    $0x0,%edx
+  802209:	b8 07 00 00 00       	mov    $0x7,%eax
+  80220e:	e8 05 fd ff ff       	call   801f18 <fsipc>
+  802213:	83 c4 10             	add    $0x10,%esp
+}
+  802216:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802219:	c9                   	leave
+  80221a:	c3                   	ret
+		return -E_BAD_PATH;
+  80221b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802220:	eb f4                	jmp    802216 <remove+0x3a>
+
+00802222 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802222:	55                   	push   %ebp
+  802223:	89 e5                	mov    %esp,%ebp
+  802225:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802228:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802232:	e8 e1 fc ff ff       	call   801f18 <fsipc>
+}
+  802237:	c9                   	leave
+  802238:	c3                   	ret
+
+00802239 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  802239:	55                   	push   %ebp
+  80223a:	89 e5                	mov    %esp,%ebp
+  80223c:	53                   	push   %ebx
+  80223d:	83 ec 04             	sub    $0x4,%esp
+  802240:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  802243:	ba 00 00 00 00       	mov    $0x0,%edx
+  802248:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80224d:	e8 c6 fc ff ff       	call   801f18 <fsipc>
+  802252:	85 c0                	test   %eax,%eax
+  802254:	78 3c                	js     802292 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802256:	a1 00 00 81 00       	mov    0x810000,%eax
+  80225b:	89 03                	mov    %eax,(%ebx)
+  80225d:	a1 04 00 81 00       	mov    0x810004,%eax
+  802262:	89 43 04             	mov    %eax,0x4(%ebx)
+  802265:	a1 08 00 81 00       	mov    0x810008,%eax
+  80226a:	89 43 08             	mov    %eax,0x8(%ebx)
+  80226d:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  802272:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802275:	a1 10 00 81 00       	mov    0x810010,%eax
+  80227a:	89 43 10             	mov    %eax,0x10(%ebx)
+  80227d:	a1 14 00 81 00       	mov    0x810014,%eax
+  802282:	89 43 14             	mov    %eax,0x14(%ebx)
+  802285:	a1 18 00 81 00       	mov    0x810018,%eax
+  80228a:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80228d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802292:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802295:	c9                   	leave
+  802296:	c3                   	ret
+
+00802297 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  802297:	55                   	push   %ebp
+  802298:	89 e5                	mov    %esp,%ebp
+  80229a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80229d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a0:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  8022a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022aa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8022af:	e8 64 fc ff ff       	call   801f18 <fsipc>
+}
+  8022b4:	c9                   	leave
+  8022b5:	c3                   	ret
+
+008022b6 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022b6:	55                   	push   %ebp
+  8022b7:	89 e5                	mov    %esp,%ebp
+  8022b9:	56                   	push   %esi
+  8022ba:	53                   	push   %ebx
+  8022bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8022be:	83 ec 0c             	sub    $0xc,%esp
+  8022c1:	ff 75 08             	push   0x8(%ebp)
+  8022c4:	e8 80 f6 ff ff       	call   801949 <fd2data>
+  8022c9:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8022cb:	83 c4 08             	add    $0x8,%esp
+  8022ce:	68 e7 59 80 00       	push   $0x8059e7
+  8022d3:	53                   	push   %ebx
+  8022d4:	e8 1e e6 ff ff       	call   8008f7 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8022d9:	8b 46 04             	mov    0x4(%esi),%eax
+  8022dc:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  8022e2:	2b 0e                	sub    (%esi),%ecx
+  8022e4:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  8022e9:	89 c8                	mov    %ecx,%eax
+  8022eb:	f7 e2                	mul    %edx
+  8022ed:	c1 ea 0c             	shr    $0xc,%edx
+  8022f0:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8022f6:	29 d1                	sub    %edx,%ecx
+  8022f8:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  8022fe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802305:	00 00 00 
+	stat->st_dev = &devpipe;
+  802308:	c7 83 88 00 00 00 20 	movl   $0x807020,0x88(%ebx)
+  80230f:	70 80 00 
+	return 0;
+}
+  802312:	b8 00 00 00 00       	mov    $0x0,%eax
+  802317:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80231a:	5b                   	pop    %ebx
+  80231b:	5e                   	pop    %esi
+  80231c:	5d                   	pop    %ebp
+  80231d:	c3                   	ret
+
+0080231e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80231e:	55                   	push   %ebp
+  80231f:	89 e5                	mov    %esp,%ebp
+  802321:	53                   	push   %ebx
+  802322:	83 ec 0c             	sub    $0xc,%esp
+  802325:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802328:	53                   	push   %ebx
+  802329:	6a 00                	push   $0x0
+  80232b:	e8 3f eb ff ff       	call   800e6f <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802330:	89 1c 24             	mov    %ebx,(%esp)
+  802333:	e8 11 f6 ff ff       	call   801949 <fd2data>
+  802338:	83 c4 08             	add    $0x8,%esp
+  80233b:	50                   	push   %eax
+  80233c:	6a 00                	push   $0x0
+  80233e:	e8 2c eb ff ff       	call   800e6f <sys_page_unmap>
+}
+  802343:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802346:	c9                   	leave
+  802347:	c3                   	ret
+
+00802348 <_pipeisclosed>:
+{
+  802348:	55                   	push   %ebp
+  802349:	89 e5                	mov    %esp,%ebp
+  80234b:	57                   	push   %edi
+  80234c:	56                   	push   %esi
+  80234d:	53                   	push   %ebx
+  80234e:	83 ec 1c             	sub    $0x1c,%esp
+  802351:	89 c7                	mov    %eax,%edi
+  802353:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802355:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80235a:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80235d:	83 ec 0c             	sub    $0xc,%esp
+  802360:	57                   	push   %edi
+  802361:	e8 06 2e 00 00       	call   80516c <pageref>
+  802366:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802369:	89 34 24             	mov    %esi,(%esp)
+  80236c:	e8 fb 2d 00 00       	call   80516c <pageref>
+		nn = thisenv->env_runs;
+  802371:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802377:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  80237a:	83 c4 10             	add    $0x10,%esp
+  80237d:	39 cb                	cmp    %ecx,%ebx
+  80237f:	74 1b                	je     80239c <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802381:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802384:	75 cf                	jne    802355 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802386:	8b 42 58             	mov    0x58(%edx),%eax
+  802389:	6a 01                	push   $0x1
+  80238b:	50                   	push   %eax
+  80238c:	53                   	push   %ebx
+  80238d:	68 ee 59 80 00       	push   $0x8059ee
+  802392:	e8 79 df ff ff       	call   800310 <cprintf>
+  802397:	83 c4 10             	add    $0x10,%esp
+  80239a:	eb b9                	jmp    802355 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80239c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80239f:	0f 94 c0             	sete   %al
+  8023a2:	0f b6 c0             	movzbl %al,%eax
+}
+  8023a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023a8:	5b                   	pop    %ebx
+  8023a9:	5e                   	pop    %esi
+  8023aa:	5f                   	pop    %edi
+  8023ab:	5d                   	pop    %ebp
+  8023ac:	c3                   	ret
+
+008023ad <devpipe_read>:
+{
+  8023ad:	55                   	push   %ebp
+  8023ae:	89 e5                	mov    %esp,%ebp
+  8023b0:	57                   	push   %edi
+  8023b1:	56                   	push   %esi
+  8023b2:	53                   	push   %ebx
+  8023b3:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  8023b6:	ff 75 08             	push   0x8(%ebp)
+  8023b9:	e8 8b f5 ff ff       	call   801949 <fd2data>
+  8023be:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  8023c0:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  8023c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8023c6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8023c9:	8b 7b 04             	mov    0x4(%ebx),%edi
+  8023cc:	8b 0b                	mov    (%ebx),%ecx
+  8023ce:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  8023d4:	29 ce                	sub    %ecx,%esi
+  8023d6:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8023db:	f7 e6                	mul    %esi
+  8023dd:	c1 ea 0c             	shr    $0xc,%edx
+  8023e0:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  8023e6:	29 c6                	sub    %eax,%esi
+  8023e8:	89 f2                	mov    %esi,%edx
+  8023ea:	75 43                	jne    80242f <devpipe_read+0x82>
+		ref = pageref(p);
+  8023ec:	83 ec 0c             	sub    $0xc,%esp
+  8023ef:	53                   	push   %ebx
+  8023f0:	e8 77 2d 00 00       	call   80516c <pageref>
+  8023f5:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  8023f7:	89 da                	mov    %ebx,%edx
+  8023f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023fc:	e8 47 ff ff ff       	call   802348 <_pipeisclosed>
+  802401:	83 c4 10             	add    $0x10,%esp
+  802404:	85 c0                	test   %eax,%eax
+  802406:	0f 85 c1 00 00 00    	jne    8024cd <devpipe_read+0x120>
+	*sleeping = 1;
+  80240c:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802413:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802418:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  80241b:	75 ac                	jne    8023c9 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  80241d:	83 ec 04             	sub    $0x4,%esp
+  802420:	56                   	push   %esi
+  802421:	57                   	push   %edi
+  802422:	ff 75 e4             	push   -0x1c(%ebp)
+  802425:	e8 99 ee ff ff       	call   8012c3 <sys_futex_wait>
+  80242a:	83 c4 10             	add    $0x10,%esp
+  80242d:	eb 9a                	jmp    8023c9 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  80242f:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802432:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802436:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802438:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80243d:	f7 e1                	mul    %ecx
+  80243f:	c1 ea 0b             	shr    $0xb,%edx
+  802442:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802448:	29 c1                	sub    %eax,%ecx
+  80244a:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  80244c:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802451:	29 cf                	sub    %ecx,%edi
+  802453:	39 f7                	cmp    %esi,%edi
+  802455:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802458:	8d 43 10             	lea    0x10(%ebx),%eax
+  80245b:	83 ec 04             	sub    $0x4,%esp
+  80245e:	57                   	push   %edi
+  80245f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802462:	01 c2                	add    %eax,%edx
+  802464:	52                   	push   %edx
+  802465:	ff 75 0c             	push   0xc(%ebp)
+  802468:	e8 10 e6 ff ff       	call   800a7d <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  80246d:	83 c4 0c             	add    $0xc,%esp
+  802470:	89 f1                	mov    %esi,%ecx
+  802472:	29 f9                	sub    %edi,%ecx
+  802474:	51                   	push   %ecx
+  802475:	ff 75 e4             	push   -0x1c(%ebp)
+  802478:	89 f8                	mov    %edi,%eax
+  80247a:	03 45 0c             	add    0xc(%ebp),%eax
+  80247d:	50                   	push   %eax
+  80247e:	e8 fa e5 ff ff       	call   800a7d <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802483:	89 f1                	mov    %esi,%ecx
+  802485:	03 0b                	add    (%ebx),%ecx
+  802487:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80248c:	f7 e1                	mul    %ecx
+  80248e:	c1 ea 0c             	shr    $0xc,%edx
+  802491:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802497:	29 d1                	sub    %edx,%ecx
+  802499:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  80249b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8024a0:	83 c4 10             	add    $0x10,%esp
+  8024a3:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  8024a7:	75 0a                	jne    8024b3 <devpipe_read+0x106>
+	return n;
+  8024a9:	89 f0                	mov    %esi,%eax
+}
+  8024ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ae:	5b                   	pop    %ebx
+  8024af:	5e                   	pop    %esi
+  8024b0:	5f                   	pop    %edi
+  8024b1:	5d                   	pop    %ebp
+  8024b2:	c3                   	ret
+		*sleeping = 0;
+  8024b3:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  8024ba:	83 ec 08             	sub    $0x8,%esp
+  8024bd:	68 00 04 00 00       	push   $0x400
+  8024c2:	53                   	push   %ebx
+  8024c3:	e8 4b ee ff ff       	call   801313 <sys_futex_wake>
+  8024c8:	83 c4 10             	add    $0x10,%esp
+  8024cb:	eb dc                	jmp    8024a9 <devpipe_read+0xfc>
+			return 0;
+  8024cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d2:	eb d7                	jmp    8024ab <devpipe_read+0xfe>
+
+008024d4 <devpipe_write>:
+{
+  8024d4:	55                   	push   %ebp
+  8024d5:	89 e5                	mov    %esp,%ebp
+  8024d7:	57                   	push   %edi
+  8024d8:	56                   	push   %esi
+  8024d9:	53                   	push   %ebx
+  8024da:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  8024dd:	ff 75 08             	push   0x8(%ebp)
+  8024e0:	e8 64 f4 ff ff       	call   801949 <fd2data>
+  8024e5:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  8024e7:	83 c4 10             	add    $0x10,%esp
+  8024ea:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8024f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024f4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8024f7:	0f 83 23 01 00 00    	jae    802620 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  8024fd:	8b 77 04             	mov    0x4(%edi),%esi
+  802500:	8b 1f                	mov    (%edi),%ebx
+  802502:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802508:	29 d9                	sub    %ebx,%ecx
+  80250a:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  80250f:	f7 e1                	mul    %ecx
+  802511:	c1 ea 0c             	shr    $0xc,%edx
+  802514:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  80251a:	29 c1                	sub    %eax,%ecx
+  80251c:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  80251e:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802524:	75 40                	jne    802566 <devpipe_write+0x92>
+			ref = pageref(p);
+  802526:	83 ec 0c             	sub    $0xc,%esp
+  802529:	57                   	push   %edi
+  80252a:	e8 3d 2c 00 00       	call   80516c <pageref>
+  80252f:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802531:	89 fa                	mov    %edi,%edx
+  802533:	8b 45 08             	mov    0x8(%ebp),%eax
+  802536:	e8 0d fe ff ff       	call   802348 <_pipeisclosed>
+  80253b:	83 c4 10             	add    $0x10,%esp
+  80253e:	85 c0                	test   %eax,%eax
+  802540:	0f 85 d5 00 00 00    	jne    80261b <devpipe_write+0x147>
+	*sleeping = 1;
+  802546:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  80254d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802552:	39 1f                	cmp    %ebx,(%edi)
+  802554:	75 a7                	jne    8024fd <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802556:	83 ec 04             	sub    $0x4,%esp
+  802559:	56                   	push   %esi
+  80255a:	53                   	push   %ebx
+  80255b:	57                   	push   %edi
+  80255c:	e8 62 ed ff ff       	call   8012c3 <sys_futex_wait>
+  802561:	83 c4 10             	add    $0x10,%esp
+  802564:	eb 97                	jmp    8024fd <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802566:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802569:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80256c:	29 c1                	sub    %eax,%ecx
+  80256e:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802573:	89 d8                	mov    %ebx,%eax
+  802575:	29 d0                	sub    %edx,%eax
+  802577:	39 c1                	cmp    %eax,%ecx
+  802579:	0f 46 c1             	cmovbe %ecx,%eax
+  80257c:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  80257e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802583:	f7 e6                	mul    %esi
+  802585:	c1 ea 0b             	shr    $0xb,%edx
+  802588:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  80258e:	29 c6                	sub    %eax,%esi
+  802590:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802592:	29 f3                	sub    %esi,%ebx
+  802594:	39 cb                	cmp    %ecx,%ebx
+  802596:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802599:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  80259c:	8d 77 10             	lea    0x10(%edi),%esi
+  80259f:	83 ec 04             	sub    $0x4,%esp
+  8025a2:	53                   	push   %ebx
+  8025a3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025a6:	03 45 0c             	add    0xc(%ebp),%eax
+  8025a9:	50                   	push   %eax
+  8025aa:	01 f2                	add    %esi,%edx
+  8025ac:	52                   	push   %edx
+  8025ad:	e8 cb e4 ff ff       	call   800a7d <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  8025b2:	83 c4 0c             	add    $0xc,%esp
+  8025b5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025b8:	29 d8                	sub    %ebx,%eax
+  8025ba:	50                   	push   %eax
+  8025bb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025be:	01 d3                	add    %edx,%ebx
+  8025c0:	03 5d 0c             	add    0xc(%ebp),%ebx
+  8025c3:	53                   	push   %ebx
+  8025c4:	56                   	push   %esi
+  8025c5:	e8 b3 e4 ff ff       	call   800a7d <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  8025ca:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025cd:	03 4f 04             	add    0x4(%edi),%ecx
+  8025d0:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  8025d5:	f7 e1                	mul    %ecx
+  8025d7:	c1 ea 0c             	shr    $0xc,%edx
+  8025da:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  8025e0:	29 d1                	sub    %edx,%ecx
+  8025e2:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  8025e5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  8025ea:	83 c4 10             	add    $0x10,%esp
+  8025ed:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  8025f1:	75 0b                	jne    8025fe <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  8025f3:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8025f6:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  8025f9:	e9 f3 fe ff ff       	jmp    8024f1 <devpipe_write+0x1d>
+		*sleeping = 0;
+  8025fe:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802605:	83 ec 08             	sub    $0x8,%esp
+  802608:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  80260d:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802610:	50                   	push   %eax
+  802611:	e8 fd ec ff ff       	call   801313 <sys_futex_wake>
+  802616:	83 c4 10             	add    $0x10,%esp
+  802619:	eb d8                	jmp    8025f3 <devpipe_write+0x11f>
+				return 0;
+  80261b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802620:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802623:	5b                   	pop    %ebx
+  802624:	5e                   	pop    %esi
+  802625:	5f                   	pop    %edi
+  802626:	5d                   	pop    %ebp
+  802627:	c3                   	ret
+
+00802628 <pipe>:
+{
+  802628:	55                   	push   %ebp
+  802629:	89 e5                	mov    %esp,%ebp
+  80262b:	56                   	push   %esi
+  80262c:	53                   	push   %ebx
+  80262d:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802630:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802633:	50                   	push   %eax
+  802634:	e8 27 f3 ff ff       	call   801960 <fd_alloc>
+  802639:	89 c3                	mov    %eax,%ebx
+  80263b:	83 c4 10             	add    $0x10,%esp
+  80263e:	85 c0                	test   %eax,%eax
+  802640:	0f 88 23 01 00 00    	js     802769 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802646:	83 ec 04             	sub    $0x4,%esp
+  802649:	68 07 04 00 00       	push   $0x407
+  80264e:	ff 75 f4             	push   -0xc(%ebp)
+  802651:	6a 00                	push   $0x0
+  802653:	e8 92 e7 ff ff       	call   800dea <sys_page_alloc>
+  802658:	89 c3                	mov    %eax,%ebx
+  80265a:	83 c4 10             	add    $0x10,%esp
+  80265d:	85 c0                	test   %eax,%eax
+  80265f:	0f 88 04 01 00 00    	js     802769 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802665:	83 ec 0c             	sub    $0xc,%esp
+  802668:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80266b:	50                   	push   %eax
+  80266c:	e8 ef f2 ff ff       	call   801960 <fd_alloc>
+  802671:	89 c3                	mov    %eax,%ebx
+  802673:	83 c4 10             	add    $0x10,%esp
+  802676:	85 c0                	test   %eax,%eax
+  802678:	0f 88 db 00 00 00    	js     802759 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80267e:	83 ec 04             	sub    $0x4,%esp
+  802681:	68 07 04 00 00       	push   $0x407
+  802686:	ff 75 f0             	push   -0x10(%ebp)
+  802689:	6a 00                	push   $0x0
+  80268b:	e8 5a e7 ff ff       	call   800dea <sys_page_alloc>
+  802690:	89 c3                	mov    %eax,%ebx
+  802692:	83 c4 10             	add    $0x10,%esp
+  802695:	85 c0                	test   %eax,%eax
+  802697:	0f 88 bc 00 00 00    	js     802759 <pipe+0x131>
+	va = fd2data(fd0);
+  80269d:	83 ec 0c             	sub    $0xc,%esp
+  8026a0:	ff 75 f4             	push   -0xc(%ebp)
+  8026a3:	e8 a1 f2 ff ff       	call   801949 <fd2data>
+  8026a8:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026aa:	83 c4 0c             	add    $0xc,%esp
+  8026ad:	68 07 04 00 00       	push   $0x407
+  8026b2:	50                   	push   %eax
+  8026b3:	6a 00                	push   $0x0
+  8026b5:	e8 30 e7 ff ff       	call   800dea <sys_page_alloc>
+  8026ba:	89 c3                	mov    %eax,%ebx
+  8026bc:	83 c4 10             	add    $0x10,%esp
+  8026bf:	85 c0                	test   %eax,%eax
+  8026c1:	0f 88 82 00 00 00    	js     802749 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026c7:	83 ec 0c             	sub    $0xc,%esp
+  8026ca:	ff 75 f0             	push   -0x10(%ebp)
+  8026cd:	e8 77 f2 ff ff       	call   801949 <fd2data>
+  8026d2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8026d9:	50                   	push   %eax
+  8026da:	6a 00                	push   $0x0
+  8026dc:	56                   	push   %esi
+  8026dd:	6a 00                	push   $0x0
+  8026df:	e8 49 e7 ff ff       	call   800e2d <sys_page_map>
+  8026e4:	89 c3                	mov    %eax,%ebx
+  8026e6:	83 c4 20             	add    $0x20,%esp
+  8026e9:	85 c0                	test   %eax,%eax
+  8026eb:	78 4e                	js     80273b <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  8026ed:	a1 20 70 80 00       	mov    0x807020,%eax
+  8026f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026f5:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  8026f7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026fa:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802701:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802704:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802706:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802709:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802710:	83 ec 0c             	sub    $0xc,%esp
+  802713:	ff 75 f4             	push   -0xc(%ebp)
+  802716:	e8 1e f2 ff ff       	call   801939 <fd2num>
+  80271b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80271e:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802720:	83 c4 04             	add    $0x4,%esp
+  802723:	ff 75 f0             	push   -0x10(%ebp)
+  802726:	e8 0e f2 ff ff       	call   801939 <fd2num>
+  80272b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80272e:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802731:	83 c4 10             	add    $0x10,%esp
+  802734:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802739:	eb 2e                	jmp    802769 <pipe+0x141>
+	sys_page_unmap(0, va);
+  80273b:	83 ec 08             	sub    $0x8,%esp
+  80273e:	56                   	push   %esi
+  80273f:	6a 00                	push   $0x0
+  802741:	e8 29 e7 ff ff       	call   800e6f <sys_page_unmap>
+  802746:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802749:	83 ec 08             	sub    $0x8,%esp
+  80274c:	ff 75 f0             	push   -0x10(%ebp)
+  80274f:	6a 00                	push   $0x0
+  802751:	e8 19 e7 ff ff       	call   800e6f <sys_page_unmap>
+  802756:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802759:	83 ec 08             	sub    $0x8,%esp
+  80275c:	ff 75 f4             	push   -0xc(%ebp)
+  80275f:	6a 00                	push   $0x0
+  802761:	e8 09 e7 ff ff       	call   800e6f <sys_page_unmap>
+  802766:	83 c4 10             	add    $0x10,%esp
+}
+  802769:	89 d8                	mov    %ebx,%eax
+  80276b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80276e:	5b                   	pop    %ebx
+  80276f:	5e                   	pop    %esi
+  802770:	5d                   	pop    %ebp
+  802771:	c3                   	ret
+
+00802772 <pipeisclosed>:
+{
+  802772:	55                   	push   %ebp
+  802773:	89 e5                	mov    %esp,%ebp
+  802775:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802778:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80277b:	50                   	push   %eax
+  80277c:	ff 75 08             	push   0x8(%ebp)
+  80277f:	e8 30 f2 ff ff       	call   8019b4 <fd_lookup>
+  802784:	83 c4 10             	add    $0x10,%esp
+  802787:	85 c0                	test   %eax,%eax
+  802789:	78 18                	js     8027a3 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80278b:	83 ec 0c             	sub    $0xc,%esp
+  80278e:	ff 75 f4             	push   -0xc(%ebp)
+  802791:	e8 b3 f1 ff ff       	call   801949 <fd2data>
+  802796:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802798:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80279b:	e8 a8 fb ff ff       	call   802348 <_pipeisclosed>
+  8027a0:	83 c4 10             	add    $0x10,%esp
+}
+  8027a3:	c9                   	leave
+  8027a4:	c3                   	ret
+
+008027a5 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8027a5:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8027a7:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  8027ad:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8027b3:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8027b9:	39 d0                	cmp    %edx,%eax
+  8027bb:	74 2e                	je     8027eb <segment_lookup+0x46>
+{
+  8027bd:	55                   	push   %ebp
+  8027be:	89 e5                	mov    %esp,%ebp
+  8027c0:	57                   	push   %edi
+  8027c1:	56                   	push   %esi
+  8027c2:	53                   	push   %ebx
+  8027c3:	eb 07                	jmp    8027cc <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8027c5:	83 c0 20             	add    $0x20,%eax
+  8027c8:	39 d0                	cmp    %edx,%eax
+  8027ca:	74 15                	je     8027e1 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8027cc:	8b 18                	mov    (%eax),%ebx
+  8027ce:	39 d9                	cmp    %ebx,%ecx
+  8027d0:	72 f3                	jb     8027c5 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8027d2:	8b 38                	mov    (%eax),%edi
+  8027d4:	8b 58 04             	mov    0x4(%eax),%ebx
+  8027d7:	89 ce                	mov    %ecx,%esi
+  8027d9:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8027db:	39 de                	cmp    %ebx,%esi
+  8027dd:	73 e6                	jae    8027c5 <segment_lookup+0x20>
+  8027df:	eb 05                	jmp    8027e6 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8027e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027e6:	5b                   	pop    %ebx
+  8027e7:	5e                   	pop    %esi
+  8027e8:	5f                   	pop    %edi
+  8027e9:	5d                   	pop    %ebp
+  8027ea:	c3                   	ret
+	return NULL;
+  8027eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027f0:	c3                   	ret
+
+008027f1 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  8027f1:	55                   	push   %ebp
+  8027f2:	89 e5                	mov    %esp,%ebp
+  8027f4:	53                   	push   %ebx
+  8027f5:	83 ec 04             	sub    $0x4,%esp
+  8027f8:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8027fa:	c1 e8 16             	shr    $0x16,%eax
+  8027fd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802804:	25 81 00 00 00       	and    $0x81,%eax
+  802809:	83 f8 01             	cmp    $0x1,%eax
+  80280c:	75 6b                	jne    802879 <page_is_clean+0x88>
+  80280e:	89 da                	mov    %ebx,%edx
+  802810:	c1 ea 0c             	shr    $0xc,%edx
+  802813:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80281a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80281f:	f6 c1 01             	test   $0x1,%cl
+  802822:	74 5a                	je     80287e <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802824:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80282b:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802831:	75 4b                	jne    80287e <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802833:	89 d8                	mov    %ebx,%eax
+  802835:	e8 6b ff ff ff       	call   8027a5 <segment_lookup>
+  80283a:	89 c2                	mov    %eax,%edx
+		return 1;
+  80283c:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802841:	85 d2                	test   %edx,%edx
+  802843:	75 39                	jne    80287e <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802845:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  80284b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802850:	eb 03                	jmp    802855 <page_is_clean+0x64>
+  802852:	83 c0 01             	add    $0x1,%eax
+  802855:	39 c2                	cmp    %eax,%edx
+  802857:	7e 19                	jle    802872 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802859:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  802860:	72 f0                	jb     802852 <page_is_clean+0x61>
+  802862:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  802869:	73 e7                	jae    802852 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  80286b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802870:	eb 0c                	jmp    80287e <page_is_clean+0x8d>
+	return 0;
+  802872:	b8 00 00 00 00       	mov    $0x0,%eax
+  802877:	eb 05                	jmp    80287e <page_is_clean+0x8d>
+		return 0;
+  802879:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80287e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802881:	c9                   	leave
+  802882:	c3                   	ret
+
+00802883 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802883:	55                   	push   %ebp
+  802884:	89 e5                	mov    %esp,%ebp
+  802886:	57                   	push   %edi
+  802887:	56                   	push   %esi
+  802888:	53                   	push   %ebx
+  802889:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80288c:	be 00 00 00 00       	mov    $0x0,%esi
+  802891:	eb 19                	jmp    8028ac <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802893:	f7 d3                	not    %ebx
+  802895:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80289b:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80289d:	83 c6 01             	add    $0x1,%esi
+  8028a0:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8028a6:	0f 87 97 00 00 00    	ja     802943 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8028ac:	89 f3                	mov    %esi,%ebx
+  8028ae:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  8028b4:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8028ba:	89 d8                	mov    %ebx,%eax
+  8028bc:	c1 e8 0a             	shr    $0xa,%eax
+  8028bf:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8028c6:	25 81 00 00 00       	and    $0x81,%eax
+  8028cb:	83 f8 01             	cmp    $0x1,%eax
+  8028ce:	75 c3                	jne    802893 <linear_walk+0x10>
+  8028d0:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8028d6:	77 bb                	ja     802893 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8028d8:	89 df                	mov    %ebx,%edi
+  8028da:	c1 e7 0c             	shl    $0xc,%edi
+  8028dd:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8028e0:	89 f8                	mov    %edi,%eax
+  8028e2:	e8 0a ff ff ff       	call   8027f1 <page_is_clean>
+  8028e7:	84 c0                	test   %al,%al
+  8028e9:	75 64                	jne    80294f <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8028eb:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8028f1:	77 aa                	ja     80289d <linear_walk+0x1a>
+  8028f3:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  8028f9:	72 a2                	jb     80289d <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8028fb:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802902:	a8 01                	test   $0x1,%al
+  802904:	74 97                	je     80289d <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802906:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80290d:	f6 c4 04             	test   $0x4,%ah
+  802910:	75 8b                	jne    80289d <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802912:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802919:	f6 c4 02             	test   $0x2,%ah
+  80291c:	0f 85 7b ff ff ff    	jne    80289d <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802922:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802929:	c1 e8 0c             	shr    $0xc,%eax
+  80292c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80292f:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802934:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802938:	66 83 f8 01          	cmp    $0x1,%ax
+  80293c:	76 11                	jbe    80294f <linear_walk+0xcc>
+  80293e:	e9 5a ff ff ff       	jmp    80289d <linear_walk+0x1a>
+  802943:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  802948:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  80294f:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  802955:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802958:	83 c4 1c             	add    $0x1c,%esp
+  80295b:	5b                   	pop    %ebx
+  80295c:	5e                   	pop    %esi
+  80295d:	5f                   	pop    %edi
+  80295e:	5d                   	pop    %ebp
+  80295f:	c3                   	ret
+
+00802960 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802960:	55                   	push   %ebp
+  802961:	89 e5                	mov    %esp,%ebp
+  802963:	56                   	push   %esi
+  802964:	53                   	push   %ebx
+  802965:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  802967:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80296c:	83 e0 7f             	and    $0x7f,%eax
+  80296f:	c1 e0 04             	shl    $0x4,%eax
+  802972:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  802978:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  80297e:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802984:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  80298a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80298f:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  802992:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802997:	83 c0 01             	add    $0x1,%eax
+  80299a:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  80299f:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8029a2:	5b                   	pop    %ebx
+  8029a3:	5e                   	pop    %esi
+  8029a4:	5d                   	pop    %ebp
+  8029a5:	c3                   	ret
+
+008029a6 <page_ring_enter>:
+{
+  8029a6:	55                   	push   %ebp
+  8029a7:	89 e5                	mov    %esp,%ebp
+  8029a9:	57                   	push   %edi
+  8029aa:	56                   	push   %esi
+  8029ab:	53                   	push   %ebx
+  8029ac:	83 ec 18             	sub    $0x18,%esp
+  8029af:	89 c6                	mov    %eax,%esi
+  8029b1:	89 d7                	mov    %edx,%edi
+  8029b3:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8029b5:	6a 00                	push   $0x0
+  8029b7:	6a 00                	push   $0x0
+  8029b9:	6a 00                	push   $0x0
+  8029bb:	6a 07                	push   $0x7
+  8029bd:	ff 35 40 c0 80 00    	push   0x80c040
+  8029c3:	e8 8e 26 00 00       	call   805056 <ipc_call>
+  8029c8:	83 c4 20             	add    $0x20,%esp
+  8029cb:	85 c0                	test   %eax,%eax
+  8029cd:	79 22                	jns    8029f1 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8029cf:	50                   	push   %eax
+  8029d0:	68 06 5a 80 00       	push   $0x805a06
+  8029d5:	68 13 02 00 00       	push   $0x213
+  8029da:	68 1a 5a 80 00       	push   $0x805a1a
+  8029df:	e8 51 d8 ff ff       	call   800235 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8029e4:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8029e9:	83 c0 01             	add    $0x1,%eax
+  8029ec:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  8029f1:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8029f7:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  8029fc:	39 c2                	cmp    %eax,%edx
+  8029fe:	74 24                	je     802a24 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802a00:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  802a05:	83 e0 7f             	and    $0x7f,%eax
+  802a08:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802a0f:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  802a16:	29 f0                	sub    %esi,%eax
+  802a18:	39 d8                	cmp    %ebx,%eax
+  802a1a:	73 c8                	jae    8029e4 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802a1c:	8b 52 04             	mov    0x4(%edx),%edx
+  802a1f:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802a22:	eb c0                	jmp    8029e4 <page_ring_enter+0x3e>
+}
+  802a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a27:	5b                   	pop    %ebx
+  802a28:	5e                   	pop    %esi
+  802a29:	5f                   	pop    %edi
+  802a2a:	5d                   	pop    %ebp
+  802a2b:	c3                   	ret
+
+00802a2c <page_ring_reserve>:
+{
+  802a2c:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802a2e:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802a33:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  802a39:	29 d0                	sub    %edx,%eax
+  802a3b:	ba 80 00 00 00       	mov    $0x80,%edx
+  802a40:	29 ca                	sub    %ecx,%edx
+  802a42:	39 c2                	cmp    %eax,%edx
+  802a44:	72 01                	jb     802a47 <page_ring_reserve+0x1b>
+  802a46:	c3                   	ret
+{
+  802a47:	55                   	push   %ebp
+  802a48:	89 e5                	mov    %esp,%ebp
+  802a4a:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802a4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a52:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a57:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a5c:	e8 45 ff ff ff       	call   8029a6 <page_ring_enter>
+}
+  802a61:	c9                   	leave
+  802a62:	c3                   	ret
+
+00802a63 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802a63:	55                   	push   %ebp
+  802a64:	89 e5                	mov    %esp,%ebp
+  802a66:	53                   	push   %ebx
+  802a67:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  802a6a:	6a 07                	push   $0x7
+  802a6c:	6a 01                	push   $0x1
+  802a6e:	89 c3                	mov    %eax,%ebx
+  802a70:	c1 e3 0c             	shl    $0xc,%ebx
+  802a73:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  802a79:	52                   	push   %edx
+  802a7a:	6a 04                	push   $0x4
+  802a7c:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  802a83:	e8 ce 25 00 00       	call   805056 <ipc_call>
+	sharereqs[i].nslots = 0;
+  802a88:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  802a8f:	00 00 00 
+	return r;
+}
+  802a92:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a95:	c9                   	leave
+  802a96:	c3                   	ret
+
+00802a97 <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  802a97:	55                   	push   %ebp
+  802a98:	89 e5                	mov    %esp,%ebp
+  802a9a:	56                   	push   %esi
+  802a9b:	53                   	push   %ebx
+  802a9c:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  802a9e:	c1 e8 10             	shr    $0x10,%eax
+  802aa1:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  802aa4:	89 c2                	mov    %eax,%edx
+  802aa6:	c1 e2 0c             	shl    $0xc,%edx
+  802aa9:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  802aaf:	8d 5e 01             	lea    0x1(%esi),%ebx
+  802ab2:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  802ab8:	89 c2                	mov    %eax,%edx
+  802aba:	c1 e2 0a             	shl    $0xa,%edx
+  802abd:	01 f2                	add    %esi,%edx
+  802abf:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  802ac6:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  802acc:	74 09                	je     802ad7 <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  802ace:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ad3:	5b                   	pop    %ebx
+  802ad4:	5e                   	pop    %esi
+  802ad5:	5d                   	pop    %ebp
+  802ad6:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  802ad7:	e8 87 ff ff ff       	call   802a63 <page_share_send>
+  802adc:	eb f5                	jmp    802ad3 <page_share_slot+0x3c>
+
+00802ade <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  802ade:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802ae3:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  802ae6:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802aeb:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  802af1:	74 09                	je     802afc <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802af3:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  802af8:	85 c0                	test   %eax,%eax
+  802afa:	75 01                	jne    802afd <page_ring_ready+0x1f>
+}
+  802afc:	c3                   	ret
+{
+  802afd:	55                   	push   %ebp
+  802afe:	89 e5                	mov    %esp,%ebp
+  802b00:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802b03:	68 07 06 00 00       	push   $0x607
+  802b08:	6a 08                	push   $0x8
+  802b0a:	68 00 30 ad de       	push   $0xdead3000
+  802b0f:	6a 00                	push   $0x0
+  802b11:	e8 ff e3 ff ff       	call   800f15 <sys_page_alloc_range>
+  802b16:	83 c4 10             	add    $0x10,%esp
+  802b19:	83 f8 08             	cmp    $0x8,%eax
+  802b1c:	74 1b                	je     802b39 <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802b1e:	83 ec 04             	sub    $0x4,%esp
+  802b21:	6a 08                	push   $0x8
+  802b23:	68 00 30 ad de       	push   $0xdead3000
+  802b28:	6a 00                	push   $0x0
+  802b2a:	e8 54 e4 ff ff       	call   800f83 <sys_page_unmap_range>
+		return 0;
+  802b2f:	83 c4 10             	add    $0x10,%esp
+  802b32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b37:	c9                   	leave
+  802b38:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  802b39:	83 ec 0c             	sub    $0xc,%esp
+  802b3c:	68 07 04 00 00       	push   $0x407
+  802b41:	6a 08                	push   $0x8
+  802b43:	68 00 30 ad de       	push   $0xdead3000
+  802b48:	6a 06                	push   $0x6
+  802b4a:	ff 35 40 c0 80 00    	push   0x80c040
+  802b50:	e8 01 25 00 00       	call   805056 <ipc_call>
+  802b55:	83 c4 20             	add    $0x20,%esp
+  802b58:	85 c0                	test   %eax,%eax
+  802b5a:	78 14                	js     802b70 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802b5c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802b61:	8b 40 48             	mov    0x48(%eax),%eax
+  802b64:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  802b69:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b6e:	eb c7                	jmp    802b37 <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802b70:	83 ec 04             	sub    $0x4,%esp
+  802b73:	6a 08                	push   $0x8
+  802b75:	68 00 30 ad de       	push   $0xdead3000
+  802b7a:	6a 00                	push   $0x0
+  802b7c:	e8 02 e4 ff ff       	call   800f83 <sys_page_unmap_range>
+		return 0;
+  802b81:	83 c4 10             	add    $0x10,%esp
+  802b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b89:	eb ac                	jmp    802b37 <page_ring_ready+0x59>
+
+00802b8b <page_remove_slot>:
+{
+  802b8b:	55                   	push   %ebp
+  802b8c:	89 e5                	mov    %esp,%ebp
+  802b8e:	56                   	push   %esi
+  802b8f:	53                   	push   %ebx
+  802b90:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  802b92:	89 c6                	mov    %eax,%esi
+  802b94:	c1 ee 10             	shr    $0x10,%esi
+  802b97:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802b9a:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  802ba1:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  802ba7:	74 2a                	je     802bd3 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802ba9:	83 ec 0c             	sub    $0xc,%esp
+  802bac:	6a 00                	push   $0x0
+  802bae:	6a 00                	push   $0x0
+  802bb0:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  802bb2:	c1 e3 04             	shl    $0x4,%ebx
+  802bb5:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  802bb8:	53                   	push   %ebx
+  802bb9:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  802bc0:	e8 91 24 00 00       	call   805056 <ipc_call>
+  802bc5:	83 c4 20             	add    $0x20,%esp
+  802bc8:	85 c0                	test   %eax,%eax
+  802bca:	78 2d                	js     802bf9 <page_remove_slot+0x6e>
+}
+  802bcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bcf:	5b                   	pop    %ebx
+  802bd0:	5e                   	pop    %esi
+  802bd1:	5d                   	pop    %ebp
+  802bd2:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  802bd3:	e8 06 ff ff ff       	call   802ade <page_ring_ready>
+  802bd8:	85 c0                	test   %eax,%eax
+  802bda:	74 cd                	je     802ba9 <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  802bdc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802be1:	e8 46 fe ff ff       	call   802a2c <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  802be6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802beb:	89 da                	mov    %ebx,%edx
+  802bed:	b8 02 00 00 00       	mov    $0x2,%eax
+  802bf2:	e8 69 fd ff ff       	call   802960 <page_ring_post>
+		return;
+  802bf7:	eb d3                	jmp    802bcc <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  802bf9:	50                   	push   %eax
+  802bfa:	68 74 5a 80 00       	push   $0x805a74
+  802bff:	68 ac 03 00 00       	push   $0x3ac
+  802c04:	68 1a 5a 80 00       	push   $0x805a1a
+  802c09:	e8 27 d6 ff ff       	call   800235 <_panic>
+
+00802c0e <find_paging_env>:
+	if(pagingenv)
+  802c0e:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802c13:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  802c15:	85 c0                	test   %eax,%eax
+  802c17:	74 05                	je     802c1e <find_paging_env+0x10>
+  802c19:	eb 56                	jmp    802c71 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802c1b:	83 c0 01             	add    $0x1,%eax
+  802c1e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c23:	7f 47                	jg     802c6c <find_paging_env+0x5e>
+  802c25:	83 f9 01             	cmp    $0x1,%ecx
+  802c28:	7f 42                	jg     802c6c <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  802c2a:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c2d:	c1 e2 06             	shl    $0x6,%edx
+  802c30:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c36:	8b 52 50             	mov    0x50(%edx),%edx
+  802c39:	83 fa 02             	cmp    $0x2,%edx
+  802c3c:	75 dd                	jne    802c1b <find_paging_env+0xd>
+  802c3e:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c41:	c1 e2 06             	shl    $0x6,%edx
+  802c44:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c4a:	8b 52 54             	mov    0x54(%edx),%edx
+  802c4d:	85 d2                	test   %edx,%edx
+  802c4f:	74 ca                	je     802c1b <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802c51:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802c54:	c1 e2 06             	shl    $0x6,%edx
+  802c57:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802c5d:	8b 52 48             	mov    0x48(%edx),%edx
+  802c60:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  802c67:	8d 49 01             	lea    0x1(%ecx),%ecx
+  802c6a:	eb af                	jmp    802c1b <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802c6c:	83 f9 02             	cmp    $0x2,%ecx
+  802c6f:	74 01                	je     802c72 <find_paging_env+0x64>
+}
+  802c71:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802c72:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802c77:	8b 40 48             	mov    0x48(%eax),%eax
+  802c7a:	83 e0 01             	and    $0x1,%eax
+  802c7d:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  802c84:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  802c89:	eb e6                	jmp    802c71 <find_paging_env+0x63>
+
+00802c8b <page_add_backed>:
+{
+  802c8b:	55                   	push   %ebp
+  802c8c:	89 e5                	mov    %esp,%ebp
+  802c8e:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  802c91:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  802c96:	83 f8 04             	cmp    $0x4,%eax
+  802c99:	74 35                	je     802cd0 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  802c9b:	89 d1                	mov    %edx,%ecx
+  802c9d:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  802ca3:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  802caa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cad:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  802cb4:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  802cba:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  802cc1:	83 c0 01             	add    $0x1,%eax
+  802cc4:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  802cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cce:	5d                   	pop    %ebp
+  802ccf:	c3                   	ret
+		return -E_NO_MEM;
+  802cd0:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802cd5:	eb f7                	jmp    802cce <page_add_backed+0x43>
+
+00802cd7 <percentage_of_pgdir_to_walk>:
+{
+  802cd7:	55                   	push   %ebp
+  802cd8:	89 e5                	mov    %esp,%ebp
+  802cda:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802cdd:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  802ce1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  802ce4:	db 45 fc             	fildl  -0x4(%ebp)
+  802ce7:	d8 35 00 5f 80 00    	fdivs  0x805f00
+	return ret*ret;
+  802ced:	d8 c8                	fmul   %st(0),%st
+}
+  802cef:	c9                   	leave
+  802cf0:	c3                   	ret
+
+00802cf1 <nfu_with_aging_page_choice_func>:
+{
+  802cf1:	55                   	push   %ebp
+  802cf2:	89 e5                	mov    %esp,%ebp
+  802cf4:	57                   	push   %edi
+  802cf5:	56                   	push   %esi
+  802cf6:	53                   	push   %ebx
+  802cf7:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802cfa:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  802d00:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802d02:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802d07:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d0c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d13:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d18:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802d1b:	eb 18                	jmp    802d35 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802d1d:	f7 d0                	not    %eax
+  802d1f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802d24:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802d26:	83 c2 01             	add    $0x1,%edx
+  802d29:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802d2f:	0f 87 13 01 00 00    	ja     802e48 <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  802d35:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d39:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802d3c:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802d41:	89 c1                	mov    %eax,%ecx
+  802d43:	c1 e9 0a             	shr    $0xa,%ecx
+  802d46:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802d4d:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802d53:	83 f9 01             	cmp    $0x1,%ecx
+  802d56:	75 c5                	jne    802d1d <nfu_with_aging_page_choice_func+0x2c>
+  802d58:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802d5d:	77 be                	ja     802d1d <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802d5f:	89 c1                	mov    %eax,%ecx
+  802d61:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802d64:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  802d6a:	0f 82 a5 00 00 00    	jb     802e15 <nfu_with_aging_page_choice_func+0x124>
+  802d70:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802d76:	0f 87 99 00 00 00    	ja     802e15 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802d7c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802d83:	f6 c1 01             	test   $0x1,%cl
+  802d86:	0f 84 89 00 00 00    	je     802e15 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802d8c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802d93:	f6 c5 04             	test   $0x4,%ch
+  802d96:	75 7d                	jne    802e15 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802d98:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802d9f:	f6 c5 02             	test   $0x2,%ch
+  802da2:	75 71                	jne    802e15 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802da4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802dab:	c1 e9 0c             	shr    $0xc,%ecx
+  802dae:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802db1:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802db7:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802dbb:	66 83 f9 01          	cmp    $0x1,%cx
+  802dbf:	77 54                	ja     802e15 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  802dc1:	89 f9                	mov    %edi,%ecx
+  802dc3:	80 f9 ff             	cmp    $0xff,%cl
+  802dc6:	74 21                	je     802de9 <nfu_with_aging_page_choice_func+0xf8>
+  802dc8:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802dcf:	c1 e9 0c             	shr    $0xc,%ecx
+  802dd2:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802dd5:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ddb:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  802ddf:	89 fb                	mov    %edi,%ebx
+  802de1:	38 d9                	cmp    %bl,%cl
+  802de3:	73 30                	jae    802e15 <nfu_with_aging_page_choice_func+0x124>
+  802de5:	dd d8                	fstp   %st(0)
+  802de7:	eb 02                	jmp    802deb <nfu_with_aging_page_choice_func+0xfa>
+  802de9:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802deb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802df2:	c1 e9 0c             	shr    $0xc,%ecx
+  802df5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802df8:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802dff:	89 fb                	mov    %edi,%ebx
+  802e01:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802e04:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802e07:	db 45 e0             	fildl  -0x20(%ebp)
+  802e0a:	d8 35 00 5f 80 00    	fdivs  0x805f00
+	return ret*ret;
+  802e10:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802e12:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802e15:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802e18:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802e1b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802e22:	df 6d e0             	fildll -0x20(%ebp)
+  802e25:	d9 c1                	fld    %st(1)
+  802e27:	d8 0d 04 5f 80 00    	fmuls  0x805f04
+  802e2d:	d9 c9                	fxch   %st(1)
+  802e2f:	df f1                	fcomip %st(1),%st
+  802e31:	dd d8                	fstp   %st(0)
+  802e33:	0f 82 ed fe ff ff    	jb     802d26 <nfu_with_aging_page_choice_func+0x35>
+  802e39:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802e3b:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  802e40:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802e43:	c1 e0 0c             	shl    $0xc,%eax
+  802e46:	eb 0e                	jmp    802e56 <nfu_with_aging_page_choice_func+0x165>
+  802e48:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802e4a:	89 f8                	mov    %edi,%eax
+  802e4c:	3c ff                	cmp    $0xff,%al
+  802e4e:	74 0e                	je     802e5e <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802e50:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802e53:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802e56:	83 c4 14             	add    $0x14,%esp
+  802e59:	5b                   	pop    %ebx
+  802e5a:	5e                   	pop    %esi
+  802e5b:	5f                   	pop    %edi
+  802e5c:	5d                   	pop    %ebp
+  802e5d:	c3                   	ret
+	pgnum = 0;
+  802e5e:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  802e65:	00 00 00 
+	return (void*)UTOP;
+  802e68:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e6d:	eb e7                	jmp    802e56 <nfu_with_aging_page_choice_func+0x165>
+
+00802e6f <myRand>:
+    state = state * 1664525 + 1013904223;
+  802e6f:	69 05 40 70 80 00 0d 	imul   $0x19660d,0x807040,%eax
+  802e76:	66 19 00 
+  802e79:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802e7e:	a3 40 70 80 00       	mov    %eax,0x807040
+    return state >> 24;
+  802e83:	c1 e8 18             	shr    $0x18,%eax
+}
+  802e86:	c3                   	ret
+
+00802e87 <random_page_choice_func>:
+{
+  802e87:	55                   	push   %ebp
+  802e88:	89 e5                	mov    %esp,%ebp
+  802e8a:	57                   	push   %edi
+  802e8b:	56                   	push   %esi
+  802e8c:	53                   	push   %ebx
+  802e8d:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802e90:	be 00 00 00 00       	mov    $0x0,%esi
+  802e95:	eb 19                	jmp    802eb0 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802e97:	f7 d3                	not    %ebx
+  802e99:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802e9f:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ea1:	83 c6 01             	add    $0x1,%esi
+  802ea4:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802eaa:	0f 87 a0 00 00 00    	ja     802f50 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802eb0:	89 f3                	mov    %esi,%ebx
+  802eb2:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  802eb8:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802ebe:	89 d8                	mov    %ebx,%eax
+  802ec0:	c1 e8 0a             	shr    $0xa,%eax
+  802ec3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802eca:	25 81 00 00 00       	and    $0x81,%eax
+  802ecf:	83 f8 01             	cmp    $0x1,%eax
+  802ed2:	75 c3                	jne    802e97 <random_page_choice_func+0x10>
+  802ed4:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802eda:	77 bb                	ja     802e97 <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802edc:	89 df                	mov    %ebx,%edi
+  802ede:	c1 e7 0c             	shl    $0xc,%edi
+  802ee1:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802ee4:	89 f8                	mov    %edi,%eax
+  802ee6:	e8 06 f9 ff ff       	call   8027f1 <page_is_clean>
+  802eeb:	84 c0                	test   %al,%al
+  802eed:	0f 85 82 00 00 00    	jne    802f75 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802ef3:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802ef9:	72 a6                	jb     802ea1 <random_page_choice_func+0x1a>
+  802efb:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802f01:	77 9e                	ja     802ea1 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f03:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802f0a:	a8 01                	test   $0x1,%al
+  802f0c:	74 93                	je     802ea1 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f0e:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802f15:	f6 c4 04             	test   $0x4,%ah
+  802f18:	75 87                	jne    802ea1 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802f1a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802f21:	f6 c4 02             	test   $0x2,%ah
+  802f24:	0f 85 77 ff ff ff    	jne    802ea1 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802f2a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802f31:	c1 e8 0c             	shr    $0xc,%eax
+  802f34:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f37:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f3c:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f40:	66 83 f8 01          	cmp    $0x1,%ax
+  802f44:	0f 87 57 ff ff ff    	ja     802ea1 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  802f4a:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802f50:	e8 1a ff ff ff       	call   802e6f <myRand>
+  802f55:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  802f5b:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802f60:	29 fe                	sub    %edi,%esi
+  802f62:	0f be c0             	movsbl %al,%eax
+  802f65:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f6a:	f7 f6                	div    %esi
+  802f6c:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802f6e:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802f73:	eb 1c                	jmp    802f91 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  802f75:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  802f7b:	e9 8f 00 00 00       	jmp    80300f <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802f80:	e8 ea fe ff ff       	call   802e6f <myRand>
+  802f85:	0f be c0             	movsbl %al,%eax
+  802f88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f8d:	f7 f6                	div    %esi
+  802f8f:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802f91:	83 eb 01             	sub    $0x1,%ebx
+  802f94:	0f 84 c2 00 00 00    	je     80305c <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  802f9a:	89 d0                	mov    %edx,%eax
+  802f9c:	c1 e8 0a             	shr    $0xa,%eax
+  802f9f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fa6:	25 81 00 00 00       	and    $0x81,%eax
+  802fab:	83 f8 01             	cmp    $0x1,%eax
+  802fae:	75 d0                	jne    802f80 <random_page_choice_func+0xf9>
+  802fb0:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  802fb6:	77 c8                	ja     802f80 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  802fb8:	89 d0                	mov    %edx,%eax
+  802fba:	c1 e0 0c             	shl    $0xc,%eax
+  802fbd:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  802fc2:	72 56                	jb     80301a <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fc4:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  802fc9:	77 65                	ja     803030 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802fcb:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fd2:	f6 c1 01             	test   $0x1,%cl
+  802fd5:	74 59                	je     803030 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802fd7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  802fde:	f6 c5 04             	test   $0x4,%ch
+  802fe1:	75 4d                	jne    803030 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  802fe3:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  802fea:	f6 c5 02             	test   $0x2,%ch
+  802fed:	75 41                	jne    803030 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802fef:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802ff6:	c1 ea 0c             	shr    $0xc,%edx
+  802ff9:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802ffc:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  803002:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  803006:	66 83 fa 01          	cmp    $0x1,%dx
+  80300a:	77 3a                	ja     803046 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  80300c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  80300f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803012:	83 c4 1c             	add    $0x1c,%esp
+  803015:	5b                   	pop    %ebx
+  803016:	5e                   	pop    %esi
+  803017:	5f                   	pop    %edi
+  803018:	5d                   	pop    %ebp
+  803019:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80301a:	e8 50 fe ff ff       	call   802e6f <myRand>
+  80301f:	0f be c0             	movsbl %al,%eax
+  803022:	ba 00 00 00 00       	mov    $0x0,%edx
+  803027:	f7 f6                	div    %esi
+  803029:	01 fa                	add    %edi,%edx
+			continue;
+  80302b:	e9 61 ff ff ff       	jmp    802f91 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803030:	e8 3a fe ff ff       	call   802e6f <myRand>
+  803035:	0f be c0             	movsbl %al,%eax
+  803038:	ba 00 00 00 00       	mov    $0x0,%edx
+  80303d:	f7 f6                	div    %esi
+  80303f:	01 fa                	add    %edi,%edx
+			continue;
+  803041:	e9 4b ff ff ff       	jmp    802f91 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803046:	e8 24 fe ff ff       	call   802e6f <myRand>
+  80304b:	0f be c0             	movsbl %al,%eax
+  80304e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803053:	f7 f6                	div    %esi
+  803055:	01 fa                	add    %edi,%edx
+			continue;
+  803057:	e9 35 ff ff ff       	jmp    802f91 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  80305c:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  803063:	00 00 00 
+	return (void*)UTOP;
+  803066:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  80306d:	eb a0                	jmp    80300f <random_page_choice_func+0x188>
+
+0080306f <nfu>:
+{
+  80306f:	55                   	push   %ebp
+  803070:	89 e5                	mov    %esp,%ebp
+  803072:	57                   	push   %edi
+  803073:	56                   	push   %esi
+  803074:	53                   	push   %ebx
+  803075:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803078:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  80307e:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803080:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803085:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80308a:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803091:	ba 00 00 00 00       	mov    $0x0,%edx
+  803096:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803099:	eb 18                	jmp    8030b3 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80309b:	f7 d0                	not    %eax
+  80309d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030a2:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8030a4:	83 c2 01             	add    $0x1,%edx
+  8030a7:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8030ad:	0f 87 13 01 00 00    	ja     8031c6 <nfu+0x157>
+		++num_searched_ptes;
+  8030b3:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8030b7:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8030ba:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8030bf:	89 c1                	mov    %eax,%ecx
+  8030c1:	c1 e9 0a             	shr    $0xa,%ecx
+  8030c4:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8030cb:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8030d1:	83 f9 01             	cmp    $0x1,%ecx
+  8030d4:	75 c5                	jne    80309b <nfu+0x2c>
+  8030d6:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8030db:	77 be                	ja     80309b <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8030dd:	89 c1                	mov    %eax,%ecx
+  8030df:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8030e2:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  8030e8:	0f 82 a5 00 00 00    	jb     803193 <nfu+0x124>
+  8030ee:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8030f4:	0f 87 99 00 00 00    	ja     803193 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8030fa:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803101:	f6 c1 01             	test   $0x1,%cl
+  803104:	0f 84 89 00 00 00    	je     803193 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80310a:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803111:	f6 c5 04             	test   $0x4,%ch
+  803114:	75 7d                	jne    803193 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803116:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80311d:	f6 c5 02             	test   $0x2,%ch
+  803120:	75 71                	jne    803193 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803122:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803129:	c1 e9 0c             	shr    $0xc,%ecx
+  80312c:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80312f:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803135:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803139:	66 83 f9 01          	cmp    $0x1,%cx
+  80313d:	77 54                	ja     803193 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  80313f:	89 f9                	mov    %edi,%ecx
+  803141:	80 f9 ff             	cmp    $0xff,%cl
+  803144:	74 21                	je     803167 <nfu+0xf8>
+  803146:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80314d:	c1 e9 0c             	shr    $0xc,%ecx
+  803150:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803153:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803159:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  80315d:	89 fb                	mov    %edi,%ebx
+  80315f:	38 d9                	cmp    %bl,%cl
+  803161:	73 30                	jae    803193 <nfu+0x124>
+  803163:	dd d8                	fstp   %st(0)
+  803165:	eb 02                	jmp    803169 <nfu+0xfa>
+  803167:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803169:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803170:	c1 e9 0c             	shr    $0xc,%ecx
+  803173:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803176:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  80317d:	89 fb                	mov    %edi,%ebx
+  80317f:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803182:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803185:	db 45 e0             	fildl  -0x20(%ebp)
+  803188:	d8 35 00 5f 80 00    	fdivs  0x805f00
+	return ret*ret;
+  80318e:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803190:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803193:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803196:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803199:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8031a0:	df 6d e0             	fildll -0x20(%ebp)
+  8031a3:	d9 c1                	fld    %st(1)
+  8031a5:	d8 0d 04 5f 80 00    	fmuls  0x805f04
+  8031ab:	d9 c9                	fxch   %st(1)
+  8031ad:	df f1                	fcomip %st(1),%st
+  8031af:	dd d8                	fstp   %st(0)
+  8031b1:	0f 82 ed fe ff ff    	jb     8030a4 <nfu+0x35>
+  8031b7:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  8031b9:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  8031be:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8031c1:	c1 e0 0c             	shl    $0xc,%eax
+  8031c4:	eb 0e                	jmp    8031d4 <nfu+0x165>
+  8031c6:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8031c8:	89 f8                	mov    %edi,%eax
+  8031ca:	3c ff                	cmp    $0xff,%al
+  8031cc:	74 0e                	je     8031dc <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8031ce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8031d1:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8031d4:	83 c4 14             	add    $0x14,%esp
+  8031d7:	5b                   	pop    %ebx
+  8031d8:	5e                   	pop    %esi
+  8031d9:	5f                   	pop    %edi
+  8031da:	5d                   	pop    %ebp
+  8031db:	c3                   	ret
+	pgnum = 0;
+  8031dc:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  8031e3:	00 00 00 
+	return (void*)UTOP;
+  8031e6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8031eb:	eb e7                	jmp    8031d4 <nfu+0x165>
+
+008031ed <lru>:
+{
+  8031ed:	55                   	push   %ebp
+  8031ee:	89 e5                	mov    %esp,%ebp
+  8031f0:	57                   	push   %edi
+  8031f1:	56                   	push   %esi
+  8031f2:	53                   	push   %ebx
+  8031f3:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8031f6:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  8031fc:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  803203:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80320a:	be 00 00 00 00       	mov    $0x0,%esi
+  80320f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80321b:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  80321e:	eb 18                	jmp    803238 <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803220:	f7 d0                	not    %eax
+  803222:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803227:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803229:	83 c2 01             	add    $0x1,%edx
+  80322c:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803232:	0f 87 fa 00 00 00    	ja     803332 <lru+0x145>
+		++num_searched_ptes;
+  803238:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80323b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80323e:	01 d0                	add    %edx,%eax
+  803240:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803245:	89 c1                	mov    %eax,%ecx
+  803247:	c1 e9 0a             	shr    $0xa,%ecx
+  80324a:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803251:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803257:	83 f9 01             	cmp    $0x1,%ecx
+  80325a:	75 c4                	jne    803220 <lru+0x33>
+  80325c:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803261:	77 bd                	ja     803220 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803263:	89 c1                	mov    %eax,%ecx
+  803265:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803268:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80326e:	0f 87 92 00 00 00    	ja     803306 <lru+0x119>
+  803274:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80327a:	0f 82 86 00 00 00    	jb     803306 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803280:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803287:	f6 c1 01             	test   $0x1,%cl
+  80328a:	74 7a                	je     803306 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80328c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803293:	f6 c5 04             	test   $0x4,%ch
+  803296:	75 6e                	jne    803306 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803298:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80329f:	f6 c5 02             	test   $0x2,%ch
+  8032a2:	75 62                	jne    803306 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8032a4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032ab:	c1 e9 0c             	shr    $0xc,%ecx
+  8032ae:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032b1:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032b7:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8032bb:	66 83 f9 01          	cmp    $0x1,%cx
+  8032bf:	77 45                	ja     803306 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  8032c1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032c8:	c1 e9 0c             	shr    $0xc,%ecx
+  8032cb:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032ce:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032d4:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8032d7:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8032da:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8032dd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8032e0:	19 df                	sbb    %ebx,%edi
+  8032e2:	7c 22                	jl     803306 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8032e4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032eb:	c1 e9 0c             	shr    $0xc,%ecx
+  8032ee:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8032f1:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8032f7:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8032fa:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8032fd:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  803300:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803303:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803306:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  803309:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803310:	df 6d e0             	fildll -0x20(%ebp)
+  803313:	d9 05 04 5f 80 00    	flds   0x805f04
+  803319:	d9 c9                	fxch   %st(1)
+  80331b:	df f1                	fcomip %st(1),%st
+  80331d:	dd d8                	fstp   %st(0)
+  80331f:	0f 82 04 ff ff ff    	jb     803229 <lru+0x3c>
+			pgnum = pgnum_actual;
+  803325:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  80332a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  80332d:	c1 e0 0c             	shl    $0xc,%eax
+  803330:	eb 06                	jmp    803338 <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  803332:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803335:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803338:	83 c4 1c             	add    $0x1c,%esp
+  80333b:	5b                   	pop    %ebx
+  80333c:	5e                   	pop    %esi
+  80333d:	5f                   	pop    %edi
+  80333e:	5d                   	pop    %ebp
+  80333f:	c3                   	ret
+
+00803340 <set_page_choice_func>:
+{
+  803340:	55                   	push   %ebp
+  803341:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  803343:	8b 45 08             	mov    0x8(%ebp),%eax
+  803346:	a3 3c 70 80 00       	mov    %eax,0x80703c
+}
+  80334b:	5d                   	pop    %ebp
+  80334c:	c3                   	ret
+
+0080334d <get_page_choice>:
+{
+  80334d:	55                   	push   %ebp
+  80334e:	89 e5                	mov    %esp,%ebp
+  803350:	57                   	push   %edi
+  803351:	56                   	push   %esi
+  803352:	53                   	push   %ebx
+  803353:	83 ec 24             	sub    $0x24,%esp
+  803356:	8b 75 08             	mov    0x8(%ebp),%esi
+  803359:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  80335c:	57                   	push   %edi
+  80335d:	56                   	push   %esi
+  80335e:	ff 15 3c 70 80 00    	call   *0x80703c
+  803364:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803366:	83 c4 10             	add    $0x10,%esp
+  803369:	eb 25                	jmp    803390 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  80336b:	83 ec 08             	sub    $0x8,%esp
+  80336e:	c1 e0 16             	shl    $0x16,%eax
+  803371:	50                   	push   %eax
+  803372:	6a 00                	push   $0x0
+  803374:	e8 38 db ff ff       	call   800eb1 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803379:	83 c4 10             	add    $0x10,%esp
+  80337c:	85 c0                	test   %eax,%eax
+  80337e:	75 43                	jne    8033c3 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  803380:	83 ec 08             	sub    $0x8,%esp
+  803383:	57                   	push   %edi
+  803384:	56                   	push   %esi
+  803385:	ff 15 3c 70 80 00    	call   *0x80703c
+  80338b:	89 c3                	mov    %eax,%ebx
+  80338d:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803390:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803393:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803399:	0f 86 ae 00 00 00    	jbe    80344d <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  80339f:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  8033a4:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8033ab:	81 e2 81 00 00 00    	and    $0x81,%edx
+  8033b1:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  8033b7:	74 b2                	je     80336b <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  8033b9:	83 c0 01             	add    $0x1,%eax
+  8033bc:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  8033c1:	75 e1                	jne    8033a4 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  8033c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033c6:	05 00 10 40 11       	add    $0x11401000,%eax
+  8033cb:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8033d0:	76 1f                	jbe    8033f1 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  8033d2:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  8033d7:	89 d8                	mov    %ebx,%eax
+  8033d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033dc:	5b                   	pop    %ebx
+  8033dd:	5e                   	pop    %esi
+  8033de:	5f                   	pop    %edi
+  8033df:	5d                   	pop    %ebp
+  8033e0:	c3                   	ret
+		sys_page_split(0, pg_out);
+  8033e1:	83 ec 08             	sub    $0x8,%esp
+  8033e4:	53                   	push   %ebx
+  8033e5:	6a 00                	push   $0x0
+  8033e7:	e8 c5 da ff ff       	call   800eb1 <sys_page_split>
+  8033ec:	83 c4 10             	add    $0x10,%esp
+  8033ef:	eb 6c                	jmp    80345d <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  8033f1:	83 ec 04             	sub    $0x4,%esp
+  8033f4:	68 ac 5a 80 00       	push   $0x805aac
+  8033f9:	68 cc 01 00 00       	push   $0x1cc
+  8033fe:	68 1a 5a 80 00       	push   $0x805a1a
+  803403:	e8 2d ce ff ff       	call   800235 <_panic>
+		panic("We tried to page out code pages\n");
+  803408:	83 ec 04             	sub    $0x4,%esp
+  80340b:	68 dc 5a 80 00       	push   $0x805adc
+  803410:	68 d6 01 00 00       	push   $0x1d6
+  803415:	68 1a 5a 80 00       	push   $0x805a1a
+  80341a:	e8 16 ce ff ff       	call   800235 <_panic>
+		panic("Invalid mapping for the va\n");
+  80341f:	83 ec 04             	sub    $0x4,%esp
+  803422:	68 27 5a 80 00       	push   $0x805a27
+  803427:	68 da 01 00 00       	push   $0x1da
+  80342c:	68 1a 5a 80 00       	push   $0x805a1a
+  803431:	e8 ff cd ff ff       	call   800235 <_panic>
+		panic("We tried to page out a shared page\n");
+  803436:	83 ec 04             	sub    $0x4,%esp
+  803439:	68 00 5b 80 00       	push   $0x805b00
+  80343e:	68 e0 01 00 00       	push   $0x1e0
+  803443:	68 1a 5a 80 00       	push   $0x805a1a
+  803448:	e8 e8 cd ff ff       	call   800235 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  80344d:	89 de                	mov    %ebx,%esi
+  80344f:	c1 ee 16             	shr    $0x16,%esi
+  803452:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803459:	a8 80                	test   $0x80,%al
+  80345b:	75 84                	jne    8033e1 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  80345d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803460:	05 00 10 40 11       	add    $0x11401000,%eax
+  803465:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80346a:	76 85                	jbe    8033f1 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  80346c:	89 d8                	mov    %ebx,%eax
+  80346e:	e8 7e f3 ff ff       	call   8027f1 <page_is_clean>
+  803473:	84 c0                	test   %al,%al
+  803475:	0f 85 5c ff ff ff    	jne    8033d7 <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  80347b:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  803482:	76 84                	jbe    803408 <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803484:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  80348b:	a8 01                	test   $0x1,%al
+  80348d:	74 90                	je     80341f <get_page_choice+0xd2>
+  80348f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803492:	c1 e8 0c             	shr    $0xc,%eax
+  803495:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80349c:	f6 c2 01             	test   $0x1,%dl
+  80349f:	0f 84 7a ff ff ff    	je     80341f <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8034a5:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  8034ac:	f6 c2 01             	test   $0x1,%dl
+  8034af:	74 85                	je     803436 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8034b1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  8034b8:	f6 c2 01             	test   $0x1,%dl
+  8034bb:	0f 84 75 ff ff ff    	je     803436 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8034c1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  8034c8:	f6 c6 04             	test   $0x4,%dh
+  8034cb:	0f 85 65 ff ff ff    	jne    803436 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  8034d1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  8034d8:	f6 c6 02             	test   $0x2,%dh
+  8034db:	0f 85 55 ff ff ff    	jne    803436 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  8034e1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8034e8:	c1 e8 0c             	shr    $0xc,%eax
+  8034eb:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8034ee:	05 00 00 00 ef       	add    $0xef000000,%eax
+  8034f3:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  8034f7:	66 83 f8 01          	cmp    $0x1,%ax
+  8034fb:	0f 86 d6 fe ff ff    	jbe    8033d7 <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  803501:	83 ec 04             	sub    $0x4,%esp
+  803504:	68 24 5b 80 00       	push   $0x805b24
+  803509:	68 e2 01 00 00       	push   $0x1e2
+  80350e:	68 1a 5a 80 00       	push   $0x805a1a
+  803513:	e8 1d cd ff ff       	call   800235 <_panic>
+
+00803518 <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  803518:	55                   	push   %ebp
+  803519:	89 e5                	mov    %esp,%ebp
+  80351b:	57                   	push   %edi
+  80351c:	56                   	push   %esi
+  80351d:	53                   	push   %ebx
+  80351e:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  803521:	e8 e8 f6 ff ff       	call   802c0e <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803526:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  80352b:	85 c0                	test   %eax,%eax
+  80352d:	74 41                	je     803570 <page_share_paged_out+0x58>
+  80352f:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803536:	0f 84 fd 00 00 00    	je     803639 <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  80353c:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803543:	00 00 00 
+  803546:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  80354d:	00 00 00 
+  803550:	bf 00 00 00 00       	mov    $0x0,%edi
+  803555:	eb 2c                	jmp    803583 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803557:	83 c3 04             	add    $0x4,%ebx
+  80355a:	39 f3                	cmp    %esi,%ebx
+  80355c:	74 1a                	je     803578 <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  80355e:	8b 03                	mov    (%ebx),%eax
+  803560:	a8 01                	test   $0x1,%al
+  803562:	74 f3                	je     803557 <page_share_paged_out+0x3f>
+  803564:	c1 e8 0c             	shr    $0xc,%eax
+  803567:	e8 2b f5 ff ff       	call   802a97 <page_share_slot>
+  80356c:	85 c0                	test   %eax,%eax
+  80356e:	79 e7                	jns    803557 <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  803570:	83 c4 0c             	add    $0xc,%esp
+  803573:	5b                   	pop    %ebx
+  803574:	5e                   	pop    %esi
+  803575:	5f                   	pop    %edi
+  803576:	5d                   	pop    %ebp
+  803577:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803578:	83 c7 04             	add    $0x4,%edi
+  80357b:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  803581:	74 1b                	je     80359e <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803583:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  803588:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  80358b:	f6 c3 01             	test   $0x1,%bl
+  80358e:	74 e8                	je     803578 <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  803590:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803596:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  80359c:	eb bc                	jmp    80355a <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  80359e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8035a3:	eb 11                	jmp    8035b6 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  8035a5:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  8035ab:	83 c3 01             	add    $0x1,%ebx
+  8035ae:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8035b4:	77 41                	ja     8035f7 <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  8035b6:	89 d8                	mov    %ebx,%eax
+  8035b8:	c1 e8 0a             	shr    $0xa,%eax
+  8035bb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035c2:	25 81 00 00 00       	and    $0x81,%eax
+  8035c7:	83 f8 01             	cmp    $0x1,%eax
+  8035ca:	75 d9                	jne    8035a5 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8035cc:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8035d3:	25 81 00 00 00       	and    $0x81,%eax
+  8035d8:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8035dd:	75 cc                	jne    8035ab <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  8035df:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8035e6:	c1 e8 0c             	shr    $0xc,%eax
+  8035e9:	e8 a9 f4 ff ff       	call   802a97 <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  8035ee:	85 c0                	test   %eax,%eax
+  8035f0:	79 b9                	jns    8035ab <page_share_paged_out+0x93>
+  8035f2:	e9 79 ff ff ff       	jmp    803570 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  8035f7:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8035fe:	75 13                	jne    803613 <page_share_paged_out+0xfb>
+  803600:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  803607:	75 1d                	jne    803626 <page_share_paged_out+0x10e>
+	return 0;
+  803609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80360e:	e9 5d ff ff ff       	jmp    803570 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803613:	b8 00 00 00 00       	mov    $0x0,%eax
+  803618:	e8 46 f4 ff ff       	call   802a63 <page_share_send>
+  80361d:	85 c0                	test   %eax,%eax
+  80361f:	79 df                	jns    803600 <page_share_paged_out+0xe8>
+  803621:	e9 4a ff ff ff       	jmp    803570 <page_share_paged_out+0x58>
+  803626:	b8 01 00 00 00       	mov    $0x1,%eax
+  80362b:	e8 33 f4 ff ff       	call   802a63 <page_share_send>
+  803630:	85 c0                	test   %eax,%eax
+  803632:	79 d5                	jns    803609 <page_share_paged_out+0xf1>
+  803634:	e9 37 ff ff ff       	jmp    803570 <page_share_paged_out+0x58>
+		return 0;
+  803639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363e:	e9 2d ff ff ff       	jmp    803570 <page_share_paged_out+0x58>
+
+00803643 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803643:	55                   	push   %ebp
+  803644:	89 e5                	mov    %esp,%ebp
+  803646:	56                   	push   %esi
+  803647:	53                   	push   %ebx
+  803648:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  80364b:	e8 be f5 ff ff       	call   802c0e <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803650:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803655:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80365c:	0f 84 82 00 00 00    	je     8036e4 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803662:	83 ec 0c             	sub    $0xc,%esp
+  803665:	68 00 10 00 00       	push   $0x1000
+  80366a:	e8 84 11 00 00       	call   8047f3 <malloc>
+  80366f:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803671:	83 c4 0c             	add    $0xc,%esp
+  803674:	6a 14                	push   $0x14
+  803676:	6a 00                	push   $0x0
+  803678:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80367b:	50                   	push   %eax
+  80367c:	e8 c7 d3 ff ff       	call   800a48 <memset>
+  803681:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803684:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803689:	83 ec 0c             	sub    $0xc,%esp
+  80368c:	6a 07                	push   $0x7
+  80368e:	6a 01                	push   $0x1
+  803690:	53                   	push   %ebx
+  803691:	6a 03                	push   $0x3
+  803693:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  80369a:	e8 b7 19 00 00       	call   805056 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  80369f:	8b 03                	mov    (%ebx),%eax
+  8036a1:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8036a4:	8b 43 04             	mov    0x4(%ebx),%eax
+  8036a7:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8036aa:	8b 43 08             	mov    0x8(%ebx),%eax
+  8036ad:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8036b0:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8036b3:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8036b6:	8b 43 10             	mov    0x10(%ebx),%eax
+  8036b9:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8036bc:	83 c6 01             	add    $0x1,%esi
+  8036bf:	83 c4 20             	add    $0x20,%esp
+  8036c2:	83 fe 02             	cmp    $0x2,%esi
+  8036c5:	75 c2                	jne    803689 <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8036c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036ca:	89 03                	mov    %eax,(%ebx)
+  8036cc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8036cf:	89 43 04             	mov    %eax,0x4(%ebx)
+  8036d2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8036d5:	89 43 08             	mov    %eax,0x8(%ebx)
+  8036d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8036db:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8036de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036e1:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8036e4:	89 d8                	mov    %ebx,%eax
+  8036e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036e9:	5b                   	pop    %ebx
+  8036ea:	5e                   	pop    %esi
+  8036eb:	5d                   	pop    %ebp
+  8036ec:	c3                   	ret
+
+008036ed <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8036ed:	55                   	push   %ebp
+  8036ee:	89 e5                	mov    %esp,%ebp
+  8036f0:	53                   	push   %ebx
+  8036f1:	83 ec 10             	sub    $0x10,%esp
+  8036f4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8036f7:	68 41 5a 80 00       	push   $0x805a41
+  8036fc:	e8 0f cc ff ff       	call   800310 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803701:	83 c4 08             	add    $0x8,%esp
+  803704:	ff 33                	push   (%ebx)
+  803706:	68 58 5b 80 00       	push   $0x805b58
+  80370b:	e8 00 cc ff ff       	call   800310 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803710:	83 c4 08             	add    $0x8,%esp
+  803713:	ff 73 04             	push   0x4(%ebx)
+  803716:	68 43 5a 80 00       	push   $0x805a43
+  80371b:	e8 f0 cb ff ff       	call   800310 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803720:	83 c4 08             	add    $0x8,%esp
+  803723:	ff 73 08             	push   0x8(%ebx)
+  803726:	68 78 5b 80 00       	push   $0x805b78
+  80372b:	e8 e0 cb ff ff       	call   800310 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803730:	83 c4 08             	add    $0x8,%esp
+  803733:	ff 73 0c             	push   0xc(%ebx)
+  803736:	68 9c 5b 80 00       	push   $0x805b9c
+  80373b:	e8 d0 cb ff ff       	call   800310 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803740:	83 c4 08             	add    $0x8,%esp
+  803743:	ff 73 10             	push   0x10(%ebx)
+  803746:	68 c0 5b 80 00       	push   $0x805bc0
+  80374b:	e8 c0 cb ff ff       	call   800310 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803750:	83 c4 08             	add    $0x8,%esp
+  803753:	ff 35 08 c0 80 00    	push   0x80c008
+  803759:	68 fc 5b 80 00       	push   $0x805bfc
+  80375e:	e8 ad cb ff ff       	call   800310 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803763:	83 c4 08             	add    $0x8,%esp
+  803766:	ff 35 04 c0 80 00    	push   0x80c004
+  80376c:	68 30 5c 80 00       	push   $0x805c30
+  803771:	e8 9a cb ff ff       	call   800310 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803776:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80377b:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  80377e:	8b 50 68             	mov    0x68(%eax),%edx
+  803781:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803784:	51                   	push   %ecx
+  803785:	52                   	push   %edx
+  803786:	50                   	push   %eax
+  803787:	68 70 5c 80 00       	push   $0x805c70
+  80378c:	e8 7f cb ff ff       	call   800310 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803791:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803796:	8b 40 70             	mov    0x70(%eax),%eax
+  803799:	83 c4 18             	add    $0x18,%esp
+  80379c:	50                   	push   %eax
+  80379d:	68 a4 5c 80 00       	push   $0x805ca4
+  8037a2:	e8 69 cb ff ff       	call   800310 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8037a7:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8037ad:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8037b3:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8037b8:	51                   	push   %ecx
+  8037b9:	52                   	push   %edx
+  8037ba:	50                   	push   %eax
+  8037bb:	68 d4 5c 80 00       	push   $0x805cd4
+  8037c0:	e8 4b cb ff ff       	call   800310 <cprintf>
+	cprintf("\n");
+  8037c5:	83 c4 14             	add    $0x14,%esp
+  8037c8:	68 41 5a 80 00       	push   $0x805a41
+  8037cd:	e8 3e cb ff ff       	call   800310 <cprintf>
+}
+  8037d2:	83 c4 10             	add    $0x10,%esp
+  8037d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037d8:	c9                   	leave
+  8037d9:	c3                   	ret
+
+008037da <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8037da:	55                   	push   %ebp
+  8037db:	89 e5                	mov    %esp,%ebp
+  8037dd:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8037e0:	e8 5e fe ff ff       	call   803643 <get_paging_stats>
+  8037e5:	83 ec 0c             	sub    $0xc,%esp
+  8037e8:	50                   	push   %eax
+  8037e9:	e8 ff fe ff ff       	call   8036ed <print_paging_stats>
+}
+  8037ee:	83 c4 10             	add    $0x10,%esp
+  8037f1:	c9                   	leave
+  8037f2:	c3                   	ret
+
+008037f3 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  8037f3:	55                   	push   %ebp
+  8037f4:	89 e5                	mov    %esp,%ebp
+  8037f6:	53                   	push   %ebx
+  8037f7:	83 ec 04             	sub    $0x4,%esp
+  8037fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8037fd:	eb 13                	jmp    803812 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8037ff:	83 ec 04             	sub    $0x4,%esp
+  803802:	6a ff                	push   $0xffffffff
+  803804:	53                   	push   %ebx
+  803805:	68 00 f0 ff ee       	push   $0xeefff000
+  80380a:	e8 b4 da ff ff       	call   8012c3 <sys_futex_wait>
+  80380f:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803812:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803817:	39 d8                	cmp    %ebx,%eax
+  803819:	74 e4                	je     8037ff <mem_pressure_wait+0xc>
+	return now;
+}
+  80381b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80381e:	c9                   	leave
+  80381f:	c3                   	ret
+
+00803820 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803820:	55                   	push   %ebp
+  803821:	89 e5                	mov    %esp,%ebp
+  803823:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803826:	68 92 44 80 00       	push   $0x804492
+  80382b:	e8 32 16 00 00       	call   804e62 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803830:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  803837:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80383a:	83 c4 0c             	add    $0xc,%esp
+  80383d:	68 07 02 00 00       	push   $0x207
+  803842:	68 00 b0 ad de       	push   $0xdeadb000
+  803847:	6a 00                	push   $0x0
+  803849:	e8 9c d5 ff ff       	call   800dea <sys_page_alloc>
+  80384e:	83 c4 10             	add    $0x10,%esp
+  803851:	85 c0                	test   %eax,%eax
+  803853:	78 0c                	js     803861 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803855:	e8 b4 f3 ff ff       	call   802c0e <find_paging_env>
+	page_ring_ready();
+  80385a:	e8 7f f2 ff ff       	call   802ade <page_ring_ready>
+}
+  80385f:	c9                   	leave
+  803860:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803861:	50                   	push   %eax
+  803862:	68 61 5a 80 00       	push   $0x805a61
+  803867:	68 13 05 00 00       	push   $0x513
+  80386c:	68 1a 5a 80 00       	push   $0x805a1a
+  803871:	e8 bf c9 ff ff       	call   800235 <_panic>
+
+00803876 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803876:	55                   	push   %ebp
+  803877:	89 e5                	mov    %esp,%ebp
+  803879:	57                   	push   %edi
+  80387a:	56                   	push   %esi
+  80387b:	53                   	push   %ebx
+  80387c:	83 ec 0c             	sub    $0xc,%esp
+  80387f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803882:	89 fa                	mov    %edi,%edx
+  803884:	c1 ea 16             	shr    $0x16,%edx
+  803887:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  80388c:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  80388f:	f6 06 01             	testb  $0x1,(%esi)
+  803892:	75 3e                	jne    8038d2 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803894:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803899:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80389d:	74 47                	je     8038e6 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  80389f:	83 ec 0c             	sub    $0xc,%esp
+  8038a2:	6a 01                	push   $0x1
+  8038a4:	e8 f2 11 00 00       	call   804a9b <va_alloc>
+  8038a9:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8038ab:	83 c4 10             	add    $0x10,%esp
+  8038ae:	85 c0                	test   %eax,%eax
+  8038b0:	74 34                	je     8038e6 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8038b2:	6a 00                	push   $0x0
+  8038b4:	68 07 02 00 00       	push   $0x207
+  8038b9:	50                   	push   %eax
+  8038ba:	6a 00                	push   $0x0
+  8038bc:	e8 df 02 00 00       	call   803ba0 <page_alloc>
+  8038c1:	83 c4 10             	add    $0x10,%esp
+  8038c4:	85 c0                	test   %eax,%eax
+  8038c6:	78 28                	js     8038f0 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8038c8:	f6 06 01             	testb  $0x1,(%esi)
+  8038cb:	75 38                	jne    803905 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8038cd:	83 cb 01             	or     $0x1,%ebx
+  8038d0:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8038d2:	89 f8                	mov    %edi,%eax
+  8038d4:	c1 e8 0a             	shr    $0xa,%eax
+  8038d7:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8038dc:	8b 1e                	mov    (%esi),%ebx
+  8038de:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8038e4:	01 c3                	add    %eax,%ebx
+}
+  8038e6:	89 d8                	mov    %ebx,%eax
+  8038e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038eb:	5b                   	pop    %ebx
+  8038ec:	5e                   	pop    %esi
+  8038ed:	5f                   	pop    %edi
+  8038ee:	5d                   	pop    %ebp
+  8038ef:	c3                   	ret
+			va_free(page, 1);
+  8038f0:	83 ec 08             	sub    $0x8,%esp
+  8038f3:	6a 01                	push   $0x1
+  8038f5:	53                   	push   %ebx
+  8038f6:	e8 d8 12 00 00       	call   804bd3 <va_free>
+			return NULL;
+  8038fb:	83 c4 10             	add    $0x10,%esp
+  8038fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803903:	eb e1                	jmp    8038e6 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  803905:	83 ec 08             	sub    $0x8,%esp
+  803908:	53                   	push   %ebx
+  803909:	6a 00                	push   $0x0
+  80390b:	e8 5f d5 ff ff       	call   800e6f <sys_page_unmap>
+			va_free(page, 1);
+  803910:	83 c4 08             	add    $0x8,%esp
+  803913:	6a 01                	push   $0x1
+  803915:	53                   	push   %ebx
+  803916:	e8 b8 12 00 00       	call   804bd3 <va_free>
+  80391b:	83 c4 10             	add    $0x10,%esp
+  80391e:	eb b2                	jmp    8038d2 <umapdir_walk+0x5c>
+
+00803920 <page_out>:
+{
+  803920:	55                   	push   %ebp
+  803921:	89 e5                	mov    %esp,%ebp
+  803923:	57                   	push   %edi
+  803924:	56                   	push   %esi
+  803925:	53                   	push   %ebx
+  803926:	83 ec 5c             	sub    $0x5c,%esp
+  803929:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  80392c:	e8 dd f2 ff ff       	call   802c0e <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803931:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803936:	85 c0                	test   %eax,%eax
+  803938:	74 1e                	je     803958 <page_out+0x38>
+  80393a:	83 ec 0c             	sub    $0xc,%esp
+  80393d:	6a 00                	push   $0x0
+  80393f:	6a 00                	push   $0x0
+  803941:	6a 00                	push   $0x0
+  803943:	6a 08                	push   $0x8
+  803945:	50                   	push   %eax
+  803946:	e8 0b 17 00 00       	call   805056 <ipc_call>
+  80394b:	89 c3                	mov    %eax,%ebx
+  80394d:	83 c4 20             	add    $0x20,%esp
+  803950:	85 c0                	test   %eax,%eax
+  803952:	0f 84 ac 00 00 00    	je     803a04 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  803958:	83 ec 08             	sub    $0x8,%esp
+  80395b:	ff 75 0c             	push   0xc(%ebp)
+  80395e:	57                   	push   %edi
+  80395f:	e8 e9 f9 ff ff       	call   80334d <get_page_choice>
+  803964:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  803966:	83 c4 10             	add    $0x10,%esp
+  803969:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  80396e:	0f 84 18 02 00 00    	je     803b8c <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803974:	e8 78 ee ff ff       	call   8027f1 <page_is_clean>
+  803979:	84 c0                	test   %al,%al
+  80397b:	0f 85 8c 00 00 00    	jne    803a0d <page_out+0xed>
+	if (pagingenv == 0)
+  803981:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803988:	0f 84 08 02 00 00    	je     803b96 <page_out+0x276>
+	if (page_ring_ready())
+  80398e:	e8 4b f1 ff ff       	call   802ade <page_ring_ready>
+  803993:	89 c3                	mov    %eax,%ebx
+  803995:	85 c0                	test   %eax,%eax
+  803997:	0f 85 89 00 00 00    	jne    803a26 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  80399d:	83 ec 0c             	sub    $0xc,%esp
+  8039a0:	6a 05                	push   $0x5
+  8039a2:	6a 01                	push   $0x1
+  8039a4:	56                   	push   %esi
+  8039a5:	6a 01                	push   $0x1
+  8039a7:	ff 35 40 c0 80 00    	push   0x80c040
+  8039ad:	e8 a4 16 00 00       	call   805056 <ipc_call>
+  8039b2:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8039b4:	83 c4 20             	add    $0x20,%esp
+  8039b7:	85 c0                	test   %eax,%eax
+  8039b9:	0f 88 b8 01 00 00    	js     803b77 <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8039bf:	89 f0                	mov    %esi,%eax
+  8039c1:	c1 e8 0c             	shr    $0xc,%eax
+  8039c4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8039cb:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8039ce:	83 ec 08             	sub    $0x8,%esp
+  8039d1:	56                   	push   %esi
+  8039d2:	6a 00                	push   $0x0
+  8039d4:	e8 96 d4 ff ff       	call   800e6f <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8039d9:	83 c4 08             	add    $0x8,%esp
+  8039dc:	6a 01                	push   $0x1
+  8039de:	56                   	push   %esi
+  8039df:	e8 92 fe ff ff       	call   803876 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8039e4:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8039e7:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  8039ed:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  8039f0:	09 fe                	or     %edi,%esi
+  8039f2:	83 ce 01             	or     $0x1,%esi
+  8039f5:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8039f7:	83 c4 10             	add    $0x10,%esp
+}
+  8039fa:	89 d8                	mov    %ebx,%eax
+  8039fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039ff:	5b                   	pop    %ebx
+  803a00:	5e                   	pop    %esi
+  803a01:	5f                   	pop    %edi
+  803a02:	5d                   	pop    %ebp
+  803a03:	c3                   	ret
+		num_page_reclaims++;
+  803a04:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  803a0b:	eb ed                	jmp    8039fa <page_out+0xda>
+		num_page_drops++;
+  803a0d:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  803a14:	83 ec 08             	sub    $0x8,%esp
+  803a17:	56                   	push   %esi
+  803a18:	6a 00                	push   $0x0
+  803a1a:	e8 50 d4 ff ff       	call   800e6f <sys_page_unmap>
+  803a1f:	89 c3                	mov    %eax,%ebx
+  803a21:	83 c4 10             	add    $0x10,%esp
+  803a24:	eb d4                	jmp    8039fa <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  803a26:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  803a28:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803a2d:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803a32:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  803a35:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  803a37:	83 c0 08             	add    $0x8,%eax
+  803a3a:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803a3d:	b8 07 00 00 00       	mov    $0x7,%eax
+  803a42:	e8 e5 ef ff ff       	call   802a2c <page_ring_reserve>
+	first = ring->sq_tail;
+  803a47:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803a4c:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803a4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803a54:	83 ec 04             	sub    $0x4,%esp
+  803a57:	68 00 10 00 00       	push   $0x1000
+  803a5c:	56                   	push   %esi
+  803a5d:	89 d8                	mov    %ebx,%eax
+  803a5f:	c1 e0 0c             	shl    $0xc,%eax
+  803a62:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  803a67:	50                   	push   %eax
+  803a68:	e8 72 d0 ff ff       	call   800adf <memcpy>
+		vas[n] = va;
+  803a6d:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803a71:	89 d9                	mov    %ebx,%ecx
+  803a73:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a78:	b8 01 00 00 00       	mov    $0x1,%eax
+  803a7d:	e8 de ee ff ff       	call   802960 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803a82:	8d 43 01             	lea    0x1(%ebx),%eax
+  803a85:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  803a88:	83 c4 10             	add    $0x10,%esp
+  803a8b:	83 fb 06             	cmp    $0x6,%ebx
+  803a8e:	74 62                	je     803af2 <page_out+0x1d2>
+  803a90:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803a93:	eb 15                	jmp    803aaa <page_out+0x18a>
+			num_page_drops++;
+  803a95:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  803a9c:	83 ec 08             	sub    $0x8,%esp
+  803a9f:	56                   	push   %esi
+  803aa0:	6a 00                	push   $0x0
+  803aa2:	e8 c8 d3 ff ff       	call   800e6f <sys_page_unmap>
+  803aa7:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  803aaa:	83 ec 08             	sub    $0x8,%esp
+  803aad:	53                   	push   %ebx
+  803aae:	57                   	push   %edi
+  803aaf:	e8 99 f8 ff ff       	call   80334d <get_page_choice>
+  803ab4:	89 c6                	mov    %eax,%esi
+  803ab6:	83 c4 10             	add    $0x10,%esp
+  803ab9:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803abe:	74 32                	je     803af2 <page_out+0x1d2>
+  803ac0:	e8 2c ed ff ff       	call   8027f1 <page_is_clean>
+  803ac5:	84 c0                	test   %al,%al
+  803ac7:	75 cc                	jne    803a95 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  803ac9:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803acc:	39 c6                	cmp    %eax,%esi
+  803ace:	72 07                	jb     803ad7 <page_out+0x1b7>
+  803ad0:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803ad3:	39 c6                	cmp    %eax,%esi
+  803ad5:	72 1b                	jb     803af2 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  803ad7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803adc:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  803adf:	eb 03                	jmp    803ae4 <page_out+0x1c4>
+  803ae1:	83 c3 01             	add    $0x1,%ebx
+  803ae4:	39 da                	cmp    %ebx,%edx
+  803ae6:	0f 84 68 ff ff ff    	je     803a54 <page_out+0x134>
+  803aec:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803af0:	75 ef                	jne    803ae1 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803af2:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  803af5:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  803af8:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803afb:	e8 a6 ee ff ff       	call   8029a6 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803b00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b05:	eb 42                	jmp    803b49 <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803b07:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803b0b:	89 f8                	mov    %edi,%eax
+  803b0d:	c1 e8 0c             	shr    $0xc,%eax
+  803b10:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b17:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  803b1a:	83 ec 08             	sub    $0x8,%esp
+  803b1d:	57                   	push   %edi
+  803b1e:	6a 00                	push   $0x0
+  803b20:	e8 4a d3 ff ff       	call   800e6f <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  803b25:	83 c4 08             	add    $0x8,%esp
+  803b28:	6a 01                	push   $0x1
+  803b2a:	57                   	push   %edi
+  803b2b:	e8 46 fd ff ff       	call   803876 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803b30:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803b33:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  803b39:	c1 e6 0c             	shl    $0xc,%esi
+  803b3c:	09 d6                	or     %edx,%esi
+  803b3e:	83 ce 01             	or     $0x1,%esi
+  803b41:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803b43:	83 c3 01             	add    $0x1,%ebx
+  803b46:	83 c4 10             	add    $0x10,%esp
+  803b49:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803b4c:	39 c3                	cmp    %eax,%ebx
+  803b4e:	74 1d                	je     803b6d <page_out+0x24d>
+		if (res[i] < 0)
+  803b50:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803b54:	85 f6                	test   %esi,%esi
+  803b56:	79 af                	jns    803b07 <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  803b58:	56                   	push   %esi
+  803b59:	68 04 5d 80 00       	push   $0x805d04
+  803b5e:	68 d1 02 00 00       	push   $0x2d1
+  803b63:	68 1a 5a 80 00       	push   $0x805a1a
+  803b68:	e8 c8 c6 ff ff       	call   800235 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803b6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b72:	e9 83 fe ff ff       	jmp    8039fa <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  803b77:	50                   	push   %eax
+  803b78:	68 04 5d 80 00       	push   $0x805d04
+  803b7d:	68 0a 03 00 00       	push   $0x30a
+  803b82:	68 1a 5a 80 00       	push   $0x805a1a
+  803b87:	e8 a9 c6 ff ff       	call   800235 <_panic>
+		return -E_NO_MEM;
+  803b8c:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  803b91:	e9 64 fe ff ff       	jmp    8039fa <page_out+0xda>
+		return -E_PAGING;
+  803b96:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803b9b:	e9 5a fe ff ff       	jmp    8039fa <page_out+0xda>
+
+00803ba0 <page_alloc>:
+{
+  803ba0:	55                   	push   %ebp
+  803ba1:	89 e5                	mov    %esp,%ebp
+  803ba3:	57                   	push   %edi
+  803ba4:	56                   	push   %esi
+  803ba5:	53                   	push   %ebx
+  803ba6:	83 ec 0c             	sub    $0xc,%esp
+  803ba9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803bac:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  803baf:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803bb6:	74 34                	je     803bec <page_alloc+0x4c>
+	if (check_mte)
+  803bb8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  803bbc:	75 35                	jne    803bf3 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  803bbe:	83 ec 04             	sub    $0x4,%esp
+  803bc1:	ff 75 10             	push   0x10(%ebp)
+  803bc4:	56                   	push   %esi
+  803bc5:	57                   	push   %edi
+  803bc6:	e8 1f d2 ff ff       	call   800dea <sys_page_alloc>
+  803bcb:	89 c3                	mov    %eax,%ebx
+  803bcd:	83 c4 10             	add    $0x10,%esp
+  803bd0:	85 c0                	test   %eax,%eax
+  803bd2:	79 52                	jns    803c26 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  803bd4:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803bd7:	75 52                	jne    803c2b <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  803bd9:	83 ec 08             	sub    $0x8,%esp
+  803bdc:	56                   	push   %esi
+  803bdd:	57                   	push   %edi
+  803bde:	e8 3d fd ff ff       	call   803920 <page_out>
+  803be3:	83 c4 10             	add    $0x10,%esp
+  803be6:	85 c0                	test   %eax,%eax
+  803be8:	79 d4                	jns    803bbe <page_alloc+0x1e>
+  803bea:	eb 3f                	jmp    803c2b <page_alloc+0x8b>
+		init_map_dir();
+  803bec:	e8 2f fc ff ff       	call   803820 <init_map_dir>
+  803bf1:	eb c5                	jmp    803bb8 <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803bf3:	83 ec 08             	sub    $0x8,%esp
+  803bf6:	6a 00                	push   $0x0
+  803bf8:	56                   	push   %esi
+  803bf9:	e8 78 fc ff ff       	call   803876 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803bfe:	83 c4 10             	add    $0x10,%esp
+  803c01:	85 c0                	test   %eax,%eax
+  803c03:	74 b9                	je     803bbe <page_alloc+0x1e>
+  803c05:	8b 10                	mov    (%eax),%edx
+  803c07:	f6 c2 01             	test   $0x1,%dl
+  803c0a:	74 b2                	je     803bbe <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803c0c:	83 ec 08             	sub    $0x8,%esp
+  803c0f:	56                   	push   %esi
+  803c10:	52                   	push   %edx
+  803c11:	50                   	push   %eax
+  803c12:	68 28 5d 80 00       	push   $0x805d28
+  803c17:	68 34 03 00 00       	push   $0x334
+  803c1c:	68 1a 5a 80 00       	push   $0x805a1a
+  803c21:	e8 0f c6 ff ff       	call   800235 <_panic>
+	return 0;
+  803c26:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c2b:	89 d8                	mov    %ebx,%eax
+  803c2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c30:	5b                   	pop    %ebx
+  803c31:	5e                   	pop    %esi
+  803c32:	5f                   	pop    %edi
+  803c33:	5d                   	pop    %ebp
+  803c34:	c3                   	ret
+
+00803c35 <page_adopt>:
+{
+  803c35:	55                   	push   %ebp
+  803c36:	89 e5                	mov    %esp,%ebp
+  803c38:	56                   	push   %esi
+  803c39:	53                   	push   %ebx
+  803c3a:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803c3c:	c1 e8 16             	shr    $0x16,%eax
+  803c3f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803c46:	25 81 00 00 00       	and    $0x81,%eax
+  803c4b:	83 f8 01             	cmp    $0x1,%eax
+  803c4e:	75 53                	jne    803ca3 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803c50:	89 d8                	mov    %ebx,%eax
+  803c52:	c1 e8 0c             	shr    $0xc,%eax
+  803c55:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803c5c:	89 f2                	mov    %esi,%edx
+  803c5e:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803c64:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803c69:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803c6f:	75 37                	jne    803ca8 <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803c71:	83 ec 08             	sub    $0x8,%esp
+  803c74:	6a 01                	push   $0x1
+  803c76:	53                   	push   %ebx
+  803c77:	e8 fa fb ff ff       	call   803876 <umapdir_walk>
+  803c7c:	83 c4 10             	add    $0x10,%esp
+  803c7f:	85 c0                	test   %eax,%eax
+  803c81:	74 2c                	je     803caf <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803c83:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  803c89:	83 ce 01             	or     $0x1,%esi
+  803c8c:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  803c8e:	83 ec 08             	sub    $0x8,%esp
+  803c91:	53                   	push   %ebx
+  803c92:	6a 00                	push   $0x0
+  803c94:	e8 d6 d1 ff ff       	call   800e6f <sys_page_unmap>
+	return 1;
+  803c99:	83 c4 10             	add    $0x10,%esp
+  803c9c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ca1:	eb 05                	jmp    803ca8 <page_adopt+0x73>
+		return 0;
+  803ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ca8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803cab:	5b                   	pop    %ebx
+  803cac:	5e                   	pop    %esi
+  803cad:	5d                   	pop    %ebp
+  803cae:	c3                   	ret
+		return -E_NO_MEM;
+  803caf:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803cb4:	eb f2                	jmp    803ca8 <page_adopt+0x73>
+
+00803cb6 <page_forget>:
+{
+  803cb6:	55                   	push   %ebp
+  803cb7:	89 e5                	mov    %esp,%ebp
+  803cb9:	53                   	push   %ebx
+  803cba:	83 ec 04             	sub    $0x4,%esp
+  803cbd:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  803cbf:	e8 4a ef ff ff       	call   802c0e <find_paging_env>
+	if (pagingenv == 0)
+  803cc4:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803ccb:	74 39                	je     803d06 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803ccd:	89 d8                	mov    %ebx,%eax
+  803ccf:	c1 e8 16             	shr    $0x16,%eax
+  803cd2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803cd9:	25 81 00 00 00       	and    $0x81,%eax
+  803cde:	83 f8 01             	cmp    $0x1,%eax
+  803ce1:	74 28                	je     803d0b <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  803ce3:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803cea:	74 1a                	je     803d06 <page_forget+0x50>
+  803cec:	83 ec 08             	sub    $0x8,%esp
+  803cef:	6a 00                	push   $0x0
+  803cf1:	53                   	push   %ebx
+  803cf2:	e8 7f fb ff ff       	call   803876 <umapdir_walk>
+  803cf7:	89 c3                	mov    %eax,%ebx
+  803cf9:	83 c4 10             	add    $0x10,%esp
+  803cfc:	85 c0                	test   %eax,%eax
+  803cfe:	74 06                	je     803d06 <page_forget+0x50>
+  803d00:	8b 00                	mov    (%eax),%eax
+  803d02:	a8 01                	test   $0x1,%al
+  803d04:	75 2b                	jne    803d31 <page_forget+0x7b>
+}
+  803d06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d09:	c9                   	leave
+  803d0a:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803d0b:	89 d8                	mov    %ebx,%eax
+  803d0d:	c1 e8 0c             	shr    $0xc,%eax
+  803d10:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803d17:	89 c2                	mov    %eax,%edx
+  803d19:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803d1f:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803d25:	75 bc                	jne    803ce3 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  803d27:	c1 e8 0c             	shr    $0xc,%eax
+  803d2a:	e8 5c ee ff ff       	call   802b8b <page_remove_slot>
+		return;
+  803d2f:	eb d5                	jmp    803d06 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803d31:	c1 e8 0c             	shr    $0xc,%eax
+  803d34:	e8 52 ee ff ff       	call   802b8b <page_remove_slot>
+	*mte = 0;
+  803d39:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803d3f:	eb c5                	jmp    803d06 <page_forget+0x50>
+
+00803d41 <page_unmap>:
+{
+  803d41:	55                   	push   %ebp
+  803d42:	89 e5                	mov    %esp,%ebp
+  803d44:	57                   	push   %edi
+  803d45:	56                   	push   %esi
+  803d46:	53                   	push   %ebx
+  803d47:	83 ec 0c             	sub    $0xc,%esp
+  803d4a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803d4d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803d50:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803d55:	8b 40 48             	mov    0x48(%eax),%eax
+  803d58:	85 db                	test   %ebx,%ebx
+  803d5a:	0f 8e b4 00 00 00    	jle    803e14 <page_unmap+0xd3>
+  803d60:	39 d8                	cmp    %ebx,%eax
+  803d62:	0f 84 ac 00 00 00    	je     803e14 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  803d68:	83 ec 08             	sub    $0x8,%esp
+  803d6b:	57                   	push   %edi
+  803d6c:	53                   	push   %ebx
+  803d6d:	e8 fd d0 ff ff       	call   800e6f <sys_page_unmap>
+  803d72:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803d74:	e8 95 ee ff ff       	call   802c0e <find_paging_env>
+	if (pagingenv == 0)
+  803d79:	83 c4 10             	add    $0x10,%esp
+  803d7c:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803d83:	0f 84 a1 00 00 00    	je     803e2a <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d89:	83 ec 0c             	sub    $0xc,%esp
+  803d8c:	6a 05                	push   $0x5
+  803d8e:	68 00 00 40 00       	push   $0x400000
+  803d93:	6a 00                	push   $0x0
+  803d95:	68 00 b0 ad de       	push   $0xdeadb000
+  803d9a:	53                   	push   %ebx
+  803d9b:	e8 8d d0 ff ff       	call   800e2d <sys_page_map>
+  803da0:	83 c4 20             	add    $0x20,%esp
+  803da3:	85 c0                	test   %eax,%eax
+  803da5:	0f 88 89 00 00 00    	js     803e34 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  803dab:	89 f8                	mov    %edi,%eax
+  803dad:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803db0:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  803db7:	a8 01                	test   $0x1,%al
+  803db9:	74 6f                	je     803e2a <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803dbb:	83 ec 0c             	sub    $0xc,%esp
+  803dbe:	6a 05                	push   $0x5
+  803dc0:	68 00 00 40 00       	push   $0x400000
+  803dc5:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803dc7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803dcc:	50                   	push   %eax
+  803dcd:	53                   	push   %ebx
+  803dce:	e8 5a d0 ff ff       	call   800e2d <sys_page_map>
+  803dd3:	83 c4 20             	add    $0x20,%esp
+  803dd6:	85 c0                	test   %eax,%eax
+  803dd8:	78 6f                	js     803e49 <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  803dda:	c1 ef 0c             	shr    $0xc,%edi
+  803ddd:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803de3:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  803dea:	01 
+  803deb:	74 3d                	je     803e2a <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803ded:	83 ec 08             	sub    $0x8,%esp
+  803df0:	68 00 00 40 00       	push   $0x400000
+  803df5:	6a 00                	push   $0x0
+  803df7:	e8 73 d0 ff ff       	call   800e6f <sys_page_unmap>
+  803dfc:	83 c4 10             	add    $0x10,%esp
+  803dff:	85 c0                	test   %eax,%eax
+  803e01:	78 5b                	js     803e5e <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803e03:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  803e0a:	c1 e8 0c             	shr    $0xc,%eax
+  803e0d:	e8 79 ed ff ff       	call   802b8b <page_remove_slot>
+	return r;
+  803e12:	eb 16                	jmp    803e2a <page_unmap+0xe9>
+		page_forget(va);
+  803e14:	89 f8                	mov    %edi,%eax
+  803e16:	e8 9b fe ff ff       	call   803cb6 <page_forget>
+		return sys_page_unmap(envid, va);
+  803e1b:	83 ec 08             	sub    $0x8,%esp
+  803e1e:	57                   	push   %edi
+  803e1f:	53                   	push   %ebx
+  803e20:	e8 4a d0 ff ff       	call   800e6f <sys_page_unmap>
+  803e25:	89 c6                	mov    %eax,%esi
+  803e27:	83 c4 10             	add    $0x10,%esp
+}
+  803e2a:	89 f0                	mov    %esi,%eax
+  803e2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e2f:	5b                   	pop    %ebx
+  803e30:	5e                   	pop    %esi
+  803e31:	5f                   	pop    %edi
+  803e32:	5d                   	pop    %ebp
+  803e33:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803e34:	50                   	push   %eax
+  803e35:	68 64 5d 80 00       	push   $0x805d64
+  803e3a:	68 e4 03 00 00       	push   $0x3e4
+  803e3f:	68 1a 5a 80 00       	push   $0x805a1a
+  803e44:	e8 ec c3 ff ff       	call   800235 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  803e49:	50                   	push   %eax
+  803e4a:	68 90 5d 80 00       	push   $0x805d90
+  803e4f:	68 ea 03 00 00       	push   $0x3ea
+  803e54:	68 1a 5a 80 00       	push   $0x805a1a
+  803e59:	e8 d7 c3 ff ff       	call   800235 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803e5e:	50                   	push   %eax
+  803e5f:	68 bc 5d 80 00       	push   $0x805dbc
+  803e64:	68 ef 03 00 00       	push   $0x3ef
+  803e69:	68 1a 5a 80 00       	push   $0x805a1a
+  803e6e:	e8 c2 c3 ff ff       	call   800235 <_panic>
+
+00803e73 <page_unmap_range>:
+{
+  803e73:	55                   	push   %ebp
+  803e74:	89 e5                	mov    %esp,%ebp
+  803e76:	57                   	push   %edi
+  803e77:	56                   	push   %esi
+  803e78:	53                   	push   %ebx
+  803e79:	83 ec 0c             	sub    $0xc,%esp
+  803e7c:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803e7f:	e8 8a ed ff ff       	call   802c0e <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803e84:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803e89:	8b 40 48             	mov    0x48(%eax),%eax
+  803e8c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803e90:	7e 38                	jle    803eca <page_unmap_range+0x57>
+  803e92:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803e95:	74 33                	je     803eca <page_unmap_range+0x57>
+  803e97:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803e9e:	74 2a                	je     803eca <page_unmap_range+0x57>
+  803ea0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  803ea3:	be 00 00 00 00       	mov    $0x0,%esi
+  803ea8:	39 fe                	cmp    %edi,%esi
+  803eaa:	74 56                	je     803f02 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  803eac:	83 ec 08             	sub    $0x8,%esp
+  803eaf:	53                   	push   %ebx
+  803eb0:	ff 75 08             	push   0x8(%ebp)
+  803eb3:	e8 89 fe ff ff       	call   803d41 <page_unmap>
+  803eb8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803ebe:	83 c4 10             	add    $0x10,%esp
+  803ec1:	85 c0                	test   %eax,%eax
+  803ec3:	78 35                	js     803efa <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  803ec5:	83 c6 01             	add    $0x1,%esi
+  803ec8:	eb de                	jmp    803ea8 <page_unmap_range+0x35>
+  803eca:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  803ecd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ed2:	eb 10                	jmp    803ee4 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  803ed4:	89 f0                	mov    %esi,%eax
+  803ed6:	e8 db fd ff ff       	call   803cb6 <page_forget>
+		for (i = 0; i < npages; i++)
+  803edb:	83 c3 01             	add    $0x1,%ebx
+  803ede:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803ee4:	39 fb                	cmp    %edi,%ebx
+  803ee6:	75 ec                	jne    803ed4 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  803ee8:	83 ec 04             	sub    $0x4,%esp
+  803eeb:	57                   	push   %edi
+  803eec:	ff 75 0c             	push   0xc(%ebp)
+  803eef:	ff 75 08             	push   0x8(%ebp)
+  803ef2:	e8 8c d0 ff ff       	call   800f83 <sys_page_unmap_range>
+  803ef7:	83 c4 10             	add    $0x10,%esp
+}
+  803efa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803efd:	5b                   	pop    %ebx
+  803efe:	5e                   	pop    %esi
+  803eff:	5f                   	pop    %edi
+  803f00:	5d                   	pop    %ebp
+  803f01:	c3                   	ret
+	return 0;
+  803f02:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f07:	eb f1                	jmp    803efa <page_unmap_range+0x87>
+
+00803f09 <page_alloc_range>:
+{
+  803f09:	55                   	push   %ebp
+  803f0a:	89 e5                	mov    %esp,%ebp
+  803f0c:	57                   	push   %edi
+  803f0d:	56                   	push   %esi
+  803f0e:	53                   	push   %ebx
+  803f0f:	83 ec 1c             	sub    $0x1c,%esp
+  803f12:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  803f18:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803f1f:	74 14                	je     803f35 <page_alloc_range+0x2c>
+	if (check_mte)
+  803f21:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  803f25:	74 66                	je     803f8d <page_alloc_range+0x84>
+  803f27:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  803f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2e:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803f31:	89 c7                	mov    %eax,%edi
+  803f33:	eb 10                	jmp    803f45 <page_alloc_range+0x3c>
+		init_map_dir();
+  803f35:	e8 e6 f8 ff ff       	call   803820 <init_map_dir>
+  803f3a:	eb e5                	jmp    803f21 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803f3c:	83 c7 01             	add    $0x1,%edi
+  803f3f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f45:	39 df                	cmp    %ebx,%edi
+  803f47:	74 38                	je     803f81 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  803f49:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803f4c:	83 ec 08             	sub    $0x8,%esp
+  803f4f:	6a 00                	push   $0x0
+  803f51:	56                   	push   %esi
+  803f52:	e8 1f f9 ff ff       	call   803876 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  803f57:	83 c4 10             	add    $0x10,%esp
+  803f5a:	85 c0                	test   %eax,%eax
+  803f5c:	74 de                	je     803f3c <page_alloc_range+0x33>
+  803f5e:	8b 10                	mov    (%eax),%edx
+  803f60:	f6 c2 01             	test   $0x1,%dl
+  803f63:	74 d7                	je     803f3c <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  803f65:	83 ec 08             	sub    $0x8,%esp
+  803f68:	ff 75 e4             	push   -0x1c(%ebp)
+  803f6b:	52                   	push   %edx
+  803f6c:	50                   	push   %eax
+  803f6d:	68 28 5d 80 00       	push   $0x805d28
+  803f72:	68 0b 04 00 00       	push   $0x40b
+  803f77:	68 1a 5a 80 00       	push   $0x805a1a
+  803f7c:	e8 b4 c2 ff ff       	call   800235 <_panic>
+  803f81:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803f84:	eb 07                	jmp    803f8d <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  803f86:	c1 e0 0c             	shl    $0xc,%eax
+  803f89:	01 c7                	add    %eax,%edi
+			npages -= r;
+  803f8b:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  803f8d:	85 db                	test   %ebx,%ebx
+  803f8f:	74 30                	je     803fc1 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  803f91:	ff 75 14             	push   0x14(%ebp)
+  803f94:	53                   	push   %ebx
+  803f95:	57                   	push   %edi
+  803f96:	ff 75 08             	push   0x8(%ebp)
+  803f99:	e8 77 cf ff ff       	call   800f15 <sys_page_alloc_range>
+  803f9e:	89 c6                	mov    %eax,%esi
+  803fa0:	83 c4 10             	add    $0x10,%esp
+  803fa3:	85 c0                	test   %eax,%eax
+  803fa5:	7f df                	jg     803f86 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  803fa7:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  803faa:	75 1a                	jne    803fc6 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  803fac:	83 ec 08             	sub    $0x8,%esp
+  803faf:	57                   	push   %edi
+  803fb0:	ff 75 08             	push   0x8(%ebp)
+  803fb3:	e8 68 f9 ff ff       	call   803920 <page_out>
+  803fb8:	83 c4 10             	add    $0x10,%esp
+  803fbb:	85 c0                	test   %eax,%eax
+  803fbd:	79 ce                	jns    803f8d <page_alloc_range+0x84>
+  803fbf:	eb 05                	jmp    803fc6 <page_alloc_range+0xbd>
+	return 0;
+  803fc1:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803fc6:	89 f0                	mov    %esi,%eax
+  803fc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fcb:	5b                   	pop    %ebx
+  803fcc:	5e                   	pop    %esi
+  803fcd:	5f                   	pop    %edi
+  803fce:	5d                   	pop    %ebp
+  803fcf:	c3                   	ret
+
+00803fd0 <page_in>:
+{
+  803fd0:	55                   	push   %ebp
+  803fd1:	89 e5                	mov    %esp,%ebp
+  803fd3:	57                   	push   %edi
+  803fd4:	56                   	push   %esi
+  803fd5:	53                   	push   %ebx
+  803fd6:	83 ec 3c             	sub    $0x3c,%esp
+  803fd9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  803fdc:	e8 2d ec ff ff       	call   802c0e <find_paging_env>
+	if (pagingenv == 0)
+  803fe1:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803fe8:	0f 84 09 02 00 00    	je     8041f7 <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803fee:	83 ec 08             	sub    $0x8,%esp
+  803ff1:	6a 00                	push   $0x0
+  803ff3:	56                   	push   %esi
+  803ff4:	e8 7d f8 ff ff       	call   803876 <umapdir_walk>
+  803ff9:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803ffb:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  804001:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  804004:	83 c4 10             	add    $0x10,%esp
+  804007:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80400b:	74 0d                	je     80401a <page_in+0x4a>
+  80400d:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804012:	8b 40 48             	mov    0x48(%eax),%eax
+  804015:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804018:	75 06                	jne    804020 <page_in+0x50>
+  80401a:	8b 03                	mov    (%ebx),%eax
+  80401c:	a8 02                	test   $0x2,%al
+  80401e:	75 63                	jne    804083 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  804020:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804022:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804024:	89 f0                	mov    %esi,%eax
+  804026:	25 06 0e 00 00       	and    $0xe06,%eax
+  80402b:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  80402e:	50                   	push   %eax
+  80402f:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804032:	57                   	push   %edi
+  804033:	ff 75 08             	push   0x8(%ebp)
+  804036:	e8 65 fb ff ff       	call   803ba0 <page_alloc>
+  80403b:	83 c4 10             	add    $0x10,%esp
+  80403e:	85 c0                	test   %eax,%eax
+  804040:	78 39                	js     80407b <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  804042:	89 f0                	mov    %esi,%eax
+  804044:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804047:	83 ec 0c             	sub    $0xc,%esp
+  80404a:	6a 07                	push   $0x7
+  80404c:	6a 01                	push   $0x1
+  80404e:	57                   	push   %edi
+  80404f:	c1 e0 04             	shl    $0x4,%eax
+  804052:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804053:	c1 ee 1c             	shr    $0x1c,%esi
+  804056:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804059:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  804060:	e8 f1 0f 00 00       	call   805056 <ipc_call>
+  804065:	83 c4 20             	add    $0x20,%esp
+  804068:	85 c0                	test   %eax,%eax
+  80406a:	0f 88 72 01 00 00    	js     8041e2 <page_in+0x212>
+	*mte = 0;
+  804070:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804076:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80407b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80407e:	5b                   	pop    %ebx
+  80407f:	5e                   	pop    %esi
+  804080:	5f                   	pop    %edi
+  804081:	5d                   	pop    %ebp
+  804082:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804083:	25 06 0e 00 00       	and    $0xe06,%eax
+  804088:	83 c8 01             	or     $0x1,%eax
+  80408b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  80408e:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804091:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804094:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  80409a:	be 01 00 00 00       	mov    $0x1,%esi
+  80409f:	eb 46                	jmp    8040e7 <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  8040a1:	83 ec 08             	sub    $0x8,%esp
+  8040a4:	6a 00                	push   $0x0
+  8040a6:	51                   	push   %ecx
+  8040a7:	e8 ca f7 ff ff       	call   803876 <umapdir_walk>
+  8040ac:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  8040b0:	83 c4 10             	add    $0x10,%esp
+  8040b3:	85 c0                	test   %eax,%eax
+  8040b5:	74 66                	je     80411d <page_in+0x14d>
+  8040b7:	8b 00                	mov    (%eax),%eax
+  8040b9:	a8 01                	test   $0x1,%al
+  8040bb:	74 60                	je     80411d <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  8040bd:	89 c2                	mov    %eax,%edx
+  8040bf:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  8040c5:	83 ca 01             	or     $0x1,%edx
+  8040c8:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  8040cb:	75 50                	jne    80411d <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  8040cd:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8040d3:	c1 e8 1c             	shr    $0x1c,%eax
+  8040d6:	8b 13                	mov    (%ebx),%edx
+  8040d8:	c1 ea 1c             	shr    $0x1c,%edx
+  8040db:	39 d0                	cmp    %edx,%eax
+  8040dd:	75 3e                	jne    80411d <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8040df:	83 c6 01             	add    $0x1,%esi
+  8040e2:	83 fe 08             	cmp    $0x8,%esi
+  8040e5:	74 3f                	je     804126 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  8040e7:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8040e9:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  8040ef:	77 2c                	ja     80411d <page_in+0x14d>
+  8040f1:	89 f8                	mov    %edi,%eax
+  8040f3:	c1 e8 16             	shr    $0x16,%eax
+  8040f6:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  8040fd:	f6 c2 01             	test   $0x1,%dl
+  804100:	74 9f                	je     8040a1 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804102:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804109:	a8 80                	test   $0x80,%al
+  80410b:	75 10                	jne    80411d <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  80410d:	89 f8                	mov    %edi,%eax
+  80410f:	c1 e8 0c             	shr    $0xc,%eax
+  804112:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804119:	a8 01                	test   $0x1,%al
+  80411b:	74 84                	je     8040a1 <page_in+0xd1>
+	if (n == 1)
+  80411d:	83 fe 01             	cmp    $0x1,%esi
+  804120:	0f 84 fa fe ff ff    	je     804020 <page_in+0x50>
+	req.nslots = n;
+  804126:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  80412c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804131:	eb 13                	jmp    804146 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  804133:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  804137:	8b 12                	mov    (%edx),%edx
+  804139:	c1 ea 0c             	shr    $0xc,%edx
+  80413c:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  804143:	83 c0 01             	add    $0x1,%eax
+  804146:	39 c6                	cmp    %eax,%esi
+  804148:	75 e9                	jne    804133 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  80414a:	83 ec 0c             	sub    $0xc,%esp
+  80414d:	6a 00                	push   $0x0
+  80414f:	ff 75 c0             	push   -0x40(%ebp)
+  804152:	56                   	push   %esi
+  804153:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804156:	57                   	push   %edi
+  804157:	6a 00                	push   $0x0
+  804159:	e8 ab fd ff ff       	call   803f09 <page_alloc_range>
+  80415e:	83 c4 20             	add    $0x20,%esp
+  804161:	85 c0                	test   %eax,%eax
+  804163:	78 6e                	js     8041d3 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804165:	83 ec 04             	sub    $0x4,%esp
+  804168:	6a 24                	push   $0x24
+  80416a:	68 00 90 80 00       	push   $0x809000
+  80416f:	57                   	push   %edi
+  804170:	e8 08 c9 ff ff       	call   800a7d <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804175:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80417c:	56                   	push   %esi
+  80417d:	57                   	push   %edi
+  80417e:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804180:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  804187:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80418a:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  804191:	e8 c0 0e 00 00       	call   805056 <ipc_call>
+  804196:	83 c4 20             	add    $0x20,%esp
+  804199:	85 c0                	test   %eax,%eax
+  80419b:	78 08                	js     8041a5 <page_in+0x1d5>
+  80419d:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8041a0:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  8041a3:	eb 20                	jmp    8041c5 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  8041a5:	50                   	push   %eax
+  8041a6:	68 e8 5d 80 00       	push   $0x805de8
+  8041ab:	68 59 02 00 00       	push   $0x259
+  8041b0:	68 1a 5a 80 00       	push   $0x805a1a
+  8041b5:	e8 7b c0 ff ff       	call   800235 <_panic>
+		*mtes[i] = 0;
+  8041ba:	8b 10                	mov    (%eax),%edx
+  8041bc:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  8041c2:	83 c0 04             	add    $0x4,%eax
+  8041c5:	39 c8                	cmp    %ecx,%eax
+  8041c7:	75 f1                	jne    8041ba <page_in+0x1ea>
+	return n;
+  8041c9:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  8041cb:	85 f6                	test   %esi,%esi
+  8041cd:	0f 84 4d fe ff ff    	je     804020 <page_in+0x50>
+		return r < 0 ? r : 0;
+  8041d3:	85 c0                	test   %eax,%eax
+  8041d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041da:	0f 4f c2             	cmovg  %edx,%eax
+  8041dd:	e9 99 fe ff ff       	jmp    80407b <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8041e2:	50                   	push   %eax
+  8041e3:	68 20 5e 80 00       	push   $0x805e20
+  8041e8:	68 9a 02 00 00       	push   $0x29a
+  8041ed:	68 1a 5a 80 00       	push   $0x805a1a
+  8041f2:	e8 3e c0 ff ff       	call   800235 <_panic>
+		return -E_PAGING;
+  8041f7:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8041fc:	e9 7a fe ff ff       	jmp    80407b <page_in+0xab>
+
+00804201 <page_map>:
+{
+  804201:	55                   	push   %ebp
+  804202:	89 e5                	mov    %esp,%ebp
+  804204:	57                   	push   %edi
+  804205:	56                   	push   %esi
+  804206:	53                   	push   %ebx
+  804207:	83 ec 1c             	sub    $0x1c,%esp
+  80420a:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  80420d:	83 ec 0c             	sub    $0xc,%esp
+  804210:	ff 75 18             	push   0x18(%ebp)
+  804213:	ff 75 14             	push   0x14(%ebp)
+  804216:	ff 75 10             	push   0x10(%ebp)
+  804219:	ff 75 0c             	push   0xc(%ebp)
+  80421c:	56                   	push   %esi
+  80421d:	e8 0b cc ff ff       	call   800e2d <sys_page_map>
+  804222:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804225:	83 c4 20             	add    $0x20,%esp
+  804228:	85 c0                	test   %eax,%eax
+  80422a:	0f 89 a9 01 00 00    	jns    8043d9 <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  804230:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  804234:	74 5f                	je     804295 <page_map+0x94>
+		if (r != -E_INVAL)
+  804236:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  80423a:	0f 85 a0 01 00 00    	jne    8043e0 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804240:	85 f6                	test   %esi,%esi
+  804242:	74 70                	je     8042b4 <page_map+0xb3>
+  804244:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804249:	8b 40 48             	mov    0x48(%eax),%eax
+  80424c:	39 f0                	cmp    %esi,%eax
+  80424e:	74 64                	je     8042b4 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804250:	83 ec 0c             	sub    $0xc,%esp
+  804253:	6a 05                	push   $0x5
+  804255:	68 00 00 40 00       	push   $0x400000
+  80425a:	6a 00                	push   $0x0
+  80425c:	68 00 b0 ad de       	push   $0xdeadb000
+  804261:	56                   	push   %esi
+  804262:	e8 c6 cb ff ff       	call   800e2d <sys_page_map>
+  804267:	89 c3                	mov    %eax,%ebx
+  804269:	83 c4 20             	add    $0x20,%esp
+  80426c:	85 c0                	test   %eax,%eax
+  80426e:	79 6a                	jns    8042da <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  804270:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804273:	75 50                	jne    8042c5 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804275:	83 ec 08             	sub    $0x8,%esp
+  804278:	68 00 00 40 00       	push   $0x400000
+  80427d:	6a fc                	push   $0xfffffffc
+  80427f:	e8 9c f6 ff ff       	call   803920 <page_out>
+  804284:	83 c4 10             	add    $0x10,%esp
+  804287:	85 c0                	test   %eax,%eax
+  804289:	79 c5                	jns    804250 <page_map+0x4f>
+}
+  80428b:	89 d8                	mov    %ebx,%eax
+  80428d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804290:	5b                   	pop    %ebx
+  804291:	5e                   	pop    %esi
+  804292:	5f                   	pop    %edi
+  804293:	5d                   	pop    %ebp
+  804294:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804295:	83 ec 08             	sub    $0x8,%esp
+  804298:	68 00 00 40 00       	push   $0x400000
+  80429d:	6a 00                	push   $0x0
+  80429f:	e8 7c f6 ff ff       	call   803920 <page_out>
+  8042a4:	83 c4 10             	add    $0x10,%esp
+  8042a7:	85 c0                	test   %eax,%eax
+  8042a9:	0f 89 5e ff ff ff    	jns    80420d <page_map+0xc>
+				return r;
+  8042af:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8042b2:	eb d7                	jmp    80428b <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8042b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042b7:	e8 79 f9 ff ff       	call   803c35 <page_adopt>
+  8042bc:	85 c0                	test   %eax,%eax
+  8042be:	79 90                	jns    804250 <page_map+0x4f>
+			return r;
+  8042c0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8042c3:	eb c6                	jmp    80428b <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  8042c5:	53                   	push   %ebx
+  8042c6:	68 54 5e 80 00       	push   $0x805e54
+  8042cb:	68 77 03 00 00       	push   $0x377
+  8042d0:	68 1a 5a 80 00       	push   $0x805a1a
+  8042d5:	e8 5b bf ff ff       	call   800235 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8042da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8042dd:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8042e0:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8042e7:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8042ed:	0f 84 f5 00 00 00    	je     8043e8 <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8042f3:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8042f9:	83 ec 0c             	sub    $0xc,%esp
+  8042fc:	6a 05                	push   $0x5
+  8042fe:	68 00 00 40 00       	push   $0x400000
+  804303:	6a 00                	push   $0x0
+  804305:	57                   	push   %edi
+  804306:	56                   	push   %esi
+  804307:	e8 21 cb ff ff       	call   800e2d <sys_page_map>
+  80430c:	89 c3                	mov    %eax,%ebx
+  80430e:	83 c4 20             	add    $0x20,%esp
+  804311:	85 c0                	test   %eax,%eax
+  804313:	79 35                	jns    80434a <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  804315:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804318:	75 1b                	jne    804335 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80431a:	83 ec 08             	sub    $0x8,%esp
+  80431d:	68 00 00 40 00       	push   $0x400000
+  804322:	6a 00                	push   $0x0
+  804324:	e8 f7 f5 ff ff       	call   803920 <page_out>
+  804329:	83 c4 10             	add    $0x10,%esp
+  80432c:	85 c0                	test   %eax,%eax
+  80432e:	79 c9                	jns    8042f9 <page_map+0xf8>
+  804330:	e9 56 ff ff ff       	jmp    80428b <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  804335:	53                   	push   %ebx
+  804336:	68 7c 5e 80 00       	push   $0x805e7c
+  80433b:	68 83 03 00 00       	push   $0x383
+  804340:	68 1a 5a 80 00       	push   $0x805a1a
+  804345:	e8 eb be ff ff       	call   800235 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  80434a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80434d:	c1 e8 0c             	shr    $0xc,%eax
+  804350:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  804355:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  80435c:	01 
+  80435d:	0f 84 8d 00 00 00    	je     8043f0 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804363:	83 ec 08             	sub    $0x8,%esp
+  804366:	68 00 00 40 00       	push   $0x400000
+  80436b:	6a 00                	push   $0x0
+  80436d:	e8 fd ca ff ff       	call   800e6f <sys_page_unmap>
+  804372:	83 c4 10             	add    $0x10,%esp
+  804375:	85 c0                	test   %eax,%eax
+  804377:	78 36                	js     8043af <page_map+0x1ae>
+  804379:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  80437c:	83 ec 08             	sub    $0x8,%esp
+  80437f:	57                   	push   %edi
+  804380:	56                   	push   %esi
+  804381:	e8 4a fc ff ff       	call   803fd0 <page_in>
+  804386:	89 c3                	mov    %eax,%ebx
+  804388:	83 c4 10             	add    $0x10,%esp
+  80438b:	85 c0                	test   %eax,%eax
+  80438d:	0f 89 7a fe ff ff    	jns    80420d <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804393:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804396:	75 2c                	jne    8043c4 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804398:	83 ec 08             	sub    $0x8,%esp
+  80439b:	57                   	push   %edi
+  80439c:	6a 00                	push   $0x0
+  80439e:	e8 7d f5 ff ff       	call   803920 <page_out>
+  8043a3:	83 c4 10             	add    $0x10,%esp
+  8043a6:	85 c0                	test   %eax,%eax
+  8043a8:	79 d2                	jns    80437c <page_map+0x17b>
+  8043aa:	e9 dc fe ff ff       	jmp    80428b <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  8043af:	50                   	push   %eax
+  8043b0:	68 a8 5e 80 00       	push   $0x805ea8
+  8043b5:	68 8b 03 00 00       	push   $0x38b
+  8043ba:	68 1a 5a 80 00       	push   $0x805a1a
+  8043bf:	e8 71 be ff ff       	call   800235 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  8043c4:	53                   	push   %ebx
+  8043c5:	68 d0 5e 80 00       	push   $0x805ed0
+  8043ca:	68 91 03 00 00       	push   $0x391
+  8043cf:	68 1a 5a 80 00       	push   $0x805a1a
+  8043d4:	e8 5c be ff ff       	call   800235 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  8043d9:	89 c3                	mov    %eax,%ebx
+  8043db:	e9 ab fe ff ff       	jmp    80428b <page_map+0x8a>
+  8043e0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043e3:	e9 a3 fe ff ff       	jmp    80428b <page_map+0x8a>
+			return r; // Pass through the error
+  8043e8:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043eb:	e9 9b fe ff ff       	jmp    80428b <page_map+0x8a>
+			return r; // Pass through the error
+  8043f0:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8043f3:	e9 93 fe ff ff       	jmp    80428b <page_map+0x8a>
+
+008043f8 <page_map_range>:
+{
+  8043f8:	55                   	push   %ebp
+  8043f9:	89 e5                	mov    %esp,%ebp
+  8043fb:	57                   	push   %edi
+  8043fc:	56                   	push   %esi
+  8043fd:	53                   	push   %ebx
+  8043fe:	83 ec 0c             	sub    $0xc,%esp
+  804401:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804404:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  804407:	83 ec 08             	sub    $0x8,%esp
+  80440a:	ff 75 1c             	push   0x1c(%ebp)
+  80440d:	ff 75 18             	push   0x18(%ebp)
+  804410:	56                   	push   %esi
+  804411:	ff 75 10             	push   0x10(%ebp)
+  804414:	57                   	push   %edi
+  804415:	ff 75 08             	push   0x8(%ebp)
+  804418:	e8 1b cb ff ff       	call   800f38 <sys_page_map_range>
+  80441d:	89 c3                	mov    %eax,%ebx
+  80441f:	83 c4 20             	add    $0x20,%esp
+  804422:	85 c0                	test   %eax,%eax
+  804424:	79 1b                	jns    804441 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804426:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804429:	75 20                	jne    80444b <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  80442b:	83 ec 08             	sub    $0x8,%esp
+  80442e:	68 00 00 40 00       	push   $0x400000
+  804433:	6a 00                	push   $0x0
+  804435:	e8 e6 f4 ff ff       	call   803920 <page_out>
+  80443a:	83 c4 10             	add    $0x10,%esp
+  80443d:	85 c0                	test   %eax,%eax
+  80443f:	79 c6                	jns    804407 <page_map_range+0xf>
+}
+  804441:	89 d8                	mov    %ebx,%eax
+  804443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804446:	5b                   	pop    %ebx
+  804447:	5e                   	pop    %esi
+  804448:	5f                   	pop    %edi
+  804449:	5d                   	pop    %ebp
+  80444a:	c3                   	ret
+		if (r != -E_INVAL)
+  80444b:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  80444e:	75 f1                	jne    804441 <page_map_range+0x49>
+  804450:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  804452:	be 00 00 00 00       	mov    $0x0,%esi
+  804457:	eb 03                	jmp    80445c <page_map_range+0x64>
+  804459:	83 c6 01             	add    $0x1,%esi
+  80445c:	3b 75 18             	cmp    0x18(%ebp),%esi
+  80445f:	74 2a                	je     80448b <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  804461:	83 ec 0c             	sub    $0xc,%esp
+  804464:	ff 75 1c             	push   0x1c(%ebp)
+  804467:	53                   	push   %ebx
+  804468:	ff 75 10             	push   0x10(%ebp)
+  80446b:	57                   	push   %edi
+  80446c:	ff 75 08             	push   0x8(%ebp)
+  80446f:	e8 8d fd ff ff       	call   804201 <page_map>
+  804474:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80447a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804480:	83 c4 20             	add    $0x20,%esp
+  804483:	85 c0                	test   %eax,%eax
+  804485:	79 d2                	jns    804459 <page_map_range+0x61>
+  804487:	89 c3                	mov    %eax,%ebx
+  804489:	eb b6                	jmp    804441 <page_map_range+0x49>
+		return 0;
+  80448b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804490:	eb af                	jmp    804441 <page_map_range+0x49>
+
+00804492 <paging_pgfault_handler>:
+{
+  804492:	55                   	push   %ebp
+  804493:	89 e5                	mov    %esp,%ebp
+  804495:	56                   	push   %esi
+  804496:	53                   	push   %ebx
+  804497:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  80449a:	e8 6f e7 ff ff       	call   802c0e <find_paging_env>
+	if (pagingenv == 0)
+  80449f:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  8044a4:	85 c0                	test   %eax,%eax
+  8044a6:	74 3c                	je     8044e4 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  8044a8:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8044aa:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8044ae:	75 12                	jne    8044c2 <paging_pgfault_handler+0x30>
+  8044b0:	89 f0                	mov    %esi,%eax
+  8044b2:	e8 7e f7 ff ff       	call   803c35 <page_adopt>
+  8044b7:	89 c2                	mov    %eax,%edx
+		return 0;
+  8044b9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  8044be:	85 d2                	test   %edx,%edx
+  8044c0:	78 22                	js     8044e4 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  8044c2:	83 ec 08             	sub    $0x8,%esp
+  8044c5:	6a 00                	push   $0x0
+  8044c7:	56                   	push   %esi
+  8044c8:	e8 a9 f3 ff ff       	call   803876 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  8044cd:	83 c4 10             	add    $0x10,%esp
+  8044d0:	85 c0                	test   %eax,%eax
+  8044d2:	74 05                	je     8044d9 <paging_pgfault_handler+0x47>
+  8044d4:	f6 00 01             	testb  $0x1,(%eax)
+  8044d7:	75 12                	jne    8044eb <paging_pgfault_handler+0x59>
+	return 0;
+  8044d9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  8044de:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  8044e2:	74 23                	je     804507 <paging_pgfault_handler+0x75>
+}
+  8044e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8044e7:	5b                   	pop    %ebx
+  8044e8:	5e                   	pop    %esi
+  8044e9:	5d                   	pop    %ebp
+  8044ea:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  8044eb:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8044f0:	8b 40 48             	mov    0x48(%eax),%eax
+  8044f3:	83 ec 08             	sub    $0x8,%esp
+  8044f6:	56                   	push   %esi
+  8044f7:	50                   	push   %eax
+  8044f8:	e8 d3 fa ff ff       	call   803fd0 <page_in>
+  8044fd:	f7 d0                	not    %eax
+  8044ff:	c1 e8 1f             	shr    $0x1f,%eax
+  804502:	83 c4 10             	add    $0x10,%esp
+  804505:	eb dd                	jmp    8044e4 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804507:	89 f0                	mov    %esi,%eax
+  804509:	e8 97 e2 ff ff       	call   8027a5 <segment_lookup>
+  80450e:	89 c2                	mov    %eax,%edx
+	return 0;
+  804510:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804515:	85 d2                	test   %edx,%edx
+  804517:	74 cb                	je     8044e4 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  804519:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80451e:	8b 40 48             	mov    0x48(%eax),%eax
+  804521:	83 ec 08             	sub    $0x8,%esp
+  804524:	56                   	push   %esi
+  804525:	50                   	push   %eax
+  804526:	e8 f5 f3 ff ff       	call   803920 <page_out>
+  80452b:	f7 d0                	not    %eax
+  80452d:	c1 e8 1f             	shr    $0x1f,%eax
+  804530:	83 c4 10             	add    $0x10,%esp
+  804533:	eb af                	jmp    8044e4 <paging_pgfault_handler+0x52>
+
+00804535 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  804535:	55                   	push   %ebp
+  804536:	89 e5                	mov    %esp,%ebp
+  804538:	57                   	push   %edi
+  804539:	56                   	push   %esi
+  80453a:	53                   	push   %ebx
+  80453b:	83 ec 2c             	sub    $0x2c,%esp
+  80453e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804541:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804546:	89 c1                	mov    %eax,%ecx
+  804548:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  80454b:	c1 e8 11             	shr    $0x11,%eax
+  80454e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804551:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  804558:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  80455b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804560:	d3 e0                	shl    %cl,%eax
+  804562:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804565:	85 c7                	test   %eax,%edi
+  804567:	74 12                	je     80457b <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804569:	bb 01 00 00 00       	mov    $0x1,%ebx
+  80456e:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  804571:	bf 01 00 00 00       	mov    $0x1,%edi
+  804576:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804579:	eb 17                	jmp    804592 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  80457b:	ff 75 e0             	push   -0x20(%ebp)
+  80457e:	68 08 5f 80 00       	push   $0x805f08
+  804583:	6a 48                	push   $0x48
+  804585:	68 22 5f 80 00       	push   $0x805f22
+  80458a:	e8 a6 bc ff ff       	call   800235 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  80458f:	83 c3 01             	add    $0x1,%ebx
+  804592:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804595:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804598:	89 c8                	mov    %ecx,%eax
+  80459a:	c1 e8 05             	shr    $0x5,%eax
+  80459d:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  8045a4:	89 fe                	mov    %edi,%esi
+  8045a6:	d3 e6                	shl    %cl,%esi
+  8045a8:	89 f1                	mov    %esi,%ecx
+  8045aa:	85 d6                	test   %edx,%esi
+  8045ac:	74 e1                	je     80458f <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  8045ae:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  8045b1:	f7 d6                	not    %esi
+  8045b3:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8045b6:	21 fe                	and    %edi,%esi
+  8045b8:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8045bb:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  8045c2:	f7 d1                	not    %ecx
+  8045c4:	21 d1                	and    %edx,%ecx
+  8045c6:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  8045cd:	83 ec 04             	sub    $0x4,%esp
+  8045d0:	53                   	push   %ebx
+  8045d1:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8045d4:	57                   	push   %edi
+  8045d5:	6a 00                	push   $0x0
+  8045d7:	e8 97 f8 ff ff       	call   803e73 <page_unmap_range>
+	va_free(va, n);
+  8045dc:	83 c4 08             	add    $0x8,%esp
+  8045df:	53                   	push   %ebx
+  8045e0:	57                   	push   %edi
+  8045e1:	e8 ed 05 00 00       	call   804bd3 <va_free>
+}
+  8045e6:	83 c4 10             	add    $0x10,%esp
+  8045e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8045ec:	5b                   	pop    %ebx
+  8045ed:	5e                   	pop    %esi
+  8045ee:	5f                   	pop    %edi
+  8045ef:	5d                   	pop    %ebp
+  8045f0:	c3                   	ret
+
+008045f1 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  8045f1:	55                   	push   %ebp
+  8045f2:	89 e5                	mov    %esp,%ebp
+  8045f4:	57                   	push   %edi
+  8045f5:	56                   	push   %esi
+  8045f6:	53                   	push   %ebx
+  8045f7:	83 ec 1c             	sub    $0x1c,%esp
+  8045fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  8045fd:	85 db                	test   %ebx,%ebx
+  8045ff:	74 34                	je     804635 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804601:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804607:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  80460c:	77 2f                	ja     80463d <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  80460e:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804614:	75 51                	jne    804667 <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804616:	89 c1                	mov    %eax,%ecx
+  804618:	c1 e9 0c             	shr    $0xc,%ecx
+  80461b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804620:	d3 e2                	shl    %cl,%edx
+  804622:	c1 e8 11             	shr    $0x11,%eax
+  804625:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  80462c:	75 24                	jne    804652 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  80462e:	89 d8                	mov    %ebx,%eax
+  804630:	e8 00 ff ff ff       	call   804535 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804635:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804638:	5b                   	pop    %ebx
+  804639:	5e                   	pop    %esi
+  80463a:	5f                   	pop    %edi
+  80463b:	5d                   	pop    %ebp
+  80463c:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  80463d:	53                   	push   %ebx
+  80463e:	68 2f 5f 80 00       	push   $0x805f2f
+  804643:	68 a2 00 00 00       	push   $0xa2
+  804648:	68 22 5f 80 00       	push   $0x805f22
+  80464d:	e8 e3 bb ff ff       	call   800235 <_panic>
+			panic("free: %p is not allocated", va);
+  804652:	53                   	push   %ebx
+  804653:	68 08 5f 80 00       	push   $0x805f08
+  804658:	68 a5 00 00 00       	push   $0xa5
+  80465d:	68 22 5f 80 00       	push   $0x805f22
+  804662:	e8 ce bb ff ff       	call   800235 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804667:	89 de                	mov    %ebx,%esi
+  804669:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  80466f:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804675:	89 c8                	mov    %ecx,%eax
+  804677:	c1 e8 11             	shr    $0x11,%eax
+  80467a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80467d:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  804684:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804687:	c1 e9 0c             	shr    $0xc,%ecx
+  80468a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80468f:	d3 e0                	shl    %cl,%eax
+  804691:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804694:	85 c7                	test   %eax,%edi
+  804696:	74 1b                	je     8046b3 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804698:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  80469c:	89 d8                	mov    %ebx,%eax
+  80469e:	29 f0                	sub    %esi,%eax
+  8046a0:	83 e8 10             	sub    $0x10,%eax
+  8046a3:	99                   	cltd
+  8046a4:	f7 ff                	idiv   %edi
+  8046a6:	89 d1                	mov    %edx,%ecx
+  8046a8:	85 d2                	test   %edx,%edx
+  8046aa:	75 07                	jne    8046b3 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8046ac:	ba 10 00 00 00       	mov    $0x10,%edx
+  8046b1:	eb 18                	jmp    8046cb <free+0xda>
+		panic("free: %p is not allocated", va);
+  8046b3:	53                   	push   %ebx
+  8046b4:	68 08 5f 80 00       	push   $0x805f08
+  8046b9:	68 ad 00 00 00       	push   $0xad
+  8046be:	68 22 5f 80 00       	push   $0x805f22
+  8046c3:	e8 6d bb ff ff       	call   800235 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8046c8:	83 c1 01             	add    $0x1,%ecx
+  8046cb:	89 d0                	mov    %edx,%eax
+  8046cd:	d3 e0                	shl    %cl,%eax
+  8046cf:	39 c7                	cmp    %eax,%edi
+  8046d1:	7f f5                	jg     8046c8 <free+0xd7>
+	*(void **) va = s->free;
+  8046d3:	8b 46 08             	mov    0x8(%esi),%eax
+  8046d6:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8046d8:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8046db:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8046df:	8d 58 01             	lea    0x1(%eax),%ebx
+  8046e2:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8046e6:	66 85 c0             	test   %ax,%ax
+  8046e9:	74 52                	je     80473d <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8046eb:	0f b7 db             	movzwl %bx,%ebx
+  8046ee:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8046f2:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8046f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046fc:	f7 ff                	idiv   %edi
+  8046fe:	39 c3                	cmp    %eax,%ebx
+  804700:	0f 85 2f ff ff ff    	jne    804635 <free+0x44>
+  804706:	8b 46 04             	mov    0x4(%esi),%eax
+  804709:	85 c0                	test   %eax,%eax
+  80470b:	74 53                	je     804760 <free+0x16f>
+		s->prev->next = s->next;
+  80470d:	8b 16                	mov    (%esi),%edx
+  80470f:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804711:	8b 06                	mov    (%esi),%eax
+  804713:	85 c0                	test   %eax,%eax
+  804715:	74 06                	je     80471d <free+0x12c>
+		s->next->prev = s->prev;
+  804717:	8b 56 04             	mov    0x4(%esi),%edx
+  80471a:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80471d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804720:	f7 d0                	not    %eax
+  804722:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804725:	21 d0                	and    %edx,%eax
+  804727:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80472a:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  804731:	89 f0                	mov    %esi,%eax
+  804733:	e8 fd fd ff ff       	call   804535 <heap_free_pages>
+  804738:	e9 f8 fe ff ff       	jmp    804635 <free+0x44>
+	s->prev = NULL;
+  80473d:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804744:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  80474b:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  80474d:	85 c0                	test   %eax,%eax
+  80474f:	74 03                	je     804754 <free+0x163>
+		slabs[c]->prev = s;
+  804751:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804754:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  80475b:	e9 d5 fe ff ff       	jmp    804635 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804760:	8b 06                	mov    (%esi),%eax
+  804762:	85 c0                	test   %eax,%eax
+  804764:	0f 84 cb fe ff ff    	je     804635 <free+0x44>
+		slabs[c] = s->next;
+  80476a:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  804771:	8b 06                	mov    (%esi),%eax
+  804773:	eb a2                	jmp    804717 <free+0x126>
+
+00804775 <heap_alloc_pages>:
+{
+  804775:	55                   	push   %ebp
+  804776:	89 e5                	mov    %esp,%ebp
+  804778:	57                   	push   %edi
+  804779:	56                   	push   %esi
+  80477a:	53                   	push   %ebx
+  80477b:	83 ec 18             	sub    $0x18,%esp
+  80477e:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804780:	50                   	push   %eax
+  804781:	e8 15 03 00 00       	call   804a9b <va_alloc>
+  804786:	89 c3                	mov    %eax,%ebx
+  804788:	83 c4 10             	add    $0x10,%esp
+  80478b:	85 c0                	test   %eax,%eax
+  80478d:	74 47                	je     8047d6 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  80478f:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804795:	89 c1                	mov    %eax,%ecx
+  804797:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80479a:	c1 e8 11             	shr    $0x11,%eax
+  80479d:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047a2:	89 d7                	mov    %edx,%edi
+  8047a4:	d3 e7                	shl    %cl,%edi
+  8047a6:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8047ad:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8047b1:	89 c8                	mov    %ecx,%eax
+  8047b3:	c1 e8 05             	shr    $0x5,%eax
+  8047b6:	d3 e2                	shl    %cl,%edx
+  8047b8:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8047bf:	83 ec 0c             	sub    $0xc,%esp
+  8047c2:	6a 00                	push   $0x0
+  8047c4:	6a 07                	push   $0x7
+  8047c6:	56                   	push   %esi
+  8047c7:	53                   	push   %ebx
+  8047c8:	6a 00                	push   $0x0
+  8047ca:	e8 3a f7 ff ff       	call   803f09 <page_alloc_range>
+  8047cf:	83 c4 20             	add    $0x20,%esp
+  8047d2:	85 c0                	test   %eax,%eax
+  8047d4:	78 0a                	js     8047e0 <heap_alloc_pages+0x6b>
+}
+  8047d6:	89 d8                	mov    %ebx,%eax
+  8047d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8047db:	5b                   	pop    %ebx
+  8047dc:	5e                   	pop    %esi
+  8047dd:	5f                   	pop    %edi
+  8047de:	5d                   	pop    %ebp
+  8047df:	c3                   	ret
+		free(va);
+  8047e0:	83 ec 0c             	sub    $0xc,%esp
+  8047e3:	53                   	push   %ebx
+  8047e4:	e8 08 fe ff ff       	call   8045f1 <free>
+		return NULL;
+  8047e9:	83 c4 10             	add    $0x10,%esp
+  8047ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8047f1:	eb e3                	jmp    8047d6 <heap_alloc_pages+0x61>
+
+008047f3 <malloc>:
+{
+  8047f3:	55                   	push   %ebp
+  8047f4:	89 e5                	mov    %esp,%ebp
+  8047f6:	57                   	push   %edi
+  8047f7:	56                   	push   %esi
+  8047f8:	53                   	push   %ebx
+  8047f9:	83 ec 1c             	sub    $0x1c,%esp
+  8047fc:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8047ff:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804802:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804808:	0f 87 21 01 00 00    	ja     80492f <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  80480e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804813:	ba 10 00 00 00       	mov    $0x10,%edx
+  804818:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80481a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80481f:	76 15                	jbe    804836 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804821:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804826:	c1 e8 0c             	shr    $0xc,%eax
+  804829:	e8 47 ff ff ff       	call   804775 <heap_alloc_pages>
+  80482e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804831:	eb 37                	jmp    80486a <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804833:	83 c1 01             	add    $0x1,%ecx
+  804836:	89 d6                	mov    %edx,%esi
+  804838:	d3 e6                	shl    %cl,%esi
+  80483a:	39 c6                	cmp    %eax,%esi
+  80483c:	72 f5                	jb     804833 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  80483e:	89 cb                	mov    %ecx,%ebx
+  804840:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  804847:	85 ff                	test   %edi,%edi
+  804849:	74 2a                	je     804875 <malloc+0x82>
+	v = s->free;
+  80484b:	8b 47 08             	mov    0x8(%edi),%eax
+  80484e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804851:	8b 00                	mov    (%eax),%eax
+  804853:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804856:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  80485a:	83 e8 01             	sub    $0x1,%eax
+  80485d:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804861:	66 85 c0             	test   %ax,%ax
+  804864:	0f 84 9a 00 00 00    	je     804904 <malloc+0x111>
+}
+  80486a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80486d:	83 c4 1c             	add    $0x1c,%esp
+  804870:	5b                   	pop    %ebx
+  804871:	5e                   	pop    %esi
+  804872:	5f                   	pop    %edi
+  804873:	5d                   	pop    %ebp
+  804874:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804875:	b8 01 00 00 00       	mov    $0x1,%eax
+  80487a:	e8 f6 fe ff ff       	call   804775 <heap_alloc_pages>
+  80487f:	89 c1                	mov    %eax,%ecx
+  804881:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804884:	85 c0                	test   %eax,%eax
+  804886:	74 e2                	je     80486a <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804888:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  80488e:	89 c8                	mov    %ecx,%eax
+  804890:	c1 e8 11             	shr    $0x11,%eax
+  804893:	c1 e9 0c             	shr    $0xc,%ecx
+  804896:	ba 01 00 00 00       	mov    $0x1,%edx
+  80489b:	d3 e2                	shl    %cl,%edx
+  80489d:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8048a4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8048a7:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8048ab:	0f b7 f6             	movzwl %si,%esi
+  8048ae:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8048b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048b8:	f7 fe                	idiv   %esi
+  8048ba:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8048be:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8048c1:	85 c0                	test   %eax,%eax
+  8048c3:	74 14                	je     8048d9 <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8048c5:	83 e8 01             	sub    $0x1,%eax
+  8048c8:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8048cc:	0f af d0             	imul   %eax,%edx
+  8048cf:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8048d3:	89 3a                	mov    %edi,(%edx)
+  8048d5:	89 d7                	mov    %edx,%edi
+  8048d7:	eb e5                	jmp    8048be <malloc+0xcb>
+	s->prev = NULL;
+  8048d9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8048dc:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8048e3:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  8048ea:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  8048ec:	85 c0                	test   %eax,%eax
+  8048ee:	74 03                	je     8048f3 <malloc+0x100>
+		slabs[c]->prev = s;
+  8048f0:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  8048f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8048f6:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  8048fd:	89 c7                	mov    %eax,%edi
+  8048ff:	e9 47 ff ff ff       	jmp    80484b <malloc+0x58>
+	if (s->prev)
+  804904:	8b 47 04             	mov    0x4(%edi),%eax
+  804907:	85 c0                	test   %eax,%eax
+  804909:	74 19                	je     804924 <malloc+0x131>
+		s->prev->next = s->next;
+  80490b:	8b 17                	mov    (%edi),%edx
+  80490d:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  80490f:	8b 07                	mov    (%edi),%eax
+  804911:	85 c0                	test   %eax,%eax
+  804913:	0f 84 51 ff ff ff    	je     80486a <malloc+0x77>
+		s->next->prev = s->prev;
+  804919:	8b 57 04             	mov    0x4(%edi),%edx
+  80491c:	89 50 04             	mov    %edx,0x4(%eax)
+  80491f:	e9 46 ff ff ff       	jmp    80486a <malloc+0x77>
+		slabs[c] = s->next;
+  804924:	8b 07                	mov    (%edi),%eax
+  804926:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  80492d:	eb e0                	jmp    80490f <malloc+0x11c>
+		return NULL;
+  80492f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804936:	e9 2f ff ff ff       	jmp    80486a <malloc+0x77>
+
+0080493b <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80493b:	55                   	push   %ebp
+  80493c:	89 e5                	mov    %esp,%ebp
+  80493e:	57                   	push   %edi
+  80493f:	56                   	push   %esi
+  804940:	53                   	push   %ebx
+  804941:	83 ec 0c             	sub    $0xc,%esp
+  804944:	89 c6                	mov    %eax,%esi
+  804946:	89 d7                	mov    %edx,%edi
+  804948:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80494b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804950:	ba 00 00 00 00       	mov    $0x0,%edx
+  804955:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80495a:	83 ef 01             	sub    $0x1,%edi
+  80495d:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804960:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804963:	eb 34                	jmp    804999 <va_chunk_scan+0x5e>
+			i += 31;
+  804965:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  804968:	89 ca                	mov    %ecx,%edx
+			continue;
+  80496a:	eb 23                	jmp    80498f <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  80496c:	89 c7                	mov    %eax,%edi
+  80496e:	c1 ef 05             	shr    $0x5,%edi
+  804971:	be 01 00 00 00       	mov    $0x1,%esi
+  804976:	d3 e6                	shl    %cl,%esi
+  804978:	89 f1                	mov    %esi,%ecx
+  80497a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80497d:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804980:	75 41                	jne    8049c3 <va_chunk_scan+0x88>
+			len++;
+  804982:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  804985:	39 d3                	cmp    %edx,%ebx
+  804987:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  80498a:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  80498d:	72 2d                	jb     8049bc <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80498f:	83 c0 01             	add    $0x1,%eax
+  804992:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804997:	77 31                	ja     8049ca <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  804999:	89 c1                	mov    %eax,%ecx
+  80499b:	83 e1 1f             	and    $0x1f,%ecx
+  80499e:	75 cc                	jne    80496c <va_chunk_scan+0x31>
+  8049a0:	89 c7                	mov    %eax,%edi
+  8049a2:	c1 ef 05             	shr    $0x5,%edi
+  8049a5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8049a8:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8049ab:	83 ff ff             	cmp    $0xffffffff,%edi
+  8049ae:	74 b5                	je     804965 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8049b0:	85 ff                	test   %edi,%edi
+  8049b2:	75 b8                	jne    80496c <va_chunk_scan+0x31>
+			i += 31;
+  8049b4:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8049b7:	83 c2 20             	add    $0x20,%edx
+  8049ba:	eb c9                	jmp    804985 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8049bc:	83 c0 01             	add    $0x1,%eax
+  8049bf:	29 d0                	sub    %edx,%eax
+  8049c1:	eb 15                	jmp    8049d8 <va_chunk_scan+0x9d>
+			len = 0;
+  8049c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049c8:	eb c5                	jmp    80498f <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8049ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8049cf:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8049d2:	85 d2                	test   %edx,%edx
+  8049d4:	74 02                	je     8049d8 <va_chunk_scan+0x9d>
+		*run_store = best;
+  8049d6:	89 1a                	mov    %ebx,(%edx)
+}
+  8049d8:	83 c4 0c             	add    $0xc,%esp
+  8049db:	5b                   	pop    %ebx
+  8049dc:	5e                   	pop    %esi
+  8049dd:	5f                   	pop    %edi
+  8049de:	5d                   	pop    %ebp
+  8049df:	c3                   	ret
+
+008049e0 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8049e0:	55                   	push   %ebp
+  8049e1:	89 e5                	mov    %esp,%ebp
+  8049e3:	57                   	push   %edi
+  8049e4:	56                   	push   %esi
+  8049e5:	53                   	push   %ebx
+  8049e6:	83 ec 14             	sub    $0x14,%esp
+  8049e9:	89 c3                	mov    %eax,%ebx
+  8049eb:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  8049ed:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  8049f3:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  8049f9:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  8049fc:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  8049ff:	89 d6                	mov    %edx,%esi
+  804a01:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  804a07:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  804a09:	eb 34                	jmp    804a3f <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804a0b:	89 c8                	mov    %ecx,%eax
+  804a0d:	c1 e8 05             	shr    $0x5,%eax
+  804a10:	89 da                	mov    %ebx,%edx
+  804a12:	c1 e2 05             	shl    $0x5,%edx
+  804a15:	01 da                	add    %ebx,%edx
+  804a17:	01 c2                	add    %eax,%edx
+  804a19:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804a1e:	d3 c0                	rol    %cl,%eax
+  804a20:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804a27:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804a2e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a33:	01 d0                	add    %edx,%eax
+  804a35:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804a3c:	83 c1 01             	add    $0x1,%ecx
+  804a3f:	39 f9                	cmp    %edi,%ecx
+  804a41:	74 30                	je     804a73 <va_chunk_mark+0x93>
+		if (alloc)
+  804a43:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804a47:	74 c2                	je     804a0b <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  804a49:	89 c8                	mov    %ecx,%eax
+  804a4b:	c1 e8 05             	shr    $0x5,%eax
+  804a4e:	89 da                	mov    %ebx,%edx
+  804a50:	c1 e2 05             	shl    $0x5,%edx
+  804a53:	01 da                	add    %ebx,%edx
+  804a55:	01 c2                	add    %eax,%edx
+  804a57:	b8 01 00 00 00       	mov    $0x1,%eax
+  804a5c:	d3 e0                	shl    %cl,%eax
+  804a5e:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  804a65:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804a6c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804a71:	eb c0                	jmp    804a33 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804a73:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  804a76:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a7b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804a7e:	e8 b8 fe ff ff       	call   80493b <va_chunk_scan>
+	ch->run = run;
+  804a83:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  804a89:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804a8c:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  804a93:	83 c4 14             	add    $0x14,%esp
+  804a96:	5b                   	pop    %ebx
+  804a97:	5e                   	pop    %esi
+  804a98:	5f                   	pop    %edi
+  804a99:	5d                   	pop    %ebp
+  804a9a:	c3                   	ret
+
+00804a9b <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  804a9b:	55                   	push   %ebp
+  804a9c:	89 e5                	mov    %esp,%ebp
+  804a9e:	57                   	push   %edi
+  804a9f:	56                   	push   %esi
+  804aa0:	53                   	push   %ebx
+  804aa1:	83 ec 04             	sub    $0x4,%esp
+  804aa4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  804aa7:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  804aac:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  804ab1:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  804ab8:	74 4f                	je     804b09 <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  804aba:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  804abd:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  804ac2:	0f 87 01 01 00 00    	ja     804bc9 <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  804ac8:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  804ace:	0f 87 80 00 00 00    	ja     804b54 <va_alloc+0xb9>
+  804ad4:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804ad9:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  804ade:	0f b7 10             	movzwl (%eax),%edx
+  804ae1:	05 84 00 00 00       	add    $0x84,%eax
+  804ae6:	39 da                	cmp    %ebx,%edx
+  804ae8:	73 2c                	jae    804b16 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  804aea:	83 c6 01             	add    $0x1,%esi
+  804aed:	83 fe 1c             	cmp    $0x1c,%esi
+  804af0:	75 ec                	jne    804ade <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804af2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804af7:	eb 53                	jmp    804b4c <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  804af9:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804aff:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804b04:	05 84 00 00 00       	add    $0x84,%eax
+  804b09:	39 d0                	cmp    %edx,%eax
+  804b0b:	75 ec                	jne    804af9 <va_alloc+0x5e>
+	va_inited = 1;
+  804b0d:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  804b14:	eb a4                	jmp    804aba <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  804b16:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804b1c:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  804b21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804b26:	89 da                	mov    %ebx,%edx
+  804b28:	e8 0e fe ff ff       	call   80493b <va_chunk_scan>
+  804b2d:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804b2f:	6a 01                	push   $0x1
+  804b31:	89 d9                	mov    %ebx,%ecx
+  804b33:	89 c2                	mov    %eax,%edx
+  804b35:	89 f0                	mov    %esi,%eax
+  804b37:	e8 a4 fe ff ff       	call   8049e0 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804b3c:	c1 e6 16             	shl    $0x16,%esi
+  804b3f:	c1 e7 0c             	shl    $0xc,%edi
+  804b42:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  804b49:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804b4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b4f:	5b                   	pop    %ebx
+  804b50:	5e                   	pop    %esi
+  804b51:	5f                   	pop    %edi
+  804b52:	5d                   	pop    %ebp
+  804b53:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804b54:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  804b5a:	c1 ee 0a             	shr    $0xa,%esi
+  804b5d:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b67:	eb 0a                	jmp    804b73 <va_alloc+0xd8>
+			first = c + 1;
+  804b69:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804b6b:	83 c2 01             	add    $0x1,%edx
+  804b6e:	83 fa 1d             	cmp    $0x1d,%edx
+  804b71:	74 4f                	je     804bc2 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804b73:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  804b79:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  804b80:	00 04 
+  804b82:	75 e5                	jne    804b69 <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804b84:	89 d1                	mov    %edx,%ecx
+  804b86:	29 c1                	sub    %eax,%ecx
+  804b88:	39 f1                	cmp    %esi,%ecx
+  804b8a:	75 df                	jne    804b6b <va_alloc+0xd0>
+  804b8c:	89 c7                	mov    %eax,%edi
+  804b8e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  804b91:	be 00 04 00 00       	mov    $0x400,%esi
+  804b96:	39 f3                	cmp    %esi,%ebx
+  804b98:	0f 46 f3             	cmovbe %ebx,%esi
+  804b9b:	6a 01                	push   $0x1
+  804b9d:	89 f1                	mov    %esi,%ecx
+  804b9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ba4:	89 f8                	mov    %edi,%eax
+  804ba6:	e8 35 fe ff ff       	call   8049e0 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  804bab:	83 c7 01             	add    $0x1,%edi
+  804bae:	83 c4 04             	add    $0x4,%esp
+  804bb1:	29 f3                	sub    %esi,%ebx
+  804bb3:	75 dc                	jne    804b91 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  804bb5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  804bb8:	c1 e0 16             	shl    $0x16,%eax
+  804bbb:	05 00 00 00 08       	add    $0x8000000,%eax
+  804bc0:	eb 8a                	jmp    804b4c <va_alloc+0xb1>
+	return NULL;
+  804bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bc7:	eb 83                	jmp    804b4c <va_alloc+0xb1>
+		return NULL;
+  804bc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bce:	e9 79 ff ff ff       	jmp    804b4c <va_alloc+0xb1>
+
+00804bd3 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  804bd3:	55                   	push   %ebp
+  804bd4:	89 e5                	mov    %esp,%ebp
+  804bd6:	57                   	push   %edi
+  804bd7:	56                   	push   %esi
+  804bd8:	53                   	push   %ebx
+  804bd9:	83 ec 0c             	sub    $0xc,%esp
+  804bdc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804bdf:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  804be2:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  804be8:	76 21                	jbe    804c0b <va_free+0x38>
+  804bea:	89 f0                	mov    %esi,%eax
+  804bec:	c1 e0 0c             	shl    $0xc,%eax
+  804bef:	01 f8                	add    %edi,%eax
+  804bf1:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  804bf6:	77 13                	ja     804c0b <va_free+0x38>
+	    || PGOFF(va))
+  804bf8:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804bfe:	75 0b                	jne    804c0b <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804c00:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  804c06:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  804c09:	eb 45                	jmp    804c50 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804c0b:	83 ec 0c             	sub    $0xc,%esp
+  804c0e:	56                   	push   %esi
+  804c0f:	57                   	push   %edi
+  804c10:	68 4c 5f 80 00       	push   $0x805f4c
+  804c15:	68 8e 00 00 00       	push   $0x8e
+  804c1a:	68 6c 5f 80 00       	push   $0x805f6c
+  804c1f:	e8 11 b6 ff ff       	call   800235 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804c24:	89 fa                	mov    %edi,%edx
+  804c26:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804c2c:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804c31:	29 d3                	sub    %edx,%ebx
+  804c33:	39 f3                	cmp    %esi,%ebx
+  804c35:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  804c38:	89 f8                	mov    %edi,%eax
+  804c3a:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804c3d:	83 ec 0c             	sub    $0xc,%esp
+  804c40:	6a 00                	push   $0x0
+  804c42:	89 d9                	mov    %ebx,%ecx
+  804c44:	e8 97 fd ff ff       	call   8049e0 <va_chunk_mark>
+		i += n;
+  804c49:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804c4b:	29 de                	sub    %ebx,%esi
+  804c4d:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804c50:	85 f6                	test   %esi,%esi
+  804c52:	75 d0                	jne    804c24 <va_free+0x51>
+	}
+}
+  804c54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c57:	5b                   	pop    %ebx
+  804c58:	5e                   	pop    %esi
+  804c59:	5f                   	pop    %edi
+  804c5a:	5d                   	pop    %ebp
+  804c5b:	c3                   	ret
+
+00804c5c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c61:	c3                   	ret
+
+00804c62 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804c62:	55                   	push   %ebp
+  804c63:	89 e5                	mov    %esp,%ebp
+  804c65:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  804c68:	68 79 5f 80 00       	push   $0x805f79
+  804c6d:	ff 75 0c             	push   0xc(%ebp)
+  804c70:	e8 82 bc ff ff       	call   8008f7 <strcpy>
+	return 0;
+}
+  804c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c7a:	c9                   	leave
+  804c7b:	c3                   	ret
+
+00804c7c <devcons_write>:
+{
+  804c7c:	55                   	push   %ebp
+  804c7d:	89 e5                	mov    %esp,%ebp
+  804c7f:	57                   	push   %edi
+  804c80:	56                   	push   %esi
+  804c81:	53                   	push   %ebx
+  804c82:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  804c88:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  804c8d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  804c93:	eb 2e                	jmp    804cc3 <devcons_write+0x47>
+		m = n - tot;
+  804c95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  804c98:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  804c9a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804c9f:	39 c3                	cmp    %eax,%ebx
+  804ca1:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  804ca4:	83 ec 04             	sub    $0x4,%esp
+  804ca7:	53                   	push   %ebx
+  804ca8:	89 f0                	mov    %esi,%eax
+  804caa:	03 45 0c             	add    0xc(%ebp),%eax
+  804cad:	50                   	push   %eax
+  804cae:	57                   	push   %edi
+  804caf:	e8 c9 bd ff ff       	call   800a7d <memmove>
+		sys_cputs(buf, m);
+  804cb4:	83 c4 08             	add    $0x8,%esp
+  804cb7:	53                   	push   %ebx
+  804cb8:	57                   	push   %edi
+  804cb9:	e8 5f c0 ff ff       	call   800d1d <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  804cbe:	01 de                	add    %ebx,%esi
+  804cc0:	83 c4 10             	add    $0x10,%esp
+  804cc3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  804cc6:	72 cd                	jb     804c95 <devcons_write+0x19>
+}
+  804cc8:	89 f0                	mov    %esi,%eax
+  804cca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ccd:	5b                   	pop    %ebx
+  804cce:	5e                   	pop    %esi
+  804ccf:	5f                   	pop    %edi
+  804cd0:	5d                   	pop    %ebp
+  804cd1:	c3                   	ret
+
+00804cd2 <devcons_read>:
+{
+  804cd2:	55                   	push   %ebp
+  804cd3:	89 e5                	mov    %esp,%ebp
+  804cd5:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  804cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cdd:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  804ce1:	75 07                	jne    804cea <devcons_read+0x18>
+  804ce3:	eb 1f                	jmp    804d04 <devcons_read+0x32>
+		sys_yield();
+  804ce5:	e8 e1 c0 ff ff       	call   800dcb <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  804cea:	e8 5d c0 ff ff       	call   800d4c <sys_cgetc>
+  804cef:	85 c0                	test   %eax,%eax
+  804cf1:	74 f2                	je     804ce5 <devcons_read+0x13>
+	if (c < 0)
+  804cf3:	78 0f                	js     804d04 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  804cf5:	83 f8 04             	cmp    $0x4,%eax
+  804cf8:	74 0c                	je     804d06 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  804cfa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804cfd:	88 02                	mov    %al,(%edx)
+	return 1;
+  804cff:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804d04:	c9                   	leave
+  804d05:	c3                   	ret
+		return 0;
+  804d06:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d0b:	eb f7                	jmp    804d04 <devcons_read+0x32>
+
+00804d0d <cputchar>:
+{
+  804d0d:	55                   	push   %ebp
+  804d0e:	89 e5                	mov    %esp,%ebp
+  804d10:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804d13:	8b 45 08             	mov    0x8(%ebp),%eax
+  804d16:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  804d19:	6a 01                	push   $0x1
+  804d1b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804d1e:	50                   	push   %eax
+  804d1f:	e8 f9 bf ff ff       	call   800d1d <sys_cputs>
+}
+  804d24:	83 c4 10             	add    $0x10,%esp
+  804d27:	c9                   	leave
+  804d28:	c3                   	ret
+
+00804d29 <getchar>:
+{
+  804d29:	55                   	push   %ebp
+  804d2a:	89 e5                	mov    %esp,%ebp
+  804d2c:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804d2f:	6a 01                	push   $0x1
+  804d31:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804d34:	50                   	push   %eax
+  804d35:	6a 00                	push   $0x0
+  804d37:	e8 d7 ce ff ff       	call   801c13 <read>
+	if (r < 0)
+  804d3c:	83 c4 10             	add    $0x10,%esp
+  804d3f:	85 c0                	test   %eax,%eax
+  804d41:	78 06                	js     804d49 <getchar+0x20>
+	if (r < 1)
+  804d43:	74 06                	je     804d4b <getchar+0x22>
+	return c;
+  804d45:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  804d49:	c9                   	leave
+  804d4a:	c3                   	ret
+		return -E_EOF;
+  804d4b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804d50:	eb f7                	jmp    804d49 <getchar+0x20>
+
+00804d52 <iscons>:
+{
+  804d52:	55                   	push   %ebp
+  804d53:	89 e5                	mov    %esp,%ebp
+  804d55:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804d58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804d5b:	50                   	push   %eax
+  804d5c:	ff 75 08             	push   0x8(%ebp)
+  804d5f:	e8 50 cc ff ff       	call   8019b4 <fd_lookup>
+  804d64:	83 c4 10             	add    $0x10,%esp
+  804d67:	85 c0                	test   %eax,%eax
+  804d69:	78 11                	js     804d7c <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804d6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804d6e:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804d74:	39 10                	cmp    %edx,(%eax)
+  804d76:	0f 94 c0             	sete   %al
+  804d79:	0f b6 c0             	movzbl %al,%eax
+}
+  804d7c:	c9                   	leave
+  804d7d:	c3                   	ret
+
+00804d7e <opencons>:
+{
+  804d7e:	55                   	push   %ebp
+  804d7f:	89 e5                	mov    %esp,%ebp
+  804d81:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804d84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804d87:	50                   	push   %eax
+  804d88:	e8 d3 cb ff ff       	call   801960 <fd_alloc>
+  804d8d:	83 c4 10             	add    $0x10,%esp
+  804d90:	85 c0                	test   %eax,%eax
+  804d92:	78 3a                	js     804dce <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  804d94:	83 ec 04             	sub    $0x4,%esp
+  804d97:	68 07 04 00 00       	push   $0x407
+  804d9c:	ff 75 f4             	push   -0xc(%ebp)
+  804d9f:	6a 00                	push   $0x0
+  804da1:	e8 44 c0 ff ff       	call   800dea <sys_page_alloc>
+  804da6:	83 c4 10             	add    $0x10,%esp
+  804da9:	85 c0                	test   %eax,%eax
+  804dab:	78 21                	js     804dce <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  804dad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804db0:	8b 15 44 70 80 00    	mov    0x807044,%edx
+  804db6:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  804db8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804dbb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  804dc2:	83 ec 0c             	sub    $0xc,%esp
+  804dc5:	50                   	push   %eax
+  804dc6:	e8 6e cb ff ff       	call   801939 <fd2num>
+  804dcb:	83 c4 10             	add    $0x10,%esp
+}
+  804dce:	c9                   	leave
+  804dcf:	c3                   	ret
+
+00804dd0 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  804dd0:	55                   	push   %ebp
+  804dd1:	89 e5                	mov    %esp,%ebp
+  804dd3:	56                   	push   %esi
+  804dd4:	53                   	push   %ebx
+  804dd5:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804dd8:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  804ddd:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804de0:	85 db                	test   %ebx,%ebx
+  804de2:	78 17                	js     804dfb <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  804de4:	83 ec 0c             	sub    $0xc,%esp
+  804de7:	56                   	push   %esi
+  804de8:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  804def:	83 c4 10             	add    $0x10,%esp
+  804df2:	85 c0                	test   %eax,%eax
+  804df4:	75 27                	jne    804e1d <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  804df6:	83 eb 01             	sub    $0x1,%ebx
+  804df9:	eb e5                	jmp    804de0 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804dfb:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804e00:	8b 40 48             	mov    0x48(%eax),%eax
+  804e03:	83 ec 08             	sub    $0x8,%esp
+  804e06:	ff 76 28             	push   0x28(%esi)
+  804e09:	ff 36                	push   (%esi)
+  804e0b:	50                   	push   %eax
+  804e0c:	68 88 5f 80 00       	push   $0x805f88
+  804e11:	6a 1d                	push   $0x1d
+  804e13:	68 ab 5f 80 00       	push   $0x805fab
+  804e18:	e8 18 b4 ff ff       	call   800235 <_panic>
+}
+  804e1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804e20:	5b                   	pop    %ebx
+  804e21:	5e                   	pop    %esi
+  804e22:	5d                   	pop    %ebp
+  804e23:	c3                   	ret
+
+00804e24 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804e24:	55                   	push   %ebp
+  804e25:	89 e5                	mov    %esp,%ebp
+  804e27:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  804e2a:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  804e31:	74 0a                	je     804e3d <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804e33:	8b 45 08             	mov    0x8(%ebp),%eax
+  804e36:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  804e3b:	c9                   	leave
+  804e3c:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804e3d:	83 ec 04             	sub    $0x4,%esp
+  804e40:	6a 07                	push   $0x7
+  804e42:	68 00 f0 bf ee       	push   $0xeebff000
+  804e47:	6a 00                	push   $0x0
+  804e49:	e8 9c bf ff ff       	call   800dea <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804e4e:	83 c4 08             	add    $0x8,%esp
+  804e51:	68 c4 4e 80 00       	push   $0x804ec4
+  804e56:	6a 00                	push   $0x0
+  804e58:	e8 f3 c2 ff ff       	call   801150 <sys_env_set_pgfault_upcall>
+  804e5d:	83 c4 10             	add    $0x10,%esp
+  804e60:	eb d1                	jmp    804e33 <set_pgfault_handler+0xf>
+
+00804e62 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804e62:	55                   	push   %ebp
+  804e63:	89 e5                	mov    %esp,%ebp
+  804e65:	83 ec 08             	sub    $0x8,%esp
+  804e68:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804e6b:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  804e71:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e76:	eb 03                	jmp    804e7b <add_pgfault_handler+0x19>
+  804e78:	83 c0 01             	add    $0x1,%eax
+  804e7b:	39 d0                	cmp    %edx,%eax
+  804e7d:	74 0b                	je     804e8a <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804e7f:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  804e86:	75 f0                	jne    804e78 <add_pgfault_handler+0x16>
+  804e88:	eb 24                	jmp    804eae <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  804e8a:	83 fa 0a             	cmp    $0xa,%edx
+  804e8d:	74 21                	je     804eb0 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  804e8f:	8d 42 01             	lea    0x1(%edx),%eax
+  804e92:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  804e97:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  804e9e:	83 ec 0c             	sub    $0xc,%esp
+  804ea1:	68 d0 4d 80 00       	push   $0x804dd0
+  804ea6:	e8 79 ff ff ff       	call   804e24 <set_pgfault_handler>
+  804eab:	83 c4 10             	add    $0x10,%esp
+}
+  804eae:	c9                   	leave
+  804eaf:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  804eb0:	83 ec 04             	sub    $0x4,%esp
+  804eb3:	68 b9 5f 80 00       	push   $0x805fb9
+  804eb8:	6a 44                	push   $0x44
+  804eba:	68 ab 5f 80 00       	push   $0x805fab
+  804ebf:	e8 71 b3 ff ff       	call   800235 <_panic>
+
+00804ec4 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804ec4:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804ec5:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  804eca:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  804ecc:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  804ecf:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  804ed3:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  804ed7:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  804eda:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  804edc:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  804ee0:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  804ee3:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  804ee4:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  804ee7:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  804ee8:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  804ee9:	c3                   	ret
+
+00804eea <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  804eea:	55                   	push   %ebp
+  804eeb:	89 e5                	mov    %esp,%ebp
+  804eed:	57                   	push   %edi
+  804eee:	56                   	push   %esi
+  804eef:	53                   	push   %ebx
+  804ef0:	83 ec 14             	sub    $0x14,%esp
+  804ef3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804ef6:	8b 75 14             	mov    0x14(%ebp),%esi
+  804ef9:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804efc:	ff 75 10             	push   0x10(%ebp)
+  804eff:	ff 75 0c             	push   0xc(%ebp)
+  804f02:	e8 06 c3 ff ff       	call   80120d <sys_ipc_recv_pages>
+  804f07:	83 c4 10             	add    $0x10,%esp
+  804f0a:	85 c0                	test   %eax,%eax
+  804f0c:	78 46                	js     804f54 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804f0e:	85 ff                	test   %edi,%edi
+  804f10:	74 0d                	je     804f1f <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804f12:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f17:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804f1d:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804f1f:	85 f6                	test   %esi,%esi
+  804f21:	74 0d                	je     804f30 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804f23:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f28:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804f2e:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804f30:	85 db                	test   %ebx,%ebx
+  804f32:	74 0d                	je     804f41 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804f34:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f39:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804f3f:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804f41:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f46:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804f4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804f4f:	5b                   	pop    %ebx
+  804f50:	5e                   	pop    %esi
+  804f51:	5f                   	pop    %edi
+  804f52:	5d                   	pop    %ebp
+  804f53:	c3                   	ret
+		if (from_env_store) {
+  804f54:	85 ff                	test   %edi,%edi
+  804f56:	74 06                	je     804f5e <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  804f58:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804f5e:	85 f6                	test   %esi,%esi
+  804f60:	74 06                	je     804f68 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804f62:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804f68:	85 db                	test   %ebx,%ebx
+  804f6a:	74 e0                	je     804f4c <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804f6c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804f72:	eb d8                	jmp    804f4c <ipc_recv_pages+0x62>
+
+00804f74 <ipc_recv>:
+{
+  804f74:	55                   	push   %ebp
+  804f75:	89 e5                	mov    %esp,%ebp
+  804f77:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  804f7a:	6a 00                	push   $0x0
+  804f7c:	ff 75 10             	push   0x10(%ebp)
+  804f7f:	6a 01                	push   $0x1
+  804f81:	ff 75 0c             	push   0xc(%ebp)
+  804f84:	ff 75 08             	push   0x8(%ebp)
+  804f87:	e8 5e ff ff ff       	call   804eea <ipc_recv_pages>
+}
+  804f8c:	c9                   	leave
+  804f8d:	c3                   	ret
+
+00804f8e <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  804f8e:	55                   	push   %ebp
+  804f8f:	89 e5                	mov    %esp,%ebp
+  804f91:	56                   	push   %esi
+  804f92:	53                   	push   %ebx
+  804f93:	8b 75 08             	mov    0x8(%ebp),%esi
+  804f96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  804f99:	83 ec 0c             	sub    $0xc,%esp
+  804f9c:	ff 75 0c             	push   0xc(%ebp)
+  804f9f:	e8 9d c3 ff ff       	call   801341 <sys_ipc_try_recv>
+  804fa4:	83 c4 10             	add    $0x10,%esp
+  804fa7:	85 c0                	test   %eax,%eax
+  804fa9:	78 34                	js     804fdf <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804fab:	85 f6                	test   %esi,%esi
+  804fad:	74 0d                	je     804fbc <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  804faf:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fb4:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804fba:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  804fbc:	85 db                	test   %ebx,%ebx
+  804fbe:	74 0d                	je     804fcd <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  804fc0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fc5:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804fcb:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804fcd:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804fd2:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804fd8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804fdb:	5b                   	pop    %ebx
+  804fdc:	5e                   	pop    %esi
+  804fdd:	5d                   	pop    %ebp
+  804fde:	c3                   	ret
+		if (from_env_store) {
+  804fdf:	85 f6                	test   %esi,%esi
+  804fe1:	74 06                	je     804fe9 <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  804fe3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  804fe9:	85 db                	test   %ebx,%ebx
+  804feb:	74 eb                	je     804fd8 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804fed:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804ff3:	eb e3                	jmp    804fd8 <ipc_try_recv+0x4a>
+
+00804ff5 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804ff5:	55                   	push   %ebp
+  804ff6:	89 e5                	mov    %esp,%ebp
+  804ff8:	83 ec 14             	sub    $0x14,%esp
+  804ffb:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804ffe:	85 c0                	test   %eax,%eax
+  805000:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805005:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805008:	ff 75 18             	push   0x18(%ebp)
+  80500b:	ff 75 14             	push   0x14(%ebp)
+  80500e:	50                   	push   %eax
+  80500f:	ff 75 0c             	push   0xc(%ebp)
+  805012:	ff 75 08             	push   0x8(%ebp)
+  805015:	e8 b6 c1 ff ff       	call   8011d0 <sys_ipc_send_pages>
+  80501a:	83 c4 20             	add    $0x20,%esp
+  80501d:	85 c0                	test   %eax,%eax
+  80501f:	78 02                	js     805023 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  805021:	c9                   	leave
+  805022:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  805023:	50                   	push   %eax
+  805024:	68 d4 5f 80 00       	push   $0x805fd4
+  805029:	68 80 00 00 00       	push   $0x80
+  80502e:	68 00 60 80 00       	push   $0x806000
+  805033:	e8 fd b1 ff ff       	call   800235 <_panic>
+
+00805038 <ipc_send>:
+{
+  805038:	55                   	push   %ebp
+  805039:	89 e5                	mov    %esp,%ebp
+  80503b:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  80503e:	ff 75 14             	push   0x14(%ebp)
+  805041:	6a 01                	push   $0x1
+  805043:	ff 75 10             	push   0x10(%ebp)
+  805046:	ff 75 0c             	push   0xc(%ebp)
+  805049:	ff 75 08             	push   0x8(%ebp)
+  80504c:	e8 a4 ff ff ff       	call   804ff5 <ipc_send_pages>
+}
+  805051:	83 c4 20             	add    $0x20,%esp
+  805054:	c9                   	leave
+  805055:	c3                   	ret
+
+00805056 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805056:	55                   	push   %ebp
+  805057:	89 e5                	mov    %esp,%ebp
+  805059:	83 ec 14             	sub    $0x14,%esp
+  80505c:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80505f:	85 c0                	test   %eax,%eax
+  805061:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805066:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805069:	ff 75 18             	push   0x18(%ebp)
+  80506c:	ff 75 14             	push   0x14(%ebp)
+  80506f:	50                   	push   %eax
+  805070:	ff 75 0c             	push   0xc(%ebp)
+  805073:	ff 75 08             	push   0x8(%ebp)
+  805076:	e8 e6 c1 ff ff       	call   801261 <sys_ipc_call>
+  80507b:	83 c4 20             	add    $0x20,%esp
+  80507e:	85 c0                	test   %eax,%eax
+  805080:	78 0b                	js     80508d <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  805082:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805087:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80508d:	c9                   	leave
+  80508e:	c3                   	ret
+
+0080508f <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  80508f:	55                   	push   %ebp
+  805090:	89 e5                	mov    %esp,%ebp
+  805092:	57                   	push   %edi
+  805093:	56                   	push   %esi
+  805094:	53                   	push   %ebx
+  805095:	83 ec 18             	sub    $0x18,%esp
+  805098:	8b 45 10             	mov    0x10(%ebp),%eax
+  80509b:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80509e:	8b 75 20             	mov    0x20(%ebp),%esi
+  8050a1:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8050a4:	85 c0                	test   %eax,%eax
+  8050a6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8050ab:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8050ae:	ff 75 18             	push   0x18(%ebp)
+  8050b1:	ff 75 14             	push   0x14(%ebp)
+  8050b4:	50                   	push   %eax
+  8050b5:	ff 75 0c             	push   0xc(%ebp)
+  8050b8:	ff 75 08             	push   0x8(%ebp)
+  8050bb:	e8 e2 c1 ff ff       	call   8012a2 <sys_ipc_reply_recv>
+  8050c0:	83 c4 20             	add    $0x20,%esp
+  8050c3:	85 c0                	test   %eax,%eax
+  8050c5:	78 46                	js     80510d <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8050c7:	85 ff                	test   %edi,%edi
+  8050c9:	74 0d                	je     8050d8 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8050cb:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050d0:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8050d6:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8050d8:	85 f6                	test   %esi,%esi
+  8050da:	74 0d                	je     8050e9 <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8050dc:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050e1:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8050e7:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8050e9:	85 db                	test   %ebx,%ebx
+  8050eb:	74 0d                	je     8050fa <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8050ed:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050f2:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8050f8:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8050fa:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8050ff:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805105:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805108:	5b                   	pop    %ebx
+  805109:	5e                   	pop    %esi
+  80510a:	5f                   	pop    %edi
+  80510b:	5d                   	pop    %ebp
+  80510c:	c3                   	ret
+		if (from_env_store) {
+  80510d:	85 ff                	test   %edi,%edi
+  80510f:	74 06                	je     805117 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  805111:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  805117:	85 f6                	test   %esi,%esi
+  805119:	74 06                	je     805121 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80511b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805121:	85 db                	test   %ebx,%ebx
+  805123:	74 e0                	je     805105 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  805125:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80512b:	eb d8                	jmp    805105 <ipc_reply_recv+0x76>
+
+0080512d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80512d:	55                   	push   %ebp
+  80512e:	89 e5                	mov    %esp,%ebp
+  805130:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805133:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  805138:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80513b:	c1 e0 06             	shl    $0x6,%eax
+  80513e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805143:	8b 40 50             	mov    0x50(%eax),%eax
+  805146:	39 c8                	cmp    %ecx,%eax
+  805148:	74 12                	je     80515c <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80514a:	83 c2 01             	add    $0x1,%edx
+  80514d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  805153:	75 e3                	jne    805138 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  805155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80515a:	eb 0e                	jmp    80516a <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80515c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80515f:	c1 e0 06             	shl    $0x6,%eax
+  805162:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805167:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80516a:	5d                   	pop    %ebp
+  80516b:	c3                   	ret
+
+0080516c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80516c:	55                   	push   %ebp
+  80516d:	89 e5                	mov    %esp,%ebp
+  80516f:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805172:	89 c2                	mov    %eax,%edx
+  805174:	c1 ea 16             	shr    $0x16,%edx
+  805177:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  80517e:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805183:	f6 c1 01             	test   $0x1,%cl
+  805186:	74 1e                	je     8051a6 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  805188:	c1 e8 0c             	shr    $0xc,%eax
+  80518b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805192:	a8 01                	test   $0x1,%al
+  805194:	74 10                	je     8051a6 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805196:	c1 e8 0c             	shr    $0xc,%eax
+  805199:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80519c:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8051a3:	0f b7 d2             	movzwl %dx,%edx
+}
+  8051a6:	89 d0                	mov    %edx,%eax
+  8051a8:	5d                   	pop    %ebp
+  8051a9:	c3                   	ret
+
+008051aa <udivmod>:
+  8051aa:	55                   	push   %ebp
+  8051ab:	57                   	push   %edi
+  8051ac:	56                   	push   %esi
+  8051ad:	53                   	push   %ebx
+  8051ae:	83 ec 24             	sub    $0x24,%esp
+  8051b1:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8051b5:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8051b9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8051bd:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8051c1:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8051c5:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8051c9:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8051cd:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8051d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051dc:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8051e3:	00 
+  8051e4:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8051eb:	00 
+  8051ec:	89 fb                	mov    %edi,%ebx
+  8051ee:	eb 08                	jmp    8051f8 <udivmod+0x4e>
+  8051f0:	83 e9 01             	sub    $0x1,%ecx
+  8051f3:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8051f6:	74 68                	je     805260 <udivmod+0xb6>
+  8051f8:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8051fc:	01 c0                	add    %eax,%eax
+  8051fe:	89 c6                	mov    %eax,%esi
+  805200:	89 d7                	mov    %edx,%edi
+  805202:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805206:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80520a:	0f ad d0             	shrd   %cl,%edx,%eax
+  80520d:	d3 ea                	shr    %cl,%edx
+  80520f:	f6 c1 20             	test   $0x20,%cl
+  805212:	74 04                	je     805218 <udivmod+0x6e>
+  805214:	89 d0                	mov    %edx,%eax
+  805216:	31 d2                	xor    %edx,%edx
+  805218:	83 e0 01             	and    $0x1,%eax
+  80521b:	89 04 24             	mov    %eax,(%esp)
+  80521e:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805225:	00 
+  805226:	8b 04 24             	mov    (%esp),%eax
+  805229:	8b 54 24 04          	mov    0x4(%esp),%edx
+  80522d:	09 f0                	or     %esi,%eax
+  80522f:	09 fa                	or     %edi,%edx
+  805231:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805235:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805239:	39 f0                	cmp    %esi,%eax
+  80523b:	89 d5                	mov    %edx,%ebp
+  80523d:	19 fd                	sbb    %edi,%ebp
+  80523f:	72 af                	jb     8051f0 <udivmod+0x46>
+  805241:	29 f0                	sub    %esi,%eax
+  805243:	19 fa                	sbb    %edi,%edx
+  805245:	89 cf                	mov    %ecx,%edi
+  805247:	c1 ef 05             	shr    $0x5,%edi
+  80524a:	83 e7 01             	and    $0x1,%edi
+  80524d:	89 fe                	mov    %edi,%esi
+  80524f:	83 f6 01             	xor    $0x1,%esi
+  805252:	d3 e6                	shl    %cl,%esi
+  805254:	d3 e7                	shl    %cl,%edi
+  805256:	09 74 24 18          	or     %esi,0x18(%esp)
+  80525a:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  80525e:	eb 90                	jmp    8051f0 <udivmod+0x46>
+  805260:	85 db                	test   %ebx,%ebx
+  805262:	74 05                	je     805269 <udivmod+0xbf>
+  805264:	89 03                	mov    %eax,(%ebx)
+  805266:	89 53 04             	mov    %edx,0x4(%ebx)
+  805269:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80526d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805271:	83 c4 24             	add    $0x24,%esp
+  805274:	5b                   	pop    %ebx
+  805275:	5e                   	pop    %esi
+  805276:	5f                   	pop    %edi
+  805277:	5d                   	pop    %ebp
+  805278:	c3                   	ret
+
+00805279 <__udivdi3>:
+  805279:	83 ec 08             	sub    $0x8,%esp
+  80527c:	6a 00                	push   $0x0
+  80527e:	ff 74 24 1c          	push   0x1c(%esp)
+  805282:	ff 74 24 1c          	push   0x1c(%esp)
+  805286:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80528a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80528e:	e8 17 ff ff ff       	call   8051aa <udivmod>
+  805293:	83 c4 14             	add    $0x14,%esp
+  805296:	c3                   	ret
+
+00805297 <__umoddi3>:
+  805297:	83 ec 18             	sub    $0x18,%esp
+  80529a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80529e:	50                   	push   %eax
+  80529f:	ff 74 24 2c          	push   0x2c(%esp)
+  8052a3:	ff 74 24 2c          	push   0x2c(%esp)
+  8052a7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8052ab:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8052af:	e8 f6 fe ff ff       	call   8051aa <udivmod>
+  8052b4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8052b8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8052bc:	83 c4 24             	add    $0x24,%esp
+  8052bf:	c3                   	ret
+
+008052c0 <__divdi3>:
+  8052c0:	55                   	push   %ebp
+  8052c1:	57                   	push   %edi
+  8052c2:	56                   	push   %esi
+  8052c3:	53                   	push   %ebx
+  8052c4:	83 ec 10             	sub    $0x10,%esp
+  8052c7:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8052cb:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8052cf:	89 c6                	mov    %eax,%esi
+  8052d1:	89 d7                	mov    %edx,%edi
+  8052d3:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8052d7:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8052db:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8052df:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8052e3:	89 c5                	mov    %eax,%ebp
+  8052e5:	f7 dd                	neg    %ebp
+  8052e7:	89 d6                	mov    %edx,%esi
+  8052e9:	83 d6 00             	adc    $0x0,%esi
+  8052ec:	f7 de                	neg    %esi
+  8052ee:	0f 48 e8             	cmovs  %eax,%ebp
+  8052f1:	0f 49 d6             	cmovns %esi,%edx
+  8052f4:	6a 00                	push   $0x0
+  8052f6:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8052fa:	f7 de                	neg    %esi
+  8052fc:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805300:	83 d0 00             	adc    $0x0,%eax
+  805303:	f7 d8                	neg    %eax
+  805305:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80530a:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  80530f:	50                   	push   %eax
+  805310:	56                   	push   %esi
+  805311:	89 e8                	mov    %ebp,%eax
+  805313:	e8 92 fe ff ff       	call   8051aa <udivmod>
+  805318:	83 c4 10             	add    $0x10,%esp
+  80531b:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805320:	78 08                	js     80532a <__divdi3+0x6a>
+  805322:	83 c4 0c             	add    $0xc,%esp
+  805325:	5b                   	pop    %ebx
+  805326:	5e                   	pop    %esi
+  805327:	5f                   	pop    %edi
+  805328:	5d                   	pop    %ebp
+  805329:	c3                   	ret
+  80532a:	f7 d8                	neg    %eax
+  80532c:	83 d2 00             	adc    $0x0,%edx
+  80532f:	f7 da                	neg    %edx
+  805331:	eb ef                	jmp    805322 <__divdi3+0x62>
+
+00805333 <__moddi3>:
+  805333:	55                   	push   %ebp
+  805334:	57                   	push   %edi
+  805335:	56                   	push   %esi
+  805336:	53                   	push   %ebx
+  805337:	83 ec 18             	sub    $0x18,%esp
+  80533a:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  80533e:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805342:	89 f1                	mov    %esi,%ecx
+  805344:	f7 d9                	neg    %ecx
+  805346:	89 da                	mov    %ebx,%edx
+  805348:	83 d2 00             	adc    $0x0,%edx
+  80534b:	f7 da                	neg    %edx
+  80534d:	0f 48 ce             	cmovs  %esi,%ecx
+  805350:	0f 48 d3             	cmovs  %ebx,%edx
+  805353:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805357:	50                   	push   %eax
+  805358:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80535c:	f7 de                	neg    %esi
+  80535e:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805362:	83 d0 00             	adc    $0x0,%eax
+  805365:	f7 d8                	neg    %eax
+  805367:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  80536c:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805371:	50                   	push   %eax
+  805372:	56                   	push   %esi
+  805373:	89 c8                	mov    %ecx,%eax
+  805375:	e8 30 fe ff ff       	call   8051aa <udivmod>
+  80537a:	83 c4 10             	add    $0x10,%esp
+  80537d:	85 db                	test   %ebx,%ebx
+  80537f:	78 10                	js     805391 <__moddi3+0x5e>
+  805381:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805385:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805389:	83 c4 14             	add    $0x14,%esp
+  80538c:	5b                   	pop    %ebx
+  80538d:	5e                   	pop    %esi
+  80538e:	5f                   	pop    %edi
+  80538f:	5d                   	pop    %ebp
+  805390:	c3                   	ret
+  805391:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805395:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805399:	f7 d8                	neg    %eax
+  80539b:	83 d2 00             	adc    $0x0,%edx
+  80539e:	f7 da                	neg    %edx
+  8053a0:	eb e7                	jmp    805389 <__moddi3+0x56>
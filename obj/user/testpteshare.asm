@@ -0,0 +1,11265 @@
+
+obj/user/testpteshare.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 62 01 00 00       	call   800193 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <childofspawn>:
+	breakpoint();
+}
+
+void
+childofspawn(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	strcpy(VA, msg2);
+  800039:	ff 35 00 70 80 00    	push   0x807000
+  80003f:	68 00 00 00 a0       	push   $0xa0000000
+  800044:	e8 6f 08 00 00       	call   8008b8 <strcpy>
+	exit();
+  800049:	e8 8e 01 00 00       	call   8001dc <exit>
+}
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	c9                   	leave
+  800052:	c3                   	ret
+
+00800053 <umain>:
+{
+  800053:	55                   	push   %ebp
+  800054:	89 e5                	mov    %esp,%ebp
+  800056:	53                   	push   %ebx
+  800057:	83 ec 04             	sub    $0x4,%esp
+	if (argc != 0)
+  80005a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80005e:	0f 85 cf 00 00 00    	jne    800133 <umain+0xe0>
+	if ((r = page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE, 1)) < 0)
+  800064:	6a 01                	push   $0x1
+  800066:	68 07 04 00 00       	push   $0x407
+  80006b:	68 00 00 00 a0       	push   $0xa0000000
+  800070:	6a 00                	push   $0x0
+  800072:	e8 2c 42 00 00       	call   8042a3 <page_alloc>
+  800077:	83 c4 10             	add    $0x10,%esp
+  80007a:	85 c0                	test   %eax,%eax
+  80007c:	0f 88 bb 00 00 00    	js     80013d <umain+0xea>
+	if ((r = fork()) < 0)
+  800082:	e8 0b 14 00 00       	call   801492 <fork>
+  800087:	89 c3                	mov    %eax,%ebx
+  800089:	85 c0                	test   %eax,%eax
+  80008b:	0f 88 be 00 00 00    	js     80014f <umain+0xfc>
+	if (r == 0) {
+  800091:	0f 84 ca 00 00 00    	je     800161 <umain+0x10e>
+	wait(r);
+  800097:	83 ec 0c             	sub    $0xc,%esp
+  80009a:	53                   	push   %ebx
+  80009b:	e8 9c 2d 00 00       	call   802e3c <wait>
+	cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000a0:	83 c4 08             	add    $0x8,%esp
+  8000a3:	ff 35 04 70 80 00    	push   0x807004
+  8000a9:	68 00 00 00 a0       	push   $0xa0000000
+  8000ae:	e8 b6 08 00 00       	call   800969 <strcmp>
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	85 c0                	test   %eax,%eax
+  8000b8:	b8 c6 5a 80 00       	mov    $0x805ac6,%eax
+  8000bd:	ba c0 5a 80 00       	mov    $0x805ac0,%edx
+  8000c2:	0f 44 c2             	cmove  %edx,%eax
+  8000c5:	50                   	push   %eax
+  8000c6:	68 f8 5a 80 00       	push   $0x805af8
+  8000cb:	e8 01 02 00 00       	call   8002d1 <cprintf>
+	if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  8000d0:	6a 00                	push   $0x0
+  8000d2:	68 13 5b 80 00       	push   $0x805b13
+  8000d7:	68 18 5b 80 00       	push   $0x805b18
+  8000dc:	68 17 5b 80 00       	push   $0x805b17
+  8000e1:	e8 f3 27 00 00       	call   8028d9 <spawnl>
+  8000e6:	83 c4 20             	add    $0x20,%esp
+  8000e9:	85 c0                	test   %eax,%eax
+  8000eb:	0f 88 90 00 00 00    	js     800181 <umain+0x12e>
+	wait(r);
+  8000f1:	83 ec 0c             	sub    $0xc,%esp
+  8000f4:	50                   	push   %eax
+  8000f5:	e8 42 2d 00 00       	call   802e3c <wait>
+	cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  8000fa:	83 c4 08             	add    $0x8,%esp
+  8000fd:	ff 35 00 70 80 00    	push   0x807000
+  800103:	68 00 00 00 a0       	push   $0xa0000000
+  800108:	e8 5c 08 00 00       	call   800969 <strcmp>
+  80010d:	83 c4 08             	add    $0x8,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	b8 c6 5a 80 00       	mov    $0x805ac6,%eax
+  800117:	ba c0 5a 80 00       	mov    $0x805ac0,%edx
+  80011c:	0f 44 c2             	cmove  %edx,%eax
+  80011f:	50                   	push   %eax
+  800120:	68 2f 5b 80 00       	push   $0x805b2f
+  800125:	e8 a7 01 00 00       	call   8002d1 <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  80012a:	cc                   	int3
+}
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800131:	c9                   	leave
+  800132:	c3                   	ret
+		childofspawn();
+  800133:	e8 fb fe ff ff       	call   800033 <childofspawn>
+  800138:	e9 27 ff ff ff       	jmp    800064 <umain+0x11>
+		panic("page_alloc: %e", r);
+  80013d:	50                   	push   %eax
+  80013e:	68 cc 5a 80 00       	push   $0x805acc
+  800143:	6a 13                	push   $0x13
+  800145:	68 db 5a 80 00       	push   $0x805adb
+  80014a:	e8 a7 00 00 00       	call   8001f6 <_panic>
+		panic("fork: %e", r);
+  80014f:	50                   	push   %eax
+  800150:	68 ef 5a 80 00       	push   $0x805aef
+  800155:	6a 17                	push   $0x17
+  800157:	68 db 5a 80 00       	push   $0x805adb
+  80015c:	e8 95 00 00 00       	call   8001f6 <_panic>
+		strcpy(VA, msg);
+  800161:	83 ec 08             	sub    $0x8,%esp
+  800164:	ff 35 04 70 80 00    	push   0x807004
+  80016a:	68 00 00 00 a0       	push   $0xa0000000
+  80016f:	e8 44 07 00 00       	call   8008b8 <strcpy>
+		exit();
+  800174:	e8 63 00 00 00       	call   8001dc <exit>
+  800179:	83 c4 10             	add    $0x10,%esp
+  80017c:	e9 16 ff ff ff       	jmp    800097 <umain+0x44>
+		panic("spawn: %e", r);
+  800181:	50                   	push   %eax
+  800182:	68 25 5b 80 00       	push   $0x805b25
+  800187:	6a 21                	push   $0x21
+  800189:	68 db 5a 80 00       	push   $0x805adb
+  80018e:	e8 63 00 00 00       	call   8001f6 <_panic>
+
+00800193 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800193:	55                   	push   %ebp
+  800194:	89 e5                	mov    %esp,%ebp
+  800196:	56                   	push   %esi
+  800197:	53                   	push   %ebx
+  800198:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80019b:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  80019e:	e8 ca 0b 00 00       	call   800d6d <sys_getenvid>
+  8001a3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001a8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8001ab:	c1 e0 06             	shl    $0x6,%eax
+  8001ae:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001b3:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001b8:	85 db                	test   %ebx,%ebx
+  8001ba:	7e 07                	jle    8001c3 <libmain+0x30>
+		binaryname = argv[0];
+  8001bc:	8b 06                	mov    (%esi),%eax
+  8001be:	a3 08 70 80 00       	mov    %eax,0x807008
+
+	// call user main routine
+	umain(argc, argv);
+  8001c3:	83 ec 08             	sub    $0x8,%esp
+  8001c6:	56                   	push   %esi
+  8001c7:	53                   	push   %ebx
+  8001c8:	e8 86 fe ff ff       	call   800053 <umain>
+
+	// exit gracefully
+	exit();
+  8001cd:	e8 0a 00 00 00       	call   8001dc <exit>
+}
+  8001d2:	83 c4 10             	add    $0x10,%esp
+  8001d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001d8:	5b                   	pop    %ebx
+  8001d9:	5e                   	pop    %esi
+  8001da:	5d                   	pop    %ebp
+  8001db:	c3                   	ret
+
+008001dc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001dc:	55                   	push   %ebp
+  8001dd:	89 e5                	mov    %esp,%ebp
+  8001df:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001e2:	e8 de 18 00 00       	call   801ac5 <close_all>
+	sys_env_destroy(0);
+  8001e7:	83 ec 0c             	sub    $0xc,%esp
+  8001ea:	6a 00                	push   $0x0
+  8001ec:	e8 3b 0b 00 00       	call   800d2c <sys_env_destroy>
+}
+  8001f1:	83 c4 10             	add    $0x10,%esp
+  8001f4:	c9                   	leave
+  8001f5:	c3                   	ret
+
+008001f6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001f6:	55                   	push   %ebp
+  8001f7:	89 e5                	mov    %esp,%ebp
+  8001f9:	56                   	push   %esi
+  8001fa:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001fb:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001fe:	8b 35 08 70 80 00    	mov    0x807008,%esi
+  800204:	e8 64 0b 00 00       	call   800d6d <sys_getenvid>
+  800209:	83 ec 0c             	sub    $0xc,%esp
+  80020c:	ff 75 0c             	push   0xc(%ebp)
+  80020f:	ff 75 08             	push   0x8(%ebp)
+  800212:	56                   	push   %esi
+  800213:	50                   	push   %eax
+  800214:	68 74 5b 80 00       	push   $0x805b74
+  800219:	e8 b3 00 00 00       	call   8002d1 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80021e:	83 c4 18             	add    $0x18,%esp
+  800221:	53                   	push   %ebx
+  800222:	ff 75 10             	push   0x10(%ebp)
+  800225:	e8 56 00 00 00       	call   800280 <vcprintf>
+	cprintf("\n");
+  80022a:	c7 04 24 d2 61 80 00 	movl   $0x8061d2,(%esp)
+  800231:	e8 9b 00 00 00       	call   8002d1 <cprintf>
+  800236:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800239:	cc                   	int3
+	while (1)
+  80023a:	eb fd                	jmp    800239 <_panic+0x43>
+
+0080023c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	53                   	push   %ebx
+  800240:	83 ec 04             	sub    $0x4,%esp
+  800243:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800246:	8b 13                	mov    (%ebx),%edx
+  800248:	8d 42 01             	lea    0x1(%edx),%eax
+  80024b:	89 03                	mov    %eax,(%ebx)
+  80024d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800250:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800254:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800259:	74 09                	je     800264 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80025b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80025f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800262:	c9                   	leave
+  800263:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800264:	83 ec 08             	sub    $0x8,%esp
+  800267:	68 ff 00 00 00       	push   $0xff
+  80026c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80026f:	50                   	push   %eax
+  800270:	e8 69 0a 00 00       	call   800cde <sys_cputs>
+		b->idx = 0;
+  800275:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80027b:	83 c4 10             	add    $0x10,%esp
+  80027e:	eb db                	jmp    80025b <putch+0x1f>
+
+00800280 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800289:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800290:	00 00 00 
+	b.cnt = 0;
+  800293:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80029a:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80029d:	ff 75 0c             	push   0xc(%ebp)
+  8002a0:	ff 75 08             	push   0x8(%ebp)
+  8002a3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002a9:	50                   	push   %eax
+  8002aa:	68 3c 02 80 00       	push   $0x80023c
+  8002af:	e8 14 01 00 00       	call   8003c8 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002b4:	83 c4 08             	add    $0x8,%esp
+  8002b7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002bd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002c3:	50                   	push   %eax
+  8002c4:	e8 15 0a 00 00       	call   800cde <sys_cputs>
+
+	return b.cnt;
+}
+  8002c9:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002cf:	c9                   	leave
+  8002d0:	c3                   	ret
+
+008002d1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002d1:	55                   	push   %ebp
+  8002d2:	89 e5                	mov    %esp,%ebp
+  8002d4:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002d7:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002da:	50                   	push   %eax
+  8002db:	ff 75 08             	push   0x8(%ebp)
+  8002de:	e8 9d ff ff ff       	call   800280 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002e3:	c9                   	leave
+  8002e4:	c3                   	ret
+
+008002e5 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002e5:	55                   	push   %ebp
+  8002e6:	89 e5                	mov    %esp,%ebp
+  8002e8:	57                   	push   %edi
+  8002e9:	56                   	push   %esi
+  8002ea:	53                   	push   %ebx
+  8002eb:	83 ec 1c             	sub    $0x1c,%esp
+  8002ee:	89 c7                	mov    %eax,%edi
+  8002f0:	89 d6                	mov    %edx,%esi
+  8002f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002f8:	89 d1                	mov    %edx,%ecx
+  8002fa:	89 c2                	mov    %eax,%edx
+  8002fc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002ff:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800302:	8b 45 10             	mov    0x10(%ebp),%eax
+  800305:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800308:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800312:	39 c2                	cmp    %eax,%edx
+  800314:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800317:	72 3e                	jb     800357 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800319:	83 ec 0c             	sub    $0xc,%esp
+  80031c:	ff 75 18             	push   0x18(%ebp)
+  80031f:	83 eb 01             	sub    $0x1,%ebx
+  800322:	53                   	push   %ebx
+  800323:	50                   	push   %eax
+  800324:	83 ec 08             	sub    $0x8,%esp
+  800327:	ff 75 e4             	push   -0x1c(%ebp)
+  80032a:	ff 75 e0             	push   -0x20(%ebp)
+  80032d:	ff 75 dc             	push   -0x24(%ebp)
+  800330:	ff 75 d8             	push   -0x28(%ebp)
+  800333:	e8 44 56 00 00       	call   80597c <__udivdi3>
+  800338:	83 c4 18             	add    $0x18,%esp
+  80033b:	52                   	push   %edx
+  80033c:	50                   	push   %eax
+  80033d:	89 f2                	mov    %esi,%edx
+  80033f:	89 f8                	mov    %edi,%eax
+  800341:	e8 9f ff ff ff       	call   8002e5 <printnum>
+  800346:	83 c4 20             	add    $0x20,%esp
+  800349:	eb 13                	jmp    80035e <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80034b:	83 ec 08             	sub    $0x8,%esp
+  80034e:	56                   	push   %esi
+  80034f:	ff 75 18             	push   0x18(%ebp)
+  800352:	ff d7                	call   *%edi
+  800354:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800357:	83 eb 01             	sub    $0x1,%ebx
+  80035a:	85 db                	test   %ebx,%ebx
+  80035c:	7f ed                	jg     80034b <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80035e:	83 ec 08             	sub    $0x8,%esp
+  800361:	56                   	push   %esi
+  800362:	83 ec 04             	sub    $0x4,%esp
+  800365:	ff 75 e4             	push   -0x1c(%ebp)
+  800368:	ff 75 e0             	push   -0x20(%ebp)
+  80036b:	ff 75 dc             	push   -0x24(%ebp)
+  80036e:	ff 75 d8             	push   -0x28(%ebp)
+  800371:	e8 24 56 00 00       	call   80599a <__umoddi3>
+  800376:	83 c4 14             	add    $0x14,%esp
+  800379:	0f be 80 97 5b 80 00 	movsbl 0x805b97(%eax),%eax
+  800380:	50                   	push   %eax
+  800381:	ff d7                	call   *%edi
+}
+  800383:	83 c4 10             	add    $0x10,%esp
+  800386:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800389:	5b                   	pop    %ebx
+  80038a:	5e                   	pop    %esi
+  80038b:	5f                   	pop    %edi
+  80038c:	5d                   	pop    %ebp
+  80038d:	c3                   	ret
+
+0080038e <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80038e:	55                   	push   %ebp
+  80038f:	89 e5                	mov    %esp,%ebp
+  800391:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800394:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800398:	8b 10                	mov    (%eax),%edx
+  80039a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80039d:	73 0a                	jae    8003a9 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  80039f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a2:	89 08                	mov    %ecx,(%eax)
+  8003a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a7:	88 02                	mov    %al,(%edx)
+}
+  8003a9:	5d                   	pop    %ebp
+  8003aa:	c3                   	ret
+
+008003ab <printfmt>:
+{
+  8003ab:	55                   	push   %ebp
+  8003ac:	89 e5                	mov    %esp,%ebp
+  8003ae:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003b1:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003b4:	50                   	push   %eax
+  8003b5:	ff 75 10             	push   0x10(%ebp)
+  8003b8:	ff 75 0c             	push   0xc(%ebp)
+  8003bb:	ff 75 08             	push   0x8(%ebp)
+  8003be:	e8 05 00 00 00       	call   8003c8 <vprintfmt>
+}
+  8003c3:	83 c4 10             	add    $0x10,%esp
+  8003c6:	c9                   	leave
+  8003c7:	c3                   	ret
+
+008003c8 <vprintfmt>:
+{
+  8003c8:	55                   	push   %ebp
+  8003c9:	89 e5                	mov    %esp,%ebp
+  8003cb:	57                   	push   %edi
+  8003cc:	56                   	push   %esi
+  8003cd:	53                   	push   %ebx
+  8003ce:	83 ec 2c             	sub    $0x2c,%esp
+  8003d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003d7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003da:	eb 0a                	jmp    8003e6 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003dc:	83 ec 08             	sub    $0x8,%esp
+  8003df:	53                   	push   %ebx
+  8003e0:	50                   	push   %eax
+  8003e1:	ff d6                	call   *%esi
+  8003e3:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003e6:	83 c7 01             	add    $0x1,%edi
+  8003e9:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003ed:	83 f8 25             	cmp    $0x25,%eax
+  8003f0:	74 0c                	je     8003fe <vprintfmt+0x36>
+			if (ch == '\0')
+  8003f2:	85 c0                	test   %eax,%eax
+  8003f4:	75 e6                	jne    8003dc <vprintfmt+0x14>
+}
+  8003f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003f9:	5b                   	pop    %ebx
+  8003fa:	5e                   	pop    %esi
+  8003fb:	5f                   	pop    %edi
+  8003fc:	5d                   	pop    %ebp
+  8003fd:	c3                   	ret
+		padc = ' ';
+  8003fe:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800402:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800409:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800410:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800417:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80041c:	8d 47 01             	lea    0x1(%edi),%eax
+  80041f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800422:	0f b6 17             	movzbl (%edi),%edx
+  800425:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800428:	3c 55                	cmp    $0x55,%al
+  80042a:	0f 87 c5 03 00 00    	ja     8007f5 <vprintfmt+0x42d>
+  800430:	0f b6 c0             	movzbl %al,%eax
+  800433:	ff 24 85 20 5d 80 00 	jmp    *0x805d20(,%eax,4)
+  80043a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80043d:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800441:	eb d9                	jmp    80041c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800443:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800446:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80044a:	eb d0                	jmp    80041c <vprintfmt+0x54>
+  80044c:	0f b6 d2             	movzbl %dl,%edx
+  80044f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800452:	b8 00 00 00 00       	mov    $0x0,%eax
+  800457:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80045a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80045d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800461:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800464:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800467:	83 f9 09             	cmp    $0x9,%ecx
+  80046a:	77 55                	ja     8004c1 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80046c:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  80046f:	eb e9                	jmp    80045a <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800471:	8b 45 14             	mov    0x14(%ebp),%eax
+  800474:	8b 00                	mov    (%eax),%eax
+  800476:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800479:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047c:	8d 40 04             	lea    0x4(%eax),%eax
+  80047f:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800482:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800485:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800489:	79 91                	jns    80041c <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80048b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80048e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800491:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800498:	eb 82                	jmp    80041c <vprintfmt+0x54>
+			if (width < 0)
+  80049a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80049d:	85 d2                	test   %edx,%edx
+  80049f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a4:	0f 49 c2             	cmovns %edx,%eax
+  8004a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004ad:	e9 6a ff ff ff       	jmp    80041c <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004b5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004bc:	e9 5b ff ff ff       	jmp    80041c <vprintfmt+0x54>
+  8004c1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004c4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c7:	eb bc                	jmp    800485 <vprintfmt+0xbd>
+			lflag++;
+  8004c9:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004cf:	e9 48 ff ff ff       	jmp    80041c <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d7:	8d 78 04             	lea    0x4(%eax),%edi
+  8004da:	83 ec 08             	sub    $0x8,%esp
+  8004dd:	53                   	push   %ebx
+  8004de:	ff 30                	push   (%eax)
+  8004e0:	ff d6                	call   *%esi
+			break;
+  8004e2:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004e5:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004e8:	e9 63 02 00 00       	jmp    800750 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8004ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f0:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004f3:	8b 10                	mov    (%eax),%edx
+  8004f5:	89 d0                	mov    %edx,%eax
+  8004f7:	f7 d8                	neg    %eax
+  8004f9:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004fc:	83 f8 12             	cmp    $0x12,%eax
+  8004ff:	7f 23                	jg     800524 <vprintfmt+0x15c>
+  800501:	8b 14 85 80 5e 80 00 	mov    0x805e80(,%eax,4),%edx
+  800508:	85 d2                	test   %edx,%edx
+  80050a:	74 18                	je     800524 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80050c:	52                   	push   %edx
+  80050d:	68 ad 60 80 00       	push   $0x8060ad
+  800512:	53                   	push   %ebx
+  800513:	56                   	push   %esi
+  800514:	e8 92 fe ff ff       	call   8003ab <printfmt>
+  800519:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80051f:	e9 2c 02 00 00       	jmp    800750 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800524:	50                   	push   %eax
+  800525:	68 af 5b 80 00       	push   $0x805baf
+  80052a:	53                   	push   %ebx
+  80052b:	56                   	push   %esi
+  80052c:	e8 7a fe ff ff       	call   8003ab <printfmt>
+  800531:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800534:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800537:	e9 14 02 00 00       	jmp    800750 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80053c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053f:	83 c0 04             	add    $0x4,%eax
+  800542:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800545:	8b 45 14             	mov    0x14(%ebp),%eax
+  800548:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80054a:	85 c9                	test   %ecx,%ecx
+  80054c:	b8 a8 5b 80 00       	mov    $0x805ba8,%eax
+  800551:	0f 45 c1             	cmovne %ecx,%eax
+  800554:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800557:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80055b:	7e 06                	jle    800563 <vprintfmt+0x19b>
+  80055d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800561:	75 0b                	jne    80056e <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800563:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800566:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800569:	89 75 08             	mov    %esi,0x8(%ebp)
+  80056c:	eb 5c                	jmp    8005ca <vprintfmt+0x202>
+  80056e:	83 ec 08             	sub    $0x8,%esp
+  800571:	ff 75 d0             	push   -0x30(%ebp)
+  800574:	ff 75 cc             	push   -0x34(%ebp)
+  800577:	e8 19 03 00 00       	call   800895 <strnlen>
+  80057c:	89 c2                	mov    %eax,%edx
+  80057e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800581:	29 d0                	sub    %edx,%eax
+  800583:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800586:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80058a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800590:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800592:	eb 0e                	jmp    8005a2 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800594:	83 ec 08             	sub    $0x8,%esp
+  800597:	53                   	push   %ebx
+  800598:	57                   	push   %edi
+  800599:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059c:	83 ee 01             	sub    $0x1,%esi
+  80059f:	83 c4 10             	add    $0x10,%esp
+  8005a2:	85 f6                	test   %esi,%esi
+  8005a4:	7f ee                	jg     800594 <vprintfmt+0x1cc>
+  8005a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ac:	85 c0                	test   %eax,%eax
+  8005ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b3:	0f 49 d0             	cmovns %eax,%edx
+  8005b6:	29 d0                	sub    %edx,%eax
+  8005b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005bb:	eb a6                	jmp    800563 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	53                   	push   %ebx
+  8005c1:	52                   	push   %edx
+  8005c2:	ff 55 08             	call   *0x8(%ebp)
+  8005c5:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005c8:	89 f1                	mov    %esi,%ecx
+  8005ca:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005cd:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d1:	0f be d0             	movsbl %al,%edx
+  8005d4:	85 d2                	test   %edx,%edx
+  8005d6:	74 28                	je     800600 <vprintfmt+0x238>
+  8005d8:	85 ff                	test   %edi,%edi
+  8005da:	78 05                	js     8005e1 <vprintfmt+0x219>
+  8005dc:	83 ef 01             	sub    $0x1,%edi
+  8005df:	78 30                	js     800611 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005e1:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e5:	74 d6                	je     8005bd <vprintfmt+0x1f5>
+  8005e7:	0f be c0             	movsbl %al,%eax
+  8005ea:	83 e8 20             	sub    $0x20,%eax
+  8005ed:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f0:	76 cb                	jbe    8005bd <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005f2:	83 ec 08             	sub    $0x8,%esp
+  8005f5:	53                   	push   %ebx
+  8005f6:	6a 3f                	push   $0x3f
+  8005f8:	ff 55 08             	call   *0x8(%ebp)
+  8005fb:	83 c4 10             	add    $0x10,%esp
+  8005fe:	eb c8                	jmp    8005c8 <vprintfmt+0x200>
+  800600:	8b 75 08             	mov    0x8(%ebp),%esi
+  800603:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800606:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800609:	01 d0                	add    %edx,%eax
+  80060b:	29 c8                	sub    %ecx,%eax
+  80060d:	89 c7                	mov    %eax,%edi
+  80060f:	eb 13                	jmp    800624 <vprintfmt+0x25c>
+  800611:	8b 75 08             	mov    0x8(%ebp),%esi
+  800614:	eb ed                	jmp    800603 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	53                   	push   %ebx
+  80061a:	6a 20                	push   $0x20
+  80061c:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80061e:	83 ef 01             	sub    $0x1,%edi
+  800621:	83 c4 10             	add    $0x10,%esp
+  800624:	85 ff                	test   %edi,%edi
+  800626:	7f ee                	jg     800616 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800628:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80062b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062e:	e9 1d 01 00 00       	jmp    800750 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800633:	83 f9 01             	cmp    $0x1,%ecx
+  800636:	7f 1b                	jg     800653 <vprintfmt+0x28b>
+	else if (lflag)
+  800638:	85 c9                	test   %ecx,%ecx
+  80063a:	74 63                	je     80069f <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  80063c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063f:	8b 00                	mov    (%eax),%eax
+  800641:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800644:	99                   	cltd
+  800645:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800648:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064b:	8d 40 04             	lea    0x4(%eax),%eax
+  80064e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800651:	eb 17                	jmp    80066a <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800653:	8b 45 14             	mov    0x14(%ebp),%eax
+  800656:	8b 50 04             	mov    0x4(%eax),%edx
+  800659:	8b 00                	mov    (%eax),%eax
+  80065b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80065e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800661:	8b 45 14             	mov    0x14(%ebp),%eax
+  800664:	8d 40 08             	lea    0x8(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80066a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80066d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800670:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800675:	85 c9                	test   %ecx,%ecx
+  800677:	0f 89 b9 00 00 00    	jns    800736 <vprintfmt+0x36e>
+				putch('-', putdat);
+  80067d:	83 ec 08             	sub    $0x8,%esp
+  800680:	53                   	push   %ebx
+  800681:	6a 2d                	push   $0x2d
+  800683:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800685:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800688:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80068b:	f7 da                	neg    %edx
+  80068d:	83 d1 00             	adc    $0x0,%ecx
+  800690:	f7 d9                	neg    %ecx
+  800692:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800695:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80069a:	e9 97 00 00 00       	jmp    800736 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  80069f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a2:	8b 00                	mov    (%eax),%eax
+  8006a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a7:	99                   	cltd
+  8006a8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006b4:	eb b4                	jmp    80066a <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8006b6:	83 f9 01             	cmp    $0x1,%ecx
+  8006b9:	7f 1b                	jg     8006d6 <vprintfmt+0x30e>
+	else if (lflag)
+  8006bb:	85 c9                	test   %ecx,%ecx
+  8006bd:	74 2c                	je     8006eb <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c2:	8b 10                	mov    (%eax),%edx
+  8006c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006cf:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006d4:	eb 60                	jmp    800736 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d9:	8b 10                	mov    (%eax),%edx
+  8006db:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006de:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006e4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006e9:	eb 4b                	jmp    800736 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ee:	8b 10                	mov    (%eax),%edx
+  8006f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006fb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800700:	eb 34                	jmp    800736 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800702:	83 f9 01             	cmp    $0x1,%ecx
+  800705:	7f 15                	jg     80071c <vprintfmt+0x354>
+	else if (lflag)
+  800707:	85 c9                	test   %ecx,%ecx
+  800709:	74 4d                	je     800758 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  80070b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070e:	8b 00                	mov    (%eax),%eax
+  800710:	99                   	cltd
+  800711:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800714:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800717:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80071a:	eb 11                	jmp    80072d <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 50 04             	mov    0x4(%eax),%edx
+  800722:	8b 00                	mov    (%eax),%eax
+  800724:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800727:	8d 49 08             	lea    0x8(%ecx),%ecx
+  80072a:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  80072d:	89 d1                	mov    %edx,%ecx
+  80072f:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800731:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800736:	83 ec 0c             	sub    $0xc,%esp
+  800739:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80073d:	50                   	push   %eax
+  80073e:	ff 75 e0             	push   -0x20(%ebp)
+  800741:	57                   	push   %edi
+  800742:	51                   	push   %ecx
+  800743:	52                   	push   %edx
+  800744:	89 da                	mov    %ebx,%edx
+  800746:	89 f0                	mov    %esi,%eax
+  800748:	e8 98 fb ff ff       	call   8002e5 <printnum>
+			break;
+  80074d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800750:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800753:	e9 8e fc ff ff       	jmp    8003e6 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800758:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075b:	8b 00                	mov    (%eax),%eax
+  80075d:	99                   	cltd
+  80075e:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800761:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800764:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800767:	eb c4                	jmp    80072d <vprintfmt+0x365>
+			putch('0', putdat);
+  800769:	83 ec 08             	sub    $0x8,%esp
+  80076c:	53                   	push   %ebx
+  80076d:	6a 30                	push   $0x30
+  80076f:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800771:	83 c4 08             	add    $0x8,%esp
+  800774:	53                   	push   %ebx
+  800775:	6a 78                	push   $0x78
+  800777:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8b 10                	mov    (%eax),%edx
+  80077e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800783:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800786:	8d 40 04             	lea    0x4(%eax),%eax
+  800789:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80078c:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800791:	eb a3                	jmp    800736 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800793:	83 f9 01             	cmp    $0x1,%ecx
+  800796:	7f 1b                	jg     8007b3 <vprintfmt+0x3eb>
+	else if (lflag)
+  800798:	85 c9                	test   %ecx,%ecx
+  80079a:	74 2f                	je     8007cb <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  80079c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079f:	8b 10                	mov    (%eax),%edx
+  8007a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ac:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007b1:	eb 83                	jmp    800736 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 10                	mov    (%eax),%edx
+  8007b8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8007be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007c6:	e9 6b ff ff ff       	jmp    800736 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8007cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ce:	8b 10                	mov    (%eax),%edx
+  8007d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007db:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007e0:	e9 51 ff ff ff       	jmp    800736 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8007e5:	83 ec 08             	sub    $0x8,%esp
+  8007e8:	53                   	push   %ebx
+  8007e9:	6a 25                	push   $0x25
+  8007eb:	ff d6                	call   *%esi
+			break;
+  8007ed:	83 c4 10             	add    $0x10,%esp
+  8007f0:	e9 5b ff ff ff       	jmp    800750 <vprintfmt+0x388>
+			putch('%', putdat);
+  8007f5:	83 ec 08             	sub    $0x8,%esp
+  8007f8:	53                   	push   %ebx
+  8007f9:	6a 25                	push   $0x25
+  8007fb:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8007fd:	83 c4 10             	add    $0x10,%esp
+  800800:	89 f8                	mov    %edi,%eax
+  800802:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800806:	74 05                	je     80080d <vprintfmt+0x445>
+  800808:	83 e8 01             	sub    $0x1,%eax
+  80080b:	eb f5                	jmp    800802 <vprintfmt+0x43a>
+  80080d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800810:	e9 3b ff ff ff       	jmp    800750 <vprintfmt+0x388>
+
+00800815 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800815:	55                   	push   %ebp
+  800816:	89 e5                	mov    %esp,%ebp
+  800818:	83 ec 18             	sub    $0x18,%esp
+  80081b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80081e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800821:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800824:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800828:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80082b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800832:	85 c0                	test   %eax,%eax
+  800834:	74 26                	je     80085c <vsnprintf+0x47>
+  800836:	85 d2                	test   %edx,%edx
+  800838:	7e 22                	jle    80085c <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80083a:	ff 75 14             	push   0x14(%ebp)
+  80083d:	ff 75 10             	push   0x10(%ebp)
+  800840:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800843:	50                   	push   %eax
+  800844:	68 8e 03 80 00       	push   $0x80038e
+  800849:	e8 7a fb ff ff       	call   8003c8 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80084e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800851:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800854:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800857:	83 c4 10             	add    $0x10,%esp
+}
+  80085a:	c9                   	leave
+  80085b:	c3                   	ret
+		return -E_INVAL;
+  80085c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800861:	eb f7                	jmp    80085a <vsnprintf+0x45>
+
+00800863 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800863:	55                   	push   %ebp
+  800864:	89 e5                	mov    %esp,%ebp
+  800866:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800869:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80086c:	50                   	push   %eax
+  80086d:	ff 75 10             	push   0x10(%ebp)
+  800870:	ff 75 0c             	push   0xc(%ebp)
+  800873:	ff 75 08             	push   0x8(%ebp)
+  800876:	e8 9a ff ff ff       	call   800815 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80087b:	c9                   	leave
+  80087c:	c3                   	ret
+
+0080087d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80087d:	55                   	push   %ebp
+  80087e:	89 e5                	mov    %esp,%ebp
+  800880:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800883:	b8 00 00 00 00       	mov    $0x0,%eax
+  800888:	eb 03                	jmp    80088d <strlen+0x10>
+		n++;
+  80088a:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80088d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800891:	75 f7                	jne    80088a <strlen+0xd>
+	return n;
+}
+  800893:	5d                   	pop    %ebp
+  800894:	c3                   	ret
+
+00800895 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80089b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80089e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a3:	eb 03                	jmp    8008a8 <strnlen+0x13>
+		n++;
+  8008a5:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a8:	39 d0                	cmp    %edx,%eax
+  8008aa:	74 08                	je     8008b4 <strnlen+0x1f>
+  8008ac:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008b0:	75 f3                	jne    8008a5 <strnlen+0x10>
+  8008b2:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008b4:	89 d0                	mov    %edx,%eax
+  8008b6:	5d                   	pop    %ebp
+  8008b7:	c3                   	ret
+
+008008b8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	53                   	push   %ebx
+  8008bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c7:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008cb:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008ce:	83 c0 01             	add    $0x1,%eax
+  8008d1:	84 d2                	test   %dl,%dl
+  8008d3:	75 f2                	jne    8008c7 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008d5:	89 c8                	mov    %ecx,%eax
+  8008d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008da:	c9                   	leave
+  8008db:	c3                   	ret
+
+008008dc <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008dc:	55                   	push   %ebp
+  8008dd:	89 e5                	mov    %esp,%ebp
+  8008df:	53                   	push   %ebx
+  8008e0:	83 ec 10             	sub    $0x10,%esp
+  8008e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008e6:	53                   	push   %ebx
+  8008e7:	e8 91 ff ff ff       	call   80087d <strlen>
+  8008ec:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008ef:	ff 75 0c             	push   0xc(%ebp)
+  8008f2:	01 d8                	add    %ebx,%eax
+  8008f4:	50                   	push   %eax
+  8008f5:	e8 be ff ff ff       	call   8008b8 <strcpy>
+	return dst;
+}
+  8008fa:	89 d8                	mov    %ebx,%eax
+  8008fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ff:	c9                   	leave
+  800900:	c3                   	ret
+
+00800901 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	56                   	push   %esi
+  800905:	53                   	push   %ebx
+  800906:	8b 75 08             	mov    0x8(%ebp),%esi
+  800909:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  80090c:	89 f3                	mov    %esi,%ebx
+  80090e:	03 5d 10             	add    0x10(%ebp),%ebx
+  800911:	89 f0                	mov    %esi,%eax
+  800913:	eb 0f                	jmp    800924 <strncpy+0x23>
+		*dst++ = *src;
+  800915:	83 c0 01             	add    $0x1,%eax
+  800918:	0f b6 0a             	movzbl (%edx),%ecx
+  80091b:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80091e:	80 f9 01             	cmp    $0x1,%cl
+  800921:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800924:	39 d8                	cmp    %ebx,%eax
+  800926:	75 ed                	jne    800915 <strncpy+0x14>
+	}
+	return ret;
+}
+  800928:	89 f0                	mov    %esi,%eax
+  80092a:	5b                   	pop    %ebx
+  80092b:	5e                   	pop    %esi
+  80092c:	5d                   	pop    %ebp
+  80092d:	c3                   	ret
+
+0080092e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80092e:	55                   	push   %ebp
+  80092f:	89 e5                	mov    %esp,%ebp
+  800931:	56                   	push   %esi
+  800932:	53                   	push   %ebx
+  800933:	8b 75 08             	mov    0x8(%ebp),%esi
+  800936:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800939:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  80093c:	89 f0                	mov    %esi,%eax
+  80093e:	85 d2                	test   %edx,%edx
+  800940:	74 21                	je     800963 <strlcpy+0x35>
+  800942:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800946:	89 f2                	mov    %esi,%edx
+  800948:	eb 09                	jmp    800953 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80094a:	83 c1 01             	add    $0x1,%ecx
+  80094d:	83 c2 01             	add    $0x1,%edx
+  800950:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800953:	39 c2                	cmp    %eax,%edx
+  800955:	74 09                	je     800960 <strlcpy+0x32>
+  800957:	0f b6 19             	movzbl (%ecx),%ebx
+  80095a:	84 db                	test   %bl,%bl
+  80095c:	75 ec                	jne    80094a <strlcpy+0x1c>
+  80095e:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800960:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800963:	29 f0                	sub    %esi,%eax
+}
+  800965:	5b                   	pop    %ebx
+  800966:	5e                   	pop    %esi
+  800967:	5d                   	pop    %ebp
+  800968:	c3                   	ret
+
+00800969 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800969:	55                   	push   %ebp
+  80096a:	89 e5                	mov    %esp,%ebp
+  80096c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80096f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800972:	eb 06                	jmp    80097a <strcmp+0x11>
+		p++, q++;
+  800974:	83 c1 01             	add    $0x1,%ecx
+  800977:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80097a:	0f b6 01             	movzbl (%ecx),%eax
+  80097d:	84 c0                	test   %al,%al
+  80097f:	74 04                	je     800985 <strcmp+0x1c>
+  800981:	3a 02                	cmp    (%edx),%al
+  800983:	74 ef                	je     800974 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800985:	0f b6 c0             	movzbl %al,%eax
+  800988:	0f b6 12             	movzbl (%edx),%edx
+  80098b:	29 d0                	sub    %edx,%eax
+}
+  80098d:	5d                   	pop    %ebp
+  80098e:	c3                   	ret
+
+0080098f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	53                   	push   %ebx
+  800993:	8b 45 08             	mov    0x8(%ebp),%eax
+  800996:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800999:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80099c:	eb 09                	jmp    8009a7 <strncmp+0x18>
+		n--, p++, q++;
+  80099e:	83 ea 01             	sub    $0x1,%edx
+  8009a1:	83 c0 01             	add    $0x1,%eax
+  8009a4:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009a7:	85 d2                	test   %edx,%edx
+  8009a9:	74 18                	je     8009c3 <strncmp+0x34>
+  8009ab:	0f b6 18             	movzbl (%eax),%ebx
+  8009ae:	84 db                	test   %bl,%bl
+  8009b0:	74 04                	je     8009b6 <strncmp+0x27>
+  8009b2:	3a 19                	cmp    (%ecx),%bl
+  8009b4:	74 e8                	je     80099e <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009b6:	0f b6 00             	movzbl (%eax),%eax
+  8009b9:	0f b6 11             	movzbl (%ecx),%edx
+  8009bc:	29 d0                	sub    %edx,%eax
+}
+  8009be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c1:	c9                   	leave
+  8009c2:	c3                   	ret
+		return 0;
+  8009c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c8:	eb f4                	jmp    8009be <strncmp+0x2f>
+
+008009ca <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009ca:	55                   	push   %ebp
+  8009cb:	89 e5                	mov    %esp,%ebp
+  8009cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009d4:	eb 03                	jmp    8009d9 <strchr+0xf>
+  8009d6:	83 c0 01             	add    $0x1,%eax
+  8009d9:	0f b6 10             	movzbl (%eax),%edx
+  8009dc:	84 d2                	test   %dl,%dl
+  8009de:	74 06                	je     8009e6 <strchr+0x1c>
+		if (*s == c)
+  8009e0:	38 ca                	cmp    %cl,%dl
+  8009e2:	75 f2                	jne    8009d6 <strchr+0xc>
+  8009e4:	eb 05                	jmp    8009eb <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009eb:	5d                   	pop    %ebp
+  8009ec:	c3                   	ret
+
+008009ed <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009ed:	55                   	push   %ebp
+  8009ee:	89 e5                	mov    %esp,%ebp
+  8009f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009f7:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8009fa:	38 ca                	cmp    %cl,%dl
+  8009fc:	74 09                	je     800a07 <strfind+0x1a>
+  8009fe:	84 d2                	test   %dl,%dl
+  800a00:	74 05                	je     800a07 <strfind+0x1a>
+	for (; *s; s++)
+  800a02:	83 c0 01             	add    $0x1,%eax
+  800a05:	eb f0                	jmp    8009f7 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a07:	5d                   	pop    %ebp
+  800a08:	c3                   	ret
+
+00800a09 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	57                   	push   %edi
+  800a0d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a10:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a13:	85 c9                	test   %ecx,%ecx
+  800a15:	74 20                	je     800a37 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a17:	89 f8                	mov    %edi,%eax
+  800a19:	09 c8                	or     %ecx,%eax
+  800a1b:	a8 03                	test   $0x3,%al
+  800a1d:	75 12                	jne    800a31 <memset+0x28>
+		c &= 0xFF;
+  800a1f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a23:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a29:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a2c:	fc                   	cld
+  800a2d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a2f:	eb 06                	jmp    800a37 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a34:	fc                   	cld
+  800a35:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a37:	89 f8                	mov    %edi,%eax
+  800a39:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a3c:	c9                   	leave
+  800a3d:	c3                   	ret
+
+00800a3e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a3e:	55                   	push   %ebp
+  800a3f:	89 e5                	mov    %esp,%ebp
+  800a41:	57                   	push   %edi
+  800a42:	56                   	push   %esi
+  800a43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a46:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a49:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a4c:	39 c6                	cmp    %eax,%esi
+  800a4e:	73 32                	jae    800a82 <memmove+0x44>
+  800a50:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a53:	39 d0                	cmp    %edx,%eax
+  800a55:	73 2b                	jae    800a82 <memmove+0x44>
+		s += n;
+		d += n;
+  800a57:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a5a:	89 d6                	mov    %edx,%esi
+  800a5c:	09 fe                	or     %edi,%esi
+  800a5e:	09 ce                	or     %ecx,%esi
+  800a60:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a66:	75 0e                	jne    800a76 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a68:	83 ef 04             	sub    $0x4,%edi
+  800a6b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a6e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a71:	fd                   	std
+  800a72:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a74:	eb 09                	jmp    800a7f <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a76:	83 ef 01             	sub    $0x1,%edi
+  800a79:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a7c:	fd                   	std
+  800a7d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a7f:	fc                   	cld
+  800a80:	eb 1a                	jmp    800a9c <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a82:	89 f2                	mov    %esi,%edx
+  800a84:	09 c2                	or     %eax,%edx
+  800a86:	09 ca                	or     %ecx,%edx
+  800a88:	f6 c2 03             	test   $0x3,%dl
+  800a8b:	75 0a                	jne    800a97 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a8d:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a90:	89 c7                	mov    %eax,%edi
+  800a92:	fc                   	cld
+  800a93:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a95:	eb 05                	jmp    800a9c <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a97:	89 c7                	mov    %eax,%edi
+  800a99:	fc                   	cld
+  800a9a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a9c:	5e                   	pop    %esi
+  800a9d:	5f                   	pop    %edi
+  800a9e:	5d                   	pop    %ebp
+  800a9f:	c3                   	ret
+
+00800aa0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aa6:	ff 75 10             	push   0x10(%ebp)
+  800aa9:	ff 75 0c             	push   0xc(%ebp)
+  800aac:	ff 75 08             	push   0x8(%ebp)
+  800aaf:	e8 8a ff ff ff       	call   800a3e <memmove>
+}
+  800ab4:	c9                   	leave
+  800ab5:	c3                   	ret
+
+00800ab6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ab6:	55                   	push   %ebp
+  800ab7:	89 e5                	mov    %esp,%ebp
+  800ab9:	56                   	push   %esi
+  800aba:	53                   	push   %ebx
+  800abb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800abe:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ac1:	89 c6                	mov    %eax,%esi
+  800ac3:	03 75 10             	add    0x10(%ebp),%esi
+  800ac6:	eb 06                	jmp    800ace <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ac8:	83 c0 01             	add    $0x1,%eax
+  800acb:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ace:	39 f0                	cmp    %esi,%eax
+  800ad0:	74 14                	je     800ae6 <memcmp+0x30>
+		if (*s1 != *s2)
+  800ad2:	0f b6 08             	movzbl (%eax),%ecx
+  800ad5:	0f b6 1a             	movzbl (%edx),%ebx
+  800ad8:	38 d9                	cmp    %bl,%cl
+  800ada:	74 ec                	je     800ac8 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800adc:	0f b6 c1             	movzbl %cl,%eax
+  800adf:	0f b6 db             	movzbl %bl,%ebx
+  800ae2:	29 d8                	sub    %ebx,%eax
+  800ae4:	eb 05                	jmp    800aeb <memcmp+0x35>
+	}
+
+	return 0;
+  800ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aeb:	5b                   	pop    %ebx
+  800aec:	5e                   	pop    %esi
+  800aed:	5d                   	pop    %ebp
+  800aee:	c3                   	ret
+
+00800aef <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800aef:	55                   	push   %ebp
+  800af0:	89 e5                	mov    %esp,%ebp
+  800af2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800af8:	89 c2                	mov    %eax,%edx
+  800afa:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800afd:	eb 03                	jmp    800b02 <memfind+0x13>
+  800aff:	83 c0 01             	add    $0x1,%eax
+  800b02:	39 d0                	cmp    %edx,%eax
+  800b04:	73 04                	jae    800b0a <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b06:	38 08                	cmp    %cl,(%eax)
+  800b08:	75 f5                	jne    800aff <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b0a:	5d                   	pop    %ebp
+  800b0b:	c3                   	ret
+
+00800b0c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b0c:	55                   	push   %ebp
+  800b0d:	89 e5                	mov    %esp,%ebp
+  800b0f:	57                   	push   %edi
+  800b10:	56                   	push   %esi
+  800b11:	53                   	push   %ebx
+  800b12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b15:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b18:	eb 03                	jmp    800b1d <strtol+0x11>
+		s++;
+  800b1a:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b1d:	0f b6 02             	movzbl (%edx),%eax
+  800b20:	3c 20                	cmp    $0x20,%al
+  800b22:	74 f6                	je     800b1a <strtol+0xe>
+  800b24:	3c 09                	cmp    $0x9,%al
+  800b26:	74 f2                	je     800b1a <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b28:	3c 2b                	cmp    $0x2b,%al
+  800b2a:	74 2a                	je     800b56 <strtol+0x4a>
+	int neg = 0;
+  800b2c:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b31:	3c 2d                	cmp    $0x2d,%al
+  800b33:	74 2b                	je     800b60 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b35:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b3b:	75 0f                	jne    800b4c <strtol+0x40>
+  800b3d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b40:	74 28                	je     800b6a <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b42:	85 db                	test   %ebx,%ebx
+  800b44:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b49:	0f 44 d8             	cmove  %eax,%ebx
+  800b4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b51:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b54:	eb 46                	jmp    800b9c <strtol+0x90>
+		s++;
+  800b56:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b59:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b5e:	eb d5                	jmp    800b35 <strtol+0x29>
+		s++, neg = 1;
+  800b60:	83 c2 01             	add    $0x1,%edx
+  800b63:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b68:	eb cb                	jmp    800b35 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b6a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b6e:	74 0e                	je     800b7e <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b70:	85 db                	test   %ebx,%ebx
+  800b72:	75 d8                	jne    800b4c <strtol+0x40>
+		s++, base = 8;
+  800b74:	83 c2 01             	add    $0x1,%edx
+  800b77:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b7c:	eb ce                	jmp    800b4c <strtol+0x40>
+		s += 2, base = 16;
+  800b7e:	83 c2 02             	add    $0x2,%edx
+  800b81:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b86:	eb c4                	jmp    800b4c <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b88:	0f be c0             	movsbl %al,%eax
+  800b8b:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b8e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b91:	7d 3a                	jge    800bcd <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b93:	83 c2 01             	add    $0x1,%edx
+  800b96:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b9a:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b9c:	0f b6 02             	movzbl (%edx),%eax
+  800b9f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ba2:	89 f3                	mov    %esi,%ebx
+  800ba4:	80 fb 09             	cmp    $0x9,%bl
+  800ba7:	76 df                	jbe    800b88 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ba9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bac:	89 f3                	mov    %esi,%ebx
+  800bae:	80 fb 19             	cmp    $0x19,%bl
+  800bb1:	77 08                	ja     800bbb <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bb3:	0f be c0             	movsbl %al,%eax
+  800bb6:	83 e8 57             	sub    $0x57,%eax
+  800bb9:	eb d3                	jmp    800b8e <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bbb:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bbe:	89 f3                	mov    %esi,%ebx
+  800bc0:	80 fb 19             	cmp    $0x19,%bl
+  800bc3:	77 08                	ja     800bcd <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bc5:	0f be c0             	movsbl %al,%eax
+  800bc8:	83 e8 37             	sub    $0x37,%eax
+  800bcb:	eb c1                	jmp    800b8e <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bcd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bd1:	74 05                	je     800bd8 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bd3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bd6:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800bd8:	89 c8                	mov    %ecx,%eax
+  800bda:	f7 d8                	neg    %eax
+  800bdc:	85 ff                	test   %edi,%edi
+  800bde:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800be1:	89 c8                	mov    %ecx,%eax
+  800be3:	5b                   	pop    %ebx
+  800be4:	5e                   	pop    %esi
+  800be5:	5f                   	pop    %edi
+  800be6:	5d                   	pop    %ebp
+  800be7:	c3                   	ret
+
+00800be8 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	57                   	push   %edi
+  800bec:	56                   	push   %esi
+  800bed:	53                   	push   %ebx
+  800bee:	83 ec 0c             	sub    $0xc,%esp
+  800bf1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800bf4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bf7:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800bfa:	85 ff                	test   %edi,%edi
+  800bfc:	74 16                	je     800c14 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800bfe:	83 ec 04             	sub    $0x4,%esp
+  800c01:	56                   	push   %esi
+  800c02:	6a 00                	push   $0x0
+  800c04:	53                   	push   %ebx
+  800c05:	e8 02 ff ff ff       	call   800b0c <strtol>
+  800c0a:	89 07                	mov    %eax,(%edi)
+  800c0c:	83 c4 10             	add    $0x10,%esp
+  800c0f:	eb 03                	jmp    800c14 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c11:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c14:	0f b6 03             	movzbl (%ebx),%eax
+  800c17:	3c 20                	cmp    $0x20,%al
+  800c19:	74 f6                	je     800c11 <strisl+0x29>
+  800c1b:	3c 09                	cmp    $0x9,%al
+  800c1d:	74 f2                	je     800c11 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c1f:	3c 2b                	cmp    $0x2b,%al
+  800c21:	74 23                	je     800c46 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c23:	3c 2d                	cmp    $0x2d,%al
+  800c25:	0f 94 c0             	sete   %al
+  800c28:	0f b6 c0             	movzbl %al,%eax
+  800c2b:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c2d:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c33:	75 41                	jne    800c76 <strisl+0x8e>
+  800c35:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c38:	74 11                	je     800c4b <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c3a:	85 f6                	test   %esi,%esi
+  800c3c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c41:	0f 44 f0             	cmove  %eax,%esi
+  800c44:	eb 30                	jmp    800c76 <strisl+0x8e>
+		s++;
+  800c46:	83 c3 01             	add    $0x1,%ebx
+  800c49:	eb e2                	jmp    800c2d <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c4b:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c4f:	74 0e                	je     800c5f <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c51:	85 f6                	test   %esi,%esi
+  800c53:	75 21                	jne    800c76 <strisl+0x8e>
+		s++, base = 8;
+  800c55:	83 c3 01             	add    $0x1,%ebx
+  800c58:	be 08 00 00 00       	mov    $0x8,%esi
+  800c5d:	eb 17                	jmp    800c76 <strisl+0x8e>
+		s += 2, base = 16;
+  800c5f:	83 c3 02             	add    $0x2,%ebx
+  800c62:	be 10 00 00 00       	mov    $0x10,%esi
+  800c67:	eb 0d                	jmp    800c76 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c69:	0f be c0             	movsbl %al,%eax
+  800c6c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800c6f:	39 f0                	cmp    %esi,%eax
+  800c71:	7d 38                	jge    800cab <strisl+0xc3>
+			return 0;
+		s++;
+  800c73:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800c76:	0f b6 03             	movzbl (%ebx),%eax
+  800c79:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800c7c:	80 fa 09             	cmp    $0x9,%dl
+  800c7f:	76 e8                	jbe    800c69 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800c81:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800c84:	80 fa 19             	cmp    $0x19,%dl
+  800c87:	77 08                	ja     800c91 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800c89:	0f be c0             	movsbl %al,%eax
+  800c8c:	83 e8 57             	sub    $0x57,%eax
+  800c8f:	eb de                	jmp    800c6f <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c91:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800c94:	80 fa 19             	cmp    $0x19,%dl
+  800c97:	77 08                	ja     800ca1 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800c99:	0f be c0             	movsbl %al,%eax
+  800c9c:	83 e8 37             	sub    $0x37,%eax
+  800c9f:	eb ce                	jmp    800c6f <strisl+0x87>
+		else if (!*s)
+  800ca1:	84 c0                	test   %al,%al
+  800ca3:	0f 94 c0             	sete   %al
+  800ca6:	0f b6 c0             	movzbl %al,%eax
+  800ca9:	eb 05                	jmp    800cb0 <strisl+0xc8>
+			return 0;
+  800cab:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800cb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb3:	5b                   	pop    %ebx
+  800cb4:	5e                   	pop    %esi
+  800cb5:	5f                   	pop    %edi
+  800cb6:	5d                   	pop    %ebp
+  800cb7:	c3                   	ret
+
+00800cb8 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	83 ec 10             	sub    $0x10,%esp
+  800cbe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cc1:	89 c8                	mov    %ecx,%eax
+  800cc3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800cc8:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800ccb:	eb 0b                	jmp    800cd8 <touch_mem+0x20>
+		c = *(char *)page;
+  800ccd:	0f b6 10             	movzbl (%eax),%edx
+  800cd0:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cd3:	05 00 10 00 00       	add    $0x1000,%eax
+  800cd8:	39 c8                	cmp    %ecx,%eax
+  800cda:	72 f1                	jb     800ccd <touch_mem+0x15>
+}
+  800cdc:	c9                   	leave
+  800cdd:	c3                   	ret
+
+00800cde <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800cde:	55                   	push   %ebp
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	57                   	push   %edi
+  800ce2:	56                   	push   %esi
+  800ce3:	53                   	push   %ebx
+	touch_mem(s, len);
+  800ce4:	ff 75 0c             	push   0xc(%ebp)
+  800ce7:	ff 75 08             	push   0x8(%ebp)
+  800cea:	e8 c9 ff ff ff       	call   800cb8 <touch_mem>
+	asm volatile("int %1\n"
+  800cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfa:	89 c3                	mov    %eax,%ebx
+  800cfc:	89 c7                	mov    %eax,%edi
+  800cfe:	89 c6                	mov    %eax,%esi
+  800d00:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d02:	83 c4 08             	add    $0x8,%esp
+  800d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d13:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d18:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d1d:	89 d1                	mov    %edx,%ecx
+  800d1f:	89 d3                	mov    %edx,%ebx
+  800d21:	89 d7                	mov    %edx,%edi
+  800d23:	89 d6                	mov    %edx,%esi
+  800d25:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d27:	5b                   	pop    %ebx
+  800d28:	5e                   	pop    %esi
+  800d29:	5f                   	pop    %edi
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	c3                   	ret
+
+00800d2c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d2c:	55                   	push   %ebp
+  800d2d:	89 e5                	mov    %esp,%ebp
+  800d2f:	57                   	push   %edi
+  800d30:	56                   	push   %esi
+  800d31:	53                   	push   %ebx
+  800d32:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d42:	89 cb                	mov    %ecx,%ebx
+  800d44:	89 cf                	mov    %ecx,%edi
+  800d46:	89 ce                	mov    %ecx,%esi
+  800d48:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d4a:	85 c0                	test   %eax,%eax
+  800d4c:	7f 08                	jg     800d56 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d51:	5b                   	pop    %ebx
+  800d52:	5e                   	pop    %esi
+  800d53:	5f                   	pop    %edi
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d56:	83 ec 0c             	sub    $0xc,%esp
+  800d59:	50                   	push   %eax
+  800d5a:	6a 03                	push   $0x3
+  800d5c:	68 eb 5e 80 00       	push   $0x805eeb
+  800d61:	6a 23                	push   $0x23
+  800d63:	68 08 5f 80 00       	push   $0x805f08
+  800d68:	e8 89 f4 ff ff       	call   8001f6 <_panic>
+
+00800d6d <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d6d:	55                   	push   %ebp
+  800d6e:	89 e5                	mov    %esp,%ebp
+  800d70:	57                   	push   %edi
+  800d71:	56                   	push   %esi
+  800d72:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d78:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d7d:	89 d1                	mov    %edx,%ecx
+  800d7f:	89 d3                	mov    %edx,%ebx
+  800d81:	89 d7                	mov    %edx,%edi
+  800d83:	89 d6                	mov    %edx,%esi
+  800d85:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d87:	5b                   	pop    %ebx
+  800d88:	5e                   	pop    %esi
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+
+00800d8c <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	57                   	push   %edi
+  800d90:	56                   	push   %esi
+  800d91:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d97:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d9c:	89 d1                	mov    %edx,%ecx
+  800d9e:	89 d3                	mov    %edx,%ebx
+  800da0:	89 d7                	mov    %edx,%edi
+  800da2:	89 d6                	mov    %edx,%esi
+  800da4:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800da6:	5b                   	pop    %ebx
+  800da7:	5e                   	pop    %esi
+  800da8:	5f                   	pop    %edi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+
+00800dab <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	57                   	push   %edi
+  800daf:	56                   	push   %esi
+  800db0:	53                   	push   %ebx
+  800db1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800db4:	be 00 00 00 00       	mov    $0x0,%esi
+  800db9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dbf:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc7:	89 f7                	mov    %esi,%edi
+  800dc9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dcb:	85 c0                	test   %eax,%eax
+  800dcd:	7f 08                	jg     800dd7 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd2:	5b                   	pop    %ebx
+  800dd3:	5e                   	pop    %esi
+  800dd4:	5f                   	pop    %edi
+  800dd5:	5d                   	pop    %ebp
+  800dd6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd7:	83 ec 0c             	sub    $0xc,%esp
+  800dda:	50                   	push   %eax
+  800ddb:	6a 04                	push   $0x4
+  800ddd:	68 eb 5e 80 00       	push   $0x805eeb
+  800de2:	6a 23                	push   $0x23
+  800de4:	68 08 5f 80 00       	push   $0x805f08
+  800de9:	e8 08 f4 ff ff       	call   8001f6 <_panic>
+
+00800dee <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800dee:	55                   	push   %ebp
+  800def:	89 e5                	mov    %esp,%ebp
+  800df1:	57                   	push   %edi
+  800df2:	56                   	push   %esi
+  800df3:	53                   	push   %ebx
+  800df4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfd:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e05:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e08:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e0b:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e0d:	85 c0                	test   %eax,%eax
+  800e0f:	7f 08                	jg     800e19 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e14:	5b                   	pop    %ebx
+  800e15:	5e                   	pop    %esi
+  800e16:	5f                   	pop    %edi
+  800e17:	5d                   	pop    %ebp
+  800e18:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+  800e1c:	50                   	push   %eax
+  800e1d:	6a 05                	push   $0x5
+  800e1f:	68 eb 5e 80 00       	push   $0x805eeb
+  800e24:	6a 23                	push   $0x23
+  800e26:	68 08 5f 80 00       	push   $0x805f08
+  800e2b:	e8 c6 f3 ff ff       	call   8001f6 <_panic>
+
+00800e30 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	57                   	push   %edi
+  800e34:	56                   	push   %esi
+  800e35:	53                   	push   %ebx
+  800e36:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e44:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e49:	89 df                	mov    %ebx,%edi
+  800e4b:	89 de                	mov    %ebx,%esi
+  800e4d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e4f:	85 c0                	test   %eax,%eax
+  800e51:	7f 08                	jg     800e5b <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e56:	5b                   	pop    %ebx
+  800e57:	5e                   	pop    %esi
+  800e58:	5f                   	pop    %edi
+  800e59:	5d                   	pop    %ebp
+  800e5a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5b:	83 ec 0c             	sub    $0xc,%esp
+  800e5e:	50                   	push   %eax
+  800e5f:	6a 06                	push   $0x6
+  800e61:	68 eb 5e 80 00       	push   $0x805eeb
+  800e66:	6a 23                	push   $0x23
+  800e68:	68 08 5f 80 00       	push   $0x805f08
+  800e6d:	e8 84 f3 ff ff       	call   8001f6 <_panic>
+
+00800e72 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800e72:	55                   	push   %ebp
+  800e73:	89 e5                	mov    %esp,%ebp
+  800e75:	57                   	push   %edi
+  800e76:	56                   	push   %esi
+  800e77:	53                   	push   %ebx
+  800e78:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e86:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e8b:	89 df                	mov    %ebx,%edi
+  800e8d:	89 de                	mov    %ebx,%esi
+  800e8f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e91:	85 c0                	test   %eax,%eax
+  800e93:	7f 08                	jg     800e9d <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e98:	5b                   	pop    %ebx
+  800e99:	5e                   	pop    %esi
+  800e9a:	5f                   	pop    %edi
+  800e9b:	5d                   	pop    %ebp
+  800e9c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+  800ea0:	50                   	push   %eax
+  800ea1:	6a 18                	push   $0x18
+  800ea3:	68 eb 5e 80 00       	push   $0x805eeb
+  800ea8:	6a 23                	push   $0x23
+  800eaa:	68 08 5f 80 00       	push   $0x805f08
+  800eaf:	e8 42 f3 ff ff       	call   8001f6 <_panic>
+
+00800eb4 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800eb4:	55                   	push   %ebp
+  800eb5:	89 e5                	mov    %esp,%ebp
+  800eb7:	57                   	push   %edi
+  800eb8:	56                   	push   %esi
+  800eb9:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800eba:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 19 00 00 00       	mov    $0x19,%eax
+  800eca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecd:	89 f7                	mov    %esi,%edi
+  800ecf:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800ed1:	5b                   	pop    %ebx
+  800ed2:	5e                   	pop    %esi
+  800ed3:	5f                   	pop    %edi
+  800ed4:	5d                   	pop    %ebp
+  800ed5:	c3                   	ret
+
+00800ed6 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	57                   	push   %edi
+  800eda:	56                   	push   %esi
+  800edb:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ee7:	be 00 00 00 00       	mov    $0x0,%esi
+  800eec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eef:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef2:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800ef4:	5b                   	pop    %ebx
+  800ef5:	5e                   	pop    %esi
+  800ef6:	5f                   	pop    %edi
+  800ef7:	5d                   	pop    %ebp
+  800ef8:	c3                   	ret
+
+00800ef9 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800ef9:	55                   	push   %ebp
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	57                   	push   %edi
+  800efd:	56                   	push   %esi
+  800efe:	53                   	push   %ebx
+  800eff:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f02:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f05:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f0b:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f1f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f21:	85 c0                	test   %eax,%eax
+  800f23:	7f 08                	jg     800f2d <sys_page_map_range+0x34>
+}
+  800f25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f28:	5b                   	pop    %ebx
+  800f29:	5e                   	pop    %esi
+  800f2a:	5f                   	pop    %edi
+  800f2b:	5d                   	pop    %ebp
+  800f2c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f2d:	83 ec 0c             	sub    $0xc,%esp
+  800f30:	50                   	push   %eax
+  800f31:	6a 10                	push   $0x10
+  800f33:	68 eb 5e 80 00       	push   $0x805eeb
+  800f38:	6a 23                	push   $0x23
+  800f3a:	68 08 5f 80 00       	push   $0x805f08
+  800f3f:	e8 b2 f2 ff ff       	call   8001f6 <_panic>
+
+00800f44 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f44:	55                   	push   %ebp
+  800f45:	89 e5                	mov    %esp,%ebp
+  800f47:	57                   	push   %edi
+  800f48:	56                   	push   %esi
+  800f49:	53                   	push   %ebx
+  800f4a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f4d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f52:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f58:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f60:	89 f7                	mov    %esi,%edi
+  800f62:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f64:	85 c0                	test   %eax,%eax
+  800f66:	7f 08                	jg     800f70 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f6b:	5b                   	pop    %ebx
+  800f6c:	5e                   	pop    %esi
+  800f6d:	5f                   	pop    %edi
+  800f6e:	5d                   	pop    %ebp
+  800f6f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f70:	83 ec 0c             	sub    $0xc,%esp
+  800f73:	50                   	push   %eax
+  800f74:	6a 11                	push   $0x11
+  800f76:	68 eb 5e 80 00       	push   $0x805eeb
+  800f7b:	6a 23                	push   $0x23
+  800f7d:	68 08 5f 80 00       	push   $0x805f08
+  800f82:	e8 6f f2 ff ff       	call   8001f6 <_panic>
+
+00800f87 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800f87:	55                   	push   %ebp
+  800f88:	89 e5                	mov    %esp,%ebp
+  800f8a:	57                   	push   %edi
+  800f8b:	56                   	push   %esi
+  800f8c:	53                   	push   %ebx
+  800f8d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f90:	be 00 00 00 00       	mov    $0x0,%esi
+  800f95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fa0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa3:	89 f7                	mov    %esi,%edi
+  800fa5:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fa7:	85 c0                	test   %eax,%eax
+  800fa9:	7f 08                	jg     800fb3 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fae:	5b                   	pop    %ebx
+  800faf:	5e                   	pop    %esi
+  800fb0:	5f                   	pop    %edi
+  800fb1:	5d                   	pop    %ebp
+  800fb2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fb3:	83 ec 0c             	sub    $0xc,%esp
+  800fb6:	50                   	push   %eax
+  800fb7:	6a 1b                	push   $0x1b
+  800fb9:	68 eb 5e 80 00       	push   $0x805eeb
+  800fbe:	6a 23                	push   $0x23
+  800fc0:	68 08 5f 80 00       	push   $0x805f08
+  800fc5:	e8 2c f2 ff ff       	call   8001f6 <_panic>
+
+00800fca <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800fca:	55                   	push   %ebp
+  800fcb:	89 e5                	mov    %esp,%ebp
+  800fcd:	57                   	push   %edi
+  800fce:	56                   	push   %esi
+  800fcf:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd5:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fda:	89 d1                	mov    %edx,%ecx
+  800fdc:	89 d3                	mov    %edx,%ebx
+  800fde:	89 d7                	mov    %edx,%edi
+  800fe0:	89 d6                	mov    %edx,%esi
+  800fe2:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800fe4:	5b                   	pop    %ebx
+  800fe5:	5e                   	pop    %esi
+  800fe6:	5f                   	pop    %edi
+  800fe7:	5d                   	pop    %ebp
+  800fe8:	c3                   	ret
+
+00800fe9 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800fe9:	55                   	push   %ebp
+  800fea:	89 e5                	mov    %esp,%ebp
+  800fec:	57                   	push   %edi
+  800fed:	56                   	push   %esi
+  800fee:	53                   	push   %ebx
+  800fef:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ff2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffd:	b8 08 00 00 00       	mov    $0x8,%eax
+  801002:	89 df                	mov    %ebx,%edi
+  801004:	89 de                	mov    %ebx,%esi
+  801006:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801008:	85 c0                	test   %eax,%eax
+  80100a:	7f 08                	jg     801014 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80100c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80100f:	5b                   	pop    %ebx
+  801010:	5e                   	pop    %esi
+  801011:	5f                   	pop    %edi
+  801012:	5d                   	pop    %ebp
+  801013:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801014:	83 ec 0c             	sub    $0xc,%esp
+  801017:	50                   	push   %eax
+  801018:	6a 08                	push   $0x8
+  80101a:	68 eb 5e 80 00       	push   $0x805eeb
+  80101f:	6a 23                	push   $0x23
+  801021:	68 08 5f 80 00       	push   $0x805f08
+  801026:	e8 cb f1 ff ff       	call   8001f6 <_panic>
+
+0080102b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	56                   	push   %esi
+  801030:	53                   	push   %ebx
+  801031:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  801034:	6a 44                	push   $0x44
+  801036:	ff 75 0c             	push   0xc(%ebp)
+  801039:	e8 7a fc ff ff       	call   800cb8 <touch_mem>
+	asm volatile("int %1\n"
+  80103e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801043:	8b 55 08             	mov    0x8(%ebp),%edx
+  801046:	b8 09 00 00 00       	mov    $0x9,%eax
+  80104b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104e:	89 df                	mov    %ebx,%edi
+  801050:	89 de                	mov    %ebx,%esi
+  801052:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801054:	83 c4 08             	add    $0x8,%esp
+  801057:	85 c0                	test   %eax,%eax
+  801059:	7f 08                	jg     801063 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80105b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80105e:	5b                   	pop    %ebx
+  80105f:	5e                   	pop    %esi
+  801060:	5f                   	pop    %edi
+  801061:	5d                   	pop    %ebp
+  801062:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801063:	83 ec 0c             	sub    $0xc,%esp
+  801066:	50                   	push   %eax
+  801067:	6a 09                	push   $0x9
+  801069:	68 eb 5e 80 00       	push   $0x805eeb
+  80106e:	6a 23                	push   $0x23
+  801070:	68 08 5f 80 00       	push   $0x805f08
+  801075:	e8 7c f1 ff ff       	call   8001f6 <_panic>
+
+0080107a <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	57                   	push   %edi
+  80107e:	56                   	push   %esi
+  80107f:	53                   	push   %ebx
+  801080:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801083:	be 00 00 00 00       	mov    $0x0,%esi
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801093:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801096:	89 f7                	mov    %esi,%edi
+  801098:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80109a:	85 c0                	test   %eax,%eax
+  80109c:	7f 08                	jg     8010a6 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  80109e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a1:	5b                   	pop    %ebx
+  8010a2:	5e                   	pop    %esi
+  8010a3:	5f                   	pop    %edi
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010a6:	83 ec 0c             	sub    $0xc,%esp
+  8010a9:	50                   	push   %eax
+  8010aa:	6a 1a                	push   $0x1a
+  8010ac:	68 eb 5e 80 00       	push   $0x805eeb
+  8010b1:	6a 23                	push   $0x23
+  8010b3:	68 08 5f 80 00       	push   $0x805f08
+  8010b8:	e8 39 f1 ff ff       	call   8001f6 <_panic>
+
+008010bd <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010bd:	55                   	push   %ebp
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	57                   	push   %edi
+  8010c1:	56                   	push   %esi
+  8010c2:	53                   	push   %ebx
+  8010c3:	83 ec 0c             	sub    $0xc,%esp
+  8010c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8010c9:	89 d8                	mov    %ebx,%eax
+  8010cb:	c1 e0 05             	shl    $0x5,%eax
+  8010ce:	50                   	push   %eax
+  8010cf:	ff 75 0c             	push   0xc(%ebp)
+  8010d2:	e8 e1 fb ff ff       	call   800cb8 <touch_mem>
+	asm volatile("int %1\n"
+  8010d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010df:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e7:	89 f7                	mov    %esi,%edi
+  8010e9:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010eb:	83 c4 08             	add    $0x8,%esp
+  8010ee:	85 c0                	test   %eax,%eax
+  8010f0:	7f 08                	jg     8010fa <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8010f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f5:	5b                   	pop    %ebx
+  8010f6:	5e                   	pop    %esi
+  8010f7:	5f                   	pop    %edi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010fa:	83 ec 0c             	sub    $0xc,%esp
+  8010fd:	50                   	push   %eax
+  8010fe:	6a 13                	push   $0x13
+  801100:	68 eb 5e 80 00       	push   $0x805eeb
+  801105:	6a 23                	push   $0x23
+  801107:	68 08 5f 80 00       	push   $0x805f08
+  80110c:	e8 e5 f0 ff ff       	call   8001f6 <_panic>
+
+00801111 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801111:	55                   	push   %ebp
+  801112:	89 e5                	mov    %esp,%ebp
+  801114:	57                   	push   %edi
+  801115:	56                   	push   %esi
+  801116:	53                   	push   %ebx
+  801117:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80111a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801122:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801125:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80112a:	89 df                	mov    %ebx,%edi
+  80112c:	89 de                	mov    %ebx,%esi
+  80112e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801130:	85 c0                	test   %eax,%eax
+  801132:	7f 08                	jg     80113c <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801134:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801137:	5b                   	pop    %ebx
+  801138:	5e                   	pop    %esi
+  801139:	5f                   	pop    %edi
+  80113a:	5d                   	pop    %ebp
+  80113b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80113c:	83 ec 0c             	sub    $0xc,%esp
+  80113f:	50                   	push   %eax
+  801140:	6a 0a                	push   $0xa
+  801142:	68 eb 5e 80 00       	push   $0x805eeb
+  801147:	6a 23                	push   $0x23
+  801149:	68 08 5f 80 00       	push   $0x805f08
+  80114e:	e8 a3 f0 ff ff       	call   8001f6 <_panic>
+
+00801153 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801153:	55                   	push   %ebp
+  801154:	89 e5                	mov    %esp,%ebp
+  801156:	57                   	push   %edi
+  801157:	56                   	push   %esi
+  801158:	53                   	push   %ebx
+  801159:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80115c:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801162:	76 1d                	jbe    801181 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801164:	8b 55 08             	mov    0x8(%ebp),%edx
+  801167:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80116f:	be 01 00 00 00       	mov    $0x1,%esi
+  801174:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801177:	cd 30                	int    $0x30
+}
+  801179:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117c:	5b                   	pop    %ebx
+  80117d:	5e                   	pop    %esi
+  80117e:	5f                   	pop    %edi
+  80117f:	5d                   	pop    %ebp
+  801180:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801181:	68 00 10 00 00       	push   $0x1000
+  801186:	53                   	push   %ebx
+  801187:	e8 2c fb ff ff       	call   800cb8 <touch_mem>
+  80118c:	83 c4 08             	add    $0x8,%esp
+  80118f:	eb d3                	jmp    801164 <sys_ipc_send+0x11>
+
+00801191 <sys_ipc_send_pages>:
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  801194:	57                   	push   %edi
+  801195:	56                   	push   %esi
+  801196:	53                   	push   %ebx
+  801197:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119a:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80119d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011a3:	76 18                	jbe    8011bd <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8011a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011b0:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8011b3:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8011b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b8:	5b                   	pop    %ebx
+  8011b9:	5e                   	pop    %esi
+  8011ba:	5f                   	pop    %edi
+  8011bb:	5d                   	pop    %ebp
+  8011bc:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011bd:	89 f0                	mov    %esi,%eax
+  8011bf:	c1 e0 0c             	shl    $0xc,%eax
+  8011c2:	50                   	push   %eax
+  8011c3:	53                   	push   %ebx
+  8011c4:	e8 ef fa ff ff       	call   800cb8 <touch_mem>
+  8011c9:	83 c4 08             	add    $0x8,%esp
+  8011cc:	eb d7                	jmp    8011a5 <sys_ipc_send_pages+0x14>
+
+008011ce <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	57                   	push   %edi
+  8011d2:	56                   	push   %esi
+  8011d3:	53                   	push   %ebx
+  8011d4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011e7:	89 df                	mov    %ebx,%edi
+  8011e9:	89 de                	mov    %ebx,%esi
+  8011eb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011ed:	85 c0                	test   %eax,%eax
+  8011ef:	7f 08                	jg     8011f9 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8011f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f4:	5b                   	pop    %ebx
+  8011f5:	5e                   	pop    %esi
+  8011f6:	5f                   	pop    %edi
+  8011f7:	5d                   	pop    %ebp
+  8011f8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f9:	83 ec 0c             	sub    $0xc,%esp
+  8011fc:	50                   	push   %eax
+  8011fd:	6a 0d                	push   $0xd
+  8011ff:	68 eb 5e 80 00       	push   $0x805eeb
+  801204:	6a 23                	push   $0x23
+  801206:	68 08 5f 80 00       	push   $0x805f08
+  80120b:	e8 e6 ef ff ff       	call   8001f6 <_panic>
+
+00801210 <sys_ipc_recv>:
+{
+  801210:	55                   	push   %ebp
+  801211:	89 e5                	mov    %esp,%ebp
+  801213:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801216:	6a 01                	push   $0x1
+  801218:	ff 75 08             	push   0x8(%ebp)
+  80121b:	e8 ae ff ff ff       	call   8011ce <sys_ipc_recv_pages>
+}
+  801220:	c9                   	leave
+  801221:	c3                   	ret
+
+00801222 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	57                   	push   %edi
+  801226:	56                   	push   %esi
+  801227:	53                   	push   %ebx
+  801228:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80122b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80122e:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801231:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801237:	77 04                	ja     80123d <sys_ipc_call+0x1b>
+  801239:	85 f6                	test   %esi,%esi
+  80123b:	75 15                	jne    801252 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80123d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801240:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801243:	b8 14 00 00 00       	mov    $0x14,%eax
+  801248:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80124a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124d:	5b                   	pop    %ebx
+  80124e:	5e                   	pop    %esi
+  80124f:	5f                   	pop    %edi
+  801250:	5d                   	pop    %ebp
+  801251:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801252:	89 f8                	mov    %edi,%eax
+  801254:	c1 e0 0c             	shl    $0xc,%eax
+  801257:	50                   	push   %eax
+  801258:	53                   	push   %ebx
+  801259:	e8 5a fa ff ff       	call   800cb8 <touch_mem>
+  80125e:	83 c4 08             	add    $0x8,%esp
+  801261:	eb da                	jmp    80123d <sys_ipc_call+0x1b>
+
+00801263 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	57                   	push   %edi
+  801267:	56                   	push   %esi
+  801268:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801269:	8b 55 08             	mov    0x8(%ebp),%edx
+  80126c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80126f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801274:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801277:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80127a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80127d:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80127f:	5b                   	pop    %ebx
+  801280:	5e                   	pop    %esi
+  801281:	5f                   	pop    %edi
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+
+00801284 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	57                   	push   %edi
+  801288:	56                   	push   %esi
+  801289:	53                   	push   %ebx
+  80128a:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80128d:	6a 04                	push   $0x4
+  80128f:	ff 75 08             	push   0x8(%ebp)
+  801292:	e8 21 fa ff ff       	call   800cb8 <touch_mem>
+	asm volatile("int %1\n"
+  801297:	be 00 00 00 00       	mov    $0x0,%esi
+  80129c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80129f:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012aa:	89 f7                	mov    %esi,%edi
+  8012ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012ae:	83 c4 08             	add    $0x8,%esp
+  8012b1:	85 c0                	test   %eax,%eax
+  8012b3:	7f 08                	jg     8012bd <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8012b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b8:	5b                   	pop    %ebx
+  8012b9:	5e                   	pop    %esi
+  8012ba:	5f                   	pop    %edi
+  8012bb:	5d                   	pop    %ebp
+  8012bc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012bd:	83 ec 0c             	sub    $0xc,%esp
+  8012c0:	50                   	push   %eax
+  8012c1:	6a 16                	push   $0x16
+  8012c3:	68 eb 5e 80 00       	push   $0x805eeb
+  8012c8:	6a 23                	push   $0x23
+  8012ca:	68 08 5f 80 00       	push   $0x805f08
+  8012cf:	e8 22 ef ff ff       	call   8001f6 <_panic>
+
+008012d4 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	57                   	push   %edi
+  8012d8:	56                   	push   %esi
+  8012d9:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8012da:	6a 04                	push   $0x4
+  8012dc:	ff 75 08             	push   0x8(%ebp)
+  8012df:	e8 d4 f9 ff ff       	call   800cb8 <touch_mem>
+	asm volatile("int %1\n"
+  8012e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ec:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f4:	89 df                	mov    %ebx,%edi
+  8012f6:	89 de                	mov    %ebx,%esi
+  8012f8:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8012fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012fd:	5b                   	pop    %ebx
+  8012fe:	5e                   	pop    %esi
+  8012ff:	5f                   	pop    %edi
+  801300:	5d                   	pop    %ebp
+  801301:	c3                   	ret
+
+00801302 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  801302:	55                   	push   %ebp
+  801303:	89 e5                	mov    %esp,%ebp
+  801305:	57                   	push   %edi
+  801306:	56                   	push   %esi
+  801307:	53                   	push   %ebx
+  801308:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80130b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801310:	8b 55 08             	mov    0x8(%ebp),%edx
+  801313:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801318:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80131d:	89 df                	mov    %ebx,%edi
+  80131f:	89 de                	mov    %ebx,%esi
+  801321:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801323:	85 c0                	test   %eax,%eax
+  801325:	7f 08                	jg     80132f <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801327:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132a:	5b                   	pop    %ebx
+  80132b:	5e                   	pop    %esi
+  80132c:	5f                   	pop    %edi
+  80132d:	5d                   	pop    %ebp
+  80132e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80132f:	83 ec 0c             	sub    $0xc,%esp
+  801332:	50                   	push   %eax
+  801333:	6a 0e                	push   $0xe
+  801335:	68 eb 5e 80 00       	push   $0x805eeb
+  80133a:	6a 23                	push   $0x23
+  80133c:	68 08 5f 80 00       	push   $0x805f08
+  801341:	e8 b0 ee ff ff       	call   8001f6 <_panic>
+
+00801346 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  801346:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80134d:	f6 c6 06             	test   $0x6,%dh
+  801350:	75 37                	jne    801389 <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  801352:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801359:	f6 c2 02             	test   $0x2,%dl
+  80135c:	75 19                	jne    801377 <dupperm+0x31>
+  80135e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801365:	f6 c6 08             	test   $0x8,%dh
+  801368:	75 0d                	jne    801377 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  80136a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801371:	25 07 0e 00 00       	and    $0xe07,%eax
+  801376:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801377:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80137e:	25 00 06 00 00       	and    $0x600,%eax
+  801383:	0d 05 08 00 00       	or     $0x805,%eax
+  801388:	c3                   	ret
+		return 0;
+  801389:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80138e:	c3                   	ret
+
+0080138f <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  80138f:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  801391:	c1 e0 0c             	shl    $0xc,%eax
+  801394:	c1 e8 16             	shr    $0x16,%eax
+  801397:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80139e:	f6 c1 01             	test   $0x1,%cl
+  8013a1:	74 2c                	je     8013cf <dupable+0x40>
+  8013a3:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8013aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013af:	f6 c1 04             	test   $0x4,%cl
+  8013b2:	74 20                	je     8013d4 <dupable+0x45>
+  8013b4:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013bb:	f6 c1 01             	test   $0x1,%cl
+  8013be:	74 14                	je     8013d4 <dupable+0x45>
+  8013c0:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8013c7:	c1 e8 02             	shr    $0x2,%eax
+  8013ca:	83 e0 01             	and    $0x1,%eax
+  8013cd:	eb 05                	jmp    8013d4 <dupable+0x45>
+  8013cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d4:	83 e0 01             	and    $0x1,%eax
+}
+  8013d7:	c3                   	ret
+
+008013d8 <pgfault>:
+{
+  8013d8:	55                   	push   %ebp
+  8013d9:	89 e5                	mov    %esp,%ebp
+  8013db:	56                   	push   %esi
+  8013dc:	53                   	push   %ebx
+  8013dd:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8013e0:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  8013e2:	89 ca                	mov    %ecx,%edx
+  8013e4:	c1 ea 0c             	shr    $0xc,%edx
+  8013e7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8013ee:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8013f2:	0f 84 8e 00 00 00    	je     801486 <pgfault+0xae>
+		return 0;
+  8013f8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8013fd:	f6 c6 08             	test   $0x8,%dh
+  801400:	0f 84 85 00 00 00    	je     80148b <pgfault+0xb3>
+	perm |= PTE_W;
+  801406:	81 e2 07 06 00 00    	and    $0x607,%edx
+  80140c:	89 d3                	mov    %edx,%ebx
+  80140e:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801411:	89 ce                	mov    %ecx,%esi
+  801413:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  801419:	6a 01                	push   $0x1
+  80141b:	53                   	push   %ebx
+  80141c:	68 00 f0 7f 00       	push   $0x7ff000
+  801421:	6a 00                	push   $0x0
+  801423:	e8 7b 2e 00 00       	call   8042a3 <page_alloc>
+  801428:	83 c4 10             	add    $0x10,%esp
+  80142b:	85 c0                	test   %eax,%eax
+  80142d:	78 33                	js     801462 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  80142f:	83 ec 04             	sub    $0x4,%esp
+  801432:	68 00 10 00 00       	push   $0x1000
+  801437:	56                   	push   %esi
+  801438:	68 00 f0 7f 00       	push   $0x7ff000
+  80143d:	e8 fc f5 ff ff       	call   800a3e <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  801442:	89 1c 24             	mov    %ebx,(%esp)
+  801445:	56                   	push   %esi
+  801446:	6a 00                	push   $0x0
+  801448:	68 00 f0 7f 00       	push   $0x7ff000
+  80144d:	6a 00                	push   $0x0
+  80144f:	e8 b0 34 00 00       	call   804904 <page_map>
+  801454:	83 c4 20             	add    $0x20,%esp
+  801457:	85 c0                	test   %eax,%eax
+  801459:	78 19                	js     801474 <pgfault+0x9c>
+	return 1;
+  80145b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801460:	eb 29                	jmp    80148b <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  801462:	50                   	push   %eax
+  801463:	68 18 5f 80 00       	push   $0x805f18
+  801468:	6a 2e                	push   $0x2e
+  80146a:	68 6b 5f 80 00       	push   $0x805f6b
+  80146f:	e8 82 ed ff ff       	call   8001f6 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  801474:	50                   	push   %eax
+  801475:	68 44 5f 80 00       	push   $0x805f44
+  80147a:	6a 32                	push   $0x32
+  80147c:	68 6b 5f 80 00       	push   $0x805f6b
+  801481:	e8 70 ed ff ff       	call   8001f6 <_panic>
+		return 0;
+  801486:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80148b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80148e:	5b                   	pop    %ebx
+  80148f:	5e                   	pop    %esi
+  801490:	5d                   	pop    %ebp
+  801491:	c3                   	ret
+
+00801492 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  801492:	55                   	push   %ebp
+  801493:	89 e5                	mov    %esp,%ebp
+  801495:	57                   	push   %edi
+  801496:	56                   	push   %esi
+  801497:	53                   	push   %ebx
+  801498:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  80149b:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8014a2:	74 5d                	je     801501 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  8014a4:	83 ec 0c             	sub    $0xc,%esp
+  8014a7:	68 d8 13 80 00       	push   $0x8013d8
+  8014ac:	e8 b4 40 00 00       	call   805565 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  8014b1:	e8 14 fb ff ff       	call   800fca <sys_fork>
+  8014b6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8014b9:	83 c4 10             	add    $0x10,%esp
+  8014bc:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8014bf:	74 47                	je     801508 <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  8014c1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8014c5:	0f 84 c5 03 00 00    	je     801890 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  8014cb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8014cf:	78 25                	js     8014f6 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  8014d1:	e8 45 27 00 00       	call   803c1b <page_share_paged_out>
+  8014d6:	85 c0                	test   %eax,%eax
+  8014d8:	0f 88 d8 03 00 00    	js     8018b6 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8014de:	83 ec 08             	sub    $0x8,%esp
+  8014e1:	6a 02                	push   $0x2
+  8014e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8014e6:	e8 fe fa ff ff       	call   800fe9 <sys_env_set_status>
+  8014eb:	83 c4 10             	add    $0x10,%esp
+  8014ee:	85 c0                	test   %eax,%eax
+  8014f0:	0f 88 d5 03 00 00    	js     8018cb <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  8014f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8014f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014fc:	5b                   	pop    %ebx
+  8014fd:	5e                   	pop    %esi
+  8014fe:	5f                   	pop    %edi
+  8014ff:	5d                   	pop    %ebp
+  801500:	c3                   	ret
+		init_map_dir();
+  801501:	e8 1d 2a 00 00       	call   803f23 <init_map_dir>
+  801506:	eb 9c                	jmp    8014a4 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  801508:	b8 07 00 00 00       	mov    $0x7,%eax
+  80150d:	cd 30                	int    $0x30
+  80150f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  801512:	85 c0                	test   %eax,%eax
+  801514:	78 10                	js     801526 <fork+0x94>
+	if (envid == 0)
+  801516:	0f 84 74 03 00 00    	je     801890 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  80151c:	be 00 00 00 00       	mov    $0x0,%esi
+  801521:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801524:	eb 30                	jmp    801556 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801526:	50                   	push   %eax
+  801527:	68 76 5f 80 00       	push   $0x805f76
+  80152c:	68 cd 00 00 00       	push   $0xcd
+  801531:	68 6b 5f 80 00       	push   $0x805f6b
+  801536:	e8 bb ec ff ff       	call   8001f6 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  80153b:	89 f2                	mov    %esi,%edx
+  80153d:	c1 fa 1f             	sar    $0x1f,%edx
+  801540:	c1 ea 16             	shr    $0x16,%edx
+  801543:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801546:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80154b:	29 d0                	sub    %edx,%eax
+  80154d:	ba 00 04 00 00       	mov    $0x400,%edx
+  801552:	29 c2                	sub    %eax,%edx
+  801554:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801556:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  801559:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  80155f:	0f 87 ff 02 00 00    	ja     801864 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  801565:	89 f3                	mov    %esi,%ebx
+  801567:	c1 e3 0c             	shl    $0xc,%ebx
+  80156a:	89 d8                	mov    %ebx,%eax
+  80156c:	c1 e8 16             	shr    $0x16,%eax
+  80156f:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801576:	f6 c2 01             	test   $0x1,%dl
+  801579:	74 c0                	je     80153b <fork+0xa9>
+  80157b:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801582:	f6 c2 04             	test   $0x4,%dl
+  801585:	74 b4                	je     80153b <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  801587:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80158e:	a8 80                	test   $0x80,%al
+  801590:	75 24                	jne    8015b6 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  801592:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  801599:	25 81 00 00 00       	and    $0x81,%eax
+  80159e:	3d 80 00 00 00       	cmp    $0x80,%eax
+  8015a3:	74 21                	je     8015c6 <fork+0x134>
+		if (!dupable(pn)) {
+  8015a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015a8:	e8 e2 fd ff ff       	call   80138f <dupable>
+  8015ad:	84 c0                	test   %al,%al
+  8015af:	75 1a                	jne    8015cb <fork+0x139>
+			++pn;
+  8015b1:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8015b4:	eb a0                	jmp    801556 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  8015b6:	83 ec 08             	sub    $0x8,%esp
+  8015b9:	53                   	push   %ebx
+  8015ba:	6a 00                	push   $0x0
+  8015bc:	e8 b1 f8 ff ff       	call   800e72 <sys_page_split>
+  8015c1:	83 c4 10             	add    $0x10,%esp
+  8015c4:	eb cc                	jmp    801592 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  8015c6:	0f b6 03             	movzbl (%ebx),%eax
+  8015c9:	eb da                	jmp    8015a5 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  8015cb:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8015ce:	89 f8                	mov    %edi,%eax
+  8015d0:	e8 71 fd ff ff       	call   801346 <dupperm>
+  8015d5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8015d8:	85 c0                	test   %eax,%eax
+  8015da:	74 16                	je     8015f2 <fork+0x160>
+  8015dc:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  8015e1:	29 f8                	sub    %edi,%eax
+  8015e3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8015e6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8015eb:	89 c6                	mov    %eax,%esi
+  8015ed:	e9 c4 01 00 00       	jmp    8017b6 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  8015f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015f5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015fc:	f6 c4 04             	test   $0x4,%ah
+  8015ff:	0f 85 89 00 00 00    	jne    80168e <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  801605:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801608:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80160f:	f6 c4 02             	test   $0x2,%ah
+  801612:	0f 85 b1 00 00 00    	jne    8016c9 <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  801618:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80161b:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801622:	a8 02                	test   $0x2,%al
+  801624:	75 10                	jne    801636 <fork+0x1a4>
+  801626:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80162d:	f6 c4 08             	test   $0x8,%ah
+  801630:	0f 84 3e 01 00 00    	je     801774 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801636:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801639:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801640:	25 00 06 00 00       	and    $0x600,%eax
+  801645:	0d 05 08 00 00       	or     $0x805,%eax
+  80164a:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  80164c:	c1 e1 0c             	shl    $0xc,%ecx
+  80164f:	89 cb                	mov    %ecx,%ebx
+  801651:	83 ec 0c             	sub    $0xc,%esp
+  801654:	50                   	push   %eax
+  801655:	51                   	push   %ecx
+  801656:	ff 75 e4             	push   -0x1c(%ebp)
+  801659:	51                   	push   %ecx
+  80165a:	6a 00                	push   $0x0
+  80165c:	e8 a3 32 00 00       	call   804904 <page_map>
+  801661:	83 c4 20             	add    $0x20,%esp
+  801664:	85 c0                	test   %eax,%eax
+  801666:	0f 88 e4 00 00 00    	js     801750 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  80166c:	83 ec 0c             	sub    $0xc,%esp
+  80166f:	57                   	push   %edi
+  801670:	53                   	push   %ebx
+  801671:	6a 00                	push   $0x0
+  801673:	53                   	push   %ebx
+  801674:	6a 00                	push   $0x0
+  801676:	e8 89 32 00 00       	call   804904 <page_map>
+  80167b:	83 c4 20             	add    $0x20,%esp
+  80167e:	85 c0                	test   %eax,%eax
+  801680:	0f 88 dc 00 00 00    	js     801762 <fork+0x2d0>
+			++pn;
+  801686:	83 c6 01             	add    $0x1,%esi
+			continue;
+  801689:	e9 c8 fe ff ff       	jmp    801556 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  80168e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801691:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801698:	c1 e1 0c             	shl    $0xc,%ecx
+  80169b:	83 ec 0c             	sub    $0xc,%esp
+  80169e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016a3:	50                   	push   %eax
+  8016a4:	51                   	push   %ecx
+  8016a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8016a8:	51                   	push   %ecx
+  8016a9:	6a 00                	push   $0x0
+  8016ab:	e8 54 32 00 00       	call   804904 <page_map>
+  8016b0:	83 c4 20             	add    $0x20,%esp
+  8016b3:	85 c0                	test   %eax,%eax
+  8016b5:	79 cf                	jns    801686 <fork+0x1f4>
+			panic("page_map %d", r);
+  8016b7:	50                   	push   %eax
+  8016b8:	68 86 5f 80 00       	push   $0x805f86
+  8016bd:	6a 4d                	push   $0x4d
+  8016bf:	68 6b 5f 80 00       	push   $0x805f6b
+  8016c4:	e8 2d eb ff ff       	call   8001f6 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  8016c9:	83 ec 0c             	sub    $0xc,%esp
+  8016cc:	68 00 10 00 00       	push   $0x1000
+  8016d1:	e8 20 38 00 00       	call   804ef6 <malloc>
+  8016d6:	89 c7                	mov    %eax,%edi
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	74 4b                	je     80172a <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  8016df:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8016e2:	c1 e3 0c             	shl    $0xc,%ebx
+  8016e5:	83 ec 04             	sub    $0x4,%esp
+  8016e8:	68 00 10 00 00       	push   $0x1000
+  8016ed:	53                   	push   %ebx
+  8016ee:	50                   	push   %eax
+  8016ef:	e8 ac f3 ff ff       	call   800aa0 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  8016f4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016fe:	25 07 0e 00 00       	and    $0xe07,%eax
+  801703:	89 04 24             	mov    %eax,(%esp)
+  801706:	53                   	push   %ebx
+  801707:	ff 75 e4             	push   -0x1c(%ebp)
+  80170a:	57                   	push   %edi
+  80170b:	6a 00                	push   $0x0
+  80170d:	e8 f2 31 00 00       	call   804904 <page_map>
+  801712:	83 c4 20             	add    $0x20,%esp
+  801715:	85 c0                	test   %eax,%eax
+  801717:	78 25                	js     80173e <fork+0x2ac>
+		free(temp);
+  801719:	83 ec 0c             	sub    $0xc,%esp
+  80171c:	57                   	push   %edi
+  80171d:	e8 d2 35 00 00       	call   804cf4 <free>
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	e9 5c ff ff ff       	jmp    801686 <fork+0x1f4>
+			panic("malloc failed");
+  80172a:	83 ec 04             	sub    $0x4,%esp
+  80172d:	68 92 5f 80 00       	push   $0x805f92
+  801732:	6a 56                	push   $0x56
+  801734:	68 6b 5f 80 00       	push   $0x805f6b
+  801739:	e8 b8 ea ff ff       	call   8001f6 <_panic>
+			panic("page_map: %e", r);
+  80173e:	50                   	push   %eax
+  80173f:	68 a0 5f 80 00       	push   $0x805fa0
+  801744:	6a 59                	push   $0x59
+  801746:	68 6b 5f 80 00       	push   $0x805f6b
+  80174b:	e8 a6 ea ff ff       	call   8001f6 <_panic>
+			panic("page_map %d", r);
+  801750:	50                   	push   %eax
+  801751:	68 86 5f 80 00       	push   $0x805f86
+  801756:	6a 65                	push   $0x65
+  801758:	68 6b 5f 80 00       	push   $0x805f6b
+  80175d:	e8 94 ea ff ff       	call   8001f6 <_panic>
+			panic("page_map %d", r);
+  801762:	50                   	push   %eax
+  801763:	68 86 5f 80 00       	push   $0x805f86
+  801768:	6a 78                	push   $0x78
+  80176a:	68 6b 5f 80 00       	push   $0x805f6b
+  80176f:	e8 82 ea ff ff       	call   8001f6 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801774:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801777:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80177e:	c1 e1 0c             	shl    $0xc,%ecx
+  801781:	83 ec 0c             	sub    $0xc,%esp
+  801784:	25 07 0e 00 00       	and    $0xe07,%eax
+  801789:	50                   	push   %eax
+  80178a:	51                   	push   %ecx
+  80178b:	ff 75 e4             	push   -0x1c(%ebp)
+  80178e:	51                   	push   %ecx
+  80178f:	6a 00                	push   $0x0
+  801791:	e8 6e 31 00 00       	call   804904 <page_map>
+  801796:	83 c4 20             	add    $0x20,%esp
+  801799:	85 c0                	test   %eax,%eax
+  80179b:	0f 89 e5 fe ff ff    	jns    801686 <fork+0x1f4>
+			panic("page_map %d", r);
+  8017a1:	50                   	push   %eax
+  8017a2:	68 86 5f 80 00       	push   $0x805f86
+  8017a7:	6a 7f                	push   $0x7f
+  8017a9:	68 6b 5f 80 00       	push   $0x805f6b
+  8017ae:	e8 43 ea ff ff       	call   8001f6 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8017b3:	83 c7 01             	add    $0x1,%edi
+  8017b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017b9:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  8017bc:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  8017bf:	39 f7                	cmp    %esi,%edi
+  8017c1:	74 1c                	je     8017df <fork+0x34d>
+  8017c3:	89 d8                	mov    %ebx,%eax
+  8017c5:	e8 c5 fb ff ff       	call   80138f <dupable>
+  8017ca:	84 c0                	test   %al,%al
+  8017cc:	74 7c                	je     80184a <fork+0x3b8>
+  8017ce:	89 d8                	mov    %ebx,%eax
+  8017d0:	e8 71 fb ff ff       	call   801346 <dupperm>
+  8017d5:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  8017d8:	74 d9                	je     8017b3 <fork+0x321>
+  8017da:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8017dd:	eb 06                	jmp    8017e5 <fork+0x353>
+  8017df:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  8017e2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  8017e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017e8:	c1 e0 0c             	shl    $0xc,%eax
+  8017eb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017ee:	83 ec 08             	sub    $0x8,%esp
+  8017f1:	ff 75 dc             	push   -0x24(%ebp)
+  8017f4:	57                   	push   %edi
+  8017f5:	50                   	push   %eax
+  8017f6:	ff 75 e4             	push   -0x1c(%ebp)
+  8017f9:	50                   	push   %eax
+  8017fa:	6a 00                	push   $0x0
+  8017fc:	e8 fa 32 00 00       	call   804afb <page_map_range>
+  801801:	83 c4 20             	add    $0x20,%esp
+  801804:	85 c0                	test   %eax,%eax
+  801806:	78 47                	js     80184f <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801808:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  80180f:	0f 84 41 fd ff ff    	je     801556 <fork+0xc4>
+  801815:	83 ec 08             	sub    $0x8,%esp
+  801818:	ff 75 dc             	push   -0x24(%ebp)
+  80181b:	57                   	push   %edi
+  80181c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80181f:	50                   	push   %eax
+  801820:	6a 00                	push   $0x0
+  801822:	50                   	push   %eax
+  801823:	6a 00                	push   $0x0
+  801825:	e8 d1 32 00 00       	call   804afb <page_map_range>
+  80182a:	83 c4 20             	add    $0x20,%esp
+  80182d:	85 c0                	test   %eax,%eax
+  80182f:	0f 89 21 fd ff ff    	jns    801556 <fork+0xc4>
+		panic("page_map_range %e", r);
+  801835:	50                   	push   %eax
+  801836:	68 ad 5f 80 00       	push   $0x805fad
+  80183b:	68 a2 00 00 00       	push   $0xa2
+  801840:	68 6b 5f 80 00       	push   $0x805f6b
+  801845:	e8 ac e9 ff ff       	call   8001f6 <_panic>
+  80184a:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  80184d:	eb 96                	jmp    8017e5 <fork+0x353>
+		panic("page_map_range %e", r);
+  80184f:	50                   	push   %eax
+  801850:	68 ad 5f 80 00       	push   $0x805fad
+  801855:	68 a0 00 00 00       	push   $0xa0
+  80185a:	68 6b 5f 80 00       	push   $0x805f6b
+  80185f:	e8 92 e9 ff ff       	call   8001f6 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  801864:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801867:	6a 01                	push   $0x1
+  801869:	6a 07                	push   $0x7
+  80186b:	68 00 f0 bf ee       	push   $0xeebff000
+  801870:	53                   	push   %ebx
+  801871:	e8 2d 2a 00 00       	call   8042a3 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801876:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80187b:	8b 40 74             	mov    0x74(%eax),%eax
+  80187e:	83 c4 08             	add    $0x8,%esp
+  801881:	50                   	push   %eax
+  801882:	53                   	push   %ebx
+  801883:	e8 89 f8 ff ff       	call   801111 <sys_env_set_pgfault_upcall>
+  801888:	83 c4 10             	add    $0x10,%esp
+  80188b:	e9 41 fc ff ff       	jmp    8014d1 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801890:	e8 d8 f4 ff ff       	call   800d6d <sys_getenvid>
+  801895:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80189a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80189d:	c1 e0 06             	shl    $0x6,%eax
+  8018a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8018a5:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  8018aa:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8018b1:	e9 40 fc ff ff       	jmp    8014f6 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  8018b6:	50                   	push   %eax
+  8018b7:	68 bf 5f 80 00       	push   $0x805fbf
+  8018bc:	68 27 01 00 00       	push   $0x127
+  8018c1:	68 6b 5f 80 00       	push   $0x805f6b
+  8018c6:	e8 2b e9 ff ff       	call   8001f6 <_panic>
+		panic("sys_env_set_status: %d", r);
+  8018cb:	50                   	push   %eax
+  8018cc:	68 d8 5f 80 00       	push   $0x805fd8
+  8018d1:	68 2b 01 00 00       	push   $0x12b
+  8018d6:	68 6b 5f 80 00       	push   $0x805f6b
+  8018db:	e8 16 e9 ff ff       	call   8001f6 <_panic>
+
+008018e0 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+  8018e3:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8018e6:	68 ef 5f 80 00       	push   $0x805fef
+  8018eb:	68 35 01 00 00       	push   $0x135
+  8018f0:	68 6b 5f 80 00       	push   $0x805f6b
+  8018f5:	e8 fc e8 ff ff       	call   8001f6 <_panic>
+
+008018fa <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8018fa:	55                   	push   %ebp
+  8018fb:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8018fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801900:	05 00 00 00 30       	add    $0x30000000,%eax
+  801905:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801908:	5d                   	pop    %ebp
+  801909:	c3                   	ret
+
+0080190a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80190a:	55                   	push   %ebp
+  80190b:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80190d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801910:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801915:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80191a:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80191f:	5d                   	pop    %ebp
+  801920:	c3                   	ret
+
+00801921 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801921:	55                   	push   %ebp
+  801922:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801924:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801929:	a8 01                	test   $0x1,%al
+  80192b:	74 3c                	je     801969 <fd_alloc+0x48>
+  80192d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801932:	89 c2                	mov    %eax,%edx
+  801934:	c1 ea 0c             	shr    $0xc,%edx
+  801937:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80193e:	89 c1                	mov    %eax,%ecx
+  801940:	05 00 10 00 00       	add    $0x1000,%eax
+  801945:	f6 c2 01             	test   $0x1,%dl
+  801948:	74 13                	je     80195d <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80194a:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80194f:	75 e1                	jne    801932 <fd_alloc+0x11>
+  801951:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801956:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80195b:	eb 05                	jmp    801962 <fd_alloc+0x41>
+			return 0;
+  80195d:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801962:	8b 55 08             	mov    0x8(%ebp),%edx
+  801965:	89 0a                	mov    %ecx,(%edx)
+}
+  801967:	5d                   	pop    %ebp
+  801968:	c3                   	ret
+  801969:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80196e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801973:	eb ed                	jmp    801962 <fd_alloc+0x41>
+
+00801975 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801975:	55                   	push   %ebp
+  801976:	89 e5                	mov    %esp,%ebp
+  801978:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  80197b:	83 f8 1f             	cmp    $0x1f,%eax
+  80197e:	77 30                	ja     8019b0 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801980:	c1 e0 0c             	shl    $0xc,%eax
+  801983:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801988:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80198e:	f6 c2 01             	test   $0x1,%dl
+  801991:	74 24                	je     8019b7 <fd_lookup+0x42>
+  801993:	89 c2                	mov    %eax,%edx
+  801995:	c1 ea 0c             	shr    $0xc,%edx
+  801998:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80199f:	f6 c2 01             	test   $0x1,%dl
+  8019a2:	74 1a                	je     8019be <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019a7:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ae:	5d                   	pop    %ebp
+  8019af:	c3                   	ret
+		return -E_INVAL;
+  8019b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019b5:	eb f7                	jmp    8019ae <fd_lookup+0x39>
+		return -E_INVAL;
+  8019b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019bc:	eb f0                	jmp    8019ae <fd_lookup+0x39>
+  8019be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019c3:	eb e9                	jmp    8019ae <fd_lookup+0x39>
+
+008019c5 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8019c5:	55                   	push   %ebp
+  8019c6:	89 e5                	mov    %esp,%ebp
+  8019c8:	53                   	push   %ebx
+  8019c9:	83 ec 04             	sub    $0x4,%esp
+  8019cc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8019cf:	b8 84 60 80 00       	mov    $0x806084,%eax
+  8019d4:	8b 18                	mov    (%eax),%ebx
+  8019d6:	85 db                	test   %ebx,%ebx
+  8019d8:	74 0e                	je     8019e8 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8019da:	83 c0 04             	add    $0x4,%eax
+  8019dd:	39 13                	cmp    %edx,(%ebx)
+  8019df:	75 f3                	jne    8019d4 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8019e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e6:	eb 1f                	jmp    801a07 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019e8:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8019ed:	8b 40 48             	mov    0x48(%eax),%eax
+  8019f0:	83 ec 04             	sub    $0x4,%esp
+  8019f3:	52                   	push   %edx
+  8019f4:	50                   	push   %eax
+  8019f5:	68 08 60 80 00       	push   $0x806008
+  8019fa:	e8 d2 e8 ff ff       	call   8002d1 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8019ff:	83 c4 10             	add    $0x10,%esp
+  801a02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a07:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a0a:	89 1a                	mov    %ebx,(%edx)
+}
+  801a0c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a0f:	c9                   	leave
+  801a10:	c3                   	ret
+
+00801a11 <fd_close>:
+{
+  801a11:	55                   	push   %ebp
+  801a12:	89 e5                	mov    %esp,%ebp
+  801a14:	57                   	push   %edi
+  801a15:	56                   	push   %esi
+  801a16:	53                   	push   %ebx
+  801a17:	83 ec 24             	sub    $0x24,%esp
+  801a1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a1d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a20:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a23:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a24:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a2a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a2d:	50                   	push   %eax
+  801a2e:	e8 42 ff ff ff       	call   801975 <fd_lookup>
+  801a33:	89 c3                	mov    %eax,%ebx
+  801a35:	83 c4 10             	add    $0x10,%esp
+  801a38:	85 c0                	test   %eax,%eax
+  801a3a:	78 05                	js     801a41 <fd_close+0x30>
+	    || fd != fd2)
+  801a3c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a3f:	74 16                	je     801a57 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a41:	89 f8                	mov    %edi,%eax
+  801a43:	84 c0                	test   %al,%al
+  801a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a4d:	89 d8                	mov    %ebx,%eax
+  801a4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a52:	5b                   	pop    %ebx
+  801a53:	5e                   	pop    %esi
+  801a54:	5f                   	pop    %edi
+  801a55:	5d                   	pop    %ebp
+  801a56:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a57:	83 ec 08             	sub    $0x8,%esp
+  801a5a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a5d:	50                   	push   %eax
+  801a5e:	ff 36                	push   (%esi)
+  801a60:	e8 60 ff ff ff       	call   8019c5 <dev_lookup>
+  801a65:	89 c3                	mov    %eax,%ebx
+  801a67:	83 c4 10             	add    $0x10,%esp
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 1a                	js     801a88 <fd_close+0x77>
+		if (dev->dev_close)
+  801a6e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a71:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a74:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a79:	85 c0                	test   %eax,%eax
+  801a7b:	74 0b                	je     801a88 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a7d:	83 ec 0c             	sub    $0xc,%esp
+  801a80:	56                   	push   %esi
+  801a81:	ff d0                	call   *%eax
+  801a83:	89 c3                	mov    %eax,%ebx
+  801a85:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a88:	83 ec 08             	sub    $0x8,%esp
+  801a8b:	56                   	push   %esi
+  801a8c:	6a 00                	push   $0x0
+  801a8e:	e8 9d f3 ff ff       	call   800e30 <sys_page_unmap>
+	return r;
+  801a93:	83 c4 10             	add    $0x10,%esp
+  801a96:	eb b5                	jmp    801a4d <fd_close+0x3c>
+
+00801a98 <close>:
+
+int
+close(int fdnum)
+{
+  801a98:	55                   	push   %ebp
+  801a99:	89 e5                	mov    %esp,%ebp
+  801a9b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa1:	50                   	push   %eax
+  801aa2:	ff 75 08             	push   0x8(%ebp)
+  801aa5:	e8 cb fe ff ff       	call   801975 <fd_lookup>
+  801aaa:	83 c4 10             	add    $0x10,%esp
+  801aad:	85 c0                	test   %eax,%eax
+  801aaf:	79 02                	jns    801ab3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ab1:	c9                   	leave
+  801ab2:	c3                   	ret
+		return fd_close(fd, 1);
+  801ab3:	83 ec 08             	sub    $0x8,%esp
+  801ab6:	6a 01                	push   $0x1
+  801ab8:	ff 75 f4             	push   -0xc(%ebp)
+  801abb:	e8 51 ff ff ff       	call   801a11 <fd_close>
+  801ac0:	83 c4 10             	add    $0x10,%esp
+  801ac3:	eb ec                	jmp    801ab1 <close+0x19>
+
+00801ac5 <close_all>:
+
+void
+close_all(void)
+{
+  801ac5:	55                   	push   %ebp
+  801ac6:	89 e5                	mov    %esp,%ebp
+  801ac8:	53                   	push   %ebx
+  801ac9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801acc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801ad1:	83 ec 0c             	sub    $0xc,%esp
+  801ad4:	53                   	push   %ebx
+  801ad5:	e8 be ff ff ff       	call   801a98 <close>
+	for (i = 0; i < MAXFD; i++)
+  801ada:	83 c3 01             	add    $0x1,%ebx
+  801add:	83 c4 10             	add    $0x10,%esp
+  801ae0:	83 fb 20             	cmp    $0x20,%ebx
+  801ae3:	75 ec                	jne    801ad1 <close_all+0xc>
+}
+  801ae5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae8:	c9                   	leave
+  801ae9:	c3                   	ret
+
+00801aea <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801aea:	55                   	push   %ebp
+  801aeb:	89 e5                	mov    %esp,%ebp
+  801aed:	57                   	push   %edi
+  801aee:	56                   	push   %esi
+  801aef:	53                   	push   %ebx
+  801af0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801af3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801af6:	50                   	push   %eax
+  801af7:	ff 75 08             	push   0x8(%ebp)
+  801afa:	e8 76 fe ff ff       	call   801975 <fd_lookup>
+  801aff:	89 c3                	mov    %eax,%ebx
+  801b01:	83 c4 10             	add    $0x10,%esp
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	78 7f                	js     801b87 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b08:	83 ec 0c             	sub    $0xc,%esp
+  801b0b:	ff 75 0c             	push   0xc(%ebp)
+  801b0e:	e8 85 ff ff ff       	call   801a98 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b13:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b16:	c1 e6 0c             	shl    $0xc,%esi
+  801b19:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b1f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b22:	89 3c 24             	mov    %edi,(%esp)
+  801b25:	e8 e0 fd ff ff       	call   80190a <fd2data>
+  801b2a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b2c:	89 34 24             	mov    %esi,(%esp)
+  801b2f:	e8 d6 fd ff ff       	call   80190a <fd2data>
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b3a:	89 d8                	mov    %ebx,%eax
+  801b3c:	c1 e8 16             	shr    $0x16,%eax
+  801b3f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b46:	a8 01                	test   $0x1,%al
+  801b48:	74 11                	je     801b5b <dup+0x71>
+  801b4a:	89 d8                	mov    %ebx,%eax
+  801b4c:	c1 e8 0c             	shr    $0xc,%eax
+  801b4f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b56:	f6 c2 01             	test   $0x1,%dl
+  801b59:	75 36                	jne    801b91 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b5b:	89 f8                	mov    %edi,%eax
+  801b5d:	c1 e8 0c             	shr    $0xc,%eax
+  801b60:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b67:	83 ec 0c             	sub    $0xc,%esp
+  801b6a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b6f:	50                   	push   %eax
+  801b70:	56                   	push   %esi
+  801b71:	6a 00                	push   $0x0
+  801b73:	57                   	push   %edi
+  801b74:	6a 00                	push   $0x0
+  801b76:	e8 73 f2 ff ff       	call   800dee <sys_page_map>
+  801b7b:	89 c3                	mov    %eax,%ebx
+  801b7d:	83 c4 20             	add    $0x20,%esp
+  801b80:	85 c0                	test   %eax,%eax
+  801b82:	78 33                	js     801bb7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b84:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b87:	89 d8                	mov    %ebx,%eax
+  801b89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8c:	5b                   	pop    %ebx
+  801b8d:	5e                   	pop    %esi
+  801b8e:	5f                   	pop    %edi
+  801b8f:	5d                   	pop    %ebp
+  801b90:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801b91:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b98:	83 ec 0c             	sub    $0xc,%esp
+  801b9b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801ba0:	50                   	push   %eax
+  801ba1:	ff 75 d4             	push   -0x2c(%ebp)
+  801ba4:	6a 00                	push   $0x0
+  801ba6:	53                   	push   %ebx
+  801ba7:	6a 00                	push   $0x0
+  801ba9:	e8 40 f2 ff ff       	call   800dee <sys_page_map>
+  801bae:	89 c3                	mov    %eax,%ebx
+  801bb0:	83 c4 20             	add    $0x20,%esp
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	79 a4                	jns    801b5b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801bb7:	83 ec 08             	sub    $0x8,%esp
+  801bba:	56                   	push   %esi
+  801bbb:	6a 00                	push   $0x0
+  801bbd:	e8 6e f2 ff ff       	call   800e30 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801bc2:	83 c4 08             	add    $0x8,%esp
+  801bc5:	ff 75 d4             	push   -0x2c(%ebp)
+  801bc8:	6a 00                	push   $0x0
+  801bca:	e8 61 f2 ff ff       	call   800e30 <sys_page_unmap>
+	return r;
+  801bcf:	83 c4 10             	add    $0x10,%esp
+  801bd2:	eb b3                	jmp    801b87 <dup+0x9d>
+
+00801bd4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801bd4:	55                   	push   %ebp
+  801bd5:	89 e5                	mov    %esp,%ebp
+  801bd7:	56                   	push   %esi
+  801bd8:	53                   	push   %ebx
+  801bd9:	83 ec 18             	sub    $0x18,%esp
+  801bdc:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bdf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801be2:	50                   	push   %eax
+  801be3:	56                   	push   %esi
+  801be4:	e8 8c fd ff ff       	call   801975 <fd_lookup>
+  801be9:	83 c4 10             	add    $0x10,%esp
+  801bec:	85 c0                	test   %eax,%eax
+  801bee:	78 3c                	js     801c2c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bf0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801bf3:	83 ec 08             	sub    $0x8,%esp
+  801bf6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bf9:	50                   	push   %eax
+  801bfa:	ff 33                	push   (%ebx)
+  801bfc:	e8 c4 fd ff ff       	call   8019c5 <dev_lookup>
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	78 24                	js     801c2c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c08:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c0b:	83 e0 03             	and    $0x3,%eax
+  801c0e:	83 f8 01             	cmp    $0x1,%eax
+  801c11:	74 20                	je     801c33 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c16:	8b 40 08             	mov    0x8(%eax),%eax
+  801c19:	85 c0                	test   %eax,%eax
+  801c1b:	74 37                	je     801c54 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c1d:	83 ec 04             	sub    $0x4,%esp
+  801c20:	ff 75 10             	push   0x10(%ebp)
+  801c23:	ff 75 0c             	push   0xc(%ebp)
+  801c26:	53                   	push   %ebx
+  801c27:	ff d0                	call   *%eax
+  801c29:	83 c4 10             	add    $0x10,%esp
+}
+  801c2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c2f:	5b                   	pop    %ebx
+  801c30:	5e                   	pop    %esi
+  801c31:	5d                   	pop    %ebp
+  801c32:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c33:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801c38:	8b 40 48             	mov    0x48(%eax),%eax
+  801c3b:	83 ec 04             	sub    $0x4,%esp
+  801c3e:	56                   	push   %esi
+  801c3f:	50                   	push   %eax
+  801c40:	68 49 60 80 00       	push   $0x806049
+  801c45:	e8 87 e6 ff ff       	call   8002d1 <cprintf>
+		return -E_INVAL;
+  801c4a:	83 c4 10             	add    $0x10,%esp
+  801c4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c52:	eb d8                	jmp    801c2c <read+0x58>
+		return -E_NOT_SUPP;
+  801c54:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c59:	eb d1                	jmp    801c2c <read+0x58>
+
+00801c5b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c5b:	55                   	push   %ebp
+  801c5c:	89 e5                	mov    %esp,%ebp
+  801c5e:	57                   	push   %edi
+  801c5f:	56                   	push   %esi
+  801c60:	53                   	push   %ebx
+  801c61:	83 ec 0c             	sub    $0xc,%esp
+  801c64:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c67:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c6f:	eb 02                	jmp    801c73 <readn+0x18>
+  801c71:	01 c3                	add    %eax,%ebx
+  801c73:	39 f3                	cmp    %esi,%ebx
+  801c75:	73 21                	jae    801c98 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c77:	83 ec 04             	sub    $0x4,%esp
+  801c7a:	89 f0                	mov    %esi,%eax
+  801c7c:	29 d8                	sub    %ebx,%eax
+  801c7e:	50                   	push   %eax
+  801c7f:	89 d8                	mov    %ebx,%eax
+  801c81:	03 45 0c             	add    0xc(%ebp),%eax
+  801c84:	50                   	push   %eax
+  801c85:	57                   	push   %edi
+  801c86:	e8 49 ff ff ff       	call   801bd4 <read>
+		if (m < 0)
+  801c8b:	83 c4 10             	add    $0x10,%esp
+  801c8e:	85 c0                	test   %eax,%eax
+  801c90:	78 04                	js     801c96 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801c92:	75 dd                	jne    801c71 <readn+0x16>
+  801c94:	eb 02                	jmp    801c98 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c96:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801c98:	89 d8                	mov    %ebx,%eax
+  801c9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c9d:	5b                   	pop    %ebx
+  801c9e:	5e                   	pop    %esi
+  801c9f:	5f                   	pop    %edi
+  801ca0:	5d                   	pop    %ebp
+  801ca1:	c3                   	ret
+
+00801ca2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801ca2:	55                   	push   %ebp
+  801ca3:	89 e5                	mov    %esp,%ebp
+  801ca5:	56                   	push   %esi
+  801ca6:	53                   	push   %ebx
+  801ca7:	83 ec 18             	sub    $0x18,%esp
+  801caa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cb0:	50                   	push   %eax
+  801cb1:	53                   	push   %ebx
+  801cb2:	e8 be fc ff ff       	call   801975 <fd_lookup>
+  801cb7:	83 c4 10             	add    $0x10,%esp
+  801cba:	85 c0                	test   %eax,%eax
+  801cbc:	78 37                	js     801cf5 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cbe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cc1:	83 ec 08             	sub    $0x8,%esp
+  801cc4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cc7:	50                   	push   %eax
+  801cc8:	ff 36                	push   (%esi)
+  801cca:	e8 f6 fc ff ff       	call   8019c5 <dev_lookup>
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	78 1f                	js     801cf5 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cd6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cda:	74 20                	je     801cfc <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cdc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cdf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	74 37                	je     801d1d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801ce6:	83 ec 04             	sub    $0x4,%esp
+  801ce9:	ff 75 10             	push   0x10(%ebp)
+  801cec:	ff 75 0c             	push   0xc(%ebp)
+  801cef:	56                   	push   %esi
+  801cf0:	ff d0                	call   *%eax
+  801cf2:	83 c4 10             	add    $0x10,%esp
+}
+  801cf5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf8:	5b                   	pop    %ebx
+  801cf9:	5e                   	pop    %esi
+  801cfa:	5d                   	pop    %ebp
+  801cfb:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cfc:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801d01:	8b 40 48             	mov    0x48(%eax),%eax
+  801d04:	83 ec 04             	sub    $0x4,%esp
+  801d07:	53                   	push   %ebx
+  801d08:	50                   	push   %eax
+  801d09:	68 65 60 80 00       	push   $0x806065
+  801d0e:	e8 be e5 ff ff       	call   8002d1 <cprintf>
+		return -E_INVAL;
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d1b:	eb d8                	jmp    801cf5 <write+0x53>
+		return -E_NOT_SUPP;
+  801d1d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d22:	eb d1                	jmp    801cf5 <write+0x53>
+
+00801d24 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d24:	55                   	push   %ebp
+  801d25:	89 e5                	mov    %esp,%ebp
+  801d27:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d2a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d2d:	50                   	push   %eax
+  801d2e:	ff 75 08             	push   0x8(%ebp)
+  801d31:	e8 3f fc ff ff       	call   801975 <fd_lookup>
+  801d36:	83 c4 10             	add    $0x10,%esp
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	78 0e                	js     801d4b <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801d3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d43:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d4b:	c9                   	leave
+  801d4c:	c3                   	ret
+
+00801d4d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d4d:	55                   	push   %ebp
+  801d4e:	89 e5                	mov    %esp,%ebp
+  801d50:	56                   	push   %esi
+  801d51:	53                   	push   %ebx
+  801d52:	83 ec 18             	sub    $0x18,%esp
+  801d55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d58:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d5b:	50                   	push   %eax
+  801d5c:	53                   	push   %ebx
+  801d5d:	e8 13 fc ff ff       	call   801975 <fd_lookup>
+  801d62:	83 c4 10             	add    $0x10,%esp
+  801d65:	85 c0                	test   %eax,%eax
+  801d67:	78 34                	js     801d9d <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d69:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d6c:	83 ec 08             	sub    $0x8,%esp
+  801d6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d72:	50                   	push   %eax
+  801d73:	ff 36                	push   (%esi)
+  801d75:	e8 4b fc ff ff       	call   8019c5 <dev_lookup>
+  801d7a:	83 c4 10             	add    $0x10,%esp
+  801d7d:	85 c0                	test   %eax,%eax
+  801d7f:	78 1c                	js     801d9d <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d81:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d85:	74 1d                	je     801da4 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801d87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d8a:	8b 40 18             	mov    0x18(%eax),%eax
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	74 34                	je     801dc5 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801d91:	83 ec 08             	sub    $0x8,%esp
+  801d94:	ff 75 0c             	push   0xc(%ebp)
+  801d97:	56                   	push   %esi
+  801d98:	ff d0                	call   *%eax
+  801d9a:	83 c4 10             	add    $0x10,%esp
+}
+  801d9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da0:	5b                   	pop    %ebx
+  801da1:	5e                   	pop    %esi
+  801da2:	5d                   	pop    %ebp
+  801da3:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801da4:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801da9:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dac:	83 ec 04             	sub    $0x4,%esp
+  801daf:	53                   	push   %ebx
+  801db0:	50                   	push   %eax
+  801db1:	68 28 60 80 00       	push   $0x806028
+  801db6:	e8 16 e5 ff ff       	call   8002d1 <cprintf>
+		return -E_INVAL;
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dc3:	eb d8                	jmp    801d9d <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801dc5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801dca:	eb d1                	jmp    801d9d <ftruncate+0x50>
+
+00801dcc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801dcc:	55                   	push   %ebp
+  801dcd:	89 e5                	mov    %esp,%ebp
+  801dcf:	56                   	push   %esi
+  801dd0:	53                   	push   %ebx
+  801dd1:	83 ec 18             	sub    $0x18,%esp
+  801dd4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801dd7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dda:	50                   	push   %eax
+  801ddb:	ff 75 08             	push   0x8(%ebp)
+  801dde:	e8 92 fb ff ff       	call   801975 <fd_lookup>
+  801de3:	83 c4 10             	add    $0x10,%esp
+  801de6:	85 c0                	test   %eax,%eax
+  801de8:	78 49                	js     801e33 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dea:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ded:	83 ec 08             	sub    $0x8,%esp
+  801df0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df3:	50                   	push   %eax
+  801df4:	ff 36                	push   (%esi)
+  801df6:	e8 ca fb ff ff       	call   8019c5 <dev_lookup>
+  801dfb:	83 c4 10             	add    $0x10,%esp
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	78 31                	js     801e33 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e05:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e09:	74 2f                	je     801e3a <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e0b:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e0e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801e15:	00 00 00 
+	stat->st_isdir = 0;
+  801e18:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801e1f:	00 00 00 
+	stat->st_dev = dev;
+  801e22:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801e28:	83 ec 08             	sub    $0x8,%esp
+  801e2b:	53                   	push   %ebx
+  801e2c:	56                   	push   %esi
+  801e2d:	ff 50 14             	call   *0x14(%eax)
+  801e30:	83 c4 10             	add    $0x10,%esp
+}
+  801e33:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e36:	5b                   	pop    %ebx
+  801e37:	5e                   	pop    %esi
+  801e38:	5d                   	pop    %ebp
+  801e39:	c3                   	ret
+		return -E_NOT_SUPP;
+  801e3a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e3f:	eb f2                	jmp    801e33 <fstat+0x67>
+
+00801e41 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e41:	55                   	push   %ebp
+  801e42:	89 e5                	mov    %esp,%ebp
+  801e44:	56                   	push   %esi
+  801e45:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801e46:	83 ec 08             	sub    $0x8,%esp
+  801e49:	6a 00                	push   $0x0
+  801e4b:	ff 75 08             	push   0x8(%ebp)
+  801e4e:	e8 bc 02 00 00       	call   80210f <open>
+  801e53:	89 c3                	mov    %eax,%ebx
+  801e55:	83 c4 10             	add    $0x10,%esp
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	78 1b                	js     801e77 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801e5c:	83 ec 08             	sub    $0x8,%esp
+  801e5f:	ff 75 0c             	push   0xc(%ebp)
+  801e62:	50                   	push   %eax
+  801e63:	e8 64 ff ff ff       	call   801dcc <fstat>
+  801e68:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801e6a:	89 1c 24             	mov    %ebx,(%esp)
+  801e6d:	e8 26 fc ff ff       	call   801a98 <close>
+	return r;
+  801e72:	83 c4 10             	add    $0x10,%esp
+  801e75:	89 f3                	mov    %esi,%ebx
+}
+  801e77:	89 d8                	mov    %ebx,%eax
+  801e79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7c:	5b                   	pop    %ebx
+  801e7d:	5e                   	pop    %esi
+  801e7e:	5d                   	pop    %ebp
+  801e7f:	c3                   	ret
+
+00801e80 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  801e80:	55                   	push   %ebp
+  801e81:	89 e5                	mov    %esp,%ebp
+  801e83:	57                   	push   %edi
+  801e84:	56                   	push   %esi
+  801e85:	53                   	push   %ebx
+  801e86:	83 ec 0c             	sub    $0xc,%esp
+  801e89:	89 c7                	mov    %eax,%edi
+  801e8b:	89 d3                	mov    %edx,%ebx
+  801e8d:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  801e8f:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  801e96:	74 2d                	je     801ec5 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e98:	6a 07                	push   $0x7
+  801e9a:	68 00 00 81 00       	push   $0x810000
+  801e9f:	57                   	push   %edi
+  801ea0:	ff 35 00 80 80 00    	push   0x808000
+  801ea6:	e8 90 38 00 00       	call   80573b <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  801eab:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801eb2:	6a 00                	push   $0x0
+  801eb4:	56                   	push   %esi
+  801eb5:	53                   	push   %ebx
+  801eb6:	6a 00                	push   $0x0
+  801eb8:	e8 30 37 00 00       	call   8055ed <ipc_recv_pages>
+}
+  801ebd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ec0:	5b                   	pop    %ebx
+  801ec1:	5e                   	pop    %esi
+  801ec2:	5f                   	pop    %edi
+  801ec3:	5d                   	pop    %ebp
+  801ec4:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801ec5:	83 ec 0c             	sub    $0xc,%esp
+  801ec8:	6a 01                	push   $0x1
+  801eca:	e8 61 39 00 00       	call   805830 <ipc_find_env>
+  801ecf:	a3 00 80 80 00       	mov    %eax,0x808000
+  801ed4:	83 c4 10             	add    $0x10,%esp
+  801ed7:	eb bf                	jmp    801e98 <fsipc_pages+0x18>
+
+00801ed9 <fsipc>:
+{
+  801ed9:	55                   	push   %ebp
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801edf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ee4:	e8 97 ff ff ff       	call   801e80 <fsipc_pages>
+}
+  801ee9:	c9                   	leave
+  801eea:	c3                   	ret
+
+00801eeb <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ef1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ef7:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  801efc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eff:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801f04:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f09:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f0e:	e8 c6 ff ff ff       	call   801ed9 <fsipc>
+}
+  801f13:	c9                   	leave
+  801f14:	c3                   	ret
+
+00801f15 <devfile_flush>:
+{
+  801f15:	55                   	push   %ebp
+  801f16:	89 e5                	mov    %esp,%ebp
+  801f18:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f21:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801f26:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f30:	e8 a4 ff ff ff       	call   801ed9 <fsipc>
+}
+  801f35:	c9                   	leave
+  801f36:	c3                   	ret
+
+00801f37 <devfile_stat>:
+{
+  801f37:	55                   	push   %ebp
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	53                   	push   %ebx
+  801f3b:	83 ec 04             	sub    $0x4,%esp
+  801f3e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f44:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f47:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f51:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f56:	e8 7e ff ff ff       	call   801ed9 <fsipc>
+  801f5b:	85 c0                	test   %eax,%eax
+  801f5d:	78 2c                	js     801f8b <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f5f:	83 ec 08             	sub    $0x8,%esp
+  801f62:	68 00 00 81 00       	push   $0x810000
+  801f67:	53                   	push   %ebx
+  801f68:	e8 4b e9 ff ff       	call   8008b8 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801f6d:	a1 80 00 81 00       	mov    0x810080,%eax
+  801f72:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f78:	a1 84 00 81 00       	mov    0x810084,%eax
+  801f7d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801f83:	83 c4 10             	add    $0x10,%esp
+  801f86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f8b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+
+00801f90 <devfile_write>:
+{
+  801f90:	55                   	push   %ebp
+  801f91:	89 e5                	mov    %esp,%ebp
+  801f93:	83 ec 0c             	sub    $0xc,%esp
+  801f96:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801f99:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  801f9e:	39 d0                	cmp    %edx,%eax
+  801fa0:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fa3:	8b 55 08             	mov    0x8(%ebp),%edx
+  801fa6:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fa9:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  801faf:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801fb4:	50                   	push   %eax
+  801fb5:	ff 75 0c             	push   0xc(%ebp)
+  801fb8:	68 08 00 81 00       	push   $0x810008
+  801fbd:	e8 7c ea ff ff       	call   800a3e <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801fc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc7:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fcc:	e8 08 ff ff ff       	call   801ed9 <fsipc>
+}
+  801fd1:	c9                   	leave
+  801fd2:	c3                   	ret
+
+00801fd3 <devfile_read>:
+{
+  801fd3:	55                   	push   %ebp
+  801fd4:	89 e5                	mov    %esp,%ebp
+  801fd6:	57                   	push   %edi
+  801fd7:	56                   	push   %esi
+  801fd8:	53                   	push   %ebx
+  801fd9:	83 ec 1c             	sub    $0x1c,%esp
+  801fdc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801fdf:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801fe2:	89 fe                	mov    %edi,%esi
+  801fe4:	c1 ee 0c             	shr    $0xc,%esi
+  801fe7:	b8 20 00 00 00       	mov    $0x20,%eax
+  801fec:	39 c6                	cmp    %eax,%esi
+  801fee:	0f 47 f0             	cmova  %eax,%esi
+  801ff1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ff4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ff9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801ffc:	eb 14                	jmp    802012 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801ffe:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  802005:	05 00 10 00 00       	add    $0x1000,%eax
+  80200a:	f6 c6 06             	test   $0x6,%dh
+  80200d:	75 42                	jne    802051 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  80200f:	83 c1 01             	add    $0x1,%ecx
+  802012:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802015:	39 f1                	cmp    %esi,%ecx
+  802017:	0f 84 95 00 00 00    	je     8020b2 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80201d:	89 c2                	mov    %eax,%edx
+  80201f:	c1 ea 16             	shr    $0x16,%edx
+  802022:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  802029:	f6 c2 01             	test   $0x1,%dl
+  80202c:	74 23                	je     802051 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80202e:	89 c2                	mov    %eax,%edx
+  802030:	c1 ea 0c             	shr    $0xc,%edx
+  802033:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80203a:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  802040:	74 0f                	je     802051 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  802042:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  802049:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  80204f:	75 ad                	jne    801ffe <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802051:	85 c9                	test   %ecx,%ecx
+  802053:	74 11                	je     802066 <devfile_read+0x93>
+  802055:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80205c:	75 08                	jne    802066 <devfile_read+0x93>
+  80205e:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802064:	74 50                	je     8020b6 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802066:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802069:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  80206e:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802074:	ba 00 00 00 00       	mov    $0x0,%edx
+  802079:	b8 03 00 00 00       	mov    $0x3,%eax
+  80207e:	e8 56 fe ff ff       	call   801ed9 <fsipc>
+  802083:	89 c6                	mov    %eax,%esi
+  802085:	85 c0                	test   %eax,%eax
+  802087:	78 1f                	js     8020a8 <devfile_read+0xd5>
+	assert(r <= n);
+  802089:	39 c7                	cmp    %eax,%edi
+  80208b:	72 50                	jb     8020dd <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  80208d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802092:	7f 62                	jg     8020f6 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802094:	83 ec 04             	sub    $0x4,%esp
+  802097:	50                   	push   %eax
+  802098:	68 00 00 81 00       	push   $0x810000
+  80209d:	ff 75 0c             	push   0xc(%ebp)
+  8020a0:	e8 99 e9 ff ff       	call   800a3e <memmove>
+	return r;
+  8020a5:	83 c4 10             	add    $0x10,%esp
+}
+  8020a8:	89 f0                	mov    %esi,%eax
+  8020aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ad:	5b                   	pop    %ebx
+  8020ae:	5e                   	pop    %esi
+  8020af:	5f                   	pop    %edi
+  8020b0:	5d                   	pop    %ebp
+  8020b1:	c3                   	ret
+  8020b2:	89 f1                	mov    %esi,%ecx
+  8020b4:	eb 9b                	jmp    802051 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8020b6:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8020b9:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8020be:	89 c8                	mov    %ecx,%eax
+  8020c0:	c1 e0 0c             	shl    $0xc,%eax
+  8020c3:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  8020c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8020cb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8020d0:	e8 ab fd ff ff       	call   801e80 <fsipc_pages>
+  8020d5:	89 c6                	mov    %eax,%esi
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	78 8b                	js     802066 <devfile_read+0x93>
+  8020db:	eb cb                	jmp    8020a8 <devfile_read+0xd5>
+	assert(r <= n);
+  8020dd:	68 94 60 80 00       	push   $0x806094
+  8020e2:	68 9b 60 80 00       	push   $0x80609b
+  8020e7:	68 a0 00 00 00       	push   $0xa0
+  8020ec:	68 b0 60 80 00       	push   $0x8060b0
+  8020f1:	e8 00 e1 ff ff       	call   8001f6 <_panic>
+	assert(r <= PGSIZE);
+  8020f6:	68 bb 60 80 00       	push   $0x8060bb
+  8020fb:	68 9b 60 80 00       	push   $0x80609b
+  802100:	68 a1 00 00 00       	push   $0xa1
+  802105:	68 b0 60 80 00       	push   $0x8060b0
+  80210a:	e8 e7 e0 ff ff       	call   8001f6 <_panic>
+
+0080210f <open>:
+{
+  80210f:	55                   	push   %ebp
+  802110:	89 e5                	mov    %esp,%ebp
+  802112:	56                   	push   %esi
+  802113:	53                   	push   %ebx
+  802114:	83 ec 1c             	sub    $0x1c,%esp
+  802117:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80211a:	56                   	push   %esi
+  80211b:	e8 5d e7 ff ff       	call   80087d <strlen>
+  802120:	83 c4 10             	add    $0x10,%esp
+  802123:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802128:	7f 6c                	jg     802196 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80212a:	83 ec 0c             	sub    $0xc,%esp
+  80212d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802130:	50                   	push   %eax
+  802131:	e8 eb f7 ff ff       	call   801921 <fd_alloc>
+  802136:	89 c3                	mov    %eax,%ebx
+  802138:	83 c4 10             	add    $0x10,%esp
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	78 3c                	js     80217b <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  80213f:	83 ec 08             	sub    $0x8,%esp
+  802142:	56                   	push   %esi
+  802143:	68 00 00 81 00       	push   $0x810000
+  802148:	e8 6b e7 ff ff       	call   8008b8 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80214d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802150:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802155:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802158:	b8 01 00 00 00       	mov    $0x1,%eax
+  80215d:	e8 77 fd ff ff       	call   801ed9 <fsipc>
+  802162:	89 c3                	mov    %eax,%ebx
+  802164:	83 c4 10             	add    $0x10,%esp
+  802167:	85 c0                	test   %eax,%eax
+  802169:	78 19                	js     802184 <open+0x75>
+	return fd2num(fd);
+  80216b:	83 ec 0c             	sub    $0xc,%esp
+  80216e:	ff 75 f4             	push   -0xc(%ebp)
+  802171:	e8 84 f7 ff ff       	call   8018fa <fd2num>
+  802176:	89 c3                	mov    %eax,%ebx
+  802178:	83 c4 10             	add    $0x10,%esp
+}
+  80217b:	89 d8                	mov    %ebx,%eax
+  80217d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802180:	5b                   	pop    %ebx
+  802181:	5e                   	pop    %esi
+  802182:	5d                   	pop    %ebp
+  802183:	c3                   	ret
+		fd_close(fd, 0);
+  802184:	83 ec 08             	sub    $0x8,%esp
+  802187:	6a 00                	push   $0x0
+  802189:	ff 75 f4             	push   -0xc(%ebp)
+  80218c:	e8 80 f8 ff ff       	call   801a11 <fd_close>
+		return r;
+  802191:	83 c4 10             	add    $0x10,%esp
+  802194:	eb e5                	jmp    80217b <open+0x6c>
+		return -E_BAD_PATH;
+  802196:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80219b:	eb de                	jmp    80217b <open+0x6c>
+
+0080219d <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80219d:	55                   	push   %ebp
+  80219e:	89 e5                	mov    %esp,%ebp
+  8021a0:	53                   	push   %ebx
+  8021a1:	83 ec 10             	sub    $0x10,%esp
+  8021a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8021a7:	53                   	push   %ebx
+  8021a8:	e8 d0 e6 ff ff       	call   80087d <strlen>
+  8021ad:	83 c4 10             	add    $0x10,%esp
+  8021b0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021b5:	7f 25                	jg     8021dc <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8021b7:	83 ec 08             	sub    $0x8,%esp
+  8021ba:	53                   	push   %ebx
+  8021bb:	68 00 00 81 00       	push   $0x810000
+  8021c0:	e8 f3 e6 ff ff       	call   8008b8 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8021c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ca:	b8 07 00 00 00       	mov    $0x7,%eax
+  8021cf:	e8 05 fd ff ff       	call   801ed9 <fsipc>
+  8021d4:	83 c4 10             	add    $0x10,%esp
+}
+  8021d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021da:	c9                   	leave
+  8021db:	c3                   	ret
+		return -E_BAD_PATH;
+  8021dc:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8021e1:	eb f4                	jmp    8021d7 <remove+0x3a>
+
+008021e3 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8021e3:	55                   	push   %ebp
+  8021e4:	89 e5                	mov    %esp,%ebp
+  8021e6:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8021e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ee:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021f3:	e8 e1 fc ff ff       	call   801ed9 <fsipc>
+}
+  8021f8:	c9                   	leave
+  8021f9:	c3                   	ret
+
+008021fa <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  8021fa:	55                   	push   %ebp
+  8021fb:	89 e5                	mov    %esp,%ebp
+  8021fd:	53                   	push   %ebx
+  8021fe:	83 ec 04             	sub    $0x4,%esp
+  802201:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  802204:	ba 00 00 00 00       	mov    $0x0,%edx
+  802209:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80220e:	e8 c6 fc ff ff       	call   801ed9 <fsipc>
+  802213:	85 c0                	test   %eax,%eax
+  802215:	78 3c                	js     802253 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802217:	a1 00 00 81 00       	mov    0x810000,%eax
+  80221c:	89 03                	mov    %eax,(%ebx)
+  80221e:	a1 04 00 81 00       	mov    0x810004,%eax
+  802223:	89 43 04             	mov    %eax,0x4(%ebx)
+  802226:	a1 08 00 81 00       	mov    0x810008,%eax
+  80222b:	89 43 08             	mov    %eax,0x8(%ebx)
+  80222e:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  802233:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802236:	a1 10 00 81 00       	mov    0x810010,%eax
+  80223b:	89 43 10             	mov    %eax,0x10(%ebx)
+  80223e:	a1 14 00 81 00       	mov    0x810014,%eax
+  802243:	89 43 14             	mov    %eax,0x14(%ebx)
+  802246:	a1 18 00 81 00       	mov    0x810018,%eax
+  80224b:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  80224e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802253:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802256:	c9                   	leave
+  802257:	c3                   	ret
+
+00802258 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  802258:	55                   	push   %ebp
+  802259:	89 e5                	mov    %esp,%ebp
+  80225b:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  80225e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802261:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  802266:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802270:	e8 64 fc ff ff       	call   801ed9 <fsipc>
+}
+  802275:	c9                   	leave
+  802276:	c3                   	ret
+
+00802277 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802277:	55                   	push   %ebp
+  802278:	89 e5                	mov    %esp,%ebp
+  80227a:	57                   	push   %edi
+  80227b:	56                   	push   %esi
+  80227c:	53                   	push   %ebx
+  80227d:	81 ec 14 03 00 00    	sub    $0x314,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802283:	6a 00                	push   $0x0
+  802285:	ff 75 08             	push   0x8(%ebp)
+  802288:	e8 82 fe ff ff       	call   80210f <open>
+  80228d:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	85 c0                	test   %eax,%eax
+  802298:	0f 88 06 06 00 00    	js     8028a4 <spawn+0x62d>
+  80229e:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  8022a0:	83 ec 04             	sub    $0x4,%esp
+  8022a3:	68 00 02 00 00       	push   $0x200
+  8022a8:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8022ae:	50                   	push   %eax
+  8022af:	51                   	push   %ecx
+  8022b0:	e8 a6 f9 ff ff       	call   801c5b <readn>
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8022bd:	75 74                	jne    802333 <spawn+0xbc>
+	    || elf->e_magic != ELF_MAGIC) {
+  8022bf:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8022c6:	45 4c 46 
+  8022c9:	75 68                	jne    802333 <spawn+0xbc>
+  8022cb:	b8 07 00 00 00       	mov    $0x7,%eax
+  8022d0:	cd 30                	int    $0x30
+  8022d2:	89 85 0c fd ff ff    	mov    %eax,-0x2f4(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8022d8:	85 c0                	test   %eax,%eax
+  8022da:	0f 88 b8 05 00 00    	js     802898 <spawn+0x621>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8022e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8022e5:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8022e8:	c1 e6 06             	shl    $0x6,%esi
+  8022eb:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8022f1:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8022f7:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8022fc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8022fe:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802304:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  80230a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  80230f:	be 00 00 00 00       	mov    $0x0,%esi
+  802314:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802317:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80231a:	85 c0                	test   %eax,%eax
+  80231c:	74 4d                	je     80236b <spawn+0xf4>
+		string_size += strlen(argv[argc]) + 1;
+  80231e:	83 ec 0c             	sub    $0xc,%esp
+  802321:	50                   	push   %eax
+  802322:	e8 56 e5 ff ff       	call   80087d <strlen>
+  802327:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  80232b:	83 c3 01             	add    $0x1,%ebx
+  80232e:	83 c4 10             	add    $0x10,%esp
+  802331:	eb e4                	jmp    802317 <spawn+0xa0>
+		close(fd);
+  802333:	83 ec 0c             	sub    $0xc,%esp
+  802336:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  80233c:	e8 57 f7 ff ff       	call   801a98 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802341:	83 c4 0c             	add    $0xc,%esp
+  802344:	68 7f 45 4c 46       	push   $0x464c457f
+  802349:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  80234f:	68 c7 60 80 00       	push   $0x8060c7
+  802354:	e8 78 df ff ff       	call   8002d1 <cprintf>
+		return -E_NOT_EXEC;
+  802359:	83 c4 10             	add    $0x10,%esp
+  80235c:	c7 85 10 fd ff ff f2 	movl   $0xfffffff2,-0x2f0(%ebp)
+  802363:	ff ff ff 
+  802366:	e9 39 05 00 00       	jmp    8028a4 <spawn+0x62d>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  80236b:	89 9d 04 fd ff ff    	mov    %ebx,-0x2fc(%ebp)
+  802371:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802376:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802378:	89 fa                	mov    %edi,%edx
+  80237a:	83 e2 fc             	and    $0xfffffffc,%edx
+  80237d:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802384:	29 c2                	sub    %eax,%edx
+  802386:	89 95 14 fd ff ff    	mov    %edx,-0x2ec(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  80238c:	8d 42 f8             	lea    -0x8(%edx),%eax
+  80238f:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802394:	0f 86 18 05 00 00    	jbe    8028b2 <spawn+0x63b>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80239a:	83 ec 04             	sub    $0x4,%esp
+  80239d:	6a 07                	push   $0x7
+  80239f:	68 00 00 40 00       	push   $0x400000
+  8023a4:	6a 00                	push   $0x0
+  8023a6:	e8 00 ea ff ff       	call   800dab <sys_page_alloc>
+  8023ab:	83 c4 10             	add    $0x10,%esp
+  8023ae:	85 c0                	test   %eax,%eax
+  8023b0:	0f 88 01 05 00 00    	js     8028b7 <spawn+0x640>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8023b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023bb:	89 9d 08 fd ff ff    	mov    %ebx,-0x2f8(%ebp)
+  8023c1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8023c4:	eb 30                	jmp    8023f6 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8023c6:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8023cc:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  8023d2:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8023d5:	83 ec 08             	sub    $0x8,%esp
+  8023d8:	ff 34 b3             	push   (%ebx,%esi,4)
+  8023db:	57                   	push   %edi
+  8023dc:	e8 d7 e4 ff ff       	call   8008b8 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8023e1:	83 c4 04             	add    $0x4,%esp
+  8023e4:	ff 34 b3             	push   (%ebx,%esi,4)
+  8023e7:	e8 91 e4 ff ff       	call   80087d <strlen>
+  8023ec:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8023f0:	83 c6 01             	add    $0x1,%esi
+  8023f3:	83 c4 10             	add    $0x10,%esp
+  8023f6:	39 b5 08 fd ff ff    	cmp    %esi,-0x2f8(%ebp)
+  8023fc:	7f c8                	jg     8023c6 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  8023fe:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  802404:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  80240a:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802411:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802417:	0f 85 fb 00 00 00    	jne    802518 <spawn+0x2a1>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  80241d:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  802423:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  802429:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  80242c:	89 c8                	mov    %ecx,%eax
+  80242e:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  802434:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802437:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80243c:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802442:	83 ec 0c             	sub    $0xc,%esp
+  802445:	6a 07                	push   $0x7
+  802447:	68 00 d0 bf ee       	push   $0xeebfd000
+  80244c:	8b b5 0c fd ff ff    	mov    -0x2f4(%ebp),%esi
+  802452:	56                   	push   %esi
+  802453:	68 00 00 40 00       	push   $0x400000
+  802458:	6a 00                	push   $0x0
+  80245a:	e8 8f e9 ff ff       	call   800dee <sys_page_map>
+  80245f:	89 c3                	mov    %eax,%ebx
+  802461:	83 c4 20             	add    $0x20,%esp
+  802464:	85 c0                	test   %eax,%eax
+  802466:	0f 88 53 04 00 00    	js     8028bf <spawn+0x648>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80246c:	83 ec 08             	sub    $0x8,%esp
+  80246f:	68 00 00 40 00       	push   $0x400000
+  802474:	6a 00                	push   $0x0
+  802476:	e8 b5 e9 ff ff       	call   800e30 <sys_page_unmap>
+  80247b:	89 c3                	mov    %eax,%ebx
+  80247d:	83 c4 10             	add    $0x10,%esp
+  802480:	85 c0                	test   %eax,%eax
+  802482:	0f 88 37 04 00 00    	js     8028bf <spawn+0x648>
+	if ((r = fd_lookup(fd, &fdp)) < 0)
+  802488:	83 ec 08             	sub    $0x8,%esp
+  80248b:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  802491:	50                   	push   %eax
+  802492:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  802498:	e8 d8 f4 ff ff       	call   801975 <fd_lookup>
+  80249d:	89 c7                	mov    %eax,%edi
+  80249f:	83 c4 10             	add    $0x10,%esp
+  8024a2:	85 c0                	test   %eax,%eax
+  8024a4:	0f 88 d6 01 00 00    	js     802680 <spawn+0x409>
+	if ((r = sys_page_map(0, fdp, child, (void*) PROGFD, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8024aa:	83 ec 0c             	sub    $0xc,%esp
+  8024ad:	68 07 04 00 00       	push   $0x407
+  8024b2:	68 00 f0 ff cf       	push   $0xcffff000
+  8024b7:	56                   	push   %esi
+  8024b8:	ff b5 a0 fd ff ff    	push   -0x260(%ebp)
+  8024be:	6a 00                	push   $0x0
+  8024c0:	e8 29 e9 ff ff       	call   800dee <sys_page_map>
+  8024c5:	89 c7                	mov    %eax,%edi
+  8024c7:	83 c4 20             	add    $0x20,%esp
+  8024ca:	85 c0                	test   %eax,%eax
+  8024cc:	0f 88 ae 01 00 00    	js     802680 <spawn+0x409>
+	pager = ipc_find_env(ENV_TYPE_FS);
+  8024d2:	83 ec 0c             	sub    $0xc,%esp
+  8024d5:	6a 01                	push   $0x1
+  8024d7:	e8 54 33 00 00       	call   805830 <ipc_find_env>
+  8024dc:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%ebp)
+	memset(segs, 0, sizeof(segs));
+  8024e2:	83 c4 0c             	add    $0xc,%esp
+  8024e5:	68 80 00 00 00       	push   $0x80
+  8024ea:	6a 00                	push   $0x0
+  8024ec:	8d 9d 20 fd ff ff    	lea    -0x2e0(%ebp),%ebx
+  8024f2:	53                   	push   %ebx
+  8024f3:	e8 11 e5 ff ff       	call   800a09 <memset>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  8024f8:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8024fe:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802505:	83 c4 10             	add    $0x10,%esp
+  802508:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250d:	89 fe                	mov    %edi,%esi
+  80250f:	89 d1                	mov    %edx,%ecx
+  802511:	89 da                	mov    %ebx,%edx
+  802513:	e9 bf 01 00 00       	jmp    8026d7 <spawn+0x460>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802518:	68 3c 61 80 00       	push   $0x80613c
+  80251d:	68 9b 60 80 00       	push   $0x80609b
+  802522:	68 17 01 00 00       	push   $0x117
+  802527:	68 e1 60 80 00       	push   $0x8060e1
+  80252c:	e8 c5 dc ff ff       	call   8001f6 <_panic>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802531:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802534:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+  80253a:	8b 46 10             	mov    0x10(%esi),%eax
+  80253d:	89 85 14 fd ff ff    	mov    %eax,-0x2ec(%ebp)
+  802543:	8b 7e 14             	mov    0x14(%esi),%edi
+  802546:	89 bd 08 fd ff ff    	mov    %edi,-0x2f8(%ebp)
+  80254c:	8b 7e 08             	mov    0x8(%esi),%edi
+	int i, r;
+	void *blk;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  80254f:	89 f8                	mov    %edi,%eax
+  802551:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802556:	74 16                	je     80256e <spawn+0x2f7>
+		va -= i;
+  802558:	29 c7                	sub    %eax,%edi
+		memsz += i;
+  80255a:	01 85 08 fd ff ff    	add    %eax,-0x2f8(%ebp)
+		filesz += i;
+  802560:	01 85 14 fd ff ff    	add    %eax,-0x2ec(%ebp)
+		fileoffset -= i;
+  802566:	29 c3                	sub    %eax,%ebx
+  802568:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+	}
+
+	for (i = 0; i < memsz; i += PGSIZE) {
+  80256e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802573:	89 8d fc fc ff ff    	mov    %ecx,-0x304(%ebp)
+  802579:	89 b5 f8 fc ff ff    	mov    %esi,-0x308(%ebp)
+  80257f:	8b b5 14 fd ff ff    	mov    -0x2ec(%ebp),%esi
+  802585:	89 95 f4 fc ff ff    	mov    %edx,-0x30c(%ebp)
+  80258b:	e9 ba 00 00 00       	jmp    80264a <spawn+0x3d3>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802590:	83 ec 04             	sub    $0x4,%esp
+  802593:	6a 07                	push   $0x7
+  802595:	68 00 00 40 00       	push   $0x400000
+  80259a:	6a 00                	push   $0x0
+  80259c:	e8 0a e8 ff ff       	call   800dab <sys_page_alloc>
+  8025a1:	83 c4 10             	add    $0x10,%esp
+  8025a4:	85 c0                	test   %eax,%eax
+  8025a6:	0f 88 d7 02 00 00    	js     802883 <spawn+0x60c>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  8025ac:	83 ec 08             	sub    $0x8,%esp
+  8025af:	8b 95 00 fd ff ff    	mov    -0x300(%ebp),%edx
+  8025b5:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  8025bb:	01 d0                	add    %edx,%eax
+  8025bd:	50                   	push   %eax
+  8025be:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8025c4:	e8 5b f7 ff ff       	call   801d24 <seek>
+  8025c9:	83 c4 10             	add    $0x10,%esp
+  8025cc:	85 c0                	test   %eax,%eax
+  8025ce:	0f 88 b6 02 00 00    	js     80288a <spawn+0x613>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  8025d4:	83 ec 04             	sub    $0x4,%esp
+  8025d7:	89 f2                	mov    %esi,%edx
+  8025d9:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  8025df:	29 ca                	sub    %ecx,%edx
+  8025e1:	89 d0                	mov    %edx,%eax
+  8025e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8025e8:	39 d0                	cmp    %edx,%eax
+  8025ea:	0f 47 c2             	cmova  %edx,%eax
+  8025ed:	50                   	push   %eax
+  8025ee:	68 00 00 40 00       	push   $0x400000
+  8025f3:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8025f9:	e8 5d f6 ff ff       	call   801c5b <readn>
+  8025fe:	83 c4 10             	add    $0x10,%esp
+  802601:	85 c0                	test   %eax,%eax
+  802603:	0f 88 88 02 00 00    	js     802891 <spawn+0x61a>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  802609:	83 ec 0c             	sub    $0xc,%esp
+  80260c:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  802612:	57                   	push   %edi
+  802613:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802619:	68 00 00 40 00       	push   $0x400000
+  80261e:	6a 00                	push   $0x0
+  802620:	e8 c9 e7 ff ff       	call   800dee <sys_page_map>
+  802625:	83 c4 20             	add    $0x20,%esp
+  802628:	85 c0                	test   %eax,%eax
+  80262a:	78 7e                	js     8026aa <spawn+0x433>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  80262c:	83 ec 08             	sub    $0x8,%esp
+  80262f:	68 00 00 40 00       	push   $0x400000
+  802634:	6a 00                	push   $0x0
+  802636:	e8 f5 e7 ff ff       	call   800e30 <sys_page_unmap>
+  80263b:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  80263e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802644:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80264a:	89 9d 14 fd ff ff    	mov    %ebx,-0x2ec(%ebp)
+  802650:	8b 85 08 fd ff ff    	mov    -0x2f8(%ebp),%eax
+  802656:	39 c3                	cmp    %eax,%ebx
+  802658:	73 65                	jae    8026bf <spawn+0x448>
+		if (i >= filesz) {
+  80265a:	39 f3                	cmp    %esi,%ebx
+  80265c:	0f 82 2e ff ff ff    	jb     802590 <spawn+0x319>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  802662:	83 ec 04             	sub    $0x4,%esp
+  802665:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  80266b:	57                   	push   %edi
+  80266c:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802672:	e8 34 e7 ff ff       	call   800dab <sys_page_alloc>
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	79 c0                	jns    80263e <spawn+0x3c7>
+  80267e:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802680:	83 ec 0c             	sub    $0xc,%esp
+  802683:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802689:	e8 9e e6 ff ff       	call   800d2c <sys_env_destroy>
+	close(fd);
+  80268e:	83 c4 04             	add    $0x4,%esp
+  802691:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  802697:	e8 fc f3 ff ff       	call   801a98 <close>
+	return r;
+  80269c:	83 c4 10             	add    $0x10,%esp
+  80269f:	89 bd 10 fd ff ff    	mov    %edi,-0x2f0(%ebp)
+  8026a5:	e9 fa 01 00 00       	jmp    8028a4 <spawn+0x62d>
+				panic("spawn: sys_page_map data: %e", r);
+  8026aa:	50                   	push   %eax
+  8026ab:	68 ed 60 80 00       	push   $0x8060ed
+  8026b0:	68 4a 01 00 00       	push   $0x14a
+  8026b5:	68 e1 60 80 00       	push   $0x8060e1
+  8026ba:	e8 37 db ff ff       	call   8001f6 <_panic>
+  8026bf:	8b 8d fc fc ff ff    	mov    -0x304(%ebp),%ecx
+  8026c5:	8b b5 f8 fc ff ff    	mov    -0x308(%ebp),%esi
+  8026cb:	8b 95 f4 fc ff ff    	mov    -0x30c(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8026d1:	83 c1 01             	add    $0x1,%ecx
+  8026d4:	83 c6 20             	add    $0x20,%esi
+  8026d7:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8026de:	39 c8                	cmp    %ecx,%eax
+  8026e0:	7e 74                	jle    802756 <spawn+0x4df>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8026e2:	83 3e 01             	cmpl   $0x1,(%esi)
+  8026e5:	75 ea                	jne    8026d1 <spawn+0x45a>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8026e7:	8b 46 18             	mov    0x18(%esi),%eax
+  8026ea:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8026ed:	83 f8 01             	cmp    $0x1,%eax
+  8026f0:	19 ff                	sbb    %edi,%edi
+  8026f2:	83 e7 fe             	and    $0xfffffffe,%edi
+  8026f5:	83 c7 07             	add    $0x7,%edi
+  8026f8:	89 bd 04 fd ff ff    	mov    %edi,-0x2fc(%ebp)
+		if (seg < segs + NSEGS) {
+  8026fe:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  802704:	39 c2                	cmp    %eax,%edx
+  802706:	0f 83 25 fe ff ff    	jae    802531 <spawn+0x2ba>
+			seg->seg_va = ROUNDDOWN(ph->p_va, PGSIZE);
+  80270c:	8b 46 08             	mov    0x8(%esi),%eax
+  80270f:	89 c3                	mov    %eax,%ebx
+  802711:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802717:	89 1a                	mov    %ebx,(%edx)
+			seg->seg_memsz = ph->p_memsz + PGOFF(ph->p_va);
+  802719:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80271e:	89 c3                	mov    %eax,%ebx
+  802720:	03 5e 14             	add    0x14(%esi),%ebx
+  802723:	89 5a 04             	mov    %ebx,0x4(%edx)
+			seg->seg_filesz = ph->p_filesz + PGOFF(ph->p_va);
+  802726:	89 c3                	mov    %eax,%ebx
+  802728:	03 5e 10             	add    0x10(%esi),%ebx
+  80272b:	89 5a 08             	mov    %ebx,0x8(%edx)
+			seg->seg_offset = ph->p_offset - PGOFF(ph->p_va);
+  80272e:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802731:	29 c3                	sub    %eax,%ebx
+  802733:	89 5a 0c             	mov    %ebx,0xc(%edx)
+			seg->seg_perm = perm;
+  802736:	89 7a 10             	mov    %edi,0x10(%edx)
+			seg->seg_pager = pager;
+  802739:	8b 85 f0 fc ff ff    	mov    -0x310(%ebp),%eax
+  80273f:	89 42 14             	mov    %eax,0x14(%edx)
+			seg->seg_fileid = fdp->fd_file.id;
+  802742:	8b 85 a0 fd ff ff    	mov    -0x260(%ebp),%eax
+  802748:	8b 40 0c             	mov    0xc(%eax),%eax
+  80274b:	89 42 18             	mov    %eax,0x18(%edx)
+			seg++;
+  80274e:	83 c2 20             	add    $0x20,%edx
+			continue;
+  802751:	e9 7b ff ff ff       	jmp    8026d1 <spawn+0x45a>
+	if ((r = sys_env_set_segments(child, segs, seg - segs)) < 0)
+  802756:	89 d1                	mov    %edx,%ecx
+  802758:	83 ec 04             	sub    $0x4,%esp
+  80275b:	8d 95 20 fd ff ff    	lea    -0x2e0(%ebp),%edx
+  802761:	89 c8                	mov    %ecx,%eax
+  802763:	29 d0                	sub    %edx,%eax
+  802765:	c1 f8 05             	sar    $0x5,%eax
+  802768:	50                   	push   %eax
+  802769:	52                   	push   %edx
+  80276a:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802770:	e8 48 e9 ff ff       	call   8010bd <sys_env_set_segments>
+  802775:	89 c7                	mov    %eax,%edi
+  802777:	83 c4 10             	add    $0x10,%esp
+  80277a:	85 c0                	test   %eax,%eax
+  80277c:	0f 88 fe fe ff ff    	js     802680 <spawn+0x409>
+	close(fd);
+  802782:	83 ec 0c             	sub    $0xc,%esp
+  802785:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  80278b:	e8 08 f3 ff ff       	call   801a98 <close>
+  802790:	83 c4 10             	add    $0x10,%esp
+	// Copy the mappings for shared pages into the child address.
+	// We need to iterate through all PTEs for addresses below UTOP.
+	// However, we handle the exception stack separately, so we only need to iterate up until UXSTACKTOP-PGSIZE.
+	// Since [USTACKTOP, UXSTACKTOP-PGSIZE) is empty memory, we can get away with only iterating up until USTACKTOP.
+	// This is the same as iterating through pages 0 through PGNUM(USTACKTOP)-1 inclusive.
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  802793:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802798:	eb 2d                	jmp    8027c7 <spawn+0x550>
+		// We only copy this page if it is present and readable in user mode, and if it is a shared page.
+		// This requires checking for PTE_P and PTE_U not only in uvpt[pn],
+		// but in the associated PDE as well, since page pn won't exist if its page table doesn't exist, i.e. if it isn't present in the page directory.
+		// Large pages are never shared (see sys_page_alloc), and have no uvpt entries.
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+			sys_page_map(0, (void *)PGADDR(0,pn,0), child, (void *)PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL);
+  80279a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8027a1:	83 ec 0c             	sub    $0xc,%esp
+  8027a4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8027a9:	50                   	push   %eax
+  8027aa:	52                   	push   %edx
+  8027ab:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  8027b1:	52                   	push   %edx
+  8027b2:	6a 00                	push   $0x0
+  8027b4:	e8 35 e6 ff ff       	call   800dee <sys_page_map>
+  8027b9:	83 c4 20             	add    $0x20,%esp
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  8027bc:	83 c3 01             	add    $0x1,%ebx
+  8027bf:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  8027c5:	74 51                	je     802818 <spawn+0x5a1>
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+  8027c7:	89 da                	mov    %ebx,%edx
+  8027c9:	c1 e2 0c             	shl    $0xc,%edx
+  8027cc:	89 d0                	mov    %edx,%eax
+  8027ce:	c1 e8 16             	shr    $0x16,%eax
+  8027d1:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8027d8:	f6 c1 01             	test   $0x1,%cl
+  8027db:	74 df                	je     8027bc <spawn+0x545>
+  8027dd:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8027e4:	f6 c1 04             	test   $0x4,%cl
+  8027e7:	74 d3                	je     8027bc <spawn+0x545>
+  8027e9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8027f0:	a8 80                	test   $0x80,%al
+  8027f2:	75 c8                	jne    8027bc <spawn+0x545>
+  8027f4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  8027fb:	a8 01                	test   $0x1,%al
+  8027fd:	74 bd                	je     8027bc <spawn+0x545>
+  8027ff:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802806:	a8 04                	test   $0x4,%al
+  802808:	74 b2                	je     8027bc <spawn+0x545>
+  80280a:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802811:	f6 c4 04             	test   $0x4,%ah
+  802814:	74 a6                	je     8027bc <spawn+0x545>
+  802816:	eb 82                	jmp    80279a <spawn+0x523>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802818:	83 ec 08             	sub    $0x8,%esp
+  80281b:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802821:	50                   	push   %eax
+  802822:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802828:	e8 fe e7 ff ff       	call   80102b <sys_env_set_trapframe>
+  80282d:	83 c4 10             	add    $0x10,%esp
+  802830:	85 c0                	test   %eax,%eax
+  802832:	78 25                	js     802859 <spawn+0x5e2>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802834:	83 ec 08             	sub    $0x8,%esp
+  802837:	6a 02                	push   $0x2
+  802839:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80283f:	e8 a5 e7 ff ff       	call   800fe9 <sys_env_set_status>
+  802844:	83 c4 10             	add    $0x10,%esp
+  802847:	85 c0                	test   %eax,%eax
+  802849:	78 23                	js     80286e <spawn+0x5f7>
+	return child;
+  80284b:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  802851:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  802857:	eb 4b                	jmp    8028a4 <spawn+0x62d>
+		panic("sys_env_set_trapframe: %e", r);
+  802859:	50                   	push   %eax
+  80285a:	68 0a 61 80 00       	push   $0x80610a
+  80285f:	68 ab 00 00 00       	push   $0xab
+  802864:	68 e1 60 80 00       	push   $0x8060e1
+  802869:	e8 88 d9 ff ff       	call   8001f6 <_panic>
+		panic("sys_env_set_status: %e", r);
+  80286e:	50                   	push   %eax
+  80286f:	68 24 61 80 00       	push   $0x806124
+  802874:	68 ae 00 00 00       	push   $0xae
+  802879:	68 e1 60 80 00       	push   $0x8060e1
+  80287e:	e8 73 d9 ff ff       	call   8001f6 <_panic>
+  802883:	89 c7                	mov    %eax,%edi
+  802885:	e9 f6 fd ff ff       	jmp    802680 <spawn+0x409>
+  80288a:	89 c7                	mov    %eax,%edi
+  80288c:	e9 ef fd ff ff       	jmp    802680 <spawn+0x409>
+  802891:	89 c7                	mov    %eax,%edi
+  802893:	e9 e8 fd ff ff       	jmp    802680 <spawn+0x409>
+		return r;
+  802898:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  80289e:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+}
+  8028a4:	8b 85 10 fd ff ff    	mov    -0x2f0(%ebp),%eax
+  8028aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028ad:	5b                   	pop    %ebx
+  8028ae:	5e                   	pop    %esi
+  8028af:	5f                   	pop    %edi
+  8028b0:	5d                   	pop    %ebp
+  8028b1:	c3                   	ret
+		return -E_NO_MEM;
+  8028b2:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  8028b7:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  8028bd:	eb e5                	jmp    8028a4 <spawn+0x62d>
+	sys_page_unmap(0, UTEMP);
+  8028bf:	83 ec 08             	sub    $0x8,%esp
+  8028c2:	68 00 00 40 00       	push   $0x400000
+  8028c7:	6a 00                	push   $0x0
+  8028c9:	e8 62 e5 ff ff       	call   800e30 <sys_page_unmap>
+  8028ce:	83 c4 10             	add    $0x10,%esp
+  8028d1:	89 9d 10 fd ff ff    	mov    %ebx,-0x2f0(%ebp)
+  8028d7:	eb cb                	jmp    8028a4 <spawn+0x62d>
+
+008028d9 <spawnl>:
+{
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	56                   	push   %esi
+  8028dd:	53                   	push   %ebx
+	va_start(vl, arg0);
+  8028de:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  8028e1:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  8028e6:	eb 05                	jmp    8028ed <spawnl+0x14>
+		argc++;
+  8028e8:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  8028eb:	89 ca                	mov    %ecx,%edx
+  8028ed:	8d 4a 04             	lea    0x4(%edx),%ecx
+  8028f0:	83 3a 00             	cmpl   $0x0,(%edx)
+  8028f3:	75 f3                	jne    8028e8 <spawnl+0xf>
+	const char *argv[argc+2];
+  8028f5:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  8028fc:	83 e2 f0             	and    $0xfffffff0,%edx
+  8028ff:	29 d4                	sub    %edx,%esp
+  802901:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802905:	89 da                	mov    %ebx,%edx
+  802907:	c1 ea 02             	shr    $0x2,%edx
+  80290a:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  80290d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802910:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802917:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  80291e:	00 
+	va_start(vl, arg0);
+  80291f:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802922:	89 c2                	mov    %eax,%edx
+  802924:	b8 00 00 00 00       	mov    $0x0,%eax
+  802929:	eb 0b                	jmp    802936 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80292b:	83 c0 01             	add    $0x1,%eax
+  80292e:	8b 31                	mov    (%ecx),%esi
+  802930:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802933:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802936:	39 d0                	cmp    %edx,%eax
+  802938:	75 f1                	jne    80292b <spawnl+0x52>
+	return spawn(prog, argv);
+  80293a:	83 ec 08             	sub    $0x8,%esp
+  80293d:	53                   	push   %ebx
+  80293e:	ff 75 08             	push   0x8(%ebp)
+  802941:	e8 31 f9 ff ff       	call   802277 <spawn>
+}
+  802946:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802949:	5b                   	pop    %ebx
+  80294a:	5e                   	pop    %esi
+  80294b:	5d                   	pop    %ebp
+  80294c:	c3                   	ret
+
+0080294d <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80294d:	55                   	push   %ebp
+  80294e:	89 e5                	mov    %esp,%ebp
+  802950:	56                   	push   %esi
+  802951:	53                   	push   %ebx
+  802952:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802955:	83 ec 0c             	sub    $0xc,%esp
+  802958:	ff 75 08             	push   0x8(%ebp)
+  80295b:	e8 aa ef ff ff       	call   80190a <fd2data>
+  802960:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802962:	83 c4 08             	add    $0x8,%esp
+  802965:	68 62 61 80 00       	push   $0x806162
+  80296a:	53                   	push   %ebx
+  80296b:	e8 48 df ff ff       	call   8008b8 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802970:	8b 46 04             	mov    0x4(%esi),%eax
+  802973:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802979:	2b 0e                	sub    (%esi),%ecx
+  80297b:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802980:	89 c8                	mov    %ecx,%eax
+  802982:	f7 e2                	mul    %edx
+  802984:	c1 ea 0c             	shr    $0xc,%edx
+  802987:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  80298d:	29 d1                	sub    %edx,%ecx
+  80298f:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802995:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80299c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80299f:	c7 83 88 00 00 00 28 	movl   $0x807028,0x88(%ebx)
+  8029a6:	70 80 00 
+	return 0;
+}
+  8029a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029b1:	5b                   	pop    %ebx
+  8029b2:	5e                   	pop    %esi
+  8029b3:	5d                   	pop    %ebp
+  8029b4:	c3                   	ret
+
+008029b5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8029b5:	55                   	push   %ebp
+  8029b6:	89 e5                	mov    %esp,%ebp
+  8029b8:	53                   	push   %ebx
+  8029b9:	83 ec 0c             	sub    $0xc,%esp
+  8029bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  8029bf:	53                   	push   %ebx
+  8029c0:	6a 00                	push   $0x0
+  8029c2:	e8 69 e4 ff ff       	call   800e30 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  8029c7:	89 1c 24             	mov    %ebx,(%esp)
+  8029ca:	e8 3b ef ff ff       	call   80190a <fd2data>
+  8029cf:	83 c4 08             	add    $0x8,%esp
+  8029d2:	50                   	push   %eax
+  8029d3:	6a 00                	push   $0x0
+  8029d5:	e8 56 e4 ff ff       	call   800e30 <sys_page_unmap>
+}
+  8029da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029dd:	c9                   	leave
+  8029de:	c3                   	ret
+
+008029df <_pipeisclosed>:
+{
+  8029df:	55                   	push   %ebp
+  8029e0:	89 e5                	mov    %esp,%ebp
+  8029e2:	57                   	push   %edi
+  8029e3:	56                   	push   %esi
+  8029e4:	53                   	push   %ebx
+  8029e5:	83 ec 1c             	sub    $0x1c,%esp
+  8029e8:	89 c7                	mov    %eax,%edi
+  8029ea:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  8029ec:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8029f1:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  8029f4:	83 ec 0c             	sub    $0xc,%esp
+  8029f7:	57                   	push   %edi
+  8029f8:	e8 72 2e 00 00       	call   80586f <pageref>
+  8029fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a00:	89 34 24             	mov    %esi,(%esp)
+  802a03:	e8 67 2e 00 00       	call   80586f <pageref>
+		nn = thisenv->env_runs;
+  802a08:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802a0e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802a11:	83 c4 10             	add    $0x10,%esp
+  802a14:	39 cb                	cmp    %ecx,%ebx
+  802a16:	74 1b                	je     802a33 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802a18:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802a1b:	75 cf                	jne    8029ec <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802a1d:	8b 42 58             	mov    0x58(%edx),%eax
+  802a20:	6a 01                	push   $0x1
+  802a22:	50                   	push   %eax
+  802a23:	53                   	push   %ebx
+  802a24:	68 69 61 80 00       	push   $0x806169
+  802a29:	e8 a3 d8 ff ff       	call   8002d1 <cprintf>
+  802a2e:	83 c4 10             	add    $0x10,%esp
+  802a31:	eb b9                	jmp    8029ec <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802a33:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802a36:	0f 94 c0             	sete   %al
+  802a39:	0f b6 c0             	movzbl %al,%eax
+}
+  802a3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3f:	5b                   	pop    %ebx
+  802a40:	5e                   	pop    %esi
+  802a41:	5f                   	pop    %edi
+  802a42:	5d                   	pop    %ebp
+  802a43:	c3                   	ret
+
+00802a44 <devpipe_read>:
+{
+  802a44:	55                   	push   %ebp
+  802a45:	89 e5                	mov    %esp,%ebp
+  802a47:	57                   	push   %edi
+  802a48:	56                   	push   %esi
+  802a49:	53                   	push   %ebx
+  802a4a:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802a4d:	ff 75 08             	push   0x8(%ebp)
+  802a50:	e8 b5 ee ff ff       	call   80190a <fd2data>
+  802a55:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802a57:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802a5a:	8d 40 04             	lea    0x4(%eax),%eax
+  802a5d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802a60:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802a63:	8b 0b                	mov    (%ebx),%ecx
+  802a65:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802a6b:	29 ce                	sub    %ecx,%esi
+  802a6d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802a72:	f7 e6                	mul    %esi
+  802a74:	c1 ea 0c             	shr    $0xc,%edx
+  802a77:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802a7d:	29 c6                	sub    %eax,%esi
+  802a7f:	89 f2                	mov    %esi,%edx
+  802a81:	75 43                	jne    802ac6 <devpipe_read+0x82>
+		ref = pageref(p);
+  802a83:	83 ec 0c             	sub    $0xc,%esp
+  802a86:	53                   	push   %ebx
+  802a87:	e8 e3 2d 00 00       	call   80586f <pageref>
+  802a8c:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802a8e:	89 da                	mov    %ebx,%edx
+  802a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a93:	e8 47 ff ff ff       	call   8029df <_pipeisclosed>
+  802a98:	83 c4 10             	add    $0x10,%esp
+  802a9b:	85 c0                	test   %eax,%eax
+  802a9d:	0f 85 c1 00 00 00    	jne    802b64 <devpipe_read+0x120>
+	*sleeping = 1;
+  802aa3:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802aaa:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802aaf:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802ab2:	75 ac                	jne    802a60 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802ab4:	83 ec 04             	sub    $0x4,%esp
+  802ab7:	56                   	push   %esi
+  802ab8:	57                   	push   %edi
+  802ab9:	ff 75 e4             	push   -0x1c(%ebp)
+  802abc:	e8 c3 e7 ff ff       	call   801284 <sys_futex_wait>
+  802ac1:	83 c4 10             	add    $0x10,%esp
+  802ac4:	eb 9a                	jmp    802a60 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802ac6:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802ac9:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802acd:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802acf:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ad4:	f7 e1                	mul    %ecx
+  802ad6:	c1 ea 0b             	shr    $0xb,%edx
+  802ad9:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802adf:	29 c1                	sub    %eax,%ecx
+  802ae1:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802ae3:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802ae8:	29 cf                	sub    %ecx,%edi
+  802aea:	39 f7                	cmp    %esi,%edi
+  802aec:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802aef:	8d 43 10             	lea    0x10(%ebx),%eax
+  802af2:	83 ec 04             	sub    $0x4,%esp
+  802af5:	57                   	push   %edi
+  802af6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802af9:	01 c2                	add    %eax,%edx
+  802afb:	52                   	push   %edx
+  802afc:	ff 75 0c             	push   0xc(%ebp)
+  802aff:	e8 3a df ff ff       	call   800a3e <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802b04:	83 c4 0c             	add    $0xc,%esp
+  802b07:	89 f1                	mov    %esi,%ecx
+  802b09:	29 f9                	sub    %edi,%ecx
+  802b0b:	51                   	push   %ecx
+  802b0c:	ff 75 e4             	push   -0x1c(%ebp)
+  802b0f:	89 f8                	mov    %edi,%eax
+  802b11:	03 45 0c             	add    0xc(%ebp),%eax
+  802b14:	50                   	push   %eax
+  802b15:	e8 24 df ff ff       	call   800a3e <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802b1a:	89 f1                	mov    %esi,%ecx
+  802b1c:	03 0b                	add    (%ebx),%ecx
+  802b1e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802b23:	f7 e1                	mul    %ecx
+  802b25:	c1 ea 0c             	shr    $0xc,%edx
+  802b28:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802b2e:	29 d1                	sub    %edx,%ecx
+  802b30:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802b32:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802b37:	83 c4 10             	add    $0x10,%esp
+  802b3a:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802b3e:	75 0a                	jne    802b4a <devpipe_read+0x106>
+	return n;
+  802b40:	89 f0                	mov    %esi,%eax
+}
+  802b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b45:	5b                   	pop    %ebx
+  802b46:	5e                   	pop    %esi
+  802b47:	5f                   	pop    %edi
+  802b48:	5d                   	pop    %ebp
+  802b49:	c3                   	ret
+		*sleeping = 0;
+  802b4a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802b51:	83 ec 08             	sub    $0x8,%esp
+  802b54:	68 00 04 00 00       	push   $0x400
+  802b59:	53                   	push   %ebx
+  802b5a:	e8 75 e7 ff ff       	call   8012d4 <sys_futex_wake>
+  802b5f:	83 c4 10             	add    $0x10,%esp
+  802b62:	eb dc                	jmp    802b40 <devpipe_read+0xfc>
+			return 0;
+  802b64:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b69:	eb d7                	jmp    802b42 <devpipe_read+0xfe>
+
+00802b6b <devpipe_write>:
+{
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	57                   	push   %edi
+  802b6f:	56                   	push   %esi
+  802b70:	53                   	push   %ebx
+  802b71:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802b74:	ff 75 08             	push   0x8(%ebp)
+  802b77:	e8 8e ed ff ff       	call   80190a <fd2data>
+  802b7c:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802b7e:	83 c4 10             	add    $0x10,%esp
+  802b81:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802b88:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b8b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802b8e:	0f 83 23 01 00 00    	jae    802cb7 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802b94:	8b 77 04             	mov    0x4(%edi),%esi
+  802b97:	8b 1f                	mov    (%edi),%ebx
+  802b99:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802b9f:	29 d9                	sub    %ebx,%ecx
+  802ba1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802ba6:	f7 e1                	mul    %ecx
+  802ba8:	c1 ea 0c             	shr    $0xc,%edx
+  802bab:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802bb1:	29 c1                	sub    %eax,%ecx
+  802bb3:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802bb5:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802bbb:	75 40                	jne    802bfd <devpipe_write+0x92>
+			ref = pageref(p);
+  802bbd:	83 ec 0c             	sub    $0xc,%esp
+  802bc0:	57                   	push   %edi
+  802bc1:	e8 a9 2c 00 00       	call   80586f <pageref>
+  802bc6:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802bc8:	89 fa                	mov    %edi,%edx
+  802bca:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bcd:	e8 0d fe ff ff       	call   8029df <_pipeisclosed>
+  802bd2:	83 c4 10             	add    $0x10,%esp
+  802bd5:	85 c0                	test   %eax,%eax
+  802bd7:	0f 85 d5 00 00 00    	jne    802cb2 <devpipe_write+0x147>
+	*sleeping = 1;
+  802bdd:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802be4:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802be9:	39 1f                	cmp    %ebx,(%edi)
+  802beb:	75 a7                	jne    802b94 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802bed:	83 ec 04             	sub    $0x4,%esp
+  802bf0:	56                   	push   %esi
+  802bf1:	53                   	push   %ebx
+  802bf2:	57                   	push   %edi
+  802bf3:	e8 8c e6 ff ff       	call   801284 <sys_futex_wait>
+  802bf8:	83 c4 10             	add    $0x10,%esp
+  802bfb:	eb 97                	jmp    802b94 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802bfd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802c00:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c03:	29 c1                	sub    %eax,%ecx
+  802c05:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802c0a:	89 d8                	mov    %ebx,%eax
+  802c0c:	29 d0                	sub    %edx,%eax
+  802c0e:	39 c1                	cmp    %eax,%ecx
+  802c10:	0f 46 c1             	cmovbe %ecx,%eax
+  802c13:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802c15:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802c1a:	f7 e6                	mul    %esi
+  802c1c:	c1 ea 0b             	shr    $0xb,%edx
+  802c1f:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802c25:	29 c6                	sub    %eax,%esi
+  802c27:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802c29:	29 f3                	sub    %esi,%ebx
+  802c2b:	39 cb                	cmp    %ecx,%ebx
+  802c2d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802c30:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802c33:	8d 77 10             	lea    0x10(%edi),%esi
+  802c36:	83 ec 04             	sub    $0x4,%esp
+  802c39:	53                   	push   %ebx
+  802c3a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c3d:	03 45 0c             	add    0xc(%ebp),%eax
+  802c40:	50                   	push   %eax
+  802c41:	01 f2                	add    %esi,%edx
+  802c43:	52                   	push   %edx
+  802c44:	e8 f5 dd ff ff       	call   800a3e <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802c49:	83 c4 0c             	add    $0xc,%esp
+  802c4c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c4f:	29 d8                	sub    %ebx,%eax
+  802c51:	50                   	push   %eax
+  802c52:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c55:	01 d3                	add    %edx,%ebx
+  802c57:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802c5a:	53                   	push   %ebx
+  802c5b:	56                   	push   %esi
+  802c5c:	e8 dd dd ff ff       	call   800a3e <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802c61:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802c64:	03 4f 04             	add    0x4(%edi),%ecx
+  802c67:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802c6c:	f7 e1                	mul    %ecx
+  802c6e:	c1 ea 0c             	shr    $0xc,%edx
+  802c71:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802c77:	29 d1                	sub    %edx,%ecx
+  802c79:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802c7c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802c81:	83 c4 10             	add    $0x10,%esp
+  802c84:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802c88:	75 0b                	jne    802c95 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802c8a:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802c8d:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802c90:	e9 f3 fe ff ff       	jmp    802b88 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802c95:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802c9c:	83 ec 08             	sub    $0x8,%esp
+  802c9f:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802ca4:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802ca7:	50                   	push   %eax
+  802ca8:	e8 27 e6 ff ff       	call   8012d4 <sys_futex_wake>
+  802cad:	83 c4 10             	add    $0x10,%esp
+  802cb0:	eb d8                	jmp    802c8a <devpipe_write+0x11f>
+				return 0;
+  802cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cba:	5b                   	pop    %ebx
+  802cbb:	5e                   	pop    %esi
+  802cbc:	5f                   	pop    %edi
+  802cbd:	5d                   	pop    %ebp
+  802cbe:	c3                   	ret
+
+00802cbf <pipe>:
+{
+  802cbf:	55                   	push   %ebp
+  802cc0:	89 e5                	mov    %esp,%ebp
+  802cc2:	56                   	push   %esi
+  802cc3:	53                   	push   %ebx
+  802cc4:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802cc7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cca:	50                   	push   %eax
+  802ccb:	e8 51 ec ff ff       	call   801921 <fd_alloc>
+  802cd0:	89 c3                	mov    %eax,%ebx
+  802cd2:	83 c4 10             	add    $0x10,%esp
+  802cd5:	85 c0                	test   %eax,%eax
+  802cd7:	0f 88 23 01 00 00    	js     802e00 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cdd:	83 ec 04             	sub    $0x4,%esp
+  802ce0:	68 07 04 00 00       	push   $0x407
+  802ce5:	ff 75 f4             	push   -0xc(%ebp)
+  802ce8:	6a 00                	push   $0x0
+  802cea:	e8 bc e0 ff ff       	call   800dab <sys_page_alloc>
+  802cef:	89 c3                	mov    %eax,%ebx
+  802cf1:	83 c4 10             	add    $0x10,%esp
+  802cf4:	85 c0                	test   %eax,%eax
+  802cf6:	0f 88 04 01 00 00    	js     802e00 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802cfc:	83 ec 0c             	sub    $0xc,%esp
+  802cff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d02:	50                   	push   %eax
+  802d03:	e8 19 ec ff ff       	call   801921 <fd_alloc>
+  802d08:	89 c3                	mov    %eax,%ebx
+  802d0a:	83 c4 10             	add    $0x10,%esp
+  802d0d:	85 c0                	test   %eax,%eax
+  802d0f:	0f 88 db 00 00 00    	js     802df0 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d15:	83 ec 04             	sub    $0x4,%esp
+  802d18:	68 07 04 00 00       	push   $0x407
+  802d1d:	ff 75 f0             	push   -0x10(%ebp)
+  802d20:	6a 00                	push   $0x0
+  802d22:	e8 84 e0 ff ff       	call   800dab <sys_page_alloc>
+  802d27:	89 c3                	mov    %eax,%ebx
+  802d29:	83 c4 10             	add    $0x10,%esp
+  802d2c:	85 c0                	test   %eax,%eax
+  802d2e:	0f 88 bc 00 00 00    	js     802df0 <pipe+0x131>
+	va = fd2data(fd0);
+  802d34:	83 ec 0c             	sub    $0xc,%esp
+  802d37:	ff 75 f4             	push   -0xc(%ebp)
+  802d3a:	e8 cb eb ff ff       	call   80190a <fd2data>
+  802d3f:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d41:	83 c4 0c             	add    $0xc,%esp
+  802d44:	68 07 04 00 00       	push   $0x407
+  802d49:	50                   	push   %eax
+  802d4a:	6a 00                	push   $0x0
+  802d4c:	e8 5a e0 ff ff       	call   800dab <sys_page_alloc>
+  802d51:	89 c3                	mov    %eax,%ebx
+  802d53:	83 c4 10             	add    $0x10,%esp
+  802d56:	85 c0                	test   %eax,%eax
+  802d58:	0f 88 82 00 00 00    	js     802de0 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d5e:	83 ec 0c             	sub    $0xc,%esp
+  802d61:	ff 75 f0             	push   -0x10(%ebp)
+  802d64:	e8 a1 eb ff ff       	call   80190a <fd2data>
+  802d69:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d70:	50                   	push   %eax
+  802d71:	6a 00                	push   $0x0
+  802d73:	56                   	push   %esi
+  802d74:	6a 00                	push   $0x0
+  802d76:	e8 73 e0 ff ff       	call   800dee <sys_page_map>
+  802d7b:	89 c3                	mov    %eax,%ebx
+  802d7d:	83 c4 20             	add    $0x20,%esp
+  802d80:	85 c0                	test   %eax,%eax
+  802d82:	78 4e                	js     802dd2 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802d84:	a1 28 70 80 00       	mov    0x807028,%eax
+  802d89:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d8c:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802d8e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d91:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802d98:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802d9b:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802d9d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802da0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802da7:	83 ec 0c             	sub    $0xc,%esp
+  802daa:	ff 75 f4             	push   -0xc(%ebp)
+  802dad:	e8 48 eb ff ff       	call   8018fa <fd2num>
+  802db2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802db5:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802db7:	83 c4 04             	add    $0x4,%esp
+  802dba:	ff 75 f0             	push   -0x10(%ebp)
+  802dbd:	e8 38 eb ff ff       	call   8018fa <fd2num>
+  802dc2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dc5:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802dc8:	83 c4 10             	add    $0x10,%esp
+  802dcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802dd0:	eb 2e                	jmp    802e00 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802dd2:	83 ec 08             	sub    $0x8,%esp
+  802dd5:	56                   	push   %esi
+  802dd6:	6a 00                	push   $0x0
+  802dd8:	e8 53 e0 ff ff       	call   800e30 <sys_page_unmap>
+  802ddd:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802de0:	83 ec 08             	sub    $0x8,%esp
+  802de3:	ff 75 f0             	push   -0x10(%ebp)
+  802de6:	6a 00                	push   $0x0
+  802de8:	e8 43 e0 ff ff       	call   800e30 <sys_page_unmap>
+  802ded:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802df0:	83 ec 08             	sub    $0x8,%esp
+  802df3:	ff 75 f4             	push   -0xc(%ebp)
+  802df6:	6a 00                	push   $0x0
+  802df8:	e8 33 e0 ff ff       	call   800e30 <sys_page_unmap>
+  802dfd:	83 c4 10             	add    $0x10,%esp
+}
+  802e00:	89 d8                	mov    %ebx,%eax
+  802e02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e05:	5b                   	pop    %ebx
+  802e06:	5e                   	pop    %esi
+  802e07:	5d                   	pop    %ebp
+  802e08:	c3                   	ret
+
+00802e09 <pipeisclosed>:
+{
+  802e09:	55                   	push   %ebp
+  802e0a:	89 e5                	mov    %esp,%ebp
+  802e0c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e12:	50                   	push   %eax
+  802e13:	ff 75 08             	push   0x8(%ebp)
+  802e16:	e8 5a eb ff ff       	call   801975 <fd_lookup>
+  802e1b:	83 c4 10             	add    $0x10,%esp
+  802e1e:	85 c0                	test   %eax,%eax
+  802e20:	78 18                	js     802e3a <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802e22:	83 ec 0c             	sub    $0xc,%esp
+  802e25:	ff 75 f4             	push   -0xc(%ebp)
+  802e28:	e8 dd ea ff ff       	call   80190a <fd2data>
+  802e2d:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802e2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e32:	e8 a8 fb ff ff       	call   8029df <_pipeisclosed>
+  802e37:	83 c4 10             	add    $0x10,%esp
+}
+  802e3a:	c9                   	leave
+  802e3b:	c3                   	ret
+
+00802e3c <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802e3c:	55                   	push   %ebp
+  802e3d:	89 e5                	mov    %esp,%ebp
+  802e3f:	57                   	push   %edi
+  802e40:	56                   	push   %esi
+  802e41:	53                   	push   %ebx
+  802e42:	83 ec 0c             	sub    $0xc,%esp
+  802e45:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  802e48:	85 ff                	test   %edi,%edi
+  802e4a:	74 21                	je     802e6d <wait+0x31>
+	e = &envs[ENVX(envid)];
+  802e4c:	89 f8                	mov    %edi,%eax
+  802e4e:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  802e53:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  802e56:	c1 e6 06             	shl    $0x6,%esi
+  802e59:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802e5f:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  802e62:	c1 e3 06             	shl    $0x6,%ebx
+  802e65:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802e6b:	eb 25                	jmp    802e92 <wait+0x56>
+	assert(envid != 0);
+  802e6d:	68 81 61 80 00       	push   $0x806181
+  802e72:	68 9b 60 80 00       	push   $0x80609b
+  802e77:	6a 0a                	push   $0xa
+  802e79:	68 8c 61 80 00       	push   $0x80618c
+  802e7e:	e8 73 d3 ff ff       	call   8001f6 <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  802e83:	83 ec 04             	sub    $0x4,%esp
+  802e86:	6a ff                	push   $0xffffffff
+  802e88:	50                   	push   %eax
+  802e89:	56                   	push   %esi
+  802e8a:	e8 f5 e3 ff ff       	call   801284 <sys_futex_wait>
+  802e8f:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  802e92:	8b 43 48             	mov    0x48(%ebx),%eax
+  802e95:	39 f8                	cmp    %edi,%eax
+  802e97:	75 07                	jne    802ea0 <wait+0x64>
+  802e99:	8b 43 54             	mov    0x54(%ebx),%eax
+  802e9c:	85 c0                	test   %eax,%eax
+  802e9e:	75 e3                	jne    802e83 <wait+0x47>
+}
+  802ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea3:	5b                   	pop    %ebx
+  802ea4:	5e                   	pop    %esi
+  802ea5:	5f                   	pop    %edi
+  802ea6:	5d                   	pop    %ebp
+  802ea7:	c3                   	ret
+
+00802ea8 <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  802ea8:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802eaa:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802eb0:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  802eb6:	81 c2 34 01 00 00    	add    $0x134,%edx
+  802ebc:	39 d0                	cmp    %edx,%eax
+  802ebe:	74 2e                	je     802eee <segment_lookup+0x46>
+{
+  802ec0:	55                   	push   %ebp
+  802ec1:	89 e5                	mov    %esp,%ebp
+  802ec3:	57                   	push   %edi
+  802ec4:	56                   	push   %esi
+  802ec5:	53                   	push   %ebx
+  802ec6:	eb 07                	jmp    802ecf <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  802ec8:	83 c0 20             	add    $0x20,%eax
+  802ecb:	39 d0                	cmp    %edx,%eax
+  802ecd:	74 15                	je     802ee4 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  802ecf:	8b 18                	mov    (%eax),%ebx
+  802ed1:	39 d9                	cmp    %ebx,%ecx
+  802ed3:	72 f3                	jb     802ec8 <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  802ed5:	8b 38                	mov    (%eax),%edi
+  802ed7:	8b 58 04             	mov    0x4(%eax),%ebx
+  802eda:	89 ce                	mov    %ecx,%esi
+  802edc:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  802ede:	39 de                	cmp    %ebx,%esi
+  802ee0:	73 e6                	jae    802ec8 <segment_lookup+0x20>
+  802ee2:	eb 05                	jmp    802ee9 <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  802ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ee9:	5b                   	pop    %ebx
+  802eea:	5e                   	pop    %esi
+  802eeb:	5f                   	pop    %edi
+  802eec:	5d                   	pop    %ebp
+  802eed:	c3                   	ret
+	return NULL;
+  802eee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ef3:	c3                   	ret
+
+00802ef4 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802ef4:	55                   	push   %ebp
+  802ef5:	89 e5                	mov    %esp,%ebp
+  802ef7:	53                   	push   %ebx
+  802ef8:	83 ec 04             	sub    $0x4,%esp
+  802efb:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802efd:	c1 e8 16             	shr    $0x16,%eax
+  802f00:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802f07:	25 81 00 00 00       	and    $0x81,%eax
+  802f0c:	83 f8 01             	cmp    $0x1,%eax
+  802f0f:	75 6b                	jne    802f7c <page_is_clean+0x88>
+  802f11:	89 da                	mov    %ebx,%edx
+  802f13:	c1 ea 0c             	shr    $0xc,%edx
+  802f16:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  802f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802f22:	f6 c1 01             	test   $0x1,%cl
+  802f25:	74 5a                	je     802f81 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802f27:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802f2e:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802f34:	75 4b                	jne    802f81 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802f36:	89 d8                	mov    %ebx,%eax
+  802f38:	e8 6b ff ff ff       	call   802ea8 <segment_lookup>
+  802f3d:	89 c2                	mov    %eax,%edx
+		return 1;
+  802f3f:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802f44:	85 d2                	test   %edx,%edx
+  802f46:	75 39                	jne    802f81 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  802f48:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  802f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f53:	eb 03                	jmp    802f58 <page_is_clean+0x64>
+  802f55:	83 c0 01             	add    $0x1,%eax
+  802f58:	39 c2                	cmp    %eax,%edx
+  802f5a:	7e 19                	jle    802f75 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  802f5c:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  802f63:	72 f0                	jb     802f55 <page_is_clean+0x61>
+  802f65:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  802f6c:	73 e7                	jae    802f55 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802f6e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f73:	eb 0c                	jmp    802f81 <page_is_clean+0x8d>
+	return 0;
+  802f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7a:	eb 05                	jmp    802f81 <page_is_clean+0x8d>
+		return 0;
+  802f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f81:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f84:	c9                   	leave
+  802f85:	c3                   	ret
+
+00802f86 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802f86:	55                   	push   %ebp
+  802f87:	89 e5                	mov    %esp,%ebp
+  802f89:	57                   	push   %edi
+  802f8a:	56                   	push   %esi
+  802f8b:	53                   	push   %ebx
+  802f8c:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802f8f:	be 00 00 00 00       	mov    $0x0,%esi
+  802f94:	eb 19                	jmp    802faf <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802f96:	f7 d3                	not    %ebx
+  802f98:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802f9e:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802fa0:	83 c6 01             	add    $0x1,%esi
+  802fa3:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  802fa9:	0f 87 97 00 00 00    	ja     803046 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802faf:	89 f3                	mov    %esi,%ebx
+  802fb1:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  802fb7:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802fbd:	89 d8                	mov    %ebx,%eax
+  802fbf:	c1 e8 0a             	shr    $0xa,%eax
+  802fc2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fc9:	25 81 00 00 00       	and    $0x81,%eax
+  802fce:	83 f8 01             	cmp    $0x1,%eax
+  802fd1:	75 c3                	jne    802f96 <linear_walk+0x10>
+  802fd3:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802fd9:	77 bb                	ja     802f96 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  802fdb:	89 df                	mov    %ebx,%edi
+  802fdd:	c1 e7 0c             	shl    $0xc,%edi
+  802fe0:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  802fe3:	89 f8                	mov    %edi,%eax
+  802fe5:	e8 0a ff ff ff       	call   802ef4 <page_is_clean>
+  802fea:	84 c0                	test   %al,%al
+  802fec:	75 64                	jne    803052 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802fee:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802ff4:	77 aa                	ja     802fa0 <linear_walk+0x1a>
+  802ff6:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  802ffc:	72 a2                	jb     802fa0 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ffe:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803005:	a8 01                	test   $0x1,%al
+  803007:	74 97                	je     802fa0 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803009:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803010:	f6 c4 04             	test   $0x4,%ah
+  803013:	75 8b                	jne    802fa0 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803015:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80301c:	f6 c4 02             	test   $0x2,%ah
+  80301f:	0f 85 7b ff ff ff    	jne    802fa0 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803025:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80302c:	c1 e8 0c             	shr    $0xc,%eax
+  80302f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803032:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803037:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80303b:	66 83 f8 01          	cmp    $0x1,%ax
+  80303f:	76 11                	jbe    803052 <linear_walk+0xcc>
+  803041:	e9 5a ff ff ff       	jmp    802fa0 <linear_walk+0x1a>
+  803046:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80304b:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  803052:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  803058:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80305b:	83 c4 1c             	add    $0x1c,%esp
+  80305e:	5b                   	pop    %ebx
+  80305f:	5e                   	pop    %esi
+  803060:	5f                   	pop    %edi
+  803061:	5d                   	pop    %ebp
+  803062:	c3                   	ret
+
+00803063 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  803063:	55                   	push   %ebp
+  803064:	89 e5                	mov    %esp,%ebp
+  803066:	56                   	push   %esi
+  803067:	53                   	push   %ebx
+  803068:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  80306a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80306f:	83 e0 7f             	and    $0x7f,%eax
+  803072:	c1 e0 04             	shl    $0x4,%eax
+  803075:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  80307b:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  803081:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  803087:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  80308d:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803092:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  803095:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80309a:	83 c0 01             	add    $0x1,%eax
+  80309d:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8030a2:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8030a5:	5b                   	pop    %ebx
+  8030a6:	5e                   	pop    %esi
+  8030a7:	5d                   	pop    %ebp
+  8030a8:	c3                   	ret
+
+008030a9 <page_ring_enter>:
+{
+  8030a9:	55                   	push   %ebp
+  8030aa:	89 e5                	mov    %esp,%ebp
+  8030ac:	57                   	push   %edi
+  8030ad:	56                   	push   %esi
+  8030ae:	53                   	push   %ebx
+  8030af:	83 ec 18             	sub    $0x18,%esp
+  8030b2:	89 c6                	mov    %eax,%esi
+  8030b4:	89 d7                	mov    %edx,%edi
+  8030b6:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8030b8:	6a 00                	push   $0x0
+  8030ba:	6a 00                	push   $0x0
+  8030bc:	6a 00                	push   $0x0
+  8030be:	6a 07                	push   $0x7
+  8030c0:	ff 35 40 c0 80 00    	push   0x80c040
+  8030c6:	e8 8e 26 00 00       	call   805759 <ipc_call>
+  8030cb:	83 c4 20             	add    $0x20,%esp
+  8030ce:	85 c0                	test   %eax,%eax
+  8030d0:	79 22                	jns    8030f4 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8030d2:	50                   	push   %eax
+  8030d3:	68 97 61 80 00       	push   $0x806197
+  8030d8:	68 13 02 00 00       	push   $0x213
+  8030dd:	68 ab 61 80 00       	push   $0x8061ab
+  8030e2:	e8 0f d1 ff ff       	call   8001f6 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8030e7:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8030ec:	83 c0 01             	add    $0x1,%eax
+  8030ef:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  8030f4:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8030fa:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  8030ff:	39 c2                	cmp    %eax,%edx
+  803101:	74 24                	je     803127 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  803103:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  803108:	83 e0 7f             	and    $0x7f,%eax
+  80310b:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  803112:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  803119:	29 f0                	sub    %esi,%eax
+  80311b:	39 d8                	cmp    %ebx,%eax
+  80311d:	73 c8                	jae    8030e7 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  80311f:	8b 52 04             	mov    0x4(%edx),%edx
+  803122:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  803125:	eb c0                	jmp    8030e7 <page_ring_enter+0x3e>
+}
+  803127:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80312a:	5b                   	pop    %ebx
+  80312b:	5e                   	pop    %esi
+  80312c:	5f                   	pop    %edi
+  80312d:	5d                   	pop    %ebp
+  80312e:	c3                   	ret
+
+0080312f <page_ring_reserve>:
+{
+  80312f:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  803131:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803136:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80313c:	29 d0                	sub    %edx,%eax
+  80313e:	ba 80 00 00 00       	mov    $0x80,%edx
+  803143:	29 ca                	sub    %ecx,%edx
+  803145:	39 c2                	cmp    %eax,%edx
+  803147:	72 01                	jb     80314a <page_ring_reserve+0x1b>
+  803149:	c3                   	ret
+{
+  80314a:	55                   	push   %ebp
+  80314b:	89 e5                	mov    %esp,%ebp
+  80314d:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  803150:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803155:	ba 00 00 00 00       	mov    $0x0,%edx
+  80315a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315f:	e8 45 ff ff ff       	call   8030a9 <page_ring_enter>
+}
+  803164:	c9                   	leave
+  803165:	c3                   	ret
+
+00803166 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  803166:	55                   	push   %ebp
+  803167:	89 e5                	mov    %esp,%ebp
+  803169:	53                   	push   %ebx
+  80316a:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  80316d:	6a 07                	push   $0x7
+  80316f:	6a 01                	push   $0x1
+  803171:	89 c3                	mov    %eax,%ebx
+  803173:	c1 e3 0c             	shl    $0xc,%ebx
+  803176:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  80317c:	52                   	push   %edx
+  80317d:	6a 04                	push   $0x4
+  80317f:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  803186:	e8 ce 25 00 00       	call   805759 <ipc_call>
+	sharereqs[i].nslots = 0;
+  80318b:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  803192:	00 00 00 
+	return r;
+}
+  803195:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803198:	c9                   	leave
+  803199:	c3                   	ret
+
+0080319a <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  80319a:	55                   	push   %ebp
+  80319b:	89 e5                	mov    %esp,%ebp
+  80319d:	56                   	push   %esi
+  80319e:	53                   	push   %ebx
+  80319f:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8031a1:	c1 e8 10             	shr    $0x10,%eax
+  8031a4:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8031a7:	89 c2                	mov    %eax,%edx
+  8031a9:	c1 e2 0c             	shl    $0xc,%edx
+  8031ac:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  8031b2:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8031b5:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  8031bb:	89 c2                	mov    %eax,%edx
+  8031bd:	c1 e2 0a             	shl    $0xa,%edx
+  8031c0:	01 f2                	add    %esi,%edx
+  8031c2:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  8031c9:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8031cf:	74 09                	je     8031da <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  8031d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031d6:	5b                   	pop    %ebx
+  8031d7:	5e                   	pop    %esi
+  8031d8:	5d                   	pop    %ebp
+  8031d9:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8031da:	e8 87 ff ff ff       	call   803166 <page_share_send>
+  8031df:	eb f5                	jmp    8031d6 <page_share_slot+0x3c>
+
+008031e1 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  8031e1:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8031e6:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  8031e9:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  8031ee:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  8031f4:	74 09                	je     8031ff <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  8031f6:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  8031fb:	85 c0                	test   %eax,%eax
+  8031fd:	75 01                	jne    803200 <page_ring_ready+0x1f>
+}
+  8031ff:	c3                   	ret
+{
+  803200:	55                   	push   %ebp
+  803201:	89 e5                	mov    %esp,%ebp
+  803203:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  803206:	68 07 06 00 00       	push   $0x607
+  80320b:	6a 08                	push   $0x8
+  80320d:	68 00 30 ad de       	push   $0xdead3000
+  803212:	6a 00                	push   $0x0
+  803214:	e8 bd dc ff ff       	call   800ed6 <sys_page_alloc_range>
+  803219:	83 c4 10             	add    $0x10,%esp
+  80321c:	83 f8 08             	cmp    $0x8,%eax
+  80321f:	74 1b                	je     80323c <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  803221:	83 ec 04             	sub    $0x4,%esp
+  803224:	6a 08                	push   $0x8
+  803226:	68 00 30 ad de       	push   $0xdead3000
+  80322b:	6a 00                	push   $0x0
+  80322d:	e8 12 dd ff ff       	call   800f44 <sys_page_unmap_range>
+		return 0;
+  803232:	83 c4 10             	add    $0x10,%esp
+  803235:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80323a:	c9                   	leave
+  80323b:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  80323c:	83 ec 0c             	sub    $0xc,%esp
+  80323f:	68 07 04 00 00       	push   $0x407
+  803244:	6a 08                	push   $0x8
+  803246:	68 00 30 ad de       	push   $0xdead3000
+  80324b:	6a 06                	push   $0x6
+  80324d:	ff 35 40 c0 80 00    	push   0x80c040
+  803253:	e8 01 25 00 00       	call   805759 <ipc_call>
+  803258:	83 c4 20             	add    $0x20,%esp
+  80325b:	85 c0                	test   %eax,%eax
+  80325d:	78 14                	js     803273 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  80325f:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803264:	8b 40 48             	mov    0x48(%eax),%eax
+  803267:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  80326c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803271:	eb c7                	jmp    80323a <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  803273:	83 ec 04             	sub    $0x4,%esp
+  803276:	6a 08                	push   $0x8
+  803278:	68 00 30 ad de       	push   $0xdead3000
+  80327d:	6a 00                	push   $0x0
+  80327f:	e8 c0 dc ff ff       	call   800f44 <sys_page_unmap_range>
+		return 0;
+  803284:	83 c4 10             	add    $0x10,%esp
+  803287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80328c:	eb ac                	jmp    80323a <page_ring_ready+0x59>
+
+0080328e <page_remove_slot>:
+{
+  80328e:	55                   	push   %ebp
+  80328f:	89 e5                	mov    %esp,%ebp
+  803291:	56                   	push   %esi
+  803292:	53                   	push   %ebx
+  803293:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803295:	89 c6                	mov    %eax,%esi
+  803297:	c1 ee 10             	shr    $0x10,%esi
+  80329a:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  80329d:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  8032a4:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  8032aa:	74 2a                	je     8032d6 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8032ac:	83 ec 0c             	sub    $0xc,%esp
+  8032af:	6a 00                	push   $0x0
+  8032b1:	6a 00                	push   $0x0
+  8032b3:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8032b5:	c1 e3 04             	shl    $0x4,%ebx
+  8032b8:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8032bb:	53                   	push   %ebx
+  8032bc:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  8032c3:	e8 91 24 00 00       	call   805759 <ipc_call>
+  8032c8:	83 c4 20             	add    $0x20,%esp
+  8032cb:	85 c0                	test   %eax,%eax
+  8032cd:	78 2d                	js     8032fc <page_remove_slot+0x6e>
+}
+  8032cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032d2:	5b                   	pop    %ebx
+  8032d3:	5e                   	pop    %esi
+  8032d4:	5d                   	pop    %ebp
+  8032d5:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8032d6:	e8 06 ff ff ff       	call   8031e1 <page_ring_ready>
+  8032db:	85 c0                	test   %eax,%eax
+  8032dd:	74 cd                	je     8032ac <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  8032df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032e4:	e8 46 fe ff ff       	call   80312f <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  8032e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032ee:	89 da                	mov    %ebx,%edx
+  8032f0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8032f5:	e8 69 fd ff ff       	call   803063 <page_ring_post>
+		return;
+  8032fa:	eb d3                	jmp    8032cf <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  8032fc:	50                   	push   %eax
+  8032fd:	68 04 62 80 00       	push   $0x806204
+  803302:	68 ac 03 00 00       	push   $0x3ac
+  803307:	68 ab 61 80 00       	push   $0x8061ab
+  80330c:	e8 e5 ce ff ff       	call   8001f6 <_panic>
+
+00803311 <find_paging_env>:
+	if(pagingenv)
+  803311:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  803316:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  803318:	85 c0                	test   %eax,%eax
+  80331a:	74 05                	je     803321 <find_paging_env+0x10>
+  80331c:	eb 56                	jmp    803374 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  80331e:	83 c0 01             	add    $0x1,%eax
+  803321:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803326:	7f 47                	jg     80336f <find_paging_env+0x5e>
+  803328:	83 f9 01             	cmp    $0x1,%ecx
+  80332b:	7f 42                	jg     80336f <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  80332d:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803330:	c1 e2 06             	shl    $0x6,%edx
+  803333:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803339:	8b 52 50             	mov    0x50(%edx),%edx
+  80333c:	83 fa 02             	cmp    $0x2,%edx
+  80333f:	75 dd                	jne    80331e <find_paging_env+0xd>
+  803341:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803344:	c1 e2 06             	shl    $0x6,%edx
+  803347:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80334d:	8b 52 54             	mov    0x54(%edx),%edx
+  803350:	85 d2                	test   %edx,%edx
+  803352:	74 ca                	je     80331e <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  803354:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803357:	c1 e2 06             	shl    $0x6,%edx
+  80335a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803360:	8b 52 48             	mov    0x48(%edx),%edx
+  803363:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  80336a:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80336d:	eb af                	jmp    80331e <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  80336f:	83 f9 02             	cmp    $0x2,%ecx
+  803372:	74 01                	je     803375 <find_paging_env+0x64>
+}
+  803374:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  803375:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80337a:	8b 40 48             	mov    0x48(%eax),%eax
+  80337d:	83 e0 01             	and    $0x1,%eax
+  803380:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  803387:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  80338c:	eb e6                	jmp    803374 <find_paging_env+0x63>
+
+0080338e <page_add_backed>:
+{
+  80338e:	55                   	push   %ebp
+  80338f:	89 e5                	mov    %esp,%ebp
+  803391:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  803394:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  803399:	83 f8 04             	cmp    $0x4,%eax
+  80339c:	74 35                	je     8033d3 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  80339e:	89 d1                	mov    %edx,%ecx
+  8033a0:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8033a6:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8033ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8033b0:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8033b7:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8033bd:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  8033c4:	83 c0 01             	add    $0x1,%eax
+  8033c7:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  8033cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033d1:	5d                   	pop    %ebp
+  8033d2:	c3                   	ret
+		return -E_NO_MEM;
+  8033d3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8033d8:	eb f7                	jmp    8033d1 <page_add_backed+0x43>
+
+008033da <percentage_of_pgdir_to_walk>:
+{
+  8033da:	55                   	push   %ebp
+  8033db:	89 e5                	mov    %esp,%ebp
+  8033dd:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8033e0:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  8033e4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  8033e7:	db 45 fc             	fildl  -0x4(%ebp)
+  8033ea:	d8 35 90 66 80 00    	fdivs  0x806690
+	return ret*ret;
+  8033f0:	d8 c8                	fmul   %st(0),%st
+}
+  8033f2:	c9                   	leave
+  8033f3:	c3                   	ret
+
+008033f4 <nfu_with_aging_page_choice_func>:
+{
+  8033f4:	55                   	push   %ebp
+  8033f5:	89 e5                	mov    %esp,%ebp
+  8033f7:	57                   	push   %edi
+  8033f8:	56                   	push   %esi
+  8033f9:	53                   	push   %ebx
+  8033fa:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8033fd:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  803403:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803405:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80340a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80340f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803416:	ba 00 00 00 00       	mov    $0x0,%edx
+  80341b:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80341e:	eb 18                	jmp    803438 <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803420:	f7 d0                	not    %eax
+  803422:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803427:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803429:	83 c2 01             	add    $0x1,%edx
+  80342c:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803432:	0f 87 13 01 00 00    	ja     80354b <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  803438:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80343c:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  80343f:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803444:	89 c1                	mov    %eax,%ecx
+  803446:	c1 e9 0a             	shr    $0xa,%ecx
+  803449:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803450:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803456:	83 f9 01             	cmp    $0x1,%ecx
+  803459:	75 c5                	jne    803420 <nfu_with_aging_page_choice_func+0x2c>
+  80345b:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803460:	77 be                	ja     803420 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803462:	89 c1                	mov    %eax,%ecx
+  803464:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803467:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80346d:	0f 82 a5 00 00 00    	jb     803518 <nfu_with_aging_page_choice_func+0x124>
+  803473:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803479:	0f 87 99 00 00 00    	ja     803518 <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80347f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803486:	f6 c1 01             	test   $0x1,%cl
+  803489:	0f 84 89 00 00 00    	je     803518 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80348f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803496:	f6 c5 04             	test   $0x4,%ch
+  803499:	75 7d                	jne    803518 <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80349b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8034a2:	f6 c5 02             	test   $0x2,%ch
+  8034a5:	75 71                	jne    803518 <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8034a7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8034ae:	c1 e9 0c             	shr    $0xc,%ecx
+  8034b1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8034b4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8034ba:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8034be:	66 83 f9 01          	cmp    $0x1,%cx
+  8034c2:	77 54                	ja     803518 <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  8034c4:	89 f9                	mov    %edi,%ecx
+  8034c6:	80 f9 ff             	cmp    $0xff,%cl
+  8034c9:	74 21                	je     8034ec <nfu_with_aging_page_choice_func+0xf8>
+  8034cb:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8034d2:	c1 e9 0c             	shr    $0xc,%ecx
+  8034d5:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8034d8:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8034de:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  8034e2:	89 fb                	mov    %edi,%ebx
+  8034e4:	38 d9                	cmp    %bl,%cl
+  8034e6:	73 30                	jae    803518 <nfu_with_aging_page_choice_func+0x124>
+  8034e8:	dd d8                	fstp   %st(0)
+  8034ea:	eb 02                	jmp    8034ee <nfu_with_aging_page_choice_func+0xfa>
+  8034ec:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  8034ee:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8034f5:	c1 e9 0c             	shr    $0xc,%ecx
+  8034f8:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8034fb:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803502:	89 fb                	mov    %edi,%ebx
+  803504:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803507:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80350a:	db 45 e0             	fildl  -0x20(%ebp)
+  80350d:	d8 35 90 66 80 00    	fdivs  0x806690
+	return ret*ret;
+  803513:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803515:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803518:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80351b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80351e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803525:	df 6d e0             	fildll -0x20(%ebp)
+  803528:	d9 c1                	fld    %st(1)
+  80352a:	d8 0d 94 66 80 00    	fmuls  0x806694
+  803530:	d9 c9                	fxch   %st(1)
+  803532:	df f1                	fcomip %st(1),%st
+  803534:	dd d8                	fstp   %st(0)
+  803536:	0f 82 ed fe ff ff    	jb     803429 <nfu_with_aging_page_choice_func+0x35>
+  80353c:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  80353e:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  803543:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803546:	c1 e0 0c             	shl    $0xc,%eax
+  803549:	eb 0e                	jmp    803559 <nfu_with_aging_page_choice_func+0x165>
+  80354b:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80354d:	89 f8                	mov    %edi,%eax
+  80354f:	3c ff                	cmp    $0xff,%al
+  803551:	74 0e                	je     803561 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803553:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803556:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803559:	83 c4 14             	add    $0x14,%esp
+  80355c:	5b                   	pop    %ebx
+  80355d:	5e                   	pop    %esi
+  80355e:	5f                   	pop    %edi
+  80355f:	5d                   	pop    %ebp
+  803560:	c3                   	ret
+	pgnum = 0;
+  803561:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  803568:	00 00 00 
+	return (void*)UTOP;
+  80356b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803570:	eb e7                	jmp    803559 <nfu_with_aging_page_choice_func+0x165>
+
+00803572 <myRand>:
+    state = state * 1664525 + 1013904223;
+  803572:	69 05 48 70 80 00 0d 	imul   $0x19660d,0x807048,%eax
+  803579:	66 19 00 
+  80357c:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  803581:	a3 48 70 80 00       	mov    %eax,0x807048
+    return state >> 24;
+  803586:	c1 e8 18             	shr    $0x18,%eax
+}
+  803589:	c3                   	ret
+
+0080358a <random_page_choice_func>:
+{
+  80358a:	55                   	push   %ebp
+  80358b:	89 e5                	mov    %esp,%ebp
+  80358d:	57                   	push   %edi
+  80358e:	56                   	push   %esi
+  80358f:	53                   	push   %ebx
+  803590:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803593:	be 00 00 00 00       	mov    $0x0,%esi
+  803598:	eb 19                	jmp    8035b3 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80359a:	f7 d3                	not    %ebx
+  80359c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8035a2:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8035a4:	83 c6 01             	add    $0x1,%esi
+  8035a7:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8035ad:	0f 87 a0 00 00 00    	ja     803653 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8035b3:	89 f3                	mov    %esi,%ebx
+  8035b5:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  8035bb:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8035c1:	89 d8                	mov    %ebx,%eax
+  8035c3:	c1 e8 0a             	shr    $0xa,%eax
+  8035c6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8035cd:	25 81 00 00 00       	and    $0x81,%eax
+  8035d2:	83 f8 01             	cmp    $0x1,%eax
+  8035d5:	75 c3                	jne    80359a <random_page_choice_func+0x10>
+  8035d7:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8035dd:	77 bb                	ja     80359a <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8035df:	89 df                	mov    %ebx,%edi
+  8035e1:	c1 e7 0c             	shl    $0xc,%edi
+  8035e4:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8035e7:	89 f8                	mov    %edi,%eax
+  8035e9:	e8 06 f9 ff ff       	call   802ef4 <page_is_clean>
+  8035ee:	84 c0                	test   %al,%al
+  8035f0:	0f 85 82 00 00 00    	jne    803678 <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8035f6:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  8035fc:	72 a6                	jb     8035a4 <random_page_choice_func+0x1a>
+  8035fe:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  803604:	77 9e                	ja     8035a4 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803606:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80360d:	a8 01                	test   $0x1,%al
+  80360f:	74 93                	je     8035a4 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803611:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803618:	f6 c4 04             	test   $0x4,%ah
+  80361b:	75 87                	jne    8035a4 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80361d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803624:	f6 c4 02             	test   $0x2,%ah
+  803627:	0f 85 77 ff ff ff    	jne    8035a4 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80362d:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803634:	c1 e8 0c             	shr    $0xc,%eax
+  803637:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80363a:	05 00 00 00 ef       	add    $0xef000000,%eax
+  80363f:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803643:	66 83 f8 01          	cmp    $0x1,%ax
+  803647:	0f 87 57 ff ff ff    	ja     8035a4 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  80364d:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803653:	e8 1a ff ff ff       	call   803572 <myRand>
+  803658:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  80365e:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  803663:	29 fe                	sub    %edi,%esi
+  803665:	0f be c0             	movsbl %al,%eax
+  803668:	ba 00 00 00 00       	mov    $0x0,%edx
+  80366d:	f7 f6                	div    %esi
+  80366f:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803671:	bb 15 00 00 00       	mov    $0x15,%ebx
+  803676:	eb 1c                	jmp    803694 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  803678:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  80367e:	e9 8f 00 00 00       	jmp    803712 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803683:	e8 ea fe ff ff       	call   803572 <myRand>
+  803688:	0f be c0             	movsbl %al,%eax
+  80368b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803690:	f7 f6                	div    %esi
+  803692:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803694:	83 eb 01             	sub    $0x1,%ebx
+  803697:	0f 84 c2 00 00 00    	je     80375f <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  80369d:	89 d0                	mov    %edx,%eax
+  80369f:	c1 e8 0a             	shr    $0xa,%eax
+  8036a2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036a9:	25 81 00 00 00       	and    $0x81,%eax
+  8036ae:	83 f8 01             	cmp    $0x1,%eax
+  8036b1:	75 d0                	jne    803683 <random_page_choice_func+0xf9>
+  8036b3:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8036b9:	77 c8                	ja     803683 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8036bb:	89 d0                	mov    %edx,%eax
+  8036bd:	c1 e0 0c             	shl    $0xc,%eax
+  8036c0:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  8036c5:	72 56                	jb     80371d <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8036c7:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8036cc:	77 65                	ja     803733 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8036ce:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8036d5:	f6 c1 01             	test   $0x1,%cl
+  8036d8:	74 59                	je     803733 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8036da:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8036e1:	f6 c5 04             	test   $0x4,%ch
+  8036e4:	75 4d                	jne    803733 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  8036e6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8036ed:	f6 c5 02             	test   $0x2,%ch
+  8036f0:	75 41                	jne    803733 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  8036f2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8036f9:	c1 ea 0c             	shr    $0xc,%edx
+  8036fc:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8036ff:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  803705:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  803709:	66 83 fa 01          	cmp    $0x1,%dx
+  80370d:	77 3a                	ja     803749 <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  80370f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  803712:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803715:	83 c4 1c             	add    $0x1c,%esp
+  803718:	5b                   	pop    %ebx
+  803719:	5e                   	pop    %esi
+  80371a:	5f                   	pop    %edi
+  80371b:	5d                   	pop    %ebp
+  80371c:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  80371d:	e8 50 fe ff ff       	call   803572 <myRand>
+  803722:	0f be c0             	movsbl %al,%eax
+  803725:	ba 00 00 00 00       	mov    $0x0,%edx
+  80372a:	f7 f6                	div    %esi
+  80372c:	01 fa                	add    %edi,%edx
+			continue;
+  80372e:	e9 61 ff ff ff       	jmp    803694 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803733:	e8 3a fe ff ff       	call   803572 <myRand>
+  803738:	0f be c0             	movsbl %al,%eax
+  80373b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803740:	f7 f6                	div    %esi
+  803742:	01 fa                	add    %edi,%edx
+			continue;
+  803744:	e9 4b ff ff ff       	jmp    803694 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803749:	e8 24 fe ff ff       	call   803572 <myRand>
+  80374e:	0f be c0             	movsbl %al,%eax
+  803751:	ba 00 00 00 00       	mov    $0x0,%edx
+  803756:	f7 f6                	div    %esi
+  803758:	01 fa                	add    %edi,%edx
+			continue;
+  80375a:	e9 35 ff ff ff       	jmp    803694 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  80375f:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  803766:	00 00 00 
+	return (void*)UTOP;
+  803769:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803770:	eb a0                	jmp    803712 <random_page_choice_func+0x188>
+
+00803772 <nfu>:
+{
+  803772:	55                   	push   %ebp
+  803773:	89 e5                	mov    %esp,%ebp
+  803775:	57                   	push   %edi
+  803776:	56                   	push   %esi
+  803777:	53                   	push   %ebx
+  803778:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80377b:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  803781:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803783:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803788:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80378d:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803794:	ba 00 00 00 00       	mov    $0x0,%edx
+  803799:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  80379c:	eb 18                	jmp    8037b6 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80379e:	f7 d0                	not    %eax
+  8037a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8037a5:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8037a7:	83 c2 01             	add    $0x1,%edx
+  8037aa:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  8037b0:	0f 87 13 01 00 00    	ja     8038c9 <nfu+0x157>
+		++num_searched_ptes;
+  8037b6:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8037ba:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  8037bd:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8037c2:	89 c1                	mov    %eax,%ecx
+  8037c4:	c1 e9 0a             	shr    $0xa,%ecx
+  8037c7:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  8037ce:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  8037d4:	83 f9 01             	cmp    $0x1,%ecx
+  8037d7:	75 c5                	jne    80379e <nfu+0x2c>
+  8037d9:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  8037de:	77 be                	ja     80379e <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  8037e0:	89 c1                	mov    %eax,%ecx
+  8037e2:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8037e5:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  8037eb:	0f 82 a5 00 00 00    	jb     803896 <nfu+0x124>
+  8037f1:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  8037f7:	0f 87 99 00 00 00    	ja     803896 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8037fd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803804:	f6 c1 01             	test   $0x1,%cl
+  803807:	0f 84 89 00 00 00    	je     803896 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80380d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803814:	f6 c5 04             	test   $0x4,%ch
+  803817:	75 7d                	jne    803896 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803819:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803820:	f6 c5 02             	test   $0x2,%ch
+  803823:	75 71                	jne    803896 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803825:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  80382c:	c1 e9 0c             	shr    $0xc,%ecx
+  80382f:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803832:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803838:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  80383c:	66 83 f9 01          	cmp    $0x1,%cx
+  803840:	77 54                	ja     803896 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  803842:	89 f9                	mov    %edi,%ecx
+  803844:	80 f9 ff             	cmp    $0xff,%cl
+  803847:	74 21                	je     80386a <nfu+0xf8>
+  803849:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803850:	c1 e9 0c             	shr    $0xc,%ecx
+  803853:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803856:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  80385c:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803860:	89 fb                	mov    %edi,%ebx
+  803862:	38 d9                	cmp    %bl,%cl
+  803864:	73 30                	jae    803896 <nfu+0x124>
+  803866:	dd d8                	fstp   %st(0)
+  803868:	eb 02                	jmp    80386c <nfu+0xfa>
+  80386a:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  80386c:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803873:	c1 e9 0c             	shr    $0xc,%ecx
+  803876:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803879:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803880:	89 fb                	mov    %edi,%ebx
+  803882:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803885:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803888:	db 45 e0             	fildl  -0x20(%ebp)
+  80388b:	d8 35 90 66 80 00    	fdivs  0x806690
+	return ret*ret;
+  803891:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803893:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803896:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803899:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  80389c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8038a3:	df 6d e0             	fildll -0x20(%ebp)
+  8038a6:	d9 c1                	fld    %st(1)
+  8038a8:	d8 0d 94 66 80 00    	fmuls  0x806694
+  8038ae:	d9 c9                	fxch   %st(1)
+  8038b0:	df f1                	fcomip %st(1),%st
+  8038b2:	dd d8                	fstp   %st(0)
+  8038b4:	0f 82 ed fe ff ff    	jb     8037a7 <nfu+0x35>
+  8038ba:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  8038bc:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  8038c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8038c4:	c1 e0 0c             	shl    $0xc,%eax
+  8038c7:	eb 0e                	jmp    8038d7 <nfu+0x165>
+  8038c9:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  8038cb:	89 f8                	mov    %edi,%eax
+  8038cd:	3c ff                	cmp    $0xff,%al
+  8038cf:	74 0e                	je     8038df <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  8038d1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8038d4:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8038d7:	83 c4 14             	add    $0x14,%esp
+  8038da:	5b                   	pop    %ebx
+  8038db:	5e                   	pop    %esi
+  8038dc:	5f                   	pop    %edi
+  8038dd:	5d                   	pop    %ebp
+  8038de:	c3                   	ret
+	pgnum = 0;
+  8038df:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  8038e6:	00 00 00 
+	return (void*)UTOP;
+  8038e9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8038ee:	eb e7                	jmp    8038d7 <nfu+0x165>
+
+008038f0 <lru>:
+{
+  8038f0:	55                   	push   %ebp
+  8038f1:	89 e5                	mov    %esp,%ebp
+  8038f3:	57                   	push   %edi
+  8038f4:	56                   	push   %esi
+  8038f5:	53                   	push   %ebx
+  8038f6:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8038f9:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  8038ff:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  803906:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80390d:	be 00 00 00 00       	mov    $0x0,%esi
+  803912:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803919:	ba 00 00 00 00       	mov    $0x0,%edx
+  80391e:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  803921:	eb 18                	jmp    80393b <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803923:	f7 d0                	not    %eax
+  803925:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80392a:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80392c:	83 c2 01             	add    $0x1,%edx
+  80392f:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803935:	0f 87 fa 00 00 00    	ja     803a35 <lru+0x145>
+		++num_searched_ptes;
+  80393b:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80393e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803941:	01 d0                	add    %edx,%eax
+  803943:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803948:	89 c1                	mov    %eax,%ecx
+  80394a:	c1 e9 0a             	shr    $0xa,%ecx
+  80394d:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803954:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  80395a:	83 f9 01             	cmp    $0x1,%ecx
+  80395d:	75 c4                	jne    803923 <lru+0x33>
+  80395f:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803964:	77 bd                	ja     803923 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803966:	89 c1                	mov    %eax,%ecx
+  803968:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80396b:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803971:	0f 87 92 00 00 00    	ja     803a09 <lru+0x119>
+  803977:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80397d:	0f 82 86 00 00 00    	jb     803a09 <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803983:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80398a:	f6 c1 01             	test   $0x1,%cl
+  80398d:	74 7a                	je     803a09 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80398f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803996:	f6 c5 04             	test   $0x4,%ch
+  803999:	75 6e                	jne    803a09 <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80399b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8039a2:	f6 c5 02             	test   $0x2,%ch
+  8039a5:	75 62                	jne    803a09 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8039a7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8039ae:	c1 e9 0c             	shr    $0xc,%ecx
+  8039b1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8039b4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8039ba:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8039be:	66 83 f9 01          	cmp    $0x1,%cx
+  8039c2:	77 45                	ja     803a09 <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  8039c4:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8039cb:	c1 e9 0c             	shr    $0xc,%ecx
+  8039ce:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8039d1:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8039d7:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8039da:	8b 49 10             	mov    0x10(%ecx),%ecx
+  8039dd:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  8039e0:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8039e3:	19 df                	sbb    %ebx,%edi
+  8039e5:	7c 22                	jl     803a09 <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  8039e7:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8039ee:	c1 e9 0c             	shr    $0xc,%ecx
+  8039f1:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8039f4:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8039fa:	8b 59 14             	mov    0x14(%ecx),%ebx
+  8039fd:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803a00:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  803a03:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803a06:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803a09:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  803a0c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803a13:	df 6d e0             	fildll -0x20(%ebp)
+  803a16:	d9 05 94 66 80 00    	flds   0x806694
+  803a1c:	d9 c9                	fxch   %st(1)
+  803a1e:	df f1                	fcomip %st(1),%st
+  803a20:	dd d8                	fstp   %st(0)
+  803a22:	0f 82 04 ff ff ff    	jb     80392c <lru+0x3c>
+			pgnum = pgnum_actual;
+  803a28:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  803a2d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803a30:	c1 e0 0c             	shl    $0xc,%eax
+  803a33:	eb 06                	jmp    803a3b <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  803a35:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803a38:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803a3b:	83 c4 1c             	add    $0x1c,%esp
+  803a3e:	5b                   	pop    %ebx
+  803a3f:	5e                   	pop    %esi
+  803a40:	5f                   	pop    %edi
+  803a41:	5d                   	pop    %ebp
+  803a42:	c3                   	ret
+
+00803a43 <set_page_choice_func>:
+{
+  803a43:	55                   	push   %ebp
+  803a44:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  803a46:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a49:	a3 44 70 80 00       	mov    %eax,0x807044
+}
+  803a4e:	5d                   	pop    %ebp
+  803a4f:	c3                   	ret
+
+00803a50 <get_page_choice>:
+{
+  803a50:	55                   	push   %ebp
+  803a51:	89 e5                	mov    %esp,%ebp
+  803a53:	57                   	push   %edi
+  803a54:	56                   	push   %esi
+  803a55:	53                   	push   %ebx
+  803a56:	83 ec 24             	sub    $0x24,%esp
+  803a59:	8b 75 08             	mov    0x8(%ebp),%esi
+  803a5c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  803a5f:	57                   	push   %edi
+  803a60:	56                   	push   %esi
+  803a61:	ff 15 44 70 80 00    	call   *0x807044
+  803a67:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803a69:	83 c4 10             	add    $0x10,%esp
+  803a6c:	eb 25                	jmp    803a93 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803a6e:	83 ec 08             	sub    $0x8,%esp
+  803a71:	c1 e0 16             	shl    $0x16,%eax
+  803a74:	50                   	push   %eax
+  803a75:	6a 00                	push   $0x0
+  803a77:	e8 f6 d3 ff ff       	call   800e72 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803a7c:	83 c4 10             	add    $0x10,%esp
+  803a7f:	85 c0                	test   %eax,%eax
+  803a81:	75 43                	jne    803ac6 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  803a83:	83 ec 08             	sub    $0x8,%esp
+  803a86:	57                   	push   %edi
+  803a87:	56                   	push   %esi
+  803a88:	ff 15 44 70 80 00    	call   *0x807044
+  803a8e:	89 c3                	mov    %eax,%ebx
+  803a90:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803a93:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803a96:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803a9c:	0f 86 ae 00 00 00    	jbe    803b50 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803aa7:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803aae:	81 e2 81 00 00 00    	and    $0x81,%edx
+  803ab4:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803aba:	74 b2                	je     803a6e <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803abc:	83 c0 01             	add    $0x1,%eax
+  803abf:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  803ac4:	75 e1                	jne    803aa7 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803ac6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ac9:	05 00 10 40 11       	add    $0x11401000,%eax
+  803ace:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803ad3:	76 1f                	jbe    803af4 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  803ad5:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  803ada:	89 d8                	mov    %ebx,%eax
+  803adc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803adf:	5b                   	pop    %ebx
+  803ae0:	5e                   	pop    %esi
+  803ae1:	5f                   	pop    %edi
+  803ae2:	5d                   	pop    %ebp
+  803ae3:	c3                   	ret
+		sys_page_split(0, pg_out);
+  803ae4:	83 ec 08             	sub    $0x8,%esp
+  803ae7:	53                   	push   %ebx
+  803ae8:	6a 00                	push   $0x0
+  803aea:	e8 83 d3 ff ff       	call   800e72 <sys_page_split>
+  803aef:	83 c4 10             	add    $0x10,%esp
+  803af2:	eb 6c                	jmp    803b60 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  803af4:	83 ec 04             	sub    $0x4,%esp
+  803af7:	68 3c 62 80 00       	push   $0x80623c
+  803afc:	68 cc 01 00 00       	push   $0x1cc
+  803b01:	68 ab 61 80 00       	push   $0x8061ab
+  803b06:	e8 eb c6 ff ff       	call   8001f6 <_panic>
+		panic("We tried to page out code pages\n");
+  803b0b:	83 ec 04             	sub    $0x4,%esp
+  803b0e:	68 6c 62 80 00       	push   $0x80626c
+  803b13:	68 d6 01 00 00       	push   $0x1d6
+  803b18:	68 ab 61 80 00       	push   $0x8061ab
+  803b1d:	e8 d4 c6 ff ff       	call   8001f6 <_panic>
+		panic("Invalid mapping for the va\n");
+  803b22:	83 ec 04             	sub    $0x4,%esp
+  803b25:	68 b8 61 80 00       	push   $0x8061b8
+  803b2a:	68 da 01 00 00       	push   $0x1da
+  803b2f:	68 ab 61 80 00       	push   $0x8061ab
+  803b34:	e8 bd c6 ff ff       	call   8001f6 <_panic>
+		panic("We tried to page out a shared page\n");
+  803b39:	83 ec 04             	sub    $0x4,%esp
+  803b3c:	68 90 62 80 00       	push   $0x806290
+  803b41:	68 e0 01 00 00       	push   $0x1e0
+  803b46:	68 ab 61 80 00       	push   $0x8061ab
+  803b4b:	e8 a6 c6 ff ff       	call   8001f6 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  803b50:	89 de                	mov    %ebx,%esi
+  803b52:	c1 ee 16             	shr    $0x16,%esi
+  803b55:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803b5c:	a8 80                	test   $0x80,%al
+  803b5e:	75 84                	jne    803ae4 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803b60:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803b63:	05 00 10 40 11       	add    $0x11401000,%eax
+  803b68:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803b6d:	76 85                	jbe    803af4 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803b6f:	89 d8                	mov    %ebx,%eax
+  803b71:	e8 7e f3 ff ff       	call   802ef4 <page_is_clean>
+  803b76:	84 c0                	test   %al,%al
+  803b78:	0f 85 5c ff ff ff    	jne    803ada <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803b7e:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  803b85:	76 84                	jbe    803b0b <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803b87:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803b8e:	a8 01                	test   $0x1,%al
+  803b90:	74 90                	je     803b22 <get_page_choice+0xd2>
+  803b92:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803b95:	c1 e8 0c             	shr    $0xc,%eax
+  803b98:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803b9f:	f6 c2 01             	test   $0x1,%dl
+  803ba2:	0f 84 7a ff ff ff    	je     803b22 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803ba8:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803baf:	f6 c2 01             	test   $0x1,%dl
+  803bb2:	74 85                	je     803b39 <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803bb4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803bbb:	f6 c2 01             	test   $0x1,%dl
+  803bbe:	0f 84 75 ff ff ff    	je     803b39 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803bc4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803bcb:	f6 c6 04             	test   $0x4,%dh
+  803bce:	0f 85 65 ff ff ff    	jne    803b39 <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  803bd4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803bdb:	f6 c6 02             	test   $0x2,%dh
+  803bde:	0f 85 55 ff ff ff    	jne    803b39 <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  803be4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803beb:	c1 e8 0c             	shr    $0xc,%eax
+  803bee:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803bf1:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803bf6:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803bfa:	66 83 f8 01          	cmp    $0x1,%ax
+  803bfe:	0f 86 d6 fe ff ff    	jbe    803ada <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  803c04:	83 ec 04             	sub    $0x4,%esp
+  803c07:	68 b4 62 80 00       	push   $0x8062b4
+  803c0c:	68 e2 01 00 00       	push   $0x1e2
+  803c11:	68 ab 61 80 00       	push   $0x8061ab
+  803c16:	e8 db c5 ff ff       	call   8001f6 <_panic>
+
+00803c1b <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  803c1b:	55                   	push   %ebp
+  803c1c:	89 e5                	mov    %esp,%ebp
+  803c1e:	57                   	push   %edi
+  803c1f:	56                   	push   %esi
+  803c20:	53                   	push   %ebx
+  803c21:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  803c24:	e8 e8 f6 ff ff       	call   803311 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803c29:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803c2e:	85 c0                	test   %eax,%eax
+  803c30:	74 41                	je     803c73 <page_share_paged_out+0x58>
+  803c32:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803c39:	0f 84 fd 00 00 00    	je     803d3c <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  803c3f:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803c46:	00 00 00 
+  803c49:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  803c50:	00 00 00 
+  803c53:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c58:	eb 2c                	jmp    803c86 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803c5a:	83 c3 04             	add    $0x4,%ebx
+  803c5d:	39 f3                	cmp    %esi,%ebx
+  803c5f:	74 1a                	je     803c7b <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803c61:	8b 03                	mov    (%ebx),%eax
+  803c63:	a8 01                	test   $0x1,%al
+  803c65:	74 f3                	je     803c5a <page_share_paged_out+0x3f>
+  803c67:	c1 e8 0c             	shr    $0xc,%eax
+  803c6a:	e8 2b f5 ff ff       	call   80319a <page_share_slot>
+  803c6f:	85 c0                	test   %eax,%eax
+  803c71:	79 e7                	jns    803c5a <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  803c73:	83 c4 0c             	add    $0xc,%esp
+  803c76:	5b                   	pop    %ebx
+  803c77:	5e                   	pop    %esi
+  803c78:	5f                   	pop    %edi
+  803c79:	5d                   	pop    %ebp
+  803c7a:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803c7b:	83 c7 04             	add    $0x4,%edi
+  803c7e:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  803c84:	74 1b                	je     803ca1 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803c86:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  803c8b:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803c8e:	f6 c3 01             	test   $0x1,%bl
+  803c91:	74 e8                	je     803c7b <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  803c93:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803c99:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803c9f:	eb bc                	jmp    803c5d <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803ca1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ca6:	eb 11                	jmp    803cb9 <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803ca8:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803cae:	83 c3 01             	add    $0x1,%ebx
+  803cb1:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803cb7:	77 41                	ja     803cfa <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803cb9:	89 d8                	mov    %ebx,%eax
+  803cbb:	c1 e8 0a             	shr    $0xa,%eax
+  803cbe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803cc5:	25 81 00 00 00       	and    $0x81,%eax
+  803cca:	83 f8 01             	cmp    $0x1,%eax
+  803ccd:	75 d9                	jne    803ca8 <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803ccf:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803cd6:	25 81 00 00 00       	and    $0x81,%eax
+  803cdb:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803ce0:	75 cc                	jne    803cae <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803ce2:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803ce9:	c1 e8 0c             	shr    $0xc,%eax
+  803cec:	e8 a9 f4 ff ff       	call   80319a <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803cf1:	85 c0                	test   %eax,%eax
+  803cf3:	79 b9                	jns    803cae <page_share_paged_out+0x93>
+  803cf5:	e9 79 ff ff ff       	jmp    803c73 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803cfa:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803d01:	75 13                	jne    803d16 <page_share_paged_out+0xfb>
+  803d03:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  803d0a:	75 1d                	jne    803d29 <page_share_paged_out+0x10e>
+	return 0;
+  803d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d11:	e9 5d ff ff ff       	jmp    803c73 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1b:	e8 46 f4 ff ff       	call   803166 <page_share_send>
+  803d20:	85 c0                	test   %eax,%eax
+  803d22:	79 df                	jns    803d03 <page_share_paged_out+0xe8>
+  803d24:	e9 4a ff ff ff       	jmp    803c73 <page_share_paged_out+0x58>
+  803d29:	b8 01 00 00 00       	mov    $0x1,%eax
+  803d2e:	e8 33 f4 ff ff       	call   803166 <page_share_send>
+  803d33:	85 c0                	test   %eax,%eax
+  803d35:	79 d5                	jns    803d0c <page_share_paged_out+0xf1>
+  803d37:	e9 37 ff ff ff       	jmp    803c73 <page_share_paged_out+0x58>
+		return 0;
+  803d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d41:	e9 2d ff ff ff       	jmp    803c73 <page_share_paged_out+0x58>
+
+00803d46 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803d46:	55                   	push   %ebp
+  803d47:	89 e5                	mov    %esp,%ebp
+  803d49:	56                   	push   %esi
+  803d4a:	53                   	push   %ebx
+  803d4b:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803d4e:	e8 be f5 ff ff       	call   803311 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803d53:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  803d58:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  803d5f:	0f 84 82 00 00 00    	je     803de7 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803d65:	83 ec 0c             	sub    $0xc,%esp
+  803d68:	68 00 10 00 00       	push   $0x1000
+  803d6d:	e8 84 11 00 00       	call   804ef6 <malloc>
+  803d72:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803d74:	83 c4 0c             	add    $0xc,%esp
+  803d77:	6a 14                	push   $0x14
+  803d79:	6a 00                	push   $0x0
+  803d7b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803d7e:	50                   	push   %eax
+  803d7f:	e8 85 cc ff ff       	call   800a09 <memset>
+  803d84:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803d87:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  803d8c:	83 ec 0c             	sub    $0xc,%esp
+  803d8f:	6a 07                	push   $0x7
+  803d91:	6a 01                	push   $0x1
+  803d93:	53                   	push   %ebx
+  803d94:	6a 03                	push   $0x3
+  803d96:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  803d9d:	e8 b7 19 00 00       	call   805759 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  803da2:	8b 03                	mov    (%ebx),%eax
+  803da4:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  803da7:	8b 43 04             	mov    0x4(%ebx),%eax
+  803daa:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  803dad:	8b 43 08             	mov    0x8(%ebx),%eax
+  803db0:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  803db3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  803db6:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  803db9:	8b 43 10             	mov    0x10(%ebx),%eax
+  803dbc:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  803dbf:	83 c6 01             	add    $0x1,%esi
+  803dc2:	83 c4 20             	add    $0x20,%esp
+  803dc5:	83 fe 02             	cmp    $0x2,%esi
+  803dc8:	75 c2                	jne    803d8c <get_paging_stats+0x46>
+	}
+	*stats = total;
+  803dca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803dcd:	89 03                	mov    %eax,(%ebx)
+  803dcf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803dd2:	89 43 04             	mov    %eax,0x4(%ebx)
+  803dd5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803dd8:	89 43 08             	mov    %eax,0x8(%ebx)
+  803ddb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803dde:	89 43 0c             	mov    %eax,0xc(%ebx)
+  803de1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803de4:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  803de7:	89 d8                	mov    %ebx,%eax
+  803de9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803dec:	5b                   	pop    %ebx
+  803ded:	5e                   	pop    %esi
+  803dee:	5d                   	pop    %ebp
+  803def:	c3                   	ret
+
+00803df0 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803df0:	55                   	push   %ebp
+  803df1:	89 e5                	mov    %esp,%ebp
+  803df3:	53                   	push   %ebx
+  803df4:	83 ec 10             	sub    $0x10,%esp
+  803df7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  803dfa:	68 d2 61 80 00       	push   $0x8061d2
+  803dff:	e8 cd c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803e04:	83 c4 08             	add    $0x8,%esp
+  803e07:	ff 33                	push   (%ebx)
+  803e09:	68 e8 62 80 00       	push   $0x8062e8
+  803e0e:	e8 be c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803e13:	83 c4 08             	add    $0x8,%esp
+  803e16:	ff 73 04             	push   0x4(%ebx)
+  803e19:	68 d4 61 80 00       	push   $0x8061d4
+  803e1e:	e8 ae c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803e23:	83 c4 08             	add    $0x8,%esp
+  803e26:	ff 73 08             	push   0x8(%ebx)
+  803e29:	68 08 63 80 00       	push   $0x806308
+  803e2e:	e8 9e c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803e33:	83 c4 08             	add    $0x8,%esp
+  803e36:	ff 73 0c             	push   0xc(%ebx)
+  803e39:	68 2c 63 80 00       	push   $0x80632c
+  803e3e:	e8 8e c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803e43:	83 c4 08             	add    $0x8,%esp
+  803e46:	ff 73 10             	push   0x10(%ebx)
+  803e49:	68 50 63 80 00       	push   $0x806350
+  803e4e:	e8 7e c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803e53:	83 c4 08             	add    $0x8,%esp
+  803e56:	ff 35 08 c0 80 00    	push   0x80c008
+  803e5c:	68 8c 63 80 00       	push   $0x80638c
+  803e61:	e8 6b c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803e66:	83 c4 08             	add    $0x8,%esp
+  803e69:	ff 35 04 c0 80 00    	push   0x80c004
+  803e6f:	68 c0 63 80 00       	push   $0x8063c0
+  803e74:	e8 58 c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  803e79:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803e7e:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803e81:	8b 50 68             	mov    0x68(%eax),%edx
+  803e84:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803e87:	51                   	push   %ecx
+  803e88:	52                   	push   %edx
+  803e89:	50                   	push   %eax
+  803e8a:	68 00 64 80 00       	push   $0x806400
+  803e8f:	e8 3d c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  803e94:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803e99:	8b 40 70             	mov    0x70(%eax),%eax
+  803e9c:	83 c4 18             	add    $0x18,%esp
+  803e9f:	50                   	push   %eax
+  803ea0:	68 34 64 80 00       	push   $0x806434
+  803ea5:	e8 27 c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  803eaa:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  803eb0:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  803eb6:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  803ebb:	51                   	push   %ecx
+  803ebc:	52                   	push   %edx
+  803ebd:	50                   	push   %eax
+  803ebe:	68 64 64 80 00       	push   $0x806464
+  803ec3:	e8 09 c4 ff ff       	call   8002d1 <cprintf>
+	cprintf("\n");
+  803ec8:	83 c4 14             	add    $0x14,%esp
+  803ecb:	68 d2 61 80 00       	push   $0x8061d2
+  803ed0:	e8 fc c3 ff ff       	call   8002d1 <cprintf>
+}
+  803ed5:	83 c4 10             	add    $0x10,%esp
+  803ed8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803edb:	c9                   	leave
+  803edc:	c3                   	ret
+
+00803edd <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  803edd:	55                   	push   %ebp
+  803ede:	89 e5                	mov    %esp,%ebp
+  803ee0:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  803ee3:	e8 5e fe ff ff       	call   803d46 <get_paging_stats>
+  803ee8:	83 ec 0c             	sub    $0xc,%esp
+  803eeb:	50                   	push   %eax
+  803eec:	e8 ff fe ff ff       	call   803df0 <print_paging_stats>
+}
+  803ef1:	83 c4 10             	add    $0x10,%esp
+  803ef4:	c9                   	leave
+  803ef5:	c3                   	ret
+
+00803ef6 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803ef6:	55                   	push   %ebp
+  803ef7:	89 e5                	mov    %esp,%ebp
+  803ef9:	53                   	push   %ebx
+  803efa:	83 ec 04             	sub    $0x4,%esp
+  803efd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803f00:	eb 13                	jmp    803f15 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803f02:	83 ec 04             	sub    $0x4,%esp
+  803f05:	6a ff                	push   $0xffffffff
+  803f07:	53                   	push   %ebx
+  803f08:	68 00 f0 ff ee       	push   $0xeefff000
+  803f0d:	e8 72 d3 ff ff       	call   801284 <sys_futex_wait>
+  803f12:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803f15:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  803f1a:	39 d8                	cmp    %ebx,%eax
+  803f1c:	74 e4                	je     803f02 <mem_pressure_wait+0xc>
+	return now;
+}
+  803f1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803f21:	c9                   	leave
+  803f22:	c3                   	ret
+
+00803f23 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803f23:	55                   	push   %ebp
+  803f24:	89 e5                	mov    %esp,%ebp
+  803f26:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  803f29:	68 95 4b 80 00       	push   $0x804b95
+  803f2e:	e8 32 16 00 00       	call   805565 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803f33:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  803f3a:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  803f3d:	83 c4 0c             	add    $0xc,%esp
+  803f40:	68 07 02 00 00       	push   $0x207
+  803f45:	68 00 b0 ad de       	push   $0xdeadb000
+  803f4a:	6a 00                	push   $0x0
+  803f4c:	e8 5a ce ff ff       	call   800dab <sys_page_alloc>
+  803f51:	83 c4 10             	add    $0x10,%esp
+  803f54:	85 c0                	test   %eax,%eax
+  803f56:	78 0c                	js     803f64 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  803f58:	e8 b4 f3 ff ff       	call   803311 <find_paging_env>
+	page_ring_ready();
+  803f5d:	e8 7f f2 ff ff       	call   8031e1 <page_ring_ready>
+}
+  803f62:	c9                   	leave
+  803f63:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803f64:	50                   	push   %eax
+  803f65:	68 f2 61 80 00       	push   $0x8061f2
+  803f6a:	68 13 05 00 00       	push   $0x513
+  803f6f:	68 ab 61 80 00       	push   $0x8061ab
+  803f74:	e8 7d c2 ff ff       	call   8001f6 <_panic>
+
+00803f79 <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  803f79:	55                   	push   %ebp
+  803f7a:	89 e5                	mov    %esp,%ebp
+  803f7c:	57                   	push   %edi
+  803f7d:	56                   	push   %esi
+  803f7e:	53                   	push   %ebx
+  803f7f:	83 ec 0c             	sub    $0xc,%esp
+  803f82:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803f85:	89 fa                	mov    %edi,%edx
+  803f87:	c1 ea 16             	shr    $0x16,%edx
+  803f8a:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  803f8f:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  803f92:	f6 06 01             	testb  $0x1,(%esi)
+  803f95:	75 3e                	jne    803fd5 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  803f97:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  803f9c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803fa0:	74 47                	je     803fe9 <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  803fa2:	83 ec 0c             	sub    $0xc,%esp
+  803fa5:	6a 01                	push   $0x1
+  803fa7:	e8 f2 11 00 00       	call   80519e <va_alloc>
+  803fac:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  803fae:	83 c4 10             	add    $0x10,%esp
+  803fb1:	85 c0                	test   %eax,%eax
+  803fb3:	74 34                	je     803fe9 <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  803fb5:	6a 00                	push   $0x0
+  803fb7:	68 07 02 00 00       	push   $0x207
+  803fbc:	50                   	push   %eax
+  803fbd:	6a 00                	push   $0x0
+  803fbf:	e8 df 02 00 00       	call   8042a3 <page_alloc>
+  803fc4:	83 c4 10             	add    $0x10,%esp
+  803fc7:	85 c0                	test   %eax,%eax
+  803fc9:	78 28                	js     803ff3 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  803fcb:	f6 06 01             	testb  $0x1,(%esi)
+  803fce:	75 38                	jne    804008 <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  803fd0:	83 cb 01             	or     $0x1,%ebx
+  803fd3:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  803fd5:	89 f8                	mov    %edi,%eax
+  803fd7:	c1 e8 0a             	shr    $0xa,%eax
+  803fda:	25 fc 0f 00 00       	and    $0xffc,%eax
+  803fdf:	8b 1e                	mov    (%esi),%ebx
+  803fe1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803fe7:	01 c3                	add    %eax,%ebx
+}
+  803fe9:	89 d8                	mov    %ebx,%eax
+  803feb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fee:	5b                   	pop    %ebx
+  803fef:	5e                   	pop    %esi
+  803ff0:	5f                   	pop    %edi
+  803ff1:	5d                   	pop    %ebp
+  803ff2:	c3                   	ret
+			va_free(page, 1);
+  803ff3:	83 ec 08             	sub    $0x8,%esp
+  803ff6:	6a 01                	push   $0x1
+  803ff8:	53                   	push   %ebx
+  803ff9:	e8 d8 12 00 00       	call   8052d6 <va_free>
+			return NULL;
+  803ffe:	83 c4 10             	add    $0x10,%esp
+  804001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804006:	eb e1                	jmp    803fe9 <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  804008:	83 ec 08             	sub    $0x8,%esp
+  80400b:	53                   	push   %ebx
+  80400c:	6a 00                	push   $0x0
+  80400e:	e8 1d ce ff ff       	call   800e30 <sys_page_unmap>
+			va_free(page, 1);
+  804013:	83 c4 08             	add    $0x8,%esp
+  804016:	6a 01                	push   $0x1
+  804018:	53                   	push   %ebx
+  804019:	e8 b8 12 00 00       	call   8052d6 <va_free>
+  80401e:	83 c4 10             	add    $0x10,%esp
+  804021:	eb b2                	jmp    803fd5 <umapdir_walk+0x5c>
+
+00804023 <page_out>:
+{
+  804023:	55                   	push   %ebp
+  804024:	89 e5                	mov    %esp,%ebp
+  804026:	57                   	push   %edi
+  804027:	56                   	push   %esi
+  804028:	53                   	push   %ebx
+  804029:	83 ec 5c             	sub    $0x5c,%esp
+  80402c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  80402f:	e8 dd f2 ff ff       	call   803311 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  804034:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804039:	85 c0                	test   %eax,%eax
+  80403b:	74 1e                	je     80405b <page_out+0x38>
+  80403d:	83 ec 0c             	sub    $0xc,%esp
+  804040:	6a 00                	push   $0x0
+  804042:	6a 00                	push   $0x0
+  804044:	6a 00                	push   $0x0
+  804046:	6a 08                	push   $0x8
+  804048:	50                   	push   %eax
+  804049:	e8 0b 17 00 00       	call   805759 <ipc_call>
+  80404e:	89 c3                	mov    %eax,%ebx
+  804050:	83 c4 20             	add    $0x20,%esp
+  804053:	85 c0                	test   %eax,%eax
+  804055:	0f 84 ac 00 00 00    	je     804107 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80405b:	83 ec 08             	sub    $0x8,%esp
+  80405e:	ff 75 0c             	push   0xc(%ebp)
+  804061:	57                   	push   %edi
+  804062:	e8 e9 f9 ff ff       	call   803a50 <get_page_choice>
+  804067:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  804069:	83 c4 10             	add    $0x10,%esp
+  80406c:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  804071:	0f 84 18 02 00 00    	je     80428f <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  804077:	e8 78 ee ff ff       	call   802ef4 <page_is_clean>
+  80407c:	84 c0                	test   %al,%al
+  80407e:	0f 85 8c 00 00 00    	jne    804110 <page_out+0xed>
+	if (pagingenv == 0)
+  804084:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80408b:	0f 84 08 02 00 00    	je     804299 <page_out+0x276>
+	if (page_ring_ready())
+  804091:	e8 4b f1 ff ff       	call   8031e1 <page_ring_ready>
+  804096:	89 c3                	mov    %eax,%ebx
+  804098:	85 c0                	test   %eax,%eax
+  80409a:	0f 85 89 00 00 00    	jne    804129 <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8040a0:	83 ec 0c             	sub    $0xc,%esp
+  8040a3:	6a 05                	push   $0x5
+  8040a5:	6a 01                	push   $0x1
+  8040a7:	56                   	push   %esi
+  8040a8:	6a 01                	push   $0x1
+  8040aa:	ff 35 40 c0 80 00    	push   0x80c040
+  8040b0:	e8 a4 16 00 00       	call   805759 <ipc_call>
+  8040b5:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8040b7:	83 c4 20             	add    $0x20,%esp
+  8040ba:	85 c0                	test   %eax,%eax
+  8040bc:	0f 88 b8 01 00 00    	js     80427a <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8040c2:	89 f0                	mov    %esi,%eax
+  8040c4:	c1 e8 0c             	shr    $0xc,%eax
+  8040c7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8040ce:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8040d1:	83 ec 08             	sub    $0x8,%esp
+  8040d4:	56                   	push   %esi
+  8040d5:	6a 00                	push   $0x0
+  8040d7:	e8 54 cd ff ff       	call   800e30 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8040dc:	83 c4 08             	add    $0x8,%esp
+  8040df:	6a 01                	push   $0x1
+  8040e1:	56                   	push   %esi
+  8040e2:	e8 92 fe ff ff       	call   803f79 <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8040e7:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8040ea:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  8040f0:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  8040f3:	09 fe                	or     %edi,%esi
+  8040f5:	83 ce 01             	or     $0x1,%esi
+  8040f8:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8040fa:	83 c4 10             	add    $0x10,%esp
+}
+  8040fd:	89 d8                	mov    %ebx,%eax
+  8040ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804102:	5b                   	pop    %ebx
+  804103:	5e                   	pop    %esi
+  804104:	5f                   	pop    %edi
+  804105:	5d                   	pop    %ebp
+  804106:	c3                   	ret
+		num_page_reclaims++;
+  804107:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  80410e:	eb ed                	jmp    8040fd <page_out+0xda>
+		num_page_drops++;
+  804110:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  804117:	83 ec 08             	sub    $0x8,%esp
+  80411a:	56                   	push   %esi
+  80411b:	6a 00                	push   $0x0
+  80411d:	e8 0e cd ff ff       	call   800e30 <sys_page_unmap>
+  804122:	89 c3                	mov    %eax,%ebx
+  804124:	83 c4 10             	add    $0x10,%esp
+  804127:	eb d4                	jmp    8040fd <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  804129:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80412b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  804130:	2d 00 10 00 00       	sub    $0x1000,%eax
+  804135:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  804138:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80413a:	83 c0 08             	add    $0x8,%eax
+  80413d:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  804140:	b8 07 00 00 00       	mov    $0x7,%eax
+  804145:	e8 e5 ef ff ff       	call   80312f <page_ring_reserve>
+	first = ring->sq_tail;
+  80414a:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80414f:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  804152:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  804157:	83 ec 04             	sub    $0x4,%esp
+  80415a:	68 00 10 00 00       	push   $0x1000
+  80415f:	56                   	push   %esi
+  804160:	89 d8                	mov    %ebx,%eax
+  804162:	c1 e0 0c             	shl    $0xc,%eax
+  804165:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  80416a:	50                   	push   %eax
+  80416b:	e8 30 c9 ff ff       	call   800aa0 <memcpy>
+		vas[n] = va;
+  804170:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  804174:	89 d9                	mov    %ebx,%ecx
+  804176:	ba 00 00 00 00       	mov    $0x0,%edx
+  80417b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804180:	e8 de ee ff ff       	call   803063 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  804185:	8d 43 01             	lea    0x1(%ebx),%eax
+  804188:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  80418b:	83 c4 10             	add    $0x10,%esp
+  80418e:	83 fb 06             	cmp    $0x6,%ebx
+  804191:	74 62                	je     8041f5 <page_out+0x1d2>
+  804193:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  804196:	eb 15                	jmp    8041ad <page_out+0x18a>
+			num_page_drops++;
+  804198:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  80419f:	83 ec 08             	sub    $0x8,%esp
+  8041a2:	56                   	push   %esi
+  8041a3:	6a 00                	push   $0x0
+  8041a5:	e8 86 cc ff ff       	call   800e30 <sys_page_unmap>
+  8041aa:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8041ad:	83 ec 08             	sub    $0x8,%esp
+  8041b0:	53                   	push   %ebx
+  8041b1:	57                   	push   %edi
+  8041b2:	e8 99 f8 ff ff       	call   803a50 <get_page_choice>
+  8041b7:	89 c6                	mov    %eax,%esi
+  8041b9:	83 c4 10             	add    $0x10,%esp
+  8041bc:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8041c1:	74 32                	je     8041f5 <page_out+0x1d2>
+  8041c3:	e8 2c ed ff ff       	call   802ef4 <page_is_clean>
+  8041c8:	84 c0                	test   %al,%al
+  8041ca:	75 cc                	jne    804198 <page_out+0x175>
+		if (va == (void *) UTOP ||
+  8041cc:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8041cf:	39 c6                	cmp    %eax,%esi
+  8041d1:	72 07                	jb     8041da <page_out+0x1b7>
+  8041d3:	8b 45 98             	mov    -0x68(%ebp),%eax
+  8041d6:	39 c6                	cmp    %eax,%esi
+  8041d8:	72 1b                	jb     8041f5 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8041da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8041df:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  8041e2:	eb 03                	jmp    8041e7 <page_out+0x1c4>
+  8041e4:	83 c3 01             	add    $0x1,%ebx
+  8041e7:	39 da                	cmp    %ebx,%edx
+  8041e9:	0f 84 68 ff ff ff    	je     804157 <page_out+0x134>
+  8041ef:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  8041f3:	75 ef                	jne    8041e4 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  8041f5:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  8041f8:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  8041fb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8041fe:	e8 a6 ee ff ff       	call   8030a9 <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  804203:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804208:	eb 42                	jmp    80424c <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80420a:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  80420e:	89 f8                	mov    %edi,%eax
+  804210:	c1 e8 0c             	shr    $0xc,%eax
+  804213:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80421a:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  80421d:	83 ec 08             	sub    $0x8,%esp
+  804220:	57                   	push   %edi
+  804221:	6a 00                	push   $0x0
+  804223:	e8 08 cc ff ff       	call   800e30 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  804228:	83 c4 08             	add    $0x8,%esp
+  80422b:	6a 01                	push   $0x1
+  80422d:	57                   	push   %edi
+  80422e:	e8 46 fd ff ff       	call   803f79 <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  804233:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  804236:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  80423c:	c1 e6 0c             	shl    $0xc,%esi
+  80423f:	09 d6                	or     %edx,%esi
+  804241:	83 ce 01             	or     $0x1,%esi
+  804244:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  804246:	83 c3 01             	add    $0x1,%ebx
+  804249:	83 c4 10             	add    $0x10,%esp
+  80424c:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  80424f:	39 c3                	cmp    %eax,%ebx
+  804251:	74 1d                	je     804270 <page_out+0x24d>
+		if (res[i] < 0)
+  804253:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  804257:	85 f6                	test   %esi,%esi
+  804259:	79 af                	jns    80420a <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  80425b:	56                   	push   %esi
+  80425c:	68 94 64 80 00       	push   $0x806494
+  804261:	68 d1 02 00 00       	push   $0x2d1
+  804266:	68 ab 61 80 00       	push   $0x8061ab
+  80426b:	e8 86 bf ff ff       	call   8001f6 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  804270:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804275:	e9 83 fe ff ff       	jmp    8040fd <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  80427a:	50                   	push   %eax
+  80427b:	68 94 64 80 00       	push   $0x806494
+  804280:	68 0a 03 00 00       	push   $0x30a
+  804285:	68 ab 61 80 00       	push   $0x8061ab
+  80428a:	e8 67 bf ff ff       	call   8001f6 <_panic>
+		return -E_NO_MEM;
+  80428f:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  804294:	e9 64 fe ff ff       	jmp    8040fd <page_out+0xda>
+		return -E_PAGING;
+  804299:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80429e:	e9 5a fe ff ff       	jmp    8040fd <page_out+0xda>
+
+008042a3 <page_alloc>:
+{
+  8042a3:	55                   	push   %ebp
+  8042a4:	89 e5                	mov    %esp,%ebp
+  8042a6:	57                   	push   %edi
+  8042a7:	56                   	push   %esi
+  8042a8:	53                   	push   %ebx
+  8042a9:	83 ec 0c             	sub    $0xc,%esp
+  8042ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8042af:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8042b2:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8042b9:	74 34                	je     8042ef <page_alloc+0x4c>
+	if (check_mte)
+  8042bb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8042bf:	75 35                	jne    8042f6 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  8042c1:	83 ec 04             	sub    $0x4,%esp
+  8042c4:	ff 75 10             	push   0x10(%ebp)
+  8042c7:	56                   	push   %esi
+  8042c8:	57                   	push   %edi
+  8042c9:	e8 dd ca ff ff       	call   800dab <sys_page_alloc>
+  8042ce:	89 c3                	mov    %eax,%ebx
+  8042d0:	83 c4 10             	add    $0x10,%esp
+  8042d3:	85 c0                	test   %eax,%eax
+  8042d5:	79 52                	jns    804329 <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  8042d7:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8042da:	75 52                	jne    80432e <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  8042dc:	83 ec 08             	sub    $0x8,%esp
+  8042df:	56                   	push   %esi
+  8042e0:	57                   	push   %edi
+  8042e1:	e8 3d fd ff ff       	call   804023 <page_out>
+  8042e6:	83 c4 10             	add    $0x10,%esp
+  8042e9:	85 c0                	test   %eax,%eax
+  8042eb:	79 d4                	jns    8042c1 <page_alloc+0x1e>
+  8042ed:	eb 3f                	jmp    80432e <page_alloc+0x8b>
+		init_map_dir();
+  8042ef:	e8 2f fc ff ff       	call   803f23 <init_map_dir>
+  8042f4:	eb c5                	jmp    8042bb <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  8042f6:	83 ec 08             	sub    $0x8,%esp
+  8042f9:	6a 00                	push   $0x0
+  8042fb:	56                   	push   %esi
+  8042fc:	e8 78 fc ff ff       	call   803f79 <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  804301:	83 c4 10             	add    $0x10,%esp
+  804304:	85 c0                	test   %eax,%eax
+  804306:	74 b9                	je     8042c1 <page_alloc+0x1e>
+  804308:	8b 10                	mov    (%eax),%edx
+  80430a:	f6 c2 01             	test   $0x1,%dl
+  80430d:	74 b2                	je     8042c1 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  80430f:	83 ec 08             	sub    $0x8,%esp
+  804312:	56                   	push   %esi
+  804313:	52                   	push   %edx
+  804314:	50                   	push   %eax
+  804315:	68 b8 64 80 00       	push   $0x8064b8
+  80431a:	68 34 03 00 00       	push   $0x334
+  80431f:	68 ab 61 80 00       	push   $0x8061ab
+  804324:	e8 cd be ff ff       	call   8001f6 <_panic>
+	return 0;
+  804329:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80432e:	89 d8                	mov    %ebx,%eax
+  804330:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804333:	5b                   	pop    %ebx
+  804334:	5e                   	pop    %esi
+  804335:	5f                   	pop    %edi
+  804336:	5d                   	pop    %ebp
+  804337:	c3                   	ret
+
+00804338 <page_adopt>:
+{
+  804338:	55                   	push   %ebp
+  804339:	89 e5                	mov    %esp,%ebp
+  80433b:	56                   	push   %esi
+  80433c:	53                   	push   %ebx
+  80433d:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80433f:	c1 e8 16             	shr    $0x16,%eax
+  804342:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  804349:	25 81 00 00 00       	and    $0x81,%eax
+  80434e:	83 f8 01             	cmp    $0x1,%eax
+  804351:	75 53                	jne    8043a6 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  804353:	89 d8                	mov    %ebx,%eax
+  804355:	c1 e8 0c             	shr    $0xc,%eax
+  804358:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  80435f:	89 f2                	mov    %esi,%edx
+  804361:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  804367:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80436c:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  804372:	75 37                	jne    8043ab <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  804374:	83 ec 08             	sub    $0x8,%esp
+  804377:	6a 01                	push   $0x1
+  804379:	53                   	push   %ebx
+  80437a:	e8 fa fb ff ff       	call   803f79 <umapdir_walk>
+  80437f:	83 c4 10             	add    $0x10,%esp
+  804382:	85 c0                	test   %eax,%eax
+  804384:	74 2c                	je     8043b2 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  804386:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  80438c:	83 ce 01             	or     $0x1,%esi
+  80438f:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  804391:	83 ec 08             	sub    $0x8,%esp
+  804394:	53                   	push   %ebx
+  804395:	6a 00                	push   $0x0
+  804397:	e8 94 ca ff ff       	call   800e30 <sys_page_unmap>
+	return 1;
+  80439c:	83 c4 10             	add    $0x10,%esp
+  80439f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043a4:	eb 05                	jmp    8043ab <page_adopt+0x73>
+		return 0;
+  8043a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8043ae:	5b                   	pop    %ebx
+  8043af:	5e                   	pop    %esi
+  8043b0:	5d                   	pop    %ebp
+  8043b1:	c3                   	ret
+		return -E_NO_MEM;
+  8043b2:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8043b7:	eb f2                	jmp    8043ab <page_adopt+0x73>
+
+008043b9 <page_forget>:
+{
+  8043b9:	55                   	push   %ebp
+  8043ba:	89 e5                	mov    %esp,%ebp
+  8043bc:	53                   	push   %ebx
+  8043bd:	83 ec 04             	sub    $0x4,%esp
+  8043c0:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  8043c2:	e8 4a ef ff ff       	call   803311 <find_paging_env>
+	if (pagingenv == 0)
+  8043c7:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8043ce:	74 39                	je     804409 <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  8043d0:	89 d8                	mov    %ebx,%eax
+  8043d2:	c1 e8 16             	shr    $0x16,%eax
+  8043d5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8043dc:	25 81 00 00 00       	and    $0x81,%eax
+  8043e1:	83 f8 01             	cmp    $0x1,%eax
+  8043e4:	74 28                	je     80440e <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  8043e6:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8043ed:	74 1a                	je     804409 <page_forget+0x50>
+  8043ef:	83 ec 08             	sub    $0x8,%esp
+  8043f2:	6a 00                	push   $0x0
+  8043f4:	53                   	push   %ebx
+  8043f5:	e8 7f fb ff ff       	call   803f79 <umapdir_walk>
+  8043fa:	89 c3                	mov    %eax,%ebx
+  8043fc:	83 c4 10             	add    $0x10,%esp
+  8043ff:	85 c0                	test   %eax,%eax
+  804401:	74 06                	je     804409 <page_forget+0x50>
+  804403:	8b 00                	mov    (%eax),%eax
+  804405:	a8 01                	test   $0x1,%al
+  804407:	75 2b                	jne    804434 <page_forget+0x7b>
+}
+  804409:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80440c:	c9                   	leave
+  80440d:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  80440e:	89 d8                	mov    %ebx,%eax
+  804410:	c1 e8 0c             	shr    $0xc,%eax
+  804413:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80441a:	89 c2                	mov    %eax,%edx
+  80441c:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  804422:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  804428:	75 bc                	jne    8043e6 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  80442a:	c1 e8 0c             	shr    $0xc,%eax
+  80442d:	e8 5c ee ff ff       	call   80328e <page_remove_slot>
+		return;
+  804432:	eb d5                	jmp    804409 <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  804434:	c1 e8 0c             	shr    $0xc,%eax
+  804437:	e8 52 ee ff ff       	call   80328e <page_remove_slot>
+	*mte = 0;
+  80443c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804442:	eb c5                	jmp    804409 <page_forget+0x50>
+
+00804444 <page_unmap>:
+{
+  804444:	55                   	push   %ebp
+  804445:	89 e5                	mov    %esp,%ebp
+  804447:	57                   	push   %edi
+  804448:	56                   	push   %esi
+  804449:	53                   	push   %ebx
+  80444a:	83 ec 0c             	sub    $0xc,%esp
+  80444d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804450:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  804453:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804458:	8b 40 48             	mov    0x48(%eax),%eax
+  80445b:	85 db                	test   %ebx,%ebx
+  80445d:	0f 8e b4 00 00 00    	jle    804517 <page_unmap+0xd3>
+  804463:	39 d8                	cmp    %ebx,%eax
+  804465:	0f 84 ac 00 00 00    	je     804517 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  80446b:	83 ec 08             	sub    $0x8,%esp
+  80446e:	57                   	push   %edi
+  80446f:	53                   	push   %ebx
+  804470:	e8 bb c9 ff ff       	call   800e30 <sys_page_unmap>
+  804475:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  804477:	e8 95 ee ff ff       	call   803311 <find_paging_env>
+	if (pagingenv == 0)
+  80447c:	83 c4 10             	add    $0x10,%esp
+  80447f:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  804486:	0f 84 a1 00 00 00    	je     80452d <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80448c:	83 ec 0c             	sub    $0xc,%esp
+  80448f:	6a 05                	push   $0x5
+  804491:	68 00 00 40 00       	push   $0x400000
+  804496:	6a 00                	push   $0x0
+  804498:	68 00 b0 ad de       	push   $0xdeadb000
+  80449d:	53                   	push   %ebx
+  80449e:	e8 4b c9 ff ff       	call   800dee <sys_page_map>
+  8044a3:	83 c4 20             	add    $0x20,%esp
+  8044a6:	85 c0                	test   %eax,%eax
+  8044a8:	0f 88 89 00 00 00    	js     804537 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8044ae:	89 f8                	mov    %edi,%eax
+  8044b0:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8044b3:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  8044ba:	a8 01                	test   $0x1,%al
+  8044bc:	74 6f                	je     80452d <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8044be:	83 ec 0c             	sub    $0xc,%esp
+  8044c1:	6a 05                	push   $0x5
+  8044c3:	68 00 00 40 00       	push   $0x400000
+  8044c8:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8044ca:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8044cf:	50                   	push   %eax
+  8044d0:	53                   	push   %ebx
+  8044d1:	e8 18 c9 ff ff       	call   800dee <sys_page_map>
+  8044d6:	83 c4 20             	add    $0x20,%esp
+  8044d9:	85 c0                	test   %eax,%eax
+  8044db:	78 6f                	js     80454c <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  8044dd:	c1 ef 0c             	shr    $0xc,%edi
+  8044e0:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8044e6:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  8044ed:	01 
+  8044ee:	74 3d                	je     80452d <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8044f0:	83 ec 08             	sub    $0x8,%esp
+  8044f3:	68 00 00 40 00       	push   $0x400000
+  8044f8:	6a 00                	push   $0x0
+  8044fa:	e8 31 c9 ff ff       	call   800e30 <sys_page_unmap>
+  8044ff:	83 c4 10             	add    $0x10,%esp
+  804502:	85 c0                	test   %eax,%eax
+  804504:	78 5b                	js     804561 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  804506:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  80450d:	c1 e8 0c             	shr    $0xc,%eax
+  804510:	e8 79 ed ff ff       	call   80328e <page_remove_slot>
+	return r;
+  804515:	eb 16                	jmp    80452d <page_unmap+0xe9>
+		page_forget(va);
+  804517:	89 f8                	mov    %edi,%eax
+  804519:	e8 9b fe ff ff       	call   8043b9 <page_forget>
+		return sys_page_unmap(envid, va);
+  80451e:	83 ec 08             	sub    $0x8,%esp
+  804521:	57                   	push   %edi
+  804522:	53                   	push   %ebx
+  804523:	e8 08 c9 ff ff       	call   800e30 <sys_page_unmap>
+  804528:	89 c6                	mov    %eax,%esi
+  80452a:	83 c4 10             	add    $0x10,%esp
+}
+  80452d:	89 f0                	mov    %esi,%eax
+  80452f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804532:	5b                   	pop    %ebx
+  804533:	5e                   	pop    %esi
+  804534:	5f                   	pop    %edi
+  804535:	5d                   	pop    %ebp
+  804536:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  804537:	50                   	push   %eax
+  804538:	68 f4 64 80 00       	push   $0x8064f4
+  80453d:	68 e4 03 00 00       	push   $0x3e4
+  804542:	68 ab 61 80 00       	push   $0x8061ab
+  804547:	e8 aa bc ff ff       	call   8001f6 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  80454c:	50                   	push   %eax
+  80454d:	68 20 65 80 00       	push   $0x806520
+  804552:	68 ea 03 00 00       	push   $0x3ea
+  804557:	68 ab 61 80 00       	push   $0x8061ab
+  80455c:	e8 95 bc ff ff       	call   8001f6 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  804561:	50                   	push   %eax
+  804562:	68 4c 65 80 00       	push   $0x80654c
+  804567:	68 ef 03 00 00       	push   $0x3ef
+  80456c:	68 ab 61 80 00       	push   $0x8061ab
+  804571:	e8 80 bc ff ff       	call   8001f6 <_panic>
+
+00804576 <page_unmap_range>:
+{
+  804576:	55                   	push   %ebp
+  804577:	89 e5                	mov    %esp,%ebp
+  804579:	57                   	push   %edi
+  80457a:	56                   	push   %esi
+  80457b:	53                   	push   %ebx
+  80457c:	83 ec 0c             	sub    $0xc,%esp
+  80457f:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  804582:	e8 8a ed ff ff       	call   803311 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  804587:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80458c:	8b 40 48             	mov    0x48(%eax),%eax
+  80458f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804593:	7e 38                	jle    8045cd <page_unmap_range+0x57>
+  804595:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804598:	74 33                	je     8045cd <page_unmap_range+0x57>
+  80459a:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8045a1:	74 2a                	je     8045cd <page_unmap_range+0x57>
+  8045a3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  8045a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8045ab:	39 fe                	cmp    %edi,%esi
+  8045ad:	74 56                	je     804605 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8045af:	83 ec 08             	sub    $0x8,%esp
+  8045b2:	53                   	push   %ebx
+  8045b3:	ff 75 08             	push   0x8(%ebp)
+  8045b6:	e8 89 fe ff ff       	call   804444 <page_unmap>
+  8045bb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8045c1:	83 c4 10             	add    $0x10,%esp
+  8045c4:	85 c0                	test   %eax,%eax
+  8045c6:	78 35                	js     8045fd <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8045c8:	83 c6 01             	add    $0x1,%esi
+  8045cb:	eb de                	jmp    8045ab <page_unmap_range+0x35>
+  8045cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  8045d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8045d5:	eb 10                	jmp    8045e7 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  8045d7:	89 f0                	mov    %esi,%eax
+  8045d9:	e8 db fd ff ff       	call   8043b9 <page_forget>
+		for (i = 0; i < npages; i++)
+  8045de:	83 c3 01             	add    $0x1,%ebx
+  8045e1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8045e7:	39 fb                	cmp    %edi,%ebx
+  8045e9:	75 ec                	jne    8045d7 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  8045eb:	83 ec 04             	sub    $0x4,%esp
+  8045ee:	57                   	push   %edi
+  8045ef:	ff 75 0c             	push   0xc(%ebp)
+  8045f2:	ff 75 08             	push   0x8(%ebp)
+  8045f5:	e8 4a c9 ff ff       	call   800f44 <sys_page_unmap_range>
+  8045fa:	83 c4 10             	add    $0x10,%esp
+}
+  8045fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804600:	5b                   	pop    %ebx
+  804601:	5e                   	pop    %esi
+  804602:	5f                   	pop    %edi
+  804603:	5d                   	pop    %ebp
+  804604:	c3                   	ret
+	return 0;
+  804605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460a:	eb f1                	jmp    8045fd <page_unmap_range+0x87>
+
+0080460c <page_alloc_range>:
+{
+  80460c:	55                   	push   %ebp
+  80460d:	89 e5                	mov    %esp,%ebp
+  80460f:	57                   	push   %edi
+  804610:	56                   	push   %esi
+  804611:	53                   	push   %ebx
+  804612:	83 ec 1c             	sub    $0x1c,%esp
+  804615:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804618:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  80461b:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  804622:	74 14                	je     804638 <page_alloc_range+0x2c>
+	if (check_mte)
+  804624:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  804628:	74 66                	je     804690 <page_alloc_range+0x84>
+  80462a:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  80462c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804631:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  804634:	89 c7                	mov    %eax,%edi
+  804636:	eb 10                	jmp    804648 <page_alloc_range+0x3c>
+		init_map_dir();
+  804638:	e8 e6 f8 ff ff       	call   803f23 <init_map_dir>
+  80463d:	eb e5                	jmp    804624 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  80463f:	83 c7 01             	add    $0x1,%edi
+  804642:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  804648:	39 df                	cmp    %ebx,%edi
+  80464a:	74 38                	je     804684 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  80464c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  80464f:	83 ec 08             	sub    $0x8,%esp
+  804652:	6a 00                	push   $0x0
+  804654:	56                   	push   %esi
+  804655:	e8 1f f9 ff ff       	call   803f79 <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  80465a:	83 c4 10             	add    $0x10,%esp
+  80465d:	85 c0                	test   %eax,%eax
+  80465f:	74 de                	je     80463f <page_alloc_range+0x33>
+  804661:	8b 10                	mov    (%eax),%edx
+  804663:	f6 c2 01             	test   $0x1,%dl
+  804666:	74 d7                	je     80463f <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  804668:	83 ec 08             	sub    $0x8,%esp
+  80466b:	ff 75 e4             	push   -0x1c(%ebp)
+  80466e:	52                   	push   %edx
+  80466f:	50                   	push   %eax
+  804670:	68 b8 64 80 00       	push   $0x8064b8
+  804675:	68 0b 04 00 00       	push   $0x40b
+  80467a:	68 ab 61 80 00       	push   $0x8061ab
+  80467f:	e8 72 bb ff ff       	call   8001f6 <_panic>
+  804684:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804687:	eb 07                	jmp    804690 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  804689:	c1 e0 0c             	shl    $0xc,%eax
+  80468c:	01 c7                	add    %eax,%edi
+			npages -= r;
+  80468e:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  804690:	85 db                	test   %ebx,%ebx
+  804692:	74 30                	je     8046c4 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  804694:	ff 75 14             	push   0x14(%ebp)
+  804697:	53                   	push   %ebx
+  804698:	57                   	push   %edi
+  804699:	ff 75 08             	push   0x8(%ebp)
+  80469c:	e8 35 c8 ff ff       	call   800ed6 <sys_page_alloc_range>
+  8046a1:	89 c6                	mov    %eax,%esi
+  8046a3:	83 c4 10             	add    $0x10,%esp
+  8046a6:	85 c0                	test   %eax,%eax
+  8046a8:	7f df                	jg     804689 <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8046aa:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8046ad:	75 1a                	jne    8046c9 <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8046af:	83 ec 08             	sub    $0x8,%esp
+  8046b2:	57                   	push   %edi
+  8046b3:	ff 75 08             	push   0x8(%ebp)
+  8046b6:	e8 68 f9 ff ff       	call   804023 <page_out>
+  8046bb:	83 c4 10             	add    $0x10,%esp
+  8046be:	85 c0                	test   %eax,%eax
+  8046c0:	79 ce                	jns    804690 <page_alloc_range+0x84>
+  8046c2:	eb 05                	jmp    8046c9 <page_alloc_range+0xbd>
+	return 0;
+  8046c4:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8046c9:	89 f0                	mov    %esi,%eax
+  8046cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046ce:	5b                   	pop    %ebx
+  8046cf:	5e                   	pop    %esi
+  8046d0:	5f                   	pop    %edi
+  8046d1:	5d                   	pop    %ebp
+  8046d2:	c3                   	ret
+
+008046d3 <page_in>:
+{
+  8046d3:	55                   	push   %ebp
+  8046d4:	89 e5                	mov    %esp,%ebp
+  8046d6:	57                   	push   %edi
+  8046d7:	56                   	push   %esi
+  8046d8:	53                   	push   %ebx
+  8046d9:	83 ec 3c             	sub    $0x3c,%esp
+  8046dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  8046df:	e8 2d ec ff ff       	call   803311 <find_paging_env>
+	if (pagingenv == 0)
+  8046e4:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8046eb:	0f 84 09 02 00 00    	je     8048fa <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  8046f1:	83 ec 08             	sub    $0x8,%esp
+  8046f4:	6a 00                	push   $0x0
+  8046f6:	56                   	push   %esi
+  8046f7:	e8 7d f8 ff ff       	call   803f79 <umapdir_walk>
+  8046fc:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8046fe:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  804704:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  804707:	83 c4 10             	add    $0x10,%esp
+  80470a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80470e:	74 0d                	je     80471d <page_in+0x4a>
+  804710:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804715:	8b 40 48             	mov    0x48(%eax),%eax
+  804718:	3b 45 08             	cmp    0x8(%ebp),%eax
+  80471b:	75 06                	jne    804723 <page_in+0x50>
+  80471d:	8b 03                	mov    (%ebx),%eax
+  80471f:	a8 02                	test   $0x2,%al
+  804721:	75 63                	jne    804786 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  804723:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804725:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804727:	89 f0                	mov    %esi,%eax
+  804729:	25 06 0e 00 00       	and    $0xe06,%eax
+  80472e:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804731:	50                   	push   %eax
+  804732:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804735:	57                   	push   %edi
+  804736:	ff 75 08             	push   0x8(%ebp)
+  804739:	e8 65 fb ff ff       	call   8042a3 <page_alloc>
+  80473e:	83 c4 10             	add    $0x10,%esp
+  804741:	85 c0                	test   %eax,%eax
+  804743:	78 39                	js     80477e <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  804745:	89 f0                	mov    %esi,%eax
+  804747:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  80474a:	83 ec 0c             	sub    $0xc,%esp
+  80474d:	6a 07                	push   $0x7
+  80474f:	6a 01                	push   $0x1
+  804751:	57                   	push   %edi
+  804752:	c1 e0 04             	shl    $0x4,%eax
+  804755:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804756:	c1 ee 1c             	shr    $0x1c,%esi
+  804759:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  80475c:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  804763:	e8 f1 0f 00 00       	call   805759 <ipc_call>
+  804768:	83 c4 20             	add    $0x20,%esp
+  80476b:	85 c0                	test   %eax,%eax
+  80476d:	0f 88 72 01 00 00    	js     8048e5 <page_in+0x212>
+	*mte = 0;
+  804773:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804779:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80477e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804781:	5b                   	pop    %ebx
+  804782:	5e                   	pop    %esi
+  804783:	5f                   	pop    %edi
+  804784:	5d                   	pop    %ebp
+  804785:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804786:	25 06 0e 00 00       	and    $0xe06,%eax
+  80478b:	83 c8 01             	or     $0x1,%eax
+  80478e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  804791:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804794:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804797:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  80479d:	be 01 00 00 00       	mov    $0x1,%esi
+  8047a2:	eb 46                	jmp    8047ea <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  8047a4:	83 ec 08             	sub    $0x8,%esp
+  8047a7:	6a 00                	push   $0x0
+  8047a9:	51                   	push   %ecx
+  8047aa:	e8 ca f7 ff ff       	call   803f79 <umapdir_walk>
+  8047af:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  8047b3:	83 c4 10             	add    $0x10,%esp
+  8047b6:	85 c0                	test   %eax,%eax
+  8047b8:	74 66                	je     804820 <page_in+0x14d>
+  8047ba:	8b 00                	mov    (%eax),%eax
+  8047bc:	a8 01                	test   $0x1,%al
+  8047be:	74 60                	je     804820 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  8047c0:	89 c2                	mov    %eax,%edx
+  8047c2:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  8047c8:	83 ca 01             	or     $0x1,%edx
+  8047cb:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  8047ce:	75 50                	jne    804820 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  8047d0:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8047d6:	c1 e8 1c             	shr    $0x1c,%eax
+  8047d9:	8b 13                	mov    (%ebx),%edx
+  8047db:	c1 ea 1c             	shr    $0x1c,%edx
+  8047de:	39 d0                	cmp    %edx,%eax
+  8047e0:	75 3e                	jne    804820 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  8047e2:	83 c6 01             	add    $0x1,%esi
+  8047e5:	83 fe 08             	cmp    $0x8,%esi
+  8047e8:	74 3f                	je     804829 <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  8047ea:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  8047ec:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  8047f2:	77 2c                	ja     804820 <page_in+0x14d>
+  8047f4:	89 f8                	mov    %edi,%eax
+  8047f6:	c1 e8 16             	shr    $0x16,%eax
+  8047f9:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804800:	f6 c2 01             	test   $0x1,%dl
+  804803:	74 9f                	je     8047a4 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804805:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  80480c:	a8 80                	test   $0x80,%al
+  80480e:	75 10                	jne    804820 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804810:	89 f8                	mov    %edi,%eax
+  804812:	c1 e8 0c             	shr    $0xc,%eax
+  804815:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80481c:	a8 01                	test   $0x1,%al
+  80481e:	74 84                	je     8047a4 <page_in+0xd1>
+	if (n == 1)
+  804820:	83 fe 01             	cmp    $0x1,%esi
+  804823:	0f 84 fa fe ff ff    	je     804723 <page_in+0x50>
+	req.nslots = n;
+  804829:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  80482f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804834:	eb 13                	jmp    804849 <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  804836:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  80483a:	8b 12                	mov    (%edx),%edx
+  80483c:	c1 ea 0c             	shr    $0xc,%edx
+  80483f:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  804846:	83 c0 01             	add    $0x1,%eax
+  804849:	39 c6                	cmp    %eax,%esi
+  80484b:	75 e9                	jne    804836 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  80484d:	83 ec 0c             	sub    $0xc,%esp
+  804850:	6a 00                	push   $0x0
+  804852:	ff 75 c0             	push   -0x40(%ebp)
+  804855:	56                   	push   %esi
+  804856:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804859:	57                   	push   %edi
+  80485a:	6a 00                	push   $0x0
+  80485c:	e8 ab fd ff ff       	call   80460c <page_alloc_range>
+  804861:	83 c4 20             	add    $0x20,%esp
+  804864:	85 c0                	test   %eax,%eax
+  804866:	78 6e                	js     8048d6 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804868:	83 ec 04             	sub    $0x4,%esp
+  80486b:	6a 24                	push   $0x24
+  80486d:	68 00 90 80 00       	push   $0x809000
+  804872:	57                   	push   %edi
+  804873:	e8 c6 c1 ff ff       	call   800a3e <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804878:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80487f:	56                   	push   %esi
+  804880:	57                   	push   %edi
+  804881:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804883:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  80488a:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  80488d:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  804894:	e8 c0 0e 00 00       	call   805759 <ipc_call>
+  804899:	83 c4 20             	add    $0x20,%esp
+  80489c:	85 c0                	test   %eax,%eax
+  80489e:	78 08                	js     8048a8 <page_in+0x1d5>
+  8048a0:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8048a3:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  8048a6:	eb 20                	jmp    8048c8 <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  8048a8:	50                   	push   %eax
+  8048a9:	68 78 65 80 00       	push   $0x806578
+  8048ae:	68 59 02 00 00       	push   $0x259
+  8048b3:	68 ab 61 80 00       	push   $0x8061ab
+  8048b8:	e8 39 b9 ff ff       	call   8001f6 <_panic>
+		*mtes[i] = 0;
+  8048bd:	8b 10                	mov    (%eax),%edx
+  8048bf:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  8048c5:	83 c0 04             	add    $0x4,%eax
+  8048c8:	39 c8                	cmp    %ecx,%eax
+  8048ca:	75 f1                	jne    8048bd <page_in+0x1ea>
+	return n;
+  8048cc:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  8048ce:	85 f6                	test   %esi,%esi
+  8048d0:	0f 84 4d fe ff ff    	je     804723 <page_in+0x50>
+		return r < 0 ? r : 0;
+  8048d6:	85 c0                	test   %eax,%eax
+  8048d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048dd:	0f 4f c2             	cmovg  %edx,%eax
+  8048e0:	e9 99 fe ff ff       	jmp    80477e <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  8048e5:	50                   	push   %eax
+  8048e6:	68 b0 65 80 00       	push   $0x8065b0
+  8048eb:	68 9a 02 00 00       	push   $0x29a
+  8048f0:	68 ab 61 80 00       	push   $0x8061ab
+  8048f5:	e8 fc b8 ff ff       	call   8001f6 <_panic>
+		return -E_PAGING;
+  8048fa:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8048ff:	e9 7a fe ff ff       	jmp    80477e <page_in+0xab>
+
+00804904 <page_map>:
+{
+  804904:	55                   	push   %ebp
+  804905:	89 e5                	mov    %esp,%ebp
+  804907:	57                   	push   %edi
+  804908:	56                   	push   %esi
+  804909:	53                   	push   %ebx
+  80490a:	83 ec 1c             	sub    $0x1c,%esp
+  80490d:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804910:	83 ec 0c             	sub    $0xc,%esp
+  804913:	ff 75 18             	push   0x18(%ebp)
+  804916:	ff 75 14             	push   0x14(%ebp)
+  804919:	ff 75 10             	push   0x10(%ebp)
+  80491c:	ff 75 0c             	push   0xc(%ebp)
+  80491f:	56                   	push   %esi
+  804920:	e8 c9 c4 ff ff       	call   800dee <sys_page_map>
+  804925:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804928:	83 c4 20             	add    $0x20,%esp
+  80492b:	85 c0                	test   %eax,%eax
+  80492d:	0f 89 a9 01 00 00    	jns    804adc <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  804933:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  804937:	74 5f                	je     804998 <page_map+0x94>
+		if (r != -E_INVAL)
+  804939:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  80493d:	0f 85 a0 01 00 00    	jne    804ae3 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804943:	85 f6                	test   %esi,%esi
+  804945:	74 70                	je     8049b7 <page_map+0xb3>
+  804947:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80494c:	8b 40 48             	mov    0x48(%eax),%eax
+  80494f:	39 f0                	cmp    %esi,%eax
+  804951:	74 64                	je     8049b7 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804953:	83 ec 0c             	sub    $0xc,%esp
+  804956:	6a 05                	push   $0x5
+  804958:	68 00 00 40 00       	push   $0x400000
+  80495d:	6a 00                	push   $0x0
+  80495f:	68 00 b0 ad de       	push   $0xdeadb000
+  804964:	56                   	push   %esi
+  804965:	e8 84 c4 ff ff       	call   800dee <sys_page_map>
+  80496a:	89 c3                	mov    %eax,%ebx
+  80496c:	83 c4 20             	add    $0x20,%esp
+  80496f:	85 c0                	test   %eax,%eax
+  804971:	79 6a                	jns    8049dd <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  804973:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804976:	75 50                	jne    8049c8 <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804978:	83 ec 08             	sub    $0x8,%esp
+  80497b:	68 00 00 40 00       	push   $0x400000
+  804980:	6a fc                	push   $0xfffffffc
+  804982:	e8 9c f6 ff ff       	call   804023 <page_out>
+  804987:	83 c4 10             	add    $0x10,%esp
+  80498a:	85 c0                	test   %eax,%eax
+  80498c:	79 c5                	jns    804953 <page_map+0x4f>
+}
+  80498e:	89 d8                	mov    %ebx,%eax
+  804990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804993:	5b                   	pop    %ebx
+  804994:	5e                   	pop    %esi
+  804995:	5f                   	pop    %edi
+  804996:	5d                   	pop    %ebp
+  804997:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804998:	83 ec 08             	sub    $0x8,%esp
+  80499b:	68 00 00 40 00       	push   $0x400000
+  8049a0:	6a 00                	push   $0x0
+  8049a2:	e8 7c f6 ff ff       	call   804023 <page_out>
+  8049a7:	83 c4 10             	add    $0x10,%esp
+  8049aa:	85 c0                	test   %eax,%eax
+  8049ac:	0f 89 5e ff ff ff    	jns    804910 <page_map+0xc>
+				return r;
+  8049b2:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8049b5:	eb d7                	jmp    80498e <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  8049b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8049ba:	e8 79 f9 ff ff       	call   804338 <page_adopt>
+  8049bf:	85 c0                	test   %eax,%eax
+  8049c1:	79 90                	jns    804953 <page_map+0x4f>
+			return r;
+  8049c3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8049c6:	eb c6                	jmp    80498e <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  8049c8:	53                   	push   %ebx
+  8049c9:	68 e4 65 80 00       	push   $0x8065e4
+  8049ce:	68 77 03 00 00       	push   $0x377
+  8049d3:	68 ab 61 80 00       	push   $0x8061ab
+  8049d8:	e8 19 b8 ff ff       	call   8001f6 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  8049dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8049e0:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8049e3:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  8049ea:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  8049f0:	0f 84 f5 00 00 00    	je     804aeb <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8049f6:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8049fc:	83 ec 0c             	sub    $0xc,%esp
+  8049ff:	6a 05                	push   $0x5
+  804a01:	68 00 00 40 00       	push   $0x400000
+  804a06:	6a 00                	push   $0x0
+  804a08:	57                   	push   %edi
+  804a09:	56                   	push   %esi
+  804a0a:	e8 df c3 ff ff       	call   800dee <sys_page_map>
+  804a0f:	89 c3                	mov    %eax,%ebx
+  804a11:	83 c4 20             	add    $0x20,%esp
+  804a14:	85 c0                	test   %eax,%eax
+  804a16:	79 35                	jns    804a4d <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  804a18:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804a1b:	75 1b                	jne    804a38 <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804a1d:	83 ec 08             	sub    $0x8,%esp
+  804a20:	68 00 00 40 00       	push   $0x400000
+  804a25:	6a 00                	push   $0x0
+  804a27:	e8 f7 f5 ff ff       	call   804023 <page_out>
+  804a2c:	83 c4 10             	add    $0x10,%esp
+  804a2f:	85 c0                	test   %eax,%eax
+  804a31:	79 c9                	jns    8049fc <page_map+0xf8>
+  804a33:	e9 56 ff ff ff       	jmp    80498e <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  804a38:	53                   	push   %ebx
+  804a39:	68 0c 66 80 00       	push   $0x80660c
+  804a3e:	68 83 03 00 00       	push   $0x383
+  804a43:	68 ab 61 80 00       	push   $0x8061ab
+  804a48:	e8 a9 b7 ff ff       	call   8001f6 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  804a4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804a50:	c1 e8 0c             	shr    $0xc,%eax
+  804a53:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  804a58:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  804a5f:	01 
+  804a60:	0f 84 8d 00 00 00    	je     804af3 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804a66:	83 ec 08             	sub    $0x8,%esp
+  804a69:	68 00 00 40 00       	push   $0x400000
+  804a6e:	6a 00                	push   $0x0
+  804a70:	e8 bb c3 ff ff       	call   800e30 <sys_page_unmap>
+  804a75:	83 c4 10             	add    $0x10,%esp
+  804a78:	85 c0                	test   %eax,%eax
+  804a7a:	78 36                	js     804ab2 <page_map+0x1ae>
+  804a7c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804a7f:	83 ec 08             	sub    $0x8,%esp
+  804a82:	57                   	push   %edi
+  804a83:	56                   	push   %esi
+  804a84:	e8 4a fc ff ff       	call   8046d3 <page_in>
+  804a89:	89 c3                	mov    %eax,%ebx
+  804a8b:	83 c4 10             	add    $0x10,%esp
+  804a8e:	85 c0                	test   %eax,%eax
+  804a90:	0f 89 7a fe ff ff    	jns    804910 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804a96:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804a99:	75 2c                	jne    804ac7 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804a9b:	83 ec 08             	sub    $0x8,%esp
+  804a9e:	57                   	push   %edi
+  804a9f:	6a 00                	push   $0x0
+  804aa1:	e8 7d f5 ff ff       	call   804023 <page_out>
+  804aa6:	83 c4 10             	add    $0x10,%esp
+  804aa9:	85 c0                	test   %eax,%eax
+  804aab:	79 d2                	jns    804a7f <page_map+0x17b>
+  804aad:	e9 dc fe ff ff       	jmp    80498e <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804ab2:	50                   	push   %eax
+  804ab3:	68 38 66 80 00       	push   $0x806638
+  804ab8:	68 8b 03 00 00       	push   $0x38b
+  804abd:	68 ab 61 80 00       	push   $0x8061ab
+  804ac2:	e8 2f b7 ff ff       	call   8001f6 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804ac7:	53                   	push   %ebx
+  804ac8:	68 60 66 80 00       	push   $0x806660
+  804acd:	68 91 03 00 00       	push   $0x391
+  804ad2:	68 ab 61 80 00       	push   $0x8061ab
+  804ad7:	e8 1a b7 ff ff       	call   8001f6 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804adc:	89 c3                	mov    %eax,%ebx
+  804ade:	e9 ab fe ff ff       	jmp    80498e <page_map+0x8a>
+  804ae3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804ae6:	e9 a3 fe ff ff       	jmp    80498e <page_map+0x8a>
+			return r; // Pass through the error
+  804aeb:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804aee:	e9 9b fe ff ff       	jmp    80498e <page_map+0x8a>
+			return r; // Pass through the error
+  804af3:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804af6:	e9 93 fe ff ff       	jmp    80498e <page_map+0x8a>
+
+00804afb <page_map_range>:
+{
+  804afb:	55                   	push   %ebp
+  804afc:	89 e5                	mov    %esp,%ebp
+  804afe:	57                   	push   %edi
+  804aff:	56                   	push   %esi
+  804b00:	53                   	push   %ebx
+  804b01:	83 ec 0c             	sub    $0xc,%esp
+  804b04:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804b07:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  804b0a:	83 ec 08             	sub    $0x8,%esp
+  804b0d:	ff 75 1c             	push   0x1c(%ebp)
+  804b10:	ff 75 18             	push   0x18(%ebp)
+  804b13:	56                   	push   %esi
+  804b14:	ff 75 10             	push   0x10(%ebp)
+  804b17:	57                   	push   %edi
+  804b18:	ff 75 08             	push   0x8(%ebp)
+  804b1b:	e8 d9 c3 ff ff       	call   800ef9 <sys_page_map_range>
+  804b20:	89 c3                	mov    %eax,%ebx
+  804b22:	83 c4 20             	add    $0x20,%esp
+  804b25:	85 c0                	test   %eax,%eax
+  804b27:	79 1b                	jns    804b44 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804b29:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804b2c:	75 20                	jne    804b4e <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804b2e:	83 ec 08             	sub    $0x8,%esp
+  804b31:	68 00 00 40 00       	push   $0x400000
+  804b36:	6a 00                	push   $0x0
+  804b38:	e8 e6 f4 ff ff       	call   804023 <page_out>
+  804b3d:	83 c4 10             	add    $0x10,%esp
+  804b40:	85 c0                	test   %eax,%eax
+  804b42:	79 c6                	jns    804b0a <page_map_range+0xf>
+}
+  804b44:	89 d8                	mov    %ebx,%eax
+  804b46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b49:	5b                   	pop    %ebx
+  804b4a:	5e                   	pop    %esi
+  804b4b:	5f                   	pop    %edi
+  804b4c:	5d                   	pop    %ebp
+  804b4d:	c3                   	ret
+		if (r != -E_INVAL)
+  804b4e:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  804b51:	75 f1                	jne    804b44 <page_map_range+0x49>
+  804b53:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  804b55:	be 00 00 00 00       	mov    $0x0,%esi
+  804b5a:	eb 03                	jmp    804b5f <page_map_range+0x64>
+  804b5c:	83 c6 01             	add    $0x1,%esi
+  804b5f:	3b 75 18             	cmp    0x18(%ebp),%esi
+  804b62:	74 2a                	je     804b8e <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  804b64:	83 ec 0c             	sub    $0xc,%esp
+  804b67:	ff 75 1c             	push   0x1c(%ebp)
+  804b6a:	53                   	push   %ebx
+  804b6b:	ff 75 10             	push   0x10(%ebp)
+  804b6e:	57                   	push   %edi
+  804b6f:	ff 75 08             	push   0x8(%ebp)
+  804b72:	e8 8d fd ff ff       	call   804904 <page_map>
+  804b77:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804b7d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804b83:	83 c4 20             	add    $0x20,%esp
+  804b86:	85 c0                	test   %eax,%eax
+  804b88:	79 d2                	jns    804b5c <page_map_range+0x61>
+  804b8a:	89 c3                	mov    %eax,%ebx
+  804b8c:	eb b6                	jmp    804b44 <page_map_range+0x49>
+		return 0;
+  804b8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804b93:	eb af                	jmp    804b44 <page_map_range+0x49>
+
+00804b95 <paging_pgfault_handler>:
+{
+  804b95:	55                   	push   %ebp
+  804b96:	89 e5                	mov    %esp,%ebp
+  804b98:	56                   	push   %esi
+  804b99:	53                   	push   %ebx
+  804b9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804b9d:	e8 6f e7 ff ff       	call   803311 <find_paging_env>
+	if (pagingenv == 0)
+  804ba2:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804ba7:	85 c0                	test   %eax,%eax
+  804ba9:	74 3c                	je     804be7 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804bab:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804bad:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804bb1:	75 12                	jne    804bc5 <paging_pgfault_handler+0x30>
+  804bb3:	89 f0                	mov    %esi,%eax
+  804bb5:	e8 7e f7 ff ff       	call   804338 <page_adopt>
+  804bba:	89 c2                	mov    %eax,%edx
+		return 0;
+  804bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804bc1:	85 d2                	test   %edx,%edx
+  804bc3:	78 22                	js     804be7 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804bc5:	83 ec 08             	sub    $0x8,%esp
+  804bc8:	6a 00                	push   $0x0
+  804bca:	56                   	push   %esi
+  804bcb:	e8 a9 f3 ff ff       	call   803f79 <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804bd0:	83 c4 10             	add    $0x10,%esp
+  804bd3:	85 c0                	test   %eax,%eax
+  804bd5:	74 05                	je     804bdc <paging_pgfault_handler+0x47>
+  804bd7:	f6 00 01             	testb  $0x1,(%eax)
+  804bda:	75 12                	jne    804bee <paging_pgfault_handler+0x59>
+	return 0;
+  804bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804be1:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804be5:	74 23                	je     804c0a <paging_pgfault_handler+0x75>
+}
+  804be7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804bea:	5b                   	pop    %ebx
+  804beb:	5e                   	pop    %esi
+  804bec:	5d                   	pop    %ebp
+  804bed:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804bee:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804bf3:	8b 40 48             	mov    0x48(%eax),%eax
+  804bf6:	83 ec 08             	sub    $0x8,%esp
+  804bf9:	56                   	push   %esi
+  804bfa:	50                   	push   %eax
+  804bfb:	e8 d3 fa ff ff       	call   8046d3 <page_in>
+  804c00:	f7 d0                	not    %eax
+  804c02:	c1 e8 1f             	shr    $0x1f,%eax
+  804c05:	83 c4 10             	add    $0x10,%esp
+  804c08:	eb dd                	jmp    804be7 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804c0a:	89 f0                	mov    %esi,%eax
+  804c0c:	e8 97 e2 ff ff       	call   802ea8 <segment_lookup>
+  804c11:	89 c2                	mov    %eax,%edx
+	return 0;
+  804c13:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804c18:	85 d2                	test   %edx,%edx
+  804c1a:	74 cb                	je     804be7 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  804c1c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804c21:	8b 40 48             	mov    0x48(%eax),%eax
+  804c24:	83 ec 08             	sub    $0x8,%esp
+  804c27:	56                   	push   %esi
+  804c28:	50                   	push   %eax
+  804c29:	e8 f5 f3 ff ff       	call   804023 <page_out>
+  804c2e:	f7 d0                	not    %eax
+  804c30:	c1 e8 1f             	shr    $0x1f,%eax
+  804c33:	83 c4 10             	add    $0x10,%esp
+  804c36:	eb af                	jmp    804be7 <paging_pgfault_handler+0x52>
+
+00804c38 <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  804c38:	55                   	push   %ebp
+  804c39:	89 e5                	mov    %esp,%ebp
+  804c3b:	57                   	push   %edi
+  804c3c:	56                   	push   %esi
+  804c3d:	53                   	push   %ebx
+  804c3e:	83 ec 2c             	sub    $0x2c,%esp
+  804c41:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804c44:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804c49:	89 c1                	mov    %eax,%ecx
+  804c4b:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  804c4e:	c1 e8 11             	shr    $0x11,%eax
+  804c51:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804c54:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  804c5b:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  804c5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804c63:	d3 e0                	shl    %cl,%eax
+  804c65:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804c68:	85 c7                	test   %eax,%edi
+  804c6a:	74 12                	je     804c7e <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804c6c:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804c71:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  804c74:	bf 01 00 00 00       	mov    $0x1,%edi
+  804c79:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804c7c:	eb 17                	jmp    804c95 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804c7e:	ff 75 e0             	push   -0x20(%ebp)
+  804c81:	68 98 66 80 00       	push   $0x806698
+  804c86:	6a 48                	push   $0x48
+  804c88:	68 b2 66 80 00       	push   $0x8066b2
+  804c8d:	e8 64 b5 ff ff       	call   8001f6 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804c92:	83 c3 01             	add    $0x1,%ebx
+  804c95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804c98:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804c9b:	89 c8                	mov    %ecx,%eax
+  804c9d:	c1 e8 05             	shr    $0x5,%eax
+  804ca0:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804ca7:	89 fe                	mov    %edi,%esi
+  804ca9:	d3 e6                	shl    %cl,%esi
+  804cab:	89 f1                	mov    %esi,%ecx
+  804cad:	85 d6                	test   %edx,%esi
+  804caf:	74 e1                	je     804c92 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804cb1:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804cb4:	f7 d6                	not    %esi
+  804cb6:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804cb9:	21 fe                	and    %edi,%esi
+  804cbb:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804cbe:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804cc5:	f7 d1                	not    %ecx
+  804cc7:	21 d1                	and    %edx,%ecx
+  804cc9:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804cd0:	83 ec 04             	sub    $0x4,%esp
+  804cd3:	53                   	push   %ebx
+  804cd4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804cd7:	57                   	push   %edi
+  804cd8:	6a 00                	push   $0x0
+  804cda:	e8 97 f8 ff ff       	call   804576 <page_unmap_range>
+	va_free(va, n);
+  804cdf:	83 c4 08             	add    $0x8,%esp
+  804ce2:	53                   	push   %ebx
+  804ce3:	57                   	push   %edi
+  804ce4:	e8 ed 05 00 00       	call   8052d6 <va_free>
+}
+  804ce9:	83 c4 10             	add    $0x10,%esp
+  804cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804cef:	5b                   	pop    %ebx
+  804cf0:	5e                   	pop    %esi
+  804cf1:	5f                   	pop    %edi
+  804cf2:	5d                   	pop    %ebp
+  804cf3:	c3                   	ret
+
+00804cf4 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804cf4:	55                   	push   %ebp
+  804cf5:	89 e5                	mov    %esp,%ebp
+  804cf7:	57                   	push   %edi
+  804cf8:	56                   	push   %esi
+  804cf9:	53                   	push   %ebx
+  804cfa:	83 ec 1c             	sub    $0x1c,%esp
+  804cfd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804d00:	85 db                	test   %ebx,%ebx
+  804d02:	74 34                	je     804d38 <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804d04:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804d0a:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804d0f:	77 2f                	ja     804d40 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804d11:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804d17:	75 51                	jne    804d6a <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  804d19:	89 c1                	mov    %eax,%ecx
+  804d1b:	c1 e9 0c             	shr    $0xc,%ecx
+  804d1e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804d23:	d3 e2                	shl    %cl,%edx
+  804d25:	c1 e8 11             	shr    $0x11,%eax
+  804d28:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  804d2f:	75 24                	jne    804d55 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804d31:	89 d8                	mov    %ebx,%eax
+  804d33:	e8 00 ff ff ff       	call   804c38 <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  804d38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804d3b:	5b                   	pop    %ebx
+  804d3c:	5e                   	pop    %esi
+  804d3d:	5f                   	pop    %edi
+  804d3e:	5d                   	pop    %ebp
+  804d3f:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804d40:	53                   	push   %ebx
+  804d41:	68 bf 66 80 00       	push   $0x8066bf
+  804d46:	68 a2 00 00 00       	push   $0xa2
+  804d4b:	68 b2 66 80 00       	push   $0x8066b2
+  804d50:	e8 a1 b4 ff ff       	call   8001f6 <_panic>
+			panic("free: %p is not allocated", va);
+  804d55:	53                   	push   %ebx
+  804d56:	68 98 66 80 00       	push   $0x806698
+  804d5b:	68 a5 00 00 00       	push   $0xa5
+  804d60:	68 b2 66 80 00       	push   $0x8066b2
+  804d65:	e8 8c b4 ff ff       	call   8001f6 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  804d6a:	89 de                	mov    %ebx,%esi
+  804d6c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804d72:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  804d78:	89 c8                	mov    %ecx,%eax
+  804d7a:	c1 e8 11             	shr    $0x11,%eax
+  804d7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804d80:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  804d87:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  804d8a:	c1 e9 0c             	shr    $0xc,%ecx
+  804d8d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804d92:	d3 e0                	shl    %cl,%eax
+  804d94:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804d97:	85 c7                	test   %eax,%edi
+  804d99:	74 1b                	je     804db6 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  804d9b:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804d9f:	89 d8                	mov    %ebx,%eax
+  804da1:	29 f0                	sub    %esi,%eax
+  804da3:	83 e8 10             	sub    $0x10,%eax
+  804da6:	99                   	cltd
+  804da7:	f7 ff                	idiv   %edi
+  804da9:	89 d1                	mov    %edx,%ecx
+  804dab:	85 d2                	test   %edx,%edx
+  804dad:	75 07                	jne    804db6 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804daf:	ba 10 00 00 00       	mov    $0x10,%edx
+  804db4:	eb 18                	jmp    804dce <free+0xda>
+		panic("free: %p is not allocated", va);
+  804db6:	53                   	push   %ebx
+  804db7:	68 98 66 80 00       	push   $0x806698
+  804dbc:	68 ad 00 00 00       	push   $0xad
+  804dc1:	68 b2 66 80 00       	push   $0x8066b2
+  804dc6:	e8 2b b4 ff ff       	call   8001f6 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  804dcb:	83 c1 01             	add    $0x1,%ecx
+  804dce:	89 d0                	mov    %edx,%eax
+  804dd0:	d3 e0                	shl    %cl,%eax
+  804dd2:	39 c7                	cmp    %eax,%edi
+  804dd4:	7f f5                	jg     804dcb <free+0xd7>
+	*(void **) va = s->free;
+  804dd6:	8b 46 08             	mov    0x8(%esi),%eax
+  804dd9:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  804ddb:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  804dde:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  804de2:	8d 58 01             	lea    0x1(%eax),%ebx
+  804de5:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  804de9:	66 85 c0             	test   %ax,%ax
+  804dec:	74 52                	je     804e40 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804dee:	0f b7 db             	movzwl %bx,%ebx
+  804df1:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804df5:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dff:	f7 ff                	idiv   %edi
+  804e01:	39 c3                	cmp    %eax,%ebx
+  804e03:	0f 85 2f ff ff ff    	jne    804d38 <free+0x44>
+  804e09:	8b 46 04             	mov    0x4(%esi),%eax
+  804e0c:	85 c0                	test   %eax,%eax
+  804e0e:	74 53                	je     804e63 <free+0x16f>
+		s->prev->next = s->next;
+  804e10:	8b 16                	mov    (%esi),%edx
+  804e12:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804e14:	8b 06                	mov    (%esi),%eax
+  804e16:	85 c0                	test   %eax,%eax
+  804e18:	74 06                	je     804e20 <free+0x12c>
+		s->next->prev = s->prev;
+  804e1a:	8b 56 04             	mov    0x4(%esi),%edx
+  804e1d:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804e20:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804e23:	f7 d0                	not    %eax
+  804e25:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804e28:	21 d0                	and    %edx,%eax
+  804e2a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  804e2d:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  804e34:	89 f0                	mov    %esi,%eax
+  804e36:	e8 fd fd ff ff       	call   804c38 <heap_free_pages>
+  804e3b:	e9 f8 fe ff ff       	jmp    804d38 <free+0x44>
+	s->prev = NULL;
+  804e40:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804e47:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  804e4e:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804e50:	85 c0                	test   %eax,%eax
+  804e52:	74 03                	je     804e57 <free+0x163>
+		slabs[c]->prev = s;
+  804e54:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804e57:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  804e5e:	e9 d5 fe ff ff       	jmp    804d38 <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804e63:	8b 06                	mov    (%esi),%eax
+  804e65:	85 c0                	test   %eax,%eax
+  804e67:	0f 84 cb fe ff ff    	je     804d38 <free+0x44>
+		slabs[c] = s->next;
+  804e6d:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  804e74:	8b 06                	mov    (%esi),%eax
+  804e76:	eb a2                	jmp    804e1a <free+0x126>
+
+00804e78 <heap_alloc_pages>:
+{
+  804e78:	55                   	push   %ebp
+  804e79:	89 e5                	mov    %esp,%ebp
+  804e7b:	57                   	push   %edi
+  804e7c:	56                   	push   %esi
+  804e7d:	53                   	push   %ebx
+  804e7e:	83 ec 18             	sub    $0x18,%esp
+  804e81:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804e83:	50                   	push   %eax
+  804e84:	e8 15 03 00 00       	call   80519e <va_alloc>
+  804e89:	89 c3                	mov    %eax,%ebx
+  804e8b:	83 c4 10             	add    $0x10,%esp
+  804e8e:	85 c0                	test   %eax,%eax
+  804e90:	74 47                	je     804ed9 <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804e92:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  804e98:	89 c1                	mov    %eax,%ecx
+  804e9a:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  804e9d:	c1 e8 11             	shr    $0x11,%eax
+  804ea0:	ba 01 00 00 00       	mov    $0x1,%edx
+  804ea5:	89 d7                	mov    %edx,%edi
+  804ea7:	d3 e7                	shl    %cl,%edi
+  804ea9:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  804eb0:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  804eb4:	89 c8                	mov    %ecx,%eax
+  804eb6:	c1 e8 05             	shr    $0x5,%eax
+  804eb9:	d3 e2                	shl    %cl,%edx
+  804ebb:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  804ec2:	83 ec 0c             	sub    $0xc,%esp
+  804ec5:	6a 00                	push   $0x0
+  804ec7:	6a 07                	push   $0x7
+  804ec9:	56                   	push   %esi
+  804eca:	53                   	push   %ebx
+  804ecb:	6a 00                	push   $0x0
+  804ecd:	e8 3a f7 ff ff       	call   80460c <page_alloc_range>
+  804ed2:	83 c4 20             	add    $0x20,%esp
+  804ed5:	85 c0                	test   %eax,%eax
+  804ed7:	78 0a                	js     804ee3 <heap_alloc_pages+0x6b>
+}
+  804ed9:	89 d8                	mov    %ebx,%eax
+  804edb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ede:	5b                   	pop    %ebx
+  804edf:	5e                   	pop    %esi
+  804ee0:	5f                   	pop    %edi
+  804ee1:	5d                   	pop    %ebp
+  804ee2:	c3                   	ret
+		free(va);
+  804ee3:	83 ec 0c             	sub    $0xc,%esp
+  804ee6:	53                   	push   %ebx
+  804ee7:	e8 08 fe ff ff       	call   804cf4 <free>
+		return NULL;
+  804eec:	83 c4 10             	add    $0x10,%esp
+  804eef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804ef4:	eb e3                	jmp    804ed9 <heap_alloc_pages+0x61>
+
+00804ef6 <malloc>:
+{
+  804ef6:	55                   	push   %ebp
+  804ef7:	89 e5                	mov    %esp,%ebp
+  804ef9:	57                   	push   %edi
+  804efa:	56                   	push   %esi
+  804efb:	53                   	push   %ebx
+  804efc:	83 ec 1c             	sub    $0x1c,%esp
+  804eff:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804f02:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804f05:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  804f0b:	0f 87 21 01 00 00    	ja     805032 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804f11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804f16:	ba 10 00 00 00       	mov    $0x10,%edx
+  804f1b:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  804f1d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804f22:	76 15                	jbe    804f39 <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804f24:	05 ff 0f 00 00       	add    $0xfff,%eax
+  804f29:	c1 e8 0c             	shr    $0xc,%eax
+  804f2c:	e8 47 ff ff ff       	call   804e78 <heap_alloc_pages>
+  804f31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804f34:	eb 37                	jmp    804f6d <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804f36:	83 c1 01             	add    $0x1,%ecx
+  804f39:	89 d6                	mov    %edx,%esi
+  804f3b:	d3 e6                	shl    %cl,%esi
+  804f3d:	39 c6                	cmp    %eax,%esi
+  804f3f:	72 f5                	jb     804f36 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804f41:	89 cb                	mov    %ecx,%ebx
+  804f43:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  804f4a:	85 ff                	test   %edi,%edi
+  804f4c:	74 2a                	je     804f78 <malloc+0x82>
+	v = s->free;
+  804f4e:	8b 47 08             	mov    0x8(%edi),%eax
+  804f51:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804f54:	8b 00                	mov    (%eax),%eax
+  804f56:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  804f59:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  804f5d:	83 e8 01             	sub    $0x1,%eax
+  804f60:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804f64:	66 85 c0             	test   %ax,%ax
+  804f67:	0f 84 9a 00 00 00    	je     805007 <malloc+0x111>
+}
+  804f6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804f70:	83 c4 1c             	add    $0x1c,%esp
+  804f73:	5b                   	pop    %ebx
+  804f74:	5e                   	pop    %esi
+  804f75:	5f                   	pop    %edi
+  804f76:	5d                   	pop    %ebp
+  804f77:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  804f78:	b8 01 00 00 00       	mov    $0x1,%eax
+  804f7d:	e8 f6 fe ff ff       	call   804e78 <heap_alloc_pages>
+  804f82:	89 c1                	mov    %eax,%ecx
+  804f84:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804f87:	85 c0                	test   %eax,%eax
+  804f89:	74 e2                	je     804f6d <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804f8b:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  804f91:	89 c8                	mov    %ecx,%eax
+  804f93:	c1 e8 11             	shr    $0x11,%eax
+  804f96:	c1 e9 0c             	shr    $0xc,%ecx
+  804f99:	ba 01 00 00 00       	mov    $0x1,%edx
+  804f9e:	d3 e2                	shl    %cl,%edx
+  804fa0:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  804fa7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804faa:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  804fae:	0f b7 f6             	movzwl %si,%esi
+  804fb1:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  804fb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fbb:	f7 fe                	idiv   %esi
+  804fbd:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  804fc1:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  804fc4:	85 c0                	test   %eax,%eax
+  804fc6:	74 14                	je     804fdc <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  804fc8:	83 e8 01             	sub    $0x1,%eax
+  804fcb:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  804fcf:	0f af d0             	imul   %eax,%edx
+  804fd2:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  804fd6:	89 3a                	mov    %edi,(%edx)
+  804fd8:	89 d7                	mov    %edx,%edi
+  804fda:	eb e5                	jmp    804fc1 <malloc+0xcb>
+	s->prev = NULL;
+  804fdc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  804fdf:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  804fe6:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  804fed:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804fef:	85 c0                	test   %eax,%eax
+  804ff1:	74 03                	je     804ff6 <malloc+0x100>
+		slabs[c]->prev = s;
+  804ff3:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804ff6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804ff9:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  805000:	89 c7                	mov    %eax,%edi
+  805002:	e9 47 ff ff ff       	jmp    804f4e <malloc+0x58>
+	if (s->prev)
+  805007:	8b 47 04             	mov    0x4(%edi),%eax
+  80500a:	85 c0                	test   %eax,%eax
+  80500c:	74 19                	je     805027 <malloc+0x131>
+		s->prev->next = s->next;
+  80500e:	8b 17                	mov    (%edi),%edx
+  805010:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  805012:	8b 07                	mov    (%edi),%eax
+  805014:	85 c0                	test   %eax,%eax
+  805016:	0f 84 51 ff ff ff    	je     804f6d <malloc+0x77>
+		s->next->prev = s->prev;
+  80501c:	8b 57 04             	mov    0x4(%edi),%edx
+  80501f:	89 50 04             	mov    %edx,0x4(%eax)
+  805022:	e9 46 ff ff ff       	jmp    804f6d <malloc+0x77>
+		slabs[c] = s->next;
+  805027:	8b 07                	mov    (%edi),%eax
+  805029:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  805030:	eb e0                	jmp    805012 <malloc+0x11c>
+		return NULL;
+  805032:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  805039:	e9 2f ff ff ff       	jmp    804f6d <malloc+0x77>
+
+0080503e <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  80503e:	55                   	push   %ebp
+  80503f:	89 e5                	mov    %esp,%ebp
+  805041:	57                   	push   %edi
+  805042:	56                   	push   %esi
+  805043:	53                   	push   %ebx
+  805044:	83 ec 0c             	sub    $0xc,%esp
+  805047:	89 c6                	mov    %eax,%esi
+  805049:	89 d7                	mov    %edx,%edi
+  80504b:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  80504e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805053:	ba 00 00 00 00       	mov    $0x0,%edx
+  805058:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80505d:	83 ef 01             	sub    $0x1,%edi
+  805060:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  805063:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  805066:	eb 34                	jmp    80509c <va_chunk_scan+0x5e>
+			i += 31;
+  805068:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  80506b:	89 ca                	mov    %ecx,%edx
+			continue;
+  80506d:	eb 23                	jmp    805092 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  80506f:	89 c7                	mov    %eax,%edi
+  805071:	c1 ef 05             	shr    $0x5,%edi
+  805074:	be 01 00 00 00       	mov    $0x1,%esi
+  805079:	d3 e6                	shl    %cl,%esi
+  80507b:	89 f1                	mov    %esi,%ecx
+  80507d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  805080:	23 0c be             	and    (%esi,%edi,4),%ecx
+  805083:	75 41                	jne    8050c6 <va_chunk_scan+0x88>
+			len++;
+  805085:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  805088:	39 d3                	cmp    %edx,%ebx
+  80508a:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  80508d:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  805090:	72 2d                	jb     8050bf <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  805092:	83 c0 01             	add    $0x1,%eax
+  805095:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80509a:	77 31                	ja     8050cd <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  80509c:	89 c1                	mov    %eax,%ecx
+  80509e:	83 e1 1f             	and    $0x1f,%ecx
+  8050a1:	75 cc                	jne    80506f <va_chunk_scan+0x31>
+  8050a3:	89 c7                	mov    %eax,%edi
+  8050a5:	c1 ef 05             	shr    $0x5,%edi
+  8050a8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8050ab:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8050ae:	83 ff ff             	cmp    $0xffffffff,%edi
+  8050b1:	74 b5                	je     805068 <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8050b3:	85 ff                	test   %edi,%edi
+  8050b5:	75 b8                	jne    80506f <va_chunk_scan+0x31>
+			i += 31;
+  8050b7:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8050ba:	83 c2 20             	add    $0x20,%edx
+  8050bd:	eb c9                	jmp    805088 <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8050bf:	83 c0 01             	add    $0x1,%eax
+  8050c2:	29 d0                	sub    %edx,%eax
+  8050c4:	eb 15                	jmp    8050db <va_chunk_scan+0x9d>
+			len = 0;
+  8050c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050cb:	eb c5                	jmp    805092 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8050cd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8050d2:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8050d5:	85 d2                	test   %edx,%edx
+  8050d7:	74 02                	je     8050db <va_chunk_scan+0x9d>
+		*run_store = best;
+  8050d9:	89 1a                	mov    %ebx,(%edx)
+}
+  8050db:	83 c4 0c             	add    $0xc,%esp
+  8050de:	5b                   	pop    %ebx
+  8050df:	5e                   	pop    %esi
+  8050e0:	5f                   	pop    %edi
+  8050e1:	5d                   	pop    %ebp
+  8050e2:	c3                   	ret
+
+008050e3 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8050e3:	55                   	push   %ebp
+  8050e4:	89 e5                	mov    %esp,%ebp
+  8050e6:	57                   	push   %edi
+  8050e7:	56                   	push   %esi
+  8050e8:	53                   	push   %ebx
+  8050e9:	83 ec 14             	sub    $0x14,%esp
+  8050ec:	89 c3                	mov    %eax,%ebx
+  8050ee:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  8050f0:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  8050f6:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  8050fc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  8050ff:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  805102:	89 d6                	mov    %edx,%esi
+  805104:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  80510a:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  80510c:	eb 34                	jmp    805142 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  80510e:	89 c8                	mov    %ecx,%eax
+  805110:	c1 e8 05             	shr    $0x5,%eax
+  805113:	89 da                	mov    %ebx,%edx
+  805115:	c1 e2 05             	shl    $0x5,%edx
+  805118:	01 da                	add    %ebx,%edx
+  80511a:	01 c2                	add    %eax,%edx
+  80511c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  805121:	d3 c0                	rol    %cl,%eax
+  805123:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80512a:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  805131:	b8 01 00 00 00       	mov    $0x1,%eax
+  805136:	01 d0                	add    %edx,%eax
+  805138:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  80513f:	83 c1 01             	add    $0x1,%ecx
+  805142:	39 f9                	cmp    %edi,%ecx
+  805144:	74 30                	je     805176 <va_chunk_mark+0x93>
+		if (alloc)
+  805146:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80514a:	74 c2                	je     80510e <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  80514c:	89 c8                	mov    %ecx,%eax
+  80514e:	c1 e8 05             	shr    $0x5,%eax
+  805151:	89 da                	mov    %ebx,%edx
+  805153:	c1 e2 05             	shl    $0x5,%edx
+  805156:	01 da                	add    %ebx,%edx
+  805158:	01 c2                	add    %eax,%edx
+  80515a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80515f:	d3 e0                	shl    %cl,%eax
+  805161:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  805168:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  80516f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  805174:	eb c0                	jmp    805136 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  805176:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  805179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80517e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805181:	e8 b8 fe ff ff       	call   80503e <va_chunk_scan>
+	ch->run = run;
+  805186:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  80518c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80518f:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  805196:	83 c4 14             	add    $0x14,%esp
+  805199:	5b                   	pop    %ebx
+  80519a:	5e                   	pop    %esi
+  80519b:	5f                   	pop    %edi
+  80519c:	5d                   	pop    %ebp
+  80519d:	c3                   	ret
+
+0080519e <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  80519e:	55                   	push   %ebp
+  80519f:	89 e5                	mov    %esp,%ebp
+  8051a1:	57                   	push   %edi
+  8051a2:	56                   	push   %esi
+  8051a3:	53                   	push   %ebx
+  8051a4:	83 ec 04             	sub    $0x4,%esp
+  8051a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8051aa:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  8051af:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  8051b4:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  8051bb:	74 4f                	je     80520c <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  8051bd:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8051c0:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  8051c5:	0f 87 01 01 00 00    	ja     8052cc <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  8051cb:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  8051d1:	0f 87 80 00 00 00    	ja     805257 <va_alloc+0xb9>
+  8051d7:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8051dc:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  8051e1:	0f b7 10             	movzwl (%eax),%edx
+  8051e4:	05 84 00 00 00       	add    $0x84,%eax
+  8051e9:	39 da                	cmp    %ebx,%edx
+  8051eb:	73 2c                	jae    805219 <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8051ed:	83 c6 01             	add    $0x1,%esi
+  8051f0:	83 fe 1c             	cmp    $0x1c,%esi
+  8051f3:	75 ec                	jne    8051e1 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  8051f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051fa:	eb 53                	jmp    80524f <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  8051fc:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  805202:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  805207:	05 84 00 00 00       	add    $0x84,%eax
+  80520c:	39 d0                	cmp    %edx,%eax
+  80520e:	75 ec                	jne    8051fc <va_alloc+0x5e>
+	va_inited = 1;
+  805210:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  805217:	eb a4                	jmp    8051bd <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  805219:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  80521f:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  805224:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805229:	89 da                	mov    %ebx,%edx
+  80522b:	e8 0e fe ff ff       	call   80503e <va_chunk_scan>
+  805230:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  805232:	6a 01                	push   $0x1
+  805234:	89 d9                	mov    %ebx,%ecx
+  805236:	89 c2                	mov    %eax,%edx
+  805238:	89 f0                	mov    %esi,%eax
+  80523a:	e8 a4 fe ff ff       	call   8050e3 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  80523f:	c1 e6 16             	shl    $0x16,%esi
+  805242:	c1 e7 0c             	shl    $0xc,%edi
+  805245:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  80524c:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  80524f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805252:	5b                   	pop    %ebx
+  805253:	5e                   	pop    %esi
+  805254:	5f                   	pop    %edi
+  805255:	5d                   	pop    %ebp
+  805256:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  805257:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  80525d:	c1 ee 0a             	shr    $0xa,%esi
+  805260:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  805265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80526a:	eb 0a                	jmp    805276 <va_alloc+0xd8>
+			first = c + 1;
+  80526c:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  80526e:	83 c2 01             	add    $0x1,%edx
+  805271:	83 fa 1d             	cmp    $0x1d,%edx
+  805274:	74 4f                	je     8052c5 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  805276:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  80527c:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  805283:	00 04 
+  805285:	75 e5                	jne    80526c <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  805287:	89 d1                	mov    %edx,%ecx
+  805289:	29 c1                	sub    %eax,%ecx
+  80528b:	39 f1                	cmp    %esi,%ecx
+  80528d:	75 df                	jne    80526e <va_alloc+0xd0>
+  80528f:	89 c7                	mov    %eax,%edi
+  805291:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  805294:	be 00 04 00 00       	mov    $0x400,%esi
+  805299:	39 f3                	cmp    %esi,%ebx
+  80529b:	0f 46 f3             	cmovbe %ebx,%esi
+  80529e:	6a 01                	push   $0x1
+  8052a0:	89 f1                	mov    %esi,%ecx
+  8052a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052a7:	89 f8                	mov    %edi,%eax
+  8052a9:	e8 35 fe ff ff       	call   8050e3 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8052ae:	83 c7 01             	add    $0x1,%edi
+  8052b1:	83 c4 04             	add    $0x4,%esp
+  8052b4:	29 f3                	sub    %esi,%ebx
+  8052b6:	75 dc                	jne    805294 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8052b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8052bb:	c1 e0 16             	shl    $0x16,%eax
+  8052be:	05 00 00 00 08       	add    $0x8000000,%eax
+  8052c3:	eb 8a                	jmp    80524f <va_alloc+0xb1>
+	return NULL;
+  8052c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052ca:	eb 83                	jmp    80524f <va_alloc+0xb1>
+		return NULL;
+  8052cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052d1:	e9 79 ff ff ff       	jmp    80524f <va_alloc+0xb1>
+
+008052d6 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  8052d6:	55                   	push   %ebp
+  8052d7:	89 e5                	mov    %esp,%ebp
+  8052d9:	57                   	push   %edi
+  8052da:	56                   	push   %esi
+  8052db:	53                   	push   %ebx
+  8052dc:	83 ec 0c             	sub    $0xc,%esp
+  8052df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8052e2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  8052e5:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  8052eb:	76 21                	jbe    80530e <va_free+0x38>
+  8052ed:	89 f0                	mov    %esi,%eax
+  8052ef:	c1 e0 0c             	shl    $0xc,%eax
+  8052f2:	01 f8                	add    %edi,%eax
+  8052f4:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  8052f9:	77 13                	ja     80530e <va_free+0x38>
+	    || PGOFF(va))
+  8052fb:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  805301:	75 0b                	jne    80530e <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  805303:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  805309:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  80530c:	eb 45                	jmp    805353 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  80530e:	83 ec 0c             	sub    $0xc,%esp
+  805311:	56                   	push   %esi
+  805312:	57                   	push   %edi
+  805313:	68 dc 66 80 00       	push   $0x8066dc
+  805318:	68 8e 00 00 00       	push   $0x8e
+  80531d:	68 fc 66 80 00       	push   $0x8066fc
+  805322:	e8 cf ae ff ff       	call   8001f6 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  805327:	89 fa                	mov    %edi,%edx
+  805329:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80532f:	bb 00 04 00 00       	mov    $0x400,%ebx
+  805334:	29 d3                	sub    %edx,%ebx
+  805336:	39 f3                	cmp    %esi,%ebx
+  805338:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80533b:	89 f8                	mov    %edi,%eax
+  80533d:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  805340:	83 ec 0c             	sub    $0xc,%esp
+  805343:	6a 00                	push   $0x0
+  805345:	89 d9                	mov    %ebx,%ecx
+  805347:	e8 97 fd ff ff       	call   8050e3 <va_chunk_mark>
+		i += n;
+  80534c:	01 df                	add    %ebx,%edi
+		npages -= n;
+  80534e:	29 de                	sub    %ebx,%esi
+  805350:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  805353:	85 f6                	test   %esi,%esi
+  805355:	75 d0                	jne    805327 <va_free+0x51>
+	}
+}
+  805357:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80535a:	5b                   	pop    %ebx
+  80535b:	5e                   	pop    %esi
+  80535c:	5f                   	pop    %edi
+  80535d:	5d                   	pop    %ebp
+  80535e:	c3                   	ret
+
+0080535f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  80535f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805364:	c3                   	ret
+
+00805365 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  805365:	55                   	push   %ebp
+  805366:	89 e5                	mov    %esp,%ebp
+  805368:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80536b:	68 09 67 80 00       	push   $0x806709
+  805370:	ff 75 0c             	push   0xc(%ebp)
+  805373:	e8 40 b5 ff ff       	call   8008b8 <strcpy>
+	return 0;
+}
+  805378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80537d:	c9                   	leave
+  80537e:	c3                   	ret
+
+0080537f <devcons_write>:
+{
+  80537f:	55                   	push   %ebp
+  805380:	89 e5                	mov    %esp,%ebp
+  805382:	57                   	push   %edi
+  805383:	56                   	push   %esi
+  805384:	53                   	push   %ebx
+  805385:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80538b:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  805390:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  805396:	eb 2e                	jmp    8053c6 <devcons_write+0x47>
+		m = n - tot;
+  805398:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80539b:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80539d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8053a2:	39 c3                	cmp    %eax,%ebx
+  8053a4:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8053a7:	83 ec 04             	sub    $0x4,%esp
+  8053aa:	53                   	push   %ebx
+  8053ab:	89 f0                	mov    %esi,%eax
+  8053ad:	03 45 0c             	add    0xc(%ebp),%eax
+  8053b0:	50                   	push   %eax
+  8053b1:	57                   	push   %edi
+  8053b2:	e8 87 b6 ff ff       	call   800a3e <memmove>
+		sys_cputs(buf, m);
+  8053b7:	83 c4 08             	add    $0x8,%esp
+  8053ba:	53                   	push   %ebx
+  8053bb:	57                   	push   %edi
+  8053bc:	e8 1d b9 ff ff       	call   800cde <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8053c1:	01 de                	add    %ebx,%esi
+  8053c3:	83 c4 10             	add    $0x10,%esp
+  8053c6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8053c9:	72 cd                	jb     805398 <devcons_write+0x19>
+}
+  8053cb:	89 f0                	mov    %esi,%eax
+  8053cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8053d0:	5b                   	pop    %ebx
+  8053d1:	5e                   	pop    %esi
+  8053d2:	5f                   	pop    %edi
+  8053d3:	5d                   	pop    %ebp
+  8053d4:	c3                   	ret
+
+008053d5 <devcons_read>:
+{
+  8053d5:	55                   	push   %ebp
+  8053d6:	89 e5                	mov    %esp,%ebp
+  8053d8:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8053db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053e0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8053e4:	75 07                	jne    8053ed <devcons_read+0x18>
+  8053e6:	eb 1f                	jmp    805407 <devcons_read+0x32>
+		sys_yield();
+  8053e8:	e8 9f b9 ff ff       	call   800d8c <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8053ed:	e8 1b b9 ff ff       	call   800d0d <sys_cgetc>
+  8053f2:	85 c0                	test   %eax,%eax
+  8053f4:	74 f2                	je     8053e8 <devcons_read+0x13>
+	if (c < 0)
+  8053f6:	78 0f                	js     805407 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8053f8:	83 f8 04             	cmp    $0x4,%eax
+  8053fb:	74 0c                	je     805409 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8053fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  805400:	88 02                	mov    %al,(%edx)
+	return 1;
+  805402:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  805407:	c9                   	leave
+  805408:	c3                   	ret
+		return 0;
+  805409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80540e:	eb f7                	jmp    805407 <devcons_read+0x32>
+
+00805410 <cputchar>:
+{
+  805410:	55                   	push   %ebp
+  805411:	89 e5                	mov    %esp,%ebp
+  805413:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  805416:	8b 45 08             	mov    0x8(%ebp),%eax
+  805419:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80541c:	6a 01                	push   $0x1
+  80541e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  805421:	50                   	push   %eax
+  805422:	e8 b7 b8 ff ff       	call   800cde <sys_cputs>
+}
+  805427:	83 c4 10             	add    $0x10,%esp
+  80542a:	c9                   	leave
+  80542b:	c3                   	ret
+
+0080542c <getchar>:
+{
+  80542c:	55                   	push   %ebp
+  80542d:	89 e5                	mov    %esp,%ebp
+  80542f:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  805432:	6a 01                	push   $0x1
+  805434:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  805437:	50                   	push   %eax
+  805438:	6a 00                	push   $0x0
+  80543a:	e8 95 c7 ff ff       	call   801bd4 <read>
+	if (r < 0)
+  80543f:	83 c4 10             	add    $0x10,%esp
+  805442:	85 c0                	test   %eax,%eax
+  805444:	78 06                	js     80544c <getchar+0x20>
+	if (r < 1)
+  805446:	74 06                	je     80544e <getchar+0x22>
+	return c;
+  805448:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80544c:	c9                   	leave
+  80544d:	c3                   	ret
+		return -E_EOF;
+  80544e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  805453:	eb f7                	jmp    80544c <getchar+0x20>
+
+00805455 <iscons>:
+{
+  805455:	55                   	push   %ebp
+  805456:	89 e5                	mov    %esp,%ebp
+  805458:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80545b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80545e:	50                   	push   %eax
+  80545f:	ff 75 08             	push   0x8(%ebp)
+  805462:	e8 0e c5 ff ff       	call   801975 <fd_lookup>
+  805467:	83 c4 10             	add    $0x10,%esp
+  80546a:	85 c0                	test   %eax,%eax
+  80546c:	78 11                	js     80547f <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  80546e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805471:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  805477:	39 10                	cmp    %edx,(%eax)
+  805479:	0f 94 c0             	sete   %al
+  80547c:	0f b6 c0             	movzbl %al,%eax
+}
+  80547f:	c9                   	leave
+  805480:	c3                   	ret
+
+00805481 <opencons>:
+{
+  805481:	55                   	push   %ebp
+  805482:	89 e5                	mov    %esp,%ebp
+  805484:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  805487:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80548a:	50                   	push   %eax
+  80548b:	e8 91 c4 ff ff       	call   801921 <fd_alloc>
+  805490:	83 c4 10             	add    $0x10,%esp
+  805493:	85 c0                	test   %eax,%eax
+  805495:	78 3a                	js     8054d1 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  805497:	83 ec 04             	sub    $0x4,%esp
+  80549a:	68 07 04 00 00       	push   $0x407
+  80549f:	ff 75 f4             	push   -0xc(%ebp)
+  8054a2:	6a 00                	push   $0x0
+  8054a4:	e8 02 b9 ff ff       	call   800dab <sys_page_alloc>
+  8054a9:	83 c4 10             	add    $0x10,%esp
+  8054ac:	85 c0                	test   %eax,%eax
+  8054ae:	78 21                	js     8054d1 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8054b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8054b3:	8b 15 4c 70 80 00    	mov    0x80704c,%edx
+  8054b9:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8054bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8054be:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8054c5:	83 ec 0c             	sub    $0xc,%esp
+  8054c8:	50                   	push   %eax
+  8054c9:	e8 2c c4 ff ff       	call   8018fa <fd2num>
+  8054ce:	83 c4 10             	add    $0x10,%esp
+}
+  8054d1:	c9                   	leave
+  8054d2:	c3                   	ret
+
+008054d3 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  8054d3:	55                   	push   %ebp
+  8054d4:	89 e5                	mov    %esp,%ebp
+  8054d6:	56                   	push   %esi
+  8054d7:	53                   	push   %ebx
+  8054d8:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8054db:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  8054e0:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8054e3:	85 db                	test   %ebx,%ebx
+  8054e5:	78 17                	js     8054fe <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  8054e7:	83 ec 0c             	sub    $0xc,%esp
+  8054ea:	56                   	push   %esi
+  8054eb:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  8054f2:	83 c4 10             	add    $0x10,%esp
+  8054f5:	85 c0                	test   %eax,%eax
+  8054f7:	75 27                	jne    805520 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8054f9:	83 eb 01             	sub    $0x1,%ebx
+  8054fc:	eb e5                	jmp    8054e3 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  8054fe:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805503:	8b 40 48             	mov    0x48(%eax),%eax
+  805506:	83 ec 08             	sub    $0x8,%esp
+  805509:	ff 76 28             	push   0x28(%esi)
+  80550c:	ff 36                	push   (%esi)
+  80550e:	50                   	push   %eax
+  80550f:	68 18 67 80 00       	push   $0x806718
+  805514:	6a 1d                	push   $0x1d
+  805516:	68 3b 67 80 00       	push   $0x80673b
+  80551b:	e8 d6 ac ff ff       	call   8001f6 <_panic>
+}
+  805520:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805523:	5b                   	pop    %ebx
+  805524:	5e                   	pop    %esi
+  805525:	5d                   	pop    %ebp
+  805526:	c3                   	ret
+
+00805527 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  805527:	55                   	push   %ebp
+  805528:	89 e5                	mov    %esp,%ebp
+  80552a:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  80552d:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  805534:	74 0a                	je     805540 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  805536:	8b 45 08             	mov    0x8(%ebp),%eax
+  805539:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  80553e:	c9                   	leave
+  80553f:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  805540:	83 ec 04             	sub    $0x4,%esp
+  805543:	6a 07                	push   $0x7
+  805545:	68 00 f0 bf ee       	push   $0xeebff000
+  80554a:	6a 00                	push   $0x0
+  80554c:	e8 5a b8 ff ff       	call   800dab <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  805551:	83 c4 08             	add    $0x8,%esp
+  805554:	68 c7 55 80 00       	push   $0x8055c7
+  805559:	6a 00                	push   $0x0
+  80555b:	e8 b1 bb ff ff       	call   801111 <sys_env_set_pgfault_upcall>
+  805560:	83 c4 10             	add    $0x10,%esp
+  805563:	eb d1                	jmp    805536 <set_pgfault_handler+0xf>
+
+00805565 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  805565:	55                   	push   %ebp
+  805566:	89 e5                	mov    %esp,%ebp
+  805568:	83 ec 08             	sub    $0x8,%esp
+  80556b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  80556e:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  805574:	b8 00 00 00 00       	mov    $0x0,%eax
+  805579:	eb 03                	jmp    80557e <add_pgfault_handler+0x19>
+  80557b:	83 c0 01             	add    $0x1,%eax
+  80557e:	39 d0                	cmp    %edx,%eax
+  805580:	74 0b                	je     80558d <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  805582:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  805589:	75 f0                	jne    80557b <add_pgfault_handler+0x16>
+  80558b:	eb 24                	jmp    8055b1 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80558d:	83 fa 0a             	cmp    $0xa,%edx
+  805590:	74 21                	je     8055b3 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  805592:	8d 42 01             	lea    0x1(%edx),%eax
+  805595:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  80559a:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  8055a1:	83 ec 0c             	sub    $0xc,%esp
+  8055a4:	68 d3 54 80 00       	push   $0x8054d3
+  8055a9:	e8 79 ff ff ff       	call   805527 <set_pgfault_handler>
+  8055ae:	83 c4 10             	add    $0x10,%esp
+}
+  8055b1:	c9                   	leave
+  8055b2:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8055b3:	83 ec 04             	sub    $0x4,%esp
+  8055b6:	68 49 67 80 00       	push   $0x806749
+  8055bb:	6a 44                	push   $0x44
+  8055bd:	68 3b 67 80 00       	push   $0x80673b
+  8055c2:	e8 2f ac ff ff       	call   8001f6 <_panic>
+
+008055c7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8055c7:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8055c8:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  8055cd:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8055cf:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  8055d2:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  8055d6:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  8055da:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  8055dd:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  8055df:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  8055e3:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  8055e6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  8055e7:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  8055ea:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  8055eb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8055ec:	c3                   	ret
+
+008055ed <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8055ed:	55                   	push   %ebp
+  8055ee:	89 e5                	mov    %esp,%ebp
+  8055f0:	57                   	push   %edi
+  8055f1:	56                   	push   %esi
+  8055f2:	53                   	push   %ebx
+  8055f3:	83 ec 14             	sub    $0x14,%esp
+  8055f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8055f9:	8b 75 14             	mov    0x14(%ebp),%esi
+  8055fc:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  8055ff:	ff 75 10             	push   0x10(%ebp)
+  805602:	ff 75 0c             	push   0xc(%ebp)
+  805605:	e8 c4 bb ff ff       	call   8011ce <sys_ipc_recv_pages>
+  80560a:	83 c4 10             	add    $0x10,%esp
+  80560d:	85 c0                	test   %eax,%eax
+  80560f:	78 46                	js     805657 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805611:	85 ff                	test   %edi,%edi
+  805613:	74 0d                	je     805622 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  805615:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80561a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  805620:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  805622:	85 f6                	test   %esi,%esi
+  805624:	74 0d                	je     805633 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  805626:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80562b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805631:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  805633:	85 db                	test   %ebx,%ebx
+  805635:	74 0d                	je     805644 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  805637:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80563c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  805642:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  805644:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805649:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80564f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805652:	5b                   	pop    %ebx
+  805653:	5e                   	pop    %esi
+  805654:	5f                   	pop    %edi
+  805655:	5d                   	pop    %ebp
+  805656:	c3                   	ret
+		if (from_env_store) {
+  805657:	85 ff                	test   %edi,%edi
+  805659:	74 06                	je     805661 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80565b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  805661:	85 f6                	test   %esi,%esi
+  805663:	74 06                	je     80566b <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  805665:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80566b:	85 db                	test   %ebx,%ebx
+  80566d:	74 e0                	je     80564f <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  80566f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805675:	eb d8                	jmp    80564f <ipc_recv_pages+0x62>
+
+00805677 <ipc_recv>:
+{
+  805677:	55                   	push   %ebp
+  805678:	89 e5                	mov    %esp,%ebp
+  80567a:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80567d:	6a 00                	push   $0x0
+  80567f:	ff 75 10             	push   0x10(%ebp)
+  805682:	6a 01                	push   $0x1
+  805684:	ff 75 0c             	push   0xc(%ebp)
+  805687:	ff 75 08             	push   0x8(%ebp)
+  80568a:	e8 5e ff ff ff       	call   8055ed <ipc_recv_pages>
+}
+  80568f:	c9                   	leave
+  805690:	c3                   	ret
+
+00805691 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  805691:	55                   	push   %ebp
+  805692:	89 e5                	mov    %esp,%ebp
+  805694:	56                   	push   %esi
+  805695:	53                   	push   %ebx
+  805696:	8b 75 08             	mov    0x8(%ebp),%esi
+  805699:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80569c:	83 ec 0c             	sub    $0xc,%esp
+  80569f:	ff 75 0c             	push   0xc(%ebp)
+  8056a2:	e8 5b bc ff ff       	call   801302 <sys_ipc_try_recv>
+  8056a7:	83 c4 10             	add    $0x10,%esp
+  8056aa:	85 c0                	test   %eax,%eax
+  8056ac:	78 34                	js     8056e2 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8056ae:	85 f6                	test   %esi,%esi
+  8056b0:	74 0d                	je     8056bf <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8056b2:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8056b7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8056bd:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8056bf:	85 db                	test   %ebx,%ebx
+  8056c1:	74 0d                	je     8056d0 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8056c3:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8056c8:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8056ce:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8056d0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8056d5:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8056db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8056de:	5b                   	pop    %ebx
+  8056df:	5e                   	pop    %esi
+  8056e0:	5d                   	pop    %ebp
+  8056e1:	c3                   	ret
+		if (from_env_store) {
+  8056e2:	85 f6                	test   %esi,%esi
+  8056e4:	74 06                	je     8056ec <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8056e6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8056ec:	85 db                	test   %ebx,%ebx
+  8056ee:	74 eb                	je     8056db <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  8056f0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8056f6:	eb e3                	jmp    8056db <ipc_try_recv+0x4a>
+
+008056f8 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8056f8:	55                   	push   %ebp
+  8056f9:	89 e5                	mov    %esp,%ebp
+  8056fb:	83 ec 14             	sub    $0x14,%esp
+  8056fe:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805701:	85 c0                	test   %eax,%eax
+  805703:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805708:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80570b:	ff 75 18             	push   0x18(%ebp)
+  80570e:	ff 75 14             	push   0x14(%ebp)
+  805711:	50                   	push   %eax
+  805712:	ff 75 0c             	push   0xc(%ebp)
+  805715:	ff 75 08             	push   0x8(%ebp)
+  805718:	e8 74 ba ff ff       	call   801191 <sys_ipc_send_pages>
+  80571d:	83 c4 20             	add    $0x20,%esp
+  805720:	85 c0                	test   %eax,%eax
+  805722:	78 02                	js     805726 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  805724:	c9                   	leave
+  805725:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  805726:	50                   	push   %eax
+  805727:	68 64 67 80 00       	push   $0x806764
+  80572c:	68 80 00 00 00       	push   $0x80
+  805731:	68 90 67 80 00       	push   $0x806790
+  805736:	e8 bb aa ff ff       	call   8001f6 <_panic>
+
+0080573b <ipc_send>:
+{
+  80573b:	55                   	push   %ebp
+  80573c:	89 e5                	mov    %esp,%ebp
+  80573e:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  805741:	ff 75 14             	push   0x14(%ebp)
+  805744:	6a 01                	push   $0x1
+  805746:	ff 75 10             	push   0x10(%ebp)
+  805749:	ff 75 0c             	push   0xc(%ebp)
+  80574c:	ff 75 08             	push   0x8(%ebp)
+  80574f:	e8 a4 ff ff ff       	call   8056f8 <ipc_send_pages>
+}
+  805754:	83 c4 20             	add    $0x20,%esp
+  805757:	c9                   	leave
+  805758:	c3                   	ret
+
+00805759 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805759:	55                   	push   %ebp
+  80575a:	89 e5                	mov    %esp,%ebp
+  80575c:	83 ec 14             	sub    $0x14,%esp
+  80575f:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805762:	85 c0                	test   %eax,%eax
+  805764:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805769:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80576c:	ff 75 18             	push   0x18(%ebp)
+  80576f:	ff 75 14             	push   0x14(%ebp)
+  805772:	50                   	push   %eax
+  805773:	ff 75 0c             	push   0xc(%ebp)
+  805776:	ff 75 08             	push   0x8(%ebp)
+  805779:	e8 a4 ba ff ff       	call   801222 <sys_ipc_call>
+  80577e:	83 c4 20             	add    $0x20,%esp
+  805781:	85 c0                	test   %eax,%eax
+  805783:	78 0b                	js     805790 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  805785:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80578a:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805790:	c9                   	leave
+  805791:	c3                   	ret
+
+00805792 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  805792:	55                   	push   %ebp
+  805793:	89 e5                	mov    %esp,%ebp
+  805795:	57                   	push   %edi
+  805796:	56                   	push   %esi
+  805797:	53                   	push   %ebx
+  805798:	83 ec 18             	sub    $0x18,%esp
+  80579b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80579e:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8057a1:	8b 75 20             	mov    0x20(%ebp),%esi
+  8057a4:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8057a7:	85 c0                	test   %eax,%eax
+  8057a9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8057ae:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8057b1:	ff 75 18             	push   0x18(%ebp)
+  8057b4:	ff 75 14             	push   0x14(%ebp)
+  8057b7:	50                   	push   %eax
+  8057b8:	ff 75 0c             	push   0xc(%ebp)
+  8057bb:	ff 75 08             	push   0x8(%ebp)
+  8057be:	e8 a0 ba ff ff       	call   801263 <sys_ipc_reply_recv>
+  8057c3:	83 c4 20             	add    $0x20,%esp
+  8057c6:	85 c0                	test   %eax,%eax
+  8057c8:	78 46                	js     805810 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8057ca:	85 ff                	test   %edi,%edi
+  8057cc:	74 0d                	je     8057db <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  8057ce:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8057d3:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8057d9:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8057db:	85 f6                	test   %esi,%esi
+  8057dd:	74 0d                	je     8057ec <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  8057df:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8057e4:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8057ea:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8057ec:	85 db                	test   %ebx,%ebx
+  8057ee:	74 0d                	je     8057fd <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  8057f0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8057f5:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8057fb:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8057fd:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805802:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805808:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80580b:	5b                   	pop    %ebx
+  80580c:	5e                   	pop    %esi
+  80580d:	5f                   	pop    %edi
+  80580e:	5d                   	pop    %ebp
+  80580f:	c3                   	ret
+		if (from_env_store) {
+  805810:	85 ff                	test   %edi,%edi
+  805812:	74 06                	je     80581a <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  805814:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80581a:	85 f6                	test   %esi,%esi
+  80581c:	74 06                	je     805824 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80581e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  805824:	85 db                	test   %ebx,%ebx
+  805826:	74 e0                	je     805808 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  805828:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80582e:	eb d8                	jmp    805808 <ipc_reply_recv+0x76>
+
+00805830 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  805830:	55                   	push   %ebp
+  805831:	89 e5                	mov    %esp,%ebp
+  805833:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  805836:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80583b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80583e:	c1 e0 06             	shl    $0x6,%eax
+  805841:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  805846:	8b 40 50             	mov    0x50(%eax),%eax
+  805849:	39 c8                	cmp    %ecx,%eax
+  80584b:	74 12                	je     80585f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80584d:	83 c2 01             	add    $0x1,%edx
+  805850:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  805856:	75 e3                	jne    80583b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  805858:	b8 00 00 00 00       	mov    $0x0,%eax
+  80585d:	eb 0e                	jmp    80586d <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80585f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  805862:	c1 e0 06             	shl    $0x6,%eax
+  805865:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80586a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80586d:	5d                   	pop    %ebp
+  80586e:	c3                   	ret
+
+0080586f <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80586f:	55                   	push   %ebp
+  805870:	89 e5                	mov    %esp,%ebp
+  805872:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805875:	89 c2                	mov    %eax,%edx
+  805877:	c1 ea 16             	shr    $0x16,%edx
+  80587a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  805881:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805886:	f6 c1 01             	test   $0x1,%cl
+  805889:	74 1e                	je     8058a9 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  80588b:	c1 e8 0c             	shr    $0xc,%eax
+  80588e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805895:	a8 01                	test   $0x1,%al
+  805897:	74 10                	je     8058a9 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805899:	c1 e8 0c             	shr    $0xc,%eax
+  80589c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80589f:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8058a6:	0f b7 d2             	movzwl %dx,%edx
+}
+  8058a9:	89 d0                	mov    %edx,%eax
+  8058ab:	5d                   	pop    %ebp
+  8058ac:	c3                   	ret
+
+008058ad <udivmod>:
+  8058ad:	55                   	push   %ebp
+  8058ae:	57                   	push   %edi
+  8058af:	56                   	push   %esi
+  8058b0:	53                   	push   %ebx
+  8058b1:	83 ec 24             	sub    $0x24,%esp
+  8058b4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8058b8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8058bc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8058c0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8058c4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8058c8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8058cc:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8058d0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8058d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058df:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8058e6:	00 
+  8058e7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8058ee:	00 
+  8058ef:	89 fb                	mov    %edi,%ebx
+  8058f1:	eb 08                	jmp    8058fb <udivmod+0x4e>
+  8058f3:	83 e9 01             	sub    $0x1,%ecx
+  8058f6:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8058f9:	74 68                	je     805963 <udivmod+0xb6>
+  8058fb:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8058ff:	01 c0                	add    %eax,%eax
+  805901:	89 c6                	mov    %eax,%esi
+  805903:	89 d7                	mov    %edx,%edi
+  805905:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805909:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80590d:	0f ad d0             	shrd   %cl,%edx,%eax
+  805910:	d3 ea                	shr    %cl,%edx
+  805912:	f6 c1 20             	test   $0x20,%cl
+  805915:	74 04                	je     80591b <udivmod+0x6e>
+  805917:	89 d0                	mov    %edx,%eax
+  805919:	31 d2                	xor    %edx,%edx
+  80591b:	83 e0 01             	and    $0x1,%eax
+  80591e:	89 04 24             	mov    %eax,(%esp)
+  805921:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805928:	00 
+  805929:	8b 04 24             	mov    (%esp),%eax
+  80592c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805930:	09 f0                	or     %esi,%eax
+  805932:	09 fa                	or     %edi,%edx
+  805934:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805938:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80593c:	39 f0                	cmp    %esi,%eax
+  80593e:	89 d5                	mov    %edx,%ebp
+  805940:	19 fd                	sbb    %edi,%ebp
+  805942:	72 af                	jb     8058f3 <udivmod+0x46>
+  805944:	29 f0                	sub    %esi,%eax
+  805946:	19 fa                	sbb    %edi,%edx
+  805948:	89 cf                	mov    %ecx,%edi
+  80594a:	c1 ef 05             	shr    $0x5,%edi
+  80594d:	83 e7 01             	and    $0x1,%edi
+  805950:	89 fe                	mov    %edi,%esi
+  805952:	83 f6 01             	xor    $0x1,%esi
+  805955:	d3 e6                	shl    %cl,%esi
+  805957:	d3 e7                	shl    %cl,%edi
+  805959:	09 74 24 18          	or     %esi,0x18(%esp)
+  80595d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805961:	eb 90                	jmp    8058f3 <udivmod+0x46>
+  805963:	85 db                	test   %ebx,%ebx
+  805965:	74 05                	je     80596c <udivmod+0xbf>
+  805967:	89 03                	mov    %eax,(%ebx)
+  805969:	89 53 04             	mov    %edx,0x4(%ebx)
+  80596c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805970:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805974:	83 c4 24             	add    $0x24,%esp
+  805977:	5b                   	pop    %ebx
+  805978:	5e                   	pop    %esi
+  805979:	5f                   	pop    %edi
+  80597a:	5d                   	pop    %ebp
+  80597b:	c3                   	ret
+
+0080597c <__udivdi3>:
+  80597c:	83 ec 08             	sub    $0x8,%esp
+  80597f:	6a 00                	push   $0x0
+  805981:	ff 74 24 1c          	push   0x1c(%esp)
+  805985:	ff 74 24 1c          	push   0x1c(%esp)
+  805989:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80598d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805991:	e8 17 ff ff ff       	call   8058ad <udivmod>
+  805996:	83 c4 14             	add    $0x14,%esp
+  805999:	c3                   	ret
+
+0080599a <__umoddi3>:
+  80599a:	83 ec 18             	sub    $0x18,%esp
+  80599d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8059a1:	50                   	push   %eax
+  8059a2:	ff 74 24 2c          	push   0x2c(%esp)
+  8059a6:	ff 74 24 2c          	push   0x2c(%esp)
+  8059aa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8059ae:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8059b2:	e8 f6 fe ff ff       	call   8058ad <udivmod>
+  8059b7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8059bb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8059bf:	83 c4 24             	add    $0x24,%esp
+  8059c2:	c3                   	ret
+
+008059c3 <__divdi3>:
+  8059c3:	55                   	push   %ebp
+  8059c4:	57                   	push   %edi
+  8059c5:	56                   	push   %esi
+  8059c6:	53                   	push   %ebx
+  8059c7:	83 ec 10             	sub    $0x10,%esp
+  8059ca:	8b 44 24 24          	mov    0x24(%esp),%eax
+  8059ce:	8b 54 24 28          	mov    0x28(%esp),%edx
+  8059d2:	89 c6                	mov    %eax,%esi
+  8059d4:	89 d7                	mov    %edx,%edi
+  8059d6:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  8059da:	33 7c 24 30          	xor    0x30(%esp),%edi
+  8059de:	89 74 24 04          	mov    %esi,0x4(%esp)
+  8059e2:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  8059e6:	89 c5                	mov    %eax,%ebp
+  8059e8:	f7 dd                	neg    %ebp
+  8059ea:	89 d6                	mov    %edx,%esi
+  8059ec:	83 d6 00             	adc    $0x0,%esi
+  8059ef:	f7 de                	neg    %esi
+  8059f1:	0f 48 e8             	cmovs  %eax,%ebp
+  8059f4:	0f 49 d6             	cmovns %esi,%edx
+  8059f7:	6a 00                	push   $0x0
+  8059f9:	8b 74 24 30          	mov    0x30(%esp),%esi
+  8059fd:	f7 de                	neg    %esi
+  8059ff:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805a03:	83 d0 00             	adc    $0x0,%eax
+  805a06:	f7 d8                	neg    %eax
+  805a08:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  805a0d:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805a12:	50                   	push   %eax
+  805a13:	56                   	push   %esi
+  805a14:	89 e8                	mov    %ebp,%eax
+  805a16:	e8 92 fe ff ff       	call   8058ad <udivmod>
+  805a1b:	83 c4 10             	add    $0x10,%esp
+  805a1e:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805a23:	78 08                	js     805a2d <__divdi3+0x6a>
+  805a25:	83 c4 0c             	add    $0xc,%esp
+  805a28:	5b                   	pop    %ebx
+  805a29:	5e                   	pop    %esi
+  805a2a:	5f                   	pop    %edi
+  805a2b:	5d                   	pop    %ebp
+  805a2c:	c3                   	ret
+  805a2d:	f7 d8                	neg    %eax
+  805a2f:	83 d2 00             	adc    $0x0,%edx
+  805a32:	f7 da                	neg    %edx
+  805a34:	eb ef                	jmp    805a25 <__divdi3+0x62>
+
+00805a36 <__moddi3>:
+  805a36:	55                   	push   %ebp
+  805a37:	57                   	push   %edi
+  805a38:	56                   	push   %esi
+  805a39:	53                   	push   %ebx
+  805a3a:	83 ec 18             	sub    $0x18,%esp
+  805a3d:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  805a41:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805a45:	89 f1                	mov    %esi,%ecx
+  805a47:	f7 d9                	neg    %ecx
+  805a49:	89 da                	mov    %ebx,%edx
+  805a4b:	83 d2 00             	adc    $0x0,%edx
+  805a4e:	f7 da                	neg    %edx
+  805a50:	0f 48 ce             	cmovs  %esi,%ecx
+  805a53:	0f 48 d3             	cmovs  %ebx,%edx
+  805a56:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805a5a:	50                   	push   %eax
+  805a5b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  805a5f:	f7 de                	neg    %esi
+  805a61:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805a65:	83 d0 00             	adc    $0x0,%eax
+  805a68:	f7 d8                	neg    %eax
+  805a6a:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  805a6f:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805a74:	50                   	push   %eax
+  805a75:	56                   	push   %esi
+  805a76:	89 c8                	mov    %ecx,%eax
+  805a78:	e8 30 fe ff ff       	call   8058ad <udivmod>
+  805a7d:	83 c4 10             	add    $0x10,%esp
+  805a80:	85 db                	test   %ebx,%ebx
+  805a82:	78 10                	js     805a94 <__moddi3+0x5e>
+  805a84:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805a88:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805a8c:	83 c4 14             	add    $0x14,%esp
+  805a8f:	5b                   	pop    %ebx
+  805a90:	5e                   	pop    %esi
+  805a91:	5f                   	pop    %edi
+  805a92:	5d                   	pop    %ebp
+  805a93:	c3                   	ret
+  805a94:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805a98:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805a9c:	f7 d8                	neg    %eax
+  805a9e:	83 d2 00             	adc    $0x0,%edx
+  805aa1:	f7 da                	neg    %edx
+  805aa3:	eb e7                	jmp    805a8c <__moddi3+0x56>
@@ -0,0 +1,11445 @@
+
+obj/user/testshell.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 54 04 00 00       	call   800485 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <wrong>:
+	breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  80003f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800042:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char buf[100];
+	int n;
+
+	seek(rfd, off);
+  800048:	53                   	push   %ebx
+  800049:	56                   	push   %esi
+  80004a:	e8 c7 1f 00 00       	call   802016 <seek>
+	seek(kfd, off);
+  80004f:	83 c4 08             	add    $0x8,%esp
+  800052:	53                   	push   %ebx
+  800053:	57                   	push   %edi
+  800054:	e8 bd 1f 00 00       	call   802016 <seek>
+
+	cprintf("shell produced incorrect output.\n");
+  800059:	c7 04 24 40 5c 80 00 	movl   $0x805c40,(%esp)
+  800060:	e8 5e 05 00 00       	call   8005c3 <cprintf>
+	cprintf("expected:\n===\n");
+  800065:	c7 04 24 ab 5c 80 00 	movl   $0x805cab,(%esp)
+  80006c:	e8 52 05 00 00       	call   8005c3 <cprintf>
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  800077:	eb 0d                	jmp    800086 <wrong+0x53>
+		sys_cputs(buf, n);
+  800079:	83 ec 08             	sub    $0x8,%esp
+  80007c:	50                   	push   %eax
+  80007d:	53                   	push   %ebx
+  80007e:	e8 4d 0f 00 00       	call   800fd0 <sys_cputs>
+  800083:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800086:	83 ec 04             	sub    $0x4,%esp
+  800089:	6a 63                	push   $0x63
+  80008b:	53                   	push   %ebx
+  80008c:	57                   	push   %edi
+  80008d:	e8 34 1e 00 00       	call   801ec6 <read>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	7f e0                	jg     800079 <wrong+0x46>
+	cprintf("===\ngot:\n===\n");
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	68 ba 5c 80 00       	push   $0x805cba
+  8000a1:	e8 1d 05 00 00       	call   8005c3 <cprintf>
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  8000ac:	eb 0d                	jmp    8000bb <wrong+0x88>
+		sys_cputs(buf, n);
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+  8000b1:	50                   	push   %eax
+  8000b2:	53                   	push   %ebx
+  8000b3:	e8 18 0f 00 00       	call   800fd0 <sys_cputs>
+  8000b8:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	6a 63                	push   $0x63
+  8000c0:	53                   	push   %ebx
+  8000c1:	56                   	push   %esi
+  8000c2:	e8 ff 1d 00 00       	call   801ec6 <read>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f e0                	jg     8000ae <wrong+0x7b>
+	cprintf("===\n");
+  8000ce:	83 ec 0c             	sub    $0xc,%esp
+  8000d1:	68 b5 5c 80 00       	push   $0x805cb5
+  8000d6:	e8 e8 04 00 00       	call   8005c3 <cprintf>
+	exit();
+  8000db:	e8 ee 03 00 00       	call   8004ce <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <umain>:
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 38             	sub    $0x38,%esp
+	close(0);
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	e8 8f 1c 00 00       	call   801d8a <close>
+	close(1);
+  8000fb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800102:	e8 83 1c 00 00       	call   801d8a <close>
+	opencons();
+  800107:	e8 27 03 00 00       	call   800433 <opencons>
+	opencons();
+  80010c:	e8 22 03 00 00       	call   800433 <opencons>
+	if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800111:	83 c4 08             	add    $0x8,%esp
+  800114:	6a 00                	push   $0x0
+  800116:	68 c8 5c 80 00       	push   $0x805cc8
+  80011b:	e8 e1 22 00 00       	call   802401 <open>
+  800120:	89 c3                	mov    %eax,%ebx
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 e7 00 00 00    	js     800214 <umain+0x129>
+	if ((wfd = pipe(pfds)) < 0)
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800133:	50                   	push   %eax
+  800134:	e8 78 2e 00 00       	call   802fb1 <pipe>
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	0f 88 e2 00 00 00    	js     800226 <umain+0x13b>
+	wfd = pfds[1];
+  800144:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	cprintf("running sh -x < testshell.sh | cat\n");
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	68 64 5c 80 00       	push   $0x805c64
+  80014f:	e8 6f 04 00 00       	call   8005c3 <cprintf>
+	if ((r = fork()) < 0)
+  800154:	e8 2b 16 00 00       	call   801784 <fork>
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	0f 88 d4 00 00 00    	js     800238 <umain+0x14d>
+	if (r == 0) {
+  800164:	75 6f                	jne    8001d5 <umain+0xea>
+		dup(rfd, 0);
+  800166:	83 ec 08             	sub    $0x8,%esp
+  800169:	6a 00                	push   $0x0
+  80016b:	53                   	push   %ebx
+  80016c:	e8 6b 1c 00 00       	call   801ddc <dup>
+		dup(wfd, 1);
+  800171:	83 c4 08             	add    $0x8,%esp
+  800174:	6a 01                	push   $0x1
+  800176:	56                   	push   %esi
+  800177:	e8 60 1c 00 00       	call   801ddc <dup>
+		close(rfd);
+  80017c:	89 1c 24             	mov    %ebx,(%esp)
+  80017f:	e8 06 1c 00 00       	call   801d8a <close>
+		close(wfd);
+  800184:	89 34 24             	mov    %esi,(%esp)
+  800187:	e8 fe 1b 00 00       	call   801d8a <close>
+		if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  80018c:	6a 00                	push   $0x0
+  80018e:	68 0e 5d 80 00       	push   $0x805d0e
+  800193:	68 d2 5c 80 00       	push   $0x805cd2
+  800198:	68 11 5d 80 00       	push   $0x805d11
+  80019d:	e8 29 2a 00 00       	call   802bcb <spawnl>
+  8001a2:	89 c7                	mov    %eax,%edi
+  8001a4:	83 c4 20             	add    $0x20,%esp
+  8001a7:	85 c0                	test   %eax,%eax
+  8001a9:	0f 88 9b 00 00 00    	js     80024a <umain+0x15f>
+		close(0);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	6a 00                	push   $0x0
+  8001b4:	e8 d1 1b 00 00       	call   801d8a <close>
+		close(1);
+  8001b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8001c0:	e8 c5 1b 00 00       	call   801d8a <close>
+		wait(r);
+  8001c5:	89 3c 24             	mov    %edi,(%esp)
+  8001c8:	e8 61 2f 00 00       	call   80312e <wait>
+		exit();
+  8001cd:	e8 fc 02 00 00       	call   8004ce <exit>
+  8001d2:	83 c4 10             	add    $0x10,%esp
+	close(rfd);
+  8001d5:	83 ec 0c             	sub    $0xc,%esp
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 ac 1b 00 00       	call   801d8a <close>
+	close(wfd);
+  8001de:	89 34 24             	mov    %esi,(%esp)
+  8001e1:	e8 a4 1b 00 00       	call   801d8a <close>
+	rfd = pfds[0];
+  8001e6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8001e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	6a 00                	push   $0x0
+  8001f1:	68 1f 5d 80 00       	push   $0x805d1f
+  8001f6:	e8 06 22 00 00       	call   802401 <open>
+  8001fb:	83 c4 10             	add    $0x10,%esp
+  8001fe:	85 c0                	test   %eax,%eax
+  800200:	78 5a                	js     80025c <umain+0x171>
+  800202:	be 01 00 00 00       	mov    $0x1,%esi
+	nloff = 0;
+  800207:	bf 00 00 00 00       	mov    $0x0,%edi
+		n2 = read(kfd, &c2, 1);
+  80020c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80020f:	e9 9a 00 00 00       	jmp    8002ae <umain+0x1c3>
+		panic("open testshell.sh: %e", rfd);
+  800214:	50                   	push   %eax
+  800215:	68 d5 5c 80 00       	push   $0x805cd5
+  80021a:	6a 13                	push   $0x13
+  80021c:	68 eb 5c 80 00       	push   $0x805ceb
+  800221:	e8 c2 02 00 00       	call   8004e8 <_panic>
+		panic("pipe: %e", wfd);
+  800226:	50                   	push   %eax
+  800227:	68 fc 5c 80 00       	push   $0x805cfc
+  80022c:	6a 15                	push   $0x15
+  80022e:	68 eb 5c 80 00       	push   $0x805ceb
+  800233:	e8 b0 02 00 00       	call   8004e8 <_panic>
+		panic("fork: %e", r);
+  800238:	50                   	push   %eax
+  800239:	68 05 5d 80 00       	push   $0x805d05
+  80023e:	6a 1a                	push   $0x1a
+  800240:	68 eb 5c 80 00       	push   $0x805ceb
+  800245:	e8 9e 02 00 00       	call   8004e8 <_panic>
+			panic("spawn: %e", r);
+  80024a:	50                   	push   %eax
+  80024b:	68 15 5d 80 00       	push   $0x805d15
+  800250:	6a 21                	push   $0x21
+  800252:	68 eb 5c 80 00       	push   $0x805ceb
+  800257:	e8 8c 02 00 00       	call   8004e8 <_panic>
+		panic("open testshell.key for reading: %e", kfd);
+  80025c:	50                   	push   %eax
+  80025d:	68 88 5c 80 00       	push   $0x805c88
+  800262:	6a 2c                	push   $0x2c
+  800264:	68 eb 5c 80 00       	push   $0x805ceb
+  800269:	e8 7a 02 00 00       	call   8004e8 <_panic>
+			panic("reading testshell.out: %e", n1);
+  80026e:	53                   	push   %ebx
+  80026f:	68 2d 5d 80 00       	push   $0x805d2d
+  800274:	6a 33                	push   $0x33
+  800276:	68 eb 5c 80 00       	push   $0x805ceb
+  80027b:	e8 68 02 00 00       	call   8004e8 <_panic>
+			panic("reading testshell.key: %e", n2);
+  800280:	50                   	push   %eax
+  800281:	68 47 5d 80 00       	push   $0x805d47
+  800286:	6a 35                	push   $0x35
+  800288:	68 eb 5c 80 00       	push   $0x805ceb
+  80028d:	e8 56 02 00 00       	call   8004e8 <_panic>
+			wrong(rfd, kfd, nloff);
+  800292:	83 ec 04             	sub    $0x4,%esp
+  800295:	57                   	push   %edi
+  800296:	ff 75 d0             	push   -0x30(%ebp)
+  800299:	ff 75 d4             	push   -0x2c(%ebp)
+  80029c:	e8 92 fd ff ff       	call   800033 <wrong>
+  8002a1:	83 c4 10             	add    $0x10,%esp
+			nloff = off+1;
+  8002a4:	80 7d e7 0a          	cmpb   $0xa,-0x19(%ebp)
+  8002a8:	0f 44 fe             	cmove  %esi,%edi
+	for (off=0;; off++) {
+  8002ab:	83 c6 01             	add    $0x1,%esi
+		n1 = read(rfd, &c1, 1);
+  8002ae:	83 ec 04             	sub    $0x4,%esp
+  8002b1:	6a 01                	push   $0x1
+  8002b3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8002ba:	e8 07 1c 00 00       	call   801ec6 <read>
+  8002bf:	89 c3                	mov    %eax,%ebx
+		n2 = read(kfd, &c2, 1);
+  8002c1:	83 c4 0c             	add    $0xc,%esp
+  8002c4:	6a 01                	push   $0x1
+  8002c6:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff 75 d0             	push   -0x30(%ebp)
+  8002cd:	e8 f4 1b 00 00       	call   801ec6 <read>
+		if (n1 < 0)
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	85 db                	test   %ebx,%ebx
+  8002d7:	78 95                	js     80026e <umain+0x183>
+		if (n2 < 0)
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	78 a3                	js     800280 <umain+0x195>
+		if (n1 == 0 && n2 == 0)
+  8002dd:	89 d9                	mov    %ebx,%ecx
+  8002df:	09 c1                	or     %eax,%ecx
+  8002e1:	74 15                	je     8002f8 <umain+0x20d>
+		if (n1 != 1 || n2 != 1 || c1 != c2)
+  8002e3:	83 fb 01             	cmp    $0x1,%ebx
+  8002e6:	75 aa                	jne    800292 <umain+0x1a7>
+  8002e8:	83 f8 01             	cmp    $0x1,%eax
+  8002eb:	75 a5                	jne    800292 <umain+0x1a7>
+  8002ed:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  8002f1:	38 45 e7             	cmp    %al,-0x19(%ebp)
+  8002f4:	75 9c                	jne    800292 <umain+0x1a7>
+  8002f6:	eb ac                	jmp    8002a4 <umain+0x1b9>
+	cprintf("shell ran correctly\n");
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	68 61 5d 80 00       	push   $0x805d61
+  800300:	e8 be 02 00 00       	call   8005c3 <cprintf>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+	__asm __volatile("int3");
+  800305:	cc                   	int3
+}
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030c:	5b                   	pop    %ebx
+  80030d:	5e                   	pop    %esi
+  80030e:	5f                   	pop    %edi
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+
+00800311 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	c3                   	ret
+
+00800317 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80031d:	68 76 5d 80 00       	push   $0x805d76
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	e8 80 08 00 00       	call   800baa <strcpy>
+	return 0;
+}
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+00800331 <devcons_write>:
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80033d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800342:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800348:	eb 2e                	jmp    800378 <devcons_write+0x47>
+		m = n - tot;
+  80034a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80034d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80034f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800354:	39 c3                	cmp    %eax,%ebx
+  800356:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800359:	83 ec 04             	sub    $0x4,%esp
+  80035c:	53                   	push   %ebx
+  80035d:	89 f0                	mov    %esi,%eax
+  80035f:	03 45 0c             	add    0xc(%ebp),%eax
+  800362:	50                   	push   %eax
+  800363:	57                   	push   %edi
+  800364:	e8 c7 09 00 00       	call   800d30 <memmove>
+		sys_cputs(buf, m);
+  800369:	83 c4 08             	add    $0x8,%esp
+  80036c:	53                   	push   %ebx
+  80036d:	57                   	push   %edi
+  80036e:	e8 5d 0c 00 00       	call   800fd0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800373:	01 de                	add    %ebx,%esi
+  800375:	83 c4 10             	add    $0x10,%esp
+  800378:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80037b:	72 cd                	jb     80034a <devcons_write+0x19>
+}
+  80037d:	89 f0                	mov    %esi,%eax
+  80037f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800382:	5b                   	pop    %ebx
+  800383:	5e                   	pop    %esi
+  800384:	5f                   	pop    %edi
+  800385:	5d                   	pop    %ebp
+  800386:	c3                   	ret
+
+00800387 <devcons_read>:
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800396:	75 07                	jne    80039f <devcons_read+0x18>
+  800398:	eb 1f                	jmp    8003b9 <devcons_read+0x32>
+		sys_yield();
+  80039a:	e8 df 0c 00 00       	call   80107e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80039f:	e8 5b 0c 00 00       	call   800fff <sys_cgetc>
+  8003a4:	85 c0                	test   %eax,%eax
+  8003a6:	74 f2                	je     80039a <devcons_read+0x13>
+	if (c < 0)
+  8003a8:	78 0f                	js     8003b9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8003aa:	83 f8 04             	cmp    $0x4,%eax
+  8003ad:	74 0c                	je     8003bb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8003af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003b2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8003b4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8003b9:	c9                   	leave
+  8003ba:	c3                   	ret
+		return 0;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c0:	eb f7                	jmp    8003b9 <devcons_read+0x32>
+
+008003c2 <cputchar>:
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8003c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003cb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8003ce:	6a 01                	push   $0x1
+  8003d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003d3:	50                   	push   %eax
+  8003d4:	e8 f7 0b 00 00       	call   800fd0 <sys_cputs>
+}
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+
+008003de <getchar>:
+{
+  8003de:	55                   	push   %ebp
+  8003df:	89 e5                	mov    %esp,%ebp
+  8003e1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8003e4:	6a 01                	push   $0x1
+  8003e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	6a 00                	push   $0x0
+  8003ec:	e8 d5 1a 00 00       	call   801ec6 <read>
+	if (r < 0)
+  8003f1:	83 c4 10             	add    $0x10,%esp
+  8003f4:	85 c0                	test   %eax,%eax
+  8003f6:	78 06                	js     8003fe <getchar+0x20>
+	if (r < 1)
+  8003f8:	74 06                	je     800400 <getchar+0x22>
+	return c;
+  8003fa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+		return -E_EOF;
+  800400:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800405:	eb f7                	jmp    8003fe <getchar+0x20>
+
+00800407 <iscons>:
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80040d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800410:	50                   	push   %eax
+  800411:	ff 75 08             	push   0x8(%ebp)
+  800414:	e8 4e 18 00 00       	call   801c67 <fd_lookup>
+  800419:	83 c4 10             	add    $0x10,%esp
+  80041c:	85 c0                	test   %eax,%eax
+  80041e:	78 11                	js     800431 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800423:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  800429:	39 10                	cmp    %edx,(%eax)
+  80042b:	0f 94 c0             	sete   %al
+  80042e:	0f b6 c0             	movzbl %al,%eax
+}
+  800431:	c9                   	leave
+  800432:	c3                   	ret
+
+00800433 <opencons>:
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800439:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80043c:	50                   	push   %eax
+  80043d:	e8 d1 17 00 00       	call   801c13 <fd_alloc>
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	85 c0                	test   %eax,%eax
+  800447:	78 3a                	js     800483 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800449:	83 ec 04             	sub    $0x4,%esp
+  80044c:	68 07 04 00 00       	push   $0x407
+  800451:	ff 75 f4             	push   -0xc(%ebp)
+  800454:	6a 00                	push   $0x0
+  800456:	e8 42 0c 00 00       	call   80109d <sys_page_alloc>
+  80045b:	83 c4 10             	add    $0x10,%esp
+  80045e:	85 c0                	test   %eax,%eax
+  800460:	78 21                	js     800483 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800462:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800465:	8b 15 00 70 80 00    	mov    0x807000,%edx
+  80046b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80046d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800470:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800477:	83 ec 0c             	sub    $0xc,%esp
+  80047a:	50                   	push   %eax
+  80047b:	e8 6c 17 00 00       	call   801bec <fd2num>
+  800480:	83 c4 10             	add    $0x10,%esp
+}
+  800483:	c9                   	leave
+  800484:	c3                   	ret
+
+00800485 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800485:	55                   	push   %ebp
+  800486:	89 e5                	mov    %esp,%ebp
+  800488:	56                   	push   %esi
+  800489:	53                   	push   %ebx
+  80048a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80048d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  800490:	e8 ca 0b 00 00       	call   80105f <sys_getenvid>
+  800495:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80049a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80049d:	c1 e0 06             	shl    $0x6,%eax
+  8004a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004a5:	a3 18 f9 80 00       	mov    %eax,0x80f918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004aa:	85 db                	test   %ebx,%ebx
+  8004ac:	7e 07                	jle    8004b5 <libmain+0x30>
+		binaryname = argv[0];
+  8004ae:	8b 06                	mov    (%esi),%eax
+  8004b0:	a3 1c 70 80 00       	mov    %eax,0x80701c
+
+	// call user main routine
+	umain(argc, argv);
+  8004b5:	83 ec 08             	sub    $0x8,%esp
+  8004b8:	56                   	push   %esi
+  8004b9:	53                   	push   %ebx
+  8004ba:	e8 2c fc ff ff       	call   8000eb <umain>
+
+	// exit gracefully
+	exit();
+  8004bf:	e8 0a 00 00 00       	call   8004ce <exit>
+}
+  8004c4:	83 c4 10             	add    $0x10,%esp
+  8004c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8004ca:	5b                   	pop    %ebx
+  8004cb:	5e                   	pop    %esi
+  8004cc:	5d                   	pop    %ebp
+  8004cd:	c3                   	ret
+
+008004ce <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8004d4:	e8 de 18 00 00       	call   801db7 <close_all>
+	sys_env_destroy(0);
+  8004d9:	83 ec 0c             	sub    $0xc,%esp
+  8004dc:	6a 00                	push   $0x0
+  8004de:	e8 3b 0b 00 00       	call   80101e <sys_env_destroy>
+}
+  8004e3:	83 c4 10             	add    $0x10,%esp
+  8004e6:	c9                   	leave
+  8004e7:	c3                   	ret
+
+008004e8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004e8:	55                   	push   %ebp
+  8004e9:	89 e5                	mov    %esp,%ebp
+  8004eb:	56                   	push   %esi
+  8004ec:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004ed:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004f0:	8b 35 1c 70 80 00    	mov    0x80701c,%esi
+  8004f6:	e8 64 0b 00 00       	call   80105f <sys_getenvid>
+  8004fb:	83 ec 0c             	sub    $0xc,%esp
+  8004fe:	ff 75 0c             	push   0xc(%ebp)
+  800501:	ff 75 08             	push   0x8(%ebp)
+  800504:	56                   	push   %esi
+  800505:	50                   	push   %eax
+  800506:	68 8c 5d 80 00       	push   $0x805d8c
+  80050b:	e8 b3 00 00 00       	call   8005c3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800510:	83 c4 18             	add    $0x18,%esp
+  800513:	53                   	push   %ebx
+  800514:	ff 75 10             	push   0x10(%ebp)
+  800517:	e8 56 00 00 00       	call   800572 <vcprintf>
+	cprintf("\n");
+  80051c:	c7 04 24 b8 5c 80 00 	movl   $0x805cb8,(%esp)
+  800523:	e8 9b 00 00 00       	call   8005c3 <cprintf>
+  800528:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80052b:	cc                   	int3
+	while (1)
+  80052c:	eb fd                	jmp    80052b <_panic+0x43>
+
+0080052e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80052e:	55                   	push   %ebp
+  80052f:	89 e5                	mov    %esp,%ebp
+  800531:	53                   	push   %ebx
+  800532:	83 ec 04             	sub    $0x4,%esp
+  800535:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800538:	8b 13                	mov    (%ebx),%edx
+  80053a:	8d 42 01             	lea    0x1(%edx),%eax
+  80053d:	89 03                	mov    %eax,(%ebx)
+  80053f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800542:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800546:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80054b:	74 09                	je     800556 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80054d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800551:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800554:	c9                   	leave
+  800555:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800556:	83 ec 08             	sub    $0x8,%esp
+  800559:	68 ff 00 00 00       	push   $0xff
+  80055e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800561:	50                   	push   %eax
+  800562:	e8 69 0a 00 00       	call   800fd0 <sys_cputs>
+		b->idx = 0;
+  800567:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80056d:	83 c4 10             	add    $0x10,%esp
+  800570:	eb db                	jmp    80054d <putch+0x1f>
+
+00800572 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800572:	55                   	push   %ebp
+  800573:	89 e5                	mov    %esp,%ebp
+  800575:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80057b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800582:	00 00 00 
+	b.cnt = 0;
+  800585:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80058c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80058f:	ff 75 0c             	push   0xc(%ebp)
+  800592:	ff 75 08             	push   0x8(%ebp)
+  800595:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80059b:	50                   	push   %eax
+  80059c:	68 2e 05 80 00       	push   $0x80052e
+  8005a1:	e8 14 01 00 00       	call   8006ba <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005a6:	83 c4 08             	add    $0x8,%esp
+  8005a9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005af:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005b5:	50                   	push   %eax
+  8005b6:	e8 15 0a 00 00       	call   800fd0 <sys_cputs>
+
+	return b.cnt;
+}
+  8005bb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005c1:	c9                   	leave
+  8005c2:	c3                   	ret
+
+008005c3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005c3:	55                   	push   %ebp
+  8005c4:	89 e5                	mov    %esp,%ebp
+  8005c6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005c9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005cc:	50                   	push   %eax
+  8005cd:	ff 75 08             	push   0x8(%ebp)
+  8005d0:	e8 9d ff ff ff       	call   800572 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005d5:	c9                   	leave
+  8005d6:	c3                   	ret
+
+008005d7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	57                   	push   %edi
+  8005db:	56                   	push   %esi
+  8005dc:	53                   	push   %ebx
+  8005dd:	83 ec 1c             	sub    $0x1c,%esp
+  8005e0:	89 c7                	mov    %eax,%edi
+  8005e2:	89 d6                	mov    %edx,%esi
+  8005e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005ea:	89 d1                	mov    %edx,%ecx
+  8005ec:	89 c2                	mov    %eax,%edx
+  8005ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005f7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800604:	39 c2                	cmp    %eax,%edx
+  800606:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800609:	72 3e                	jb     800649 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80060b:	83 ec 0c             	sub    $0xc,%esp
+  80060e:	ff 75 18             	push   0x18(%ebp)
+  800611:	83 eb 01             	sub    $0x1,%ebx
+  800614:	53                   	push   %ebx
+  800615:	50                   	push   %eax
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	ff 75 e4             	push   -0x1c(%ebp)
+  80061c:	ff 75 e0             	push   -0x20(%ebp)
+  80061f:	ff 75 dc             	push   -0x24(%ebp)
+  800622:	ff 75 d8             	push   -0x28(%ebp)
+  800625:	e8 d0 54 00 00       	call   805afa <__udivdi3>
+  80062a:	83 c4 18             	add    $0x18,%esp
+  80062d:	52                   	push   %edx
+  80062e:	50                   	push   %eax
+  80062f:	89 f2                	mov    %esi,%edx
+  800631:	89 f8                	mov    %edi,%eax
+  800633:	e8 9f ff ff ff       	call   8005d7 <printnum>
+  800638:	83 c4 20             	add    $0x20,%esp
+  80063b:	eb 13                	jmp    800650 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80063d:	83 ec 08             	sub    $0x8,%esp
+  800640:	56                   	push   %esi
+  800641:	ff 75 18             	push   0x18(%ebp)
+  800644:	ff d7                	call   *%edi
+  800646:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800649:	83 eb 01             	sub    $0x1,%ebx
+  80064c:	85 db                	test   %ebx,%ebx
+  80064e:	7f ed                	jg     80063d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800650:	83 ec 08             	sub    $0x8,%esp
+  800653:	56                   	push   %esi
+  800654:	83 ec 04             	sub    $0x4,%esp
+  800657:	ff 75 e4             	push   -0x1c(%ebp)
+  80065a:	ff 75 e0             	push   -0x20(%ebp)
+  80065d:	ff 75 dc             	push   -0x24(%ebp)
+  800660:	ff 75 d8             	push   -0x28(%ebp)
+  800663:	e8 b0 54 00 00       	call   805b18 <__umoddi3>
+  800668:	83 c4 14             	add    $0x14,%esp
+  80066b:	0f be 80 af 5d 80 00 	movsbl 0x805daf(%eax),%eax
+  800672:	50                   	push   %eax
+  800673:	ff d7                	call   *%edi
+}
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80067b:	5b                   	pop    %ebx
+  80067c:	5e                   	pop    %esi
+  80067d:	5f                   	pop    %edi
+  80067e:	5d                   	pop    %ebp
+  80067f:	c3                   	ret
+
+00800680 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800680:	55                   	push   %ebp
+  800681:	89 e5                	mov    %esp,%ebp
+  800683:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800686:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80068a:	8b 10                	mov    (%eax),%edx
+  80068c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80068f:	73 0a                	jae    80069b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800691:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800694:	89 08                	mov    %ecx,(%eax)
+  800696:	8b 45 08             	mov    0x8(%ebp),%eax
+  800699:	88 02                	mov    %al,(%edx)
+}
+  80069b:	5d                   	pop    %ebp
+  80069c:	c3                   	ret
+
+0080069d <printfmt>:
+{
+  80069d:	55                   	push   %ebp
+  80069e:	89 e5                	mov    %esp,%ebp
+  8006a0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006a3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006a6:	50                   	push   %eax
+  8006a7:	ff 75 10             	push   0x10(%ebp)
+  8006aa:	ff 75 0c             	push   0xc(%ebp)
+  8006ad:	ff 75 08             	push   0x8(%ebp)
+  8006b0:	e8 05 00 00 00       	call   8006ba <vprintfmt>
+}
+  8006b5:	83 c4 10             	add    $0x10,%esp
+  8006b8:	c9                   	leave
+  8006b9:	c3                   	ret
+
+008006ba <vprintfmt>:
+{
+  8006ba:	55                   	push   %ebp
+  8006bb:	89 e5                	mov    %esp,%ebp
+  8006bd:	57                   	push   %edi
+  8006be:	56                   	push   %esi
+  8006bf:	53                   	push   %ebx
+  8006c0:	83 ec 2c             	sub    $0x2c,%esp
+  8006c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006c9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006cc:	eb 0a                	jmp    8006d8 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006ce:	83 ec 08             	sub    $0x8,%esp
+  8006d1:	53                   	push   %ebx
+  8006d2:	50                   	push   %eax
+  8006d3:	ff d6                	call   *%esi
+  8006d5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006d8:	83 c7 01             	add    $0x1,%edi
+  8006db:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8006df:	83 f8 25             	cmp    $0x25,%eax
+  8006e2:	74 0c                	je     8006f0 <vprintfmt+0x36>
+			if (ch == '\0')
+  8006e4:	85 c0                	test   %eax,%eax
+  8006e6:	75 e6                	jne    8006ce <vprintfmt+0x14>
+}
+  8006e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006eb:	5b                   	pop    %ebx
+  8006ec:	5e                   	pop    %esi
+  8006ed:	5f                   	pop    %edi
+  8006ee:	5d                   	pop    %ebp
+  8006ef:	c3                   	ret
+		padc = ' ';
+  8006f0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8006f4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8006fb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800702:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800709:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80070e:	8d 47 01             	lea    0x1(%edi),%eax
+  800711:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800714:	0f b6 17             	movzbl (%edi),%edx
+  800717:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80071a:	3c 55                	cmp    $0x55,%al
+  80071c:	0f 87 c5 03 00 00    	ja     800ae7 <vprintfmt+0x42d>
+  800722:	0f b6 c0             	movzbl %al,%eax
+  800725:	ff 24 85 40 5f 80 00 	jmp    *0x805f40(,%eax,4)
+  80072c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80072f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800733:	eb d9                	jmp    80070e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800735:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800738:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80073c:	eb d0                	jmp    80070e <vprintfmt+0x54>
+  80073e:	0f b6 d2             	movzbl %dl,%edx
+  800741:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+  800749:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80074c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80074f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800753:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800756:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800759:	83 f9 09             	cmp    $0x9,%ecx
+  80075c:	77 55                	ja     8007b3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80075e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800761:	eb e9                	jmp    80074c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800763:	8b 45 14             	mov    0x14(%ebp),%eax
+  800766:	8b 00                	mov    (%eax),%eax
+  800768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8d 40 04             	lea    0x4(%eax),%eax
+  800771:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800774:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800777:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80077b:	79 91                	jns    80070e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80077d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800780:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800783:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80078a:	eb 82                	jmp    80070e <vprintfmt+0x54>
+			if (width < 0)
+  80078c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80078f:	85 d2                	test   %edx,%edx
+  800791:	b8 00 00 00 00       	mov    $0x0,%eax
+  800796:	0f 49 c2             	cmovns %edx,%eax
+  800799:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80079c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80079f:	e9 6a ff ff ff       	jmp    80070e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007a7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007ae:	e9 5b ff ff ff       	jmp    80070e <vprintfmt+0x54>
+  8007b3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007b9:	eb bc                	jmp    800777 <vprintfmt+0xbd>
+			lflag++;
+  8007bb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007c1:	e9 48 ff ff ff       	jmp    80070e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c9:	8d 78 04             	lea    0x4(%eax),%edi
+  8007cc:	83 ec 08             	sub    $0x8,%esp
+  8007cf:	53                   	push   %ebx
+  8007d0:	ff 30                	push   (%eax)
+  8007d2:	ff d6                	call   *%esi
+			break;
+  8007d4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007d7:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007da:	e9 63 02 00 00       	jmp    800a42 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8007e5:	8b 10                	mov    (%eax),%edx
+  8007e7:	89 d0                	mov    %edx,%eax
+  8007e9:	f7 d8                	neg    %eax
+  8007eb:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007ee:	83 f8 12             	cmp    $0x12,%eax
+  8007f1:	7f 23                	jg     800816 <vprintfmt+0x15c>
+  8007f3:	8b 14 85 a0 60 80 00 	mov    0x8060a0(,%eax,4),%edx
+  8007fa:	85 d2                	test   %edx,%edx
+  8007fc:	74 18                	je     800816 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8007fe:	52                   	push   %edx
+  8007ff:	68 cd 62 80 00       	push   $0x8062cd
+  800804:	53                   	push   %ebx
+  800805:	56                   	push   %esi
+  800806:	e8 92 fe ff ff       	call   80069d <printfmt>
+  80080b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80080e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800811:	e9 2c 02 00 00       	jmp    800a42 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  800816:	50                   	push   %eax
+  800817:	68 c7 5d 80 00       	push   $0x805dc7
+  80081c:	53                   	push   %ebx
+  80081d:	56                   	push   %esi
+  80081e:	e8 7a fe ff ff       	call   80069d <printfmt>
+  800823:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800826:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800829:	e9 14 02 00 00       	jmp    800a42 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80082e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800831:	83 c0 04             	add    $0x4,%eax
+  800834:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80083c:	85 c9                	test   %ecx,%ecx
+  80083e:	b8 c0 5d 80 00       	mov    $0x805dc0,%eax
+  800843:	0f 45 c1             	cmovne %ecx,%eax
+  800846:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800849:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80084d:	7e 06                	jle    800855 <vprintfmt+0x19b>
+  80084f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800853:	75 0b                	jne    800860 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800855:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800858:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80085b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80085e:	eb 5c                	jmp    8008bc <vprintfmt+0x202>
+  800860:	83 ec 08             	sub    $0x8,%esp
+  800863:	ff 75 d0             	push   -0x30(%ebp)
+  800866:	ff 75 cc             	push   -0x34(%ebp)
+  800869:	e8 19 03 00 00       	call   800b87 <strnlen>
+  80086e:	89 c2                	mov    %eax,%edx
+  800870:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800873:	29 d0                	sub    %edx,%eax
+  800875:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800878:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80087c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80087f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800882:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800884:	eb 0e                	jmp    800894 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800886:	83 ec 08             	sub    $0x8,%esp
+  800889:	53                   	push   %ebx
+  80088a:	57                   	push   %edi
+  80088b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80088e:	83 ee 01             	sub    $0x1,%esi
+  800891:	83 c4 10             	add    $0x10,%esp
+  800894:	85 f6                	test   %esi,%esi
+  800896:	7f ee                	jg     800886 <vprintfmt+0x1cc>
+  800898:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80089b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089e:	85 c0                	test   %eax,%eax
+  8008a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008a5:	0f 49 d0             	cmovns %eax,%edx
+  8008a8:	29 d0                	sub    %edx,%eax
+  8008aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008ad:	eb a6                	jmp    800855 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008af:	83 ec 08             	sub    $0x8,%esp
+  8008b2:	53                   	push   %ebx
+  8008b3:	52                   	push   %edx
+  8008b4:	ff 55 08             	call   *0x8(%ebp)
+  8008b7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008ba:	89 f1                	mov    %esi,%ecx
+  8008bc:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008bf:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008c3:	0f be d0             	movsbl %al,%edx
+  8008c6:	85 d2                	test   %edx,%edx
+  8008c8:	74 28                	je     8008f2 <vprintfmt+0x238>
+  8008ca:	85 ff                	test   %edi,%edi
+  8008cc:	78 05                	js     8008d3 <vprintfmt+0x219>
+  8008ce:	83 ef 01             	sub    $0x1,%edi
+  8008d1:	78 30                	js     800903 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008d3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008d7:	74 d6                	je     8008af <vprintfmt+0x1f5>
+  8008d9:	0f be c0             	movsbl %al,%eax
+  8008dc:	83 e8 20             	sub    $0x20,%eax
+  8008df:	83 f8 5e             	cmp    $0x5e,%eax
+  8008e2:	76 cb                	jbe    8008af <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8008e4:	83 ec 08             	sub    $0x8,%esp
+  8008e7:	53                   	push   %ebx
+  8008e8:	6a 3f                	push   $0x3f
+  8008ea:	ff 55 08             	call   *0x8(%ebp)
+  8008ed:	83 c4 10             	add    $0x10,%esp
+  8008f0:	eb c8                	jmp    8008ba <vprintfmt+0x200>
+  8008f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008f8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008fb:	01 d0                	add    %edx,%eax
+  8008fd:	29 c8                	sub    %ecx,%eax
+  8008ff:	89 c7                	mov    %eax,%edi
+  800901:	eb 13                	jmp    800916 <vprintfmt+0x25c>
+  800903:	8b 75 08             	mov    0x8(%ebp),%esi
+  800906:	eb ed                	jmp    8008f5 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800908:	83 ec 08             	sub    $0x8,%esp
+  80090b:	53                   	push   %ebx
+  80090c:	6a 20                	push   $0x20
+  80090e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800910:	83 ef 01             	sub    $0x1,%edi
+  800913:	83 c4 10             	add    $0x10,%esp
+  800916:	85 ff                	test   %edi,%edi
+  800918:	7f ee                	jg     800908 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80091a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80091d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800920:	e9 1d 01 00 00       	jmp    800a42 <vprintfmt+0x388>
+	if (lflag >= 2)
+  800925:	83 f9 01             	cmp    $0x1,%ecx
+  800928:	7f 1b                	jg     800945 <vprintfmt+0x28b>
+	else if (lflag)
+  80092a:	85 c9                	test   %ecx,%ecx
+  80092c:	74 63                	je     800991 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  80092e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800931:	8b 00                	mov    (%eax),%eax
+  800933:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800936:	99                   	cltd
+  800937:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80093a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093d:	8d 40 04             	lea    0x4(%eax),%eax
+  800940:	89 45 14             	mov    %eax,0x14(%ebp)
+  800943:	eb 17                	jmp    80095c <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800945:	8b 45 14             	mov    0x14(%ebp),%eax
+  800948:	8b 50 04             	mov    0x4(%eax),%edx
+  80094b:	8b 00                	mov    (%eax),%eax
+  80094d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800950:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800953:	8b 45 14             	mov    0x14(%ebp),%eax
+  800956:	8d 40 08             	lea    0x8(%eax),%eax
+  800959:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80095c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80095f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800962:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800967:	85 c9                	test   %ecx,%ecx
+  800969:	0f 89 b9 00 00 00    	jns    800a28 <vprintfmt+0x36e>
+				putch('-', putdat);
+  80096f:	83 ec 08             	sub    $0x8,%esp
+  800972:	53                   	push   %ebx
+  800973:	6a 2d                	push   $0x2d
+  800975:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800977:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80097a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80097d:	f7 da                	neg    %edx
+  80097f:	83 d1 00             	adc    $0x0,%ecx
+  800982:	f7 d9                	neg    %ecx
+  800984:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800987:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80098c:	e9 97 00 00 00       	jmp    800a28 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800991:	8b 45 14             	mov    0x14(%ebp),%eax
+  800994:	8b 00                	mov    (%eax),%eax
+  800996:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800999:	99                   	cltd
+  80099a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80099d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8009a3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009a6:	eb b4                	jmp    80095c <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8009a8:	83 f9 01             	cmp    $0x1,%ecx
+  8009ab:	7f 1b                	jg     8009c8 <vprintfmt+0x30e>
+	else if (lflag)
+  8009ad:	85 c9                	test   %ecx,%ecx
+  8009af:	74 2c                	je     8009dd <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8009b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b4:	8b 10                	mov    (%eax),%edx
+  8009b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8009be:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009c1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009c6:	eb 60                	jmp    800a28 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8009c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cb:	8b 10                	mov    (%eax),%edx
+  8009cd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009d0:	8d 40 08             	lea    0x8(%eax),%eax
+  8009d3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009d6:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8009db:	eb 4b                	jmp    800a28 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8009dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e0:	8b 10                	mov    (%eax),%edx
+  8009e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ea:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009ed:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8009f2:	eb 34                	jmp    800a28 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8009f4:	83 f9 01             	cmp    $0x1,%ecx
+  8009f7:	7f 15                	jg     800a0e <vprintfmt+0x354>
+	else if (lflag)
+  8009f9:	85 c9                	test   %ecx,%ecx
+  8009fb:	74 4d                	je     800a4a <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8009fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a00:	8b 00                	mov    (%eax),%eax
+  800a02:	99                   	cltd
+  800a03:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800a06:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800a09:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800a0c:	eb 11                	jmp    800a1f <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800a0e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a11:	8b 50 04             	mov    0x4(%eax),%edx
+  800a14:	8b 00                	mov    (%eax),%eax
+  800a16:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800a19:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800a1c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800a1f:	89 d1                	mov    %edx,%ecx
+  800a21:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800a23:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a28:	83 ec 0c             	sub    $0xc,%esp
+  800a2b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a2f:	50                   	push   %eax
+  800a30:	ff 75 e0             	push   -0x20(%ebp)
+  800a33:	57                   	push   %edi
+  800a34:	51                   	push   %ecx
+  800a35:	52                   	push   %edx
+  800a36:	89 da                	mov    %ebx,%edx
+  800a38:	89 f0                	mov    %esi,%eax
+  800a3a:	e8 98 fb ff ff       	call   8005d7 <printnum>
+			break;
+  800a3f:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a42:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a45:	e9 8e fc ff ff       	jmp    8006d8 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800a4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a4d:	8b 00                	mov    (%eax),%eax
+  800a4f:	99                   	cltd
+  800a50:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800a53:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800a56:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800a59:	eb c4                	jmp    800a1f <vprintfmt+0x365>
+			putch('0', putdat);
+  800a5b:	83 ec 08             	sub    $0x8,%esp
+  800a5e:	53                   	push   %ebx
+  800a5f:	6a 30                	push   $0x30
+  800a61:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a63:	83 c4 08             	add    $0x8,%esp
+  800a66:	53                   	push   %ebx
+  800a67:	6a 78                	push   $0x78
+  800a69:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a6b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a6e:	8b 10                	mov    (%eax),%edx
+  800a70:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a75:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a78:	8d 40 04             	lea    0x4(%eax),%eax
+  800a7b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a7e:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800a83:	eb a3                	jmp    800a28 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800a85:	83 f9 01             	cmp    $0x1,%ecx
+  800a88:	7f 1b                	jg     800aa5 <vprintfmt+0x3eb>
+	else if (lflag)
+  800a8a:	85 c9                	test   %ecx,%ecx
+  800a8c:	74 2f                	je     800abd <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  800a8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a91:	8b 10                	mov    (%eax),%edx
+  800a93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a98:	8d 40 04             	lea    0x4(%eax),%eax
+  800a9b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a9e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800aa3:	eb 83                	jmp    800a28 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800aa5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa8:	8b 10                	mov    (%eax),%edx
+  800aaa:	8b 48 04             	mov    0x4(%eax),%ecx
+  800aad:	8d 40 08             	lea    0x8(%eax),%eax
+  800ab0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ab3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800ab8:	e9 6b ff ff ff       	jmp    800a28 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  800abd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac0:	8b 10                	mov    (%eax),%edx
+  800ac2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac7:	8d 40 04             	lea    0x4(%eax),%eax
+  800aca:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800acd:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800ad2:	e9 51 ff ff ff       	jmp    800a28 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  800ad7:	83 ec 08             	sub    $0x8,%esp
+  800ada:	53                   	push   %ebx
+  800adb:	6a 25                	push   $0x25
+  800add:	ff d6                	call   *%esi
+			break;
+  800adf:	83 c4 10             	add    $0x10,%esp
+  800ae2:	e9 5b ff ff ff       	jmp    800a42 <vprintfmt+0x388>
+			putch('%', putdat);
+  800ae7:	83 ec 08             	sub    $0x8,%esp
+  800aea:	53                   	push   %ebx
+  800aeb:	6a 25                	push   $0x25
+  800aed:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800aef:	83 c4 10             	add    $0x10,%esp
+  800af2:	89 f8                	mov    %edi,%eax
+  800af4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800af8:	74 05                	je     800aff <vprintfmt+0x445>
+  800afa:	83 e8 01             	sub    $0x1,%eax
+  800afd:	eb f5                	jmp    800af4 <vprintfmt+0x43a>
+  800aff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b02:	e9 3b ff ff ff       	jmp    800a42 <vprintfmt+0x388>
+
+00800b07 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	83 ec 18             	sub    $0x18,%esp
+  800b0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b10:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b13:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b16:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b1a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b1d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b24:	85 c0                	test   %eax,%eax
+  800b26:	74 26                	je     800b4e <vsnprintf+0x47>
+  800b28:	85 d2                	test   %edx,%edx
+  800b2a:	7e 22                	jle    800b4e <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b2c:	ff 75 14             	push   0x14(%ebp)
+  800b2f:	ff 75 10             	push   0x10(%ebp)
+  800b32:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b35:	50                   	push   %eax
+  800b36:	68 80 06 80 00       	push   $0x800680
+  800b3b:	e8 7a fb ff ff       	call   8006ba <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b40:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b43:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b49:	83 c4 10             	add    $0x10,%esp
+}
+  800b4c:	c9                   	leave
+  800b4d:	c3                   	ret
+		return -E_INVAL;
+  800b4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b53:	eb f7                	jmp    800b4c <vsnprintf+0x45>
+
+00800b55 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b55:	55                   	push   %ebp
+  800b56:	89 e5                	mov    %esp,%ebp
+  800b58:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b5b:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b5e:	50                   	push   %eax
+  800b5f:	ff 75 10             	push   0x10(%ebp)
+  800b62:	ff 75 0c             	push   0xc(%ebp)
+  800b65:	ff 75 08             	push   0x8(%ebp)
+  800b68:	e8 9a ff ff ff       	call   800b07 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b6d:	c9                   	leave
+  800b6e:	c3                   	ret
+
+00800b6f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b7a:	eb 03                	jmp    800b7f <strlen+0x10>
+		n++;
+  800b7c:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b7f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b83:	75 f7                	jne    800b7c <strlen+0xd>
+	return n;
+}
+  800b85:	5d                   	pop    %ebp
+  800b86:	c3                   	ret
+
+00800b87 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b87:	55                   	push   %ebp
+  800b88:	89 e5                	mov    %esp,%ebp
+  800b8a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b8d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b95:	eb 03                	jmp    800b9a <strnlen+0x13>
+		n++;
+  800b97:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b9a:	39 d0                	cmp    %edx,%eax
+  800b9c:	74 08                	je     800ba6 <strnlen+0x1f>
+  800b9e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ba2:	75 f3                	jne    800b97 <strnlen+0x10>
+  800ba4:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800ba6:	89 d0                	mov    %edx,%eax
+  800ba8:	5d                   	pop    %ebp
+  800ba9:	c3                   	ret
+
+00800baa <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800baa:	55                   	push   %ebp
+  800bab:	89 e5                	mov    %esp,%ebp
+  800bad:	53                   	push   %ebx
+  800bae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bb1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bbd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bc0:	83 c0 01             	add    $0x1,%eax
+  800bc3:	84 d2                	test   %dl,%dl
+  800bc5:	75 f2                	jne    800bb9 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bc7:	89 c8                	mov    %ecx,%eax
+  800bc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bcc:	c9                   	leave
+  800bcd:	c3                   	ret
+
+00800bce <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	53                   	push   %ebx
+  800bd2:	83 ec 10             	sub    $0x10,%esp
+  800bd5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800bd8:	53                   	push   %ebx
+  800bd9:	e8 91 ff ff ff       	call   800b6f <strlen>
+  800bde:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800be1:	ff 75 0c             	push   0xc(%ebp)
+  800be4:	01 d8                	add    %ebx,%eax
+  800be6:	50                   	push   %eax
+  800be7:	e8 be ff ff ff       	call   800baa <strcpy>
+	return dst;
+}
+  800bec:	89 d8                	mov    %ebx,%eax
+  800bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf1:	c9                   	leave
+  800bf2:	c3                   	ret
+
+00800bf3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bf3:	55                   	push   %ebp
+  800bf4:	89 e5                	mov    %esp,%ebp
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+  800bf8:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bfb:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800bfe:	89 f3                	mov    %esi,%ebx
+  800c00:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c03:	89 f0                	mov    %esi,%eax
+  800c05:	eb 0f                	jmp    800c16 <strncpy+0x23>
+		*dst++ = *src;
+  800c07:	83 c0 01             	add    $0x1,%eax
+  800c0a:	0f b6 0a             	movzbl (%edx),%ecx
+  800c0d:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c10:	80 f9 01             	cmp    $0x1,%cl
+  800c13:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c16:	39 d8                	cmp    %ebx,%eax
+  800c18:	75 ed                	jne    800c07 <strncpy+0x14>
+	}
+	return ret;
+}
+  800c1a:	89 f0                	mov    %esi,%eax
+  800c1c:	5b                   	pop    %ebx
+  800c1d:	5e                   	pop    %esi
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+
+00800c20 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c20:	55                   	push   %ebp
+  800c21:	89 e5                	mov    %esp,%ebp
+  800c23:	56                   	push   %esi
+  800c24:	53                   	push   %ebx
+  800c25:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2b:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c2e:	89 f0                	mov    %esi,%eax
+  800c30:	85 d2                	test   %edx,%edx
+  800c32:	74 21                	je     800c55 <strlcpy+0x35>
+  800c34:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c38:	89 f2                	mov    %esi,%edx
+  800c3a:	eb 09                	jmp    800c45 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c3c:	83 c1 01             	add    $0x1,%ecx
+  800c3f:	83 c2 01             	add    $0x1,%edx
+  800c42:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c45:	39 c2                	cmp    %eax,%edx
+  800c47:	74 09                	je     800c52 <strlcpy+0x32>
+  800c49:	0f b6 19             	movzbl (%ecx),%ebx
+  800c4c:	84 db                	test   %bl,%bl
+  800c4e:	75 ec                	jne    800c3c <strlcpy+0x1c>
+  800c50:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c52:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c55:	29 f0                	sub    %esi,%eax
+}
+  800c57:	5b                   	pop    %ebx
+  800c58:	5e                   	pop    %esi
+  800c59:	5d                   	pop    %ebp
+  800c5a:	c3                   	ret
+
+00800c5b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c5b:	55                   	push   %ebp
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c61:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c64:	eb 06                	jmp    800c6c <strcmp+0x11>
+		p++, q++;
+  800c66:	83 c1 01             	add    $0x1,%ecx
+  800c69:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c6c:	0f b6 01             	movzbl (%ecx),%eax
+  800c6f:	84 c0                	test   %al,%al
+  800c71:	74 04                	je     800c77 <strcmp+0x1c>
+  800c73:	3a 02                	cmp    (%edx),%al
+  800c75:	74 ef                	je     800c66 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c77:	0f b6 c0             	movzbl %al,%eax
+  800c7a:	0f b6 12             	movzbl (%edx),%edx
+  800c7d:	29 d0                	sub    %edx,%eax
+}
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+
+00800c81 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	53                   	push   %ebx
+  800c85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8b:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c8e:	eb 09                	jmp    800c99 <strncmp+0x18>
+		n--, p++, q++;
+  800c90:	83 ea 01             	sub    $0x1,%edx
+  800c93:	83 c0 01             	add    $0x1,%eax
+  800c96:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800c99:	85 d2                	test   %edx,%edx
+  800c9b:	74 18                	je     800cb5 <strncmp+0x34>
+  800c9d:	0f b6 18             	movzbl (%eax),%ebx
+  800ca0:	84 db                	test   %bl,%bl
+  800ca2:	74 04                	je     800ca8 <strncmp+0x27>
+  800ca4:	3a 19                	cmp    (%ecx),%bl
+  800ca6:	74 e8                	je     800c90 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800ca8:	0f b6 00             	movzbl (%eax),%eax
+  800cab:	0f b6 11             	movzbl (%ecx),%edx
+  800cae:	29 d0                	sub    %edx,%eax
+}
+  800cb0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cb3:	c9                   	leave
+  800cb4:	c3                   	ret
+		return 0;
+  800cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cba:	eb f4                	jmp    800cb0 <strncmp+0x2f>
+
+00800cbc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cc6:	eb 03                	jmp    800ccb <strchr+0xf>
+  800cc8:	83 c0 01             	add    $0x1,%eax
+  800ccb:	0f b6 10             	movzbl (%eax),%edx
+  800cce:	84 d2                	test   %dl,%dl
+  800cd0:	74 06                	je     800cd8 <strchr+0x1c>
+		if (*s == c)
+  800cd2:	38 ca                	cmp    %cl,%dl
+  800cd4:	75 f2                	jne    800cc8 <strchr+0xc>
+  800cd6:	eb 05                	jmp    800cdd <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cdd:	5d                   	pop    %ebp
+  800cde:	c3                   	ret
+
+00800cdf <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ce9:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cec:	38 ca                	cmp    %cl,%dl
+  800cee:	74 09                	je     800cf9 <strfind+0x1a>
+  800cf0:	84 d2                	test   %dl,%dl
+  800cf2:	74 05                	je     800cf9 <strfind+0x1a>
+	for (; *s; s++)
+  800cf4:	83 c0 01             	add    $0x1,%eax
+  800cf7:	eb f0                	jmp    800ce9 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800cf9:	5d                   	pop    %ebp
+  800cfa:	c3                   	ret
+
+00800cfb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cfb:	55                   	push   %ebp
+  800cfc:	89 e5                	mov    %esp,%ebp
+  800cfe:	57                   	push   %edi
+  800cff:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d02:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d05:	85 c9                	test   %ecx,%ecx
+  800d07:	74 20                	je     800d29 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d09:	89 f8                	mov    %edi,%eax
+  800d0b:	09 c8                	or     %ecx,%eax
+  800d0d:	a8 03                	test   $0x3,%al
+  800d0f:	75 12                	jne    800d23 <memset+0x28>
+		c &= 0xFF;
+  800d11:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d15:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d1b:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d1e:	fc                   	cld
+  800d1f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d21:	eb 06                	jmp    800d29 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d26:	fc                   	cld
+  800d27:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d29:	89 f8                	mov    %edi,%eax
+  800d2b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d2e:	c9                   	leave
+  800d2f:	c3                   	ret
+
+00800d30 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d30:	55                   	push   %ebp
+  800d31:	89 e5                	mov    %esp,%ebp
+  800d33:	57                   	push   %edi
+  800d34:	56                   	push   %esi
+  800d35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d38:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d3b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d3e:	39 c6                	cmp    %eax,%esi
+  800d40:	73 32                	jae    800d74 <memmove+0x44>
+  800d42:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d45:	39 d0                	cmp    %edx,%eax
+  800d47:	73 2b                	jae    800d74 <memmove+0x44>
+		s += n;
+		d += n;
+  800d49:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d4c:	89 d6                	mov    %edx,%esi
+  800d4e:	09 fe                	or     %edi,%esi
+  800d50:	09 ce                	or     %ecx,%esi
+  800d52:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d58:	75 0e                	jne    800d68 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d5a:	83 ef 04             	sub    $0x4,%edi
+  800d5d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d60:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d63:	fd                   	std
+  800d64:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d66:	eb 09                	jmp    800d71 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d68:	83 ef 01             	sub    $0x1,%edi
+  800d6b:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d6e:	fd                   	std
+  800d6f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d71:	fc                   	cld
+  800d72:	eb 1a                	jmp    800d8e <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d74:	89 f2                	mov    %esi,%edx
+  800d76:	09 c2                	or     %eax,%edx
+  800d78:	09 ca                	or     %ecx,%edx
+  800d7a:	f6 c2 03             	test   $0x3,%dl
+  800d7d:	75 0a                	jne    800d89 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d7f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d82:	89 c7                	mov    %eax,%edi
+  800d84:	fc                   	cld
+  800d85:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d87:	eb 05                	jmp    800d8e <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d89:	89 c7                	mov    %eax,%edi
+  800d8b:	fc                   	cld
+  800d8c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d8e:	5e                   	pop    %esi
+  800d8f:	5f                   	pop    %edi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+
+00800d92 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d98:	ff 75 10             	push   0x10(%ebp)
+  800d9b:	ff 75 0c             	push   0xc(%ebp)
+  800d9e:	ff 75 08             	push   0x8(%ebp)
+  800da1:	e8 8a ff ff ff       	call   800d30 <memmove>
+}
+  800da6:	c9                   	leave
+  800da7:	c3                   	ret
+
+00800da8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800da8:	55                   	push   %ebp
+  800da9:	89 e5                	mov    %esp,%ebp
+  800dab:	56                   	push   %esi
+  800dac:	53                   	push   %ebx
+  800dad:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800db3:	89 c6                	mov    %eax,%esi
+  800db5:	03 75 10             	add    0x10(%ebp),%esi
+  800db8:	eb 06                	jmp    800dc0 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800dba:	83 c0 01             	add    $0x1,%eax
+  800dbd:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800dc0:	39 f0                	cmp    %esi,%eax
+  800dc2:	74 14                	je     800dd8 <memcmp+0x30>
+		if (*s1 != *s2)
+  800dc4:	0f b6 08             	movzbl (%eax),%ecx
+  800dc7:	0f b6 1a             	movzbl (%edx),%ebx
+  800dca:	38 d9                	cmp    %bl,%cl
+  800dcc:	74 ec                	je     800dba <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800dce:	0f b6 c1             	movzbl %cl,%eax
+  800dd1:	0f b6 db             	movzbl %bl,%ebx
+  800dd4:	29 d8                	sub    %ebx,%eax
+  800dd6:	eb 05                	jmp    800ddd <memcmp+0x35>
+	}
+
+	return 0;
+  800dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ddd:	5b                   	pop    %ebx
+  800dde:	5e                   	pop    %esi
+  800ddf:	5d                   	pop    %ebp
+  800de0:	c3                   	ret
+
+00800de1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800de1:	55                   	push   %ebp
+  800de2:	89 e5                	mov    %esp,%ebp
+  800de4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800de7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800dea:	89 c2                	mov    %eax,%edx
+  800dec:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800def:	eb 03                	jmp    800df4 <memfind+0x13>
+  800df1:	83 c0 01             	add    $0x1,%eax
+  800df4:	39 d0                	cmp    %edx,%eax
+  800df6:	73 04                	jae    800dfc <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800df8:	38 08                	cmp    %cl,(%eax)
+  800dfa:	75 f5                	jne    800df1 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800dfc:	5d                   	pop    %ebp
+  800dfd:	c3                   	ret
+
+00800dfe <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	57                   	push   %edi
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  800e04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e0a:	eb 03                	jmp    800e0f <strtol+0x11>
+		s++;
+  800e0c:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e0f:	0f b6 02             	movzbl (%edx),%eax
+  800e12:	3c 20                	cmp    $0x20,%al
+  800e14:	74 f6                	je     800e0c <strtol+0xe>
+  800e16:	3c 09                	cmp    $0x9,%al
+  800e18:	74 f2                	je     800e0c <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e1a:	3c 2b                	cmp    $0x2b,%al
+  800e1c:	74 2a                	je     800e48 <strtol+0x4a>
+	int neg = 0;
+  800e1e:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e23:	3c 2d                	cmp    $0x2d,%al
+  800e25:	74 2b                	je     800e52 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e27:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e2d:	75 0f                	jne    800e3e <strtol+0x40>
+  800e2f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e32:	74 28                	je     800e5c <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e34:	85 db                	test   %ebx,%ebx
+  800e36:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e3b:	0f 44 d8             	cmove  %eax,%ebx
+  800e3e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e43:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e46:	eb 46                	jmp    800e8e <strtol+0x90>
+		s++;
+  800e48:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e50:	eb d5                	jmp    800e27 <strtol+0x29>
+		s++, neg = 1;
+  800e52:	83 c2 01             	add    $0x1,%edx
+  800e55:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e5a:	eb cb                	jmp    800e27 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e5c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e60:	74 0e                	je     800e70 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e62:	85 db                	test   %ebx,%ebx
+  800e64:	75 d8                	jne    800e3e <strtol+0x40>
+		s++, base = 8;
+  800e66:	83 c2 01             	add    $0x1,%edx
+  800e69:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e6e:	eb ce                	jmp    800e3e <strtol+0x40>
+		s += 2, base = 16;
+  800e70:	83 c2 02             	add    $0x2,%edx
+  800e73:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e78:	eb c4                	jmp    800e3e <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e7a:	0f be c0             	movsbl %al,%eax
+  800e7d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e80:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e83:	7d 3a                	jge    800ebf <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e85:	83 c2 01             	add    $0x1,%edx
+  800e88:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e8c:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e8e:	0f b6 02             	movzbl (%edx),%eax
+  800e91:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e94:	89 f3                	mov    %esi,%ebx
+  800e96:	80 fb 09             	cmp    $0x9,%bl
+  800e99:	76 df                	jbe    800e7a <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800e9b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e9e:	89 f3                	mov    %esi,%ebx
+  800ea0:	80 fb 19             	cmp    $0x19,%bl
+  800ea3:	77 08                	ja     800ead <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800ea5:	0f be c0             	movsbl %al,%eax
+  800ea8:	83 e8 57             	sub    $0x57,%eax
+  800eab:	eb d3                	jmp    800e80 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800ead:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800eb0:	89 f3                	mov    %esi,%ebx
+  800eb2:	80 fb 19             	cmp    $0x19,%bl
+  800eb5:	77 08                	ja     800ebf <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800eb7:	0f be c0             	movsbl %al,%eax
+  800eba:	83 e8 37             	sub    $0x37,%eax
+  800ebd:	eb c1                	jmp    800e80 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ebf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ec3:	74 05                	je     800eca <strtol+0xcc>
+		*endptr = (char *) s;
+  800ec5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ec8:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800eca:	89 c8                	mov    %ecx,%eax
+  800ecc:	f7 d8                	neg    %eax
+  800ece:	85 ff                	test   %edi,%edi
+  800ed0:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ed3:	89 c8                	mov    %ecx,%eax
+  800ed5:	5b                   	pop    %ebx
+  800ed6:	5e                   	pop    %esi
+  800ed7:	5f                   	pop    %edi
+  800ed8:	5d                   	pop    %ebp
+  800ed9:	c3                   	ret
+
+00800eda <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+  800ee3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ee6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ee9:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800eec:	85 ff                	test   %edi,%edi
+  800eee:	74 16                	je     800f06 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800ef0:	83 ec 04             	sub    $0x4,%esp
+  800ef3:	56                   	push   %esi
+  800ef4:	6a 00                	push   $0x0
+  800ef6:	53                   	push   %ebx
+  800ef7:	e8 02 ff ff ff       	call   800dfe <strtol>
+  800efc:	89 07                	mov    %eax,(%edi)
+  800efe:	83 c4 10             	add    $0x10,%esp
+  800f01:	eb 03                	jmp    800f06 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800f03:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800f06:	0f b6 03             	movzbl (%ebx),%eax
+  800f09:	3c 20                	cmp    $0x20,%al
+  800f0b:	74 f6                	je     800f03 <strisl+0x29>
+  800f0d:	3c 09                	cmp    $0x9,%al
+  800f0f:	74 f2                	je     800f03 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f11:	3c 2b                	cmp    $0x2b,%al
+  800f13:	74 23                	je     800f38 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800f15:	3c 2d                	cmp    $0x2d,%al
+  800f17:	0f 94 c0             	sete   %al
+  800f1a:	0f b6 c0             	movzbl %al,%eax
+  800f1d:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f1f:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800f25:	75 41                	jne    800f68 <strisl+0x8e>
+  800f27:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800f2a:	74 11                	je     800f3d <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f2c:	85 f6                	test   %esi,%esi
+  800f2e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f33:	0f 44 f0             	cmove  %eax,%esi
+  800f36:	eb 30                	jmp    800f68 <strisl+0x8e>
+		s++;
+  800f38:	83 c3 01             	add    $0x1,%ebx
+  800f3b:	eb e2                	jmp    800f1f <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f3d:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800f41:	74 0e                	je     800f51 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800f43:	85 f6                	test   %esi,%esi
+  800f45:	75 21                	jne    800f68 <strisl+0x8e>
+		s++, base = 8;
+  800f47:	83 c3 01             	add    $0x1,%ebx
+  800f4a:	be 08 00 00 00       	mov    $0x8,%esi
+  800f4f:	eb 17                	jmp    800f68 <strisl+0x8e>
+		s += 2, base = 16;
+  800f51:	83 c3 02             	add    $0x2,%ebx
+  800f54:	be 10 00 00 00       	mov    $0x10,%esi
+  800f59:	eb 0d                	jmp    800f68 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800f5b:	0f be c0             	movsbl %al,%eax
+  800f5e:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800f61:	39 f0                	cmp    %esi,%eax
+  800f63:	7d 38                	jge    800f9d <strisl+0xc3>
+			return 0;
+		s++;
+  800f65:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800f68:	0f b6 03             	movzbl (%ebx),%eax
+  800f6b:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800f6e:	80 fa 09             	cmp    $0x9,%dl
+  800f71:	76 e8                	jbe    800f5b <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800f73:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800f76:	80 fa 19             	cmp    $0x19,%dl
+  800f79:	77 08                	ja     800f83 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800f7b:	0f be c0             	movsbl %al,%eax
+  800f7e:	83 e8 57             	sub    $0x57,%eax
+  800f81:	eb de                	jmp    800f61 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f83:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800f86:	80 fa 19             	cmp    $0x19,%dl
+  800f89:	77 08                	ja     800f93 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800f8b:	0f be c0             	movsbl %al,%eax
+  800f8e:	83 e8 37             	sub    $0x37,%eax
+  800f91:	eb ce                	jmp    800f61 <strisl+0x87>
+		else if (!*s)
+  800f93:	84 c0                	test   %al,%al
+  800f95:	0f 94 c0             	sete   %al
+  800f98:	0f b6 c0             	movzbl %al,%eax
+  800f9b:	eb 05                	jmp    800fa2 <strisl+0xc8>
+			return 0;
+  800f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800fa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa5:	5b                   	pop    %ebx
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+
+00800faa <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	83 ec 10             	sub    $0x10,%esp
+  800fb0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800fb3:	89 c8                	mov    %ecx,%eax
+  800fb5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800fba:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800fbd:	eb 0b                	jmp    800fca <touch_mem+0x20>
+		c = *(char *)page;
+  800fbf:	0f b6 10             	movzbl (%eax),%edx
+  800fc2:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800fc5:	05 00 10 00 00       	add    $0x1000,%eax
+  800fca:	39 c8                	cmp    %ecx,%eax
+  800fcc:	72 f1                	jb     800fbf <touch_mem+0x15>
+}
+  800fce:	c9                   	leave
+  800fcf:	c3                   	ret
+
+00800fd0 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+	touch_mem(s, len);
+  800fd6:	ff 75 0c             	push   0xc(%ebp)
+  800fd9:	ff 75 08             	push   0x8(%ebp)
+  800fdc:	e8 c9 ff ff ff       	call   800faa <touch_mem>
+	asm volatile("int %1\n"
+  800fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fec:	89 c3                	mov    %eax,%ebx
+  800fee:	89 c7                	mov    %eax,%edi
+  800ff0:	89 c6                	mov    %eax,%esi
+  800ff2:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ff4:	83 c4 08             	add    $0x8,%esp
+  800ff7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffa:	5b                   	pop    %ebx
+  800ffb:	5e                   	pop    %esi
+  800ffc:	5f                   	pop    %edi
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	c3                   	ret
+
+00800fff <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	56                   	push   %esi
+  801004:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801005:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80100f:	89 d1                	mov    %edx,%ecx
+  801011:	89 d3                	mov    %edx,%ebx
+  801013:	89 d7                	mov    %edx,%edi
+  801015:	89 d6                	mov    %edx,%esi
+  801017:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801019:	5b                   	pop    %ebx
+  80101a:	5e                   	pop    %esi
+  80101b:	5f                   	pop    %edi
+  80101c:	5d                   	pop    %ebp
+  80101d:	c3                   	ret
+
+0080101e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80101e:	55                   	push   %ebp
+  80101f:	89 e5                	mov    %esp,%ebp
+  801021:	57                   	push   %edi
+  801022:	56                   	push   %esi
+  801023:	53                   	push   %ebx
+  801024:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801027:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80102c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801034:	89 cb                	mov    %ecx,%ebx
+  801036:	89 cf                	mov    %ecx,%edi
+  801038:	89 ce                	mov    %ecx,%esi
+  80103a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80103c:	85 c0                	test   %eax,%eax
+  80103e:	7f 08                	jg     801048 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801040:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801043:	5b                   	pop    %ebx
+  801044:	5e                   	pop    %esi
+  801045:	5f                   	pop    %edi
+  801046:	5d                   	pop    %ebp
+  801047:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801048:	83 ec 0c             	sub    $0xc,%esp
+  80104b:	50                   	push   %eax
+  80104c:	6a 03                	push   $0x3
+  80104e:	68 0b 61 80 00       	push   $0x80610b
+  801053:	6a 23                	push   $0x23
+  801055:	68 28 61 80 00       	push   $0x806128
+  80105a:	e8 89 f4 ff ff       	call   8004e8 <_panic>
+
+0080105f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80105f:	55                   	push   %ebp
+  801060:	89 e5                	mov    %esp,%ebp
+  801062:	57                   	push   %edi
+  801063:	56                   	push   %esi
+  801064:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801065:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80106f:	89 d1                	mov    %edx,%ecx
+  801071:	89 d3                	mov    %edx,%ebx
+  801073:	89 d7                	mov    %edx,%edi
+  801075:	89 d6                	mov    %edx,%esi
+  801077:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+
+0080107e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	57                   	push   %edi
+  801082:	56                   	push   %esi
+  801083:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801084:	ba 00 00 00 00       	mov    $0x0,%edx
+  801089:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80108e:	89 d1                	mov    %edx,%ecx
+  801090:	89 d3                	mov    %edx,%ebx
+  801092:	89 d7                	mov    %edx,%edi
+  801094:	89 d6                	mov    %edx,%esi
+  801096:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801098:	5b                   	pop    %ebx
+  801099:	5e                   	pop    %esi
+  80109a:	5f                   	pop    %edi
+  80109b:	5d                   	pop    %ebp
+  80109c:	c3                   	ret
+
+0080109d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  80109d:	55                   	push   %ebp
+  80109e:	89 e5                	mov    %esp,%ebp
+  8010a0:	57                   	push   %edi
+  8010a1:	56                   	push   %esi
+  8010a2:	53                   	push   %ebx
+  8010a3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b1:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b9:	89 f7                	mov    %esi,%edi
+  8010bb:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010bd:	85 c0                	test   %eax,%eax
+  8010bf:	7f 08                	jg     8010c9 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  8010c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c4:	5b                   	pop    %ebx
+  8010c5:	5e                   	pop    %esi
+  8010c6:	5f                   	pop    %edi
+  8010c7:	5d                   	pop    %ebp
+  8010c8:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c9:	83 ec 0c             	sub    $0xc,%esp
+  8010cc:	50                   	push   %eax
+  8010cd:	6a 04                	push   $0x4
+  8010cf:	68 0b 61 80 00       	push   $0x80610b
+  8010d4:	6a 23                	push   $0x23
+  8010d6:	68 28 61 80 00       	push   $0x806128
+  8010db:	e8 08 f4 ff ff       	call   8004e8 <_panic>
+
+008010e0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010e0:	55                   	push   %ebp
+  8010e1:	89 e5                	mov    %esp,%ebp
+  8010e3:	57                   	push   %edi
+  8010e4:	56                   	push   %esi
+  8010e5:	53                   	push   %ebx
+  8010e6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ef:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010fa:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010fd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ff:	85 c0                	test   %eax,%eax
+  801101:	7f 08                	jg     80110b <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  801103:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801106:	5b                   	pop    %ebx
+  801107:	5e                   	pop    %esi
+  801108:	5f                   	pop    %edi
+  801109:	5d                   	pop    %ebp
+  80110a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80110b:	83 ec 0c             	sub    $0xc,%esp
+  80110e:	50                   	push   %eax
+  80110f:	6a 05                	push   $0x5
+  801111:	68 0b 61 80 00       	push   $0x80610b
+  801116:	6a 23                	push   $0x23
+  801118:	68 28 61 80 00       	push   $0x806128
+  80111d:	e8 c6 f3 ff ff       	call   8004e8 <_panic>
+
+00801122 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	57                   	push   %edi
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+  801128:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80112b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801136:	b8 06 00 00 00       	mov    $0x6,%eax
+  80113b:	89 df                	mov    %ebx,%edi
+  80113d:	89 de                	mov    %ebx,%esi
+  80113f:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801141:	85 c0                	test   %eax,%eax
+  801143:	7f 08                	jg     80114d <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801148:	5b                   	pop    %ebx
+  801149:	5e                   	pop    %esi
+  80114a:	5f                   	pop    %edi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80114d:	83 ec 0c             	sub    $0xc,%esp
+  801150:	50                   	push   %eax
+  801151:	6a 06                	push   $0x6
+  801153:	68 0b 61 80 00       	push   $0x80610b
+  801158:	6a 23                	push   $0x23
+  80115a:	68 28 61 80 00       	push   $0x806128
+  80115f:	e8 84 f3 ff ff       	call   8004e8 <_panic>
+
+00801164 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  80116a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80116d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801172:	8b 55 08             	mov    0x8(%ebp),%edx
+  801175:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801178:	b8 18 00 00 00       	mov    $0x18,%eax
+  80117d:	89 df                	mov    %ebx,%edi
+  80117f:	89 de                	mov    %ebx,%esi
+  801181:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801183:	85 c0                	test   %eax,%eax
+  801185:	7f 08                	jg     80118f <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  801187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80118a:	5b                   	pop    %ebx
+  80118b:	5e                   	pop    %esi
+  80118c:	5f                   	pop    %edi
+  80118d:	5d                   	pop    %ebp
+  80118e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80118f:	83 ec 0c             	sub    $0xc,%esp
+  801192:	50                   	push   %eax
+  801193:	6a 18                	push   $0x18
+  801195:	68 0b 61 80 00       	push   $0x80610b
+  80119a:	6a 23                	push   $0x23
+  80119c:	68 28 61 80 00       	push   $0x806128
+  8011a1:	e8 42 f3 ff ff       	call   8004e8 <_panic>
+
+008011a6 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	57                   	push   %edi
+  8011aa:	56                   	push   %esi
+  8011ab:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8011b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b7:	b8 19 00 00 00       	mov    $0x19,%eax
+  8011bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011bf:	89 f7                	mov    %esi,%edi
+  8011c1:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  8011c3:	5b                   	pop    %ebx
+  8011c4:	5e                   	pop    %esi
+  8011c5:	5f                   	pop    %edi
+  8011c6:	5d                   	pop    %ebp
+  8011c7:	c3                   	ret
+
+008011c8 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	57                   	push   %edi
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011de:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e4:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  8011e6:	5b                   	pop    %ebx
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5f                   	pop    %edi
+  8011e9:	5d                   	pop    %ebp
+  8011ea:	c3                   	ret
+
+008011eb <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  8011eb:	55                   	push   %ebp
+  8011ec:	89 e5                	mov    %esp,%ebp
+  8011ee:	57                   	push   %edi
+  8011ef:	56                   	push   %esi
+  8011f0:	53                   	push   %ebx
+  8011f1:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  8011f4:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8011f7:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8011fd:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801206:	b8 10 00 00 00       	mov    $0x10,%eax
+  80120b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801211:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801213:	85 c0                	test   %eax,%eax
+  801215:	7f 08                	jg     80121f <sys_page_map_range+0x34>
+}
+  801217:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80121a:	5b                   	pop    %ebx
+  80121b:	5e                   	pop    %esi
+  80121c:	5f                   	pop    %edi
+  80121d:	5d                   	pop    %ebp
+  80121e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80121f:	83 ec 0c             	sub    $0xc,%esp
+  801222:	50                   	push   %eax
+  801223:	6a 10                	push   $0x10
+  801225:	68 0b 61 80 00       	push   $0x80610b
+  80122a:	6a 23                	push   $0x23
+  80122c:	68 28 61 80 00       	push   $0x806128
+  801231:	e8 b2 f2 ff ff       	call   8004e8 <_panic>
+
+00801236 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  801236:	55                   	push   %ebp
+  801237:	89 e5                	mov    %esp,%ebp
+  801239:	57                   	push   %edi
+  80123a:	56                   	push   %esi
+  80123b:	53                   	push   %ebx
+  80123c:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80123f:	be 00 00 00 00       	mov    $0x0,%esi
+  801244:	8b 55 08             	mov    0x8(%ebp),%edx
+  801247:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124a:	b8 11 00 00 00       	mov    $0x11,%eax
+  80124f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801252:	89 f7                	mov    %esi,%edi
+  801254:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801256:	85 c0                	test   %eax,%eax
+  801258:	7f 08                	jg     801262 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80125a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80125d:	5b                   	pop    %ebx
+  80125e:	5e                   	pop    %esi
+  80125f:	5f                   	pop    %edi
+  801260:	5d                   	pop    %ebp
+  801261:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801262:	83 ec 0c             	sub    $0xc,%esp
+  801265:	50                   	push   %eax
+  801266:	6a 11                	push   $0x11
+  801268:	68 0b 61 80 00       	push   $0x80610b
+  80126d:	6a 23                	push   $0x23
+  80126f:	68 28 61 80 00       	push   $0x806128
+  801274:	e8 6f f2 ff ff       	call   8004e8 <_panic>
+
+00801279 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  801279:	55                   	push   %ebp
+  80127a:	89 e5                	mov    %esp,%ebp
+  80127c:	57                   	push   %edi
+  80127d:	56                   	push   %esi
+  80127e:	53                   	push   %ebx
+  80127f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801282:	be 00 00 00 00       	mov    $0x0,%esi
+  801287:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80128d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  801292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801295:	89 f7                	mov    %esi,%edi
+  801297:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801299:	85 c0                	test   %eax,%eax
+  80129b:	7f 08                	jg     8012a5 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  80129d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a0:	5b                   	pop    %ebx
+  8012a1:	5e                   	pop    %esi
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012a5:	83 ec 0c             	sub    $0xc,%esp
+  8012a8:	50                   	push   %eax
+  8012a9:	6a 1b                	push   $0x1b
+  8012ab:	68 0b 61 80 00       	push   $0x80610b
+  8012b0:	6a 23                	push   $0x23
+  8012b2:	68 28 61 80 00       	push   $0x806128
+  8012b7:	e8 2c f2 ff ff       	call   8004e8 <_panic>
+
+008012bc <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  8012bc:	55                   	push   %ebp
+  8012bd:	89 e5                	mov    %esp,%ebp
+  8012bf:	57                   	push   %edi
+  8012c0:	56                   	push   %esi
+  8012c1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8012c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012cc:	89 d1                	mov    %edx,%ecx
+  8012ce:	89 d3                	mov    %edx,%ebx
+  8012d0:	89 d7                	mov    %edx,%edi
+  8012d2:	89 d6                	mov    %edx,%esi
+  8012d4:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012d6:	5b                   	pop    %ebx
+  8012d7:	5e                   	pop    %esi
+  8012d8:	5f                   	pop    %edi
+  8012d9:	5d                   	pop    %ebp
+  8012da:	c3                   	ret
+
+008012db <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8012db:	55                   	push   %ebp
+  8012dc:	89 e5                	mov    %esp,%ebp
+  8012de:	57                   	push   %edi
+  8012df:	56                   	push   %esi
+  8012e0:	53                   	push   %ebx
+  8012e1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ef:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012f4:	89 df                	mov    %ebx,%edi
+  8012f6:	89 de                	mov    %ebx,%esi
+  8012f8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012fa:	85 c0                	test   %eax,%eax
+  8012fc:	7f 08                	jg     801306 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8012fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5f                   	pop    %edi
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801306:	83 ec 0c             	sub    $0xc,%esp
+  801309:	50                   	push   %eax
+  80130a:	6a 08                	push   $0x8
+  80130c:	68 0b 61 80 00       	push   $0x80610b
+  801311:	6a 23                	push   $0x23
+  801313:	68 28 61 80 00       	push   $0x806128
+  801318:	e8 cb f1 ff ff       	call   8004e8 <_panic>
+
+0080131d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80131d:	55                   	push   %ebp
+  80131e:	89 e5                	mov    %esp,%ebp
+  801320:	57                   	push   %edi
+  801321:	56                   	push   %esi
+  801322:	53                   	push   %ebx
+  801323:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  801326:	6a 44                	push   $0x44
+  801328:	ff 75 0c             	push   0xc(%ebp)
+  80132b:	e8 7a fc ff ff       	call   800faa <touch_mem>
+	asm volatile("int %1\n"
+  801330:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801335:	8b 55 08             	mov    0x8(%ebp),%edx
+  801338:	b8 09 00 00 00       	mov    $0x9,%eax
+  80133d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801340:	89 df                	mov    %ebx,%edi
+  801342:	89 de                	mov    %ebx,%esi
+  801344:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801346:	83 c4 08             	add    $0x8,%esp
+  801349:	85 c0                	test   %eax,%eax
+  80134b:	7f 08                	jg     801355 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  80134d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801350:	5b                   	pop    %ebx
+  801351:	5e                   	pop    %esi
+  801352:	5f                   	pop    %edi
+  801353:	5d                   	pop    %ebp
+  801354:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801355:	83 ec 0c             	sub    $0xc,%esp
+  801358:	50                   	push   %eax
+  801359:	6a 09                	push   $0x9
+  80135b:	68 0b 61 80 00       	push   $0x80610b
+  801360:	6a 23                	push   $0x23
+  801362:	68 28 61 80 00       	push   $0x806128
+  801367:	e8 7c f1 ff ff       	call   8004e8 <_panic>
+
+0080136c <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  80136c:	55                   	push   %ebp
+  80136d:	89 e5                	mov    %esp,%ebp
+  80136f:	57                   	push   %edi
+  801370:	56                   	push   %esi
+  801371:	53                   	push   %ebx
+  801372:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801375:	be 00 00 00 00       	mov    $0x0,%esi
+  80137a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801380:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  801385:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801388:	89 f7                	mov    %esi,%edi
+  80138a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	7f 08                	jg     801398 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  801390:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801393:	5b                   	pop    %ebx
+  801394:	5e                   	pop    %esi
+  801395:	5f                   	pop    %edi
+  801396:	5d                   	pop    %ebp
+  801397:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801398:	83 ec 0c             	sub    $0xc,%esp
+  80139b:	50                   	push   %eax
+  80139c:	6a 1a                	push   $0x1a
+  80139e:	68 0b 61 80 00       	push   $0x80610b
+  8013a3:	6a 23                	push   $0x23
+  8013a5:	68 28 61 80 00       	push   $0x806128
+  8013aa:	e8 39 f1 ff ff       	call   8004e8 <_panic>
+
+008013af <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8013af:	55                   	push   %ebp
+  8013b0:	89 e5                	mov    %esp,%ebp
+  8013b2:	57                   	push   %edi
+  8013b3:	56                   	push   %esi
+  8013b4:	53                   	push   %ebx
+  8013b5:	83 ec 0c             	sub    $0xc,%esp
+  8013b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8013bb:	89 d8                	mov    %ebx,%eax
+  8013bd:	c1 e0 05             	shl    $0x5,%eax
+  8013c0:	50                   	push   %eax
+  8013c1:	ff 75 0c             	push   0xc(%ebp)
+  8013c4:	e8 e1 fb ff ff       	call   800faa <touch_mem>
+	asm volatile("int %1\n"
+  8013c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8013d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013d9:	89 f7                	mov    %esi,%edi
+  8013db:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8013dd:	83 c4 08             	add    $0x8,%esp
+  8013e0:	85 c0                	test   %eax,%eax
+  8013e2:	7f 08                	jg     8013ec <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8013e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013e7:	5b                   	pop    %ebx
+  8013e8:	5e                   	pop    %esi
+  8013e9:	5f                   	pop    %edi
+  8013ea:	5d                   	pop    %ebp
+  8013eb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8013ec:	83 ec 0c             	sub    $0xc,%esp
+  8013ef:	50                   	push   %eax
+  8013f0:	6a 13                	push   $0x13
+  8013f2:	68 0b 61 80 00       	push   $0x80610b
+  8013f7:	6a 23                	push   $0x23
+  8013f9:	68 28 61 80 00       	push   $0x806128
+  8013fe:	e8 e5 f0 ff ff       	call   8004e8 <_panic>
+
+00801403 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801403:	55                   	push   %ebp
+  801404:	89 e5                	mov    %esp,%ebp
+  801406:	57                   	push   %edi
+  801407:	56                   	push   %esi
+  801408:	53                   	push   %ebx
+  801409:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80140c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801411:	8b 55 08             	mov    0x8(%ebp),%edx
+  801414:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801417:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80141c:	89 df                	mov    %ebx,%edi
+  80141e:	89 de                	mov    %ebx,%esi
+  801420:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801422:	85 c0                	test   %eax,%eax
+  801424:	7f 08                	jg     80142e <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  801426:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801429:	5b                   	pop    %ebx
+  80142a:	5e                   	pop    %esi
+  80142b:	5f                   	pop    %edi
+  80142c:	5d                   	pop    %ebp
+  80142d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80142e:	83 ec 0c             	sub    $0xc,%esp
+  801431:	50                   	push   %eax
+  801432:	6a 0a                	push   $0xa
+  801434:	68 0b 61 80 00       	push   $0x80610b
+  801439:	6a 23                	push   $0x23
+  80143b:	68 28 61 80 00       	push   $0x806128
+  801440:	e8 a3 f0 ff ff       	call   8004e8 <_panic>
+
+00801445 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	57                   	push   %edi
+  801449:	56                   	push   %esi
+  80144a:	53                   	push   %ebx
+  80144b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80144e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801454:	76 1d                	jbe    801473 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801456:	8b 55 08             	mov    0x8(%ebp),%edx
+  801459:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80145c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801461:	be 01 00 00 00       	mov    $0x1,%esi
+  801466:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801469:	cd 30                	int    $0x30
+}
+  80146b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146e:	5b                   	pop    %ebx
+  80146f:	5e                   	pop    %esi
+  801470:	5f                   	pop    %edi
+  801471:	5d                   	pop    %ebp
+  801472:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801473:	68 00 10 00 00       	push   $0x1000
+  801478:	53                   	push   %ebx
+  801479:	e8 2c fb ff ff       	call   800faa <touch_mem>
+  80147e:	83 c4 08             	add    $0x8,%esp
+  801481:	eb d3                	jmp    801456 <sys_ipc_send+0x11>
+
+00801483 <sys_ipc_send_pages>:
+{
+  801483:	55                   	push   %ebp
+  801484:	89 e5                	mov    %esp,%ebp
+  801486:	57                   	push   %edi
+  801487:	56                   	push   %esi
+  801488:	53                   	push   %ebx
+  801489:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80148c:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80148f:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801495:	76 18                	jbe    8014af <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801497:	8b 55 08             	mov    0x8(%ebp),%edx
+  80149a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80149d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014a2:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8014a5:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8014a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014aa:	5b                   	pop    %ebx
+  8014ab:	5e                   	pop    %esi
+  8014ac:	5f                   	pop    %edi
+  8014ad:	5d                   	pop    %ebp
+  8014ae:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8014af:	89 f0                	mov    %esi,%eax
+  8014b1:	c1 e0 0c             	shl    $0xc,%eax
+  8014b4:	50                   	push   %eax
+  8014b5:	53                   	push   %ebx
+  8014b6:	e8 ef fa ff ff       	call   800faa <touch_mem>
+  8014bb:	83 c4 08             	add    $0x8,%esp
+  8014be:	eb d7                	jmp    801497 <sys_ipc_send_pages+0x14>
+
+008014c0 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8014c0:	55                   	push   %ebp
+  8014c1:	89 e5                	mov    %esp,%ebp
+  8014c3:	57                   	push   %edi
+  8014c4:	56                   	push   %esi
+  8014c5:	53                   	push   %ebx
+  8014c6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8014c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014d9:	89 df                	mov    %ebx,%edi
+  8014db:	89 de                	mov    %ebx,%esi
+  8014dd:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8014df:	85 c0                	test   %eax,%eax
+  8014e1:	7f 08                	jg     8014eb <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8014e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e6:	5b                   	pop    %ebx
+  8014e7:	5e                   	pop    %esi
+  8014e8:	5f                   	pop    %edi
+  8014e9:	5d                   	pop    %ebp
+  8014ea:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014eb:	83 ec 0c             	sub    $0xc,%esp
+  8014ee:	50                   	push   %eax
+  8014ef:	6a 0d                	push   $0xd
+  8014f1:	68 0b 61 80 00       	push   $0x80610b
+  8014f6:	6a 23                	push   $0x23
+  8014f8:	68 28 61 80 00       	push   $0x806128
+  8014fd:	e8 e6 ef ff ff       	call   8004e8 <_panic>
+
+00801502 <sys_ipc_recv>:
+{
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  801508:	6a 01                	push   $0x1
+  80150a:	ff 75 08             	push   0x8(%ebp)
+  80150d:	e8 ae ff ff ff       	call   8014c0 <sys_ipc_recv_pages>
+}
+  801512:	c9                   	leave
+  801513:	c3                   	ret
+
+00801514 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801514:	55                   	push   %ebp
+  801515:	89 e5                	mov    %esp,%ebp
+  801517:	57                   	push   %edi
+  801518:	56                   	push   %esi
+  801519:	53                   	push   %ebx
+  80151a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801520:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801523:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801529:	77 04                	ja     80152f <sys_ipc_call+0x1b>
+  80152b:	85 f6                	test   %esi,%esi
+  80152d:	75 15                	jne    801544 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  80152f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801532:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801535:	b8 14 00 00 00       	mov    $0x14,%eax
+  80153a:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80153c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80153f:	5b                   	pop    %ebx
+  801540:	5e                   	pop    %esi
+  801541:	5f                   	pop    %edi
+  801542:	5d                   	pop    %ebp
+  801543:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801544:	89 f8                	mov    %edi,%eax
+  801546:	c1 e0 0c             	shl    $0xc,%eax
+  801549:	50                   	push   %eax
+  80154a:	53                   	push   %ebx
+  80154b:	e8 5a fa ff ff       	call   800faa <touch_mem>
+  801550:	83 c4 08             	add    $0x8,%esp
+  801553:	eb da                	jmp    80152f <sys_ipc_call+0x1b>
+
+00801555 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801555:	55                   	push   %ebp
+  801556:	89 e5                	mov    %esp,%ebp
+  801558:	57                   	push   %edi
+  801559:	56                   	push   %esi
+  80155a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80155b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80155e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801561:	b8 15 00 00 00       	mov    $0x15,%eax
+  801566:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801569:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80156c:	8b 75 18             	mov    0x18(%ebp),%esi
+  80156f:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801571:	5b                   	pop    %ebx
+  801572:	5e                   	pop    %esi
+  801573:	5f                   	pop    %edi
+  801574:	5d                   	pop    %ebp
+  801575:	c3                   	ret
+
+00801576 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	57                   	push   %edi
+  80157a:	56                   	push   %esi
+  80157b:	53                   	push   %ebx
+  80157c:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80157f:	6a 04                	push   $0x4
+  801581:	ff 75 08             	push   0x8(%ebp)
+  801584:	e8 21 fa ff ff       	call   800faa <touch_mem>
+	asm volatile("int %1\n"
+  801589:	be 00 00 00 00       	mov    $0x0,%esi
+  80158e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801591:	b8 16 00 00 00       	mov    $0x16,%eax
+  801596:	8b 55 08             	mov    0x8(%ebp),%edx
+  801599:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80159c:	89 f7                	mov    %esi,%edi
+  80159e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8015a0:	83 c4 08             	add    $0x8,%esp
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	7f 08                	jg     8015af <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8015a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015aa:	5b                   	pop    %ebx
+  8015ab:	5e                   	pop    %esi
+  8015ac:	5f                   	pop    %edi
+  8015ad:	5d                   	pop    %ebp
+  8015ae:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015af:	83 ec 0c             	sub    $0xc,%esp
+  8015b2:	50                   	push   %eax
+  8015b3:	6a 16                	push   $0x16
+  8015b5:	68 0b 61 80 00       	push   $0x80610b
+  8015ba:	6a 23                	push   $0x23
+  8015bc:	68 28 61 80 00       	push   $0x806128
+  8015c1:	e8 22 ef ff ff       	call   8004e8 <_panic>
+
+008015c6 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8015c6:	55                   	push   %ebp
+  8015c7:	89 e5                	mov    %esp,%ebp
+  8015c9:	57                   	push   %edi
+  8015ca:	56                   	push   %esi
+  8015cb:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8015cc:	6a 04                	push   $0x4
+  8015ce:	ff 75 08             	push   0x8(%ebp)
+  8015d1:	e8 d4 f9 ff ff       	call   800faa <touch_mem>
+	asm volatile("int %1\n"
+  8015d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015de:	b8 17 00 00 00       	mov    $0x17,%eax
+  8015e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e6:	89 df                	mov    %ebx,%edi
+  8015e8:	89 de                	mov    %ebx,%esi
+  8015ea:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8015ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ef:	5b                   	pop    %ebx
+  8015f0:	5e                   	pop    %esi
+  8015f1:	5f                   	pop    %edi
+  8015f2:	5d                   	pop    %ebp
+  8015f3:	c3                   	ret
+
+008015f4 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8015f4:	55                   	push   %ebp
+  8015f5:	89 e5                	mov    %esp,%ebp
+  8015f7:	57                   	push   %edi
+  8015f8:	56                   	push   %esi
+  8015f9:	53                   	push   %ebx
+  8015fa:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8015fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801602:	8b 55 08             	mov    0x8(%ebp),%edx
+  801605:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80160a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80160f:	89 df                	mov    %ebx,%edi
+  801611:	89 de                	mov    %ebx,%esi
+  801613:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801615:	85 c0                	test   %eax,%eax
+  801617:	7f 08                	jg     801621 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  801619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161c:	5b                   	pop    %ebx
+  80161d:	5e                   	pop    %esi
+  80161e:	5f                   	pop    %edi
+  80161f:	5d                   	pop    %ebp
+  801620:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801621:	83 ec 0c             	sub    $0xc,%esp
+  801624:	50                   	push   %eax
+  801625:	6a 0e                	push   $0xe
+  801627:	68 0b 61 80 00       	push   $0x80610b
+  80162c:	6a 23                	push   $0x23
+  80162e:	68 28 61 80 00       	push   $0x806128
+  801633:	e8 b0 ee ff ff       	call   8004e8 <_panic>
+
+00801638 <dupperm>:
+// the paging library's mapping tables).
+//
+static int
+dupperm(unsigned pn)
+{
+	if (uvpt[pn]&(PTE_SHARE|PTE_NO_PAGE))
+  801638:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80163f:	f6 c6 06             	test   $0x6,%dh
+  801642:	75 37                	jne    80167b <dupperm+0x43>
+		return 0;
+	if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW))
+  801644:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80164b:	f6 c2 02             	test   $0x2,%dl
+  80164e:	75 19                	jne    801669 <dupperm+0x31>
+  801650:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801657:	f6 c6 08             	test   $0x8,%dh
+  80165a:	75 0d                	jne    801669 <dupperm+0x31>
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+	return uvpt[pn]&PTE_SYSCALL;
+  80165c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801663:	25 07 0e 00 00       	and    $0xe07,%eax
+  801668:	c3                   	ret
+		return PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801669:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801670:	25 00 06 00 00       	and    $0x600,%eax
+  801675:	0d 05 08 00 00       	or     $0x805,%eax
+  80167a:	c3                   	ret
+		return 0;
+  80167b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801680:	c3                   	ret
+
+00801681 <dupable>:
+}
+
+// Is page pn present and user-readable (both its PDE and its PTE)?
+static bool
+dupable(unsigned pn)
+{
+  801681:	89 c2                	mov    %eax,%edx
+	return ((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U));
+  801683:	c1 e0 0c             	shl    $0xc,%eax
+  801686:	c1 e8 16             	shr    $0x16,%eax
+  801689:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  801690:	f6 c1 01             	test   $0x1,%cl
+  801693:	74 2c                	je     8016c1 <dupable+0x40>
+  801695:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  80169c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a1:	f6 c1 04             	test   $0x4,%cl
+  8016a4:	74 20                	je     8016c6 <dupable+0x45>
+  8016a6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8016ad:	f6 c1 01             	test   $0x1,%cl
+  8016b0:	74 14                	je     8016c6 <dupable+0x45>
+  8016b2:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8016b9:	c1 e8 02             	shr    $0x2,%eax
+  8016bc:	83 e0 01             	and    $0x1,%eax
+  8016bf:	eb 05                	jmp    8016c6 <dupable+0x45>
+  8016c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c6:	83 e0 01             	and    $0x1,%eax
+}
+  8016c9:	c3                   	ret
+
+008016ca <pgfault>:
+{
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+  8016cd:	56                   	push   %esi
+  8016ce:	53                   	push   %ebx
+  8016cf:	8b 45 08             	mov    0x8(%ebp),%eax
+	void *addr = (void *) utf->utf_fault_va;
+  8016d2:	8b 08                	mov    (%eax),%ecx
+	pte_t pte = uvpt[PGNUM(addr)];
+  8016d4:	89 ca                	mov    %ecx,%edx
+  8016d6:	c1 ea 0c             	shr    $0xc,%edx
+  8016d9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8016e0:	f6 40 04 02          	testb  $0x2,0x4(%eax)
+  8016e4:	0f 84 8e 00 00 00    	je     801778 <pgfault+0xae>
+		return 0;
+  8016ea:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!((err&FEC_WR) && (perm&PTE_COW))) {
+  8016ef:	f6 c6 08             	test   $0x8,%dh
+  8016f2:	0f 84 85 00 00 00    	je     80177d <pgfault+0xb3>
+	perm |= PTE_W;
+  8016f8:	81 e2 07 06 00 00    	and    $0x607,%edx
+  8016fe:	89 d3                	mov    %edx,%ebx
+  801700:	83 cb 02             	or     $0x2,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  801703:	89 ce                	mov    %ecx,%esi
+  801705:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((r = page_alloc(0, (void *)PFTEMP, perm, 1)) < 0) {
+  80170b:	6a 01                	push   $0x1
+  80170d:	53                   	push   %ebx
+  80170e:	68 00 f0 7f 00       	push   $0x7ff000
+  801713:	6a 00                	push   $0x0
+  801715:	e8 7b 2e 00 00       	call   804595 <page_alloc>
+  80171a:	83 c4 10             	add    $0x10,%esp
+  80171d:	85 c0                	test   %eax,%eax
+  80171f:	78 33                	js     801754 <pgfault+0x8a>
+	memmove((void *)PFTEMP, addr, PGSIZE);
+  801721:	83 ec 04             	sub    $0x4,%esp
+  801724:	68 00 10 00 00       	push   $0x1000
+  801729:	56                   	push   %esi
+  80172a:	68 00 f0 7f 00       	push   $0x7ff000
+  80172f:	e8 fc f5 ff ff       	call   800d30 <memmove>
+	if ((r = page_map(0, (void *)PFTEMP, 0, addr, perm)) < 0) {
+  801734:	89 1c 24             	mov    %ebx,(%esp)
+  801737:	56                   	push   %esi
+  801738:	6a 00                	push   $0x0
+  80173a:	68 00 f0 7f 00       	push   $0x7ff000
+  80173f:	6a 00                	push   $0x0
+  801741:	e8 b0 34 00 00       	call   804bf6 <page_map>
+  801746:	83 c4 20             	add    $0x20,%esp
+  801749:	85 c0                	test   %eax,%eax
+  80174b:	78 19                	js     801766 <pgfault+0x9c>
+	return 1;
+  80174d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801752:	eb 29                	jmp    80177d <pgfault+0xb3>
+		panic("pgfault: page_alloc failed with error %d", r);
+  801754:	50                   	push   %eax
+  801755:	68 38 61 80 00       	push   $0x806138
+  80175a:	6a 2e                	push   $0x2e
+  80175c:	68 8b 61 80 00       	push   $0x80618b
+  801761:	e8 82 ed ff ff       	call   8004e8 <_panic>
+		panic("pgfault: page_map failed with error %d", r);
+  801766:	50                   	push   %eax
+  801767:	68 64 61 80 00       	push   $0x806164
+  80176c:	6a 32                	push   $0x32
+  80176e:	68 8b 61 80 00       	push   $0x80618b
+  801773:	e8 70 ed ff ff       	call   8004e8 <_panic>
+		return 0;
+  801778:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80177d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801780:	5b                   	pop    %ebx
+  801781:	5e                   	pop    %esi
+  801782:	5d                   	pop    %ebp
+  801783:	c3                   	ret
+
+00801784 <fork>:
+//
+// Returns: child's envid to the parent, 0 to the child, < 0 on error.
+//
+envid_t
+fork(void)
+{
+  801784:	55                   	push   %ebp
+  801785:	89 e5                	mov    %esp,%ebp
+  801787:	57                   	push   %edi
+  801788:	56                   	push   %esi
+  801789:	53                   	push   %ebx
+  80178a:	83 ec 2c             	sub    $0x2c,%esp
+	envid_t envid;
+	int r;
+
+	if(!umapdir)
+  80178d:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  801794:	74 5d                	je     8017f3 <fork+0x6f>
+		init_map_dir();
+	// Set up our page fault handler appropriately.
+	add_pgfault_handler(pgfault);
+  801796:	83 ec 0c             	sub    $0xc,%esp
+  801799:	68 ca 16 80 00       	push   $0x8016ca
+  80179e:	e8 40 3f 00 00       	call   8056e3 <add_pgfault_handler>
+
+	if ((envid = sys_fork()) == -E_NO_MEM)
+  8017a3:	e8 14 fb ff ff       	call   8012bc <sys_fork>
+  8017a8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017ab:	83 c4 10             	add    $0x10,%esp
+  8017ae:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8017b1:	74 47                	je     8017fa <fork+0x76>
+		envid = ufork();
+	if (envid == 0) {
+  8017b3:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8017b7:	0f 84 c5 03 00 00    	je     801b82 <fork+0x3fe>
+		// is no longer valid (it refers to the parent!).
+		// Fix it and return 0.
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+	if (envid < 0)
+  8017bd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8017c1:	78 25                	js     8017e8 <fork+0x64>
+		return envid;
+
+	// The child's copies of our mapping tables point at the same swap
+	// slots as ours, so take a reference on them before it can run.
+	if ((r = page_share_paged_out()) < 0)
+  8017c3:	e8 45 27 00 00       	call   803f0d <page_share_paged_out>
+  8017c8:	85 c0                	test   %eax,%eax
+  8017ca:	0f 88 d8 03 00 00    	js     801ba8 <fork+0x424>
+		panic("page_share_paged_out: %e", r);
+
+	// Start the child environment running
+	if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8017d0:	83 ec 08             	sub    $0x8,%esp
+  8017d3:	6a 02                	push   $0x2
+  8017d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8017d8:	e8 fe fa ff ff       	call   8012db <sys_env_set_status>
+  8017dd:	83 c4 10             	add    $0x10,%esp
+  8017e0:	85 c0                	test   %eax,%eax
+  8017e2:	0f 88 d5 03 00 00    	js     801bbd <fork+0x439>
+		panic("sys_env_set_status: %d", r);
+	}
+
+	return envid;
+}
+  8017e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ee:	5b                   	pop    %ebx
+  8017ef:	5e                   	pop    %esi
+  8017f0:	5f                   	pop    %edi
+  8017f1:	5d                   	pop    %ebp
+  8017f2:	c3                   	ret
+		init_map_dir();
+  8017f3:	e8 1d 2a 00 00       	call   804215 <init_map_dir>
+  8017f8:	eb 9c                	jmp    801796 <fork+0x12>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	__asm __volatile("int %2"
+  8017fa:	b8 07 00 00 00       	mov    $0x7,%eax
+  8017ff:	cd 30                	int    $0x30
+  801801:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	if (envid < 0)
+  801804:	85 c0                	test   %eax,%eax
+  801806:	78 10                	js     801818 <fork+0x94>
+	if (envid == 0)
+  801808:	0f 84 74 03 00 00    	je     801b82 <fork+0x3fe>
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  80180e:	be 00 00 00 00       	mov    $0x0,%esi
+  801813:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801816:	eb 30                	jmp    801848 <fork+0xc4>
+		panic("sys_exofork: %d", envid);
+  801818:	50                   	push   %eax
+  801819:	68 96 61 80 00       	push   $0x806196
+  80181e:	68 cd 00 00 00       	push   $0xcd
+  801823:	68 8b 61 80 00       	push   $0x80618b
+  801828:	e8 bb ec ff ff       	call   8004e8 <_panic>
+			pn += NPTENTRIES - pn%NPTENTRIES;
+  80182d:	89 f2                	mov    %esi,%edx
+  80182f:	c1 fa 1f             	sar    $0x1f,%edx
+  801832:	c1 ea 16             	shr    $0x16,%edx
+  801835:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  801838:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80183d:	29 d0                	sub    %edx,%eax
+  80183f:	ba 00 04 00 00       	mov    $0x400,%edx
+  801844:	29 c2                	sub    %eax,%edx
+  801846:	01 d6                	add    %edx,%esi
+	for (pn = 0; pn < PGNUM(USTACKTOP); ) {
+  801848:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  80184b:	81 fe fd eb 0e 00    	cmp    $0xeebfd,%esi
+  801851:	0f 87 ff 02 00 00    	ja     801b56 <fork+0x3d2>
+		if (!((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U))) {
+  801857:	89 f3                	mov    %esi,%ebx
+  801859:	c1 e3 0c             	shl    $0xc,%ebx
+  80185c:	89 d8                	mov    %ebx,%eax
+  80185e:	c1 e8 16             	shr    $0x16,%eax
+  801861:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801868:	f6 c2 01             	test   $0x1,%dl
+  80186b:	74 c0                	je     80182d <fork+0xa9>
+  80186d:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  801874:	f6 c2 04             	test   $0x4,%dl
+  801877:	74 b4                	je     80182d <fork+0xa9>
+		if (uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)
+  801879:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801880:	a8 80                	test   $0x80,%al
+  801882:	75 24                	jne    8018a8 <fork+0x124>
+		if ((uvpt[pn]&(PTE_P|PTE_SWAPPED)) == PTE_SWAPPED)
+  801884:	8b 04 b5 00 00 40 ef 	mov    -0x10c00000(,%esi,4),%eax
+  80188b:	25 81 00 00 00       	and    $0x81,%eax
+  801890:	3d 80 00 00 00       	cmp    $0x80,%eax
+  801895:	74 21                	je     8018b8 <fork+0x134>
+		if (!dupable(pn)) {
+  801897:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80189a:	e8 e2 fd ff ff       	call   801681 <dupable>
+  80189f:	84 c0                	test   %al,%al
+  8018a1:	75 1a                	jne    8018bd <fork+0x139>
+			++pn;
+  8018a3:	83 c6 01             	add    $0x1,%esi
+			continue;
+  8018a6:	eb a0                	jmp    801848 <fork+0xc4>
+			sys_page_split(0, PGADDR(0,pn,0));
+  8018a8:	83 ec 08             	sub    $0x8,%esp
+  8018ab:	53                   	push   %ebx
+  8018ac:	6a 00                	push   $0x0
+  8018ae:	e8 b1 f8 ff ff       	call   801164 <sys_page_split>
+  8018b3:	83 c4 10             	add    $0x10,%esp
+  8018b6:	eb cc                	jmp    801884 <fork+0x100>
+			(void) *(volatile char *) PGADDR(0,pn,0);
+  8018b8:	0f b6 03             	movzbl (%ebx),%eax
+  8018bb:	eb da                	jmp    801897 <fork+0x113>
+		if (!(perm = dupperm(pn))) {
+  8018bd:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8018c0:	89 f8                	mov    %edi,%eax
+  8018c2:	e8 71 fd ff ff       	call   801638 <dupperm>
+  8018c7:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8018ca:	85 c0                	test   %eax,%eax
+  8018cc:	74 16                	je     8018e4 <fork+0x160>
+  8018ce:	b8 fe eb 0e 00       	mov    $0xeebfe,%eax
+  8018d3:	29 f8                	sub    %edi,%eax
+  8018d5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  8018d8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8018dd:	89 c6                	mov    %eax,%esi
+  8018df:	e9 c4 01 00 00       	jmp    801aa8 <fork+0x324>
+	if (uvpt[pn]&PTE_SHARE) {
+  8018e4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018ee:	f6 c4 04             	test   $0x4,%ah
+  8018f1:	0f 85 89 00 00 00    	jne    801980 <fork+0x1fc>
+	else if (uvpt[pn]&PTE_NO_PAGE) {
+  8018f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018fa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801901:	f6 c4 02             	test   $0x2,%ah
+  801904:	0f 85 b1 00 00 00    	jne    8019bb <fork+0x237>
+	else if ((uvpt[pn]&PTE_W) || (uvpt[pn]&PTE_COW)) {
+  80190a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80190d:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801914:	a8 02                	test   $0x2,%al
+  801916:	75 10                	jne    801928 <fork+0x1a4>
+  801918:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80191f:	f6 c4 08             	test   $0x8,%ah
+  801922:	0f 84 3e 01 00 00    	je     801a66 <fork+0x2e2>
+		perm = PTE_P|PTE_U|PTE_COW|(uvpt[pn]&PTE_AVAIL);
+  801928:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80192b:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801932:	25 00 06 00 00       	and    $0x600,%eax
+  801937:	0d 05 08 00 00       	or     $0x805,%eax
+  80193c:	89 c7                	mov    %eax,%edi
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), perm)) < 0) {
+  80193e:	c1 e1 0c             	shl    $0xc,%ecx
+  801941:	89 cb                	mov    %ecx,%ebx
+  801943:	83 ec 0c             	sub    $0xc,%esp
+  801946:	50                   	push   %eax
+  801947:	51                   	push   %ecx
+  801948:	ff 75 e4             	push   -0x1c(%ebp)
+  80194b:	51                   	push   %ecx
+  80194c:	6a 00                	push   $0x0
+  80194e:	e8 a3 32 00 00       	call   804bf6 <page_map>
+  801953:	83 c4 20             	add    $0x20,%esp
+  801956:	85 c0                	test   %eax,%eax
+  801958:	0f 88 e4 00 00 00    	js     801a42 <fork+0x2be>
+		if ((r = page_map(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), perm)) < 0) {
+  80195e:	83 ec 0c             	sub    $0xc,%esp
+  801961:	57                   	push   %edi
+  801962:	53                   	push   %ebx
+  801963:	6a 00                	push   $0x0
+  801965:	53                   	push   %ebx
+  801966:	6a 00                	push   $0x0
+  801968:	e8 89 32 00 00       	call   804bf6 <page_map>
+  80196d:	83 c4 20             	add    $0x20,%esp
+  801970:	85 c0                	test   %eax,%eax
+  801972:	0f 88 dc 00 00 00    	js     801a54 <fork+0x2d0>
+			++pn;
+  801978:	83 c6 01             	add    $0x1,%esi
+			continue;
+  80197b:	e9 c8 fe ff ff       	jmp    801848 <fork+0xc4>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801980:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801983:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  80198a:	c1 e1 0c             	shl    $0xc,%ecx
+  80198d:	83 ec 0c             	sub    $0xc,%esp
+  801990:	25 07 0e 00 00       	and    $0xe07,%eax
+  801995:	50                   	push   %eax
+  801996:	51                   	push   %ecx
+  801997:	ff 75 e4             	push   -0x1c(%ebp)
+  80199a:	51                   	push   %ecx
+  80199b:	6a 00                	push   $0x0
+  80199d:	e8 54 32 00 00       	call   804bf6 <page_map>
+  8019a2:	83 c4 20             	add    $0x20,%esp
+  8019a5:	85 c0                	test   %eax,%eax
+  8019a7:	79 cf                	jns    801978 <fork+0x1f4>
+			panic("page_map %d", r);
+  8019a9:	50                   	push   %eax
+  8019aa:	68 a6 61 80 00       	push   $0x8061a6
+  8019af:	6a 4d                	push   $0x4d
+  8019b1:	68 8b 61 80 00       	push   $0x80618b
+  8019b6:	e8 2d eb ff ff       	call   8004e8 <_panic>
+		if (!(temp = malloc(PGSIZE)))
+  8019bb:	83 ec 0c             	sub    $0xc,%esp
+  8019be:	68 00 10 00 00       	push   $0x1000
+  8019c3:	e8 20 38 00 00       	call   8051e8 <malloc>
+  8019c8:	89 c7                	mov    %eax,%edi
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	74 4b                	je     801a1c <fork+0x298>
+		memcpy(temp, PGADDR(0,pn,0), PGSIZE);
+  8019d1:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  8019d4:	c1 e3 0c             	shl    $0xc,%ebx
+  8019d7:	83 ec 04             	sub    $0x4,%esp
+  8019da:	68 00 10 00 00       	push   $0x1000
+  8019df:	53                   	push   %ebx
+  8019e0:	50                   	push   %eax
+  8019e1:	e8 ac f3 ff ff       	call   800d92 <memcpy>
+		if ((r = page_map(0, temp, envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0)
+  8019e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019e9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8019f0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019f5:	89 04 24             	mov    %eax,(%esp)
+  8019f8:	53                   	push   %ebx
+  8019f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8019fc:	57                   	push   %edi
+  8019fd:	6a 00                	push   $0x0
+  8019ff:	e8 f2 31 00 00       	call   804bf6 <page_map>
+  801a04:	83 c4 20             	add    $0x20,%esp
+  801a07:	85 c0                	test   %eax,%eax
+  801a09:	78 25                	js     801a30 <fork+0x2ac>
+		free(temp);
+  801a0b:	83 ec 0c             	sub    $0xc,%esp
+  801a0e:	57                   	push   %edi
+  801a0f:	e8 d2 35 00 00       	call   804fe6 <free>
+  801a14:	83 c4 10             	add    $0x10,%esp
+  801a17:	e9 5c ff ff ff       	jmp    801978 <fork+0x1f4>
+			panic("malloc failed");
+  801a1c:	83 ec 04             	sub    $0x4,%esp
+  801a1f:	68 b2 61 80 00       	push   $0x8061b2
+  801a24:	6a 56                	push   $0x56
+  801a26:	68 8b 61 80 00       	push   $0x80618b
+  801a2b:	e8 b8 ea ff ff       	call   8004e8 <_panic>
+			panic("page_map: %e", r);
+  801a30:	50                   	push   %eax
+  801a31:	68 c0 61 80 00       	push   $0x8061c0
+  801a36:	6a 59                	push   $0x59
+  801a38:	68 8b 61 80 00       	push   $0x80618b
+  801a3d:	e8 a6 ea ff ff       	call   8004e8 <_panic>
+			panic("page_map %d", r);
+  801a42:	50                   	push   %eax
+  801a43:	68 a6 61 80 00       	push   $0x8061a6
+  801a48:	6a 65                	push   $0x65
+  801a4a:	68 8b 61 80 00       	push   $0x80618b
+  801a4f:	e8 94 ea ff ff       	call   8004e8 <_panic>
+			panic("page_map %d", r);
+  801a54:	50                   	push   %eax
+  801a55:	68 a6 61 80 00       	push   $0x8061a6
+  801a5a:	6a 78                	push   $0x78
+  801a5c:	68 8b 61 80 00       	push   $0x80618b
+  801a61:	e8 82 ea ff ff       	call   8004e8 <_panic>
+		if ((r = page_map(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL)) < 0) {
+  801a66:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801a69:	8b 04 8d 00 00 40 ef 	mov    -0x10c00000(,%ecx,4),%eax
+  801a70:	c1 e1 0c             	shl    $0xc,%ecx
+  801a73:	83 ec 0c             	sub    $0xc,%esp
+  801a76:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a7b:	50                   	push   %eax
+  801a7c:	51                   	push   %ecx
+  801a7d:	ff 75 e4             	push   -0x1c(%ebp)
+  801a80:	51                   	push   %ecx
+  801a81:	6a 00                	push   $0x0
+  801a83:	e8 6e 31 00 00       	call   804bf6 <page_map>
+  801a88:	83 c4 20             	add    $0x20,%esp
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	0f 89 e5 fe ff ff    	jns    801978 <fork+0x1f4>
+			panic("page_map %d", r);
+  801a93:	50                   	push   %eax
+  801a94:	68 a6 61 80 00       	push   $0x8061a6
+  801a99:	6a 7f                	push   $0x7f
+  801a9b:	68 8b 61 80 00       	push   $0x80618b
+  801aa0:	e8 43 ea ff ff       	call   8004e8 <_panic>
+		for (n = 1; pn+n < PGNUM(USTACKTOP) && dupable(pn+n) && dupperm(pn+n) == perm; ++n)
+  801aa5:	83 c7 01             	add    $0x1,%edi
+  801aa8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801aab:	8d 1c 07             	lea    (%edi,%eax,1),%ebx
+  801aae:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  801ab1:	39 f7                	cmp    %esi,%edi
+  801ab3:	74 1c                	je     801ad1 <fork+0x34d>
+  801ab5:	89 d8                	mov    %ebx,%eax
+  801ab7:	e8 c5 fb ff ff       	call   801681 <dupable>
+  801abc:	84 c0                	test   %al,%al
+  801abe:	74 7c                	je     801b3c <fork+0x3b8>
+  801ac0:	89 d8                	mov    %ebx,%eax
+  801ac2:	e8 71 fb ff ff       	call   801638 <dupperm>
+  801ac7:	39 45 dc             	cmp    %eax,-0x24(%ebp)
+  801aca:	74 d9                	je     801aa5 <fork+0x321>
+  801acc:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801acf:	eb 06                	jmp    801ad7 <fork+0x353>
+  801ad1:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801ad4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+	if ((r = page_map_range(0, PGADDR(0,pn,0), envid, PGADDR(0,pn,0), npages, perm)) < 0)
+  801ad7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801ada:	c1 e0 0c             	shl    $0xc,%eax
+  801add:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801ae0:	83 ec 08             	sub    $0x8,%esp
+  801ae3:	ff 75 dc             	push   -0x24(%ebp)
+  801ae6:	57                   	push   %edi
+  801ae7:	50                   	push   %eax
+  801ae8:	ff 75 e4             	push   -0x1c(%ebp)
+  801aeb:	50                   	push   %eax
+  801aec:	6a 00                	push   $0x0
+  801aee:	e8 fa 32 00 00       	call   804ded <page_map_range>
+  801af3:	83 c4 20             	add    $0x20,%esp
+  801af6:	85 c0                	test   %eax,%eax
+  801af8:	78 47                	js     801b41 <fork+0x3bd>
+	if ((perm&PTE_COW) && (r = page_map_range(0, PGADDR(0,pn,0), 0, PGADDR(0,pn,0), npages, perm)) < 0)
+  801afa:	f7 45 dc 00 08 00 00 	testl  $0x800,-0x24(%ebp)
+  801b01:	0f 84 41 fd ff ff    	je     801848 <fork+0xc4>
+  801b07:	83 ec 08             	sub    $0x8,%esp
+  801b0a:	ff 75 dc             	push   -0x24(%ebp)
+  801b0d:	57                   	push   %edi
+  801b0e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b11:	50                   	push   %eax
+  801b12:	6a 00                	push   $0x0
+  801b14:	50                   	push   %eax
+  801b15:	6a 00                	push   $0x0
+  801b17:	e8 d1 32 00 00       	call   804ded <page_map_range>
+  801b1c:	83 c4 20             	add    $0x20,%esp
+  801b1f:	85 c0                	test   %eax,%eax
+  801b21:	0f 89 21 fd ff ff    	jns    801848 <fork+0xc4>
+		panic("page_map_range %e", r);
+  801b27:	50                   	push   %eax
+  801b28:	68 cd 61 80 00       	push   $0x8061cd
+  801b2d:	68 a2 00 00 00       	push   $0xa2
+  801b32:	68 8b 61 80 00       	push   $0x80618b
+  801b37:	e8 ac e9 ff ff       	call   8004e8 <_panic>
+  801b3c:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  801b3f:	eb 96                	jmp    801ad7 <fork+0x353>
+		panic("page_map_range %e", r);
+  801b41:	50                   	push   %eax
+  801b42:	68 cd 61 80 00       	push   $0x8061cd
+  801b47:	68 a0 00 00 00       	push   $0xa0
+  801b4c:	68 8b 61 80 00       	push   $0x80618b
+  801b51:	e8 92 e9 ff ff       	call   8004e8 <_panic>
+	page_alloc(envid, (void *)(UXSTACKTOP-PGSIZE), PTE_U|PTE_P|PTE_W, 1);
+  801b56:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  801b59:	6a 01                	push   $0x1
+  801b5b:	6a 07                	push   $0x7
+  801b5d:	68 00 f0 bf ee       	push   $0xeebff000
+  801b62:	53                   	push   %ebx
+  801b63:	e8 2d 2a 00 00       	call   804595 <page_alloc>
+	sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  801b68:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801b6d:	8b 40 74             	mov    0x74(%eax),%eax
+  801b70:	83 c4 08             	add    $0x8,%esp
+  801b73:	50                   	push   %eax
+  801b74:	53                   	push   %ebx
+  801b75:	e8 89 f8 ff ff       	call   801403 <sys_env_set_pgfault_upcall>
+  801b7a:	83 c4 10             	add    $0x10,%esp
+  801b7d:	e9 41 fc ff ff       	jmp    8017c3 <fork+0x3f>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801b82:	e8 d8 f4 ff ff       	call   80105f <sys_getenvid>
+  801b87:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801b8c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  801b8f:	c1 e0 06             	shl    $0x6,%eax
+  801b92:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801b97:	a3 18 f9 80 00       	mov    %eax,0x80f918
+		return 0;
+  801b9c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801ba3:	e9 40 fc ff ff       	jmp    8017e8 <fork+0x64>
+		panic("page_share_paged_out: %e", r);
+  801ba8:	50                   	push   %eax
+  801ba9:	68 df 61 80 00       	push   $0x8061df
+  801bae:	68 27 01 00 00       	push   $0x127
+  801bb3:	68 8b 61 80 00       	push   $0x80618b
+  801bb8:	e8 2b e9 ff ff       	call   8004e8 <_panic>
+		panic("sys_env_set_status: %d", r);
+  801bbd:	50                   	push   %eax
+  801bbe:	68 f8 61 80 00       	push   $0x8061f8
+  801bc3:	68 2b 01 00 00       	push   $0x12b
+  801bc8:	68 8b 61 80 00       	push   $0x80618b
+  801bcd:	e8 16 e9 ff ff       	call   8004e8 <_panic>
+
+00801bd2 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  801bd2:	55                   	push   %ebp
+  801bd3:	89 e5                	mov    %esp,%ebp
+  801bd5:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  801bd8:	68 0f 62 80 00       	push   $0x80620f
+  801bdd:	68 35 01 00 00       	push   $0x135
+  801be2:	68 8b 61 80 00       	push   $0x80618b
+  801be7:	e8 fc e8 ff ff       	call   8004e8 <_panic>
+
+00801bec <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801bec:	55                   	push   %ebp
+  801bed:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bef:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf2:	05 00 00 00 30       	add    $0x30000000,%eax
+  801bf7:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801bfa:	5d                   	pop    %ebp
+  801bfb:	c3                   	ret
+
+00801bfc <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801bfc:	55                   	push   %ebp
+  801bfd:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801bff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c02:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801c07:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c0c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801c11:	5d                   	pop    %ebp
+  801c12:	c3                   	ret
+
+00801c13 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801c13:	55                   	push   %ebp
+  801c14:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801c16:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801c1b:	a8 01                	test   $0x1,%al
+  801c1d:	74 3c                	je     801c5b <fd_alloc+0x48>
+  801c1f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801c24:	89 c2                	mov    %eax,%edx
+  801c26:	c1 ea 0c             	shr    $0xc,%edx
+  801c29:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c30:	89 c1                	mov    %eax,%ecx
+  801c32:	05 00 10 00 00       	add    $0x1000,%eax
+  801c37:	f6 c2 01             	test   $0x1,%dl
+  801c3a:	74 13                	je     801c4f <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801c3c:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  801c41:	75 e1                	jne    801c24 <fd_alloc+0x11>
+  801c43:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801c48:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801c4d:	eb 05                	jmp    801c54 <fd_alloc+0x41>
+			return 0;
+  801c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  801c54:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c57:	89 0a                	mov    %ecx,(%edx)
+}
+  801c59:	5d                   	pop    %ebp
+  801c5a:	c3                   	ret
+  801c5b:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  801c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c65:	eb ed                	jmp    801c54 <fd_alloc+0x41>
+
+00801c67 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801c67:	55                   	push   %ebp
+  801c68:	89 e5                	mov    %esp,%ebp
+  801c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801c6d:	83 f8 1f             	cmp    $0x1f,%eax
+  801c70:	77 30                	ja     801ca2 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801c72:	c1 e0 0c             	shl    $0xc,%eax
+  801c75:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801c7a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801c80:	f6 c2 01             	test   $0x1,%dl
+  801c83:	74 24                	je     801ca9 <fd_lookup+0x42>
+  801c85:	89 c2                	mov    %eax,%edx
+  801c87:	c1 ea 0c             	shr    $0xc,%edx
+  801c8a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c91:	f6 c2 01             	test   $0x1,%dl
+  801c94:	74 1a                	je     801cb0 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801c96:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c99:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ca0:	5d                   	pop    %ebp
+  801ca1:	c3                   	ret
+		return -E_INVAL;
+  801ca2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ca7:	eb f7                	jmp    801ca0 <fd_lookup+0x39>
+		return -E_INVAL;
+  801ca9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cae:	eb f0                	jmp    801ca0 <fd_lookup+0x39>
+  801cb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cb5:	eb e9                	jmp    801ca0 <fd_lookup+0x39>
+
+00801cb7 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801cb7:	55                   	push   %ebp
+  801cb8:	89 e5                	mov    %esp,%ebp
+  801cba:	53                   	push   %ebx
+  801cbb:	83 ec 04             	sub    $0x4,%esp
+  801cbe:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801cc1:	b8 a4 62 80 00       	mov    $0x8062a4,%eax
+  801cc6:	8b 18                	mov    (%eax),%ebx
+  801cc8:	85 db                	test   %ebx,%ebx
+  801cca:	74 0e                	je     801cda <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  801ccc:	83 c0 04             	add    $0x4,%eax
+  801ccf:	39 13                	cmp    %edx,(%ebx)
+  801cd1:	75 f3                	jne    801cc6 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801cd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd8:	eb 1f                	jmp    801cf9 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801cda:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801cdf:	8b 40 48             	mov    0x48(%eax),%eax
+  801ce2:	83 ec 04             	sub    $0x4,%esp
+  801ce5:	52                   	push   %edx
+  801ce6:	50                   	push   %eax
+  801ce7:	68 28 62 80 00       	push   $0x806228
+  801cec:	e8 d2 e8 ff ff       	call   8005c3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801cf1:	83 c4 10             	add    $0x10,%esp
+  801cf4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801cf9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cfc:	89 1a                	mov    %ebx,(%edx)
+}
+  801cfe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d01:	c9                   	leave
+  801d02:	c3                   	ret
+
+00801d03 <fd_close>:
+{
+  801d03:	55                   	push   %ebp
+  801d04:	89 e5                	mov    %esp,%ebp
+  801d06:	57                   	push   %edi
+  801d07:	56                   	push   %esi
+  801d08:	53                   	push   %ebx
+  801d09:	83 ec 24             	sub    $0x24,%esp
+  801d0c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d0f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d12:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d15:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801d16:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801d1c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801d1f:	50                   	push   %eax
+  801d20:	e8 42 ff ff ff       	call   801c67 <fd_lookup>
+  801d25:	89 c3                	mov    %eax,%ebx
+  801d27:	83 c4 10             	add    $0x10,%esp
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	78 05                	js     801d33 <fd_close+0x30>
+	    || fd != fd2)
+  801d2e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801d31:	74 16                	je     801d49 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801d33:	89 f8                	mov    %edi,%eax
+  801d35:	84 c0                	test   %al,%al
+  801d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801d3f:	89 d8                	mov    %ebx,%eax
+  801d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d44:	5b                   	pop    %ebx
+  801d45:	5e                   	pop    %esi
+  801d46:	5f                   	pop    %edi
+  801d47:	5d                   	pop    %ebp
+  801d48:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d49:	83 ec 08             	sub    $0x8,%esp
+  801d4c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801d4f:	50                   	push   %eax
+  801d50:	ff 36                	push   (%esi)
+  801d52:	e8 60 ff ff ff       	call   801cb7 <dev_lookup>
+  801d57:	89 c3                	mov    %eax,%ebx
+  801d59:	83 c4 10             	add    $0x10,%esp
+  801d5c:	85 c0                	test   %eax,%eax
+  801d5e:	78 1a                	js     801d7a <fd_close+0x77>
+		if (dev->dev_close)
+  801d60:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801d63:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801d66:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	74 0b                	je     801d7a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801d6f:	83 ec 0c             	sub    $0xc,%esp
+  801d72:	56                   	push   %esi
+  801d73:	ff d0                	call   *%eax
+  801d75:	89 c3                	mov    %eax,%ebx
+  801d77:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801d7a:	83 ec 08             	sub    $0x8,%esp
+  801d7d:	56                   	push   %esi
+  801d7e:	6a 00                	push   $0x0
+  801d80:	e8 9d f3 ff ff       	call   801122 <sys_page_unmap>
+	return r;
+  801d85:	83 c4 10             	add    $0x10,%esp
+  801d88:	eb b5                	jmp    801d3f <fd_close+0x3c>
+
+00801d8a <close>:
+
+int
+close(int fdnum)
+{
+  801d8a:	55                   	push   %ebp
+  801d8b:	89 e5                	mov    %esp,%ebp
+  801d8d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d90:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d93:	50                   	push   %eax
+  801d94:	ff 75 08             	push   0x8(%ebp)
+  801d97:	e8 cb fe ff ff       	call   801c67 <fd_lookup>
+  801d9c:	83 c4 10             	add    $0x10,%esp
+  801d9f:	85 c0                	test   %eax,%eax
+  801da1:	79 02                	jns    801da5 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801da3:	c9                   	leave
+  801da4:	c3                   	ret
+		return fd_close(fd, 1);
+  801da5:	83 ec 08             	sub    $0x8,%esp
+  801da8:	6a 01                	push   $0x1
+  801daa:	ff 75 f4             	push   -0xc(%ebp)
+  801dad:	e8 51 ff ff ff       	call   801d03 <fd_close>
+  801db2:	83 c4 10             	add    $0x10,%esp
+  801db5:	eb ec                	jmp    801da3 <close+0x19>
+
+00801db7 <close_all>:
+
+void
+close_all(void)
+{
+  801db7:	55                   	push   %ebp
+  801db8:	89 e5                	mov    %esp,%ebp
+  801dba:	53                   	push   %ebx
+  801dbb:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801dbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801dc3:	83 ec 0c             	sub    $0xc,%esp
+  801dc6:	53                   	push   %ebx
+  801dc7:	e8 be ff ff ff       	call   801d8a <close>
+	for (i = 0; i < MAXFD; i++)
+  801dcc:	83 c3 01             	add    $0x1,%ebx
+  801dcf:	83 c4 10             	add    $0x10,%esp
+  801dd2:	83 fb 20             	cmp    $0x20,%ebx
+  801dd5:	75 ec                	jne    801dc3 <close_all+0xc>
+}
+  801dd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dda:	c9                   	leave
+  801ddb:	c3                   	ret
+
+00801ddc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801ddc:	55                   	push   %ebp
+  801ddd:	89 e5                	mov    %esp,%ebp
+  801ddf:	57                   	push   %edi
+  801de0:	56                   	push   %esi
+  801de1:	53                   	push   %ebx
+  801de2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801de5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801de8:	50                   	push   %eax
+  801de9:	ff 75 08             	push   0x8(%ebp)
+  801dec:	e8 76 fe ff ff       	call   801c67 <fd_lookup>
+  801df1:	89 c3                	mov    %eax,%ebx
+  801df3:	83 c4 10             	add    $0x10,%esp
+  801df6:	85 c0                	test   %eax,%eax
+  801df8:	78 7f                	js     801e79 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801dfa:	83 ec 0c             	sub    $0xc,%esp
+  801dfd:	ff 75 0c             	push   0xc(%ebp)
+  801e00:	e8 85 ff ff ff       	call   801d8a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801e05:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801e08:	c1 e6 0c             	shl    $0xc,%esi
+  801e0b:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801e11:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801e14:	89 3c 24             	mov    %edi,(%esp)
+  801e17:	e8 e0 fd ff ff       	call   801bfc <fd2data>
+  801e1c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801e1e:	89 34 24             	mov    %esi,(%esp)
+  801e21:	e8 d6 fd ff ff       	call   801bfc <fd2data>
+  801e26:	83 c4 10             	add    $0x10,%esp
+  801e29:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801e2c:	89 d8                	mov    %ebx,%eax
+  801e2e:	c1 e8 16             	shr    $0x16,%eax
+  801e31:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e38:	a8 01                	test   $0x1,%al
+  801e3a:	74 11                	je     801e4d <dup+0x71>
+  801e3c:	89 d8                	mov    %ebx,%eax
+  801e3e:	c1 e8 0c             	shr    $0xc,%eax
+  801e41:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801e48:	f6 c2 01             	test   $0x1,%dl
+  801e4b:	75 36                	jne    801e83 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801e4d:	89 f8                	mov    %edi,%eax
+  801e4f:	c1 e8 0c             	shr    $0xc,%eax
+  801e52:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e59:	83 ec 0c             	sub    $0xc,%esp
+  801e5c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e61:	50                   	push   %eax
+  801e62:	56                   	push   %esi
+  801e63:	6a 00                	push   $0x0
+  801e65:	57                   	push   %edi
+  801e66:	6a 00                	push   $0x0
+  801e68:	e8 73 f2 ff ff       	call   8010e0 <sys_page_map>
+  801e6d:	89 c3                	mov    %eax,%ebx
+  801e6f:	83 c4 20             	add    $0x20,%esp
+  801e72:	85 c0                	test   %eax,%eax
+  801e74:	78 33                	js     801ea9 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801e76:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801e79:	89 d8                	mov    %ebx,%eax
+  801e7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e7e:	5b                   	pop    %ebx
+  801e7f:	5e                   	pop    %esi
+  801e80:	5f                   	pop    %edi
+  801e81:	5d                   	pop    %ebp
+  801e82:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801e83:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801e8a:	83 ec 0c             	sub    $0xc,%esp
+  801e8d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801e92:	50                   	push   %eax
+  801e93:	ff 75 d4             	push   -0x2c(%ebp)
+  801e96:	6a 00                	push   $0x0
+  801e98:	53                   	push   %ebx
+  801e99:	6a 00                	push   $0x0
+  801e9b:	e8 40 f2 ff ff       	call   8010e0 <sys_page_map>
+  801ea0:	89 c3                	mov    %eax,%ebx
+  801ea2:	83 c4 20             	add    $0x20,%esp
+  801ea5:	85 c0                	test   %eax,%eax
+  801ea7:	79 a4                	jns    801e4d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801ea9:	83 ec 08             	sub    $0x8,%esp
+  801eac:	56                   	push   %esi
+  801ead:	6a 00                	push   $0x0
+  801eaf:	e8 6e f2 ff ff       	call   801122 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801eb4:	83 c4 08             	add    $0x8,%esp
+  801eb7:	ff 75 d4             	push   -0x2c(%ebp)
+  801eba:	6a 00                	push   $0x0
+  801ebc:	e8 61 f2 ff ff       	call   801122 <sys_page_unmap>
+	return r;
+  801ec1:	83 c4 10             	add    $0x10,%esp
+  801ec4:	eb b3                	jmp    801e79 <dup+0x9d>
+
+00801ec6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801ec6:	55                   	push   %ebp
+  801ec7:	89 e5                	mov    %esp,%ebp
+  801ec9:	56                   	push   %esi
+  801eca:	53                   	push   %ebx
+  801ecb:	83 ec 18             	sub    $0x18,%esp
+  801ece:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ed1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ed4:	50                   	push   %eax
+  801ed5:	56                   	push   %esi
+  801ed6:	e8 8c fd ff ff       	call   801c67 <fd_lookup>
+  801edb:	83 c4 10             	add    $0x10,%esp
+  801ede:	85 c0                	test   %eax,%eax
+  801ee0:	78 3c                	js     801f1e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ee2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801ee5:	83 ec 08             	sub    $0x8,%esp
+  801ee8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eeb:	50                   	push   %eax
+  801eec:	ff 33                	push   (%ebx)
+  801eee:	e8 c4 fd ff ff       	call   801cb7 <dev_lookup>
+  801ef3:	83 c4 10             	add    $0x10,%esp
+  801ef6:	85 c0                	test   %eax,%eax
+  801ef8:	78 24                	js     801f1e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801efa:	8b 43 08             	mov    0x8(%ebx),%eax
+  801efd:	83 e0 03             	and    $0x3,%eax
+  801f00:	83 f8 01             	cmp    $0x1,%eax
+  801f03:	74 20                	je     801f25 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801f05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f08:	8b 40 08             	mov    0x8(%eax),%eax
+  801f0b:	85 c0                	test   %eax,%eax
+  801f0d:	74 37                	je     801f46 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801f0f:	83 ec 04             	sub    $0x4,%esp
+  801f12:	ff 75 10             	push   0x10(%ebp)
+  801f15:	ff 75 0c             	push   0xc(%ebp)
+  801f18:	53                   	push   %ebx
+  801f19:	ff d0                	call   *%eax
+  801f1b:	83 c4 10             	add    $0x10,%esp
+}
+  801f1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f21:	5b                   	pop    %ebx
+  801f22:	5e                   	pop    %esi
+  801f23:	5d                   	pop    %ebp
+  801f24:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f25:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801f2a:	8b 40 48             	mov    0x48(%eax),%eax
+  801f2d:	83 ec 04             	sub    $0x4,%esp
+  801f30:	56                   	push   %esi
+  801f31:	50                   	push   %eax
+  801f32:	68 69 62 80 00       	push   $0x806269
+  801f37:	e8 87 e6 ff ff       	call   8005c3 <cprintf>
+		return -E_INVAL;
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f44:	eb d8                	jmp    801f1e <read+0x58>
+		return -E_NOT_SUPP;
+  801f46:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f4b:	eb d1                	jmp    801f1e <read+0x58>
+
+00801f4d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801f4d:	55                   	push   %ebp
+  801f4e:	89 e5                	mov    %esp,%ebp
+  801f50:	57                   	push   %edi
+  801f51:	56                   	push   %esi
+  801f52:	53                   	push   %ebx
+  801f53:	83 ec 0c             	sub    $0xc,%esp
+  801f56:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f59:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801f5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f61:	eb 02                	jmp    801f65 <readn+0x18>
+  801f63:	01 c3                	add    %eax,%ebx
+  801f65:	39 f3                	cmp    %esi,%ebx
+  801f67:	73 21                	jae    801f8a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f69:	83 ec 04             	sub    $0x4,%esp
+  801f6c:	89 f0                	mov    %esi,%eax
+  801f6e:	29 d8                	sub    %ebx,%eax
+  801f70:	50                   	push   %eax
+  801f71:	89 d8                	mov    %ebx,%eax
+  801f73:	03 45 0c             	add    0xc(%ebp),%eax
+  801f76:	50                   	push   %eax
+  801f77:	57                   	push   %edi
+  801f78:	e8 49 ff ff ff       	call   801ec6 <read>
+		if (m < 0)
+  801f7d:	83 c4 10             	add    $0x10,%esp
+  801f80:	85 c0                	test   %eax,%eax
+  801f82:	78 04                	js     801f88 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801f84:	75 dd                	jne    801f63 <readn+0x16>
+  801f86:	eb 02                	jmp    801f8a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801f88:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801f8a:	89 d8                	mov    %ebx,%eax
+  801f8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f8f:	5b                   	pop    %ebx
+  801f90:	5e                   	pop    %esi
+  801f91:	5f                   	pop    %edi
+  801f92:	5d                   	pop    %ebp
+  801f93:	c3                   	ret
+
+00801f94 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801f94:	55                   	push   %ebp
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	56                   	push   %esi
+  801f98:	53                   	push   %ebx
+  801f99:	83 ec 18             	sub    $0x18,%esp
+  801f9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f9f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fa2:	50                   	push   %eax
+  801fa3:	53                   	push   %ebx
+  801fa4:	e8 be fc ff ff       	call   801c67 <fd_lookup>
+  801fa9:	83 c4 10             	add    $0x10,%esp
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 37                	js     801fe7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fb0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fb3:	83 ec 08             	sub    $0x8,%esp
+  801fb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb9:	50                   	push   %eax
+  801fba:	ff 36                	push   (%esi)
+  801fbc:	e8 f6 fc ff ff       	call   801cb7 <dev_lookup>
+  801fc1:	83 c4 10             	add    $0x10,%esp
+  801fc4:	85 c0                	test   %eax,%eax
+  801fc6:	78 1f                	js     801fe7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fc8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801fcc:	74 20                	je     801fee <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801fce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fd1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	74 37                	je     80200f <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801fd8:	83 ec 04             	sub    $0x4,%esp
+  801fdb:	ff 75 10             	push   0x10(%ebp)
+  801fde:	ff 75 0c             	push   0xc(%ebp)
+  801fe1:	56                   	push   %esi
+  801fe2:	ff d0                	call   *%eax
+  801fe4:	83 c4 10             	add    $0x10,%esp
+}
+  801fe7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801fea:	5b                   	pop    %ebx
+  801feb:	5e                   	pop    %esi
+  801fec:	5d                   	pop    %ebp
+  801fed:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fee:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  801ff3:	8b 40 48             	mov    0x48(%eax),%eax
+  801ff6:	83 ec 04             	sub    $0x4,%esp
+  801ff9:	53                   	push   %ebx
+  801ffa:	50                   	push   %eax
+  801ffb:	68 85 62 80 00       	push   $0x806285
+  802000:	e8 be e5 ff ff       	call   8005c3 <cprintf>
+		return -E_INVAL;
+  802005:	83 c4 10             	add    $0x10,%esp
+  802008:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80200d:	eb d8                	jmp    801fe7 <write+0x53>
+		return -E_NOT_SUPP;
+  80200f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802014:	eb d1                	jmp    801fe7 <write+0x53>
+
+00802016 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  802016:	55                   	push   %ebp
+  802017:	89 e5                	mov    %esp,%ebp
+  802019:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80201c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80201f:	50                   	push   %eax
+  802020:	ff 75 08             	push   0x8(%ebp)
+  802023:	e8 3f fc ff ff       	call   801c67 <fd_lookup>
+  802028:	83 c4 10             	add    $0x10,%esp
+  80202b:	85 c0                	test   %eax,%eax
+  80202d:	78 0e                	js     80203d <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80202f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802032:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802035:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  802038:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80203d:	c9                   	leave
+  80203e:	c3                   	ret
+
+0080203f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80203f:	55                   	push   %ebp
+  802040:	89 e5                	mov    %esp,%ebp
+  802042:	56                   	push   %esi
+  802043:	53                   	push   %ebx
+  802044:	83 ec 18             	sub    $0x18,%esp
+  802047:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80204a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80204d:	50                   	push   %eax
+  80204e:	53                   	push   %ebx
+  80204f:	e8 13 fc ff ff       	call   801c67 <fd_lookup>
+  802054:	83 c4 10             	add    $0x10,%esp
+  802057:	85 c0                	test   %eax,%eax
+  802059:	78 34                	js     80208f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80205b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80205e:	83 ec 08             	sub    $0x8,%esp
+  802061:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802064:	50                   	push   %eax
+  802065:	ff 36                	push   (%esi)
+  802067:	e8 4b fc ff ff       	call   801cb7 <dev_lookup>
+  80206c:	83 c4 10             	add    $0x10,%esp
+  80206f:	85 c0                	test   %eax,%eax
+  802071:	78 1c                	js     80208f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802073:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802077:	74 1d                	je     802096 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  802079:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80207c:	8b 40 18             	mov    0x18(%eax),%eax
+  80207f:	85 c0                	test   %eax,%eax
+  802081:	74 34                	je     8020b7 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  802083:	83 ec 08             	sub    $0x8,%esp
+  802086:	ff 75 0c             	push   0xc(%ebp)
+  802089:	56                   	push   %esi
+  80208a:	ff d0                	call   *%eax
+  80208c:	83 c4 10             	add    $0x10,%esp
+}
+  80208f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802092:	5b                   	pop    %ebx
+  802093:	5e                   	pop    %esi
+  802094:	5d                   	pop    %ebp
+  802095:	c3                   	ret
+			thisenv->env_id, fdnum);
+  802096:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80209b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80209e:	83 ec 04             	sub    $0x4,%esp
+  8020a1:	53                   	push   %ebx
+  8020a2:	50                   	push   %eax
+  8020a3:	68 48 62 80 00       	push   $0x806248
+  8020a8:	e8 16 e5 ff ff       	call   8005c3 <cprintf>
+		return -E_INVAL;
+  8020ad:	83 c4 10             	add    $0x10,%esp
+  8020b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020b5:	eb d8                	jmp    80208f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8020b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8020bc:	eb d1                	jmp    80208f <ftruncate+0x50>
+
+008020be <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8020be:	55                   	push   %ebp
+  8020bf:	89 e5                	mov    %esp,%ebp
+  8020c1:	56                   	push   %esi
+  8020c2:	53                   	push   %ebx
+  8020c3:	83 ec 18             	sub    $0x18,%esp
+  8020c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8020c9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8020cc:	50                   	push   %eax
+  8020cd:	ff 75 08             	push   0x8(%ebp)
+  8020d0:	e8 92 fb ff ff       	call   801c67 <fd_lookup>
+  8020d5:	83 c4 10             	add    $0x10,%esp
+  8020d8:	85 c0                	test   %eax,%eax
+  8020da:	78 49                	js     802125 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8020dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8020df:	83 ec 08             	sub    $0x8,%esp
+  8020e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020e5:	50                   	push   %eax
+  8020e6:	ff 36                	push   (%esi)
+  8020e8:	e8 ca fb ff ff       	call   801cb7 <dev_lookup>
+  8020ed:	83 c4 10             	add    $0x10,%esp
+  8020f0:	85 c0                	test   %eax,%eax
+  8020f2:	78 31                	js     802125 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8020f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8020fb:	74 2f                	je     80212c <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8020fd:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  802100:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  802107:	00 00 00 
+	stat->st_isdir = 0;
+  80210a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802111:	00 00 00 
+	stat->st_dev = dev;
+  802114:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80211a:	83 ec 08             	sub    $0x8,%esp
+  80211d:	53                   	push   %ebx
+  80211e:	56                   	push   %esi
+  80211f:	ff 50 14             	call   *0x14(%eax)
+  802122:	83 c4 10             	add    $0x10,%esp
+}
+  802125:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802128:	5b                   	pop    %ebx
+  802129:	5e                   	pop    %esi
+  80212a:	5d                   	pop    %ebp
+  80212b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80212c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802131:	eb f2                	jmp    802125 <fstat+0x67>
+
+00802133 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  802133:	55                   	push   %ebp
+  802134:	89 e5                	mov    %esp,%ebp
+  802136:	56                   	push   %esi
+  802137:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  802138:	83 ec 08             	sub    $0x8,%esp
+  80213b:	6a 00                	push   $0x0
+  80213d:	ff 75 08             	push   0x8(%ebp)
+  802140:	e8 bc 02 00 00       	call   802401 <open>
+  802145:	89 c3                	mov    %eax,%ebx
+  802147:	83 c4 10             	add    $0x10,%esp
+  80214a:	85 c0                	test   %eax,%eax
+  80214c:	78 1b                	js     802169 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  80214e:	83 ec 08             	sub    $0x8,%esp
+  802151:	ff 75 0c             	push   0xc(%ebp)
+  802154:	50                   	push   %eax
+  802155:	e8 64 ff ff ff       	call   8020be <fstat>
+  80215a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80215c:	89 1c 24             	mov    %ebx,(%esp)
+  80215f:	e8 26 fc ff ff       	call   801d8a <close>
+	return r;
+  802164:	83 c4 10             	add    $0x10,%esp
+  802167:	89 f3                	mov    %esi,%ebx
+}
+  802169:	89 d8                	mov    %ebx,%eax
+  80216b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80216e:	5b                   	pop    %ebx
+  80216f:	5e                   	pop    %esi
+  802170:	5d                   	pop    %ebp
+  802171:	c3                   	ret
+
+00802172 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  802172:	55                   	push   %ebp
+  802173:	89 e5                	mov    %esp,%ebp
+  802175:	57                   	push   %edi
+  802176:	56                   	push   %esi
+  802177:	53                   	push   %ebx
+  802178:	83 ec 0c             	sub    $0xc,%esp
+  80217b:	89 c7                	mov    %eax,%edi
+  80217d:	89 d3                	mov    %edx,%ebx
+  80217f:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  802181:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  802188:	74 2d                	je     8021b7 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80218a:	6a 07                	push   $0x7
+  80218c:	68 00 00 81 00       	push   $0x810000
+  802191:	57                   	push   %edi
+  802192:	ff 35 00 80 80 00    	push   0x808000
+  802198:	e8 1c 37 00 00       	call   8058b9 <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  80219d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8021a4:	6a 00                	push   $0x0
+  8021a6:	56                   	push   %esi
+  8021a7:	53                   	push   %ebx
+  8021a8:	6a 00                	push   $0x0
+  8021aa:	e8 bc 35 00 00       	call   80576b <ipc_recv_pages>
+}
+  8021af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b2:	5b                   	pop    %ebx
+  8021b3:	5e                   	pop    %esi
+  8021b4:	5f                   	pop    %edi
+  8021b5:	5d                   	pop    %ebp
+  8021b6:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8021b7:	83 ec 0c             	sub    $0xc,%esp
+  8021ba:	6a 01                	push   $0x1
+  8021bc:	e8 ed 37 00 00       	call   8059ae <ipc_find_env>
+  8021c1:	a3 00 80 80 00       	mov    %eax,0x808000
+  8021c6:	83 c4 10             	add    $0x10,%esp
+  8021c9:	eb bf                	jmp    80218a <fsipc_pages+0x18>
+
+008021cb <fsipc>:
+{
+  8021cb:	55                   	push   %ebp
+  8021cc:	89 e5                	mov    %esp,%ebp
+  8021ce:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8021d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8021d6:	e8 97 ff ff ff       	call   802172 <fsipc_pages>
+}
+  8021db:	c9                   	leave
+  8021dc:	c3                   	ret
+
+008021dd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8021dd:	55                   	push   %ebp
+  8021de:	89 e5                	mov    %esp,%ebp
+  8021e0:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8021e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021e6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021e9:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.set_size.req_size = newsize;
+  8021ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f1:	a3 04 00 81 00       	mov    %eax,0x810004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8021f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fb:	b8 02 00 00 00       	mov    $0x2,%eax
+  802200:	e8 c6 ff ff ff       	call   8021cb <fsipc>
+}
+  802205:	c9                   	leave
+  802206:	c3                   	ret
+
+00802207 <devfile_flush>:
+{
+  802207:	55                   	push   %ebp
+  802208:	89 e5                	mov    %esp,%ebp
+  80220a:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80220d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802210:	8b 40 0c             	mov    0xc(%eax),%eax
+  802213:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_FLUSH, NULL);
+  802218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221d:	b8 06 00 00 00       	mov    $0x6,%eax
+  802222:	e8 a4 ff ff ff       	call   8021cb <fsipc>
+}
+  802227:	c9                   	leave
+  802228:	c3                   	ret
+
+00802229 <devfile_stat>:
+{
+  802229:	55                   	push   %ebp
+  80222a:	89 e5                	mov    %esp,%ebp
+  80222c:	53                   	push   %ebx
+  80222d:	83 ec 04             	sub    $0x4,%esp
+  802230:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802233:	8b 45 08             	mov    0x8(%ebp),%eax
+  802236:	8b 40 0c             	mov    0xc(%eax),%eax
+  802239:	a3 00 00 81 00       	mov    %eax,0x810000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80223e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802243:	b8 05 00 00 00       	mov    $0x5,%eax
+  802248:	e8 7e ff ff ff       	call   8021cb <fsipc>
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	78 2c                	js     80227d <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802251:	83 ec 08             	sub    $0x8,%esp
+  802254:	68 00 00 81 00       	push   $0x810000
+  802259:	53                   	push   %ebx
+  80225a:	e8 4b e9 ff ff       	call   800baa <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80225f:	a1 80 00 81 00       	mov    0x810080,%eax
+  802264:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80226a:	a1 84 00 81 00       	mov    0x810084,%eax
+  80226f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  802275:	83 c4 10             	add    $0x10,%esp
+  802278:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80227d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802280:	c9                   	leave
+  802281:	c3                   	ret
+
+00802282 <devfile_write>:
+{
+  802282:	55                   	push   %ebp
+  802283:	89 e5                	mov    %esp,%ebp
+  802285:	83 ec 0c             	sub    $0xc,%esp
+  802288:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80228b:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  802290:	39 d0                	cmp    %edx,%eax
+  802292:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802295:	8b 55 08             	mov    0x8(%ebp),%edx
+  802298:	8b 52 0c             	mov    0xc(%edx),%edx
+  80229b:	89 15 00 00 81 00    	mov    %edx,0x810000
+	fsipcbuf.write.req_n = n;
+  8022a1:	a3 04 00 81 00       	mov    %eax,0x810004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8022a6:	50                   	push   %eax
+  8022a7:	ff 75 0c             	push   0xc(%ebp)
+  8022aa:	68 08 00 81 00       	push   $0x810008
+  8022af:	e8 7c ea ff ff       	call   800d30 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8022b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b9:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022be:	e8 08 ff ff ff       	call   8021cb <fsipc>
+}
+  8022c3:	c9                   	leave
+  8022c4:	c3                   	ret
+
+008022c5 <devfile_read>:
+{
+  8022c5:	55                   	push   %ebp
+  8022c6:	89 e5                	mov    %esp,%ebp
+  8022c8:	57                   	push   %edi
+  8022c9:	56                   	push   %esi
+  8022ca:	53                   	push   %ebx
+  8022cb:	83 ec 1c             	sub    $0x1c,%esp
+  8022ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022d1:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8022d4:	89 fe                	mov    %edi,%esi
+  8022d6:	c1 ee 0c             	shr    $0xc,%esi
+  8022d9:	b8 20 00 00 00       	mov    $0x20,%eax
+  8022de:	39 c6                	cmp    %eax,%esi
+  8022e0:	0f 47 f0             	cmova  %eax,%esi
+  8022e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022eb:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  8022ee:	eb 14                	jmp    802304 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  8022f0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  8022f7:	05 00 10 00 00       	add    $0x1000,%eax
+  8022fc:	f6 c6 06             	test   $0x6,%dh
+  8022ff:	75 42                	jne    802343 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  802301:	83 c1 01             	add    $0x1,%ecx
+  802304:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  802307:	39 f1                	cmp    %esi,%ecx
+  802309:	0f 84 95 00 00 00    	je     8023a4 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80230f:	89 c2                	mov    %eax,%edx
+  802311:	c1 ea 16             	shr    $0x16,%edx
+  802314:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80231b:	f6 c2 01             	test   $0x1,%dl
+  80231e:	74 23                	je     802343 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  802320:	89 c2                	mov    %eax,%edx
+  802322:	c1 ea 0c             	shr    $0xc,%edx
+  802325:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80232c:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  802332:	74 0f                	je     802343 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  802334:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  80233b:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  802341:	75 ad                	jne    8022f0 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  802343:	85 c9                	test   %ecx,%ecx
+  802345:	74 11                	je     802358 <devfile_read+0x93>
+  802347:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  80234e:	75 08                	jne    802358 <devfile_read+0x93>
+  802350:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  802356:	74 50                	je     8023a8 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802358:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80235b:	a3 00 00 81 00       	mov    %eax,0x810000
+	fsipcbuf.read.req_n = n;
+  802360:	89 3d 04 00 81 00    	mov    %edi,0x810004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802366:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236b:	b8 03 00 00 00       	mov    $0x3,%eax
+  802370:	e8 56 fe ff ff       	call   8021cb <fsipc>
+  802375:	89 c6                	mov    %eax,%esi
+  802377:	85 c0                	test   %eax,%eax
+  802379:	78 1f                	js     80239a <devfile_read+0xd5>
+	assert(r <= n);
+  80237b:	39 c7                	cmp    %eax,%edi
+  80237d:	72 50                	jb     8023cf <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  80237f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802384:	7f 62                	jg     8023e8 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  802386:	83 ec 04             	sub    $0x4,%esp
+  802389:	50                   	push   %eax
+  80238a:	68 00 00 81 00       	push   $0x810000
+  80238f:	ff 75 0c             	push   0xc(%ebp)
+  802392:	e8 99 e9 ff ff       	call   800d30 <memmove>
+	return r;
+  802397:	83 c4 10             	add    $0x10,%esp
+}
+  80239a:	89 f0                	mov    %esi,%eax
+  80239c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80239f:	5b                   	pop    %ebx
+  8023a0:	5e                   	pop    %esi
+  8023a1:	5f                   	pop    %edi
+  8023a2:	5d                   	pop    %ebp
+  8023a3:	c3                   	ret
+  8023a4:	89 f1                	mov    %esi,%ecx
+  8023a6:	eb 9b                	jmp    802343 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8023a8:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8023ab:	a3 00 00 81 00       	mov    %eax,0x810000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8023b0:	89 c8                	mov    %ecx,%eax
+  8023b2:	c1 e0 0c             	shl    $0xc,%eax
+  8023b5:	a3 04 00 81 00       	mov    %eax,0x810004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  8023ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023bd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8023c2:	e8 ab fd ff ff       	call   802172 <fsipc_pages>
+  8023c7:	89 c6                	mov    %eax,%esi
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	78 8b                	js     802358 <devfile_read+0x93>
+  8023cd:	eb cb                	jmp    80239a <devfile_read+0xd5>
+	assert(r <= n);
+  8023cf:	68 b4 62 80 00       	push   $0x8062b4
+  8023d4:	68 bb 62 80 00       	push   $0x8062bb
+  8023d9:	68 a0 00 00 00       	push   $0xa0
+  8023de:	68 d0 62 80 00       	push   $0x8062d0
+  8023e3:	e8 00 e1 ff ff       	call   8004e8 <_panic>
+	assert(r <= PGSIZE);
+  8023e8:	68 db 62 80 00       	push   $0x8062db
+  8023ed:	68 bb 62 80 00       	push   $0x8062bb
+  8023f2:	68 a1 00 00 00       	push   $0xa1
+  8023f7:	68 d0 62 80 00       	push   $0x8062d0
+  8023fc:	e8 e7 e0 ff ff       	call   8004e8 <_panic>
+
+00802401 <open>:
+{
+  802401:	55                   	push   %ebp
+  802402:	89 e5                	mov    %esp,%ebp
+  802404:	56                   	push   %esi
+  802405:	53                   	push   %ebx
+  802406:	83 ec 1c             	sub    $0x1c,%esp
+  802409:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  80240c:	56                   	push   %esi
+  80240d:	e8 5d e7 ff ff       	call   800b6f <strlen>
+  802412:	83 c4 10             	add    $0x10,%esp
+  802415:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80241a:	7f 6c                	jg     802488 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  80241c:	83 ec 0c             	sub    $0xc,%esp
+  80241f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802422:	50                   	push   %eax
+  802423:	e8 eb f7 ff ff       	call   801c13 <fd_alloc>
+  802428:	89 c3                	mov    %eax,%ebx
+  80242a:	83 c4 10             	add    $0x10,%esp
+  80242d:	85 c0                	test   %eax,%eax
+  80242f:	78 3c                	js     80246d <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  802431:	83 ec 08             	sub    $0x8,%esp
+  802434:	56                   	push   %esi
+  802435:	68 00 00 81 00       	push   $0x810000
+  80243a:	e8 6b e7 ff ff       	call   800baa <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80243f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802442:	a3 00 04 81 00       	mov    %eax,0x810400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802447:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80244a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80244f:	e8 77 fd ff ff       	call   8021cb <fsipc>
+  802454:	89 c3                	mov    %eax,%ebx
+  802456:	83 c4 10             	add    $0x10,%esp
+  802459:	85 c0                	test   %eax,%eax
+  80245b:	78 19                	js     802476 <open+0x75>
+	return fd2num(fd);
+  80245d:	83 ec 0c             	sub    $0xc,%esp
+  802460:	ff 75 f4             	push   -0xc(%ebp)
+  802463:	e8 84 f7 ff ff       	call   801bec <fd2num>
+  802468:	89 c3                	mov    %eax,%ebx
+  80246a:	83 c4 10             	add    $0x10,%esp
+}
+  80246d:	89 d8                	mov    %ebx,%eax
+  80246f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802472:	5b                   	pop    %ebx
+  802473:	5e                   	pop    %esi
+  802474:	5d                   	pop    %ebp
+  802475:	c3                   	ret
+		fd_close(fd, 0);
+  802476:	83 ec 08             	sub    $0x8,%esp
+  802479:	6a 00                	push   $0x0
+  80247b:	ff 75 f4             	push   -0xc(%ebp)
+  80247e:	e8 80 f8 ff ff       	call   801d03 <fd_close>
+		return r;
+  802483:	83 c4 10             	add    $0x10,%esp
+  802486:	eb e5                	jmp    80246d <open+0x6c>
+		return -E_BAD_PATH;
+  802488:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80248d:	eb de                	jmp    80246d <open+0x6c>
+
+0080248f <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80248f:	55                   	push   %ebp
+  802490:	89 e5                	mov    %esp,%ebp
+  802492:	53                   	push   %ebx
+  802493:	83 ec 10             	sub    $0x10,%esp
+  802496:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802499:	53                   	push   %ebx
+  80249a:	e8 d0 e6 ff ff       	call   800b6f <strlen>
+  80249f:	83 c4 10             	add    $0x10,%esp
+  8024a2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8024a7:	7f 25                	jg     8024ce <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8024a9:	83 ec 08             	sub    $0x8,%esp
+  8024ac:	53                   	push   %ebx
+  8024ad:	68 00 00 81 00       	push   $0x810000
+  8024b2:	e8 f3 e6 ff ff       	call   800baa <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8024b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024bc:	b8 07 00 00 00       	mov    $0x7,%eax
+  8024c1:	e8 05 fd ff ff       	call   8021cb <fsipc>
+  8024c6:	83 c4 10             	add    $0x10,%esp
+}
+  8024c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024cc:	c9                   	leave
+  8024cd:	c3                   	ret
+		return -E_BAD_PATH;
+  8024ce:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8024d3:	eb f4                	jmp    8024c9 <remove+0x3a>
+
+008024d5 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024d5:	55                   	push   %ebp
+  8024d6:	89 e5                	mov    %esp,%ebp
+  8024d8:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8024db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024e5:	e8 e1 fc ff ff       	call   8021cb <fsipc>
+}
+  8024ea:	c9                   	leave
+  8024eb:	c3                   	ret
+
+008024ec <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  8024ec:	55                   	push   %ebp
+  8024ed:	89 e5                	mov    %esp,%ebp
+  8024ef:	53                   	push   %ebx
+  8024f0:	83 ec 04             	sub    $0x4,%esp
+  8024f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  8024f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802500:	e8 c6 fc ff ff       	call   8021cb <fsipc>
+  802505:	85 c0                	test   %eax,%eax
+  802507:	78 3c                	js     802545 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  802509:	a1 00 00 81 00       	mov    0x810000,%eax
+  80250e:	89 03                	mov    %eax,(%ebx)
+  802510:	a1 04 00 81 00       	mov    0x810004,%eax
+  802515:	89 43 04             	mov    %eax,0x4(%ebx)
+  802518:	a1 08 00 81 00       	mov    0x810008,%eax
+  80251d:	89 43 08             	mov    %eax,0x8(%ebx)
+  802520:	a1 0c 00 81 00       	mov    0x81000c,%eax
+  802525:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802528:	a1 10 00 81 00       	mov    0x810010,%eax
+  80252d:	89 43 10             	mov    %eax,0x10(%ebx)
+  802530:	a1 14 00 81 00       	mov    0x810014,%eax
+  802535:	89 43 14             	mov    %eax,0x14(%ebx)
+  802538:	a1 18 00 81 00       	mov    0x810018,%eax
+  80253d:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  802540:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802548:	c9                   	leave
+  802549:	c3                   	ret
+
+0080254a <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  80254a:	55                   	push   %ebp
+  80254b:	89 e5                	mov    %esp,%ebp
+  80254d:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  802550:	8b 45 08             	mov    0x8(%ebp),%eax
+  802553:	a3 00 00 81 00       	mov    %eax,0x810000
+	return fsipc(FSREQ_BCSET, NULL);
+  802558:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802562:	e8 64 fc ff ff       	call   8021cb <fsipc>
+}
+  802567:	c9                   	leave
+  802568:	c3                   	ret
+
+00802569 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802569:	55                   	push   %ebp
+  80256a:	89 e5                	mov    %esp,%ebp
+  80256c:	57                   	push   %edi
+  80256d:	56                   	push   %esi
+  80256e:	53                   	push   %ebx
+  80256f:	81 ec 14 03 00 00    	sub    $0x314,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802575:	6a 00                	push   $0x0
+  802577:	ff 75 08             	push   0x8(%ebp)
+  80257a:	e8 82 fe ff ff       	call   802401 <open>
+  80257f:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  802585:	83 c4 10             	add    $0x10,%esp
+  802588:	85 c0                	test   %eax,%eax
+  80258a:	0f 88 06 06 00 00    	js     802b96 <spawn+0x62d>
+  802590:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802592:	83 ec 04             	sub    $0x4,%esp
+  802595:	68 00 02 00 00       	push   $0x200
+  80259a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8025a0:	50                   	push   %eax
+  8025a1:	51                   	push   %ecx
+  8025a2:	e8 a6 f9 ff ff       	call   801f4d <readn>
+  8025a7:	83 c4 10             	add    $0x10,%esp
+  8025aa:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8025af:	75 74                	jne    802625 <spawn+0xbc>
+	    || elf->e_magic != ELF_MAGIC) {
+  8025b1:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8025b8:	45 4c 46 
+  8025bb:	75 68                	jne    802625 <spawn+0xbc>
+  8025bd:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025c2:	cd 30                	int    $0x30
+  8025c4:	89 85 0c fd ff ff    	mov    %eax,-0x2f4(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  8025ca:	85 c0                	test   %eax,%eax
+  8025cc:	0f 88 b8 05 00 00    	js     802b8a <spawn+0x621>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  8025d2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8025d7:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8025da:	c1 e6 06             	shl    $0x6,%esi
+  8025dd:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8025e3:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8025e9:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8025ee:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  8025f0:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8025f6:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  8025fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802601:	be 00 00 00 00       	mov    $0x0,%esi
+  802606:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802609:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80260c:	85 c0                	test   %eax,%eax
+  80260e:	74 4d                	je     80265d <spawn+0xf4>
+		string_size += strlen(argv[argc]) + 1;
+  802610:	83 ec 0c             	sub    $0xc,%esp
+  802613:	50                   	push   %eax
+  802614:	e8 56 e5 ff ff       	call   800b6f <strlen>
+  802619:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  80261d:	83 c3 01             	add    $0x1,%ebx
+  802620:	83 c4 10             	add    $0x10,%esp
+  802623:	eb e4                	jmp    802609 <spawn+0xa0>
+		close(fd);
+  802625:	83 ec 0c             	sub    $0xc,%esp
+  802628:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  80262e:	e8 57 f7 ff ff       	call   801d8a <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802633:	83 c4 0c             	add    $0xc,%esp
+  802636:	68 7f 45 4c 46       	push   $0x464c457f
+  80263b:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802641:	68 e7 62 80 00       	push   $0x8062e7
+  802646:	e8 78 df ff ff       	call   8005c3 <cprintf>
+		return -E_NOT_EXEC;
+  80264b:	83 c4 10             	add    $0x10,%esp
+  80264e:	c7 85 10 fd ff ff f2 	movl   $0xfffffff2,-0x2f0(%ebp)
+  802655:	ff ff ff 
+  802658:	e9 39 05 00 00       	jmp    802b96 <spawn+0x62d>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  80265d:	89 9d 04 fd ff ff    	mov    %ebx,-0x2fc(%ebp)
+  802663:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802668:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80266a:	89 fa                	mov    %edi,%edx
+  80266c:	83 e2 fc             	and    $0xfffffffc,%edx
+  80266f:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802676:	29 c2                	sub    %eax,%edx
+  802678:	89 95 14 fd ff ff    	mov    %edx,-0x2ec(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  80267e:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802681:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802686:	0f 86 18 05 00 00    	jbe    802ba4 <spawn+0x63b>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80268c:	83 ec 04             	sub    $0x4,%esp
+  80268f:	6a 07                	push   $0x7
+  802691:	68 00 00 40 00       	push   $0x400000
+  802696:	6a 00                	push   $0x0
+  802698:	e8 00 ea ff ff       	call   80109d <sys_page_alloc>
+  80269d:	83 c4 10             	add    $0x10,%esp
+  8026a0:	85 c0                	test   %eax,%eax
+  8026a2:	0f 88 01 05 00 00    	js     802ba9 <spawn+0x640>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  8026a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ad:	89 9d 08 fd ff ff    	mov    %ebx,-0x2f8(%ebp)
+  8026b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8026b6:	eb 30                	jmp    8026e8 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  8026b8:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8026be:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  8026c4:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+		strcpy(string_store, argv[i]);
+  8026c7:	83 ec 08             	sub    $0x8,%esp
+  8026ca:	ff 34 b3             	push   (%ebx,%esi,4)
+  8026cd:	57                   	push   %edi
+  8026ce:	e8 d7 e4 ff ff       	call   800baa <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  8026d3:	83 c4 04             	add    $0x4,%esp
+  8026d6:	ff 34 b3             	push   (%ebx,%esi,4)
+  8026d9:	e8 91 e4 ff ff       	call   800b6f <strlen>
+  8026de:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  8026e2:	83 c6 01             	add    $0x1,%esi
+  8026e5:	83 c4 10             	add    $0x10,%esp
+  8026e8:	39 b5 08 fd ff ff    	cmp    %esi,-0x2f8(%ebp)
+  8026ee:	7f c8                	jg     8026b8 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  8026f0:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  8026f6:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  8026fc:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802703:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802709:	0f 85 fb 00 00 00    	jne    80280a <spawn+0x2a1>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  80270f:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  802715:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  80271b:	89 41 fc             	mov    %eax,-0x4(%ecx)
+	argv_store[-2] = argc;
+  80271e:	89 c8                	mov    %ecx,%eax
+  802720:	8b 8d 04 fd ff ff    	mov    -0x2fc(%ebp),%ecx
+  802726:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802729:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80272e:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802734:	83 ec 0c             	sub    $0xc,%esp
+  802737:	6a 07                	push   $0x7
+  802739:	68 00 d0 bf ee       	push   $0xeebfd000
+  80273e:	8b b5 0c fd ff ff    	mov    -0x2f4(%ebp),%esi
+  802744:	56                   	push   %esi
+  802745:	68 00 00 40 00       	push   $0x400000
+  80274a:	6a 00                	push   $0x0
+  80274c:	e8 8f e9 ff ff       	call   8010e0 <sys_page_map>
+  802751:	89 c3                	mov    %eax,%ebx
+  802753:	83 c4 20             	add    $0x20,%esp
+  802756:	85 c0                	test   %eax,%eax
+  802758:	0f 88 53 04 00 00    	js     802bb1 <spawn+0x648>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80275e:	83 ec 08             	sub    $0x8,%esp
+  802761:	68 00 00 40 00       	push   $0x400000
+  802766:	6a 00                	push   $0x0
+  802768:	e8 b5 e9 ff ff       	call   801122 <sys_page_unmap>
+  80276d:	89 c3                	mov    %eax,%ebx
+  80276f:	83 c4 10             	add    $0x10,%esp
+  802772:	85 c0                	test   %eax,%eax
+  802774:	0f 88 37 04 00 00    	js     802bb1 <spawn+0x648>
+	if ((r = fd_lookup(fd, &fdp)) < 0)
+  80277a:	83 ec 08             	sub    $0x8,%esp
+  80277d:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  802783:	50                   	push   %eax
+  802784:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  80278a:	e8 d8 f4 ff ff       	call   801c67 <fd_lookup>
+  80278f:	89 c7                	mov    %eax,%edi
+  802791:	83 c4 10             	add    $0x10,%esp
+  802794:	85 c0                	test   %eax,%eax
+  802796:	0f 88 d6 01 00 00    	js     802972 <spawn+0x409>
+	if ((r = sys_page_map(0, fdp, child, (void*) PROGFD, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80279c:	83 ec 0c             	sub    $0xc,%esp
+  80279f:	68 07 04 00 00       	push   $0x407
+  8027a4:	68 00 f0 ff cf       	push   $0xcffff000
+  8027a9:	56                   	push   %esi
+  8027aa:	ff b5 a0 fd ff ff    	push   -0x260(%ebp)
+  8027b0:	6a 00                	push   $0x0
+  8027b2:	e8 29 e9 ff ff       	call   8010e0 <sys_page_map>
+  8027b7:	89 c7                	mov    %eax,%edi
+  8027b9:	83 c4 20             	add    $0x20,%esp
+  8027bc:	85 c0                	test   %eax,%eax
+  8027be:	0f 88 ae 01 00 00    	js     802972 <spawn+0x409>
+	pager = ipc_find_env(ENV_TYPE_FS);
+  8027c4:	83 ec 0c             	sub    $0xc,%esp
+  8027c7:	6a 01                	push   $0x1
+  8027c9:	e8 e0 31 00 00       	call   8059ae <ipc_find_env>
+  8027ce:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%ebp)
+	memset(segs, 0, sizeof(segs));
+  8027d4:	83 c4 0c             	add    $0xc,%esp
+  8027d7:	68 80 00 00 00       	push   $0x80
+  8027dc:	6a 00                	push   $0x0
+  8027de:	8d 9d 20 fd ff ff    	lea    -0x2e0(%ebp),%ebx
+  8027e4:	53                   	push   %ebx
+  8027e5:	e8 11 e5 ff ff       	call   800cfb <memset>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  8027ea:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8027f0:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8027f7:	83 c4 10             	add    $0x10,%esp
+  8027fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ff:	89 fe                	mov    %edi,%esi
+  802801:	89 d1                	mov    %edx,%ecx
+  802803:	89 da                	mov    %ebx,%edx
+  802805:	e9 bf 01 00 00       	jmp    8029c9 <spawn+0x460>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  80280a:	68 5c 63 80 00       	push   $0x80635c
+  80280f:	68 bb 62 80 00       	push   $0x8062bb
+  802814:	68 17 01 00 00       	push   $0x117
+  802819:	68 01 63 80 00       	push   $0x806301
+  80281e:	e8 c5 dc ff ff       	call   8004e8 <_panic>
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802823:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802826:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+  80282c:	8b 46 10             	mov    0x10(%esi),%eax
+  80282f:	89 85 14 fd ff ff    	mov    %eax,-0x2ec(%ebp)
+  802835:	8b 7e 14             	mov    0x14(%esi),%edi
+  802838:	89 bd 08 fd ff ff    	mov    %edi,-0x2f8(%ebp)
+  80283e:	8b 7e 08             	mov    0x8(%esi),%edi
+	int i, r;
+	void *blk;
+
+	//cprintf("map_segment %x+%x\n", va, memsz);
+
+	if ((i = PGOFF(va))) {
+  802841:	89 f8                	mov    %edi,%eax
+  802843:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802848:	74 16                	je     802860 <spawn+0x2f7>
+		va -= i;
+  80284a:	29 c7                	sub    %eax,%edi
+		memsz += i;
+  80284c:	01 85 08 fd ff ff    	add    %eax,-0x2f8(%ebp)
+		filesz += i;
+  802852:	01 85 14 fd ff ff    	add    %eax,-0x2ec(%ebp)
+		fileoffset -= i;
+  802858:	29 c3                	sub    %eax,%ebx
+  80285a:	89 9d 00 fd ff ff    	mov    %ebx,-0x300(%ebp)
+	}
+
+	for (i = 0; i < memsz; i += PGSIZE) {
+  802860:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802865:	89 8d fc fc ff ff    	mov    %ecx,-0x304(%ebp)
+  80286b:	89 b5 f8 fc ff ff    	mov    %esi,-0x308(%ebp)
+  802871:	8b b5 14 fd ff ff    	mov    -0x2ec(%ebp),%esi
+  802877:	89 95 f4 fc ff ff    	mov    %edx,-0x30c(%ebp)
+  80287d:	e9 ba 00 00 00       	jmp    80293c <spawn+0x3d3>
+			// allocate a blank page
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+				return r;
+		} else {
+			// from file
+			if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802882:	83 ec 04             	sub    $0x4,%esp
+  802885:	6a 07                	push   $0x7
+  802887:	68 00 00 40 00       	push   $0x400000
+  80288c:	6a 00                	push   $0x0
+  80288e:	e8 0a e8 ff ff       	call   80109d <sys_page_alloc>
+  802893:	83 c4 10             	add    $0x10,%esp
+  802896:	85 c0                	test   %eax,%eax
+  802898:	0f 88 d7 02 00 00    	js     802b75 <spawn+0x60c>
+				return r;
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  80289e:	83 ec 08             	sub    $0x8,%esp
+  8028a1:	8b 95 00 fd ff ff    	mov    -0x300(%ebp),%edx
+  8028a7:	8b 85 14 fd ff ff    	mov    -0x2ec(%ebp),%eax
+  8028ad:	01 d0                	add    %edx,%eax
+  8028af:	50                   	push   %eax
+  8028b0:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8028b6:	e8 5b f7 ff ff       	call   802016 <seek>
+  8028bb:	83 c4 10             	add    $0x10,%esp
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	0f 88 b6 02 00 00    	js     802b7c <spawn+0x613>
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+  8028c6:	83 ec 04             	sub    $0x4,%esp
+  8028c9:	89 f2                	mov    %esi,%edx
+  8028cb:	8b 8d 14 fd ff ff    	mov    -0x2ec(%ebp),%ecx
+  8028d1:	29 ca                	sub    %ecx,%edx
+  8028d3:	89 d0                	mov    %edx,%eax
+  8028d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028da:	39 d0                	cmp    %edx,%eax
+  8028dc:	0f 47 c2             	cmova  %edx,%eax
+  8028df:	50                   	push   %eax
+  8028e0:	68 00 00 40 00       	push   $0x400000
+  8028e5:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  8028eb:	e8 5d f6 ff ff       	call   801f4d <readn>
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	0f 88 88 02 00 00    	js     802b83 <spawn+0x61a>
+				return r;
+			if ((r = sys_page_map(0, UTEMP, child, (void*) (va + i), perm)) < 0)
+  8028fb:	83 ec 0c             	sub    $0xc,%esp
+  8028fe:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  802904:	57                   	push   %edi
+  802905:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80290b:	68 00 00 40 00       	push   $0x400000
+  802910:	6a 00                	push   $0x0
+  802912:	e8 c9 e7 ff ff       	call   8010e0 <sys_page_map>
+  802917:	83 c4 20             	add    $0x20,%esp
+  80291a:	85 c0                	test   %eax,%eax
+  80291c:	78 7e                	js     80299c <spawn+0x433>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP);
+  80291e:	83 ec 08             	sub    $0x8,%esp
+  802921:	68 00 00 40 00       	push   $0x400000
+  802926:	6a 00                	push   $0x0
+  802928:	e8 f5 e7 ff ff       	call   801122 <sys_page_unmap>
+  80292d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < memsz; i += PGSIZE) {
+  802930:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802936:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80293c:	89 9d 14 fd ff ff    	mov    %ebx,-0x2ec(%ebp)
+  802942:	8b 85 08 fd ff ff    	mov    -0x2f8(%ebp),%eax
+  802948:	39 c3                	cmp    %eax,%ebx
+  80294a:	73 65                	jae    8029b1 <spawn+0x448>
+		if (i >= filesz) {
+  80294c:	39 f3                	cmp    %esi,%ebx
+  80294e:	0f 82 2e ff ff ff    	jb     802882 <spawn+0x319>
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  802954:	83 ec 04             	sub    $0x4,%esp
+  802957:	ff b5 04 fd ff ff    	push   -0x2fc(%ebp)
+  80295d:	57                   	push   %edi
+  80295e:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802964:	e8 34 e7 ff ff       	call   80109d <sys_page_alloc>
+  802969:	83 c4 10             	add    $0x10,%esp
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	79 c0                	jns    802930 <spawn+0x3c7>
+  802970:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802972:	83 ec 0c             	sub    $0xc,%esp
+  802975:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  80297b:	e8 9e e6 ff ff       	call   80101e <sys_env_destroy>
+	close(fd);
+  802980:	83 c4 04             	add    $0x4,%esp
+  802983:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  802989:	e8 fc f3 ff ff       	call   801d8a <close>
+	return r;
+  80298e:	83 c4 10             	add    $0x10,%esp
+  802991:	89 bd 10 fd ff ff    	mov    %edi,-0x2f0(%ebp)
+  802997:	e9 fa 01 00 00       	jmp    802b96 <spawn+0x62d>
+				panic("spawn: sys_page_map data: %e", r);
+  80299c:	50                   	push   %eax
+  80299d:	68 0d 63 80 00       	push   $0x80630d
+  8029a2:	68 4a 01 00 00       	push   $0x14a
+  8029a7:	68 01 63 80 00       	push   $0x806301
+  8029ac:	e8 37 db ff ff       	call   8004e8 <_panic>
+  8029b1:	8b 8d fc fc ff ff    	mov    -0x304(%ebp),%ecx
+  8029b7:	8b b5 f8 fc ff ff    	mov    -0x308(%ebp),%esi
+  8029bd:	8b 95 f4 fc ff ff    	mov    -0x30c(%ebp),%edx
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8029c3:	83 c1 01             	add    $0x1,%ecx
+  8029c6:	83 c6 20             	add    $0x20,%esi
+  8029c9:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8029d0:	39 c8                	cmp    %ecx,%eax
+  8029d2:	7e 74                	jle    802a48 <spawn+0x4df>
+		if (ph->p_type != ELF_PROG_LOAD)
+  8029d4:	83 3e 01             	cmpl   $0x1,(%esi)
+  8029d7:	75 ea                	jne    8029c3 <spawn+0x45a>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8029d9:	8b 46 18             	mov    0x18(%esi),%eax
+  8029dc:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  8029df:	83 f8 01             	cmp    $0x1,%eax
+  8029e2:	19 ff                	sbb    %edi,%edi
+  8029e4:	83 e7 fe             	and    $0xfffffffe,%edi
+  8029e7:	83 c7 07             	add    $0x7,%edi
+  8029ea:	89 bd 04 fd ff ff    	mov    %edi,-0x2fc(%ebp)
+		if (seg < segs + NSEGS) {
+  8029f0:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  8029f6:	39 c2                	cmp    %eax,%edx
+  8029f8:	0f 83 25 fe ff ff    	jae    802823 <spawn+0x2ba>
+			seg->seg_va = ROUNDDOWN(ph->p_va, PGSIZE);
+  8029fe:	8b 46 08             	mov    0x8(%esi),%eax
+  802a01:	89 c3                	mov    %eax,%ebx
+  802a03:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802a09:	89 1a                	mov    %ebx,(%edx)
+			seg->seg_memsz = ph->p_memsz + PGOFF(ph->p_va);
+  802a0b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802a10:	89 c3                	mov    %eax,%ebx
+  802a12:	03 5e 14             	add    0x14(%esi),%ebx
+  802a15:	89 5a 04             	mov    %ebx,0x4(%edx)
+			seg->seg_filesz = ph->p_filesz + PGOFF(ph->p_va);
+  802a18:	89 c3                	mov    %eax,%ebx
+  802a1a:	03 5e 10             	add    0x10(%esi),%ebx
+  802a1d:	89 5a 08             	mov    %ebx,0x8(%edx)
+			seg->seg_offset = ph->p_offset - PGOFF(ph->p_va);
+  802a20:	8b 5e 04             	mov    0x4(%esi),%ebx
+  802a23:	29 c3                	sub    %eax,%ebx
+  802a25:	89 5a 0c             	mov    %ebx,0xc(%edx)
+			seg->seg_perm = perm;
+  802a28:	89 7a 10             	mov    %edi,0x10(%edx)
+			seg->seg_pager = pager;
+  802a2b:	8b 85 f0 fc ff ff    	mov    -0x310(%ebp),%eax
+  802a31:	89 42 14             	mov    %eax,0x14(%edx)
+			seg->seg_fileid = fdp->fd_file.id;
+  802a34:	8b 85 a0 fd ff ff    	mov    -0x260(%ebp),%eax
+  802a3a:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a3d:	89 42 18             	mov    %eax,0x18(%edx)
+			seg++;
+  802a40:	83 c2 20             	add    $0x20,%edx
+			continue;
+  802a43:	e9 7b ff ff ff       	jmp    8029c3 <spawn+0x45a>
+	if ((r = sys_env_set_segments(child, segs, seg - segs)) < 0)
+  802a48:	89 d1                	mov    %edx,%ecx
+  802a4a:	83 ec 04             	sub    $0x4,%esp
+  802a4d:	8d 95 20 fd ff ff    	lea    -0x2e0(%ebp),%edx
+  802a53:	89 c8                	mov    %ecx,%eax
+  802a55:	29 d0                	sub    %edx,%eax
+  802a57:	c1 f8 05             	sar    $0x5,%eax
+  802a5a:	50                   	push   %eax
+  802a5b:	52                   	push   %edx
+  802a5c:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802a62:	e8 48 e9 ff ff       	call   8013af <sys_env_set_segments>
+  802a67:	89 c7                	mov    %eax,%edi
+  802a69:	83 c4 10             	add    $0x10,%esp
+  802a6c:	85 c0                	test   %eax,%eax
+  802a6e:	0f 88 fe fe ff ff    	js     802972 <spawn+0x409>
+	close(fd);
+  802a74:	83 ec 0c             	sub    $0xc,%esp
+  802a77:	ff b5 10 fd ff ff    	push   -0x2f0(%ebp)
+  802a7d:	e8 08 f3 ff ff       	call   801d8a <close>
+  802a82:	83 c4 10             	add    $0x10,%esp
+	// Copy the mappings for shared pages into the child address.
+	// We need to iterate through all PTEs for addresses below UTOP.
+	// However, we handle the exception stack separately, so we only need to iterate up until UXSTACKTOP-PGSIZE.
+	// Since [USTACKTOP, UXSTACKTOP-PGSIZE) is empty memory, we can get away with only iterating up until USTACKTOP.
+	// This is the same as iterating through pages 0 through PGNUM(USTACKTOP)-1 inclusive.
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  802a85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a8a:	eb 2d                	jmp    802ab9 <spawn+0x550>
+		// We only copy this page if it is present and readable in user mode, and if it is a shared page.
+		// This requires checking for PTE_P and PTE_U not only in uvpt[pn],
+		// but in the associated PDE as well, since page pn won't exist if its page table doesn't exist, i.e. if it isn't present in the page directory.
+		// Large pages are never shared (see sys_page_alloc), and have no uvpt entries.
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+			sys_page_map(0, (void *)PGADDR(0,pn,0), child, (void *)PGADDR(0,pn,0), uvpt[pn]&PTE_SYSCALL);
+  802a8c:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802a93:	83 ec 0c             	sub    $0xc,%esp
+  802a96:	25 07 0e 00 00       	and    $0xe07,%eax
+  802a9b:	50                   	push   %eax
+  802a9c:	52                   	push   %edx
+  802a9d:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802aa3:	52                   	push   %edx
+  802aa4:	6a 00                	push   $0x0
+  802aa6:	e8 35 e6 ff ff       	call   8010e0 <sys_page_map>
+  802aab:	83 c4 20             	add    $0x20,%esp
+	for (pn = 0; pn < PGNUM(USTACKTOP); ++pn) {
+  802aae:	83 c3 01             	add    $0x1,%ebx
+  802ab1:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  802ab7:	74 51                	je     802b0a <spawn+0x5a1>
+		if (((uvpd[PDX(PGADDR(0,pn,0))]&PTE_P) && (uvpd[PDX(PGADDR(0,pn,0))]&PTE_U) && !(uvpd[PDX(PGADDR(0,pn,0))]&PTE_PS)) && ((uvpt[pn]&PTE_P) && (uvpt[pn]&PTE_U) && (uvpt[pn]&PTE_SHARE))) {
+  802ab9:	89 da                	mov    %ebx,%edx
+  802abb:	c1 e2 0c             	shl    $0xc,%edx
+  802abe:	89 d0                	mov    %edx,%eax
+  802ac0:	c1 e8 16             	shr    $0x16,%eax
+  802ac3:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  802aca:	f6 c1 01             	test   $0x1,%cl
+  802acd:	74 df                	je     802aae <spawn+0x545>
+  802acf:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  802ad6:	f6 c1 04             	test   $0x4,%cl
+  802ad9:	74 d3                	je     802aae <spawn+0x545>
+  802adb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ae2:	a8 80                	test   $0x80,%al
+  802ae4:	75 c8                	jne    802aae <spawn+0x545>
+  802ae6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802aed:	a8 01                	test   $0x1,%al
+  802aef:	74 bd                	je     802aae <spawn+0x545>
+  802af1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802af8:	a8 04                	test   $0x4,%al
+  802afa:	74 b2                	je     802aae <spawn+0x545>
+  802afc:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802b03:	f6 c4 04             	test   $0x4,%ah
+  802b06:	74 a6                	je     802aae <spawn+0x545>
+  802b08:	eb 82                	jmp    802a8c <spawn+0x523>
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  802b0a:	83 ec 08             	sub    $0x8,%esp
+  802b0d:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802b13:	50                   	push   %eax
+  802b14:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802b1a:	e8 fe e7 ff ff       	call   80131d <sys_env_set_trapframe>
+  802b1f:	83 c4 10             	add    $0x10,%esp
+  802b22:	85 c0                	test   %eax,%eax
+  802b24:	78 25                	js     802b4b <spawn+0x5e2>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  802b26:	83 ec 08             	sub    $0x8,%esp
+  802b29:	6a 02                	push   $0x2
+  802b2b:	ff b5 0c fd ff ff    	push   -0x2f4(%ebp)
+  802b31:	e8 a5 e7 ff ff       	call   8012db <sys_env_set_status>
+  802b36:	83 c4 10             	add    $0x10,%esp
+  802b39:	85 c0                	test   %eax,%eax
+  802b3b:	78 23                	js     802b60 <spawn+0x5f7>
+	return child;
+  802b3d:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  802b43:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  802b49:	eb 4b                	jmp    802b96 <spawn+0x62d>
+		panic("sys_env_set_trapframe: %e", r);
+  802b4b:	50                   	push   %eax
+  802b4c:	68 2a 63 80 00       	push   $0x80632a
+  802b51:	68 ab 00 00 00       	push   $0xab
+  802b56:	68 01 63 80 00       	push   $0x806301
+  802b5b:	e8 88 d9 ff ff       	call   8004e8 <_panic>
+		panic("sys_env_set_status: %e", r);
+  802b60:	50                   	push   %eax
+  802b61:	68 44 63 80 00       	push   $0x806344
+  802b66:	68 ae 00 00 00       	push   $0xae
+  802b6b:	68 01 63 80 00       	push   $0x806301
+  802b70:	e8 73 d9 ff ff       	call   8004e8 <_panic>
+  802b75:	89 c7                	mov    %eax,%edi
+  802b77:	e9 f6 fd ff ff       	jmp    802972 <spawn+0x409>
+  802b7c:	89 c7                	mov    %eax,%edi
+  802b7e:	e9 ef fd ff ff       	jmp    802972 <spawn+0x409>
+  802b83:	89 c7                	mov    %eax,%edi
+  802b85:	e9 e8 fd ff ff       	jmp    802972 <spawn+0x409>
+		return r;
+  802b8a:	8b 85 0c fd ff ff    	mov    -0x2f4(%ebp),%eax
+  802b90:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+}
+  802b96:	8b 85 10 fd ff ff    	mov    -0x2f0(%ebp),%eax
+  802b9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b9f:	5b                   	pop    %ebx
+  802ba0:	5e                   	pop    %esi
+  802ba1:	5f                   	pop    %edi
+  802ba2:	5d                   	pop    %ebp
+  802ba3:	c3                   	ret
+		return -E_NO_MEM;
+  802ba4:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  802ba9:	89 85 10 fd ff ff    	mov    %eax,-0x2f0(%ebp)
+  802baf:	eb e5                	jmp    802b96 <spawn+0x62d>
+	sys_page_unmap(0, UTEMP);
+  802bb1:	83 ec 08             	sub    $0x8,%esp
+  802bb4:	68 00 00 40 00       	push   $0x400000
+  802bb9:	6a 00                	push   $0x0
+  802bbb:	e8 62 e5 ff ff       	call   801122 <sys_page_unmap>
+  802bc0:	83 c4 10             	add    $0x10,%esp
+  802bc3:	89 9d 10 fd ff ff    	mov    %ebx,-0x2f0(%ebp)
+  802bc9:	eb cb                	jmp    802b96 <spawn+0x62d>
+
+00802bcb <spawnl>:
+{
+  802bcb:	55                   	push   %ebp
+  802bcc:	89 e5                	mov    %esp,%ebp
+  802bce:	56                   	push   %esi
+  802bcf:	53                   	push   %ebx
+	va_start(vl, arg0);
+  802bd0:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  802bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  802bd8:	eb 05                	jmp    802bdf <spawnl+0x14>
+		argc++;
+  802bda:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  802bdd:	89 ca                	mov    %ecx,%edx
+  802bdf:	8d 4a 04             	lea    0x4(%edx),%ecx
+  802be2:	83 3a 00             	cmpl   $0x0,(%edx)
+  802be5:	75 f3                	jne    802bda <spawnl+0xf>
+	const char *argv[argc+2];
+  802be7:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  802bee:	83 e2 f0             	and    $0xfffffff0,%edx
+  802bf1:	29 d4                	sub    %edx,%esp
+  802bf3:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802bf7:	89 da                	mov    %ebx,%edx
+  802bf9:	c1 ea 02             	shr    $0x2,%edx
+  802bfc:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  802bff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c02:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  802c09:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  802c10:	00 
+	va_start(vl, arg0);
+  802c11:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  802c14:	89 c2                	mov    %eax,%edx
+  802c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1b:	eb 0b                	jmp    802c28 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  802c1d:	83 c0 01             	add    $0x1,%eax
+  802c20:	8b 31                	mov    (%ecx),%esi
+  802c22:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  802c25:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  802c28:	39 d0                	cmp    %edx,%eax
+  802c2a:	75 f1                	jne    802c1d <spawnl+0x52>
+	return spawn(prog, argv);
+  802c2c:	83 ec 08             	sub    $0x8,%esp
+  802c2f:	53                   	push   %ebx
+  802c30:	ff 75 08             	push   0x8(%ebp)
+  802c33:	e8 31 f9 ff ff       	call   802569 <spawn>
+}
+  802c38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c3b:	5b                   	pop    %ebx
+  802c3c:	5e                   	pop    %esi
+  802c3d:	5d                   	pop    %ebp
+  802c3e:	c3                   	ret
+
+00802c3f <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c3f:	55                   	push   %ebp
+  802c40:	89 e5                	mov    %esp,%ebp
+  802c42:	56                   	push   %esi
+  802c43:	53                   	push   %ebx
+  802c44:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802c47:	83 ec 0c             	sub    $0xc,%esp
+  802c4a:	ff 75 08             	push   0x8(%ebp)
+  802c4d:	e8 aa ef ff ff       	call   801bfc <fd2data>
+  802c52:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802c54:	83 c4 08             	add    $0x8,%esp
+  802c57:	68 82 63 80 00       	push   $0x806382
+  802c5c:	53                   	push   %ebx
+  802c5d:	e8 48 df ff ff       	call   800baa <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802c62:	8b 46 04             	mov    0x4(%esi),%eax
+  802c65:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  802c6b:	2b 0e                	sub    (%esi),%ecx
+  802c6d:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  802c72:	89 c8                	mov    %ecx,%eax
+  802c74:	f7 e2                	mul    %edx
+  802c76:	c1 ea 0c             	shr    $0xc,%edx
+  802c79:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802c7f:	29 d1                	sub    %edx,%ecx
+  802c81:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  802c87:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802c8e:	00 00 00 
+	stat->st_dev = &devpipe;
+  802c91:	c7 83 88 00 00 00 3c 	movl   $0x80703c,0x88(%ebx)
+  802c98:	70 80 00 
+	return 0;
+}
+  802c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ca3:	5b                   	pop    %ebx
+  802ca4:	5e                   	pop    %esi
+  802ca5:	5d                   	pop    %ebp
+  802ca6:	c3                   	ret
+
+00802ca7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ca7:	55                   	push   %ebp
+  802ca8:	89 e5                	mov    %esp,%ebp
+  802caa:	53                   	push   %ebx
+  802cab:	83 ec 0c             	sub    $0xc,%esp
+  802cae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802cb1:	53                   	push   %ebx
+  802cb2:	6a 00                	push   $0x0
+  802cb4:	e8 69 e4 ff ff       	call   801122 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802cb9:	89 1c 24             	mov    %ebx,(%esp)
+  802cbc:	e8 3b ef ff ff       	call   801bfc <fd2data>
+  802cc1:	83 c4 08             	add    $0x8,%esp
+  802cc4:	50                   	push   %eax
+  802cc5:	6a 00                	push   $0x0
+  802cc7:	e8 56 e4 ff ff       	call   801122 <sys_page_unmap>
+}
+  802ccc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ccf:	c9                   	leave
+  802cd0:	c3                   	ret
+
+00802cd1 <_pipeisclosed>:
+{
+  802cd1:	55                   	push   %ebp
+  802cd2:	89 e5                	mov    %esp,%ebp
+  802cd4:	57                   	push   %edi
+  802cd5:	56                   	push   %esi
+  802cd6:	53                   	push   %ebx
+  802cd7:	83 ec 1c             	sub    $0x1c,%esp
+  802cda:	89 c7                	mov    %eax,%edi
+  802cdc:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802cde:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  802ce3:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802ce6:	83 ec 0c             	sub    $0xc,%esp
+  802ce9:	57                   	push   %edi
+  802cea:	e8 fe 2c 00 00       	call   8059ed <pageref>
+  802cef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802cf2:	89 34 24             	mov    %esi,(%esp)
+  802cf5:	e8 f3 2c 00 00       	call   8059ed <pageref>
+		nn = thisenv->env_runs;
+  802cfa:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  802d00:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802d03:	83 c4 10             	add    $0x10,%esp
+  802d06:	39 cb                	cmp    %ecx,%ebx
+  802d08:	74 1b                	je     802d25 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802d0a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d0d:	75 cf                	jne    802cde <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802d0f:	8b 42 58             	mov    0x58(%edx),%eax
+  802d12:	6a 01                	push   $0x1
+  802d14:	50                   	push   %eax
+  802d15:	53                   	push   %ebx
+  802d16:	68 89 63 80 00       	push   $0x806389
+  802d1b:	e8 a3 d8 ff ff       	call   8005c3 <cprintf>
+  802d20:	83 c4 10             	add    $0x10,%esp
+  802d23:	eb b9                	jmp    802cde <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802d25:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d28:	0f 94 c0             	sete   %al
+  802d2b:	0f b6 c0             	movzbl %al,%eax
+}
+  802d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d31:	5b                   	pop    %ebx
+  802d32:	5e                   	pop    %esi
+  802d33:	5f                   	pop    %edi
+  802d34:	5d                   	pop    %ebp
+  802d35:	c3                   	ret
+
+00802d36 <devpipe_read>:
+{
+  802d36:	55                   	push   %ebp
+  802d37:	89 e5                	mov    %esp,%ebp
+  802d39:	57                   	push   %edi
+  802d3a:	56                   	push   %esi
+  802d3b:	53                   	push   %ebx
+  802d3c:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  802d3f:	ff 75 08             	push   0x8(%ebp)
+  802d42:	e8 b5 ee ff ff       	call   801bfc <fd2data>
+  802d47:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  802d49:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  802d4c:	8d 40 04             	lea    0x4(%eax),%eax
+  802d4f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802d52:	8b 7b 04             	mov    0x4(%ebx),%edi
+  802d55:	8b 0b                	mov    (%ebx),%ecx
+  802d57:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  802d5d:	29 ce                	sub    %ecx,%esi
+  802d5f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802d64:	f7 e6                	mul    %esi
+  802d66:	c1 ea 0c             	shr    $0xc,%edx
+  802d69:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  802d6f:	29 c6                	sub    %eax,%esi
+  802d71:	89 f2                	mov    %esi,%edx
+  802d73:	75 43                	jne    802db8 <devpipe_read+0x82>
+		ref = pageref(p);
+  802d75:	83 ec 0c             	sub    $0xc,%esp
+  802d78:	53                   	push   %ebx
+  802d79:	e8 6f 2c 00 00       	call   8059ed <pageref>
+  802d7e:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  802d80:	89 da                	mov    %ebx,%edx
+  802d82:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d85:	e8 47 ff ff ff       	call   802cd1 <_pipeisclosed>
+  802d8a:	83 c4 10             	add    $0x10,%esp
+  802d8d:	85 c0                	test   %eax,%eax
+  802d8f:	0f 85 c1 00 00 00    	jne    802e56 <devpipe_read+0x120>
+	*sleeping = 1;
+  802d95:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  802d9c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802da1:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  802da4:	75 ac                	jne    802d52 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  802da6:	83 ec 04             	sub    $0x4,%esp
+  802da9:	56                   	push   %esi
+  802daa:	57                   	push   %edi
+  802dab:	ff 75 e4             	push   -0x1c(%ebp)
+  802dae:	e8 c3 e7 ff ff       	call   801576 <sys_futex_wait>
+  802db3:	83 c4 10             	add    $0x10,%esp
+  802db6:	eb 9a                	jmp    802d52 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  802db8:	39 75 10             	cmp    %esi,0x10(%ebp)
+  802dbb:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  802dbf:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  802dc1:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802dc6:	f7 e1                	mul    %ecx
+  802dc8:	c1 ea 0b             	shr    $0xb,%edx
+  802dcb:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802dd1:	29 c1                	sub    %eax,%ecx
+  802dd3:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  802dd5:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  802dda:	29 cf                	sub    %ecx,%edi
+  802ddc:	39 f7                	cmp    %esi,%edi
+  802dde:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  802de1:	8d 43 10             	lea    0x10(%ebx),%eax
+  802de4:	83 ec 04             	sub    $0x4,%esp
+  802de7:	57                   	push   %edi
+  802de8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802deb:	01 c2                	add    %eax,%edx
+  802ded:	52                   	push   %edx
+  802dee:	ff 75 0c             	push   0xc(%ebp)
+  802df1:	e8 3a df ff ff       	call   800d30 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  802df6:	83 c4 0c             	add    $0xc,%esp
+  802df9:	89 f1                	mov    %esi,%ecx
+  802dfb:	29 f9                	sub    %edi,%ecx
+  802dfd:	51                   	push   %ecx
+  802dfe:	ff 75 e4             	push   -0x1c(%ebp)
+  802e01:	89 f8                	mov    %edi,%eax
+  802e03:	03 45 0c             	add    0xc(%ebp),%eax
+  802e06:	50                   	push   %eax
+  802e07:	e8 24 df ff ff       	call   800d30 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  802e0c:	89 f1                	mov    %esi,%ecx
+  802e0e:	03 0b                	add    (%ebx),%ecx
+  802e10:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e15:	f7 e1                	mul    %ecx
+  802e17:	c1 ea 0c             	shr    $0xc,%edx
+  802e1a:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802e20:	29 d1                	sub    %edx,%ecx
+  802e22:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  802e24:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802e29:	83 c4 10             	add    $0x10,%esp
+  802e2c:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  802e30:	75 0a                	jne    802e3c <devpipe_read+0x106>
+	return n;
+  802e32:	89 f0                	mov    %esi,%eax
+}
+  802e34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e37:	5b                   	pop    %ebx
+  802e38:	5e                   	pop    %esi
+  802e39:	5f                   	pop    %edi
+  802e3a:	5d                   	pop    %ebp
+  802e3b:	c3                   	ret
+		*sleeping = 0;
+  802e3c:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  802e43:	83 ec 08             	sub    $0x8,%esp
+  802e46:	68 00 04 00 00       	push   $0x400
+  802e4b:	53                   	push   %ebx
+  802e4c:	e8 75 e7 ff ff       	call   8015c6 <sys_futex_wake>
+  802e51:	83 c4 10             	add    $0x10,%esp
+  802e54:	eb dc                	jmp    802e32 <devpipe_read+0xfc>
+			return 0;
+  802e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e5b:	eb d7                	jmp    802e34 <devpipe_read+0xfe>
+
+00802e5d <devpipe_write>:
+{
+  802e5d:	55                   	push   %ebp
+  802e5e:	89 e5                	mov    %esp,%ebp
+  802e60:	57                   	push   %edi
+  802e61:	56                   	push   %esi
+  802e62:	53                   	push   %ebx
+  802e63:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  802e66:	ff 75 08             	push   0x8(%ebp)
+  802e69:	e8 8e ed ff ff       	call   801bfc <fd2data>
+  802e6e:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  802e70:	83 c4 10             	add    $0x10,%esp
+  802e73:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802e7a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e7d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802e80:	0f 83 23 01 00 00    	jae    802fa9 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  802e86:	8b 77 04             	mov    0x4(%edi),%esi
+  802e89:	8b 1f                	mov    (%edi),%ebx
+  802e8b:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  802e91:	29 d9                	sub    %ebx,%ecx
+  802e93:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802e98:	f7 e1                	mul    %ecx
+  802e9a:	c1 ea 0c             	shr    $0xc,%edx
+  802e9d:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  802ea3:	29 c1                	sub    %eax,%ecx
+  802ea5:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  802ea7:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  802ead:	75 40                	jne    802eef <devpipe_write+0x92>
+			ref = pageref(p);
+  802eaf:	83 ec 0c             	sub    $0xc,%esp
+  802eb2:	57                   	push   %edi
+  802eb3:	e8 35 2b 00 00       	call   8059ed <pageref>
+  802eb8:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  802eba:	89 fa                	mov    %edi,%edx
+  802ebc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ebf:	e8 0d fe ff ff       	call   802cd1 <_pipeisclosed>
+  802ec4:	83 c4 10             	add    $0x10,%esp
+  802ec7:	85 c0                	test   %eax,%eax
+  802ec9:	0f 85 d5 00 00 00    	jne    802fa4 <devpipe_write+0x147>
+	*sleeping = 1;
+  802ecf:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  802ed6:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  802edb:	39 1f                	cmp    %ebx,(%edi)
+  802edd:	75 a7                	jne    802e86 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  802edf:	83 ec 04             	sub    $0x4,%esp
+  802ee2:	56                   	push   %esi
+  802ee3:	53                   	push   %ebx
+  802ee4:	57                   	push   %edi
+  802ee5:	e8 8c e6 ff ff       	call   801576 <sys_futex_wait>
+  802eea:	83 c4 10             	add    $0x10,%esp
+  802eed:	eb 97                	jmp    802e86 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  802eef:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  802ef2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ef5:	29 c1                	sub    %eax,%ecx
+  802ef7:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  802efc:	89 d8                	mov    %ebx,%eax
+  802efe:	29 d0                	sub    %edx,%eax
+  802f00:	39 c1                	cmp    %eax,%ecx
+  802f02:	0f 46 c1             	cmovbe %ecx,%eax
+  802f05:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  802f07:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f0c:	f7 e6                	mul    %esi
+  802f0e:	c1 ea 0b             	shr    $0xb,%edx
+  802f11:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  802f17:	29 c6                	sub    %eax,%esi
+  802f19:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  802f1b:	29 f3                	sub    %esi,%ebx
+  802f1d:	39 cb                	cmp    %ecx,%ebx
+  802f1f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802f22:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  802f25:	8d 77 10             	lea    0x10(%edi),%esi
+  802f28:	83 ec 04             	sub    $0x4,%esp
+  802f2b:	53                   	push   %ebx
+  802f2c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f2f:	03 45 0c             	add    0xc(%ebp),%eax
+  802f32:	50                   	push   %eax
+  802f33:	01 f2                	add    %esi,%edx
+  802f35:	52                   	push   %edx
+  802f36:	e8 f5 dd ff ff       	call   800d30 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  802f3b:	83 c4 0c             	add    $0xc,%esp
+  802f3e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f41:	29 d8                	sub    %ebx,%eax
+  802f43:	50                   	push   %eax
+  802f44:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802f47:	01 d3                	add    %edx,%ebx
+  802f49:	03 5d 0c             	add    0xc(%ebp),%ebx
+  802f4c:	53                   	push   %ebx
+  802f4d:	56                   	push   %esi
+  802f4e:	e8 dd dd ff ff       	call   800d30 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  802f53:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f56:	03 4f 04             	add    0x4(%edi),%ecx
+  802f59:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  802f5e:	f7 e1                	mul    %ecx
+  802f60:	c1 ea 0c             	shr    $0xc,%edx
+  802f63:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  802f69:	29 d1                	sub    %edx,%ecx
+  802f6b:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  802f6e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  802f73:	83 c4 10             	add    $0x10,%esp
+  802f76:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802f7a:	75 0b                	jne    802f87 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802f7c:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  802f7f:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  802f82:	e9 f3 fe ff ff       	jmp    802e7a <devpipe_write+0x1d>
+		*sleeping = 0;
+  802f87:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  802f8e:	83 ec 08             	sub    $0x8,%esp
+  802f91:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802f96:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802f99:	50                   	push   %eax
+  802f9a:	e8 27 e6 ff ff       	call   8015c6 <sys_futex_wake>
+  802f9f:	83 c4 10             	add    $0x10,%esp
+  802fa2:	eb d8                	jmp    802f7c <devpipe_write+0x11f>
+				return 0;
+  802fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fac:	5b                   	pop    %ebx
+  802fad:	5e                   	pop    %esi
+  802fae:	5f                   	pop    %edi
+  802faf:	5d                   	pop    %ebp
+  802fb0:	c3                   	ret
+
+00802fb1 <pipe>:
+{
+  802fb1:	55                   	push   %ebp
+  802fb2:	89 e5                	mov    %esp,%ebp
+  802fb4:	56                   	push   %esi
+  802fb5:	53                   	push   %ebx
+  802fb6:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802fb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fbc:	50                   	push   %eax
+  802fbd:	e8 51 ec ff ff       	call   801c13 <fd_alloc>
+  802fc2:	89 c3                	mov    %eax,%ebx
+  802fc4:	83 c4 10             	add    $0x10,%esp
+  802fc7:	85 c0                	test   %eax,%eax
+  802fc9:	0f 88 23 01 00 00    	js     8030f2 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fcf:	83 ec 04             	sub    $0x4,%esp
+  802fd2:	68 07 04 00 00       	push   $0x407
+  802fd7:	ff 75 f4             	push   -0xc(%ebp)
+  802fda:	6a 00                	push   $0x0
+  802fdc:	e8 bc e0 ff ff       	call   80109d <sys_page_alloc>
+  802fe1:	89 c3                	mov    %eax,%ebx
+  802fe3:	83 c4 10             	add    $0x10,%esp
+  802fe6:	85 c0                	test   %eax,%eax
+  802fe8:	0f 88 04 01 00 00    	js     8030f2 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802fee:	83 ec 0c             	sub    $0xc,%esp
+  802ff1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802ff4:	50                   	push   %eax
+  802ff5:	e8 19 ec ff ff       	call   801c13 <fd_alloc>
+  802ffa:	89 c3                	mov    %eax,%ebx
+  802ffc:	83 c4 10             	add    $0x10,%esp
+  802fff:	85 c0                	test   %eax,%eax
+  803001:	0f 88 db 00 00 00    	js     8030e2 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803007:	83 ec 04             	sub    $0x4,%esp
+  80300a:	68 07 04 00 00       	push   $0x407
+  80300f:	ff 75 f0             	push   -0x10(%ebp)
+  803012:	6a 00                	push   $0x0
+  803014:	e8 84 e0 ff ff       	call   80109d <sys_page_alloc>
+  803019:	89 c3                	mov    %eax,%ebx
+  80301b:	83 c4 10             	add    $0x10,%esp
+  80301e:	85 c0                	test   %eax,%eax
+  803020:	0f 88 bc 00 00 00    	js     8030e2 <pipe+0x131>
+	va = fd2data(fd0);
+  803026:	83 ec 0c             	sub    $0xc,%esp
+  803029:	ff 75 f4             	push   -0xc(%ebp)
+  80302c:	e8 cb eb ff ff       	call   801bfc <fd2data>
+  803031:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803033:	83 c4 0c             	add    $0xc,%esp
+  803036:	68 07 04 00 00       	push   $0x407
+  80303b:	50                   	push   %eax
+  80303c:	6a 00                	push   $0x0
+  80303e:	e8 5a e0 ff ff       	call   80109d <sys_page_alloc>
+  803043:	89 c3                	mov    %eax,%ebx
+  803045:	83 c4 10             	add    $0x10,%esp
+  803048:	85 c0                	test   %eax,%eax
+  80304a:	0f 88 82 00 00 00    	js     8030d2 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803050:	83 ec 0c             	sub    $0xc,%esp
+  803053:	ff 75 f0             	push   -0x10(%ebp)
+  803056:	e8 a1 eb ff ff       	call   801bfc <fd2data>
+  80305b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803062:	50                   	push   %eax
+  803063:	6a 00                	push   $0x0
+  803065:	56                   	push   %esi
+  803066:	6a 00                	push   $0x0
+  803068:	e8 73 e0 ff ff       	call   8010e0 <sys_page_map>
+  80306d:	89 c3                	mov    %eax,%ebx
+  80306f:	83 c4 20             	add    $0x20,%esp
+  803072:	85 c0                	test   %eax,%eax
+  803074:	78 4e                	js     8030c4 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803076:	a1 3c 70 80 00       	mov    0x80703c,%eax
+  80307b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80307e:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803080:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803083:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80308a:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80308d:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80308f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803092:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803099:	83 ec 0c             	sub    $0xc,%esp
+  80309c:	ff 75 f4             	push   -0xc(%ebp)
+  80309f:	e8 48 eb ff ff       	call   801bec <fd2num>
+  8030a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030a7:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8030a9:	83 c4 04             	add    $0x4,%esp
+  8030ac:	ff 75 f0             	push   -0x10(%ebp)
+  8030af:	e8 38 eb ff ff       	call   801bec <fd2num>
+  8030b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030b7:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8030ba:	83 c4 10             	add    $0x10,%esp
+  8030bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8030c2:	eb 2e                	jmp    8030f2 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8030c4:	83 ec 08             	sub    $0x8,%esp
+  8030c7:	56                   	push   %esi
+  8030c8:	6a 00                	push   $0x0
+  8030ca:	e8 53 e0 ff ff       	call   801122 <sys_page_unmap>
+  8030cf:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8030d2:	83 ec 08             	sub    $0x8,%esp
+  8030d5:	ff 75 f0             	push   -0x10(%ebp)
+  8030d8:	6a 00                	push   $0x0
+  8030da:	e8 43 e0 ff ff       	call   801122 <sys_page_unmap>
+  8030df:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8030e2:	83 ec 08             	sub    $0x8,%esp
+  8030e5:	ff 75 f4             	push   -0xc(%ebp)
+  8030e8:	6a 00                	push   $0x0
+  8030ea:	e8 33 e0 ff ff       	call   801122 <sys_page_unmap>
+  8030ef:	83 c4 10             	add    $0x10,%esp
+}
+  8030f2:	89 d8                	mov    %ebx,%eax
+  8030f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030f7:	5b                   	pop    %ebx
+  8030f8:	5e                   	pop    %esi
+  8030f9:	5d                   	pop    %ebp
+  8030fa:	c3                   	ret
+
+008030fb <pipeisclosed>:
+{
+  8030fb:	55                   	push   %ebp
+  8030fc:	89 e5                	mov    %esp,%ebp
+  8030fe:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803101:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803104:	50                   	push   %eax
+  803105:	ff 75 08             	push   0x8(%ebp)
+  803108:	e8 5a eb ff ff       	call   801c67 <fd_lookup>
+  80310d:	83 c4 10             	add    $0x10,%esp
+  803110:	85 c0                	test   %eax,%eax
+  803112:	78 18                	js     80312c <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803114:	83 ec 0c             	sub    $0xc,%esp
+  803117:	ff 75 f4             	push   -0xc(%ebp)
+  80311a:	e8 dd ea ff ff       	call   801bfc <fd2data>
+  80311f:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803121:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803124:	e8 a8 fb ff ff       	call   802cd1 <_pipeisclosed>
+  803129:	83 c4 10             	add    $0x10,%esp
+}
+  80312c:	c9                   	leave
+  80312d:	c3                   	ret
+
+0080312e <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80312e:	55                   	push   %ebp
+  80312f:	89 e5                	mov    %esp,%ebp
+  803131:	57                   	push   %edi
+  803132:	56                   	push   %esi
+  803133:	53                   	push   %ebx
+  803134:	83 ec 0c             	sub    $0xc,%esp
+  803137:	8b 7d 08             	mov    0x8(%ebp),%edi
+	const volatile struct Env *e;
+	unsigned status;
+
+	assert(envid != 0);
+  80313a:	85 ff                	test   %edi,%edi
+  80313c:	74 21                	je     80315f <wait+0x31>
+	e = &envs[ENVX(envid)];
+  80313e:	89 f8                	mov    %edi,%eax
+  803140:	25 ff 03 00 00       	and    $0x3ff,%eax
+	// The kernel wakes us when it frees the environment.  Until then
+	// we sleep, unless its status changed since we looked.
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  803145:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803148:	c1 e6 06             	shl    $0x6,%esi
+  80314b:	81 c6 54 00 c0 ee    	add    $0xeec00054,%esi
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  803151:	8d 1c 80             	lea    (%eax,%eax,4),%ebx
+  803154:	c1 e3 06             	shl    $0x6,%ebx
+  803157:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  80315d:	eb 25                	jmp    803184 <wait+0x56>
+	assert(envid != 0);
+  80315f:	68 a1 63 80 00       	push   $0x8063a1
+  803164:	68 bb 62 80 00       	push   $0x8062bb
+  803169:	6a 0a                	push   $0xa
+  80316b:	68 ac 63 80 00       	push   $0x8063ac
+  803170:	e8 73 d3 ff ff       	call   8004e8 <_panic>
+		sys_futex_wait((const uint32_t *) &e->env_status, status, -1);
+  803175:	83 ec 04             	sub    $0x4,%esp
+  803178:	6a ff                	push   $0xffffffff
+  80317a:	50                   	push   %eax
+  80317b:	56                   	push   %esi
+  80317c:	e8 f5 e3 ff ff       	call   801576 <sys_futex_wait>
+  803181:	83 c4 10             	add    $0x10,%esp
+	while (e->env_id == envid && (status = e->env_status) != ENV_FREE)
+  803184:	8b 43 48             	mov    0x48(%ebx),%eax
+  803187:	39 f8                	cmp    %edi,%eax
+  803189:	75 07                	jne    803192 <wait+0x64>
+  80318b:	8b 43 54             	mov    0x54(%ebx),%eax
+  80318e:	85 c0                	test   %eax,%eax
+  803190:	75 e3                	jne    803175 <wait+0x47>
+}
+  803192:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803195:	5b                   	pop    %ebx
+  803196:	5e                   	pop    %esi
+  803197:	5f                   	pop    %edi
+  803198:	5d                   	pop    %ebp
+  803199:	c3                   	ret
+
+0080319a <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  80319a:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  80319c:	8b 15 18 f9 80 00    	mov    0x80f918,%edx
+  8031a2:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8031a8:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8031ae:	39 d0                	cmp    %edx,%eax
+  8031b0:	74 2e                	je     8031e0 <segment_lookup+0x46>
+{
+  8031b2:	55                   	push   %ebp
+  8031b3:	89 e5                	mov    %esp,%ebp
+  8031b5:	57                   	push   %edi
+  8031b6:	56                   	push   %esi
+  8031b7:	53                   	push   %ebx
+  8031b8:	eb 07                	jmp    8031c1 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8031ba:	83 c0 20             	add    $0x20,%eax
+  8031bd:	39 d0                	cmp    %edx,%eax
+  8031bf:	74 15                	je     8031d6 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8031c1:	8b 18                	mov    (%eax),%ebx
+  8031c3:	39 d9                	cmp    %ebx,%ecx
+  8031c5:	72 f3                	jb     8031ba <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8031c7:	8b 38                	mov    (%eax),%edi
+  8031c9:	8b 58 04             	mov    0x4(%eax),%ebx
+  8031cc:	89 ce                	mov    %ecx,%esi
+  8031ce:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8031d0:	39 de                	cmp    %ebx,%esi
+  8031d2:	73 e6                	jae    8031ba <segment_lookup+0x20>
+  8031d4:	eb 05                	jmp    8031db <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8031d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031db:	5b                   	pop    %ebx
+  8031dc:	5e                   	pop    %esi
+  8031dd:	5f                   	pop    %edi
+  8031de:	5d                   	pop    %ebp
+  8031df:	c3                   	ret
+	return NULL;
+  8031e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031e5:	c3                   	ret
+
+008031e6 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  8031e6:	55                   	push   %ebp
+  8031e7:	89 e5                	mov    %esp,%ebp
+  8031e9:	53                   	push   %ebx
+  8031ea:	83 ec 04             	sub    $0x4,%esp
+  8031ed:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  8031ef:	c1 e8 16             	shr    $0x16,%eax
+  8031f2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8031f9:	25 81 00 00 00       	and    $0x81,%eax
+  8031fe:	83 f8 01             	cmp    $0x1,%eax
+  803201:	75 6b                	jne    80326e <page_is_clean+0x88>
+  803203:	89 da                	mov    %ebx,%edx
+  803205:	c1 ea 0c             	shr    $0xc,%edx
+  803208:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80320f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  803214:	f6 c1 01             	test   $0x1,%cl
+  803217:	74 5a                	je     803273 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  803219:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  803220:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  803226:	75 4b                	jne    803273 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  803228:	89 d8                	mov    %ebx,%eax
+  80322a:	e8 6b ff ff ff       	call   80319a <segment_lookup>
+  80322f:	89 c2                	mov    %eax,%edx
+		return 1;
+  803231:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  803236:	85 d2                	test   %edx,%edx
+  803238:	75 39                	jne    803273 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  80323a:	8b 15 0c c0 80 00    	mov    0x80c00c,%edx
+  803240:	b8 00 00 00 00       	mov    $0x0,%eax
+  803245:	eb 03                	jmp    80324a <page_is_clean+0x64>
+  803247:	83 c0 01             	add    $0x1,%eax
+  80324a:	39 c2                	cmp    %eax,%edx
+  80324c:	7e 19                	jle    803267 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  80324e:	3b 1c c5 20 c0 80 00 	cmp    0x80c020(,%eax,8),%ebx
+  803255:	72 f0                	jb     803247 <page_is_clean+0x61>
+  803257:	3b 1c c5 24 c0 80 00 	cmp    0x80c024(,%eax,8),%ebx
+  80325e:	73 e7                	jae    803247 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  803260:	b8 01 00 00 00       	mov    $0x1,%eax
+  803265:	eb 0c                	jmp    803273 <page_is_clean+0x8d>
+	return 0;
+  803267:	b8 00 00 00 00       	mov    $0x0,%eax
+  80326c:	eb 05                	jmp    803273 <page_is_clean+0x8d>
+		return 0;
+  80326e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803273:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803276:	c9                   	leave
+  803277:	c3                   	ret
+
+00803278 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  803278:	55                   	push   %ebp
+  803279:	89 e5                	mov    %esp,%ebp
+  80327b:	57                   	push   %edi
+  80327c:	56                   	push   %esi
+  80327d:	53                   	push   %ebx
+  80327e:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803281:	be 00 00 00 00       	mov    $0x0,%esi
+  803286:	eb 19                	jmp    8032a1 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803288:	f7 d3                	not    %ebx
+  80328a:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803290:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803292:	83 c6 01             	add    $0x1,%esi
+  803295:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80329b:	0f 87 97 00 00 00    	ja     803338 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8032a1:	89 f3                	mov    %esi,%ebx
+  8032a3:	03 1d 34 90 80 00    	add    0x809034,%ebx
+  8032a9:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8032af:	89 d8                	mov    %ebx,%eax
+  8032b1:	c1 e8 0a             	shr    $0xa,%eax
+  8032b4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8032bb:	25 81 00 00 00       	and    $0x81,%eax
+  8032c0:	83 f8 01             	cmp    $0x1,%eax
+  8032c3:	75 c3                	jne    803288 <linear_walk+0x10>
+  8032c5:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8032cb:	77 bb                	ja     803288 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8032cd:	89 df                	mov    %ebx,%edi
+  8032cf:	c1 e7 0c             	shl    $0xc,%edi
+  8032d2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8032d5:	89 f8                	mov    %edi,%eax
+  8032d7:	e8 0a ff ff ff       	call   8031e6 <page_is_clean>
+  8032dc:	84 c0                	test   %al,%al
+  8032de:	75 64                	jne    803344 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032e0:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8032e6:	77 aa                	ja     803292 <linear_walk+0x1a>
+  8032e8:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  8032ee:	72 a2                	jb     803292 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8032f0:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8032f7:	a8 01                	test   $0x1,%al
+  8032f9:	74 97                	je     803292 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8032fb:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803302:	f6 c4 04             	test   $0x4,%ah
+  803305:	75 8b                	jne    803292 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803307:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80330e:	f6 c4 02             	test   $0x2,%ah
+  803311:	0f 85 7b ff ff ff    	jne    803292 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803317:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80331e:	c1 e8 0c             	shr    $0xc,%eax
+  803321:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803324:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803329:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80332d:	66 83 f8 01          	cmp    $0x1,%ax
+  803331:	76 11                	jbe    803344 <linear_walk+0xcc>
+  803333:	e9 5a ff ff ff       	jmp    803292 <linear_walk+0x1a>
+  803338:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80333d:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  803344:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+}
+  80334a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80334d:	83 c4 1c             	add    $0x1c,%esp
+  803350:	5b                   	pop    %ebx
+  803351:	5e                   	pop    %esi
+  803352:	5f                   	pop    %edi
+  803353:	5d                   	pop    %ebp
+  803354:	c3                   	ret
+
+00803355 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  803355:	55                   	push   %ebp
+  803356:	89 e5                	mov    %esp,%ebp
+  803358:	56                   	push   %esi
+  803359:	53                   	push   %ebx
+  80335a:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  80335c:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803361:	83 e0 7f             	and    $0x7f,%eax
+  803364:	c1 e0 04             	shl    $0x4,%eax
+  803367:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  80336d:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  803373:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  803379:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  80337f:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803384:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  803387:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  80338c:	83 c0 01             	add    $0x1,%eax
+  80338f:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  803394:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  803397:	5b                   	pop    %ebx
+  803398:	5e                   	pop    %esi
+  803399:	5d                   	pop    %ebp
+  80339a:	c3                   	ret
+
+0080339b <page_ring_enter>:
+{
+  80339b:	55                   	push   %ebp
+  80339c:	89 e5                	mov    %esp,%ebp
+  80339e:	57                   	push   %edi
+  80339f:	56                   	push   %esi
+  8033a0:	53                   	push   %ebx
+  8033a1:	83 ec 18             	sub    $0x18,%esp
+  8033a4:	89 c6                	mov    %eax,%esi
+  8033a6:	89 d7                	mov    %edx,%edi
+  8033a8:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8033aa:	6a 00                	push   $0x0
+  8033ac:	6a 00                	push   $0x0
+  8033ae:	6a 00                	push   $0x0
+  8033b0:	6a 07                	push   $0x7
+  8033b2:	ff 35 40 c0 80 00    	push   0x80c040
+  8033b8:	e8 1a 25 00 00       	call   8058d7 <ipc_call>
+  8033bd:	83 c4 20             	add    $0x20,%esp
+  8033c0:	85 c0                	test   %eax,%eax
+  8033c2:	79 22                	jns    8033e6 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8033c4:	50                   	push   %eax
+  8033c5:	68 b7 63 80 00       	push   $0x8063b7
+  8033ca:	68 13 02 00 00       	push   $0x213
+  8033cf:	68 cb 63 80 00       	push   $0x8063cb
+  8033d4:	e8 0f d1 ff ff       	call   8004e8 <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8033d9:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8033de:	83 c0 01             	add    $0x1,%eax
+  8033e1:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  8033e6:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  8033ec:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  8033f1:	39 c2                	cmp    %eax,%edx
+  8033f3:	74 24                	je     803419 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  8033f5:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8033fa:	83 e0 7f             	and    $0x7f,%eax
+  8033fd:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  803404:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  80340b:	29 f0                	sub    %esi,%eax
+  80340d:	39 d8                	cmp    %ebx,%eax
+  80340f:	73 c8                	jae    8033d9 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  803411:	8b 52 04             	mov    0x4(%edx),%edx
+  803414:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  803417:	eb c0                	jmp    8033d9 <page_ring_enter+0x3e>
+}
+  803419:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80341c:	5b                   	pop    %ebx
+  80341d:	5e                   	pop    %esi
+  80341e:	5f                   	pop    %edi
+  80341f:	5d                   	pop    %ebp
+  803420:	c3                   	ret
+
+00803421 <page_ring_reserve>:
+{
+  803421:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  803423:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803428:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80342e:	29 d0                	sub    %edx,%eax
+  803430:	ba 80 00 00 00       	mov    $0x80,%edx
+  803435:	29 ca                	sub    %ecx,%edx
+  803437:	39 c2                	cmp    %eax,%edx
+  803439:	72 01                	jb     80343c <page_ring_reserve+0x1b>
+  80343b:	c3                   	ret
+{
+  80343c:	55                   	push   %ebp
+  80343d:	89 e5                	mov    %esp,%ebp
+  80343f:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  803442:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80344c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803451:	e8 45 ff ff ff       	call   80339b <page_ring_enter>
+}
+  803456:	c9                   	leave
+  803457:	c3                   	ret
+
+00803458 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  803458:	55                   	push   %ebp
+  803459:	89 e5                	mov    %esp,%ebp
+  80345b:	53                   	push   %ebx
+  80345c:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  80345f:	6a 07                	push   $0x7
+  803461:	6a 01                	push   $0x1
+  803463:	89 c3                	mov    %eax,%ebx
+  803465:	c1 e3 0c             	shl    $0xc,%ebx
+  803468:	8d 93 00 a0 80 00    	lea    0x80a000(%ebx),%edx
+  80346e:	52                   	push   %edx
+  80346f:	6a 04                	push   $0x4
+  803471:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  803478:	e8 5a 24 00 00       	call   8058d7 <ipc_call>
+	sharereqs[i].nslots = 0;
+  80347d:	c7 83 00 a0 80 00 00 	movl   $0x0,0x80a000(%ebx)
+  803484:	00 00 00 
+	return r;
+}
+  803487:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80348a:	c9                   	leave
+  80348b:	c3                   	ret
+
+0080348c <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  80348c:	55                   	push   %ebp
+  80348d:	89 e5                	mov    %esp,%ebp
+  80348f:	56                   	push   %esi
+  803490:	53                   	push   %ebx
+  803491:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  803493:	c1 e8 10             	shr    $0x10,%eax
+  803496:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  803499:	89 c2                	mov    %eax,%edx
+  80349b:	c1 e2 0c             	shl    $0xc,%edx
+  80349e:	8b b2 00 a0 80 00    	mov    0x80a000(%edx),%esi
+  8034a4:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8034a7:	89 9a 00 a0 80 00    	mov    %ebx,0x80a000(%edx)
+  8034ad:	89 c2                	mov    %eax,%edx
+  8034af:	c1 e2 0a             	shl    $0xa,%edx
+  8034b2:	01 f2                	add    %esi,%edx
+  8034b4:	89 0c 95 04 a0 80 00 	mov    %ecx,0x80a004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  8034bb:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8034c1:	74 09                	je     8034cc <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  8034c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034c8:	5b                   	pop    %ebx
+  8034c9:	5e                   	pop    %esi
+  8034ca:	5d                   	pop    %ebp
+  8034cb:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8034cc:	e8 87 ff ff ff       	call   803458 <page_share_send>
+  8034d1:	eb f5                	jmp    8034c8 <page_share_slot+0x3c>
+
+008034d3 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  8034d3:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8034d8:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  8034db:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  8034e0:	3b 15 00 c0 80 00    	cmp    0x80c000,%edx
+  8034e6:	74 09                	je     8034f1 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  8034e8:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  8034ed:	85 c0                	test   %eax,%eax
+  8034ef:	75 01                	jne    8034f2 <page_ring_ready+0x1f>
+}
+  8034f1:	c3                   	ret
+{
+  8034f2:	55                   	push   %ebp
+  8034f3:	89 e5                	mov    %esp,%ebp
+  8034f5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  8034f8:	68 07 06 00 00       	push   $0x607
+  8034fd:	6a 08                	push   $0x8
+  8034ff:	68 00 30 ad de       	push   $0xdead3000
+  803504:	6a 00                	push   $0x0
+  803506:	e8 bd dc ff ff       	call   8011c8 <sys_page_alloc_range>
+  80350b:	83 c4 10             	add    $0x10,%esp
+  80350e:	83 f8 08             	cmp    $0x8,%eax
+  803511:	74 1b                	je     80352e <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  803513:	83 ec 04             	sub    $0x4,%esp
+  803516:	6a 08                	push   $0x8
+  803518:	68 00 30 ad de       	push   $0xdead3000
+  80351d:	6a 00                	push   $0x0
+  80351f:	e8 12 dd ff ff       	call   801236 <sys_page_unmap_range>
+		return 0;
+  803524:	83 c4 10             	add    $0x10,%esp
+  803527:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80352c:	c9                   	leave
+  80352d:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  80352e:	83 ec 0c             	sub    $0xc,%esp
+  803531:	68 07 04 00 00       	push   $0x407
+  803536:	6a 08                	push   $0x8
+  803538:	68 00 30 ad de       	push   $0xdead3000
+  80353d:	6a 06                	push   $0x6
+  80353f:	ff 35 40 c0 80 00    	push   0x80c040
+  803545:	e8 8d 23 00 00       	call   8058d7 <ipc_call>
+  80354a:	83 c4 20             	add    $0x20,%esp
+  80354d:	85 c0                	test   %eax,%eax
+  80354f:	78 14                	js     803565 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  803551:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  803556:	8b 40 48             	mov    0x48(%eax),%eax
+  803559:	a3 00 c0 80 00       	mov    %eax,0x80c000
+	return 1;
+  80355e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803563:	eb c7                	jmp    80352c <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  803565:	83 ec 04             	sub    $0x4,%esp
+  803568:	6a 08                	push   $0x8
+  80356a:	68 00 30 ad de       	push   $0xdead3000
+  80356f:	6a 00                	push   $0x0
+  803571:	e8 c0 dc ff ff       	call   801236 <sys_page_unmap_range>
+		return 0;
+  803576:	83 c4 10             	add    $0x10,%esp
+  803579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357e:	eb ac                	jmp    80352c <page_ring_ready+0x59>
+
+00803580 <page_remove_slot>:
+{
+  803580:	55                   	push   %ebp
+  803581:	89 e5                	mov    %esp,%ebp
+  803583:	56                   	push   %esi
+  803584:	53                   	push   %ebx
+  803585:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803587:	89 c6                	mov    %eax,%esi
+  803589:	c1 ee 10             	shr    $0x10,%esi
+  80358c:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  80358f:	8b 04 b5 44 c0 80 00 	mov    0x80c044(,%esi,4),%eax
+  803596:	39 05 40 c0 80 00    	cmp    %eax,0x80c040
+  80359c:	74 2a                	je     8035c8 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  80359e:	83 ec 0c             	sub    $0xc,%esp
+  8035a1:	6a 00                	push   $0x0
+  8035a3:	6a 00                	push   $0x0
+  8035a5:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8035a7:	c1 e3 04             	shl    $0x4,%ebx
+  8035aa:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8035ad:	53                   	push   %ebx
+  8035ae:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  8035b5:	e8 1d 23 00 00       	call   8058d7 <ipc_call>
+  8035ba:	83 c4 20             	add    $0x20,%esp
+  8035bd:	85 c0                	test   %eax,%eax
+  8035bf:	78 2d                	js     8035ee <page_remove_slot+0x6e>
+}
+  8035c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035c4:	5b                   	pop    %ebx
+  8035c5:	5e                   	pop    %esi
+  8035c6:	5d                   	pop    %ebp
+  8035c7:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8035c8:	e8 06 ff ff ff       	call   8034d3 <page_ring_ready>
+  8035cd:	85 c0                	test   %eax,%eax
+  8035cf:	74 cd                	je     80359e <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  8035d1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8035d6:	e8 46 fe ff ff       	call   803421 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  8035db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8035e0:	89 da                	mov    %ebx,%edx
+  8035e2:	b8 02 00 00 00       	mov    $0x2,%eax
+  8035e7:	e8 69 fd ff ff       	call   803355 <page_ring_post>
+		return;
+  8035ec:	eb d3                	jmp    8035c1 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  8035ee:	50                   	push   %eax
+  8035ef:	68 24 64 80 00       	push   $0x806424
+  8035f4:	68 ac 03 00 00       	push   $0x3ac
+  8035f9:	68 cb 63 80 00       	push   $0x8063cb
+  8035fe:	e8 e5 ce ff ff       	call   8004e8 <_panic>
+
+00803603 <find_paging_env>:
+	if(pagingenv)
+  803603:	a1 40 c0 80 00       	mov    0x80c040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  803608:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  80360a:	85 c0                	test   %eax,%eax
+  80360c:	74 05                	je     803613 <find_paging_env+0x10>
+  80360e:	eb 56                	jmp    803666 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  803610:	83 c0 01             	add    $0x1,%eax
+  803613:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803618:	7f 47                	jg     803661 <find_paging_env+0x5e>
+  80361a:	83 f9 01             	cmp    $0x1,%ecx
+  80361d:	7f 42                	jg     803661 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  80361f:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803622:	c1 e2 06             	shl    $0x6,%edx
+  803625:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80362b:	8b 52 50             	mov    0x50(%edx),%edx
+  80362e:	83 fa 02             	cmp    $0x2,%edx
+  803631:	75 dd                	jne    803610 <find_paging_env+0xd>
+  803633:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803636:	c1 e2 06             	shl    $0x6,%edx
+  803639:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80363f:	8b 52 54             	mov    0x54(%edx),%edx
+  803642:	85 d2                	test   %edx,%edx
+  803644:	74 ca                	je     803610 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  803646:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  803649:	c1 e2 06             	shl    $0x6,%edx
+  80364c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803652:	8b 52 48             	mov    0x48(%edx),%edx
+  803655:	89 14 8d 44 c0 80 00 	mov    %edx,0x80c044(,%ecx,4)
+  80365c:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80365f:	eb af                	jmp    803610 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  803661:	83 f9 02             	cmp    $0x2,%ecx
+  803664:	74 01                	je     803667 <find_paging_env+0x64>
+}
+  803666:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  803667:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80366c:	8b 40 48             	mov    0x48(%eax),%eax
+  80366f:	83 e0 01             	and    $0x1,%eax
+  803672:	8b 04 85 44 c0 80 00 	mov    0x80c044(,%eax,4),%eax
+  803679:	a3 40 c0 80 00       	mov    %eax,0x80c040
+  80367e:	eb e6                	jmp    803666 <find_paging_env+0x63>
+
+00803680 <page_add_backed>:
+{
+  803680:	55                   	push   %ebp
+  803681:	89 e5                	mov    %esp,%ebp
+  803683:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  803686:	a1 0c c0 80 00       	mov    0x80c00c,%eax
+  80368b:	83 f8 04             	cmp    $0x4,%eax
+  80368e:	74 35                	je     8036c5 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  803690:	89 d1                	mov    %edx,%ecx
+  803692:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  803698:	89 0c c5 20 c0 80 00 	mov    %ecx,0x80c020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  80369f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8036a2:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8036a9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8036af:	89 14 c5 24 c0 80 00 	mov    %edx,0x80c024(,%eax,8)
+	num_backed_ranges++;
+  8036b6:	83 c0 01             	add    $0x1,%eax
+  8036b9:	a3 0c c0 80 00       	mov    %eax,0x80c00c
+	return 0;
+  8036be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036c3:	5d                   	pop    %ebp
+  8036c4:	c3                   	ret
+		return -E_NO_MEM;
+  8036c5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8036ca:	eb f7                	jmp    8036c3 <page_add_backed+0x43>
+
+008036cc <percentage_of_pgdir_to_walk>:
+{
+  8036cc:	55                   	push   %ebp
+  8036cd:	89 e5                	mov    %esp,%ebp
+  8036cf:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8036d2:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  8036d6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  8036d9:	db 45 fc             	fildl  -0x4(%ebp)
+  8036dc:	d8 35 b0 68 80 00    	fdivs  0x8068b0
+	return ret*ret;
+  8036e2:	d8 c8                	fmul   %st(0),%st
+}
+  8036e4:	c9                   	leave
+  8036e5:	c3                   	ret
+
+008036e6 <nfu_with_aging_page_choice_func>:
+{
+  8036e6:	55                   	push   %ebp
+  8036e7:	89 e5                	mov    %esp,%ebp
+  8036e9:	57                   	push   %edi
+  8036ea:	56                   	push   %esi
+  8036eb:	53                   	push   %ebx
+  8036ec:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8036ef:	8b 35 30 90 80 00    	mov    0x809030,%esi
+	float pct_to_walk = 1.0f;
+  8036f5:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  8036f7:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  8036fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803701:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803708:	ba 00 00 00 00       	mov    $0x0,%edx
+  80370d:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803710:	eb 18                	jmp    80372a <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803712:	f7 d0                	not    %eax
+  803714:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803719:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80371b:	83 c2 01             	add    $0x1,%edx
+  80371e:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803724:	0f 87 13 01 00 00    	ja     80383d <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  80372a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80372e:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  803731:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803736:	89 c1                	mov    %eax,%ecx
+  803738:	c1 e9 0a             	shr    $0xa,%ecx
+  80373b:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803742:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803748:	83 f9 01             	cmp    $0x1,%ecx
+  80374b:	75 c5                	jne    803712 <nfu_with_aging_page_choice_func+0x2c>
+  80374d:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803752:	77 be                	ja     803712 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803754:	89 c1                	mov    %eax,%ecx
+  803756:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803759:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  80375f:	0f 82 a5 00 00 00    	jb     80380a <nfu_with_aging_page_choice_func+0x124>
+  803765:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80376b:	0f 87 99 00 00 00    	ja     80380a <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803771:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803778:	f6 c1 01             	test   $0x1,%cl
+  80377b:	0f 84 89 00 00 00    	je     80380a <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803781:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803788:	f6 c5 04             	test   $0x4,%ch
+  80378b:	75 7d                	jne    80380a <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80378d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803794:	f6 c5 02             	test   $0x2,%ch
+  803797:	75 71                	jne    80380a <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803799:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8037a0:	c1 e9 0c             	shr    $0xc,%ecx
+  8037a3:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8037a6:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8037ac:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8037b0:	66 83 f9 01          	cmp    $0x1,%cx
+  8037b4:	77 54                	ja     80380a <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  8037b6:	89 f9                	mov    %edi,%ecx
+  8037b8:	80 f9 ff             	cmp    $0xff,%cl
+  8037bb:	74 21                	je     8037de <nfu_with_aging_page_choice_func+0xf8>
+  8037bd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8037c4:	c1 e9 0c             	shr    $0xc,%ecx
+  8037c7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8037ca:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8037d0:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  8037d4:	89 fb                	mov    %edi,%ebx
+  8037d6:	38 d9                	cmp    %bl,%cl
+  8037d8:	73 30                	jae    80380a <nfu_with_aging_page_choice_func+0x124>
+  8037da:	dd d8                	fstp   %st(0)
+  8037dc:	eb 02                	jmp    8037e0 <nfu_with_aging_page_choice_func+0xfa>
+  8037de:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  8037e0:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8037e7:	c1 e9 0c             	shr    $0xc,%ecx
+  8037ea:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8037ed:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  8037f4:	89 fb                	mov    %edi,%ebx
+  8037f6:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8037f9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8037fc:	db 45 e0             	fildl  -0x20(%ebp)
+  8037ff:	d8 35 b0 68 80 00    	fdivs  0x8068b0
+	return ret*ret;
+  803805:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803807:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80380a:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80380d:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803810:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803817:	df 6d e0             	fildll -0x20(%ebp)
+  80381a:	d9 c1                	fld    %st(1)
+  80381c:	d8 0d b4 68 80 00    	fmuls  0x8068b4
+  803822:	d9 c9                	fxch   %st(1)
+  803824:	df f1                	fcomip %st(1),%st
+  803826:	dd d8                	fstp   %st(0)
+  803828:	0f 82 ed fe ff ff    	jb     80371b <nfu_with_aging_page_choice_func+0x35>
+  80382e:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803830:	a3 30 90 80 00       	mov    %eax,0x809030
+			return (void*)(pgnum_opt*PGSIZE);
+  803835:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803838:	c1 e0 0c             	shl    $0xc,%eax
+  80383b:	eb 0e                	jmp    80384b <nfu_with_aging_page_choice_func+0x165>
+  80383d:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80383f:	89 f8                	mov    %edi,%eax
+  803841:	3c ff                	cmp    $0xff,%al
+  803843:	74 0e                	je     803853 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803845:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803848:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80384b:	83 c4 14             	add    $0x14,%esp
+  80384e:	5b                   	pop    %ebx
+  80384f:	5e                   	pop    %esi
+  803850:	5f                   	pop    %edi
+  803851:	5d                   	pop    %ebp
+  803852:	c3                   	ret
+	pgnum = 0;
+  803853:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  80385a:	00 00 00 
+	return (void*)UTOP;
+  80385d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803862:	eb e7                	jmp    80384b <nfu_with_aging_page_choice_func+0x165>
+
+00803864 <myRand>:
+    state = state * 1664525 + 1013904223;
+  803864:	69 05 5c 70 80 00 0d 	imul   $0x19660d,0x80705c,%eax
+  80386b:	66 19 00 
+  80386e:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  803873:	a3 5c 70 80 00       	mov    %eax,0x80705c
+    return state >> 24;
+  803878:	c1 e8 18             	shr    $0x18,%eax
+}
+  80387b:	c3                   	ret
+
+0080387c <random_page_choice_func>:
+{
+  80387c:	55                   	push   %ebp
+  80387d:	89 e5                	mov    %esp,%ebp
+  80387f:	57                   	push   %edi
+  803880:	56                   	push   %esi
+  803881:	53                   	push   %ebx
+  803882:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803885:	be 00 00 00 00       	mov    $0x0,%esi
+  80388a:	eb 19                	jmp    8038a5 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  80388c:	f7 d3                	not    %ebx
+  80388e:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803894:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803896:	83 c6 01             	add    $0x1,%esi
+  803899:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  80389f:	0f 87 a0 00 00 00    	ja     803945 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8038a5:	89 f3                	mov    %esi,%ebx
+  8038a7:	03 1d 2c 90 80 00    	add    0x80902c,%ebx
+  8038ad:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8038b3:	89 d8                	mov    %ebx,%eax
+  8038b5:	c1 e8 0a             	shr    $0xa,%eax
+  8038b8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8038bf:	25 81 00 00 00       	and    $0x81,%eax
+  8038c4:	83 f8 01             	cmp    $0x1,%eax
+  8038c7:	75 c3                	jne    80388c <random_page_choice_func+0x10>
+  8038c9:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8038cf:	77 bb                	ja     80388c <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8038d1:	89 df                	mov    %ebx,%edi
+  8038d3:	c1 e7 0c             	shl    $0xc,%edi
+  8038d6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8038d9:	89 f8                	mov    %edi,%eax
+  8038db:	e8 06 f9 ff ff       	call   8031e6 <page_is_clean>
+  8038e0:	84 c0                	test   %al,%al
+  8038e2:	0f 85 82 00 00 00    	jne    80396a <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8038e8:	81 ff 2c 10 81 00    	cmp    $0x81102c,%edi
+  8038ee:	72 a6                	jb     803896 <random_page_choice_func+0x1a>
+  8038f0:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  8038f6:	77 9e                	ja     803896 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8038f8:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  8038ff:	a8 01                	test   $0x1,%al
+  803901:	74 93                	je     803896 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803903:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80390a:	f6 c4 04             	test   $0x4,%ah
+  80390d:	75 87                	jne    803896 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80390f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803916:	f6 c4 02             	test   $0x2,%ah
+  803919:	0f 85 77 ff ff ff    	jne    803896 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80391f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803926:	c1 e8 0c             	shr    $0xc,%eax
+  803929:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80392c:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803931:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803935:	66 83 f8 01          	cmp    $0x1,%ax
+  803939:	0f 87 57 ff ff ff    	ja     803896 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  80393f:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803945:	e8 1a ff ff ff       	call   803864 <myRand>
+  80394a:	8b 3d 2c 90 80 00    	mov    0x80902c,%edi
+  803950:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  803955:	29 fe                	sub    %edi,%esi
+  803957:	0f be c0             	movsbl %al,%eax
+  80395a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80395f:	f7 f6                	div    %esi
+  803961:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803963:	bb 15 00 00 00       	mov    $0x15,%ebx
+  803968:	eb 1c                	jmp    803986 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  80396a:	89 1d 2c 90 80 00    	mov    %ebx,0x80902c
+			return (void*)(pgnum*PGSIZE);
+  803970:	e9 8f 00 00 00       	jmp    803a04 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803975:	e8 ea fe ff ff       	call   803864 <myRand>
+  80397a:	0f be c0             	movsbl %al,%eax
+  80397d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803982:	f7 f6                	div    %esi
+  803984:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  803986:	83 eb 01             	sub    $0x1,%ebx
+  803989:	0f 84 c2 00 00 00    	je     803a51 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  80398f:	89 d0                	mov    %edx,%eax
+  803991:	c1 e8 0a             	shr    $0xa,%eax
+  803994:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80399b:	25 81 00 00 00       	and    $0x81,%eax
+  8039a0:	83 f8 01             	cmp    $0x1,%eax
+  8039a3:	75 d0                	jne    803975 <random_page_choice_func+0xf9>
+  8039a5:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8039ab:	77 c8                	ja     803975 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8039ad:	89 d0                	mov    %edx,%eax
+  8039af:	c1 e0 0c             	shl    $0xc,%eax
+  8039b2:	3d 2c 10 81 00       	cmp    $0x81102c,%eax
+  8039b7:	72 56                	jb     803a0f <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8039b9:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8039be:	77 65                	ja     803a25 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8039c0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8039c7:	f6 c1 01             	test   $0x1,%cl
+  8039ca:	74 59                	je     803a25 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8039cc:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8039d3:	f6 c5 04             	test   $0x4,%ch
+  8039d6:	75 4d                	jne    803a25 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  8039d8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8039df:	f6 c5 02             	test   $0x2,%ch
+  8039e2:	75 41                	jne    803a25 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  8039e4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8039eb:	c1 ea 0c             	shr    $0xc,%edx
+  8039ee:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  8039f1:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  8039f7:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  8039fb:	66 83 fa 01          	cmp    $0x1,%dx
+  8039ff:	77 3a                	ja     803a3b <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  803a01:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  803a04:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803a07:	83 c4 1c             	add    $0x1c,%esp
+  803a0a:	5b                   	pop    %ebx
+  803a0b:	5e                   	pop    %esi
+  803a0c:	5f                   	pop    %edi
+  803a0d:	5d                   	pop    %ebp
+  803a0e:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  803a0f:	e8 50 fe ff ff       	call   803864 <myRand>
+  803a14:	0f be c0             	movsbl %al,%eax
+  803a17:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a1c:	f7 f6                	div    %esi
+  803a1e:	01 fa                	add    %edi,%edx
+			continue;
+  803a20:	e9 61 ff ff ff       	jmp    803986 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803a25:	e8 3a fe ff ff       	call   803864 <myRand>
+  803a2a:	0f be c0             	movsbl %al,%eax
+  803a2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a32:	f7 f6                	div    %esi
+  803a34:	01 fa                	add    %edi,%edx
+			continue;
+  803a36:	e9 4b ff ff ff       	jmp    803986 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  803a3b:	e8 24 fe ff ff       	call   803864 <myRand>
+  803a40:	0f be c0             	movsbl %al,%eax
+  803a43:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a48:	f7 f6                	div    %esi
+  803a4a:	01 fa                	add    %edi,%edx
+			continue;
+  803a4c:	e9 35 ff ff ff       	jmp    803986 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  803a51:	c7 05 2c 90 80 00 00 	movl   $0x0,0x80902c
+  803a58:	00 00 00 
+	return (void*)UTOP;
+  803a5b:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  803a62:	eb a0                	jmp    803a04 <random_page_choice_func+0x188>
+
+00803a64 <nfu>:
+{
+  803a64:	55                   	push   %ebp
+  803a65:	89 e5                	mov    %esp,%ebp
+  803a67:	57                   	push   %edi
+  803a68:	56                   	push   %esi
+  803a69:	53                   	push   %ebx
+  803a6a:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803a6d:	8b 35 28 90 80 00    	mov    0x809028,%esi
+	float pct_to_walk = 1.0f;
+  803a73:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  803a75:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803a7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803a7f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803a86:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a8b:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  803a8e:	eb 18                	jmp    803aa8 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803a90:	f7 d0                	not    %eax
+  803a92:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a97:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803a99:	83 c2 01             	add    $0x1,%edx
+  803a9c:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803aa2:	0f 87 13 01 00 00    	ja     803bbb <nfu+0x157>
+		++num_searched_ptes;
+  803aa8:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803aac:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  803aaf:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803ab4:	89 c1                	mov    %eax,%ecx
+  803ab6:	c1 e9 0a             	shr    $0xa,%ecx
+  803ab9:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803ac0:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803ac6:	83 f9 01             	cmp    $0x1,%ecx
+  803ac9:	75 c5                	jne    803a90 <nfu+0x2c>
+  803acb:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803ad0:	77 be                	ja     803a90 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803ad2:	89 c1                	mov    %eax,%ecx
+  803ad4:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803ad7:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  803add:	0f 82 a5 00 00 00    	jb     803b88 <nfu+0x124>
+  803ae3:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803ae9:	0f 87 99 00 00 00    	ja     803b88 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803aef:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803af6:	f6 c1 01             	test   $0x1,%cl
+  803af9:	0f 84 89 00 00 00    	je     803b88 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803aff:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803b06:	f6 c5 04             	test   $0x4,%ch
+  803b09:	75 7d                	jne    803b88 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803b0b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803b12:	f6 c5 02             	test   $0x2,%ch
+  803b15:	75 71                	jne    803b88 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803b17:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803b1e:	c1 e9 0c             	shr    $0xc,%ecx
+  803b21:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803b24:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803b2a:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803b2e:	66 83 f9 01          	cmp    $0x1,%cx
+  803b32:	77 54                	ja     803b88 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  803b34:	89 f9                	mov    %edi,%ecx
+  803b36:	80 f9 ff             	cmp    $0xff,%cl
+  803b39:	74 21                	je     803b5c <nfu+0xf8>
+  803b3b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803b42:	c1 e9 0c             	shr    $0xc,%ecx
+  803b45:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803b48:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803b4e:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  803b52:	89 fb                	mov    %edi,%ebx
+  803b54:	38 d9                	cmp    %bl,%cl
+  803b56:	73 30                	jae    803b88 <nfu+0x124>
+  803b58:	dd d8                	fstp   %st(0)
+  803b5a:	eb 02                	jmp    803b5e <nfu+0xfa>
+  803b5c:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  803b5e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803b65:	c1 e9 0c             	shr    $0xc,%ecx
+  803b68:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803b6b:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  803b72:	89 fb                	mov    %edi,%ebx
+  803b74:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  803b77:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  803b7a:	db 45 e0             	fildl  -0x20(%ebp)
+  803b7d:	d8 35 b0 68 80 00    	fdivs  0x8068b0
+	return ret*ret;
+  803b83:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803b85:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803b88:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  803b8b:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  803b8e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803b95:	df 6d e0             	fildll -0x20(%ebp)
+  803b98:	d9 c1                	fld    %st(1)
+  803b9a:	d8 0d b4 68 80 00    	fmuls  0x8068b4
+  803ba0:	d9 c9                	fxch   %st(1)
+  803ba2:	df f1                	fcomip %st(1),%st
+  803ba4:	dd d8                	fstp   %st(0)
+  803ba6:	0f 82 ed fe ff ff    	jb     803a99 <nfu+0x35>
+  803bac:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  803bae:	a3 28 90 80 00       	mov    %eax,0x809028
+			return (void*)(pgnum_opt*PGSIZE);
+  803bb3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803bb6:	c1 e0 0c             	shl    $0xc,%eax
+  803bb9:	eb 0e                	jmp    803bc9 <nfu+0x165>
+  803bbb:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  803bbd:	89 f8                	mov    %edi,%eax
+  803bbf:	3c ff                	cmp    $0xff,%al
+  803bc1:	74 0e                	je     803bd1 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  803bc3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803bc6:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803bc9:	83 c4 14             	add    $0x14,%esp
+  803bcc:	5b                   	pop    %ebx
+  803bcd:	5e                   	pop    %esi
+  803bce:	5f                   	pop    %edi
+  803bcf:	5d                   	pop    %ebp
+  803bd0:	c3                   	ret
+	pgnum = 0;
+  803bd1:	c7 05 28 90 80 00 00 	movl   $0x0,0x809028
+  803bd8:	00 00 00 
+	return (void*)UTOP;
+  803bdb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803be0:	eb e7                	jmp    803bc9 <nfu+0x165>
+
+00803be2 <lru>:
+{
+  803be2:	55                   	push   %ebp
+  803be3:	89 e5                	mov    %esp,%ebp
+  803be5:	57                   	push   %edi
+  803be6:	56                   	push   %esi
+  803be7:	53                   	push   %ebx
+  803be8:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803beb:	8b 3d 24 90 80 00    	mov    0x809024,%edi
+	long long time_min = 9223372036854775807;
+  803bf1:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  803bf8:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  803bff:	be 00 00 00 00       	mov    $0x0,%esi
+  803c04:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803c0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c10:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  803c13:	eb 18                	jmp    803c2d <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  803c15:	f7 d0                	not    %eax
+  803c17:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803c1c:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  803c1e:	83 c2 01             	add    $0x1,%edx
+  803c21:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  803c27:	0f 87 fa 00 00 00    	ja     803d27 <lru+0x145>
+		++num_searched_ptes;
+  803c2d:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803c30:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  803c33:	01 d0                	add    %edx,%eax
+  803c35:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  803c3a:	89 c1                	mov    %eax,%ecx
+  803c3c:	c1 e9 0a             	shr    $0xa,%ecx
+  803c3f:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  803c46:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  803c4c:	83 f9 01             	cmp    $0x1,%ecx
+  803c4f:	75 c4                	jne    803c15 <lru+0x33>
+  803c51:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  803c56:	77 bd                	ja     803c15 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  803c58:	89 c1                	mov    %eax,%ecx
+  803c5a:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803c5d:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  803c63:	0f 87 92 00 00 00    	ja     803cfb <lru+0x119>
+  803c69:	81 f9 2c 10 81 00    	cmp    $0x81102c,%ecx
+  803c6f:	0f 82 86 00 00 00    	jb     803cfb <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803c75:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  803c7c:	f6 c1 01             	test   $0x1,%cl
+  803c7f:	74 7a                	je     803cfb <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803c81:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  803c88:	f6 c5 04             	test   $0x4,%ch
+  803c8b:	75 6e                	jne    803cfb <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  803c8d:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  803c94:	f6 c5 02             	test   $0x2,%ch
+  803c97:	75 62                	jne    803cfb <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  803c99:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803ca0:	c1 e9 0c             	shr    $0xc,%ecx
+  803ca3:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803ca6:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803cac:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  803cb0:	66 83 f9 01          	cmp    $0x1,%cx
+  803cb4:	77 45                	ja     803cfb <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  803cb6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803cbd:	c1 e9 0c             	shr    $0xc,%ecx
+  803cc0:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803cc3:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803cc9:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803ccc:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803ccf:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  803cd2:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803cd5:	19 df                	sbb    %ebx,%edi
+  803cd7:	7c 22                	jl     803cfb <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  803cd9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803ce0:	c1 e9 0c             	shr    $0xc,%ecx
+  803ce3:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  803ce6:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  803cec:	8b 59 14             	mov    0x14(%ecx),%ebx
+  803cef:	8b 49 10             	mov    0x10(%ecx),%ecx
+  803cf2:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  803cf5:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  803cf8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  803cfb:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  803cfe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  803d05:	df 6d e0             	fildll -0x20(%ebp)
+  803d08:	d9 05 b4 68 80 00    	flds   0x8068b4
+  803d0e:	d9 c9                	fxch   %st(1)
+  803d10:	df f1                	fcomip %st(1),%st
+  803d12:	dd d8                	fstp   %st(0)
+  803d14:	0f 82 04 ff ff ff    	jb     803c1e <lru+0x3c>
+			pgnum = pgnum_actual;
+  803d1a:	a3 24 90 80 00       	mov    %eax,0x809024
+			return (void*)(pgnum_opt*PGSIZE);
+  803d1f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803d22:	c1 e0 0c             	shl    $0xc,%eax
+  803d25:	eb 06                	jmp    803d2d <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  803d27:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  803d2a:	c1 e0 0c             	shl    $0xc,%eax
+}
+  803d2d:	83 c4 1c             	add    $0x1c,%esp
+  803d30:	5b                   	pop    %ebx
+  803d31:	5e                   	pop    %esi
+  803d32:	5f                   	pop    %edi
+  803d33:	5d                   	pop    %ebp
+  803d34:	c3                   	ret
+
+00803d35 <set_page_choice_func>:
+{
+  803d35:	55                   	push   %ebp
+  803d36:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  803d38:	8b 45 08             	mov    0x8(%ebp),%eax
+  803d3b:	a3 58 70 80 00       	mov    %eax,0x807058
+}
+  803d40:	5d                   	pop    %ebp
+  803d41:	c3                   	ret
+
+00803d42 <get_page_choice>:
+{
+  803d42:	55                   	push   %ebp
+  803d43:	89 e5                	mov    %esp,%ebp
+  803d45:	57                   	push   %edi
+  803d46:	56                   	push   %esi
+  803d47:	53                   	push   %ebx
+  803d48:	83 ec 24             	sub    $0x24,%esp
+  803d4b:	8b 75 08             	mov    0x8(%ebp),%esi
+  803d4e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  803d51:	57                   	push   %edi
+  803d52:	56                   	push   %esi
+  803d53:	ff 15 58 70 80 00    	call   *0x807058
+  803d59:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803d5b:	83 c4 10             	add    $0x10,%esp
+  803d5e:	eb 25                	jmp    803d85 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  803d60:	83 ec 08             	sub    $0x8,%esp
+  803d63:	c1 e0 16             	shl    $0x16,%eax
+  803d66:	50                   	push   %eax
+  803d67:	6a 00                	push   $0x0
+  803d69:	e8 f6 d3 ff ff       	call   801164 <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803d6e:	83 c4 10             	add    $0x10,%esp
+  803d71:	85 c0                	test   %eax,%eax
+  803d73:	75 43                	jne    803db8 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  803d75:	83 ec 08             	sub    $0x8,%esp
+  803d78:	57                   	push   %edi
+  803d79:	56                   	push   %esi
+  803d7a:	ff 15 58 70 80 00    	call   *0x807058
+  803d80:	89 c3                	mov    %eax,%ebx
+  803d82:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  803d85:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  803d88:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803d8e:	0f 86 ae 00 00 00    	jbe    803e42 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803d94:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  803d99:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803da0:	81 e2 81 00 00 00    	and    $0x81,%edx
+  803da6:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  803dac:	74 b2                	je     803d60 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  803dae:	83 c0 01             	add    $0x1,%eax
+  803db1:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  803db6:	75 e1                	jne    803d99 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803db8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803dbb:	05 00 10 40 11       	add    $0x11401000,%eax
+  803dc0:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803dc5:	76 1f                	jbe    803de6 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  803dc7:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  803dcc:	89 d8                	mov    %ebx,%eax
+  803dce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dd1:	5b                   	pop    %ebx
+  803dd2:	5e                   	pop    %esi
+  803dd3:	5f                   	pop    %edi
+  803dd4:	5d                   	pop    %ebp
+  803dd5:	c3                   	ret
+		sys_page_split(0, pg_out);
+  803dd6:	83 ec 08             	sub    $0x8,%esp
+  803dd9:	53                   	push   %ebx
+  803dda:	6a 00                	push   $0x0
+  803ddc:	e8 83 d3 ff ff       	call   801164 <sys_page_split>
+  803de1:	83 c4 10             	add    $0x10,%esp
+  803de4:	eb 6c                	jmp    803e52 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  803de6:	83 ec 04             	sub    $0x4,%esp
+  803de9:	68 5c 64 80 00       	push   $0x80645c
+  803dee:	68 cc 01 00 00       	push   $0x1cc
+  803df3:	68 cb 63 80 00       	push   $0x8063cb
+  803df8:	e8 eb c6 ff ff       	call   8004e8 <_panic>
+		panic("We tried to page out code pages\n");
+  803dfd:	83 ec 04             	sub    $0x4,%esp
+  803e00:	68 8c 64 80 00       	push   $0x80648c
+  803e05:	68 d6 01 00 00       	push   $0x1d6
+  803e0a:	68 cb 63 80 00       	push   $0x8063cb
+  803e0f:	e8 d4 c6 ff ff       	call   8004e8 <_panic>
+		panic("Invalid mapping for the va\n");
+  803e14:	83 ec 04             	sub    $0x4,%esp
+  803e17:	68 d8 63 80 00       	push   $0x8063d8
+  803e1c:	68 da 01 00 00       	push   $0x1da
+  803e21:	68 cb 63 80 00       	push   $0x8063cb
+  803e26:	e8 bd c6 ff ff       	call   8004e8 <_panic>
+		panic("We tried to page out a shared page\n");
+  803e2b:	83 ec 04             	sub    $0x4,%esp
+  803e2e:	68 b0 64 80 00       	push   $0x8064b0
+  803e33:	68 e0 01 00 00       	push   $0x1e0
+  803e38:	68 cb 63 80 00       	push   $0x8063cb
+  803e3d:	e8 a6 c6 ff ff       	call   8004e8 <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  803e42:	89 de                	mov    %ebx,%esi
+  803e44:	c1 ee 16             	shr    $0x16,%esi
+  803e47:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803e4e:	a8 80                	test   $0x80,%al
+  803e50:	75 84                	jne    803dd6 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  803e52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803e55:	05 00 10 40 11       	add    $0x11401000,%eax
+  803e5a:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803e5f:	76 85                	jbe    803de6 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  803e61:	89 d8                	mov    %ebx,%eax
+  803e63:	e8 7e f3 ff ff       	call   8031e6 <page_is_clean>
+  803e68:	84 c0                	test   %al,%al
+  803e6a:	0f 85 5c ff ff ff    	jne    803dcc <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  803e70:	81 7d e4 2c 10 81 00 	cmpl   $0x81102c,-0x1c(%ebp)
+  803e77:	76 84                	jbe    803dfd <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  803e79:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  803e80:	a8 01                	test   $0x1,%al
+  803e82:	74 90                	je     803e14 <get_page_choice+0xd2>
+  803e84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803e87:	c1 e8 0c             	shr    $0xc,%eax
+  803e8a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803e91:	f6 c2 01             	test   $0x1,%dl
+  803e94:	0f 84 7a ff ff ff    	je     803e14 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803e9a:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  803ea1:	f6 c2 01             	test   $0x1,%dl
+  803ea4:	74 85                	je     803e2b <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803ea6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  803ead:	f6 c2 01             	test   $0x1,%dl
+  803eb0:	0f 84 75 ff ff ff    	je     803e2b <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803eb6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  803ebd:	f6 c6 04             	test   $0x4,%dh
+  803ec0:	0f 85 65 ff ff ff    	jne    803e2b <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  803ec6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  803ecd:	f6 c6 02             	test   $0x2,%dh
+  803ed0:	0f 85 55 ff ff ff    	jne    803e2b <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  803ed6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803edd:	c1 e8 0c             	shr    $0xc,%eax
+  803ee0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  803ee3:	05 00 00 00 ef       	add    $0xef000000,%eax
+  803ee8:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  803eec:	66 83 f8 01          	cmp    $0x1,%ax
+  803ef0:	0f 86 d6 fe ff ff    	jbe    803dcc <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  803ef6:	83 ec 04             	sub    $0x4,%esp
+  803ef9:	68 d4 64 80 00       	push   $0x8064d4
+  803efe:	68 e2 01 00 00       	push   $0x1e2
+  803f03:	68 cb 63 80 00       	push   $0x8063cb
+  803f08:	e8 db c5 ff ff       	call   8004e8 <_panic>
+
+00803f0d <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  803f0d:	55                   	push   %ebp
+  803f0e:	89 e5                	mov    %esp,%ebp
+  803f10:	57                   	push   %edi
+  803f11:	56                   	push   %esi
+  803f12:	53                   	push   %ebx
+  803f13:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  803f16:	e8 e8 f6 ff ff       	call   803603 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  803f1b:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  803f20:	85 c0                	test   %eax,%eax
+  803f22:	74 41                	je     803f65 <page_share_paged_out+0x58>
+  803f24:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  803f2b:	0f 84 fd 00 00 00    	je     80402e <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  803f31:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  803f38:	00 00 00 
+  803f3b:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  803f42:	00 00 00 
+  803f45:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f4a:	eb 2c                	jmp    803f78 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803f4c:	83 c3 04             	add    $0x4,%ebx
+  803f4f:	39 f3                	cmp    %esi,%ebx
+  803f51:	74 1a                	je     803f6d <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  803f53:	8b 03                	mov    (%ebx),%eax
+  803f55:	a8 01                	test   $0x1,%al
+  803f57:	74 f3                	je     803f4c <page_share_paged_out+0x3f>
+  803f59:	c1 e8 0c             	shr    $0xc,%eax
+  803f5c:	e8 2b f5 ff ff       	call   80348c <page_share_slot>
+  803f61:	85 c0                	test   %eax,%eax
+  803f63:	79 e7                	jns    803f4c <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  803f65:	83 c4 0c             	add    $0xc,%esp
+  803f68:	5b                   	pop    %ebx
+  803f69:	5e                   	pop    %esi
+  803f6a:	5f                   	pop    %edi
+  803f6b:	5d                   	pop    %ebp
+  803f6c:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  803f6d:	83 c7 04             	add    $0x4,%edi
+  803f70:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  803f76:	74 1b                	je     803f93 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  803f78:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  803f7d:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  803f80:	f6 c3 01             	test   $0x1,%bl
+  803f83:	74 e8                	je     803f6d <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  803f85:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  803f8b:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  803f91:	eb bc                	jmp    803f4f <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803f93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f98:	eb 11                	jmp    803fab <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  803f9a:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  803fa0:	83 c3 01             	add    $0x1,%ebx
+  803fa3:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  803fa9:	77 41                	ja     803fec <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  803fab:	89 d8                	mov    %ebx,%eax
+  803fad:	c1 e8 0a             	shr    $0xa,%eax
+  803fb0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803fb7:	25 81 00 00 00       	and    $0x81,%eax
+  803fbc:	83 f8 01             	cmp    $0x1,%eax
+  803fbf:	75 d9                	jne    803f9a <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803fc1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803fc8:	25 81 00 00 00       	and    $0x81,%eax
+  803fcd:	3d 80 00 00 00       	cmp    $0x80,%eax
+  803fd2:	75 cc                	jne    803fa0 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  803fd4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  803fdb:	c1 e8 0c             	shr    $0xc,%eax
+  803fde:	e8 a9 f4 ff ff       	call   80348c <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803fe3:	85 c0                	test   %eax,%eax
+  803fe5:	79 b9                	jns    803fa0 <page_share_paged_out+0x93>
+  803fe7:	e9 79 ff ff ff       	jmp    803f65 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803fec:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  803ff3:	75 13                	jne    804008 <page_share_paged_out+0xfb>
+  803ff5:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  803ffc:	75 1d                	jne    80401b <page_share_paged_out+0x10e>
+	return 0;
+  803ffe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804003:	e9 5d ff ff ff       	jmp    803f65 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  804008:	b8 00 00 00 00       	mov    $0x0,%eax
+  80400d:	e8 46 f4 ff ff       	call   803458 <page_share_send>
+  804012:	85 c0                	test   %eax,%eax
+  804014:	79 df                	jns    803ff5 <page_share_paged_out+0xe8>
+  804016:	e9 4a ff ff ff       	jmp    803f65 <page_share_paged_out+0x58>
+  80401b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804020:	e8 33 f4 ff ff       	call   803458 <page_share_send>
+  804025:	85 c0                	test   %eax,%eax
+  804027:	79 d5                	jns    803ffe <page_share_paged_out+0xf1>
+  804029:	e9 37 ff ff ff       	jmp    803f65 <page_share_paged_out+0x58>
+		return 0;
+  80402e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804033:	e9 2d ff ff ff       	jmp    803f65 <page_share_paged_out+0x58>
+
+00804038 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  804038:	55                   	push   %ebp
+  804039:	89 e5                	mov    %esp,%ebp
+  80403b:	56                   	push   %esi
+  80403c:	53                   	push   %ebx
+  80403d:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  804040:	e8 be f5 ff ff       	call   803603 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  804045:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  80404a:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  804051:	0f 84 82 00 00 00    	je     8040d9 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  804057:	83 ec 0c             	sub    $0xc,%esp
+  80405a:	68 00 10 00 00       	push   $0x1000
+  80405f:	e8 84 11 00 00       	call   8051e8 <malloc>
+  804064:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  804066:	83 c4 0c             	add    $0xc,%esp
+  804069:	6a 14                	push   $0x14
+  80406b:	6a 00                	push   $0x0
+  80406d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  804070:	50                   	push   %eax
+  804071:	e8 85 cc ff ff       	call   800cfb <memset>
+  804076:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  804079:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  80407e:	83 ec 0c             	sub    $0xc,%esp
+  804081:	6a 07                	push   $0x7
+  804083:	6a 01                	push   $0x1
+  804085:	53                   	push   %ebx
+  804086:	6a 03                	push   $0x3
+  804088:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  80408f:	e8 43 18 00 00       	call   8058d7 <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  804094:	8b 03                	mov    (%ebx),%eax
+  804096:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  804099:	8b 43 04             	mov    0x4(%ebx),%eax
+  80409c:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  80409f:	8b 43 08             	mov    0x8(%ebx),%eax
+  8040a2:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8040a5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8040a8:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8040ab:	8b 43 10             	mov    0x10(%ebx),%eax
+  8040ae:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8040b1:	83 c6 01             	add    $0x1,%esi
+  8040b4:	83 c4 20             	add    $0x20,%esp
+  8040b7:	83 fe 02             	cmp    $0x2,%esi
+  8040ba:	75 c2                	jne    80407e <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8040bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8040bf:	89 03                	mov    %eax,(%ebx)
+  8040c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8040c4:	89 43 04             	mov    %eax,0x4(%ebx)
+  8040c7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8040ca:	89 43 08             	mov    %eax,0x8(%ebx)
+  8040cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8040d0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8040d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8040d6:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8040d9:	89 d8                	mov    %ebx,%eax
+  8040db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8040de:	5b                   	pop    %ebx
+  8040df:	5e                   	pop    %esi
+  8040e0:	5d                   	pop    %ebp
+  8040e1:	c3                   	ret
+
+008040e2 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  8040e2:	55                   	push   %ebp
+  8040e3:	89 e5                	mov    %esp,%ebp
+  8040e5:	53                   	push   %ebx
+  8040e6:	83 ec 10             	sub    $0x10,%esp
+  8040e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  8040ec:	68 b8 5c 80 00       	push   $0x805cb8
+  8040f1:	e8 cd c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  8040f6:	83 c4 08             	add    $0x8,%esp
+  8040f9:	ff 33                	push   (%ebx)
+  8040fb:	68 08 65 80 00       	push   $0x806508
+  804100:	e8 be c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  804105:	83 c4 08             	add    $0x8,%esp
+  804108:	ff 73 04             	push   0x4(%ebx)
+  80410b:	68 f4 63 80 00       	push   $0x8063f4
+  804110:	e8 ae c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  804115:	83 c4 08             	add    $0x8,%esp
+  804118:	ff 73 08             	push   0x8(%ebx)
+  80411b:	68 28 65 80 00       	push   $0x806528
+  804120:	e8 9e c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  804125:	83 c4 08             	add    $0x8,%esp
+  804128:	ff 73 0c             	push   0xc(%ebx)
+  80412b:	68 4c 65 80 00       	push   $0x80654c
+  804130:	e8 8e c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  804135:	83 c4 08             	add    $0x8,%esp
+  804138:	ff 73 10             	push   0x10(%ebx)
+  80413b:	68 70 65 80 00       	push   $0x806570
+  804140:	e8 7e c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  804145:	83 c4 08             	add    $0x8,%esp
+  804148:	ff 35 08 c0 80 00    	push   0x80c008
+  80414e:	68 ac 65 80 00       	push   $0x8065ac
+  804153:	e8 6b c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  804158:	83 c4 08             	add    $0x8,%esp
+  80415b:	ff 35 04 c0 80 00    	push   0x80c004
+  804161:	68 e0 65 80 00       	push   $0x8065e0
+  804166:	e8 58 c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  80416b:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804170:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  804173:	8b 50 68             	mov    0x68(%eax),%edx
+  804176:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  804179:	51                   	push   %ecx
+  80417a:	52                   	push   %edx
+  80417b:	50                   	push   %eax
+  80417c:	68 20 66 80 00       	push   $0x806620
+  804181:	e8 3d c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  804186:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80418b:	8b 40 70             	mov    0x70(%eax),%eax
+  80418e:	83 c4 18             	add    $0x18,%esp
+  804191:	50                   	push   %eax
+  804192:	68 54 66 80 00       	push   $0x806654
+  804197:	e8 27 c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  80419c:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8041a2:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8041a8:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8041ad:	51                   	push   %ecx
+  8041ae:	52                   	push   %edx
+  8041af:	50                   	push   %eax
+  8041b0:	68 84 66 80 00       	push   $0x806684
+  8041b5:	e8 09 c4 ff ff       	call   8005c3 <cprintf>
+	cprintf("\n");
+  8041ba:	83 c4 14             	add    $0x14,%esp
+  8041bd:	68 b8 5c 80 00       	push   $0x805cb8
+  8041c2:	e8 fc c3 ff ff       	call   8005c3 <cprintf>
+}
+  8041c7:	83 c4 10             	add    $0x10,%esp
+  8041ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8041cd:	c9                   	leave
+  8041ce:	c3                   	ret
+
+008041cf <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8041cf:	55                   	push   %ebp
+  8041d0:	89 e5                	mov    %esp,%ebp
+  8041d2:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8041d5:	e8 5e fe ff ff       	call   804038 <get_paging_stats>
+  8041da:	83 ec 0c             	sub    $0xc,%esp
+  8041dd:	50                   	push   %eax
+  8041de:	e8 ff fe ff ff       	call   8040e2 <print_paging_stats>
+}
+  8041e3:	83 c4 10             	add    $0x10,%esp
+  8041e6:	c9                   	leave
+  8041e7:	c3                   	ret
+
+008041e8 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  8041e8:	55                   	push   %ebp
+  8041e9:	89 e5                	mov    %esp,%ebp
+  8041eb:	53                   	push   %ebx
+  8041ec:	83 ec 04             	sub    $0x4,%esp
+  8041ef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  8041f2:	eb 13                	jmp    804207 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  8041f4:	83 ec 04             	sub    $0x4,%esp
+  8041f7:	6a ff                	push   $0xffffffff
+  8041f9:	53                   	push   %ebx
+  8041fa:	68 00 f0 ff ee       	push   $0xeefff000
+  8041ff:	e8 72 d3 ff ff       	call   801576 <sys_futex_wait>
+  804204:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  804207:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80420c:	39 d8                	cmp    %ebx,%eax
+  80420e:	74 e4                	je     8041f4 <mem_pressure_wait+0xc>
+	return now;
+}
+  804210:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804213:	c9                   	leave
+  804214:	c3                   	ret
+
+00804215 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  804215:	55                   	push   %ebp
+  804216:	89 e5                	mov    %esp,%ebp
+  804218:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80421b:	68 87 4e 80 00       	push   $0x804e87
+  804220:	e8 be 14 00 00       	call   8056e3 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  804225:	c7 05 14 f9 80 00 00 	movl   $0xdeadb000,0x80f914
+  80422c:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80422f:	83 c4 0c             	add    $0xc,%esp
+  804232:	68 07 02 00 00       	push   $0x207
+  804237:	68 00 b0 ad de       	push   $0xdeadb000
+  80423c:	6a 00                	push   $0x0
+  80423e:	e8 5a ce ff ff       	call   80109d <sys_page_alloc>
+  804243:	83 c4 10             	add    $0x10,%esp
+  804246:	85 c0                	test   %eax,%eax
+  804248:	78 0c                	js     804256 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  80424a:	e8 b4 f3 ff ff       	call   803603 <find_paging_env>
+	page_ring_ready();
+  80424f:	e8 7f f2 ff ff       	call   8034d3 <page_ring_ready>
+}
+  804254:	c9                   	leave
+  804255:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  804256:	50                   	push   %eax
+  804257:	68 12 64 80 00       	push   $0x806412
+  80425c:	68 13 05 00 00       	push   $0x513
+  804261:	68 cb 63 80 00       	push   $0x8063cb
+  804266:	e8 7d c2 ff ff       	call   8004e8 <_panic>
+
+0080426b <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  80426b:	55                   	push   %ebp
+  80426c:	89 e5                	mov    %esp,%ebp
+  80426e:	57                   	push   %edi
+  80426f:	56                   	push   %esi
+  804270:	53                   	push   %ebx
+  804271:	83 ec 0c             	sub    $0xc,%esp
+  804274:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  804277:	89 fa                	mov    %edi,%edx
+  804279:	c1 ea 16             	shr    $0x16,%edx
+  80427c:	a1 14 f9 80 00       	mov    0x80f914,%eax
+  804281:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  804284:	f6 06 01             	testb  $0x1,(%esi)
+  804287:	75 3e                	jne    8042c7 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  804289:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  80428e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  804292:	74 47                	je     8042db <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  804294:	83 ec 0c             	sub    $0xc,%esp
+  804297:	6a 01                	push   $0x1
+  804299:	e8 f2 11 00 00       	call   805490 <va_alloc>
+  80429e:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8042a0:	83 c4 10             	add    $0x10,%esp
+  8042a3:	85 c0                	test   %eax,%eax
+  8042a5:	74 34                	je     8042db <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8042a7:	6a 00                	push   $0x0
+  8042a9:	68 07 02 00 00       	push   $0x207
+  8042ae:	50                   	push   %eax
+  8042af:	6a 00                	push   $0x0
+  8042b1:	e8 df 02 00 00       	call   804595 <page_alloc>
+  8042b6:	83 c4 10             	add    $0x10,%esp
+  8042b9:	85 c0                	test   %eax,%eax
+  8042bb:	78 28                	js     8042e5 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8042bd:	f6 06 01             	testb  $0x1,(%esi)
+  8042c0:	75 38                	jne    8042fa <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8042c2:	83 cb 01             	or     $0x1,%ebx
+  8042c5:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8042c7:	89 f8                	mov    %edi,%eax
+  8042c9:	c1 e8 0a             	shr    $0xa,%eax
+  8042cc:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8042d1:	8b 1e                	mov    (%esi),%ebx
+  8042d3:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8042d9:	01 c3                	add    %eax,%ebx
+}
+  8042db:	89 d8                	mov    %ebx,%eax
+  8042dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042e0:	5b                   	pop    %ebx
+  8042e1:	5e                   	pop    %esi
+  8042e2:	5f                   	pop    %edi
+  8042e3:	5d                   	pop    %ebp
+  8042e4:	c3                   	ret
+			va_free(page, 1);
+  8042e5:	83 ec 08             	sub    $0x8,%esp
+  8042e8:	6a 01                	push   $0x1
+  8042ea:	53                   	push   %ebx
+  8042eb:	e8 d8 12 00 00       	call   8055c8 <va_free>
+			return NULL;
+  8042f0:	83 c4 10             	add    $0x10,%esp
+  8042f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8042f8:	eb e1                	jmp    8042db <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  8042fa:	83 ec 08             	sub    $0x8,%esp
+  8042fd:	53                   	push   %ebx
+  8042fe:	6a 00                	push   $0x0
+  804300:	e8 1d ce ff ff       	call   801122 <sys_page_unmap>
+			va_free(page, 1);
+  804305:	83 c4 08             	add    $0x8,%esp
+  804308:	6a 01                	push   $0x1
+  80430a:	53                   	push   %ebx
+  80430b:	e8 b8 12 00 00       	call   8055c8 <va_free>
+  804310:	83 c4 10             	add    $0x10,%esp
+  804313:	eb b2                	jmp    8042c7 <umapdir_walk+0x5c>
+
+00804315 <page_out>:
+{
+  804315:	55                   	push   %ebp
+  804316:	89 e5                	mov    %esp,%ebp
+  804318:	57                   	push   %edi
+  804319:	56                   	push   %esi
+  80431a:	53                   	push   %ebx
+  80431b:	83 ec 5c             	sub    $0x5c,%esp
+  80431e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  804321:	e8 dd f2 ff ff       	call   803603 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  804326:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  80432b:	85 c0                	test   %eax,%eax
+  80432d:	74 1e                	je     80434d <page_out+0x38>
+  80432f:	83 ec 0c             	sub    $0xc,%esp
+  804332:	6a 00                	push   $0x0
+  804334:	6a 00                	push   $0x0
+  804336:	6a 00                	push   $0x0
+  804338:	6a 08                	push   $0x8
+  80433a:	50                   	push   %eax
+  80433b:	e8 97 15 00 00       	call   8058d7 <ipc_call>
+  804340:	89 c3                	mov    %eax,%ebx
+  804342:	83 c4 20             	add    $0x20,%esp
+  804345:	85 c0                	test   %eax,%eax
+  804347:	0f 84 ac 00 00 00    	je     8043f9 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80434d:	83 ec 08             	sub    $0x8,%esp
+  804350:	ff 75 0c             	push   0xc(%ebp)
+  804353:	57                   	push   %edi
+  804354:	e8 e9 f9 ff ff       	call   803d42 <get_page_choice>
+  804359:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  80435b:	83 c4 10             	add    $0x10,%esp
+  80435e:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  804363:	0f 84 18 02 00 00    	je     804581 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  804369:	e8 78 ee ff ff       	call   8031e6 <page_is_clean>
+  80436e:	84 c0                	test   %al,%al
+  804370:	0f 85 8c 00 00 00    	jne    804402 <page_out+0xed>
+	if (pagingenv == 0)
+  804376:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  80437d:	0f 84 08 02 00 00    	je     80458b <page_out+0x276>
+	if (page_ring_ready())
+  804383:	e8 4b f1 ff ff       	call   8034d3 <page_ring_ready>
+  804388:	89 c3                	mov    %eax,%ebx
+  80438a:	85 c0                	test   %eax,%eax
+  80438c:	0f 85 89 00 00 00    	jne    80441b <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  804392:	83 ec 0c             	sub    $0xc,%esp
+  804395:	6a 05                	push   $0x5
+  804397:	6a 01                	push   $0x1
+  804399:	56                   	push   %esi
+  80439a:	6a 01                	push   $0x1
+  80439c:	ff 35 40 c0 80 00    	push   0x80c040
+  8043a2:	e8 30 15 00 00       	call   8058d7 <ipc_call>
+  8043a7:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8043a9:	83 c4 20             	add    $0x20,%esp
+  8043ac:	85 c0                	test   %eax,%eax
+  8043ae:	0f 88 b8 01 00 00    	js     80456c <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8043b4:	89 f0                	mov    %esi,%eax
+  8043b6:	c1 e8 0c             	shr    $0xc,%eax
+  8043b9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8043c0:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8043c3:	83 ec 08             	sub    $0x8,%esp
+  8043c6:	56                   	push   %esi
+  8043c7:	6a 00                	push   $0x0
+  8043c9:	e8 54 cd ff ff       	call   801122 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8043ce:	83 c4 08             	add    $0x8,%esp
+  8043d1:	6a 01                	push   $0x1
+  8043d3:	56                   	push   %esi
+  8043d4:	e8 92 fe ff ff       	call   80426b <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8043d9:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8043dc:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  8043e2:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  8043e5:	09 fe                	or     %edi,%esi
+  8043e7:	83 ce 01             	or     $0x1,%esi
+  8043ea:	89 30                	mov    %esi,(%eax)
+	return 0;
+  8043ec:	83 c4 10             	add    $0x10,%esp
+}
+  8043ef:	89 d8                	mov    %ebx,%eax
+  8043f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8043f4:	5b                   	pop    %ebx
+  8043f5:	5e                   	pop    %esi
+  8043f6:	5f                   	pop    %edi
+  8043f7:	5d                   	pop    %ebp
+  8043f8:	c3                   	ret
+		num_page_reclaims++;
+  8043f9:	83 05 04 c0 80 00 01 	addl   $0x1,0x80c004
+		return 0;
+  804400:	eb ed                	jmp    8043ef <page_out+0xda>
+		num_page_drops++;
+  804402:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+		return sys_page_unmap(0, map_out_addr);
+  804409:	83 ec 08             	sub    $0x8,%esp
+  80440c:	56                   	push   %esi
+  80440d:	6a 00                	push   $0x0
+  80440f:	e8 0e cd ff ff       	call   801122 <sys_page_unmap>
+  804414:	89 c3                	mov    %eax,%ebx
+  804416:	83 c4 10             	add    $0x10,%esp
+  804419:	eb d4                	jmp    8043ef <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80441b:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80441d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  804422:	2d 00 10 00 00       	sub    $0x1000,%eax
+  804427:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  80442a:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80442c:	83 c0 08             	add    $0x8,%eax
+  80442f:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  804432:	b8 07 00 00 00       	mov    $0x7,%eax
+  804437:	e8 e5 ef ff ff       	call   803421 <page_ring_reserve>
+	first = ring->sq_tail;
+  80443c:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  804441:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  804444:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  804449:	83 ec 04             	sub    $0x4,%esp
+  80444c:	68 00 10 00 00       	push   $0x1000
+  804451:	56                   	push   %esi
+  804452:	89 d8                	mov    %ebx,%eax
+  804454:	c1 e0 0c             	shl    $0xc,%eax
+  804457:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  80445c:	50                   	push   %eax
+  80445d:	e8 30 c9 ff ff       	call   800d92 <memcpy>
+		vas[n] = va;
+  804462:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  804466:	89 d9                	mov    %ebx,%ecx
+  804468:	ba 00 00 00 00       	mov    $0x0,%edx
+  80446d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804472:	e8 de ee ff ff       	call   803355 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  804477:	8d 43 01             	lea    0x1(%ebx),%eax
+  80447a:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  80447d:	83 c4 10             	add    $0x10,%esp
+  804480:	83 fb 06             	cmp    $0x6,%ebx
+  804483:	74 62                	je     8044e7 <page_out+0x1d2>
+  804485:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  804488:	eb 15                	jmp    80449f <page_out+0x18a>
+			num_page_drops++;
+  80448a:	83 05 08 c0 80 00 01 	addl   $0x1,0x80c008
+			sys_page_unmap(0, va);
+  804491:	83 ec 08             	sub    $0x8,%esp
+  804494:	56                   	push   %esi
+  804495:	6a 00                	push   $0x0
+  804497:	e8 86 cc ff ff       	call   801122 <sys_page_unmap>
+  80449c:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  80449f:	83 ec 08             	sub    $0x8,%esp
+  8044a2:	53                   	push   %ebx
+  8044a3:	57                   	push   %edi
+  8044a4:	e8 99 f8 ff ff       	call   803d42 <get_page_choice>
+  8044a9:	89 c6                	mov    %eax,%esi
+  8044ab:	83 c4 10             	add    $0x10,%esp
+  8044ae:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8044b3:	74 32                	je     8044e7 <page_out+0x1d2>
+  8044b5:	e8 2c ed ff ff       	call   8031e6 <page_is_clean>
+  8044ba:	84 c0                	test   %al,%al
+  8044bc:	75 cc                	jne    80448a <page_out+0x175>
+		if (va == (void *) UTOP ||
+  8044be:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8044c1:	39 c6                	cmp    %eax,%esi
+  8044c3:	72 07                	jb     8044cc <page_out+0x1b7>
+  8044c5:	8b 45 98             	mov    -0x68(%ebp),%eax
+  8044c8:	39 c6                	cmp    %eax,%esi
+  8044ca:	72 1b                	jb     8044e7 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8044cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044d1:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  8044d4:	eb 03                	jmp    8044d9 <page_out+0x1c4>
+  8044d6:	83 c3 01             	add    $0x1,%ebx
+  8044d9:	39 da                	cmp    %ebx,%edx
+  8044db:	0f 84 68 ff ff ff    	je     804449 <page_out+0x134>
+  8044e1:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  8044e5:	75 ef                	jne    8044d6 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  8044e7:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  8044ea:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  8044ed:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8044f0:	e8 a6 ee ff ff       	call   80339b <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  8044f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044fa:	eb 42                	jmp    80453e <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  8044fc:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  804500:	89 f8                	mov    %edi,%eax
+  804502:	c1 e8 0c             	shr    $0xc,%eax
+  804505:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80450c:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  80450f:	83 ec 08             	sub    $0x8,%esp
+  804512:	57                   	push   %edi
+  804513:	6a 00                	push   $0x0
+  804515:	e8 08 cc ff ff       	call   801122 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  80451a:	83 c4 08             	add    $0x8,%esp
+  80451d:	6a 01                	push   $0x1
+  80451f:	57                   	push   %edi
+  804520:	e8 46 fd ff ff       	call   80426b <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  804525:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  804528:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  80452e:	c1 e6 0c             	shl    $0xc,%esi
+  804531:	09 d6                	or     %edx,%esi
+  804533:	83 ce 01             	or     $0x1,%esi
+  804536:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  804538:	83 c3 01             	add    $0x1,%ebx
+  80453b:	83 c4 10             	add    $0x10,%esp
+  80453e:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  804541:	39 c3                	cmp    %eax,%ebx
+  804543:	74 1d                	je     804562 <page_out+0x24d>
+		if (res[i] < 0)
+  804545:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  804549:	85 f6                	test   %esi,%esi
+  80454b:	79 af                	jns    8044fc <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  80454d:	56                   	push   %esi
+  80454e:	68 b4 66 80 00       	push   $0x8066b4
+  804553:	68 d1 02 00 00       	push   $0x2d1
+  804558:	68 cb 63 80 00       	push   $0x8063cb
+  80455d:	e8 86 bf ff ff       	call   8004e8 <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  804562:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804567:	e9 83 fe ff ff       	jmp    8043ef <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  80456c:	50                   	push   %eax
+  80456d:	68 b4 66 80 00       	push   $0x8066b4
+  804572:	68 0a 03 00 00       	push   $0x30a
+  804577:	68 cb 63 80 00       	push   $0x8063cb
+  80457c:	e8 67 bf ff ff       	call   8004e8 <_panic>
+		return -E_NO_MEM;
+  804581:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  804586:	e9 64 fe ff ff       	jmp    8043ef <page_out+0xda>
+		return -E_PAGING;
+  80458b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  804590:	e9 5a fe ff ff       	jmp    8043ef <page_out+0xda>
+
+00804595 <page_alloc>:
+{
+  804595:	55                   	push   %ebp
+  804596:	89 e5                	mov    %esp,%ebp
+  804598:	57                   	push   %edi
+  804599:	56                   	push   %esi
+  80459a:	53                   	push   %ebx
+  80459b:	83 ec 0c             	sub    $0xc,%esp
+  80459e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8045a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8045a4:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8045ab:	74 34                	je     8045e1 <page_alloc+0x4c>
+	if (check_mte)
+  8045ad:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8045b1:	75 35                	jne    8045e8 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  8045b3:	83 ec 04             	sub    $0x4,%esp
+  8045b6:	ff 75 10             	push   0x10(%ebp)
+  8045b9:	56                   	push   %esi
+  8045ba:	57                   	push   %edi
+  8045bb:	e8 dd ca ff ff       	call   80109d <sys_page_alloc>
+  8045c0:	89 c3                	mov    %eax,%ebx
+  8045c2:	83 c4 10             	add    $0x10,%esp
+  8045c5:	85 c0                	test   %eax,%eax
+  8045c7:	79 52                	jns    80461b <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  8045c9:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8045cc:	75 52                	jne    804620 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  8045ce:	83 ec 08             	sub    $0x8,%esp
+  8045d1:	56                   	push   %esi
+  8045d2:	57                   	push   %edi
+  8045d3:	e8 3d fd ff ff       	call   804315 <page_out>
+  8045d8:	83 c4 10             	add    $0x10,%esp
+  8045db:	85 c0                	test   %eax,%eax
+  8045dd:	79 d4                	jns    8045b3 <page_alloc+0x1e>
+  8045df:	eb 3f                	jmp    804620 <page_alloc+0x8b>
+		init_map_dir();
+  8045e1:	e8 2f fc ff ff       	call   804215 <init_map_dir>
+  8045e6:	eb c5                	jmp    8045ad <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  8045e8:	83 ec 08             	sub    $0x8,%esp
+  8045eb:	6a 00                	push   $0x0
+  8045ed:	56                   	push   %esi
+  8045ee:	e8 78 fc ff ff       	call   80426b <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  8045f3:	83 c4 10             	add    $0x10,%esp
+  8045f6:	85 c0                	test   %eax,%eax
+  8045f8:	74 b9                	je     8045b3 <page_alloc+0x1e>
+  8045fa:	8b 10                	mov    (%eax),%edx
+  8045fc:	f6 c2 01             	test   $0x1,%dl
+  8045ff:	74 b2                	je     8045b3 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  804601:	83 ec 08             	sub    $0x8,%esp
+  804604:	56                   	push   %esi
+  804605:	52                   	push   %edx
+  804606:	50                   	push   %eax
+  804607:	68 d8 66 80 00       	push   $0x8066d8
+  80460c:	68 34 03 00 00       	push   $0x334
+  804611:	68 cb 63 80 00       	push   $0x8063cb
+  804616:	e8 cd be ff ff       	call   8004e8 <_panic>
+	return 0;
+  80461b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  804620:	89 d8                	mov    %ebx,%eax
+  804622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804625:	5b                   	pop    %ebx
+  804626:	5e                   	pop    %esi
+  804627:	5f                   	pop    %edi
+  804628:	5d                   	pop    %ebp
+  804629:	c3                   	ret
+
+0080462a <page_adopt>:
+{
+  80462a:	55                   	push   %ebp
+  80462b:	89 e5                	mov    %esp,%ebp
+  80462d:	56                   	push   %esi
+  80462e:	53                   	push   %ebx
+  80462f:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  804631:	c1 e8 16             	shr    $0x16,%eax
+  804634:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80463b:	25 81 00 00 00       	and    $0x81,%eax
+  804640:	83 f8 01             	cmp    $0x1,%eax
+  804643:	75 53                	jne    804698 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  804645:	89 d8                	mov    %ebx,%eax
+  804647:	c1 e8 0c             	shr    $0xc,%eax
+  80464a:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  804651:	89 f2                	mov    %esi,%edx
+  804653:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  804659:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80465e:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  804664:	75 37                	jne    80469d <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  804666:	83 ec 08             	sub    $0x8,%esp
+  804669:	6a 01                	push   $0x1
+  80466b:	53                   	push   %ebx
+  80466c:	e8 fa fb ff ff       	call   80426b <umapdir_walk>
+  804671:	83 c4 10             	add    $0x10,%esp
+  804674:	85 c0                	test   %eax,%eax
+  804676:	74 2c                	je     8046a4 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  804678:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  80467e:	83 ce 01             	or     $0x1,%esi
+  804681:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  804683:	83 ec 08             	sub    $0x8,%esp
+  804686:	53                   	push   %ebx
+  804687:	6a 00                	push   $0x0
+  804689:	e8 94 ca ff ff       	call   801122 <sys_page_unmap>
+	return 1;
+  80468e:	83 c4 10             	add    $0x10,%esp
+  804691:	b8 01 00 00 00       	mov    $0x1,%eax
+  804696:	eb 05                	jmp    80469d <page_adopt+0x73>
+		return 0;
+  804698:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80469d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8046a0:	5b                   	pop    %ebx
+  8046a1:	5e                   	pop    %esi
+  8046a2:	5d                   	pop    %ebp
+  8046a3:	c3                   	ret
+		return -E_NO_MEM;
+  8046a4:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8046a9:	eb f2                	jmp    80469d <page_adopt+0x73>
+
+008046ab <page_forget>:
+{
+  8046ab:	55                   	push   %ebp
+  8046ac:	89 e5                	mov    %esp,%ebp
+  8046ae:	53                   	push   %ebx
+  8046af:	83 ec 04             	sub    $0x4,%esp
+  8046b2:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  8046b4:	e8 4a ef ff ff       	call   803603 <find_paging_env>
+	if (pagingenv == 0)
+  8046b9:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8046c0:	74 39                	je     8046fb <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  8046c2:	89 d8                	mov    %ebx,%eax
+  8046c4:	c1 e8 16             	shr    $0x16,%eax
+  8046c7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8046ce:	25 81 00 00 00       	and    $0x81,%eax
+  8046d3:	83 f8 01             	cmp    $0x1,%eax
+  8046d6:	74 28                	je     804700 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  8046d8:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  8046df:	74 1a                	je     8046fb <page_forget+0x50>
+  8046e1:	83 ec 08             	sub    $0x8,%esp
+  8046e4:	6a 00                	push   $0x0
+  8046e6:	53                   	push   %ebx
+  8046e7:	e8 7f fb ff ff       	call   80426b <umapdir_walk>
+  8046ec:	89 c3                	mov    %eax,%ebx
+  8046ee:	83 c4 10             	add    $0x10,%esp
+  8046f1:	85 c0                	test   %eax,%eax
+  8046f3:	74 06                	je     8046fb <page_forget+0x50>
+  8046f5:	8b 00                	mov    (%eax),%eax
+  8046f7:	a8 01                	test   $0x1,%al
+  8046f9:	75 2b                	jne    804726 <page_forget+0x7b>
+}
+  8046fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8046fe:	c9                   	leave
+  8046ff:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  804700:	89 d8                	mov    %ebx,%eax
+  804702:	c1 e8 0c             	shr    $0xc,%eax
+  804705:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80470c:	89 c2                	mov    %eax,%edx
+  80470e:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  804714:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  80471a:	75 bc                	jne    8046d8 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  80471c:	c1 e8 0c             	shr    $0xc,%eax
+  80471f:	e8 5c ee ff ff       	call   803580 <page_remove_slot>
+		return;
+  804724:	eb d5                	jmp    8046fb <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  804726:	c1 e8 0c             	shr    $0xc,%eax
+  804729:	e8 52 ee ff ff       	call   803580 <page_remove_slot>
+	*mte = 0;
+  80472e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804734:	eb c5                	jmp    8046fb <page_forget+0x50>
+
+00804736 <page_unmap>:
+{
+  804736:	55                   	push   %ebp
+  804737:	89 e5                	mov    %esp,%ebp
+  804739:	57                   	push   %edi
+  80473a:	56                   	push   %esi
+  80473b:	53                   	push   %ebx
+  80473c:	83 ec 0c             	sub    $0xc,%esp
+  80473f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804742:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  804745:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80474a:	8b 40 48             	mov    0x48(%eax),%eax
+  80474d:	85 db                	test   %ebx,%ebx
+  80474f:	0f 8e b4 00 00 00    	jle    804809 <page_unmap+0xd3>
+  804755:	39 d8                	cmp    %ebx,%eax
+  804757:	0f 84 ac 00 00 00    	je     804809 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  80475d:	83 ec 08             	sub    $0x8,%esp
+  804760:	57                   	push   %edi
+  804761:	53                   	push   %ebx
+  804762:	e8 bb c9 ff ff       	call   801122 <sys_page_unmap>
+  804767:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  804769:	e8 95 ee ff ff       	call   803603 <find_paging_env>
+	if (pagingenv == 0)
+  80476e:	83 c4 10             	add    $0x10,%esp
+  804771:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  804778:	0f 84 a1 00 00 00    	je     80481f <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80477e:	83 ec 0c             	sub    $0xc,%esp
+  804781:	6a 05                	push   $0x5
+  804783:	68 00 00 40 00       	push   $0x400000
+  804788:	6a 00                	push   $0x0
+  80478a:	68 00 b0 ad de       	push   $0xdeadb000
+  80478f:	53                   	push   %ebx
+  804790:	e8 4b c9 ff ff       	call   8010e0 <sys_page_map>
+  804795:	83 c4 20             	add    $0x20,%esp
+  804798:	85 c0                	test   %eax,%eax
+  80479a:	0f 88 89 00 00 00    	js     804829 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8047a0:	89 f8                	mov    %edi,%eax
+  8047a2:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8047a5:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  8047ac:	a8 01                	test   $0x1,%al
+  8047ae:	74 6f                	je     80481f <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8047b0:	83 ec 0c             	sub    $0xc,%esp
+  8047b3:	6a 05                	push   $0x5
+  8047b5:	68 00 00 40 00       	push   $0x400000
+  8047ba:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8047bc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8047c1:	50                   	push   %eax
+  8047c2:	53                   	push   %ebx
+  8047c3:	e8 18 c9 ff ff       	call   8010e0 <sys_page_map>
+  8047c8:	83 c4 20             	add    $0x20,%esp
+  8047cb:	85 c0                	test   %eax,%eax
+  8047cd:	78 6f                	js     80483e <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  8047cf:	c1 ef 0c             	shr    $0xc,%edi
+  8047d2:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8047d8:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  8047df:	01 
+  8047e0:	74 3d                	je     80481f <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  8047e2:	83 ec 08             	sub    $0x8,%esp
+  8047e5:	68 00 00 40 00       	push   $0x400000
+  8047ea:	6a 00                	push   $0x0
+  8047ec:	e8 31 c9 ff ff       	call   801122 <sys_page_unmap>
+  8047f1:	83 c4 10             	add    $0x10,%esp
+  8047f4:	85 c0                	test   %eax,%eax
+  8047f6:	78 5b                	js     804853 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  8047f8:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  8047ff:	c1 e8 0c             	shr    $0xc,%eax
+  804802:	e8 79 ed ff ff       	call   803580 <page_remove_slot>
+	return r;
+  804807:	eb 16                	jmp    80481f <page_unmap+0xe9>
+		page_forget(va);
+  804809:	89 f8                	mov    %edi,%eax
+  80480b:	e8 9b fe ff ff       	call   8046ab <page_forget>
+		return sys_page_unmap(envid, va);
+  804810:	83 ec 08             	sub    $0x8,%esp
+  804813:	57                   	push   %edi
+  804814:	53                   	push   %ebx
+  804815:	e8 08 c9 ff ff       	call   801122 <sys_page_unmap>
+  80481a:	89 c6                	mov    %eax,%esi
+  80481c:	83 c4 10             	add    $0x10,%esp
+}
+  80481f:	89 f0                	mov    %esi,%eax
+  804821:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804824:	5b                   	pop    %ebx
+  804825:	5e                   	pop    %esi
+  804826:	5f                   	pop    %edi
+  804827:	5d                   	pop    %ebp
+  804828:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  804829:	50                   	push   %eax
+  80482a:	68 14 67 80 00       	push   $0x806714
+  80482f:	68 e4 03 00 00       	push   $0x3e4
+  804834:	68 cb 63 80 00       	push   $0x8063cb
+  804839:	e8 aa bc ff ff       	call   8004e8 <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  80483e:	50                   	push   %eax
+  80483f:	68 40 67 80 00       	push   $0x806740
+  804844:	68 ea 03 00 00       	push   $0x3ea
+  804849:	68 cb 63 80 00       	push   $0x8063cb
+  80484e:	e8 95 bc ff ff       	call   8004e8 <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  804853:	50                   	push   %eax
+  804854:	68 6c 67 80 00       	push   $0x80676c
+  804859:	68 ef 03 00 00       	push   $0x3ef
+  80485e:	68 cb 63 80 00       	push   $0x8063cb
+  804863:	e8 80 bc ff ff       	call   8004e8 <_panic>
+
+00804868 <page_unmap_range>:
+{
+  804868:	55                   	push   %ebp
+  804869:	89 e5                	mov    %esp,%ebp
+  80486b:	57                   	push   %edi
+  80486c:	56                   	push   %esi
+  80486d:	53                   	push   %ebx
+  80486e:	83 ec 0c             	sub    $0xc,%esp
+  804871:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  804874:	e8 8a ed ff ff       	call   803603 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  804879:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  80487e:	8b 40 48             	mov    0x48(%eax),%eax
+  804881:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804885:	7e 38                	jle    8048bf <page_unmap_range+0x57>
+  804887:	3b 45 08             	cmp    0x8(%ebp),%eax
+  80488a:	74 33                	je     8048bf <page_unmap_range+0x57>
+  80488c:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  804893:	74 2a                	je     8048bf <page_unmap_range+0x57>
+  804895:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  804898:	be 00 00 00 00       	mov    $0x0,%esi
+  80489d:	39 fe                	cmp    %edi,%esi
+  80489f:	74 56                	je     8048f7 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8048a1:	83 ec 08             	sub    $0x8,%esp
+  8048a4:	53                   	push   %ebx
+  8048a5:	ff 75 08             	push   0x8(%ebp)
+  8048a8:	e8 89 fe ff ff       	call   804736 <page_unmap>
+  8048ad:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8048b3:	83 c4 10             	add    $0x10,%esp
+  8048b6:	85 c0                	test   %eax,%eax
+  8048b8:	78 35                	js     8048ef <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8048ba:	83 c6 01             	add    $0x1,%esi
+  8048bd:	eb de                	jmp    80489d <page_unmap_range+0x35>
+  8048bf:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  8048c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8048c7:	eb 10                	jmp    8048d9 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  8048c9:	89 f0                	mov    %esi,%eax
+  8048cb:	e8 db fd ff ff       	call   8046ab <page_forget>
+		for (i = 0; i < npages; i++)
+  8048d0:	83 c3 01             	add    $0x1,%ebx
+  8048d3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8048d9:	39 fb                	cmp    %edi,%ebx
+  8048db:	75 ec                	jne    8048c9 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  8048dd:	83 ec 04             	sub    $0x4,%esp
+  8048e0:	57                   	push   %edi
+  8048e1:	ff 75 0c             	push   0xc(%ebp)
+  8048e4:	ff 75 08             	push   0x8(%ebp)
+  8048e7:	e8 4a c9 ff ff       	call   801236 <sys_page_unmap_range>
+  8048ec:	83 c4 10             	add    $0x10,%esp
+}
+  8048ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048f2:	5b                   	pop    %ebx
+  8048f3:	5e                   	pop    %esi
+  8048f4:	5f                   	pop    %edi
+  8048f5:	5d                   	pop    %ebp
+  8048f6:	c3                   	ret
+	return 0;
+  8048f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048fc:	eb f1                	jmp    8048ef <page_unmap_range+0x87>
+
+008048fe <page_alloc_range>:
+{
+  8048fe:	55                   	push   %ebp
+  8048ff:	89 e5                	mov    %esp,%ebp
+  804901:	57                   	push   %edi
+  804902:	56                   	push   %esi
+  804903:	53                   	push   %ebx
+  804904:	83 ec 1c             	sub    $0x1c,%esp
+  804907:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80490a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  80490d:	83 3d 14 f9 80 00 00 	cmpl   $0x0,0x80f914
+  804914:	74 14                	je     80492a <page_alloc_range+0x2c>
+	if (check_mte)
+  804916:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80491a:	74 66                	je     804982 <page_alloc_range+0x84>
+  80491c:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  80491e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804923:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  804926:	89 c7                	mov    %eax,%edi
+  804928:	eb 10                	jmp    80493a <page_alloc_range+0x3c>
+		init_map_dir();
+  80492a:	e8 e6 f8 ff ff       	call   804215 <init_map_dir>
+  80492f:	eb e5                	jmp    804916 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  804931:	83 c7 01             	add    $0x1,%edi
+  804934:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80493a:	39 df                	cmp    %ebx,%edi
+  80493c:	74 38                	je     804976 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  80493e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804941:	83 ec 08             	sub    $0x8,%esp
+  804944:	6a 00                	push   $0x0
+  804946:	56                   	push   %esi
+  804947:	e8 1f f9 ff ff       	call   80426b <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  80494c:	83 c4 10             	add    $0x10,%esp
+  80494f:	85 c0                	test   %eax,%eax
+  804951:	74 de                	je     804931 <page_alloc_range+0x33>
+  804953:	8b 10                	mov    (%eax),%edx
+  804955:	f6 c2 01             	test   $0x1,%dl
+  804958:	74 d7                	je     804931 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  80495a:	83 ec 08             	sub    $0x8,%esp
+  80495d:	ff 75 e4             	push   -0x1c(%ebp)
+  804960:	52                   	push   %edx
+  804961:	50                   	push   %eax
+  804962:	68 d8 66 80 00       	push   $0x8066d8
+  804967:	68 0b 04 00 00       	push   $0x40b
+  80496c:	68 cb 63 80 00       	push   $0x8063cb
+  804971:	e8 72 bb ff ff       	call   8004e8 <_panic>
+  804976:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804979:	eb 07                	jmp    804982 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  80497b:	c1 e0 0c             	shl    $0xc,%eax
+  80497e:	01 c7                	add    %eax,%edi
+			npages -= r;
+  804980:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  804982:	85 db                	test   %ebx,%ebx
+  804984:	74 30                	je     8049b6 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  804986:	ff 75 14             	push   0x14(%ebp)
+  804989:	53                   	push   %ebx
+  80498a:	57                   	push   %edi
+  80498b:	ff 75 08             	push   0x8(%ebp)
+  80498e:	e8 35 c8 ff ff       	call   8011c8 <sys_page_alloc_range>
+  804993:	89 c6                	mov    %eax,%esi
+  804995:	83 c4 10             	add    $0x10,%esp
+  804998:	85 c0                	test   %eax,%eax
+  80499a:	7f df                	jg     80497b <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  80499c:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  80499f:	75 1a                	jne    8049bb <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8049a1:	83 ec 08             	sub    $0x8,%esp
+  8049a4:	57                   	push   %edi
+  8049a5:	ff 75 08             	push   0x8(%ebp)
+  8049a8:	e8 68 f9 ff ff       	call   804315 <page_out>
+  8049ad:	83 c4 10             	add    $0x10,%esp
+  8049b0:	85 c0                	test   %eax,%eax
+  8049b2:	79 ce                	jns    804982 <page_alloc_range+0x84>
+  8049b4:	eb 05                	jmp    8049bb <page_alloc_range+0xbd>
+	return 0;
+  8049b6:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8049bb:	89 f0                	mov    %esi,%eax
+  8049bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8049c0:	5b                   	pop    %ebx
+  8049c1:	5e                   	pop    %esi
+  8049c2:	5f                   	pop    %edi
+  8049c3:	5d                   	pop    %ebp
+  8049c4:	c3                   	ret
+
+008049c5 <page_in>:
+{
+  8049c5:	55                   	push   %ebp
+  8049c6:	89 e5                	mov    %esp,%ebp
+  8049c8:	57                   	push   %edi
+  8049c9:	56                   	push   %esi
+  8049ca:	53                   	push   %ebx
+  8049cb:	83 ec 3c             	sub    $0x3c,%esp
+  8049ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  8049d1:	e8 2d ec ff ff       	call   803603 <find_paging_env>
+	if (pagingenv == 0)
+  8049d6:	83 3d 40 c0 80 00 00 	cmpl   $0x0,0x80c040
+  8049dd:	0f 84 09 02 00 00    	je     804bec <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  8049e3:	83 ec 08             	sub    $0x8,%esp
+  8049e6:	6a 00                	push   $0x0
+  8049e8:	56                   	push   %esi
+  8049e9:	e8 7d f8 ff ff       	call   80426b <umapdir_walk>
+  8049ee:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  8049f0:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  8049f6:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  8049f9:	83 c4 10             	add    $0x10,%esp
+  8049fc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  804a00:	74 0d                	je     804a0f <page_in+0x4a>
+  804a02:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804a07:	8b 40 48             	mov    0x48(%eax),%eax
+  804a0a:	3b 45 08             	cmp    0x8(%ebp),%eax
+  804a0d:	75 06                	jne    804a15 <page_in+0x50>
+  804a0f:	8b 03                	mov    (%ebx),%eax
+  804a11:	a8 02                	test   $0x2,%al
+  804a13:	75 63                	jne    804a78 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  804a15:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804a17:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804a19:	89 f0                	mov    %esi,%eax
+  804a1b:	25 06 0e 00 00       	and    $0xe06,%eax
+  804a20:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  804a23:	50                   	push   %eax
+  804a24:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804a27:	57                   	push   %edi
+  804a28:	ff 75 08             	push   0x8(%ebp)
+  804a2b:	e8 65 fb ff ff       	call   804595 <page_alloc>
+  804a30:	83 c4 10             	add    $0x10,%esp
+  804a33:	85 c0                	test   %eax,%eax
+  804a35:	78 39                	js     804a70 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  804a37:	89 f0                	mov    %esi,%eax
+  804a39:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804a3c:	83 ec 0c             	sub    $0xc,%esp
+  804a3f:	6a 07                	push   $0x7
+  804a41:	6a 01                	push   $0x1
+  804a43:	57                   	push   %edi
+  804a44:	c1 e0 04             	shl    $0x4,%eax
+  804a47:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804a48:	c1 ee 1c             	shr    $0x1c,%esi
+  804a4b:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  804a4e:	ff 34 b5 44 c0 80 00 	push   0x80c044(,%esi,4)
+  804a55:	e8 7d 0e 00 00       	call   8058d7 <ipc_call>
+  804a5a:	83 c4 20             	add    $0x20,%esp
+  804a5d:	85 c0                	test   %eax,%eax
+  804a5f:	0f 88 72 01 00 00    	js     804bd7 <page_in+0x212>
+	*mte = 0;
+  804a65:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  804a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804a73:	5b                   	pop    %ebx
+  804a74:	5e                   	pop    %esi
+  804a75:	5f                   	pop    %edi
+  804a76:	5d                   	pop    %ebp
+  804a77:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  804a78:	25 06 0e 00 00       	and    $0xe06,%eax
+  804a7d:	83 c8 01             	or     $0x1,%eax
+  804a80:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  804a83:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804a86:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  804a89:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  804a8f:	be 01 00 00 00       	mov    $0x1,%esi
+  804a94:	eb 46                	jmp    804adc <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  804a96:	83 ec 08             	sub    $0x8,%esp
+  804a99:	6a 00                	push   $0x0
+  804a9b:	51                   	push   %ecx
+  804a9c:	e8 ca f7 ff ff       	call   80426b <umapdir_walk>
+  804aa1:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  804aa5:	83 c4 10             	add    $0x10,%esp
+  804aa8:	85 c0                	test   %eax,%eax
+  804aaa:	74 66                	je     804b12 <page_in+0x14d>
+  804aac:	8b 00                	mov    (%eax),%eax
+  804aae:	a8 01                	test   $0x1,%al
+  804ab0:	74 60                	je     804b12 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  804ab2:	89 c2                	mov    %eax,%edx
+  804ab4:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  804aba:	83 ca 01             	or     $0x1,%edx
+  804abd:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  804ac0:	75 50                	jne    804b12 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  804ac2:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804ac8:	c1 e8 1c             	shr    $0x1c,%eax
+  804acb:	8b 13                	mov    (%ebx),%edx
+  804acd:	c1 ea 1c             	shr    $0x1c,%edx
+  804ad0:	39 d0                	cmp    %edx,%eax
+  804ad2:	75 3e                	jne    804b12 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  804ad4:	83 c6 01             	add    $0x1,%esi
+  804ad7:	83 fe 08             	cmp    $0x8,%esi
+  804ada:	74 3f                	je     804b1b <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  804adc:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804ade:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  804ae4:	77 2c                	ja     804b12 <page_in+0x14d>
+  804ae6:	89 f8                	mov    %edi,%eax
+  804ae8:	c1 e8 16             	shr    $0x16,%eax
+  804aeb:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  804af2:	f6 c2 01             	test   $0x1,%dl
+  804af5:	74 9f                	je     804a96 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804af7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  804afe:	a8 80                	test   $0x80,%al
+  804b00:	75 10                	jne    804b12 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  804b02:	89 f8                	mov    %edi,%eax
+  804b04:	c1 e8 0c             	shr    $0xc,%eax
+  804b07:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804b0e:	a8 01                	test   $0x1,%al
+  804b10:	74 84                	je     804a96 <page_in+0xd1>
+	if (n == 1)
+  804b12:	83 fe 01             	cmp    $0x1,%esi
+  804b15:	0f 84 fa fe ff ff    	je     804a15 <page_in+0x50>
+	req.nslots = n;
+  804b1b:	89 35 00 90 80 00    	mov    %esi,0x809000
+	for (i = 0; i < n; i++)
+  804b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b26:	eb 13                	jmp    804b3b <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  804b28:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  804b2c:	8b 12                	mov    (%edx),%edx
+  804b2e:	c1 ea 0c             	shr    $0xc,%edx
+  804b31:	89 14 85 04 90 80 00 	mov    %edx,0x809004(,%eax,4)
+	for (i = 0; i < n; i++)
+  804b38:	83 c0 01             	add    $0x1,%eax
+  804b3b:	39 c6                	cmp    %eax,%esi
+  804b3d:	75 e9                	jne    804b28 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  804b3f:	83 ec 0c             	sub    $0xc,%esp
+  804b42:	6a 00                	push   $0x0
+  804b44:	ff 75 c0             	push   -0x40(%ebp)
+  804b47:	56                   	push   %esi
+  804b48:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  804b4b:	57                   	push   %edi
+  804b4c:	6a 00                	push   $0x0
+  804b4e:	e8 ab fd ff ff       	call   8048fe <page_alloc_range>
+  804b53:	83 c4 20             	add    $0x20,%esp
+  804b56:	85 c0                	test   %eax,%eax
+  804b58:	78 6e                	js     804bc8 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  804b5a:	83 ec 04             	sub    $0x4,%esp
+  804b5d:	6a 24                	push   $0x24
+  804b5f:	68 00 90 80 00       	push   $0x809000
+  804b64:	57                   	push   %edi
+  804b65:	e8 c6 c1 ff ff       	call   800d30 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804b6a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  804b71:	56                   	push   %esi
+  804b72:	57                   	push   %edi
+  804b73:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  804b75:	0f b7 05 06 90 80 00 	movzwl 0x809006,%eax
+  804b7c:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  804b7f:	ff 34 85 44 c0 80 00 	push   0x80c044(,%eax,4)
+  804b86:	e8 4c 0d 00 00       	call   8058d7 <ipc_call>
+  804b8b:	83 c4 20             	add    $0x20,%esp
+  804b8e:	85 c0                	test   %eax,%eax
+  804b90:	78 08                	js     804b9a <page_in+0x1d5>
+  804b92:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  804b95:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  804b98:	eb 20                	jmp    804bba <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  804b9a:	50                   	push   %eax
+  804b9b:	68 98 67 80 00       	push   $0x806798
+  804ba0:	68 59 02 00 00       	push   $0x259
+  804ba5:	68 cb 63 80 00       	push   $0x8063cb
+  804baa:	e8 39 b9 ff ff       	call   8004e8 <_panic>
+		*mtes[i] = 0;
+  804baf:	8b 10                	mov    (%eax),%edx
+  804bb1:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  804bb7:	83 c0 04             	add    $0x4,%eax
+  804bba:	39 c8                	cmp    %ecx,%eax
+  804bbc:	75 f1                	jne    804baf <page_in+0x1ea>
+	return n;
+  804bbe:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  804bc0:	85 f6                	test   %esi,%esi
+  804bc2:	0f 84 4d fe ff ff    	je     804a15 <page_in+0x50>
+		return r < 0 ? r : 0;
+  804bc8:	85 c0                	test   %eax,%eax
+  804bca:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bcf:	0f 4f c2             	cmovg  %edx,%eax
+  804bd2:	e9 99 fe ff ff       	jmp    804a70 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  804bd7:	50                   	push   %eax
+  804bd8:	68 d0 67 80 00       	push   $0x8067d0
+  804bdd:	68 9a 02 00 00       	push   $0x29a
+  804be2:	68 cb 63 80 00       	push   $0x8063cb
+  804be7:	e8 fc b8 ff ff       	call   8004e8 <_panic>
+		return -E_PAGING;
+  804bec:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804bf1:	e9 7a fe ff ff       	jmp    804a70 <page_in+0xab>
+
+00804bf6 <page_map>:
+{
+  804bf6:	55                   	push   %ebp
+  804bf7:	89 e5                	mov    %esp,%ebp
+  804bf9:	57                   	push   %edi
+  804bfa:	56                   	push   %esi
+  804bfb:	53                   	push   %ebx
+  804bfc:	83 ec 1c             	sub    $0x1c,%esp
+  804bff:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804c02:	83 ec 0c             	sub    $0xc,%esp
+  804c05:	ff 75 18             	push   0x18(%ebp)
+  804c08:	ff 75 14             	push   0x14(%ebp)
+  804c0b:	ff 75 10             	push   0x10(%ebp)
+  804c0e:	ff 75 0c             	push   0xc(%ebp)
+  804c11:	56                   	push   %esi
+  804c12:	e8 c9 c4 ff ff       	call   8010e0 <sys_page_map>
+  804c17:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804c1a:	83 c4 20             	add    $0x20,%esp
+  804c1d:	85 c0                	test   %eax,%eax
+  804c1f:	0f 89 a9 01 00 00    	jns    804dce <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  804c25:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  804c29:	74 5f                	je     804c8a <page_map+0x94>
+		if (r != -E_INVAL)
+  804c2b:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  804c2f:	0f 85 a0 01 00 00    	jne    804dd5 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804c35:	85 f6                	test   %esi,%esi
+  804c37:	74 70                	je     804ca9 <page_map+0xb3>
+  804c39:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804c3e:	8b 40 48             	mov    0x48(%eax),%eax
+  804c41:	39 f0                	cmp    %esi,%eax
+  804c43:	74 64                	je     804ca9 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804c45:	83 ec 0c             	sub    $0xc,%esp
+  804c48:	6a 05                	push   $0x5
+  804c4a:	68 00 00 40 00       	push   $0x400000
+  804c4f:	6a 00                	push   $0x0
+  804c51:	68 00 b0 ad de       	push   $0xdeadb000
+  804c56:	56                   	push   %esi
+  804c57:	e8 84 c4 ff ff       	call   8010e0 <sys_page_map>
+  804c5c:	89 c3                	mov    %eax,%ebx
+  804c5e:	83 c4 20             	add    $0x20,%esp
+  804c61:	85 c0                	test   %eax,%eax
+  804c63:	79 6a                	jns    804ccf <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  804c65:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804c68:	75 50                	jne    804cba <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  804c6a:	83 ec 08             	sub    $0x8,%esp
+  804c6d:	68 00 00 40 00       	push   $0x400000
+  804c72:	6a fc                	push   $0xfffffffc
+  804c74:	e8 9c f6 ff ff       	call   804315 <page_out>
+  804c79:	83 c4 10             	add    $0x10,%esp
+  804c7c:	85 c0                	test   %eax,%eax
+  804c7e:	79 c5                	jns    804c45 <page_map+0x4f>
+}
+  804c80:	89 d8                	mov    %ebx,%eax
+  804c82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804c85:	5b                   	pop    %ebx
+  804c86:	5e                   	pop    %esi
+  804c87:	5f                   	pop    %edi
+  804c88:	5d                   	pop    %ebp
+  804c89:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  804c8a:	83 ec 08             	sub    $0x8,%esp
+  804c8d:	68 00 00 40 00       	push   $0x400000
+  804c92:	6a 00                	push   $0x0
+  804c94:	e8 7c f6 ff ff       	call   804315 <page_out>
+  804c99:	83 c4 10             	add    $0x10,%esp
+  804c9c:	85 c0                	test   %eax,%eax
+  804c9e:	0f 89 5e ff ff ff    	jns    804c02 <page_map+0xc>
+				return r;
+  804ca4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804ca7:	eb d7                	jmp    804c80 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  804ca9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804cac:	e8 79 f9 ff ff       	call   80462a <page_adopt>
+  804cb1:	85 c0                	test   %eax,%eax
+  804cb3:	79 90                	jns    804c45 <page_map+0x4f>
+			return r;
+  804cb5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804cb8:	eb c6                	jmp    804c80 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  804cba:	53                   	push   %ebx
+  804cbb:	68 04 68 80 00       	push   $0x806804
+  804cc0:	68 77 03 00 00       	push   $0x377
+  804cc5:	68 cb 63 80 00       	push   $0x8063cb
+  804cca:	e8 19 b8 ff ff       	call   8004e8 <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  804ccf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804cd2:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  804cd5:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  804cdc:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  804ce2:	0f 84 f5 00 00 00    	je     804ddd <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  804ce8:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  804cee:	83 ec 0c             	sub    $0xc,%esp
+  804cf1:	6a 05                	push   $0x5
+  804cf3:	68 00 00 40 00       	push   $0x400000
+  804cf8:	6a 00                	push   $0x0
+  804cfa:	57                   	push   %edi
+  804cfb:	56                   	push   %esi
+  804cfc:	e8 df c3 ff ff       	call   8010e0 <sys_page_map>
+  804d01:	89 c3                	mov    %eax,%ebx
+  804d03:	83 c4 20             	add    $0x20,%esp
+  804d06:	85 c0                	test   %eax,%eax
+  804d08:	79 35                	jns    804d3f <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  804d0a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804d0d:	75 1b                	jne    804d2a <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804d0f:	83 ec 08             	sub    $0x8,%esp
+  804d12:	68 00 00 40 00       	push   $0x400000
+  804d17:	6a 00                	push   $0x0
+  804d19:	e8 f7 f5 ff ff       	call   804315 <page_out>
+  804d1e:	83 c4 10             	add    $0x10,%esp
+  804d21:	85 c0                	test   %eax,%eax
+  804d23:	79 c9                	jns    804cee <page_map+0xf8>
+  804d25:	e9 56 ff ff ff       	jmp    804c80 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  804d2a:	53                   	push   %ebx
+  804d2b:	68 2c 68 80 00       	push   $0x80682c
+  804d30:	68 83 03 00 00       	push   $0x383
+  804d35:	68 cb 63 80 00       	push   $0x8063cb
+  804d3a:	e8 a9 b7 ff ff       	call   8004e8 <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  804d3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804d42:	c1 e8 0c             	shr    $0xc,%eax
+  804d45:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  804d4a:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  804d51:	01 
+  804d52:	0f 84 8d 00 00 00    	je     804de5 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  804d58:	83 ec 08             	sub    $0x8,%esp
+  804d5b:	68 00 00 40 00       	push   $0x400000
+  804d60:	6a 00                	push   $0x0
+  804d62:	e8 bb c3 ff ff       	call   801122 <sys_page_unmap>
+  804d67:	83 c4 10             	add    $0x10,%esp
+  804d6a:	85 c0                	test   %eax,%eax
+  804d6c:	78 36                	js     804da4 <page_map+0x1ae>
+  804d6e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  804d71:	83 ec 08             	sub    $0x8,%esp
+  804d74:	57                   	push   %edi
+  804d75:	56                   	push   %esi
+  804d76:	e8 4a fc ff ff       	call   8049c5 <page_in>
+  804d7b:	89 c3                	mov    %eax,%ebx
+  804d7d:	83 c4 10             	add    $0x10,%esp
+  804d80:	85 c0                	test   %eax,%eax
+  804d82:	0f 89 7a fe ff ff    	jns    804c02 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  804d88:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804d8b:	75 2c                	jne    804db9 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  804d8d:	83 ec 08             	sub    $0x8,%esp
+  804d90:	57                   	push   %edi
+  804d91:	6a 00                	push   $0x0
+  804d93:	e8 7d f5 ff ff       	call   804315 <page_out>
+  804d98:	83 c4 10             	add    $0x10,%esp
+  804d9b:	85 c0                	test   %eax,%eax
+  804d9d:	79 d2                	jns    804d71 <page_map+0x17b>
+  804d9f:	e9 dc fe ff ff       	jmp    804c80 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  804da4:	50                   	push   %eax
+  804da5:	68 58 68 80 00       	push   $0x806858
+  804daa:	68 8b 03 00 00       	push   $0x38b
+  804daf:	68 cb 63 80 00       	push   $0x8063cb
+  804db4:	e8 2f b7 ff ff       	call   8004e8 <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  804db9:	53                   	push   %ebx
+  804dba:	68 80 68 80 00       	push   $0x806880
+  804dbf:	68 91 03 00 00       	push   $0x391
+  804dc4:	68 cb 63 80 00       	push   $0x8063cb
+  804dc9:	e8 1a b7 ff ff       	call   8004e8 <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  804dce:	89 c3                	mov    %eax,%ebx
+  804dd0:	e9 ab fe ff ff       	jmp    804c80 <page_map+0x8a>
+  804dd5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804dd8:	e9 a3 fe ff ff       	jmp    804c80 <page_map+0x8a>
+			return r; // Pass through the error
+  804ddd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804de0:	e9 9b fe ff ff       	jmp    804c80 <page_map+0x8a>
+			return r; // Pass through the error
+  804de5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  804de8:	e9 93 fe ff ff       	jmp    804c80 <page_map+0x8a>
+
+00804ded <page_map_range>:
+{
+  804ded:	55                   	push   %ebp
+  804dee:	89 e5                	mov    %esp,%ebp
+  804df0:	57                   	push   %edi
+  804df1:	56                   	push   %esi
+  804df2:	53                   	push   %ebx
+  804df3:	83 ec 0c             	sub    $0xc,%esp
+  804df6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  804df9:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  804dfc:	83 ec 08             	sub    $0x8,%esp
+  804dff:	ff 75 1c             	push   0x1c(%ebp)
+  804e02:	ff 75 18             	push   0x18(%ebp)
+  804e05:	56                   	push   %esi
+  804e06:	ff 75 10             	push   0x10(%ebp)
+  804e09:	57                   	push   %edi
+  804e0a:	ff 75 08             	push   0x8(%ebp)
+  804e0d:	e8 d9 c3 ff ff       	call   8011eb <sys_page_map_range>
+  804e12:	89 c3                	mov    %eax,%ebx
+  804e14:	83 c4 20             	add    $0x20,%esp
+  804e17:	85 c0                	test   %eax,%eax
+  804e19:	79 1b                	jns    804e36 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  804e1b:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  804e1e:	75 20                	jne    804e40 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  804e20:	83 ec 08             	sub    $0x8,%esp
+  804e23:	68 00 00 40 00       	push   $0x400000
+  804e28:	6a 00                	push   $0x0
+  804e2a:	e8 e6 f4 ff ff       	call   804315 <page_out>
+  804e2f:	83 c4 10             	add    $0x10,%esp
+  804e32:	85 c0                	test   %eax,%eax
+  804e34:	79 c6                	jns    804dfc <page_map_range+0xf>
+}
+  804e36:	89 d8                	mov    %ebx,%eax
+  804e38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804e3b:	5b                   	pop    %ebx
+  804e3c:	5e                   	pop    %esi
+  804e3d:	5f                   	pop    %edi
+  804e3e:	5d                   	pop    %ebp
+  804e3f:	c3                   	ret
+		if (r != -E_INVAL)
+  804e40:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  804e43:	75 f1                	jne    804e36 <page_map_range+0x49>
+  804e45:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  804e47:	be 00 00 00 00       	mov    $0x0,%esi
+  804e4c:	eb 03                	jmp    804e51 <page_map_range+0x64>
+  804e4e:	83 c6 01             	add    $0x1,%esi
+  804e51:	3b 75 18             	cmp    0x18(%ebp),%esi
+  804e54:	74 2a                	je     804e80 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  804e56:	83 ec 0c             	sub    $0xc,%esp
+  804e59:	ff 75 1c             	push   0x1c(%ebp)
+  804e5c:	53                   	push   %ebx
+  804e5d:	ff 75 10             	push   0x10(%ebp)
+  804e60:	57                   	push   %edi
+  804e61:	ff 75 08             	push   0x8(%ebp)
+  804e64:	e8 8d fd ff ff       	call   804bf6 <page_map>
+  804e69:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  804e6f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  804e75:	83 c4 20             	add    $0x20,%esp
+  804e78:	85 c0                	test   %eax,%eax
+  804e7a:	79 d2                	jns    804e4e <page_map_range+0x61>
+  804e7c:	89 c3                	mov    %eax,%ebx
+  804e7e:	eb b6                	jmp    804e36 <page_map_range+0x49>
+		return 0;
+  804e80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804e85:	eb af                	jmp    804e36 <page_map_range+0x49>
+
+00804e87 <paging_pgfault_handler>:
+{
+  804e87:	55                   	push   %ebp
+  804e88:	89 e5                	mov    %esp,%ebp
+  804e8a:	56                   	push   %esi
+  804e8b:	53                   	push   %ebx
+  804e8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  804e8f:	e8 6f e7 ff ff       	call   803603 <find_paging_env>
+	if (pagingenv == 0)
+  804e94:	a1 40 c0 80 00       	mov    0x80c040,%eax
+  804e99:	85 c0                	test   %eax,%eax
+  804e9b:	74 3c                	je     804ed9 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  804e9d:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804e9f:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804ea3:	75 12                	jne    804eb7 <paging_pgfault_handler+0x30>
+  804ea5:	89 f0                	mov    %esi,%eax
+  804ea7:	e8 7e f7 ff ff       	call   80462a <page_adopt>
+  804eac:	89 c2                	mov    %eax,%edx
+		return 0;
+  804eae:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  804eb3:	85 d2                	test   %edx,%edx
+  804eb5:	78 22                	js     804ed9 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  804eb7:	83 ec 08             	sub    $0x8,%esp
+  804eba:	6a 00                	push   $0x0
+  804ebc:	56                   	push   %esi
+  804ebd:	e8 a9 f3 ff ff       	call   80426b <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  804ec2:	83 c4 10             	add    $0x10,%esp
+  804ec5:	85 c0                	test   %eax,%eax
+  804ec7:	74 05                	je     804ece <paging_pgfault_handler+0x47>
+  804ec9:	f6 00 01             	testb  $0x1,(%eax)
+  804ecc:	75 12                	jne    804ee0 <paging_pgfault_handler+0x59>
+	return 0;
+  804ece:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804ed3:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  804ed7:	74 23                	je     804efc <paging_pgfault_handler+0x75>
+}
+  804ed9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804edc:	5b                   	pop    %ebx
+  804edd:	5e                   	pop    %esi
+  804ede:	5d                   	pop    %ebp
+  804edf:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  804ee0:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804ee5:	8b 40 48             	mov    0x48(%eax),%eax
+  804ee8:	83 ec 08             	sub    $0x8,%esp
+  804eeb:	56                   	push   %esi
+  804eec:	50                   	push   %eax
+  804eed:	e8 d3 fa ff ff       	call   8049c5 <page_in>
+  804ef2:	f7 d0                	not    %eax
+  804ef4:	c1 e8 1f             	shr    $0x1f,%eax
+  804ef7:	83 c4 10             	add    $0x10,%esp
+  804efa:	eb dd                	jmp    804ed9 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804efc:	89 f0                	mov    %esi,%eax
+  804efe:	e8 97 e2 ff ff       	call   80319a <segment_lookup>
+  804f03:	89 c2                	mov    %eax,%edx
+	return 0;
+  804f05:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  804f0a:	85 d2                	test   %edx,%edx
+  804f0c:	74 cb                	je     804ed9 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  804f0e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  804f13:	8b 40 48             	mov    0x48(%eax),%eax
+  804f16:	83 ec 08             	sub    $0x8,%esp
+  804f19:	56                   	push   %esi
+  804f1a:	50                   	push   %eax
+  804f1b:	e8 f5 f3 ff ff       	call   804315 <page_out>
+  804f20:	f7 d0                	not    %eax
+  804f22:	c1 e8 1f             	shr    $0x1f,%eax
+  804f25:	83 c4 10             	add    $0x10,%esp
+  804f28:	eb af                	jmp    804ed9 <paging_pgfault_handler+0x52>
+
+00804f2a <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  804f2a:	55                   	push   %ebp
+  804f2b:	89 e5                	mov    %esp,%ebp
+  804f2d:	57                   	push   %edi
+  804f2e:	56                   	push   %esi
+  804f2f:	53                   	push   %ebx
+  804f30:	83 ec 2c             	sub    $0x2c,%esp
+  804f33:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804f36:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  804f3b:	89 c1                	mov    %eax,%ecx
+  804f3d:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  804f40:	c1 e8 11             	shr    $0x11,%eax
+  804f43:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  804f46:	8b 3c 85 80 dc 80 00 	mov    0x80dc80(,%eax,4),%edi
+  804f4d:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  804f50:	b8 01 00 00 00       	mov    $0x1,%eax
+  804f55:	d3 e0                	shl    %cl,%eax
+  804f57:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804f5a:	85 c7                	test   %eax,%edi
+  804f5c:	74 12                	je     804f70 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804f5e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  804f63:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  804f66:	bf 01 00 00 00       	mov    $0x1,%edi
+  804f6b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  804f6e:	eb 17                	jmp    804f87 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  804f70:	ff 75 e0             	push   -0x20(%ebp)
+  804f73:	68 b8 68 80 00       	push   $0x8068b8
+  804f78:	6a 48                	push   $0x48
+  804f7a:	68 d2 68 80 00       	push   $0x8068d2
+  804f7f:	e8 64 b5 ff ff       	call   8004e8 <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  804f84:	83 c3 01             	add    $0x1,%ebx
+  804f87:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804f8a:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  804f8d:	89 c8                	mov    %ecx,%eax
+  804f8f:	c1 e8 05             	shr    $0x5,%eax
+  804f92:	8b 14 85 80 ce 80 00 	mov    0x80ce80(,%eax,4),%edx
+  804f99:	89 fe                	mov    %edi,%esi
+  804f9b:	d3 e6                	shl    %cl,%esi
+  804f9d:	89 f1                	mov    %esi,%ecx
+  804f9f:	85 d6                	test   %edx,%esi
+  804fa1:	74 e1                	je     804f84 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  804fa3:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  804fa6:	f7 d6                	not    %esi
+  804fa8:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  804fab:	21 fe                	and    %edi,%esi
+  804fad:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804fb0:	89 34 bd 80 dc 80 00 	mov    %esi,0x80dc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  804fb7:	f7 d1                	not    %ecx
+  804fb9:	21 d1                	and    %edx,%ecx
+  804fbb:	89 0c 85 80 ce 80 00 	mov    %ecx,0x80ce80(,%eax,4)
+	page_unmap_range(0, va, n);
+  804fc2:	83 ec 04             	sub    $0x4,%esp
+  804fc5:	53                   	push   %ebx
+  804fc6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  804fc9:	57                   	push   %edi
+  804fca:	6a 00                	push   $0x0
+  804fcc:	e8 97 f8 ff ff       	call   804868 <page_unmap_range>
+	va_free(va, n);
+  804fd1:	83 c4 08             	add    $0x8,%esp
+  804fd4:	53                   	push   %ebx
+  804fd5:	57                   	push   %edi
+  804fd6:	e8 ed 05 00 00       	call   8055c8 <va_free>
+}
+  804fdb:	83 c4 10             	add    $0x10,%esp
+  804fde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804fe1:	5b                   	pop    %ebx
+  804fe2:	5e                   	pop    %esi
+  804fe3:	5f                   	pop    %edi
+  804fe4:	5d                   	pop    %ebp
+  804fe5:	c3                   	ret
+
+00804fe6 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804fe6:	55                   	push   %ebp
+  804fe7:	89 e5                	mov    %esp,%ebp
+  804fe9:	57                   	push   %edi
+  804fea:	56                   	push   %esi
+  804feb:	53                   	push   %ebx
+  804fec:	83 ec 1c             	sub    $0x1c,%esp
+  804fef:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804ff2:	85 db                	test   %ebx,%ebx
+  804ff4:	74 34                	je     80502a <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804ff6:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  804ffc:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  805001:	77 2f                	ja     805032 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  805003:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  805009:	75 51                	jne    80505c <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80500b:	89 c1                	mov    %eax,%ecx
+  80500d:	c1 e9 0c             	shr    $0xc,%ecx
+  805010:	ba 01 00 00 00       	mov    $0x1,%edx
+  805015:	d3 e2                	shl    %cl,%edx
+  805017:	c1 e8 11             	shr    $0x11,%eax
+  80501a:	23 14 85 80 c0 80 00 	and    0x80c080(,%eax,4),%edx
+  805021:	75 24                	jne    805047 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  805023:	89 d8                	mov    %ebx,%eax
+  805025:	e8 00 ff ff ff       	call   804f2a <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80502a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80502d:	5b                   	pop    %ebx
+  80502e:	5e                   	pop    %esi
+  80502f:	5f                   	pop    %edi
+  805030:	5d                   	pop    %ebp
+  805031:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  805032:	53                   	push   %ebx
+  805033:	68 df 68 80 00       	push   $0x8068df
+  805038:	68 a2 00 00 00       	push   $0xa2
+  80503d:	68 d2 68 80 00       	push   $0x8068d2
+  805042:	e8 a1 b4 ff ff       	call   8004e8 <_panic>
+			panic("free: %p is not allocated", va);
+  805047:	53                   	push   %ebx
+  805048:	68 b8 68 80 00       	push   $0x8068b8
+  80504d:	68 a5 00 00 00       	push   $0xa5
+  805052:	68 d2 68 80 00       	push   $0x8068d2
+  805057:	e8 8c b4 ff ff       	call   8004e8 <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  80505c:	89 de                	mov    %ebx,%esi
+  80505e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  805064:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  80506a:	89 c8                	mov    %ecx,%eax
+  80506c:	c1 e8 11             	shr    $0x11,%eax
+  80506f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805072:	8b 3c 85 80 c0 80 00 	mov    0x80c080(,%eax,4),%edi
+  805079:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80507c:	c1 e9 0c             	shr    $0xc,%ecx
+  80507f:	b8 01 00 00 00       	mov    $0x1,%eax
+  805084:	d3 e0                	shl    %cl,%eax
+  805086:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  805089:	85 c7                	test   %eax,%edi
+  80508b:	74 1b                	je     8050a8 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  80508d:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  805091:	89 d8                	mov    %ebx,%eax
+  805093:	29 f0                	sub    %esi,%eax
+  805095:	83 e8 10             	sub    $0x10,%eax
+  805098:	99                   	cltd
+  805099:	f7 ff                	idiv   %edi
+  80509b:	89 d1                	mov    %edx,%ecx
+  80509d:	85 d2                	test   %edx,%edx
+  80509f:	75 07                	jne    8050a8 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8050a1:	ba 10 00 00 00       	mov    $0x10,%edx
+  8050a6:	eb 18                	jmp    8050c0 <free+0xda>
+		panic("free: %p is not allocated", va);
+  8050a8:	53                   	push   %ebx
+  8050a9:	68 b8 68 80 00       	push   $0x8068b8
+  8050ae:	68 ad 00 00 00       	push   $0xad
+  8050b3:	68 d2 68 80 00       	push   $0x8068d2
+  8050b8:	e8 2b b4 ff ff       	call   8004e8 <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8050bd:	83 c1 01             	add    $0x1,%ecx
+  8050c0:	89 d0                	mov    %edx,%eax
+  8050c2:	d3 e0                	shl    %cl,%eax
+  8050c4:	39 c7                	cmp    %eax,%edi
+  8050c6:	7f f5                	jg     8050bd <free+0xd7>
+	*(void **) va = s->free;
+  8050c8:	8b 46 08             	mov    0x8(%esi),%eax
+  8050cb:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8050cd:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8050d0:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8050d4:	8d 58 01             	lea    0x1(%eax),%ebx
+  8050d7:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8050db:	66 85 c0             	test   %ax,%ax
+  8050de:	74 52                	je     805132 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  8050e0:	0f b7 db             	movzwl %bx,%ebx
+  8050e3:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8050e7:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8050ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8050f1:	f7 ff                	idiv   %edi
+  8050f3:	39 c3                	cmp    %eax,%ebx
+  8050f5:	0f 85 2f ff ff ff    	jne    80502a <free+0x44>
+  8050fb:	8b 46 04             	mov    0x4(%esi),%eax
+  8050fe:	85 c0                	test   %eax,%eax
+  805100:	74 53                	je     805155 <free+0x16f>
+		s->prev->next = s->next;
+  805102:	8b 16                	mov    (%esi),%edx
+  805104:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  805106:	8b 06                	mov    (%esi),%eax
+  805108:	85 c0                	test   %eax,%eax
+  80510a:	74 06                	je     805112 <free+0x12c>
+		s->next->prev = s->prev;
+  80510c:	8b 56 04             	mov    0x4(%esi),%edx
+  80510f:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  805112:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  805115:	f7 d0                	not    %eax
+  805117:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80511a:	21 d0                	and    %edx,%eax
+  80511c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80511f:	89 04 95 80 c0 80 00 	mov    %eax,0x80c080(,%edx,4)
+		heap_free_pages(s);
+  805126:	89 f0                	mov    %esi,%eax
+  805128:	e8 fd fd ff ff       	call   804f2a <heap_free_pages>
+  80512d:	e9 f8 fe ff ff       	jmp    80502a <free+0x44>
+	s->prev = NULL;
+  805132:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  805139:	8b 04 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%eax
+  805140:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  805142:	85 c0                	test   %eax,%eax
+  805144:	74 03                	je     805149 <free+0x163>
+		slabs[c]->prev = s;
+  805146:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  805149:	89 34 8d 60 c0 80 00 	mov    %esi,0x80c060(,%ecx,4)
+}
+  805150:	e9 d5 fe ff ff       	jmp    80502a <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  805155:	8b 06                	mov    (%esi),%eax
+  805157:	85 c0                	test   %eax,%eax
+  805159:	0f 84 cb fe ff ff    	je     80502a <free+0x44>
+		slabs[c] = s->next;
+  80515f:	89 04 8d 60 c0 80 00 	mov    %eax,0x80c060(,%ecx,4)
+	if (s->next)
+  805166:	8b 06                	mov    (%esi),%eax
+  805168:	eb a2                	jmp    80510c <free+0x126>
+
+0080516a <heap_alloc_pages>:
+{
+  80516a:	55                   	push   %ebp
+  80516b:	89 e5                	mov    %esp,%ebp
+  80516d:	57                   	push   %edi
+  80516e:	56                   	push   %esi
+  80516f:	53                   	push   %ebx
+  805170:	83 ec 18             	sub    $0x18,%esp
+  805173:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  805175:	50                   	push   %eax
+  805176:	e8 15 03 00 00       	call   805490 <va_alloc>
+  80517b:	89 c3                	mov    %eax,%ebx
+  80517d:	83 c4 10             	add    $0x10,%esp
+  805180:	85 c0                	test   %eax,%eax
+  805182:	74 47                	je     8051cb <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  805184:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  80518a:	89 c1                	mov    %eax,%ecx
+  80518c:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  80518f:	c1 e8 11             	shr    $0x11,%eax
+  805192:	ba 01 00 00 00       	mov    $0x1,%edx
+  805197:	89 d7                	mov    %edx,%edi
+  805199:	d3 e7                	shl    %cl,%edi
+  80519b:	09 3c 85 80 dc 80 00 	or     %edi,0x80dc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8051a2:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8051a6:	89 c8                	mov    %ecx,%eax
+  8051a8:	c1 e8 05             	shr    $0x5,%eax
+  8051ab:	d3 e2                	shl    %cl,%edx
+  8051ad:	09 14 85 80 ce 80 00 	or     %edx,0x80ce80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8051b4:	83 ec 0c             	sub    $0xc,%esp
+  8051b7:	6a 00                	push   $0x0
+  8051b9:	6a 07                	push   $0x7
+  8051bb:	56                   	push   %esi
+  8051bc:	53                   	push   %ebx
+  8051bd:	6a 00                	push   $0x0
+  8051bf:	e8 3a f7 ff ff       	call   8048fe <page_alloc_range>
+  8051c4:	83 c4 20             	add    $0x20,%esp
+  8051c7:	85 c0                	test   %eax,%eax
+  8051c9:	78 0a                	js     8051d5 <heap_alloc_pages+0x6b>
+}
+  8051cb:	89 d8                	mov    %ebx,%eax
+  8051cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051d0:	5b                   	pop    %ebx
+  8051d1:	5e                   	pop    %esi
+  8051d2:	5f                   	pop    %edi
+  8051d3:	5d                   	pop    %ebp
+  8051d4:	c3                   	ret
+		free(va);
+  8051d5:	83 ec 0c             	sub    $0xc,%esp
+  8051d8:	53                   	push   %ebx
+  8051d9:	e8 08 fe ff ff       	call   804fe6 <free>
+		return NULL;
+  8051de:	83 c4 10             	add    $0x10,%esp
+  8051e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8051e6:	eb e3                	jmp    8051cb <heap_alloc_pages+0x61>
+
+008051e8 <malloc>:
+{
+  8051e8:	55                   	push   %ebp
+  8051e9:	89 e5                	mov    %esp,%ebp
+  8051eb:	57                   	push   %edi
+  8051ec:	56                   	push   %esi
+  8051ed:	53                   	push   %ebx
+  8051ee:	83 ec 1c             	sub    $0x1c,%esp
+  8051f1:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  8051f4:	8d 50 ff             	lea    -0x1(%eax),%edx
+  8051f7:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  8051fd:	0f 87 21 01 00 00    	ja     805324 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  805203:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805208:	ba 10 00 00 00       	mov    $0x10,%edx
+  80520d:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80520f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  805214:	76 15                	jbe    80522b <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  805216:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80521b:	c1 e8 0c             	shr    $0xc,%eax
+  80521e:	e8 47 ff ff ff       	call   80516a <heap_alloc_pages>
+  805223:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805226:	eb 37                	jmp    80525f <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  805228:	83 c1 01             	add    $0x1,%ecx
+  80522b:	89 d6                	mov    %edx,%esi
+  80522d:	d3 e6                	shl    %cl,%esi
+  80522f:	39 c6                	cmp    %eax,%esi
+  805231:	72 f5                	jb     805228 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  805233:	89 cb                	mov    %ecx,%ebx
+  805235:	8b 3c 8d 60 c0 80 00 	mov    0x80c060(,%ecx,4),%edi
+  80523c:	85 ff                	test   %edi,%edi
+  80523e:	74 2a                	je     80526a <malloc+0x82>
+	v = s->free;
+  805240:	8b 47 08             	mov    0x8(%edi),%eax
+  805243:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  805246:	8b 00                	mov    (%eax),%eax
+  805248:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  80524b:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  80524f:	83 e8 01             	sub    $0x1,%eax
+  805252:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  805256:	66 85 c0             	test   %ax,%ax
+  805259:	0f 84 9a 00 00 00    	je     8052f9 <malloc+0x111>
+}
+  80525f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  805262:	83 c4 1c             	add    $0x1c,%esp
+  805265:	5b                   	pop    %ebx
+  805266:	5e                   	pop    %esi
+  805267:	5f                   	pop    %edi
+  805268:	5d                   	pop    %ebp
+  805269:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  80526a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80526f:	e8 f6 fe ff ff       	call   80516a <heap_alloc_pages>
+  805274:	89 c1                	mov    %eax,%ecx
+  805276:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805279:	85 c0                	test   %eax,%eax
+  80527b:	74 e2                	je     80525f <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80527d:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  805283:	89 c8                	mov    %ecx,%eax
+  805285:	c1 e8 11             	shr    $0x11,%eax
+  805288:	c1 e9 0c             	shr    $0xc,%ecx
+  80528b:	ba 01 00 00 00       	mov    $0x1,%edx
+  805290:	d3 e2                	shl    %cl,%edx
+  805292:	09 14 85 80 c0 80 00 	or     %edx,0x80c080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  805299:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80529c:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8052a0:	0f b7 f6             	movzwl %si,%esi
+  8052a3:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8052a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052ad:	f7 fe                	idiv   %esi
+  8052af:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8052b3:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8052b6:	85 c0                	test   %eax,%eax
+  8052b8:	74 14                	je     8052ce <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8052ba:	83 e8 01             	sub    $0x1,%eax
+  8052bd:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8052c1:	0f af d0             	imul   %eax,%edx
+  8052c4:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8052c8:	89 3a                	mov    %edi,(%edx)
+  8052ca:	89 d7                	mov    %edx,%edi
+  8052cc:	eb e5                	jmp    8052b3 <malloc+0xcb>
+	s->prev = NULL;
+  8052ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8052d1:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8052d8:	8b 04 9d 60 c0 80 00 	mov    0x80c060(,%ebx,4),%eax
+  8052df:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  8052e1:	85 c0                	test   %eax,%eax
+  8052e3:	74 03                	je     8052e8 <malloc+0x100>
+		slabs[c]->prev = s;
+  8052e5:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  8052e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8052eb:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+	return s;
+  8052f2:	89 c7                	mov    %eax,%edi
+  8052f4:	e9 47 ff ff ff       	jmp    805240 <malloc+0x58>
+	if (s->prev)
+  8052f9:	8b 47 04             	mov    0x4(%edi),%eax
+  8052fc:	85 c0                	test   %eax,%eax
+  8052fe:	74 19                	je     805319 <malloc+0x131>
+		s->prev->next = s->next;
+  805300:	8b 17                	mov    (%edi),%edx
+  805302:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  805304:	8b 07                	mov    (%edi),%eax
+  805306:	85 c0                	test   %eax,%eax
+  805308:	0f 84 51 ff ff ff    	je     80525f <malloc+0x77>
+		s->next->prev = s->prev;
+  80530e:	8b 57 04             	mov    0x4(%edi),%edx
+  805311:	89 50 04             	mov    %edx,0x4(%eax)
+  805314:	e9 46 ff ff ff       	jmp    80525f <malloc+0x77>
+		slabs[c] = s->next;
+  805319:	8b 07                	mov    (%edi),%eax
+  80531b:	89 04 9d 60 c0 80 00 	mov    %eax,0x80c060(,%ebx,4)
+  805322:	eb e0                	jmp    805304 <malloc+0x11c>
+		return NULL;
+  805324:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80532b:	e9 2f ff ff ff       	jmp    80525f <malloc+0x77>
+
+00805330 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  805330:	55                   	push   %ebp
+  805331:	89 e5                	mov    %esp,%ebp
+  805333:	57                   	push   %edi
+  805334:	56                   	push   %esi
+  805335:	53                   	push   %ebx
+  805336:	83 ec 0c             	sub    $0xc,%esp
+  805339:	89 c6                	mov    %eax,%esi
+  80533b:	89 d7                	mov    %edx,%edi
+  80533d:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  805340:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805345:	ba 00 00 00 00       	mov    $0x0,%edx
+  80534a:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80534f:	83 ef 01             	sub    $0x1,%edi
+  805352:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  805355:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  805358:	eb 34                	jmp    80538e <va_chunk_scan+0x5e>
+			i += 31;
+  80535a:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  80535d:	89 ca                	mov    %ecx,%edx
+			continue;
+  80535f:	eb 23                	jmp    805384 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  805361:	89 c7                	mov    %eax,%edi
+  805363:	c1 ef 05             	shr    $0x5,%edi
+  805366:	be 01 00 00 00       	mov    $0x1,%esi
+  80536b:	d3 e6                	shl    %cl,%esi
+  80536d:	89 f1                	mov    %esi,%ecx
+  80536f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  805372:	23 0c be             	and    (%esi,%edi,4),%ecx
+  805375:	75 41                	jne    8053b8 <va_chunk_scan+0x88>
+			len++;
+  805377:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  80537a:	39 d3                	cmp    %edx,%ebx
+  80537c:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  80537f:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  805382:	72 2d                	jb     8053b1 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  805384:	83 c0 01             	add    $0x1,%eax
+  805387:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80538c:	77 31                	ja     8053bf <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  80538e:	89 c1                	mov    %eax,%ecx
+  805390:	83 e1 1f             	and    $0x1f,%ecx
+  805393:	75 cc                	jne    805361 <va_chunk_scan+0x31>
+  805395:	89 c7                	mov    %eax,%edi
+  805397:	c1 ef 05             	shr    $0x5,%edi
+  80539a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80539d:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8053a0:	83 ff ff             	cmp    $0xffffffff,%edi
+  8053a3:	74 b5                	je     80535a <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8053a5:	85 ff                	test   %edi,%edi
+  8053a7:	75 b8                	jne    805361 <va_chunk_scan+0x31>
+			i += 31;
+  8053a9:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8053ac:	83 c2 20             	add    $0x20,%edx
+  8053af:	eb c9                	jmp    80537a <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8053b1:	83 c0 01             	add    $0x1,%eax
+  8053b4:	29 d0                	sub    %edx,%eax
+  8053b6:	eb 15                	jmp    8053cd <va_chunk_scan+0x9d>
+			len = 0;
+  8053b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053bd:	eb c5                	jmp    805384 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8053bf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8053c4:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8053c7:	85 d2                	test   %edx,%edx
+  8053c9:	74 02                	je     8053cd <va_chunk_scan+0x9d>
+		*run_store = best;
+  8053cb:	89 1a                	mov    %ebx,(%edx)
+}
+  8053cd:	83 c4 0c             	add    $0xc,%esp
+  8053d0:	5b                   	pop    %ebx
+  8053d1:	5e                   	pop    %esi
+  8053d2:	5f                   	pop    %edi
+  8053d3:	5d                   	pop    %ebp
+  8053d4:	c3                   	ret
+
+008053d5 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8053d5:	55                   	push   %ebp
+  8053d6:	89 e5                	mov    %esp,%ebp
+  8053d8:	57                   	push   %edi
+  8053d9:	56                   	push   %esi
+  8053da:	53                   	push   %ebx
+  8053db:	83 ec 14             	sub    $0x14,%esp
+  8053de:	89 c3                	mov    %eax,%ebx
+  8053e0:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  8053e2:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  8053e8:	8d ba a0 ea 80 00    	lea    0x80eaa0(%edx),%edi
+  8053ee:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  8053f1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  8053f4:	89 d6                	mov    %edx,%esi
+  8053f6:	81 c6 a0 ea 80 00    	add    $0x80eaa0,%esi
+  8053fc:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  8053fe:	eb 34                	jmp    805434 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  805400:	89 c8                	mov    %ecx,%eax
+  805402:	c1 e8 05             	shr    $0x5,%eax
+  805405:	89 da                	mov    %ebx,%edx
+  805407:	c1 e2 05             	shl    $0x5,%edx
+  80540a:	01 da                	add    %ebx,%edx
+  80540c:	01 c2                	add    %eax,%edx
+  80540e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  805413:	d3 c0                	rol    %cl,%eax
+  805415:	21 04 95 a0 ea 80 00 	and    %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80541c:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  805423:	b8 01 00 00 00       	mov    $0x1,%eax
+  805428:	01 d0                	add    %edx,%eax
+  80542a:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  805431:	83 c1 01             	add    $0x1,%ecx
+  805434:	39 f9                	cmp    %edi,%ecx
+  805436:	74 30                	je     805468 <va_chunk_mark+0x93>
+		if (alloc)
+  805438:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80543c:	74 c2                	je     805400 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  80543e:	89 c8                	mov    %ecx,%eax
+  805440:	c1 e8 05             	shr    $0x5,%eax
+  805443:	89 da                	mov    %ebx,%edx
+  805445:	c1 e2 05             	shl    $0x5,%edx
+  805448:	01 da                	add    %ebx,%edx
+  80544a:	01 c2                	add    %eax,%edx
+  80544c:	b8 01 00 00 00       	mov    $0x1,%eax
+  805451:	d3 e0                	shl    %cl,%eax
+  805453:	09 04 95 a0 ea 80 00 	or     %eax,0x80eaa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80545a:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  805461:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  805466:	eb c0                	jmp    805428 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  805468:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  80546b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805470:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805473:	e8 b8 fe ff ff       	call   805330 <va_chunk_scan>
+	ch->run = run;
+  805478:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  80547e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  805481:	66 89 83 22 eb 80 00 	mov    %ax,0x80eb22(%ebx)
+}
+  805488:	83 c4 14             	add    $0x14,%esp
+  80548b:	5b                   	pop    %ebx
+  80548c:	5e                   	pop    %esi
+  80548d:	5f                   	pop    %edi
+  80548e:	5d                   	pop    %ebp
+  80548f:	c3                   	ret
+
+00805490 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  805490:	55                   	push   %ebp
+  805491:	89 e5                	mov    %esp,%ebp
+  805493:	57                   	push   %edi
+  805494:	56                   	push   %esi
+  805495:	53                   	push   %ebx
+  805496:	83 ec 04             	sub    $0x4,%esp
+  805499:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  80549c:	b8 20 eb 80 00       	mov    $0x80eb20,%eax
+  8054a1:	ba 90 f9 80 00       	mov    $0x80f990,%edx
+  8054a6:	80 3d 80 ea 80 00 00 	cmpb   $0x0,0x80ea80
+  8054ad:	74 4f                	je     8054fe <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  8054af:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8054b2:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  8054b7:	0f 87 01 01 00 00    	ja     8055be <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  8054bd:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  8054c3:	0f 87 80 00 00 00    	ja     805549 <va_alloc+0xb9>
+  8054c9:	b8 22 eb 80 00       	mov    $0x80eb22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8054ce:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  8054d3:	0f b7 10             	movzwl (%eax),%edx
+  8054d6:	05 84 00 00 00       	add    $0x84,%eax
+  8054db:	39 da                	cmp    %ebx,%edx
+  8054dd:	73 2c                	jae    80550b <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8054df:	83 c6 01             	add    $0x1,%esi
+  8054e2:	83 fe 1c             	cmp    $0x1c,%esi
+  8054e5:	75 ec                	jne    8054d3 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  8054e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054ec:	eb 53                	jmp    805541 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  8054ee:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  8054f4:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  8054f9:	05 84 00 00 00       	add    $0x84,%eax
+  8054fe:	39 d0                	cmp    %edx,%eax
+  805500:	75 ec                	jne    8054ee <va_alloc+0x5e>
+	va_inited = 1;
+  805502:	c6 05 80 ea 80 00 01 	movb   $0x1,0x80ea80
+}
+  805509:	eb a4                	jmp    8054af <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  80550b:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  805511:	05 a0 ea 80 00       	add    $0x80eaa0,%eax
+  805516:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80551b:	89 da                	mov    %ebx,%edx
+  80551d:	e8 0e fe ff ff       	call   805330 <va_chunk_scan>
+  805522:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  805524:	6a 01                	push   $0x1
+  805526:	89 d9                	mov    %ebx,%ecx
+  805528:	89 c2                	mov    %eax,%edx
+  80552a:	89 f0                	mov    %esi,%eax
+  80552c:	e8 a4 fe ff ff       	call   8053d5 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  805531:	c1 e6 16             	shl    $0x16,%esi
+  805534:	c1 e7 0c             	shl    $0xc,%edi
+  805537:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  80553e:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  805541:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805544:	5b                   	pop    %ebx
+  805545:	5e                   	pop    %esi
+  805546:	5f                   	pop    %edi
+  805547:	5d                   	pop    %ebp
+  805548:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  805549:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  80554f:	c1 ee 0a             	shr    $0xa,%esi
+  805552:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  805557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80555c:	eb 0a                	jmp    805568 <va_alloc+0xd8>
+			first = c + 1;
+  80555e:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  805560:	83 c2 01             	add    $0x1,%edx
+  805563:	83 fa 1d             	cmp    $0x1d,%edx
+  805566:	74 4f                	je     8055b7 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  805568:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  80556e:	66 81 b9 9c ea 80 00 	cmpw   $0x400,0x80ea9c(%ecx)
+  805575:	00 04 
+  805577:	75 e5                	jne    80555e <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  805579:	89 d1                	mov    %edx,%ecx
+  80557b:	29 c1                	sub    %eax,%ecx
+  80557d:	39 f1                	cmp    %esi,%ecx
+  80557f:	75 df                	jne    805560 <va_alloc+0xd0>
+  805581:	89 c7                	mov    %eax,%edi
+  805583:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  805586:	be 00 04 00 00       	mov    $0x400,%esi
+  80558b:	39 f3                	cmp    %esi,%ebx
+  80558d:	0f 46 f3             	cmovbe %ebx,%esi
+  805590:	6a 01                	push   $0x1
+  805592:	89 f1                	mov    %esi,%ecx
+  805594:	ba 00 00 00 00       	mov    $0x0,%edx
+  805599:	89 f8                	mov    %edi,%eax
+  80559b:	e8 35 fe ff ff       	call   8053d5 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8055a0:	83 c7 01             	add    $0x1,%edi
+  8055a3:	83 c4 04             	add    $0x4,%esp
+  8055a6:	29 f3                	sub    %esi,%ebx
+  8055a8:	75 dc                	jne    805586 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8055aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8055ad:	c1 e0 16             	shl    $0x16,%eax
+  8055b0:	05 00 00 00 08       	add    $0x8000000,%eax
+  8055b5:	eb 8a                	jmp    805541 <va_alloc+0xb1>
+	return NULL;
+  8055b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055bc:	eb 83                	jmp    805541 <va_alloc+0xb1>
+		return NULL;
+  8055be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055c3:	e9 79 ff ff ff       	jmp    805541 <va_alloc+0xb1>
+
+008055c8 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  8055c8:	55                   	push   %ebp
+  8055c9:	89 e5                	mov    %esp,%ebp
+  8055cb:	57                   	push   %edi
+  8055cc:	56                   	push   %esi
+  8055cd:	53                   	push   %ebx
+  8055ce:	83 ec 0c             	sub    $0xc,%esp
+  8055d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8055d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  8055d7:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  8055dd:	76 21                	jbe    805600 <va_free+0x38>
+  8055df:	89 f0                	mov    %esi,%eax
+  8055e1:	c1 e0 0c             	shl    $0xc,%eax
+  8055e4:	01 f8                	add    %edi,%eax
+  8055e6:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  8055eb:	77 13                	ja     805600 <va_free+0x38>
+	    || PGOFF(va))
+  8055ed:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8055f3:	75 0b                	jne    805600 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8055f5:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  8055fb:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  8055fe:	eb 45                	jmp    805645 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  805600:	83 ec 0c             	sub    $0xc,%esp
+  805603:	56                   	push   %esi
+  805604:	57                   	push   %edi
+  805605:	68 fc 68 80 00       	push   $0x8068fc
+  80560a:	68 8e 00 00 00       	push   $0x8e
+  80560f:	68 1c 69 80 00       	push   $0x80691c
+  805614:	e8 cf ae ff ff       	call   8004e8 <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  805619:	89 fa                	mov    %edi,%edx
+  80561b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  805621:	bb 00 04 00 00       	mov    $0x400,%ebx
+  805626:	29 d3                	sub    %edx,%ebx
+  805628:	39 f3                	cmp    %esi,%ebx
+  80562a:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80562d:	89 f8                	mov    %edi,%eax
+  80562f:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  805632:	83 ec 0c             	sub    $0xc,%esp
+  805635:	6a 00                	push   $0x0
+  805637:	89 d9                	mov    %ebx,%ecx
+  805639:	e8 97 fd ff ff       	call   8053d5 <va_chunk_mark>
+		i += n;
+  80563e:	01 df                	add    %ebx,%edi
+		npages -= n;
+  805640:	29 de                	sub    %ebx,%esi
+  805642:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  805645:	85 f6                	test   %esi,%esi
+  805647:	75 d0                	jne    805619 <va_free+0x51>
+	}
+}
+  805649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80564c:	5b                   	pop    %ebx
+  80564d:	5e                   	pop    %esi
+  80564e:	5f                   	pop    %edi
+  80564f:	5d                   	pop    %ebp
+  805650:	c3                   	ret
+
+00805651 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  805651:	55                   	push   %ebp
+  805652:	89 e5                	mov    %esp,%ebp
+  805654:	56                   	push   %esi
+  805655:	53                   	push   %ebx
+  805656:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  805659:	a1 10 f9 80 00       	mov    0x80f910,%eax
+  80565e:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  805661:	85 db                	test   %ebx,%ebx
+  805663:	78 17                	js     80567c <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  805665:	83 ec 0c             	sub    $0xc,%esp
+  805668:	56                   	push   %esi
+  805669:	ff 14 9d 00 10 81 00 	call   *0x811000(,%ebx,4)
+  805670:	83 c4 10             	add    $0x10,%esp
+  805673:	85 c0                	test   %eax,%eax
+  805675:	75 27                	jne    80569e <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  805677:	83 eb 01             	sub    $0x1,%ebx
+  80567a:	eb e5                	jmp    805661 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  80567c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805681:	8b 40 48             	mov    0x48(%eax),%eax
+  805684:	83 ec 08             	sub    $0x8,%esp
+  805687:	ff 76 28             	push   0x28(%esi)
+  80568a:	ff 36                	push   (%esi)
+  80568c:	50                   	push   %eax
+  80568d:	68 2c 69 80 00       	push   $0x80692c
+  805692:	6a 1d                	push   $0x1d
+  805694:	68 4f 69 80 00       	push   $0x80694f
+  805699:	e8 4a ae ff ff       	call   8004e8 <_panic>
+}
+  80569e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8056a1:	5b                   	pop    %ebx
+  8056a2:	5e                   	pop    %esi
+  8056a3:	5d                   	pop    %ebp
+  8056a4:	c3                   	ret
+
+008056a5 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8056a5:	55                   	push   %ebp
+  8056a6:	89 e5                	mov    %esp,%ebp
+  8056a8:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  8056ab:	83 3d 28 10 81 00 00 	cmpl   $0x0,0x811028
+  8056b2:	74 0a                	je     8056be <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8056b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8056b7:	a3 28 10 81 00       	mov    %eax,0x811028
+}
+  8056bc:	c9                   	leave
+  8056bd:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  8056be:	83 ec 04             	sub    $0x4,%esp
+  8056c1:	6a 07                	push   $0x7
+  8056c3:	68 00 f0 bf ee       	push   $0xeebff000
+  8056c8:	6a 00                	push   $0x0
+  8056ca:	e8 ce b9 ff ff       	call   80109d <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  8056cf:	83 c4 08             	add    $0x8,%esp
+  8056d2:	68 45 57 80 00       	push   $0x805745
+  8056d7:	6a 00                	push   $0x0
+  8056d9:	e8 25 bd ff ff       	call   801403 <sys_env_set_pgfault_upcall>
+  8056de:	83 c4 10             	add    $0x10,%esp
+  8056e1:	eb d1                	jmp    8056b4 <set_pgfault_handler+0xf>
+
+008056e3 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  8056e3:	55                   	push   %ebp
+  8056e4:	89 e5                	mov    %esp,%ebp
+  8056e6:	83 ec 08             	sub    $0x8,%esp
+  8056e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  8056ec:	8b 15 10 f9 80 00    	mov    0x80f910,%edx
+  8056f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056f7:	eb 03                	jmp    8056fc <add_pgfault_handler+0x19>
+  8056f9:	83 c0 01             	add    $0x1,%eax
+  8056fc:	39 d0                	cmp    %edx,%eax
+  8056fe:	74 0b                	je     80570b <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  805700:	39 0c 85 00 10 81 00 	cmp    %ecx,0x811000(,%eax,4)
+  805707:	75 f0                	jne    8056f9 <add_pgfault_handler+0x16>
+  805709:	eb 24                	jmp    80572f <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80570b:	83 fa 0a             	cmp    $0xa,%edx
+  80570e:	74 21                	je     805731 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  805710:	8d 42 01             	lea    0x1(%edx),%eax
+  805713:	a3 10 f9 80 00       	mov    %eax,0x80f910
+  805718:	89 0c 95 00 10 81 00 	mov    %ecx,0x811000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  80571f:	83 ec 0c             	sub    $0xc,%esp
+  805722:	68 51 56 80 00       	push   $0x805651
+  805727:	e8 79 ff ff ff       	call   8056a5 <set_pgfault_handler>
+  80572c:	83 c4 10             	add    $0x10,%esp
+}
+  80572f:	c9                   	leave
+  805730:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  805731:	83 ec 04             	sub    $0x4,%esp
+  805734:	68 5d 69 80 00       	push   $0x80695d
+  805739:	6a 44                	push   $0x44
+  80573b:	68 4f 69 80 00       	push   $0x80694f
+  805740:	e8 a3 ad ff ff       	call   8004e8 <_panic>
+
+00805745 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  805745:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  805746:	a1 28 10 81 00       	mov    0x811028,%eax
+	call *%eax
+  80574b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80574d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  805750:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  805754:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  805758:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  80575b:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  80575d:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  805761:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  805764:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  805765:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  805768:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  805769:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  80576a:	c3                   	ret
+
+0080576b <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80576b:	55                   	push   %ebp
+  80576c:	89 e5                	mov    %esp,%ebp
+  80576e:	57                   	push   %edi
+  80576f:	56                   	push   %esi
+  805770:	53                   	push   %ebx
+  805771:	83 ec 14             	sub    $0x14,%esp
+  805774:	8b 7d 08             	mov    0x8(%ebp),%edi
+  805777:	8b 75 14             	mov    0x14(%ebp),%esi
+  80577a:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  80577d:	ff 75 10             	push   0x10(%ebp)
+  805780:	ff 75 0c             	push   0xc(%ebp)
+  805783:	e8 38 bd ff ff       	call   8014c0 <sys_ipc_recv_pages>
+  805788:	83 c4 10             	add    $0x10,%esp
+  80578b:	85 c0                	test   %eax,%eax
+  80578d:	78 46                	js     8057d5 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80578f:	85 ff                	test   %edi,%edi
+  805791:	74 0d                	je     8057a0 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  805793:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805798:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80579e:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  8057a0:	85 f6                	test   %esi,%esi
+  8057a2:	74 0d                	je     8057b1 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  8057a4:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8057a9:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8057af:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  8057b1:	85 db                	test   %ebx,%ebx
+  8057b3:	74 0d                	je     8057c2 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  8057b5:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8057ba:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  8057c0:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8057c2:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  8057c7:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8057cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8057d0:	5b                   	pop    %ebx
+  8057d1:	5e                   	pop    %esi
+  8057d2:	5f                   	pop    %edi
+  8057d3:	5d                   	pop    %ebp
+  8057d4:	c3                   	ret
+		if (from_env_store) {
+  8057d5:	85 ff                	test   %edi,%edi
+  8057d7:	74 06                	je     8057df <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  8057d9:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8057df:	85 f6                	test   %esi,%esi
+  8057e1:	74 06                	je     8057e9 <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8057e3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8057e9:	85 db                	test   %ebx,%ebx
+  8057eb:	74 e0                	je     8057cd <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8057ed:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8057f3:	eb d8                	jmp    8057cd <ipc_recv_pages+0x62>
+
+008057f5 <ipc_recv>:
+{
+  8057f5:	55                   	push   %ebp
+  8057f6:	89 e5                	mov    %esp,%ebp
+  8057f8:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8057fb:	6a 00                	push   $0x0
+  8057fd:	ff 75 10             	push   0x10(%ebp)
+  805800:	6a 01                	push   $0x1
+  805802:	ff 75 0c             	push   0xc(%ebp)
+  805805:	ff 75 08             	push   0x8(%ebp)
+  805808:	e8 5e ff ff ff       	call   80576b <ipc_recv_pages>
+}
+  80580d:	c9                   	leave
+  80580e:	c3                   	ret
+
+0080580f <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  80580f:	55                   	push   %ebp
+  805810:	89 e5                	mov    %esp,%ebp
+  805812:	56                   	push   %esi
+  805813:	53                   	push   %ebx
+  805814:	8b 75 08             	mov    0x8(%ebp),%esi
+  805817:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  80581a:	83 ec 0c             	sub    $0xc,%esp
+  80581d:	ff 75 0c             	push   0xc(%ebp)
+  805820:	e8 cf bd ff ff       	call   8015f4 <sys_ipc_try_recv>
+  805825:	83 c4 10             	add    $0x10,%esp
+  805828:	85 c0                	test   %eax,%eax
+  80582a:	78 34                	js     805860 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80582c:	85 f6                	test   %esi,%esi
+  80582e:	74 0d                	je     80583d <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  805830:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805835:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  80583b:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  80583d:	85 db                	test   %ebx,%ebx
+  80583f:	74 0d                	je     80584e <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  805841:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805846:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80584c:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80584e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805853:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805859:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80585c:	5b                   	pop    %ebx
+  80585d:	5e                   	pop    %esi
+  80585e:	5d                   	pop    %ebp
+  80585f:	c3                   	ret
+		if (from_env_store) {
+  805860:	85 f6                	test   %esi,%esi
+  805862:	74 06                	je     80586a <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  805864:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80586a:	85 db                	test   %ebx,%ebx
+  80586c:	74 eb                	je     805859 <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  80586e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  805874:	eb e3                	jmp    805859 <ipc_try_recv+0x4a>
+
+00805876 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  805876:	55                   	push   %ebp
+  805877:	89 e5                	mov    %esp,%ebp
+  805879:	83 ec 14             	sub    $0x14,%esp
+  80587c:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  80587f:	85 c0                	test   %eax,%eax
+  805881:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  805886:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  805889:	ff 75 18             	push   0x18(%ebp)
+  80588c:	ff 75 14             	push   0x14(%ebp)
+  80588f:	50                   	push   %eax
+  805890:	ff 75 0c             	push   0xc(%ebp)
+  805893:	ff 75 08             	push   0x8(%ebp)
+  805896:	e8 e8 bb ff ff       	call   801483 <sys_ipc_send_pages>
+  80589b:	83 c4 20             	add    $0x20,%esp
+  80589e:	85 c0                	test   %eax,%eax
+  8058a0:	78 02                	js     8058a4 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  8058a2:	c9                   	leave
+  8058a3:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  8058a4:	50                   	push   %eax
+  8058a5:	68 78 69 80 00       	push   $0x806978
+  8058aa:	68 80 00 00 00       	push   $0x80
+  8058af:	68 a4 69 80 00       	push   $0x8069a4
+  8058b4:	e8 2f ac ff ff       	call   8004e8 <_panic>
+
+008058b9 <ipc_send>:
+{
+  8058b9:	55                   	push   %ebp
+  8058ba:	89 e5                	mov    %esp,%ebp
+  8058bc:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  8058bf:	ff 75 14             	push   0x14(%ebp)
+  8058c2:	6a 01                	push   $0x1
+  8058c4:	ff 75 10             	push   0x10(%ebp)
+  8058c7:	ff 75 0c             	push   0xc(%ebp)
+  8058ca:	ff 75 08             	push   0x8(%ebp)
+  8058cd:	e8 a4 ff ff ff       	call   805876 <ipc_send_pages>
+}
+  8058d2:	83 c4 20             	add    $0x20,%esp
+  8058d5:	c9                   	leave
+  8058d6:	c3                   	ret
+
+008058d7 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  8058d7:	55                   	push   %ebp
+  8058d8:	89 e5                	mov    %esp,%ebp
+  8058da:	83 ec 14             	sub    $0x14,%esp
+  8058dd:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8058e0:	85 c0                	test   %eax,%eax
+  8058e2:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8058e7:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8058ea:	ff 75 18             	push   0x18(%ebp)
+  8058ed:	ff 75 14             	push   0x14(%ebp)
+  8058f0:	50                   	push   %eax
+  8058f1:	ff 75 0c             	push   0xc(%ebp)
+  8058f4:	ff 75 08             	push   0x8(%ebp)
+  8058f7:	e8 18 bc ff ff       	call   801514 <sys_ipc_call>
+  8058fc:	83 c4 20             	add    $0x20,%esp
+  8058ff:	85 c0                	test   %eax,%eax
+  805901:	78 0b                	js     80590e <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  805903:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805908:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80590e:	c9                   	leave
+  80590f:	c3                   	ret
+
+00805910 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  805910:	55                   	push   %ebp
+  805911:	89 e5                	mov    %esp,%ebp
+  805913:	57                   	push   %edi
+  805914:	56                   	push   %esi
+  805915:	53                   	push   %ebx
+  805916:	83 ec 18             	sub    $0x18,%esp
+  805919:	8b 45 10             	mov    0x10(%ebp),%eax
+  80591c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  80591f:	8b 75 20             	mov    0x20(%ebp),%esi
+  805922:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  805925:	85 c0                	test   %eax,%eax
+  805927:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80592c:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80592f:	ff 75 18             	push   0x18(%ebp)
+  805932:	ff 75 14             	push   0x14(%ebp)
+  805935:	50                   	push   %eax
+  805936:	ff 75 0c             	push   0xc(%ebp)
+  805939:	ff 75 08             	push   0x8(%ebp)
+  80593c:	e8 14 bc ff ff       	call   801555 <sys_ipc_reply_recv>
+  805941:	83 c4 20             	add    $0x20,%esp
+  805944:	85 c0                	test   %eax,%eax
+  805946:	78 46                	js     80598e <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  805948:	85 ff                	test   %edi,%edi
+  80594a:	74 0d                	je     805959 <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  80594c:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805951:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  805957:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  805959:	85 f6                	test   %esi,%esi
+  80595b:	74 0d                	je     80596a <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  80595d:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805962:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  805968:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80596a:	85 db                	test   %ebx,%ebx
+  80596c:	74 0d                	je     80597b <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  80596e:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805973:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  805979:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80597b:	a1 18 f9 80 00       	mov    0x80f918,%eax
+  805980:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  805986:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805989:	5b                   	pop    %ebx
+  80598a:	5e                   	pop    %esi
+  80598b:	5f                   	pop    %edi
+  80598c:	5d                   	pop    %ebp
+  80598d:	c3                   	ret
+		if (from_env_store) {
+  80598e:	85 ff                	test   %edi,%edi
+  805990:	74 06                	je     805998 <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  805992:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  805998:	85 f6                	test   %esi,%esi
+  80599a:	74 06                	je     8059a2 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80599c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8059a2:	85 db                	test   %ebx,%ebx
+  8059a4:	74 e0                	je     805986 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  8059a6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8059ac:	eb d8                	jmp    805986 <ipc_reply_recv+0x76>
+
+008059ae <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8059ae:	55                   	push   %ebp
+  8059af:	89 e5                	mov    %esp,%ebp
+  8059b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8059b4:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  8059b9:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8059bc:	c1 e0 06             	shl    $0x6,%eax
+  8059bf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8059c4:	8b 40 50             	mov    0x50(%eax),%eax
+  8059c7:	39 c8                	cmp    %ecx,%eax
+  8059c9:	74 12                	je     8059dd <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8059cb:	83 c2 01             	add    $0x1,%edx
+  8059ce:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8059d4:	75 e3                	jne    8059b9 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8059d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059db:	eb 0e                	jmp    8059eb <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8059dd:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8059e0:	c1 e0 06             	shl    $0x6,%eax
+  8059e3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8059e8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8059eb:	5d                   	pop    %ebp
+  8059ec:	c3                   	ret
+
+008059ed <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8059ed:	55                   	push   %ebp
+  8059ee:	89 e5                	mov    %esp,%ebp
+  8059f0:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8059f3:	89 c2                	mov    %eax,%edx
+  8059f5:	c1 ea 16             	shr    $0x16,%edx
+  8059f8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8059ff:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  805a04:	f6 c1 01             	test   $0x1,%cl
+  805a07:	74 1e                	je     805a27 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  805a09:	c1 e8 0c             	shr    $0xc,%eax
+  805a0c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  805a13:	a8 01                	test   $0x1,%al
+  805a15:	74 10                	je     805a27 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  805a17:	c1 e8 0c             	shr    $0xc,%eax
+  805a1a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  805a1d:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  805a24:	0f b7 d2             	movzwl %dx,%edx
+}
+  805a27:	89 d0                	mov    %edx,%eax
+  805a29:	5d                   	pop    %ebp
+  805a2a:	c3                   	ret
+
+00805a2b <udivmod>:
+  805a2b:	55                   	push   %ebp
+  805a2c:	57                   	push   %edi
+  805a2d:	56                   	push   %esi
+  805a2e:	53                   	push   %ebx
+  805a2f:	83 ec 24             	sub    $0x24,%esp
+  805a32:	89 44 24 08          	mov    %eax,0x8(%esp)
+  805a36:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  805a3a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  805a3e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  805a42:	89 44 24 10          	mov    %eax,0x10(%esp)
+  805a46:	89 54 24 14          	mov    %edx,0x14(%esp)
+  805a4a:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  805a4e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  805a53:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a58:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a5d:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  805a64:	00 
+  805a65:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  805a6c:	00 
+  805a6d:	89 fb                	mov    %edi,%ebx
+  805a6f:	eb 08                	jmp    805a79 <udivmod+0x4e>
+  805a71:	83 e9 01             	sub    $0x1,%ecx
+  805a74:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  805a77:	74 68                	je     805ae1 <udivmod+0xb6>
+  805a79:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  805a7d:	01 c0                	add    %eax,%eax
+  805a7f:	89 c6                	mov    %eax,%esi
+  805a81:	89 d7                	mov    %edx,%edi
+  805a83:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805a87:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805a8b:	0f ad d0             	shrd   %cl,%edx,%eax
+  805a8e:	d3 ea                	shr    %cl,%edx
+  805a90:	f6 c1 20             	test   $0x20,%cl
+  805a93:	74 04                	je     805a99 <udivmod+0x6e>
+  805a95:	89 d0                	mov    %edx,%eax
+  805a97:	31 d2                	xor    %edx,%edx
+  805a99:	83 e0 01             	and    $0x1,%eax
+  805a9c:	89 04 24             	mov    %eax,(%esp)
+  805a9f:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  805aa6:	00 
+  805aa7:	8b 04 24             	mov    (%esp),%eax
+  805aaa:	8b 54 24 04          	mov    0x4(%esp),%edx
+  805aae:	09 f0                	or     %esi,%eax
+  805ab0:	09 fa                	or     %edi,%edx
+  805ab2:	8b 74 24 10          	mov    0x10(%esp),%esi
+  805ab6:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  805aba:	39 f0                	cmp    %esi,%eax
+  805abc:	89 d5                	mov    %edx,%ebp
+  805abe:	19 fd                	sbb    %edi,%ebp
+  805ac0:	72 af                	jb     805a71 <udivmod+0x46>
+  805ac2:	29 f0                	sub    %esi,%eax
+  805ac4:	19 fa                	sbb    %edi,%edx
+  805ac6:	89 cf                	mov    %ecx,%edi
+  805ac8:	c1 ef 05             	shr    $0x5,%edi
+  805acb:	83 e7 01             	and    $0x1,%edi
+  805ace:	89 fe                	mov    %edi,%esi
+  805ad0:	83 f6 01             	xor    $0x1,%esi
+  805ad3:	d3 e6                	shl    %cl,%esi
+  805ad5:	d3 e7                	shl    %cl,%edi
+  805ad7:	09 74 24 18          	or     %esi,0x18(%esp)
+  805adb:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  805adf:	eb 90                	jmp    805a71 <udivmod+0x46>
+  805ae1:	85 db                	test   %ebx,%ebx
+  805ae3:	74 05                	je     805aea <udivmod+0xbf>
+  805ae5:	89 03                	mov    %eax,(%ebx)
+  805ae7:	89 53 04             	mov    %edx,0x4(%ebx)
+  805aea:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805aee:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805af2:	83 c4 24             	add    $0x24,%esp
+  805af5:	5b                   	pop    %ebx
+  805af6:	5e                   	pop    %esi
+  805af7:	5f                   	pop    %edi
+  805af8:	5d                   	pop    %ebp
+  805af9:	c3                   	ret
+
+00805afa <__udivdi3>:
+  805afa:	83 ec 08             	sub    $0x8,%esp
+  805afd:	6a 00                	push   $0x0
+  805aff:	ff 74 24 1c          	push   0x1c(%esp)
+  805b03:	ff 74 24 1c          	push   0x1c(%esp)
+  805b07:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805b0b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805b0f:	e8 17 ff ff ff       	call   805a2b <udivmod>
+  805b14:	83 c4 14             	add    $0x14,%esp
+  805b17:	c3                   	ret
+
+00805b18 <__umoddi3>:
+  805b18:	83 ec 18             	sub    $0x18,%esp
+  805b1b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805b1f:	50                   	push   %eax
+  805b20:	ff 74 24 2c          	push   0x2c(%esp)
+  805b24:	ff 74 24 2c          	push   0x2c(%esp)
+  805b28:	8b 44 24 28          	mov    0x28(%esp),%eax
+  805b2c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  805b30:	e8 f6 fe ff ff       	call   805a2b <udivmod>
+  805b35:	8b 44 24 18          	mov    0x18(%esp),%eax
+  805b39:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  805b3d:	83 c4 24             	add    $0x24,%esp
+  805b40:	c3                   	ret
+
+00805b41 <__divdi3>:
+  805b41:	55                   	push   %ebp
+  805b42:	57                   	push   %edi
+  805b43:	56                   	push   %esi
+  805b44:	53                   	push   %ebx
+  805b45:	83 ec 10             	sub    $0x10,%esp
+  805b48:	8b 44 24 24          	mov    0x24(%esp),%eax
+  805b4c:	8b 54 24 28          	mov    0x28(%esp),%edx
+  805b50:	89 c6                	mov    %eax,%esi
+  805b52:	89 d7                	mov    %edx,%edi
+  805b54:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  805b58:	33 7c 24 30          	xor    0x30(%esp),%edi
+  805b5c:	89 74 24 04          	mov    %esi,0x4(%esp)
+  805b60:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  805b64:	89 c5                	mov    %eax,%ebp
+  805b66:	f7 dd                	neg    %ebp
+  805b68:	89 d6                	mov    %edx,%esi
+  805b6a:	83 d6 00             	adc    $0x0,%esi
+  805b6d:	f7 de                	neg    %esi
+  805b6f:	0f 48 e8             	cmovs  %eax,%ebp
+  805b72:	0f 49 d6             	cmovns %esi,%edx
+  805b75:	6a 00                	push   $0x0
+  805b77:	8b 74 24 30          	mov    0x30(%esp),%esi
+  805b7b:	f7 de                	neg    %esi
+  805b7d:	8b 44 24 34          	mov    0x34(%esp),%eax
+  805b81:	83 d0 00             	adc    $0x0,%eax
+  805b84:	f7 d8                	neg    %eax
+  805b86:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  805b8b:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  805b90:	50                   	push   %eax
+  805b91:	56                   	push   %esi
+  805b92:	89 e8                	mov    %ebp,%eax
+  805b94:	e8 92 fe ff ff       	call   805a2b <udivmod>
+  805b99:	83 c4 10             	add    $0x10,%esp
+  805b9c:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  805ba1:	78 08                	js     805bab <__divdi3+0x6a>
+  805ba3:	83 c4 0c             	add    $0xc,%esp
+  805ba6:	5b                   	pop    %ebx
+  805ba7:	5e                   	pop    %esi
+  805ba8:	5f                   	pop    %edi
+  805ba9:	5d                   	pop    %ebp
+  805baa:	c3                   	ret
+  805bab:	f7 d8                	neg    %eax
+  805bad:	83 d2 00             	adc    $0x0,%edx
+  805bb0:	f7 da                	neg    %edx
+  805bb2:	eb ef                	jmp    805ba3 <__divdi3+0x62>
+
+00805bb4 <__moddi3>:
+  805bb4:	55                   	push   %ebp
+  805bb5:	57                   	push   %edi
+  805bb6:	56                   	push   %esi
+  805bb7:	53                   	push   %ebx
+  805bb8:	83 ec 18             	sub    $0x18,%esp
+  805bbb:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  805bbf:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  805bc3:	89 f1                	mov    %esi,%ecx
+  805bc5:	f7 d9                	neg    %ecx
+  805bc7:	89 da                	mov    %ebx,%edx
+  805bc9:	83 d2 00             	adc    $0x0,%edx
+  805bcc:	f7 da                	neg    %edx
+  805bce:	0f 48 ce             	cmovs  %esi,%ecx
+  805bd1:	0f 48 d3             	cmovs  %ebx,%edx
+  805bd4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  805bd8:	50                   	push   %eax
+  805bd9:	8b 74 24 38          	mov    0x38(%esp),%esi
+  805bdd:	f7 de                	neg    %esi
+  805bdf:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  805be3:	83 d0 00             	adc    $0x0,%eax
+  805be6:	f7 d8                	neg    %eax
+  805be8:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  805bed:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  805bf2:	50                   	push   %eax
+  805bf3:	56                   	push   %esi
+  805bf4:	89 c8                	mov    %ecx,%eax
+  805bf6:	e8 30 fe ff ff       	call   805a2b <udivmod>
+  805bfb:	83 c4 10             	add    $0x10,%esp
+  805bfe:	85 db                	test   %ebx,%ebx
+  805c00:	78 10                	js     805c12 <__moddi3+0x5e>
+  805c02:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805c06:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805c0a:	83 c4 14             	add    $0x14,%esp
+  805c0d:	5b                   	pop    %ebx
+  805c0e:	5e                   	pop    %esi
+  805c0f:	5f                   	pop    %edi
+  805c10:	5d                   	pop    %ebp
+  805c11:	c3                   	ret
+  805c12:	8b 44 24 08          	mov    0x8(%esp),%eax
+  805c16:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  805c1a:	f7 d8                	neg    %eax
+  805c1c:	83 d2 00             	adc    $0x0,%edx
+  805c1f:	f7 da                	neg    %edx
+  805c21:	eb e7                	jmp    805c0a <__moddi3+0x56>
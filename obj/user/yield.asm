@@ -0,0 +1,5598 @@
+
+obj/user/yield.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 69 00 00 00       	call   80009a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  80003a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80003f:	8b 40 48             	mov    0x48(%eax),%eax
+  800042:	50                   	push   %eax
+  800043:	68 00 27 80 00       	push   $0x802700
+  800048:	e8 45 01 00 00       	call   800192 <cprintf>
+  80004d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 5; i++) {
+  800050:	bb 00 00 00 00       	mov    $0x0,%ebx
+		sys_yield();
+  800055:	e8 f3 0b 00 00       	call   800c4d <sys_yield>
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  80005a:	a1 08 40 80 00       	mov    0x804008,%eax
+  80005f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	53                   	push   %ebx
+  800066:	50                   	push   %eax
+  800067:	68 20 27 80 00       	push   $0x802720
+  80006c:	e8 21 01 00 00       	call   800192 <cprintf>
+	for (i = 0; i < 5; i++) {
+  800071:	83 c3 01             	add    $0x1,%ebx
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	83 fb 05             	cmp    $0x5,%ebx
+  80007a:	75 d9                	jne    800055 <umain+0x22>
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  80007c:	a1 08 40 80 00       	mov    0x804008,%eax
+  800081:	8b 40 48             	mov    0x48(%eax),%eax
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	50                   	push   %eax
+  800088:	68 4c 27 80 00       	push   $0x80274c
+  80008d:	e8 00 01 00 00       	call   800192 <cprintf>
+}
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8000a5:	e8 84 0b 00 00       	call   800c2e <sys_getenvid>
+  8000aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000af:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8000b2:	c1 e0 06             	shl    $0x6,%eax
+  8000b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ba:	a3 08 40 80 00       	mov    %eax,0x804008
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000bf:	85 db                	test   %ebx,%ebx
+  8000c1:	7e 07                	jle    8000ca <libmain+0x30>
+		binaryname = argv[0];
+  8000c3:	8b 06                	mov    (%esi),%eax
+  8000c5:	a3 00 30 80 00       	mov    %eax,0x803000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	e8 5f ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d4:	e8 0a 00 00 00       	call   8000e3 <exit>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5d                   	pop    %ebp
+  8000e2:	c3                   	ret
+
+008000e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e9:	e8 e4 12 00 00       	call   8013d2 <close_all>
+	sys_env_destroy(0);
+  8000ee:	83 ec 0c             	sub    $0xc,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	e8 f5 0a 00 00       	call   800bed <sys_env_destroy>
+}
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	c9                   	leave
+  8000fc:	c3                   	ret
+
+008000fd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	53                   	push   %ebx
+  800101:	83 ec 04             	sub    $0x4,%esp
+  800104:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800107:	8b 13                	mov    (%ebx),%edx
+  800109:	8d 42 01             	lea    0x1(%edx),%eax
+  80010c:	89 03                	mov    %eax,(%ebx)
+  80010e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800111:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800115:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80011a:	74 09                	je     800125 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80011c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800120:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800123:	c9                   	leave
+  800124:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800125:	83 ec 08             	sub    $0x8,%esp
+  800128:	68 ff 00 00 00       	push   $0xff
+  80012d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800130:	50                   	push   %eax
+  800131:	e8 69 0a 00 00       	call   800b9f <sys_cputs>
+		b->idx = 0;
+  800136:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80013c:	83 c4 10             	add    $0x10,%esp
+  80013f:	eb db                	jmp    80011c <putch+0x1f>
+
+00800141 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800141:	55                   	push   %ebp
+  800142:	89 e5                	mov    %esp,%ebp
+  800144:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80014a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800151:	00 00 00 
+	b.cnt = 0;
+  800154:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80015b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80015e:	ff 75 0c             	push   0xc(%ebp)
+  800161:	ff 75 08             	push   0x8(%ebp)
+  800164:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80016a:	50                   	push   %eax
+  80016b:	68 fd 00 80 00       	push   $0x8000fd
+  800170:	e8 14 01 00 00       	call   800289 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800175:	83 c4 08             	add    $0x8,%esp
+  800178:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80017e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800184:	50                   	push   %eax
+  800185:	e8 15 0a 00 00       	call   800b9f <sys_cputs>
+
+	return b.cnt;
+}
+  80018a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800190:	c9                   	leave
+  800191:	c3                   	ret
+
+00800192 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800192:	55                   	push   %ebp
+  800193:	89 e5                	mov    %esp,%ebp
+  800195:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800198:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80019b:	50                   	push   %eax
+  80019c:	ff 75 08             	push   0x8(%ebp)
+  80019f:	e8 9d ff ff ff       	call   800141 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+
+008001a6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	57                   	push   %edi
+  8001aa:	56                   	push   %esi
+  8001ab:	53                   	push   %ebx
+  8001ac:	83 ec 1c             	sub    $0x1c,%esp
+  8001af:	89 c7                	mov    %eax,%edi
+  8001b1:	89 d6                	mov    %edx,%esi
+  8001b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b9:	89 d1                	mov    %edx,%ecx
+  8001bb:	89 c2                	mov    %eax,%edx
+  8001bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001c6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001cc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001d3:	39 c2                	cmp    %eax,%edx
+  8001d5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d8:	72 3e                	jb     800218 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001da:	83 ec 0c             	sub    $0xc,%esp
+  8001dd:	ff 75 18             	push   0x18(%ebp)
+  8001e0:	83 eb 01             	sub    $0x1,%ebx
+  8001e3:	53                   	push   %ebx
+  8001e4:	50                   	push   %eax
+  8001e5:	83 ec 08             	sub    $0x8,%esp
+  8001e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8001eb:	ff 75 e0             	push   -0x20(%ebp)
+  8001ee:	ff 75 dc             	push   -0x24(%ebp)
+  8001f1:	ff 75 d8             	push   -0x28(%ebp)
+  8001f4:	e8 c3 23 00 00       	call   8025bc <__udivdi3>
+  8001f9:	83 c4 18             	add    $0x18,%esp
+  8001fc:	52                   	push   %edx
+  8001fd:	50                   	push   %eax
+  8001fe:	89 f2                	mov    %esi,%edx
+  800200:	89 f8                	mov    %edi,%eax
+  800202:	e8 9f ff ff ff       	call   8001a6 <printnum>
+  800207:	83 c4 20             	add    $0x20,%esp
+  80020a:	eb 13                	jmp    80021f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80020c:	83 ec 08             	sub    $0x8,%esp
+  80020f:	56                   	push   %esi
+  800210:	ff 75 18             	push   0x18(%ebp)
+  800213:	ff d7                	call   *%edi
+  800215:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800218:	83 eb 01             	sub    $0x1,%ebx
+  80021b:	85 db                	test   %ebx,%ebx
+  80021d:	7f ed                	jg     80020c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80021f:	83 ec 08             	sub    $0x8,%esp
+  800222:	56                   	push   %esi
+  800223:	83 ec 04             	sub    $0x4,%esp
+  800226:	ff 75 e4             	push   -0x1c(%ebp)
+  800229:	ff 75 e0             	push   -0x20(%ebp)
+  80022c:	ff 75 dc             	push   -0x24(%ebp)
+  80022f:	ff 75 d8             	push   -0x28(%ebp)
+  800232:	e8 a3 23 00 00       	call   8025da <__umoddi3>
+  800237:	83 c4 14             	add    $0x14,%esp
+  80023a:	0f be 80 75 27 80 00 	movsbl 0x802775(%eax),%eax
+  800241:	50                   	push   %eax
+  800242:	ff d7                	call   *%edi
+}
+  800244:	83 c4 10             	add    $0x10,%esp
+  800247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024a:	5b                   	pop    %ebx
+  80024b:	5e                   	pop    %esi
+  80024c:	5f                   	pop    %edi
+  80024d:	5d                   	pop    %ebp
+  80024e:	c3                   	ret
+
+0080024f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80024f:	55                   	push   %ebp
+  800250:	89 e5                	mov    %esp,%ebp
+  800252:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800255:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800259:	8b 10                	mov    (%eax),%edx
+  80025b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80025e:	73 0a                	jae    80026a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800260:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800263:	89 08                	mov    %ecx,(%eax)
+  800265:	8b 45 08             	mov    0x8(%ebp),%eax
+  800268:	88 02                	mov    %al,(%edx)
+}
+  80026a:	5d                   	pop    %ebp
+  80026b:	c3                   	ret
+
+0080026c <printfmt>:
+{
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800272:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800275:	50                   	push   %eax
+  800276:	ff 75 10             	push   0x10(%ebp)
+  800279:	ff 75 0c             	push   0xc(%ebp)
+  80027c:	ff 75 08             	push   0x8(%ebp)
+  80027f:	e8 05 00 00 00       	call   800289 <vprintfmt>
+}
+  800284:	83 c4 10             	add    $0x10,%esp
+  800287:	c9                   	leave
+  800288:	c3                   	ret
+
+00800289 <vprintfmt>:
+{
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	57                   	push   %edi
+  80028d:	56                   	push   %esi
+  80028e:	53                   	push   %ebx
+  80028f:	83 ec 2c             	sub    $0x2c,%esp
+  800292:	8b 75 08             	mov    0x8(%ebp),%esi
+  800295:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800298:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80029b:	eb 0a                	jmp    8002a7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80029d:	83 ec 08             	sub    $0x8,%esp
+  8002a0:	53                   	push   %ebx
+  8002a1:	50                   	push   %eax
+  8002a2:	ff d6                	call   *%esi
+  8002a4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002a7:	83 c7 01             	add    $0x1,%edi
+  8002aa:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002ae:	83 f8 25             	cmp    $0x25,%eax
+  8002b1:	74 0c                	je     8002bf <vprintfmt+0x36>
+			if (ch == '\0')
+  8002b3:	85 c0                	test   %eax,%eax
+  8002b5:	75 e6                	jne    80029d <vprintfmt+0x14>
+}
+  8002b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ba:	5b                   	pop    %ebx
+  8002bb:	5e                   	pop    %esi
+  8002bc:	5f                   	pop    %edi
+  8002bd:	5d                   	pop    %ebp
+  8002be:	c3                   	ret
+		padc = ' ';
+  8002bf:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002c3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002ca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002d1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002dd:	8d 47 01             	lea    0x1(%edi),%eax
+  8002e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002e3:	0f b6 17             	movzbl (%edi),%edx
+  8002e6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002e9:	3c 55                	cmp    $0x55,%al
+  8002eb:	0f 87 c5 03 00 00    	ja     8006b6 <vprintfmt+0x42d>
+  8002f1:	0f b6 c0             	movzbl %al,%eax
+  8002f4:	ff 24 85 00 29 80 00 	jmp    *0x802900(,%eax,4)
+  8002fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002fe:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800302:	eb d9                	jmp    8002dd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800304:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800307:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80030b:	eb d0                	jmp    8002dd <vprintfmt+0x54>
+  80030d:	0f b6 d2             	movzbl %dl,%edx
+  800310:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800313:	b8 00 00 00 00       	mov    $0x0,%eax
+  800318:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80031b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80031e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800322:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800325:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800328:	83 f9 09             	cmp    $0x9,%ecx
+  80032b:	77 55                	ja     800382 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80032d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800330:	eb e9                	jmp    80031b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800332:	8b 45 14             	mov    0x14(%ebp),%eax
+  800335:	8b 00                	mov    (%eax),%eax
+  800337:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033d:	8d 40 04             	lea    0x4(%eax),%eax
+  800340:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800343:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800346:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80034a:	79 91                	jns    8002dd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80034c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80034f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800352:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800359:	eb 82                	jmp    8002dd <vprintfmt+0x54>
+			if (width < 0)
+  80035b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80035e:	85 d2                	test   %edx,%edx
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	0f 49 c2             	cmovns %edx,%eax
+  800368:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80036b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80036e:	e9 6a ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800373:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800376:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80037d:	e9 5b ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+  800382:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800385:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800388:	eb bc                	jmp    800346 <vprintfmt+0xbd>
+			lflag++;
+  80038a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80038d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800390:	e9 48 ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800395:	8b 45 14             	mov    0x14(%ebp),%eax
+  800398:	8d 78 04             	lea    0x4(%eax),%edi
+  80039b:	83 ec 08             	sub    $0x8,%esp
+  80039e:	53                   	push   %ebx
+  80039f:	ff 30                	push   (%eax)
+  8003a1:	ff d6                	call   *%esi
+			break;
+  8003a3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003a6:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003a9:	e9 63 02 00 00       	jmp    800611 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8003ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b1:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003b4:	8b 10                	mov    (%eax),%edx
+  8003b6:	89 d0                	mov    %edx,%eax
+  8003b8:	f7 d8                	neg    %eax
+  8003ba:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003bd:	83 f8 12             	cmp    $0x12,%eax
+  8003c0:	7f 23                	jg     8003e5 <vprintfmt+0x15c>
+  8003c2:	8b 14 85 60 2a 80 00 	mov    0x802a60(,%eax,4),%edx
+  8003c9:	85 d2                	test   %edx,%edx
+  8003cb:	74 18                	je     8003e5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003cd:	52                   	push   %edx
+  8003ce:	68 9d 2b 80 00       	push   $0x802b9d
+  8003d3:	53                   	push   %ebx
+  8003d4:	56                   	push   %esi
+  8003d5:	e8 92 fe ff ff       	call   80026c <printfmt>
+  8003da:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003dd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003e0:	e9 2c 02 00 00       	jmp    800611 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  8003e5:	50                   	push   %eax
+  8003e6:	68 8d 27 80 00       	push   $0x80278d
+  8003eb:	53                   	push   %ebx
+  8003ec:	56                   	push   %esi
+  8003ed:	e8 7a fe ff ff       	call   80026c <printfmt>
+  8003f2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003f8:	e9 14 02 00 00       	jmp    800611 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800400:	83 c0 04             	add    $0x4,%eax
+  800403:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800406:	8b 45 14             	mov    0x14(%ebp),%eax
+  800409:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80040b:	85 c9                	test   %ecx,%ecx
+  80040d:	b8 86 27 80 00       	mov    $0x802786,%eax
+  800412:	0f 45 c1             	cmovne %ecx,%eax
+  800415:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800418:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80041c:	7e 06                	jle    800424 <vprintfmt+0x19b>
+  80041e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800422:	75 0b                	jne    80042f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800424:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800427:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80042a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80042d:	eb 5c                	jmp    80048b <vprintfmt+0x202>
+  80042f:	83 ec 08             	sub    $0x8,%esp
+  800432:	ff 75 d0             	push   -0x30(%ebp)
+  800435:	ff 75 cc             	push   -0x34(%ebp)
+  800438:	e8 19 03 00 00       	call   800756 <strnlen>
+  80043d:	89 c2                	mov    %eax,%edx
+  80043f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800442:	29 d0                	sub    %edx,%eax
+  800444:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800447:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80044b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800451:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800453:	eb 0e                	jmp    800463 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800455:	83 ec 08             	sub    $0x8,%esp
+  800458:	53                   	push   %ebx
+  800459:	57                   	push   %edi
+  80045a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80045d:	83 ee 01             	sub    $0x1,%esi
+  800460:	83 c4 10             	add    $0x10,%esp
+  800463:	85 f6                	test   %esi,%esi
+  800465:	7f ee                	jg     800455 <vprintfmt+0x1cc>
+  800467:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80046a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80046d:	85 c0                	test   %eax,%eax
+  80046f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800474:	0f 49 d0             	cmovns %eax,%edx
+  800477:	29 d0                	sub    %edx,%eax
+  800479:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047c:	eb a6                	jmp    800424 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80047e:	83 ec 08             	sub    $0x8,%esp
+  800481:	53                   	push   %ebx
+  800482:	52                   	push   %edx
+  800483:	ff 55 08             	call   *0x8(%ebp)
+  800486:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800489:	89 f1                	mov    %esi,%ecx
+  80048b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80048e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800492:	0f be d0             	movsbl %al,%edx
+  800495:	85 d2                	test   %edx,%edx
+  800497:	74 28                	je     8004c1 <vprintfmt+0x238>
+  800499:	85 ff                	test   %edi,%edi
+  80049b:	78 05                	js     8004a2 <vprintfmt+0x219>
+  80049d:	83 ef 01             	sub    $0x1,%edi
+  8004a0:	78 30                	js     8004d2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004a2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004a6:	74 d6                	je     80047e <vprintfmt+0x1f5>
+  8004a8:	0f be c0             	movsbl %al,%eax
+  8004ab:	83 e8 20             	sub    $0x20,%eax
+  8004ae:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b1:	76 cb                	jbe    80047e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004b3:	83 ec 08             	sub    $0x8,%esp
+  8004b6:	53                   	push   %ebx
+  8004b7:	6a 3f                	push   $0x3f
+  8004b9:	ff 55 08             	call   *0x8(%ebp)
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	eb c8                	jmp    800489 <vprintfmt+0x200>
+  8004c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004c7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ca:	01 d0                	add    %edx,%eax
+  8004cc:	29 c8                	sub    %ecx,%eax
+  8004ce:	89 c7                	mov    %eax,%edi
+  8004d0:	eb 13                	jmp    8004e5 <vprintfmt+0x25c>
+  8004d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d5:	eb ed                	jmp    8004c4 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004d7:	83 ec 08             	sub    $0x8,%esp
+  8004da:	53                   	push   %ebx
+  8004db:	6a 20                	push   $0x20
+  8004dd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004df:	83 ef 01             	sub    $0x1,%edi
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	85 ff                	test   %edi,%edi
+  8004e7:	7f ee                	jg     8004d7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004e9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ef:	e9 1d 01 00 00       	jmp    800611 <vprintfmt+0x388>
+	if (lflag >= 2)
+  8004f4:	83 f9 01             	cmp    $0x1,%ecx
+  8004f7:	7f 1b                	jg     800514 <vprintfmt+0x28b>
+	else if (lflag)
+  8004f9:	85 c9                	test   %ecx,%ecx
+  8004fb:	74 63                	je     800560 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  8004fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800500:	8b 00                	mov    (%eax),%eax
+  800502:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800505:	99                   	cltd
+  800506:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800509:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050c:	8d 40 04             	lea    0x4(%eax),%eax
+  80050f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800512:	eb 17                	jmp    80052b <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  800514:	8b 45 14             	mov    0x14(%ebp),%eax
+  800517:	8b 50 04             	mov    0x4(%eax),%edx
+  80051a:	8b 00                	mov    (%eax),%eax
+  80051c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80051f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800522:	8b 45 14             	mov    0x14(%ebp),%eax
+  800525:	8d 40 08             	lea    0x8(%eax),%eax
+  800528:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80052b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80052e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800531:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800536:	85 c9                	test   %ecx,%ecx
+  800538:	0f 89 b9 00 00 00    	jns    8005f7 <vprintfmt+0x36e>
+				putch('-', putdat);
+  80053e:	83 ec 08             	sub    $0x8,%esp
+  800541:	53                   	push   %ebx
+  800542:	6a 2d                	push   $0x2d
+  800544:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800546:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800549:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80054c:	f7 da                	neg    %edx
+  80054e:	83 d1 00             	adc    $0x0,%ecx
+  800551:	f7 d9                	neg    %ecx
+  800553:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800556:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80055b:	e9 97 00 00 00       	jmp    8005f7 <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  800560:	8b 45 14             	mov    0x14(%ebp),%eax
+  800563:	8b 00                	mov    (%eax),%eax
+  800565:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800568:	99                   	cltd
+  800569:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80056c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056f:	8d 40 04             	lea    0x4(%eax),%eax
+  800572:	89 45 14             	mov    %eax,0x14(%ebp)
+  800575:	eb b4                	jmp    80052b <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  800577:	83 f9 01             	cmp    $0x1,%ecx
+  80057a:	7f 1b                	jg     800597 <vprintfmt+0x30e>
+	else if (lflag)
+  80057c:	85 c9                	test   %ecx,%ecx
+  80057e:	74 2c                	je     8005ac <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8b 10                	mov    (%eax),%edx
+  800585:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80058a:	8d 40 04             	lea    0x4(%eax),%eax
+  80058d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800590:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800595:	eb 60                	jmp    8005f7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800597:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059a:	8b 10                	mov    (%eax),%edx
+  80059c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80059f:	8d 40 08             	lea    0x8(%eax),%eax
+  8005a2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005a5:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005aa:	eb 4b                	jmp    8005f7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8005ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005af:	8b 10                	mov    (%eax),%edx
+  8005b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005bc:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005c1:	eb 34                	jmp    8005f7 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  8005c3:	83 f9 01             	cmp    $0x1,%ecx
+  8005c6:	7f 15                	jg     8005dd <vprintfmt+0x354>
+	else if (lflag)
+  8005c8:	85 c9                	test   %ecx,%ecx
+  8005ca:	74 4d                	je     800619 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  8005cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cf:	8b 00                	mov    (%eax),%eax
+  8005d1:	99                   	cltd
+  8005d2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005d5:	8d 49 04             	lea    0x4(%ecx),%ecx
+  8005d8:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  8005db:	eb 11                	jmp    8005ee <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  8005dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e0:	8b 50 04             	mov    0x4(%eax),%edx
+  8005e3:	8b 00                	mov    (%eax),%eax
+  8005e5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8005e8:	8d 49 08             	lea    0x8(%ecx),%ecx
+  8005eb:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  8005ee:	89 d1                	mov    %edx,%ecx
+  8005f0:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  8005f2:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8005f7:	83 ec 0c             	sub    $0xc,%esp
+  8005fa:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8005fe:	50                   	push   %eax
+  8005ff:	ff 75 e0             	push   -0x20(%ebp)
+  800602:	57                   	push   %edi
+  800603:	51                   	push   %ecx
+  800604:	52                   	push   %edx
+  800605:	89 da                	mov    %ebx,%edx
+  800607:	89 f0                	mov    %esi,%eax
+  800609:	e8 98 fb ff ff       	call   8001a6 <printnum>
+			break;
+  80060e:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800611:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800614:	e9 8e fc ff ff       	jmp    8002a7 <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800619:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061c:	8b 00                	mov    (%eax),%eax
+  80061e:	99                   	cltd
+  80061f:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800622:	8d 49 04             	lea    0x4(%ecx),%ecx
+  800625:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800628:	eb c4                	jmp    8005ee <vprintfmt+0x365>
+			putch('0', putdat);
+  80062a:	83 ec 08             	sub    $0x8,%esp
+  80062d:	53                   	push   %ebx
+  80062e:	6a 30                	push   $0x30
+  800630:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800632:	83 c4 08             	add    $0x8,%esp
+  800635:	53                   	push   %ebx
+  800636:	6a 78                	push   $0x78
+  800638:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8b 10                	mov    (%eax),%edx
+  80063f:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800644:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800647:	8d 40 04             	lea    0x4(%eax),%eax
+  80064a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80064d:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800652:	eb a3                	jmp    8005f7 <vprintfmt+0x36e>
+	if (lflag >= 2)
+  800654:	83 f9 01             	cmp    $0x1,%ecx
+  800657:	7f 1b                	jg     800674 <vprintfmt+0x3eb>
+	else if (lflag)
+  800659:	85 c9                	test   %ecx,%ecx
+  80065b:	74 2f                	je     80068c <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  80065d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800660:	8b 10                	mov    (%eax),%edx
+  800662:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800667:	8d 40 04             	lea    0x4(%eax),%eax
+  80066a:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80066d:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800672:	eb 83                	jmp    8005f7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8b 10                	mov    (%eax),%edx
+  800679:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067c:	8d 40 08             	lea    0x8(%eax),%eax
+  80067f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800682:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800687:	e9 6b ff ff ff       	jmp    8005f7 <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 10                	mov    (%eax),%edx
+  800691:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80069c:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006a1:	e9 51 ff ff ff       	jmp    8005f7 <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	53                   	push   %ebx
+  8006aa:	6a 25                	push   $0x25
+  8006ac:	ff d6                	call   *%esi
+			break;
+  8006ae:	83 c4 10             	add    $0x10,%esp
+  8006b1:	e9 5b ff ff ff       	jmp    800611 <vprintfmt+0x388>
+			putch('%', putdat);
+  8006b6:	83 ec 08             	sub    $0x8,%esp
+  8006b9:	53                   	push   %ebx
+  8006ba:	6a 25                	push   $0x25
+  8006bc:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006be:	83 c4 10             	add    $0x10,%esp
+  8006c1:	89 f8                	mov    %edi,%eax
+  8006c3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006c7:	74 05                	je     8006ce <vprintfmt+0x445>
+  8006c9:	83 e8 01             	sub    $0x1,%eax
+  8006cc:	eb f5                	jmp    8006c3 <vprintfmt+0x43a>
+  8006ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006d1:	e9 3b ff ff ff       	jmp    800611 <vprintfmt+0x388>
+
+008006d6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006d6:	55                   	push   %ebp
+  8006d7:	89 e5                	mov    %esp,%ebp
+  8006d9:	83 ec 18             	sub    $0x18,%esp
+  8006dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006df:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006e2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006e5:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006e9:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006ec:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006f3:	85 c0                	test   %eax,%eax
+  8006f5:	74 26                	je     80071d <vsnprintf+0x47>
+  8006f7:	85 d2                	test   %edx,%edx
+  8006f9:	7e 22                	jle    80071d <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006fb:	ff 75 14             	push   0x14(%ebp)
+  8006fe:	ff 75 10             	push   0x10(%ebp)
+  800701:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800704:	50                   	push   %eax
+  800705:	68 4f 02 80 00       	push   $0x80024f
+  80070a:	e8 7a fb ff ff       	call   800289 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80070f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800712:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800715:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800718:	83 c4 10             	add    $0x10,%esp
+}
+  80071b:	c9                   	leave
+  80071c:	c3                   	ret
+		return -E_INVAL;
+  80071d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800722:	eb f7                	jmp    80071b <vsnprintf+0x45>
+
+00800724 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800724:	55                   	push   %ebp
+  800725:	89 e5                	mov    %esp,%ebp
+  800727:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  80072a:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  80072d:	50                   	push   %eax
+  80072e:	ff 75 10             	push   0x10(%ebp)
+  800731:	ff 75 0c             	push   0xc(%ebp)
+  800734:	ff 75 08             	push   0x8(%ebp)
+  800737:	e8 9a ff ff ff       	call   8006d6 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  80073c:	c9                   	leave
+  80073d:	c3                   	ret
+
+0080073e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80073e:	55                   	push   %ebp
+  80073f:	89 e5                	mov    %esp,%ebp
+  800741:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+  800749:	eb 03                	jmp    80074e <strlen+0x10>
+		n++;
+  80074b:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  80074e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800752:	75 f7                	jne    80074b <strlen+0xd>
+	return n;
+}
+  800754:	5d                   	pop    %ebp
+  800755:	c3                   	ret
+
+00800756 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800756:	55                   	push   %ebp
+  800757:	89 e5                	mov    %esp,%ebp
+  800759:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80075c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80075f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800764:	eb 03                	jmp    800769 <strnlen+0x13>
+		n++;
+  800766:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800769:	39 d0                	cmp    %edx,%eax
+  80076b:	74 08                	je     800775 <strnlen+0x1f>
+  80076d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800771:	75 f3                	jne    800766 <strnlen+0x10>
+  800773:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800775:	89 d0                	mov    %edx,%eax
+  800777:	5d                   	pop    %ebp
+  800778:	c3                   	ret
+
+00800779 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800779:	55                   	push   %ebp
+  80077a:	89 e5                	mov    %esp,%ebp
+  80077c:	53                   	push   %ebx
+  80077d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800780:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800783:	b8 00 00 00 00       	mov    $0x0,%eax
+  800788:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80078c:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80078f:	83 c0 01             	add    $0x1,%eax
+  800792:	84 d2                	test   %dl,%dl
+  800794:	75 f2                	jne    800788 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800796:	89 c8                	mov    %ecx,%eax
+  800798:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80079b:	c9                   	leave
+  80079c:	c3                   	ret
+
+0080079d <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80079d:	55                   	push   %ebp
+  80079e:	89 e5                	mov    %esp,%ebp
+  8007a0:	53                   	push   %ebx
+  8007a1:	83 ec 10             	sub    $0x10,%esp
+  8007a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007a7:	53                   	push   %ebx
+  8007a8:	e8 91 ff ff ff       	call   80073e <strlen>
+  8007ad:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007b0:	ff 75 0c             	push   0xc(%ebp)
+  8007b3:	01 d8                	add    %ebx,%eax
+  8007b5:	50                   	push   %eax
+  8007b6:	e8 be ff ff ff       	call   800779 <strcpy>
+	return dst;
+}
+  8007bb:	89 d8                	mov    %ebx,%eax
+  8007bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c0:	c9                   	leave
+  8007c1:	c3                   	ret
+
+008007c2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007c2:	55                   	push   %ebp
+  8007c3:	89 e5                	mov    %esp,%ebp
+  8007c5:	56                   	push   %esi
+  8007c6:	53                   	push   %ebx
+  8007c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007cd:	89 f3                	mov    %esi,%ebx
+  8007cf:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007d2:	89 f0                	mov    %esi,%eax
+  8007d4:	eb 0f                	jmp    8007e5 <strncpy+0x23>
+		*dst++ = *src;
+  8007d6:	83 c0 01             	add    $0x1,%eax
+  8007d9:	0f b6 0a             	movzbl (%edx),%ecx
+  8007dc:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007df:	80 f9 01             	cmp    $0x1,%cl
+  8007e2:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007e5:	39 d8                	cmp    %ebx,%eax
+  8007e7:	75 ed                	jne    8007d6 <strncpy+0x14>
+	}
+	return ret;
+}
+  8007e9:	89 f0                	mov    %esi,%eax
+  8007eb:	5b                   	pop    %ebx
+  8007ec:	5e                   	pop    %esi
+  8007ed:	5d                   	pop    %ebp
+  8007ee:	c3                   	ret
+
+008007ef <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007ef:	55                   	push   %ebp
+  8007f0:	89 e5                	mov    %esp,%ebp
+  8007f2:	56                   	push   %esi
+  8007f3:	53                   	push   %ebx
+  8007f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007fa:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8007fd:	89 f0                	mov    %esi,%eax
+  8007ff:	85 d2                	test   %edx,%edx
+  800801:	74 21                	je     800824 <strlcpy+0x35>
+  800803:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800807:	89 f2                	mov    %esi,%edx
+  800809:	eb 09                	jmp    800814 <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  80080b:	83 c1 01             	add    $0x1,%ecx
+  80080e:	83 c2 01             	add    $0x1,%edx
+  800811:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800814:	39 c2                	cmp    %eax,%edx
+  800816:	74 09                	je     800821 <strlcpy+0x32>
+  800818:	0f b6 19             	movzbl (%ecx),%ebx
+  80081b:	84 db                	test   %bl,%bl
+  80081d:	75 ec                	jne    80080b <strlcpy+0x1c>
+  80081f:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800821:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800824:	29 f0                	sub    %esi,%eax
+}
+  800826:	5b                   	pop    %ebx
+  800827:	5e                   	pop    %esi
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+
+0080082a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80082a:	55                   	push   %ebp
+  80082b:	89 e5                	mov    %esp,%ebp
+  80082d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800830:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800833:	eb 06                	jmp    80083b <strcmp+0x11>
+		p++, q++;
+  800835:	83 c1 01             	add    $0x1,%ecx
+  800838:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  80083b:	0f b6 01             	movzbl (%ecx),%eax
+  80083e:	84 c0                	test   %al,%al
+  800840:	74 04                	je     800846 <strcmp+0x1c>
+  800842:	3a 02                	cmp    (%edx),%al
+  800844:	74 ef                	je     800835 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800846:	0f b6 c0             	movzbl %al,%eax
+  800849:	0f b6 12             	movzbl (%edx),%edx
+  80084c:	29 d0                	sub    %edx,%eax
+}
+  80084e:	5d                   	pop    %ebp
+  80084f:	c3                   	ret
+
+00800850 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800850:	55                   	push   %ebp
+  800851:	89 e5                	mov    %esp,%ebp
+  800853:	53                   	push   %ebx
+  800854:	8b 45 08             	mov    0x8(%ebp),%eax
+  800857:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80085a:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  80085d:	eb 09                	jmp    800868 <strncmp+0x18>
+		n--, p++, q++;
+  80085f:	83 ea 01             	sub    $0x1,%edx
+  800862:	83 c0 01             	add    $0x1,%eax
+  800865:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800868:	85 d2                	test   %edx,%edx
+  80086a:	74 18                	je     800884 <strncmp+0x34>
+  80086c:	0f b6 18             	movzbl (%eax),%ebx
+  80086f:	84 db                	test   %bl,%bl
+  800871:	74 04                	je     800877 <strncmp+0x27>
+  800873:	3a 19                	cmp    (%ecx),%bl
+  800875:	74 e8                	je     80085f <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800877:	0f b6 00             	movzbl (%eax),%eax
+  80087a:	0f b6 11             	movzbl (%ecx),%edx
+  80087d:	29 d0                	sub    %edx,%eax
+}
+  80087f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800882:	c9                   	leave
+  800883:	c3                   	ret
+		return 0;
+  800884:	b8 00 00 00 00       	mov    $0x0,%eax
+  800889:	eb f4                	jmp    80087f <strncmp+0x2f>
+
+0080088b <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80088b:	55                   	push   %ebp
+  80088c:	89 e5                	mov    %esp,%ebp
+  80088e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800891:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800895:	eb 03                	jmp    80089a <strchr+0xf>
+  800897:	83 c0 01             	add    $0x1,%eax
+  80089a:	0f b6 10             	movzbl (%eax),%edx
+  80089d:	84 d2                	test   %dl,%dl
+  80089f:	74 06                	je     8008a7 <strchr+0x1c>
+		if (*s == c)
+  8008a1:	38 ca                	cmp    %cl,%dl
+  8008a3:	75 f2                	jne    800897 <strchr+0xc>
+  8008a5:	eb 05                	jmp    8008ac <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008ac:	5d                   	pop    %ebp
+  8008ad:	c3                   	ret
+
+008008ae <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008ae:	55                   	push   %ebp
+  8008af:	89 e5                	mov    %esp,%ebp
+  8008b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008b8:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008bb:	38 ca                	cmp    %cl,%dl
+  8008bd:	74 09                	je     8008c8 <strfind+0x1a>
+  8008bf:	84 d2                	test   %dl,%dl
+  8008c1:	74 05                	je     8008c8 <strfind+0x1a>
+	for (; *s; s++)
+  8008c3:	83 c0 01             	add    $0x1,%eax
+  8008c6:	eb f0                	jmp    8008b8 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008c8:	5d                   	pop    %ebp
+  8008c9:	c3                   	ret
+
+008008ca <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	57                   	push   %edi
+  8008ce:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008d1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008d4:	85 c9                	test   %ecx,%ecx
+  8008d6:	74 20                	je     8008f8 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008d8:	89 f8                	mov    %edi,%eax
+  8008da:	09 c8                	or     %ecx,%eax
+  8008dc:	a8 03                	test   $0x3,%al
+  8008de:	75 12                	jne    8008f2 <memset+0x28>
+		c &= 0xFF;
+  8008e0:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008e4:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008ea:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008ed:	fc                   	cld
+  8008ee:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008f0:	eb 06                	jmp    8008f8 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008f5:	fc                   	cld
+  8008f6:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008f8:	89 f8                	mov    %edi,%eax
+  8008fa:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008fd:	c9                   	leave
+  8008fe:	c3                   	ret
+
+008008ff <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008ff:	55                   	push   %ebp
+  800900:	89 e5                	mov    %esp,%ebp
+  800902:	57                   	push   %edi
+  800903:	56                   	push   %esi
+  800904:	8b 45 08             	mov    0x8(%ebp),%eax
+  800907:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80090a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  80090d:	39 c6                	cmp    %eax,%esi
+  80090f:	73 32                	jae    800943 <memmove+0x44>
+  800911:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800914:	39 d0                	cmp    %edx,%eax
+  800916:	73 2b                	jae    800943 <memmove+0x44>
+		s += n;
+		d += n;
+  800918:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80091b:	89 d6                	mov    %edx,%esi
+  80091d:	09 fe                	or     %edi,%esi
+  80091f:	09 ce                	or     %ecx,%esi
+  800921:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800927:	75 0e                	jne    800937 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800929:	83 ef 04             	sub    $0x4,%edi
+  80092c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80092f:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800932:	fd                   	std
+  800933:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800935:	eb 09                	jmp    800940 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800937:	83 ef 01             	sub    $0x1,%edi
+  80093a:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  80093d:	fd                   	std
+  80093e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800940:	fc                   	cld
+  800941:	eb 1a                	jmp    80095d <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800943:	89 f2                	mov    %esi,%edx
+  800945:	09 c2                	or     %eax,%edx
+  800947:	09 ca                	or     %ecx,%edx
+  800949:	f6 c2 03             	test   $0x3,%dl
+  80094c:	75 0a                	jne    800958 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80094e:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800951:	89 c7                	mov    %eax,%edi
+  800953:	fc                   	cld
+  800954:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800956:	eb 05                	jmp    80095d <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800958:	89 c7                	mov    %eax,%edi
+  80095a:	fc                   	cld
+  80095b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  80095d:	5e                   	pop    %esi
+  80095e:	5f                   	pop    %edi
+  80095f:	5d                   	pop    %ebp
+  800960:	c3                   	ret
+
+00800961 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800967:	ff 75 10             	push   0x10(%ebp)
+  80096a:	ff 75 0c             	push   0xc(%ebp)
+  80096d:	ff 75 08             	push   0x8(%ebp)
+  800970:	e8 8a ff ff ff       	call   8008ff <memmove>
+}
+  800975:	c9                   	leave
+  800976:	c3                   	ret
+
+00800977 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800977:	55                   	push   %ebp
+  800978:	89 e5                	mov    %esp,%ebp
+  80097a:	56                   	push   %esi
+  80097b:	53                   	push   %ebx
+  80097c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097f:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800982:	89 c6                	mov    %eax,%esi
+  800984:	03 75 10             	add    0x10(%ebp),%esi
+  800987:	eb 06                	jmp    80098f <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800989:	83 c0 01             	add    $0x1,%eax
+  80098c:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80098f:	39 f0                	cmp    %esi,%eax
+  800991:	74 14                	je     8009a7 <memcmp+0x30>
+		if (*s1 != *s2)
+  800993:	0f b6 08             	movzbl (%eax),%ecx
+  800996:	0f b6 1a             	movzbl (%edx),%ebx
+  800999:	38 d9                	cmp    %bl,%cl
+  80099b:	74 ec                	je     800989 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  80099d:	0f b6 c1             	movzbl %cl,%eax
+  8009a0:	0f b6 db             	movzbl %bl,%ebx
+  8009a3:	29 d8                	sub    %ebx,%eax
+  8009a5:	eb 05                	jmp    8009ac <memcmp+0x35>
+	}
+
+	return 0;
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009ac:	5b                   	pop    %ebx
+  8009ad:	5e                   	pop    %esi
+  8009ae:	5d                   	pop    %ebp
+  8009af:	c3                   	ret
+
+008009b0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009b0:	55                   	push   %ebp
+  8009b1:	89 e5                	mov    %esp,%ebp
+  8009b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009b9:	89 c2                	mov    %eax,%edx
+  8009bb:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009be:	eb 03                	jmp    8009c3 <memfind+0x13>
+  8009c0:	83 c0 01             	add    $0x1,%eax
+  8009c3:	39 d0                	cmp    %edx,%eax
+  8009c5:	73 04                	jae    8009cb <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009c7:	38 08                	cmp    %cl,(%eax)
+  8009c9:	75 f5                	jne    8009c0 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009cb:	5d                   	pop    %ebp
+  8009cc:	c3                   	ret
+
+008009cd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009cd:	55                   	push   %ebp
+  8009ce:	89 e5                	mov    %esp,%ebp
+  8009d0:	57                   	push   %edi
+  8009d1:	56                   	push   %esi
+  8009d2:	53                   	push   %ebx
+  8009d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009d9:	eb 03                	jmp    8009de <strtol+0x11>
+		s++;
+  8009db:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009de:	0f b6 02             	movzbl (%edx),%eax
+  8009e1:	3c 20                	cmp    $0x20,%al
+  8009e3:	74 f6                	je     8009db <strtol+0xe>
+  8009e5:	3c 09                	cmp    $0x9,%al
+  8009e7:	74 f2                	je     8009db <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009e9:	3c 2b                	cmp    $0x2b,%al
+  8009eb:	74 2a                	je     800a17 <strtol+0x4a>
+	int neg = 0;
+  8009ed:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009f2:	3c 2d                	cmp    $0x2d,%al
+  8009f4:	74 2b                	je     800a21 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009f6:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009fc:	75 0f                	jne    800a0d <strtol+0x40>
+  8009fe:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a01:	74 28                	je     800a2b <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a03:	85 db                	test   %ebx,%ebx
+  800a05:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a0a:	0f 44 d8             	cmove  %eax,%ebx
+  800a0d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a12:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a15:	eb 46                	jmp    800a5d <strtol+0x90>
+		s++;
+  800a17:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a1f:	eb d5                	jmp    8009f6 <strtol+0x29>
+		s++, neg = 1;
+  800a21:	83 c2 01             	add    $0x1,%edx
+  800a24:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a29:	eb cb                	jmp    8009f6 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a2b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a2f:	74 0e                	je     800a3f <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a31:	85 db                	test   %ebx,%ebx
+  800a33:	75 d8                	jne    800a0d <strtol+0x40>
+		s++, base = 8;
+  800a35:	83 c2 01             	add    $0x1,%edx
+  800a38:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a3d:	eb ce                	jmp    800a0d <strtol+0x40>
+		s += 2, base = 16;
+  800a3f:	83 c2 02             	add    $0x2,%edx
+  800a42:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a47:	eb c4                	jmp    800a0d <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a49:	0f be c0             	movsbl %al,%eax
+  800a4c:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a4f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a52:	7d 3a                	jge    800a8e <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a54:	83 c2 01             	add    $0x1,%edx
+  800a57:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a5b:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a5d:	0f b6 02             	movzbl (%edx),%eax
+  800a60:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a63:	89 f3                	mov    %esi,%ebx
+  800a65:	80 fb 09             	cmp    $0x9,%bl
+  800a68:	76 df                	jbe    800a49 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a6a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a6d:	89 f3                	mov    %esi,%ebx
+  800a6f:	80 fb 19             	cmp    $0x19,%bl
+  800a72:	77 08                	ja     800a7c <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a74:	0f be c0             	movsbl %al,%eax
+  800a77:	83 e8 57             	sub    $0x57,%eax
+  800a7a:	eb d3                	jmp    800a4f <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a7c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a7f:	89 f3                	mov    %esi,%ebx
+  800a81:	80 fb 19             	cmp    $0x19,%bl
+  800a84:	77 08                	ja     800a8e <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a86:	0f be c0             	movsbl %al,%eax
+  800a89:	83 e8 37             	sub    $0x37,%eax
+  800a8c:	eb c1                	jmp    800a4f <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a8e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a92:	74 05                	je     800a99 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a97:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800a99:	89 c8                	mov    %ecx,%eax
+  800a9b:	f7 d8                	neg    %eax
+  800a9d:	85 ff                	test   %edi,%edi
+  800a9f:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aa2:	89 c8                	mov    %ecx,%eax
+  800aa4:	5b                   	pop    %ebx
+  800aa5:	5e                   	pop    %esi
+  800aa6:	5f                   	pop    %edi
+  800aa7:	5d                   	pop    %ebp
+  800aa8:	c3                   	ret
+
+00800aa9 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800aa9:	55                   	push   %ebp
+  800aaa:	89 e5                	mov    %esp,%ebp
+  800aac:	57                   	push   %edi
+  800aad:	56                   	push   %esi
+  800aae:	53                   	push   %ebx
+  800aaf:	83 ec 0c             	sub    $0xc,%esp
+  800ab2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800ab5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ab8:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800abb:	85 ff                	test   %edi,%edi
+  800abd:	74 16                	je     800ad5 <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800abf:	83 ec 04             	sub    $0x4,%esp
+  800ac2:	56                   	push   %esi
+  800ac3:	6a 00                	push   $0x0
+  800ac5:	53                   	push   %ebx
+  800ac6:	e8 02 ff ff ff       	call   8009cd <strtol>
+  800acb:	89 07                	mov    %eax,(%edi)
+  800acd:	83 c4 10             	add    $0x10,%esp
+  800ad0:	eb 03                	jmp    800ad5 <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800ad2:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800ad5:	0f b6 03             	movzbl (%ebx),%eax
+  800ad8:	3c 20                	cmp    $0x20,%al
+  800ada:	74 f6                	je     800ad2 <strisl+0x29>
+  800adc:	3c 09                	cmp    $0x9,%al
+  800ade:	74 f2                	je     800ad2 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800ae0:	3c 2b                	cmp    $0x2b,%al
+  800ae2:	74 23                	je     800b07 <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800ae4:	3c 2d                	cmp    $0x2d,%al
+  800ae6:	0f 94 c0             	sete   %al
+  800ae9:	0f b6 c0             	movzbl %al,%eax
+  800aec:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aee:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800af4:	75 41                	jne    800b37 <strisl+0x8e>
+  800af6:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800af9:	74 11                	je     800b0c <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800afb:	85 f6                	test   %esi,%esi
+  800afd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b02:	0f 44 f0             	cmove  %eax,%esi
+  800b05:	eb 30                	jmp    800b37 <strisl+0x8e>
+		s++;
+  800b07:	83 c3 01             	add    $0x1,%ebx
+  800b0a:	eb e2                	jmp    800aee <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b0c:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800b10:	74 0e                	je     800b20 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800b12:	85 f6                	test   %esi,%esi
+  800b14:	75 21                	jne    800b37 <strisl+0x8e>
+		s++, base = 8;
+  800b16:	83 c3 01             	add    $0x1,%ebx
+  800b19:	be 08 00 00 00       	mov    $0x8,%esi
+  800b1e:	eb 17                	jmp    800b37 <strisl+0x8e>
+		s += 2, base = 16;
+  800b20:	83 c3 02             	add    $0x2,%ebx
+  800b23:	be 10 00 00 00       	mov    $0x10,%esi
+  800b28:	eb 0d                	jmp    800b37 <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b2a:	0f be c0             	movsbl %al,%eax
+  800b2d:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800b30:	39 f0                	cmp    %esi,%eax
+  800b32:	7d 38                	jge    800b6c <strisl+0xc3>
+			return 0;
+		s++;
+  800b34:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800b37:	0f b6 03             	movzbl (%ebx),%eax
+  800b3a:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800b3d:	80 fa 09             	cmp    $0x9,%dl
+  800b40:	76 e8                	jbe    800b2a <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800b42:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800b45:	80 fa 19             	cmp    $0x19,%dl
+  800b48:	77 08                	ja     800b52 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800b4a:	0f be c0             	movsbl %al,%eax
+  800b4d:	83 e8 57             	sub    $0x57,%eax
+  800b50:	eb de                	jmp    800b30 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b52:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800b55:	80 fa 19             	cmp    $0x19,%dl
+  800b58:	77 08                	ja     800b62 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800b5a:	0f be c0             	movsbl %al,%eax
+  800b5d:	83 e8 37             	sub    $0x37,%eax
+  800b60:	eb ce                	jmp    800b30 <strisl+0x87>
+		else if (!*s)
+  800b62:	84 c0                	test   %al,%al
+  800b64:	0f 94 c0             	sete   %al
+  800b67:	0f b6 c0             	movzbl %al,%eax
+  800b6a:	eb 05                	jmp    800b71 <strisl+0xc8>
+			return 0;
+  800b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800b71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b74:	5b                   	pop    %ebx
+  800b75:	5e                   	pop    %esi
+  800b76:	5f                   	pop    %edi
+  800b77:	5d                   	pop    %ebp
+  800b78:	c3                   	ret
+
+00800b79 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800b79:	55                   	push   %ebp
+  800b7a:	89 e5                	mov    %esp,%ebp
+  800b7c:	83 ec 10             	sub    $0x10,%esp
+  800b7f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b82:	89 c8                	mov    %ecx,%eax
+  800b84:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800b89:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800b8c:	eb 0b                	jmp    800b99 <touch_mem+0x20>
+		c = *(char *)page;
+  800b8e:	0f b6 10             	movzbl (%eax),%edx
+  800b91:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800b94:	05 00 10 00 00       	add    $0x1000,%eax
+  800b99:	39 c8                	cmp    %ecx,%eax
+  800b9b:	72 f1                	jb     800b8e <touch_mem+0x15>
+}
+  800b9d:	c9                   	leave
+  800b9e:	c3                   	ret
+
+00800b9f <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b9f:	55                   	push   %ebp
+  800ba0:	89 e5                	mov    %esp,%ebp
+  800ba2:	57                   	push   %edi
+  800ba3:	56                   	push   %esi
+  800ba4:	53                   	push   %ebx
+	touch_mem(s, len);
+  800ba5:	ff 75 0c             	push   0xc(%ebp)
+  800ba8:	ff 75 08             	push   0x8(%ebp)
+  800bab:	e8 c9 ff ff ff       	call   800b79 <touch_mem>
+	asm volatile("int %1\n"
+  800bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bbb:	89 c3                	mov    %eax,%ebx
+  800bbd:	89 c7                	mov    %eax,%edi
+  800bbf:	89 c6                	mov    %eax,%esi
+  800bc1:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bc3:	83 c4 08             	add    $0x8,%esp
+  800bc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc9:	5b                   	pop    %ebx
+  800bca:	5e                   	pop    %esi
+  800bcb:	5f                   	pop    %edi
+  800bcc:	5d                   	pop    %ebp
+  800bcd:	c3                   	ret
+
+00800bce <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	57                   	push   %edi
+  800bd2:	56                   	push   %esi
+  800bd3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bde:	89 d1                	mov    %edx,%ecx
+  800be0:	89 d3                	mov    %edx,%ebx
+  800be2:	89 d7                	mov    %edx,%edi
+  800be4:	89 d6                	mov    %edx,%esi
+  800be6:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800be8:	5b                   	pop    %ebx
+  800be9:	5e                   	pop    %esi
+  800bea:	5f                   	pop    %edi
+  800beb:	5d                   	pop    %ebp
+  800bec:	c3                   	ret
+
+00800bed <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	57                   	push   %edi
+  800bf1:	56                   	push   %esi
+  800bf2:	53                   	push   %ebx
+  800bf3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800bf6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfe:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c03:	89 cb                	mov    %ecx,%ebx
+  800c05:	89 cf                	mov    %ecx,%edi
+  800c07:	89 ce                	mov    %ecx,%esi
+  800c09:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c0b:	85 c0                	test   %eax,%eax
+  800c0d:	7f 08                	jg     800c17 <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c12:	5b                   	pop    %ebx
+  800c13:	5e                   	pop    %esi
+  800c14:	5f                   	pop    %edi
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c17:	83 ec 0c             	sub    $0xc,%esp
+  800c1a:	50                   	push   %eax
+  800c1b:	6a 03                	push   $0x3
+  800c1d:	68 cb 2a 80 00       	push   $0x802acb
+  800c22:	6a 23                	push   $0x23
+  800c24:	68 e8 2a 80 00       	push   $0x802ae8
+  800c29:	e8 b9 15 00 00       	call   8021e7 <_panic>
+
+00800c2e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c2e:	55                   	push   %ebp
+  800c2f:	89 e5                	mov    %esp,%ebp
+  800c31:	57                   	push   %edi
+  800c32:	56                   	push   %esi
+  800c33:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c39:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c3e:	89 d1                	mov    %edx,%ecx
+  800c40:	89 d3                	mov    %edx,%ebx
+  800c42:	89 d7                	mov    %edx,%edi
+  800c44:	89 d6                	mov    %edx,%esi
+  800c46:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c48:	5b                   	pop    %ebx
+  800c49:	5e                   	pop    %esi
+  800c4a:	5f                   	pop    %edi
+  800c4b:	5d                   	pop    %ebp
+  800c4c:	c3                   	ret
+
+00800c4d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c4d:	55                   	push   %ebp
+  800c4e:	89 e5                	mov    %esp,%ebp
+  800c50:	57                   	push   %edi
+  800c51:	56                   	push   %esi
+  800c52:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c58:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c5d:	89 d1                	mov    %edx,%ecx
+  800c5f:	89 d3                	mov    %edx,%ebx
+  800c61:	89 d7                	mov    %edx,%edi
+  800c63:	89 d6                	mov    %edx,%esi
+  800c65:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c67:	5b                   	pop    %ebx
+  800c68:	5e                   	pop    %esi
+  800c69:	5f                   	pop    %edi
+  800c6a:	5d                   	pop    %ebp
+  800c6b:	c3                   	ret
+
+00800c6c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c6c:	55                   	push   %ebp
+  800c6d:	89 e5                	mov    %esp,%ebp
+  800c6f:	57                   	push   %edi
+  800c70:	56                   	push   %esi
+  800c71:	53                   	push   %ebx
+  800c72:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c75:	be 00 00 00 00       	mov    $0x0,%esi
+  800c7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c80:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c88:	89 f7                	mov    %esi,%edi
+  800c8a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c8c:	85 c0                	test   %eax,%eax
+  800c8e:	7f 08                	jg     800c98 <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800c90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c93:	5b                   	pop    %ebx
+  800c94:	5e                   	pop    %esi
+  800c95:	5f                   	pop    %edi
+  800c96:	5d                   	pop    %ebp
+  800c97:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c98:	83 ec 0c             	sub    $0xc,%esp
+  800c9b:	50                   	push   %eax
+  800c9c:	6a 04                	push   $0x4
+  800c9e:	68 cb 2a 80 00       	push   $0x802acb
+  800ca3:	6a 23                	push   $0x23
+  800ca5:	68 e8 2a 80 00       	push   $0x802ae8
+  800caa:	e8 38 15 00 00       	call   8021e7 <_panic>
+
+00800caf <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800caf:	55                   	push   %ebp
+  800cb0:	89 e5                	mov    %esp,%ebp
+  800cb2:	57                   	push   %edi
+  800cb3:	56                   	push   %esi
+  800cb4:	53                   	push   %ebx
+  800cb5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbe:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cc9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ccc:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800cce:	85 c0                	test   %eax,%eax
+  800cd0:	7f 08                	jg     800cda <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800cd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd5:	5b                   	pop    %ebx
+  800cd6:	5e                   	pop    %esi
+  800cd7:	5f                   	pop    %edi
+  800cd8:	5d                   	pop    %ebp
+  800cd9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cda:	83 ec 0c             	sub    $0xc,%esp
+  800cdd:	50                   	push   %eax
+  800cde:	6a 05                	push   $0x5
+  800ce0:	68 cb 2a 80 00       	push   $0x802acb
+  800ce5:	6a 23                	push   $0x23
+  800ce7:	68 e8 2a 80 00       	push   $0x802ae8
+  800cec:	e8 f6 14 00 00       	call   8021e7 <_panic>
+
+00800cf1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	57                   	push   %edi
+  800cf5:	56                   	push   %esi
+  800cf6:	53                   	push   %ebx
+  800cf7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800cfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d05:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d0a:	89 df                	mov    %ebx,%edi
+  800d0c:	89 de                	mov    %ebx,%esi
+  800d0e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d10:	85 c0                	test   %eax,%eax
+  800d12:	7f 08                	jg     800d1c <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d17:	5b                   	pop    %ebx
+  800d18:	5e                   	pop    %esi
+  800d19:	5f                   	pop    %edi
+  800d1a:	5d                   	pop    %ebp
+  800d1b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d1c:	83 ec 0c             	sub    $0xc,%esp
+  800d1f:	50                   	push   %eax
+  800d20:	6a 06                	push   $0x6
+  800d22:	68 cb 2a 80 00       	push   $0x802acb
+  800d27:	6a 23                	push   $0x23
+  800d29:	68 e8 2a 80 00       	push   $0x802ae8
+  800d2e:	e8 b4 14 00 00       	call   8021e7 <_panic>
+
+00800d33 <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800d33:	55                   	push   %ebp
+  800d34:	89 e5                	mov    %esp,%ebp
+  800d36:	57                   	push   %edi
+  800d37:	56                   	push   %esi
+  800d38:	53                   	push   %ebx
+  800d39:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d47:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d4c:	89 df                	mov    %ebx,%edi
+  800d4e:	89 de                	mov    %ebx,%esi
+  800d50:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d52:	85 c0                	test   %eax,%eax
+  800d54:	7f 08                	jg     800d5e <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800d56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d5e:	83 ec 0c             	sub    $0xc,%esp
+  800d61:	50                   	push   %eax
+  800d62:	6a 18                	push   $0x18
+  800d64:	68 cb 2a 80 00       	push   $0x802acb
+  800d69:	6a 23                	push   $0x23
+  800d6b:	68 e8 2a 80 00       	push   $0x802ae8
+  800d70:	e8 72 14 00 00       	call   8021e7 <_panic>
+
+00800d75 <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d7b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d86:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8e:	89 f7                	mov    %esi,%edi
+  800d90:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800d92:	5b                   	pop    %ebx
+  800d93:	5e                   	pop    %esi
+  800d94:	5f                   	pop    %edi
+  800d95:	5d                   	pop    %ebp
+  800d96:	c3                   	ret
+
+00800d97 <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800d97:	55                   	push   %ebp
+  800d98:	89 e5                	mov    %esp,%ebp
+  800d9a:	57                   	push   %edi
+  800d9b:	56                   	push   %esi
+  800d9c:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800da8:	be 00 00 00 00       	mov    $0x0,%esi
+  800dad:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db3:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800db5:	5b                   	pop    %ebx
+  800db6:	5e                   	pop    %esi
+  800db7:	5f                   	pop    %edi
+  800db8:	5d                   	pop    %ebp
+  800db9:	c3                   	ret
+
+00800dba <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800dba:	55                   	push   %ebp
+  800dbb:	89 e5                	mov    %esp,%ebp
+  800dbd:	57                   	push   %edi
+  800dbe:	56                   	push   %esi
+  800dbf:	53                   	push   %ebx
+  800dc0:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800dc3:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800dc6:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800dcc:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800dcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd5:	b8 10 00 00 00       	mov    $0x10,%eax
+  800dda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ddd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800de0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800de2:	85 c0                	test   %eax,%eax
+  800de4:	7f 08                	jg     800dee <sys_page_map_range+0x34>
+}
+  800de6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de9:	5b                   	pop    %ebx
+  800dea:	5e                   	pop    %esi
+  800deb:	5f                   	pop    %edi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+  800df1:	50                   	push   %eax
+  800df2:	6a 10                	push   $0x10
+  800df4:	68 cb 2a 80 00       	push   $0x802acb
+  800df9:	6a 23                	push   $0x23
+  800dfb:	68 e8 2a 80 00       	push   $0x802ae8
+  800e00:	e8 e2 13 00 00       	call   8021e7 <_panic>
+
+00800e05 <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	56                   	push   %esi
+  800e0a:	53                   	push   %ebx
+  800e0b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e0e:	be 00 00 00 00       	mov    $0x0,%esi
+  800e13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e19:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e21:	89 f7                	mov    %esi,%edi
+  800e23:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e25:	85 c0                	test   %eax,%eax
+  800e27:	7f 08                	jg     800e31 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e31:	83 ec 0c             	sub    $0xc,%esp
+  800e34:	50                   	push   %eax
+  800e35:	6a 11                	push   $0x11
+  800e37:	68 cb 2a 80 00       	push   $0x802acb
+  800e3c:	6a 23                	push   $0x23
+  800e3e:	68 e8 2a 80 00       	push   $0x802ae8
+  800e43:	e8 9f 13 00 00       	call   8021e7 <_panic>
+
+00800e48 <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800e48:	55                   	push   %ebp
+  800e49:	89 e5                	mov    %esp,%ebp
+  800e4b:	57                   	push   %edi
+  800e4c:	56                   	push   %esi
+  800e4d:	53                   	push   %ebx
+  800e4e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e51:	be 00 00 00 00       	mov    $0x0,%esi
+  800e56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800e61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e64:	89 f7                	mov    %esi,%edi
+  800e66:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e68:	85 c0                	test   %eax,%eax
+  800e6a:	7f 08                	jg     800e74 <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6f:	5b                   	pop    %ebx
+  800e70:	5e                   	pop    %esi
+  800e71:	5f                   	pop    %edi
+  800e72:	5d                   	pop    %ebp
+  800e73:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+  800e77:	50                   	push   %eax
+  800e78:	6a 1b                	push   $0x1b
+  800e7a:	68 cb 2a 80 00       	push   $0x802acb
+  800e7f:	6a 23                	push   $0x23
+  800e81:	68 e8 2a 80 00       	push   $0x802ae8
+  800e86:	e8 5c 13 00 00       	call   8021e7 <_panic>
+
+00800e8b <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800e8b:	55                   	push   %ebp
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	57                   	push   %edi
+  800e8f:	56                   	push   %esi
+  800e90:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800e91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e96:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e9b:	89 d1                	mov    %edx,%ecx
+  800e9d:	89 d3                	mov    %edx,%ebx
+  800e9f:	89 d7                	mov    %edx,%edi
+  800ea1:	89 d6                	mov    %edx,%esi
+  800ea3:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+
+00800eaa <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	57                   	push   %edi
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+  800eb0:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebe:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ec3:	89 df                	mov    %ebx,%edi
+  800ec5:	89 de                	mov    %ebx,%esi
+  800ec7:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ec9:	85 c0                	test   %eax,%eax
+  800ecb:	7f 08                	jg     800ed5 <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ecd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed0:	5b                   	pop    %ebx
+  800ed1:	5e                   	pop    %esi
+  800ed2:	5f                   	pop    %edi
+  800ed3:	5d                   	pop    %ebp
+  800ed4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ed5:	83 ec 0c             	sub    $0xc,%esp
+  800ed8:	50                   	push   %eax
+  800ed9:	6a 08                	push   $0x8
+  800edb:	68 cb 2a 80 00       	push   $0x802acb
+  800ee0:	6a 23                	push   $0x23
+  800ee2:	68 e8 2a 80 00       	push   $0x802ae8
+  800ee7:	e8 fb 12 00 00       	call   8021e7 <_panic>
+
+00800eec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	57                   	push   %edi
+  800ef0:	56                   	push   %esi
+  800ef1:	53                   	push   %ebx
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  800ef5:	6a 44                	push   $0x44
+  800ef7:	ff 75 0c             	push   0xc(%ebp)
+  800efa:	e8 7a fc ff ff       	call   800b79 <touch_mem>
+	asm volatile("int %1\n"
+  800eff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f07:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f0c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0f:	89 df                	mov    %ebx,%edi
+  800f11:	89 de                	mov    %ebx,%esi
+  800f13:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f15:	83 c4 08             	add    $0x8,%esp
+  800f18:	85 c0                	test   %eax,%eax
+  800f1a:	7f 08                	jg     800f24 <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  800f1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1f:	5b                   	pop    %ebx
+  800f20:	5e                   	pop    %esi
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f24:	83 ec 0c             	sub    $0xc,%esp
+  800f27:	50                   	push   %eax
+  800f28:	6a 09                	push   $0x9
+  800f2a:	68 cb 2a 80 00       	push   $0x802acb
+  800f2f:	6a 23                	push   $0x23
+  800f31:	68 e8 2a 80 00       	push   $0x802ae8
+  800f36:	e8 ac 12 00 00       	call   8021e7 <_panic>
+
+00800f3b <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  800f41:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f44:	be 00 00 00 00       	mov    $0x0,%esi
+  800f49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  800f54:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f57:	89 f7                	mov    %esi,%edi
+  800f59:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f5b:	85 c0                	test   %eax,%eax
+  800f5d:	7f 08                	jg     800f67 <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  800f5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f62:	5b                   	pop    %ebx
+  800f63:	5e                   	pop    %esi
+  800f64:	5f                   	pop    %edi
+  800f65:	5d                   	pop    %ebp
+  800f66:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f67:	83 ec 0c             	sub    $0xc,%esp
+  800f6a:	50                   	push   %eax
+  800f6b:	6a 1a                	push   $0x1a
+  800f6d:	68 cb 2a 80 00       	push   $0x802acb
+  800f72:	6a 23                	push   $0x23
+  800f74:	68 e8 2a 80 00       	push   $0x802ae8
+  800f79:	e8 69 12 00 00       	call   8021e7 <_panic>
+
+00800f7e <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  800f7e:	55                   	push   %ebp
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	57                   	push   %edi
+  800f82:	56                   	push   %esi
+  800f83:	53                   	push   %ebx
+  800f84:	83 ec 0c             	sub    $0xc,%esp
+  800f87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  800f8a:	89 d8                	mov    %ebx,%eax
+  800f8c:	c1 e0 05             	shl    $0x5,%eax
+  800f8f:	50                   	push   %eax
+  800f90:	ff 75 0c             	push   0xc(%ebp)
+  800f93:	e8 e1 fb ff ff       	call   800b79 <touch_mem>
+	asm volatile("int %1\n"
+  800f98:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa0:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa8:	89 f7                	mov    %esi,%edi
+  800faa:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800fac:	83 c4 08             	add    $0x8,%esp
+  800faf:	85 c0                	test   %eax,%eax
+  800fb1:	7f 08                	jg     800fbb <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  800fb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb6:	5b                   	pop    %ebx
+  800fb7:	5e                   	pop    %esi
+  800fb8:	5f                   	pop    %edi
+  800fb9:	5d                   	pop    %ebp
+  800fba:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbb:	83 ec 0c             	sub    $0xc,%esp
+  800fbe:	50                   	push   %eax
+  800fbf:	6a 13                	push   $0x13
+  800fc1:	68 cb 2a 80 00       	push   $0x802acb
+  800fc6:	6a 23                	push   $0x23
+  800fc8:	68 e8 2a 80 00       	push   $0x802ae8
+  800fcd:	e8 15 12 00 00       	call   8021e7 <_panic>
+
+00800fd2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	57                   	push   %edi
+  800fd6:	56                   	push   %esi
+  800fd7:	53                   	push   %ebx
+  800fd8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800fdb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800feb:	89 df                	mov    %ebx,%edi
+  800fed:	89 de                	mov    %ebx,%esi
+  800fef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ff1:	85 c0                	test   %eax,%eax
+  800ff3:	7f 08                	jg     800ffd <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  800ff5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ffd:	83 ec 0c             	sub    $0xc,%esp
+  801000:	50                   	push   %eax
+  801001:	6a 0a                	push   $0xa
+  801003:	68 cb 2a 80 00       	push   $0x802acb
+  801008:	6a 23                	push   $0x23
+  80100a:	68 e8 2a 80 00       	push   $0x802ae8
+  80100f:	e8 d3 11 00 00       	call   8021e7 <_panic>
+
+00801014 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801014:	55                   	push   %ebp
+  801015:	89 e5                	mov    %esp,%ebp
+  801017:	57                   	push   %edi
+  801018:	56                   	push   %esi
+  801019:	53                   	push   %ebx
+  80101a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  80101d:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801023:	76 1d                	jbe    801042 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801030:	be 01 00 00 00       	mov    $0x1,%esi
+  801035:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801038:	cd 30                	int    $0x30
+}
+  80103a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103d:	5b                   	pop    %ebx
+  80103e:	5e                   	pop    %esi
+  80103f:	5f                   	pop    %edi
+  801040:	5d                   	pop    %ebp
+  801041:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801042:	68 00 10 00 00       	push   $0x1000
+  801047:	53                   	push   %ebx
+  801048:	e8 2c fb ff ff       	call   800b79 <touch_mem>
+  80104d:	83 c4 08             	add    $0x8,%esp
+  801050:	eb d3                	jmp    801025 <sys_ipc_send+0x11>
+
+00801052 <sys_ipc_send_pages>:
+{
+  801052:	55                   	push   %ebp
+  801053:	89 e5                	mov    %esp,%ebp
+  801055:	57                   	push   %edi
+  801056:	56                   	push   %esi
+  801057:	53                   	push   %ebx
+  801058:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80105b:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  80105e:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  801064:	76 18                	jbe    80107e <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801071:	8b 7d 18             	mov    0x18(%ebp),%edi
+  801074:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  801076:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  80107e:	89 f0                	mov    %esi,%eax
+  801080:	c1 e0 0c             	shl    $0xc,%eax
+  801083:	50                   	push   %eax
+  801084:	53                   	push   %ebx
+  801085:	e8 ef fa ff ff       	call   800b79 <touch_mem>
+  80108a:	83 c4 08             	add    $0x8,%esp
+  80108d:	eb d7                	jmp    801066 <sys_ipc_send_pages+0x14>
+
+0080108f <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	57                   	push   %edi
+  801093:	56                   	push   %esi
+  801094:	53                   	push   %ebx
+  801095:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801098:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8010a8:	89 df                	mov    %ebx,%edi
+  8010aa:	89 de                	mov    %ebx,%esi
+  8010ac:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010ae:	85 c0                	test   %eax,%eax
+  8010b0:	7f 08                	jg     8010ba <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8010b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b5:	5b                   	pop    %ebx
+  8010b6:	5e                   	pop    %esi
+  8010b7:	5f                   	pop    %edi
+  8010b8:	5d                   	pop    %ebp
+  8010b9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ba:	83 ec 0c             	sub    $0xc,%esp
+  8010bd:	50                   	push   %eax
+  8010be:	6a 0d                	push   $0xd
+  8010c0:	68 cb 2a 80 00       	push   $0x802acb
+  8010c5:	6a 23                	push   $0x23
+  8010c7:	68 e8 2a 80 00       	push   $0x802ae8
+  8010cc:	e8 16 11 00 00       	call   8021e7 <_panic>
+
+008010d1 <sys_ipc_recv>:
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  8010d7:	6a 01                	push   $0x1
+  8010d9:	ff 75 08             	push   0x8(%ebp)
+  8010dc:	e8 ae ff ff ff       	call   80108f <sys_ipc_recv_pages>
+}
+  8010e1:	c9                   	leave
+  8010e2:	c3                   	ret
+
+008010e3 <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ef:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  8010f2:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8010f8:	77 04                	ja     8010fe <sys_ipc_call+0x1b>
+  8010fa:	85 f6                	test   %esi,%esi
+  8010fc:	75 15                	jne    801113 <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  8010fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801101:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801104:	b8 14 00 00 00       	mov    $0x14,%eax
+  801109:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  80110b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110e:	5b                   	pop    %ebx
+  80110f:	5e                   	pop    %esi
+  801110:	5f                   	pop    %edi
+  801111:	5d                   	pop    %ebp
+  801112:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  801113:	89 f8                	mov    %edi,%eax
+  801115:	c1 e0 0c             	shl    $0xc,%eax
+  801118:	50                   	push   %eax
+  801119:	53                   	push   %ebx
+  80111a:	e8 5a fa ff ff       	call   800b79 <touch_mem>
+  80111f:	83 c4 08             	add    $0x8,%esp
+  801122:	eb da                	jmp    8010fe <sys_ipc_call+0x1b>
+
+00801124 <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  801127:	57                   	push   %edi
+  801128:	56                   	push   %esi
+  801129:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  80112a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801130:	b8 15 00 00 00       	mov    $0x15,%eax
+  801135:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801138:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80113b:	8b 75 18             	mov    0x18(%ebp),%esi
+  80113e:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801140:	5b                   	pop    %ebx
+  801141:	5e                   	pop    %esi
+  801142:	5f                   	pop    %edi
+  801143:	5d                   	pop    %ebp
+  801144:	c3                   	ret
+
+00801145 <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+  80114b:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  80114e:	6a 04                	push   $0x4
+  801150:	ff 75 08             	push   0x8(%ebp)
+  801153:	e8 21 fa ff ff       	call   800b79 <touch_mem>
+	asm volatile("int %1\n"
+  801158:	be 00 00 00 00       	mov    $0x0,%esi
+  80115d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801160:	b8 16 00 00 00       	mov    $0x16,%eax
+  801165:	8b 55 08             	mov    0x8(%ebp),%edx
+  801168:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80116b:	89 f7                	mov    %esi,%edi
+  80116d:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80116f:	83 c4 08             	add    $0x8,%esp
+  801172:	85 c0                	test   %eax,%eax
+  801174:	7f 08                	jg     80117e <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  801176:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801179:	5b                   	pop    %ebx
+  80117a:	5e                   	pop    %esi
+  80117b:	5f                   	pop    %edi
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80117e:	83 ec 0c             	sub    $0xc,%esp
+  801181:	50                   	push   %eax
+  801182:	6a 16                	push   $0x16
+  801184:	68 cb 2a 80 00       	push   $0x802acb
+  801189:	6a 23                	push   $0x23
+  80118b:	68 e8 2a 80 00       	push   $0x802ae8
+  801190:	e8 52 10 00 00       	call   8021e7 <_panic>
+
+00801195 <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  801195:	55                   	push   %ebp
+  801196:	89 e5                	mov    %esp,%ebp
+  801198:	57                   	push   %edi
+  801199:	56                   	push   %esi
+  80119a:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  80119b:	6a 04                	push   $0x4
+  80119d:	ff 75 08             	push   0x8(%ebp)
+  8011a0:	e8 d4 f9 ff ff       	call   800b79 <touch_mem>
+	asm volatile("int %1\n"
+  8011a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ad:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b5:	89 df                	mov    %ebx,%edi
+  8011b7:	89 de                	mov    %ebx,%esi
+  8011b9:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  8011bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011be:	5b                   	pop    %ebx
+  8011bf:	5e                   	pop    %esi
+  8011c0:	5f                   	pop    %edi
+  8011c1:	5d                   	pop    %ebp
+  8011c2:	c3                   	ret
+
+008011c3 <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  8011c3:	55                   	push   %ebp
+  8011c4:	89 e5                	mov    %esp,%ebp
+  8011c6:	57                   	push   %edi
+  8011c7:	56                   	push   %esi
+  8011c8:	53                   	push   %ebx
+  8011c9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011d9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8011de:	89 df                	mov    %ebx,%edi
+  8011e0:	89 de                	mov    %ebx,%esi
+  8011e2:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e4:	85 c0                	test   %eax,%eax
+  8011e6:	7f 08                	jg     8011f0 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  8011e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011eb:	5b                   	pop    %ebx
+  8011ec:	5e                   	pop    %esi
+  8011ed:	5f                   	pop    %edi
+  8011ee:	5d                   	pop    %ebp
+  8011ef:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f0:	83 ec 0c             	sub    $0xc,%esp
+  8011f3:	50                   	push   %eax
+  8011f4:	6a 0e                	push   $0xe
+  8011f6:	68 cb 2a 80 00       	push   $0x802acb
+  8011fb:	6a 23                	push   $0x23
+  8011fd:	68 e8 2a 80 00       	push   $0x802ae8
+  801202:	e8 e0 0f 00 00       	call   8021e7 <_panic>
+
+00801207 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801207:	55                   	push   %ebp
+  801208:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80120a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80120d:	05 00 00 00 30       	add    $0x30000000,%eax
+  801212:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+
+00801217 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801217:	55                   	push   %ebp
+  801218:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  80121a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80121d:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801222:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801227:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80122c:	5d                   	pop    %ebp
+  80122d:	c3                   	ret
+
+0080122e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801231:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  801236:	a8 01                	test   $0x1,%al
+  801238:	74 3c                	je     801276 <fd_alloc+0x48>
+  80123a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80123f:	89 c2                	mov    %eax,%edx
+  801241:	c1 ea 0c             	shr    $0xc,%edx
+  801244:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80124b:	89 c1                	mov    %eax,%ecx
+  80124d:	05 00 10 00 00       	add    $0x1000,%eax
+  801252:	f6 c2 01             	test   $0x1,%dl
+  801255:	74 13                	je     80126a <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  801257:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  80125c:	75 e1                	jne    80123f <fd_alloc+0x11>
+  80125e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801263:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  801268:	eb 05                	jmp    80126f <fd_alloc+0x41>
+			return 0;
+  80126a:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  80126f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801272:	89 0a                	mov    %ecx,(%edx)
+}
+  801274:	5d                   	pop    %ebp
+  801275:	c3                   	ret
+  801276:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  80127b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801280:	eb ed                	jmp    80126f <fd_alloc+0x41>
+
+00801282 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801282:	55                   	push   %ebp
+  801283:	89 e5                	mov    %esp,%ebp
+  801285:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801288:	83 f8 1f             	cmp    $0x1f,%eax
+  80128b:	77 30                	ja     8012bd <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80128d:	c1 e0 0c             	shl    $0xc,%eax
+  801290:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801295:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80129b:	f6 c2 01             	test   $0x1,%dl
+  80129e:	74 24                	je     8012c4 <fd_lookup+0x42>
+  8012a0:	89 c2                	mov    %eax,%edx
+  8012a2:	c1 ea 0c             	shr    $0xc,%edx
+  8012a5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012ac:	f6 c2 01             	test   $0x1,%dl
+  8012af:	74 1a                	je     8012cb <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8012b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012b4:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8012b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012bb:	5d                   	pop    %ebp
+  8012bc:	c3                   	ret
+		return -E_INVAL;
+  8012bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012c2:	eb f7                	jmp    8012bb <fd_lookup+0x39>
+		return -E_INVAL;
+  8012c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012c9:	eb f0                	jmp    8012bb <fd_lookup+0x39>
+  8012cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012d0:	eb e9                	jmp    8012bb <fd_lookup+0x39>
+
+008012d2 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012d2:	55                   	push   %ebp
+  8012d3:	89 e5                	mov    %esp,%ebp
+  8012d5:	53                   	push   %ebx
+  8012d6:	83 ec 04             	sub    $0x4,%esp
+  8012d9:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8012dc:	b8 74 2b 80 00       	mov    $0x802b74,%eax
+  8012e1:	8b 18                	mov    (%eax),%ebx
+  8012e3:	85 db                	test   %ebx,%ebx
+  8012e5:	74 0e                	je     8012f5 <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  8012e7:	83 c0 04             	add    $0x4,%eax
+  8012ea:	39 13                	cmp    %edx,(%ebx)
+  8012ec:	75 f3                	jne    8012e1 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  8012ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f3:	eb 1f                	jmp    801314 <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012f5:	a1 08 40 80 00       	mov    0x804008,%eax
+  8012fa:	8b 40 48             	mov    0x48(%eax),%eax
+  8012fd:	83 ec 04             	sub    $0x4,%esp
+  801300:	52                   	push   %edx
+  801301:	50                   	push   %eax
+  801302:	68 f8 2a 80 00       	push   $0x802af8
+  801307:	e8 86 ee ff ff       	call   800192 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80130c:	83 c4 10             	add    $0x10,%esp
+  80130f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801314:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801317:	89 1a                	mov    %ebx,(%edx)
+}
+  801319:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131c:	c9                   	leave
+  80131d:	c3                   	ret
+
+0080131e <fd_close>:
+{
+  80131e:	55                   	push   %ebp
+  80131f:	89 e5                	mov    %esp,%ebp
+  801321:	57                   	push   %edi
+  801322:	56                   	push   %esi
+  801323:	53                   	push   %ebx
+  801324:	83 ec 24             	sub    $0x24,%esp
+  801327:	8b 75 08             	mov    0x8(%ebp),%esi
+  80132a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80132d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801330:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801331:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801337:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80133a:	50                   	push   %eax
+  80133b:	e8 42 ff ff ff       	call   801282 <fd_lookup>
+  801340:	89 c3                	mov    %eax,%ebx
+  801342:	83 c4 10             	add    $0x10,%esp
+  801345:	85 c0                	test   %eax,%eax
+  801347:	78 05                	js     80134e <fd_close+0x30>
+	    || fd != fd2)
+  801349:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80134c:	74 16                	je     801364 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80134e:	89 f8                	mov    %edi,%eax
+  801350:	84 c0                	test   %al,%al
+  801352:	b8 00 00 00 00       	mov    $0x0,%eax
+  801357:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80135a:	89 d8                	mov    %ebx,%eax
+  80135c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80135f:	5b                   	pop    %ebx
+  801360:	5e                   	pop    %esi
+  801361:	5f                   	pop    %edi
+  801362:	5d                   	pop    %ebp
+  801363:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801364:	83 ec 08             	sub    $0x8,%esp
+  801367:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80136a:	50                   	push   %eax
+  80136b:	ff 36                	push   (%esi)
+  80136d:	e8 60 ff ff ff       	call   8012d2 <dev_lookup>
+  801372:	89 c3                	mov    %eax,%ebx
+  801374:	83 c4 10             	add    $0x10,%esp
+  801377:	85 c0                	test   %eax,%eax
+  801379:	78 1a                	js     801395 <fd_close+0x77>
+		if (dev->dev_close)
+  80137b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80137e:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801381:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801386:	85 c0                	test   %eax,%eax
+  801388:	74 0b                	je     801395 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80138a:	83 ec 0c             	sub    $0xc,%esp
+  80138d:	56                   	push   %esi
+  80138e:	ff d0                	call   *%eax
+  801390:	89 c3                	mov    %eax,%ebx
+  801392:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801395:	83 ec 08             	sub    $0x8,%esp
+  801398:	56                   	push   %esi
+  801399:	6a 00                	push   $0x0
+  80139b:	e8 51 f9 ff ff       	call   800cf1 <sys_page_unmap>
+	return r;
+  8013a0:	83 c4 10             	add    $0x10,%esp
+  8013a3:	eb b5                	jmp    80135a <fd_close+0x3c>
+
+008013a5 <close>:
+
+int
+close(int fdnum)
+{
+  8013a5:	55                   	push   %ebp
+  8013a6:	89 e5                	mov    %esp,%ebp
+  8013a8:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013ae:	50                   	push   %eax
+  8013af:	ff 75 08             	push   0x8(%ebp)
+  8013b2:	e8 cb fe ff ff       	call   801282 <fd_lookup>
+  8013b7:	83 c4 10             	add    $0x10,%esp
+  8013ba:	85 c0                	test   %eax,%eax
+  8013bc:	79 02                	jns    8013c0 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8013be:	c9                   	leave
+  8013bf:	c3                   	ret
+		return fd_close(fd, 1);
+  8013c0:	83 ec 08             	sub    $0x8,%esp
+  8013c3:	6a 01                	push   $0x1
+  8013c5:	ff 75 f4             	push   -0xc(%ebp)
+  8013c8:	e8 51 ff ff ff       	call   80131e <fd_close>
+  8013cd:	83 c4 10             	add    $0x10,%esp
+  8013d0:	eb ec                	jmp    8013be <close+0x19>
+
+008013d2 <close_all>:
+
+void
+close_all(void)
+{
+  8013d2:	55                   	push   %ebp
+  8013d3:	89 e5                	mov    %esp,%ebp
+  8013d5:	53                   	push   %ebx
+  8013d6:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8013d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8013de:	83 ec 0c             	sub    $0xc,%esp
+  8013e1:	53                   	push   %ebx
+  8013e2:	e8 be ff ff ff       	call   8013a5 <close>
+	for (i = 0; i < MAXFD; i++)
+  8013e7:	83 c3 01             	add    $0x1,%ebx
+  8013ea:	83 c4 10             	add    $0x10,%esp
+  8013ed:	83 fb 20             	cmp    $0x20,%ebx
+  8013f0:	75 ec                	jne    8013de <close_all+0xc>
+}
+  8013f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f5:	c9                   	leave
+  8013f6:	c3                   	ret
+
+008013f7 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	57                   	push   %edi
+  8013fb:	56                   	push   %esi
+  8013fc:	53                   	push   %ebx
+  8013fd:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801400:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801403:	50                   	push   %eax
+  801404:	ff 75 08             	push   0x8(%ebp)
+  801407:	e8 76 fe ff ff       	call   801282 <fd_lookup>
+  80140c:	89 c3                	mov    %eax,%ebx
+  80140e:	83 c4 10             	add    $0x10,%esp
+  801411:	85 c0                	test   %eax,%eax
+  801413:	78 7f                	js     801494 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801415:	83 ec 0c             	sub    $0xc,%esp
+  801418:	ff 75 0c             	push   0xc(%ebp)
+  80141b:	e8 85 ff ff ff       	call   8013a5 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801420:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801423:	c1 e6 0c             	shl    $0xc,%esi
+  801426:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80142c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80142f:	89 3c 24             	mov    %edi,(%esp)
+  801432:	e8 e0 fd ff ff       	call   801217 <fd2data>
+  801437:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801439:	89 34 24             	mov    %esi,(%esp)
+  80143c:	e8 d6 fd ff ff       	call   801217 <fd2data>
+  801441:	83 c4 10             	add    $0x10,%esp
+  801444:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801447:	89 d8                	mov    %ebx,%eax
+  801449:	c1 e8 16             	shr    $0x16,%eax
+  80144c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801453:	a8 01                	test   $0x1,%al
+  801455:	74 11                	je     801468 <dup+0x71>
+  801457:	89 d8                	mov    %ebx,%eax
+  801459:	c1 e8 0c             	shr    $0xc,%eax
+  80145c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801463:	f6 c2 01             	test   $0x1,%dl
+  801466:	75 36                	jne    80149e <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801468:	89 f8                	mov    %edi,%eax
+  80146a:	c1 e8 0c             	shr    $0xc,%eax
+  80146d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801474:	83 ec 0c             	sub    $0xc,%esp
+  801477:	25 07 0e 00 00       	and    $0xe07,%eax
+  80147c:	50                   	push   %eax
+  80147d:	56                   	push   %esi
+  80147e:	6a 00                	push   $0x0
+  801480:	57                   	push   %edi
+  801481:	6a 00                	push   $0x0
+  801483:	e8 27 f8 ff ff       	call   800caf <sys_page_map>
+  801488:	89 c3                	mov    %eax,%ebx
+  80148a:	83 c4 20             	add    $0x20,%esp
+  80148d:	85 c0                	test   %eax,%eax
+  80148f:	78 33                	js     8014c4 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801491:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801494:	89 d8                	mov    %ebx,%eax
+  801496:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801499:	5b                   	pop    %ebx
+  80149a:	5e                   	pop    %esi
+  80149b:	5f                   	pop    %edi
+  80149c:	5d                   	pop    %ebp
+  80149d:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80149e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014ad:	50                   	push   %eax
+  8014ae:	ff 75 d4             	push   -0x2c(%ebp)
+  8014b1:	6a 00                	push   $0x0
+  8014b3:	53                   	push   %ebx
+  8014b4:	6a 00                	push   $0x0
+  8014b6:	e8 f4 f7 ff ff       	call   800caf <sys_page_map>
+  8014bb:	89 c3                	mov    %eax,%ebx
+  8014bd:	83 c4 20             	add    $0x20,%esp
+  8014c0:	85 c0                	test   %eax,%eax
+  8014c2:	79 a4                	jns    801468 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8014c4:	83 ec 08             	sub    $0x8,%esp
+  8014c7:	56                   	push   %esi
+  8014c8:	6a 00                	push   $0x0
+  8014ca:	e8 22 f8 ff ff       	call   800cf1 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8014cf:	83 c4 08             	add    $0x8,%esp
+  8014d2:	ff 75 d4             	push   -0x2c(%ebp)
+  8014d5:	6a 00                	push   $0x0
+  8014d7:	e8 15 f8 ff ff       	call   800cf1 <sys_page_unmap>
+	return r;
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	eb b3                	jmp    801494 <dup+0x9d>
+
+008014e1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	56                   	push   %esi
+  8014e5:	53                   	push   %ebx
+  8014e6:	83 ec 18             	sub    $0x18,%esp
+  8014e9:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014ec:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014ef:	50                   	push   %eax
+  8014f0:	56                   	push   %esi
+  8014f1:	e8 8c fd ff ff       	call   801282 <fd_lookup>
+  8014f6:	83 c4 10             	add    $0x10,%esp
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	78 3c                	js     801539 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014fd:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801500:	83 ec 08             	sub    $0x8,%esp
+  801503:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801506:	50                   	push   %eax
+  801507:	ff 33                	push   (%ebx)
+  801509:	e8 c4 fd ff ff       	call   8012d2 <dev_lookup>
+  80150e:	83 c4 10             	add    $0x10,%esp
+  801511:	85 c0                	test   %eax,%eax
+  801513:	78 24                	js     801539 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801515:	8b 43 08             	mov    0x8(%ebx),%eax
+  801518:	83 e0 03             	and    $0x3,%eax
+  80151b:	83 f8 01             	cmp    $0x1,%eax
+  80151e:	74 20                	je     801540 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801520:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801523:	8b 40 08             	mov    0x8(%eax),%eax
+  801526:	85 c0                	test   %eax,%eax
+  801528:	74 37                	je     801561 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80152a:	83 ec 04             	sub    $0x4,%esp
+  80152d:	ff 75 10             	push   0x10(%ebp)
+  801530:	ff 75 0c             	push   0xc(%ebp)
+  801533:	53                   	push   %ebx
+  801534:	ff d0                	call   *%eax
+  801536:	83 c4 10             	add    $0x10,%esp
+}
+  801539:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80153c:	5b                   	pop    %ebx
+  80153d:	5e                   	pop    %esi
+  80153e:	5d                   	pop    %ebp
+  80153f:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801540:	a1 08 40 80 00       	mov    0x804008,%eax
+  801545:	8b 40 48             	mov    0x48(%eax),%eax
+  801548:	83 ec 04             	sub    $0x4,%esp
+  80154b:	56                   	push   %esi
+  80154c:	50                   	push   %eax
+  80154d:	68 39 2b 80 00       	push   $0x802b39
+  801552:	e8 3b ec ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  801557:	83 c4 10             	add    $0x10,%esp
+  80155a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80155f:	eb d8                	jmp    801539 <read+0x58>
+		return -E_NOT_SUPP;
+  801561:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801566:	eb d1                	jmp    801539 <read+0x58>
+
+00801568 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801568:	55                   	push   %ebp
+  801569:	89 e5                	mov    %esp,%ebp
+  80156b:	57                   	push   %edi
+  80156c:	56                   	push   %esi
+  80156d:	53                   	push   %ebx
+  80156e:	83 ec 0c             	sub    $0xc,%esp
+  801571:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801574:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801577:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157c:	eb 02                	jmp    801580 <readn+0x18>
+  80157e:	01 c3                	add    %eax,%ebx
+  801580:	39 f3                	cmp    %esi,%ebx
+  801582:	73 21                	jae    8015a5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801584:	83 ec 04             	sub    $0x4,%esp
+  801587:	89 f0                	mov    %esi,%eax
+  801589:	29 d8                	sub    %ebx,%eax
+  80158b:	50                   	push   %eax
+  80158c:	89 d8                	mov    %ebx,%eax
+  80158e:	03 45 0c             	add    0xc(%ebp),%eax
+  801591:	50                   	push   %eax
+  801592:	57                   	push   %edi
+  801593:	e8 49 ff ff ff       	call   8014e1 <read>
+		if (m < 0)
+  801598:	83 c4 10             	add    $0x10,%esp
+  80159b:	85 c0                	test   %eax,%eax
+  80159d:	78 04                	js     8015a3 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80159f:	75 dd                	jne    80157e <readn+0x16>
+  8015a1:	eb 02                	jmp    8015a5 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8015a3:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8015a5:	89 d8                	mov    %ebx,%eax
+  8015a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015aa:	5b                   	pop    %ebx
+  8015ab:	5e                   	pop    %esi
+  8015ac:	5f                   	pop    %edi
+  8015ad:	5d                   	pop    %ebp
+  8015ae:	c3                   	ret
+
+008015af <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015af:	55                   	push   %ebp
+  8015b0:	89 e5                	mov    %esp,%ebp
+  8015b2:	56                   	push   %esi
+  8015b3:	53                   	push   %ebx
+  8015b4:	83 ec 18             	sub    $0x18,%esp
+  8015b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ba:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015bd:	50                   	push   %eax
+  8015be:	53                   	push   %ebx
+  8015bf:	e8 be fc ff ff       	call   801282 <fd_lookup>
+  8015c4:	83 c4 10             	add    $0x10,%esp
+  8015c7:	85 c0                	test   %eax,%eax
+  8015c9:	78 37                	js     801602 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015cb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015ce:	83 ec 08             	sub    $0x8,%esp
+  8015d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d4:	50                   	push   %eax
+  8015d5:	ff 36                	push   (%esi)
+  8015d7:	e8 f6 fc ff ff       	call   8012d2 <dev_lookup>
+  8015dc:	83 c4 10             	add    $0x10,%esp
+  8015df:	85 c0                	test   %eax,%eax
+  8015e1:	78 1f                	js     801602 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015e3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015e7:	74 20                	je     801609 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8015e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ec:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015ef:	85 c0                	test   %eax,%eax
+  8015f1:	74 37                	je     80162a <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8015f3:	83 ec 04             	sub    $0x4,%esp
+  8015f6:	ff 75 10             	push   0x10(%ebp)
+  8015f9:	ff 75 0c             	push   0xc(%ebp)
+  8015fc:	56                   	push   %esi
+  8015fd:	ff d0                	call   *%eax
+  8015ff:	83 c4 10             	add    $0x10,%esp
+}
+  801602:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801605:	5b                   	pop    %ebx
+  801606:	5e                   	pop    %esi
+  801607:	5d                   	pop    %ebp
+  801608:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801609:	a1 08 40 80 00       	mov    0x804008,%eax
+  80160e:	8b 40 48             	mov    0x48(%eax),%eax
+  801611:	83 ec 04             	sub    $0x4,%esp
+  801614:	53                   	push   %ebx
+  801615:	50                   	push   %eax
+  801616:	68 55 2b 80 00       	push   $0x802b55
+  80161b:	e8 72 eb ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  801620:	83 c4 10             	add    $0x10,%esp
+  801623:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801628:	eb d8                	jmp    801602 <write+0x53>
+		return -E_NOT_SUPP;
+  80162a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80162f:	eb d1                	jmp    801602 <write+0x53>
+
+00801631 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801631:	55                   	push   %ebp
+  801632:	89 e5                	mov    %esp,%ebp
+  801634:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801637:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80163a:	50                   	push   %eax
+  80163b:	ff 75 08             	push   0x8(%ebp)
+  80163e:	e8 3f fc ff ff       	call   801282 <fd_lookup>
+  801643:	83 c4 10             	add    $0x10,%esp
+  801646:	85 c0                	test   %eax,%eax
+  801648:	78 0e                	js     801658 <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  80164a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80164d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801650:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  801653:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801658:	c9                   	leave
+  801659:	c3                   	ret
+
+0080165a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80165a:	55                   	push   %ebp
+  80165b:	89 e5                	mov    %esp,%ebp
+  80165d:	56                   	push   %esi
+  80165e:	53                   	push   %ebx
+  80165f:	83 ec 18             	sub    $0x18,%esp
+  801662:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801665:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801668:	50                   	push   %eax
+  801669:	53                   	push   %ebx
+  80166a:	e8 13 fc ff ff       	call   801282 <fd_lookup>
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	85 c0                	test   %eax,%eax
+  801674:	78 34                	js     8016aa <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801676:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801679:	83 ec 08             	sub    $0x8,%esp
+  80167c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167f:	50                   	push   %eax
+  801680:	ff 36                	push   (%esi)
+  801682:	e8 4b fc ff ff       	call   8012d2 <dev_lookup>
+  801687:	83 c4 10             	add    $0x10,%esp
+  80168a:	85 c0                	test   %eax,%eax
+  80168c:	78 1c                	js     8016aa <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80168e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801692:	74 1d                	je     8016b1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801694:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801697:	8b 40 18             	mov    0x18(%eax),%eax
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	74 34                	je     8016d2 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  80169e:	83 ec 08             	sub    $0x8,%esp
+  8016a1:	ff 75 0c             	push   0xc(%ebp)
+  8016a4:	56                   	push   %esi
+  8016a5:	ff d0                	call   *%eax
+  8016a7:	83 c4 10             	add    $0x10,%esp
+}
+  8016aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ad:	5b                   	pop    %ebx
+  8016ae:	5e                   	pop    %esi
+  8016af:	5d                   	pop    %ebp
+  8016b0:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8016b1:	a1 08 40 80 00       	mov    0x804008,%eax
+  8016b6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016b9:	83 ec 04             	sub    $0x4,%esp
+  8016bc:	53                   	push   %ebx
+  8016bd:	50                   	push   %eax
+  8016be:	68 18 2b 80 00       	push   $0x802b18
+  8016c3:	e8 ca ea ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  8016c8:	83 c4 10             	add    $0x10,%esp
+  8016cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d0:	eb d8                	jmp    8016aa <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8016d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d7:	eb d1                	jmp    8016aa <ftruncate+0x50>
+
+008016d9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016d9:	55                   	push   %ebp
+  8016da:	89 e5                	mov    %esp,%ebp
+  8016dc:	56                   	push   %esi
+  8016dd:	53                   	push   %ebx
+  8016de:	83 ec 18             	sub    $0x18,%esp
+  8016e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016e4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016e7:	50                   	push   %eax
+  8016e8:	ff 75 08             	push   0x8(%ebp)
+  8016eb:	e8 92 fb ff ff       	call   801282 <fd_lookup>
+  8016f0:	83 c4 10             	add    $0x10,%esp
+  8016f3:	85 c0                	test   %eax,%eax
+  8016f5:	78 49                	js     801740 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016f7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016fa:	83 ec 08             	sub    $0x8,%esp
+  8016fd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801700:	50                   	push   %eax
+  801701:	ff 36                	push   (%esi)
+  801703:	e8 ca fb ff ff       	call   8012d2 <dev_lookup>
+  801708:	83 c4 10             	add    $0x10,%esp
+  80170b:	85 c0                	test   %eax,%eax
+  80170d:	78 31                	js     801740 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80170f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801712:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801716:	74 2f                	je     801747 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801718:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80171b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801722:	00 00 00 
+	stat->st_isdir = 0;
+  801725:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80172c:	00 00 00 
+	stat->st_dev = dev;
+  80172f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801735:	83 ec 08             	sub    $0x8,%esp
+  801738:	53                   	push   %ebx
+  801739:	56                   	push   %esi
+  80173a:	ff 50 14             	call   *0x14(%eax)
+  80173d:	83 c4 10             	add    $0x10,%esp
+}
+  801740:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801743:	5b                   	pop    %ebx
+  801744:	5e                   	pop    %esi
+  801745:	5d                   	pop    %ebp
+  801746:	c3                   	ret
+		return -E_NOT_SUPP;
+  801747:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80174c:	eb f2                	jmp    801740 <fstat+0x67>
+
+0080174e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	56                   	push   %esi
+  801752:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  801753:	83 ec 08             	sub    $0x8,%esp
+  801756:	6a 00                	push   $0x0
+  801758:	ff 75 08             	push   0x8(%ebp)
+  80175b:	e8 bc 02 00 00       	call   801a1c <open>
+  801760:	89 c3                	mov    %eax,%ebx
+  801762:	83 c4 10             	add    $0x10,%esp
+  801765:	85 c0                	test   %eax,%eax
+  801767:	78 1b                	js     801784 <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  801769:	83 ec 08             	sub    $0x8,%esp
+  80176c:	ff 75 0c             	push   0xc(%ebp)
+  80176f:	50                   	push   %eax
+  801770:	e8 64 ff ff ff       	call   8016d9 <fstat>
+  801775:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801777:	89 1c 24             	mov    %ebx,(%esp)
+  80177a:	e8 26 fc ff ff       	call   8013a5 <close>
+	return r;
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	89 f3                	mov    %esi,%ebx
+}
+  801784:	89 d8                	mov    %ebx,%eax
+  801786:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801789:	5b                   	pop    %ebx
+  80178a:	5e                   	pop    %esi
+  80178b:	5d                   	pop    %ebp
+  80178c:	c3                   	ret
+
+0080178d <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  80178d:	55                   	push   %ebp
+  80178e:	89 e5                	mov    %esp,%ebp
+  801790:	57                   	push   %edi
+  801791:	56                   	push   %esi
+  801792:	53                   	push   %ebx
+  801793:	83 ec 0c             	sub    $0xc,%esp
+  801796:	89 c7                	mov    %eax,%edi
+  801798:	89 d3                	mov    %edx,%ebx
+  80179a:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  80179c:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  8017a3:	74 2d                	je     8017d2 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017a5:	6a 07                	push   $0x7
+  8017a7:	68 00 50 80 00       	push   $0x805000
+  8017ac:	57                   	push   %edi
+  8017ad:	ff 35 00 40 80 00    	push   0x804000
+  8017b3:	e8 c3 0b 00 00       	call   80237b <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  8017b8:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8017bf:	6a 00                	push   $0x0
+  8017c1:	56                   	push   %esi
+  8017c2:	53                   	push   %ebx
+  8017c3:	6a 00                	push   $0x0
+  8017c5:	e8 63 0a 00 00       	call   80222d <ipc_recv_pages>
+}
+  8017ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017cd:	5b                   	pop    %ebx
+  8017ce:	5e                   	pop    %esi
+  8017cf:	5f                   	pop    %edi
+  8017d0:	5d                   	pop    %ebp
+  8017d1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017d2:	83 ec 0c             	sub    $0xc,%esp
+  8017d5:	6a 01                	push   $0x1
+  8017d7:	e8 94 0c 00 00       	call   802470 <ipc_find_env>
+  8017dc:	a3 00 40 80 00       	mov    %eax,0x804000
+  8017e1:	83 c4 10             	add    $0x10,%esp
+  8017e4:	eb bf                	jmp    8017a5 <fsipc_pages+0x18>
+
+008017e6 <fsipc>:
+{
+  8017e6:	55                   	push   %ebp
+  8017e7:	89 e5                	mov    %esp,%ebp
+  8017e9:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  8017ec:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017f1:	e8 97 ff ff ff       	call   80178d <fsipc_pages>
+}
+  8017f6:	c9                   	leave
+  8017f7:	c3                   	ret
+
+008017f8 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017f8:	55                   	push   %ebp
+  8017f9:	89 e5                	mov    %esp,%ebp
+  8017fb:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017fe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801801:	8b 40 0c             	mov    0xc(%eax),%eax
+  801804:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.set_size.req_size = newsize;
+  801809:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80180c:	a3 04 50 80 00       	mov    %eax,0x805004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801811:	ba 00 00 00 00       	mov    $0x0,%edx
+  801816:	b8 02 00 00 00       	mov    $0x2,%eax
+  80181b:	e8 c6 ff ff ff       	call   8017e6 <fsipc>
+}
+  801820:	c9                   	leave
+  801821:	c3                   	ret
+
+00801822 <devfile_flush>:
+{
+  801822:	55                   	push   %ebp
+  801823:	89 e5                	mov    %esp,%ebp
+  801825:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801828:	8b 45 08             	mov    0x8(%ebp),%eax
+  80182b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80182e:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_FLUSH, NULL);
+  801833:	ba 00 00 00 00       	mov    $0x0,%edx
+  801838:	b8 06 00 00 00       	mov    $0x6,%eax
+  80183d:	e8 a4 ff ff ff       	call   8017e6 <fsipc>
+}
+  801842:	c9                   	leave
+  801843:	c3                   	ret
+
+00801844 <devfile_stat>:
+{
+  801844:	55                   	push   %ebp
+  801845:	89 e5                	mov    %esp,%ebp
+  801847:	53                   	push   %ebx
+  801848:	83 ec 04             	sub    $0x4,%esp
+  80184b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80184e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801851:	8b 40 0c             	mov    0xc(%eax),%eax
+  801854:	a3 00 50 80 00       	mov    %eax,0x805000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801859:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185e:	b8 05 00 00 00       	mov    $0x5,%eax
+  801863:	e8 7e ff ff ff       	call   8017e6 <fsipc>
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	78 2c                	js     801898 <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80186c:	83 ec 08             	sub    $0x8,%esp
+  80186f:	68 00 50 80 00       	push   $0x805000
+  801874:	53                   	push   %ebx
+  801875:	e8 ff ee ff ff       	call   800779 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  80187a:	a1 80 50 80 00       	mov    0x805080,%eax
+  80187f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801885:	a1 84 50 80 00       	mov    0x805084,%eax
+  80188a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  801890:	83 c4 10             	add    $0x10,%esp
+  801893:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801898:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80189b:	c9                   	leave
+  80189c:	c3                   	ret
+
+0080189d <devfile_write>:
+{
+  80189d:	55                   	push   %ebp
+  80189e:	89 e5                	mov    %esp,%ebp
+  8018a0:	83 ec 0c             	sub    $0xc,%esp
+  8018a3:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8018a6:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8018ab:	39 d0                	cmp    %edx,%eax
+  8018ad:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8018b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b3:	8b 52 0c             	mov    0xc(%edx),%edx
+  8018b6:	89 15 00 50 80 00    	mov    %edx,0x805000
+	fsipcbuf.write.req_n = n;
+  8018bc:	a3 04 50 80 00       	mov    %eax,0x805004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8018c1:	50                   	push   %eax
+  8018c2:	ff 75 0c             	push   0xc(%ebp)
+  8018c5:	68 08 50 80 00       	push   $0x805008
+  8018ca:	e8 30 f0 ff ff       	call   8008ff <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  8018cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018d4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8018d9:	e8 08 ff ff ff       	call   8017e6 <fsipc>
+}
+  8018de:	c9                   	leave
+  8018df:	c3                   	ret
+
+008018e0 <devfile_read>:
+{
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+  8018e3:	57                   	push   %edi
+  8018e4:	56                   	push   %esi
+  8018e5:	53                   	push   %ebx
+  8018e6:	83 ec 1c             	sub    $0x1c,%esp
+  8018e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8018ec:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  8018ef:	89 fe                	mov    %edi,%esi
+  8018f1:	c1 ee 0c             	shr    $0xc,%esi
+  8018f4:	b8 20 00 00 00       	mov    $0x20,%eax
+  8018f9:	39 c6                	cmp    %eax,%esi
+  8018fb:	0f 47 f0             	cmova  %eax,%esi
+  8018fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801901:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801906:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801909:	eb 14                	jmp    80191f <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  80190b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801912:	05 00 10 00 00       	add    $0x1000,%eax
+  801917:	f6 c6 06             	test   $0x6,%dh
+  80191a:	75 42                	jne    80195e <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  80191c:	83 c1 01             	add    $0x1,%ecx
+  80191f:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801922:	39 f1                	cmp    %esi,%ecx
+  801924:	0f 84 95 00 00 00    	je     8019bf <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80192a:	89 c2                	mov    %eax,%edx
+  80192c:	c1 ea 16             	shr    $0x16,%edx
+  80192f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801936:	f6 c2 01             	test   $0x1,%dl
+  801939:	74 23                	je     80195e <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  80193b:	89 c2                	mov    %eax,%edx
+  80193d:	c1 ea 0c             	shr    $0xc,%edx
+  801940:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801947:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  80194d:	74 0f                	je     80195e <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  80194f:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801956:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  80195c:	75 ad                	jne    80190b <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  80195e:	85 c9                	test   %ecx,%ecx
+  801960:	74 11                	je     801973 <devfile_read+0x93>
+  801962:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801969:	75 08                	jne    801973 <devfile_read+0x93>
+  80196b:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801971:	74 50                	je     8019c3 <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801973:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801976:	a3 00 50 80 00       	mov    %eax,0x805000
+	fsipcbuf.read.req_n = n;
+  80197b:	89 3d 04 50 80 00    	mov    %edi,0x805004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801981:	ba 00 00 00 00       	mov    $0x0,%edx
+  801986:	b8 03 00 00 00       	mov    $0x3,%eax
+  80198b:	e8 56 fe ff ff       	call   8017e6 <fsipc>
+  801990:	89 c6                	mov    %eax,%esi
+  801992:	85 c0                	test   %eax,%eax
+  801994:	78 1f                	js     8019b5 <devfile_read+0xd5>
+	assert(r <= n);
+  801996:	39 c7                	cmp    %eax,%edi
+  801998:	72 50                	jb     8019ea <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  80199a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80199f:	7f 62                	jg     801a03 <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  8019a1:	83 ec 04             	sub    $0x4,%esp
+  8019a4:	50                   	push   %eax
+  8019a5:	68 00 50 80 00       	push   $0x805000
+  8019aa:	ff 75 0c             	push   0xc(%ebp)
+  8019ad:	e8 4d ef ff ff       	call   8008ff <memmove>
+	return r;
+  8019b2:	83 c4 10             	add    $0x10,%esp
+}
+  8019b5:	89 f0                	mov    %esi,%eax
+  8019b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ba:	5b                   	pop    %ebx
+  8019bb:	5e                   	pop    %esi
+  8019bc:	5f                   	pop    %edi
+  8019bd:	5d                   	pop    %ebp
+  8019be:	c3                   	ret
+  8019bf:	89 f1                	mov    %esi,%ecx
+  8019c1:	eb 9b                	jmp    80195e <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  8019c3:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019c6:	a3 00 50 80 00       	mov    %eax,0x805000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  8019cb:	89 c8                	mov    %ecx,%eax
+  8019cd:	c1 e0 0c             	shl    $0xc,%eax
+  8019d0:	a3 04 50 80 00       	mov    %eax,0x805004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  8019d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8019dd:	e8 ab fd ff ff       	call   80178d <fsipc_pages>
+  8019e2:	89 c6                	mov    %eax,%esi
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	78 8b                	js     801973 <devfile_read+0x93>
+  8019e8:	eb cb                	jmp    8019b5 <devfile_read+0xd5>
+	assert(r <= n);
+  8019ea:	68 84 2b 80 00       	push   $0x802b84
+  8019ef:	68 8b 2b 80 00       	push   $0x802b8b
+  8019f4:	68 a0 00 00 00       	push   $0xa0
+  8019f9:	68 a0 2b 80 00       	push   $0x802ba0
+  8019fe:	e8 e4 07 00 00       	call   8021e7 <_panic>
+	assert(r <= PGSIZE);
+  801a03:	68 ab 2b 80 00       	push   $0x802bab
+  801a08:	68 8b 2b 80 00       	push   $0x802b8b
+  801a0d:	68 a1 00 00 00       	push   $0xa1
+  801a12:	68 a0 2b 80 00       	push   $0x802ba0
+  801a17:	e8 cb 07 00 00       	call   8021e7 <_panic>
+
+00801a1c <open>:
+{
+  801a1c:	55                   	push   %ebp
+  801a1d:	89 e5                	mov    %esp,%ebp
+  801a1f:	56                   	push   %esi
+  801a20:	53                   	push   %ebx
+  801a21:	83 ec 1c             	sub    $0x1c,%esp
+  801a24:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801a27:	56                   	push   %esi
+  801a28:	e8 11 ed ff ff       	call   80073e <strlen>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801a35:	7f 6c                	jg     801aa3 <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801a37:	83 ec 0c             	sub    $0xc,%esp
+  801a3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3d:	50                   	push   %eax
+  801a3e:	e8 eb f7 ff ff       	call   80122e <fd_alloc>
+  801a43:	89 c3                	mov    %eax,%ebx
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	85 c0                	test   %eax,%eax
+  801a4a:	78 3c                	js     801a88 <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801a4c:	83 ec 08             	sub    $0x8,%esp
+  801a4f:	56                   	push   %esi
+  801a50:	68 00 50 80 00       	push   $0x805000
+  801a55:	e8 1f ed ff ff       	call   800779 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801a5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a5d:	a3 00 54 80 00       	mov    %eax,0x805400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801a62:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801a65:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a6a:	e8 77 fd ff ff       	call   8017e6 <fsipc>
+  801a6f:	89 c3                	mov    %eax,%ebx
+  801a71:	83 c4 10             	add    $0x10,%esp
+  801a74:	85 c0                	test   %eax,%eax
+  801a76:	78 19                	js     801a91 <open+0x75>
+	return fd2num(fd);
+  801a78:	83 ec 0c             	sub    $0xc,%esp
+  801a7b:	ff 75 f4             	push   -0xc(%ebp)
+  801a7e:	e8 84 f7 ff ff       	call   801207 <fd2num>
+  801a83:	89 c3                	mov    %eax,%ebx
+  801a85:	83 c4 10             	add    $0x10,%esp
+}
+  801a88:	89 d8                	mov    %ebx,%eax
+  801a8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a8d:	5b                   	pop    %ebx
+  801a8e:	5e                   	pop    %esi
+  801a8f:	5d                   	pop    %ebp
+  801a90:	c3                   	ret
+		fd_close(fd, 0);
+  801a91:	83 ec 08             	sub    $0x8,%esp
+  801a94:	6a 00                	push   $0x0
+  801a96:	ff 75 f4             	push   -0xc(%ebp)
+  801a99:	e8 80 f8 ff ff       	call   80131e <fd_close>
+		return r;
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	eb e5                	jmp    801a88 <open+0x6c>
+		return -E_BAD_PATH;
+  801aa3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801aa8:	eb de                	jmp    801a88 <open+0x6c>
+
+00801aaa <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801aaa:	55                   	push   %ebp
+  801aab:	89 e5                	mov    %esp,%ebp
+  801aad:	53                   	push   %ebx
+  801aae:	83 ec 10             	sub    $0x10,%esp
+  801ab1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801ab4:	53                   	push   %ebx
+  801ab5:	e8 84 ec ff ff       	call   80073e <strlen>
+  801aba:	83 c4 10             	add    $0x10,%esp
+  801abd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ac2:	7f 25                	jg     801ae9 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801ac4:	83 ec 08             	sub    $0x8,%esp
+  801ac7:	53                   	push   %ebx
+  801ac8:	68 00 50 80 00       	push   $0x805000
+  801acd:	e8 a7 ec ff ff       	call   800779 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801ad2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad7:	b8 07 00 00 00       	mov    $0x7,%eax
+  801adc:	e8 05 fd ff ff       	call   8017e6 <fsipc>
+  801ae1:	83 c4 10             	add    $0x10,%esp
+}
+  801ae4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+		return -E_BAD_PATH;
+  801ae9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801aee:	eb f4                	jmp    801ae4 <remove+0x3a>
+
+00801af0 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801af0:	55                   	push   %ebp
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801af6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afb:	b8 08 00 00 00       	mov    $0x8,%eax
+  801b00:	e8 e1 fc ff ff       	call   8017e6 <fsipc>
+}
+  801b05:	c9                   	leave
+  801b06:	c3                   	ret
+
+00801b07 <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801b07:	55                   	push   %ebp
+  801b08:	89 e5                	mov    %esp,%ebp
+  801b0a:	53                   	push   %ebx
+  801b0b:	83 ec 04             	sub    $0x4,%esp
+  801b0e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b16:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801b1b:	e8 c6 fc ff ff       	call   8017e6 <fsipc>
+  801b20:	85 c0                	test   %eax,%eax
+  801b22:	78 3c                	js     801b60 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801b24:	a1 00 50 80 00       	mov    0x805000,%eax
+  801b29:	89 03                	mov    %eax,(%ebx)
+  801b2b:	a1 04 50 80 00       	mov    0x805004,%eax
+  801b30:	89 43 04             	mov    %eax,0x4(%ebx)
+  801b33:	a1 08 50 80 00       	mov    0x805008,%eax
+  801b38:	89 43 08             	mov    %eax,0x8(%ebx)
+  801b3b:	a1 0c 50 80 00       	mov    0x80500c,%eax
+  801b40:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801b43:	a1 10 50 80 00       	mov    0x805010,%eax
+  801b48:	89 43 10             	mov    %eax,0x10(%ebx)
+  801b4b:	a1 14 50 80 00       	mov    0x805014,%eax
+  801b50:	89 43 14             	mov    %eax,0x14(%ebx)
+  801b53:	a1 18 50 80 00       	mov    0x805018,%eax
+  801b58:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b63:	c9                   	leave
+  801b64:	c3                   	ret
+
+00801b65 <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801b65:	55                   	push   %ebp
+  801b66:	89 e5                	mov    %esp,%ebp
+  801b68:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801b6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b6e:	a3 00 50 80 00       	mov    %eax,0x805000
+	return fsipc(FSREQ_BCSET, NULL);
+  801b73:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b78:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b7d:	e8 64 fc ff ff       	call   8017e6 <fsipc>
+}
+  801b82:	c9                   	leave
+  801b83:	c3                   	ret
+
+00801b84 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801b84:	55                   	push   %ebp
+  801b85:	89 e5                	mov    %esp,%ebp
+  801b87:	56                   	push   %esi
+  801b88:	53                   	push   %ebx
+  801b89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801b8c:	83 ec 0c             	sub    $0xc,%esp
+  801b8f:	ff 75 08             	push   0x8(%ebp)
+  801b92:	e8 80 f6 ff ff       	call   801217 <fd2data>
+  801b97:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801b99:	83 c4 08             	add    $0x8,%esp
+  801b9c:	68 b7 2b 80 00       	push   $0x802bb7
+  801ba1:	53                   	push   %ebx
+  801ba2:	e8 d2 eb ff ff       	call   800779 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801ba7:	8b 46 04             	mov    0x4(%esi),%eax
+  801baa:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801bb0:	2b 0e                	sub    (%esi),%ecx
+  801bb2:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801bb7:	89 c8                	mov    %ecx,%eax
+  801bb9:	f7 e2                	mul    %edx
+  801bbb:	c1 ea 0c             	shr    $0xc,%edx
+  801bbe:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801bc4:	29 d1                	sub    %edx,%ecx
+  801bc6:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801bcc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bd3:	00 00 00 
+	stat->st_dev = &devpipe;
+  801bd6:	c7 83 88 00 00 00 20 	movl   $0x803020,0x88(%ebx)
+  801bdd:	30 80 00 
+	return 0;
+}
+  801be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be8:	5b                   	pop    %ebx
+  801be9:	5e                   	pop    %esi
+  801bea:	5d                   	pop    %ebp
+  801beb:	c3                   	ret
+
+00801bec <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801bec:	55                   	push   %ebp
+  801bed:	89 e5                	mov    %esp,%ebp
+  801bef:	53                   	push   %ebx
+  801bf0:	83 ec 0c             	sub    $0xc,%esp
+  801bf3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801bf6:	53                   	push   %ebx
+  801bf7:	6a 00                	push   $0x0
+  801bf9:	e8 f3 f0 ff ff       	call   800cf1 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801bfe:	89 1c 24             	mov    %ebx,(%esp)
+  801c01:	e8 11 f6 ff ff       	call   801217 <fd2data>
+  801c06:	83 c4 08             	add    $0x8,%esp
+  801c09:	50                   	push   %eax
+  801c0a:	6a 00                	push   $0x0
+  801c0c:	e8 e0 f0 ff ff       	call   800cf1 <sys_page_unmap>
+}
+  801c11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c14:	c9                   	leave
+  801c15:	c3                   	ret
+
+00801c16 <_pipeisclosed>:
+{
+  801c16:	55                   	push   %ebp
+  801c17:	89 e5                	mov    %esp,%ebp
+  801c19:	57                   	push   %edi
+  801c1a:	56                   	push   %esi
+  801c1b:	53                   	push   %ebx
+  801c1c:	83 ec 1c             	sub    $0x1c,%esp
+  801c1f:	89 c7                	mov    %eax,%edi
+  801c21:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801c23:	a1 08 40 80 00       	mov    0x804008,%eax
+  801c28:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801c2b:	83 ec 0c             	sub    $0xc,%esp
+  801c2e:	57                   	push   %edi
+  801c2f:	e8 7b 08 00 00       	call   8024af <pageref>
+  801c34:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801c37:	89 34 24             	mov    %esi,(%esp)
+  801c3a:	e8 70 08 00 00       	call   8024af <pageref>
+		nn = thisenv->env_runs;
+  801c3f:	8b 15 08 40 80 00    	mov    0x804008,%edx
+  801c45:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801c48:	83 c4 10             	add    $0x10,%esp
+  801c4b:	39 cb                	cmp    %ecx,%ebx
+  801c4d:	74 1b                	je     801c6a <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801c4f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c52:	75 cf                	jne    801c23 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801c54:	8b 42 58             	mov    0x58(%edx),%eax
+  801c57:	6a 01                	push   $0x1
+  801c59:	50                   	push   %eax
+  801c5a:	53                   	push   %ebx
+  801c5b:	68 be 2b 80 00       	push   $0x802bbe
+  801c60:	e8 2d e5 ff ff       	call   800192 <cprintf>
+  801c65:	83 c4 10             	add    $0x10,%esp
+  801c68:	eb b9                	jmp    801c23 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801c6a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801c6d:	0f 94 c0             	sete   %al
+  801c70:	0f b6 c0             	movzbl %al,%eax
+}
+  801c73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c76:	5b                   	pop    %ebx
+  801c77:	5e                   	pop    %esi
+  801c78:	5f                   	pop    %edi
+  801c79:	5d                   	pop    %ebp
+  801c7a:	c3                   	ret
+
+00801c7b <devpipe_read>:
+{
+  801c7b:	55                   	push   %ebp
+  801c7c:	89 e5                	mov    %esp,%ebp
+  801c7e:	57                   	push   %edi
+  801c7f:	56                   	push   %esi
+  801c80:	53                   	push   %ebx
+  801c81:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801c84:	ff 75 08             	push   0x8(%ebp)
+  801c87:	e8 8b f5 ff ff       	call   801217 <fd2data>
+  801c8c:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801c8e:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801c91:	8d 40 04             	lea    0x4(%eax),%eax
+  801c94:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801c97:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801c9a:	8b 0b                	mov    (%ebx),%ecx
+  801c9c:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801ca2:	29 ce                	sub    %ecx,%esi
+  801ca4:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ca9:	f7 e6                	mul    %esi
+  801cab:	c1 ea 0c             	shr    $0xc,%edx
+  801cae:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801cb4:	29 c6                	sub    %eax,%esi
+  801cb6:	89 f2                	mov    %esi,%edx
+  801cb8:	75 43                	jne    801cfd <devpipe_read+0x82>
+		ref = pageref(p);
+  801cba:	83 ec 0c             	sub    $0xc,%esp
+  801cbd:	53                   	push   %ebx
+  801cbe:	e8 ec 07 00 00       	call   8024af <pageref>
+  801cc3:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801cc5:	89 da                	mov    %ebx,%edx
+  801cc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cca:	e8 47 ff ff ff       	call   801c16 <_pipeisclosed>
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	85 c0                	test   %eax,%eax
+  801cd4:	0f 85 c1 00 00 00    	jne    801d9b <devpipe_read+0x120>
+	*sleeping = 1;
+  801cda:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801ce1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801ce6:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801ce9:	75 ac                	jne    801c97 <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801ceb:	83 ec 04             	sub    $0x4,%esp
+  801cee:	56                   	push   %esi
+  801cef:	57                   	push   %edi
+  801cf0:	ff 75 e4             	push   -0x1c(%ebp)
+  801cf3:	e8 4d f4 ff ff       	call   801145 <sys_futex_wait>
+  801cf8:	83 c4 10             	add    $0x10,%esp
+  801cfb:	eb 9a                	jmp    801c97 <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801cfd:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801d00:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801d04:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801d06:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d0b:	f7 e1                	mul    %ecx
+  801d0d:	c1 ea 0b             	shr    $0xb,%edx
+  801d10:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801d16:	29 c1                	sub    %eax,%ecx
+  801d18:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801d1a:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801d1f:	29 cf                	sub    %ecx,%edi
+  801d21:	39 f7                	cmp    %esi,%edi
+  801d23:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801d26:	8d 43 10             	lea    0x10(%ebx),%eax
+  801d29:	83 ec 04             	sub    $0x4,%esp
+  801d2c:	57                   	push   %edi
+  801d2d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d30:	01 c2                	add    %eax,%edx
+  801d32:	52                   	push   %edx
+  801d33:	ff 75 0c             	push   0xc(%ebp)
+  801d36:	e8 c4 eb ff ff       	call   8008ff <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801d3b:	83 c4 0c             	add    $0xc,%esp
+  801d3e:	89 f1                	mov    %esi,%ecx
+  801d40:	29 f9                	sub    %edi,%ecx
+  801d42:	51                   	push   %ecx
+  801d43:	ff 75 e4             	push   -0x1c(%ebp)
+  801d46:	89 f8                	mov    %edi,%eax
+  801d48:	03 45 0c             	add    0xc(%ebp),%eax
+  801d4b:	50                   	push   %eax
+  801d4c:	e8 ae eb ff ff       	call   8008ff <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801d51:	89 f1                	mov    %esi,%ecx
+  801d53:	03 0b                	add    (%ebx),%ecx
+  801d55:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801d5a:	f7 e1                	mul    %ecx
+  801d5c:	c1 ea 0c             	shr    $0xc,%edx
+  801d5f:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d65:	29 d1                	sub    %edx,%ecx
+  801d67:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801d69:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801d6e:	83 c4 10             	add    $0x10,%esp
+  801d71:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801d75:	75 0a                	jne    801d81 <devpipe_read+0x106>
+	return n;
+  801d77:	89 f0                	mov    %esi,%eax
+}
+  801d79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d7c:	5b                   	pop    %ebx
+  801d7d:	5e                   	pop    %esi
+  801d7e:	5f                   	pop    %edi
+  801d7f:	5d                   	pop    %ebp
+  801d80:	c3                   	ret
+		*sleeping = 0;
+  801d81:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801d88:	83 ec 08             	sub    $0x8,%esp
+  801d8b:	68 00 04 00 00       	push   $0x400
+  801d90:	53                   	push   %ebx
+  801d91:	e8 ff f3 ff ff       	call   801195 <sys_futex_wake>
+  801d96:	83 c4 10             	add    $0x10,%esp
+  801d99:	eb dc                	jmp    801d77 <devpipe_read+0xfc>
+			return 0;
+  801d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da0:	eb d7                	jmp    801d79 <devpipe_read+0xfe>
+
+00801da2 <devpipe_write>:
+{
+  801da2:	55                   	push   %ebp
+  801da3:	89 e5                	mov    %esp,%ebp
+  801da5:	57                   	push   %edi
+  801da6:	56                   	push   %esi
+  801da7:	53                   	push   %ebx
+  801da8:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801dab:	ff 75 08             	push   0x8(%ebp)
+  801dae:	e8 64 f4 ff ff       	call   801217 <fd2data>
+  801db3:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801db5:	83 c4 10             	add    $0x10,%esp
+  801db8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801dbf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dc2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801dc5:	0f 83 23 01 00 00    	jae    801eee <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801dcb:	8b 77 04             	mov    0x4(%edi),%esi
+  801dce:	8b 1f                	mov    (%edi),%ebx
+  801dd0:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801dd6:	29 d9                	sub    %ebx,%ecx
+  801dd8:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ddd:	f7 e1                	mul    %ecx
+  801ddf:	c1 ea 0c             	shr    $0xc,%edx
+  801de2:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801de8:	29 c1                	sub    %eax,%ecx
+  801dea:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801dec:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801df2:	75 40                	jne    801e34 <devpipe_write+0x92>
+			ref = pageref(p);
+  801df4:	83 ec 0c             	sub    $0xc,%esp
+  801df7:	57                   	push   %edi
+  801df8:	e8 b2 06 00 00       	call   8024af <pageref>
+  801dfd:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801dff:	89 fa                	mov    %edi,%edx
+  801e01:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e04:	e8 0d fe ff ff       	call   801c16 <_pipeisclosed>
+  801e09:	83 c4 10             	add    $0x10,%esp
+  801e0c:	85 c0                	test   %eax,%eax
+  801e0e:	0f 85 d5 00 00 00    	jne    801ee9 <devpipe_write+0x147>
+	*sleeping = 1;
+  801e14:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801e1b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801e20:	39 1f                	cmp    %ebx,(%edi)
+  801e22:	75 a7                	jne    801dcb <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801e24:	83 ec 04             	sub    $0x4,%esp
+  801e27:	56                   	push   %esi
+  801e28:	53                   	push   %ebx
+  801e29:	57                   	push   %edi
+  801e2a:	e8 16 f3 ff ff       	call   801145 <sys_futex_wait>
+  801e2f:	83 c4 10             	add    $0x10,%esp
+  801e32:	eb 97                	jmp    801dcb <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801e34:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801e37:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e3a:	29 c1                	sub    %eax,%ecx
+  801e3c:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801e41:	89 d8                	mov    %ebx,%eax
+  801e43:	29 d0                	sub    %edx,%eax
+  801e45:	39 c1                	cmp    %eax,%ecx
+  801e47:	0f 46 c1             	cmovbe %ecx,%eax
+  801e4a:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801e4c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e51:	f7 e6                	mul    %esi
+  801e53:	c1 ea 0b             	shr    $0xb,%edx
+  801e56:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e5c:	29 c6                	sub    %eax,%esi
+  801e5e:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801e60:	29 f3                	sub    %esi,%ebx
+  801e62:	39 cb                	cmp    %ecx,%ebx
+  801e64:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801e67:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801e6a:	8d 77 10             	lea    0x10(%edi),%esi
+  801e6d:	83 ec 04             	sub    $0x4,%esp
+  801e70:	53                   	push   %ebx
+  801e71:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e74:	03 45 0c             	add    0xc(%ebp),%eax
+  801e77:	50                   	push   %eax
+  801e78:	01 f2                	add    %esi,%edx
+  801e7a:	52                   	push   %edx
+  801e7b:	e8 7f ea ff ff       	call   8008ff <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801e80:	83 c4 0c             	add    $0xc,%esp
+  801e83:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801e86:	29 d8                	sub    %ebx,%eax
+  801e88:	50                   	push   %eax
+  801e89:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e8c:	01 d3                	add    %edx,%ebx
+  801e8e:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801e91:	53                   	push   %ebx
+  801e92:	56                   	push   %esi
+  801e93:	e8 67 ea ff ff       	call   8008ff <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801e98:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801e9b:	03 4f 04             	add    0x4(%edi),%ecx
+  801e9e:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ea3:	f7 e1                	mul    %ecx
+  801ea5:	c1 ea 0c             	shr    $0xc,%edx
+  801ea8:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801eae:	29 d1                	sub    %edx,%ecx
+  801eb0:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801eb3:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801eb8:	83 c4 10             	add    $0x10,%esp
+  801ebb:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  801ebf:	75 0b                	jne    801ecc <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  801ec1:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801ec4:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  801ec7:	e9 f3 fe ff ff       	jmp    801dbf <devpipe_write+0x1d>
+		*sleeping = 0;
+  801ecc:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  801ed3:	83 ec 08             	sub    $0x8,%esp
+  801ed6:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  801edb:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  801ede:	50                   	push   %eax
+  801edf:	e8 b1 f2 ff ff       	call   801195 <sys_futex_wake>
+  801ee4:	83 c4 10             	add    $0x10,%esp
+  801ee7:	eb d8                	jmp    801ec1 <devpipe_write+0x11f>
+				return 0;
+  801ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef1:	5b                   	pop    %ebx
+  801ef2:	5e                   	pop    %esi
+  801ef3:	5f                   	pop    %edi
+  801ef4:	5d                   	pop    %ebp
+  801ef5:	c3                   	ret
+
+00801ef6 <pipe>:
+{
+  801ef6:	55                   	push   %ebp
+  801ef7:	89 e5                	mov    %esp,%ebp
+  801ef9:	56                   	push   %esi
+  801efa:	53                   	push   %ebx
+  801efb:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  801efe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f01:	50                   	push   %eax
+  801f02:	e8 27 f3 ff ff       	call   80122e <fd_alloc>
+  801f07:	89 c3                	mov    %eax,%ebx
+  801f09:	83 c4 10             	add    $0x10,%esp
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	0f 88 23 01 00 00    	js     802037 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f14:	83 ec 04             	sub    $0x4,%esp
+  801f17:	68 07 04 00 00       	push   $0x407
+  801f1c:	ff 75 f4             	push   -0xc(%ebp)
+  801f1f:	6a 00                	push   $0x0
+  801f21:	e8 46 ed ff ff       	call   800c6c <sys_page_alloc>
+  801f26:	89 c3                	mov    %eax,%ebx
+  801f28:	83 c4 10             	add    $0x10,%esp
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	0f 88 04 01 00 00    	js     802037 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  801f33:	83 ec 0c             	sub    $0xc,%esp
+  801f36:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f39:	50                   	push   %eax
+  801f3a:	e8 ef f2 ff ff       	call   80122e <fd_alloc>
+  801f3f:	89 c3                	mov    %eax,%ebx
+  801f41:	83 c4 10             	add    $0x10,%esp
+  801f44:	85 c0                	test   %eax,%eax
+  801f46:	0f 88 db 00 00 00    	js     802027 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f4c:	83 ec 04             	sub    $0x4,%esp
+  801f4f:	68 07 04 00 00       	push   $0x407
+  801f54:	ff 75 f0             	push   -0x10(%ebp)
+  801f57:	6a 00                	push   $0x0
+  801f59:	e8 0e ed ff ff       	call   800c6c <sys_page_alloc>
+  801f5e:	89 c3                	mov    %eax,%ebx
+  801f60:	83 c4 10             	add    $0x10,%esp
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	0f 88 bc 00 00 00    	js     802027 <pipe+0x131>
+	va = fd2data(fd0);
+  801f6b:	83 ec 0c             	sub    $0xc,%esp
+  801f6e:	ff 75 f4             	push   -0xc(%ebp)
+  801f71:	e8 a1 f2 ff ff       	call   801217 <fd2data>
+  801f76:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f78:	83 c4 0c             	add    $0xc,%esp
+  801f7b:	68 07 04 00 00       	push   $0x407
+  801f80:	50                   	push   %eax
+  801f81:	6a 00                	push   $0x0
+  801f83:	e8 e4 ec ff ff       	call   800c6c <sys_page_alloc>
+  801f88:	89 c3                	mov    %eax,%ebx
+  801f8a:	83 c4 10             	add    $0x10,%esp
+  801f8d:	85 c0                	test   %eax,%eax
+  801f8f:	0f 88 82 00 00 00    	js     802017 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f95:	83 ec 0c             	sub    $0xc,%esp
+  801f98:	ff 75 f0             	push   -0x10(%ebp)
+  801f9b:	e8 77 f2 ff ff       	call   801217 <fd2data>
+  801fa0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801fa7:	50                   	push   %eax
+  801fa8:	6a 00                	push   $0x0
+  801faa:	56                   	push   %esi
+  801fab:	6a 00                	push   $0x0
+  801fad:	e8 fd ec ff ff       	call   800caf <sys_page_map>
+  801fb2:	89 c3                	mov    %eax,%ebx
+  801fb4:	83 c4 20             	add    $0x20,%esp
+  801fb7:	85 c0                	test   %eax,%eax
+  801fb9:	78 4e                	js     802009 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  801fbb:	a1 20 30 80 00       	mov    0x803020,%eax
+  801fc0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fc3:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  801fc5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fc8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  801fcf:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  801fd2:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  801fd4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  801fd7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  801fde:	83 ec 0c             	sub    $0xc,%esp
+  801fe1:	ff 75 f4             	push   -0xc(%ebp)
+  801fe4:	e8 1e f2 ff ff       	call   801207 <fd2num>
+  801fe9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801fec:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  801fee:	83 c4 04             	add    $0x4,%esp
+  801ff1:	ff 75 f0             	push   -0x10(%ebp)
+  801ff4:	e8 0e f2 ff ff       	call   801207 <fd2num>
+  801ff9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801ffc:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  801fff:	83 c4 10             	add    $0x10,%esp
+  802002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802007:	eb 2e                	jmp    802037 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802009:	83 ec 08             	sub    $0x8,%esp
+  80200c:	56                   	push   %esi
+  80200d:	6a 00                	push   $0x0
+  80200f:	e8 dd ec ff ff       	call   800cf1 <sys_page_unmap>
+  802014:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802017:	83 ec 08             	sub    $0x8,%esp
+  80201a:	ff 75 f0             	push   -0x10(%ebp)
+  80201d:	6a 00                	push   $0x0
+  80201f:	e8 cd ec ff ff       	call   800cf1 <sys_page_unmap>
+  802024:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802027:	83 ec 08             	sub    $0x8,%esp
+  80202a:	ff 75 f4             	push   -0xc(%ebp)
+  80202d:	6a 00                	push   $0x0
+  80202f:	e8 bd ec ff ff       	call   800cf1 <sys_page_unmap>
+  802034:	83 c4 10             	add    $0x10,%esp
+}
+  802037:	89 d8                	mov    %ebx,%eax
+  802039:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80203c:	5b                   	pop    %ebx
+  80203d:	5e                   	pop    %esi
+  80203e:	5d                   	pop    %ebp
+  80203f:	c3                   	ret
+
+00802040 <pipeisclosed>:
+{
+  802040:	55                   	push   %ebp
+  802041:	89 e5                	mov    %esp,%ebp
+  802043:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802046:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802049:	50                   	push   %eax
+  80204a:	ff 75 08             	push   0x8(%ebp)
+  80204d:	e8 30 f2 ff ff       	call   801282 <fd_lookup>
+  802052:	83 c4 10             	add    $0x10,%esp
+  802055:	85 c0                	test   %eax,%eax
+  802057:	78 18                	js     802071 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802059:	83 ec 0c             	sub    $0xc,%esp
+  80205c:	ff 75 f4             	push   -0xc(%ebp)
+  80205f:	e8 b3 f1 ff ff       	call   801217 <fd2data>
+  802064:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802066:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802069:	e8 a8 fb ff ff       	call   801c16 <_pipeisclosed>
+  80206e:	83 c4 10             	add    $0x10,%esp
+}
+  802071:	c9                   	leave
+  802072:	c3                   	ret
+
+00802073 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802073:	b8 00 00 00 00       	mov    $0x0,%eax
+  802078:	c3                   	ret
+
+00802079 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802079:	55                   	push   %ebp
+  80207a:	89 e5                	mov    %esp,%ebp
+  80207c:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80207f:	68 d6 2b 80 00       	push   $0x802bd6
+  802084:	ff 75 0c             	push   0xc(%ebp)
+  802087:	e8 ed e6 ff ff       	call   800779 <strcpy>
+	return 0;
+}
+  80208c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802091:	c9                   	leave
+  802092:	c3                   	ret
+
+00802093 <devcons_write>:
+{
+  802093:	55                   	push   %ebp
+  802094:	89 e5                	mov    %esp,%ebp
+  802096:	57                   	push   %edi
+  802097:	56                   	push   %esi
+  802098:	53                   	push   %ebx
+  802099:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80209f:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8020a4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8020aa:	eb 2e                	jmp    8020da <devcons_write+0x47>
+		m = n - tot;
+  8020ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8020af:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8020b1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8020b6:	39 c3                	cmp    %eax,%ebx
+  8020b8:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8020bb:	83 ec 04             	sub    $0x4,%esp
+  8020be:	53                   	push   %ebx
+  8020bf:	89 f0                	mov    %esi,%eax
+  8020c1:	03 45 0c             	add    0xc(%ebp),%eax
+  8020c4:	50                   	push   %eax
+  8020c5:	57                   	push   %edi
+  8020c6:	e8 34 e8 ff ff       	call   8008ff <memmove>
+		sys_cputs(buf, m);
+  8020cb:	83 c4 08             	add    $0x8,%esp
+  8020ce:	53                   	push   %ebx
+  8020cf:	57                   	push   %edi
+  8020d0:	e8 ca ea ff ff       	call   800b9f <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8020d5:	01 de                	add    %ebx,%esi
+  8020d7:	83 c4 10             	add    $0x10,%esp
+  8020da:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8020dd:	72 cd                	jb     8020ac <devcons_write+0x19>
+}
+  8020df:	89 f0                	mov    %esi,%eax
+  8020e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e4:	5b                   	pop    %ebx
+  8020e5:	5e                   	pop    %esi
+  8020e6:	5f                   	pop    %edi
+  8020e7:	5d                   	pop    %ebp
+  8020e8:	c3                   	ret
+
+008020e9 <devcons_read>:
+{
+  8020e9:	55                   	push   %ebp
+  8020ea:	89 e5                	mov    %esp,%ebp
+  8020ec:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8020ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8020f8:	75 07                	jne    802101 <devcons_read+0x18>
+  8020fa:	eb 1f                	jmp    80211b <devcons_read+0x32>
+		sys_yield();
+  8020fc:	e8 4c eb ff ff       	call   800c4d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802101:	e8 c8 ea ff ff       	call   800bce <sys_cgetc>
+  802106:	85 c0                	test   %eax,%eax
+  802108:	74 f2                	je     8020fc <devcons_read+0x13>
+	if (c < 0)
+  80210a:	78 0f                	js     80211b <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80210c:	83 f8 04             	cmp    $0x4,%eax
+  80210f:	74 0c                	je     80211d <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802111:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802114:	88 02                	mov    %al,(%edx)
+	return 1;
+  802116:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80211b:	c9                   	leave
+  80211c:	c3                   	ret
+		return 0;
+  80211d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802122:	eb f7                	jmp    80211b <devcons_read+0x32>
+
+00802124 <cputchar>:
+{
+  802124:	55                   	push   %ebp
+  802125:	89 e5                	mov    %esp,%ebp
+  802127:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80212a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80212d:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802130:	6a 01                	push   $0x1
+  802132:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802135:	50                   	push   %eax
+  802136:	e8 64 ea ff ff       	call   800b9f <sys_cputs>
+}
+  80213b:	83 c4 10             	add    $0x10,%esp
+  80213e:	c9                   	leave
+  80213f:	c3                   	ret
+
+00802140 <getchar>:
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802146:	6a 01                	push   $0x1
+  802148:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80214b:	50                   	push   %eax
+  80214c:	6a 00                	push   $0x0
+  80214e:	e8 8e f3 ff ff       	call   8014e1 <read>
+	if (r < 0)
+  802153:	83 c4 10             	add    $0x10,%esp
+  802156:	85 c0                	test   %eax,%eax
+  802158:	78 06                	js     802160 <getchar+0x20>
+	if (r < 1)
+  80215a:	74 06                	je     802162 <getchar+0x22>
+	return c;
+  80215c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802160:	c9                   	leave
+  802161:	c3                   	ret
+		return -E_EOF;
+  802162:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802167:	eb f7                	jmp    802160 <getchar+0x20>
+
+00802169 <iscons>:
+{
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80216f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802172:	50                   	push   %eax
+  802173:	ff 75 08             	push   0x8(%ebp)
+  802176:	e8 07 f1 ff ff       	call   801282 <fd_lookup>
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	85 c0                	test   %eax,%eax
+  802180:	78 11                	js     802193 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802182:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802185:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  80218b:	39 10                	cmp    %edx,(%eax)
+  80218d:	0f 94 c0             	sete   %al
+  802190:	0f b6 c0             	movzbl %al,%eax
+}
+  802193:	c9                   	leave
+  802194:	c3                   	ret
+
+00802195 <opencons>:
+{
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  80219b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80219e:	50                   	push   %eax
+  80219f:	e8 8a f0 ff ff       	call   80122e <fd_alloc>
+  8021a4:	83 c4 10             	add    $0x10,%esp
+  8021a7:	85 c0                	test   %eax,%eax
+  8021a9:	78 3a                	js     8021e5 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8021ab:	83 ec 04             	sub    $0x4,%esp
+  8021ae:	68 07 04 00 00       	push   $0x407
+  8021b3:	ff 75 f4             	push   -0xc(%ebp)
+  8021b6:	6a 00                	push   $0x0
+  8021b8:	e8 af ea ff ff       	call   800c6c <sys_page_alloc>
+  8021bd:	83 c4 10             	add    $0x10,%esp
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	78 21                	js     8021e5 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8021c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c7:	8b 15 3c 30 80 00    	mov    0x80303c,%edx
+  8021cd:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8021cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021d2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8021d9:	83 ec 0c             	sub    $0xc,%esp
+  8021dc:	50                   	push   %eax
+  8021dd:	e8 25 f0 ff ff       	call   801207 <fd2num>
+  8021e2:	83 c4 10             	add    $0x10,%esp
+}
+  8021e5:	c9                   	leave
+  8021e6:	c3                   	ret
+
+008021e7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8021e7:	55                   	push   %ebp
+  8021e8:	89 e5                	mov    %esp,%ebp
+  8021ea:	56                   	push   %esi
+  8021eb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8021ec:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8021ef:	8b 35 00 30 80 00    	mov    0x803000,%esi
+  8021f5:	e8 34 ea ff ff       	call   800c2e <sys_getenvid>
+  8021fa:	83 ec 0c             	sub    $0xc,%esp
+  8021fd:	ff 75 0c             	push   0xc(%ebp)
+  802200:	ff 75 08             	push   0x8(%ebp)
+  802203:	56                   	push   %esi
+  802204:	50                   	push   %eax
+  802205:	68 e4 2b 80 00       	push   $0x802be4
+  80220a:	e8 83 df ff ff       	call   800192 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80220f:	83 c4 18             	add    $0x18,%esp
+  802212:	53                   	push   %ebx
+  802213:	ff 75 10             	push   0x10(%ebp)
+  802216:	e8 26 df ff ff       	call   800141 <vcprintf>
+	cprintf("\n");
+  80221b:	c7 04 24 cf 2b 80 00 	movl   $0x802bcf,(%esp)
+  802222:	e8 6b df ff ff       	call   800192 <cprintf>
+  802227:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80222a:	cc                   	int3
+	while (1)
+  80222b:	eb fd                	jmp    80222a <_panic+0x43>
+
+0080222d <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  80222d:	55                   	push   %ebp
+  80222e:	89 e5                	mov    %esp,%ebp
+  802230:	57                   	push   %edi
+  802231:	56                   	push   %esi
+  802232:	53                   	push   %ebx
+  802233:	83 ec 14             	sub    $0x14,%esp
+  802236:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802239:	8b 75 14             	mov    0x14(%ebp),%esi
+  80223c:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  80223f:	ff 75 10             	push   0x10(%ebp)
+  802242:	ff 75 0c             	push   0xc(%ebp)
+  802245:	e8 45 ee ff ff       	call   80108f <sys_ipc_recv_pages>
+  80224a:	83 c4 10             	add    $0x10,%esp
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	78 46                	js     802297 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  802251:	85 ff                	test   %edi,%edi
+  802253:	74 0d                	je     802262 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  802255:	a1 08 40 80 00       	mov    0x804008,%eax
+  80225a:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802260:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  802262:	85 f6                	test   %esi,%esi
+  802264:	74 0d                	je     802273 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  802266:	a1 08 40 80 00       	mov    0x804008,%eax
+  80226b:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  802271:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  802273:	85 db                	test   %ebx,%ebx
+  802275:	74 0d                	je     802284 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  802277:	a1 08 40 80 00       	mov    0x804008,%eax
+  80227c:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  802282:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802284:	a1 08 40 80 00       	mov    0x804008,%eax
+  802289:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80228f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802292:	5b                   	pop    %ebx
+  802293:	5e                   	pop    %esi
+  802294:	5f                   	pop    %edi
+  802295:	5d                   	pop    %ebp
+  802296:	c3                   	ret
+		if (from_env_store) {
+  802297:	85 ff                	test   %edi,%edi
+  802299:	74 06                	je     8022a1 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80229b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  8022a1:	85 f6                	test   %esi,%esi
+  8022a3:	74 06                	je     8022ab <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  8022a5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  8022ab:	85 db                	test   %ebx,%ebx
+  8022ad:	74 e0                	je     80228f <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  8022af:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8022b5:	eb d8                	jmp    80228f <ipc_recv_pages+0x62>
+
+008022b7 <ipc_recv>:
+{
+  8022b7:	55                   	push   %ebp
+  8022b8:	89 e5                	mov    %esp,%ebp
+  8022ba:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  8022bd:	6a 00                	push   $0x0
+  8022bf:	ff 75 10             	push   0x10(%ebp)
+  8022c2:	6a 01                	push   $0x1
+  8022c4:	ff 75 0c             	push   0xc(%ebp)
+  8022c7:	ff 75 08             	push   0x8(%ebp)
+  8022ca:	e8 5e ff ff ff       	call   80222d <ipc_recv_pages>
+}
+  8022cf:	c9                   	leave
+  8022d0:	c3                   	ret
+
+008022d1 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8022d1:	55                   	push   %ebp
+  8022d2:	89 e5                	mov    %esp,%ebp
+  8022d4:	56                   	push   %esi
+  8022d5:	53                   	push   %ebx
+  8022d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8022dc:	83 ec 0c             	sub    $0xc,%esp
+  8022df:	ff 75 0c             	push   0xc(%ebp)
+  8022e2:	e8 dc ee ff ff       	call   8011c3 <sys_ipc_try_recv>
+  8022e7:	83 c4 10             	add    $0x10,%esp
+  8022ea:	85 c0                	test   %eax,%eax
+  8022ec:	78 34                	js     802322 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8022ee:	85 f6                	test   %esi,%esi
+  8022f0:	74 0d                	je     8022ff <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8022f2:	a1 08 40 80 00       	mov    0x804008,%eax
+  8022f7:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8022fd:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8022ff:	85 db                	test   %ebx,%ebx
+  802301:	74 0d                	je     802310 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  802303:	a1 08 40 80 00       	mov    0x804008,%eax
+  802308:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80230e:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  802310:	a1 08 40 80 00       	mov    0x804008,%eax
+  802315:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  80231b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80231e:	5b                   	pop    %ebx
+  80231f:	5e                   	pop    %esi
+  802320:	5d                   	pop    %ebp
+  802321:	c3                   	ret
+		if (from_env_store) {
+  802322:	85 f6                	test   %esi,%esi
+  802324:	74 06                	je     80232c <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  802326:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  80232c:	85 db                	test   %ebx,%ebx
+  80232e:	74 eb                	je     80231b <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  802330:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802336:	eb e3                	jmp    80231b <ipc_try_recv+0x4a>
+
+00802338 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802338:	55                   	push   %ebp
+  802339:	89 e5                	mov    %esp,%ebp
+  80233b:	83 ec 14             	sub    $0x14,%esp
+  80233e:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  802341:	85 c0                	test   %eax,%eax
+  802343:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802348:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  80234b:	ff 75 18             	push   0x18(%ebp)
+  80234e:	ff 75 14             	push   0x14(%ebp)
+  802351:	50                   	push   %eax
+  802352:	ff 75 0c             	push   0xc(%ebp)
+  802355:	ff 75 08             	push   0x8(%ebp)
+  802358:	e8 f5 ec ff ff       	call   801052 <sys_ipc_send_pages>
+  80235d:	83 c4 20             	add    $0x20,%esp
+  802360:	85 c0                	test   %eax,%eax
+  802362:	78 02                	js     802366 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  802364:	c9                   	leave
+  802365:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  802366:	50                   	push   %eax
+  802367:	68 08 2c 80 00       	push   $0x802c08
+  80236c:	68 80 00 00 00       	push   $0x80
+  802371:	68 34 2c 80 00       	push   $0x802c34
+  802376:	e8 6c fe ff ff       	call   8021e7 <_panic>
+
+0080237b <ipc_send>:
+{
+  80237b:	55                   	push   %ebp
+  80237c:	89 e5                	mov    %esp,%ebp
+  80237e:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  802381:	ff 75 14             	push   0x14(%ebp)
+  802384:	6a 01                	push   $0x1
+  802386:	ff 75 10             	push   0x10(%ebp)
+  802389:	ff 75 0c             	push   0xc(%ebp)
+  80238c:	ff 75 08             	push   0x8(%ebp)
+  80238f:	e8 a4 ff ff ff       	call   802338 <ipc_send_pages>
+}
+  802394:	83 c4 20             	add    $0x20,%esp
+  802397:	c9                   	leave
+  802398:	c3                   	ret
+
+00802399 <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  802399:	55                   	push   %ebp
+  80239a:	89 e5                	mov    %esp,%ebp
+  80239c:	83 ec 14             	sub    $0x14,%esp
+  80239f:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8023a2:	85 c0                	test   %eax,%eax
+  8023a4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023a9:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8023ac:	ff 75 18             	push   0x18(%ebp)
+  8023af:	ff 75 14             	push   0x14(%ebp)
+  8023b2:	50                   	push   %eax
+  8023b3:	ff 75 0c             	push   0xc(%ebp)
+  8023b6:	ff 75 08             	push   0x8(%ebp)
+  8023b9:	e8 25 ed ff ff       	call   8010e3 <sys_ipc_call>
+  8023be:	83 c4 20             	add    $0x20,%esp
+  8023c1:	85 c0                	test   %eax,%eax
+  8023c3:	78 0b                	js     8023d0 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  8023c5:	a1 08 40 80 00       	mov    0x804008,%eax
+  8023ca:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8023d0:	c9                   	leave
+  8023d1:	c3                   	ret
+
+008023d2 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  8023d2:	55                   	push   %ebp
+  8023d3:	89 e5                	mov    %esp,%ebp
+  8023d5:	57                   	push   %edi
+  8023d6:	56                   	push   %esi
+  8023d7:	53                   	push   %ebx
+  8023d8:	83 ec 18             	sub    $0x18,%esp
+  8023db:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023de:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  8023e1:	8b 75 20             	mov    0x20(%ebp),%esi
+  8023e4:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  8023e7:	85 c0                	test   %eax,%eax
+  8023e9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8023ee:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  8023f1:	ff 75 18             	push   0x18(%ebp)
+  8023f4:	ff 75 14             	push   0x14(%ebp)
+  8023f7:	50                   	push   %eax
+  8023f8:	ff 75 0c             	push   0xc(%ebp)
+  8023fb:	ff 75 08             	push   0x8(%ebp)
+  8023fe:	e8 21 ed ff ff       	call   801124 <sys_ipc_reply_recv>
+  802403:	83 c4 20             	add    $0x20,%esp
+  802406:	85 c0                	test   %eax,%eax
+  802408:	78 46                	js     802450 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  80240a:	85 ff                	test   %edi,%edi
+  80240c:	74 0d                	je     80241b <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  80240e:	a1 08 40 80 00       	mov    0x804008,%eax
+  802413:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  802419:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  80241b:	85 f6                	test   %esi,%esi
+  80241d:	74 0d                	je     80242c <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  80241f:	a1 08 40 80 00       	mov    0x804008,%eax
+  802424:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  80242a:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  80242c:	85 db                	test   %ebx,%ebx
+  80242e:	74 0d                	je     80243d <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  802430:	a1 08 40 80 00       	mov    0x804008,%eax
+  802435:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  80243b:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  80243d:	a1 08 40 80 00       	mov    0x804008,%eax
+  802442:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  802448:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80244b:	5b                   	pop    %ebx
+  80244c:	5e                   	pop    %esi
+  80244d:	5f                   	pop    %edi
+  80244e:	5d                   	pop    %ebp
+  80244f:	c3                   	ret
+		if (from_env_store) {
+  802450:	85 ff                	test   %edi,%edi
+  802452:	74 06                	je     80245a <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  802454:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  80245a:	85 f6                	test   %esi,%esi
+  80245c:	74 06                	je     802464 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  80245e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  802464:	85 db                	test   %ebx,%ebx
+  802466:	74 e0                	je     802448 <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  802468:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80246e:	eb d8                	jmp    802448 <ipc_reply_recv+0x76>
+
+00802470 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802470:	55                   	push   %ebp
+  802471:	89 e5                	mov    %esp,%ebp
+  802473:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  802476:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  80247b:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  80247e:	c1 e0 06             	shl    $0x6,%eax
+  802481:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802486:	8b 40 50             	mov    0x50(%eax),%eax
+  802489:	39 c8                	cmp    %ecx,%eax
+  80248b:	74 12                	je     80249f <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  80248d:	83 c2 01             	add    $0x1,%edx
+  802490:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802496:	75 e3                	jne    80247b <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  802498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249d:	eb 0e                	jmp    8024ad <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  80249f:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8024a2:	c1 e0 06             	shl    $0x6,%eax
+  8024a5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8024aa:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8024ad:	5d                   	pop    %ebp
+  8024ae:	c3                   	ret
+
+008024af <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8024af:	55                   	push   %ebp
+  8024b0:	89 e5                	mov    %esp,%ebp
+  8024b2:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024b5:	89 c2                	mov    %eax,%edx
+  8024b7:	c1 ea 16             	shr    $0x16,%edx
+  8024ba:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8024c1:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8024c6:	f6 c1 01             	test   $0x1,%cl
+  8024c9:	74 1e                	je     8024e9 <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  8024cb:	c1 e8 0c             	shr    $0xc,%eax
+  8024ce:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8024d5:	a8 01                	test   $0x1,%al
+  8024d7:	74 10                	je     8024e9 <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8024d9:	c1 e8 0c             	shr    $0xc,%eax
+  8024dc:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8024df:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  8024e6:	0f b7 d2             	movzwl %dx,%edx
+}
+  8024e9:	89 d0                	mov    %edx,%eax
+  8024eb:	5d                   	pop    %ebp
+  8024ec:	c3                   	ret
+
+008024ed <udivmod>:
+  8024ed:	55                   	push   %ebp
+  8024ee:	57                   	push   %edi
+  8024ef:	56                   	push   %esi
+  8024f0:	53                   	push   %ebx
+  8024f1:	83 ec 24             	sub    $0x24,%esp
+  8024f4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8024f8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8024fc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802500:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802504:	89 44 24 10          	mov    %eax,0x10(%esp)
+  802508:	89 54 24 14          	mov    %edx,0x14(%esp)
+  80250c:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  802510:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80251a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80251f:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  802526:	00 
+  802527:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  80252e:	00 
+  80252f:	89 fb                	mov    %edi,%ebx
+  802531:	eb 08                	jmp    80253b <udivmod+0x4e>
+  802533:	83 e9 01             	sub    $0x1,%ecx
+  802536:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  802539:	74 68                	je     8025a3 <udivmod+0xb6>
+  80253b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80253f:	01 c0                	add    %eax,%eax
+  802541:	89 c6                	mov    %eax,%esi
+  802543:	89 d7                	mov    %edx,%edi
+  802545:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802549:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80254d:	0f ad d0             	shrd   %cl,%edx,%eax
+  802550:	d3 ea                	shr    %cl,%edx
+  802552:	f6 c1 20             	test   $0x20,%cl
+  802555:	74 04                	je     80255b <udivmod+0x6e>
+  802557:	89 d0                	mov    %edx,%eax
+  802559:	31 d2                	xor    %edx,%edx
+  80255b:	83 e0 01             	and    $0x1,%eax
+  80255e:	89 04 24             	mov    %eax,(%esp)
+  802561:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  802568:	00 
+  802569:	8b 04 24             	mov    (%esp),%eax
+  80256c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  802570:	09 f0                	or     %esi,%eax
+  802572:	09 fa                	or     %edi,%edx
+  802574:	8b 74 24 10          	mov    0x10(%esp),%esi
+  802578:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80257c:	39 f0                	cmp    %esi,%eax
+  80257e:	89 d5                	mov    %edx,%ebp
+  802580:	19 fd                	sbb    %edi,%ebp
+  802582:	72 af                	jb     802533 <udivmod+0x46>
+  802584:	29 f0                	sub    %esi,%eax
+  802586:	19 fa                	sbb    %edi,%edx
+  802588:	89 cf                	mov    %ecx,%edi
+  80258a:	c1 ef 05             	shr    $0x5,%edi
+  80258d:	83 e7 01             	and    $0x1,%edi
+  802590:	89 fe                	mov    %edi,%esi
+  802592:	83 f6 01             	xor    $0x1,%esi
+  802595:	d3 e6                	shl    %cl,%esi
+  802597:	d3 e7                	shl    %cl,%edi
+  802599:	09 74 24 18          	or     %esi,0x18(%esp)
+  80259d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  8025a1:	eb 90                	jmp    802533 <udivmod+0x46>
+  8025a3:	85 db                	test   %ebx,%ebx
+  8025a5:	74 05                	je     8025ac <udivmod+0xbf>
+  8025a7:	89 03                	mov    %eax,(%ebx)
+  8025a9:	89 53 04             	mov    %edx,0x4(%ebx)
+  8025ac:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025b0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025b4:	83 c4 24             	add    $0x24,%esp
+  8025b7:	5b                   	pop    %ebx
+  8025b8:	5e                   	pop    %esi
+  8025b9:	5f                   	pop    %edi
+  8025ba:	5d                   	pop    %ebp
+  8025bb:	c3                   	ret
+
+008025bc <__udivdi3>:
+  8025bc:	83 ec 08             	sub    $0x8,%esp
+  8025bf:	6a 00                	push   $0x0
+  8025c1:	ff 74 24 1c          	push   0x1c(%esp)
+  8025c5:	ff 74 24 1c          	push   0x1c(%esp)
+  8025c9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025cd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025d1:	e8 17 ff ff ff       	call   8024ed <udivmod>
+  8025d6:	83 c4 14             	add    $0x14,%esp
+  8025d9:	c3                   	ret
+
+008025da <__umoddi3>:
+  8025da:	83 ec 18             	sub    $0x18,%esp
+  8025dd:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8025e1:	50                   	push   %eax
+  8025e2:	ff 74 24 2c          	push   0x2c(%esp)
+  8025e6:	ff 74 24 2c          	push   0x2c(%esp)
+  8025ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8025ee:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8025f2:	e8 f6 fe ff ff       	call   8024ed <udivmod>
+  8025f7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8025fb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8025ff:	83 c4 24             	add    $0x24,%esp
+  802602:	c3                   	ret
+
+00802603 <__divdi3>:
+  802603:	55                   	push   %ebp
+  802604:	57                   	push   %edi
+  802605:	56                   	push   %esi
+  802606:	53                   	push   %ebx
+  802607:	83 ec 10             	sub    $0x10,%esp
+  80260a:	8b 44 24 24          	mov    0x24(%esp),%eax
+  80260e:	8b 54 24 28          	mov    0x28(%esp),%edx
+  802612:	89 c6                	mov    %eax,%esi
+  802614:	89 d7                	mov    %edx,%edi
+  802616:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  80261a:	33 7c 24 30          	xor    0x30(%esp),%edi
+  80261e:	89 74 24 04          	mov    %esi,0x4(%esp)
+  802622:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  802626:	89 c5                	mov    %eax,%ebp
+  802628:	f7 dd                	neg    %ebp
+  80262a:	89 d6                	mov    %edx,%esi
+  80262c:	83 d6 00             	adc    $0x0,%esi
+  80262f:	f7 de                	neg    %esi
+  802631:	0f 48 e8             	cmovs  %eax,%ebp
+  802634:	0f 49 d6             	cmovns %esi,%edx
+  802637:	6a 00                	push   $0x0
+  802639:	8b 74 24 30          	mov    0x30(%esp),%esi
+  80263d:	f7 de                	neg    %esi
+  80263f:	8b 44 24 34          	mov    0x34(%esp),%eax
+  802643:	83 d0 00             	adc    $0x0,%eax
+  802646:	f7 d8                	neg    %eax
+  802648:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  80264d:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  802652:	50                   	push   %eax
+  802653:	56                   	push   %esi
+  802654:	89 e8                	mov    %ebp,%eax
+  802656:	e8 92 fe ff ff       	call   8024ed <udivmod>
+  80265b:	83 c4 10             	add    $0x10,%esp
+  80265e:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  802663:	78 08                	js     80266d <__divdi3+0x6a>
+  802665:	83 c4 0c             	add    $0xc,%esp
+  802668:	5b                   	pop    %ebx
+  802669:	5e                   	pop    %esi
+  80266a:	5f                   	pop    %edi
+  80266b:	5d                   	pop    %ebp
+  80266c:	c3                   	ret
+  80266d:	f7 d8                	neg    %eax
+  80266f:	83 d2 00             	adc    $0x0,%edx
+  802672:	f7 da                	neg    %edx
+  802674:	eb ef                	jmp    802665 <__divdi3+0x62>
+
+00802676 <__moddi3>:
+  802676:	55                   	push   %ebp
+  802677:	57                   	push   %edi
+  802678:	56                   	push   %esi
+  802679:	53                   	push   %ebx
+  80267a:	83 ec 18             	sub    $0x18,%esp
+  80267d:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  802681:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  802685:	89 f1                	mov    %esi,%ecx
+  802687:	f7 d9                	neg    %ecx
+  802689:	89 da                	mov    %ebx,%edx
+  80268b:	83 d2 00             	adc    $0x0,%edx
+  80268e:	f7 da                	neg    %edx
+  802690:	0f 48 ce             	cmovs  %esi,%ecx
+  802693:	0f 48 d3             	cmovs  %ebx,%edx
+  802696:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80269a:	50                   	push   %eax
+  80269b:	8b 74 24 38          	mov    0x38(%esp),%esi
+  80269f:	f7 de                	neg    %esi
+  8026a1:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  8026a5:	83 d0 00             	adc    $0x0,%eax
+  8026a8:	f7 d8                	neg    %eax
+  8026aa:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  8026af:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  8026b4:	50                   	push   %eax
+  8026b5:	56                   	push   %esi
+  8026b6:	89 c8                	mov    %ecx,%eax
+  8026b8:	e8 30 fe ff ff       	call   8024ed <udivmod>
+  8026bd:	83 c4 10             	add    $0x10,%esp
+  8026c0:	85 db                	test   %ebx,%ebx
+  8026c2:	78 10                	js     8026d4 <__moddi3+0x5e>
+  8026c4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026c8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026cc:	83 c4 14             	add    $0x14,%esp
+  8026cf:	5b                   	pop    %ebx
+  8026d0:	5e                   	pop    %esi
+  8026d1:	5f                   	pop    %edi
+  8026d2:	5d                   	pop    %ebp
+  8026d3:	c3                   	ret
+  8026d4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8026d8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8026dc:	f7 d8                	neg    %eax
+  8026de:	83 d2 00             	adc    $0x0,%edx
+  8026e1:	f7 da                	neg    %edx
+  8026e3:	eb e7                	jmp    8026cc <__moddi3+0x56>
@@ -0,0 +1,9993 @@
+
+obj/user/zigzag.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 6a 01 00 00       	call   80019b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define SIZE 0x8000000
+#define BASE 0x10000000
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+	int r, perm;
+	uintptr_t va;
+
+	if((r = page_alloc(0, (void*) 0x0f000000, PTE_P|PTE_U|PTE_W, 1)) < 0)
+  800038:	6a 01                	push   $0x1
+  80003a:	6a 07                	push   $0x7
+  80003c:	68 00 00 00 0f       	push   $0xf000000
+  800041:	6a 00                	push   $0x0
+  800043:	e8 6d 35 00 00       	call   8035b5 <page_alloc>
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	85 c0                	test   %eax,%eax
+  80004d:	78 56                	js     8000a5 <umain+0x72>
+		panic("sys_page_alloc on %p: %e", (void*) 0x0f000000, r);
+
+	for(va = BASE+SIZE-PGSIZE; va >= BASE; va-=PGSIZE){
+  80004f:	bb 00 f0 ff 17       	mov    $0x17fff000,%ebx
+		//cprintf("+%x\n", va);
+		perm = PTE_P|PTE_U|PTE_W;
+		if ((va % 1000) == 0)
+  800054:	be d3 4d 62 10       	mov    $0x10624dd3,%esi
+  800059:	89 d8                	mov    %ebx,%eax
+  80005b:	f7 e6                	mul    %esi
+  80005d:	c1 ea 06             	shr    $0x6,%edx
+  800060:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+  800066:	89 d8                	mov    %ebx,%eax
+  800068:	29 d0                	sub    %edx,%eax
+		perm = PTE_P|PTE_U|PTE_W;
+  80006a:	83 f8 01             	cmp    $0x1,%eax
+  80006d:	19 c0                	sbb    %eax,%eax
+  80006f:	25 00 04 00 00       	and    $0x400,%eax
+  800074:	83 c0 07             	add    $0x7,%eax
+			perm |= PTE_SHARE;
+		if((r = page_alloc(0, (void*) va, perm, 1)) < 0)
+  800077:	6a 01                	push   $0x1
+  800079:	50                   	push   %eax
+  80007a:	53                   	push   %ebx
+  80007b:	6a 00                	push   $0x0
+  80007d:	e8 33 35 00 00       	call   8035b5 <page_alloc>
+  800082:	83 c4 10             	add    $0x10,%esp
+  800085:	85 c0                	test   %eax,%eax
+  800087:	78 36                	js     8000bf <umain+0x8c>
+			panic("sys_page_alloc on %p: %e", va, r);
+
+		// Store the address in the page
+		*(uintptr_t*)va = (uintptr_t)va;
+  800089:	89 1b                	mov    %ebx,(%ebx)
+	for(va = BASE+SIZE-PGSIZE; va >= BASE; va-=PGSIZE){
+  80008b:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  800091:	81 fb 00 f0 ff 0f    	cmp    $0xffff000,%ebx
+  800097:	75 c0                	jne    800059 <umain+0x26>
+	}
+
+	for(va = BASE; va < BASE+(SIZE/2); va+=PGSIZE){
+  800099:	b9 00 00 00 10       	mov    $0x10000000,%ecx
+		//cprintf("+%x=%x\n", va, *(uintptr_t*)va);
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+		if ((va % 1000) == 0)
+  80009e:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+  8000a3:	eb 65                	jmp    80010a <umain+0xd7>
+		panic("sys_page_alloc on %p: %e", (void*) 0x0f000000, r);
+  8000a5:	83 ec 0c             	sub    $0xc,%esp
+  8000a8:	50                   	push   %eax
+  8000a9:	68 00 00 00 0f       	push   $0xf000000
+  8000ae:	68 c7 4d 80 00       	push   $0x804dc7
+  8000b3:	6a 12                	push   $0x12
+  8000b5:	68 e0 4d 80 00       	push   $0x804de0
+  8000ba:	e8 3f 01 00 00       	call   8001fe <_panic>
+			panic("sys_page_alloc on %p: %e", va, r);
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	50                   	push   %eax
+  8000c3:	53                   	push   %ebx
+  8000c4:	68 c7 4d 80 00       	push   $0x804dc7
+  8000c9:	6a 1a                	push   $0x1a
+  8000cb:	68 e0 4d 80 00       	push   $0x804de0
+  8000d0:	e8 29 01 00 00       	call   8001fe <_panic>
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+  8000d5:	68 44 4e 80 00       	push   $0x804e44
+  8000da:	68 fb 4d 80 00       	push   $0x804dfb
+  8000df:	6a 22                	push   $0x22
+  8000e1:	68 e0 4d 80 00       	push   $0x804de0
+  8000e6:	e8 13 01 00 00       	call   8001fe <_panic>
+			assert(uvpt[PGNUM(va)] & PTE_SHARE);
+		else
+			assert(!(uvpt[PGNUM(va)] & PTE_SHARE));
+  8000eb:	89 c8                	mov    %ecx,%eax
+  8000ed:	c1 e8 0c             	shr    $0xc,%eax
+  8000f0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8000f7:	f6 c4 04             	test   $0x4,%ah
+  8000fa:	75 4a                	jne    800146 <umain+0x113>
+	for(va = BASE; va < BASE+(SIZE/2); va+=PGSIZE){
+  8000fc:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+  800102:	81 f9 00 00 00 14    	cmp    $0x14000000,%ecx
+  800108:	74 52                	je     80015c <umain+0x129>
+		assert(*(uintptr_t*)va == (uintptr_t)va);
+  80010a:	39 09                	cmp    %ecx,(%ecx)
+  80010c:	75 c7                	jne    8000d5 <umain+0xa2>
+		if ((va % 1000) == 0)
+  80010e:	89 c8                	mov    %ecx,%eax
+  800110:	f7 e3                	mul    %ebx
+  800112:	c1 ea 06             	shr    $0x6,%edx
+  800115:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+  80011b:	39 d1                	cmp    %edx,%ecx
+  80011d:	75 cc                	jne    8000eb <umain+0xb8>
+			assert(uvpt[PGNUM(va)] & PTE_SHARE);
+  80011f:	89 c8                	mov    %ecx,%eax
+  800121:	c1 e8 0c             	shr    $0xc,%eax
+  800124:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80012b:	f6 c4 04             	test   $0x4,%ah
+  80012e:	75 cc                	jne    8000fc <umain+0xc9>
+  800130:	68 10 4e 80 00       	push   $0x804e10
+  800135:	68 fb 4d 80 00       	push   $0x804dfb
+  80013a:	6a 24                	push   $0x24
+  80013c:	68 e0 4d 80 00       	push   $0x804de0
+  800141:	e8 b8 00 00 00       	call   8001fe <_panic>
+			assert(!(uvpt[PGNUM(va)] & PTE_SHARE));
+  800146:	68 68 4e 80 00       	push   $0x804e68
+  80014b:	68 fb 4d 80 00       	push   $0x804dfb
+  800150:	6a 26                	push   $0x26
+  800152:	68 e0 4d 80 00       	push   $0x804de0
+  800157:	e8 a2 00 00 00       	call   8001fe <_panic>
+	}
+
+	sys_cputs((char*)0x0f000000, 1);
+  80015c:	83 ec 08             	sub    $0x8,%esp
+  80015f:	6a 01                	push   $0x1
+  800161:	68 00 00 00 0f       	push   $0xf000000
+  800166:	e8 7b 0b 00 00       	call   800ce6 <sys_cputs>
+
+	cprintf("%s: Passed all checks!\n", argc > 0 ? argv[0] : "zigzag");
+  80016b:	83 c4 10             	add    $0x10,%esp
+  80016e:	b8 c0 4d 80 00       	mov    $0x804dc0,%eax
+  800173:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  800177:	7e 05                	jle    80017e <umain+0x14b>
+  800179:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80017c:	8b 00                	mov    (%eax),%eax
+  80017e:	83 ec 08             	sub    $0x8,%esp
+  800181:	50                   	push   %eax
+  800182:	68 2c 4e 80 00       	push   $0x804e2c
+  800187:	e8 4d 01 00 00       	call   8002d9 <cprintf>
+	get_and_print_paging_stats();
+  80018c:	e8 5e 30 00 00       	call   8031ef <get_and_print_paging_stats>
+}
+  800191:	83 c4 10             	add    $0x10,%esp
+  800194:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800197:	5b                   	pop    %ebx
+  800198:	5e                   	pop    %esi
+  800199:	5d                   	pop    %ebp
+  80019a:	c3                   	ret
+
+0080019b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80019b:	55                   	push   %ebp
+  80019c:	89 e5                	mov    %esp,%ebp
+  80019e:	56                   	push   %esi
+  80019f:	53                   	push   %ebx
+  8001a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001a3:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = envs + ENVX(sys_getenvid());
+  8001a6:	e8 ca 0b 00 00       	call   800d75 <sys_getenvid>
+  8001ab:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001b0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8001b3:	c1 e0 06             	shl    $0x6,%eax
+  8001b6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001bb:	a3 18 e9 80 00       	mov    %eax,0x80e918
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001c0:	85 db                	test   %ebx,%ebx
+  8001c2:	7e 07                	jle    8001cb <libmain+0x30>
+		binaryname = argv[0];
+  8001c4:	8b 06                	mov    (%esi),%eax
+  8001c6:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// call user main routine
+	umain(argc, argv);
+  8001cb:	83 ec 08             	sub    $0x8,%esp
+  8001ce:	56                   	push   %esi
+  8001cf:	53                   	push   %ebx
+  8001d0:	e8 5e fe ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8001d5:	e8 0a 00 00 00       	call   8001e4 <exit>
+}
+  8001da:	83 c4 10             	add    $0x10,%esp
+  8001dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001e0:	5b                   	pop    %ebx
+  8001e1:	5e                   	pop    %esi
+  8001e2:	5d                   	pop    %ebp
+  8001e3:	c3                   	ret
+
+008001e4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001e4:	55                   	push   %ebp
+  8001e5:	89 e5                	mov    %esp,%ebp
+  8001e7:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001ea:	e8 2a 13 00 00       	call   801519 <close_all>
+	sys_env_destroy(0);
+  8001ef:	83 ec 0c             	sub    $0xc,%esp
+  8001f2:	6a 00                	push   $0x0
+  8001f4:	e8 3b 0b 00 00       	call   800d34 <sys_env_destroy>
+}
+  8001f9:	83 c4 10             	add    $0x10,%esp
+  8001fc:	c9                   	leave
+  8001fd:	c3                   	ret
+
+008001fe <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001fe:	55                   	push   %ebp
+  8001ff:	89 e5                	mov    %esp,%ebp
+  800201:	56                   	push   %esi
+  800202:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800203:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800206:	8b 35 00 60 80 00    	mov    0x806000,%esi
+  80020c:	e8 64 0b 00 00       	call   800d75 <sys_getenvid>
+  800211:	83 ec 0c             	sub    $0xc,%esp
+  800214:	ff 75 0c             	push   0xc(%ebp)
+  800217:	ff 75 08             	push   0x8(%ebp)
+  80021a:	56                   	push   %esi
+  80021b:	50                   	push   %eax
+  80021c:	68 94 4e 80 00       	push   $0x804e94
+  800221:	e8 b3 00 00 00       	call   8002d9 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800226:	83 c4 18             	add    $0x18,%esp
+  800229:	53                   	push   %ebx
+  80022a:	ff 75 10             	push   0x10(%ebp)
+  80022d:	e8 56 00 00 00       	call   800288 <vcprintf>
+	cprintf("\n");
+  800232:	c7 04 24 42 4e 80 00 	movl   $0x804e42,(%esp)
+  800239:	e8 9b 00 00 00       	call   8002d9 <cprintf>
+  80023e:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800241:	cc                   	int3
+	while (1)
+  800242:	eb fd                	jmp    800241 <_panic+0x43>
+
+00800244 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800244:	55                   	push   %ebp
+  800245:	89 e5                	mov    %esp,%ebp
+  800247:	53                   	push   %ebx
+  800248:	83 ec 04             	sub    $0x4,%esp
+  80024b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80024e:	8b 13                	mov    (%ebx),%edx
+  800250:	8d 42 01             	lea    0x1(%edx),%eax
+  800253:	89 03                	mov    %eax,(%ebx)
+  800255:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800258:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  80025c:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800261:	74 09                	je     80026c <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800263:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800267:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80026a:	c9                   	leave
+  80026b:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  80026c:	83 ec 08             	sub    $0x8,%esp
+  80026f:	68 ff 00 00 00       	push   $0xff
+  800274:	8d 43 08             	lea    0x8(%ebx),%eax
+  800277:	50                   	push   %eax
+  800278:	e8 69 0a 00 00       	call   800ce6 <sys_cputs>
+		b->idx = 0;
+  80027d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800283:	83 c4 10             	add    $0x10,%esp
+  800286:	eb db                	jmp    800263 <putch+0x1f>
+
+00800288 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800288:	55                   	push   %ebp
+  800289:	89 e5                	mov    %esp,%ebp
+  80028b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800291:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800298:	00 00 00 
+	b.cnt = 0;
+  80029b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002a2:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  8002a5:	ff 75 0c             	push   0xc(%ebp)
+  8002a8:	ff 75 08             	push   0x8(%ebp)
+  8002ab:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002b1:	50                   	push   %eax
+  8002b2:	68 44 02 80 00       	push   $0x800244
+  8002b7:	e8 14 01 00 00       	call   8003d0 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002bc:	83 c4 08             	add    $0x8,%esp
+  8002bf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002c5:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002cb:	50                   	push   %eax
+  8002cc:	e8 15 0a 00 00       	call   800ce6 <sys_cputs>
+
+	return b.cnt;
+}
+  8002d1:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002d7:	c9                   	leave
+  8002d8:	c3                   	ret
+
+008002d9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002d9:	55                   	push   %ebp
+  8002da:	89 e5                	mov    %esp,%ebp
+  8002dc:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002df:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002e2:	50                   	push   %eax
+  8002e3:	ff 75 08             	push   0x8(%ebp)
+  8002e6:	e8 9d ff ff ff       	call   800288 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002eb:	c9                   	leave
+  8002ec:	c3                   	ret
+
+008002ed <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002ed:	55                   	push   %ebp
+  8002ee:	89 e5                	mov    %esp,%ebp
+  8002f0:	57                   	push   %edi
+  8002f1:	56                   	push   %esi
+  8002f2:	53                   	push   %ebx
+  8002f3:	83 ec 1c             	sub    $0x1c,%esp
+  8002f6:	89 c7                	mov    %eax,%edi
+  8002f8:	89 d6                	mov    %edx,%esi
+  8002fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800300:	89 d1                	mov    %edx,%ecx
+  800302:	89 c2                	mov    %eax,%edx
+  800304:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800307:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80030a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80030d:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800310:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800313:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80031a:	39 c2                	cmp    %eax,%edx
+  80031c:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80031f:	72 3e                	jb     80035f <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800321:	83 ec 0c             	sub    $0xc,%esp
+  800324:	ff 75 18             	push   0x18(%ebp)
+  800327:	83 eb 01             	sub    $0x1,%ebx
+  80032a:	53                   	push   %ebx
+  80032b:	50                   	push   %eax
+  80032c:	83 ec 08             	sub    $0x8,%esp
+  80032f:	ff 75 e4             	push   -0x1c(%ebp)
+  800332:	ff 75 e0             	push   -0x20(%ebp)
+  800335:	ff 75 dc             	push   -0x24(%ebp)
+  800338:	ff 75 d8             	push   -0x28(%ebp)
+  80033b:	e8 4e 49 00 00       	call   804c8e <__udivdi3>
+  800340:	83 c4 18             	add    $0x18,%esp
+  800343:	52                   	push   %edx
+  800344:	50                   	push   %eax
+  800345:	89 f2                	mov    %esi,%edx
+  800347:	89 f8                	mov    %edi,%eax
+  800349:	e8 9f ff ff ff       	call   8002ed <printnum>
+  80034e:	83 c4 20             	add    $0x20,%esp
+  800351:	eb 13                	jmp    800366 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800353:	83 ec 08             	sub    $0x8,%esp
+  800356:	56                   	push   %esi
+  800357:	ff 75 18             	push   0x18(%ebp)
+  80035a:	ff d7                	call   *%edi
+  80035c:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80035f:	83 eb 01             	sub    $0x1,%ebx
+  800362:	85 db                	test   %ebx,%ebx
+  800364:	7f ed                	jg     800353 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800366:	83 ec 08             	sub    $0x8,%esp
+  800369:	56                   	push   %esi
+  80036a:	83 ec 04             	sub    $0x4,%esp
+  80036d:	ff 75 e4             	push   -0x1c(%ebp)
+  800370:	ff 75 e0             	push   -0x20(%ebp)
+  800373:	ff 75 dc             	push   -0x24(%ebp)
+  800376:	ff 75 d8             	push   -0x28(%ebp)
+  800379:	e8 2e 49 00 00       	call   804cac <__umoddi3>
+  80037e:	83 c4 14             	add    $0x14,%esp
+  800381:	0f be 80 b7 4e 80 00 	movsbl 0x804eb7(%eax),%eax
+  800388:	50                   	push   %eax
+  800389:	ff d7                	call   *%edi
+}
+  80038b:	83 c4 10             	add    $0x10,%esp
+  80038e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800391:	5b                   	pop    %ebx
+  800392:	5e                   	pop    %esi
+  800393:	5f                   	pop    %edi
+  800394:	5d                   	pop    %ebp
+  800395:	c3                   	ret
+
+00800396 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800396:	55                   	push   %ebp
+  800397:	89 e5                	mov    %esp,%ebp
+  800399:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  80039c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8003a0:	8b 10                	mov    (%eax),%edx
+  8003a2:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003a5:	73 0a                	jae    8003b1 <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003a7:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003aa:	89 08                	mov    %ecx,(%eax)
+  8003ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003af:	88 02                	mov    %al,(%edx)
+}
+  8003b1:	5d                   	pop    %ebp
+  8003b2:	c3                   	ret
+
+008003b3 <printfmt>:
+{
+  8003b3:	55                   	push   %ebp
+  8003b4:	89 e5                	mov    %esp,%ebp
+  8003b6:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003b9:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003bc:	50                   	push   %eax
+  8003bd:	ff 75 10             	push   0x10(%ebp)
+  8003c0:	ff 75 0c             	push   0xc(%ebp)
+  8003c3:	ff 75 08             	push   0x8(%ebp)
+  8003c6:	e8 05 00 00 00       	call   8003d0 <vprintfmt>
+}
+  8003cb:	83 c4 10             	add    $0x10,%esp
+  8003ce:	c9                   	leave
+  8003cf:	c3                   	ret
+
+008003d0 <vprintfmt>:
+{
+  8003d0:	55                   	push   %ebp
+  8003d1:	89 e5                	mov    %esp,%ebp
+  8003d3:	57                   	push   %edi
+  8003d4:	56                   	push   %esi
+  8003d5:	53                   	push   %ebx
+  8003d6:	83 ec 2c             	sub    $0x2c,%esp
+  8003d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003df:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003e2:	eb 0a                	jmp    8003ee <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003e4:	83 ec 08             	sub    $0x8,%esp
+  8003e7:	53                   	push   %ebx
+  8003e8:	50                   	push   %eax
+  8003e9:	ff d6                	call   *%esi
+  8003eb:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003ee:	83 c7 01             	add    $0x1,%edi
+  8003f1:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003f5:	83 f8 25             	cmp    $0x25,%eax
+  8003f8:	74 0c                	je     800406 <vprintfmt+0x36>
+			if (ch == '\0')
+  8003fa:	85 c0                	test   %eax,%eax
+  8003fc:	75 e6                	jne    8003e4 <vprintfmt+0x14>
+}
+  8003fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800401:	5b                   	pop    %ebx
+  800402:	5e                   	pop    %esi
+  800403:	5f                   	pop    %edi
+  800404:	5d                   	pop    %ebp
+  800405:	c3                   	ret
+		padc = ' ';
+  800406:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  80040a:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800411:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800418:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80041f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800424:	8d 47 01             	lea    0x1(%edi),%eax
+  800427:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80042a:	0f b6 17             	movzbl (%edi),%edx
+  80042d:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800430:	3c 55                	cmp    $0x55,%al
+  800432:	0f 87 c5 03 00 00    	ja     8007fd <vprintfmt+0x42d>
+  800438:	0f b6 c0             	movzbl %al,%eax
+  80043b:	ff 24 85 40 50 80 00 	jmp    *0x805040(,%eax,4)
+  800442:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800445:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800449:	eb d9                	jmp    800424 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  80044b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80044e:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800452:	eb d0                	jmp    800424 <vprintfmt+0x54>
+  800454:	0f b6 d2             	movzbl %dl,%edx
+  800457:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  80045a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800462:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800465:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800469:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  80046c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80046f:	83 f9 09             	cmp    $0x9,%ecx
+  800472:	77 55                	ja     8004c9 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800474:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800477:	eb e9                	jmp    800462 <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800479:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047c:	8b 00                	mov    (%eax),%eax
+  80047e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800481:	8b 45 14             	mov    0x14(%ebp),%eax
+  800484:	8d 40 04             	lea    0x4(%eax),%eax
+  800487:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80048a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80048d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800491:	79 91                	jns    800424 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800493:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800496:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800499:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004a0:	eb 82                	jmp    800424 <vprintfmt+0x54>
+			if (width < 0)
+  8004a2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004a5:	85 d2                	test   %edx,%edx
+  8004a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ac:	0f 49 c2             	cmovns %edx,%eax
+  8004af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004b5:	e9 6a ff ff ff       	jmp    800424 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004bd:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004c4:	e9 5b ff ff ff       	jmp    800424 <vprintfmt+0x54>
+  8004c9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004cf:	eb bc                	jmp    80048d <vprintfmt+0xbd>
+			lflag++;
+  8004d1:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004d7:	e9 48 ff ff ff       	jmp    800424 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8d 78 04             	lea    0x4(%eax),%edi
+  8004e2:	83 ec 08             	sub    $0x8,%esp
+  8004e5:	53                   	push   %ebx
+  8004e6:	ff 30                	push   (%eax)
+  8004e8:	ff d6                	call   *%esi
+			break;
+  8004ea:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004ed:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004f0:	e9 63 02 00 00       	jmp    800758 <vprintfmt+0x388>
+			err = va_arg(ap, int);
+  8004f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f8:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004fb:	8b 10                	mov    (%eax),%edx
+  8004fd:	89 d0                	mov    %edx,%eax
+  8004ff:	f7 d8                	neg    %eax
+  800501:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800504:	83 f8 12             	cmp    $0x12,%eax
+  800507:	7f 23                	jg     80052c <vprintfmt+0x15c>
+  800509:	8b 14 85 a0 51 80 00 	mov    0x8051a0(,%eax,4),%edx
+  800510:	85 d2                	test   %edx,%edx
+  800512:	74 18                	je     80052c <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800514:	52                   	push   %edx
+  800515:	68 0d 4e 80 00       	push   $0x804e0d
+  80051a:	53                   	push   %ebx
+  80051b:	56                   	push   %esi
+  80051c:	e8 92 fe ff ff       	call   8003b3 <printfmt>
+  800521:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800524:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800527:	e9 2c 02 00 00       	jmp    800758 <vprintfmt+0x388>
+				printfmt(putch, putdat, "error %d", err);
+  80052c:	50                   	push   %eax
+  80052d:	68 cf 4e 80 00       	push   $0x804ecf
+  800532:	53                   	push   %ebx
+  800533:	56                   	push   %esi
+  800534:	e8 7a fe ff ff       	call   8003b3 <printfmt>
+  800539:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80053c:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80053f:	e9 14 02 00 00       	jmp    800758 <vprintfmt+0x388>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800544:	8b 45 14             	mov    0x14(%ebp),%eax
+  800547:	83 c0 04             	add    $0x4,%eax
+  80054a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80054d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800550:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800552:	85 c9                	test   %ecx,%ecx
+  800554:	b8 c8 4e 80 00       	mov    $0x804ec8,%eax
+  800559:	0f 45 c1             	cmovne %ecx,%eax
+  80055c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80055f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800563:	7e 06                	jle    80056b <vprintfmt+0x19b>
+  800565:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800569:	75 0b                	jne    800576 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80056b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80056e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800571:	89 75 08             	mov    %esi,0x8(%ebp)
+  800574:	eb 5c                	jmp    8005d2 <vprintfmt+0x202>
+  800576:	83 ec 08             	sub    $0x8,%esp
+  800579:	ff 75 d0             	push   -0x30(%ebp)
+  80057c:	ff 75 cc             	push   -0x34(%ebp)
+  80057f:	e8 19 03 00 00       	call   80089d <strnlen>
+  800584:	89 c2                	mov    %eax,%edx
+  800586:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800589:	29 d0                	sub    %edx,%eax
+  80058b:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80058e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800592:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800595:	89 75 08             	mov    %esi,0x8(%ebp)
+  800598:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059a:	eb 0e                	jmp    8005aa <vprintfmt+0x1da>
+					putch(padc, putdat);
+  80059c:	83 ec 08             	sub    $0x8,%esp
+  80059f:	53                   	push   %ebx
+  8005a0:	57                   	push   %edi
+  8005a1:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8005a4:	83 ee 01             	sub    $0x1,%esi
+  8005a7:	83 c4 10             	add    $0x10,%esp
+  8005aa:	85 f6                	test   %esi,%esi
+  8005ac:	7f ee                	jg     80059c <vprintfmt+0x1cc>
+  8005ae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b4:	85 c0                	test   %eax,%eax
+  8005b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005bb:	0f 49 d0             	cmovns %eax,%edx
+  8005be:	29 d0                	sub    %edx,%eax
+  8005c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c3:	eb a6                	jmp    80056b <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005c5:	83 ec 08             	sub    $0x8,%esp
+  8005c8:	53                   	push   %ebx
+  8005c9:	52                   	push   %edx
+  8005ca:	ff 55 08             	call   *0x8(%ebp)
+  8005cd:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005d0:	89 f1                	mov    %esi,%ecx
+  8005d2:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005d5:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d9:	0f be d0             	movsbl %al,%edx
+  8005dc:	85 d2                	test   %edx,%edx
+  8005de:	74 28                	je     800608 <vprintfmt+0x238>
+  8005e0:	85 ff                	test   %edi,%edi
+  8005e2:	78 05                	js     8005e9 <vprintfmt+0x219>
+  8005e4:	83 ef 01             	sub    $0x1,%edi
+  8005e7:	78 30                	js     800619 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005e9:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ed:	74 d6                	je     8005c5 <vprintfmt+0x1f5>
+  8005ef:	0f be c0             	movsbl %al,%eax
+  8005f2:	83 e8 20             	sub    $0x20,%eax
+  8005f5:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f8:	76 cb                	jbe    8005c5 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005fa:	83 ec 08             	sub    $0x8,%esp
+  8005fd:	53                   	push   %ebx
+  8005fe:	6a 3f                	push   $0x3f
+  800600:	ff 55 08             	call   *0x8(%ebp)
+  800603:	83 c4 10             	add    $0x10,%esp
+  800606:	eb c8                	jmp    8005d0 <vprintfmt+0x200>
+  800608:	8b 75 08             	mov    0x8(%ebp),%esi
+  80060b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80060e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800611:	01 d0                	add    %edx,%eax
+  800613:	29 c8                	sub    %ecx,%eax
+  800615:	89 c7                	mov    %eax,%edi
+  800617:	eb 13                	jmp    80062c <vprintfmt+0x25c>
+  800619:	8b 75 08             	mov    0x8(%ebp),%esi
+  80061c:	eb ed                	jmp    80060b <vprintfmt+0x23b>
+				putch(' ', putdat);
+  80061e:	83 ec 08             	sub    $0x8,%esp
+  800621:	53                   	push   %ebx
+  800622:	6a 20                	push   $0x20
+  800624:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800626:	83 ef 01             	sub    $0x1,%edi
+  800629:	83 c4 10             	add    $0x10,%esp
+  80062c:	85 ff                	test   %edi,%edi
+  80062e:	7f ee                	jg     80061e <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800630:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800633:	89 45 14             	mov    %eax,0x14(%ebp)
+  800636:	e9 1d 01 00 00       	jmp    800758 <vprintfmt+0x388>
+	if (lflag >= 2)
+  80063b:	83 f9 01             	cmp    $0x1,%ecx
+  80063e:	7f 1b                	jg     80065b <vprintfmt+0x28b>
+	else if (lflag)
+  800640:	85 c9                	test   %ecx,%ecx
+  800642:	74 63                	je     8006a7 <vprintfmt+0x2d7>
+		return va_arg(*ap, long);
+  800644:	8b 45 14             	mov    0x14(%ebp),%eax
+  800647:	8b 00                	mov    (%eax),%eax
+  800649:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064c:	99                   	cltd
+  80064d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800650:	8b 45 14             	mov    0x14(%ebp),%eax
+  800653:	8d 40 04             	lea    0x4(%eax),%eax
+  800656:	89 45 14             	mov    %eax,0x14(%ebp)
+  800659:	eb 17                	jmp    800672 <vprintfmt+0x2a2>
+		return va_arg(*ap, long long);
+  80065b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065e:	8b 50 04             	mov    0x4(%eax),%edx
+  800661:	8b 00                	mov    (%eax),%eax
+  800663:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800666:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800669:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066c:	8d 40 08             	lea    0x8(%eax),%eax
+  80066f:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800672:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800675:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800678:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80067d:	85 c9                	test   %ecx,%ecx
+  80067f:	0f 89 b9 00 00 00    	jns    80073e <vprintfmt+0x36e>
+				putch('-', putdat);
+  800685:	83 ec 08             	sub    $0x8,%esp
+  800688:	53                   	push   %ebx
+  800689:	6a 2d                	push   $0x2d
+  80068b:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80068d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800690:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800693:	f7 da                	neg    %edx
+  800695:	83 d1 00             	adc    $0x0,%ecx
+  800698:	f7 d9                	neg    %ecx
+  80069a:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80069d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006a2:	e9 97 00 00 00       	jmp    80073e <vprintfmt+0x36e>
+		return va_arg(*ap, int);
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8b 00                	mov    (%eax),%eax
+  8006ac:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006af:	99                   	cltd
+  8006b0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bc:	eb b4                	jmp    800672 <vprintfmt+0x2a2>
+	if (lflag >= 2)
+  8006be:	83 f9 01             	cmp    $0x1,%ecx
+  8006c1:	7f 1b                	jg     8006de <vprintfmt+0x30e>
+	else if (lflag)
+  8006c3:	85 c9                	test   %ecx,%ecx
+  8006c5:	74 2c                	je     8006f3 <vprintfmt+0x323>
+		return va_arg(*ap, unsigned long);
+  8006c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ca:	8b 10                	mov    (%eax),%edx
+  8006cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d4:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006dc:	eb 60                	jmp    80073e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8006de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e1:	8b 10                	mov    (%eax),%edx
+  8006e3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e6:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006ec:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006f1:	eb 4b                	jmp    80073e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	8b 10                	mov    (%eax),%edx
+  8006f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800700:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800703:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800708:	eb 34                	jmp    80073e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80070a:	83 f9 01             	cmp    $0x1,%ecx
+  80070d:	7f 15                	jg     800724 <vprintfmt+0x354>
+	else if (lflag)
+  80070f:	85 c9                	test   %ecx,%ecx
+  800711:	74 4d                	je     800760 <vprintfmt+0x390>
+		return va_arg(*ap, long);
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8b 00                	mov    (%eax),%eax
+  800718:	99                   	cltd
+  800719:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80071c:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80071f:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  800722:	eb 11                	jmp    800735 <vprintfmt+0x365>
+		return va_arg(*ap, long long);
+  800724:	8b 45 14             	mov    0x14(%ebp),%eax
+  800727:	8b 50 04             	mov    0x4(%eax),%edx
+  80072a:	8b 00                	mov    (%eax),%eax
+  80072c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80072f:	8d 49 08             	lea    0x8(%ecx),%ecx
+  800732:	89 4d 14             	mov    %ecx,0x14(%ebp)
+			num = getint(&ap, lflag);   // Get the next argument from the ap varargs list as a signed int.
+  800735:	89 d1                	mov    %edx,%ecx
+  800737:	89 c2                	mov    %eax,%edx
+			base = 8;                   // Set the base to 8, so that the number is printed in octal.
+  800739:	bf 08 00 00 00       	mov    $0x8,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  80073e:	83 ec 0c             	sub    $0xc,%esp
+  800741:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800745:	50                   	push   %eax
+  800746:	ff 75 e0             	push   -0x20(%ebp)
+  800749:	57                   	push   %edi
+  80074a:	51                   	push   %ecx
+  80074b:	52                   	push   %edx
+  80074c:	89 da                	mov    %ebx,%edx
+  80074e:	89 f0                	mov    %esi,%eax
+  800750:	e8 98 fb ff ff       	call   8002ed <printnum>
+			break;
+  800755:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800758:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  80075b:	e9 8e fc ff ff       	jmp    8003ee <vprintfmt+0x1e>
+		return va_arg(*ap, int);
+  800760:	8b 45 14             	mov    0x14(%ebp),%eax
+  800763:	8b 00                	mov    (%eax),%eax
+  800765:	99                   	cltd
+  800766:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  800769:	8d 49 04             	lea    0x4(%ecx),%ecx
+  80076c:	89 4d 14             	mov    %ecx,0x14(%ebp)
+  80076f:	eb c4                	jmp    800735 <vprintfmt+0x365>
+			putch('0', putdat);
+  800771:	83 ec 08             	sub    $0x8,%esp
+  800774:	53                   	push   %ebx
+  800775:	6a 30                	push   $0x30
+  800777:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800779:	83 c4 08             	add    $0x8,%esp
+  80077c:	53                   	push   %ebx
+  80077d:	6a 78                	push   $0x78
+  80077f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800781:	8b 45 14             	mov    0x14(%ebp),%eax
+  800784:	8b 10                	mov    (%eax),%edx
+  800786:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  80078b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80078e:	8d 40 04             	lea    0x4(%eax),%eax
+  800791:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800794:	bf 10 00 00 00       	mov    $0x10,%edi
+			goto number;
+  800799:	eb a3                	jmp    80073e <vprintfmt+0x36e>
+	if (lflag >= 2)
+  80079b:	83 f9 01             	cmp    $0x1,%ecx
+  80079e:	7f 1b                	jg     8007bb <vprintfmt+0x3eb>
+	else if (lflag)
+  8007a0:	85 c9                	test   %ecx,%ecx
+  8007a2:	74 2f                	je     8007d3 <vprintfmt+0x403>
+		return va_arg(*ap, unsigned long);
+  8007a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a7:	8b 10                	mov    (%eax),%edx
+  8007a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007b4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007b9:	eb 83                	jmp    80073e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned long long);
+  8007bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007be:	8b 10                	mov    (%eax),%edx
+  8007c0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c3:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007ce:	e9 6b ff ff ff       	jmp    80073e <vprintfmt+0x36e>
+		return va_arg(*ap, unsigned int);
+  8007d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d6:	8b 10                	mov    (%eax),%edx
+  8007d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007dd:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e0:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007e3:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007e8:	e9 51 ff ff ff       	jmp    80073e <vprintfmt+0x36e>
+			putch(ch, putdat);
+  8007ed:	83 ec 08             	sub    $0x8,%esp
+  8007f0:	53                   	push   %ebx
+  8007f1:	6a 25                	push   $0x25
+  8007f3:	ff d6                	call   *%esi
+			break;
+  8007f5:	83 c4 10             	add    $0x10,%esp
+  8007f8:	e9 5b ff ff ff       	jmp    800758 <vprintfmt+0x388>
+			putch('%', putdat);
+  8007fd:	83 ec 08             	sub    $0x8,%esp
+  800800:	53                   	push   %ebx
+  800801:	6a 25                	push   $0x25
+  800803:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800805:	83 c4 10             	add    $0x10,%esp
+  800808:	89 f8                	mov    %edi,%eax
+  80080a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80080e:	74 05                	je     800815 <vprintfmt+0x445>
+  800810:	83 e8 01             	sub    $0x1,%eax
+  800813:	eb f5                	jmp    80080a <vprintfmt+0x43a>
+  800815:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800818:	e9 3b ff ff ff       	jmp    800758 <vprintfmt+0x388>
+
+0080081d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	83 ec 18             	sub    $0x18,%esp
+  800823:	8b 45 08             	mov    0x8(%ebp),%eax
+  800826:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800829:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80082c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800830:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800833:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80083a:	85 c0                	test   %eax,%eax
+  80083c:	74 26                	je     800864 <vsnprintf+0x47>
+  80083e:	85 d2                	test   %edx,%edx
+  800840:	7e 22                	jle    800864 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800842:	ff 75 14             	push   0x14(%ebp)
+  800845:	ff 75 10             	push   0x10(%ebp)
+  800848:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80084b:	50                   	push   %eax
+  80084c:	68 96 03 80 00       	push   $0x800396
+  800851:	e8 7a fb ff ff       	call   8003d0 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800856:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800859:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80085c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80085f:	83 c4 10             	add    $0x10,%esp
+}
+  800862:	c9                   	leave
+  800863:	c3                   	ret
+		return -E_INVAL;
+  800864:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800869:	eb f7                	jmp    800862 <vsnprintf+0x45>
+
+0080086b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80086b:	55                   	push   %ebp
+  80086c:	89 e5                	mov    %esp,%ebp
+  80086e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800871:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800874:	50                   	push   %eax
+  800875:	ff 75 10             	push   0x10(%ebp)
+  800878:	ff 75 0c             	push   0xc(%ebp)
+  80087b:	ff 75 08             	push   0x8(%ebp)
+  80087e:	e8 9a ff ff ff       	call   80081d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800883:	c9                   	leave
+  800884:	c3                   	ret
+
+00800885 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	eb 03                	jmp    800895 <strlen+0x10>
+		n++;
+  800892:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800895:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800899:	75 f7                	jne    800892 <strlen+0xd>
+	return n;
+}
+  80089b:	5d                   	pop    %ebp
+  80089c:	c3                   	ret
+
+0080089d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ab:	eb 03                	jmp    8008b0 <strnlen+0x13>
+		n++;
+  8008ad:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008b0:	39 d0                	cmp    %edx,%eax
+  8008b2:	74 08                	je     8008bc <strnlen+0x1f>
+  8008b4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008b8:	75 f3                	jne    8008ad <strnlen+0x10>
+  8008ba:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008bc:	89 d0                	mov    %edx,%eax
+  8008be:	5d                   	pop    %ebp
+  8008bf:	c3                   	ret
+
+008008c0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	53                   	push   %ebx
+  8008c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cf:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008d6:	83 c0 01             	add    $0x1,%eax
+  8008d9:	84 d2                	test   %dl,%dl
+  8008db:	75 f2                	jne    8008cf <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008dd:	89 c8                	mov    %ecx,%eax
+  8008df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e2:	c9                   	leave
+  8008e3:	c3                   	ret
+
+008008e4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	53                   	push   %ebx
+  8008e8:	83 ec 10             	sub    $0x10,%esp
+  8008eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008ee:	53                   	push   %ebx
+  8008ef:	e8 91 ff ff ff       	call   800885 <strlen>
+  8008f4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008f7:	ff 75 0c             	push   0xc(%ebp)
+  8008fa:	01 d8                	add    %ebx,%eax
+  8008fc:	50                   	push   %eax
+  8008fd:	e8 be ff ff ff       	call   8008c0 <strcpy>
+	return dst;
+}
+  800902:	89 d8                	mov    %ebx,%eax
+  800904:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800907:	c9                   	leave
+  800908:	c3                   	ret
+
+00800909 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800909:	55                   	push   %ebp
+  80090a:	89 e5                	mov    %esp,%ebp
+  80090c:	56                   	push   %esi
+  80090d:	53                   	push   %ebx
+  80090e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800911:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800914:	89 f3                	mov    %esi,%ebx
+  800916:	03 5d 10             	add    0x10(%ebp),%ebx
+  800919:	89 f0                	mov    %esi,%eax
+  80091b:	eb 0f                	jmp    80092c <strncpy+0x23>
+		*dst++ = *src;
+  80091d:	83 c0 01             	add    $0x1,%eax
+  800920:	0f b6 0a             	movzbl (%edx),%ecx
+  800923:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800926:	80 f9 01             	cmp    $0x1,%cl
+  800929:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80092c:	39 d8                	cmp    %ebx,%eax
+  80092e:	75 ed                	jne    80091d <strncpy+0x14>
+	}
+	return ret;
+}
+  800930:	89 f0                	mov    %esi,%eax
+  800932:	5b                   	pop    %ebx
+  800933:	5e                   	pop    %esi
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	56                   	push   %esi
+  80093a:	53                   	push   %ebx
+  80093b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800941:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800944:	89 f0                	mov    %esi,%eax
+  800946:	85 d2                	test   %edx,%edx
+  800948:	74 21                	je     80096b <strlcpy+0x35>
+  80094a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80094e:	89 f2                	mov    %esi,%edx
+  800950:	eb 09                	jmp    80095b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800952:	83 c1 01             	add    $0x1,%ecx
+  800955:	83 c2 01             	add    $0x1,%edx
+  800958:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80095b:	39 c2                	cmp    %eax,%edx
+  80095d:	74 09                	je     800968 <strlcpy+0x32>
+  80095f:	0f b6 19             	movzbl (%ecx),%ebx
+  800962:	84 db                	test   %bl,%bl
+  800964:	75 ec                	jne    800952 <strlcpy+0x1c>
+  800966:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800968:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80096b:	29 f0                	sub    %esi,%eax
+}
+  80096d:	5b                   	pop    %ebx
+  80096e:	5e                   	pop    %esi
+  80096f:	5d                   	pop    %ebp
+  800970:	c3                   	ret
+
+00800971 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800977:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80097a:	eb 06                	jmp    800982 <strcmp+0x11>
+		p++, q++;
+  80097c:	83 c1 01             	add    $0x1,%ecx
+  80097f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800982:	0f b6 01             	movzbl (%ecx),%eax
+  800985:	84 c0                	test   %al,%al
+  800987:	74 04                	je     80098d <strcmp+0x1c>
+  800989:	3a 02                	cmp    (%edx),%al
+  80098b:	74 ef                	je     80097c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80098d:	0f b6 c0             	movzbl %al,%eax
+  800990:	0f b6 12             	movzbl (%edx),%edx
+  800993:	29 d0                	sub    %edx,%eax
+}
+  800995:	5d                   	pop    %ebp
+  800996:	c3                   	ret
+
+00800997 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800997:	55                   	push   %ebp
+  800998:	89 e5                	mov    %esp,%ebp
+  80099a:	53                   	push   %ebx
+  80099b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009a4:	eb 09                	jmp    8009af <strncmp+0x18>
+		n--, p++, q++;
+  8009a6:	83 ea 01             	sub    $0x1,%edx
+  8009a9:	83 c0 01             	add    $0x1,%eax
+  8009ac:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009af:	85 d2                	test   %edx,%edx
+  8009b1:	74 18                	je     8009cb <strncmp+0x34>
+  8009b3:	0f b6 18             	movzbl (%eax),%ebx
+  8009b6:	84 db                	test   %bl,%bl
+  8009b8:	74 04                	je     8009be <strncmp+0x27>
+  8009ba:	3a 19                	cmp    (%ecx),%bl
+  8009bc:	74 e8                	je     8009a6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009be:	0f b6 00             	movzbl (%eax),%eax
+  8009c1:	0f b6 11             	movzbl (%ecx),%edx
+  8009c4:	29 d0                	sub    %edx,%eax
+}
+  8009c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c9:	c9                   	leave
+  8009ca:	c3                   	ret
+		return 0;
+  8009cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d0:	eb f4                	jmp    8009c6 <strncmp+0x2f>
+
+008009d2 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009d2:	55                   	push   %ebp
+  8009d3:	89 e5                	mov    %esp,%ebp
+  8009d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009dc:	eb 03                	jmp    8009e1 <strchr+0xf>
+  8009de:	83 c0 01             	add    $0x1,%eax
+  8009e1:	0f b6 10             	movzbl (%eax),%edx
+  8009e4:	84 d2                	test   %dl,%dl
+  8009e6:	74 06                	je     8009ee <strchr+0x1c>
+		if (*s == c)
+  8009e8:	38 ca                	cmp    %cl,%dl
+  8009ea:	75 f2                	jne    8009de <strchr+0xc>
+  8009ec:	eb 05                	jmp    8009f3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f3:	5d                   	pop    %ebp
+  8009f4:	c3                   	ret
+
+008009f5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009f5:	55                   	push   %ebp
+  8009f6:	89 e5                	mov    %esp,%ebp
+  8009f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009ff:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a02:	38 ca                	cmp    %cl,%dl
+  800a04:	74 09                	je     800a0f <strfind+0x1a>
+  800a06:	84 d2                	test   %dl,%dl
+  800a08:	74 05                	je     800a0f <strfind+0x1a>
+	for (; *s; s++)
+  800a0a:	83 c0 01             	add    $0x1,%eax
+  800a0d:	eb f0                	jmp    8009ff <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a0f:	5d                   	pop    %ebp
+  800a10:	c3                   	ret
+
+00800a11 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	57                   	push   %edi
+  800a15:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a18:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a1b:	85 c9                	test   %ecx,%ecx
+  800a1d:	74 20                	je     800a3f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a1f:	89 f8                	mov    %edi,%eax
+  800a21:	09 c8                	or     %ecx,%eax
+  800a23:	a8 03                	test   $0x3,%al
+  800a25:	75 12                	jne    800a39 <memset+0x28>
+		c &= 0xFF;
+  800a27:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a2b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a31:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a34:	fc                   	cld
+  800a35:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a37:	eb 06                	jmp    800a3f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a3c:	fc                   	cld
+  800a3d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a3f:	89 f8                	mov    %edi,%eax
+  800a41:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a44:	c9                   	leave
+  800a45:	c3                   	ret
+
+00800a46 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	57                   	push   %edi
+  800a4a:	56                   	push   %esi
+  800a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a51:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a54:	39 c6                	cmp    %eax,%esi
+  800a56:	73 32                	jae    800a8a <memmove+0x44>
+  800a58:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a5b:	39 d0                	cmp    %edx,%eax
+  800a5d:	73 2b                	jae    800a8a <memmove+0x44>
+		s += n;
+		d += n;
+  800a5f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a62:	89 d6                	mov    %edx,%esi
+  800a64:	09 fe                	or     %edi,%esi
+  800a66:	09 ce                	or     %ecx,%esi
+  800a68:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a6e:	75 0e                	jne    800a7e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a70:	83 ef 04             	sub    $0x4,%edi
+  800a73:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a76:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a79:	fd                   	std
+  800a7a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a7c:	eb 09                	jmp    800a87 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a7e:	83 ef 01             	sub    $0x1,%edi
+  800a81:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a84:	fd                   	std
+  800a85:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a87:	fc                   	cld
+  800a88:	eb 1a                	jmp    800aa4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a8a:	89 f2                	mov    %esi,%edx
+  800a8c:	09 c2                	or     %eax,%edx
+  800a8e:	09 ca                	or     %ecx,%edx
+  800a90:	f6 c2 03             	test   $0x3,%dl
+  800a93:	75 0a                	jne    800a9f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a95:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a98:	89 c7                	mov    %eax,%edi
+  800a9a:	fc                   	cld
+  800a9b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a9d:	eb 05                	jmp    800aa4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a9f:	89 c7                	mov    %eax,%edi
+  800aa1:	fc                   	cld
+  800aa2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aa4:	5e                   	pop    %esi
+  800aa5:	5f                   	pop    %edi
+  800aa6:	5d                   	pop    %ebp
+  800aa7:	c3                   	ret
+
+00800aa8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aae:	ff 75 10             	push   0x10(%ebp)
+  800ab1:	ff 75 0c             	push   0xc(%ebp)
+  800ab4:	ff 75 08             	push   0x8(%ebp)
+  800ab7:	e8 8a ff ff ff       	call   800a46 <memmove>
+}
+  800abc:	c9                   	leave
+  800abd:	c3                   	ret
+
+00800abe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800abe:	55                   	push   %ebp
+  800abf:	89 e5                	mov    %esp,%ebp
+  800ac1:	56                   	push   %esi
+  800ac2:	53                   	push   %ebx
+  800ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ac9:	89 c6                	mov    %eax,%esi
+  800acb:	03 75 10             	add    0x10(%ebp),%esi
+  800ace:	eb 06                	jmp    800ad6 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ad0:	83 c0 01             	add    $0x1,%eax
+  800ad3:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ad6:	39 f0                	cmp    %esi,%eax
+  800ad8:	74 14                	je     800aee <memcmp+0x30>
+		if (*s1 != *s2)
+  800ada:	0f b6 08             	movzbl (%eax),%ecx
+  800add:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae0:	38 d9                	cmp    %bl,%cl
+  800ae2:	74 ec                	je     800ad0 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ae4:	0f b6 c1             	movzbl %cl,%eax
+  800ae7:	0f b6 db             	movzbl %bl,%ebx
+  800aea:	29 d8                	sub    %ebx,%eax
+  800aec:	eb 05                	jmp    800af3 <memcmp+0x35>
+	}
+
+	return 0;
+  800aee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af3:	5b                   	pop    %ebx
+  800af4:	5e                   	pop    %esi
+  800af5:	5d                   	pop    %ebp
+  800af6:	c3                   	ret
+
+00800af7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800af7:	55                   	push   %ebp
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b00:	89 c2                	mov    %eax,%edx
+  800b02:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b05:	eb 03                	jmp    800b0a <memfind+0x13>
+  800b07:	83 c0 01             	add    $0x1,%eax
+  800b0a:	39 d0                	cmp    %edx,%eax
+  800b0c:	73 04                	jae    800b12 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b0e:	38 08                	cmp    %cl,(%eax)
+  800b10:	75 f5                	jne    800b07 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b12:	5d                   	pop    %ebp
+  800b13:	c3                   	ret
+
+00800b14 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b14:	55                   	push   %ebp
+  800b15:	89 e5                	mov    %esp,%ebp
+  800b17:	57                   	push   %edi
+  800b18:	56                   	push   %esi
+  800b19:	53                   	push   %ebx
+  800b1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b20:	eb 03                	jmp    800b25 <strtol+0x11>
+		s++;
+  800b22:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b25:	0f b6 02             	movzbl (%edx),%eax
+  800b28:	3c 20                	cmp    $0x20,%al
+  800b2a:	74 f6                	je     800b22 <strtol+0xe>
+  800b2c:	3c 09                	cmp    $0x9,%al
+  800b2e:	74 f2                	je     800b22 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b30:	3c 2b                	cmp    $0x2b,%al
+  800b32:	74 2a                	je     800b5e <strtol+0x4a>
+	int neg = 0;
+  800b34:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b39:	3c 2d                	cmp    $0x2d,%al
+  800b3b:	74 2b                	je     800b68 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b43:	75 0f                	jne    800b54 <strtol+0x40>
+  800b45:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b48:	74 28                	je     800b72 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b4a:	85 db                	test   %ebx,%ebx
+  800b4c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b51:	0f 44 d8             	cmove  %eax,%ebx
+  800b54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b59:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b5c:	eb 46                	jmp    800ba4 <strtol+0x90>
+		s++;
+  800b5e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b61:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b66:	eb d5                	jmp    800b3d <strtol+0x29>
+		s++, neg = 1;
+  800b68:	83 c2 01             	add    $0x1,%edx
+  800b6b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b70:	eb cb                	jmp    800b3d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b72:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b76:	74 0e                	je     800b86 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b78:	85 db                	test   %ebx,%ebx
+  800b7a:	75 d8                	jne    800b54 <strtol+0x40>
+		s++, base = 8;
+  800b7c:	83 c2 01             	add    $0x1,%edx
+  800b7f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b84:	eb ce                	jmp    800b54 <strtol+0x40>
+		s += 2, base = 16;
+  800b86:	83 c2 02             	add    $0x2,%edx
+  800b89:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b8e:	eb c4                	jmp    800b54 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b90:	0f be c0             	movsbl %al,%eax
+  800b93:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b96:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b99:	7d 3a                	jge    800bd5 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b9b:	83 c2 01             	add    $0x1,%edx
+  800b9e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ba2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ba4:	0f b6 02             	movzbl (%edx),%eax
+  800ba7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800baa:	89 f3                	mov    %esi,%ebx
+  800bac:	80 fb 09             	cmp    $0x9,%bl
+  800baf:	76 df                	jbe    800b90 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bb1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bb4:	89 f3                	mov    %esi,%ebx
+  800bb6:	80 fb 19             	cmp    $0x19,%bl
+  800bb9:	77 08                	ja     800bc3 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bbb:	0f be c0             	movsbl %al,%eax
+  800bbe:	83 e8 57             	sub    $0x57,%eax
+  800bc1:	eb d3                	jmp    800b96 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bc6:	89 f3                	mov    %esi,%ebx
+  800bc8:	80 fb 19             	cmp    $0x19,%bl
+  800bcb:	77 08                	ja     800bd5 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bcd:	0f be c0             	movsbl %al,%eax
+  800bd0:	83 e8 37             	sub    $0x37,%eax
+  800bd3:	eb c1                	jmp    800b96 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bd5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bd9:	74 05                	je     800be0 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bde:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800be0:	89 c8                	mov    %ecx,%eax
+  800be2:	f7 d8                	neg    %eax
+  800be4:	85 ff                	test   %edi,%edi
+  800be6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800be9:	89 c8                	mov    %ecx,%eax
+  800beb:	5b                   	pop    %ebx
+  800bec:	5e                   	pop    %esi
+  800bed:	5f                   	pop    %edi
+  800bee:	5d                   	pop    %ebp
+  800bef:	c3                   	ret
+
+00800bf0 <strisl>:
+
+int
+strisl(const char *s, int base, long *num)
+{
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	57                   	push   %edi
+  800bf4:	56                   	push   %esi
+  800bf5:	53                   	push   %ebx
+  800bf6:	83 ec 0c             	sub    $0xc,%esp
+  800bf9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800bfc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bff:	8b 7d 10             	mov    0x10(%ebp),%edi
+	if (num) {
+  800c02:	85 ff                	test   %edi,%edi
+  800c04:	74 16                	je     800c1c <strisl+0x2c>
+		*num = strtol(s, (char **) NULL, base);
+  800c06:	83 ec 04             	sub    $0x4,%esp
+  800c09:	56                   	push   %esi
+  800c0a:	6a 00                	push   $0x0
+  800c0c:	53                   	push   %ebx
+  800c0d:	e8 02 ff ff ff       	call   800b14 <strtol>
+  800c12:	89 07                	mov    %eax,(%edi)
+  800c14:	83 c4 10             	add    $0x10,%esp
+  800c17:	eb 03                	jmp    800c1c <strisl+0x2c>
+	}
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+		s++;
+  800c19:	83 c3 01             	add    $0x1,%ebx
+	while (*s == ' ' || *s == '\t')
+  800c1c:	0f b6 03             	movzbl (%ebx),%eax
+  800c1f:	3c 20                	cmp    $0x20,%al
+  800c21:	74 f6                	je     800c19 <strisl+0x29>
+  800c23:	3c 09                	cmp    $0x9,%al
+  800c25:	74 f2                	je     800c19 <strisl+0x29>
+
+	// plus/minus sign
+	if (*s == '+')
+  800c27:	3c 2b                	cmp    $0x2b,%al
+  800c29:	74 23                	je     800c4e <strisl+0x5e>
+		s++;
+	else if (*s == '-')
+		s++;
+  800c2b:	3c 2d                	cmp    $0x2d,%al
+  800c2d:	0f 94 c0             	sete   %al
+  800c30:	0f b6 c0             	movzbl %al,%eax
+  800c33:	01 c3                	add    %eax,%ebx
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c35:	f7 c6 ef ff ff ff    	test   $0xffffffef,%esi
+  800c3b:	75 41                	jne    800c7e <strisl+0x8e>
+  800c3d:	80 3b 30             	cmpb   $0x30,(%ebx)
+  800c40:	74 11                	je     800c53 <strisl+0x63>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800c42:	85 f6                	test   %esi,%esi
+  800c44:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c49:	0f 44 f0             	cmove  %eax,%esi
+  800c4c:	eb 30                	jmp    800c7e <strisl+0x8e>
+		s++;
+  800c4e:	83 c3 01             	add    $0x1,%ebx
+  800c51:	eb e2                	jmp    800c35 <strisl+0x45>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c53:	80 7b 01 78          	cmpb   $0x78,0x1(%ebx)
+  800c57:	74 0e                	je     800c67 <strisl+0x77>
+	else if (base == 0 && s[0] == '0')
+  800c59:	85 f6                	test   %esi,%esi
+  800c5b:	75 21                	jne    800c7e <strisl+0x8e>
+		s++, base = 8;
+  800c5d:	83 c3 01             	add    $0x1,%ebx
+  800c60:	be 08 00 00 00       	mov    $0x8,%esi
+  800c65:	eb 17                	jmp    800c7e <strisl+0x8e>
+		s += 2, base = 16;
+  800c67:	83 c3 02             	add    $0x2,%ebx
+  800c6a:	be 10 00 00 00       	mov    $0x10,%esi
+  800c6f:	eb 0d                	jmp    800c7e <strisl+0x8e>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800c71:	0f be c0             	movsbl %al,%eax
+  800c74:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'A' + 10;
+		else if (!*s)
+			break;
+		else
+			return 0;
+		if (dig >= base)
+  800c77:	39 f0                	cmp    %esi,%eax
+  800c79:	7d 38                	jge    800cb3 <strisl+0xc3>
+			return 0;
+		s++;
+  800c7b:	83 c3 01             	add    $0x1,%ebx
+		if (*s >= '0' && *s <= '9')
+  800c7e:	0f b6 03             	movzbl (%ebx),%eax
+  800c81:	8d 50 d0             	lea    -0x30(%eax),%edx
+  800c84:	80 fa 09             	cmp    $0x9,%dl
+  800c87:	76 e8                	jbe    800c71 <strisl+0x81>
+		else if (*s >= 'a' && *s <= 'z')
+  800c89:	8d 50 9f             	lea    -0x61(%eax),%edx
+  800c8c:	80 fa 19             	cmp    $0x19,%dl
+  800c8f:	77 08                	ja     800c99 <strisl+0xa9>
+			dig = *s - 'a' + 10;
+  800c91:	0f be c0             	movsbl %al,%eax
+  800c94:	83 e8 57             	sub    $0x57,%eax
+  800c97:	eb de                	jmp    800c77 <strisl+0x87>
+		else if (*s >= 'A' && *s <= 'Z')
+  800c99:	8d 50 bf             	lea    -0x41(%eax),%edx
+  800c9c:	80 fa 19             	cmp    $0x19,%dl
+  800c9f:	77 08                	ja     800ca9 <strisl+0xb9>
+			dig = *s - 'A' + 10;
+  800ca1:	0f be c0             	movsbl %al,%eax
+  800ca4:	83 e8 37             	sub    $0x37,%eax
+  800ca7:	eb ce                	jmp    800c77 <strisl+0x87>
+		else if (!*s)
+  800ca9:	84 c0                	test   %al,%al
+  800cab:	0f 94 c0             	sete   %al
+  800cae:	0f b6 c0             	movzbl %al,%eax
+  800cb1:	eb 05                	jmp    800cb8 <strisl+0xc8>
+			return 0;
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+		// we don't properly detect overflow!
+	}
+
+	return 1;
+}
+  800cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cbb:	5b                   	pop    %ebx
+  800cbc:	5e                   	pop    %esi
+  800cbd:	5f                   	pop    %edi
+  800cbe:	5d                   	pop    %ebp
+  800cbf:	c3                   	ret
+
+00800cc0 <touch_mem>:
+	return ret;
+}
+
+// Read from a virtual address to ensure that it gets paged into memory
+// from the hard drive if it was paged out
+void touch_mem(const void *va, size_t length){
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	83 ec 10             	sub    $0x10,%esp
+  800cc6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	volatile char c;
+	const void *page;
+
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cc9:	89 c8                	mov    %ecx,%eax
+  800ccb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800cd0:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800cd3:	eb 0b                	jmp    800ce0 <touch_mem+0x20>
+		c = *(char *)page;
+  800cd5:	0f b6 10             	movzbl (%eax),%edx
+  800cd8:	88 55 ff             	mov    %dl,-0x1(%ebp)
+	for(page=ROUNDDOWN(va, PGSIZE); page < va + length; page += PGSIZE)
+  800cdb:	05 00 10 00 00       	add    $0x1000,%eax
+  800ce0:	39 c8                	cmp    %ecx,%eax
+  800ce2:	72 f1                	jb     800cd5 <touch_mem+0x15>
+}
+  800ce4:	c9                   	leave
+  800ce5:	c3                   	ret
+
+00800ce6 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ce6:	55                   	push   %ebp
+  800ce7:	89 e5                	mov    %esp,%ebp
+  800ce9:	57                   	push   %edi
+  800cea:	56                   	push   %esi
+  800ceb:	53                   	push   %ebx
+	touch_mem(s, len);
+  800cec:	ff 75 0c             	push   0xc(%ebp)
+  800cef:	ff 75 08             	push   0x8(%ebp)
+  800cf2:	e8 c9 ff ff ff       	call   800cc0 <touch_mem>
+	asm volatile("int %1\n"
+  800cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d02:	89 c3                	mov    %eax,%ebx
+  800d04:	89 c7                	mov    %eax,%edi
+  800d06:	89 c6                	mov    %eax,%esi
+  800d08:	cd 30                	int    $0x30
+	syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d0a:	83 c4 08             	add    $0x8,%esp
+  800d0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d10:	5b                   	pop    %ebx
+  800d11:	5e                   	pop    %esi
+  800d12:	5f                   	pop    %edi
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+
+00800d15 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d15:	55                   	push   %ebp
+  800d16:	89 e5                	mov    %esp,%ebp
+  800d18:	57                   	push   %edi
+  800d19:	56                   	push   %esi
+  800d1a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d20:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d25:	89 d1                	mov    %edx,%ecx
+  800d27:	89 d3                	mov    %edx,%ebx
+  800d29:	89 d7                	mov    %edx,%edi
+  800d2b:	89 d6                	mov    %edx,%esi
+  800d2d:	cd 30                	int    $0x30
+	return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d2f:	5b                   	pop    %ebx
+  800d30:	5e                   	pop    %esi
+  800d31:	5f                   	pop    %edi
+  800d32:	5d                   	pop    %ebp
+  800d33:	c3                   	ret
+
+00800d34 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d34:	55                   	push   %ebp
+  800d35:	89 e5                	mov    %esp,%ebp
+  800d37:	57                   	push   %edi
+  800d38:	56                   	push   %esi
+  800d39:	53                   	push   %ebx
+  800d3a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d45:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d4a:	89 cb                	mov    %ecx,%ebx
+  800d4c:	89 cf                	mov    %ecx,%edi
+  800d4e:	89 ce                	mov    %ecx,%esi
+  800d50:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d52:	85 c0                	test   %eax,%eax
+  800d54:	7f 08                	jg     800d5e <sys_env_destroy+0x2a>
+	return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d5e:	83 ec 0c             	sub    $0xc,%esp
+  800d61:	50                   	push   %eax
+  800d62:	6a 03                	push   $0x3
+  800d64:	68 0b 52 80 00       	push   $0x80520b
+  800d69:	6a 23                	push   $0x23
+  800d6b:	68 28 52 80 00       	push   $0x805228
+  800d70:	e8 89 f4 ff ff       	call   8001fe <_panic>
+
+00800d75 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d80:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d85:	89 d1                	mov    %edx,%ecx
+  800d87:	89 d3                	mov    %edx,%ebx
+  800d89:	89 d7                	mov    %edx,%edi
+  800d8b:	89 d6                	mov    %edx,%esi
+  800d8d:	cd 30                	int    $0x30
+	 return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d8f:	5b                   	pop    %ebx
+  800d90:	5e                   	pop    %esi
+  800d91:	5f                   	pop    %edi
+  800d92:	5d                   	pop    %ebp
+  800d93:	c3                   	ret
+
+00800d94 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d94:	55                   	push   %ebp
+  800d95:	89 e5                	mov    %esp,%ebp
+  800d97:	57                   	push   %edi
+  800d98:	56                   	push   %esi
+  800d99:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800d9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800da4:	89 d1                	mov    %edx,%ecx
+  800da6:	89 d3                	mov    %edx,%ebx
+  800da8:	89 d7                	mov    %edx,%edi
+  800daa:	89 d6                	mov    %edx,%esi
+  800dac:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dae:	5b                   	pop    %ebx
+  800daf:	5e                   	pop    %esi
+  800db0:	5f                   	pop    %edi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+
+00800db3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800db3:	55                   	push   %ebp
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	57                   	push   %edi
+  800db7:	56                   	push   %esi
+  800db8:	53                   	push   %ebx
+  800db9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dbc:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dcc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dcf:	89 f7                	mov    %esi,%edi
+  800dd1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800dd3:	85 c0                	test   %eax,%eax
+  800dd5:	7f 08                	jg     800ddf <sys_page_alloc+0x2c>
+	return syscall(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0, 0);
+}
+  800dd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dda:	5b                   	pop    %ebx
+  800ddb:	5e                   	pop    %esi
+  800ddc:	5f                   	pop    %edi
+  800ddd:	5d                   	pop    %ebp
+  800dde:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ddf:	83 ec 0c             	sub    $0xc,%esp
+  800de2:	50                   	push   %eax
+  800de3:	6a 04                	push   $0x4
+  800de5:	68 0b 52 80 00       	push   $0x80520b
+  800dea:	6a 23                	push   $0x23
+  800dec:	68 28 52 80 00       	push   $0x805228
+  800df1:	e8 08 f4 ff ff       	call   8001fe <_panic>
+
+00800df6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800df6:	55                   	push   %ebp
+  800df7:	89 e5                	mov    %esp,%ebp
+  800df9:	57                   	push   %edi
+  800dfa:	56                   	push   %esi
+  800dfb:	53                   	push   %ebx
+  800dfc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800dff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e05:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e0a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e10:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e13:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e15:	85 c0                	test   %eax,%eax
+  800e17:	7f 08                	jg     800e21 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800e19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1c:	5b                   	pop    %ebx
+  800e1d:	5e                   	pop    %esi
+  800e1e:	5f                   	pop    %edi
+  800e1f:	5d                   	pop    %ebp
+  800e20:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e21:	83 ec 0c             	sub    $0xc,%esp
+  800e24:	50                   	push   %eax
+  800e25:	6a 05                	push   $0x5
+  800e27:	68 0b 52 80 00       	push   $0x80520b
+  800e2c:	6a 23                	push   $0x23
+  800e2e:	68 28 52 80 00       	push   $0x805228
+  800e33:	e8 c6 f3 ff ff       	call   8001fe <_panic>
+
+00800e38 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e38:	55                   	push   %ebp
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	57                   	push   %edi
+  800e3c:	56                   	push   %esi
+  800e3d:	53                   	push   %ebx
+  800e3e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e51:	89 df                	mov    %ebx,%edi
+  800e53:	89 de                	mov    %ebx,%esi
+  800e55:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e57:	85 c0                	test   %eax,%eax
+  800e59:	7f 08                	jg     800e63 <sys_page_unmap+0x2b>
+	return syscall(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5e:	5b                   	pop    %ebx
+  800e5f:	5e                   	pop    %esi
+  800e60:	5f                   	pop    %edi
+  800e61:	5d                   	pop    %ebp
+  800e62:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e63:	83 ec 0c             	sub    $0xc,%esp
+  800e66:	50                   	push   %eax
+  800e67:	6a 06                	push   $0x6
+  800e69:	68 0b 52 80 00       	push   $0x80520b
+  800e6e:	6a 23                	push   $0x23
+  800e70:	68 28 52 80 00       	push   $0x805228
+  800e75:	e8 84 f3 ff ff       	call   8001fe <_panic>
+
+00800e7a <sys_page_split>:
+
+int
+sys_page_split(envid_t envid, void *va)
+{
+  800e7a:	55                   	push   %ebp
+  800e7b:	89 e5                	mov    %esp,%ebp
+  800e7d:	57                   	push   %edi
+  800e7e:	56                   	push   %esi
+  800e7f:	53                   	push   %ebx
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8e:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e93:	89 df                	mov    %ebx,%edi
+  800e95:	89 de                	mov    %ebx,%esi
+  800e97:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e99:	85 c0                	test   %eax,%eax
+  800e9b:	7f 08                	jg     800ea5 <sys_page_split+0x2b>
+	return syscall(SYS_page_split, 1, envid, (uint32_t) va, 0, 0, 0);
+}
+  800e9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea0:	5b                   	pop    %ebx
+  800ea1:	5e                   	pop    %esi
+  800ea2:	5f                   	pop    %edi
+  800ea3:	5d                   	pop    %ebp
+  800ea4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ea5:	83 ec 0c             	sub    $0xc,%esp
+  800ea8:	50                   	push   %eax
+  800ea9:	6a 18                	push   $0x18
+  800eab:	68 0b 52 80 00       	push   $0x80520b
+  800eb0:	6a 23                	push   $0x23
+  800eb2:	68 28 52 80 00       	push   $0x805228
+  800eb7:	e8 42 f3 ff ff       	call   8001fe <_panic>
+
+00800ebc <sys_page_reclaim>:
+
+int
+sys_page_reclaim(envid_t envid, void *va, uint32_t slot)
+{
+  800ebc:	55                   	push   %ebp
+  800ebd:	89 e5                	mov    %esp,%ebp
+  800ebf:	57                   	push   %edi
+  800ec0:	56                   	push   %esi
+  800ec1:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ec2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecd:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ed2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ed5:	89 f7                	mov    %esi,%edi
+  800ed7:	cd 30                	int    $0x30
+	return syscall(SYS_page_reclaim, 0, envid, (uint32_t) va, slot, 0, 0);
+}
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+
+00800ede <sys_page_alloc_range>:
+
+// Returns the number of pages allocated, which may be fewer than npages
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm)
+{
+  800ede:	55                   	push   %ebp
+  800edf:	89 e5                	mov    %esp,%ebp
+  800ee1:	57                   	push   %edi
+  800ee2:	56                   	push   %esi
+  800ee3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eea:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800eef:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800efa:	cd 30                	int    $0x30
+	return syscall(SYS_page_alloc_range, 0, envid, (uint32_t) va, npages, perm, 0);
+}
+  800efc:	5b                   	pop    %ebx
+  800efd:	5e                   	pop    %esi
+  800efe:	5f                   	pop    %edi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+
+00800f01 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t npages, int perm)
+{
+  800f01:	55                   	push   %ebp
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	57                   	push   %edi
+  800f05:	56                   	push   %esi
+  800f06:	53                   	push   %ebx
+  800f07:	83 ec 0c             	sub    $0xc,%esp
+	// perm travels in the page offset bits of dstva (see kern/syscall.c)
+	return syscall(SYS_page_map_range, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva | PGOFF(perm), npages);
+  800f0a:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  800f0d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800f13:	0b 7d 14             	or     0x14(%ebp),%edi
+	asm volatile("int %1\n"
+  800f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f24:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f27:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	7f 08                	jg     800f35 <sys_page_map_range+0x34>
+}
+  800f2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f30:	5b                   	pop    %ebx
+  800f31:	5e                   	pop    %esi
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f35:	83 ec 0c             	sub    $0xc,%esp
+  800f38:	50                   	push   %eax
+  800f39:	6a 10                	push   $0x10
+  800f3b:	68 0b 52 80 00       	push   $0x80520b
+  800f40:	6a 23                	push   $0x23
+  800f42:	68 28 52 80 00       	push   $0x805228
+  800f47:	e8 b2 f2 ff ff       	call   8001fe <_panic>
+
+00800f4c <sys_page_unmap_range>:
+
+int
+sys_page_unmap_range(envid_t envid, void *va, size_t npages)
+{
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  800f52:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f55:	be 00 00 00 00       	mov    $0x0,%esi
+  800f5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f60:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f68:	89 f7                	mov    %esi,%edi
+  800f6a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f6c:	85 c0                	test   %eax,%eax
+  800f6e:	7f 08                	jg     800f78 <sys_page_unmap_range+0x2c>
+	return syscall(SYS_page_unmap_range, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f73:	5b                   	pop    %ebx
+  800f74:	5e                   	pop    %esi
+  800f75:	5f                   	pop    %edi
+  800f76:	5d                   	pop    %ebp
+  800f77:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f78:	83 ec 0c             	sub    $0xc,%esp
+  800f7b:	50                   	push   %eax
+  800f7c:	6a 11                	push   $0x11
+  800f7e:	68 0b 52 80 00       	push   $0x80520b
+  800f83:	6a 23                	push   $0x23
+  800f85:	68 28 52 80 00       	push   $0x805228
+  800f8a:	e8 6f f2 ff ff       	call   8001fe <_panic>
+
+00800f8f <sys_page_clean>:
+
+int
+sys_page_clean(envid_t envid, void *va, size_t npages)
+{
+  800f8f:	55                   	push   %ebp
+  800f90:	89 e5                	mov    %esp,%ebp
+  800f92:	57                   	push   %edi
+  800f93:	56                   	push   %esi
+  800f94:	53                   	push   %ebx
+  800f95:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f98:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa3:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  800fa8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fab:	89 f7                	mov    %esi,%edi
+  800fad:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800faf:	85 c0                	test   %eax,%eax
+  800fb1:	7f 08                	jg     800fbb <sys_page_clean+0x2c>
+	return syscall(SYS_page_clean, 1, envid, (uint32_t) va, npages, 0, 0);
+}
+  800fb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb6:	5b                   	pop    %ebx
+  800fb7:	5e                   	pop    %esi
+  800fb8:	5f                   	pop    %edi
+  800fb9:	5d                   	pop    %ebp
+  800fba:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800fbb:	83 ec 0c             	sub    $0xc,%esp
+  800fbe:	50                   	push   %eax
+  800fbf:	6a 1b                	push   $0x1b
+  800fc1:	68 0b 52 80 00       	push   $0x80520b
+  800fc6:	6a 23                	push   $0x23
+  800fc8:	68 28 52 80 00       	push   $0x805228
+  800fcd:	e8 2c f2 ff ff       	call   8001fe <_panic>
+
+00800fd2 <sys_fork>:
+// Unlike sys_exofork, sys_fork needn't be inlined: the kernel copies
+// the address space at the moment of the call, so the child's stack
+// still holds this frame.
+envid_t
+sys_fork(void)
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	57                   	push   %edi
+  800fd6:	56                   	push   %esi
+  800fd7:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdd:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fe2:	89 d1                	mov    %edx,%ecx
+  800fe4:	89 d3                	mov    %edx,%ebx
+  800fe6:	89 d7                	mov    %edx,%edi
+  800fe8:	89 d6                	mov    %edx,%esi
+  800fea:	cd 30                	int    $0x30
+	return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800fec:	5b                   	pop    %ebx
+  800fed:	5e                   	pop    %esi
+  800fee:	5f                   	pop    %edi
+  800fef:	5d                   	pop    %ebp
+  800ff0:	c3                   	ret
+
+00800ff1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+  800ff7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800ffa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801005:	b8 08 00 00 00       	mov    $0x8,%eax
+  80100a:	89 df                	mov    %ebx,%edi
+  80100c:	89 de                	mov    %ebx,%esi
+  80100e:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801010:	85 c0                	test   %eax,%eax
+  801012:	7f 08                	jg     80101c <sys_env_set_status+0x2b>
+	return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801014:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80101c:	83 ec 0c             	sub    $0xc,%esp
+  80101f:	50                   	push   %eax
+  801020:	6a 08                	push   $0x8
+  801022:	68 0b 52 80 00       	push   $0x80520b
+  801027:	6a 23                	push   $0x23
+  801029:	68 28 52 80 00       	push   $0x805228
+  80102e:	e8 cb f1 ff ff       	call   8001fe <_panic>
+
+00801033 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	57                   	push   %edi
+  801037:	56                   	push   %esi
+  801038:	53                   	push   %ebx
+  801039:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(tf, sizeof(struct Trapframe));
+  80103c:	6a 44                	push   $0x44
+  80103e:	ff 75 0c             	push   0xc(%ebp)
+  801041:	e8 7a fc ff ff       	call   800cc0 <touch_mem>
+	asm volatile("int %1\n"
+  801046:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80104b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801053:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801056:	89 df                	mov    %ebx,%edi
+  801058:	89 de                	mov    %ebx,%esi
+  80105a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80105c:	83 c4 08             	add    $0x8,%esp
+  80105f:	85 c0                	test   %eax,%eax
+  801061:	7f 08                	jg     80106b <sys_env_set_trapframe+0x38>
+	return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0, 0);
+}
+  801063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801066:	5b                   	pop    %ebx
+  801067:	5e                   	pop    %esi
+  801068:	5f                   	pop    %edi
+  801069:	5d                   	pop    %ebp
+  80106a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80106b:	83 ec 0c             	sub    $0xc,%esp
+  80106e:	50                   	push   %eax
+  80106f:	6a 09                	push   $0x9
+  801071:	68 0b 52 80 00       	push   $0x80520b
+  801076:	6a 23                	push   $0x23
+  801078:	68 28 52 80 00       	push   $0x805228
+  80107d:	e8 7c f1 ff ff       	call   8001fe <_panic>
+
+00801082 <sys_env_set_rss>:
+
+int
+sys_env_set_rss(envid_t envid, int min, int max)
+{
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  801088:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80108b:	be 00 00 00 00       	mov    $0x0,%esi
+  801090:	8b 55 08             	mov    0x8(%ebp),%edx
+  801093:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801096:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  80109b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109e:	89 f7                	mov    %esi,%edi
+  8010a0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010a2:	85 c0                	test   %eax,%eax
+  8010a4:	7f 08                	jg     8010ae <sys_env_set_rss+0x2c>
+	return syscall(SYS_env_set_rss, 1, envid, min, max, 0, 0);
+}
+  8010a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a9:	5b                   	pop    %ebx
+  8010aa:	5e                   	pop    %esi
+  8010ab:	5f                   	pop    %edi
+  8010ac:	5d                   	pop    %ebp
+  8010ad:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010ae:	83 ec 0c             	sub    $0xc,%esp
+  8010b1:	50                   	push   %eax
+  8010b2:	6a 1a                	push   $0x1a
+  8010b4:	68 0b 52 80 00       	push   $0x80520b
+  8010b9:	6a 23                	push   $0x23
+  8010bb:	68 28 52 80 00       	push   $0x805228
+  8010c0:	e8 39 f1 ff ff       	call   8001fe <_panic>
+
+008010c5 <sys_env_set_segments>:
+
+int
+sys_env_set_segments(envid_t envid, const struct Segment *segs, int nsegs)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	57                   	push   %edi
+  8010c9:	56                   	push   %esi
+  8010ca:	53                   	push   %ebx
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	touch_mem(segs, nsegs * sizeof(struct Segment));
+  8010d1:	89 d8                	mov    %ebx,%eax
+  8010d3:	c1 e0 05             	shl    $0x5,%eax
+  8010d6:	50                   	push   %eax
+  8010d7:	ff 75 0c             	push   0xc(%ebp)
+  8010da:	e8 e1 fb ff ff       	call   800cc0 <touch_mem>
+	asm volatile("int %1\n"
+  8010df:	be 00 00 00 00       	mov    $0x0,%esi
+  8010e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ef:	89 f7                	mov    %esi,%edi
+  8010f1:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8010f3:	83 c4 08             	add    $0x8,%esp
+  8010f6:	85 c0                	test   %eax,%eax
+  8010f8:	7f 08                	jg     801102 <sys_env_set_segments+0x3d>
+	return syscall(SYS_env_set_segments, 1, envid, (uint32_t) segs, nsegs, 0, 0);
+}
+  8010fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fd:	5b                   	pop    %ebx
+  8010fe:	5e                   	pop    %esi
+  8010ff:	5f                   	pop    %edi
+  801100:	5d                   	pop    %ebp
+  801101:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801102:	83 ec 0c             	sub    $0xc,%esp
+  801105:	50                   	push   %eax
+  801106:	6a 13                	push   $0x13
+  801108:	68 0b 52 80 00       	push   $0x80520b
+  80110d:	6a 23                	push   $0x23
+  80110f:	68 28 52 80 00       	push   $0x805228
+  801114:	e8 e5 f0 ff ff       	call   8001fe <_panic>
+
+00801119 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801119:	55                   	push   %ebp
+  80111a:	89 e5                	mov    %esp,%ebp
+  80111c:	57                   	push   %edi
+  80111d:	56                   	push   %esi
+  80111e:	53                   	push   %ebx
+  80111f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801122:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801127:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801132:	89 df                	mov    %ebx,%edi
+  801134:	89 de                	mov    %ebx,%esi
+  801136:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801138:	85 c0                	test   %eax,%eax
+  80113a:	7f 08                	jg     801144 <sys_env_set_pgfault_upcall+0x2b>
+	return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0, 0);
+}
+  80113c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113f:	5b                   	pop    %ebx
+  801140:	5e                   	pop    %esi
+  801141:	5f                   	pop    %edi
+  801142:	5d                   	pop    %ebp
+  801143:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801144:	83 ec 0c             	sub    $0xc,%esp
+  801147:	50                   	push   %eax
+  801148:	6a 0a                	push   $0xa
+  80114a:	68 0b 52 80 00       	push   $0x80520b
+  80114f:	6a 23                	push   $0x23
+  801151:	68 28 52 80 00       	push   $0x805228
+  801156:	e8 a3 f0 ff ff       	call   8001fe <_panic>
+
+0080115b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  80115e:	57                   	push   %edi
+  80115f:	56                   	push   %esi
+  801160:	53                   	push   %ebx
+  801161:	8b 5d 10             	mov    0x10(%ebp),%ebx
+}
+
+int
+sys_ipc_send_pages(envid_t envid, uint32_t value, void *srcva, size_t npg, int perm)
+{
+	if ((uint32_t) srcva < UTOP)
+  801164:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80116a:	76 1d                	jbe    801189 <sys_ipc_send+0x2e>
+	asm volatile("int %1\n"
+  80116c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801172:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801177:	be 01 00 00 00       	mov    $0x1,%esi
+  80117c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117f:	cd 30                	int    $0x30
+}
+  801181:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  801189:	68 00 10 00 00       	push   $0x1000
+  80118e:	53                   	push   %ebx
+  80118f:	e8 2c fb ff ff       	call   800cc0 <touch_mem>
+  801194:	83 c4 08             	add    $0x8,%esp
+  801197:	eb d3                	jmp    80116c <sys_ipc_send+0x11>
+
+00801199 <sys_ipc_send_pages>:
+{
+  801199:	55                   	push   %ebp
+  80119a:	89 e5                	mov    %esp,%ebp
+  80119c:	57                   	push   %edi
+  80119d:	56                   	push   %esi
+  80119e:	53                   	push   %ebx
+  80119f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a2:	8b 75 14             	mov    0x14(%ebp),%esi
+	if ((uint32_t) srcva < UTOP)
+  8011a5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8011ab:	76 18                	jbe    8011c5 <sys_ipc_send_pages+0x2c>
+	asm volatile("int %1\n"
+  8011ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011b8:	8b 7d 18             	mov    0x18(%ebp),%edi
+  8011bb:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_send, 0, envid, value, (uint32_t) srcva, perm, npg);
+}
+  8011bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c0:	5b                   	pop    %ebx
+  8011c1:	5e                   	pop    %esi
+  8011c2:	5f                   	pop    %edi
+  8011c3:	5d                   	pop    %ebp
+  8011c4:	c3                   	ret
+		touch_mem(srcva, npg * PGSIZE);
+  8011c5:	89 f0                	mov    %esi,%eax
+  8011c7:	c1 e0 0c             	shl    $0xc,%eax
+  8011ca:	50                   	push   %eax
+  8011cb:	53                   	push   %ebx
+  8011cc:	e8 ef fa ff ff       	call   800cc0 <touch_mem>
+  8011d1:	83 c4 08             	add    $0x8,%esp
+  8011d4:	eb d7                	jmp    8011ad <sys_ipc_send_pages+0x14>
+
+008011d6 <sys_ipc_recv_pages>:
+	return sys_ipc_recv_pages(dstva, 1);
+}
+
+int
+sys_ipc_recv_pages(void *dstva, size_t npg)
+{
+  8011d6:	55                   	push   %ebp
+  8011d7:	89 e5                	mov    %esp,%ebp
+  8011d9:	57                   	push   %edi
+  8011da:	56                   	push   %esi
+  8011db:	53                   	push   %ebx
+  8011dc:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ea:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011ef:	89 df                	mov    %ebx,%edi
+  8011f1:	89 de                	mov    %ebx,%esi
+  8011f3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011f5:	85 c0                	test   %eax,%eax
+  8011f7:	7f 08                	jg     801201 <sys_ipc_recv_pages+0x2b>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npg, 0, 0, 0);
+}
+  8011f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011fc:	5b                   	pop    %ebx
+  8011fd:	5e                   	pop    %esi
+  8011fe:	5f                   	pop    %edi
+  8011ff:	5d                   	pop    %ebp
+  801200:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801201:	83 ec 0c             	sub    $0xc,%esp
+  801204:	50                   	push   %eax
+  801205:	6a 0d                	push   $0xd
+  801207:	68 0b 52 80 00       	push   $0x80520b
+  80120c:	6a 23                	push   $0x23
+  80120e:	68 28 52 80 00       	push   $0x805228
+  801213:	e8 e6 ef ff ff       	call   8001fe <_panic>
+
+00801218 <sys_ipc_recv>:
+{
+  801218:	55                   	push   %ebp
+  801219:	89 e5                	mov    %esp,%ebp
+  80121b:	83 ec 10             	sub    $0x10,%esp
+	return sys_ipc_recv_pages(dstva, 1);
+  80121e:	6a 01                	push   $0x1
+  801220:	ff 75 08             	push   0x8(%ebp)
+  801223:	e8 ae ff ff ff       	call   8011d6 <sys_ipc_recv_pages>
+}
+  801228:	c9                   	leave
+  801229:	c3                   	ret
+
+0080122a <sys_ipc_call>:
+
+int
+sys_ipc_call(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80122a:	55                   	push   %ebp
+  80122b:	89 e5                	mov    %esp,%ebp
+  80122d:	57                   	push   %edi
+  80122e:	56                   	push   %esi
+  80122f:	53                   	push   %ebx
+  801230:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801233:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801236:	8b 75 18             	mov    0x18(%ebp),%esi
+	if ((uint32_t) pg < UTOP && perm)
+  801239:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80123f:	77 04                	ja     801245 <sys_ipc_call+0x1b>
+  801241:	85 f6                	test   %esi,%esi
+  801243:	75 15                	jne    80125a <sys_ipc_call+0x30>
+	asm volatile("int %1\n"
+  801245:	8b 55 08             	mov    0x8(%ebp),%edx
+  801248:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80124b:	b8 14 00 00 00       	mov    $0x14,%eax
+  801250:	cd 30                	int    $0x30
+		touch_mem(pg, npg * PGSIZE);
+	return syscall(SYS_ipc_call, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801255:	5b                   	pop    %ebx
+  801256:	5e                   	pop    %esi
+  801257:	5f                   	pop    %edi
+  801258:	5d                   	pop    %ebp
+  801259:	c3                   	ret
+		touch_mem(pg, npg * PGSIZE);
+  80125a:	89 f8                	mov    %edi,%eax
+  80125c:	c1 e0 0c             	shl    $0xc,%eax
+  80125f:	50                   	push   %eax
+  801260:	53                   	push   %ebx
+  801261:	e8 5a fa ff ff       	call   800cc0 <touch_mem>
+  801266:	83 c4 08             	add    $0x8,%esp
+  801269:	eb da                	jmp    801245 <sys_ipc_call+0x1b>
+
+0080126b <sys_ipc_reply_recv>:
+
+int
+sys_ipc_reply_recv(envid_t envid, uint32_t value, void *pg, size_t npg, int perm)
+{
+  80126b:	55                   	push   %ebp
+  80126c:	89 e5                	mov    %esp,%ebp
+  80126e:	57                   	push   %edi
+  80126f:	56                   	push   %esi
+  801270:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 15 00 00 00       	mov    $0x15,%eax
+  80127c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80127f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801282:	8b 75 18             	mov    0x18(%ebp),%esi
+  801285:	cd 30                	int    $0x30
+	return syscall(SYS_ipc_reply_recv, 0, envid, value, (uint32_t) pg, npg, perm);
+}
+  801287:	5b                   	pop    %ebx
+  801288:	5e                   	pop    %esi
+  801289:	5f                   	pop    %edi
+  80128a:	5d                   	pop    %ebp
+  80128b:	c3                   	ret
+
+0080128c <sys_futex_wait>:
+
+int
+sys_futex_wait(const uint32_t *addr, uint32_t val, int ref)
+{
+  80128c:	55                   	push   %ebp
+  80128d:	89 e5                	mov    %esp,%ebp
+  80128f:	57                   	push   %edi
+  801290:	56                   	push   %esi
+  801291:	53                   	push   %ebx
+  801292:	83 ec 0c             	sub    $0xc,%esp
+	touch_mem(addr, sizeof(*addr));
+  801295:	6a 04                	push   $0x4
+  801297:	ff 75 08             	push   0x8(%ebp)
+  80129a:	e8 21 fa ff ff       	call   800cc0 <touch_mem>
+	asm volatile("int %1\n"
+  80129f:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012a7:	b8 16 00 00 00       	mov    $0x16,%eax
+  8012ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012b2:	89 f7                	mov    %esi,%edi
+  8012b4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012b6:	83 c4 08             	add    $0x8,%esp
+  8012b9:	85 c0                	test   %eax,%eax
+  8012bb:	7f 08                	jg     8012c5 <sys_futex_wait+0x39>
+	return syscall(SYS_futex_wait, 1, (uint32_t) addr, val, ref, 0, 0);
+}
+  8012bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012c0:	5b                   	pop    %ebx
+  8012c1:	5e                   	pop    %esi
+  8012c2:	5f                   	pop    %edi
+  8012c3:	5d                   	pop    %ebp
+  8012c4:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012c5:	83 ec 0c             	sub    $0xc,%esp
+  8012c8:	50                   	push   %eax
+  8012c9:	6a 16                	push   $0x16
+  8012cb:	68 0b 52 80 00       	push   $0x80520b
+  8012d0:	6a 23                	push   $0x23
+  8012d2:	68 28 52 80 00       	push   $0x805228
+  8012d7:	e8 22 ef ff ff       	call   8001fe <_panic>
+
+008012dc <sys_futex_wake>:
+
+// Returns the number of environments woken
+int
+sys_futex_wake(const uint32_t *addr, int n)
+{
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	57                   	push   %edi
+  8012e0:	56                   	push   %esi
+  8012e1:	53                   	push   %ebx
+	touch_mem(addr, sizeof(*addr));
+  8012e2:	6a 04                	push   $0x4
+  8012e4:	ff 75 08             	push   0x8(%ebp)
+  8012e7:	e8 d4 f9 ff ff       	call   800cc0 <touch_mem>
+	asm volatile("int %1\n"
+  8012ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f4:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fc:	89 df                	mov    %ebx,%edi
+  8012fe:	89 de                	mov    %ebx,%esi
+  801300:	cd 30                	int    $0x30
+	return syscall(SYS_futex_wake, 0, (uint32_t) addr, n, 0, 0, 0);
+}
+  801302:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801305:	5b                   	pop    %ebx
+  801306:	5e                   	pop    %esi
+  801307:	5f                   	pop    %edi
+  801308:	5d                   	pop    %ebp
+  801309:	c3                   	ret
+
+0080130a <sys_ipc_try_recv>:
+
+int
+sys_ipc_try_recv(void *dstva)
+{
+  80130a:	55                   	push   %ebp
+  80130b:	89 e5                	mov    %esp,%ebp
+  80130d:	57                   	push   %edi
+  80130e:	56                   	push   %esi
+  80130f:	53                   	push   %ebx
+  801310:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801313:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801318:	8b 55 08             	mov    0x8(%ebp),%edx
+  80131b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801320:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801325:	89 df                	mov    %ebx,%edi
+  801327:	89 de                	mov    %ebx,%esi
+  801329:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80132b:	85 c0                	test   %eax,%eax
+  80132d:	7f 08                	jg     801337 <sys_ipc_try_recv+0x2d>
+	return syscall(SYS_ipc_try_recv, 1, (uint32_t)dstva, 1, 0, 0, 0);
+}
+  80132f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801332:	5b                   	pop    %ebx
+  801333:	5e                   	pop    %esi
+  801334:	5f                   	pop    %edi
+  801335:	5d                   	pop    %ebp
+  801336:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801337:	83 ec 0c             	sub    $0xc,%esp
+  80133a:	50                   	push   %eax
+  80133b:	6a 0e                	push   $0xe
+  80133d:	68 0b 52 80 00       	push   $0x80520b
+  801342:	6a 23                	push   $0x23
+  801344:	68 28 52 80 00       	push   $0x805228
+  801349:	e8 b0 ee ff ff       	call   8001fe <_panic>
+
+0080134e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80134e:	55                   	push   %ebp
+  80134f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801351:	8b 45 08             	mov    0x8(%ebp),%eax
+  801354:	05 00 00 00 30       	add    $0x30000000,%eax
+  801359:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80135c:	5d                   	pop    %ebp
+  80135d:	c3                   	ret
+
+0080135e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80135e:	55                   	push   %ebp
+  80135f:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801361:	8b 45 08             	mov    0x8(%ebp),%eax
+  801364:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  801369:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80136e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801373:	5d                   	pop    %ebp
+  801374:	c3                   	ret
+
+00801375 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801375:	55                   	push   %ebp
+  801376:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	// The whole fd table is under one page directory entry
+	if ((uvpd[PDX(FDTABLE)] & PTE_P) == 0) {
+  801378:	a1 00 dd 7b ef       	mov    0xef7bdd00,%eax
+  80137d:	a8 01                	test   $0x1,%al
+  80137f:	74 3c                	je     8013bd <fd_alloc+0x48>
+  801381:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+		*fd_store = INDEX2FD(0);
+		return 0;
+	}
+	for (i = 0; i < MAXFD; i++) {
+		fd = INDEX2FD(i);
+		if ((uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801386:	89 c2                	mov    %eax,%edx
+  801388:	c1 ea 0c             	shr    $0xc,%edx
+  80138b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801392:	89 c1                	mov    %eax,%ecx
+  801394:	05 00 10 00 00       	add    $0x1000,%eax
+  801399:	f6 c2 01             	test   $0x1,%dl
+  80139c:	74 13                	je     8013b1 <fd_alloc+0x3c>
+	for (i = 0; i < MAXFD; i++) {
+  80139e:	3d 00 00 02 d0       	cmp    $0xd0020000,%eax
+  8013a3:	75 e1                	jne    801386 <fd_alloc+0x11>
+  8013a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  8013aa:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8013af:	eb 05                	jmp    8013b6 <fd_alloc+0x41>
+			return 0;
+  8013b1:	b8 00 00 00 00       	mov    $0x0,%eax
+		*fd_store = INDEX2FD(0);
+  8013b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b9:	89 0a                	mov    %ecx,(%edx)
+}
+  8013bb:	5d                   	pop    %ebp
+  8013bc:	c3                   	ret
+  8013bd:	b9 00 00 00 d0       	mov    $0xd0000000,%ecx
+		return 0;
+  8013c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c7:	eb ed                	jmp    8013b6 <fd_alloc+0x41>
+
+008013c9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013c9:	55                   	push   %ebp
+  8013ca:	89 e5                	mov    %esp,%ebp
+  8013cc:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8013cf:	83 f8 1f             	cmp    $0x1f,%eax
+  8013d2:	77 30                	ja     801404 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8013d4:	c1 e0 0c             	shl    $0xc,%eax
+  8013d7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013dc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013e2:	f6 c2 01             	test   $0x1,%dl
+  8013e5:	74 24                	je     80140b <fd_lookup+0x42>
+  8013e7:	89 c2                	mov    %eax,%edx
+  8013e9:	c1 ea 0c             	shr    $0xc,%edx
+  8013ec:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013f3:	f6 c2 01             	test   $0x1,%dl
+  8013f6:	74 1a                	je     801412 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8013f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013fb:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8013fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801402:	5d                   	pop    %ebp
+  801403:	c3                   	ret
+		return -E_INVAL;
+  801404:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801409:	eb f7                	jmp    801402 <fd_lookup+0x39>
+		return -E_INVAL;
+  80140b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801410:	eb f0                	jmp    801402 <fd_lookup+0x39>
+  801412:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801417:	eb e9                	jmp    801402 <fd_lookup+0x39>
+
+00801419 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	53                   	push   %ebx
+  80141d:	83 ec 04             	sub    $0x4,%esp
+  801420:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801423:	b8 b4 52 80 00       	mov    $0x8052b4,%eax
+  801428:	8b 18                	mov    (%eax),%ebx
+  80142a:	85 db                	test   %ebx,%ebx
+  80142c:	74 0e                	je     80143c <dev_lookup+0x23>
+		if (devtab[i]->dev_id == dev_id) {
+  80142e:	83 c0 04             	add    $0x4,%eax
+  801431:	39 13                	cmp    %edx,(%ebx)
+  801433:	75 f3                	jne    801428 <dev_lookup+0xf>
+			*dev = devtab[i];
+			return 0;
+  801435:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143a:	eb 1f                	jmp    80145b <dev_lookup+0x42>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80143c:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801441:	8b 40 48             	mov    0x48(%eax),%eax
+  801444:	83 ec 04             	sub    $0x4,%esp
+  801447:	52                   	push   %edx
+  801448:	50                   	push   %eax
+  801449:	68 38 52 80 00       	push   $0x805238
+  80144e:	e8 86 ee ff ff       	call   8002d9 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801453:	83 c4 10             	add    $0x10,%esp
+  801456:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  80145b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80145e:	89 1a                	mov    %ebx,(%edx)
+}
+  801460:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801463:	c9                   	leave
+  801464:	c3                   	ret
+
+00801465 <fd_close>:
+{
+  801465:	55                   	push   %ebp
+  801466:	89 e5                	mov    %esp,%ebp
+  801468:	57                   	push   %edi
+  801469:	56                   	push   %esi
+  80146a:	53                   	push   %ebx
+  80146b:	83 ec 24             	sub    $0x24,%esp
+  80146e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801471:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801474:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801477:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801478:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80147e:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801481:	50                   	push   %eax
+  801482:	e8 42 ff ff ff       	call   8013c9 <fd_lookup>
+  801487:	89 c3                	mov    %eax,%ebx
+  801489:	83 c4 10             	add    $0x10,%esp
+  80148c:	85 c0                	test   %eax,%eax
+  80148e:	78 05                	js     801495 <fd_close+0x30>
+	    || fd != fd2)
+  801490:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801493:	74 16                	je     8014ab <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801495:	89 f8                	mov    %edi,%eax
+  801497:	84 c0                	test   %al,%al
+  801499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014a1:	89 d8                	mov    %ebx,%eax
+  8014a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a6:	5b                   	pop    %ebx
+  8014a7:	5e                   	pop    %esi
+  8014a8:	5f                   	pop    %edi
+  8014a9:	5d                   	pop    %ebp
+  8014aa:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014ab:	83 ec 08             	sub    $0x8,%esp
+  8014ae:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014b1:	50                   	push   %eax
+  8014b2:	ff 36                	push   (%esi)
+  8014b4:	e8 60 ff ff ff       	call   801419 <dev_lookup>
+  8014b9:	89 c3                	mov    %eax,%ebx
+  8014bb:	83 c4 10             	add    $0x10,%esp
+  8014be:	85 c0                	test   %eax,%eax
+  8014c0:	78 1a                	js     8014dc <fd_close+0x77>
+		if (dev->dev_close)
+  8014c2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014c5:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8014c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8014cd:	85 c0                	test   %eax,%eax
+  8014cf:	74 0b                	je     8014dc <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8014d1:	83 ec 0c             	sub    $0xc,%esp
+  8014d4:	56                   	push   %esi
+  8014d5:	ff d0                	call   *%eax
+  8014d7:	89 c3                	mov    %eax,%ebx
+  8014d9:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8014dc:	83 ec 08             	sub    $0x8,%esp
+  8014df:	56                   	push   %esi
+  8014e0:	6a 00                	push   $0x0
+  8014e2:	e8 51 f9 ff ff       	call   800e38 <sys_page_unmap>
+	return r;
+  8014e7:	83 c4 10             	add    $0x10,%esp
+  8014ea:	eb b5                	jmp    8014a1 <fd_close+0x3c>
+
+008014ec <close>:
+
+int
+close(int fdnum)
+{
+  8014ec:	55                   	push   %ebp
+  8014ed:	89 e5                	mov    %esp,%ebp
+  8014ef:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014f5:	50                   	push   %eax
+  8014f6:	ff 75 08             	push   0x8(%ebp)
+  8014f9:	e8 cb fe ff ff       	call   8013c9 <fd_lookup>
+  8014fe:	83 c4 10             	add    $0x10,%esp
+  801501:	85 c0                	test   %eax,%eax
+  801503:	79 02                	jns    801507 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801505:	c9                   	leave
+  801506:	c3                   	ret
+		return fd_close(fd, 1);
+  801507:	83 ec 08             	sub    $0x8,%esp
+  80150a:	6a 01                	push   $0x1
+  80150c:	ff 75 f4             	push   -0xc(%ebp)
+  80150f:	e8 51 ff ff ff       	call   801465 <fd_close>
+  801514:	83 c4 10             	add    $0x10,%esp
+  801517:	eb ec                	jmp    801505 <close+0x19>
+
+00801519 <close_all>:
+
+void
+close_all(void)
+{
+  801519:	55                   	push   %ebp
+  80151a:	89 e5                	mov    %esp,%ebp
+  80151c:	53                   	push   %ebx
+  80151d:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801520:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801525:	83 ec 0c             	sub    $0xc,%esp
+  801528:	53                   	push   %ebx
+  801529:	e8 be ff ff ff       	call   8014ec <close>
+	for (i = 0; i < MAXFD; i++)
+  80152e:	83 c3 01             	add    $0x1,%ebx
+  801531:	83 c4 10             	add    $0x10,%esp
+  801534:	83 fb 20             	cmp    $0x20,%ebx
+  801537:	75 ec                	jne    801525 <close_all+0xc>
+}
+  801539:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80153c:	c9                   	leave
+  80153d:	c3                   	ret
+
+0080153e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80153e:	55                   	push   %ebp
+  80153f:	89 e5                	mov    %esp,%ebp
+  801541:	57                   	push   %edi
+  801542:	56                   	push   %esi
+  801543:	53                   	push   %ebx
+  801544:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801547:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80154a:	50                   	push   %eax
+  80154b:	ff 75 08             	push   0x8(%ebp)
+  80154e:	e8 76 fe ff ff       	call   8013c9 <fd_lookup>
+  801553:	89 c3                	mov    %eax,%ebx
+  801555:	83 c4 10             	add    $0x10,%esp
+  801558:	85 c0                	test   %eax,%eax
+  80155a:	78 7f                	js     8015db <dup+0x9d>
+		return r;
+	close(newfdnum);
+  80155c:	83 ec 0c             	sub    $0xc,%esp
+  80155f:	ff 75 0c             	push   0xc(%ebp)
+  801562:	e8 85 ff ff ff       	call   8014ec <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801567:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80156a:	c1 e6 0c             	shl    $0xc,%esi
+  80156d:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801573:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801576:	89 3c 24             	mov    %edi,(%esp)
+  801579:	e8 e0 fd ff ff       	call   80135e <fd2data>
+  80157e:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801580:	89 34 24             	mov    %esi,(%esp)
+  801583:	e8 d6 fd ff ff       	call   80135e <fd2data>
+  801588:	83 c4 10             	add    $0x10,%esp
+  80158b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80158e:	89 d8                	mov    %ebx,%eax
+  801590:	c1 e8 16             	shr    $0x16,%eax
+  801593:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80159a:	a8 01                	test   $0x1,%al
+  80159c:	74 11                	je     8015af <dup+0x71>
+  80159e:	89 d8                	mov    %ebx,%eax
+  8015a0:	c1 e8 0c             	shr    $0xc,%eax
+  8015a3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015aa:	f6 c2 01             	test   $0x1,%dl
+  8015ad:	75 36                	jne    8015e5 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015af:	89 f8                	mov    %edi,%eax
+  8015b1:	c1 e8 0c             	shr    $0xc,%eax
+  8015b4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015bb:	83 ec 0c             	sub    $0xc,%esp
+  8015be:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015c3:	50                   	push   %eax
+  8015c4:	56                   	push   %esi
+  8015c5:	6a 00                	push   $0x0
+  8015c7:	57                   	push   %edi
+  8015c8:	6a 00                	push   $0x0
+  8015ca:	e8 27 f8 ff ff       	call   800df6 <sys_page_map>
+  8015cf:	89 c3                	mov    %eax,%ebx
+  8015d1:	83 c4 20             	add    $0x20,%esp
+  8015d4:	85 c0                	test   %eax,%eax
+  8015d6:	78 33                	js     80160b <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8015d8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8015db:	89 d8                	mov    %ebx,%eax
+  8015dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015e0:	5b                   	pop    %ebx
+  8015e1:	5e                   	pop    %esi
+  8015e2:	5f                   	pop    %edi
+  8015e3:	5d                   	pop    %ebp
+  8015e4:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8015e5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015ec:	83 ec 0c             	sub    $0xc,%esp
+  8015ef:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015f4:	50                   	push   %eax
+  8015f5:	ff 75 d4             	push   -0x2c(%ebp)
+  8015f8:	6a 00                	push   $0x0
+  8015fa:	53                   	push   %ebx
+  8015fb:	6a 00                	push   $0x0
+  8015fd:	e8 f4 f7 ff ff       	call   800df6 <sys_page_map>
+  801602:	89 c3                	mov    %eax,%ebx
+  801604:	83 c4 20             	add    $0x20,%esp
+  801607:	85 c0                	test   %eax,%eax
+  801609:	79 a4                	jns    8015af <dup+0x71>
+	sys_page_unmap(0, newfd);
+  80160b:	83 ec 08             	sub    $0x8,%esp
+  80160e:	56                   	push   %esi
+  80160f:	6a 00                	push   $0x0
+  801611:	e8 22 f8 ff ff       	call   800e38 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801616:	83 c4 08             	add    $0x8,%esp
+  801619:	ff 75 d4             	push   -0x2c(%ebp)
+  80161c:	6a 00                	push   $0x0
+  80161e:	e8 15 f8 ff ff       	call   800e38 <sys_page_unmap>
+	return r;
+  801623:	83 c4 10             	add    $0x10,%esp
+  801626:	eb b3                	jmp    8015db <dup+0x9d>
+
+00801628 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801628:	55                   	push   %ebp
+  801629:	89 e5                	mov    %esp,%ebp
+  80162b:	56                   	push   %esi
+  80162c:	53                   	push   %ebx
+  80162d:	83 ec 18             	sub    $0x18,%esp
+  801630:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801633:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801636:	50                   	push   %eax
+  801637:	56                   	push   %esi
+  801638:	e8 8c fd ff ff       	call   8013c9 <fd_lookup>
+  80163d:	83 c4 10             	add    $0x10,%esp
+  801640:	85 c0                	test   %eax,%eax
+  801642:	78 3c                	js     801680 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801644:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801647:	83 ec 08             	sub    $0x8,%esp
+  80164a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80164d:	50                   	push   %eax
+  80164e:	ff 33                	push   (%ebx)
+  801650:	e8 c4 fd ff ff       	call   801419 <dev_lookup>
+  801655:	83 c4 10             	add    $0x10,%esp
+  801658:	85 c0                	test   %eax,%eax
+  80165a:	78 24                	js     801680 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80165c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80165f:	83 e0 03             	and    $0x3,%eax
+  801662:	83 f8 01             	cmp    $0x1,%eax
+  801665:	74 20                	je     801687 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80166a:	8b 40 08             	mov    0x8(%eax),%eax
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	74 37                	je     8016a8 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801671:	83 ec 04             	sub    $0x4,%esp
+  801674:	ff 75 10             	push   0x10(%ebp)
+  801677:	ff 75 0c             	push   0xc(%ebp)
+  80167a:	53                   	push   %ebx
+  80167b:	ff d0                	call   *%eax
+  80167d:	83 c4 10             	add    $0x10,%esp
+}
+  801680:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801683:	5b                   	pop    %ebx
+  801684:	5e                   	pop    %esi
+  801685:	5d                   	pop    %ebp
+  801686:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801687:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80168c:	8b 40 48             	mov    0x48(%eax),%eax
+  80168f:	83 ec 04             	sub    $0x4,%esp
+  801692:	56                   	push   %esi
+  801693:	50                   	push   %eax
+  801694:	68 79 52 80 00       	push   $0x805279
+  801699:	e8 3b ec ff ff       	call   8002d9 <cprintf>
+		return -E_INVAL;
+  80169e:	83 c4 10             	add    $0x10,%esp
+  8016a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a6:	eb d8                	jmp    801680 <read+0x58>
+		return -E_NOT_SUPP;
+  8016a8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ad:	eb d1                	jmp    801680 <read+0x58>
+
+008016af <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	57                   	push   %edi
+  8016b3:	56                   	push   %esi
+  8016b4:	53                   	push   %ebx
+  8016b5:	83 ec 0c             	sub    $0xc,%esp
+  8016b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016bb:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8016be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c3:	eb 02                	jmp    8016c7 <readn+0x18>
+  8016c5:	01 c3                	add    %eax,%ebx
+  8016c7:	39 f3                	cmp    %esi,%ebx
+  8016c9:	73 21                	jae    8016ec <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016cb:	83 ec 04             	sub    $0x4,%esp
+  8016ce:	89 f0                	mov    %esi,%eax
+  8016d0:	29 d8                	sub    %ebx,%eax
+  8016d2:	50                   	push   %eax
+  8016d3:	89 d8                	mov    %ebx,%eax
+  8016d5:	03 45 0c             	add    0xc(%ebp),%eax
+  8016d8:	50                   	push   %eax
+  8016d9:	57                   	push   %edi
+  8016da:	e8 49 ff ff ff       	call   801628 <read>
+		if (m < 0)
+  8016df:	83 c4 10             	add    $0x10,%esp
+  8016e2:	85 c0                	test   %eax,%eax
+  8016e4:	78 04                	js     8016ea <readn+0x3b>
+			return m;
+		if (m == 0)
+  8016e6:	75 dd                	jne    8016c5 <readn+0x16>
+  8016e8:	eb 02                	jmp    8016ec <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8016ea:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8016ec:	89 d8                	mov    %ebx,%eax
+  8016ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f1:	5b                   	pop    %ebx
+  8016f2:	5e                   	pop    %esi
+  8016f3:	5f                   	pop    %edi
+  8016f4:	5d                   	pop    %ebp
+  8016f5:	c3                   	ret
+
+008016f6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016f6:	55                   	push   %ebp
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	56                   	push   %esi
+  8016fa:	53                   	push   %ebx
+  8016fb:	83 ec 18             	sub    $0x18,%esp
+  8016fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801701:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801704:	50                   	push   %eax
+  801705:	53                   	push   %ebx
+  801706:	e8 be fc ff ff       	call   8013c9 <fd_lookup>
+  80170b:	83 c4 10             	add    $0x10,%esp
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	78 37                	js     801749 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801712:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801715:	83 ec 08             	sub    $0x8,%esp
+  801718:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80171b:	50                   	push   %eax
+  80171c:	ff 36                	push   (%esi)
+  80171e:	e8 f6 fc ff ff       	call   801419 <dev_lookup>
+  801723:	83 c4 10             	add    $0x10,%esp
+  801726:	85 c0                	test   %eax,%eax
+  801728:	78 1f                	js     801749 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80172a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80172e:	74 20                	je     801750 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801730:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801733:	8b 40 0c             	mov    0xc(%eax),%eax
+  801736:	85 c0                	test   %eax,%eax
+  801738:	74 37                	je     801771 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  80173a:	83 ec 04             	sub    $0x4,%esp
+  80173d:	ff 75 10             	push   0x10(%ebp)
+  801740:	ff 75 0c             	push   0xc(%ebp)
+  801743:	56                   	push   %esi
+  801744:	ff d0                	call   *%eax
+  801746:	83 c4 10             	add    $0x10,%esp
+}
+  801749:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80174c:	5b                   	pop    %ebx
+  80174d:	5e                   	pop    %esi
+  80174e:	5d                   	pop    %ebp
+  80174f:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801750:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801755:	8b 40 48             	mov    0x48(%eax),%eax
+  801758:	83 ec 04             	sub    $0x4,%esp
+  80175b:	53                   	push   %ebx
+  80175c:	50                   	push   %eax
+  80175d:	68 95 52 80 00       	push   $0x805295
+  801762:	e8 72 eb ff ff       	call   8002d9 <cprintf>
+		return -E_INVAL;
+  801767:	83 c4 10             	add    $0x10,%esp
+  80176a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80176f:	eb d8                	jmp    801749 <write+0x53>
+		return -E_NOT_SUPP;
+  801771:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801776:	eb d1                	jmp    801749 <write+0x53>
+
+00801778 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801778:	55                   	push   %ebp
+  801779:	89 e5                	mov    %esp,%ebp
+  80177b:	83 ec 20             	sub    $0x20,%esp
+	int r;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80177e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801781:	50                   	push   %eax
+  801782:	ff 75 08             	push   0x8(%ebp)
+  801785:	e8 3f fc ff ff       	call   8013c9 <fd_lookup>
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	78 0e                	js     80179f <seek+0x27>
+		return r;
+	fd->fd_offset = offset;
+  801791:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801794:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801797:	89 50 04             	mov    %edx,0x4(%eax)
+	return 0;
+  80179a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80179f:	c9                   	leave
+  8017a0:	c3                   	ret
+
+008017a1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017a1:	55                   	push   %ebp
+  8017a2:	89 e5                	mov    %esp,%ebp
+  8017a4:	56                   	push   %esi
+  8017a5:	53                   	push   %ebx
+  8017a6:	83 ec 18             	sub    $0x18,%esp
+  8017a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017ac:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017af:	50                   	push   %eax
+  8017b0:	53                   	push   %ebx
+  8017b1:	e8 13 fc ff ff       	call   8013c9 <fd_lookup>
+  8017b6:	83 c4 10             	add    $0x10,%esp
+  8017b9:	85 c0                	test   %eax,%eax
+  8017bb:	78 34                	js     8017f1 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017bd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017c0:	83 ec 08             	sub    $0x8,%esp
+  8017c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017c6:	50                   	push   %eax
+  8017c7:	ff 36                	push   (%esi)
+  8017c9:	e8 4b fc ff ff       	call   801419 <dev_lookup>
+  8017ce:	83 c4 10             	add    $0x10,%esp
+  8017d1:	85 c0                	test   %eax,%eax
+  8017d3:	78 1c                	js     8017f1 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017d5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017d9:	74 1d                	je     8017f8 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8017db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017de:	8b 40 18             	mov    0x18(%eax),%eax
+  8017e1:	85 c0                	test   %eax,%eax
+  8017e3:	74 34                	je     801819 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8017e5:	83 ec 08             	sub    $0x8,%esp
+  8017e8:	ff 75 0c             	push   0xc(%ebp)
+  8017eb:	56                   	push   %esi
+  8017ec:	ff d0                	call   *%eax
+  8017ee:	83 c4 10             	add    $0x10,%esp
+}
+  8017f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017f4:	5b                   	pop    %ebx
+  8017f5:	5e                   	pop    %esi
+  8017f6:	5d                   	pop    %ebp
+  8017f7:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8017f8:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8017fd:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801800:	83 ec 04             	sub    $0x4,%esp
+  801803:	53                   	push   %ebx
+  801804:	50                   	push   %eax
+  801805:	68 58 52 80 00       	push   $0x805258
+  80180a:	e8 ca ea ff ff       	call   8002d9 <cprintf>
+		return -E_INVAL;
+  80180f:	83 c4 10             	add    $0x10,%esp
+  801812:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801817:	eb d8                	jmp    8017f1 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801819:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80181e:	eb d1                	jmp    8017f1 <ftruncate+0x50>
+
+00801820 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801820:	55                   	push   %ebp
+  801821:	89 e5                	mov    %esp,%ebp
+  801823:	56                   	push   %esi
+  801824:	53                   	push   %ebx
+  801825:	83 ec 18             	sub    $0x18,%esp
+  801828:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80182b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80182e:	50                   	push   %eax
+  80182f:	ff 75 08             	push   0x8(%ebp)
+  801832:	e8 92 fb ff ff       	call   8013c9 <fd_lookup>
+  801837:	83 c4 10             	add    $0x10,%esp
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	78 49                	js     801887 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80183e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801841:	83 ec 08             	sub    $0x8,%esp
+  801844:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801847:	50                   	push   %eax
+  801848:	ff 36                	push   (%esi)
+  80184a:	e8 ca fb ff ff       	call   801419 <dev_lookup>
+  80184f:	83 c4 10             	add    $0x10,%esp
+  801852:	85 c0                	test   %eax,%eax
+  801854:	78 31                	js     801887 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801856:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801859:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80185d:	74 2f                	je     80188e <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80185f:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801862:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801869:	00 00 00 
+	stat->st_isdir = 0;
+  80186c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801873:	00 00 00 
+	stat->st_dev = dev;
+  801876:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80187c:	83 ec 08             	sub    $0x8,%esp
+  80187f:	53                   	push   %ebx
+  801880:	56                   	push   %esi
+  801881:	ff 50 14             	call   *0x14(%eax)
+  801884:	83 c4 10             	add    $0x10,%esp
+}
+  801887:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188a:	5b                   	pop    %ebx
+  80188b:	5e                   	pop    %esi
+  80188c:	5d                   	pop    %ebp
+  80188d:	c3                   	ret
+		return -E_NOT_SUPP;
+  80188e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801893:	eb f2                	jmp    801887 <fstat+0x67>
+
+00801895 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801895:	55                   	push   %ebp
+  801896:	89 e5                	mov    %esp,%ebp
+  801898:	56                   	push   %esi
+  801899:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+  80189a:	83 ec 08             	sub    $0x8,%esp
+  80189d:	6a 00                	push   $0x0
+  80189f:	ff 75 08             	push   0x8(%ebp)
+  8018a2:	e8 bc 02 00 00       	call   801b63 <open>
+  8018a7:	89 c3                	mov    %eax,%ebx
+  8018a9:	83 c4 10             	add    $0x10,%esp
+  8018ac:	85 c0                	test   %eax,%eax
+  8018ae:	78 1b                	js     8018cb <stat+0x36>
+		return fd;
+	r = fstat(fd, stat);
+  8018b0:	83 ec 08             	sub    $0x8,%esp
+  8018b3:	ff 75 0c             	push   0xc(%ebp)
+  8018b6:	50                   	push   %eax
+  8018b7:	e8 64 ff ff ff       	call   801820 <fstat>
+  8018bc:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8018be:	89 1c 24             	mov    %ebx,(%esp)
+  8018c1:	e8 26 fc ff ff       	call   8014ec <close>
+	return r;
+  8018c6:	83 c4 10             	add    $0x10,%esp
+  8018c9:	89 f3                	mov    %esi,%ebx
+}
+  8018cb:	89 d8                	mov    %ebx,%eax
+  8018cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018d0:	5b                   	pop    %ebx
+  8018d1:	5e                   	pop    %esi
+  8018d2:	5d                   	pop    %ebp
+  8018d3:	c3                   	ret
+
+008018d4 <fsipc_pages>:
+
+// Like fsipc, but take up to npg reply pages, at consecutive pages
+// from dstva.
+static int
+fsipc_pages(unsigned type, void *dstva, size_t npg)
+{
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	57                   	push   %edi
+  8018d8:	56                   	push   %esi
+  8018d9:	53                   	push   %ebx
+  8018da:	83 ec 0c             	sub    $0xc,%esp
+  8018dd:	89 c7                	mov    %eax,%edi
+  8018df:	89 d3                	mov    %edx,%ebx
+  8018e1:	89 ce                	mov    %ecx,%esi
+	static envid_t fsenv;
+	if (fsenv == 0)
+  8018e3:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8018ea:	74 2d                	je     801919 <fsipc_pages+0x45>
+	static_assert(sizeof(fsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8018ec:	6a 07                	push   $0x7
+  8018ee:	68 00 f0 80 00       	push   $0x80f000
+  8018f3:	57                   	push   %edi
+  8018f4:	ff 35 00 70 80 00    	push   0x807000
+  8018fa:	e8 4e 31 00 00       	call   804a4d <ipc_send>
+	return ipc_recv_pages(NULL, dstva, npg, NULL, NULL);
+  8018ff:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  801906:	6a 00                	push   $0x0
+  801908:	56                   	push   %esi
+  801909:	53                   	push   %ebx
+  80190a:	6a 00                	push   $0x0
+  80190c:	e8 ee 2f 00 00       	call   8048ff <ipc_recv_pages>
+}
+  801911:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801914:	5b                   	pop    %ebx
+  801915:	5e                   	pop    %esi
+  801916:	5f                   	pop    %edi
+  801917:	5d                   	pop    %ebp
+  801918:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801919:	83 ec 0c             	sub    $0xc,%esp
+  80191c:	6a 01                	push   $0x1
+  80191e:	e8 1f 32 00 00       	call   804b42 <ipc_find_env>
+  801923:	a3 00 70 80 00       	mov    %eax,0x807000
+  801928:	83 c4 10             	add    $0x10,%esp
+  80192b:	eb bf                	jmp    8018ec <fsipc_pages+0x18>
+
+0080192d <fsipc>:
+{
+  80192d:	55                   	push   %ebp
+  80192e:	89 e5                	mov    %esp,%ebp
+  801930:	83 ec 08             	sub    $0x8,%esp
+	return fsipc_pages(type, dstva, 1);
+  801933:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801938:	e8 97 ff ff ff       	call   8018d4 <fsipc_pages>
+}
+  80193d:	c9                   	leave
+  80193e:	c3                   	ret
+
+0080193f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801945:	8b 45 08             	mov    0x8(%ebp),%eax
+  801948:	8b 40 0c             	mov    0xc(%eax),%eax
+  80194b:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.set_size.req_size = newsize;
+  801950:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801953:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801958:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801962:	e8 c6 ff ff ff       	call   80192d <fsipc>
+}
+  801967:	c9                   	leave
+  801968:	c3                   	ret
+
+00801969 <devfile_flush>:
+{
+  801969:	55                   	push   %ebp
+  80196a:	89 e5                	mov    %esp,%ebp
+  80196c:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80196f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801972:	8b 40 0c             	mov    0xc(%eax),%eax
+  801975:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_FLUSH, NULL);
+  80197a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801984:	e8 a4 ff ff ff       	call   80192d <fsipc>
+}
+  801989:	c9                   	leave
+  80198a:	c3                   	ret
+
+0080198b <devfile_stat>:
+{
+  80198b:	55                   	push   %ebp
+  80198c:	89 e5                	mov    %esp,%ebp
+  80198e:	53                   	push   %ebx
+  80198f:	83 ec 04             	sub    $0x4,%esp
+  801992:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801995:	8b 45 08             	mov    0x8(%ebp),%eax
+  801998:	8b 40 0c             	mov    0xc(%eax),%eax
+  80199b:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019aa:	e8 7e ff ff ff       	call   80192d <fsipc>
+  8019af:	85 c0                	test   %eax,%eax
+  8019b1:	78 2c                	js     8019df <devfile_stat+0x54>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019b3:	83 ec 08             	sub    $0x8,%esp
+  8019b6:	68 00 f0 80 00       	push   $0x80f000
+  8019bb:	53                   	push   %ebx
+  8019bc:	e8 ff ee ff ff       	call   8008c0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019c1:	a1 80 f0 80 00       	mov    0x80f080,%eax
+  8019c6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019cc:	a1 84 f0 80 00       	mov    0x80f084,%eax
+  8019d1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  8019d7:	83 c4 10             	add    $0x10,%esp
+  8019da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019e2:	c9                   	leave
+  8019e3:	c3                   	ret
+
+008019e4 <devfile_write>:
+{
+  8019e4:	55                   	push   %ebp
+  8019e5:	89 e5                	mov    %esp,%ebp
+  8019e7:	83 ec 0c             	sub    $0xc,%esp
+  8019ea:	8b 45 10             	mov    0x10(%ebp),%eax
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8019ed:	ba f8 0f 00 00       	mov    $0xff8,%edx
+  8019f2:	39 d0                	cmp    %edx,%eax
+  8019f4:	0f 47 c2             	cmova  %edx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8019f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019fa:	8b 52 0c             	mov    0xc(%edx),%edx
+  8019fd:	89 15 00 f0 80 00    	mov    %edx,0x80f000
+	fsipcbuf.write.req_n = n;
+  801a03:	a3 04 f0 80 00       	mov    %eax,0x80f004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801a08:	50                   	push   %eax
+  801a09:	ff 75 0c             	push   0xc(%ebp)
+  801a0c:	68 08 f0 80 00       	push   $0x80f008
+  801a11:	e8 30 f0 ff ff       	call   800a46 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801a16:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a1b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801a20:	e8 08 ff ff ff       	call   80192d <fsipc>
+}
+  801a25:	c9                   	leave
+  801a26:	c3                   	ret
+
+00801a27 <devfile_read>:
+{
+  801a27:	55                   	push   %ebp
+  801a28:	89 e5                	mov    %esp,%ebp
+  801a2a:	57                   	push   %edi
+  801a2b:	56                   	push   %esi
+  801a2c:	53                   	push   %ebx
+  801a2d:	83 ec 1c             	sub    $0x1c,%esp
+  801a30:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a33:	8b 7d 10             	mov    0x10(%ebp),%edi
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a36:	89 fe                	mov    %edi,%esi
+  801a38:	c1 ee 0c             	shr    $0xc,%esi
+  801a3b:	b8 20 00 00 00       	mov    $0x20,%eax
+  801a40:	39 c6                	cmp    %eax,%esi
+  801a42:	0f 47 f0             	cmova  %eax,%esi
+  801a45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a4d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  801a50:	eb 14                	jmp    801a66 <devfile_read+0x3f>
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a52:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+		if (!devfile_can_map(buf + npg*PGSIZE))
+  801a59:	05 00 10 00 00       	add    $0x1000,%eax
+  801a5e:	f6 c6 06             	test   $0x6,%dh
+  801a61:	75 42                	jne    801aa5 <devfile_read+0x7e>
+	for (npg = 0; npg < MIN(n / PGSIZE, READMAP_MAXBLOCKS); npg++)
+  801a63:	83 c1 01             	add    $0x1,%ecx
+  801a66:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  801a69:	39 f1                	cmp    %esi,%ecx
+  801a6b:	0f 84 95 00 00 00    	je     801b06 <devfile_read+0xdf>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a71:	89 c2                	mov    %eax,%edx
+  801a73:	c1 ea 16             	shr    $0x16,%edx
+  801a76:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+		&& !(uvpt[PGNUM(va)] & (PTE_SHARE|PTE_NO_PAGE));
+  801a7d:	f6 c2 01             	test   $0x1,%dl
+  801a80:	74 23                	je     801aa5 <devfile_read+0x7e>
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P)
+  801a82:	89 c2                	mov    %eax,%edx
+  801a84:	c1 ea 0c             	shr    $0xc,%edx
+  801a87:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a8e:	f7 c6 01 00 00 00    	test   $0x1,%esi
+  801a94:	74 0f                	je     801aa5 <devfile_read+0x7e>
+		&& (uvpt[PGNUM(va)] & (PTE_W|PTE_COW))
+  801a96:	8b 34 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%esi
+  801a9d:	f7 c6 02 08 00 00    	test   $0x802,%esi
+  801aa3:	75 ad                	jne    801a52 <devfile_read+0x2b>
+	if (npg > 0 && PGOFF(buf) == 0 && fd->fd_offset % BLKSIZE == 0) {
+  801aa5:	85 c9                	test   %ecx,%ecx
+  801aa7:	74 11                	je     801aba <devfile_read+0x93>
+  801aa9:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+  801ab0:	75 08                	jne    801aba <devfile_read+0x93>
+  801ab2:	66 f7 43 04 ff 0f    	testw  $0xfff,0x4(%ebx)
+  801ab8:	74 50                	je     801b0a <devfile_read+0xe3>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801aba:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801abd:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	fsipcbuf.read.req_n = n;
+  801ac2:	89 3d 04 f0 80 00    	mov    %edi,0x80f004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ac8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801acd:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ad2:	e8 56 fe ff ff       	call   80192d <fsipc>
+  801ad7:	89 c6                	mov    %eax,%esi
+  801ad9:	85 c0                	test   %eax,%eax
+  801adb:	78 1f                	js     801afc <devfile_read+0xd5>
+	assert(r <= n);
+  801add:	39 c7                	cmp    %eax,%edi
+  801adf:	72 50                	jb     801b31 <devfile_read+0x10a>
+	assert(r <= PGSIZE);
+  801ae1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ae6:	7f 62                	jg     801b4a <devfile_read+0x123>
+	memmove(buf, &fsipcbuf, r);
+  801ae8:	83 ec 04             	sub    $0x4,%esp
+  801aeb:	50                   	push   %eax
+  801aec:	68 00 f0 80 00       	push   $0x80f000
+  801af1:	ff 75 0c             	push   0xc(%ebp)
+  801af4:	e8 4d ef ff ff       	call   800a46 <memmove>
+	return r;
+  801af9:	83 c4 10             	add    $0x10,%esp
+}
+  801afc:	89 f0                	mov    %esi,%eax
+  801afe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b01:	5b                   	pop    %ebx
+  801b02:	5e                   	pop    %esi
+  801b03:	5f                   	pop    %edi
+  801b04:	5d                   	pop    %ebp
+  801b05:	c3                   	ret
+  801b06:	89 f1                	mov    %esi,%ecx
+  801b08:	eb 9b                	jmp    801aa5 <devfile_read+0x7e>
+		fsipcbuf.readmap.req_fileid = fd->fd_file.id;
+  801b0a:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801b0d:	a3 00 f0 80 00       	mov    %eax,0x80f000
+		fsipcbuf.readmap.req_n = npg * PGSIZE;
+  801b12:	89 c8                	mov    %ecx,%eax
+  801b14:	c1 e0 0c             	shl    $0xc,%eax
+  801b17:	a3 04 f0 80 00       	mov    %eax,0x80f004
+		if ((r = fsipc_pages(FSREQ_READMAP, buf, npg)) >= 0)
+  801b1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b1f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801b24:	e8 ab fd ff ff       	call   8018d4 <fsipc_pages>
+  801b29:	89 c6                	mov    %eax,%esi
+  801b2b:	85 c0                	test   %eax,%eax
+  801b2d:	78 8b                	js     801aba <devfile_read+0x93>
+  801b2f:	eb cb                	jmp    801afc <devfile_read+0xd5>
+	assert(r <= n);
+  801b31:	68 c4 52 80 00       	push   $0x8052c4
+  801b36:	68 fb 4d 80 00       	push   $0x804dfb
+  801b3b:	68 a0 00 00 00       	push   $0xa0
+  801b40:	68 cb 52 80 00       	push   $0x8052cb
+  801b45:	e8 b4 e6 ff ff       	call   8001fe <_panic>
+	assert(r <= PGSIZE);
+  801b4a:	68 d6 52 80 00       	push   $0x8052d6
+  801b4f:	68 fb 4d 80 00       	push   $0x804dfb
+  801b54:	68 a1 00 00 00       	push   $0xa1
+  801b59:	68 cb 52 80 00       	push   $0x8052cb
+  801b5e:	e8 9b e6 ff ff       	call   8001fe <_panic>
+
+00801b63 <open>:
+{
+  801b63:	55                   	push   %ebp
+  801b64:	89 e5                	mov    %esp,%ebp
+  801b66:	56                   	push   %esi
+  801b67:	53                   	push   %ebx
+  801b68:	83 ec 1c             	sub    $0x1c,%esp
+  801b6b:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801b6e:	56                   	push   %esi
+  801b6f:	e8 11 ed ff ff       	call   800885 <strlen>
+  801b74:	83 c4 10             	add    $0x10,%esp
+  801b77:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b7c:	7f 6c                	jg     801bea <open+0x87>
+	if ((r = fd_alloc(&fd)) < 0)
+  801b7e:	83 ec 0c             	sub    $0xc,%esp
+  801b81:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b84:	50                   	push   %eax
+  801b85:	e8 eb f7 ff ff       	call   801375 <fd_alloc>
+  801b8a:	89 c3                	mov    %eax,%ebx
+  801b8c:	83 c4 10             	add    $0x10,%esp
+  801b8f:	85 c0                	test   %eax,%eax
+  801b91:	78 3c                	js     801bcf <open+0x6c>
+	strcpy(fsipcbuf.open.req_path, path);
+  801b93:	83 ec 08             	sub    $0x8,%esp
+  801b96:	56                   	push   %esi
+  801b97:	68 00 f0 80 00       	push   $0x80f000
+  801b9c:	e8 1f ed ff ff       	call   8008c0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801ba1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ba4:	a3 00 f4 80 00       	mov    %eax,0x80f400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ba9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bac:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bb1:	e8 77 fd ff ff       	call   80192d <fsipc>
+  801bb6:	89 c3                	mov    %eax,%ebx
+  801bb8:	83 c4 10             	add    $0x10,%esp
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	78 19                	js     801bd8 <open+0x75>
+	return fd2num(fd);
+  801bbf:	83 ec 0c             	sub    $0xc,%esp
+  801bc2:	ff 75 f4             	push   -0xc(%ebp)
+  801bc5:	e8 84 f7 ff ff       	call   80134e <fd2num>
+  801bca:	89 c3                	mov    %eax,%ebx
+  801bcc:	83 c4 10             	add    $0x10,%esp
+}
+  801bcf:	89 d8                	mov    %ebx,%eax
+  801bd1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bd4:	5b                   	pop    %ebx
+  801bd5:	5e                   	pop    %esi
+  801bd6:	5d                   	pop    %ebp
+  801bd7:	c3                   	ret
+		fd_close(fd, 0);
+  801bd8:	83 ec 08             	sub    $0x8,%esp
+  801bdb:	6a 00                	push   $0x0
+  801bdd:	ff 75 f4             	push   -0xc(%ebp)
+  801be0:	e8 80 f8 ff ff       	call   801465 <fd_close>
+		return r;
+  801be5:	83 c4 10             	add    $0x10,%esp
+  801be8:	eb e5                	jmp    801bcf <open+0x6c>
+		return -E_BAD_PATH;
+  801bea:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801bef:	eb de                	jmp    801bcf <open+0x6c>
+
+00801bf1 <remove>:
+
+
+// Delete a file
+int
+remove(const char *path)
+{
+  801bf1:	55                   	push   %ebp
+  801bf2:	89 e5                	mov    %esp,%ebp
+  801bf4:	53                   	push   %ebx
+  801bf5:	83 ec 10             	sub    $0x10,%esp
+  801bf8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  801bfb:	53                   	push   %ebx
+  801bfc:	e8 84 ec ff ff       	call   800885 <strlen>
+  801c01:	83 c4 10             	add    $0x10,%esp
+  801c04:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c09:	7f 25                	jg     801c30 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  801c0b:	83 ec 08             	sub    $0x8,%esp
+  801c0e:	53                   	push   %ebx
+  801c0f:	68 00 f0 80 00       	push   $0x80f000
+  801c14:	e8 a7 ec ff ff       	call   8008c0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  801c19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c1e:	b8 07 00 00 00       	mov    $0x7,%eax
+  801c23:	e8 05 fd ff ff       	call   80192d <fsipc>
+  801c28:	83 c4 10             	add    $0x10,%esp
+}
+  801c2b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c2e:	c9                   	leave
+  801c2f:	c3                   	ret
+		return -E_BAD_PATH;
+  801c30:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801c35:	eb f4                	jmp    801c2b <remove+0x3a>
+
+00801c37 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801c37:	55                   	push   %ebp
+  801c38:	89 e5                	mov    %esp,%ebp
+  801c3a:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  801c3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c42:	b8 08 00 00 00       	mov    $0x8,%eax
+  801c47:	e8 e1 fc ff ff       	call   80192d <fsipc>
+}
+  801c4c:	c9                   	leave
+  801c4d:	c3                   	ret
+
+00801c4e <fs_bcstat>:
+
+// Get the file server's block cache statistics.
+int
+fs_bcstat(struct Fsret_bcstat *st)
+{
+  801c4e:	55                   	push   %ebp
+  801c4f:	89 e5                	mov    %esp,%ebp
+  801c51:	53                   	push   %ebx
+  801c52:	83 ec 04             	sub    $0x4,%esp
+  801c55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTAT, NULL)) < 0)
+  801c58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c62:	e8 c6 fc ff ff       	call   80192d <fsipc>
+  801c67:	85 c0                	test   %eax,%eax
+  801c69:	78 3c                	js     801ca7 <fs_bcstat+0x59>
+		return r;
+	*st = fsipcbuf.bcstatRet;
+  801c6b:	a1 00 f0 80 00       	mov    0x80f000,%eax
+  801c70:	89 03                	mov    %eax,(%ebx)
+  801c72:	a1 04 f0 80 00       	mov    0x80f004,%eax
+  801c77:	89 43 04             	mov    %eax,0x4(%ebx)
+  801c7a:	a1 08 f0 80 00       	mov    0x80f008,%eax
+  801c7f:	89 43 08             	mov    %eax,0x8(%ebx)
+  801c82:	a1 0c f0 80 00       	mov    0x80f00c,%eax
+  801c87:	89 43 0c             	mov    %eax,0xc(%ebx)
+  801c8a:	a1 10 f0 80 00       	mov    0x80f010,%eax
+  801c8f:	89 43 10             	mov    %eax,0x10(%ebx)
+  801c92:	a1 14 f0 80 00       	mov    0x80f014,%eax
+  801c97:	89 43 14             	mov    %eax,0x14(%ebx)
+  801c9a:	a1 18 f0 80 00       	mov    0x80f018,%eax
+  801c9f:	89 43 18             	mov    %eax,0x18(%ebx)
+	return 0;
+  801ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ca7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801caa:	c9                   	leave
+  801cab:	c3                   	ret
+
+00801cac <fs_bcset>:
+
+// Change the file server's block cache capacity to 'capacity' blocks.
+int
+fs_bcset(uint32_t capacity)
+{
+  801cac:	55                   	push   %ebp
+  801cad:	89 e5                	mov    %esp,%ebp
+  801caf:	83 ec 08             	sub    $0x8,%esp
+	fsipcbuf.bcset.req_capacity = capacity;
+  801cb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb5:	a3 00 f0 80 00       	mov    %eax,0x80f000
+	return fsipc(FSREQ_BCSET, NULL);
+  801cba:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801cc4:	e8 64 fc ff ff       	call   80192d <fsipc>
+}
+  801cc9:	c9                   	leave
+  801cca:	c3                   	ret
+
+00801ccb <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ccb:	55                   	push   %ebp
+  801ccc:	89 e5                	mov    %esp,%ebp
+  801cce:	56                   	push   %esi
+  801ccf:	53                   	push   %ebx
+  801cd0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  801cd3:	83 ec 0c             	sub    $0xc,%esp
+  801cd6:	ff 75 08             	push   0x8(%ebp)
+  801cd9:	e8 80 f6 ff ff       	call   80135e <fd2data>
+  801cde:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  801ce0:	83 c4 08             	add    $0x8,%esp
+  801ce3:	68 e2 52 80 00       	push   $0x8052e2
+  801ce8:	53                   	push   %ebx
+  801ce9:	e8 d2 eb ff ff       	call   8008c0 <strcpy>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801cee:	8b 46 04             	mov    0x4(%esi),%eax
+  801cf1:	8d 88 e0 1f 00 00    	lea    0x1fe0(%eax),%ecx
+  801cf7:	2b 0e                	sub    (%esi),%ecx
+  801cf9:	ba 81 80 80 80       	mov    $0x80808081,%edx
+  801cfe:	89 c8                	mov    %ecx,%eax
+  801d00:	f7 e2                	mul    %edx
+  801d02:	c1 ea 0c             	shr    $0xc,%edx
+  801d05:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801d0b:	29 d1                	sub    %edx,%ecx
+  801d0d:	89 8b 80 00 00 00    	mov    %ecx,0x80(%ebx)
+	stat->st_size = pipe_count(p);
+	stat->st_isdir = 0;
+  801d13:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d1a:	00 00 00 
+	stat->st_dev = &devpipe;
+  801d1d:	c7 83 88 00 00 00 20 	movl   $0x806020,0x88(%ebx)
+  801d24:	60 80 00 
+	return 0;
+}
+  801d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d2f:	5b                   	pop    %ebx
+  801d30:	5e                   	pop    %esi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+
+00801d33 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801d33:	55                   	push   %ebp
+  801d34:	89 e5                	mov    %esp,%ebp
+  801d36:	53                   	push   %ebx
+  801d37:	83 ec 0c             	sub    $0xc,%esp
+  801d3a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  801d3d:	53                   	push   %ebx
+  801d3e:	6a 00                	push   $0x0
+  801d40:	e8 f3 f0 ff ff       	call   800e38 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  801d45:	89 1c 24             	mov    %ebx,(%esp)
+  801d48:	e8 11 f6 ff ff       	call   80135e <fd2data>
+  801d4d:	83 c4 08             	add    $0x8,%esp
+  801d50:	50                   	push   %eax
+  801d51:	6a 00                	push   $0x0
+  801d53:	e8 e0 f0 ff ff       	call   800e38 <sys_page_unmap>
+}
+  801d58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d5b:	c9                   	leave
+  801d5c:	c3                   	ret
+
+00801d5d <_pipeisclosed>:
+{
+  801d5d:	55                   	push   %ebp
+  801d5e:	89 e5                	mov    %esp,%ebp
+  801d60:	57                   	push   %edi
+  801d61:	56                   	push   %esi
+  801d62:	53                   	push   %ebx
+  801d63:	83 ec 1c             	sub    $0x1c,%esp
+  801d66:	89 c7                	mov    %eax,%edi
+  801d68:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  801d6a:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  801d6f:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  801d72:	83 ec 0c             	sub    $0xc,%esp
+  801d75:	57                   	push   %edi
+  801d76:	e8 06 2e 00 00       	call   804b81 <pageref>
+  801d7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d7e:	89 34 24             	mov    %esi,(%esp)
+  801d81:	e8 fb 2d 00 00       	call   804b81 <pageref>
+		nn = thisenv->env_runs;
+  801d86:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  801d8c:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  801d8f:	83 c4 10             	add    $0x10,%esp
+  801d92:	39 cb                	cmp    %ecx,%ebx
+  801d94:	74 1b                	je     801db1 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  801d96:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801d99:	75 cf                	jne    801d6a <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801d9b:	8b 42 58             	mov    0x58(%edx),%eax
+  801d9e:	6a 01                	push   $0x1
+  801da0:	50                   	push   %eax
+  801da1:	53                   	push   %ebx
+  801da2:	68 e9 52 80 00       	push   $0x8052e9
+  801da7:	e8 2d e5 ff ff       	call   8002d9 <cprintf>
+  801dac:	83 c4 10             	add    $0x10,%esp
+  801daf:	eb b9                	jmp    801d6a <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  801db1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801db4:	0f 94 c0             	sete   %al
+  801db7:	0f b6 c0             	movzbl %al,%eax
+}
+  801dba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dbd:	5b                   	pop    %ebx
+  801dbe:	5e                   	pop    %esi
+  801dbf:	5f                   	pop    %edi
+  801dc0:	5d                   	pop    %ebp
+  801dc1:	c3                   	ret
+
+00801dc2 <devpipe_read>:
+{
+  801dc2:	55                   	push   %ebp
+  801dc3:	89 e5                	mov    %esp,%ebp
+  801dc5:	57                   	push   %edi
+  801dc6:	56                   	push   %esi
+  801dc7:	53                   	push   %ebx
+  801dc8:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*)fd2data(fd);
+  801dcb:	ff 75 08             	push   0x8(%ebp)
+  801dce:	e8 8b f5 ff ff       	call   80135e <fd2data>
+  801dd3:	89 c3                	mov    %eax,%ebx
+	while (pipe_count(p) == 0) {
+  801dd5:	83 c4 10             	add    $0x10,%esp
+		pipe_sleep(&p->p_wpos, wpos, ref, &p->p_rsleep);
+  801dd8:	8d 40 04             	lea    0x4(%eax),%eax
+  801ddb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801dde:	8b 7b 04             	mov    0x4(%ebx),%edi
+  801de1:	8b 0b                	mov    (%ebx),%ecx
+  801de3:	8d b7 e0 1f 00 00    	lea    0x1fe0(%edi),%esi
+  801de9:	29 ce                	sub    %ecx,%esi
+  801deb:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801df0:	f7 e6                	mul    %esi
+  801df2:	c1 ea 0c             	shr    $0xc,%edx
+  801df5:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+	while (pipe_count(p) == 0) {
+  801dfb:	29 c6                	sub    %eax,%esi
+  801dfd:	89 f2                	mov    %esi,%edx
+  801dff:	75 43                	jne    801e44 <devpipe_read+0x82>
+		ref = pageref(p);
+  801e01:	83 ec 0c             	sub    $0xc,%esp
+  801e04:	53                   	push   %ebx
+  801e05:	e8 77 2d 00 00       	call   804b81 <pageref>
+  801e0a:	89 c6                	mov    %eax,%esi
+		if (_pipeisclosed(fd, p))
+  801e0c:	89 da                	mov    %ebx,%edx
+  801e0e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e11:	e8 47 ff ff ff       	call   801d5d <_pipeisclosed>
+  801e16:	83 c4 10             	add    $0x10,%esp
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	0f 85 c1 00 00 00    	jne    801ee2 <devpipe_read+0x120>
+	*sleeping = 1;
+  801e21:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+	__sync_synchronize();
+  801e28:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801e2d:	39 7b 04             	cmp    %edi,0x4(%ebx)
+  801e30:	75 ac                	jne    801dde <devpipe_read+0x1c>
+		sys_futex_wait(pos, seen, ref);
+  801e32:	83 ec 04             	sub    $0x4,%esp
+  801e35:	56                   	push   %esi
+  801e36:	57                   	push   %edi
+  801e37:	ff 75 e4             	push   -0x1c(%ebp)
+  801e3a:	e8 4d f4 ff ff       	call   80128c <sys_futex_wait>
+  801e3f:	83 c4 10             	add    $0x10,%esp
+  801e42:	eb 9a                	jmp    801dde <devpipe_read+0x1c>
+	n = MIN(n, pipe_count(p));
+  801e44:	39 75 10             	cmp    %esi,0x10(%ebp)
+  801e47:	0f 46 55 10          	cmovbe 0x10(%ebp),%edx
+  801e4b:	89 d6                	mov    %edx,%esi
+	i = p->p_rpos % PIPEBUFSIZ;
+  801e4d:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801e52:	f7 e1                	mul    %ecx
+  801e54:	c1 ea 0b             	shr    $0xb,%edx
+  801e57:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801e5d:	29 c1                	sub    %eax,%ecx
+  801e5f:	89 ca                	mov    %ecx,%edx
+	m = MIN(n, PIPEBUFSIZ - i);
+  801e61:	bf f0 0f 00 00       	mov    $0xff0,%edi
+  801e66:	29 cf                	sub    %ecx,%edi
+  801e68:	39 f7                	cmp    %esi,%edi
+  801e6a:	0f 47 fe             	cmova  %esi,%edi
+	memmove(buf, p->p_buf + i, m);
+  801e6d:	8d 43 10             	lea    0x10(%ebx),%eax
+  801e70:	83 ec 04             	sub    $0x4,%esp
+  801e73:	57                   	push   %edi
+  801e74:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801e77:	01 c2                	add    %eax,%edx
+  801e79:	52                   	push   %edx
+  801e7a:	ff 75 0c             	push   0xc(%ebp)
+  801e7d:	e8 c4 eb ff ff       	call   800a46 <memmove>
+	memmove(buf + m, p->p_buf, n - m);
+  801e82:	83 c4 0c             	add    $0xc,%esp
+  801e85:	89 f1                	mov    %esi,%ecx
+  801e87:	29 f9                	sub    %edi,%ecx
+  801e89:	51                   	push   %ecx
+  801e8a:	ff 75 e4             	push   -0x1c(%ebp)
+  801e8d:	89 f8                	mov    %edi,%eax
+  801e8f:	03 45 0c             	add    0xc(%ebp),%eax
+  801e92:	50                   	push   %eax
+  801e93:	e8 ae eb ff ff       	call   800a46 <memmove>
+	p->p_rpos = (p->p_rpos + n) % (2*PIPEBUFSIZ);
+  801e98:	89 f1                	mov    %esi,%ecx
+  801e9a:	03 0b                	add    (%ebx),%ecx
+  801e9c:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801ea1:	f7 e1                	mul    %ecx
+  801ea3:	c1 ea 0c             	shr    $0xc,%edx
+  801ea6:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801eac:	29 d1                	sub    %edx,%ecx
+  801eae:	89 0b                	mov    %ecx,(%ebx)
+	__sync_synchronize();
+  801eb0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801eb5:	83 c4 10             	add    $0x10,%esp
+  801eb8:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+  801ebc:	75 0a                	jne    801ec8 <devpipe_read+0x106>
+	return n;
+  801ebe:	89 f0                	mov    %esi,%eax
+}
+  801ec0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ec3:	5b                   	pop    %ebx
+  801ec4:	5e                   	pop    %esi
+  801ec5:	5f                   	pop    %edi
+  801ec6:	5d                   	pop    %ebp
+  801ec7:	c3                   	ret
+		*sleeping = 0;
+  801ec8:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+		sys_futex_wake(pos, NENV);
+  801ecf:	83 ec 08             	sub    $0x8,%esp
+  801ed2:	68 00 04 00 00       	push   $0x400
+  801ed7:	53                   	push   %ebx
+  801ed8:	e8 ff f3 ff ff       	call   8012dc <sys_futex_wake>
+  801edd:	83 c4 10             	add    $0x10,%esp
+  801ee0:	eb dc                	jmp    801ebe <devpipe_read+0xfc>
+			return 0;
+  801ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee7:	eb d7                	jmp    801ec0 <devpipe_read+0xfe>
+
+00801ee9 <devpipe_write>:
+{
+  801ee9:	55                   	push   %ebp
+  801eea:	89 e5                	mov    %esp,%ebp
+  801eec:	57                   	push   %edi
+  801eed:	56                   	push   %esi
+  801eee:	53                   	push   %ebx
+  801eef:	83 ec 28             	sub    $0x28,%esp
+	p = (struct Pipe*) fd2data(fd);
+  801ef2:	ff 75 08             	push   0x8(%ebp)
+  801ef5:	e8 64 f4 ff ff       	call   80135e <fd2data>
+  801efa:	89 c7                	mov    %eax,%edi
+	for (i = 0; i < n; i += m) {
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  801f06:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f09:	3b 45 10             	cmp    0x10(%ebp),%eax
+  801f0c:	0f 83 23 01 00 00    	jae    802035 <devpipe_write+0x14c>
+	return (p->p_wpos + 2*PIPEBUFSIZ - p->p_rpos) % (2*PIPEBUFSIZ);
+  801f12:	8b 77 04             	mov    0x4(%edi),%esi
+  801f15:	8b 1f                	mov    (%edi),%ebx
+  801f17:	8d 8e e0 1f 00 00    	lea    0x1fe0(%esi),%ecx
+  801f1d:	29 d9                	sub    %ebx,%ecx
+  801f1f:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f24:	f7 e1                	mul    %ecx
+  801f26:	c1 ea 0c             	shr    $0xc,%edx
+  801f29:	69 c2 e0 1f 00 00    	imul   $0x1fe0,%edx,%eax
+  801f2f:	29 c1                	sub    %eax,%ecx
+  801f31:	89 ca                	mov    %ecx,%edx
+		while (pipe_count(p) == PIPEBUFSIZ) {
+  801f33:	81 f9 f0 0f 00 00    	cmp    $0xff0,%ecx
+  801f39:	75 40                	jne    801f7b <devpipe_write+0x92>
+			ref = pageref(p);
+  801f3b:	83 ec 0c             	sub    $0xc,%esp
+  801f3e:	57                   	push   %edi
+  801f3f:	e8 3d 2c 00 00       	call   804b81 <pageref>
+  801f44:	89 c6                	mov    %eax,%esi
+			if (_pipeisclosed(fd, p))
+  801f46:	89 fa                	mov    %edi,%edx
+  801f48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4b:	e8 0d fe ff ff       	call   801d5d <_pipeisclosed>
+  801f50:	83 c4 10             	add    $0x10,%esp
+  801f53:	85 c0                	test   %eax,%eax
+  801f55:	0f 85 d5 00 00 00    	jne    802030 <devpipe_write+0x147>
+	*sleeping = 1;
+  801f5b:	c7 47 0c 01 00 00 00 	movl   $0x1,0xc(%edi)
+	__sync_synchronize();
+  801f62:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*pos == seen)
+  801f67:	39 1f                	cmp    %ebx,(%edi)
+  801f69:	75 a7                	jne    801f12 <devpipe_write+0x29>
+		sys_futex_wait(pos, seen, ref);
+  801f6b:	83 ec 04             	sub    $0x4,%esp
+  801f6e:	56                   	push   %esi
+  801f6f:	53                   	push   %ebx
+  801f70:	57                   	push   %edi
+  801f71:	e8 16 f3 ff ff       	call   80128c <sys_futex_wait>
+  801f76:	83 c4 10             	add    $0x10,%esp
+  801f79:	eb 97                	jmp    801f12 <devpipe_write+0x29>
+		m = MIN(n - i, PIPEBUFSIZ - pipe_count(p));
+  801f7b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801f7e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801f81:	29 c1                	sub    %eax,%ecx
+  801f83:	bb f0 0f 00 00       	mov    $0xff0,%ebx
+  801f88:	89 d8                	mov    %ebx,%eax
+  801f8a:	29 d0                	sub    %edx,%eax
+  801f8c:	39 c1                	cmp    %eax,%ecx
+  801f8e:	0f 46 c1             	cmovbe %ecx,%eax
+  801f91:	89 c1                	mov    %eax,%ecx
+		j = p->p_wpos % PIPEBUFSIZ;
+  801f93:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801f98:	f7 e6                	mul    %esi
+  801f9a:	c1 ea 0b             	shr    $0xb,%edx
+  801f9d:	69 c2 f0 0f 00 00    	imul   $0xff0,%edx,%eax
+  801fa3:	29 c6                	sub    %eax,%esi
+  801fa5:	89 f2                	mov    %esi,%edx
+		k = MIN(m, PIPEBUFSIZ - j);
+  801fa7:	29 f3                	sub    %esi,%ebx
+  801fa9:	39 cb                	cmp    %ecx,%ebx
+  801fab:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801fae:	0f 47 d9             	cmova  %ecx,%ebx
+		memmove(p->p_buf + j, buf + i, k);
+  801fb1:	8d 77 10             	lea    0x10(%edi),%esi
+  801fb4:	83 ec 04             	sub    $0x4,%esp
+  801fb7:	53                   	push   %ebx
+  801fb8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fbb:	03 45 0c             	add    0xc(%ebp),%eax
+  801fbe:	50                   	push   %eax
+  801fbf:	01 f2                	add    %esi,%edx
+  801fc1:	52                   	push   %edx
+  801fc2:	e8 7f ea ff ff       	call   800a46 <memmove>
+		memmove(p->p_buf, buf + i + k, m - k);
+  801fc7:	83 c4 0c             	add    $0xc,%esp
+  801fca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fcd:	29 d8                	sub    %ebx,%eax
+  801fcf:	50                   	push   %eax
+  801fd0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fd3:	01 d3                	add    %edx,%ebx
+  801fd5:	03 5d 0c             	add    0xc(%ebp),%ebx
+  801fd8:	53                   	push   %ebx
+  801fd9:	56                   	push   %esi
+  801fda:	e8 67 ea ff ff       	call   800a46 <memmove>
+		p->p_wpos = (p->p_wpos + m) % (2*PIPEBUFSIZ);
+  801fdf:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801fe2:	03 4f 04             	add    0x4(%edi),%ecx
+  801fe5:	b8 81 80 80 80       	mov    $0x80808081,%eax
+  801fea:	f7 e1                	mul    %ecx
+  801fec:	c1 ea 0c             	shr    $0xc,%edx
+  801fef:	69 d2 e0 1f 00 00    	imul   $0x1fe0,%edx,%edx
+  801ff5:	29 d1                	sub    %edx,%ecx
+  801ff7:	89 4f 04             	mov    %ecx,0x4(%edi)
+	__sync_synchronize();
+  801ffa:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+	if (*sleeping) {
+  801fff:	83 c4 10             	add    $0x10,%esp
+  802002:	83 7f 08 00          	cmpl   $0x0,0x8(%edi)
+  802006:	75 0b                	jne    802013 <devpipe_write+0x12a>
+	for (i = 0; i < n; i += m) {
+  802008:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  80200b:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80200e:	e9 f3 fe ff ff       	jmp    801f06 <devpipe_write+0x1d>
+		*sleeping = 0;
+  802013:	c7 47 08 00 00 00 00 	movl   $0x0,0x8(%edi)
+		sys_futex_wake(pos, NENV);
+  80201a:	83 ec 08             	sub    $0x8,%esp
+  80201d:	68 00 04 00 00       	push   $0x400
+		pipe_wake(&p->p_wpos, &p->p_rsleep);
+  802022:	8d 47 04             	lea    0x4(%edi),%eax
+		sys_futex_wake(pos, NENV);
+  802025:	50                   	push   %eax
+  802026:	e8 b1 f2 ff ff       	call   8012dc <sys_futex_wake>
+  80202b:	83 c4 10             	add    $0x10,%esp
+  80202e:	eb d8                	jmp    802008 <devpipe_write+0x11f>
+				return 0;
+  802030:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802035:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802038:	5b                   	pop    %ebx
+  802039:	5e                   	pop    %esi
+  80203a:	5f                   	pop    %edi
+  80203b:	5d                   	pop    %ebp
+  80203c:	c3                   	ret
+
+0080203d <pipe>:
+{
+  80203d:	55                   	push   %ebp
+  80203e:	89 e5                	mov    %esp,%ebp
+  802040:	56                   	push   %esi
+  802041:	53                   	push   %ebx
+  802042:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802045:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802048:	50                   	push   %eax
+  802049:	e8 27 f3 ff ff       	call   801375 <fd_alloc>
+  80204e:	89 c3                	mov    %eax,%ebx
+  802050:	83 c4 10             	add    $0x10,%esp
+  802053:	85 c0                	test   %eax,%eax
+  802055:	0f 88 23 01 00 00    	js     80217e <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80205b:	83 ec 04             	sub    $0x4,%esp
+  80205e:	68 07 04 00 00       	push   $0x407
+  802063:	ff 75 f4             	push   -0xc(%ebp)
+  802066:	6a 00                	push   $0x0
+  802068:	e8 46 ed ff ff       	call   800db3 <sys_page_alloc>
+  80206d:	89 c3                	mov    %eax,%ebx
+  80206f:	83 c4 10             	add    $0x10,%esp
+  802072:	85 c0                	test   %eax,%eax
+  802074:	0f 88 04 01 00 00    	js     80217e <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  80207a:	83 ec 0c             	sub    $0xc,%esp
+  80207d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802080:	50                   	push   %eax
+  802081:	e8 ef f2 ff ff       	call   801375 <fd_alloc>
+  802086:	89 c3                	mov    %eax,%ebx
+  802088:	83 c4 10             	add    $0x10,%esp
+  80208b:	85 c0                	test   %eax,%eax
+  80208d:	0f 88 db 00 00 00    	js     80216e <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802093:	83 ec 04             	sub    $0x4,%esp
+  802096:	68 07 04 00 00       	push   $0x407
+  80209b:	ff 75 f0             	push   -0x10(%ebp)
+  80209e:	6a 00                	push   $0x0
+  8020a0:	e8 0e ed ff ff       	call   800db3 <sys_page_alloc>
+  8020a5:	89 c3                	mov    %eax,%ebx
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	0f 88 bc 00 00 00    	js     80216e <pipe+0x131>
+	va = fd2data(fd0);
+  8020b2:	83 ec 0c             	sub    $0xc,%esp
+  8020b5:	ff 75 f4             	push   -0xc(%ebp)
+  8020b8:	e8 a1 f2 ff ff       	call   80135e <fd2data>
+  8020bd:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020bf:	83 c4 0c             	add    $0xc,%esp
+  8020c2:	68 07 04 00 00       	push   $0x407
+  8020c7:	50                   	push   %eax
+  8020c8:	6a 00                	push   $0x0
+  8020ca:	e8 e4 ec ff ff       	call   800db3 <sys_page_alloc>
+  8020cf:	89 c3                	mov    %eax,%ebx
+  8020d1:	83 c4 10             	add    $0x10,%esp
+  8020d4:	85 c0                	test   %eax,%eax
+  8020d6:	0f 88 82 00 00 00    	js     80215e <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8020dc:	83 ec 0c             	sub    $0xc,%esp
+  8020df:	ff 75 f0             	push   -0x10(%ebp)
+  8020e2:	e8 77 f2 ff ff       	call   80135e <fd2data>
+  8020e7:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8020ee:	50                   	push   %eax
+  8020ef:	6a 00                	push   $0x0
+  8020f1:	56                   	push   %esi
+  8020f2:	6a 00                	push   $0x0
+  8020f4:	e8 fd ec ff ff       	call   800df6 <sys_page_map>
+  8020f9:	89 c3                	mov    %eax,%ebx
+  8020fb:	83 c4 20             	add    $0x20,%esp
+  8020fe:	85 c0                	test   %eax,%eax
+  802100:	78 4e                	js     802150 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802102:	a1 20 60 80 00       	mov    0x806020,%eax
+  802107:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80210a:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80210c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80210f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802116:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802119:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  80211b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80211e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802125:	83 ec 0c             	sub    $0xc,%esp
+  802128:	ff 75 f4             	push   -0xc(%ebp)
+  80212b:	e8 1e f2 ff ff       	call   80134e <fd2num>
+  802130:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802133:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802135:	83 c4 04             	add    $0x4,%esp
+  802138:	ff 75 f0             	push   -0x10(%ebp)
+  80213b:	e8 0e f2 ff ff       	call   80134e <fd2num>
+  802140:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802143:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802146:	83 c4 10             	add    $0x10,%esp
+  802149:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80214e:	eb 2e                	jmp    80217e <pipe+0x141>
+	sys_page_unmap(0, va);
+  802150:	83 ec 08             	sub    $0x8,%esp
+  802153:	56                   	push   %esi
+  802154:	6a 00                	push   $0x0
+  802156:	e8 dd ec ff ff       	call   800e38 <sys_page_unmap>
+  80215b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80215e:	83 ec 08             	sub    $0x8,%esp
+  802161:	ff 75 f0             	push   -0x10(%ebp)
+  802164:	6a 00                	push   $0x0
+  802166:	e8 cd ec ff ff       	call   800e38 <sys_page_unmap>
+  80216b:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80216e:	83 ec 08             	sub    $0x8,%esp
+  802171:	ff 75 f4             	push   -0xc(%ebp)
+  802174:	6a 00                	push   $0x0
+  802176:	e8 bd ec ff ff       	call   800e38 <sys_page_unmap>
+  80217b:	83 c4 10             	add    $0x10,%esp
+}
+  80217e:	89 d8                	mov    %ebx,%eax
+  802180:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802183:	5b                   	pop    %ebx
+  802184:	5e                   	pop    %esi
+  802185:	5d                   	pop    %ebp
+  802186:	c3                   	ret
+
+00802187 <pipeisclosed>:
+{
+  802187:	55                   	push   %ebp
+  802188:	89 e5                	mov    %esp,%ebp
+  80218a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80218d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802190:	50                   	push   %eax
+  802191:	ff 75 08             	push   0x8(%ebp)
+  802194:	e8 30 f2 ff ff       	call   8013c9 <fd_lookup>
+  802199:	83 c4 10             	add    $0x10,%esp
+  80219c:	85 c0                	test   %eax,%eax
+  80219e:	78 18                	js     8021b8 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8021a0:	83 ec 0c             	sub    $0xc,%esp
+  8021a3:	ff 75 f4             	push   -0xc(%ebp)
+  8021a6:	e8 b3 f1 ff ff       	call   80135e <fd2data>
+  8021ab:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8021ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b0:	e8 a8 fb ff ff       	call   801d5d <_pipeisclosed>
+  8021b5:	83 c4 10             	add    $0x10,%esp
+}
+  8021b8:	c9                   	leave
+  8021b9:	c3                   	ret
+
+008021ba <segment_lookup>:
+
+// Return the lazily loaded segment (see sys_env_set_segments) that va
+// is in, or NULL if it isn't in one.
+static const volatile struct Segment *
+segment_lookup(void *va)
+{
+  8021ba:	89 c1                	mov    %eax,%ecx
+	const volatile struct Segment *seg;
+
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021bc:	8b 15 18 e9 80 00    	mov    0x80e918,%edx
+  8021c2:	8d 82 b4 00 00 00    	lea    0xb4(%edx),%eax
+  8021c8:	81 c2 34 01 00 00    	add    $0x134,%edx
+  8021ce:	39 d0                	cmp    %edx,%eax
+  8021d0:	74 2e                	je     802200 <segment_lookup+0x46>
+{
+  8021d2:	55                   	push   %ebp
+  8021d3:	89 e5                	mov    %esp,%ebp
+  8021d5:	57                   	push   %edi
+  8021d6:	56                   	push   %esi
+  8021d7:	53                   	push   %ebx
+  8021d8:	eb 07                	jmp    8021e1 <segment_lookup+0x27>
+	for (seg = thisenv->env_segs; seg < thisenv->env_segs + NSEGS; seg++)
+  8021da:	83 c0 20             	add    $0x20,%eax
+  8021dd:	39 d0                	cmp    %edx,%eax
+  8021df:	74 15                	je     8021f6 <segment_lookup+0x3c>
+		if ((uintptr_t)va >= seg->seg_va &&
+  8021e1:	8b 18                	mov    (%eax),%ebx
+  8021e3:	39 d9                	cmp    %ebx,%ecx
+  8021e5:	72 f3                	jb     8021da <segment_lookup+0x20>
+		    (uintptr_t)va - seg->seg_va < seg->seg_memsz)
+  8021e7:	8b 38                	mov    (%eax),%edi
+  8021e9:	8b 58 04             	mov    0x4(%eax),%ebx
+  8021ec:	89 ce                	mov    %ecx,%esi
+  8021ee:	29 fe                	sub    %edi,%esi
+		if ((uintptr_t)va >= seg->seg_va &&
+  8021f0:	39 de                	cmp    %ebx,%esi
+  8021f2:	73 e6                	jae    8021da <segment_lookup+0x20>
+  8021f4:	eb 05                	jmp    8021fb <segment_lookup+0x41>
+			return seg;
+	return NULL;
+  8021f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021fb:	5b                   	pop    %ebx
+  8021fc:	5e                   	pop    %esi
+  8021fd:	5f                   	pop    %edi
+  8021fe:	5d                   	pop    %ebp
+  8021ff:	c3                   	ret
+	return NULL;
+  802200:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802205:	c3                   	ret
+
+00802206 <page_is_clean>:
+// shared -- and it gets read back in the next time we touch it.
+// Copy-on-write pages never count, since fork's remapping doesn't
+// tell us whether they were written to before it.
+static bool
+page_is_clean(void *va)
+{
+  802206:	55                   	push   %ebp
+  802207:	89 e5                	mov    %esp,%ebp
+  802209:	53                   	push   %ebx
+  80220a:	83 ec 04             	sub    $0x4,%esp
+  80220d:	89 c3                	mov    %eax,%ebx
+	int i;
+
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  80220f:	c1 e8 16             	shr    $0x16,%eax
+  802212:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802219:	25 81 00 00 00       	and    $0x81,%eax
+  80221e:	83 f8 01             	cmp    $0x1,%eax
+  802221:	75 6b                	jne    80228e <page_is_clean+0x88>
+  802223:	89 da                	mov    %ebx,%edx
+  802225:	c1 ea 0c             	shr    $0xc,%edx
+  802228:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+		return 0;
+  80222f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802234:	f6 c1 01             	test   $0x1,%cl
+  802237:	74 5a                	je     802293 <page_is_clean+0x8d>
+	    (uvpt[PGNUM(va)] & (PTE_D|PTE_SHARE|PTE_NO_PAGE|PTE_COW)))
+  802239:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P || !(uvpt[PGNUM(va)] & PTE_P) ||
+  802240:	f7 c2 40 0e 00 00    	test   $0xe40,%edx
+  802246:	75 4b                	jne    802293 <page_is_clean+0x8d>
+	if (segment_lookup(va))
+  802248:	89 d8                	mov    %ebx,%eax
+  80224a:	e8 6b ff ff ff       	call   8021ba <segment_lookup>
+  80224f:	89 c2                	mov    %eax,%edx
+		return 1;
+  802251:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (segment_lookup(va))
+  802256:	85 d2                	test   %edx,%edx
+  802258:	75 39                	jne    802293 <page_is_clean+0x8d>
+	for (i = 0; i < num_backed_ranges; i++)
+  80225a:	8b 15 0c b0 80 00    	mov    0x80b00c,%edx
+  802260:	b8 00 00 00 00       	mov    $0x0,%eax
+  802265:	eb 03                	jmp    80226a <page_is_clean+0x64>
+  802267:	83 c0 01             	add    $0x1,%eax
+  80226a:	39 c2                	cmp    %eax,%edx
+  80226c:	7e 19                	jle    802287 <page_is_clean+0x81>
+		if ((uintptr_t)va >= backed_ranges[i].start &&
+  80226e:	3b 1c c5 20 b0 80 00 	cmp    0x80b020(,%eax,8),%ebx
+  802275:	72 f0                	jb     802267 <page_is_clean+0x61>
+  802277:	3b 1c c5 24 b0 80 00 	cmp    0x80b024(,%eax,8),%ebx
+  80227e:	73 e7                	jae    802267 <page_is_clean+0x61>
+		    (uintptr_t)va < backed_ranges[i].end)
+			return 1;
+  802280:	b8 01 00 00 00       	mov    $0x1,%eax
+  802285:	eb 0c                	jmp    802293 <page_is_clean+0x8d>
+	return 0;
+  802287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228c:	eb 05                	jmp    802293 <page_is_clean+0x8d>
+		return 0;
+  80228e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802293:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802296:	c9                   	leave
+  802297:	c3                   	ret
+
+00802298 <linear_walk>:
+
+// The default linear walk page choice function, overridable by assigning page_choice
+void *
+linear_walk(envid_t env, void *pg_in)
+{
+  802298:	55                   	push   %ebp
+  802299:	89 e5                	mov    %esp,%ebp
+  80229b:	57                   	push   %edi
+  80229c:	56                   	push   %esi
+  80229d:	53                   	push   %ebx
+  80229e:	83 ec 1c             	sub    $0x1c,%esp
+	static uint32_t pgnum = 0;
+	uint32_t pgnum_offset, pgnum_actual;
+
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a6:	eb 19                	jmp    8022c1 <linear_walk+0x29>
+		// Calculate the actual pgnum
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+		// Check for the directory being present (and not a large page) and UTOP
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+		{
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8022a8:	f7 d3                	not    %ebx
+  8022aa:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8022b0:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8022b2:	83 c6 01             	add    $0x1,%esi
+  8022b5:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8022bb:	0f 87 97 00 00 00    	ja     802358 <linear_walk+0xc0>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8022c1:	89 f3                	mov    %esi,%ebx
+  8022c3:	03 1d 34 80 80 00    	add    0x808034,%ebx
+  8022c9:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8022cf:	89 d8                	mov    %ebx,%eax
+  8022d1:	c1 e8 0a             	shr    $0xa,%eax
+  8022d4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8022db:	25 81 00 00 00       	and    $0x81,%eax
+  8022e0:	83 f8 01             	cmp    $0x1,%eax
+  8022e3:	75 c3                	jne    8022a8 <linear_walk+0x10>
+  8022e5:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8022eb:	77 bb                	ja     8022a8 <linear_walk+0x10>
+			continue;
+		}
+		// Checks (other)
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8022ed:	89 df                	mov    %ebx,%edi
+  8022ef:	c1 e7 0c             	shl    $0xc,%edi
+  8022f2:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8022f5:	89 f8                	mov    %edi,%eax
+  8022f7:	e8 0a ff ff ff       	call   802206 <page_is_clean>
+  8022fc:	84 c0                	test   %al,%al
+  8022fe:	75 64                	jne    802364 <linear_walk+0xcc>
+			pgnum = pgnum_actual;
+			return (void*)(pgnum*PGSIZE);
+		}
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+			continue;
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802300:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802306:	77 aa                	ja     8022b2 <linear_walk+0x1a>
+  802308:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  80230e:	72 a2                	jb     8022b2 <linear_walk+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802310:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802317:	a8 01                	test   $0x1,%al
+  802319:	74 97                	je     8022b2 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80231b:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802322:	f6 c4 04             	test   $0x4,%ah
+  802325:	75 8b                	jne    8022b2 <linear_walk+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802327:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  80232e:	f6 c4 02             	test   $0x2,%ah
+  802331:	0f 85 7b ff ff ff    	jne    8022b2 <linear_walk+0x1a>
+			continue;
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802337:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80233e:	c1 e8 0c             	shr    $0xc,%eax
+  802341:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802344:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802349:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  80234d:	66 83 f8 01          	cmp    $0x1,%ax
+  802351:	76 11                	jbe    802364 <linear_walk+0xcc>
+  802353:	e9 5a ff ff ff       	jmp    8022b2 <linear_walk+0x1a>
+  802358:	bb 00 00 00 00       	mov    $0x0,%ebx
+	}
+
+	// There are no valid pages to page out -- return an address
+	// that's guaranteed to be invalid
+	pgnum = 0;
+	return (void*)UTOP;
+  80235d:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+			pgnum = pgnum_actual;
+  802364:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+}
+  80236a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80236d:	83 c4 1c             	add    $0x1c,%esp
+  802370:	5b                   	pop    %ebx
+  802371:	5e                   	pop    %esi
+  802372:	5f                   	pop    %edi
+  802373:	5d                   	pop    %ebp
+  802374:	c3                   	ret
+
+00802375 <page_ring_post>:
+
+// Post a request on the ring, and return its tag.  The caller has
+// made room for it.
+static uint32_t
+page_ring_post(uint32_t op, uint32_t slot, uint32_t data)
+{
+  802375:	55                   	push   %ebp
+  802376:	89 e5                	mov    %esp,%ebp
+  802378:	56                   	push   %esi
+  802379:	53                   	push   %ebx
+  80237a:	89 c3                	mov    %eax,%ebx
+	struct Pagering_sqe *sqe;
+
+	sqe = &ring->sq[ring->sq_tail % PAGERING_NENTRIES];
+  80237c:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802381:	83 e0 7f             	and    $0x7f,%eax
+  802384:	c1 e0 04             	shl    $0x4,%eax
+  802387:	8d b0 10 30 ad de    	lea    -0x2152cff0(%eax),%esi
+	sqe->op = op;
+  80238d:	89 98 10 30 ad de    	mov    %ebx,-0x2152cff0(%eax)
+	sqe->slot = slot;
+  802393:	89 90 14 30 ad de    	mov    %edx,-0x2152cfec(%eax)
+	sqe->data = data;
+  802399:	89 88 18 30 ad de    	mov    %ecx,-0x2152cfe8(%eax)
+	sqe->tag = ring->sq_tail;
+  80239f:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023a4:	89 46 0c             	mov    %eax,0xc(%esi)
+	ring->sq_tail++;
+  8023a7:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  8023ac:	83 c0 01             	add    $0x1,%eax
+  8023af:	a3 04 30 ad de       	mov    %eax,0xdead3004
+	return sqe->tag;
+  8023b4:	8b 46 0c             	mov    0xc(%esi),%eax
+}
+  8023b7:	5b                   	pop    %ebx
+  8023b8:	5e                   	pop    %esi
+  8023b9:	5d                   	pop    %ebp
+  8023ba:	c3                   	ret
+
+008023bb <page_ring_enter>:
+{
+  8023bb:	55                   	push   %ebp
+  8023bc:	89 e5                	mov    %esp,%ebp
+  8023be:	57                   	push   %edi
+  8023bf:	56                   	push   %esi
+  8023c0:	53                   	push   %ebx
+  8023c1:	83 ec 18             	sub    $0x18,%esp
+  8023c4:	89 c6                	mov    %eax,%esi
+  8023c6:	89 d7                	mov    %edx,%edi
+  8023c8:	89 cb                	mov    %ecx,%ebx
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_ENTER, NULL, 0, 0)) < 0)
+  8023ca:	6a 00                	push   $0x0
+  8023cc:	6a 00                	push   $0x0
+  8023ce:	6a 00                	push   $0x0
+  8023d0:	6a 07                	push   $0x7
+  8023d2:	ff 35 40 b0 80 00    	push   0x80b040
+  8023d8:	e8 8e 26 00 00       	call   804a6b <ipc_call>
+  8023dd:	83 c4 20             	add    $0x20,%esp
+  8023e0:	85 c0                	test   %eax,%eax
+  8023e2:	79 22                	jns    802406 <page_ring_enter+0x4b>
+		panic("page_ring_enter: %e", r);
+  8023e4:	50                   	push   %eax
+  8023e5:	68 01 53 80 00       	push   $0x805301
+  8023ea:	68 13 02 00 00       	push   $0x213
+  8023ef:	68 15 53 80 00       	push   $0x805315
+  8023f4:	e8 05 de ff ff       	call   8001fe <_panic>
+	for (; ring->cq_head != ring->cq_tail; ring->cq_head++) {
+  8023f9:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  8023fe:	83 c0 01             	add    $0x1,%eax
+  802401:	a3 08 30 ad de       	mov    %eax,0xdead3008
+  802406:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80240c:	a1 0c 30 ad de       	mov    0xdead300c,%eax
+  802411:	39 c2                	cmp    %eax,%edx
+  802413:	74 24                	je     802439 <page_ring_enter+0x7e>
+		cqe = &ring->cq[ring->cq_head % PAGERING_NENTRIES];
+  802415:	a1 08 30 ad de       	mov    0xdead3008,%eax
+  80241a:	83 e0 7f             	and    $0x7f,%eax
+  80241d:	8d 14 c5 10 38 ad de 	lea    -0x2152c7f0(,%eax,8),%edx
+		if (cqe->tag - first < n)
+  802424:	8b 04 c5 10 38 ad de 	mov    -0x2152c7f0(,%eax,8),%eax
+  80242b:	29 f0                	sub    %esi,%eax
+  80242d:	39 d8                	cmp    %ebx,%eax
+  80242f:	73 c8                	jae    8023f9 <page_ring_enter+0x3e>
+			res[cqe->tag - first] = cqe->res;
+  802431:	8b 52 04             	mov    0x4(%edx),%edx
+  802434:	89 14 87             	mov    %edx,(%edi,%eax,4)
+  802437:	eb c0                	jmp    8023f9 <page_ring_enter+0x3e>
+}
+  802439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80243c:	5b                   	pop    %ebx
+  80243d:	5e                   	pop    %esi
+  80243e:	5f                   	pop    %edi
+  80243f:	5d                   	pop    %ebp
+  802440:	c3                   	ret
+
+00802441 <page_ring_reserve>:
+{
+  802441:	89 c1                	mov    %eax,%ecx
+	if (ring->sq_tail - ring->cq_head > PAGERING_NENTRIES - n)
+  802443:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  802448:	8b 15 08 30 ad de    	mov    0xdead3008,%edx
+  80244e:	29 d0                	sub    %edx,%eax
+  802450:	ba 80 00 00 00       	mov    $0x80,%edx
+  802455:	29 ca                	sub    %ecx,%edx
+  802457:	39 c2                	cmp    %eax,%edx
+  802459:	72 01                	jb     80245c <page_ring_reserve+0x1b>
+  80245b:	c3                   	ret
+{
+  80245c:	55                   	push   %ebp
+  80245d:	89 e5                	mov    %esp,%ebp
+  80245f:	83 ec 08             	sub    $0x8,%esp
+		page_ring_enter(0, NULL, 0);
+  802462:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802467:	ba 00 00 00 00       	mov    $0x0,%edx
+  80246c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802471:	e8 45 ff ff ff       	call   8023bb <page_ring_enter>
+}
+  802476:	c9                   	leave
+  802477:	c3                   	ret
+
+00802478 <page_share_send>:
+// page out) in the middle of walking the mapping tables.
+static struct Pagereq_share sharereqs[NPAGESERV] __attribute__((aligned(PGSIZE)));
+
+static int
+page_share_send(int i)
+{
+  802478:	55                   	push   %ebp
+  802479:	89 e5                	mov    %esp,%ebp
+  80247b:	53                   	push   %ebx
+  80247c:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	r = ipc_call(pagingenvs[i], PAGEREQ_PAGE_SHARE, &sharereqs[i], 1, PTE_P|PTE_U|PTE_W);
+  80247f:	6a 07                	push   $0x7
+  802481:	6a 01                	push   $0x1
+  802483:	89 c3                	mov    %eax,%ebx
+  802485:	c1 e3 0c             	shl    $0xc,%ebx
+  802488:	8d 93 00 90 80 00    	lea    0x809000(%ebx),%edx
+  80248e:	52                   	push   %edx
+  80248f:	6a 04                	push   $0x4
+  802491:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  802498:	e8 ce 25 00 00       	call   804a6b <ipc_call>
+	sharereqs[i].nslots = 0;
+  80249d:	c7 83 00 90 80 00 00 	movl   $0x0,0x809000(%ebx)
+  8024a4:	00 00 00 
+	return r;
+}
+  8024a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024aa:	c9                   	leave
+  8024ab:	c3                   	ret
+
+008024ac <page_share_slot>:
+
+// Add slot to the request for its paging server, sending the request
+// when it's full
+static int
+page_share_slot(uint32_t slot)
+{
+  8024ac:	55                   	push   %ebp
+  8024ad:	89 e5                	mov    %esp,%ebp
+  8024af:	56                   	push   %esi
+  8024b0:	53                   	push   %ebx
+  8024b1:	89 c1                	mov    %eax,%ecx
+	struct Pagereq_share *req;
+
+	req = &sharereqs[PAGESERV_OF(slot) % NPAGESERV];
+  8024b3:	c1 e8 10             	shr    $0x10,%eax
+  8024b6:	83 e0 01             	and    $0x1,%eax
+	req->slots[req->nslots++] = slot;
+  8024b9:	89 c2                	mov    %eax,%edx
+  8024bb:	c1 e2 0c             	shl    $0xc,%edx
+  8024be:	8b b2 00 90 80 00    	mov    0x809000(%edx),%esi
+  8024c4:	8d 5e 01             	lea    0x1(%esi),%ebx
+  8024c7:	89 9a 00 90 80 00    	mov    %ebx,0x809000(%edx)
+  8024cd:	89 c2                	mov    %eax,%edx
+  8024cf:	c1 e2 0a             	shl    $0xa,%edx
+  8024d2:	01 f2                	add    %esi,%edx
+  8024d4:	89 0c 95 04 90 80 00 	mov    %ecx,0x809004(,%edx,4)
+	if (req->nslots == PAGEREQ_SHARE_NSLOTS)
+  8024db:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  8024e1:	74 09                	je     8024ec <page_share_slot+0x40>
+		return page_share_send(req - sharereqs);
+	return 0;
+  8024e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024e8:	5b                   	pop    %ebx
+  8024e9:	5e                   	pop    %esi
+  8024ea:	5d                   	pop    %ebp
+  8024eb:	c3                   	ret
+		return page_share_send(req - sharereqs);
+  8024ec:	e8 87 ff ff ff       	call   802478 <page_share_send>
+  8024f1:	eb f5                	jmp    8024e8 <page_share_slot+0x3c>
+
+008024f3 <page_ring_ready>:
+	if (ring_owner == thisenv->env_id)
+  8024f3:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8024f8:	8b 50 48             	mov    0x48(%eax),%edx
+		return 1;
+  8024fb:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (ring_owner == thisenv->env_id)
+  802500:	3b 15 00 b0 80 00    	cmp    0x80b000,%edx
+  802506:	74 09                	je     802511 <page_ring_ready+0x1e>
+	if (pagingenv == 0)
+  802508:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80250d:	85 c0                	test   %eax,%eax
+  80250f:	75 01                	jne    802512 <page_ring_ready+0x1f>
+}
+  802511:	c3                   	ret
+{
+  802512:	55                   	push   %ebp
+  802513:	89 e5                	mov    %esp,%ebp
+  802515:	83 ec 08             	sub    $0x8,%esp
+	if ((r = sys_page_alloc_range(0, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE|PTE_NO_PAGE)) != PAGERING_NPAGES) {
+  802518:	68 07 06 00 00       	push   $0x607
+  80251d:	6a 08                	push   $0x8
+  80251f:	68 00 30 ad de       	push   $0xdead3000
+  802524:	6a 00                	push   $0x0
+  802526:	e8 b3 e9 ff ff       	call   800ede <sys_page_alloc_range>
+  80252b:	83 c4 10             	add    $0x10,%esp
+  80252e:	83 f8 08             	cmp    $0x8,%eax
+  802531:	74 1b                	je     80254e <page_ring_ready+0x5b>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802533:	83 ec 04             	sub    $0x4,%esp
+  802536:	6a 08                	push   $0x8
+  802538:	68 00 30 ad de       	push   $0xdead3000
+  80253d:	6a 00                	push   $0x0
+  80253f:	e8 08 ea ff ff       	call   800f4c <sys_page_unmap_range>
+		return 0;
+  802544:	83 c4 10             	add    $0x10,%esp
+  802547:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80254c:	c9                   	leave
+  80254d:	c3                   	ret
+	if ((r = ipc_call(pagingenv, PAGEREQ_RING_SETUP, ring, PAGERING_NPAGES, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0) {
+  80254e:	83 ec 0c             	sub    $0xc,%esp
+  802551:	68 07 04 00 00       	push   $0x407
+  802556:	6a 08                	push   $0x8
+  802558:	68 00 30 ad de       	push   $0xdead3000
+  80255d:	6a 06                	push   $0x6
+  80255f:	ff 35 40 b0 80 00    	push   0x80b040
+  802565:	e8 01 25 00 00       	call   804a6b <ipc_call>
+  80256a:	83 c4 20             	add    $0x20,%esp
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	78 14                	js     802585 <page_ring_ready+0x92>
+	ring_owner = thisenv->env_id;
+  802571:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  802576:	8b 40 48             	mov    0x48(%eax),%eax
+  802579:	a3 00 b0 80 00       	mov    %eax,0x80b000
+	return 1;
+  80257e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802583:	eb c7                	jmp    80254c <page_ring_ready+0x59>
+		sys_page_unmap_range(0, ring, PAGERING_NPAGES);
+  802585:	83 ec 04             	sub    $0x4,%esp
+  802588:	6a 08                	push   $0x8
+  80258a:	68 00 30 ad de       	push   $0xdead3000
+  80258f:	6a 00                	push   $0x0
+  802591:	e8 b6 e9 ff ff       	call   800f4c <sys_page_unmap_range>
+		return 0;
+  802596:	83 c4 10             	add    $0x10,%esp
+  802599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259e:	eb ac                	jmp    80254c <page_ring_ready+0x59>
+
+008025a0 <page_remove_slot>:
+{
+  8025a0:	55                   	push   %ebp
+  8025a1:	89 e5                	mov    %esp,%ebp
+  8025a3:	56                   	push   %esi
+  8025a4:	53                   	push   %ebx
+  8025a5:	89 c3                	mov    %eax,%ebx
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  8025a7:	89 c6                	mov    %eax,%esi
+  8025a9:	c1 ee 10             	shr    $0x10,%esi
+  8025ac:	83 e6 01             	and    $0x1,%esi
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025af:	8b 04 b5 44 b0 80 00 	mov    0x80b044(,%esi,4),%eax
+  8025b6:	39 05 40 b0 80 00    	cmp    %eax,0x80b040
+  8025bc:	74 2a                	je     8025e8 <page_remove_slot+0x48>
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025be:	83 ec 0c             	sub    $0xc,%esp
+  8025c1:	6a 00                	push   $0x0
+  8025c3:	6a 00                	push   $0x0
+  8025c5:	6a 00                	push   $0x0
+	int ipc_val = (map_index << PAGEREQ_SHIFT) | PAGEREQ_PAGE_REMOVE;
+  8025c7:	c1 e3 04             	shl    $0x4,%ebx
+  8025ca:	83 cb 02             	or     $0x2,%ebx
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, NULL, 0, 0)) < 0)
+  8025cd:	53                   	push   %ebx
+  8025ce:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8025d5:	e8 91 24 00 00       	call   804a6b <ipc_call>
+  8025da:	83 c4 20             	add    $0x20,%esp
+  8025dd:	85 c0                	test   %eax,%eax
+  8025df:	78 2d                	js     80260e <page_remove_slot+0x6e>
+}
+  8025e1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025e4:	5b                   	pop    %ebx
+  8025e5:	5e                   	pop    %esi
+  8025e6:	5d                   	pop    %ebp
+  8025e7:	c3                   	ret
+	if (slot_paging_env(map_index) == pagingenv && page_ring_ready()) {
+  8025e8:	e8 06 ff ff ff       	call   8024f3 <page_ring_ready>
+  8025ed:	85 c0                	test   %eax,%eax
+  8025ef:	74 cd                	je     8025be <page_remove_slot+0x1e>
+		page_ring_reserve(1);
+  8025f1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025f6:	e8 46 fe ff ff       	call   802441 <page_ring_reserve>
+		page_ring_post(PAGEREQ_PAGE_REMOVE, map_index, 0);
+  8025fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802600:	89 da                	mov    %ebx,%edx
+  802602:	b8 02 00 00 00       	mov    $0x2,%eax
+  802607:	e8 69 fd ff ff       	call   802375 <page_ring_post>
+		return;
+  80260c:	eb d3                	jmp    8025e1 <page_remove_slot+0x41>
+		panic("page_unmap: failed to recv from paging server -- %e\n", r);
+  80260e:	50                   	push   %eax
+  80260f:	68 70 53 80 00       	push   $0x805370
+  802614:	68 ac 03 00 00       	push   $0x3ac
+  802619:	68 15 53 80 00       	push   $0x805315
+  80261e:	e8 db db ff ff       	call   8001fe <_panic>
+
+00802623 <find_paging_env>:
+	if(pagingenv)
+  802623:	a1 40 b0 80 00       	mov    0x80b040,%eax
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802628:	89 c1                	mov    %eax,%ecx
+	if(pagingenv)
+  80262a:	85 c0                	test   %eax,%eax
+  80262c:	74 05                	je     802633 <find_paging_env+0x10>
+  80262e:	eb 56                	jmp    802686 <find_paging_env+0x63>
+	for (i = n = 0; i < NENV && n < NPAGESERV; i++)
+  802630:	83 c0 01             	add    $0x1,%eax
+  802633:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802638:	7f 47                	jg     802681 <find_paging_env+0x5e>
+  80263a:	83 f9 01             	cmp    $0x1,%ecx
+  80263d:	7f 42                	jg     802681 <find_paging_env+0x5e>
+		if (envs[i].env_type == ENV_TYPE_PAGE && envs[i].env_status != ENV_FREE)
+  80263f:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802642:	c1 e2 06             	shl    $0x6,%edx
+  802645:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80264b:	8b 52 50             	mov    0x50(%edx),%edx
+  80264e:	83 fa 02             	cmp    $0x2,%edx
+  802651:	75 dd                	jne    802630 <find_paging_env+0xd>
+  802653:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802656:	c1 e2 06             	shl    $0x6,%edx
+  802659:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80265f:	8b 52 54             	mov    0x54(%edx),%edx
+  802662:	85 d2                	test   %edx,%edx
+  802664:	74 ca                	je     802630 <find_paging_env+0xd>
+			pagingenvs[n++] = envs[i].env_id;
+  802666:	8d 14 80             	lea    (%eax,%eax,4),%edx
+  802669:	c1 e2 06             	shl    $0x6,%edx
+  80266c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802672:	8b 52 48             	mov    0x48(%edx),%edx
+  802675:	89 14 8d 44 b0 80 00 	mov    %edx,0x80b044(,%ecx,4)
+  80267c:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80267f:	eb af                	jmp    802630 <find_paging_env+0xd>
+	if (n == NPAGESERV)
+  802681:	83 f9 02             	cmp    $0x2,%ecx
+  802684:	74 01                	je     802687 <find_paging_env+0x64>
+}
+  802686:	c3                   	ret
+		pagingenv = pagingenvs[ENVX(thisenv->env_id) % NPAGESERV];
+  802687:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80268c:	8b 40 48             	mov    0x48(%eax),%eax
+  80268f:	83 e0 01             	and    $0x1,%eax
+  802692:	8b 04 85 44 b0 80 00 	mov    0x80b044(,%eax,4),%eax
+  802699:	a3 40 b0 80 00       	mov    %eax,0x80b040
+  80269e:	eb e6                	jmp    802686 <find_paging_env+0x63>
+
+008026a0 <page_add_backed>:
+{
+  8026a0:	55                   	push   %ebp
+  8026a1:	89 e5                	mov    %esp,%ebp
+  8026a3:	8b 55 08             	mov    0x8(%ebp),%edx
+	if (num_backed_ranges == MAX_BACKED_RANGES)
+  8026a6:	a1 0c b0 80 00       	mov    0x80b00c,%eax
+  8026ab:	83 f8 04             	cmp    $0x4,%eax
+  8026ae:	74 35                	je     8026e5 <page_add_backed+0x45>
+	backed_ranges[num_backed_ranges].start = ROUNDDOWN((uintptr_t)va, PGSIZE);
+  8026b0:	89 d1                	mov    %edx,%ecx
+  8026b2:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  8026b8:	89 0c c5 20 b0 80 00 	mov    %ecx,0x80b020(,%eax,8)
+	backed_ranges[num_backed_ranges].end = ROUNDUP((uintptr_t)va + len, PGSIZE);
+  8026bf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026c2:	8d 94 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%edx
+  8026c9:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8026cf:	89 14 c5 24 b0 80 00 	mov    %edx,0x80b024(,%eax,8)
+	num_backed_ranges++;
+  8026d6:	83 c0 01             	add    $0x1,%eax
+  8026d9:	a3 0c b0 80 00       	mov    %eax,0x80b00c
+	return 0;
+  8026de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026e3:	5d                   	pop    %ebp
+  8026e4:	c3                   	ret
+		return -E_NO_MEM;
+  8026e5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8026ea:	eb f7                	jmp    8026e3 <page_add_backed+0x43>
+
+008026ec <percentage_of_pgdir_to_walk>:
+{
+  8026ec:	55                   	push   %ebp
+  8026ed:	89 e5                	mov    %esp,%ebp
+  8026ef:	83 ec 04             	sub    $0x4,%esp
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  8026f2:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+  8026f6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  8026f9:	db 45 fc             	fildl  -0x4(%ebp)
+  8026fc:	d8 35 fc 57 80 00    	fdivs  0x8057fc
+	return ret*ret;
+  802702:	d8 c8                	fmul   %st(0),%st
+}
+  802704:	c9                   	leave
+  802705:	c3                   	ret
+
+00802706 <nfu_with_aging_page_choice_func>:
+{
+  802706:	55                   	push   %ebp
+  802707:	89 e5                	mov    %esp,%ebp
+  802709:	57                   	push   %edi
+  80270a:	56                   	push   %esi
+  80270b:	53                   	push   %ebx
+  80270c:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80270f:	8b 35 30 80 80 00    	mov    0x808030,%esi
+	float pct_to_walk = 1.0f;
+  802715:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802717:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  80271c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802721:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802728:	ba 00 00 00 00       	mov    $0x0,%edx
+  80272d:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802730:	eb 18                	jmp    80274a <nfu_with_aging_page_choice_func+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802732:	f7 d0                	not    %eax
+  802734:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802739:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  80273b:	83 c2 01             	add    $0x1,%edx
+  80273e:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802744:	0f 87 13 01 00 00    	ja     80285d <nfu_with_aging_page_choice_func+0x157>
+		++num_searched_ptes;
+  80274a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  80274e:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802751:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802756:	89 c1                	mov    %eax,%ecx
+  802758:	c1 e9 0a             	shr    $0xa,%ecx
+  80275b:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802762:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802768:	83 f9 01             	cmp    $0x1,%ecx
+  80276b:	75 c5                	jne    802732 <nfu_with_aging_page_choice_func+0x2c>
+  80276d:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802772:	77 be                	ja     802732 <nfu_with_aging_page_choice_func+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802774:	89 c1                	mov    %eax,%ecx
+  802776:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802779:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  80277f:	0f 82 a5 00 00 00    	jb     80282a <nfu_with_aging_page_choice_func+0x124>
+  802785:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  80278b:	0f 87 99 00 00 00    	ja     80282a <nfu_with_aging_page_choice_func+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802791:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802798:	f6 c1 01             	test   $0x1,%cl
+  80279b:	0f 84 89 00 00 00    	je     80282a <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027a1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  8027a8:	f6 c5 04             	test   $0x4,%ch
+  8027ab:	75 7d                	jne    80282a <nfu_with_aging_page_choice_func+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  8027ad:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  8027b4:	f6 c5 02             	test   $0x2,%ch
+  8027b7:	75 71                	jne    80282a <nfu_with_aging_page_choice_func+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  8027b9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027c0:	c1 e9 0c             	shr    $0xc,%ecx
+  8027c3:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027c6:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8027cc:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  8027d0:	66 83 f9 01          	cmp    $0x1,%cx
+  8027d4:	77 54                	ja     80282a <nfu_with_aging_page_choice_func+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].age < age_opt) {
+  8027d6:	89 f9                	mov    %edi,%ecx
+  8027d8:	80 f9 ff             	cmp    $0xff,%cl
+  8027db:	74 21                	je     8027fe <nfu_with_aging_page_choice_func+0xf8>
+  8027dd:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8027e4:	c1 e9 0c             	shr    $0xc,%ecx
+  8027e7:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  8027ea:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  8027f0:	0f b6 49 0e          	movzbl 0xe(%ecx),%ecx
+  8027f4:	89 fb                	mov    %edi,%ebx
+  8027f6:	38 d9                	cmp    %bl,%cl
+  8027f8:	73 30                	jae    80282a <nfu_with_aging_page_choice_func+0x124>
+  8027fa:	dd d8                	fstp   %st(0)
+  8027fc:	eb 02                	jmp    802800 <nfu_with_aging_page_choice_func+0xfa>
+  8027fe:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].age;
+  802800:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802807:	c1 e9 0c             	shr    $0xc,%ecx
+  80280a:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  80280d:	0f b6 b9 0e 00 00 ef 	movzbl -0x10fffff2(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802814:	89 fb                	mov    %edi,%ebx
+  802816:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802819:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80281c:	db 45 e0             	fildl  -0x20(%ebp)
+  80281f:	d8 35 fc 57 80 00    	fdivs  0x8057fc
+	return ret*ret;
+  802825:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802827:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  80282a:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  80282d:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802830:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802837:	df 6d e0             	fildll -0x20(%ebp)
+  80283a:	d9 c1                	fld    %st(1)
+  80283c:	d8 0d 00 58 80 00    	fmuls  0x805800
+  802842:	d9 c9                	fxch   %st(1)
+  802844:	df f1                	fcomip %st(1),%st
+  802846:	dd d8                	fstp   %st(0)
+  802848:	0f 82 ed fe ff ff    	jb     80273b <nfu_with_aging_page_choice_func+0x35>
+  80284e:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802850:	a3 30 80 80 00       	mov    %eax,0x808030
+			return (void*)(pgnum_opt*PGSIZE);
+  802855:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802858:	c1 e0 0c             	shl    $0xc,%eax
+  80285b:	eb 0e                	jmp    80286b <nfu_with_aging_page_choice_func+0x165>
+  80285d:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  80285f:	89 f8                	mov    %edi,%eax
+  802861:	3c ff                	cmp    $0xff,%al
+  802863:	74 0e                	je     802873 <nfu_with_aging_page_choice_func+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802865:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802868:	c1 e0 0c             	shl    $0xc,%eax
+}
+  80286b:	83 c4 14             	add    $0x14,%esp
+  80286e:	5b                   	pop    %ebx
+  80286f:	5e                   	pop    %esi
+  802870:	5f                   	pop    %edi
+  802871:	5d                   	pop    %ebp
+  802872:	c3                   	ret
+	pgnum = 0;
+  802873:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  80287a:	00 00 00 
+	return (void*)UTOP;
+  80287d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802882:	eb e7                	jmp    80286b <nfu_with_aging_page_choice_func+0x165>
+
+00802884 <myRand>:
+    state = state * 1664525 + 1013904223;
+  802884:	69 05 40 60 80 00 0d 	imul   $0x19660d,0x806040,%eax
+  80288b:	66 19 00 
+  80288e:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+  802893:	a3 40 60 80 00       	mov    %eax,0x806040
+    return state >> 24;
+  802898:	c1 e8 18             	shr    $0x18,%eax
+}
+  80289b:	c3                   	ret
+
+0080289c <random_page_choice_func>:
+{
+  80289c:	55                   	push   %ebp
+  80289d:	89 e5                	mov    %esp,%ebp
+  80289f:	57                   	push   %edi
+  8028a0:	56                   	push   %esi
+  8028a1:	53                   	push   %ebx
+  8028a2:	83 ec 1c             	sub    $0x1c,%esp
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028aa:	eb 19                	jmp    8028c5 <random_page_choice_func+0x29>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  8028ac:	f7 d3                	not    %ebx
+  8028ae:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8028b4:	01 de                	add    %ebx,%esi
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  8028b6:	83 c6 01             	add    $0x1,%esi
+  8028b9:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+  8028bf:	0f 87 a0 00 00 00    	ja     802965 <random_page_choice_func+0xc9>
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  8028c5:	89 f3                	mov    %esi,%ebx
+  8028c7:	03 1d 2c 80 80 00    	add    0x80802c,%ebx
+  8028cd:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  8028d3:	89 d8                	mov    %ebx,%eax
+  8028d5:	c1 e8 0a             	shr    $0xa,%eax
+  8028d8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8028df:	25 81 00 00 00       	and    $0x81,%eax
+  8028e4:	83 f8 01             	cmp    $0x1,%eax
+  8028e7:	75 c3                	jne    8028ac <random_page_choice_func+0x10>
+  8028e9:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  8028ef:	77 bb                	ja     8028ac <random_page_choice_func+0x10>
+		if (page_is_clean((void*)(pgnum_actual*PGSIZE))) {
+  8028f1:	89 df                	mov    %ebx,%edi
+  8028f3:	c1 e7 0c             	shl    $0xc,%edi
+  8028f6:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8028f9:	89 f8                	mov    %edi,%eax
+  8028fb:	e8 06 f9 ff ff       	call   802206 <page_is_clean>
+  802900:	84 c0                	test   %al,%al
+  802902:	0f 85 82 00 00 00    	jne    80298a <random_page_choice_func+0xee>
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802908:	81 ff 2c 00 81 00    	cmp    $0x81002c,%edi
+  80290e:	72 a6                	jb     8028b6 <random_page_choice_func+0x1a>
+  802910:	81 ff ff cf bf ee    	cmp    $0xeebfcfff,%edi
+  802916:	77 9e                	ja     8028b6 <random_page_choice_func+0x1a>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802918:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  80291f:	a8 01                	test   $0x1,%al
+  802921:	74 93                	je     8028b6 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802923:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  80292a:	f6 c4 04             	test   $0x4,%ah
+  80292d:	75 87                	jne    8028b6 <random_page_choice_func+0x1a>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  80292f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802936:	f6 c4 02             	test   $0x2,%ah
+  802939:	0f 85 77 ff ff ff    	jne    8028b6 <random_page_choice_func+0x1a>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  80293f:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802946:	c1 e8 0c             	shr    $0xc,%eax
+  802949:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80294c:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802951:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802955:	66 83 f8 01          	cmp    $0x1,%ax
+  802959:	0f 87 57 ff ff ff    	ja     8028b6 <random_page_choice_func+0x1a>
+		pgnum = pgnum_actual;
+  80295f:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+	random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802965:	e8 1a ff ff ff       	call   802884 <myRand>
+  80296a:	8b 3d 2c 80 80 00    	mov    0x80802c,%edi
+  802970:	be fd eb 0e 00       	mov    $0xeebfd,%esi
+  802975:	29 fe                	sub    %edi,%esi
+  802977:	0f be c0             	movsbl %al,%eax
+  80297a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297f:	f7 f6                	div    %esi
+  802981:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  802983:	bb 15 00 00 00       	mov    $0x15,%ebx
+  802988:	eb 1c                	jmp    8029a6 <random_page_choice_func+0x10a>
+			pgnum = pgnum_actual;
+  80298a:	89 1d 2c 80 80 00    	mov    %ebx,0x80802c
+			return (void*)(pgnum*PGSIZE);
+  802990:	e9 8f 00 00 00       	jmp    802a24 <random_page_choice_func+0x188>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802995:	e8 ea fe ff ff       	call   802884 <myRand>
+  80299a:	0f be c0             	movsbl %al,%eax
+  80299d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a2:	f7 f6                	div    %esi
+  8029a4:	01 fa                	add    %edi,%edx
+	while(counter < 20)
+  8029a6:	83 eb 01             	sub    $0x1,%ebx
+  8029a9:	0f 84 c2 00 00 00    	je     802a71 <random_page_choice_func+0x1d5>
+		if ((uvpd[random_pgnum/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || random_pgnum >= PGNUM(UTOP))
+  8029af:	89 d0                	mov    %edx,%eax
+  8029b1:	c1 e8 0a             	shr    $0xa,%eax
+  8029b4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8029bb:	25 81 00 00 00       	and    $0x81,%eax
+  8029c0:	83 f8 01             	cmp    $0x1,%eax
+  8029c3:	75 d0                	jne    802995 <random_page_choice_func+0xf9>
+  8029c5:	81 fa ff eb 0e 00    	cmp    $0xeebff,%edx
+  8029cb:	77 c8                	ja     802995 <random_page_choice_func+0xf9>
+		if (random_pgnum*PGSIZE < (uintptr_t)end){
+  8029cd:	89 d0                	mov    %edx,%eax
+  8029cf:	c1 e0 0c             	shl    $0xc,%eax
+  8029d2:	3d 2c 00 81 00       	cmp    $0x81002c,%eax
+  8029d7:	72 56                	jb     802a2f <random_page_choice_func+0x193>
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029d9:	3d ff cf bf ee       	cmp    $0xeebfcfff,%eax
+  8029de:	77 65                	ja     802a45 <random_page_choice_func+0x1a9>
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8029e0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		if (!(random_pgnum*PGSIZE < USTACKTOP - PGSIZE) ||
+  8029e7:	f6 c1 01             	test   $0x1,%cl
+  8029ea:	74 59                	je     802a45 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8029ec:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    !(uvpt[random_pgnum] & PTE_P) ||
+  8029f3:	f6 c5 04             	test   $0x4,%ch
+  8029f6:	75 4d                	jne    802a45 <random_page_choice_func+0x1a9>
+		    (uvpt[random_pgnum] & PTE_NO_PAGE)){
+  8029f8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+		    (uvpt[random_pgnum] & PTE_SHARE) ||
+  8029ff:	f6 c5 02             	test   $0x2,%ch
+  802a02:	75 41                	jne    802a45 <random_page_choice_func+0x1a9>
+		if (pages[PGNUM(uvpt[random_pgnum])].pp_ref >= 2){
+  802a04:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802a0b:	c1 ea 0c             	shr    $0xc,%edx
+  802a0e:	6b d2 1c             	imul   $0x1c,%edx,%edx
+  802a11:	81 c2 00 00 00 ef    	add    $0xef000000,%edx
+  802a17:	0f b7 52 0a          	movzwl 0xa(%edx),%edx
+  802a1b:	66 83 fa 01          	cmp    $0x1,%dx
+  802a1f:	77 3a                	ja     802a5b <random_page_choice_func+0x1bf>
+		return (void*)(random_pgnum*PGSIZE);
+  802a21:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+}
+  802a24:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a27:	83 c4 1c             	add    $0x1c,%esp
+  802a2a:	5b                   	pop    %ebx
+  802a2b:	5e                   	pop    %esi
+  802a2c:	5f                   	pop    %edi
+  802a2d:	5d                   	pop    %ebp
+  802a2e:	c3                   	ret
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum;
+  802a2f:	e8 50 fe ff ff       	call   802884 <myRand>
+  802a34:	0f be c0             	movsbl %al,%eax
+  802a37:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a3c:	f7 f6                	div    %esi
+  802a3e:	01 fa                	add    %edi,%edx
+			continue;
+  802a40:	e9 61 ff ff ff       	jmp    8029a6 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a45:	e8 3a fe ff ff       	call   802884 <myRand>
+  802a4a:	0f be c0             	movsbl %al,%eax
+  802a4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a52:	f7 f6                	div    %esi
+  802a54:	01 fa                	add    %edi,%edx
+			continue;
+  802a56:	e9 4b ff ff ff       	jmp    8029a6 <random_page_choice_func+0x10a>
+			random_pgnum = (myRand() % ((USTACKTOP-PGSIZE)/PGSIZE - pgnum)) + pgnum	;		
+  802a5b:	e8 24 fe ff ff       	call   802884 <myRand>
+  802a60:	0f be c0             	movsbl %al,%eax
+  802a63:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a68:	f7 f6                	div    %esi
+  802a6a:	01 fa                	add    %edi,%edx
+			continue;
+  802a6c:	e9 35 ff ff ff       	jmp    8029a6 <random_page_choice_func+0x10a>
+	pgnum = 0;
+  802a71:	c7 05 2c 80 80 00 00 	movl   $0x0,0x80802c
+  802a78:	00 00 00 
+	return (void*)UTOP;
+  802a7b:	c7 45 e4 00 00 c0 ee 	movl   $0xeec00000,-0x1c(%ebp)
+  802a82:	eb a0                	jmp    802a24 <random_page_choice_func+0x188>
+
+00802a84 <nfu>:
+{
+  802a84:	55                   	push   %ebp
+  802a85:	89 e5                	mov    %esp,%ebp
+  802a87:	57                   	push   %edi
+  802a88:	56                   	push   %esi
+  802a89:	53                   	push   %ebx
+  802a8a:	83 ec 14             	sub    $0x14,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802a8d:	8b 35 28 80 80 00    	mov    0x808028,%esi
+	float pct_to_walk = 1.0f;
+  802a93:	d9 e8                	fld1
+	uint8_t age_opt = MAX_PAGE_AGE + 1;
+  802a95:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802a9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a9f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802aa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aab:	89 5d ec             	mov    %ebx,-0x14(%ebp)
+  802aae:	eb 18                	jmp    802ac8 <nfu+0x44>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802ab0:	f7 d0                	not    %eax
+  802ab2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ab7:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802ab9:	83 c2 01             	add    $0x1,%edx
+  802abc:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802ac2:	0f 87 13 01 00 00    	ja     802bdb <nfu+0x157>
+		++num_searched_ptes;
+  802ac8:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802acc:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  802acf:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802ad4:	89 c1                	mov    %eax,%ecx
+  802ad6:	c1 e9 0a             	shr    $0xa,%ecx
+  802ad9:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802ae0:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802ae6:	83 f9 01             	cmp    $0x1,%ecx
+  802ae9:	75 c5                	jne    802ab0 <nfu+0x2c>
+  802aeb:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802af0:	77 be                	ja     802ab0 <nfu+0x2c>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802af2:	89 c1                	mov    %eax,%ecx
+  802af4:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802af7:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802afd:	0f 82 a5 00 00 00    	jb     802ba8 <nfu+0x124>
+  802b03:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802b09:	0f 87 99 00 00 00    	ja     802ba8 <nfu+0x124>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b0f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802b16:	f6 c1 01             	test   $0x1,%cl
+  802b19:	0f 84 89 00 00 00    	je     802ba8 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b1f:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802b26:	f6 c5 04             	test   $0x4,%ch
+  802b29:	75 7d                	jne    802ba8 <nfu+0x124>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802b2b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802b32:	f6 c5 02             	test   $0x2,%ch
+  802b35:	75 71                	jne    802ba8 <nfu+0x124>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802b37:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b3e:	c1 e9 0c             	shr    $0xc,%ecx
+  802b41:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b44:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b4a:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802b4e:	66 83 f9 01          	cmp    $0x1,%cx
+  802b52:	77 54                	ja     802ba8 <nfu+0x124>
+		if (age_opt > MAX_PAGE_AGE || pages[PGNUM(uvpt[pgnum_actual])].nfu_age < age_opt) {
+  802b54:	89 f9                	mov    %edi,%ecx
+  802b56:	80 f9 ff             	cmp    $0xff,%cl
+  802b59:	74 21                	je     802b7c <nfu+0xf8>
+  802b5b:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b62:	c1 e9 0c             	shr    $0xc,%ecx
+  802b65:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b68:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802b6e:	0f b6 49 0f          	movzbl 0xf(%ecx),%ecx
+  802b72:	89 fb                	mov    %edi,%ebx
+  802b74:	38 d9                	cmp    %bl,%cl
+  802b76:	73 30                	jae    802ba8 <nfu+0x124>
+  802b78:	dd d8                	fstp   %st(0)
+  802b7a:	eb 02                	jmp    802b7e <nfu+0xfa>
+  802b7c:	dd d8                	fstp   %st(0)
+			age_opt = pages[PGNUM(uvpt[pgnum_actual])].nfu_age;
+  802b7e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802b85:	c1 e9 0c             	shr    $0xc,%ecx
+  802b88:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802b8b:	0f b6 b9 0f 00 00 ef 	movzbl -0x10fffff1(%ecx),%edi
+			pct_to_walk = percentage_of_pgdir_to_walk(age_opt);
+  802b92:	89 fb                	mov    %edi,%ebx
+  802b94:	0f b6 cb             	movzbl %bl,%ecx
+	ret = age / ((float)(MAX_PAGE_AGE+1));
+  802b97:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802b9a:	db 45 e0             	fildl  -0x20(%ebp)
+  802b9d:	d8 35 fc 57 80 00    	fdivs  0x8057fc
+	return ret*ret;
+  802ba3:	d8 c8                	fmul   %st(0),%st
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802ba5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802ba8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+  802bab:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  802bae:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802bb5:	df 6d e0             	fildll -0x20(%ebp)
+  802bb8:	d9 c1                	fld    %st(1)
+  802bba:	d8 0d 00 58 80 00    	fmuls  0x805800
+  802bc0:	d9 c9                	fxch   %st(1)
+  802bc2:	df f1                	fcomip %st(1),%st
+  802bc4:	dd d8                	fstp   %st(0)
+  802bc6:	0f 82 ed fe ff ff    	jb     802ab9 <nfu+0x35>
+  802bcc:	dd d8                	fstp   %st(0)
+			pgnum = pgnum_actual;
+  802bce:	a3 28 80 80 00       	mov    %eax,0x808028
+			return (void*)(pgnum_opt*PGSIZE);
+  802bd3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802bd6:	c1 e0 0c             	shl    $0xc,%eax
+  802bd9:	eb 0e                	jmp    802be9 <nfu+0x165>
+  802bdb:	dd d8                	fstp   %st(0)
+	if (age_opt <= MAX_PAGE_AGE) {
+  802bdd:	89 f8                	mov    %edi,%eax
+  802bdf:	3c ff                	cmp    $0xff,%al
+  802be1:	74 0e                	je     802bf1 <nfu+0x16d>
+		return (void*)(pgnum_opt*PGSIZE);
+  802be3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802be6:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802be9:	83 c4 14             	add    $0x14,%esp
+  802bec:	5b                   	pop    %ebx
+  802bed:	5e                   	pop    %esi
+  802bee:	5f                   	pop    %edi
+  802bef:	5d                   	pop    %ebp
+  802bf0:	c3                   	ret
+	pgnum = 0;
+  802bf1:	c7 05 28 80 80 00 00 	movl   $0x0,0x808028
+  802bf8:	00 00 00 
+	return (void*)UTOP;
+  802bfb:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c00:	eb e7                	jmp    802be9 <nfu+0x165>
+
+00802c02 <lru>:
+{
+  802c02:	55                   	push   %ebp
+  802c03:	89 e5                	mov    %esp,%ebp
+  802c05:	57                   	push   %edi
+  802c06:	56                   	push   %esi
+  802c07:	53                   	push   %ebx
+  802c08:	83 ec 1c             	sub    $0x1c,%esp
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c0b:	8b 3d 24 80 80 00    	mov    0x808024,%edi
+	long long time_min = 9223372036854775807;
+  802c11:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%ebp)
+  802c18:	c7 45 dc ff ff ff 7f 	movl   $0x7fffffff,-0x24(%ebp)
+	uint32_t pgnum_offset, pgnum_actual, pgnum_opt = 0, num_searched_ptes = 0;
+  802c1f:	be 00 00 00 00       	mov    $0x0,%esi
+  802c24:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c30:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  802c33:	eb 18                	jmp    802c4d <lru+0x4b>
+			pgnum_offset += (NPTENTRIES - pgnum_actual%NPTENTRIES) - 1;
+  802c35:	f7 d0                	not    %eax
+  802c37:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802c3c:	01 c2                	add    %eax,%edx
+	for (pgnum_offset = 0; pgnum_offset < NPDENTRIES*NPTENTRIES; pgnum_offset++)
+  802c3e:	83 c2 01             	add    $0x1,%edx
+  802c41:	81 fa ff ff 0f 00    	cmp    $0xfffff,%edx
+  802c47:	0f 87 fa 00 00 00    	ja     802d47 <lru+0x145>
+		++num_searched_ptes;
+  802c4d:	83 c6 01             	add    $0x1,%esi
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802c50:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802c53:	01 d0                	add    %edx,%eax
+  802c55:	25 ff ff 0f 00       	and    $0xfffff,%eax
+		if ((uvpd[pgnum_actual/NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P || pgnum_actual >= PGNUM(UTOP))
+  802c5a:	89 c1                	mov    %eax,%ecx
+  802c5c:	c1 e9 0a             	shr    $0xa,%ecx
+  802c5f:	8b 0c 8d 00 d0 7b ef 	mov    -0x10843000(,%ecx,4),%ecx
+  802c66:	81 e1 81 00 00 00    	and    $0x81,%ecx
+  802c6c:	83 f9 01             	cmp    $0x1,%ecx
+  802c6f:	75 c4                	jne    802c35 <lru+0x33>
+  802c71:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+  802c76:	77 bd                	ja     802c35 <lru+0x33>
+		if (pgnum_actual*PGSIZE < (uintptr_t)end)
+  802c78:	89 c1                	mov    %eax,%ecx
+  802c7a:	c1 e1 0c             	shl    $0xc,%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c7d:	81 f9 ff cf bf ee    	cmp    $0xeebfcfff,%ecx
+  802c83:	0f 87 92 00 00 00    	ja     802d1b <lru+0x119>
+  802c89:	81 f9 2c 00 81 00    	cmp    $0x81002c,%ecx
+  802c8f:	0f 82 86 00 00 00    	jb     802d1b <lru+0x119>
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802c95:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		if (!(pgnum_actual*PGSIZE < USTACKTOP - PGSIZE) ||
+  802c9c:	f6 c1 01             	test   $0x1,%cl
+  802c9f:	74 7a                	je     802d1b <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802ca1:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    !(uvpt[pgnum_actual] & PTE_P) ||
+  802ca8:	f6 c5 04             	test   $0x4,%ch
+  802cab:	75 6e                	jne    802d1b <lru+0x119>
+		    (uvpt[pgnum_actual] & PTE_NO_PAGE))
+  802cad:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+		    (uvpt[pgnum_actual] & PTE_SHARE) ||
+  802cb4:	f6 c5 02             	test   $0x2,%ch
+  802cb7:	75 62                	jne    802d1b <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].pp_ref >= 2)
+  802cb9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cc0:	c1 e9 0c             	shr    $0xc,%ecx
+  802cc3:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802cc6:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ccc:	0f b7 49 0a          	movzwl 0xa(%ecx),%ecx
+  802cd0:	66 83 f9 01          	cmp    $0x1,%cx
+  802cd4:	77 45                	ja     802d1b <lru+0x119>
+		if (pages[PGNUM(uvpt[pgnum_actual])].timestamp <= time_min) {
+  802cd6:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802cdd:	c1 e9 0c             	shr    $0xc,%ecx
+  802ce0:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802ce3:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802ce9:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802cec:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802cef:	39 4d d8             	cmp    %ecx,-0x28(%ebp)
+  802cf2:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  802cf5:	19 df                	sbb    %ebx,%edi
+  802cf7:	7c 22                	jl     802d1b <lru+0x119>
+			time_min = pages[PGNUM(uvpt[pgnum_actual])].timestamp;
+  802cf9:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  802d00:	c1 e9 0c             	shr    $0xc,%ecx
+  802d03:	6b c9 1c             	imul   $0x1c,%ecx,%ecx
+  802d06:	81 c1 00 00 00 ef    	add    $0xef000000,%ecx
+  802d0c:	8b 59 14             	mov    0x14(%ecx),%ebx
+  802d0f:	8b 49 10             	mov    0x10(%ecx),%ecx
+  802d12:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  802d15:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+		pgnum_actual = (pgnum + pgnum_offset)%(NPDENTRIES*NPTENTRIES);
+  802d18:	89 45 e8             	mov    %eax,-0x18(%ebp)
+		if (num_searched_ptes >= nentries*pct_to_walk) {
+  802d1b:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  802d1e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802d25:	df 6d e0             	fildll -0x20(%ebp)
+  802d28:	d9 05 00 58 80 00    	flds   0x805800
+  802d2e:	d9 c9                	fxch   %st(1)
+  802d30:	df f1                	fcomip %st(1),%st
+  802d32:	dd d8                	fstp   %st(0)
+  802d34:	0f 82 04 ff ff ff    	jb     802c3e <lru+0x3c>
+			pgnum = pgnum_actual;
+  802d3a:	a3 24 80 80 00       	mov    %eax,0x808024
+			return (void*)(pgnum_opt*PGSIZE);
+  802d3f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d42:	c1 e0 0c             	shl    $0xc,%eax
+  802d45:	eb 06                	jmp    802d4d <lru+0x14b>
+	return (void*)(pgnum_opt*PGSIZE);
+  802d47:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  802d4a:	c1 e0 0c             	shl    $0xc,%eax
+}
+  802d4d:	83 c4 1c             	add    $0x1c,%esp
+  802d50:	5b                   	pop    %ebx
+  802d51:	5e                   	pop    %esi
+  802d52:	5f                   	pop    %edi
+  802d53:	5d                   	pop    %ebp
+  802d54:	c3                   	ret
+
+00802d55 <set_page_choice_func>:
+{
+  802d55:	55                   	push   %ebp
+  802d56:	89 e5                	mov    %esp,%ebp
+	page_choice_func = pgchc_func;
+  802d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d5b:	a3 3c 60 80 00       	mov    %eax,0x80603c
+}
+  802d60:	5d                   	pop    %ebp
+  802d61:	c3                   	ret
+
+00802d62 <get_page_choice>:
+{
+  802d62:	55                   	push   %ebp
+  802d63:	89 e5                	mov    %esp,%ebp
+  802d65:	57                   	push   %edi
+  802d66:	56                   	push   %esi
+  802d67:	53                   	push   %ebx
+  802d68:	83 ec 24             	sub    $0x24,%esp
+  802d6b:	8b 75 08             	mov    0x8(%ebp),%esi
+  802d6e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	void *pg_out = page_choice_func(env, pg_in);
+  802d71:	57                   	push   %edi
+  802d72:	56                   	push   %esi
+  802d73:	ff 15 3c 60 80 00    	call   *0x80603c
+  802d79:	89 c3                	mov    %eax,%ebx
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802d7b:	83 c4 10             	add    $0x10,%esp
+  802d7e:	eb 25                	jmp    802da5 <get_page_choice+0x43>
+			return sys_page_split(0, PGADDR(pdx, 0, 0));
+  802d80:	83 ec 08             	sub    $0x8,%esp
+  802d83:	c1 e0 16             	shl    $0x16,%eax
+  802d86:	50                   	push   %eax
+  802d87:	6a 00                	push   $0x0
+  802d89:	e8 ec e0 ff ff       	call   800e7a <sys_page_split>
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802d8e:	83 c4 10             	add    $0x10,%esp
+  802d91:	85 c0                	test   %eax,%eax
+  802d93:	75 43                	jne    802dd8 <get_page_choice+0x76>
+		pg_out = page_choice_func(env, pg_in);
+  802d95:	83 ec 08             	sub    $0x8,%esp
+  802d98:	57                   	push   %edi
+  802d99:	56                   	push   %esi
+  802d9a:	ff 15 3c 60 80 00    	call   *0x80603c
+  802da0:	89 c3                	mov    %eax,%ebx
+  802da2:	83 c4 10             	add    $0x10,%esp
+	while ((uintptr_t)pg_out >= UTOP && page_split_any() == 0)
+  802da5:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802da8:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802dae:	0f 86 ae 00 00 00    	jbe    802e62 <get_page_choice+0x100>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802db4:	b8 00 00 00 00       	mov    $0x0,%eax
+		if ((uvpd[pdx] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS))
+  802db9:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  802dc0:	81 e2 81 00 00 00    	and    $0x81,%edx
+  802dc6:	81 fa 81 00 00 00    	cmp    $0x81,%edx
+  802dcc:	74 b2                	je     802d80 <get_page_choice+0x1e>
+	for (pdx = 0; pdx < PDX(UTOP); pdx++)
+  802dce:	83 c0 01             	add    $0x1,%eax
+  802dd1:	3d bb 03 00 00       	cmp    $0x3bb,%eax
+  802dd6:	75 e1                	jne    802db9 <get_page_choice+0x57>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802dd8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ddb:	05 00 10 40 11       	add    $0x11401000,%eax
+  802de0:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802de5:	76 1f                	jbe    802e06 <get_page_choice+0xa4>
+		return (void *) UTOP;
+  802de7:	bb 00 00 c0 ee       	mov    $0xeec00000,%ebx
+}
+  802dec:	89 d8                	mov    %ebx,%eax
+  802dee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802df1:	5b                   	pop    %ebx
+  802df2:	5e                   	pop    %esi
+  802df3:	5f                   	pop    %edi
+  802df4:	5d                   	pop    %ebp
+  802df5:	c3                   	ret
+		sys_page_split(0, pg_out);
+  802df6:	83 ec 08             	sub    $0x8,%esp
+  802df9:	53                   	push   %ebx
+  802dfa:	6a 00                	push   $0x0
+  802dfc:	e8 79 e0 ff ff       	call   800e7a <sys_page_split>
+  802e01:	83 c4 10             	add    $0x10,%esp
+  802e04:	eb 6c                	jmp    802e72 <get_page_choice+0x110>
+		panic("We tried to page out the user exception stack\n");
+  802e06:	83 ec 04             	sub    $0x4,%esp
+  802e09:	68 a8 53 80 00       	push   $0x8053a8
+  802e0e:	68 cc 01 00 00       	push   $0x1cc
+  802e13:	68 15 53 80 00       	push   $0x805315
+  802e18:	e8 e1 d3 ff ff       	call   8001fe <_panic>
+		panic("We tried to page out code pages\n");
+  802e1d:	83 ec 04             	sub    $0x4,%esp
+  802e20:	68 d8 53 80 00       	push   $0x8053d8
+  802e25:	68 d6 01 00 00       	push   $0x1d6
+  802e2a:	68 15 53 80 00       	push   $0x805315
+  802e2f:	e8 ca d3 ff ff       	call   8001fe <_panic>
+		panic("Invalid mapping for the va\n");
+  802e34:	83 ec 04             	sub    $0x4,%esp
+  802e37:	68 22 53 80 00       	push   $0x805322
+  802e3c:	68 da 01 00 00       	push   $0x1da
+  802e41:	68 15 53 80 00       	push   $0x805315
+  802e46:	e8 b3 d3 ff ff       	call   8001fe <_panic>
+		panic("We tried to page out a shared page\n");
+  802e4b:	83 ec 04             	sub    $0x4,%esp
+  802e4e:	68 fc 53 80 00       	push   $0x8053fc
+  802e53:	68 e0 01 00 00       	push   $0x1e0
+  802e58:	68 15 53 80 00       	push   $0x805315
+  802e5d:	e8 9c d3 ff ff       	call   8001fe <_panic>
+	if ((uintptr_t)pg_out < UTOP && (uvpd[PDX(pg_out)] & PTE_PS))
+  802e62:	89 de                	mov    %ebx,%esi
+  802e64:	c1 ee 16             	shr    $0x16,%esi
+  802e67:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802e6e:	a8 80                	test   $0x80,%al
+  802e70:	75 84                	jne    802df6 <get_page_choice+0x94>
+	if ((uintptr_t)pg_out < UXSTACKTOP &&
+  802e72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e75:	05 00 10 40 11       	add    $0x11401000,%eax
+  802e7a:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802e7f:	76 85                	jbe    802e06 <get_page_choice+0xa4>
+	else if (page_is_clean(pg_out))
+  802e81:	89 d8                	mov    %ebx,%eax
+  802e83:	e8 7e f3 ff ff       	call   802206 <page_is_clean>
+  802e88:	84 c0                	test   %al,%al
+  802e8a:	0f 85 5c ff ff ff    	jne    802dec <get_page_choice+0x8a>
+	else if ((uintptr_t)pg_out <= (uintptr_t)end)
+  802e90:	81 7d e4 2c 00 81 00 	cmpl   $0x81002c,-0x1c(%ebp)
+  802e97:	76 84                	jbe    802e1d <get_page_choice+0xbb>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) || !(uvpt[PGNUM(pg_out)] & PTE_P))
+  802e99:	8b 04 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%eax
+  802ea0:	a8 01                	test   $0x1,%al
+  802ea2:	74 90                	je     802e34 <get_page_choice+0xd2>
+  802ea4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ea7:	c1 e8 0c             	shr    $0xc,%eax
+  802eaa:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  802eb1:	f6 c2 01             	test   $0x1,%dl
+  802eb4:	0f 84 7a ff ff ff    	je     802e34 <get_page_choice+0xd2>
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802eba:	8b 14 b5 00 d0 7b ef 	mov    -0x10843000(,%esi,4),%edx
+  802ec1:	f6 c2 01             	test   $0x1,%dl
+  802ec4:	74 85                	je     802e4b <get_page_choice+0xe9>
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802ec6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if (!(uvpd[PDX(pg_out)] & PTE_P) ||
+  802ecd:	f6 c2 01             	test   $0x1,%dl
+  802ed0:	0f 84 75 ff ff ff    	je     802e4b <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802ed6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    !(uvpt[PGNUM(pg_out)] & PTE_P) ||
+  802edd:	f6 c6 04             	test   $0x4,%dh
+  802ee0:	0f 85 65 ff ff ff    	jne    802e4b <get_page_choice+0xe9>
+	    uvpt[PGNUM(pg_out)] & PTE_NO_PAGE)
+  802ee6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	    uvpt[PGNUM(pg_out)] & PTE_SHARE ||
+  802eed:	f6 c6 02             	test   $0x2,%dh
+  802ef0:	0f 85 55 ff ff ff    	jne    802e4b <get_page_choice+0xe9>
+	if (pages[PGNUM(uvpt[PGNUM(pg_out)])].pp_ref >= 2)
+  802ef6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802efd:	c1 e8 0c             	shr    $0xc,%eax
+  802f00:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802f03:	05 00 00 00 ef       	add    $0xef000000,%eax
+  802f08:	0f b7 40 0a          	movzwl 0xa(%eax),%eax
+  802f0c:	66 83 f8 01          	cmp    $0x1,%ax
+  802f10:	0f 86 d6 fe ff ff    	jbe    802dec <get_page_choice+0x8a>
+		panic("We tried to page out a page mapped in >1 locations\n");
+  802f16:	83 ec 04             	sub    $0x4,%esp
+  802f19:	68 20 54 80 00       	push   $0x805420
+  802f1e:	68 e2 01 00 00       	push   $0x1e2
+  802f23:	68 15 53 80 00       	push   $0x805315
+  802f28:	e8 d1 d2 ff ff       	call   8001fe <_panic>
+
+00802f2d <page_share_paged_out>:
+// Called by fork, whose child gets copies of both: the slots are then
+// shared rather than copied, and whichever of us pages a page in first
+// leaves the slot for the other.
+int
+page_share_paged_out(void)
+{
+  802f2d:	55                   	push   %ebp
+  802f2e:	89 e5                	mov    %esp,%ebp
+  802f30:	57                   	push   %edi
+  802f31:	56                   	push   %esi
+  802f32:	53                   	push   %ebx
+  802f33:	83 ec 0c             	sub    $0xc,%esp
+	uint32_t mdx, mtx, pn;
+	mte_t *mt;
+	int i, r;
+
+	find_paging_env();
+  802f36:	e8 e8 f6 ff ff       	call   802623 <find_paging_env>
+	if (pagingenv == 0 || !umapdir)
+  802f3b:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  802f40:	85 c0                	test   %eax,%eax
+  802f42:	74 41                	je     802f85 <page_share_paged_out+0x58>
+  802f44:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  802f4b:	0f 84 fd 00 00 00    	je     80304e <page_share_paged_out+0x121>
+		return 0;
+
+	for (i = 0; i < NPAGESERV; i++)
+		sharereqs[i].nslots = 0;
+  802f51:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802f58:	00 00 00 
+  802f5b:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  802f62:	00 00 00 
+  802f65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f6a:	eb 2c                	jmp    802f98 <page_share_paged_out+0x6b>
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+		if (!(umapdir[mdx] & MTE_P))
+			continue;
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802f6c:	83 c3 04             	add    $0x4,%ebx
+  802f6f:	39 f3                	cmp    %esi,%ebx
+  802f71:	74 1a                	je     802f8d <page_share_paged_out+0x60>
+			if ((mt[mtx] & MTE_P) && (r = page_share_slot(MTE_VAL(mt[mtx]))) < 0)
+  802f73:	8b 03                	mov    (%ebx),%eax
+  802f75:	a8 01                	test   $0x1,%al
+  802f77:	74 f3                	je     802f6c <page_share_paged_out+0x3f>
+  802f79:	c1 e8 0c             	shr    $0xc,%eax
+  802f7c:	e8 2b f5 ff ff       	call   8024ac <page_share_slot>
+  802f81:	85 c0                	test   %eax,%eax
+  802f83:	79 e7                	jns    802f6c <page_share_paged_out+0x3f>
+	}
+	for (i = 0; i < NPAGESERV; i++)
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+			return r;
+	return 0;
+}
+  802f85:	83 c4 0c             	add    $0xc,%esp
+  802f88:	5b                   	pop    %ebx
+  802f89:	5e                   	pop    %esi
+  802f8a:	5f                   	pop    %edi
+  802f8b:	5d                   	pop    %ebp
+  802f8c:	c3                   	ret
+	for (mdx = 0; mdx < NMDENTIRES; mdx++) {
+  802f8d:	83 c7 04             	add    $0x4,%edi
+  802f90:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  802f96:	74 1b                	je     802fb3 <page_share_paged_out+0x86>
+		if (!(umapdir[mdx] & MTE_P))
+  802f98:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  802f9d:	8b 1c 38             	mov    (%eax,%edi,1),%ebx
+  802fa0:	f6 c3 01             	test   $0x1,%bl
+  802fa3:	74 e8                	je     802f8d <page_share_paged_out+0x60>
+		mt = (mte_t*)(PGNUM(umapdir[mdx]) << MTXSHIFT);
+  802fa5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+		for (mtx = 0; mtx < NMTENTIRES; mtx++)
+  802fab:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  802fb1:	eb bc                	jmp    802f6f <page_share_paged_out+0x42>
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fb8:	eb 11                	jmp    802fcb <page_share_paged_out+0x9e>
+			pn += NPTENTRIES - 1;
+  802fba:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+	for (pn = 0; pn < PGNUM(UTOP); pn++) {
+  802fc0:	83 c3 01             	add    $0x1,%ebx
+  802fc3:	81 fb ff eb 0e 00    	cmp    $0xeebff,%ebx
+  802fc9:	77 41                	ja     80300c <page_share_paged_out+0xdf>
+		if ((uvpd[pn / NPTENTRIES] & (PTE_P|PTE_PS)) != PTE_P) {
+  802fcb:	89 d8                	mov    %ebx,%eax
+  802fcd:	c1 e8 0a             	shr    $0xa,%eax
+  802fd0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802fd7:	25 81 00 00 00       	and    $0x81,%eax
+  802fdc:	83 f8 01             	cmp    $0x1,%eax
+  802fdf:	75 d9                	jne    802fba <page_share_paged_out+0x8d>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  802fe1:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802fe8:	25 81 00 00 00       	and    $0x81,%eax
+  802fed:	3d 80 00 00 00       	cmp    $0x80,%eax
+  802ff2:	75 cc                	jne    802fc0 <page_share_paged_out+0x93>
+		    (r = page_share_slot(PTE_SWAP_SLOT(uvpt[pn]))) < 0)
+  802ff4:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  802ffb:	c1 e8 0c             	shr    $0xc,%eax
+  802ffe:	e8 a9 f4 ff ff       	call   8024ac <page_share_slot>
+		if ((uvpt[pn] & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED &&
+  803003:	85 c0                	test   %eax,%eax
+  803005:	79 b9                	jns    802fc0 <page_share_paged_out+0x93>
+  803007:	e9 79 ff ff ff       	jmp    802f85 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  80300c:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803013:	75 13                	jne    803028 <page_share_paged_out+0xfb>
+  803015:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80301c:	75 1d                	jne    80303b <page_share_paged_out+0x10e>
+	return 0;
+  80301e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803023:	e9 5d ff ff ff       	jmp    802f85 <page_share_paged_out+0x58>
+		if (sharereqs[i].nslots > 0 && (r = page_share_send(i)) < 0)
+  803028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302d:	e8 46 f4 ff ff       	call   802478 <page_share_send>
+  803032:	85 c0                	test   %eax,%eax
+  803034:	79 df                	jns    803015 <page_share_paged_out+0xe8>
+  803036:	e9 4a ff ff ff       	jmp    802f85 <page_share_paged_out+0x58>
+  80303b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803040:	e8 33 f4 ff ff       	call   802478 <page_share_send>
+  803045:	85 c0                	test   %eax,%eax
+  803047:	79 d5                	jns    80301e <page_share_paged_out+0xf1>
+  803049:	e9 37 ff ff ff       	jmp    802f85 <page_share_paged_out+0x58>
+		return 0;
+  80304e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803053:	e9 2d ff ff ff       	jmp    802f85 <page_share_paged_out+0x58>
+
+00803058 <get_paging_stats>:
+
+// Get paging stats from the paging servers, added up.
+// Simply a wrapper around sending the IPC to each paging server
+struct Pageret_stat*
+get_paging_stats()
+{
+  803058:	55                   	push   %ebp
+  803059:	89 e5                	mov    %esp,%ebp
+  80305b:	56                   	push   %esi
+  80305c:	53                   	push   %ebx
+  80305d:	83 ec 20             	sub    $0x20,%esp
+	struct Pageret_stat total;
+	int i;
+
+	// First, check that the paging envs are up
+	find_paging_env();
+  803060:	e8 be f5 ff ff       	call   802623 <find_paging_env>
+	if (pagingenv == 0)
+		return NULL;
+  803065:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (pagingenv == 0)
+  80306a:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803071:	0f 84 82 00 00 00    	je     8030f9 <get_paging_stats+0xa1>
+	// Send the ipcs; each paging server fills in our page
+	struct Pageret_stat* stats = (struct Pageret_stat*)malloc(PGSIZE);
+  803077:	83 ec 0c             	sub    $0xc,%esp
+  80307a:	68 00 10 00 00       	push   $0x1000
+  80307f:	e8 84 11 00 00       	call   804208 <malloc>
+  803084:	89 c3                	mov    %eax,%ebx
+	memset(&total, 0, sizeof(total));
+  803086:	83 c4 0c             	add    $0xc,%esp
+  803089:	6a 14                	push   $0x14
+  80308b:	6a 00                	push   $0x0
+  80308d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803090:	50                   	push   %eax
+  803091:	e8 7b d9 ff ff       	call   800a11 <memset>
+  803096:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NPAGESERV; i++) {
+  803099:	be 00 00 00 00       	mov    $0x0,%esi
+		ipc_call(pagingenvs[i], PAGEREQ_PAGE_STAT, stats, 1, PTE_U|PTE_W|PTE_P);
+  80309e:	83 ec 0c             	sub    $0xc,%esp
+  8030a1:	6a 07                	push   $0x7
+  8030a3:	6a 01                	push   $0x1
+  8030a5:	53                   	push   %ebx
+  8030a6:	6a 03                	push   $0x3
+  8030a8:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  8030af:	e8 b7 19 00 00       	call   804a6b <ipc_call>
+		total.num_page_outs += stats->num_page_outs;
+  8030b4:	8b 03                	mov    (%ebx),%eax
+  8030b6:	01 45 e4             	add    %eax,-0x1c(%ebp)
+		total.num_page_ins += stats->num_page_ins;
+  8030b9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030bc:	01 45 e8             	add    %eax,-0x18(%ebp)
+		total.num_page_removes += stats->num_page_removes;
+  8030bf:	8b 43 08             	mov    0x8(%ebx),%eax
+  8030c2:	01 45 ec             	add    %eax,-0x14(%ebp)
+		total.num_page_shares += stats->num_page_shares;
+  8030c5:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8030c8:	01 45 f0             	add    %eax,-0x10(%ebp)
+		total.num_page_reclaims += stats->num_page_reclaims;
+  8030cb:	8b 43 10             	mov    0x10(%ebx),%eax
+  8030ce:	01 45 f4             	add    %eax,-0xc(%ebp)
+	for (i = 0; i < NPAGESERV; i++) {
+  8030d1:	83 c6 01             	add    $0x1,%esi
+  8030d4:	83 c4 20             	add    $0x20,%esp
+  8030d7:	83 fe 02             	cmp    $0x2,%esi
+  8030da:	75 c2                	jne    80309e <get_paging_stats+0x46>
+	}
+	*stats = total;
+  8030dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030df:	89 03                	mov    %eax,(%ebx)
+  8030e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  8030e4:	89 43 04             	mov    %eax,0x4(%ebx)
+  8030e7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8030ea:	89 43 08             	mov    %eax,0x8(%ebx)
+  8030ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8030f0:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8030f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030f6:	89 43 10             	mov    %eax,0x10(%ebx)
+	return stats;
+}
+  8030f9:	89 d8                	mov    %ebx,%eax
+  8030fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030fe:	5b                   	pop    %ebx
+  8030ff:	5e                   	pop    %esi
+  803100:	5d                   	pop    %ebp
+  803101:	c3                   	ret
+
+00803102 <print_paging_stats>:
+
+void
+print_paging_stats(struct Pageret_stat *stats)
+{
+  803102:	55                   	push   %ebp
+  803103:	89 e5                	mov    %esp,%ebp
+  803105:	53                   	push   %ebx
+  803106:	83 ec 10             	sub    $0x10,%esp
+  803109:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	cprintf("\n");
+  80310c:	68 42 4e 80 00       	push   $0x804e42
+  803111:	e8 c3 d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Total number of page outs: %d\n", stats->num_page_outs);
+  803116:	83 c4 08             	add    $0x8,%esp
+  803119:	ff 33                	push   (%ebx)
+  80311b:	68 54 54 80 00       	push   $0x805454
+  803120:	e8 b4 d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Total number of page ins: %d\n", stats->num_page_ins);
+  803125:	83 c4 08             	add    $0x8,%esp
+  803128:	ff 73 04             	push   0x4(%ebx)
+  80312b:	68 3e 53 80 00       	push   $0x80533e
+  803130:	e8 a4 d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Total number of page removes: %d\n", stats->num_page_removes);
+  803135:	83 c4 08             	add    $0x8,%esp
+  803138:	ff 73 08             	push   0x8(%ebx)
+  80313b:	68 74 54 80 00       	push   $0x805474
+  803140:	e8 94 d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Total number of page shares: %d\n", stats->num_page_shares);
+  803145:	83 c4 08             	add    $0x8,%esp
+  803148:	ff 73 0c             	push   0xc(%ebx)
+  80314b:	68 98 54 80 00       	push   $0x805498
+  803150:	e8 84 d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Total number of page outs of the coldest page anywhere: %d\n", stats->num_page_reclaims);
+  803155:	83 c4 08             	add    $0x8,%esp
+  803158:	ff 73 10             	push   0x10(%ebx)
+  80315b:	68 bc 54 80 00       	push   $0x8054bc
+  803160:	e8 74 d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Clean pages dropped here without a page out: %d\n", num_page_drops);
+  803165:	83 c4 08             	add    $0x8,%esp
+  803168:	ff 35 08 b0 80 00    	push   0x80b008
+  80316e:	68 f8 54 80 00       	push   $0x8054f8
+  803173:	e8 61 d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Shortages here met by paging out the coldest page anywhere: %d\n", num_page_reclaims);
+  803178:	83 c4 08             	add    $0x8,%esp
+  80317b:	ff 35 04 b0 80 00    	push   0x80b004
+  803181:	68 2c 55 80 00       	push   $0x80552c
+  803186:	e8 4e d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+		thisenv->env_npages, thisenv->env_rss_min, thisenv->env_rss_max);
+  80318b:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803190:	8b 48 6c             	mov    0x6c(%eax),%ecx
+  803193:	8b 50 68             	mov    0x68(%eax),%edx
+  803196:	8b 40 64             	mov    0x64(%eax),%eax
+	cprintf("Resident pages here: %d (guaranteed %d, limit %d)\n",
+  803199:	51                   	push   %ecx
+  80319a:	52                   	push   %edx
+  80319b:	50                   	push   %eax
+  80319c:	68 6c 55 80 00       	push   $0x80556c
+  8031a1:	e8 33 d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Pages the paging servers took from here: %u\n", thisenv->env_rss_reclaimed);
+  8031a6:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8031ab:	8b 40 70             	mov    0x70(%eax),%eax
+  8031ae:	83 c4 18             	add    $0x18,%esp
+  8031b1:	50                   	push   %eax
+  8031b2:	68 a0 55 80 00       	push   $0x8055a0
+  8031b7:	e8 1d d1 ff ff       	call   8002d9 <cprintf>
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+		meminfo.mi_level, meminfo.mi_free_pages, meminfo.mi_npages);
+  8031bc:	8b 0d 08 f0 ff ee    	mov    0xeefff008,%ecx
+  8031c2:	8b 15 04 f0 ff ee    	mov    0xeefff004,%edx
+  8031c8:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+	cprintf("Memory pressure: level %d, %d of %d pages free\n",
+  8031cd:	51                   	push   %ecx
+  8031ce:	52                   	push   %edx
+  8031cf:	50                   	push   %eax
+  8031d0:	68 d0 55 80 00       	push   $0x8055d0
+  8031d5:	e8 ff d0 ff ff       	call   8002d9 <cprintf>
+	cprintf("\n");
+  8031da:	83 c4 14             	add    $0x14,%esp
+  8031dd:	68 42 4e 80 00       	push   $0x804e42
+  8031e2:	e8 f2 d0 ff ff       	call   8002d9 <cprintf>
+}
+  8031e7:	83 c4 10             	add    $0x10,%esp
+  8031ea:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ed:	c9                   	leave
+  8031ee:	c3                   	ret
+
+008031ef <get_and_print_paging_stats>:
+
+void
+get_and_print_paging_stats()
+{
+  8031ef:	55                   	push   %ebp
+  8031f0:	89 e5                	mov    %esp,%ebp
+  8031f2:	83 ec 08             	sub    $0x8,%esp
+	print_paging_stats(get_paging_stats());
+  8031f5:	e8 5e fe ff ff       	call   803058 <get_paging_stats>
+  8031fa:	83 ec 0c             	sub    $0xc,%esp
+  8031fd:	50                   	push   %eax
+  8031fe:	e8 ff fe ff ff       	call   803102 <print_paging_stats>
+}
+  803203:	83 c4 10             	add    $0x10,%esp
+  803206:	c9                   	leave
+  803207:	c3                   	ret
+
+00803208 <mem_pressure_wait>:
+// Sleep until the memory pressure level is no longer 'level', and
+// return the new one (MEM_PRESSURE_*).  A cache can keep an environment
+// of its own in here, dropping its clean data as the level goes up.
+uint32_t
+mem_pressure_wait(uint32_t level)
+{
+  803208:	55                   	push   %ebp
+  803209:	89 e5                	mov    %esp,%ebp
+  80320b:	53                   	push   %ebx
+  80320c:	83 ec 04             	sub    $0x4,%esp
+  80320f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t now;
+
+	// The kernel wakes us when it changes the level
+	while ((now = meminfo.mi_level) == level)
+  803212:	eb 13                	jmp    803227 <mem_pressure_wait+0x1f>
+		sys_futex_wait((const uint32_t *) &meminfo.mi_level, level, -1);
+  803214:	83 ec 04             	sub    $0x4,%esp
+  803217:	6a ff                	push   $0xffffffff
+  803219:	53                   	push   %ebx
+  80321a:	68 00 f0 ff ee       	push   $0xeefff000
+  80321f:	e8 68 e0 ff ff       	call   80128c <sys_futex_wait>
+  803224:	83 c4 10             	add    $0x10,%esp
+	while ((now = meminfo.mi_level) == level)
+  803227:	a1 00 f0 ff ee       	mov    0xeefff000,%eax
+  80322c:	39 d8                	cmp    %ebx,%eax
+  80322e:	74 e4                	je     803214 <mem_pressure_wait+0xc>
+	return now;
+}
+  803230:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803233:	c9                   	leave
+  803234:	c3                   	ret
+
+00803235 <init_map_dir>:
+
+void
+init_map_dir()
+{
+  803235:	55                   	push   %ebp
+  803236:	89 e5                	mov    %esp,%ebp
+  803238:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	// Set the pgfault handler
+	add_pgfault_handler(paging_pgfault_handler);
+  80323b:	68 a7 3e 80 00       	push   $0x803ea7
+  803240:	e8 32 16 00 00       	call   804877 <add_pgfault_handler>
+
+        // Define the global umapdir variable, allocate a page
+	umapdir = (mde_t*)UMAPDIR;
+  803245:	c7 05 14 e9 80 00 00 	movl   $0xdeadb000,0x80e914
+  80324c:	b0 ad de 
+	if((r = sys_page_alloc(0, umapdir, PTE_P|PTE_U|PTE_W|PTE_NO_PAGE)) < 0)
+  80324f:	83 c4 0c             	add    $0xc,%esp
+  803252:	68 07 02 00 00       	push   $0x207
+  803257:	68 00 b0 ad de       	push   $0xdeadb000
+  80325c:	6a 00                	push   $0x0
+  80325e:	e8 50 db ff ff       	call   800db3 <sys_page_alloc>
+  803263:	83 c4 10             	add    $0x10,%esp
+  803266:	85 c0                	test   %eax,%eax
+  803268:	78 0c                	js     803276 <init_map_dir+0x41>
+		panic("init_map_dir: %e", r);
+
+	find_paging_env();
+  80326a:	e8 b4 f3 ff ff       	call   802623 <find_paging_env>
+	page_ring_ready();
+  80326f:	e8 7f f2 ff ff       	call   8024f3 <page_ring_ready>
+}
+  803274:	c9                   	leave
+  803275:	c3                   	ret
+		panic("init_map_dir: %e", r);
+  803276:	50                   	push   %eax
+  803277:	68 5c 53 80 00       	push   $0x80535c
+  80327c:	68 13 05 00 00       	push   $0x513
+  803281:	68 15 53 80 00       	push   $0x805315
+  803286:	e8 73 cf ff ff       	call   8001fe <_panic>
+
+0080328b <umapdir_walk>:
+
+mte_t *
+umapdir_walk(const void *va, int create)
+{
+  80328b:	55                   	push   %ebp
+  80328c:	89 e5                	mov    %esp,%ebp
+  80328e:	57                   	push   %edi
+  80328f:	56                   	push   %esi
+  803290:	53                   	push   %ebx
+  803291:	83 ec 0c             	sub    $0xc,%esp
+  803294:	8b 7d 08             	mov    0x8(%ebp),%edi
+	mde_t *mde;
+	void *page;
+	int r;
+
+	// Find directory entry
+	mde = (mde_t*)(umapdir + MDX(va));
+  803297:	89 fa                	mov    %edi,%edx
+  803299:	c1 ea 16             	shr    $0x16,%edx
+  80329c:	a1 14 e9 80 00       	mov    0x80e914,%eax
+  8032a1:	8d 34 90             	lea    (%eax,%edx,4),%esi
+	// Mapping table doesn't exist yet
+	if(!(*mde & MTE_P)){
+  8032a4:	f6 06 01             	testb  $0x1,(%esi)
+  8032a7:	75 3e                	jne    8032e7 <umapdir_walk+0x5c>
+		// Should we create it?
+		if(!create)
+			return NULL;
+  8032a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if(!create)
+  8032ae:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8032b2:	74 47                	je     8032fb <umapdir_walk+0x70>
+		// Find a page to allocate for it, with PTE_NO_PAGE set
+		page = va_alloc(1);
+  8032b4:	83 ec 0c             	sub    $0xc,%esp
+  8032b7:	6a 01                	push   $0x1
+  8032b9:	e8 f2 11 00 00       	call   8044b0 <va_alloc>
+  8032be:	89 c3                	mov    %eax,%ebx
+		if(!page)
+  8032c0:	83 c4 10             	add    $0x10,%esp
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	74 34                	je     8032fb <umapdir_walk+0x70>
+			return NULL;
+		if(page_alloc(0, page, PTE_P|PTE_W|PTE_U|PTE_NO_PAGE, 0) < 0)
+  8032c7:	6a 00                	push   $0x0
+  8032c9:	68 07 02 00 00       	push   $0x207
+  8032ce:	50                   	push   %eax
+  8032cf:	6a 00                	push   $0x0
+  8032d1:	e8 df 02 00 00       	call   8035b5 <page_alloc>
+  8032d6:	83 c4 10             	add    $0x10,%esp
+  8032d9:	85 c0                	test   %eax,%eax
+  8032db:	78 28                	js     803305 <umapdir_walk+0x7a>
+			va_free(page, 1);
+			return NULL;
+		}
+		// Check to see if a recursive call to umapdir_walk
+		// created the table already
+		if(*mde & MTE_P)
+  8032dd:	f6 06 01             	testb  $0x1,(%esi)
+  8032e0:	75 38                	jne    80331a <umapdir_walk+0x8f>
+		{
+			sys_page_unmap(0, page);
+			va_free(page, 1);
+		}
+		else
+			*mde = (uintptr_t)(page) | MTE_P;
+  8032e2:	83 cb 01             	or     $0x1,%ebx
+  8032e5:	89 1e                	mov    %ebx,(%esi)
+	}
+	// Get the pointer to the mapping table and add the mapping table offset
+	return (mte_t*)(PGNUM(*mde) << MTXSHIFT) + MTX(va);
+  8032e7:	89 f8                	mov    %edi,%eax
+  8032e9:	c1 e8 0a             	shr    $0xa,%eax
+  8032ec:	25 fc 0f 00 00       	and    $0xffc,%eax
+  8032f1:	8b 1e                	mov    (%esi),%ebx
+  8032f3:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8032f9:	01 c3                	add    %eax,%ebx
+}
+  8032fb:	89 d8                	mov    %ebx,%eax
+  8032fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803300:	5b                   	pop    %ebx
+  803301:	5e                   	pop    %esi
+  803302:	5f                   	pop    %edi
+  803303:	5d                   	pop    %ebp
+  803304:	c3                   	ret
+			va_free(page, 1);
+  803305:	83 ec 08             	sub    $0x8,%esp
+  803308:	6a 01                	push   $0x1
+  80330a:	53                   	push   %ebx
+  80330b:	e8 d8 12 00 00       	call   8045e8 <va_free>
+			return NULL;
+  803310:	83 c4 10             	add    $0x10,%esp
+  803313:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803318:	eb e1                	jmp    8032fb <umapdir_walk+0x70>
+			sys_page_unmap(0, page);
+  80331a:	83 ec 08             	sub    $0x8,%esp
+  80331d:	53                   	push   %ebx
+  80331e:	6a 00                	push   $0x0
+  803320:	e8 13 db ff ff       	call   800e38 <sys_page_unmap>
+			va_free(page, 1);
+  803325:	83 c4 08             	add    $0x8,%esp
+  803328:	6a 01                	push   $0x1
+  80332a:	53                   	push   %ebx
+  80332b:	e8 b8 12 00 00       	call   8045e8 <va_free>
+  803330:	83 c4 10             	add    $0x10,%esp
+  803333:	eb b2                	jmp    8032e7 <umapdir_walk+0x5c>
+
+00803335 <page_out>:
+{
+  803335:	55                   	push   %ebp
+  803336:	89 e5                	mov    %esp,%ebp
+  803338:	57                   	push   %edi
+  803339:	56                   	push   %esi
+  80333a:	53                   	push   %ebx
+  80333b:	83 ec 5c             	sub    $0x5c,%esp
+  80333e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	find_paging_env();
+  803341:	e8 dd f2 ff ff       	call   802623 <find_paging_env>
+	if (pagingenv && ipc_call(pagingenv, PAGEREQ_PAGE_RECLAIM, NULL, 0, 0) == 0) {
+  803346:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  80334b:	85 c0                	test   %eax,%eax
+  80334d:	74 1e                	je     80336d <page_out+0x38>
+  80334f:	83 ec 0c             	sub    $0xc,%esp
+  803352:	6a 00                	push   $0x0
+  803354:	6a 00                	push   $0x0
+  803356:	6a 00                	push   $0x0
+  803358:	6a 08                	push   $0x8
+  80335a:	50                   	push   %eax
+  80335b:	e8 0b 17 00 00       	call   804a6b <ipc_call>
+  803360:	89 c3                	mov    %eax,%ebx
+  803362:	83 c4 20             	add    $0x20,%esp
+  803365:	85 c0                	test   %eax,%eax
+  803367:	0f 84 ac 00 00 00    	je     803419 <page_out+0xe4>
+	void *map_out_addr = get_page_choice(env, pg_in);
+  80336d:	83 ec 08             	sub    $0x8,%esp
+  803370:	ff 75 0c             	push   0xc(%ebp)
+  803373:	57                   	push   %edi
+  803374:	e8 e9 f9 ff ff       	call   802d62 <get_page_choice>
+  803379:	89 c6                	mov    %eax,%esi
+	if(map_out_addr == (void *) UTOP)
+  80337b:	83 c4 10             	add    $0x10,%esp
+  80337e:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  803383:	0f 84 18 02 00 00    	je     8035a1 <page_out+0x26c>
+	if (page_is_clean(map_out_addr)) {
+  803389:	e8 78 ee ff ff       	call   802206 <page_is_clean>
+  80338e:	84 c0                	test   %al,%al
+  803390:	0f 85 8c 00 00 00    	jne    803422 <page_out+0xed>
+	if (pagingenv == 0)
+  803396:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  80339d:	0f 84 08 02 00 00    	je     8035ab <page_out+0x276>
+	if (page_ring_ready())
+  8033a3:	e8 4b f1 ff ff       	call   8024f3 <page_ring_ready>
+  8033a8:	89 c3                	mov    %eax,%ebx
+  8033aa:	85 c0                	test   %eax,%eax
+  8033ac:	0f 85 89 00 00 00    	jne    80343b <page_out+0x106>
+	uint32_t map_index = ipc_call(pagingenv, PAGEREQ_PAGE_OUT, map_out_addr, 1, PTE_P|PTE_U);
+  8033b2:	83 ec 0c             	sub    $0xc,%esp
+  8033b5:	6a 05                	push   $0x5
+  8033b7:	6a 01                	push   $0x1
+  8033b9:	56                   	push   %esi
+  8033ba:	6a 01                	push   $0x1
+  8033bc:	ff 35 40 b0 80 00    	push   0x80b040
+  8033c2:	e8 a4 16 00 00       	call   804a6b <ipc_call>
+  8033c7:	89 c7                	mov    %eax,%edi
+	if ((int)map_index < 0)
+  8033c9:	83 c4 20             	add    $0x20,%esp
+  8033cc:	85 c0                	test   %eax,%eax
+  8033ce:	0f 88 b8 01 00 00    	js     80358c <page_out+0x257>
+	pte = uvpt[PGNUM(map_out_addr)];
+  8033d4:	89 f0                	mov    %esi,%eax
+  8033d6:	c1 e8 0c             	shr    $0xc,%eax
+  8033d9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033e0:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	sys_page_unmap(0, map_out_addr);
+  8033e3:	83 ec 08             	sub    $0x8,%esp
+  8033e6:	56                   	push   %esi
+  8033e7:	6a 00                	push   $0x0
+  8033e9:	e8 4a da ff ff       	call   800e38 <sys_page_unmap>
+	mte_t *mte = umapdir_walk(map_out_addr, 1);
+  8033ee:	83 c4 08             	add    $0x8,%esp
+  8033f1:	6a 01                	push   $0x1
+  8033f3:	56                   	push   %esi
+  8033f4:	e8 92 fe ff ff       	call   80328b <umapdir_walk>
+	perm = (pte & PTE_SYSCALL) | MTE_P;
+  8033f9:	8b 75 a4             	mov    -0x5c(%ebp),%esi
+  8033fc:	81 e6 06 0e 00 00    	and    $0xe06,%esi
+	*mte = (map_index << MTEFLAGS);
+  803402:	c1 e7 0c             	shl    $0xc,%edi
+	*mte |= perm;
+  803405:	09 fe                	or     %edi,%esi
+  803407:	83 ce 01             	or     $0x1,%esi
+  80340a:	89 30                	mov    %esi,(%eax)
+	return 0;
+  80340c:	83 c4 10             	add    $0x10,%esp
+}
+  80340f:	89 d8                	mov    %ebx,%eax
+  803411:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803414:	5b                   	pop    %ebx
+  803415:	5e                   	pop    %esi
+  803416:	5f                   	pop    %edi
+  803417:	5d                   	pop    %ebp
+  803418:	c3                   	ret
+		num_page_reclaims++;
+  803419:	83 05 04 b0 80 00 01 	addl   $0x1,0x80b004
+		return 0;
+  803420:	eb ed                	jmp    80340f <page_out+0xda>
+		num_page_drops++;
+  803422:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+		return sys_page_unmap(0, map_out_addr);
+  803429:	83 ec 08             	sub    $0x8,%esp
+  80342c:	56                   	push   %esi
+  80342d:	6a 00                	push   $0x0
+  80342f:	e8 04 da ff ff       	call   800e38 <sys_page_unmap>
+  803434:	89 c3                	mov    %eax,%ebx
+  803436:	83 c4 10             	add    $0x10,%esp
+  803439:	eb d4                	jmp    80340f <page_out+0xda>
+
+static __inline uint32_t
+read_esp(void)
+{
+	uint32_t esp;
+	__asm __volatile("movl %%esp,%0" : "=r" (esp));
+  80343b:	89 e0                	mov    %esp,%eax
+	stack_lo = ROUNDDOWN(read_esp(), PGSIZE) - PGSIZE;
+  80343d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803442:	2d 00 10 00 00       	sub    $0x1000,%eax
+  803447:	89 45 9c             	mov    %eax,-0x64(%ebp)
+	__asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+  80344a:	89 e8                	mov    %ebp,%eax
+	stack_hi = read_ebp() + 2*sizeof(uint32_t);
+  80344c:	83 c0 08             	add    $0x8,%eax
+  80344f:	89 45 98             	mov    %eax,-0x68(%ebp)
+	page_ring_reserve(PAGERING_NDATA);
+  803452:	b8 07 00 00 00       	mov    $0x7,%eax
+  803457:	e8 e5 ef ff ff       	call   802441 <page_ring_reserve>
+	first = ring->sq_tail;
+  80345c:	a1 04 30 ad de       	mov    0xdead3004,%eax
+  803461:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+	for (n = 0; ; ) {
+  803464:	bb 00 00 00 00       	mov    $0x0,%ebx
+		memcpy(RING_DATA(n), va, PGSIZE);
+  803469:	83 ec 04             	sub    $0x4,%esp
+  80346c:	68 00 10 00 00       	push   $0x1000
+  803471:	56                   	push   %esi
+  803472:	89 d8                	mov    %ebx,%eax
+  803474:	c1 e0 0c             	shl    $0xc,%eax
+  803477:	2d 00 c0 52 21       	sub    $0x2152c000,%eax
+  80347c:	50                   	push   %eax
+  80347d:	e8 26 d6 ff ff       	call   800aa8 <memcpy>
+		vas[n] = va;
+  803482:	89 74 9d b0          	mov    %esi,-0x50(%ebp,%ebx,4)
+		page_ring_post(PAGEREQ_PAGE_OUT, 0, n);
+  803486:	89 d9                	mov    %ebx,%ecx
+  803488:	ba 00 00 00 00       	mov    $0x0,%edx
+  80348d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803492:	e8 de ee ff ff       	call   802375 <page_ring_post>
+		if (++n == PAGERING_NDATA)
+  803497:	8d 43 01             	lea    0x1(%ebx),%eax
+  80349a:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  80349d:	83 c4 10             	add    $0x10,%esp
+  8034a0:	83 fb 06             	cmp    $0x6,%ebx
+  8034a3:	74 62                	je     803507 <page_out+0x1d2>
+  8034a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8034a8:	eb 15                	jmp    8034bf <page_out+0x18a>
+			num_page_drops++;
+  8034aa:	83 05 08 b0 80 00 01 	addl   $0x1,0x80b008
+			sys_page_unmap(0, va);
+  8034b1:	83 ec 08             	sub    $0x8,%esp
+  8034b4:	56                   	push   %esi
+  8034b5:	6a 00                	push   $0x0
+  8034b7:	e8 7c d9 ff ff       	call   800e38 <sys_page_unmap>
+  8034bc:	83 c4 10             	add    $0x10,%esp
+		while ((va = get_page_choice(env, pg_in)) != (void *) UTOP && page_is_clean(va)) {
+  8034bf:	83 ec 08             	sub    $0x8,%esp
+  8034c2:	53                   	push   %ebx
+  8034c3:	57                   	push   %edi
+  8034c4:	e8 99 f8 ff ff       	call   802d62 <get_page_choice>
+  8034c9:	89 c6                	mov    %eax,%esi
+  8034cb:	83 c4 10             	add    $0x10,%esp
+  8034ce:	3d 00 00 c0 ee       	cmp    $0xeec00000,%eax
+  8034d3:	74 32                	je     803507 <page_out+0x1d2>
+  8034d5:	e8 2c ed ff ff       	call   802206 <page_is_clean>
+  8034da:	84 c0                	test   %al,%al
+  8034dc:	75 cc                	jne    8034aa <page_out+0x175>
+		if (va == (void *) UTOP ||
+  8034de:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  8034e1:	39 c6                	cmp    %eax,%esi
+  8034e3:	72 07                	jb     8034ec <page_out+0x1b7>
+  8034e5:	8b 45 98             	mov    -0x68(%ebp),%eax
+  8034e8:	39 c6                	cmp    %eax,%esi
+  8034ea:	72 1b                	jb     803507 <page_out+0x1d2>
+		for (i = 0; i < n && vas[i] != va; i++)
+  8034ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8034f1:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  8034f4:	eb 03                	jmp    8034f9 <page_out+0x1c4>
+  8034f6:	83 c3 01             	add    $0x1,%ebx
+  8034f9:	39 da                	cmp    %ebx,%edx
+  8034fb:	0f 84 68 ff ff ff    	je     803469 <page_out+0x134>
+  803501:	3b 74 9d b0          	cmp    -0x50(%ebp,%ebx,4),%esi
+  803505:	75 ef                	jne    8034f6 <page_out+0x1c1>
+	page_ring_enter(first, res, n);
+  803507:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  80350a:	8d 55 cc             	lea    -0x34(%ebp),%edx
+  80350d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  803510:	e8 a6 ee ff ff       	call   8023bb <page_ring_enter>
+	for (i = 0; i < n; i++) {
+  803515:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80351a:	eb 42                	jmp    80355e <page_out+0x229>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  80351c:	8b 7c 9d b0          	mov    -0x50(%ebp,%ebx,4),%edi
+  803520:	89 f8                	mov    %edi,%eax
+  803522:	c1 e8 0c             	shr    $0xc,%eax
+  803525:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80352c:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+		sys_page_unmap(0, vas[i]);
+  80352f:	83 ec 08             	sub    $0x8,%esp
+  803532:	57                   	push   %edi
+  803533:	6a 00                	push   $0x0
+  803535:	e8 fe d8 ff ff       	call   800e38 <sys_page_unmap>
+		mte = umapdir_walk(vas[i], 1);
+  80353a:	83 c4 08             	add    $0x8,%esp
+  80353d:	6a 01                	push   $0x1
+  80353f:	57                   	push   %edi
+  803540:	e8 46 fd ff ff       	call   80328b <umapdir_walk>
+		perm = (uvpt[PGNUM(vas[i])] & PTE_SYSCALL) | MTE_P;
+  803545:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  803548:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+		*mte = (res[i] << MTEFLAGS) | perm;
+  80354e:	c1 e6 0c             	shl    $0xc,%esi
+  803551:	09 d6                	or     %edx,%esi
+  803553:	83 ce 01             	or     $0x1,%esi
+  803556:	89 30                	mov    %esi,(%eax)
+	for (i = 0; i < n; i++) {
+  803558:	83 c3 01             	add    $0x1,%ebx
+  80355b:	83 c4 10             	add    $0x10,%esp
+  80355e:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803561:	39 c3                	cmp    %eax,%ebx
+  803563:	74 1d                	je     803582 <page_out+0x24d>
+		if (res[i] < 0)
+  803565:	8b 74 9d cc          	mov    -0x34(%ebp,%ebx,4),%esi
+  803569:	85 f6                	test   %esi,%esi
+  80356b:	79 af                	jns    80351c <page_out+0x1e7>
+			panic("Error from the paging server: %e\n", res[i]);
+  80356d:	56                   	push   %esi
+  80356e:	68 00 56 80 00       	push   $0x805600
+  803573:	68 d1 02 00 00       	push   $0x2d1
+  803578:	68 15 53 80 00       	push   $0x805315
+  80357d:	e8 7c cc ff ff       	call   8001fe <_panic>
+		return page_out_ring(env, pg_in, map_out_addr);
+  803582:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803587:	e9 83 fe ff ff       	jmp    80340f <page_out+0xda>
+		panic("Error from the paging server: %e\n", map_index);
+  80358c:	50                   	push   %eax
+  80358d:	68 00 56 80 00       	push   $0x805600
+  803592:	68 0a 03 00 00       	push   $0x30a
+  803597:	68 15 53 80 00       	push   $0x805315
+  80359c:	e8 5d cc ff ff       	call   8001fe <_panic>
+		return -E_NO_MEM;
+  8035a1:	bb fc ff ff ff       	mov    $0xfffffffc,%ebx
+  8035a6:	e9 64 fe ff ff       	jmp    80340f <page_out+0xda>
+		return -E_PAGING;
+  8035ab:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035b0:	e9 5a fe ff ff       	jmp    80340f <page_out+0xda>
+
+008035b5 <page_alloc>:
+{
+  8035b5:	55                   	push   %ebp
+  8035b6:	89 e5                	mov    %esp,%ebp
+  8035b8:	57                   	push   %edi
+  8035b9:	56                   	push   %esi
+  8035ba:	53                   	push   %ebx
+  8035bb:	83 ec 0c             	sub    $0xc,%esp
+  8035be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if(!umapdir)
+  8035c4:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8035cb:	74 34                	je     803601 <page_alloc+0x4c>
+	if (check_mte)
+  8035cd:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+  8035d1:	75 35                	jne    803608 <page_alloc+0x53>
+	while ((r = sys_page_alloc(env, pg, perm)) < 0)
+  8035d3:	83 ec 04             	sub    $0x4,%esp
+  8035d6:	ff 75 10             	push   0x10(%ebp)
+  8035d9:	56                   	push   %esi
+  8035da:	57                   	push   %edi
+  8035db:	e8 d3 d7 ff ff       	call   800db3 <sys_page_alloc>
+  8035e0:	89 c3                	mov    %eax,%ebx
+  8035e2:	83 c4 10             	add    $0x10,%esp
+  8035e5:	85 c0                	test   %eax,%eax
+  8035e7:	79 52                	jns    80363b <page_alloc+0x86>
+		if (r != -E_NO_MEM)
+  8035e9:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  8035ec:	75 52                	jne    803640 <page_alloc+0x8b>
+		if (page_out(env, pg) < 0)
+  8035ee:	83 ec 08             	sub    $0x8,%esp
+  8035f1:	56                   	push   %esi
+  8035f2:	57                   	push   %edi
+  8035f3:	e8 3d fd ff ff       	call   803335 <page_out>
+  8035f8:	83 c4 10             	add    $0x10,%esp
+  8035fb:	85 c0                	test   %eax,%eax
+  8035fd:	79 d4                	jns    8035d3 <page_alloc+0x1e>
+  8035ff:	eb 3f                	jmp    803640 <page_alloc+0x8b>
+		init_map_dir();
+  803601:	e8 2f fc ff ff       	call   803235 <init_map_dir>
+  803606:	eb c5                	jmp    8035cd <page_alloc+0x18>
+		mte = umapdir_walk(pg, 0);
+  803608:	83 ec 08             	sub    $0x8,%esp
+  80360b:	6a 00                	push   $0x0
+  80360d:	56                   	push   %esi
+  80360e:	e8 78 fc ff ff       	call   80328b <umapdir_walk>
+		if (mte && (*mte & PTE_P))
+  803613:	83 c4 10             	add    $0x10,%esp
+  803616:	85 c0                	test   %eax,%eax
+  803618:	74 b9                	je     8035d3 <page_alloc+0x1e>
+  80361a:	8b 10                	mov    (%eax),%edx
+  80361c:	f6 c2 01             	test   $0x1,%dl
+  80361f:	74 b2                	je     8035d3 <page_alloc+0x1e>
+			panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, pg);
+  803621:	83 ec 08             	sub    $0x8,%esp
+  803624:	56                   	push   %esi
+  803625:	52                   	push   %edx
+  803626:	50                   	push   %eax
+  803627:	68 24 56 80 00       	push   $0x805624
+  80362c:	68 34 03 00 00       	push   $0x334
+  803631:	68 15 53 80 00       	push   $0x805315
+  803636:	e8 c3 cb ff ff       	call   8001fe <_panic>
+	return 0;
+  80363b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803640:	89 d8                	mov    %ebx,%eax
+  803642:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803645:	5b                   	pop    %ebx
+  803646:	5e                   	pop    %esi
+  803647:	5f                   	pop    %edi
+  803648:	5d                   	pop    %ebp
+  803649:	c3                   	ret
+
+0080364a <page_adopt>:
+{
+  80364a:	55                   	push   %ebp
+  80364b:	89 e5                	mov    %esp,%ebp
+  80364d:	56                   	push   %esi
+  80364e:	53                   	push   %ebx
+  80364f:	89 c3                	mov    %eax,%ebx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  803651:	c1 e8 16             	shr    $0x16,%eax
+  803654:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80365b:	25 81 00 00 00       	and    $0x81,%eax
+  803660:	83 f8 01             	cmp    $0x1,%eax
+  803663:	75 53                	jne    8036b8 <page_adopt+0x6e>
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) != PTE_SWAPPED)
+  803665:	89 d8                	mov    %ebx,%eax
+  803667:	c1 e8 0c             	shr    $0xc,%eax
+  80366a:	8b 34 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%esi
+  803671:	89 f2                	mov    %esi,%edx
+  803673:	81 e2 81 00 00 00    	and    $0x81,%edx
+		return 0;
+  803679:	b8 00 00 00 00       	mov    $0x0,%eax
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) != PTE_P ||
+  80367e:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  803684:	75 37                	jne    8036bd <page_adopt+0x73>
+	if (!(mte = umapdir_walk(va, 1)))
+  803686:	83 ec 08             	sub    $0x8,%esp
+  803689:	6a 01                	push   $0x1
+  80368b:	53                   	push   %ebx
+  80368c:	e8 fa fb ff ff       	call   80328b <umapdir_walk>
+  803691:	83 c4 10             	add    $0x10,%esp
+  803694:	85 c0                	test   %eax,%eax
+  803696:	74 2c                	je     8036c4 <page_adopt+0x7a>
+	*mte = (PTE_SWAP_SLOT(pte) << MTEFLAGS) | (pte & PTE_SYSCALL) | MTE_P;
+  803698:	81 e6 06 fe ff ff    	and    $0xfffffe06,%esi
+  80369e:	83 ce 01             	or     $0x1,%esi
+  8036a1:	89 30                	mov    %esi,(%eax)
+	sys_page_unmap(0, va);
+  8036a3:	83 ec 08             	sub    $0x8,%esp
+  8036a6:	53                   	push   %ebx
+  8036a7:	6a 00                	push   $0x0
+  8036a9:	e8 8a d7 ff ff       	call   800e38 <sys_page_unmap>
+	return 1;
+  8036ae:	83 c4 10             	add    $0x10,%esp
+  8036b1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036b6:	eb 05                	jmp    8036bd <page_adopt+0x73>
+		return 0;
+  8036b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8036c0:	5b                   	pop    %ebx
+  8036c1:	5e                   	pop    %esi
+  8036c2:	5d                   	pop    %ebp
+  8036c3:	c3                   	ret
+		return -E_NO_MEM;
+  8036c4:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8036c9:	eb f2                	jmp    8036bd <page_adopt+0x73>
+
+008036cb <page_forget>:
+{
+  8036cb:	55                   	push   %ebp
+  8036cc:	89 e5                	mov    %esp,%ebp
+  8036ce:	53                   	push   %ebx
+  8036cf:	83 ec 04             	sub    $0x4,%esp
+  8036d2:	89 c3                	mov    %eax,%ebx
+	find_paging_env();
+  8036d4:	e8 4a ef ff ff       	call   802623 <find_paging_env>
+	if (pagingenv == 0)
+  8036d9:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8036e0:	74 39                	je     80371b <page_forget+0x50>
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  8036e2:	89 d8                	mov    %ebx,%eax
+  8036e4:	c1 e8 16             	shr    $0x16,%eax
+  8036e7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8036ee:	25 81 00 00 00       	and    $0x81,%eax
+  8036f3:	83 f8 01             	cmp    $0x1,%eax
+  8036f6:	74 28                	je     803720 <page_forget+0x55>
+	if (!umapdir || !(mte = umapdir_walk(va, 0)) || !(*mte & MTE_P))
+  8036f8:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  8036ff:	74 1a                	je     80371b <page_forget+0x50>
+  803701:	83 ec 08             	sub    $0x8,%esp
+  803704:	6a 00                	push   $0x0
+  803706:	53                   	push   %ebx
+  803707:	e8 7f fb ff ff       	call   80328b <umapdir_walk>
+  80370c:	89 c3                	mov    %eax,%ebx
+  80370e:	83 c4 10             	add    $0x10,%esp
+  803711:	85 c0                	test   %eax,%eax
+  803713:	74 06                	je     80371b <page_forget+0x50>
+  803715:	8b 00                	mov    (%eax),%eax
+  803717:	a8 01                	test   $0x1,%al
+  803719:	75 2b                	jne    803746 <page_forget+0x7b>
+}
+  80371b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80371e:	c9                   	leave
+  80371f:	c3                   	ret
+	    ((pte = uvpt[PGNUM(va)]) & (PTE_P|PTE_SWAPPED)) == PTE_SWAPPED) {
+  803720:	89 d8                	mov    %ebx,%eax
+  803722:	c1 e8 0c             	shr    $0xc,%eax
+  803725:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80372c:	89 c2                	mov    %eax,%edx
+  80372e:	81 e2 81 00 00 00    	and    $0x81,%edx
+	if ((uvpd[PDX(va)] & (PTE_P|PTE_PS)) == PTE_P &&
+  803734:	81 fa 80 00 00 00    	cmp    $0x80,%edx
+  80373a:	75 bc                	jne    8036f8 <page_forget+0x2d>
+		page_remove_slot(PTE_SWAP_SLOT(pte));
+  80373c:	c1 e8 0c             	shr    $0xc,%eax
+  80373f:	e8 5c ee ff ff       	call   8025a0 <page_remove_slot>
+		return;
+  803744:	eb d5                	jmp    80371b <page_forget+0x50>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803746:	c1 e8 0c             	shr    $0xc,%eax
+  803749:	e8 52 ee ff ff       	call   8025a0 <page_remove_slot>
+	*mte = 0;
+  80374e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  803754:	eb c5                	jmp    80371b <page_forget+0x50>
+
+00803756 <page_unmap>:
+{
+  803756:	55                   	push   %ebp
+  803757:	89 e5                	mov    %esp,%ebp
+  803759:	57                   	push   %edi
+  80375a:	56                   	push   %esi
+  80375b:	53                   	push   %ebx
+  80375c:	83 ec 0c             	sub    $0xc,%esp
+  80375f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803762:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (envid == thisenv->env_id || envid <= 0) {
+  803765:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80376a:	8b 40 48             	mov    0x48(%eax),%eax
+  80376d:	85 db                	test   %ebx,%ebx
+  80376f:	0f 8e b4 00 00 00    	jle    803829 <page_unmap+0xd3>
+  803775:	39 d8                	cmp    %ebx,%eax
+  803777:	0f 84 ac 00 00 00    	je     803829 <page_unmap+0xd3>
+	r = sys_page_unmap(envid, va);
+  80377d:	83 ec 08             	sub    $0x8,%esp
+  803780:	57                   	push   %edi
+  803781:	53                   	push   %ebx
+  803782:	e8 b1 d6 ff ff       	call   800e38 <sys_page_unmap>
+  803787:	89 c6                	mov    %eax,%esi
+	find_paging_env();
+  803789:	e8 95 ee ff ff       	call   802623 <find_paging_env>
+	if (pagingenv == 0)
+  80378e:	83 c4 10             	add    $0x10,%esp
+  803791:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  803798:	0f 84 a1 00 00 00    	je     80383f <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  80379e:	83 ec 0c             	sub    $0xc,%esp
+  8037a1:	6a 05                	push   $0x5
+  8037a3:	68 00 00 40 00       	push   $0x400000
+  8037a8:	6a 00                	push   $0x0
+  8037aa:	68 00 b0 ad de       	push   $0xdeadb000
+  8037af:	53                   	push   %ebx
+  8037b0:	e8 41 d6 ff ff       	call   800df6 <sys_page_map>
+  8037b5:	83 c4 20             	add    $0x20,%esp
+  8037b8:	85 c0                	test   %eax,%eax
+  8037ba:	0f 88 89 00 00 00    	js     803849 <page_unmap+0xf3>
+	mde = (mde_t*)UTEMP + MDX(va);
+  8037c0:	89 f8                	mov    %edi,%eax
+  8037c2:	c1 e8 16             	shr    $0x16,%eax
+	if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  8037c5:	8b 04 85 00 00 40 00 	mov    0x400000(,%eax,4),%eax
+  8037cc:	a8 01                	test   $0x1,%al
+  8037ce:	74 6f                	je     80383f <page_unmap+0xe9>
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037d0:	83 ec 0c             	sub    $0xc,%esp
+  8037d3:	6a 05                	push   $0x5
+  8037d5:	68 00 00 40 00       	push   $0x400000
+  8037da:	6a 00                	push   $0x0
+	mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  8037dc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+	if ((r2 = sys_page_map(envid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  8037e1:	50                   	push   %eax
+  8037e2:	53                   	push   %ebx
+  8037e3:	e8 0e d6 ff ff       	call   800df6 <sys_page_map>
+  8037e8:	83 c4 20             	add    $0x20,%esp
+  8037eb:	85 c0                	test   %eax,%eax
+  8037ed:	78 6f                	js     80385e <page_unmap+0x108>
+	mte = (mte_t*)UTEMP + MTX(va);
+  8037ef:	c1 ef 0c             	shr    $0xc,%edi
+  8037f2:	81 e7 ff 03 00 00    	and    $0x3ff,%edi
+	if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  8037f8:	f6 04 bd 00 00 40 00 	testb  $0x1,0x400000(,%edi,4)
+  8037ff:	01 
+  803800:	74 3d                	je     80383f <page_unmap+0xe9>
+	if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803802:	83 ec 08             	sub    $0x8,%esp
+  803805:	68 00 00 40 00       	push   $0x400000
+  80380a:	6a 00                	push   $0x0
+  80380c:	e8 27 d6 ff ff       	call   800e38 <sys_page_unmap>
+  803811:	83 c4 10             	add    $0x10,%esp
+  803814:	85 c0                	test   %eax,%eax
+  803816:	78 5b                	js     803873 <page_unmap+0x11d>
+	page_remove_slot(*mte >> MTEFLAGS);
+  803818:	8b 04 bd 00 00 40 00 	mov    0x400000(,%edi,4),%eax
+  80381f:	c1 e8 0c             	shr    $0xc,%eax
+  803822:	e8 79 ed ff ff       	call   8025a0 <page_remove_slot>
+	return r;
+  803827:	eb 16                	jmp    80383f <page_unmap+0xe9>
+		page_forget(va);
+  803829:	89 f8                	mov    %edi,%eax
+  80382b:	e8 9b fe ff ff       	call   8036cb <page_forget>
+		return sys_page_unmap(envid, va);
+  803830:	83 ec 08             	sub    $0x8,%esp
+  803833:	57                   	push   %edi
+  803834:	53                   	push   %ebx
+  803835:	e8 fe d5 ff ff       	call   800e38 <sys_page_unmap>
+  80383a:	89 c6                	mov    %eax,%esi
+  80383c:	83 c4 10             	add    $0x10,%esp
+}
+  80383f:	89 f0                	mov    %esi,%eax
+  803841:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803844:	5b                   	pop    %ebx
+  803845:	5e                   	pop    %esi
+  803846:	5f                   	pop    %edi
+  803847:	5d                   	pop    %ebp
+  803848:	c3                   	ret
+		panic("page_unmap: Unable to map UMAPDIR -- %e\n", r2);
+  803849:	50                   	push   %eax
+  80384a:	68 60 56 80 00       	push   $0x805660
+  80384f:	68 e4 03 00 00       	push   $0x3e4
+  803854:	68 15 53 80 00       	push   $0x805315
+  803859:	e8 a0 c9 ff ff       	call   8001fe <_panic>
+		panic("page_unmap: Unable to map map table -- %e\n", r2);
+  80385e:	50                   	push   %eax
+  80385f:	68 8c 56 80 00       	push   $0x80568c
+  803864:	68 ea 03 00 00       	push   $0x3ea
+  803869:	68 15 53 80 00       	push   $0x805315
+  80386e:	e8 8b c9 ff ff       	call   8001fe <_panic>
+		panic("page_unmap: Unable to unmap UTEMP -- %e\n", r2);
+  803873:	50                   	push   %eax
+  803874:	68 b8 56 80 00       	push   $0x8056b8
+  803879:	68 ef 03 00 00       	push   $0x3ef
+  80387e:	68 15 53 80 00       	push   $0x805315
+  803883:	e8 76 c9 ff ff       	call   8001fe <_panic>
+
+00803888 <page_unmap_range>:
+{
+  803888:	55                   	push   %ebp
+  803889:	89 e5                	mov    %esp,%ebp
+  80388b:	57                   	push   %edi
+  80388c:	56                   	push   %esi
+  80388d:	53                   	push   %ebx
+  80388e:	83 ec 0c             	sub    $0xc,%esp
+  803891:	8b 7d 10             	mov    0x10(%ebp),%edi
+	find_paging_env();
+  803894:	e8 8a ed ff ff       	call   802623 <find_paging_env>
+	if (envid == thisenv->env_id || envid <= 0 || pagingenv == 0) {
+  803899:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80389e:	8b 40 48             	mov    0x48(%eax),%eax
+  8038a1:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8038a5:	7e 38                	jle    8038df <page_unmap_range+0x57>
+  8038a7:	3b 45 08             	cmp    0x8(%ebp),%eax
+  8038aa:	74 33                	je     8038df <page_unmap_range+0x57>
+  8038ac:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8038b3:	74 2a                	je     8038df <page_unmap_range+0x57>
+  8038b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	for (i = 0; i < npages; i++)
+  8038b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8038bd:	39 fe                	cmp    %edi,%esi
+  8038bf:	74 56                	je     803917 <page_unmap_range+0x8f>
+		if ((r = page_unmap(envid, va + i*PGSIZE)) < 0)
+  8038c1:	83 ec 08             	sub    $0x8,%esp
+  8038c4:	53                   	push   %ebx
+  8038c5:	ff 75 08             	push   0x8(%ebp)
+  8038c8:	e8 89 fe ff ff       	call   803756 <page_unmap>
+  8038cd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8038d3:	83 c4 10             	add    $0x10,%esp
+  8038d6:	85 c0                	test   %eax,%eax
+  8038d8:	78 35                	js     80390f <page_unmap_range+0x87>
+	for (i = 0; i < npages; i++)
+  8038da:	83 c6 01             	add    $0x1,%esi
+  8038dd:	eb de                	jmp    8038bd <page_unmap_range+0x35>
+  8038df:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+  8038e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038e7:	eb 10                	jmp    8038f9 <page_unmap_range+0x71>
+			page_forget(va + i*PGSIZE);
+  8038e9:	89 f0                	mov    %esi,%eax
+  8038eb:	e8 db fd ff ff       	call   8036cb <page_forget>
+		for (i = 0; i < npages; i++)
+  8038f0:	83 c3 01             	add    $0x1,%ebx
+  8038f3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8038f9:	39 fb                	cmp    %edi,%ebx
+  8038fb:	75 ec                	jne    8038e9 <page_unmap_range+0x61>
+		return sys_page_unmap_range(envid, va, npages);
+  8038fd:	83 ec 04             	sub    $0x4,%esp
+  803900:	57                   	push   %edi
+  803901:	ff 75 0c             	push   0xc(%ebp)
+  803904:	ff 75 08             	push   0x8(%ebp)
+  803907:	e8 40 d6 ff ff       	call   800f4c <sys_page_unmap_range>
+  80390c:	83 c4 10             	add    $0x10,%esp
+}
+  80390f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803912:	5b                   	pop    %ebx
+  803913:	5e                   	pop    %esi
+  803914:	5f                   	pop    %edi
+  803915:	5d                   	pop    %ebp
+  803916:	c3                   	ret
+	return 0;
+  803917:	b8 00 00 00 00       	mov    $0x0,%eax
+  80391c:	eb f1                	jmp    80390f <page_unmap_range+0x87>
+
+0080391e <page_alloc_range>:
+{
+  80391e:	55                   	push   %ebp
+  80391f:	89 e5                	mov    %esp,%ebp
+  803921:	57                   	push   %edi
+  803922:	56                   	push   %esi
+  803923:	53                   	push   %ebx
+  803924:	83 ec 1c             	sub    $0x1c,%esp
+  803927:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80392a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	if(!umapdir)
+  80392d:	83 3d 14 e9 80 00 00 	cmpl   $0x0,0x80e914
+  803934:	74 14                	je     80394a <page_alloc_range+0x2c>
+	if (check_mte)
+  803936:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+  80393a:	74 66                	je     8039a2 <page_alloc_range+0x84>
+  80393c:	89 fe                	mov    %edi,%esi
+		for (i = 0; i < npages; i++)
+  80393e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803943:	89 7d 0c             	mov    %edi,0xc(%ebp)
+  803946:	89 c7                	mov    %eax,%edi
+  803948:	eb 10                	jmp    80395a <page_alloc_range+0x3c>
+		init_map_dir();
+  80394a:	e8 e6 f8 ff ff       	call   803235 <init_map_dir>
+  80394f:	eb e5                	jmp    803936 <page_alloc_range+0x18>
+		for (i = 0; i < npages; i++)
+  803951:	83 c7 01             	add    $0x1,%edi
+  803954:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80395a:	39 df                	cmp    %ebx,%edi
+  80395c:	74 38                	je     803996 <page_alloc_range+0x78>
+			mte = umapdir_walk(va + i*PGSIZE, 0);
+  80395e:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803961:	83 ec 08             	sub    $0x8,%esp
+  803964:	6a 00                	push   $0x0
+  803966:	56                   	push   %esi
+  803967:	e8 1f f9 ff ff       	call   80328b <umapdir_walk>
+			if (mte && (*mte & PTE_P))
+  80396c:	83 c4 10             	add    $0x10,%esp
+  80396f:	85 c0                	test   %eax,%eax
+  803971:	74 de                	je     803951 <page_alloc_range+0x33>
+  803973:	8b 10                	mov    (%eax),%edx
+  803975:	f6 c2 01             	test   $0x1,%dl
+  803978:	74 d7                	je     803951 <page_alloc_range+0x33>
+				panic("Unhandled case -- mapping to a paged out page: %p = %x\n%p\n", mte, *mte, va + i*PGSIZE);
+  80397a:	83 ec 08             	sub    $0x8,%esp
+  80397d:	ff 75 e4             	push   -0x1c(%ebp)
+  803980:	52                   	push   %edx
+  803981:	50                   	push   %eax
+  803982:	68 24 56 80 00       	push   $0x805624
+  803987:	68 0b 04 00 00       	push   $0x40b
+  80398c:	68 15 53 80 00       	push   $0x805315
+  803991:	e8 68 c8 ff ff       	call   8001fe <_panic>
+  803996:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803999:	eb 07                	jmp    8039a2 <page_alloc_range+0x84>
+			va += r*PGSIZE;
+  80399b:	c1 e0 0c             	shl    $0xc,%eax
+  80399e:	01 c7                	add    %eax,%edi
+			npages -= r;
+  8039a0:	29 f3                	sub    %esi,%ebx
+	while (npages > 0)
+  8039a2:	85 db                	test   %ebx,%ebx
+  8039a4:	74 30                	je     8039d6 <page_alloc_range+0xb8>
+		if ((r = sys_page_alloc_range(env, va, npages, perm)) > 0)
+  8039a6:	ff 75 14             	push   0x14(%ebp)
+  8039a9:	53                   	push   %ebx
+  8039aa:	57                   	push   %edi
+  8039ab:	ff 75 08             	push   0x8(%ebp)
+  8039ae:	e8 2b d5 ff ff       	call   800ede <sys_page_alloc_range>
+  8039b3:	89 c6                	mov    %eax,%esi
+  8039b5:	83 c4 10             	add    $0x10,%esp
+  8039b8:	85 c0                	test   %eax,%eax
+  8039ba:	7f df                	jg     80399b <page_alloc_range+0x7d>
+		if (r != -E_NO_MEM)
+  8039bc:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8039bf:	75 1a                	jne    8039db <page_alloc_range+0xbd>
+		if (page_out(env, va) < 0)
+  8039c1:	83 ec 08             	sub    $0x8,%esp
+  8039c4:	57                   	push   %edi
+  8039c5:	ff 75 08             	push   0x8(%ebp)
+  8039c8:	e8 68 f9 ff ff       	call   803335 <page_out>
+  8039cd:	83 c4 10             	add    $0x10,%esp
+  8039d0:	85 c0                	test   %eax,%eax
+  8039d2:	79 ce                	jns    8039a2 <page_alloc_range+0x84>
+  8039d4:	eb 05                	jmp    8039db <page_alloc_range+0xbd>
+	return 0;
+  8039d6:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  8039db:	89 f0                	mov    %esi,%eax
+  8039dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039e0:	5b                   	pop    %ebx
+  8039e1:	5e                   	pop    %esi
+  8039e2:	5f                   	pop    %edi
+  8039e3:	5d                   	pop    %ebp
+  8039e4:	c3                   	ret
+
+008039e5 <page_in>:
+{
+  8039e5:	55                   	push   %ebp
+  8039e6:	89 e5                	mov    %esp,%ebp
+  8039e8:	57                   	push   %edi
+  8039e9:	56                   	push   %esi
+  8039ea:	53                   	push   %ebx
+  8039eb:	83 ec 3c             	sub    $0x3c,%esp
+  8039ee:	8b 75 0c             	mov    0xc(%ebp),%esi
+	find_paging_env();
+  8039f1:	e8 2d ec ff ff       	call   802623 <find_paging_env>
+	if (pagingenv == 0)
+  8039f6:	83 3d 40 b0 80 00 00 	cmpl   $0x0,0x80b040
+  8039fd:	0f 84 09 02 00 00    	je     803c0c <page_in+0x227>
+	mte = umapdir_walk(addr, 0);
+  803a03:	83 ec 08             	sub    $0x8,%esp
+  803a06:	6a 00                	push   $0x0
+  803a08:	56                   	push   %esi
+  803a09:	e8 7d f8 ff ff       	call   80328b <umapdir_walk>
+  803a0e:	89 c3                	mov    %eax,%ebx
+	addr = ROUNDDOWN(addr, PGSIZE);
+  803a10:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  803a16:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+	if ((env == 0 || env == thisenv->env_id) && (*mte & PTE_W)
+  803a19:	83 c4 10             	add    $0x10,%esp
+  803a1c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  803a20:	74 0d                	je     803a2f <page_in+0x4a>
+  803a22:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803a27:	8b 40 48             	mov    0x48(%eax),%eax
+  803a2a:	3b 45 08             	cmp    0x8(%ebp),%eax
+  803a2d:	75 06                	jne    803a35 <page_in+0x50>
+  803a2f:	8b 03                	mov    (%ebx),%eax
+  803a31:	a8 02                	test   $0x2,%al
+  803a33:	75 63                	jne    803a98 <page_in+0xb3>
+	int map_index = *mte >> MTEFLAGS;
+  803a35:	8b 33                	mov    (%ebx),%esi
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a37:	6a 00                	push   $0x0
+	int perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a39:	89 f0                	mov    %esi,%eax
+  803a3b:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a40:	83 c8 01             	or     $0x1,%eax
+	if ((r = page_alloc(env, addr, perm, 0)) < 0)
+  803a43:	50                   	push   %eax
+  803a44:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803a47:	57                   	push   %edi
+  803a48:	ff 75 08             	push   0x8(%ebp)
+  803a4b:	e8 65 fb ff ff       	call   8035b5 <page_alloc>
+  803a50:	83 c4 10             	add    $0x10,%esp
+  803a53:	85 c0                	test   %eax,%eax
+  803a55:	78 39                	js     803a90 <page_in+0xab>
+	int map_index = *mte >> MTEFLAGS;
+  803a57:	89 f0                	mov    %esi,%eax
+  803a59:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a5c:	83 ec 0c             	sub    $0xc,%esp
+  803a5f:	6a 07                	push   $0x7
+  803a61:	6a 01                	push   $0x1
+  803a63:	57                   	push   %edi
+  803a64:	c1 e0 04             	shl    $0x4,%eax
+  803a67:	50                   	push   %eax
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803a68:	c1 ee 1c             	shr    $0x1c,%esi
+  803a6b:	83 e6 01             	and    $0x1,%esi
+	if ((r = ipc_call(slot_paging_env(map_index), ipc_val, addr, 1, PTE_U|PTE_W|PTE_P)) < 0)
+  803a6e:	ff 34 b5 44 b0 80 00 	push   0x80b044(,%esi,4)
+  803a75:	e8 f1 0f 00 00       	call   804a6b <ipc_call>
+  803a7a:	83 c4 20             	add    $0x20,%esp
+  803a7d:	85 c0                	test   %eax,%eax
+  803a7f:	0f 88 72 01 00 00    	js     803bf7 <page_in+0x212>
+	*mte = 0;
+  803a85:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return 0;
+  803a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a93:	5b                   	pop    %ebx
+  803a94:	5e                   	pop    %esi
+  803a95:	5f                   	pop    %edi
+  803a96:	5d                   	pop    %ebp
+  803a97:	c3                   	ret
+	perm = (*mte & PTE_SYSCALL) | PTE_P;
+  803a98:	25 06 0e 00 00       	and    $0xe06,%eax
+  803a9d:	83 c8 01             	or     $0x1,%eax
+  803aa0:	89 45 c0             	mov    %eax,-0x40(%ebp)
+	mtes[0] = mte;
+  803aa3:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803aa6:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  803aa9:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  803aaf:	be 01 00 00 00       	mov    $0x1,%esi
+  803ab4:	eb 46                	jmp    803afc <page_in+0x117>
+		if (!(mtes[n] = umapdir_walk(va, 0)) || !(*mtes[n] & PTE_P)
+  803ab6:	83 ec 08             	sub    $0x8,%esp
+  803ab9:	6a 00                	push   $0x0
+  803abb:	51                   	push   %ecx
+  803abc:	e8 ca f7 ff ff       	call   80328b <umapdir_walk>
+  803ac1:	89 44 b5 c8          	mov    %eax,-0x38(%ebp,%esi,4)
+  803ac5:	83 c4 10             	add    $0x10,%esp
+  803ac8:	85 c0                	test   %eax,%eax
+  803aca:	74 66                	je     803b32 <page_in+0x14d>
+  803acc:	8b 00                	mov    (%eax),%eax
+  803ace:	a8 01                	test   $0x1,%al
+  803ad0:	74 60                	je     803b32 <page_in+0x14d>
+		    || ((*mtes[n] & PTE_SYSCALL) | PTE_P) != perm
+  803ad2:	89 c2                	mov    %eax,%edx
+  803ad4:	81 e2 06 0e 00 00    	and    $0xe06,%edx
+  803ada:	83 ca 01             	or     $0x1,%edx
+  803add:	39 55 c0             	cmp    %edx,-0x40(%ebp)
+  803ae0:	75 50                	jne    803b32 <page_in+0x14d>
+		    || PAGESERV_OF(MTE_VAL(*mtes[n])) != PAGESERV_OF(MTE_VAL(*mte)))
+  803ae2:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803ae8:	c1 e8 1c             	shr    $0x1c,%eax
+  803aeb:	8b 13                	mov    (%ebx),%edx
+  803aed:	c1 ea 1c             	shr    $0x1c,%edx
+  803af0:	39 d0                	cmp    %edx,%eax
+  803af2:	75 3e                	jne    803b32 <page_in+0x14d>
+	for (n = 1; n < PAGEREQ_PAGE_IN_MAXPAGES; n++) {
+  803af4:	83 c6 01             	add    $0x1,%esi
+  803af7:	83 fe 08             	cmp    $0x8,%esi
+  803afa:	74 3f                	je     803b3b <page_in+0x156>
+		void *va = addr + n*PGSIZE;
+  803afc:	89 f9                	mov    %edi,%ecx
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803afe:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+  803b04:	77 2c                	ja     803b32 <page_in+0x14d>
+  803b06:	89 f8                	mov    %edi,%eax
+  803b08:	c1 e8 16             	shr    $0x16,%eax
+  803b0b:	8b 14 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%edx
+  803b12:	f6 c2 01             	test   $0x1,%dl
+  803b15:	74 9f                	je     803ab6 <page_in+0xd1>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b17:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+		if ((uintptr_t) va >= UTOP || ((uvpd[PDX(va)] & PTE_P) &&
+  803b1e:	a8 80                	test   $0x80,%al
+  803b20:	75 10                	jne    803b32 <page_in+0x14d>
+		    ((uvpd[PDX(va)] & PTE_PS) || (uvpt[PGNUM(va)] & PTE_P))))
+  803b22:	89 f8                	mov    %edi,%eax
+  803b24:	c1 e8 0c             	shr    $0xc,%eax
+  803b27:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b2e:	a8 01                	test   $0x1,%al
+  803b30:	74 84                	je     803ab6 <page_in+0xd1>
+	if (n == 1)
+  803b32:	83 fe 01             	cmp    $0x1,%esi
+  803b35:	0f 84 fa fe ff ff    	je     803a35 <page_in+0x50>
+	req.nslots = n;
+  803b3b:	89 35 00 80 80 00    	mov    %esi,0x808000
+	for (i = 0; i < n; i++)
+  803b41:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b46:	eb 13                	jmp    803b5b <page_in+0x176>
+		req.slots[i] = *mtes[i] >> MTEFLAGS;
+  803b48:	8b 54 85 c8          	mov    -0x38(%ebp,%eax,4),%edx
+  803b4c:	8b 12                	mov    (%edx),%edx
+  803b4e:	c1 ea 0c             	shr    $0xc,%edx
+  803b51:	89 14 85 04 80 80 00 	mov    %edx,0x808004(,%eax,4)
+	for (i = 0; i < n; i++)
+  803b58:	83 c0 01             	add    $0x1,%eax
+  803b5b:	39 c6                	cmp    %eax,%esi
+  803b5d:	75 e9                	jne    803b48 <page_in+0x163>
+	if ((r = page_alloc_range(0, addr, n, perm, 0)) < 0)
+  803b5f:	83 ec 0c             	sub    $0xc,%esp
+  803b62:	6a 00                	push   $0x0
+  803b64:	ff 75 c0             	push   -0x40(%ebp)
+  803b67:	56                   	push   %esi
+  803b68:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  803b6b:	57                   	push   %edi
+  803b6c:	6a 00                	push   $0x0
+  803b6e:	e8 ab fd ff ff       	call   80391e <page_alloc_range>
+  803b73:	83 c4 20             	add    $0x20,%esp
+  803b76:	85 c0                	test   %eax,%eax
+  803b78:	78 6e                	js     803be8 <page_in+0x203>
+	memmove(addr, &req, sizeof(req));
+  803b7a:	83 ec 04             	sub    $0x4,%esp
+  803b7d:	6a 24                	push   $0x24
+  803b7f:	68 00 80 80 00       	push   $0x808000
+  803b84:	57                   	push   %edi
+  803b85:	e8 bc ce ff ff       	call   800a46 <memmove>
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803b8a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  803b91:	56                   	push   %esi
+  803b92:	57                   	push   %edi
+  803b93:	6a 05                	push   $0x5
+	return pagingenvs[PAGESERV_OF(slot) % NPAGESERV];
+  803b95:	0f b7 05 06 80 80 00 	movzwl 0x808006,%eax
+  803b9c:	83 e0 01             	and    $0x1,%eax
+	if ((r = ipc_call(slot_paging_env(req.slots[0]), PAGEREQ_PAGE_IN_RANGE, addr, n, PTE_U|PTE_W|PTE_P)) < 0)
+  803b9f:	ff 34 85 44 b0 80 00 	push   0x80b044(,%eax,4)
+  803ba6:	e8 c0 0e 00 00       	call   804a6b <ipc_call>
+  803bab:	83 c4 20             	add    $0x20,%esp
+  803bae:	85 c0                	test   %eax,%eax
+  803bb0:	78 08                	js     803bba <page_in+0x1d5>
+  803bb2:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  803bb5:	8d 0c b0             	lea    (%eax,%esi,4),%ecx
+  803bb8:	eb 20                	jmp    803bda <page_in+0x1f5>
+		panic("page_in_range: failed to recv from paging server -- %e\n", r);
+  803bba:	50                   	push   %eax
+  803bbb:	68 e4 56 80 00       	push   $0x8056e4
+  803bc0:	68 59 02 00 00       	push   $0x259
+  803bc5:	68 15 53 80 00       	push   $0x805315
+  803bca:	e8 2f c6 ff ff       	call   8001fe <_panic>
+		*mtes[i] = 0;
+  803bcf:	8b 10                	mov    (%eax),%edx
+  803bd1:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < n; i++)
+  803bd7:	83 c0 04             	add    $0x4,%eax
+  803bda:	39 c8                	cmp    %ecx,%eax
+  803bdc:	75 f1                	jne    803bcf <page_in+0x1ea>
+	return n;
+  803bde:	89 f0                	mov    %esi,%eax
+	    && (r = page_in_range(addr, mte)) != 0)
+  803be0:	85 f6                	test   %esi,%esi
+  803be2:	0f 84 4d fe ff ff    	je     803a35 <page_in+0x50>
+		return r < 0 ? r : 0;
+  803be8:	85 c0                	test   %eax,%eax
+  803bea:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bef:	0f 4f c2             	cmovg  %edx,%eax
+  803bf2:	e9 99 fe ff ff       	jmp    803a90 <page_in+0xab>
+		panic("page_in: failed to recv from paging server -- %e\n", r);
+  803bf7:	50                   	push   %eax
+  803bf8:	68 1c 57 80 00       	push   $0x80571c
+  803bfd:	68 9a 02 00 00       	push   $0x29a
+  803c02:	68 15 53 80 00       	push   $0x805315
+  803c07:	e8 f2 c5 ff ff       	call   8001fe <_panic>
+		return -E_PAGING;
+  803c0c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803c11:	e9 7a fe ff ff       	jmp    803a90 <page_in+0xab>
+
+00803c16 <page_map>:
+{
+  803c16:	55                   	push   %ebp
+  803c17:	89 e5                	mov    %esp,%ebp
+  803c19:	57                   	push   %edi
+  803c1a:	56                   	push   %esi
+  803c1b:	53                   	push   %ebx
+  803c1c:	83 ec 1c             	sub    $0x1c,%esp
+  803c1f:	8b 75 08             	mov    0x8(%ebp),%esi
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803c22:	83 ec 0c             	sub    $0xc,%esp
+  803c25:	ff 75 18             	push   0x18(%ebp)
+  803c28:	ff 75 14             	push   0x14(%ebp)
+  803c2b:	ff 75 10             	push   0x10(%ebp)
+  803c2e:	ff 75 0c             	push   0xc(%ebp)
+  803c31:	56                   	push   %esi
+  803c32:	e8 bf d1 ff ff       	call   800df6 <sys_page_map>
+  803c37:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c3a:	83 c4 20             	add    $0x20,%esp
+  803c3d:	85 c0                	test   %eax,%eax
+  803c3f:	0f 89 a9 01 00 00    	jns    803dee <page_map+0x1d8>
+		if (r == -E_NO_MEM)
+  803c45:	83 7d e4 fc          	cmpl   $0xfffffffc,-0x1c(%ebp)
+  803c49:	74 5f                	je     803caa <page_map+0x94>
+		if (r != -E_INVAL)
+  803c4b:	83 7d e4 fd          	cmpl   $0xfffffffd,-0x1c(%ebp)
+  803c4f:	0f 85 a0 01 00 00    	jne    803df5 <page_map+0x1df>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803c55:	85 f6                	test   %esi,%esi
+  803c57:	74 70                	je     803cc9 <page_map+0xb3>
+  803c59:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803c5e:	8b 40 48             	mov    0x48(%eax),%eax
+  803c61:	39 f0                	cmp    %esi,%eax
+  803c63:	74 64                	je     803cc9 <page_map+0xb3>
+		while ((r2 = sys_page_map(srcenvid, (void*)UMAPDIR, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803c65:	83 ec 0c             	sub    $0xc,%esp
+  803c68:	6a 05                	push   $0x5
+  803c6a:	68 00 00 40 00       	push   $0x400000
+  803c6f:	6a 00                	push   $0x0
+  803c71:	68 00 b0 ad de       	push   $0xdeadb000
+  803c76:	56                   	push   %esi
+  803c77:	e8 7a d1 ff ff       	call   800df6 <sys_page_map>
+  803c7c:	89 c3                	mov    %eax,%ebx
+  803c7e:	83 c4 20             	add    $0x20,%esp
+  803c81:	85 c0                	test   %eax,%eax
+  803c83:	79 6a                	jns    803cef <page_map+0xd9>
+			if (r2 != -E_NO_MEM)
+  803c85:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803c88:	75 50                	jne    803cda <page_map+0xc4>
+			if (page_out(-E_NO_MEM, (void*)UTEMP) < 0)
+  803c8a:	83 ec 08             	sub    $0x8,%esp
+  803c8d:	68 00 00 40 00       	push   $0x400000
+  803c92:	6a fc                	push   $0xfffffffc
+  803c94:	e8 9c f6 ff ff       	call   803335 <page_out>
+  803c99:	83 c4 10             	add    $0x10,%esp
+  803c9c:	85 c0                	test   %eax,%eax
+  803c9e:	79 c5                	jns    803c65 <page_map+0x4f>
+}
+  803ca0:	89 d8                	mov    %ebx,%eax
+  803ca2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ca5:	5b                   	pop    %ebx
+  803ca6:	5e                   	pop    %esi
+  803ca7:	5f                   	pop    %edi
+  803ca8:	5d                   	pop    %ebp
+  803ca9:	c3                   	ret
+			if (page_out(0, (void*)UTEMP) < 0)
+  803caa:	83 ec 08             	sub    $0x8,%esp
+  803cad:	68 00 00 40 00       	push   $0x400000
+  803cb2:	6a 00                	push   $0x0
+  803cb4:	e8 7c f6 ff ff       	call   803335 <page_out>
+  803cb9:	83 c4 10             	add    $0x10,%esp
+  803cbc:	85 c0                	test   %eax,%eax
+  803cbe:	0f 89 5e ff ff ff    	jns    803c22 <page_map+0xc>
+				return r;
+  803cc4:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cc7:	eb d7                	jmp    803ca0 <page_map+0x8a>
+		if ((srcenvid == 0 || srcenvid == thisenv->env_id) && page_adopt(srcva) < 0)
+  803cc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ccc:	e8 79 f9 ff ff       	call   80364a <page_adopt>
+  803cd1:	85 c0                	test   %eax,%eax
+  803cd3:	79 90                	jns    803c65 <page_map+0x4f>
+			return r;
+  803cd5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803cd8:	eb c6                	jmp    803ca0 <page_map+0x8a>
+				panic("page_map: Unable to map UMAPDIR -- %e\n", r2);
+  803cda:	53                   	push   %ebx
+  803cdb:	68 50 57 80 00       	push   $0x805750
+  803ce0:	68 77 03 00 00       	push   $0x377
+  803ce5:	68 15 53 80 00       	push   $0x805315
+  803cea:	e8 0f c5 ff ff       	call   8001fe <_panic>
+		mde = (mde_t*)UTEMP + MDX(srcva);
+  803cef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803cf2:	c1 e8 16             	shr    $0x16,%eax
+		if (!(*mde & MTE_P)) // Mapping table doesn't exist
+  803cf5:	8b 3c 85 00 00 40 00 	mov    0x400000(,%eax,4),%edi
+  803cfc:	f7 c7 01 00 00 00    	test   $0x1,%edi
+  803d02:	0f 84 f5 00 00 00    	je     803dfd <page_map+0x1e7>
+		mte = (mte_t*)(PGNUM(*mde) << MTXSHIFT);
+  803d08:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+		while ((r2 = sys_page_map(srcenvid, (void*)mte, 0, (void*)UTEMP, PTE_P|PTE_U)) < 0)
+  803d0e:	83 ec 0c             	sub    $0xc,%esp
+  803d11:	6a 05                	push   $0x5
+  803d13:	68 00 00 40 00       	push   $0x400000
+  803d18:	6a 00                	push   $0x0
+  803d1a:	57                   	push   %edi
+  803d1b:	56                   	push   %esi
+  803d1c:	e8 d5 d0 ff ff       	call   800df6 <sys_page_map>
+  803d21:	89 c3                	mov    %eax,%ebx
+  803d23:	83 c4 20             	add    $0x20,%esp
+  803d26:	85 c0                	test   %eax,%eax
+  803d28:	79 35                	jns    803d5f <page_map+0x149>
+			if (r2 != -E_NO_MEM)
+  803d2a:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803d2d:	75 1b                	jne    803d4a <page_map+0x134>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803d2f:	83 ec 08             	sub    $0x8,%esp
+  803d32:	68 00 00 40 00       	push   $0x400000
+  803d37:	6a 00                	push   $0x0
+  803d39:	e8 f7 f5 ff ff       	call   803335 <page_out>
+  803d3e:	83 c4 10             	add    $0x10,%esp
+  803d41:	85 c0                	test   %eax,%eax
+  803d43:	79 c9                	jns    803d0e <page_map+0xf8>
+  803d45:	e9 56 ff ff ff       	jmp    803ca0 <page_map+0x8a>
+				panic("page_map: Unable to map map table -- %e\n", r2);
+  803d4a:	53                   	push   %ebx
+  803d4b:	68 78 57 80 00       	push   $0x805778
+  803d50:	68 83 03 00 00       	push   $0x383
+  803d55:	68 15 53 80 00       	push   $0x805315
+  803d5a:	e8 9f c4 ff ff       	call   8001fe <_panic>
+		mte = (mte_t*)UTEMP + MTX(srcva);
+  803d5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d62:	c1 e8 0c             	shr    $0xc,%eax
+  803d65:	25 ff 03 00 00       	and    $0x3ff,%eax
+		if (!(*mte & MTE_P)) // Page doesn't exist in mapping table
+  803d6a:	f6 04 85 00 00 40 00 	testb  $0x1,0x400000(,%eax,4)
+  803d71:	01 
+  803d72:	0f 84 8d 00 00 00    	je     803e05 <page_map+0x1ef>
+		if ((r2 = sys_page_unmap(0, UTEMP)) < 0)
+  803d78:	83 ec 08             	sub    $0x8,%esp
+  803d7b:	68 00 00 40 00       	push   $0x400000
+  803d80:	6a 00                	push   $0x0
+  803d82:	e8 b1 d0 ff ff       	call   800e38 <sys_page_unmap>
+  803d87:	83 c4 10             	add    $0x10,%esp
+  803d8a:	85 c0                	test   %eax,%eax
+  803d8c:	78 36                	js     803dc4 <page_map+0x1ae>
+  803d8e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+		while ((r2 = page_in(srcenvid, srcva)) < 0)
+  803d91:	83 ec 08             	sub    $0x8,%esp
+  803d94:	57                   	push   %edi
+  803d95:	56                   	push   %esi
+  803d96:	e8 4a fc ff ff       	call   8039e5 <page_in>
+  803d9b:	89 c3                	mov    %eax,%ebx
+  803d9d:	83 c4 10             	add    $0x10,%esp
+  803da0:	85 c0                	test   %eax,%eax
+  803da2:	0f 89 7a fe ff ff    	jns    803c22 <page_map+0xc>
+			if (r2 != -E_NO_MEM)
+  803da8:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803dab:	75 2c                	jne    803dd9 <page_map+0x1c3>
+			if (page_out(0, (void*)srcva) < 0)
+  803dad:	83 ec 08             	sub    $0x8,%esp
+  803db0:	57                   	push   %edi
+  803db1:	6a 00                	push   $0x0
+  803db3:	e8 7d f5 ff ff       	call   803335 <page_out>
+  803db8:	83 c4 10             	add    $0x10,%esp
+  803dbb:	85 c0                	test   %eax,%eax
+  803dbd:	79 d2                	jns    803d91 <page_map+0x17b>
+  803dbf:	e9 dc fe ff ff       	jmp    803ca0 <page_map+0x8a>
+			panic("page_map: Unable to unmap UTEMP -- %e\n", r2);
+  803dc4:	50                   	push   %eax
+  803dc5:	68 a4 57 80 00       	push   $0x8057a4
+  803dca:	68 8b 03 00 00       	push   $0x38b
+  803dcf:	68 15 53 80 00       	push   $0x805315
+  803dd4:	e8 25 c4 ff ff       	call   8001fe <_panic>
+				panic("page_map: Unable to page in target page -- %e\n", r2);
+  803dd9:	53                   	push   %ebx
+  803dda:	68 cc 57 80 00       	push   $0x8057cc
+  803ddf:	68 91 03 00 00       	push   $0x391
+  803de4:	68 15 53 80 00       	push   $0x805315
+  803de9:	e8 10 c4 ff ff       	call   8001fe <_panic>
+	while ((r = sys_page_map(srcenvid, srcva, dstenvid, dstva, perm)) < 0)
+  803dee:	89 c3                	mov    %eax,%ebx
+  803df0:	e9 ab fe ff ff       	jmp    803ca0 <page_map+0x8a>
+  803df5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803df8:	e9 a3 fe ff ff       	jmp    803ca0 <page_map+0x8a>
+			return r; // Pass through the error
+  803dfd:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e00:	e9 9b fe ff ff       	jmp    803ca0 <page_map+0x8a>
+			return r; // Pass through the error
+  803e05:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  803e08:	e9 93 fe ff ff       	jmp    803ca0 <page_map+0x8a>
+
+00803e0d <page_map_range>:
+{
+  803e0d:	55                   	push   %ebp
+  803e0e:	89 e5                	mov    %esp,%ebp
+  803e10:	57                   	push   %edi
+  803e11:	56                   	push   %esi
+  803e12:	53                   	push   %ebx
+  803e13:	83 ec 0c             	sub    $0xc,%esp
+  803e16:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  803e19:	8b 75 14             	mov    0x14(%ebp),%esi
+	while ((r = sys_page_map_range(srcenvid, srcva, dstenvid, dstva, npages, perm)) < 0)
+  803e1c:	83 ec 08             	sub    $0x8,%esp
+  803e1f:	ff 75 1c             	push   0x1c(%ebp)
+  803e22:	ff 75 18             	push   0x18(%ebp)
+  803e25:	56                   	push   %esi
+  803e26:	ff 75 10             	push   0x10(%ebp)
+  803e29:	57                   	push   %edi
+  803e2a:	ff 75 08             	push   0x8(%ebp)
+  803e2d:	e8 cf d0 ff ff       	call   800f01 <sys_page_map_range>
+  803e32:	89 c3                	mov    %eax,%ebx
+  803e34:	83 c4 20             	add    $0x20,%esp
+  803e37:	85 c0                	test   %eax,%eax
+  803e39:	79 1b                	jns    803e56 <page_map_range+0x49>
+		if (r == -E_NO_MEM)
+  803e3b:	83 fb fc             	cmp    $0xfffffffc,%ebx
+  803e3e:	75 20                	jne    803e60 <page_map_range+0x53>
+			if (page_out(0, (void*)UTEMP) < 0)
+  803e40:	83 ec 08             	sub    $0x8,%esp
+  803e43:	68 00 00 40 00       	push   $0x400000
+  803e48:	6a 00                	push   $0x0
+  803e4a:	e8 e6 f4 ff ff       	call   803335 <page_out>
+  803e4f:	83 c4 10             	add    $0x10,%esp
+  803e52:	85 c0                	test   %eax,%eax
+  803e54:	79 c6                	jns    803e1c <page_map_range+0xf>
+}
+  803e56:	89 d8                	mov    %ebx,%eax
+  803e58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e5b:	5b                   	pop    %ebx
+  803e5c:	5e                   	pop    %esi
+  803e5d:	5f                   	pop    %edi
+  803e5e:	5d                   	pop    %ebp
+  803e5f:	c3                   	ret
+		if (r != -E_INVAL)
+  803e60:	83 fb fd             	cmp    $0xfffffffd,%ebx
+  803e63:	75 f1                	jne    803e56 <page_map_range+0x49>
+  803e65:	89 f3                	mov    %esi,%ebx
+		for (i = 0; i < npages; i++)
+  803e67:	be 00 00 00 00       	mov    $0x0,%esi
+  803e6c:	eb 03                	jmp    803e71 <page_map_range+0x64>
+  803e6e:	83 c6 01             	add    $0x1,%esi
+  803e71:	3b 75 18             	cmp    0x18(%ebp),%esi
+  803e74:	74 2a                	je     803ea0 <page_map_range+0x93>
+			if ((r = page_map(srcenvid, srcva + i*PGSIZE, dstenvid, dstva + i*PGSIZE, perm)) < 0)
+  803e76:	83 ec 0c             	sub    $0xc,%esp
+  803e79:	ff 75 1c             	push   0x1c(%ebp)
+  803e7c:	53                   	push   %ebx
+  803e7d:	ff 75 10             	push   0x10(%ebp)
+  803e80:	57                   	push   %edi
+  803e81:	ff 75 08             	push   0x8(%ebp)
+  803e84:	e8 8d fd ff ff       	call   803c16 <page_map>
+  803e89:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  803e8f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803e95:	83 c4 20             	add    $0x20,%esp
+  803e98:	85 c0                	test   %eax,%eax
+  803e9a:	79 d2                	jns    803e6e <page_map_range+0x61>
+  803e9c:	89 c3                	mov    %eax,%ebx
+  803e9e:	eb b6                	jmp    803e56 <page_map_range+0x49>
+		return 0;
+  803ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ea5:	eb af                	jmp    803e56 <page_map_range+0x49>
+
+00803ea7 <paging_pgfault_handler>:
+{
+  803ea7:	55                   	push   %ebp
+  803ea8:	89 e5                	mov    %esp,%ebp
+  803eaa:	56                   	push   %esi
+  803eab:	53                   	push   %ebx
+  803eac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	find_paging_env();
+  803eaf:	e8 6f e7 ff ff       	call   802623 <find_paging_env>
+	if (pagingenv == 0)
+  803eb4:	a1 40 b0 80 00       	mov    0x80b040,%eax
+  803eb9:	85 c0                	test   %eax,%eax
+  803ebb:	74 3c                	je     803ef9 <paging_pgfault_handler+0x52>
+	void *fault_addr = (void*)utf->utf_fault_va;
+  803ebd:	8b 33                	mov    (%ebx),%esi
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803ebf:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803ec3:	75 12                	jne    803ed7 <paging_pgfault_handler+0x30>
+  803ec5:	89 f0                	mov    %esi,%eax
+  803ec7:	e8 7e f7 ff ff       	call   80364a <page_adopt>
+  803ecc:	89 c2                	mov    %eax,%edx
+		return 0;
+  803ece:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && page_adopt(fault_addr) < 0)
+  803ed3:	85 d2                	test   %edx,%edx
+  803ed5:	78 22                	js     803ef9 <paging_pgfault_handler+0x52>
+	mte_t *mte = umapdir_walk(fault_addr, 0);
+  803ed7:	83 ec 08             	sub    $0x8,%esp
+  803eda:	6a 00                	push   $0x0
+  803edc:	56                   	push   %esi
+  803edd:	e8 a9 f3 ff ff       	call   80328b <umapdir_walk>
+	if (mte && (*mte & MTE_P))
+  803ee2:	83 c4 10             	add    $0x10,%esp
+  803ee5:	85 c0                	test   %eax,%eax
+  803ee7:	74 05                	je     803eee <paging_pgfault_handler+0x47>
+  803ee9:	f6 00 01             	testb  $0x1,(%eax)
+  803eec:	75 12                	jne    803f00 <paging_pgfault_handler+0x59>
+	return 0;
+  803eee:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803ef3:	f6 43 04 01          	testb  $0x1,0x4(%ebx)
+  803ef7:	74 23                	je     803f1c <paging_pgfault_handler+0x75>
+}
+  803ef9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803efc:	5b                   	pop    %ebx
+  803efd:	5e                   	pop    %esi
+  803efe:	5d                   	pop    %ebp
+  803eff:	c3                   	ret
+		if ((r = page_in(thisenv->env_id, fault_addr)) < 0)
+  803f00:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f05:	8b 40 48             	mov    0x48(%eax),%eax
+  803f08:	83 ec 08             	sub    $0x8,%esp
+  803f0b:	56                   	push   %esi
+  803f0c:	50                   	push   %eax
+  803f0d:	e8 d3 fa ff ff       	call   8039e5 <page_in>
+  803f12:	f7 d0                	not    %eax
+  803f14:	c1 e8 1f             	shr    $0x1f,%eax
+  803f17:	83 c4 10             	add    $0x10,%esp
+  803f1a:	eb dd                	jmp    803ef9 <paging_pgfault_handler+0x52>
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f1c:	89 f0                	mov    %esi,%eax
+  803f1e:	e8 97 e2 ff ff       	call   8021ba <segment_lookup>
+  803f23:	89 c2                	mov    %eax,%edx
+	return 0;
+  803f25:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(utf->utf_err & FEC_PR) && segment_lookup(fault_addr))
+  803f2a:	85 d2                	test   %edx,%edx
+  803f2c:	74 cb                	je     803ef9 <paging_pgfault_handler+0x52>
+		if ((r = page_out(thisenv->env_id, fault_addr)) < 0)
+  803f2e:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  803f33:	8b 40 48             	mov    0x48(%eax),%eax
+  803f36:	83 ec 08             	sub    $0x8,%esp
+  803f39:	56                   	push   %esi
+  803f3a:	50                   	push   %eax
+  803f3b:	e8 f5 f3 ff ff       	call   803335 <page_out>
+  803f40:	f7 d0                	not    %eax
+  803f42:	c1 e8 1f             	shr    $0x1f,%eax
+  803f45:	83 c4 10             	add    $0x10,%esp
+  803f48:	eb af                	jmp    803ef9 <paging_pgfault_handler+0x52>
+
+00803f4a <heap_free_pages>:
+
+// Unmap the pages of the big allocation starting at va, and give back
+// their address space
+static void
+heap_free_pages(void *va)
+{
+  803f4a:	55                   	push   %ebp
+  803f4b:	89 e5                	mov    %esp,%ebp
+  803f4d:	57                   	push   %edi
+  803f4e:	56                   	push   %esi
+  803f4f:	53                   	push   %ebx
+  803f50:	83 ec 2c             	sub    $0x2c,%esp
+  803f53:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	uint32_t i, n;
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  803f56:	2d 00 00 00 08       	sub    $0x8000000,%eax
+  803f5b:	89 c1                	mov    %eax,%ecx
+  803f5d:	c1 e9 0c             	shr    $0xc,%ecx
+	if (!HEAP_BIT(heap_first, i))
+  803f60:	c1 e8 11             	shr    $0x11,%eax
+  803f63:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  803f66:	8b 3c 85 80 cc 80 00 	mov    0x80cc80(,%eax,4),%edi
+  803f6d:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  803f70:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f75:	d3 e0                	shl    %cl,%eax
+  803f77:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803f7a:	85 c7                	test   %eax,%edi
+  803f7c:	74 12                	je     803f90 <heap_free_pages+0x46>
+		panic("free: %p is not allocated", va);
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803f7e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  803f83:	8d 71 ff             	lea    -0x1(%ecx),%esi
+  803f86:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f8b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  803f8e:	eb 17                	jmp    803fa7 <heap_free_pages+0x5d>
+		panic("free: %p is not allocated", va);
+  803f90:	ff 75 e0             	push   -0x20(%ebp)
+  803f93:	68 04 58 80 00       	push   $0x805804
+  803f98:	6a 48                	push   $0x48
+  803f9a:	68 1e 58 80 00       	push   $0x80581e
+  803f9f:	e8 5a c2 ff ff       	call   8001fe <_panic>
+	for (n = 1; !HEAP_BIT(heap_last, i + n - 1); n++)
+  803fa4:	83 c3 01             	add    $0x1,%ebx
+  803fa7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803faa:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+  803fad:	89 c8                	mov    %ecx,%eax
+  803faf:	c1 e8 05             	shr    $0x5,%eax
+  803fb2:	8b 14 85 80 be 80 00 	mov    0x80be80(,%eax,4),%edx
+  803fb9:	89 fe                	mov    %edi,%esi
+  803fbb:	d3 e6                	shl    %cl,%esi
+  803fbd:	89 f1                	mov    %esi,%ecx
+  803fbf:	85 d6                	test   %edx,%esi
+  803fc1:	74 e1                	je     803fa4 <heap_free_pages+0x5a>
+		/* do nothing */;
+	HEAP_CLEAR(heap_first, i);
+  803fc3:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803fc6:	f7 d6                	not    %esi
+  803fc8:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  803fcb:	21 fe                	and    %edi,%esi
+  803fcd:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  803fd0:	89 34 bd 80 cc 80 00 	mov    %esi,0x80cc80(,%edi,4)
+	HEAP_CLEAR(heap_last, i + n - 1);
+  803fd7:	f7 d1                	not    %ecx
+  803fd9:	21 d1                	and    %edx,%ecx
+  803fdb:	89 0c 85 80 be 80 00 	mov    %ecx,0x80be80(,%eax,4)
+	page_unmap_range(0, va, n);
+  803fe2:	83 ec 04             	sub    $0x4,%esp
+  803fe5:	53                   	push   %ebx
+  803fe6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803fe9:	57                   	push   %edi
+  803fea:	6a 00                	push   $0x0
+  803fec:	e8 97 f8 ff ff       	call   803888 <page_unmap_range>
+	va_free(va, n);
+  803ff1:	83 c4 08             	add    $0x8,%esp
+  803ff4:	53                   	push   %ebx
+  803ff5:	57                   	push   %edi
+  803ff6:	e8 ed 05 00 00       	call   8045e8 <va_free>
+}
+  803ffb:	83 c4 10             	add    $0x10,%esp
+  803ffe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804001:	5b                   	pop    %ebx
+  804002:	5e                   	pop    %esi
+  804003:	5f                   	pop    %edi
+  804004:	5d                   	pop    %ebp
+  804005:	c3                   	ret
+
+00804006 <free>:
+}
+
+// Free a block of memory returned by malloc, so it can be malloc'd later
+void
+free(void *va)
+{
+  804006:	55                   	push   %ebp
+  804007:	89 e5                	mov    %esp,%ebp
+  804009:	57                   	push   %edi
+  80400a:	56                   	push   %esi
+  80400b:	53                   	push   %ebx
+  80400c:	83 ec 1c             	sub    $0x1c,%esp
+  80400f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct slab *s;
+	int c;
+
+	if (!va)
+  804012:	85 db                	test   %ebx,%ebx
+  804014:	74 34                	je     80404a <free+0x44>
+		return;
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va >= UHEAPTOP)
+  804016:	8d 83 00 00 00 f8    	lea    -0x8000000(%ebx),%eax
+  80401c:	3d ff ff ff 06       	cmp    $0x6ffffff,%eax
+  804021:	77 2f                	ja     804052 <free+0x4c>
+		panic("free: %p is not in the heap", va);
+	if ((uintptr_t) va % PGSIZE == 0) {
+  804023:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804029:	75 51                	jne    80407c <free+0x76>
+		if (HEAP_BIT(heap_slab, ((uintptr_t) va - UHEAP) / PGSIZE))
+  80402b:	89 c1                	mov    %eax,%ecx
+  80402d:	c1 e9 0c             	shr    $0xc,%ecx
+  804030:	ba 01 00 00 00       	mov    $0x1,%edx
+  804035:	d3 e2                	shl    %cl,%edx
+  804037:	c1 e8 11             	shr    $0x11,%eax
+  80403a:	23 14 85 80 b0 80 00 	and    0x80b080(,%eax,4),%edx
+  804041:	75 24                	jne    804067 <free+0x61>
+			panic("free: %p is not allocated", va);
+		heap_free_pages(va);
+  804043:	89 d8                	mov    %ebx,%eax
+  804045:	e8 00 ff ff ff       	call   803f4a <heap_free_pages>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+		slab_unlink(s, c);
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+		heap_free_pages(s);
+	}
+}
+  80404a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80404d:	5b                   	pop    %ebx
+  80404e:	5e                   	pop    %esi
+  80404f:	5f                   	pop    %edi
+  804050:	5d                   	pop    %ebp
+  804051:	c3                   	ret
+		panic("free: %p is not in the heap", va);
+  804052:	53                   	push   %ebx
+  804053:	68 2b 58 80 00       	push   $0x80582b
+  804058:	68 a2 00 00 00       	push   $0xa2
+  80405d:	68 1e 58 80 00       	push   $0x80581e
+  804062:	e8 97 c1 ff ff       	call   8001fe <_panic>
+			panic("free: %p is not allocated", va);
+  804067:	53                   	push   %ebx
+  804068:	68 04 58 80 00       	push   $0x805804
+  80406d:	68 a5 00 00 00       	push   $0xa5
+  804072:	68 1e 58 80 00       	push   $0x80581e
+  804077:	e8 82 c1 ff ff       	call   8001fe <_panic>
+	s = ROUNDDOWN((struct slab *) va, PGSIZE);
+  80407c:	89 de                	mov    %ebx,%esi
+  80407e:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (!HEAP_BIT(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE)
+  804084:	8d 8e 00 00 00 f8    	lea    -0x8000000(%esi),%ecx
+  80408a:	89 c8                	mov    %ecx,%eax
+  80408c:	c1 e8 11             	shr    $0x11,%eax
+  80408f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804092:	8b 3c 85 80 b0 80 00 	mov    0x80b080(,%eax,4),%edi
+  804099:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  80409c:	c1 e9 0c             	shr    $0xc,%ecx
+  80409f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040a4:	d3 e0                	shl    %cl,%eax
+  8040a6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8040a9:	85 c7                	test   %eax,%edi
+  8040ab:	74 1b                	je     8040c8 <free+0xc2>
+	    || ((char *) va - (char *) s - SLAB_HDRSIZE) % s->size != 0)
+  8040ad:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  8040b1:	89 d8                	mov    %ebx,%eax
+  8040b3:	29 f0                	sub    %esi,%eax
+  8040b5:	83 e8 10             	sub    $0x10,%eax
+  8040b8:	99                   	cltd
+  8040b9:	f7 ff                	idiv   %edi
+  8040bb:	89 d1                	mov    %edx,%ecx
+  8040bd:	85 d2                	test   %edx,%edx
+  8040bf:	75 07                	jne    8040c8 <free+0xc2>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040c1:	ba 10 00 00 00       	mov    $0x10,%edx
+  8040c6:	eb 18                	jmp    8040e0 <free+0xda>
+		panic("free: %p is not allocated", va);
+  8040c8:	53                   	push   %ebx
+  8040c9:	68 04 58 80 00       	push   $0x805804
+  8040ce:	68 ad 00 00 00       	push   $0xad
+  8040d3:	68 1e 58 80 00       	push   $0x80581e
+  8040d8:	e8 21 c1 ff ff       	call   8001fe <_panic>
+	for (c = 0; (HEAP_MINSIZE << c) < s->size; c++)
+  8040dd:	83 c1 01             	add    $0x1,%ecx
+  8040e0:	89 d0                	mov    %edx,%eax
+  8040e2:	d3 e0                	shl    %cl,%eax
+  8040e4:	39 c7                	cmp    %eax,%edi
+  8040e6:	7f f5                	jg     8040dd <free+0xd7>
+	*(void **) va = s->free;
+  8040e8:	8b 46 08             	mov    0x8(%esi),%eax
+  8040eb:	89 03                	mov    %eax,(%ebx)
+	s->free = va;
+  8040ed:	89 5e 08             	mov    %ebx,0x8(%esi)
+	if (s->nfree++ == 0)
+  8040f0:	0f b7 46 0e          	movzwl 0xe(%esi),%eax
+  8040f4:	8d 58 01             	lea    0x1(%eax),%ebx
+  8040f7:	66 89 5e 0e          	mov    %bx,0xe(%esi)
+  8040fb:	66 85 c0             	test   %ax,%ax
+  8040fe:	74 52                	je     804152 <free+0x14c>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804100:	0f b7 db             	movzwl %bx,%ebx
+  804103:	0f b7 7e 0c          	movzwl 0xc(%esi),%edi
+  804107:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  80410c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804111:	f7 ff                	idiv   %edi
+  804113:	39 c3                	cmp    %eax,%ebx
+  804115:	0f 85 2f ff ff ff    	jne    80404a <free+0x44>
+  80411b:	8b 46 04             	mov    0x4(%esi),%eax
+  80411e:	85 c0                	test   %eax,%eax
+  804120:	74 53                	je     804175 <free+0x16f>
+		s->prev->next = s->next;
+  804122:	8b 16                	mov    (%esi),%edx
+  804124:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804126:	8b 06                	mov    (%esi),%eax
+  804128:	85 c0                	test   %eax,%eax
+  80412a:	74 06                	je     804132 <free+0x12c>
+		s->next->prev = s->prev;
+  80412c:	8b 56 04             	mov    0x4(%esi),%edx
+  80412f:	89 50 04             	mov    %edx,0x4(%eax)
+		HEAP_CLEAR(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  804132:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  804135:	f7 d0                	not    %eax
+  804137:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80413a:	21 d0                	and    %edx,%eax
+  80413c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80413f:	89 04 95 80 b0 80 00 	mov    %eax,0x80b080(,%edx,4)
+		heap_free_pages(s);
+  804146:	89 f0                	mov    %esi,%eax
+  804148:	e8 fd fd ff ff       	call   803f4a <heap_free_pages>
+  80414d:	e9 f8 fe ff ff       	jmp    80404a <free+0x44>
+	s->prev = NULL;
+  804152:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	s->next = slabs[c];
+  804159:	8b 04 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%eax
+  804160:	89 06                	mov    %eax,(%esi)
+	if (slabs[c])
+  804162:	85 c0                	test   %eax,%eax
+  804164:	74 03                	je     804169 <free+0x163>
+		slabs[c]->prev = s;
+  804166:	89 70 04             	mov    %esi,0x4(%eax)
+	slabs[c] = s;
+  804169:	89 34 8d 60 b0 80 00 	mov    %esi,0x80b060(,%ecx,4)
+}
+  804170:	e9 d5 fe ff ff       	jmp    80404a <free+0x44>
+	else if (s->nfree == SLAB_NOBJS(s->size) && (s->prev || s->next)) {
+  804175:	8b 06                	mov    (%esi),%eax
+  804177:	85 c0                	test   %eax,%eax
+  804179:	0f 84 cb fe ff ff    	je     80404a <free+0x44>
+		slabs[c] = s->next;
+  80417f:	89 04 8d 60 b0 80 00 	mov    %eax,0x80b060(,%ecx,4)
+	if (s->next)
+  804186:	8b 06                	mov    (%esi),%eax
+  804188:	eb a2                	jmp    80412c <free+0x126>
+
+0080418a <heap_alloc_pages>:
+{
+  80418a:	55                   	push   %ebp
+  80418b:	89 e5                	mov    %esp,%ebp
+  80418d:	57                   	push   %edi
+  80418e:	56                   	push   %esi
+  80418f:	53                   	push   %ebx
+  804190:	83 ec 18             	sub    $0x18,%esp
+  804193:	89 c6                	mov    %eax,%esi
+	if (!(va = va_alloc(npages)))
+  804195:	50                   	push   %eax
+  804196:	e8 15 03 00 00       	call   8044b0 <va_alloc>
+  80419b:	89 c3                	mov    %eax,%ebx
+  80419d:	83 c4 10             	add    $0x10,%esp
+  8041a0:	85 c0                	test   %eax,%eax
+  8041a2:	74 47                	je     8041eb <heap_alloc_pages+0x61>
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  8041a4:	8d 80 00 00 00 f8    	lea    -0x8000000(%eax),%eax
+  8041aa:	89 c1                	mov    %eax,%ecx
+  8041ac:	c1 e9 0c             	shr    $0xc,%ecx
+	HEAP_SET(heap_first, i);
+  8041af:	c1 e8 11             	shr    $0x11,%eax
+  8041b2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8041b7:	89 d7                	mov    %edx,%edi
+  8041b9:	d3 e7                	shl    %cl,%edi
+  8041bb:	09 3c 85 80 cc 80 00 	or     %edi,0x80cc80(,%eax,4)
+	HEAP_SET(heap_last, i + npages - 1);
+  8041c2:	8d 4c 31 ff          	lea    -0x1(%ecx,%esi,1),%ecx
+  8041c6:	89 c8                	mov    %ecx,%eax
+  8041c8:	c1 e8 05             	shr    $0x5,%eax
+  8041cb:	d3 e2                	shl    %cl,%edx
+  8041cd:	09 14 85 80 be 80 00 	or     %edx,0x80be80(,%eax,4)
+	if (page_alloc_range(0, va, npages, PTE_P|PTE_U|PTE_W, 0) < 0) {
+  8041d4:	83 ec 0c             	sub    $0xc,%esp
+  8041d7:	6a 00                	push   $0x0
+  8041d9:	6a 07                	push   $0x7
+  8041db:	56                   	push   %esi
+  8041dc:	53                   	push   %ebx
+  8041dd:	6a 00                	push   $0x0
+  8041df:	e8 3a f7 ff ff       	call   80391e <page_alloc_range>
+  8041e4:	83 c4 20             	add    $0x20,%esp
+  8041e7:	85 c0                	test   %eax,%eax
+  8041e9:	78 0a                	js     8041f5 <heap_alloc_pages+0x6b>
+}
+  8041eb:	89 d8                	mov    %ebx,%eax
+  8041ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8041f0:	5b                   	pop    %ebx
+  8041f1:	5e                   	pop    %esi
+  8041f2:	5f                   	pop    %edi
+  8041f3:	5d                   	pop    %ebp
+  8041f4:	c3                   	ret
+		free(va);
+  8041f5:	83 ec 0c             	sub    $0xc,%esp
+  8041f8:	53                   	push   %ebx
+  8041f9:	e8 08 fe ff ff       	call   804006 <free>
+		return NULL;
+  8041fe:	83 c4 10             	add    $0x10,%esp
+  804201:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804206:	eb e3                	jmp    8041eb <heap_alloc_pages+0x61>
+
+00804208 <malloc>:
+{
+  804208:	55                   	push   %ebp
+  804209:	89 e5                	mov    %esp,%ebp
+  80420b:	57                   	push   %edi
+  80420c:	56                   	push   %esi
+  80420d:	53                   	push   %ebx
+  80420e:	83 ec 1c             	sub    $0x1c,%esp
+  804211:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (n == 0 || n > UHEAPTOP - UHEAP)
+  804214:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804217:	81 fa ff ff ff 06    	cmp    $0x6ffffff,%edx
+  80421d:	0f 87 21 01 00 00    	ja     804344 <malloc+0x13c>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804223:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804228:	ba 10 00 00 00       	mov    $0x10,%edx
+  80422d:	89 d9                	mov    %ebx,%ecx
+	if (n > HEAP_MAXSMALL)
+  80422f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  804234:	76 15                	jbe    80424b <malloc+0x43>
+		return heap_alloc_pages(ROUNDUP(n, PGSIZE) / PGSIZE);
+  804236:	05 ff 0f 00 00       	add    $0xfff,%eax
+  80423b:	c1 e8 0c             	shr    $0xc,%eax
+  80423e:	e8 47 ff ff ff       	call   80418a <heap_alloc_pages>
+  804243:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804246:	eb 37                	jmp    80427f <malloc+0x77>
+	for (c = 0; (HEAP_MINSIZE << c) < n; c++)
+  804248:	83 c1 01             	add    $0x1,%ecx
+  80424b:	89 d6                	mov    %edx,%esi
+  80424d:	d3 e6                	shl    %cl,%esi
+  80424f:	39 c6                	cmp    %eax,%esi
+  804251:	72 f5                	jb     804248 <malloc+0x40>
+	if (!(s = slabs[c]) && !(s = slab_new(c)))
+  804253:	89 cb                	mov    %ecx,%ebx
+  804255:	8b 3c 8d 60 b0 80 00 	mov    0x80b060(,%ecx,4),%edi
+  80425c:	85 ff                	test   %edi,%edi
+  80425e:	74 2a                	je     80428a <malloc+0x82>
+	v = s->free;
+  804260:	8b 47 08             	mov    0x8(%edi),%eax
+  804263:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	s->free = *(void **) v;
+  804266:	8b 00                	mov    (%eax),%eax
+  804268:	89 47 08             	mov    %eax,0x8(%edi)
+	if (--s->nfree == 0)
+  80426b:	0f b7 47 0e          	movzwl 0xe(%edi),%eax
+  80426f:	83 e8 01             	sub    $0x1,%eax
+  804272:	66 89 47 0e          	mov    %ax,0xe(%edi)
+  804276:	66 85 c0             	test   %ax,%ax
+  804279:	0f 84 9a 00 00 00    	je     804319 <malloc+0x111>
+}
+  80427f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804282:	83 c4 1c             	add    $0x1c,%esp
+  804285:	5b                   	pop    %ebx
+  804286:	5e                   	pop    %esi
+  804287:	5f                   	pop    %edi
+  804288:	5d                   	pop    %ebp
+  804289:	c3                   	ret
+	if (!(s = heap_alloc_pages(1)))
+  80428a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80428f:	e8 f6 fe ff ff       	call   80418a <heap_alloc_pages>
+  804294:	89 c1                	mov    %eax,%ecx
+  804296:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804299:	85 c0                	test   %eax,%eax
+  80429b:	74 e2                	je     80427f <malloc+0x77>
+	HEAP_SET(heap_slab, ((uintptr_t) s - UHEAP) / PGSIZE);
+  80429d:	81 e9 00 00 00 08    	sub    $0x8000000,%ecx
+  8042a3:	89 c8                	mov    %ecx,%eax
+  8042a5:	c1 e8 11             	shr    $0x11,%eax
+  8042a8:	c1 e9 0c             	shr    $0xc,%ecx
+  8042ab:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042b0:	d3 e2                	shl    %cl,%edx
+  8042b2:	09 14 85 80 b0 80 00 	or     %edx,0x80b080(,%eax,4)
+	s->size = HEAP_MINSIZE << c;
+  8042b9:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8042bc:	66 89 71 0c          	mov    %si,0xc(%ecx)
+	s->nfree = SLAB_NOBJS(s->size);
+  8042c0:	0f b7 f6             	movzwl %si,%esi
+  8042c3:	b8 f0 0f 00 00       	mov    $0xff0,%eax
+  8042c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042cd:	f7 fe                	idiv   %esi
+  8042cf:	66 89 41 0e          	mov    %ax,0xe(%ecx)
+	s->free = NULL;
+  8042d3:	89 79 08             	mov    %edi,0x8(%ecx)
+	for (i = s->nfree; i > 0; i--) {
+  8042d6:	85 c0                	test   %eax,%eax
+  8042d8:	74 14                	je     8042ee <malloc+0xe6>
+		obj = (char *) s + SLAB_HDRSIZE + (i - 1)*s->size;
+  8042da:	83 e8 01             	sub    $0x1,%eax
+  8042dd:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  8042e1:	0f af d0             	imul   %eax,%edx
+  8042e4:	8d 54 11 10          	lea    0x10(%ecx,%edx,1),%edx
+		*(void **) obj = s->free;
+  8042e8:	89 3a                	mov    %edi,(%edx)
+  8042ea:	89 d7                	mov    %edx,%edi
+  8042ec:	eb e5                	jmp    8042d3 <malloc+0xcb>
+	s->prev = NULL;
+  8042ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8042f1:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+	s->next = slabs[c];
+  8042f8:	8b 04 9d 60 b0 80 00 	mov    0x80b060(,%ebx,4),%eax
+  8042ff:	89 07                	mov    %eax,(%edi)
+	if (slabs[c])
+  804301:	85 c0                	test   %eax,%eax
+  804303:	74 03                	je     804308 <malloc+0x100>
+		slabs[c]->prev = s;
+  804305:	89 78 04             	mov    %edi,0x4(%eax)
+	slabs[c] = s;
+  804308:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80430b:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+	return s;
+  804312:	89 c7                	mov    %eax,%edi
+  804314:	e9 47 ff ff ff       	jmp    804260 <malloc+0x58>
+	if (s->prev)
+  804319:	8b 47 04             	mov    0x4(%edi),%eax
+  80431c:	85 c0                	test   %eax,%eax
+  80431e:	74 19                	je     804339 <malloc+0x131>
+		s->prev->next = s->next;
+  804320:	8b 17                	mov    (%edi),%edx
+  804322:	89 10                	mov    %edx,(%eax)
+	if (s->next)
+  804324:	8b 07                	mov    (%edi),%eax
+  804326:	85 c0                	test   %eax,%eax
+  804328:	0f 84 51 ff ff ff    	je     80427f <malloc+0x77>
+		s->next->prev = s->prev;
+  80432e:	8b 57 04             	mov    0x4(%edi),%edx
+  804331:	89 50 04             	mov    %edx,0x4(%eax)
+  804334:	e9 46 ff ff ff       	jmp    80427f <malloc+0x77>
+		slabs[c] = s->next;
+  804339:	8b 07                	mov    (%edi),%eax
+  80433b:	89 04 9d 60 b0 80 00 	mov    %eax,0x80b060(,%ebx,4)
+  804342:	eb e0                	jmp    804324 <malloc+0x11c>
+		return NULL;
+  804344:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80434b:	e9 2f ff ff ff       	jmp    80427f <malloc+0x77>
+
+00804350 <va_chunk_scan>:
+// Find the first run of n free pages in chunk ch.
+// Returns the index of its first page, or -1 if there is none.
+// If run_store isn't null, sets *run_store to the longest free run.
+static int
+va_chunk_scan(struct va_chunk *ch, uint32_t n, uint32_t *run_store)
+{
+  804350:	55                   	push   %ebp
+  804351:	89 e5                	mov    %esp,%ebp
+  804353:	57                   	push   %edi
+  804354:	56                   	push   %esi
+  804355:	53                   	push   %ebx
+  804356:	83 ec 0c             	sub    $0xc,%esp
+  804359:	89 c6                	mov    %eax,%esi
+  80435b:	89 d7                	mov    %edx,%edi
+  80435d:	89 4d e8             	mov    %ecx,-0x18(%ebp)
+	uint32_t i, len, best;
+
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  804360:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804365:	ba 00 00 00 00       	mov    $0x0,%edx
+  80436a:	b8 00 00 00 00       	mov    $0x0,%eax
+			continue;
+		} else
+			len++;
+		if (len > best)
+			best = len;
+		if (n && len >= n)
+  80436f:	83 ef 01             	sub    $0x1,%edi
+  804372:	89 7d ec             	mov    %edi,-0x14(%ebp)
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804375:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  804378:	eb 34                	jmp    8043ae <va_chunk_scan+0x5e>
+			i += 31;
+  80437a:	83 c0 1f             	add    $0x1f,%eax
+			len = 0;
+  80437d:	89 ca                	mov    %ecx,%edx
+			continue;
+  80437f:	eb 23                	jmp    8043a4 <va_chunk_scan+0x54>
+		} else if (ch->map[i / 32] & (1 << (i % 32))) {
+  804381:	89 c7                	mov    %eax,%edi
+  804383:	c1 ef 05             	shr    $0x5,%edi
+  804386:	be 01 00 00 00       	mov    $0x1,%esi
+  80438b:	d3 e6                	shl    %cl,%esi
+  80438d:	89 f1                	mov    %esi,%ecx
+  80438f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  804392:	23 0c be             	and    (%esi,%edi,4),%ecx
+  804395:	75 41                	jne    8043d8 <va_chunk_scan+0x88>
+			len++;
+  804397:	83 c2 01             	add    $0x1,%edx
+		if (len > best)
+  80439a:	39 d3                	cmp    %edx,%ebx
+  80439c:	0f 42 da             	cmovb  %edx,%ebx
+		if (n && len >= n)
+  80439f:	39 55 ec             	cmp    %edx,-0x14(%ebp)
+  8043a2:	72 2d                	jb     8043d1 <va_chunk_scan+0x81>
+	for (i = len = best = 0; i < NPTENTRIES; i++) {
+  8043a4:	83 c0 01             	add    $0x1,%eax
+  8043a7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8043ac:	77 31                	ja     8043df <va_chunk_scan+0x8f>
+		if (i % 32 == 0 && ch->map[i / 32] == ~0U) {
+  8043ae:	89 c1                	mov    %eax,%ecx
+  8043b0:	83 e1 1f             	and    $0x1f,%ecx
+  8043b3:	75 cc                	jne    804381 <va_chunk_scan+0x31>
+  8043b5:	89 c7                	mov    %eax,%edi
+  8043b7:	c1 ef 05             	shr    $0x5,%edi
+  8043ba:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8043bd:	8b 3c be             	mov    (%esi,%edi,4),%edi
+  8043c0:	83 ff ff             	cmp    $0xffffffff,%edi
+  8043c3:	74 b5                	je     80437a <va_chunk_scan+0x2a>
+		if (i % 32 == 0 && ch->map[i / 32] == 0) {
+  8043c5:	85 ff                	test   %edi,%edi
+  8043c7:	75 b8                	jne    804381 <va_chunk_scan+0x31>
+			i += 31;
+  8043c9:	83 c0 1f             	add    $0x1f,%eax
+			len += 32;
+  8043cc:	83 c2 20             	add    $0x20,%edx
+  8043cf:	eb c9                	jmp    80439a <va_chunk_scan+0x4a>
+			return i + 1 - len;
+  8043d1:	83 c0 01             	add    $0x1,%eax
+  8043d4:	29 d0                	sub    %edx,%eax
+  8043d6:	eb 15                	jmp    8043ed <va_chunk_scan+0x9d>
+			len = 0;
+  8043d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043dd:	eb c5                	jmp    8043a4 <va_chunk_scan+0x54>
+	}
+	if (run_store)
+		*run_store = best;
+	return -1;
+  8043df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+	if (run_store)
+  8043e4:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  8043e7:	85 d2                	test   %edx,%edx
+  8043e9:	74 02                	je     8043ed <va_chunk_scan+0x9d>
+		*run_store = best;
+  8043eb:	89 1a                	mov    %ebx,(%edx)
+}
+  8043ed:	83 c4 0c             	add    $0xc,%esp
+  8043f0:	5b                   	pop    %ebx
+  8043f1:	5e                   	pop    %esi
+  8043f2:	5f                   	pop    %edi
+  8043f3:	5d                   	pop    %ebp
+  8043f4:	c3                   	ret
+
+008043f5 <va_chunk_mark>:
+
+// Mark pages [i, i+n) of chunk c as allocated (alloc != 0) or free,
+// and bring its summary up to date
+static void
+va_chunk_mark(int c, uint32_t i, uint32_t n, int alloc)
+{
+  8043f5:	55                   	push   %ebp
+  8043f6:	89 e5                	mov    %esp,%ebp
+  8043f8:	57                   	push   %edi
+  8043f9:	56                   	push   %esi
+  8043fa:	53                   	push   %ebx
+  8043fb:	83 ec 14             	sub    $0x14,%esp
+  8043fe:	89 c3                	mov    %eax,%ebx
+  804400:	89 d0                	mov    %edx,%eax
+	struct va_chunk *ch = &va_chunks[c];
+  804402:	69 d3 84 00 00 00    	imul   $0x84,%ebx,%edx
+  804408:	8d ba a0 da 80 00    	lea    0x80daa0(%edx),%edi
+  80440e:	89 7d e0             	mov    %edi,-0x20(%ebp)
+	uint32_t run;
+
+	for (; n > 0; i++, n--) {
+  804411:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if (alloc)
+			ch->map[i / 32] |= 1 << (i % 32);
+		else
+			ch->map[i / 32] &= ~(1 << (i % 32));
+		ch->nfree += alloc ? -1 : 1;
+  804414:	89 d6                	mov    %edx,%esi
+  804416:	81 c6 a0 da 80 00    	add    $0x80daa0,%esi
+  80441c:	89 c1                	mov    %eax,%ecx
+	for (; n > 0; i++, n--) {
+  80441e:	eb 34                	jmp    804454 <va_chunk_mark+0x5f>
+			ch->map[i / 32] &= ~(1 << (i % 32));
+  804420:	89 c8                	mov    %ecx,%eax
+  804422:	c1 e8 05             	shr    $0x5,%eax
+  804425:	89 da                	mov    %ebx,%edx
+  804427:	c1 e2 05             	shl    $0x5,%edx
+  80442a:	01 da                	add    %ebx,%edx
+  80442c:	01 c2                	add    %eax,%edx
+  80442e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  804433:	d3 c0                	rol    %cl,%eax
+  804435:	21 04 95 a0 da 80 00 	and    %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80443c:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804443:	b8 01 00 00 00       	mov    $0x1,%eax
+  804448:	01 d0                	add    %edx,%eax
+  80444a:	66 89 86 80 00 00 00 	mov    %ax,0x80(%esi)
+	for (; n > 0; i++, n--) {
+  804451:	83 c1 01             	add    $0x1,%ecx
+  804454:	39 f9                	cmp    %edi,%ecx
+  804456:	74 30                	je     804488 <va_chunk_mark+0x93>
+		if (alloc)
+  804458:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80445c:	74 c2                	je     804420 <va_chunk_mark+0x2b>
+			ch->map[i / 32] |= 1 << (i % 32);
+  80445e:	89 c8                	mov    %ecx,%eax
+  804460:	c1 e8 05             	shr    $0x5,%eax
+  804463:	89 da                	mov    %ebx,%edx
+  804465:	c1 e2 05             	shl    $0x5,%edx
+  804468:	01 da                	add    %ebx,%edx
+  80446a:	01 c2                	add    %eax,%edx
+  80446c:	b8 01 00 00 00       	mov    $0x1,%eax
+  804471:	d3 e0                	shl    %cl,%eax
+  804473:	09 04 95 a0 da 80 00 	or     %eax,0x80daa0(,%edx,4)
+		ch->nfree += alloc ? -1 : 1;
+  80447a:	0f b7 96 80 00 00 00 	movzwl 0x80(%esi),%edx
+  804481:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  804486:	eb c0                	jmp    804448 <va_chunk_mark+0x53>
+	}
+	va_chunk_scan(ch, 0, &run);
+  804488:	8d 4d f0             	lea    -0x10(%ebp),%ecx
+  80448b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804490:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804493:	e8 b8 fe ff ff       	call   804350 <va_chunk_scan>
+	ch->run = run;
+  804498:	69 db 84 00 00 00    	imul   $0x84,%ebx,%ebx
+  80449e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8044a1:	66 89 83 22 db 80 00 	mov    %ax,0x80db22(%ebx)
+}
+  8044a8:	83 c4 14             	add    $0x14,%esp
+  8044ab:	5b                   	pop    %ebx
+  8044ac:	5e                   	pop    %esi
+  8044ad:	5f                   	pop    %edi
+  8044ae:	5d                   	pop    %ebp
+  8044af:	c3                   	ret
+
+008044b0 <va_alloc>:
+// Allocate npages pages' worth of address space, returning its start.
+// Nothing is mapped there.
+// On error, return NULL
+void *
+va_alloc(size_t npages)
+{
+  8044b0:	55                   	push   %ebp
+  8044b1:	89 e5                	mov    %esp,%ebp
+  8044b3:	57                   	push   %edi
+  8044b4:	56                   	push   %esi
+  8044b5:	53                   	push   %ebx
+  8044b6:	83 ec 04             	sub    $0x4,%esp
+  8044b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	uint32_t need;
+	int c, first, i;
+
+	if (!va_inited)
+  8044bc:	b8 20 db 80 00       	mov    $0x80db20,%eax
+  8044c1:	ba 90 e9 80 00       	mov    $0x80e990,%edx
+  8044c6:	80 3d 80 da 80 00 00 	cmpb   $0x0,0x80da80
+  8044cd:	74 4f                	je     80451e <va_alloc+0x6e>
+		va_init();
+	if (npages == 0 || npages > VA_NCHUNKS*NPTENTRIES)
+  8044cf:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8044d2:	3d ff 6f 00 00       	cmp    $0x6fff,%eax
+  8044d7:	0f 87 01 01 00 00    	ja     8045de <va_alloc+0x12e>
+		return NULL;
+
+	if (npages <= NPTENTRIES) {
+  8044dd:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+  8044e3:	0f 87 80 00 00 00    	ja     804569 <va_alloc+0xb9>
+  8044e9:	b8 22 db 80 00       	mov    $0x80db22,%eax
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8044ee:	be 00 00 00 00       	mov    $0x0,%esi
+			if (va_chunks[c].run < npages)
+  8044f3:	0f b7 10             	movzwl (%eax),%edx
+  8044f6:	05 84 00 00 00       	add    $0x84,%eax
+  8044fb:	39 da                	cmp    %ebx,%edx
+  8044fd:	73 2c                	jae    80452b <va_alloc+0x7b>
+		for (c = 0; c < VA_NCHUNKS; c++) {
+  8044ff:	83 c6 01             	add    $0x1,%esi
+  804502:	83 fe 1c             	cmp    $0x1c,%esi
+  804505:	75 ec                	jne    8044f3 <va_alloc+0x43>
+				continue;
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+			va_chunk_mark(c, i, npages, 1);
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+		}
+		return NULL;
+  804507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80450c:	eb 53                	jmp    804561 <va_alloc+0xb1>
+		va_chunks[c].nfree = va_chunks[c].run = NPTENTRIES;
+  80450e:	66 c7 40 02 00 04    	movw   $0x400,0x2(%eax)
+  804514:	66 c7 00 00 04       	movw   $0x400,(%eax)
+	for (c = 0; c < VA_NCHUNKS; c++)
+  804519:	05 84 00 00 00       	add    $0x84,%eax
+  80451e:	39 d0                	cmp    %edx,%eax
+  804520:	75 ec                	jne    80450e <va_alloc+0x5e>
+	va_inited = 1;
+  804522:	c6 05 80 da 80 00 01 	movb   $0x1,0x80da80
+}
+  804529:	eb a4                	jmp    8044cf <va_alloc+0x1f>
+			i = va_chunk_scan(&va_chunks[c], npages, NULL);
+  80452b:	69 c6 84 00 00 00    	imul   $0x84,%esi,%eax
+  804531:	05 a0 da 80 00       	add    $0x80daa0,%eax
+  804536:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80453b:	89 da                	mov    %ebx,%edx
+  80453d:	e8 0e fe ff ff       	call   804350 <va_chunk_scan>
+  804542:	89 c7                	mov    %eax,%edi
+			va_chunk_mark(c, i, npages, 1);
+  804544:	6a 01                	push   $0x1
+  804546:	89 d9                	mov    %ebx,%ecx
+  804548:	89 c2                	mov    %eax,%edx
+  80454a:	89 f0                	mov    %esi,%eax
+  80454c:	e8 a4 fe ff ff       	call   8043f5 <va_chunk_mark>
+			return (void *) UHEAP + c*PTSIZE + i*PGSIZE;
+  804551:	c1 e6 16             	shl    $0x16,%esi
+  804554:	c1 e7 0c             	shl    $0xc,%edi
+  804557:	8d 84 3e 00 00 00 08 	lea    0x8000000(%esi,%edi,1),%eax
+  80455e:	83 c4 04             	add    $0x4,%esp
+			}
+			return (void *) UHEAP + first*PTSIZE;
+		}
+	}
+	return NULL;
+}
+  804561:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804564:	5b                   	pop    %ebx
+  804565:	5e                   	pop    %esi
+  804566:	5f                   	pop    %edi
+  804567:	5d                   	pop    %ebp
+  804568:	c3                   	ret
+	need = ROUNDUP(npages, NPTENTRIES) / NPTENTRIES;
+  804569:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  80456f:	c1 ee 0a             	shr    $0xa,%esi
+  804572:	ba 01 00 00 00       	mov    $0x1,%edx
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80457c:	eb 0a                	jmp    804588 <va_alloc+0xd8>
+			first = c + 1;
+  80457e:	89 d0                	mov    %edx,%eax
+	for (c = first = 0; c < VA_NCHUNKS; c++) {
+  804580:	83 c2 01             	add    $0x1,%edx
+  804583:	83 fa 1d             	cmp    $0x1d,%edx
+  804586:	74 4f                	je     8045d7 <va_alloc+0x127>
+		if (va_chunks[c].nfree != NPTENTRIES) {
+  804588:	69 ca 84 00 00 00    	imul   $0x84,%edx,%ecx
+  80458e:	66 81 b9 9c da 80 00 	cmpw   $0x400,0x80da9c(%ecx)
+  804595:	00 04 
+  804597:	75 e5                	jne    80457e <va_alloc+0xce>
+		if (c + 1 - first == need) {
+  804599:	89 d1                	mov    %edx,%ecx
+  80459b:	29 c1                	sub    %eax,%ecx
+  80459d:	39 f1                	cmp    %esi,%ecx
+  80459f:	75 df                	jne    804580 <va_alloc+0xd0>
+  8045a1:	89 c7                	mov    %eax,%edi
+  8045a3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+				va_chunk_mark(c, 0, MIN(npages, NPTENTRIES), 1);
+  8045a6:	be 00 04 00 00       	mov    $0x400,%esi
+  8045ab:	39 f3                	cmp    %esi,%ebx
+  8045ad:	0f 46 f3             	cmovbe %ebx,%esi
+  8045b0:	6a 01                	push   $0x1
+  8045b2:	89 f1                	mov    %esi,%ecx
+  8045b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045b9:	89 f8                	mov    %edi,%eax
+  8045bb:	e8 35 fe ff ff       	call   8043f5 <va_chunk_mark>
+			for (c = first; npages > 0; c++) {
+  8045c0:	83 c7 01             	add    $0x1,%edi
+  8045c3:	83 c4 04             	add    $0x4,%esp
+  8045c6:	29 f3                	sub    %esi,%ebx
+  8045c8:	75 dc                	jne    8045a6 <va_alloc+0xf6>
+			return (void *) UHEAP + first*PTSIZE;
+  8045ca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8045cd:	c1 e0 16             	shl    $0x16,%eax
+  8045d0:	05 00 00 00 08       	add    $0x8000000,%eax
+  8045d5:	eb 8a                	jmp    804561 <va_alloc+0xb1>
+	return NULL;
+  8045d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045dc:	eb 83                	jmp    804561 <va_alloc+0xb1>
+		return NULL;
+  8045de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e3:	e9 79 ff ff ff       	jmp    804561 <va_alloc+0xb1>
+
+008045e8 <va_free>:
+
+// Give back npages pages' worth of address space starting at va, which
+// must have come from va_alloc.  Whatever is mapped there stays mapped.
+void
+va_free(void *va, size_t npages)
+{
+  8045e8:	55                   	push   %ebp
+  8045e9:	89 e5                	mov    %esp,%ebp
+  8045eb:	57                   	push   %edi
+  8045ec:	56                   	push   %esi
+  8045ed:	53                   	push   %ebx
+  8045ee:	83 ec 0c             	sub    $0xc,%esp
+  8045f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8045f4:	8b 75 0c             	mov    0xc(%ebp),%esi
+	uint32_t i, n;
+	int c;
+
+	if ((uintptr_t) va < UHEAP || (uintptr_t) va + npages*PGSIZE > UHEAPTOP
+  8045f7:	81 ff ff ff ff 07    	cmp    $0x7ffffff,%edi
+  8045fd:	76 21                	jbe    804620 <va_free+0x38>
+  8045ff:	89 f0                	mov    %esi,%eax
+  804601:	c1 e0 0c             	shl    $0xc,%eax
+  804604:	01 f8                	add    %edi,%eax
+  804606:	3d 00 00 00 0f       	cmp    $0xf000000,%eax
+  80460b:	77 13                	ja     804620 <va_free+0x38>
+	    || PGOFF(va))
+  80460d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804613:	75 0b                	jne    804620 <va_free+0x38>
+		panic("va_free: bad range %p, %d pages", va, npages);
+
+	i = ((uintptr_t) va - UHEAP) / PGSIZE;
+  804615:	81 ef 00 00 00 08    	sub    $0x8000000,%edi
+  80461b:	c1 ef 0c             	shr    $0xc,%edi
+	while (npages > 0) {
+  80461e:	eb 45                	jmp    804665 <va_free+0x7d>
+		panic("va_free: bad range %p, %d pages", va, npages);
+  804620:	83 ec 0c             	sub    $0xc,%esp
+  804623:	56                   	push   %esi
+  804624:	57                   	push   %edi
+  804625:	68 48 58 80 00       	push   $0x805848
+  80462a:	68 8e 00 00 00       	push   $0x8e
+  80462f:	68 68 58 80 00       	push   $0x805868
+  804634:	e8 c5 bb ff ff       	call   8001fe <_panic>
+		c = i / NPTENTRIES;
+		n = MIN(npages, NPTENTRIES - i % NPTENTRIES);
+  804639:	89 fa                	mov    %edi,%edx
+  80463b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804641:	bb 00 04 00 00       	mov    $0x400,%ebx
+  804646:	29 d3                	sub    %edx,%ebx
+  804648:	39 f3                	cmp    %esi,%ebx
+  80464a:	0f 47 de             	cmova  %esi,%ebx
+		c = i / NPTENTRIES;
+  80464d:	89 f8                	mov    %edi,%eax
+  80464f:	c1 e8 0a             	shr    $0xa,%eax
+		va_chunk_mark(c, i % NPTENTRIES, n, 0);
+  804652:	83 ec 0c             	sub    $0xc,%esp
+  804655:	6a 00                	push   $0x0
+  804657:	89 d9                	mov    %ebx,%ecx
+  804659:	e8 97 fd ff ff       	call   8043f5 <va_chunk_mark>
+		i += n;
+  80465e:	01 df                	add    %ebx,%edi
+		npages -= n;
+  804660:	29 de                	sub    %ebx,%esi
+  804662:	83 c4 10             	add    $0x10,%esp
+	while (npages > 0) {
+  804665:	85 f6                	test   %esi,%esi
+  804667:	75 d0                	jne    804639 <va_free+0x51>
+	}
+}
+  804669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80466c:	5b                   	pop    %ebx
+  80466d:	5e                   	pop    %esi
+  80466e:	5f                   	pop    %edi
+  80466f:	5d                   	pop    %ebp
+  804670:	c3                   	ret
+
+00804671 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  804671:	b8 00 00 00 00       	mov    $0x0,%eax
+  804676:	c3                   	ret
+
+00804677 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  804677:	55                   	push   %ebp
+  804678:	89 e5                	mov    %esp,%ebp
+  80467a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80467d:	68 75 58 80 00       	push   $0x805875
+  804682:	ff 75 0c             	push   0xc(%ebp)
+  804685:	e8 36 c2 ff ff       	call   8008c0 <strcpy>
+	return 0;
+}
+  80468a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80468f:	c9                   	leave
+  804690:	c3                   	ret
+
+00804691 <devcons_write>:
+{
+  804691:	55                   	push   %ebp
+  804692:	89 e5                	mov    %esp,%ebp
+  804694:	57                   	push   %edi
+  804695:	56                   	push   %esi
+  804696:	53                   	push   %ebx
+  804697:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80469d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8046a2:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8046a8:	eb 2e                	jmp    8046d8 <devcons_write+0x47>
+		m = n - tot;
+  8046aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8046ad:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8046af:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8046b4:	39 c3                	cmp    %eax,%ebx
+  8046b6:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8046b9:	83 ec 04             	sub    $0x4,%esp
+  8046bc:	53                   	push   %ebx
+  8046bd:	89 f0                	mov    %esi,%eax
+  8046bf:	03 45 0c             	add    0xc(%ebp),%eax
+  8046c2:	50                   	push   %eax
+  8046c3:	57                   	push   %edi
+  8046c4:	e8 7d c3 ff ff       	call   800a46 <memmove>
+		sys_cputs(buf, m);
+  8046c9:	83 c4 08             	add    $0x8,%esp
+  8046cc:	53                   	push   %ebx
+  8046cd:	57                   	push   %edi
+  8046ce:	e8 13 c6 ff ff       	call   800ce6 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8046d3:	01 de                	add    %ebx,%esi
+  8046d5:	83 c4 10             	add    $0x10,%esp
+  8046d8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8046db:	72 cd                	jb     8046aa <devcons_write+0x19>
+}
+  8046dd:	89 f0                	mov    %esi,%eax
+  8046df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8046e2:	5b                   	pop    %ebx
+  8046e3:	5e                   	pop    %esi
+  8046e4:	5f                   	pop    %edi
+  8046e5:	5d                   	pop    %ebp
+  8046e6:	c3                   	ret
+
+008046e7 <devcons_read>:
+{
+  8046e7:	55                   	push   %ebp
+  8046e8:	89 e5                	mov    %esp,%ebp
+  8046ea:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8046ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046f2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8046f6:	75 07                	jne    8046ff <devcons_read+0x18>
+  8046f8:	eb 1f                	jmp    804719 <devcons_read+0x32>
+		sys_yield();
+  8046fa:	e8 95 c6 ff ff       	call   800d94 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8046ff:	e8 11 c6 ff ff       	call   800d15 <sys_cgetc>
+  804704:	85 c0                	test   %eax,%eax
+  804706:	74 f2                	je     8046fa <devcons_read+0x13>
+	if (c < 0)
+  804708:	78 0f                	js     804719 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  80470a:	83 f8 04             	cmp    $0x4,%eax
+  80470d:	74 0c                	je     80471b <devcons_read+0x34>
+	*(char*)vbuf = c;
+  80470f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  804712:	88 02                	mov    %al,(%edx)
+	return 1;
+  804714:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  804719:	c9                   	leave
+  80471a:	c3                   	ret
+		return 0;
+  80471b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804720:	eb f7                	jmp    804719 <devcons_read+0x32>
+
+00804722 <cputchar>:
+{
+  804722:	55                   	push   %ebp
+  804723:	89 e5                	mov    %esp,%ebp
+  804725:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  804728:	8b 45 08             	mov    0x8(%ebp),%eax
+  80472b:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  80472e:	6a 01                	push   $0x1
+  804730:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804733:	50                   	push   %eax
+  804734:	e8 ad c5 ff ff       	call   800ce6 <sys_cputs>
+}
+  804739:	83 c4 10             	add    $0x10,%esp
+  80473c:	c9                   	leave
+  80473d:	c3                   	ret
+
+0080473e <getchar>:
+{
+  80473e:	55                   	push   %ebp
+  80473f:	89 e5                	mov    %esp,%ebp
+  804741:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  804744:	6a 01                	push   $0x1
+  804746:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  804749:	50                   	push   %eax
+  80474a:	6a 00                	push   $0x0
+  80474c:	e8 d7 ce ff ff       	call   801628 <read>
+	if (r < 0)
+  804751:	83 c4 10             	add    $0x10,%esp
+  804754:	85 c0                	test   %eax,%eax
+  804756:	78 06                	js     80475e <getchar+0x20>
+	if (r < 1)
+  804758:	74 06                	je     804760 <getchar+0x22>
+	return c;
+  80475a:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80475e:	c9                   	leave
+  80475f:	c3                   	ret
+		return -E_EOF;
+  804760:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  804765:	eb f7                	jmp    80475e <getchar+0x20>
+
+00804767 <iscons>:
+{
+  804767:	55                   	push   %ebp
+  804768:	89 e5                	mov    %esp,%ebp
+  80476a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80476d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804770:	50                   	push   %eax
+  804771:	ff 75 08             	push   0x8(%ebp)
+  804774:	e8 50 cc ff ff       	call   8013c9 <fd_lookup>
+  804779:	83 c4 10             	add    $0x10,%esp
+  80477c:	85 c0                	test   %eax,%eax
+  80477e:	78 11                	js     804791 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  804780:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804783:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  804789:	39 10                	cmp    %edx,(%eax)
+  80478b:	0f 94 c0             	sete   %al
+  80478e:	0f b6 c0             	movzbl %al,%eax
+}
+  804791:	c9                   	leave
+  804792:	c3                   	ret
+
+00804793 <opencons>:
+{
+  804793:	55                   	push   %ebp
+  804794:	89 e5                	mov    %esp,%ebp
+  804796:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  804799:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80479c:	50                   	push   %eax
+  80479d:	e8 d3 cb ff ff       	call   801375 <fd_alloc>
+  8047a2:	83 c4 10             	add    $0x10,%esp
+  8047a5:	85 c0                	test   %eax,%eax
+  8047a7:	78 3a                	js     8047e3 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8047a9:	83 ec 04             	sub    $0x4,%esp
+  8047ac:	68 07 04 00 00       	push   $0x407
+  8047b1:	ff 75 f4             	push   -0xc(%ebp)
+  8047b4:	6a 00                	push   $0x0
+  8047b6:	e8 f8 c5 ff ff       	call   800db3 <sys_page_alloc>
+  8047bb:	83 c4 10             	add    $0x10,%esp
+  8047be:	85 c0                	test   %eax,%eax
+  8047c0:	78 21                	js     8047e3 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  8047c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047c5:	8b 15 44 60 80 00    	mov    0x806044,%edx
+  8047cb:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8047cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8047d0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8047d7:	83 ec 0c             	sub    $0xc,%esp
+  8047da:	50                   	push   %eax
+  8047db:	e8 6e cb ff ff       	call   80134e <fd2num>
+  8047e0:	83 c4 10             	add    $0x10,%esp
+}
+  8047e3:	c9                   	leave
+  8047e4:	c3                   	ret
+
+008047e5 <_pgfault_handler_wrapper>:
+// Array of pointers to currently installed C-language pgfault handlers.
+int (*_pgfault_handlers[MAX_PGFAULT_HANDLERS])(struct UTrapframe *utf);
+size_t num_pgfault_handlers=0;
+
+// C-language wrapper to call into the installed pgfault handlers.
+void _pgfault_handler_wrapper(struct UTrapframe *utf){
+  8047e5:	55                   	push   %ebp
+  8047e6:	89 e5                	mov    %esp,%ebp
+  8047e8:	56                   	push   %esi
+  8047e9:	53                   	push   %ebx
+  8047ea:	8b 75 08             	mov    0x8(%ebp),%esi
+	int i, r;
+
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  8047ed:	a1 10 e9 80 00       	mov    0x80e910,%eax
+  8047f2:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  8047f5:	85 db                	test   %ebx,%ebx
+  8047f7:	78 17                	js     804810 <_pgfault_handler_wrapper+0x2b>
+		if((r = (*_pgfault_handlers[i])(utf)))
+  8047f9:	83 ec 0c             	sub    $0xc,%esp
+  8047fc:	56                   	push   %esi
+  8047fd:	ff 14 9d 00 00 81 00 	call   *0x810000(,%ebx,4)
+  804804:	83 c4 10             	add    $0x10,%esp
+  804807:	85 c0                	test   %eax,%eax
+  804809:	75 27                	jne    804832 <_pgfault_handler_wrapper+0x4d>
+	for(i = num_pgfault_handlers - 1; i >= 0; i--){
+  80480b:	83 eb 01             	sub    $0x1,%ebx
+  80480e:	eb e5                	jmp    8047f5 <_pgfault_handler_wrapper+0x10>
+			return;
+	}
+
+	panic("[%08x] user fault va %08x ip %08x\n", thisenv->env_id, utf->utf_fault_va, utf->utf_eip);
+  804810:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804815:	8b 40 48             	mov    0x48(%eax),%eax
+  804818:	83 ec 08             	sub    $0x8,%esp
+  80481b:	ff 76 28             	push   0x28(%esi)
+  80481e:	ff 36                	push   (%esi)
+  804820:	50                   	push   %eax
+  804821:	68 84 58 80 00       	push   $0x805884
+  804826:	6a 1d                	push   $0x1d
+  804828:	68 a7 58 80 00       	push   $0x8058a7
+  80482d:	e8 cc b9 ff ff       	call   8001fe <_panic>
+}
+  804832:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804835:	5b                   	pop    %ebx
+  804836:	5e                   	pop    %esi
+  804837:	5d                   	pop    %ebp
+  804838:	c3                   	ret
+
+00804839 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804839:	55                   	push   %ebp
+  80483a:	89 e5                	mov    %esp,%ebp
+  80483c:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	if(_pgfault_handler == 0) {
+  80483f:	83 3d 28 00 81 00 00 	cmpl   $0x0,0x810028
+  804846:	74 0a                	je     804852 <set_pgfault_handler+0x19>
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  804848:	8b 45 08             	mov    0x8(%ebp),%eax
+  80484b:	a3 28 00 81 00       	mov    %eax,0x810028
+}
+  804850:	c9                   	leave
+  804851:	c3                   	ret
+		sys_page_alloc(0, (void *)(UXSTACKTOP-PGSIZE), PTE_W|PTE_U|PTE_P);
+  804852:	83 ec 04             	sub    $0x4,%esp
+  804855:	6a 07                	push   $0x7
+  804857:	68 00 f0 bf ee       	push   $0xeebff000
+  80485c:	6a 00                	push   $0x0
+  80485e:	e8 50 c5 ff ff       	call   800db3 <sys_page_alloc>
+		sys_env_set_pgfault_upcall(0, _pgfault_upcall);
+  804863:	83 c4 08             	add    $0x8,%esp
+  804866:	68 d9 48 80 00       	push   $0x8048d9
+  80486b:	6a 00                	push   $0x0
+  80486d:	e8 a7 c8 ff ff       	call   801119 <sys_env_set_pgfault_upcall>
+  804872:	83 c4 10             	add    $0x10,%esp
+  804875:	eb d1                	jmp    804848 <set_pgfault_handler+0xf>
+
+00804877 <add_pgfault_handler>:
+
+
+void
+add_pgfault_handler(int (*handler)(struct UTrapframe *utf))
+{
+  804877:	55                   	push   %ebp
+  804878:	89 e5                	mov    %esp,%ebp
+  80487a:	83 ec 08             	sub    $0x8,%esp
+  80487d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i, r;
+
+	// Check if we've already added this handler
+	for(i = 0; i < num_pgfault_handlers; i++)
+  804880:	8b 15 10 e9 80 00    	mov    0x80e910,%edx
+  804886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80488b:	eb 03                	jmp    804890 <add_pgfault_handler+0x19>
+  80488d:	83 c0 01             	add    $0x1,%eax
+  804890:	39 d0                	cmp    %edx,%eax
+  804892:	74 0b                	je     80489f <add_pgfault_handler+0x28>
+		if(_pgfault_handlers[i] == handler)
+  804894:	39 0c 85 00 00 81 00 	cmp    %ecx,0x810000(,%eax,4)
+  80489b:	75 f0                	jne    80488d <add_pgfault_handler+0x16>
+  80489d:	eb 24                	jmp    8048c3 <add_pgfault_handler+0x4c>
+			return;
+
+	if (num_pgfault_handlers == MAX_PGFAULT_HANDLERS)
+  80489f:	83 fa 0a             	cmp    $0xa,%edx
+  8048a2:	74 21                	je     8048c5 <add_pgfault_handler+0x4e>
+		panic("Too many pgfault handlers!");
+
+	_pgfault_handlers[num_pgfault_handlers++] = handler;
+  8048a4:	8d 42 01             	lea    0x1(%edx),%eax
+  8048a7:	a3 10 e9 80 00       	mov    %eax,0x80e910
+  8048ac:	89 0c 95 00 00 81 00 	mov    %ecx,0x810000(,%edx,4)
+	set_pgfault_handler(_pgfault_handler_wrapper);
+  8048b3:	83 ec 0c             	sub    $0xc,%esp
+  8048b6:	68 e5 47 80 00       	push   $0x8047e5
+  8048bb:	e8 79 ff ff ff       	call   804839 <set_pgfault_handler>
+  8048c0:	83 c4 10             	add    $0x10,%esp
+}
+  8048c3:	c9                   	leave
+  8048c4:	c3                   	ret
+		panic("Too many pgfault handlers!");
+  8048c5:	83 ec 04             	sub    $0x4,%esp
+  8048c8:	68 b5 58 80 00       	push   $0x8058b5
+  8048cd:	6a 44                	push   $0x44
+  8048cf:	68 a7 58 80 00       	push   $0x8058a7
+  8048d4:	e8 25 b9 ff ff       	call   8001fe <_panic>
+
+008048d9 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8048d9:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8048da:	a1 28 00 81 00       	mov    0x810028,%eax
+	call *%eax
+  8048df:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8048e1:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl 40(%esp), %eax     // Get the trap-time %eip, temporarily store it in %eax.
+  8048e4:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl 48(%esp), %ecx     // Get the trap-time stack, temporarily store it in %ecx.
+  8048e8:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+
+	// Push the trap-time %eip onto the trap-time stack.
+	subl $4, %ecx
+  8048ec:	83 e9 04             	sub    $0x4,%ecx
+	movl %eax, 0x0(%ecx)
+  8048ef:	89 01                	mov    %eax,(%ecx)
+	movl %ecx, 48(%esp)     // Update the location of the trap-time stack in the UTrapframe.
+  8048f1:	89 4c 24 30          	mov    %ecx,0x30(%esp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl $8, %esp       // We don't need utf_fault_va or utf_err, so remove them from the stack.
+  8048f5:	83 c4 08             	add    $0x8,%esp
+	popal       // Pop all of the stored register value in utf_regs, restoring the physical registers.
+  8048f8:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl $4, %esp       // We don't need utf_eip, so remove it from the stack.
+  8048f9:	83 c4 04             	add    $0x4,%esp
+	popfl       // Pop utf_eflags off the stack and into the %eflags register.
+  8048fc:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl %esp       // Pop utf_esp, move the stack pointer to this location.
+  8048fd:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8048fe:	c3                   	ret
+
+008048ff <ipc_recv_pages>:
+// pages starting at 'pg'.  If 'npages_store' is nonnull, then store
+// the number of pages mapped in *npages_store.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t npages,
+	       int *perm_store, size_t *npages_store)
+{
+  8048ff:	55                   	push   %ebp
+  804900:	89 e5                	mov    %esp,%ebp
+  804902:	57                   	push   %edi
+  804903:	56                   	push   %esi
+  804904:	53                   	push   %ebx
+  804905:	83 ec 14             	sub    $0x14,%esp
+  804908:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80490b:	8b 75 14             	mov    0x14(%ebp),%esi
+  80490e:	8b 5d 18             	mov    0x18(%ebp),%ebx
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_recv_pages(pg, npages)) < 0) {
+  804911:	ff 75 10             	push   0x10(%ebp)
+  804914:	ff 75 0c             	push   0xc(%ebp)
+  804917:	e8 ba c8 ff ff       	call   8011d6 <sys_ipc_recv_pages>
+  80491c:	83 c4 10             	add    $0x10,%esp
+  80491f:	85 c0                	test   %eax,%eax
+  804921:	78 46                	js     804969 <ipc_recv_pages+0x6a>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804923:	85 ff                	test   %edi,%edi
+  804925:	74 0d                	je     804934 <ipc_recv_pages+0x35>
+		*from_env_store = thisenv->env_ipc_from;
+  804927:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80492c:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804932:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804934:	85 f6                	test   %esi,%esi
+  804936:	74 0d                	je     804945 <ipc_recv_pages+0x46>
+		*perm_store = thisenv->env_ipc_perm;
+  804938:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80493d:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804943:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804945:	85 db                	test   %ebx,%ebx
+  804947:	74 0d                	je     804956 <ipc_recv_pages+0x57>
+		*npages_store = thisenv->env_ipc_npages;
+  804949:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80494e:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804954:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804956:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  80495b:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804961:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804964:	5b                   	pop    %ebx
+  804965:	5e                   	pop    %esi
+  804966:	5f                   	pop    %edi
+  804967:	5d                   	pop    %ebp
+  804968:	c3                   	ret
+		if (from_env_store) {
+  804969:	85 ff                	test   %edi,%edi
+  80496b:	74 06                	je     804973 <ipc_recv_pages+0x74>
+			*from_env_store = 0;
+  80496d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804973:	85 f6                	test   %esi,%esi
+  804975:	74 06                	je     80497d <ipc_recv_pages+0x7e>
+			*perm_store = 0;
+  804977:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  80497d:	85 db                	test   %ebx,%ebx
+  80497f:	74 e0                	je     804961 <ipc_recv_pages+0x62>
+			*npages_store = 0;
+  804981:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804987:	eb d8                	jmp    804961 <ipc_recv_pages+0x62>
+
+00804989 <ipc_recv>:
+{
+  804989:	55                   	push   %ebp
+  80498a:	89 e5                	mov    %esp,%ebp
+  80498c:	83 ec 14             	sub    $0x14,%esp
+	return ipc_recv_pages(from_env_store, pg, 1, perm_store, NULL);
+  80498f:	6a 00                	push   $0x0
+  804991:	ff 75 10             	push   0x10(%ebp)
+  804994:	6a 01                	push   $0x1
+  804996:	ff 75 0c             	push   0xc(%ebp)
+  804999:	ff 75 08             	push   0x8(%ebp)
+  80499c:	e8 5e ff ff ff       	call   8048ff <ipc_recv_pages>
+}
+  8049a1:	c9                   	leave
+  8049a2:	c3                   	ret
+
+008049a3 <ipc_try_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_try_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8049a3:	55                   	push   %ebp
+  8049a4:	89 e5                	mov    %esp,%ebp
+  8049a6:	56                   	push   %esi
+  8049a7:	53                   	push   %ebx
+  8049a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8049ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int32_t r;
+	if ((r = (int32_t)sys_ipc_try_recv(pg)) < 0) {
+  8049ae:	83 ec 0c             	sub    $0xc,%esp
+  8049b1:	ff 75 0c             	push   0xc(%ebp)
+  8049b4:	e8 51 c9 ff ff       	call   80130a <sys_ipc_try_recv>
+  8049b9:	83 c4 10             	add    $0x10,%esp
+  8049bc:	85 c0                	test   %eax,%eax
+  8049be:	78 34                	js     8049f4 <ipc_try_recv+0x51>
+		if (perm_store) {
+			*perm_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  8049c0:	85 f6                	test   %esi,%esi
+  8049c2:	74 0d                	je     8049d1 <ipc_try_recv+0x2e>
+		*from_env_store = thisenv->env_ipc_from;
+  8049c4:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049c9:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  8049cf:	89 06                	mov    %eax,(%esi)
+	}
+	if (perm_store) {
+  8049d1:	85 db                	test   %ebx,%ebx
+  8049d3:	74 0d                	je     8049e2 <ipc_try_recv+0x3f>
+		*perm_store = thisenv->env_ipc_perm;
+  8049d5:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049da:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  8049e0:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  8049e2:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  8049e7:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  8049ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8049f0:	5b                   	pop    %ebx
+  8049f1:	5e                   	pop    %esi
+  8049f2:	5d                   	pop    %ebp
+  8049f3:	c3                   	ret
+		if (from_env_store) {
+  8049f4:	85 f6                	test   %esi,%esi
+  8049f6:	74 06                	je     8049fe <ipc_try_recv+0x5b>
+			*from_env_store = 0;
+  8049f8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (perm_store) {
+  8049fe:	85 db                	test   %ebx,%ebx
+  804a00:	74 eb                	je     8049ed <ipc_try_recv+0x4a>
+			*perm_store = 0;
+  804a02:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804a08:	eb e3                	jmp    8049ed <ipc_try_recv+0x4a>
+
+00804a0a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg' (if 'pg'
+// is nonnull) in one go.  The receiver gets as many of them as it asked
+// for.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a0a:	55                   	push   %ebp
+  804a0b:	89 e5                	mov    %esp,%ebp
+  804a0d:	83 ec 14             	sub    $0x14,%esp
+  804a10:	8b 45 10             	mov    0x10(%ebp),%eax
+	// LAB 4: Your code here.
+	int r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a13:	85 c0                	test   %eax,%eax
+  804a15:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a1a:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if((r = sys_ipc_send_pages(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a1d:	ff 75 18             	push   0x18(%ebp)
+  804a20:	ff 75 14             	push   0x14(%ebp)
+  804a23:	50                   	push   %eax
+  804a24:	ff 75 0c             	push   0xc(%ebp)
+  804a27:	ff 75 08             	push   0x8(%ebp)
+  804a2a:	e8 6a c7 ff ff       	call   801199 <sys_ipc_send_pages>
+  804a2f:	83 c4 20             	add    $0x20,%esp
+  804a32:	85 c0                	test   %eax,%eax
+  804a34:	78 02                	js     804a38 <ipc_send_pages+0x2e>
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+	}
+}
+  804a36:	c9                   	leave
+  804a37:	c3                   	ret
+		panic("ipc_send: sys_ipc_send failed with error %d", r);
+  804a38:	50                   	push   %eax
+  804a39:	68 d0 58 80 00       	push   $0x8058d0
+  804a3e:	68 80 00 00 00       	push   $0x80
+  804a43:	68 fc 58 80 00       	push   $0x8058fc
+  804a48:	e8 b1 b7 ff ff       	call   8001fe <_panic>
+
+00804a4d <ipc_send>:
+{
+  804a4d:	55                   	push   %ebp
+  804a4e:	89 e5                	mov    %esp,%ebp
+  804a50:	83 ec 14             	sub    $0x14,%esp
+	ipc_send_pages(to_env, val, pg, 1, perm);
+  804a53:	ff 75 14             	push   0x14(%ebp)
+  804a56:	6a 01                	push   $0x1
+  804a58:	ff 75 10             	push   0x10(%ebp)
+  804a5b:	ff 75 0c             	push   0xc(%ebp)
+  804a5e:	ff 75 08             	push   0x8(%ebp)
+  804a61:	e8 a4 ff ff ff       	call   804a0a <ipc_send_pages>
+}
+  804a66:	83 c4 20             	add    $0x20,%esp
+  804a69:	c9                   	leave
+  804a6a:	c3                   	ret
+
+00804a6b <ipc_call>:
+// that is sent along (if 'perm' is nonzero) and where any pages of the
+// reply are mapped.
+// Returns the value of the reply, or < 0 if the system call fails.
+int32_t
+ipc_call(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm)
+{
+  804a6b:	55                   	push   %ebp
+  804a6c:	89 e5                	mov    %esp,%ebp
+  804a6e:	83 ec 14             	sub    $0x14,%esp
+  804a71:	8b 45 10             	mov    0x10(%ebp),%eax
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804a74:	85 c0                	test   %eax,%eax
+  804a76:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804a7b:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_call(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804a7e:	ff 75 18             	push   0x18(%ebp)
+  804a81:	ff 75 14             	push   0x14(%ebp)
+  804a84:	50                   	push   %eax
+  804a85:	ff 75 0c             	push   0xc(%ebp)
+  804a88:	ff 75 08             	push   0x8(%ebp)
+  804a8b:	e8 9a c7 ff ff       	call   80122a <sys_ipc_call>
+  804a90:	83 c4 20             	add    $0x20,%esp
+  804a93:	85 c0                	test   %eax,%eax
+  804a95:	78 0b                	js     804aa2 <ipc_call+0x37>
+		return r;
+	}
+	return thisenv->env_ipc_value;
+  804a97:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804a9c:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804aa2:	c9                   	leave
+  804aa3:	c3                   	ret
+
+00804aa4 <ipc_reply_recv>:
+// the next request into the window of 'npages' pages at 'pg' (which is
+// unmapped first), as ipc_recv_pages does.
+int32_t
+ipc_reply_recv(envid_t to_env, uint32_t val, void *pg, size_t npages, int perm,
+	       envid_t *from_env_store, int *perm_store, size_t *npages_store)
+{
+  804aa4:	55                   	push   %ebp
+  804aa5:	89 e5                	mov    %esp,%ebp
+  804aa7:	57                   	push   %edi
+  804aa8:	56                   	push   %esi
+  804aa9:	53                   	push   %ebx
+  804aaa:	83 ec 18             	sub    $0x18,%esp
+  804aad:	8b 45 10             	mov    0x10(%ebp),%eax
+  804ab0:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+  804ab3:	8b 75 20             	mov    0x20(%ebp),%esi
+  804ab6:	8b 5d 24             	mov    0x24(%ebp),%ebx
+	int32_t r;
+	if (pg == NULL) {
+		pg = (void *)UTOP;
+  804ab9:	85 c0                	test   %eax,%eax
+  804abb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  804ac0:	0f 44 c2             	cmove  %edx,%eax
+	}
+	if ((r = sys_ipc_reply_recv(to_env, val, pg, npages, (unsigned)perm)) < 0) {
+  804ac3:	ff 75 18             	push   0x18(%ebp)
+  804ac6:	ff 75 14             	push   0x14(%ebp)
+  804ac9:	50                   	push   %eax
+  804aca:	ff 75 0c             	push   0xc(%ebp)
+  804acd:	ff 75 08             	push   0x8(%ebp)
+  804ad0:	e8 96 c7 ff ff       	call   80126b <sys_ipc_reply_recv>
+  804ad5:	83 c4 20             	add    $0x20,%esp
+  804ad8:	85 c0                	test   %eax,%eax
+  804ada:	78 46                	js     804b22 <ipc_reply_recv+0x7e>
+		if (npages_store) {
+			*npages_store = 0;
+		}
+		return r;
+	}
+	if (from_env_store) {
+  804adc:	85 ff                	test   %edi,%edi
+  804ade:	74 0d                	je     804aed <ipc_reply_recv+0x49>
+		*from_env_store = thisenv->env_ipc_from;
+  804ae0:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804ae5:	8b 80 88 00 00 00    	mov    0x88(%eax),%eax
+  804aeb:	89 07                	mov    %eax,(%edi)
+	}
+	if (perm_store) {
+  804aed:	85 f6                	test   %esi,%esi
+  804aef:	74 0d                	je     804afe <ipc_reply_recv+0x5a>
+		*perm_store = thisenv->env_ipc_perm;
+  804af1:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804af6:	8b 80 8c 00 00 00    	mov    0x8c(%eax),%eax
+  804afc:	89 06                	mov    %eax,(%esi)
+	}
+	if (npages_store) {
+  804afe:	85 db                	test   %ebx,%ebx
+  804b00:	74 0d                	je     804b0f <ipc_reply_recv+0x6b>
+		*npages_store = thisenv->env_ipc_npages;
+  804b02:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b07:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+  804b0d:	89 03                	mov    %eax,(%ebx)
+	}
+	return thisenv->env_ipc_value;
+  804b0f:	a1 18 e9 80 00       	mov    0x80e918,%eax
+  804b14:	8b 80 84 00 00 00    	mov    0x84(%eax),%eax
+}
+  804b1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804b1d:	5b                   	pop    %ebx
+  804b1e:	5e                   	pop    %esi
+  804b1f:	5f                   	pop    %edi
+  804b20:	5d                   	pop    %ebp
+  804b21:	c3                   	ret
+		if (from_env_store) {
+  804b22:	85 ff                	test   %edi,%edi
+  804b24:	74 06                	je     804b2c <ipc_reply_recv+0x88>
+			*from_env_store = 0;
+  804b26:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+		if (perm_store) {
+  804b2c:	85 f6                	test   %esi,%esi
+  804b2e:	74 06                	je     804b36 <ipc_reply_recv+0x92>
+			*perm_store = 0;
+  804b30:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+		if (npages_store) {
+  804b36:	85 db                	test   %ebx,%ebx
+  804b38:	74 e0                	je     804b1a <ipc_reply_recv+0x76>
+			*npages_store = 0;
+  804b3a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  804b40:	eb d8                	jmp    804b1a <ipc_reply_recv+0x76>
+
+00804b42 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  804b42:	55                   	push   %ebp
+  804b43:	89 e5                	mov    %esp,%ebp
+  804b45:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  804b48:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (envs[i].env_type == type)
+  804b4d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b50:	c1 e0 06             	shl    $0x6,%eax
+  804b53:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b58:	8b 40 50             	mov    0x50(%eax),%eax
+  804b5b:	39 c8                	cmp    %ecx,%eax
+  804b5d:	74 12                	je     804b71 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  804b5f:	83 c2 01             	add    $0x1,%edx
+  804b62:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  804b68:	75 e3                	jne    804b4d <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  804b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b6f:	eb 0e                	jmp    804b7f <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  804b71:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  804b74:	c1 e0 06             	shl    $0x6,%eax
+  804b77:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  804b7c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  804b7f:	5d                   	pop    %ebp
+  804b80:	c3                   	ret
+
+00804b81 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  804b81:	55                   	push   %ebp
+  804b82:	89 e5                	mov    %esp,%ebp
+  804b84:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804b87:	89 c2                	mov    %eax,%edx
+  804b89:	c1 ea 16             	shr    $0x16,%edx
+  804b8c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  804b93:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  804b98:	f6 c1 01             	test   $0x1,%cl
+  804b9b:	74 1e                	je     804bbb <pageref+0x3a>
+	pte = uvpt[PGNUM(v)];
+  804b9d:	c1 e8 0c             	shr    $0xc,%eax
+  804ba0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  804ba7:	a8 01                	test   $0x1,%al
+  804ba9:	74 10                	je     804bbb <pageref+0x3a>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  804bab:	c1 e8 0c             	shr    $0xc,%eax
+  804bae:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  804bb1:	0f b7 90 0a 00 00 ef 	movzwl -0x10fffff6(%eax),%edx
+  804bb8:	0f b7 d2             	movzwl %dx,%edx
+}
+  804bbb:	89 d0                	mov    %edx,%eax
+  804bbd:	5d                   	pop    %ebp
+  804bbe:	c3                   	ret
+
+00804bbf <udivmod>:
+  804bbf:	55                   	push   %ebp
+  804bc0:	57                   	push   %edi
+  804bc1:	56                   	push   %esi
+  804bc2:	53                   	push   %ebx
+  804bc3:	83 ec 24             	sub    $0x24,%esp
+  804bc6:	89 44 24 08          	mov    %eax,0x8(%esp)
+  804bca:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  804bce:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804bd2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804bd6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  804bda:	89 54 24 14          	mov    %edx,0x14(%esp)
+  804bde:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  804be2:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bec:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bf1:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  804bf8:	00 
+  804bf9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  804c00:	00 
+  804c01:	89 fb                	mov    %edi,%ebx
+  804c03:	eb 08                	jmp    804c0d <udivmod+0x4e>
+  804c05:	83 e9 01             	sub    $0x1,%ecx
+  804c08:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  804c0b:	74 68                	je     804c75 <udivmod+0xb6>
+  804c0d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  804c11:	01 c0                	add    %eax,%eax
+  804c13:	89 c6                	mov    %eax,%esi
+  804c15:	89 d7                	mov    %edx,%edi
+  804c17:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804c1b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804c1f:	0f ad d0             	shrd   %cl,%edx,%eax
+  804c22:	d3 ea                	shr    %cl,%edx
+  804c24:	f6 c1 20             	test   $0x20,%cl
+  804c27:	74 04                	je     804c2d <udivmod+0x6e>
+  804c29:	89 d0                	mov    %edx,%eax
+  804c2b:	31 d2                	xor    %edx,%edx
+  804c2d:	83 e0 01             	and    $0x1,%eax
+  804c30:	89 04 24             	mov    %eax,(%esp)
+  804c33:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  804c3a:	00 
+  804c3b:	8b 04 24             	mov    (%esp),%eax
+  804c3e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  804c42:	09 f0                	or     %esi,%eax
+  804c44:	09 fa                	or     %edi,%edx
+  804c46:	8b 74 24 10          	mov    0x10(%esp),%esi
+  804c4a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  804c4e:	39 f0                	cmp    %esi,%eax
+  804c50:	89 d5                	mov    %edx,%ebp
+  804c52:	19 fd                	sbb    %edi,%ebp
+  804c54:	72 af                	jb     804c05 <udivmod+0x46>
+  804c56:	29 f0                	sub    %esi,%eax
+  804c58:	19 fa                	sbb    %edi,%edx
+  804c5a:	89 cf                	mov    %ecx,%edi
+  804c5c:	c1 ef 05             	shr    $0x5,%edi
+  804c5f:	83 e7 01             	and    $0x1,%edi
+  804c62:	89 fe                	mov    %edi,%esi
+  804c64:	83 f6 01             	xor    $0x1,%esi
+  804c67:	d3 e6                	shl    %cl,%esi
+  804c69:	d3 e7                	shl    %cl,%edi
+  804c6b:	09 74 24 18          	or     %esi,0x18(%esp)
+  804c6f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  804c73:	eb 90                	jmp    804c05 <udivmod+0x46>
+  804c75:	85 db                	test   %ebx,%ebx
+  804c77:	74 05                	je     804c7e <udivmod+0xbf>
+  804c79:	89 03                	mov    %eax,(%ebx)
+  804c7b:	89 53 04             	mov    %edx,0x4(%ebx)
+  804c7e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c82:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804c86:	83 c4 24             	add    $0x24,%esp
+  804c89:	5b                   	pop    %ebx
+  804c8a:	5e                   	pop    %esi
+  804c8b:	5f                   	pop    %edi
+  804c8c:	5d                   	pop    %ebp
+  804c8d:	c3                   	ret
+
+00804c8e <__udivdi3>:
+  804c8e:	83 ec 08             	sub    $0x8,%esp
+  804c91:	6a 00                	push   $0x0
+  804c93:	ff 74 24 1c          	push   0x1c(%esp)
+  804c97:	ff 74 24 1c          	push   0x1c(%esp)
+  804c9b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804c9f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804ca3:	e8 17 ff ff ff       	call   804bbf <udivmod>
+  804ca8:	83 c4 14             	add    $0x14,%esp
+  804cab:	c3                   	ret
+
+00804cac <__umoddi3>:
+  804cac:	83 ec 18             	sub    $0x18,%esp
+  804caf:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804cb3:	50                   	push   %eax
+  804cb4:	ff 74 24 2c          	push   0x2c(%esp)
+  804cb8:	ff 74 24 2c          	push   0x2c(%esp)
+  804cbc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804cc0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804cc4:	e8 f6 fe ff ff       	call   804bbf <udivmod>
+  804cc9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804ccd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804cd1:	83 c4 24             	add    $0x24,%esp
+  804cd4:	c3                   	ret
+
+00804cd5 <__divdi3>:
+  804cd5:	55                   	push   %ebp
+  804cd6:	57                   	push   %edi
+  804cd7:	56                   	push   %esi
+  804cd8:	53                   	push   %ebx
+  804cd9:	83 ec 10             	sub    $0x10,%esp
+  804cdc:	8b 44 24 24          	mov    0x24(%esp),%eax
+  804ce0:	8b 54 24 28          	mov    0x28(%esp),%edx
+  804ce4:	89 c6                	mov    %eax,%esi
+  804ce6:	89 d7                	mov    %edx,%edi
+  804ce8:	33 74 24 2c          	xor    0x2c(%esp),%esi
+  804cec:	33 7c 24 30          	xor    0x30(%esp),%edi
+  804cf0:	89 74 24 04          	mov    %esi,0x4(%esp)
+  804cf4:	89 7c 24 08          	mov    %edi,0x8(%esp)
+  804cf8:	89 c5                	mov    %eax,%ebp
+  804cfa:	f7 dd                	neg    %ebp
+  804cfc:	89 d6                	mov    %edx,%esi
+  804cfe:	83 d6 00             	adc    $0x0,%esi
+  804d01:	f7 de                	neg    %esi
+  804d03:	0f 48 e8             	cmovs  %eax,%ebp
+  804d06:	0f 49 d6             	cmovns %esi,%edx
+  804d09:	6a 00                	push   $0x0
+  804d0b:	8b 74 24 30          	mov    0x30(%esp),%esi
+  804d0f:	f7 de                	neg    %esi
+  804d11:	8b 44 24 34          	mov    0x34(%esp),%eax
+  804d15:	83 d0 00             	adc    $0x0,%eax
+  804d18:	f7 d8                	neg    %eax
+  804d1a:	0f 48 74 24 30       	cmovs  0x30(%esp),%esi
+  804d1f:	0f 48 44 24 34       	cmovs  0x34(%esp),%eax
+  804d24:	50                   	push   %eax
+  804d25:	56                   	push   %esi
+  804d26:	89 e8                	mov    %ebp,%eax
+  804d28:	e8 92 fe ff ff       	call   804bbf <udivmod>
+  804d2d:	83 c4 10             	add    $0x10,%esp
+  804d30:	83 7c 24 04 00       	cmpl   $0x0,0x4(%esp)
+  804d35:	78 08                	js     804d3f <__divdi3+0x6a>
+  804d37:	83 c4 0c             	add    $0xc,%esp
+  804d3a:	5b                   	pop    %ebx
+  804d3b:	5e                   	pop    %esi
+  804d3c:	5f                   	pop    %edi
+  804d3d:	5d                   	pop    %ebp
+  804d3e:	c3                   	ret
+  804d3f:	f7 d8                	neg    %eax
+  804d41:	83 d2 00             	adc    $0x0,%edx
+  804d44:	f7 da                	neg    %edx
+  804d46:	eb ef                	jmp    804d37 <__divdi3+0x62>
+
+00804d48 <__moddi3>:
+  804d48:	55                   	push   %ebp
+  804d49:	57                   	push   %edi
+  804d4a:	56                   	push   %esi
+  804d4b:	53                   	push   %ebx
+  804d4c:	83 ec 18             	sub    $0x18,%esp
+  804d4f:	8b 74 24 2c          	mov    0x2c(%esp),%esi
+  804d53:	8b 5c 24 30          	mov    0x30(%esp),%ebx
+  804d57:	89 f1                	mov    %esi,%ecx
+  804d59:	f7 d9                	neg    %ecx
+  804d5b:	89 da                	mov    %ebx,%edx
+  804d5d:	83 d2 00             	adc    $0x0,%edx
+  804d60:	f7 da                	neg    %edx
+  804d62:	0f 48 ce             	cmovs  %esi,%ecx
+  804d65:	0f 48 d3             	cmovs  %ebx,%edx
+  804d68:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804d6c:	50                   	push   %eax
+  804d6d:	8b 74 24 38          	mov    0x38(%esp),%esi
+  804d71:	f7 de                	neg    %esi
+  804d73:	8b 44 24 3c          	mov    0x3c(%esp),%eax
+  804d77:	83 d0 00             	adc    $0x0,%eax
+  804d7a:	f7 d8                	neg    %eax
+  804d7c:	0f 48 74 24 38       	cmovs  0x38(%esp),%esi
+  804d81:	0f 48 44 24 3c       	cmovs  0x3c(%esp),%eax
+  804d86:	50                   	push   %eax
+  804d87:	56                   	push   %esi
+  804d88:	89 c8                	mov    %ecx,%eax
+  804d8a:	e8 30 fe ff ff       	call   804bbf <udivmod>
+  804d8f:	83 c4 10             	add    $0x10,%esp
+  804d92:	85 db                	test   %ebx,%ebx
+  804d94:	78 10                	js     804da6 <__moddi3+0x5e>
+  804d96:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804d9a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804d9e:	83 c4 14             	add    $0x14,%esp
+  804da1:	5b                   	pop    %ebx
+  804da2:	5e                   	pop    %esi
+  804da3:	5f                   	pop    %edi
+  804da4:	5d                   	pop    %ebp
+  804da5:	c3                   	ret
+  804da6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804daa:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804dae:	f7 d8                	neg    %eax
+  804db0:	83 d2 00             	adc    $0x0,%edx
+  804db3:	f7 da                	neg    %edx
+  804db5:	eb e7                	jmp    804d9e <__moddi3+0x56>
@@ -0,0 +1,97 @@
+/*
+ * JOS swap area format
+ *
+ * Writes a swap area header into block startblock of a disk image, and
+ * makes the image big enough to hold the nslots slots after it.  The
+ * slots themselves needn't be initialized, so the image is extended
+ * without writing them.
+ */
+
+// We don't actually want to define off_t!
+#define off_t xxx_off_t
+#define bool xxx_bool
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#undef off_t
+#undef bool
+
+// Prevent inc/types.h, included from inc/fs.h,
+// from attempting to redefine types defined in the host's inttypes.h.
+#define JOS_INC_TYPES_H
+// Typedef the types that inc/mmu.h needs.
+typedef uint32_t physaddr_t;
+typedef uint32_t off_t;
+typedef int bool;
+
+#include <inc/mmu.h>
+#include <inc/fs.h>
+
+void
+panic(const char *fmt, ...)
+{
+        va_list ap;
+
+        va_start(ap, fmt);
+        vfprintf(stderr, fmt, ap);
+        va_end(ap);
+        fputc('\n', stderr);
+	abort();
+}
+
+void
+usage(void)
+{
+	fprintf(stderr, "Usage: mkswap disk.img startblock nslots priority\n");
+	exit(2);
+}
+
+int
+main(int argc, char **argv)
+{
+	char block[BLKSIZE], *end;
+	struct SwapHeader *hdr = (struct SwapHeader *)block;
+	unsigned long start, nslots;
+	long priority;
+	struct stat st;
+	int fd;
+
+	if (argc != 5)
+		usage();
+	start = strtoul(argv[2], &end, 0);
+	if (*end)
+		usage();
+	nslots = strtoul(argv[3], &end, 0);
+	if (*end || nslots == 0)
+		usage();
+	priority = strtol(argv[4], &end, 0);
+	if (*end)
+		usage();
+
+	if ((fd = open(argv[1], O_RDWR | O_CREAT, 0666)) < 0)
+		panic("open %s: %s", argv[1], strerror(errno));
+
+	memset(block, 0, sizeof(block));
+	hdr->sh_magic = SWAP_MAGIC;
+	hdr->sh_nslots = nslots;
+	hdr->sh_priority = priority;
+	if (pwrite(fd, block, BLKSIZE, (uint64_t) start * BLKSIZE) != BLKSIZE)
+		panic("write %s: %s", argv[1], strerror(errno));
+
+	if (fstat(fd, &st) < 0)
+		panic("stat %s: %s", argv[1], strerror(errno));
+	if ((uint64_t) st.st_size < (uint64_t) (start + 1 + nslots) * BLKSIZE &&
+	    ftruncate(fd, (uint64_t) (start + 1 + nslots) * BLKSIZE) < 0)
+		panic("truncate %s: %s", argv[1], strerror(errno));
+
+	if (close(fd) < 0)
+		panic("close %s: %s", argv[1], strerror(errno));
+	return 0;
+}
@@ -1,6 +1,14 @@
 #include <inc/page.h>
 #include <inc/lib.h>
 
+// Clients' request rings (see struct Pagering) are mapped at RINGMAP,
+// PAGERING_NPAGES pages each.
+#define RINGMAP		0x20000000
+#define NRINGS		64
+
+// Where we map the page we're writing out for PAGEREQ_PAGE_RECLAIM
+#define RECLAIMVA	(RINGMAP - PGSIZE)
+
 /* page.c */
 void	page_init(void);
 
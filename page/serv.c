@@ -12,8 +12,10 @@
 
 #define debug 0
 
-// Virtual address at which to receive page mappings containing client requests.
-struct Pageipc *pagereq = (struct Pageipc *)0x0ffff000;
+// Virtual address at which to receive page mappings containing client
+// requests: up to PAGEREQ_PAGE_IN_MAXPAGES of them, ending at 0x10000000.
+struct Pageipc *pagereq = (struct Pageipc *)(0x10000000 - PAGEREQ_PAGE_IN_MAXPAGES*PGSIZE);
+size_t pagereq_npages;  // number of pages mapped at pagereq by the current request
 
 /*
  * We use a bitmap to keep track of HD blocks that are free and not-free in the swap space.
@@ -31,93 +33,159 @@ struct page_bitmap_node {
 	struct page_bitmap_node *link;
 };
 
-/*
- * The desired number of blocks for the swap space
- * Update PAGE_NBLOCKS whenever count in fs/Makefrag is updated, and vice-versa
- */
-#define PAGE_NBLOCKS 32768
-
 /*
  * To reduce the overhead of having a large number of linked lists, each node is a bitmap for a group of blocks, rather than a single block.
  * We use a uint32_t for this bitmap; therefore the number of blocks per group is 32.
  */
 #define NBLOCKS_PER_GROUP 32
-#define PAGE_NGROUPS PAGE_NBLOCKS/NBLOCKS_PER_GROUP
+#define PAGE_NGROUPS (PAGESERV_NSLOTS/NBLOCKS_PER_GROUP)
 
-#define PAGE_BLOCKS_OFFSET 1024 // The size of the fs partition, and the start of the swap partition
+/*
+ * The swap areas we found at boot.  We number the slots of our share of
+ * each area one after another, so each area has its own run of block
+ * groups, and its own free list.
+ */
+#define MAXSWAPAREAS 3
+struct swap_area {
+	int disk;                                 // IDE disk the area is on
+	uint32_t start;                           // disk block of our first slot in it
+	uint32_t first;                           // our slot number for that block
+	uint32_t nslots;                          // our share of the area, a whole number of groups
+	int32_t priority;
+	struct page_bitmap_node *free_list;       // linked list of its free groups
+};
+struct swap_area swap_areas[MAXSWAPAREAS];
+int nswap_areas;
+int swap_rotor;                                           // the area we last paged out to
 
-struct page_bitmap_node page_bitmap_nodes[PAGE_NGROUPS];  // PAGE_NBLOCKS bits, to indicate free and used blocks in the swap space
-struct page_bitmap_node *page_bitmap_node_free_list = 0;  // linked list of free groups
+struct page_bitmap_node page_bitmap_nodes[PAGE_NGROUPS];  // one bit per slot, to indicate free and used blocks in the swap space
+uint16_t page_block_refs[PAGESERV_NSLOTS];                // number of mapping table entries referring to each used block
+uint32_t page_nslots;                                     // number of slots we own
 struct Pageret_stat serve_stats_s;                        // stats for the page server
+int page_instance;                                        // which of the NPAGESERV page servers we are
+
+/*
+ * Clients' request rings.  Ring i is mapped at RINGMAP + i*PAGERING_NPAGES*PGSIZE.
+ * We keep our own copies of the indices we own, so a client can't make us
+ * run past the end of its queues.
+ */
+struct page_ring {
+	envid_t envid;        // the client, or 0 if this ring is free
+	uint32_t sq_head;     // next request to take
+	uint32_t cq_tail;     // next completion to post
+};
+struct page_ring page_rings[NRINGS];
 
-// returns the block number of a free block in the page swap space
-// returns 0 if there are no such free blocks
+// returns the swap area our slot number slot is in
+// panics on error
+struct swap_area *
+swap_area_of(uint32_t slot)
+{
+	int i;
+	for (i = 0; i < nswap_areas; ++i) {
+		if (slot >= swap_areas[i].first && slot < swap_areas[i].first + swap_areas[i].nslots) {
+			return &swap_areas[i];
+		}
+	}
+	panic("swap_area_of: slot %d is in no swap area", slot);
+	return NULL;
+}
+
+// reads or writes n slots' worth of blocks starting at our slot number slot,
+// which must all be in the same swap area
+int
+swap_io(uint32_t slot, void *pg, uint32_t n, bool write)
+{
+	struct swap_area *area = swap_area_of(slot);
+	uint32_t secno = (area->start + slot - area->first)*BLKSECTS;
+	ide_set_disk(area->disk);
+	if (write) {
+		return ide_write(secno, pg, n*BLKSECTS);
+	}
+	return ide_read(secno, pg, n*BLKSECTS);
+}
+
+// returns our slot number of a free block in the page swap space, taken
+// from the highest-priority area that has one, going round the areas of
+// that priority in turn so that consecutive page outs go to different
+// disks
+// returns -E_SWAP_SPACE_FULL if there are no such free blocks
 // panics on error
 // NOTE: does not mark the block as not free, you must call mark_page_block_as_not_free with the return value from get_free_page_block
-// TODO: determine if this is the correct behavior
 int
 get_free_page_block(void)
 {
 	int i;
 	uint32_t bitmap;
-	struct page_bitmap_node *node = page_bitmap_node_free_list;
-	if (!page_bitmap_node_free_list) {
+	struct swap_area *area = NULL;
+	struct page_bitmap_node *node;
+	for (i = 1; i <= nswap_areas; ++i) {
+		struct swap_area *a = &swap_areas[(swap_rotor + i) % nswap_areas];
+		if (a->free_list && (!area || a->priority > area->priority)) {
+			area = a;
+		}
+	}
+	if (!area) {
 		return -E_SWAP_SPACE_FULL;
 	}
+	swap_rotor = area - swap_areas;
+	node = area->free_list;
 	for (i = 0, bitmap = node->bitmap; i < NBLOCKS_PER_GROUP; ++i, bitmap >>= 1) {
 		if (!(bitmap&1)) {
-			return PAGE_BLOCKS_OFFSET + node->groupno*NBLOCKS_PER_GROUP + i;
+			return node->groupno*NBLOCKS_PER_GROUP + i;
 		}
 	}
-	panic("get_free_page_block: there is a block group in page_bitmap_node_free_list that has no free blocks");
+	panic("get_free_page_block: there is a block group in a free list that has no free blocks");
 	return 0;
 }
 
 // marks the given block as not free
-// if all blocks in the group are now not free, removes the group from the free list
-// the given block number must be the actual block number (so it must be >= PAGE_BLOCKS_OFFSET)
-// for simplicity, you can only unfree a block in the group at the head of the free list
+// if all blocks in the group are now not free, removes the group from its area's free list
+// the given block number is our slot number for it
+// for simplicity, you can only unfree a block in the group at the head of its area's free list
 // panics on error
 void
 mark_page_block_as_not_free(uint32_t blockno)
 {
 	int i;
 	uint32_t groupno;
-	blockno -= PAGE_BLOCKS_OFFSET;
-	if (blockno < 0 || blockno >= PAGE_NBLOCKS) {
+	struct swap_area *area;
+	if (blockno >= page_nslots) {
 		panic("mark_page_block_as_not_free: invalid block number");
 	}
+	area = swap_area_of(blockno);
 	groupno = blockno / NBLOCKS_PER_GROUP;
-	if (!page_bitmap_node_free_list || groupno != page_bitmap_node_free_list->groupno) {
-		panic("mark_page_block_as_not_free: attempting to unfree block that isn't in front of page_bitmap_node_free_list");
+	if (!area->free_list || groupno != area->free_list->groupno) {
+		panic("mark_page_block_as_not_free: attempting to unfree block that isn't in front of its area's free list");
 	}
 	i = blockno % NBLOCKS_PER_GROUP;
-	if (page_bitmap_node_free_list->bitmap & (1<<i)) {
+	if (area->free_list->bitmap & (1<<i)) {
 		panic("mark_page_block_as_not_free: attempting to unfree block that is already unfree");
 	}
-	page_bitmap_node_free_list->bitmap |= (1<<i);
-	if (!(~(page_bitmap_node_free_list->bitmap))) {
-		page_bitmap_node_free_list = page_bitmap_node_free_list->link;
+	area->free_list->bitmap |= (1<<i);
+	if (!(~(area->free_list->bitmap))) {
+		area->free_list = area->free_list->link;
 	}
 }
 
 // marks the given block as free
-// if none of the blocks in the group were free, adds the group to the free list
-// the given block number must be the actual block number (so it must be >= PAGE_BLOCKS_OFFSET)
+// if none of the blocks in the group were free, adds the group to its area's free list
+// the given block number is our slot number for it
 // panics on error
 void
 mark_page_block_as_free(uint32_t blockno)
 {
 	int i;
 	uint32_t groupno;
-	blockno -= PAGE_BLOCKS_OFFSET;
-	if (blockno < 0 || blockno >= PAGE_NBLOCKS) {
+	struct swap_area *area;
+	if (blockno >= page_nslots) {
 		panic("mark_page_block_as_free: invalid block number");
 	}
+	area = swap_area_of(blockno);
 	groupno = blockno / NBLOCKS_PER_GROUP;
 	if (!(~page_bitmap_nodes[groupno].bitmap)) {
-		page_bitmap_nodes[groupno].link = page_bitmap_node_free_list;
-		page_bitmap_node_free_list = (page_bitmap_nodes+groupno);
+		page_bitmap_nodes[groupno].link = area->free_list;
+		area->free_list = (page_bitmap_nodes+groupno);
 	}
 	i = blockno % NBLOCKS_PER_GROUP;
 	if (!(page_bitmap_nodes[groupno].bitmap & (1<<i))) {
@@ -126,37 +194,177 @@ mark_page_block_as_free(uint32_t blockno)
 	page_bitmap_nodes[groupno].bitmap ^= (1<<i);
 }
 
+// drops a reference to the given block, freeing it once nobody refers to it
+// the given block number is our slot number for it
+// panics on error
 void
-serve_init(void)
+page_block_decref(uint32_t blockno)
 {
-	int i;
-	for (i = PAGE_NGROUPS-1; i >= 0; --i) {
+	uint16_t *refs = &page_block_refs[blockno];
+	if (*refs == 0) {
+		panic("page_block_decref: attempting to drop a reference to a free block");
+	}
+	if (--(*refs) == 0) {
+		mark_page_block_as_free(blockno);
+	}
+}
+
+// is the given swap slot in our share of the swap space?
+bool
+page_slot_ours(uint32_t slot)
+{
+	return PAGESERV_OF(slot) == page_instance && slot % PAGESERV_NSLOTS < page_nslots;
+}
+
+// our slot number for the given swap slot, which must be ours
+#define OURSLOT(slot) ((slot) % PAGESERV_NSLOTS)
+
+// takes our share of a swap area of nslots slots starting at the given
+// block of the given disk, putting its groups on the area's free list
+void
+swap_area_add(int disk, uint32_t start, uint32_t nslots, int32_t priority)
+{
+	struct swap_area *area;
+	uint32_t share, i;
+
+	share = nslots / NPAGESERV / NBLOCKS_PER_GROUP * NBLOCKS_PER_GROUP;
+	if (share > PAGESERV_NSLOTS - page_nslots) {
+		share = PAGESERV_NSLOTS - page_nslots;
+	}
+	if (share == 0 || nswap_areas == MAXSWAPAREAS) {
+		return;
+	}
+	area = &swap_areas[nswap_areas++];
+	area->disk = disk;
+	area->start = start + page_instance*share;
+	area->first = page_nslots;
+	area->nslots = share;
+	area->priority = priority;
+	area->free_list = 0;
+	for (i = (area->first + share)/NBLOCKS_PER_GROUP; i-- > area->first/NBLOCKS_PER_GROUP; ) {
 		page_bitmap_nodes[i].bitmap = 0;    // every block in the page swap space starts out free (indicated by 0 bits)
 		page_bitmap_nodes[i].groupno = i;
-		page_bitmap_nodes[i].link = page_bitmap_node_free_list;
-		page_bitmap_node_free_list = (page_bitmap_nodes+i);
+		page_bitmap_nodes[i].link = area->free_list;
+		area->free_list = (page_bitmap_nodes+i);
+	}
+	page_nslots += share;
+	if (debug)
+		cprintf("swap area on disk %d at block %d: %d slots, priority %d\n",
+			disk, area->start, share, priority);
+}
+
+// looks for swap areas: after the file system on its disk (disk 1), and
+// at the start of disks 2 and 3, on the secondary IDE channel
+void
+swap_init(void)
+{
+	static char buf[BLKSIZE];
+	struct Super *super = (struct Super *)buf;
+	struct SwapHeader *hdr = (struct SwapHeader *)buf;
+	uint32_t start;
+	int d;
+
+	for (d = 1; d < 4; ++d) {
+		if (!ide_probe_disk(d)) {
+			continue;
+		}
+		ide_set_disk(d);
+		start = 0;
+		if (d == 1) {
+			if (ide_read(1*BLKSECTS, buf, BLKSECTS) < 0 || super->s_magic != FS_MAGIC) {
+				continue;
+			}
+			start = super->s_nblocks;
+		}
+		if (ide_read(start*BLKSECTS, buf, BLKSECTS) < 0 || hdr->sh_magic != SWAP_MAGIC) {
+			continue;
+		}
+		swap_area_add(d, start + 1, hdr->sh_nslots, hdr->sh_priority);
+	}
+	if (nswap_areas == 0) {
+		cprintf("page server %d: no swap space\n", page_instance);
+	}
+}
+
+void
+serve_init(void)
+{
+	int i;
+
+	// The page servers were created one after another, and take their
+	// shares of the swap space in that order.
+	for (i = 0; i < ENVX(thisenv->env_id); ++i) {
+		if (envs[i].env_type == ENV_TYPE_PAGE) {
+			++page_instance;
+		}
 	}
+	if (page_instance >= NPAGESERV) {
+		panic("serve_init: more than %d page servers", NPAGESERV);
+	}
+
+	swap_init();
 	// Allocate the pagereq address, so the we create the page table ahead of time
 	sys_page_alloc(0, pagereq, PTE_U|PTE_P|PTE_W);
+	// And the one for RECLAIMVA, which sys_page_reclaim can't make
+	sys_page_alloc(0, (void *) RECLAIMVA, PTE_U|PTE_P|PTE_W);
+	sys_page_unmap(0, (void *) RECLAIMVA);
 	serve_stats_s.num_page_outs = 0;
 	serve_stats_s.num_page_ins = 0;
 	serve_stats_s.num_page_removes = 0;
+	serve_stats_s.num_page_shares = 0;
+	serve_stats_s.num_page_reclaims = 0;
 }
 
 int
 serve_page_in(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **return_page)
 {
 	int r;
-	if (blockno < 0 || blockno >= PAGE_NBLOCKS) {
-		return -1;  // TODO handle incorrect block numbers
+	if (!page_slot_ours(blockno) || !page_block_refs[OURSLOT(blockno)]) {
+		return -E_INVAL;
 	}
-	blockno += PAGE_BLOCKS_OFFSET;
-	if ((r = ide_read(blockno*BLKSECTS, (void *)ipc, BLKSECTS)) < 0) {
+	blockno = OURSLOT(blockno);
+	if ((r = swap_io(blockno, (void *)ipc, 1, 0)) < 0) {
 		return r;   // TODO handle IDE write errors
 	}
-	mark_page_block_as_free(blockno);
-	*return_page = (void *)ipc;
-	++serve_stats_s.num_page_ins;
+	page_block_decref(blockno);    // other sharers of the block still need it
+	++serve_stats_s.num_page_ins;   // the client's own page was filled in, so there's nothing to return
+	return 0;
+}
+
+// reads the swap blocks listed at the start of the first request page
+// into the request pages, which the client sent all together and gets
+// back filled in
+// runs of consecutive blocks in the same swap area are read in with one
+// disk read
+int
+serve_page_in_range(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **return_page)
+{
+	struct Pagereq_page_in_range req = *(struct Pagereq_page_in_range *)ipc;
+	struct swap_area *area;
+	uint32_t i, j;
+	int r;
+	if (req.nslots == 0 || req.nslots > PAGEREQ_PAGE_IN_MAXPAGES || req.nslots > pagereq_npages) {
+		return -E_INVAL;
+	}
+	for (i = 0; i < req.nslots; ++i) {
+		if (!page_slot_ours(req.slots[i]) || !page_block_refs[OURSLOT(req.slots[i])]) {
+			return -E_INVAL;
+		}
+		req.slots[i] = OURSLOT(req.slots[i]);
+	}
+	for (i = 0; i < req.nslots; i = j) {
+		area = swap_area_of(req.slots[i]);
+		for (j = i + 1; j < req.nslots && req.slots[j] == req.slots[i] + (j - i) &&
+			     req.slots[j] < area->first + area->nslots; ++j)
+			;
+		if ((r = swap_io(req.slots[i], (void *)(ipc + i), j - i, 0)) < 0) {
+			return r;   // TODO handle IDE read errors
+		}
+	}
+	for (i = 0; i < req.nslots; ++i) {
+		page_block_decref(req.slots[i]);    // other sharers of the block still need it
+	}
+	serve_stats_s.num_page_ins += req.nslots;
 	return 0;
 }
 
@@ -164,11 +372,10 @@ int
 serve_page_remove(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **return_page)
 {
 	int r;
-	if (blockno < 0 || blockno >= PAGE_NBLOCKS) {
-		return -1;  // TODO handle incorrect block numbers
+	if (!page_slot_ours(blockno) || !page_block_refs[OURSLOT(blockno)]) {
+		return -E_INVAL;
 	}
-	blockno += PAGE_BLOCKS_OFFSET;
-	mark_page_block_as_free(blockno);
+	page_block_decref(OURSLOT(blockno));
 	++serve_stats_s.num_page_removes;
 	return 0;
 }
@@ -177,15 +384,67 @@ int
 serve_page_out(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **return_page)
 {
 	int free_blockno, r;
-	if ((free_blockno = get_free_page_block()) <= 0) {
+	if ((free_blockno = get_free_page_block()) < 0) {
 		return free_blockno;
 	}
-	if ((r = ide_write(free_blockno*BLKSECTS, (void *)ipc, BLKSECTS)) < 0) {
+	if ((r = swap_io(free_blockno, (void *)ipc, 1, 1)) < 0) {
 		return r;   // TODO handle IDE write errors
 	}
 	mark_page_block_as_not_free(free_blockno);
+	page_block_refs[free_blockno] = 1;
 	++serve_stats_s.num_page_outs;
-	return free_blockno-PAGE_BLOCKS_OFFSET;
+	return page_instance*PAGESERV_NSLOTS + free_blockno;
+}
+
+// pages out the coldest page in the system, for a client that is short
+// of memory: the kernel takes it from its owner, leaving the slot in
+// the owner's page table, and lends it to us to write out
+// the owner pages it back in from us, so it can't get at the slot
+// before we've written it
+int
+serve_page_reclaim(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **return_page)
+{
+	int free_blockno, r;
+	if ((free_blockno = get_free_page_block()) < 0) {
+		return free_blockno;
+	}
+	if ((r = sys_page_reclaim(envid, (void *) RECLAIMVA, page_instance*PAGESERV_NSLOTS + free_blockno)) < 0) {
+		return r;
+	}
+	if ((r = swap_io(free_blockno, (void *) RECLAIMVA, 1, 1)) < 0) {
+		panic("serve_page_reclaim: %e", r);   // the owner has nowhere else to get its page from
+	}
+	sys_page_unmap(0, (void *) RECLAIMVA);
+	mark_page_block_as_not_free(free_blockno);
+	page_block_refs[free_blockno] = 1;
+	++serve_stats_s.num_page_reclaims;
+	return 0;
+}
+
+// takes another reference on each block listed in the request, which
+// are now referred to by one more environment's mapping tables
+// the whole request is checked before any reference is taken
+int
+serve_page_share(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **return_page)
+{
+	struct Pagereq_share *req = (struct Pagereq_share *)ipc;
+	uint32_t i;
+	if (req->nslots > PAGEREQ_SHARE_NSLOTS) {
+		return -E_INVAL;
+	}
+	for (i = 0; i < req->nslots; ++i) {
+		if (!page_slot_ours(req->slots[i]) || !page_block_refs[OURSLOT(req->slots[i])]) {
+			return -E_INVAL;
+		}
+	}
+	for (i = 0; i < req->nslots; ++i) {
+		if (page_block_refs[OURSLOT(req->slots[i])] == 0xFFFF) {
+			panic("serve_page_share: too many references to block %d", req->slots[i]);
+		}
+		++page_block_refs[OURSLOT(req->slots[i])];
+	}
+	++serve_stats_s.num_page_shares;
+	return 0;
 }
 
 int
@@ -197,6 +456,60 @@ serve_page_stat(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **ret
 	return 0;
 }
 
+void serve_ring(int i);
+
+// Ring i's pages
+static struct Pagering *
+page_ring_addr(int i)
+{
+	return (struct Pagering *)(RINGMAP + i*PAGERING_NPAGES*PGSIZE);
+}
+
+// takes the client's ring pages out of the request, and maps them as one
+// of our rings, replacing any ring the client had before
+// a ring of a client that has gone away is reused when there's no free one
+int
+serve_ring_setup(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **return_page)
+{
+	int i, r, found = -1;
+	if (pagereq_npages != PAGERING_NPAGES) {
+		return -E_INVAL;
+	}
+	for (i = 0; i < NRINGS; ++i) {
+		if (page_rings[i].envid == envid) {
+			found = i;
+			break;
+		}
+		if (found < 0 && page_rings[i].envid == 0) {
+			found = i;
+		}
+	}
+	for (i = 0; found < 0 && i < NRINGS; ++i) {
+		if (envs[ENVX(page_rings[i].envid)].env_id != page_rings[i].envid ||
+		    envs[ENVX(page_rings[i].envid)].env_status == ENV_FREE) {
+			serve_ring(i);   // what it left on its ring still counts
+			found = i;
+		}
+	}
+	if (found < 0) {
+		return -E_NO_MEM;
+	}
+	if ((r = sys_page_map_range(0, ipc, 0, page_ring_addr(found), PAGERING_NPAGES, PTE_P|PTE_U|PTE_W)) < 0) {
+		return r;
+	}
+	page_rings[found].envid = envid;
+	page_rings[found].sq_head = page_ring_addr(found)->sq_head = 0;
+	page_rings[found].cq_tail = page_ring_addr(found)->cq_tail = 0;
+	return 0;
+}
+
+// the doorbell: by the time we reply, serve has been through every ring
+int
+serve_ring_enter(envid_t envid, uint32_t blockno, struct Pageipc *ipc, void **return_page)
+{
+	return 0;
+}
+
 typedef int (*pagehandler)(envid_t envid, uint32_t blockno, struct Pageipc *req, void **return_page);
 
 pagehandler handlers[] = {
@@ -204,9 +517,57 @@ pagehandler handlers[] = {
 	[PAGEREQ_PAGE_OUT] =		serve_page_out,
 	[PAGEREQ_PAGE_REMOVE] =		serve_page_remove,
 	[PAGEREQ_PAGE_STAT] =		serve_page_stat,
+	[PAGEREQ_PAGE_SHARE] =		serve_page_share,
+	[PAGEREQ_PAGE_IN_RANGE] =	serve_page_in_range,
+	[PAGEREQ_RING_SETUP] =		serve_ring_setup,
+	[PAGEREQ_RING_ENTER] =		serve_ring_enter,
+	[PAGEREQ_PAGE_RECLAIM] =	serve_page_reclaim,
 };
 #define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
 
+// takes every request the client has posted on ring i, and posts their
+// completions, stopping early if the client hasn't taken enough of the
+// completions posted before
+void
+serve_ring(int i)
+{
+	struct page_ring *pr = &page_rings[i];
+	struct Pagering *ring = page_ring_addr(i);
+	struct Pagering_sqe sqe;
+	struct Pagering_cqe *cqe;
+	struct Pageipc *data;
+	void *pg;
+	int r;
+
+	while (pr->sq_head != ring->sq_tail && pr->cq_tail - ring->cq_head < PAGERING_NENTRIES) {
+		sqe = ring->sq[pr->sq_head % PAGERING_NENTRIES];
+		data = (struct Pageipc *)ring + 1 + sqe.data;
+		if ((sqe.op != PAGEREQ_PAGE_IN && sqe.op != PAGEREQ_PAGE_OUT && sqe.op != PAGEREQ_PAGE_REMOVE) ||
+		    (sqe.op != PAGEREQ_PAGE_REMOVE && sqe.data >= PAGERING_NDATA)) {
+			r = -E_INVAL;
+		} else {
+			r = handlers[sqe.op](pr->envid, sqe.slot, data, &pg);
+		}
+		cqe = &ring->cq[pr->cq_tail % PAGERING_NENTRIES];
+		cqe->tag = sqe.tag;
+		cqe->res = r;
+		ring->cq_tail = ++pr->cq_tail;
+		ring->sq_head = ++pr->sq_head;
+	}
+}
+
+// goes through every client's ring
+void
+serve_rings(void)
+{
+	int i;
+	for (i = 0; i < NRINGS; ++i) {
+		if (page_rings[i].envid) {
+			serve_ring(i);
+		}
+	}
+}
+
 void
 serve(void)
 {
@@ -214,34 +575,48 @@ serve(void)
 	int perm, r;
 	void *pg;
 
+	perm = 0;
+	req = ipc_recv_pages((int32_t *) &whom, pagereq, PAGEREQ_PAGE_IN_MAXPAGES, &perm, &pagereq_npages);
 	while (1) {
-		perm = 0;
-		req = ipc_recv((int32_t *) &whom, pagereq, &perm);
 		if (debug)
 			cprintf("page req %d from %08x [page %08x: %s]\n",
 				req, whom, uvpt[PGNUM(pagereq)], pagereq);
 
-		// All requests must contain an argument page
-		if (!(perm & PTE_P)) {
+		// All requests except PAGE_REMOVE, RING_ENTER and PAGE_RECLAIM
+		// must contain an argument page
+		if (!(perm & PTE_P) && (req&PAGEREQ_MASK) != PAGEREQ_PAGE_REMOVE &&
+		    (req&PAGEREQ_MASK) != PAGEREQ_RING_ENTER &&
+		    (req&PAGEREQ_MASK) != PAGEREQ_PAGE_RECLAIM) {
 			cprintf("Invalid request from %08x: no argument page\n",
 				whom);
-			continue; // just leave it hanging...
+			// just leave it hanging...
+			perm = 0;
+			req = ipc_recv_pages((int32_t *) &whom, pagereq, PAGEREQ_PAGE_IN_MAXPAGES, &perm, &pagereq_npages);
+			continue;
 		}
 
 		pg = NULL;
 
-		// use the lower two bits for sending the handler number
-		if (((req&3) < NHANDLERS) && handlers[req&3]) {
-			r = handlers[req&3](whom, req>>2, pagereq, &pg);
+		// use the lower PAGEREQ_SHIFT bits for sending the handler number
+		if (((req&PAGEREQ_MASK) < NHANDLERS) && handlers[req&PAGEREQ_MASK]) {
+			r = handlers[req&PAGEREQ_MASK](whom, req>>PAGEREQ_SHIFT, pagereq, &pg);
 		} else {
 			cprintf("Invalid request code %d from %08x\n", req, whom);
 			r = -E_INVAL;
 		}
-		if (pg && ((uintptr_t)pg)%PGSIZE) {
-			panic("serve: the address being returned doesn't lie on a page boundary");
+		// Whatever woke us up, take care of what clients have posted
+		// on their rings too.
+		serve_rings();
+
+		if (pg && pg != pagereq) {
+			panic("serve: the page being returned isn't the request page");
 		}
-		ipc_send(whom, r, pg, perm);
-		sys_page_unmap(0, pagereq);
+
+		// Reply, and switch straight back to the client, which is
+		// waiting in ipc_call; the next request lands in a cleared
+		// pagereq window.
+		req = ipc_reply_recv(whom, r, pagereq, PAGEREQ_PAGE_IN_MAXPAGES, pg ? perm : 0,
+				     (int32_t *) &whom, &perm, &pagereq_npages);
 	}
 }
 
@@ -0,0 +1,147 @@
+// Program that forks twice with dirty pages in .data, .bss and a range
+// registered with page_add_backed: once with plenty of memory, which
+// the kernel's sys_fork handles, and once with none left, so fork falls
+// back to the user-level ufork.  The children, and the parent after
+// ufork, page out almost everything they have before they check that
+// every page still holds what was written to it: a copy-on-write page
+// must never be taken for a clean one and dropped.
+
+#include <inc/lib.h>
+
+#define NPAGES   16
+#define BACKED   0x30000000
+#define SQUEEZE  0x38000000
+#define NSQUEEZE 256
+#define BASE     0x40000000
+#define TOP      0xC0000000
+
+uint32_t data[NPAGES*PGSIZE/sizeof(uint32_t)] = { 1 };
+uint32_t bss[NPAGES*PGSIZE/sizeof(uint32_t)];
+
+// Pages [BASE, held) were taken to use up free memory
+uintptr_t held = BASE;
+
+static void
+fill(uint32_t tag)
+{
+	int i;
+
+	for (i = 0; i < NPAGES; i++) {
+		data[i*PGSIZE/sizeof(uint32_t)] = tag + i;
+		bss[i*PGSIZE/sizeof(uint32_t)] = tag + i;
+		((uint32_t*) BACKED)[i*PGSIZE/sizeof(uint32_t)] = tag + i;
+	}
+}
+
+static void
+check(uint32_t tag, const char *who)
+{
+	int i;
+
+	for (i = 0; i < NPAGES; i++) {
+		if (data[i*PGSIZE/sizeof(uint32_t)] != tag + i)
+			panic("%s: .data page %d holds %x", who, i, data[i*PGSIZE/sizeof(uint32_t)]);
+		if (bss[i*PGSIZE/sizeof(uint32_t)] != tag + i)
+			panic("%s: .bss page %d holds %x", who, i, bss[i*PGSIZE/sizeof(uint32_t)]);
+		if (((uint32_t*) BACKED)[i*PGSIZE/sizeof(uint32_t)] != tag + i)
+			panic("%s: backed page %d holds %x", who, i,
+			      ((uint32_t*) BACKED)[i*PGSIZE/sizeof(uint32_t)]);
+	}
+}
+
+// Hold ourselves to a few pages more than we have now, and cycle
+// NSQUEEZE pages through them, so nearly everything gets paged out
+static void
+squeeze(void)
+{
+	int r;
+	uintptr_t va;
+
+	if ((r = sys_env_set_rss(0, 0, thisenv->env_npages + 32)) < 0)
+		panic("sys_env_set_rss: %e", r);
+	for (va = SQUEEZE; va < SQUEEZE + NSQUEEZE*PGSIZE; va += PGSIZE) {
+		if ((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+			panic("page_alloc on %p: %e", va, r);
+		*(uintptr_t*)va = va;
+	}
+	for (va = SQUEEZE; va < SQUEEZE + NSQUEEZE*PGSIZE; va += PGSIZE)
+		assert(*(uintptr_t*)va == va);
+}
+
+// Give back the pages taken to use up free memory
+static void
+give_back(void)
+{
+	int r;
+
+	if (held > BASE && (r = sys_page_unmap_range(0, (void*) BASE, (held - BASE) / PGSIZE)) < 0)
+		panic("sys_page_unmap_range: %e", r);
+	held = BASE;
+}
+
+// Fork a child that pages out nearly everything it has, checks that
+// it still sees 'before' everywhere, then writes its own tag and checks
+// that too
+static envid_t
+fork_child(uint32_t before, uint32_t tag)
+{
+	envid_t envid;
+
+	if ((envid = fork()) < 0)
+		panic("fork: %e", envid);
+	if (envid == 0) {
+		give_back();
+		squeeze();
+		check(before, "child");
+		fill(tag);
+		check(tag, "child");
+		exit();
+	}
+	return envid;
+}
+
+void
+umain(int argc, char **argv)
+{
+	int r;
+	envid_t envid;
+
+	if ((r = page_alloc_range(0, (void*) BACKED, NPAGES, PTE_P|PTE_U|PTE_W, 1)) < 0)
+		panic("page_alloc_range: %e", r);
+	if ((r = page_add_backed((void*) BACKED, NPAGES*PGSIZE)) < 0)
+		panic("page_add_backed: %e", r);
+
+	// The kernel's fork: our pages and the child's are separate copies
+	fill(0x1000);
+	envid = fork_child(0x1000, 0x2000);
+	check(0x1000, "parent");
+	fill(0x3000);
+	wait(envid);
+	check(0x3000, "parent");
+	cprintf("forkfallback: sys_fork is good\n");
+
+	// Use up free memory, straight from the kernel so nothing gets
+	// paged out, until sys_fork has to refuse
+	fill(0x4000);
+	for (held = BASE; held < TOP; held += PGSIZE) {
+		if ((r = sys_page_alloc(0, (void*) held, PTE_P|PTE_U|PTE_W)) < 0) {
+			if (r != -E_NO_MEM)
+				panic("sys_page_alloc on %p: %e", held, r);
+			break;
+		}
+	}
+	if ((r = sys_fork()) != -E_NO_MEM)
+		panic("sys_fork with no memory returned %d", r);
+	envid = fork_child(0x4000, 0x5000);
+	give_back();
+
+	// ufork left our pages copy-on-write: paging them out must not
+	// take them for clean pages and drop them
+	squeeze();
+	check(0x4000, "parent");
+	fill(0x6000);
+	check(0x6000, "parent");
+	wait(envid);
+	cprintf("forkfallback: Passed all checks!\n");
+	get_and_print_paging_stats();
+}
@@ -0,0 +1,69 @@
+// Program that asks for large (4MB) pages while there's memory for
+// them, then allocates ordinary pages past the amount of physical
+// memory that exists on the system, so the large pages get split and
+// paged out too.  Every page holds its own address, which is checked
+// after a split, in a forked child, and once everything is allocated.
+
+#include <inc/lib.h>
+
+#define SIZE 0x8000000
+#define BASE 0x10000000
+
+void
+umain(int argc, char **argv)
+{
+	int r;
+	uintptr_t va, top;
+	envid_t envid;
+
+	// Large pages are private, and 4MB-aligned
+	assert(sys_page_alloc(0, (void*) BASE, PTE_P|PTE_U|PTE_W|PTE_PS|PTE_SHARE) == -E_INVAL);
+	assert(sys_page_alloc(0, (void*) (BASE + PGSIZE), PTE_P|PTE_U|PTE_W|PTE_PS) == -E_INVAL);
+
+	for (top = BASE; top < BASE+SIZE; top += PTSIZE) {
+		if ((r = sys_page_alloc(0, (void*) top, PTE_P|PTE_U|PTE_W|PTE_PS)) < 0) {
+			if (r != -E_NO_MEM)
+				panic("sys_page_alloc on %p: %e", top, r);
+			break;
+		}
+		assert((uvpd[PDX(top)] & (PTE_P|PTE_PS)) == (PTE_P|PTE_PS));
+	}
+	if (top == BASE)
+		panic("no memory for a single large page");
+	// There's a large page there already
+	assert(sys_page_alloc(0, (void*) BASE, PTE_P|PTE_U|PTE_W|PTE_PS) == -E_INVAL);
+
+	for (va = BASE; va < top; va += PGSIZE)
+		*(uintptr_t*)va = va;
+
+	// Splitting leaves the contents alone
+	if ((r = sys_page_split(0, (void*) BASE)) < 0)
+		panic("sys_page_split: %e", r);
+	assert(!(uvpd[PDX(BASE)] & PTE_PS));
+	for (va = BASE; va < BASE + PTSIZE; va += PGSIZE) {
+		assert(uvpt[PGNUM(va)] & PTE_P);
+		assert(*(uintptr_t*)va == va);
+	}
+
+	if ((envid = fork()) < 0)
+		panic("fork: %e", envid);
+	if (envid == 0) {
+		for (va = BASE; va < top; va += PGSIZE)
+			assert(*(uintptr_t*)va == va);
+		return;
+	}
+	wait(envid);
+
+	for (va = top; va < BASE+SIZE; va += PGSIZE) {
+		if ((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+			panic("page_alloc on %p: %e", va, r);
+		*(uintptr_t*)va = va;
+	}
+
+	for (va = BASE; va < BASE+SIZE; va += PGSIZE)
+		assert(*(uintptr_t*)va == va);
+
+	cprintf("%s: %d large pages, passed all checks!\n",
+		argc > 0 ? argv[0] : "largepage", (top - BASE) / PTSIZE);
+	get_and_print_paging_stats();
+}
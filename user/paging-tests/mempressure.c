@@ -0,0 +1,55 @@
+// Program that uses up free memory until the kernel reports memory
+// pressure.  A forked child sleeps in mem_pressure_wait meanwhile, and
+// must be woken when the level goes up.
+
+#include <inc/lib.h>
+
+#define BASE 0x10000000
+#define TOP  0xD0000000
+
+void
+umain(int argc, char **argv)
+{
+	int r;
+	uint32_t level;
+	uintptr_t va;
+	envid_t envid;
+
+	assert(meminfo.mi_npages > 0);
+	if (meminfo.mi_level != MEM_PRESSURE_NONE)
+		panic("memory pressure already at level %d", meminfo.mi_level);
+
+	if ((envid = fork()) < 0)
+		panic("fork: %e", envid);
+	if (envid == 0) {
+		level = mem_pressure_wait(MEM_PRESSURE_NONE);
+		assert(level != MEM_PRESSURE_NONE);
+		cprintf("mempressure: child woken at level %d, %d pages free\n",
+			level, meminfo.mi_free_pages);
+		return;
+	}
+
+	// Allocate straight from the kernel, so nothing gets paged out,
+	// until the level goes up on a clock tick
+	for (va = BASE; va < TOP && meminfo.mi_level == MEM_PRESSURE_NONE; va += PGSIZE) {
+		if ((r = sys_page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W)) < 0) {
+			if (r != -E_NO_MEM)
+				panic("sys_page_alloc on %p: %e", va, r);
+			// Out of memory: the next tick must notice
+			while (meminfo.mi_level == MEM_PRESSURE_NONE)
+				sys_yield();
+			break;
+		}
+	}
+	assert(meminfo.mi_level != MEM_PRESSURE_NONE);
+	assert(meminfo.mi_free_pages < MEM_PRESSURE_LOW_PAGES);
+	cprintf("mempressure: level %d after allocating %d pages\n",
+		meminfo.mi_level, (va - BASE) / PGSIZE);
+
+	wait(envid);
+	if ((r = sys_page_unmap_range(0, (void*) BASE, (va - BASE) / PGSIZE)) < 0)
+		panic("sys_page_unmap_range: %e", r);
+	while ((level = meminfo.mi_level) != MEM_PRESSURE_NONE)
+		mem_pressure_wait(level);
+	cprintf("mempressure: Passed all checks!\n");
+}
@@ -0,0 +1,78 @@
+// Program that exercises the range system calls: it allocates, remaps
+// and unmaps runs of pages that cross page table boundaries, then uses
+// page_alloc_range to allocate more memory than the amount of physical
+// memory that exists on the system (causing paging out) and checks the
+// pages it allocated first (causing paging in).
+
+#include <inc/lib.h>
+
+#define NPAGES (NPTENTRIES + 32)
+#define RANGE  (0x10000000 + PTSIZE - 16*PGSIZE)
+#define ALIAS  (0x30000000 + 5*PGSIZE)
+#define SIZE   0x8000000
+#define BASE   0x40000000
+
+void
+umain(int argc, char **argv)
+{
+	int r, perm = PTE_P|PTE_U|PTE_W;
+	uintptr_t va;
+
+	// Empty ranges and ranges reaching UTOP are refused
+	assert(sys_page_alloc_range(0, (void*) RANGE, 0, perm) == -E_INVAL);
+	assert(sys_page_alloc_range(0, (void*) (UTOP - PGSIZE), 2, perm) == -E_INVAL);
+	assert(sys_page_unmap_range(0, (void*) (RANGE + 1), 1) == -E_INVAL);
+
+	if ((r = page_alloc_range(0, (void*) RANGE, NPAGES, perm, 1)) < 0)
+		panic("page_alloc_range: %e", r);
+	for (va = RANGE; va < RANGE + NPAGES*PGSIZE; va += PGSIZE) {
+		assert(uvpt[PGNUM(va)] & PTE_P);
+		assert(*(uintptr_t*)va == 0);
+		*(uintptr_t*)va = va;
+	}
+
+	// A source range with a hole in it maps nothing
+	if ((r = sys_page_unmap(0, (void*) (RANGE + (NPAGES-1)*PGSIZE))) < 0)
+		panic("sys_page_unmap: %e", r);
+	assert(sys_page_map_range(0, (void*) RANGE, 0, (void*) ALIAS, NPAGES, perm) == -E_INVAL);
+	for (va = ALIAS; va < ALIAS + NPAGES*PGSIZE; va += PGSIZE)
+		assert(!(uvpd[PDX(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_P));
+
+	// Both mappings see the same pages
+	if ((r = sys_page_map_range(0, (void*) RANGE, 0, (void*) ALIAS, NPAGES-1, perm)) < 0)
+		panic("sys_page_map_range: %e", r);
+	for (va = 0; va < (NPAGES-1)*PGSIZE; va += PGSIZE) {
+		assert(*(uintptr_t*)(ALIAS + va) == RANGE + va);
+		*(uintptr_t*)(ALIAS + va) = ALIAS + va;
+		assert(*(uintptr_t*)(RANGE + va) == ALIAS + va);
+	}
+
+	// Make the range read-only in place: it stays dirty, and can't be
+	// mapped writable any more
+	if ((r = sys_page_map_range(0, (void*) RANGE, 0, (void*) RANGE, NPAGES-1, PTE_P|PTE_U)) < 0)
+		panic("sys_page_map_range: %e", r);
+	for (va = RANGE; va < RANGE + (NPAGES-1)*PGSIZE; va += PGSIZE)
+		assert((uvpt[PGNUM(va)] & (PTE_P|PTE_W|PTE_D)) == (PTE_P|PTE_D));
+	assert(sys_page_map_range(0, (void*) RANGE, 0, (void*) ALIAS, NPAGES-1, perm) == -E_INVAL);
+
+	// Unmapping skips what isn't mapped, including whole page tables
+	if ((r = sys_page_unmap_range(0, (void*) ALIAS, NPAGES + 2*NPTENTRIES)) < 0)
+		panic("sys_page_unmap_range: %e", r);
+	for (va = ALIAS; va < ALIAS + NPAGES*PGSIZE; va += PGSIZE)
+		assert(!(uvpt[PGNUM(va)] & PTE_P));
+	for (va = RANGE; va < RANGE + (NPAGES-1)*PGSIZE; va += PGSIZE)
+		assert(*(uintptr_t*)va == va - RANGE + ALIAS);
+	if ((r = sys_page_unmap_range(0, (void*) RANGE, NPAGES)) < 0)
+		panic("sys_page_unmap_range: %e", r);
+
+	// Now run out of memory
+	if ((r = page_alloc_range(0, (void*) BASE, SIZE/PGSIZE, perm, 1)) < 0)
+		panic("page_alloc_range: %e", r);
+	for (va = BASE; va < BASE+SIZE; va += PGSIZE)
+		*(uintptr_t*)va = va;
+	for (va = BASE; va < BASE+(SIZE/2); va += PGSIZE)
+		assert(*(uintptr_t*)va == va);
+
+	cprintf("%s: Passed all checks!\n", argc > 0 ? argv[0] : "rangemap");
+	get_and_print_paging_stats();
+}
@@ -0,0 +1,49 @@
+// Program that limits its own resident set, then allocates several
+// times that much memory, which it has to page out to stay under the
+// limit even though there is plenty of free memory.  A forked child
+// inherits the limit, and may not raise it.
+
+#include <inc/lib.h>
+
+#define NPAGES 512
+#define BASE 0x10000000
+
+void
+umain(int argc, char **argv)
+{
+	int r, limit;
+	uintptr_t va;
+	envid_t envid;
+
+	limit = thisenv->env_npages + 64;
+	if ((r = sys_env_set_rss(0, 0, limit)) < 0)
+		panic("sys_env_set_rss: %e", r);
+
+	for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE) {
+		if ((r = page_alloc(0, (void*) va, PTE_P|PTE_U|PTE_W, 1)) < 0)
+			panic("page_alloc on %p: %e", va, r);
+		// Store the address in the page
+		*(uintptr_t*)va = va;
+		assert(thisenv->env_npages <= limit);
+	}
+
+	if ((envid = fork()) < 0)
+		panic("fork: %e", envid);
+	if (envid == 0) {
+		assert(thisenv->env_rss_max == limit);
+		assert(sys_env_set_rss(0, 0, limit + 1) == -E_INVAL);
+		assert(sys_env_set_rss(0, 0, 0) == -E_INVAL);
+		for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE)
+			assert(*(uintptr_t*)va == va);
+		cprintf("rsslimit: child passed all checks!\n");
+		return;
+	}
+
+	for (va = BASE; va < BASE + NPAGES*PGSIZE; va += PGSIZE) {
+		assert(*(uintptr_t*)va == va);
+		assert(thisenv->env_npages <= limit);
+	}
+	wait(envid);
+	cprintf("rsslimit: Passed all checks!\n");
+	get_and_print_paging_stats();
+}
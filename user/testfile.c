@@ -102,7 +102,7 @@ umain(int argc, char **argv)
 	if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
 		panic("creat /big: %e", f);
 	memset(buf, 0, sizeof(buf));
-	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+	for (i = 0; i < (NEXTENT*3)*BLKSIZE; i += sizeof(buf)) {
 		*(int*)buf = i;
 		if ((r = write(f, buf, sizeof(buf))) < 0)
 			panic("write /big@%d: %e", i, r);
@@ -111,7 +111,7 @@ umain(int argc, char **argv)
 
 	if ((f = open("/big", O_RDONLY)) < 0)
 		panic("open /big: %e", f);
-	for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+	for (i = 0; i < (NEXTENT*3)*BLKSIZE; i += sizeof(buf)) {
 		*(int*)buf = i;
 		if ((r = readn(f, buf, sizeof(buf))) < 0)
 			panic("read /big@%d: %e", i, r);
@@ -124,5 +124,50 @@ umain(int argc, char **argv)
 	}
 	close(f);
 	cprintf("large file is good\n");
+
+	// Try a file with more extents than fit in its struct File: every
+	// other block is left a hole, so each block written is an extent
+	// of its own, and so is each hole.
+	if ((f = open("/holes", O_RDWR|O_CREAT)) < 0)
+		panic("creat /holes: %e", f);
+	for (i = 0; i < NEXTENT*3; i++) {
+		seek(f, 2*i*BLKSIZE);
+		*(int*)buf = i;
+		if ((r = write(f, buf, sizeof(buf))) < 0)
+			panic("write /holes@%d: %e", 2*i*BLKSIZE, r);
+	}
+	close(f);
+
+	if ((f = open("/holes", O_RDWR)) < 0)
+		panic("open /holes: %e", f);
+	for (i = 0; i < NEXTENT*3*2 - 1; i++) {
+		seek(f, i*BLKSIZE);
+		if ((r = readn(f, buf, sizeof(buf))) != sizeof(buf))
+			panic("read /holes@%d returned %d: %e", i*BLKSIZE, r, r);
+		if (*(int*)buf != (i % 2 ? 0 : i / 2))
+			panic("read /holes@%d returned bad data %d",
+			      i*BLKSIZE, *(int*)buf);
+	}
+
+	// Cut it back to fit in the struct File again
+	if ((r = ftruncate(f, 3*BLKSIZE)) < 0)
+		panic("ftruncate /holes: %e", r);
+	close(f);
+	if ((f = open("/holes", O_RDONLY)) < 0)
+		panic("open /holes: %e", f);
+	if ((r = fstat(f, &st)) < 0)
+		panic("fstat /holes: %e", r);
+	if (st.st_size != 3*BLKSIZE)
+		panic("ftruncate /holes left size %d", st.st_size);
+	for (i = 0; i < 3; i++) {
+		if ((r = readn(f, buf, sizeof(buf))) != sizeof(buf))
+			panic("read /holes@%d returned %d: %e", i*BLKSIZE, r, r);
+		if (*(int*)buf != (i % 2 ? 0 : i / 2))
+			panic("read /holes@%d returned bad data %d",
+			      i*BLKSIZE, *(int*)buf);
+		seek(f, (i + 1)*BLKSIZE);
+	}
+	close(f);
+	cprintf("fragmented file is good\n");
 }
 
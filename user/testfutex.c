@@ -0,0 +1,117 @@
+#include <inc/lib.h>
+
+#define VA	((uint32_t *) 0xA0000000)
+
+char buf[2*PGSIZE];
+
+// Wait until our parent is asleep
+static void
+wait_parent_asleep(void)
+{
+	while (envs[ENVX(thisenv->env_parent_id)].env_status != ENV_NOT_RUNNABLE)
+		sys_yield();
+}
+
+void
+umain(int argc, char **argv)
+{
+	int i, r, pid, p[2];
+
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+		panic("sys_page_alloc: %e", r);
+
+	// Bad addresses
+	assert(sys_futex_wait((uint32_t *) ((char *) VA + 1), 0, -1) == -E_INVAL);
+	assert(sys_futex_wait(VA + PGSIZE/sizeof(uint32_t), 0, -1) == -E_INVAL);
+	assert(sys_futex_wait((uint32_t *) &uvpt[PGNUM(VA)], uvpt[PGNUM(VA)], -1) == -E_INVAL);
+	assert(sys_futex_wake((uint32_t *) &uvpt[PGNUM(VA)], 1) == -E_INVAL);
+	assert(sys_futex_wake(VA, 1) == 0);
+
+	// The word or the page's references have changed: don't sleep
+	*VA = 5;
+	assert(sys_futex_wait(VA, 4, -1) == 0);
+	assert(sys_futex_wait(VA, 5, pageref(VA) + 1) == 0);
+	cprintf("futex mismatch is good\n");
+
+	// Wait and wake across fork
+	*VA = 0;
+	if ((pid = fork()) < 0)
+		panic("fork: %e", pid);
+	if (pid == 0) {
+		wait_parent_asleep();
+		*VA = 1;
+		if ((r = sys_futex_wake(VA, NENV)) != 1)
+			panic("sys_futex_wake woke %d", r);
+		exit();
+	}
+	while (*VA == 0)
+		if ((r = sys_futex_wait(VA, 0, -1)) < 0)
+			panic("sys_futex_wait: %e", r);
+	wait(pid);
+	cprintf("futex wait and wake are good\n");
+
+	// A reader asleep on an empty pipe sees the writer close it
+	if ((r = pipe(p)) < 0)
+		panic("pipe: %e", r);
+	if ((pid = fork()) < 0)
+		panic("fork: %e", pid);
+	if (pid == 0) {
+		close(p[0]);
+		wait_parent_asleep();
+		close(p[1]);
+		exit();
+	}
+	close(p[1]);
+	if ((r = read(p[0], buf, 1)) != 0)
+		panic("read from closed pipe returned %d", r);
+	close(p[0]);
+	wait(pid);
+	cprintf("pipe reader wakes at eof\n");
+
+	// A writer asleep on a full pipe sees the reader close it
+	if ((r = pipe(p)) < 0)
+		panic("pipe: %e", r);
+	if ((pid = fork()) < 0)
+		panic("fork: %e", pid);
+	if (pid == 0) {
+		close(p[1]);
+		wait_parent_asleep();
+		close(p[0]);
+		exit();
+	}
+	close(p[0]);
+	memset(buf, 'x', sizeof buf);
+	if ((r = write(p[1], buf, sizeof buf)) >= (int) sizeof buf)
+		panic("write to closed pipe returned %d", r);
+	close(p[1]);
+	wait(pid);
+	cprintf("pipe writer wakes at eof\n");
+
+	// More than a pipe's worth in one write, taken in bulk
+	if ((r = pipe(p)) < 0)
+		panic("pipe: %e", r);
+	if ((pid = fork()) < 0)
+		panic("fork: %e", pid);
+	if (pid == 0) {
+		close(p[0]);
+		for (i = 0; i < sizeof buf; i++)
+			buf[i] = i;
+		if ((r = write(p[1], buf, sizeof buf)) != sizeof buf)
+			panic("write: %e", r);
+		exit();
+	}
+	close(p[1]);
+	memset(buf, 0, sizeof buf);
+	if ((r = readn(p[0], buf, sizeof buf)) != sizeof buf)
+		panic("readn returned %d", r);
+	for (i = 0; i < sizeof buf; i++)
+		if (buf[i] != (char) i)
+			panic("pipe data wrong at %d", i);
+	if ((r = read(p[0], buf, 1)) != 0)
+		panic("read past eof returned %d", r);
+	close(p[0]);
+	wait(pid);
+	cprintf("pipe bulk copy is good\n");
+
+	cprintf("futex tests passed\n");
+}